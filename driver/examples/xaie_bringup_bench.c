@@ -0,0 +1,505 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_bringup_bench.c
+* @{
+*
+* This file contains the benchmark of the bring-up of a graph on a partition.
+* It scales the scenario of xaie_tile_dma_loopback.c to every AIE tile of the
+* partition, and times each phase of the bring-up:
+*  * part_init: XAie_PartitionInitialize()
+*  * clear_mems: XAie_ClearPartitionMems()
+*  * elf_load: parse of the elf given with -e, and load to every AIE tile
+*  * routing: circuit switched stream from each AIE tile to its north
+*    neighbour, in every column
+*  * dma_bd: one MM2S and one S2MM BD per AIE tile, written as one batch,
+*    pushed to the channel queues and enabled
+*  * lock_init: initial value of the two locks of every AIE tile, skipped on
+*    AIE whose locks have no value
+*  * core_enable: enable of every AIE tile core
+*
+* Every phase is printed as one JSON object per line, with its time and the
+* number of register operations it issued. The operations are counted with the
+* IO statistics when the driver is built with XAIE_FEATURE_IO_STATS_ENABLE,
+* with the IO record ring on the debug backend otherwise, and reported as -1
+* if neither is available. Messages of the driver and backends go to stdout,
+* use -o to keep the results apart.
+*
+* Usage: xaie_bringup_bench [-g aie|aieml] [-c columns] [-r rows] [-e elf]
+*		[-n runs] [-o file]
+*
+* columns and rows select the size of the partition, rows counts the AIE tile
+* rows used and defaults to all of them. Without an elf, the elf_load phase is
+* skipped and the cores are enabled with whatever their program memory holds.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <xaiengine.h>
+
+/************************** Constant Definitions *****************************/
+/* AIE Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_COL_SHIFT		23
+#define XAIE_ROW_SHIFT		18
+#define XAIE_NUM_COLS		50
+#define XAIE_SHIM_ROW		0
+
+#define XAIE_AIE_NUM_ROWS		9
+#define XAIE_AIE_RES_TILE_ROW_START	0
+#define XAIE_AIE_RES_TILE_NUM_ROWS	0
+#define XAIE_AIE_AIE_TILE_ROW_START	1
+#define XAIE_AIE_AIE_TILE_NUM_ROWS	8
+
+#define XAIE_AIEML_COL_SHIFT		25
+#define XAIE_AIEML_ROW_SHIFT		20
+#define XAIE_AIEML_NUM_ROWS		11
+#define XAIE_AIEML_MEM_TILE_ROW_START	1
+#define XAIE_AIEML_MEM_TILE_NUM_ROWS	2
+#define XAIE_AIEML_AIE_TILE_ROW_START	3
+#define XAIE_AIEML_AIE_TILE_NUM_ROWS	8
+
+/* Benchmark parameters */
+#define BENCH_DEF_COLS		4U
+#define BENCH_RECORD_ENTRIES	4096U
+#define BENCH_NS_PER_SEC	1000000000ULL
+
+/* Buffers and BDs of the loopback of each tile */
+#define BENCH_INPUT_ADDR	0x4000U
+#define BENCH_OUTPUT_ADDR	0x3000U
+#define BENCH_BUF_SIZE		(32U * sizeof(u32))
+#define BENCH_MM2S_BD		1U
+#define BENCH_S2MM_BD		9U
+#define BENCH_LOCK_MM2S		5U
+#define BENCH_LOCK_S2MM		6U
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	XAie_DevInst *DevInst;
+	XAie_IORecordRing *Ring;
+	u8 UseStats;
+	FILE *Out;
+	const char *Elf;
+	XAie_LocType *Tiles;	/* AIE tiles used, column by column */
+	u32 NumTiles;
+	u8 NumCols;
+	u8 NumRows;
+	u8 DevGen;
+	u32 Run;
+} Bench;
+
+/************************** Variable Definitions *****************************/
+static XAie_IOStats BenchStats;
+
+/************************** Function Definitions *****************************/
+static u64 BenchNow(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * BENCH_NS_PER_SEC + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of register operations issued so far.
+*
+* @param	B: Benchmark context.
+*
+* @return	Number of operations, -1 if they are not counted.
+*
+* @note		None.
+*
+*******************************************************************************/
+static long long BenchRegOps(Bench *B)
+{
+	long long Ops = 0;
+
+	if((B->UseStats != 0U) &&
+			(XAie_IOStatsGet(B->DevInst, &BenchStats) == XAIE_OK)) {
+		for(u32 i = 0U; i < XAIE_IO_STATS_MAX_OPS; i++) {
+			Ops += (long long)BenchStats.Op[i].Count;
+		}
+		return Ops;
+	}
+
+	if(B->Ring != NULL) {
+		return (long long)B->Ring->NumWritten;
+	}
+
+	return -1;
+}
+
+static void BenchReport(Bench *B, const char *Phase, const char *Status,
+		u64 Ns, long long Ops)
+{
+	fprintf(B->Out, "{\"run\": %u, \"phase\": \"%s\", \"cols\": %u, "
+			"\"rows\": %u, \"tiles\": %u, \"status\": \"%s\", "
+			"\"ns\": %llu, \"reg_ops\": %lld}\n", B->Run, Phase,
+			B->NumCols, B->NumRows, B->NumTiles, Status,
+			(unsigned long long)Ns, Ops);
+	fflush(B->Out);
+}
+
+static AieRC BenchPartInit(Bench *B)
+{
+	return XAie_PartitionInitialize(B->DevInst, NULL);
+}
+
+static AieRC BenchClearMems(Bench *B)
+{
+	return XAie_ClearPartitionMems(B->DevInst);
+}
+
+static AieRC BenchElfLoad(Bench *B)
+{
+	XAie_ElfImage Image;
+	AieRC RC;
+
+	RC = XAie_ElfImageCreate(B->DevInst, &Image, B->Elf);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_LoadElfImage(B->DevInst, &Image, B->Tiles, B->NumTiles);
+	XAie_ElfImageFree(&Image);
+
+	return RC;
+}
+
+static AieRC BenchRouting(Bench *B)
+{
+	AieRC RC = XAIE_OK;
+
+	for(u32 i = 0U; i + 1U < B->NumTiles; i++) {
+		XAie_LocType Src = B->Tiles[i], Dst = B->Tiles[i + 1U];
+
+		if(Src.Col != Dst.Col) {
+			continue;
+		}
+
+		RC |= XAie_StrmConnCctEnable(B->DevInst, Src, DMA, 0U, NORTH,
+				0U);
+		RC |= XAie_StrmConnCctEnable(B->DevInst, Dst, SOUTH, 0U, DMA,
+				0U);
+	}
+
+	return RC;
+}
+
+static AieRC BenchDmaBd(Bench *B)
+{
+	XAie_DmaBdWrite *Bds;
+	XAie_DmaDesc *Descs;
+	AieRC RC = XAIE_OK;
+
+	Descs = (XAie_DmaDesc *)calloc(B->NumTiles * 2U, sizeof(*Descs));
+	Bds = (XAie_DmaBdWrite *)calloc(B->NumTiles * 2U, sizeof(*Bds));
+	if((Descs == NULL) || (Bds == NULL)) {
+		free(Descs);
+		free(Bds);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < B->NumTiles; i++) {
+		XAie_DmaDesc *MM2S = &Descs[2U * i];
+		XAie_DmaDesc *S2MM = &Descs[2U * i + 1U];
+
+		RC |= XAie_DmaDescInit(B->DevInst, MM2S, B->Tiles[i]);
+		RC |= XAie_DmaDescInit(B->DevInst, S2MM, B->Tiles[i]);
+		RC |= XAie_DmaSetAddrLen(MM2S, BENCH_INPUT_ADDR,
+				BENCH_BUF_SIZE);
+		RC |= XAie_DmaSetAddrLen(S2MM, BENCH_OUTPUT_ADDR,
+				BENCH_BUF_SIZE);
+		RC |= XAie_DmaEnableBd(MM2S);
+		RC |= XAie_DmaEnableBd(S2MM);
+
+		Bds[2U * i].DmaDesc = MM2S;
+		Bds[2U * i].Loc = B->Tiles[i];
+		Bds[2U * i].BdNum = BENCH_MM2S_BD;
+		Bds[2U * i + 1U].DmaDesc = S2MM;
+		Bds[2U * i + 1U].Loc = B->Tiles[i];
+		Bds[2U * i + 1U].BdNum = BENCH_S2MM_BD;
+	}
+
+	if(RC == XAIE_OK) {
+		RC = XAie_DmaWriteBds(B->DevInst, Bds, B->NumTiles * 2U);
+	}
+
+	for(u32 i = 0U; (i < B->NumTiles) && (RC == XAIE_OK); i++) {
+		RC |= XAie_DmaChannelPushBdToQueue(B->DevInst, B->Tiles[i], 0U,
+				DMA_MM2S, BENCH_MM2S_BD);
+		RC |= XAie_DmaChannelPushBdToQueue(B->DevInst, B->Tiles[i], 0U,
+				DMA_S2MM, BENCH_S2MM_BD);
+		RC |= XAie_DmaChannelEnable(B->DevInst, B->Tiles[i], 0U,
+				DMA_MM2S);
+		RC |= XAie_DmaChannelEnable(B->DevInst, B->Tiles[i], 0U,
+				DMA_S2MM);
+	}
+
+	free(Descs);
+	free(Bds);
+
+	return RC;
+}
+
+static AieRC BenchLockInit(Bench *B)
+{
+	XAie_LockReq *Reqs;
+	AieRC RC;
+
+	Reqs = (XAie_LockReq *)calloc(B->NumTiles * 2U, sizeof(*Reqs));
+	if(Reqs == NULL) {
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < B->NumTiles; i++) {
+		Reqs[2U * i].Loc = B->Tiles[i];
+		Reqs[2U * i].Lock = XAie_LockInit(BENCH_LOCK_MM2S, 1);
+		Reqs[2U * i + 1U].Loc = B->Tiles[i];
+		Reqs[2U * i + 1U].Lock = XAie_LockInit(BENCH_LOCK_S2MM, 0);
+	}
+
+	RC = XAie_LockSetValueMulti(B->DevInst, Reqs, B->NumTiles * 2U);
+	free(Reqs);
+
+	return RC;
+}
+
+static AieRC BenchCoreEnable(Bench *B)
+{
+	return XAie_CoreEnableMulti(B->DevInst, B->Tiles, B->NumTiles);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs and reports the phases of one bring-up.
+*
+* @param	B: Benchmark context.
+*
+* @return	0 if all phases succeeded, -1 otherwise.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int BenchRun(Bench *B)
+{
+	static const struct {
+		const char *Name;
+		AieRC (*Run)(Bench *B);
+	} Phases[] = {
+		{"part_init", BenchPartInit},
+		{"clear_mems", BenchClearMems},
+		{"elf_load", BenchElfLoad},
+		{"routing", BenchRouting},
+		{"dma_bd", BenchDmaBd},
+		{"lock_init", BenchLockInit},
+		{"core_enable", BenchCoreEnable},
+	};
+	int Ret = 0;
+
+	for(u32 i = 0U; i < sizeof(Phases) / sizeof(Phases[0]); i++) {
+		long long Ops;
+		u64 Start, End;
+		AieRC RC;
+
+		/* AIE locks have no value to set, they are reset released */
+		if(((Phases[i].Run == BenchElfLoad) && (B->Elf == NULL)) ||
+				((Phases[i].Run == BenchLockInit) &&
+				 (B->DevGen == XAIE_DEV_GEN_AIE))) {
+			BenchReport(B, Phases[i].Name, "skipped", 0U, 0);
+			continue;
+		}
+
+		Ops = BenchRegOps(B);
+		Start = BenchNow();
+		RC = Phases[i].Run(B);
+		End = BenchNow();
+		if(Ops >= 0) {
+			Ops = BenchRegOps(B) - Ops;
+		}
+
+		BenchReport(B, Phases[i].Name, (RC == XAIE_OK) ? "ok" : "error",
+				End - Start, Ops);
+		if(RC != XAIE_OK) {
+			Ret = -1;
+		}
+	}
+
+	return Ret;
+}
+
+static void BenchUsage(const char *Prog)
+{
+	fprintf(stderr, "Usage: %s [-g aie|aieml] [-c columns] [-r rows] "
+			"[-e elf] [-n runs] [-o file]\n", Prog);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the AIE driver bring-up benchmark.
+*
+* @param	argc: Number of arguments.
+* @param	argv: Arguments, see the usage above.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+	XAie_IORecord *Records = NULL;
+	XAie_IORecordRing Ring;
+	XAie_Config *ConfigPtr;
+	u32 NumRuns = 1U;
+	int Opt, Ret = 0;
+	Bench B;
+	AieRC RC;
+
+	memset(&B, 0, sizeof(B));
+	B.Out = stdout;
+	B.DevGen = XAIE_DEV_GEN_AIEML;
+	B.NumCols = BENCH_DEF_COLS;
+
+	while((Opt = getopt(argc, argv, "g:c:r:e:n:o:")) != -1) {
+		switch(Opt) {
+		case 'g':
+			if(strcmp(optarg, "aie") == 0) {
+				B.DevGen = XAIE_DEV_GEN_AIE;
+			} else if(strcmp(optarg, "aieml") == 0) {
+				B.DevGen = XAIE_DEV_GEN_AIEML;
+			} else {
+				BenchUsage(argv[0]);
+				return -1;
+			}
+			break;
+		case 'c':
+			B.NumCols = (u8)strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			B.NumRows = (u8)strtoul(optarg, NULL, 0);
+			break;
+		case 'e':
+			B.Elf = optarg;
+			break;
+		case 'n':
+			NumRuns = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'o':
+			B.Out = fopen(optarg, "w");
+			if(B.Out == NULL) {
+				perror("Failed to open the output file");
+				return -1;
+			}
+			break;
+		default:
+			BenchUsage(argv[0]);
+			return -1;
+		}
+	}
+
+	XAie_SetupConfig(AieConfig, XAIE_DEV_GEN_AIE, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_AIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_AIE_RES_TILE_ROW_START, XAIE_AIE_RES_TILE_NUM_ROWS,
+			XAIE_AIE_AIE_TILE_ROW_START, XAIE_AIE_AIE_TILE_NUM_ROWS);
+	XAie_SetupConfig(AieMlConfig, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_AIEML_COL_SHIFT, XAIE_AIEML_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_AIEML_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_AIEML_MEM_TILE_ROW_START,
+			XAIE_AIEML_MEM_TILE_NUM_ROWS,
+			XAIE_AIEML_AIE_TILE_ROW_START,
+			XAIE_AIEML_AIE_TILE_NUM_ROWS);
+	ConfigPtr = (B.DevGen == XAIE_DEV_GEN_AIE) ? &AieConfig : &AieMlConfig;
+
+	if(B.NumRows == 0U) {
+		B.NumRows = ConfigPtr->AieTileNumRows;
+	}
+	if((B.NumCols == 0U) || (B.NumCols > ConfigPtr->NumCols) ||
+			(B.NumRows > ConfigPtr->AieTileNumRows) ||
+			(NumRuns == 0U)) {
+		BenchUsage(argv[0]);
+		return -1;
+	}
+
+	XAie_InstDeclare(DevInst, ConfigPtr);
+
+	XAie_SetupPartitionConfig(&DevInst, XAIE_BASE_ADDR, 0U, B.NumCols);
+	RC = XAie_CfgInitialize(&DevInst, ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	B.DevInst = &DevInst;
+	B.NumTiles = (u32)B.NumCols * B.NumRows;
+	B.Tiles = (XAie_LocType *)calloc(B.NumTiles, sizeof(*B.Tiles));
+	if(B.Tiles == NULL) {
+		XAie_Finish(&DevInst);
+		return -1;
+	}
+
+	for(u8 c = 0U; c < B.NumCols; c++) {
+		for(u8 r = 0U; r < B.NumRows; r++) {
+			B.Tiles[c * B.NumRows + r] = XAie_TileLoc(c,
+					ConfigPtr->AieTileRowStart + r);
+		}
+	}
+
+	/*
+	 * Count the register operations with the IO statistics if the driver
+	 * has them, or with a record ring on the debug backend, which also
+	 * keeps it from printing every access.
+	 */
+	if(XAie_ConfigIOStats(&DevInst, XAIE_ENABLE) == XAIE_OK) {
+		B.UseStats = 1U;
+	} else {
+		Records = (XAie_IORecord *)calloc(BENCH_RECORD_ENTRIES,
+				sizeof(*Records));
+		if(Records != NULL) {
+			Ring.Records = Records;
+			Ring.NumRecords = BENCH_RECORD_ENTRIES;
+			Ring.NumWritten = 0U;
+			if(XAie_ConfigIORecord(&DevInst, &Ring) == XAIE_OK) {
+				B.Ring = &Ring;
+			} else {
+				free(Records);
+				Records = NULL;
+			}
+		}
+	}
+
+	for(B.Run = 0U; B.Run < NumRuns; B.Run++) {
+		if(BenchRun(&B) != 0) {
+			Ret = -1;
+		}
+	}
+
+	if(Records != NULL) {
+		XAie_ConfigIORecord(&DevInst, NULL);
+		free(Records);
+	}
+	free(B.Tiles);
+	XAie_Finish(&DevInst);
+	if(B.Out != stdout) {
+		fclose(B.Out);
+	}
+
+	return Ret;
+}
+
+/** @} */
@@ -0,0 +1,1080 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_bench.c
+* @{
+*
+* This file contains the throughput benchmark of the DMAs. It generalizes the
+* transfer of xaie_tile_dma_loopback.c, from the DMA of one tile to the DMA of
+* another through a circuit switched stream, and sweeps:
+*  * path: tile_tile from an AIE tile to its north neighbour, memtile_tile
+*    from a memory tile to the first AIE tile of its column, and
+*    shim_memtile_tile from host memory through the shim DMA to a memory tile,
+*    double buffered there with locks, and on to the first AIE tile
+*  * bytes: size transferred by each lane, from 1KB to 16KB
+*  * bds: number of BDs the transfer is split into, chained on each channel
+*  * pattern: linear, or transpose where the MM2S channel reading from the AIE
+*    tile or memory tile reads each chunk as a matrix of 32 word rows, column
+*    by column (AIEML only)
+*  * lanes: number of transfers run in parallel, on channels 0 and 1 of each
+*    column used
+*
+* The time of each transfer is measured at the destination AIE tile, by a
+* performance counter of its memory module which counts the cycles from the
+* start to the end of the task of the S2MM channel of the lane. The timers of
+* the destination tiles are also read before and after each run, which gives
+* the device time including the start and completion through the host. The
+* counters and timers are read with one performance snapshot. Each case is
+* printed as one JSON object per line, with the best and mean active cycles
+* of the runs, the bandwidth achieved in bytes per cycle and in MB/s at the
+* clock given with -f, the peak bandwidth of 4 bytes per cycle per lane, and
+* the errors of the transfers and of the data received.
+*
+* Usage: xaie_dma_bench [-b backend] [-g aie|aieml] [-c columns] [-f MHz]
+*		[-n runs] [-p path] [-o file]
+*
+* backend is one of linux, metal, baremetal, sim, socket or debug, as for
+* xaie_io_bench. The memory tile paths are skipped on AIE. Messages of the
+* driver and backends go to stdout, use -o to keep the results apart.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <xaiengine.h>
+
+/************************** Constant Definitions *****************************/
+/* AIE Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_COL_SHIFT		23
+#define XAIE_ROW_SHIFT		18
+#define XAIE_NUM_COLS		50
+#define XAIE_SHIM_ROW		0
+
+#define XAIE_AIE_NUM_ROWS		9
+#define XAIE_AIE_RES_TILE_ROW_START	0
+#define XAIE_AIE_RES_TILE_NUM_ROWS	0
+#define XAIE_AIE_AIE_TILE_ROW_START	1
+#define XAIE_AIE_AIE_TILE_NUM_ROWS	8
+
+#define XAIE_AIEML_COL_SHIFT		25
+#define XAIE_AIEML_ROW_SHIFT		20
+#define XAIE_AIEML_NUM_ROWS		11
+#define XAIE_AIEML_MEM_TILE_ROW_START	1
+#define XAIE_AIEML_MEM_TILE_NUM_ROWS	2
+#define XAIE_AIEML_AIE_TILE_ROW_START	3
+#define XAIE_AIEML_AIE_TILE_NUM_ROWS	8
+
+/* Benchmark parameters */
+#define BENCH_DEF_COLS		4U
+#define BENCH_DEF_RUNS		10U
+#define BENCH_DEF_FREQ_MHZ	1000U
+#define BENCH_MAX_LANES		8U
+#define BENCH_MAX_SIZE		0x4000U
+#define BENCH_MAX_BDS		4U
+#define BENCH_TIMEOUT_US	100000U
+#define BENCH_RECORD_ENTRIES	4096U
+#define BENCH_NS_PER_SEC	1000000000ULL
+
+/* Peak bandwidth of a DMA channel, one 32-bit stream word per cycle */
+#define BENCH_PEAK_BYTES_PER_CYCLE	4U
+
+/* Words per row of the matrix read by the transpose pattern */
+#define BENCH_TRANSPOSE_COLS	32U
+
+/*
+ * Buffers and BDs of each lane, by channel. The memory tile DMA sees the
+ * memory of its own tile after the memory of its west neighbour, and the
+ * locks of its own tile after the locks of its west neighbour.
+ */
+#define BENCH_TILE_BUF(Ch)		((u32)(Ch) * BENCH_MAX_SIZE)
+#define BENCH_MEMTILE_BUF(Ch)		((u32)(Ch) * 4U * BENCH_MAX_SIZE)
+#define BENCH_MEMTILE_DMA_OFF		0x80000U
+#define BENCH_MEMTILE_DMA_LOCK_OFF	64U
+#define BENCH_TILE_MM2S_BD(Ch, i)	((u8)((Ch) * BENCH_MAX_BDS + (i)))
+#define BENCH_TILE_S2MM_BD(Ch, i)	((u8)(8U + (Ch) * BENCH_MAX_BDS + (i)))
+#define BENCH_MEMTILE_S2MM_BD(Ch, i)	((u8)((Ch) * 24U + (i)))
+#define BENCH_MEMTILE_MM2S_BD(Ch, i)	((u8)((Ch) * 24U + 8U + (i)))
+#define BENCH_SHIM_MM2S_BD(Ch, i)	((u8)((Ch) * BENCH_MAX_BDS + (i)))
+#define BENCH_FREE_LOCK(Ch, j)		((u8)((Ch) * 4U + (j)))
+#define BENCH_FULL_LOCK(Ch, j)		((u8)((Ch) * 4U + 2U + (j)))
+
+/* South slave port of the shim stream switch fed by each shim DMA MM2S */
+#define BENCH_SHIM_PORT(Ch)		(((Ch) == 0U) ? 3U : 7U)
+
+/**************************** Type Definitions *******************************/
+typedef enum {
+	BENCH_PATH_TILE_TILE,
+	BENCH_PATH_MEMTILE_TILE,
+	BENCH_PATH_SHIM_MEMTILE_TILE,
+	BENCH_PATH_MAX
+} BenchPath;
+
+typedef struct {
+	BenchPath Path;
+	u32 Size;	/* Bytes transferred by each lane */
+	u8 NumBds;
+	u8 Transpose;
+	u8 NumLanes;
+} BenchCase;
+
+/*
+ * Transfer of one lane, in one or two hops. The first hop starts at Src, the
+ * second one, if any, at the memory tile Mid. The last hop ends at Dst.
+ */
+typedef struct {
+	XAie_LocType Src;
+	XAie_LocType Mid;
+	XAie_LocType Dst;
+	u8 Ch;
+	u8 NumHops;
+	u8 NumRoutes;
+	XAie_StrmFlow *Flows[2U];
+	u32 NumFlows[2U];
+	XAie_StrmRoute Route[2U];
+} BenchLane;
+
+typedef struct {
+	XAie_DevInst *DevInst;
+	const XAie_Config *Config;
+	const char *Backend;
+	FILE *Out;
+	XAie_StrmRouter Router;
+	XAie_MemInst *MemInst;	/* Host memory of the shim paths */
+	u8 ShimCols[BENCH_MAX_LANES / 2U];	/* Columns with a shim DMA */
+	u8 NumShimCols;
+	u8 NumCols;
+	u8 DevGen;
+	u32 Runs;
+	u32 FreqMhz;
+	u32 MaxFlows;
+	int OnlyPath;	/* Path to run, -1 for all */
+} Bench;
+
+/************************** Variable Definitions *****************************/
+static const struct {
+	const char *Name;
+	XAie_BackendType Type;
+} BenchBackends[] = {
+	{"linux", XAIE_IO_BACKEND_LINUX},
+	{"metal", XAIE_IO_BACKEND_METAL},
+	{"baremetal", XAIE_IO_BACKEND_BAREMETAL},
+	{"sim", XAIE_IO_BACKEND_SIM},
+	{"socket", XAIE_IO_BACKEND_SOCKET},
+	{"debug", XAIE_IO_BACKEND_DEBUG},
+};
+
+static const char *const BenchPathNames[BENCH_PATH_MAX] = {
+	"tile_tile", "memtile_tile", "shim_memtile_tile"
+};
+
+static const u32 BenchSizes[] = {0x400U, 0x1000U, BENCH_MAX_SIZE};
+static const u8 BenchBds[] = {1U, 2U, BENCH_MAX_BDS};
+static const u8 BenchLanes[] = {1U, 2U, 4U, BENCH_MAX_LANES};
+
+static u32 BenchSrcBuf[BENCH_MAX_SIZE / sizeof(u32)];
+static u32 BenchDstBuf[BENCH_MAX_SIZE / sizeof(u32)];
+
+/************************** Function Definitions *****************************/
+static u64 BenchNow(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * BENCH_NS_PER_SEC + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the value of a source word of a lane.
+*
+* @param	Lane: Index of the lane.
+* @param	Word: Index of the word in the transfer of the lane.
+*
+* @return	Value of the word.
+*
+* @note		None.
+*
+*******************************************************************************/
+static u32 BenchWord(u32 Lane, u32 Word)
+{
+	return (Lane << 24U) | Word;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the index of the source word received at a position
+* of the destination buffer.
+*
+* @param	C: Case of the benchmark.
+* @param	Word: Index of the word in the destination buffer.
+*
+* @return	Index of the source word.
+*
+* @note		None.
+*
+*******************************************************************************/
+static u32 BenchExpected(const BenchCase *C, u32 Word)
+{
+	u32 ChunkWords = C->Size / C->NumBds / sizeof(u32);
+	u32 Rows = ChunkWords / BENCH_TRANSPOSE_COLS;
+	u32 Base = Word - Word % ChunkWords;
+	u32 Idx = Word % ChunkWords;
+
+	if(C->Transpose == 0U) {
+		return Word;
+	}
+
+	/* Column Idx / Rows, row Idx % Rows of the chunk matrix */
+	return Base + (Idx % Rows) * BENCH_TRANSPOSE_COLS + Idx / Rows;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the result of a case as a JSON object.
+*
+* @param	B: Benchmark context.
+* @param	C: Case of the benchmark.
+* @param	Active: Best and total active cycles of the runs.
+* @param	Timer: Best timer cycles of the runs.
+* @param	HostNs: Best host time of the runs.
+* @param	Errors: Number of runs which failed.
+* @param	DataErrors: Number of words received wrong.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void BenchReport(Bench *B, const BenchCase *C, const u64 *Active,
+		u64 Timer, u64 HostNs, u64 Errors, u64 DataErrors)
+{
+	u64 Bytes = (u64)C->Size * C->NumLanes;
+	u64 Runs = B->Runs - Errors;
+	double BytesPerCycle = (Active[0] != 0U) ?
+		(double)Bytes / (double)Active[0] : 0.0;
+	double MBps = BytesPerCycle * B->FreqMhz;
+	double PeakMBps = (double)BENCH_PEAK_BYTES_PER_CYCLE * C->NumLanes *
+		B->FreqMhz;
+
+	fprintf(B->Out, "{\"backend\": \"%s\", \"path\": \"%s\", "
+			"\"bytes\": %u, \"bds\": %u, \"pattern\": \"%s\", "
+			"\"lanes\": %u, \"runs\": %u, \"active_cycles\": %llu, "
+			"\"active_cycles_mean\": %.1f, \"timer_cycles\": %llu, "
+			"\"host_ns\": %llu, \"bytes_per_cycle\": %.3f, "
+			"\"mb_per_s\": %.1f, \"peak_mb_per_s\": %.1f, "
+			"\"efficiency\": %.3f, \"errors\": %llu, "
+			"\"data_errors\": %llu}\n", B->Backend,
+			BenchPathNames[C->Path], C->Size, C->NumBds,
+			(C->Transpose != 0U) ? "transpose" : "linear",
+			C->NumLanes, B->Runs, (unsigned long long)Active[0],
+			(Runs != 0U) ? (double)Active[1] / (double)Runs : 0.0,
+			(unsigned long long)Timer, (unsigned long long)HostNs,
+			BytesPerCycle, MBps, PeakMBps, MBps / PeakMBps,
+			(unsigned long long)Errors,
+			(unsigned long long)DataErrors);
+	fflush(B->Out);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function places the tiles of a lane. Lanes 2c and 2c + 1 run on the
+* channels 0 and 1 of the c-th column used.
+*
+* @param	B: Benchmark context.
+* @param	C: Case of the benchmark.
+* @param	Idx: Index of the lane.
+* @param	Lane: Lane to place.
+*
+* @return	0 on success, -1 if the partition has too few columns.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int BenchLanePlace(Bench *B, const BenchCase *C, u32 Idx,
+		BenchLane *Lane)
+{
+	const XAie_Config *Cfg = B->Config;
+	u8 Col = (u8)(Idx / 2U);
+	u8 AieRow = Cfg->AieTileRowStart;
+
+	if(C->Path == BENCH_PATH_SHIM_MEMTILE_TILE) {
+		if(Col >= B->NumShimCols) {
+			return -1;
+		}
+		Col = B->ShimCols[Col];
+	} else if(Col >= B->NumCols) {
+		return -1;
+	}
+
+	Lane->Ch = (u8)(Idx % 2U);
+	Lane->Dst = XAie_TileLoc(Col, AieRow);
+	Lane->NumHops = 1U;
+	switch(C->Path) {
+	case BENCH_PATH_TILE_TILE:
+		Lane->Src = XAie_TileLoc(Col, AieRow);
+		Lane->Dst = XAie_TileLoc(Col, AieRow + 1U);
+		break;
+	case BENCH_PATH_MEMTILE_TILE:
+		Lane->Src = XAie_TileLoc(Col, Cfg->MemTileRowStart);
+		break;
+	default:
+		Lane->Src = XAie_TileLoc(Col, Cfg->ShimRowNum);
+		Lane->Mid = XAie_TileLoc(Col, Cfg->MemTileRowStart);
+		Lane->NumHops = 2U;
+		break;
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function places and applies the stream paths of a lane.
+*
+* @param	B: Benchmark context.
+* @param	Lane: Lane to route.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC BenchLaneRoute(Bench *B, BenchLane *Lane)
+{
+	AieRC RC;
+
+	for(u8 h = 0U; h < Lane->NumHops; h++) {
+		XAie_LocType From = (h == 0U) ? Lane->Src : Lane->Mid;
+		XAie_LocType To = (h + 1U == Lane->NumHops) ? Lane->Dst :
+			Lane->Mid;
+		u8 Shim = (From.Row == B->Config->ShimRowNum) ? 1U : 0U;
+
+		Lane->NumFlows[h] = B->MaxFlows;
+		RC = XAie_StrmRouterFindPath(B->DevInst, &B->Router, From,
+				(Shim != 0U) ? SOUTH : DMA,
+				(Shim != 0U) ? BENCH_SHIM_PORT(Lane->Ch) :
+				Lane->Ch, To, DMA, Lane->Ch, Lane->Flows[h],
+				&Lane->NumFlows[h]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RC = XAie_StrmRouteCompile(B->DevInst, &Lane->Route[h],
+				Lane->Flows[h], Lane->NumFlows[h]);
+		if(RC != XAIE_OK) {
+			XAie_StrmRouterRelease(B->DevInst, &B->Router,
+					Lane->Flows[h], Lane->NumFlows[h]);
+			return RC;
+		}
+		Lane->NumRoutes++;
+
+		RC = XAie_StrmRouteApply(B->DevInst, &Lane->Route[h]);
+		if((RC == XAIE_OK) && (Shim != 0U)) {
+			RC = XAie_EnableShimDmaToAieStrmPort(B->DevInst, From,
+					BENCH_SHIM_PORT(Lane->Ch));
+		}
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears and releases the stream paths of a lane.
+*
+* @param	B: Benchmark context.
+* @param	Lane: Lane to release.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void BenchLaneRelease(Bench *B, BenchLane *Lane)
+{
+	for(u8 h = 0U; h < Lane->NumRoutes; h++) {
+		XAie_StrmRouteClear(B->DevInst, &Lane->Route[h]);
+		XAie_StrmRouteFree(&Lane->Route[h]);
+		XAie_StrmRouterRelease(B->DevInst, &B->Router, Lane->Flows[h],
+				Lane->NumFlows[h]);
+	}
+	Lane->NumRoutes = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes the BD chain of one channel of a lane and enables the
+* channel. Chunk i of the transfer goes to BD Bds + i, and to buffer i % 2 of
+* the memory tile when Locks is set.
+*
+* @param	B: Benchmark context.
+* @param	C: Case of the benchmark.
+* @param	Loc: Location of the tile of the channel.
+* @param	Ch: Channel number.
+* @param	Dir: Direction of the channel.
+* @param	Addr: Address of the transfer, offset in the host memory for the
+*		shim DMA.
+* @param	Bds: First BD of the chain.
+* @param	Locks: Guard the memory tile buffers with the lock pairs of the
+*		channel.
+* @param	Transpose: Read each chunk with the transpose pattern.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC BenchWriteChain(Bench *B, const BenchCase *C, XAie_LocType Loc,
+		u8 Ch, XAie_DmaDirection Dir, u64 Addr, u8 Bds, u8 Locks,
+		u8 Transpose)
+{
+	u32 Chunk = C->Size / C->NumBds;
+	AieRC RC = XAIE_OK;
+
+	for(u8 i = 0U; (i < C->NumBds) && (RC == XAIE_OK); i++) {
+		XAie_DmaDimDesc Dims[2U];
+		XAie_DmaTensor Tensor = {2U, Dims};
+		XAie_DmaDesc Desc;
+		u64 ChunkAddr = Addr + (u64)Chunk * ((Locks != 0U) ?
+				(i % 2U) : i);
+
+		RC = XAie_DmaDescInit(B->DevInst, &Desc, Loc);
+		if(Loc.Row == B->Config->ShimRowNum) {
+			RC |= XAie_DmaSetAddrOffsetLen(&Desc, B->MemInst,
+					ChunkAddr, Chunk);
+		} else if(Transpose != 0U) {
+			Dims[0].AieMlDimDesc.StepSize = BENCH_TRANSPOSE_COLS;
+			Dims[0].AieMlDimDesc.Wrap = (u16)(Chunk / sizeof(u32) /
+					BENCH_TRANSPOSE_COLS);
+			Dims[1].AieMlDimDesc.StepSize = 1U;
+			Dims[1].AieMlDimDesc.Wrap = BENCH_TRANSPOSE_COLS;
+			RC |= XAie_DmaSetMultiDimAddr(&Desc, &Tensor, ChunkAddr,
+					Chunk);
+		} else {
+			RC |= XAie_DmaSetAddrLen(&Desc, ChunkAddr, Chunk);
+		}
+
+		if(Locks != 0U) {
+			u8 Free = BENCH_MEMTILE_DMA_LOCK_OFF +
+				BENCH_FREE_LOCK(Ch, i % 2U);
+			u8 Full = BENCH_MEMTILE_DMA_LOCK_OFF +
+				BENCH_FULL_LOCK(Ch, i % 2U);
+
+			if(Dir == DMA_S2MM) {
+				RC |= XAie_DmaSetLock(&Desc,
+						XAie_LockInit(Free, -1),
+						XAie_LockInit(Full, 1));
+			} else {
+				RC |= XAie_DmaSetLock(&Desc,
+						XAie_LockInit(Full, -1),
+						XAie_LockInit(Free, 1));
+			}
+		}
+
+		if(i + 1U < C->NumBds) {
+			RC |= XAie_DmaSetNextBd(&Desc, Bds + i + 1U,
+					XAIE_ENABLE);
+		}
+		RC |= XAie_DmaEnableBd(&Desc);
+		RC |= XAie_DmaWriteBd(B->DevInst, &Desc, Loc, Bds + i);
+	}
+
+	if(RC == XAIE_OK) {
+		RC = XAie_DmaChannelEnable(B->DevInst, Loc, Ch, Dir);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes the source data, the BD chains and the performance
+* counter of a lane, and enables its channels.
+*
+* @param	B: Benchmark context.
+* @param	C: Case of the benchmark.
+* @param	Idx: Index of the lane.
+* @param	Lane: Lane to set up.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC BenchLaneSetup(Bench *B, const BenchCase *C, u32 Idx,
+		BenchLane *Lane)
+{
+	XAie_DevInst *DevInst = B->DevInst;
+	u8 Ch = Lane->Ch;
+	XAie_Events Start, Stop;
+	AieRC RC;
+
+	for(u32 w = 0U; w < C->Size / sizeof(u32); w++) {
+		BenchSrcBuf[w] = BenchWord(Idx, w);
+	}
+
+	switch(C->Path) {
+	case BENCH_PATH_TILE_TILE:
+		RC = XAie_DataMemBlockWrite(DevInst, Lane->Src,
+				BENCH_TILE_BUF(Ch), BenchSrcBuf, C->Size);
+		RC |= BenchWriteChain(B, C, Lane->Src, Ch, DMA_MM2S,
+				BENCH_TILE_BUF(Ch), BENCH_TILE_MM2S_BD(Ch, 0U),
+				0U, C->Transpose);
+		break;
+	case BENCH_PATH_MEMTILE_TILE:
+		RC = XAie_DataMemBlockWrite(DevInst, Lane->Src,
+				BENCH_MEMTILE_BUF(Ch), BenchSrcBuf, C->Size);
+		RC |= BenchWriteChain(B, C, Lane->Src, Ch, DMA_MM2S,
+				BENCH_MEMTILE_DMA_OFF + BENCH_MEMTILE_BUF(Ch),
+				BENCH_MEMTILE_MM2S_BD(Ch, 0U), 0U,
+				C->Transpose);
+		break;
+	default:
+		memcpy((u8 *)XAie_MemGetVAddr(B->MemInst) +
+				(u64)Idx * BENCH_MAX_SIZE, BenchSrcBuf,
+				C->Size);
+		RC = XAie_MemSyncForDevRange(B->MemInst,
+				(u64)Idx * BENCH_MAX_SIZE, C->Size);
+		RC |= BenchWriteChain(B, C, Lane->Src, Ch, DMA_MM2S,
+				(u64)Idx * BENCH_MAX_SIZE,
+				BENCH_SHIM_MM2S_BD(Ch, 0U), 0U, 0U);
+		RC |= BenchWriteChain(B, C, Lane->Mid, Ch, DMA_S2MM,
+				BENCH_MEMTILE_DMA_OFF + BENCH_MEMTILE_BUF(Ch),
+				BENCH_MEMTILE_S2MM_BD(Ch, 0U), 1U, 0U);
+		RC |= BenchWriteChain(B, C, Lane->Mid, Ch, DMA_MM2S,
+				BENCH_MEMTILE_DMA_OFF + BENCH_MEMTILE_BUF(Ch),
+				BENCH_MEMTILE_MM2S_BD(Ch, 0U), 1U,
+				C->Transpose);
+		break;
+	}
+
+	RC |= BenchWriteChain(B, C, Lane->Dst, Ch, DMA_S2MM,
+			BENCH_TILE_BUF(Ch), BENCH_TILE_S2MM_BD(Ch, 0U), 0U, 0U);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	/* Count the cycles of the task of the S2MM channel of the lane */
+	if(B->DevGen == XAIE_DEV_GEN_AIE) {
+		Start = (Ch == 0U) ? XAIE_EVENT_DMA_S2MM_0_START_BD_MEM :
+			XAIE_EVENT_DMA_S2MM_1_START_BD_MEM;
+		Stop = (Ch == 0U) ? XAIE_EVENT_DMA_S2MM_0_GO_TO_IDLE_MEM :
+			XAIE_EVENT_DMA_S2MM_1_GO_TO_IDLE_MEM;
+	} else {
+		Start = (Ch == 0U) ? XAIE_EVENT_DMA_S2MM_0_START_TASK_MEM :
+			XAIE_EVENT_DMA_S2MM_1_START_TASK_MEM;
+		Stop = (Ch == 0U) ? XAIE_EVENT_DMA_S2MM_0_FINISHED_TASK_MEM :
+			XAIE_EVENT_DMA_S2MM_1_FINISHED_TASK_MEM;
+	}
+
+	return XAie_PerfCounterControlSet(DevInst, Lane->Dst, XAIE_MEM_MOD,
+			Ch, Start, Stop);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts the transfer of a lane. The channels are started from
+* the destination back to the source, so that each channel is ready before
+* data reaches it.
+*
+* @param	B: Benchmark context.
+* @param	C: Case of the benchmark.
+* @param	Lane: Lane to start.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC BenchLaneStart(Bench *B, const BenchCase *C, BenchLane *Lane)
+{
+	XAie_DevInst *DevInst = B->DevInst;
+	u8 Ch = Lane->Ch;
+	AieRC RC;
+
+	RC = XAie_PerfCounterSet(DevInst, Lane->Dst, XAIE_MEM_MOD, Ch, 0U);
+	RC |= XAie_DmaChannelPushBdToQueue(DevInst, Lane->Dst, Ch, DMA_S2MM,
+			BENCH_TILE_S2MM_BD(Ch, 0U));
+
+	switch(C->Path) {
+	case BENCH_PATH_TILE_TILE:
+		RC |= XAie_DmaChannelPushBdToQueue(DevInst, Lane->Src, Ch,
+				DMA_MM2S, BENCH_TILE_MM2S_BD(Ch, 0U));
+		break;
+	case BENCH_PATH_MEMTILE_TILE:
+		RC |= XAie_DmaChannelPushBdToQueue(DevInst, Lane->Src, Ch,
+				DMA_MM2S, BENCH_MEMTILE_MM2S_BD(Ch, 0U));
+		break;
+	default:
+		for(u8 j = 0U; j < 2U; j++) {
+			RC |= XAie_LockSetValue(DevInst, Lane->Mid,
+					XAie_LockInit(BENCH_FREE_LOCK(Ch, j),
+						1));
+			RC |= XAie_LockSetValue(DevInst, Lane->Mid,
+					XAie_LockInit(BENCH_FULL_LOCK(Ch, j),
+						0));
+		}
+		RC |= XAie_DmaChannelPushBdToQueue(DevInst, Lane->Mid, Ch,
+				DMA_MM2S, BENCH_MEMTILE_MM2S_BD(Ch, 0U));
+		RC |= XAie_DmaChannelPushBdToQueue(DevInst, Lane->Mid, Ch,
+				DMA_S2MM, BENCH_MEMTILE_S2MM_BD(Ch, 0U));
+		RC |= XAie_DmaChannelPushBdToQueue(DevInst, Lane->Src, Ch,
+				DMA_MM2S, BENCH_SHIM_MM2S_BD(Ch, 0U));
+		break;
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads back the data received by a lane and counts the words
+* which differ from the source.
+*
+* @param	B: Benchmark context.
+* @param	C: Case of the benchmark.
+* @param	Idx: Index of the lane.
+* @param	Lane: Lane to check.
+*
+* @return	Number of words received wrong, all of them if the read fails.
+*
+* @note		None.
+*
+*******************************************************************************/
+static u64 BenchLaneCheck(Bench *B, const BenchCase *C, u32 Idx,
+		BenchLane *Lane)
+{
+	u32 NumWords = C->Size / sizeof(u32);
+	u64 Errors = 0U;
+
+	if(XAie_DataMemBlockRead(B->DevInst, Lane->Dst,
+				BENCH_TILE_BUF(Lane->Ch), BenchDstBuf,
+				C->Size) != XAIE_OK) {
+		return NumWords;
+	}
+
+	for(u32 w = 0U; w < NumWords; w++) {
+		if(BenchDstBuf[w] != BenchWord(Idx, BenchExpected(C, w))) {
+			Errors++;
+		}
+	}
+
+	return Errors;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs a case of the benchmark and prints its result. Cases
+* which do not apply to the device or partition are skipped.
+*
+* @param	B: Benchmark context.
+* @param	C: Case of the benchmark.
+*
+* @return	0 on success, -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int BenchRun(Bench *B, const BenchCase *C)
+{
+	XAie_DevInst *DevInst = B->DevInst;
+	BenchLane Lanes[BENCH_MAX_LANES];
+	XAie_LocType Locs[BENCH_MAX_LANES / 2U];
+	XAie_ModuleType Mods[BENCH_MAX_LANES / 2U];
+	XAie_DmaWaitCh Chs[BENCH_MAX_LANES];
+	u64 Before[BENCH_MAX_LANES / 2U];
+	u64 Active[2U] = {~0ULL, 0U}, Timer = ~0ULL, HostNs = ~0ULL;
+	u64 Errors = 0U, DataErrors = 0U;
+	u32 NumEntries = (C->NumLanes + 1U) / 2U;
+	XAie_StrmFlow *Flows;
+	XAie_PerfSnapshot Snap;
+	AieRC RC = XAIE_OK;
+
+	if(((C->Path != BENCH_PATH_TILE_TILE) &&
+			(B->DevGen == XAIE_DEV_GEN_AIE)) ||
+			((C->Path == BENCH_PATH_SHIM_MEMTILE_TILE) &&
+			 (B->MemInst == NULL)) ||
+			((C->Transpose != 0U) &&
+			 (B->DevGen == XAIE_DEV_GEN_AIE))) {
+		return 0;
+	}
+
+	memset(Lanes, 0, sizeof(Lanes));
+	for(u32 l = 0U; l < C->NumLanes; l++) {
+		if(BenchLanePlace(B, C, l, &Lanes[l]) != 0) {
+			return 0;
+		}
+	}
+
+	Flows = (XAie_StrmFlow *)malloc((size_t)C->NumLanes * 2U *
+			B->MaxFlows * sizeof(*Flows));
+	if(Flows == NULL) {
+		return -1;
+	}
+
+	for(u32 l = 0U; (l < C->NumLanes) && (RC == XAIE_OK); l++) {
+		Lanes[l].Flows[0U] = &Flows[(size_t)l * 2U * B->MaxFlows];
+		Lanes[l].Flows[1U] = Lanes[l].Flows[0U] + B->MaxFlows;
+		RC = BenchLaneRoute(B, &Lanes[l]);
+		if(RC == XAIE_OK) {
+			RC = BenchLaneSetup(B, C, l, &Lanes[l]);
+		}
+		Chs[l].Loc = Lanes[l].Dst;
+		Chs[l].ChNum = Lanes[l].Ch;
+		Chs[l].Dir = DMA_S2MM;
+	}
+
+	for(u32 e = 0U; e < NumEntries; e++) {
+		Locs[e] = Lanes[2U * e].Dst;
+		Mods[e] = XAIE_MEM_MOD;
+	}
+	if(RC == XAIE_OK) {
+		RC = XAie_PerfSnapshotInit(DevInst, &Snap, Locs, Mods,
+				NumEntries, (C->NumLanes > 1U) ? 2U : 1U,
+				XAIE_ENABLE);
+		if(RC != XAIE_OK) {
+			Snap.IsReady = 0U;
+		}
+	} else {
+		Snap.IsReady = 0U;
+	}
+
+	for(u32 r = 0U; r < B->Runs; r++) {
+		u64 Start, Cycles = 0U, Span = 0U;
+		AieRC RunRC = RC;
+
+		if(RunRC == XAIE_OK) {
+			RunRC = XAie_PerfSnapshotRead(DevInst, &Snap);
+		}
+		if(RunRC != XAIE_OK) {
+			Errors++;
+			continue;
+		}
+		memcpy(Before, Snap.TimerVals, NumEntries * sizeof(*Before));
+
+		Start = BenchNow();
+		for(u32 l = 0U; (l < C->NumLanes) && (RunRC == XAIE_OK); l++) {
+			RunRC = BenchLaneStart(B, C, &Lanes[l]);
+		}
+		if(RunRC == XAIE_OK) {
+			RunRC = XAie_DmaWaitForDoneMulti(DevInst, Chs,
+					C->NumLanes, XAIE_ENABLE, NULL,
+					BENCH_TIMEOUT_US);
+		}
+		Start = BenchNow() - Start;
+
+		if(RunRC == XAIE_OK) {
+			RunRC = XAie_PerfSnapshotRead(DevInst, &Snap);
+		}
+		if(RunRC != XAIE_OK) {
+			Errors++;
+			continue;
+		}
+
+		/* The lanes run in parallel, the slowest one sets the time */
+		for(u32 l = 0U; l < C->NumLanes; l++) {
+			u64 Val = Snap.CounterVals[(l / 2U) *
+				Snap.NumCounters + Lanes[l].Ch];
+
+			Cycles = (Val > Cycles) ? Val : Cycles;
+		}
+		for(u32 e = 0U; e < NumEntries; e++) {
+			u64 Val = Snap.TimerVals[e] - Before[e];
+
+			Span = (Val > Span) ? Val : Span;
+		}
+
+		Active[0U] = (Cycles < Active[0U]) ? Cycles : Active[0U];
+		Active[1U] += Cycles;
+		Timer = (Span < Timer) ? Span : Timer;
+		HostNs = (Start < HostNs) ? Start : HostNs;
+	}
+
+	if(Errors < B->Runs) {
+		for(u32 l = 0U; l < C->NumLanes; l++) {
+			DataErrors += BenchLaneCheck(B, C, l, &Lanes[l]);
+		}
+	} else {
+		Active[0U] = Timer = HostNs = 0U;
+	}
+	BenchReport(B, C, Active, Timer, HostNs, Errors, DataErrors);
+
+	if(Snap.IsReady != 0U) {
+		XAie_PerfSnapshotFree(&Snap);
+	}
+	for(u32 l = 0U; l < C->NumLanes; l++) {
+		XAie_PerfCounterControlReset(DevInst, Lanes[l].Dst,
+				XAIE_MEM_MOD, Lanes[l].Ch);
+		BenchLaneRelease(B, &Lanes[l]);
+	}
+	free(Flows);
+
+	return (Errors == 0U) ? 0 : -1;
+}
+
+static void BenchUsage(const char *Prog)
+{
+	fprintf(stderr, "Usage: %s [-b linux|metal|baremetal|sim|socket|"
+			"debug] [-g aie|aieml] [-c columns] [-f MHz] "
+			"[-n runs] [-p tile_tile|memtile_tile|"
+			"shim_memtile_tile] [-o file]\n", Prog);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function finds the columns of the partition whose shim tile has a DMA,
+* for the shim paths.
+*
+* @param	B: Benchmark context.
+*
+* @return	None.
+*
+* @note		The descriptor init fails, and logs an error, for the shim
+*		tiles without a DMA.
+*
+*******************************************************************************/
+static void BenchFindShimCols(Bench *B)
+{
+	XAie_DmaDesc Desc;
+
+	for(u8 c = 0U; (c < B->NumCols) &&
+			(B->NumShimCols < BENCH_MAX_LANES / 2U); c++) {
+		if(XAie_DmaDescInit(B->DevInst, &Desc,
+					XAie_TileLoc(c, B->Config->ShimRowNum))
+				== XAIE_OK) {
+			B->ShimCols[B->NumShimCols++] = c;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the AIE driver DMA benchmark.
+*
+* @param	argc: Number of arguments.
+* @param	argv: Arguments, see the usage above.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+	XAie_IORecord *Records = NULL;
+	XAie_IORecordRing Ring;
+	XAie_Config *ConfigPtr;
+	int BackendIdx = -1, Opt, Ret = 0;
+	Bench B;
+	AieRC RC;
+
+	memset(&B, 0, sizeof(B));
+	B.Backend = "default";
+	B.Out = stdout;
+	B.DevGen = XAIE_DEV_GEN_AIEML;
+	B.NumCols = BENCH_DEF_COLS;
+	B.Runs = BENCH_DEF_RUNS;
+	B.FreqMhz = BENCH_DEF_FREQ_MHZ;
+	B.OnlyPath = -1;
+
+	while((Opt = getopt(argc, argv, "b:g:c:f:n:p:o:")) != -1) {
+		switch(Opt) {
+		case 'b':
+			for(u32 i = 0U; i < sizeof(BenchBackends) /
+					sizeof(BenchBackends[0]); i++) {
+				if(strcmp(optarg, BenchBackends[i].Name) == 0) {
+					BackendIdx = (int)i;
+				}
+			}
+			if(BackendIdx < 0) {
+				BenchUsage(argv[0]);
+				return -1;
+			}
+			B.Backend = BenchBackends[BackendIdx].Name;
+			break;
+		case 'g':
+			if(strcmp(optarg, "aie") == 0) {
+				B.DevGen = XAIE_DEV_GEN_AIE;
+			} else if(strcmp(optarg, "aieml") == 0) {
+				B.DevGen = XAIE_DEV_GEN_AIEML;
+			} else {
+				BenchUsage(argv[0]);
+				return -1;
+			}
+			break;
+		case 'c':
+			B.NumCols = (u8)strtoul(optarg, NULL, 0);
+			break;
+		case 'f':
+			B.FreqMhz = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'n':
+			B.Runs = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'p':
+			for(int i = 0; i < BENCH_PATH_MAX; i++) {
+				if(strcmp(optarg, BenchPathNames[i]) == 0) {
+					B.OnlyPath = i;
+				}
+			}
+			if(B.OnlyPath < 0) {
+				BenchUsage(argv[0]);
+				return -1;
+			}
+			break;
+		case 'o':
+			B.Out = fopen(optarg, "w");
+			if(B.Out == NULL) {
+				perror("Failed to open the output file");
+				return -1;
+			}
+			break;
+		default:
+			BenchUsage(argv[0]);
+			return -1;
+		}
+	}
+
+	XAie_SetupConfig(AieConfig, XAIE_DEV_GEN_AIE, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_AIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_AIE_RES_TILE_ROW_START, XAIE_AIE_RES_TILE_NUM_ROWS,
+			XAIE_AIE_AIE_TILE_ROW_START, XAIE_AIE_AIE_TILE_NUM_ROWS);
+	XAie_SetupConfig(AieMlConfig, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_AIEML_COL_SHIFT, XAIE_AIEML_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_AIEML_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_AIEML_MEM_TILE_ROW_START,
+			XAIE_AIEML_MEM_TILE_NUM_ROWS,
+			XAIE_AIEML_AIE_TILE_ROW_START,
+			XAIE_AIEML_AIE_TILE_NUM_ROWS);
+	ConfigPtr = (B.DevGen == XAIE_DEV_GEN_AIE) ? &AieConfig : &AieMlConfig;
+
+	if((B.NumCols == 0U) || (B.NumCols > ConfigPtr->NumCols) ||
+			(B.Runs == 0U) || (B.FreqMhz == 0U)) {
+		BenchUsage(argv[0]);
+		return -1;
+	}
+
+	XAie_InstDeclare(DevInst, ConfigPtr);
+
+	XAie_SetupPartitionConfig(&DevInst, XAIE_BASE_ADDR, 0U, B.NumCols);
+	RC = XAie_CfgInitialize(&DevInst, ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	if(BackendIdx >= 0) {
+		RC = XAie_SetIOBackend(&DevInst,
+				BenchBackends[BackendIdx].Type);
+		if(RC != XAIE_OK) {
+			/* The previous backend is already closed */
+			printf("Backend %s is not available.\n", B.Backend);
+			return -1;
+		}
+	}
+
+	/* Keep the debug backend from printing every access */
+	Records = (XAie_IORecord *)calloc(BENCH_RECORD_ENTRIES,
+			sizeof(*Records));
+	if(Records != NULL) {
+		Ring.Records = Records;
+		Ring.NumRecords = BENCH_RECORD_ENTRIES;
+		Ring.NumWritten = 0U;
+		if(XAie_ConfigIORecord(&DevInst, &Ring) != XAIE_OK) {
+			free(Records);
+			Records = NULL;
+		}
+	}
+
+	RC = XAie_PmRequestTiles(&DevInst, NULL, 0);
+	if(RC == XAIE_OK) {
+		RC = XAie_StrmRouterInit(&DevInst, &B.Router);
+	}
+	if(RC != XAIE_OK) {
+		printf("Failed to request tiles.\n");
+		free(Records);
+		XAie_Finish(&DevInst);
+		return -1;
+	}
+
+	B.DevInst = &DevInst;
+	B.Config = ConfigPtr;
+	B.MaxFlows = (u32)B.NumCols * ConfigPtr->NumRows;
+	if(B.DevGen != XAIE_DEV_GEN_AIE) {
+		BenchFindShimCols(&B);
+		B.MemInst = XAie_MemAllocate(&DevInst,
+				BENCH_MAX_LANES * BENCH_MAX_SIZE,
+				XAIE_MEM_NONCACHEABLE);
+		if(B.MemInst == NULL) {
+			printf("No host memory, shim paths are skipped.\n");
+		}
+	}
+
+	for(int p = 0; p < BENCH_PATH_MAX; p++) {
+		if((B.OnlyPath >= 0) && (B.OnlyPath != p)) {
+			continue;
+		}
+		for(u32 s = 0U; s < sizeof(BenchSizes) / sizeof(BenchSizes[0]);
+				s++) {
+			for(u32 d = 0U; d < sizeof(BenchBds); d++) {
+				for(u8 t = 0U; t < 2U; t++) {
+					for(u32 l = 0U; l < sizeof(BenchLanes);
+							l++) {
+						BenchCase C = {(BenchPath)p,
+							BenchSizes[s],
+							BenchBds[d], t,
+							BenchLanes[l]};
+
+						if(BenchRun(&B, &C) != 0) {
+							Ret = -1;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	if(B.MemInst != NULL) {
+		XAie_MemFree(B.MemInst);
+	}
+	XAie_StrmRouterFree(&B.Router);
+	if(Records != NULL) {
+		XAie_ConfigIORecord(&DevInst, NULL);
+		free(Records);
+	}
+	XAie_Finish(&DevInst);
+	if(B.Out != stdout) {
+		fclose(B.Out);
+	}
+
+	return Ret;
+}
+
+/** @} */
@@ -0,0 +1,482 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_io_bench.c
+* @{
+*
+* This file contains the microbenchmarks of the register and block IO paths of
+* the driver. It measures, through the public register access APIs:
+*  * write32/read32: single register write and read latency
+*  * maskpoll_ready: latency of a poll whose condition is already met
+*  * maskpoll_wakeup: latency from a register write on another thread to the
+*    return of the poll waiting for it
+*  * blockwrite32/blockset32: block throughput for sizes of 1 to 4096 words
+*  * txn_record/txn_submit: transaction record and submit throughput
+*
+* The accesses target the data memory of the first AIE tile of the partition.
+* Every result is printed as one JSON object per line, to stdout or to the
+* file given with -o, so that runs can be compared by scripts. Messages of the
+* driver and backends always go to stdout.
+*
+* Usage: xaie_io_bench [-b backend] [-g aie|aieml] [-n iterations] [-o file]
+*
+* backend is one of linux, metal, baremetal, sim, socket or debug, and
+* defaults to the backend the driver was built for. The backend has to be
+* compiled into the driver. With the debug backend, the accesses are recorded
+* in a ring instead of printed, so that the benchmark does not measure stdout.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <xaiengine.h>
+
+/************************** Constant Definitions *****************************/
+/* AIE Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_COL_SHIFT		23
+#define XAIE_ROW_SHIFT		18
+#define XAIE_NUM_COLS		50
+#define XAIE_SHIM_ROW		0
+
+#define XAIE_AIE_NUM_ROWS		9
+#define XAIE_AIE_RES_TILE_ROW_START	0
+#define XAIE_AIE_RES_TILE_NUM_ROWS	0
+#define XAIE_AIE_AIE_TILE_ROW_START	1
+#define XAIE_AIE_AIE_TILE_NUM_ROWS	8
+
+#define XAIE_AIEML_COL_SHIFT		25
+#define XAIE_AIEML_ROW_SHIFT		20
+#define XAIE_AIEML_NUM_ROWS		11
+#define XAIE_AIEML_MEM_TILE_ROW_START	1
+#define XAIE_AIEML_MEM_TILE_NUM_ROWS	2
+#define XAIE_AIEML_AIE_TILE_ROW_START	3
+#define XAIE_AIEML_AIE_TILE_NUM_ROWS	8
+
+/* Benchmark parameters */
+#define BENCH_COL		1U
+#define BENCH_DEF_ITERS		10000U
+#define BENCH_MAX_WORDS		4096U
+#define BENCH_POLL_TIMEOUT_US	100000U
+#define BENCH_WAKEUP_DELAY_US	200U
+#define BENCH_WAKEUP_ITERS	100U
+#define BENCH_RECORD_ENTRIES	4096U
+#define BENCH_NS_PER_SEC	1000000000ULL
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	XAie_DevInst *DevInst;
+	const char *Backend;
+	FILE *Out;
+	u64 TileAddr;	/* Offset of the benchmarked tile in the partition */
+	u32 Iters;
+} Bench;
+
+typedef struct {
+	Bench *B;
+	u64 RegOff;
+	u32 Value;
+	u64 WriteNs;	/* Time stamp of the write which wakes up the poll */
+} BenchWaker;
+
+/************************** Variable Definitions *****************************/
+static const struct {
+	const char *Name;
+	XAie_BackendType Type;
+} BenchBackends[] = {
+	{"linux", XAIE_IO_BACKEND_LINUX},
+	{"metal", XAIE_IO_BACKEND_METAL},
+	{"baremetal", XAIE_IO_BACKEND_BAREMETAL},
+	{"sim", XAIE_IO_BACKEND_SIM},
+	{"socket", XAIE_IO_BACKEND_SOCKET},
+	{"debug", XAIE_IO_BACKEND_DEBUG},
+};
+
+static const u32 BenchWords[] = {1U, 4U, 16U, 64U, 256U, 1024U, 4096U};
+static u32 BenchBuf[BENCH_MAX_WORDS];
+
+/************************** Function Definitions *****************************/
+static u64 BenchNow(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * BENCH_NS_PER_SEC + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints one result as a JSON object.
+*
+* @param	B: Benchmark context.
+* @param	Name: Name of the benchmark.
+* @param	Words: Number of 32-bit words per operation.
+* @param	Ops: Number of operations.
+* @param	Ns: Total time of the operations in nanoseconds.
+* @param	Errors: Number of operations which failed.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void BenchReport(Bench *B, const char *Name, u32 Words, u64 Ops, u64 Ns,
+		u64 Errors)
+{
+	double NsPerOp = (Ops != 0U) ? (double)Ns / (double)Ops : 0.0;
+	double MBps = (Ns != 0U) ?
+		(double)Ops * Words * 4U * 1000.0 / (double)Ns : 0.0;
+
+	fprintf(B->Out, "{\"backend\": \"%s\", \"bench\": \"%s\", "
+			"\"words\": %u, \"ops\": %llu, \"total_ns\": %llu, "
+			"\"ns_per_op\": %.1f, \"mb_per_s\": %.2f, "
+			"\"errors\": %llu}\n", B->Backend, Name, Words,
+			(unsigned long long)Ops, (unsigned long long)Ns,
+			NsPerOp, MBps, (unsigned long long)Errors);
+	fflush(B->Out);
+}
+
+static void BenchWrite32(Bench *B)
+{
+	u64 Errors = 0U, Start;
+
+	Start = BenchNow();
+	for(u32 i = 0U; i < B->Iters; i++) {
+		if(XAie_Write32(B->DevInst, B->TileAddr, i) != XAIE_OK) {
+			Errors++;
+		}
+	}
+	BenchReport(B, "write32", 1U, B->Iters, BenchNow() - Start, Errors);
+}
+
+static void BenchRead32(Bench *B)
+{
+	u64 Errors = 0U, Start;
+	u32 Data;
+
+	Start = BenchNow();
+	for(u32 i = 0U; i < B->Iters; i++) {
+		if(XAie_Read32(B->DevInst, B->TileAddr, &Data) != XAIE_OK) {
+			Errors++;
+		}
+	}
+	BenchReport(B, "read32", 1U, B->Iters, BenchNow() - Start, Errors);
+}
+
+static void BenchMaskPollReady(Bench *B)
+{
+	u64 Errors = 0U, Start;
+
+	XAie_Write32(B->DevInst, B->TileAddr, 0x1U);
+
+	Start = BenchNow();
+	for(u32 i = 0U; i < B->Iters; i++) {
+		if(XAie_MaskPoll(B->DevInst, B->TileAddr, 0x1U, 0x1U,
+					BENCH_POLL_TIMEOUT_US) != XAIE_OK) {
+			Errors++;
+		}
+	}
+	BenchReport(B, "maskpoll_ready", 1U, B->Iters, BenchNow() - Start,
+			Errors);
+}
+
+static void *BenchWake(void *Arg)
+{
+	BenchWaker *W = (BenchWaker *)Arg;
+
+	usleep(BENCH_WAKEUP_DELAY_US);
+	W->WriteNs = BenchNow();
+	XAie_Write32(W->B->DevInst, W->RegOff, W->Value);
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function measures the time from a register write on another thread to
+* the return of the poll waiting for it. Polls which fail, or return before
+* the write, e.g. on backends which do not read the device, are counted as
+* errors and left out of the time.
+*
+* @param	B: Benchmark context.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void BenchMaskPollWakeup(Bench *B)
+{
+	u64 Errors = 0U, Ns = 0U, Ops = 0U;
+	BenchWaker W = {B, B->TileAddr, 0U, 0U};
+	pthread_t Thread;
+
+	for(u32 i = 0U; i < BENCH_WAKEUP_ITERS; i++) {
+		AieRC RC;
+		u64 End;
+
+		W.Value = (i & 0x1U) ? 0x0U : 0x1U;
+		XAie_Write32(B->DevInst, W.RegOff, W.Value ^ 0x1U);
+		if(pthread_create(&Thread, NULL, BenchWake, &W) != 0) {
+			Errors++;
+			continue;
+		}
+
+		RC = XAie_MaskPoll(B->DevInst, W.RegOff, 0x1U, W.Value,
+				BENCH_POLL_TIMEOUT_US);
+		End = BenchNow();
+		pthread_join(Thread, NULL);
+
+		if((RC != XAIE_OK) || (End < W.WriteNs)) {
+			Errors++;
+			continue;
+		}
+
+		Ns += End - W.WriteNs;
+		Ops++;
+	}
+	BenchReport(B, "maskpoll_wakeup", 1U, Ops, Ns, Errors);
+}
+
+static void BenchBlock(Bench *B)
+{
+	for(u32 s = 0U; s < sizeof(BenchWords) / sizeof(BenchWords[0]); s++) {
+		u32 Words = BenchWords[s];
+		u32 Iters = B->Iters / Words + 1U;
+		u64 Errors = 0U, Start;
+
+		Start = BenchNow();
+		for(u32 i = 0U; i < Iters; i++) {
+			if(XAie_BlockWrite32(B->DevInst, B->TileAddr, BenchBuf,
+						Words) != XAIE_OK) {
+				Errors++;
+			}
+		}
+		BenchReport(B, "blockwrite32", Words, Iters,
+				BenchNow() - Start, Errors);
+
+		Errors = 0U;
+		Start = BenchNow();
+		for(u32 i = 0U; i < Iters; i++) {
+			if(XAie_BlockSet32(B->DevInst, B->TileAddr, i,
+						Words) != XAIE_OK) {
+				Errors++;
+			}
+		}
+		BenchReport(B, "blockset32", Words, Iters, BenchNow() - Start,
+				Errors);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function measures the recording of register writes into a transaction,
+* and the submission of the recorded transaction to the backend.
+*
+* @param	B: Benchmark context.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void BenchTxn(Bench *B)
+{
+	u64 Errors = 0U, Start, Mid;
+	AieRC RC;
+
+	RC = XAie_StartTransaction(B->DevInst,
+			XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+	if(RC != XAIE_OK) {
+		BenchReport(B, "txn_record", 1U, 0U, 0U, 1U);
+		return;
+	}
+
+	Start = BenchNow();
+	for(u32 i = 0U; i < B->Iters; i++) {
+		if(XAie_Write32(B->DevInst, B->TileAddr + (i % BENCH_MAX_WORDS)
+					* 4U, i) != XAIE_OK) {
+			Errors++;
+		}
+	}
+	Mid = BenchNow();
+	BenchReport(B, "txn_record", 1U, B->Iters, Mid - Start, Errors);
+
+	RC = XAie_SubmitTransaction(B->DevInst, NULL);
+	BenchReport(B, "txn_submit", 1U, B->Iters, BenchNow() - Mid,
+			(RC != XAIE_OK) ? 1U : 0U);
+}
+
+static void BenchUsage(const char *Prog)
+{
+	fprintf(stderr, "Usage: %s [-b linux|metal|baremetal|sim|socket|"
+			"debug] [-g aie|aieml] [-n iterations] [-o file]\n",
+			Prog);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the AIE driver IO benchmarks.
+*
+* @param	argc: Number of arguments.
+* @param	argv: Arguments, see the usage above.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+	XAie_IORecord *Records = NULL;
+	XAie_IORecordRing Ring;
+	u8 DevGen = XAIE_DEV_GEN_AIEML;
+	int BackendIdx = -1, Opt;
+	Bench B;
+	AieRC RC;
+
+	memset(&B, 0, sizeof(B));
+	B.Backend = "default";
+	B.Out = stdout;
+	B.Iters = BENCH_DEF_ITERS;
+
+	while((Opt = getopt(argc, argv, "b:g:n:o:")) != -1) {
+		switch(Opt) {
+		case 'b':
+			for(u32 i = 0U; i < sizeof(BenchBackends) /
+					sizeof(BenchBackends[0]); i++) {
+				if(strcmp(optarg, BenchBackends[i].Name) == 0) {
+					BackendIdx = (int)i;
+				}
+			}
+			if(BackendIdx < 0) {
+				BenchUsage(argv[0]);
+				return -1;
+			}
+			B.Backend = BenchBackends[BackendIdx].Name;
+			break;
+		case 'g':
+			if(strcmp(optarg, "aie") == 0) {
+				DevGen = XAIE_DEV_GEN_AIE;
+			} else if(strcmp(optarg, "aieml") == 0) {
+				DevGen = XAIE_DEV_GEN_AIEML;
+			} else {
+				BenchUsage(argv[0]);
+				return -1;
+			}
+			break;
+		case 'n':
+			B.Iters = (u32)strtoul(optarg, NULL, 0);
+			if(B.Iters == 0U) {
+				BenchUsage(argv[0]);
+				return -1;
+			}
+			break;
+		case 'o':
+			B.Out = fopen(optarg, "w");
+			if(B.Out == NULL) {
+				perror("Failed to open the output file");
+				return -1;
+			}
+			break;
+		default:
+			BenchUsage(argv[0]);
+			return -1;
+		}
+	}
+
+	XAie_SetupConfig(AieConfig, XAIE_DEV_GEN_AIE, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_AIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_AIE_RES_TILE_ROW_START, XAIE_AIE_RES_TILE_NUM_ROWS,
+			XAIE_AIE_AIE_TILE_ROW_START, XAIE_AIE_AIE_TILE_NUM_ROWS);
+	XAie_SetupConfig(AieMlConfig, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_AIEML_COL_SHIFT, XAIE_AIEML_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_AIEML_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_AIEML_MEM_TILE_ROW_START,
+			XAIE_AIEML_MEM_TILE_NUM_ROWS,
+			XAIE_AIEML_AIE_TILE_ROW_START,
+			XAIE_AIEML_AIE_TILE_NUM_ROWS);
+	XAie_Config *ConfigPtr = (DevGen == XAIE_DEV_GEN_AIE) ? &AieConfig :
+		&AieMlConfig;
+
+	XAie_InstDeclare(DevInst, ConfigPtr);
+
+	RC = XAie_CfgInitialize(&DevInst, ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	if(BackendIdx >= 0) {
+		RC = XAie_SetIOBackend(&DevInst,
+				BenchBackends[BackendIdx].Type);
+		if(RC != XAIE_OK) {
+			/* The previous backend is already closed */
+			printf("Backend %s is not available.\n", B.Backend);
+			return -1;
+		}
+	}
+
+	/* Keep the debug backend from printing every access */
+	Records = (XAie_IORecord *)calloc(BENCH_RECORD_ENTRIES,
+			sizeof(*Records));
+	if(Records != NULL) {
+		Ring.Records = Records;
+		Ring.NumRecords = BENCH_RECORD_ENTRIES;
+		Ring.NumWritten = 0U;
+		if(XAie_ConfigIORecord(&DevInst, &Ring) != XAIE_OK) {
+			free(Records);
+			Records = NULL;
+		}
+	}
+
+	RC = XAie_PmRequestTiles(&DevInst, NULL, 0);
+	if(RC != XAIE_OK) {
+		printf("Failed to request tiles.\n");
+		free(Records);
+		XAie_Finish(&DevInst);
+		return -1;
+	}
+
+	B.DevInst = &DevInst;
+	B.TileAddr = ((u64)BENCH_COL << ConfigPtr->ColShift) |
+		((u64)ConfigPtr->AieTileRowStart << ConfigPtr->RowShift);
+	for(u32 i = 0U; i < BENCH_MAX_WORDS; i++) {
+		BenchBuf[i] = i;
+	}
+
+	BenchWrite32(&B);
+	BenchRead32(&B);
+	BenchMaskPollReady(&B);
+	BenchMaskPollWakeup(&B);
+	BenchBlock(&B);
+	BenchTxn(&B);
+
+	if(Records != NULL) {
+		XAie_ConfigIORecord(&DevInst, NULL);
+		free(Records);
+	}
+	XAie_Finish(&DevInst);
+	if(B.Out != stdout) {
+		fclose(B.Out);
+	}
+
+	return 0;
+}
+
+/** @} */
@@ -0,0 +1,481 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_graphload.c
+* @{
+*
+* This file contains the routines to load the configuration of a graph on a
+* partition with several threads. The configuration is split by column. Each
+* thread records the columns it takes in transactions of their own, and the
+* calling thread submits the transactions in increasing column order as soon
+* as they are recorded, so recording and submission overlap.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#endif
+
+#include "xaie_graphload.h"
+#include "xaie_helper.h"
+
+#if defined(XAIE_FEATURE_DMA_ENABLE) && \
+	defined(XAIE_FEATURE_LOCK_ENABLE) && \
+	defined(XAIE_FEATURE_SS_ENABLE) && \
+	defined(XAIE_FEATURE_ELF_ENABLE)
+
+/**************************** Type Definitions *******************************/
+/*
+ * Typedef to capture the recording of the configuration of a column.
+ */
+typedef struct {
+	XAie_TxnInst *Txn;	/* Transaction of the column, NULL if empty */
+	AieRC Status;		/* Status of the recording */
+	u8 Done;		/* XAIE_ENABLE once the column is recorded */
+} XAie_GraphLoadCol;
+
+/*
+ * Typedef to capture a graph load. The columns are handed out to the loading
+ * threads in increasing order. Once a recording or a submission fails, the
+ * remaining columns are handed out without being recorded.
+ */
+typedef struct {
+	XAie_DevInst *DevInst;
+	const XAie_GraphDesc *Desc;
+	XAie_GraphLoadCol *Cols;
+	u32 NextCol;		/* Next column to hand out */
+	u8 Abort;		/* XAIE_ENABLE once a column failed */
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+	pthread_cond_t Cond;
+#endif
+} XAie_GraphLoader;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API locks a graph load.
+*
+* @param	Loader: Graph load.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline void _XAie_GraphLoadLock(XAie_GraphLoader *Loader)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_lock(&Loader->Lock);
+#else
+	(void)Loader;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API unlocks a graph load.
+*
+* @param	Loader: Graph load.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline void _XAie_GraphLoadUnlock(XAie_GraphLoader *Loader)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_unlock(&Loader->Lock);
+#else
+	(void)Loader;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if a graph has no configuration in a column.
+*
+* @param	DevInst: Device Instance.
+* @param	Desc: Configuration of the graph.
+* @param	Col: Column of the partition.
+*
+* @return	XAIE_ENABLE if the column has no configuration, XAIE_DISABLE
+*		otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u8 _XAie_GraphColIsEmpty(XAie_DevInst *DevInst,
+		const XAie_GraphDesc *Desc, u8 Col)
+{
+	for(u32 i = 0U; i < Desc->NumElfs; i++) {
+		if(Desc->Elfs[i].Loc.Col == Col) {
+			return XAIE_DISABLE;
+		}
+	}
+
+	for(u32 i = 0U; i < Desc->NumLocks; i++) {
+		if(Desc->Locks[i].Loc.Col == Col) {
+			return XAIE_DISABLE;
+		}
+	}
+
+	for(u32 i = 0U; i < Desc->NumBds; i++) {
+		if(Desc->Bds[i].Loc.Col == Col) {
+			return XAIE_DISABLE;
+		}
+	}
+
+	for(u32 i = 0U; i < Desc->NumRoutes; i++) {
+		const XAie_StrmRoute *Route = &Desc->Routes[i];
+
+		for(u32 j = 0U; j < Route->NumRegs; j++) {
+			if((Route->Regs[j].RegAddr >>
+					DevInst->DevProp.ColShift) == Col) {
+				return XAIE_DISABLE;
+			}
+		}
+	}
+
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records the configuration of a graph in a column into a transaction
+* of the calling thread. The elfs are loaded first, then the locks are set,
+* the BDs written and the routes applied.
+*
+* @param	DevInst: Device Instance.
+* @param	Desc: Configuration of the graph.
+* @param	Col: Column of the partition.
+* @param	Txn: Pointer to return the detached transaction, NULL if the
+*		column has no configuration.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_GraphLoadColumn(XAie_DevInst *DevInst,
+		const XAie_GraphDesc *Desc, u8 Col, XAie_TxnInst **Txn)
+{
+	AieRC RC;
+
+	*Txn = NULL;
+	if(_XAie_GraphColIsEmpty(DevInst, Desc, Col) == XAIE_ENABLE) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_Txn_Start(DevInst, XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	for(u32 i = 0U; (i < Desc->NumElfs) && (RC == XAIE_OK); i++) {
+		const XAie_GraphElf *Elf = &Desc->Elfs[i];
+
+		if(Elf->Loc.Col == Col) {
+			RC = XAie_LoadElfImage(DevInst, Elf->Image, &Elf->Loc,
+					1U);
+		}
+	}
+
+	for(u32 i = 0U; (i < Desc->NumLocks) && (RC == XAIE_OK); i++) {
+		const XAie_LockReq *Lock = &Desc->Locks[i];
+
+		if(Lock->Loc.Col == Col) {
+			RC = XAie_LockSetValue(DevInst, Lock->Loc, Lock->Lock);
+		}
+	}
+
+	for(u32 i = 0U; (i < Desc->NumBds) && (RC == XAIE_OK); i++) {
+		const XAie_DmaBdWrite *Bd = &Desc->Bds[i];
+
+		if(Bd->Loc.Col == Col) {
+			RC = XAie_DmaWriteBd(DevInst, Bd->DmaDesc, Bd->Loc,
+					Bd->BdNum);
+		}
+	}
+
+	for(u32 i = 0U; (i < Desc->NumRoutes) && (RC == XAIE_OK); i++) {
+		const XAie_StrmRoute *Route = &Desc->Routes[i];
+
+		for(u32 j = 0U; (j < Route->NumRegs) && (RC == XAIE_OK); j++) {
+			if((Route->Regs[j].RegAddr >>
+					DevInst->DevProp.ColShift) == Col) {
+				RC = XAie_Write32(DevInst,
+						Route->Regs[j].RegAddr,
+						Route->Regs[j].RegVal);
+			}
+		}
+	}
+
+	*Txn = _XAie_TxnDetach(DevInst);
+	if(*Txn == NULL) {
+		return XAIE_ERR;
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to record configuration of column %u\n",
+				Col);
+		_XAie_TxnFree(*Txn);
+		*Txn = NULL;
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records columns of a graph load until all of them are handed out.
+*
+* @param	Loader: Graph load.
+*
+* @return	None.
+*
+* @note		Internal only. Run by every loading thread.
+*
+******************************************************************************/
+static void _XAie_GraphLoadWork(XAie_GraphLoader *Loader)
+{
+	XAie_DevInst *DevInst = Loader->DevInst;
+
+	while(1) {
+		XAie_TxnInst *Txn = NULL;
+		AieRC RC = XAIE_OK;
+		u8 Abort;
+		u32 Col;
+
+		_XAie_GraphLoadLock(Loader);
+		Col = Loader->NextCol;
+		if(Col < DevInst->NumCols) {
+			Loader->NextCol++;
+		}
+		Abort = Loader->Abort;
+		_XAie_GraphLoadUnlock(Loader);
+
+		if(Col >= DevInst->NumCols) {
+			break;
+		}
+
+		if(Abort == XAIE_DISABLE) {
+			RC = _XAie_GraphLoadColumn(DevInst, Loader->Desc,
+					(u8)Col, &Txn);
+		}
+
+		_XAie_GraphLoadLock(Loader);
+		Loader->Cols[Col].Txn = Txn;
+		Loader->Cols[Col].Status = RC;
+		Loader->Cols[Col].Done = XAIE_ENABLE;
+		if(RC != XAIE_OK) {
+			Loader->Abort = XAIE_ENABLE;
+		}
+#ifndef __AIEBAREMETAL__
+		pthread_cond_broadcast(&Loader->Cond);
+#endif
+		_XAie_GraphLoadUnlock(Loader);
+	}
+}
+
+#ifndef __AIEBAREMETAL__
+/*****************************************************************************/
+/**
+*
+* This is the thread function of the loading threads.
+*
+* @param	Arg: Pointer to the graph load.
+*
+* @return	NULL.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void *_XAie_GraphLoadWorker(void *Arg)
+{
+	_XAie_GraphLoadWork((XAie_GraphLoader *)Arg);
+
+	return NULL;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API checks the configuration of a graph.
+*
+* @param	Desc: Configuration of the graph.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_GraphDescCheck(const XAie_GraphDesc *Desc)
+{
+	if(((Desc->NumElfs != 0U) && (Desc->Elfs == XAIE_NULL)) ||
+			((Desc->NumLocks != 0U) && (Desc->Locks == XAIE_NULL)) ||
+			((Desc->NumBds != 0U) && (Desc->Bds == XAIE_NULL)) ||
+			((Desc->NumRoutes != 0U) &&
+			 (Desc->Routes == XAIE_NULL))) {
+		XAIE_ERROR("Invalid graph description\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < Desc->NumRoutes; i++) {
+		if(Desc->Routes[i].IsReady != XAIE_COMPONENT_IS_READY) {
+			XAIE_ERROR("Route %u of the graph is not compiled\n",
+					i);
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API loads the configuration of a graph on the partition with several
+* threads. The configuration is split by column: the elfs, locks and BDs by
+* the column of their tile, the routes by the column of each of their
+* registers. Every column is recorded into a transaction of its own by one of
+* the loading threads, in the order elfs, locks, BDs and routes. The calling
+* thread submits the transactions in increasing column order, each of them as
+* soon as it is recorded, so the submission of the first columns overlaps the
+* recording of the next ones.
+*
+* @param	DevInst: Device Instance.
+* @param	Desc: Configuration of the graph.
+* @param	NumThreads: Number of loading threads. At most one thread per
+*		column is started.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The columns before the first column which fails are
+*		configured, the others are not. Without thread support
+*		(__AIEBAREMETAL__), the columns are recorded by the calling
+*		thread before they are submitted.
+*
+******************************************************************************/
+AieRC XAie_GraphLoad(XAie_DevInst *DevInst, const XAie_GraphDesc *Desc,
+		u32 NumThreads)
+{
+	XAie_GraphLoader Loader;
+	AieRC RC;
+#ifndef __AIEBAREMETAL__
+	pthread_t *Threads;
+	u32 NumStarted = 0U;
+#endif
+
+	if((DevInst == XAIE_NULL) || (Desc == XAIE_NULL) ||
+			(NumThreads == 0U) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_GraphDescCheck(Desc);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Loader.DevInst = DevInst;
+	Loader.Desc = Desc;
+	Loader.NextCol = 0U;
+	Loader.Abort = XAIE_DISABLE;
+	Loader.Cols = (XAie_GraphLoadCol *)calloc(DevInst->NumCols,
+			sizeof(*Loader.Cols));
+	if(Loader.Cols == NULL) {
+		XAIE_ERROR("Failed to allocate memory for graph load\n");
+		return XAIE_ERR;
+	}
+
+#ifndef __AIEBAREMETAL__
+	if(NumThreads > DevInst->NumCols) {
+		NumThreads = DevInst->NumCols;
+	}
+
+	pthread_mutex_init(&Loader.Lock, NULL);
+	pthread_cond_init(&Loader.Cond, NULL);
+	Threads = (pthread_t *)malloc(NumThreads * sizeof(*Threads));
+	if(Threads != NULL) {
+		while((NumStarted < NumThreads) &&
+				(pthread_create(&Threads[NumStarted], NULL,
+					_XAie_GraphLoadWorker,
+					(void *)&Loader) == 0)) {
+			NumStarted++;
+		}
+	}
+
+	/* Record all the columns here if no thread could be started */
+	if(NumStarted == 0U) {
+		XAIE_WARN("Failed to start graph loading threads\n");
+		_XAie_GraphLoadWork(&Loader);
+	}
+#else
+	(void)NumThreads;
+	_XAie_GraphLoadWork(&Loader);
+#endif
+
+	for(u32 Col = 0U; Col < DevInst->NumCols; Col++) {
+		XAie_GraphLoadCol *LoadCol = &Loader.Cols[Col];
+
+		_XAie_GraphLoadLock(&Loader);
+#ifndef __AIEBAREMETAL__
+		while(LoadCol->Done == XAIE_DISABLE) {
+			pthread_cond_wait(&Loader.Cond, &Loader.Lock);
+		}
+#endif
+		_XAie_GraphLoadUnlock(&Loader);
+
+		if(RC == XAIE_OK) {
+			RC = LoadCol->Status;
+		}
+
+		if(LoadCol->Txn == NULL) {
+			continue;
+		}
+
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, LoadCol->Txn);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Failed to submit configuration of "
+						"column %u\n", Col);
+				_XAie_GraphLoadLock(&Loader);
+				Loader.Abort = XAIE_ENABLE;
+				_XAie_GraphLoadUnlock(&Loader);
+			}
+		}
+		_XAie_TxnFree(LoadCol->Txn);
+	}
+
+#ifndef __AIEBAREMETAL__
+	for(u32 i = 0U; i < NumStarted; i++) {
+		pthread_join(Threads[i], NULL);
+	}
+	free(Threads);
+	pthread_cond_destroy(&Loader.Cond);
+	pthread_mutex_destroy(&Loader.Lock);
+#endif
+	free(Loader.Cols);
+
+	return RC;
+}
+
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_FEATURE_LOCK_ENABLE &&
+	  XAIE_FEATURE_SS_ENABLE && XAIE_FEATURE_ELF_ENABLE */
+
+/** @} */
@@ -0,0 +1,67 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_graphload.h
+* @{
+*
+* This file contains the routines to load the configuration of a graph on a
+* partition with several threads, one column at a time.
+*
+******************************************************************************/
+#ifndef XAIE_GRAPHLOAD_H
+#define XAIE_GRAPHLOAD_H
+
+/***************************** Include Files *********************************/
+#include "xaie_feature_config.h"
+#include "xaiegbl.h"
+#include "xaie_dma.h"
+#include "xaie_elfloader.h"
+#include "xaie_locks.h"
+#include "xaie_ss.h"
+
+#if defined(XAIE_FEATURE_DMA_ENABLE) && \
+	defined(XAIE_FEATURE_LOCK_ENABLE) && \
+	defined(XAIE_FEATURE_SS_ENABLE) && \
+	defined(XAIE_FEATURE_ELF_ENABLE)
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures an elf image to load on an AIE tile.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	const XAie_ElfImage *Image;
+} XAie_GraphElf;
+
+/*
+ * This typedef captures the configuration of a graph. The elfs, locks and BDs
+ * are placed in the column of their tile, the register writes of the routes
+ * in the column of their register. The locks are set to their value with
+ * XAie_LockSetValue() and the BDs written with XAie_DmaWriteBd().
+ */
+typedef struct {
+	const XAie_GraphElf *Elfs;
+	u32 NumElfs;
+	const XAie_LockReq *Locks;
+	u32 NumLocks;
+	const XAie_DmaBdWrite *Bds;
+	u32 NumBds;
+	const XAie_StrmRoute *Routes;
+	u32 NumRoutes;
+} XAie_GraphDesc;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_GraphLoad(XAie_DevInst *DevInst, const XAie_GraphDesc *Desc,
+		u32 NumThreads);
+
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_FEATURE_LOCK_ENABLE &&
+	  XAIE_FEATURE_SS_ENABLE && XAIE_FEATURE_ELF_ENABLE */
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -31,20 +31,84 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
-#include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#endif
 
+#include "xaie_dma_shadow.h"
 #include "xaie_helper.h"
+#include "xaie_shadow.h"
 
 /************************** Constant Definitions *****************************/
 #define XAIE_DEFAULT_NUM_CMDS 1024U
+#define XAIE_TXN_ARENA_MIN_SIZE 0x10000U
+#define XAIE_TXN_ARENA_ALIGN 8U
 
-#define XAIE_TXN_INSTANCE_EXPORTED	0b10U
-#define XAIE_TXN_INST_EXPORTED_MASK XAIE_TXN_INSTANCE_EXPORTED
 #define XAIE_TXN_AUTO_FLUSH_MASK XAIE_TRANSACTION_ENABLE_AUTO_FLUSH
+#define XAIE_TXN_OPTIMIZE_MASK XAIE_TRANSACTION_ENABLE_OPTIMIZE
+#define XAIE_TXN_SHARE_PAYLOADS_MASK XAIE_TRANSACTION_SHARE_PAYLOADS
+
+#define XAIE_TXN_MIN_COALESCE_CMDS 2U
+
+#ifndef __AIEBAREMETAL__
+#define XAIE_THREAD_LOCAL _Thread_local
+#else
+#define XAIE_THREAD_LOCAL
+#endif
+
+/**************************** Type Definitions *******************************/
+/*
+ * Locks of the transaction list and of the transaction hash buckets. A thread
+ * only inserts and removes its own transaction instances and only looks up
+ * the bucket of its thread id, so threads hashed to different buckets do not
+ * contend. The two locks are never held together.
+ */
+struct XAie_TxnLocks {
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t List;
+	pthread_mutex_t Bucket[XAIE_TXN_HASH_SIZE];
+#else
+	u8 Unused;
+#endif
+};
 
 /************************** Variable Definitions *****************************/
+/*
+ * Transaction instance of the last lookup of the thread. Only the thread
+ * which owns a transaction instance removes it from its device instance, so
+ * the cache is kept up to date without locking. XAie_Finish() frees the
+ * instances of all the threads, it renews the generation of the transaction
+ * list so that the caches of the other threads no longer match.
+ */
+static XAIE_THREAD_LOCAL struct {
+	const XAie_DevInst *DevInst;
+	XAie_TxnInst *Inst;
+	u32 Gen;
+} TxnLookupCache;
+
+/*
+ * Last generation given to a transaction list. Generations are unique in the
+ * process, so a device instance initialized again at the same address does
+ * not match the caches of its previous life.
+ */
+static u32 _XAie_TxnGenLast;
+
+/*
+ * Modules of each tile type as bits of XAie_ModuleType. Locations without a
+ * tile type are not restricted here, they are reported by the callers.
+ */
+static const u8 XAie_TileTypeModules[XAIEGBL_TILE_TYPE_MAX + 1U] = {
+	[XAIEGBL_TILE_TYPE_AIETILE] = (1U << XAIE_MEM_MOD) |
+		(1U << XAIE_CORE_MOD),
+	[XAIEGBL_TILE_TYPE_SHIMNOC] = (1U << XAIE_PL_MOD),
+	[XAIEGBL_TILE_TYPE_SHIMPL] = (1U << XAIE_PL_MOD),
+	[XAIEGBL_TILE_TYPE_MEMTILE] = (1U << XAIE_MEM_MOD),
+	[XAIEGBL_TILE_TYPE_MAX] = (1U << XAIE_MEM_MOD) |
+		(1U << XAIE_CORE_MOD) | (1U << XAIE_PL_MOD),
+};
+
 /***************************** Macro Definitions *****************************/
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
@@ -63,7 +127,12 @@
 ******************************************************************************/
 u8 _XAie_GetTileTypefromLoc(XAie_DevInst *DevInst, XAie_LocType Loc)
 {
-	u8 ColType;
+	u8 ColType, TileType;
+
+	TileType = _XAie_LookupTileType(DevInst, Loc);
+	if(TileType != XAIEGBL_TILE_TYPE_MAX) {
+		return TileType;
+	}
 
 	if(Loc.Col >= DevInst->NumCols) {
 		XAIE_ERROR("Invalid column: %d\n", Loc.Col);
@@ -93,6 +162,119 @@ u8 _XAie_GetTileTypefromLoc(XAie_DevInst *DevInst, XAie_LocType Loc)
 	return XAIEGBL_TILE_TYPE_MAX;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function builds the table of the tile types of the partition, so that
+* the tile type of a location is resolved with a single load.
+*
+* @param	DevInst: Device Instance
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal API only. The partition location, the size and the
+*		device ops of the instance have to be set up.
+*
+******************************************************************************/
+AieRC _XAie_TileTypesInit(XAie_DevInst *DevInst)
+{
+	u8 *TileTypes;
+
+	TileTypes = (u8 *)malloc((u32)DevInst->NumCols * DevInst->NumRows);
+	if(TileTypes == NULL) {
+		XAIE_ERROR("Failed to allocate memory for tile types\n");
+		return XAIE_ERR;
+	}
+
+	for(u8 C = 0U; C < DevInst->NumCols; C++) {
+		for(u8 R = 0U; R < DevInst->NumRows; R++) {
+			TileTypes[(u32)C * DevInst->NumRows + R] =
+				DevInst->DevOps->GetTTypefromLoc(DevInst,
+						XAie_TileLoc(C, R));
+		}
+	}
+
+	DevInst->TileTypes = TileTypes;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function frees the table of the tile types of the partition.
+*
+* @param	DevInst: Device Instance
+*
+* @return	None.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+void _XAie_TileTypesFinish(XAie_DevInst *DevInst)
+{
+	free(DevInst->TileTypes);
+	DevInst->TileTypes = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function allocates the bitmaps which track the tiles, memory modules
+* and core modules in use by the partition. The bitmaps are owned by the
+* device instance so that partitions do not share any state.
+*
+* @param	DevInst: Device Instance
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal API only. Bits are indexed with
+*		_XAie_GetTileBitPosFromLoc(). A request may set up to NumRows
+*		bits past the bit of its last tile, which is covered by one
+*		extra column.
+*
+******************************************************************************/
+AieRC _XAie_TileBitmapsInit(XAie_DevInst *DevInst)
+{
+	u32 NumWords;
+	u32 *Bitmaps;
+
+	NumWords = ((u32)(DevInst->NumCols + 1U) * DevInst->NumRows +
+			(sizeof(u32) * 8U) - 1U) / (sizeof(u32) * 8U);
+	Bitmaps = (u32 *)calloc(3U * NumWords, sizeof(u32));
+	if(Bitmaps == NULL) {
+		XAIE_ERROR("Failed to allocate memory for tile bitmaps\n");
+		return XAIE_ERR;
+	}
+
+	DevInst->TilesInUse = Bitmaps;
+	DevInst->MemInUse = Bitmaps + NumWords;
+	DevInst->CoreInUse = Bitmaps + 2U * NumWords;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function frees the bitmaps of the tiles, memory modules and core
+* modules in use by the partition.
+*
+* @param	DevInst: Device Instance
+*
+* @return	None.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+void _XAie_TileBitmapsFinish(XAie_DevInst *DevInst)
+{
+	free(DevInst->TilesInUse);
+	DevInst->TilesInUse = NULL;
+	DevInst->MemInUse = NULL;
+	DevInst->CoreInUse = NULL;
+}
+
 /*****************************************************************************/
 /**
 * This function is used to check for module and tiletype combination.
@@ -114,20 +296,9 @@ AieRC _XAie_CheckModule(XAie_DevInst *DevInst,
 {
 	u8 TileType;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	if(TileType == XAIEGBL_TILE_TYPE_AIETILE && Module > XAIE_CORE_MOD) {
-		XAIE_ERROR("Invalid Module\n");
-		return XAIE_INVALID_ARGS;
-	}
-
-	if((TileType == XAIEGBL_TILE_TYPE_SHIMPL ||
-	    TileType == XAIEGBL_TILE_TYPE_SHIMNOC) && Module != XAIE_PL_MOD) {
-		XAIE_ERROR("Invalid Module\n");
-		return XAIE_INVALID_ARGS;
-	}
-
-	if(TileType == XAIEGBL_TILE_TYPE_MEMTILE &&
-		Module != XAIE_MEM_MOD) {
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(((u32)Module > (u32)XAIE_PL_MOD) ||
+			((XAie_TileTypeModules[TileType] & (1U << Module)) == 0U)) {
 		XAIE_ERROR("Invalid Module\n");
 		return XAIE_INVALID_ARGS;
 	}
@@ -320,7 +491,7 @@ u32 _XAie_GetFatalGroupErrors(XAie_DevInst *DevInst, XAie_LocType Loc,
 	u8 TileType;
 	const XAie_EvntMod *EvntMod;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(Module == XAIE_PL_MOD) {
 		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
 	} else {
@@ -330,16 +501,6 @@ u32 _XAie_GetFatalGroupErrors(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return EvntMod->DefaultGroupErrorMask;
 }
 
-void XAie_Log(FILE *Fd, const char *prefix, const char *func, u32 line,
-		const char *Format, ...)
-{
-	va_list ArgPtr;
-	va_start(ArgPtr, Format);
-	fprintf(Fd, "%s %s():%d: ", prefix, func, line);
-	vfprintf(Fd, Format, ArgPtr);
-	va_end(ArgPtr);
-}
-
 /*****************************************************************************/
 /**
 * This is an internal API to get bit position corresponding to tile location in
@@ -405,283 +566,942 @@ void _XAie_ClrBitInBitmap(u32 *Bitmap, u32 StartBit, u32 NumBit)
 
 /*****************************************************************************/
 /**
-* This API inserts a transaction node to the linked list.
+* This API returns the mask of the bits of a bitmap word which are in a range
+* of bits.
 *
-* @param        DevInst: Device Instance
-* @param        TxnNode: Pointer to the transaction node to be inserted
+* @param        Bit: First bit of the range in the word
+* @param        NumBit: Number of bits of the range, at most 32 - Bit % 32
 *
-* @return       None
+* @return       Mask of the bits in the word.
 *
 * @note         Internal only.
 *
 ******************************************************************************/
-static void _XAie_AppendTxnInstToList(XAie_DevInst *DevInst, XAie_TxnInst *Inst)
+static inline u32 _XAie_BitmapWordMask(u32 Bit, u32 NumBit)
 {
-	XAie_List *Node = &DevInst->TxnList;
-
-	while(Node->Next != NULL) {
-		Node = Node->Next;
-	}
+	u32 Mask = (NumBit == 32U) ? 0xFFFFFFFFU : ((1U << NumBit) - 1U);
 
-	Node->Next = &Inst->Node;
-	Inst->Node.Next = NULL;
+	return Mask << (Bit % 32U);
 }
 
 /*****************************************************************************/
 /**
-* This API returns the transaction list from the linked list based on the thread
-* id.
+* This API sets given number of bits from given start bit in a bitmap which
+* threads configuring different columns update concurrently. Each word is
+* updated atomically, so bits set in the same word by other threads are kept.
 *
-* @param        DevInst: Device instance pointer
-* @param	Tid: Thread id.
+* @param        Bitmap: bitmap to be set
+* @param        StartBit: Bit position in the bitmap
+* @param        NumBit: Number of bits to be set.
 *
-* @return       Pointer to transaction instance on success and NULL on failure
+* @return       None
 *
-* @note         Internal only.
+* @note         This API is internal, hence all the argument checks are taken
+*               care of in the caller API.
 *
 ******************************************************************************/
-static XAie_TxnInst *_XAie_GetTxnInst(XAie_DevInst *DevInst, u64 Tid)
+void _XAie_SetBitInBitmapAtomic(u32 *Bitmap, u32 StartBit, u32 NumBit)
 {
-	XAie_List *NodePtr = DevInst->TxnList.Next;
-	XAie_TxnInst *TxnInst;
+	u32 i = StartBit;
 
-	while(NodePtr != NULL) {
-		TxnInst = XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst, Node);
-		if(TxnInst->Tid == Tid) {
-			return TxnInst;
+	while(i < StartBit + NumBit) {
+		u32 Bits = 32U - i % 32U;
+
+		if(Bits > StartBit + NumBit - i) {
+			Bits = StartBit + NumBit - i;
 		}
 
-		NodePtr = NodePtr->Next;
+		__atomic_fetch_or(&Bitmap[i / 32U],
+				_XAie_BitmapWordMask(i, Bits),
+				__ATOMIC_RELAXED);
+		i += Bits;
 	}
-
-	return NULL;
 }
 
 /*****************************************************************************/
 /**
-* This API removes a node from the linked list if the thread id is found.
+* This API clears given number of bits from given start bit in a bitmap which
+* threads configuring different columns update concurrently. Each word is
+* updated atomically, so bits set in the same word by other threads are kept.
 *
-* @param        DevInst: Device instance pointer
-* @param	Tid: Thread id.
+* @param        Bitmap: bitmap to be cleared
+* @param        StartBit: Bit position in the bitmap
+* @param        NumBit: Number of bits to be cleared.
 *
-* @return       XAIE_OK on success and error code on failure.
+* @return       None
 *
-* @note         Internal only.
+* @note         This API is internal, hence all the argument checks are taken
+*               care of in the caller API.
 *
 ******************************************************************************/
-static AieRC _XAie_RemoveTxnInstFromList(XAie_DevInst *DevInst, u64 Tid)
+void _XAie_ClrBitInBitmapAtomic(u32 *Bitmap, u32 StartBit, u32 NumBit)
 {
-	XAie_List *NodePtr = DevInst->TxnList.Next;
-	XAie_List *Prev = &DevInst->TxnList;
-	XAie_TxnInst *Inst;
+	u32 i = StartBit;
 
-	while(NodePtr != NULL) {
-		Inst = (XAie_TxnInst *)XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst,
-				Node);
-		if(Inst->Tid == Tid) {
-			break;
-		}
+	while(i < StartBit + NumBit) {
+		u32 Bits = 32U - i % 32U;
 
-		Prev = NodePtr;
-		NodePtr = NodePtr->Next;
-	}
+		if(Bits > StartBit + NumBit - i) {
+			Bits = StartBit + NumBit - i;
+		}
 
-	if(NodePtr == NULL) {
-		XAIE_ERROR("Cannot find node to delete from list\n");
-		return XAIE_ERR;
-	} else {
-		Prev->Next = NodePtr->Next;
+		__atomic_fetch_and(&Bitmap[i / 32U],
+				~_XAie_BitmapWordMask(i, Bits),
+				__ATOMIC_RELAXED);
+		i += Bits;
 	}
-
-	return XAIE_OK;
 }
 
 /*****************************************************************************/
 /**
-* This API rellaocates the command buffer associated with the given transaction
-* instance. The command buffer is extended to accomodate an additional
-* XAIE_DEFAULT_NUM_CMDS number of commands.
+* This API computes the index of the transaction hash bucket for a thread id.
 *
-* @param        TxnInst: Pointer to the transaction instance
+* @param        Tid: Thread id.
 *
-* @return       XAIE_OK on success and XAIE_ERR on failure
+* @return       Bucket index in the range [0, XAIE_TXN_HASH_SIZE).
+*
+* @note         Internal only. Thread ids are usually aligned pointers, so a
+*		multiplicative hash is used to spread them across the buckets.
+*
+******************************************************************************/
+static inline u32 _XAie_TxnHash(u64 Tid)
+{
+	return (u32)((Tid * 0x9E3779B97F4A7C15ULL) >>
+			(64U - XAIE_TXN_HASH_BITS));
+}
+
+/*****************************************************************************/
+/**
+* This API returns a new generation for a transaction list.
+*
+* @return       Generation, never 0.
 *
 * @note         Internal only.
 *
 ******************************************************************************/
-static AieRC _XAie_ReallocCmdBuf(XAie_TxnInst *TxnInst)
+static u32 _XAie_TxnNewGen(void)
 {
-	TxnInst->CmdBuf = (XAie_TxnCmd *)realloc((void *)TxnInst->CmdBuf,
-			sizeof(XAie_TxnCmd) *
-			(TxnInst->MaxCmds + XAIE_DEFAULT_NUM_CMDS));
-	if(TxnInst->CmdBuf == NULL) {
-		XAIE_ERROR("Failed reallocate memory for transaction buffer "
-				"with id: %d\n", TxnInst->Tid);
-		return XAIE_ERR;
-	}
+	u32 Gen;
 
-	TxnInst->MaxCmds += XAIE_DEFAULT_NUM_CMDS;
+	do {
+		Gen = __atomic_add_fetch(&_XAie_TxnGenLast, 1U,
+				__ATOMIC_RELAXED);
+	} while(Gen == 0U);
 
-	return XAIE_OK;
+	return Gen;
 }
 
 /*****************************************************************************/
 /**
+* This API allocates the locks of the transaction list of a device instance
+* and gives the list its first generation.
 *
-* This api allocates the memory to store the IO transaction commands
-* when the driver is configured to execute in transaction mode.
-*
-* @param	DevInst - Device instance pointer.
-* @param	Flags - Flags passed by the user.
+* @param        DevInst: Device Instance
 *
-* @return	Pointer to transaction instance on success and NULL on error.
+* @return       XAIE_OK on success, XAIE_ERR if the allocation failed.
 *
-* @note		Internal Only.
+* @note         Internal only. No lock is allocated on baremetal.
 *
 ******************************************************************************/
-AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags)
+AieRC _XAie_TxnLocksInit(XAie_DevInst *DevInst)
 {
-	XAie_TxnInst *Inst;
-	const XAie_Backend *Backend = DevInst->Backend;
+	DevInst->TxnGen = _XAie_TxnNewGen();
 
-	Inst = (XAie_TxnInst*)malloc(sizeof(*Inst));
-	if(Inst == NULL) {
-		XAIE_ERROR("Failed to allocate memory for txn instance\n");
-		return XAIE_ERR;
-	}
+#ifndef __AIEBAREMETAL__
+	struct XAie_TxnLocks *Locks;
 
-	Inst->CmdBuf = (XAie_TxnCmd*)calloc(XAIE_DEFAULT_NUM_CMDS,
-			sizeof(*Inst->CmdBuf));
-	if(Inst->CmdBuf == NULL) {
-		XAIE_ERROR("Failed to allocate memory for command buffer\n");
-		free(Inst);
+	Locks = (struct XAie_TxnLocks *)malloc(sizeof(*Locks));
+	if(Locks == NULL) {
+		XAIE_ERROR("Failed to allocate memory for txn locks\n");
 		return XAIE_ERR;
 	}
 
-	Inst->NumCmds = 0U;
-	Inst->MaxCmds = XAIE_DEFAULT_NUM_CMDS;
-	Inst->Tid = Backend->Ops.GetTid();
-
-	XAIE_DBG("Transaction buffer allocated with id: %ld\n", Inst->Tid);
-	Inst->Flags = Flags;
-	if(Flags & XAIE_TXN_AUTO_FLUSH_MASK) {
-		XAIE_DBG("Auto flush is enabled for transaction buffer with "
-				"id: %ld\n", Inst->Tid);
-	} else {
-		XAIE_DBG("Auto flush is disabled for transaction buffer with "
-				"id: %ld\n", Inst->Tid);
+	pthread_mutex_init(&Locks->List, NULL);
+	for(u32 i = 0U; i < XAIE_TXN_HASH_SIZE; i++) {
+		pthread_mutex_init(&Locks->Bucket[i], NULL);
 	}
-
-	_XAie_AppendTxnInstToList(DevInst, Inst);
+	DevInst->TxnLocks = Locks;
+#else
+	DevInst->TxnLocks = NULL;
+#endif
 
 	return XAIE_OK;
 }
 
 /*****************************************************************************/
 /**
-* This API decodes the command type and executes the IO operation.
+* This API releases the locks of the transaction list of a device instance.
 *
-* @param        DevInst: Device instance pointer
-* @param        Cmd: Pointer to the transaction command structure
-* @param	Flags: Transaction instance flags
+* @param        DevInst: Device Instance
 *
-* @return       XAIE_OK on success and XAIE_ERR on failure.
+* @return       None
 *
 * @note         Internal only.
 *
 ******************************************************************************/
-static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd,
-		u32 Flags)
+void _XAie_TxnLocksFinish(XAie_DevInst *DevInst)
 {
-	AieRC RC;
-	const XAie_Backend *Backend = DevInst->Backend;
-
-	switch(Cmd->Opcode)
-	{
-		case XAIE_IO_WRITE:
-			if(!Cmd->Mask) {
-				RC = Backend->Ops.Write32((void*)DevInst->IOInst,
-						Cmd->RegOff, Cmd->Value);
-			} else {
-
-				RC = Backend->Ops.MaskWrite32((void*)DevInst->IOInst,
-							Cmd->RegOff, Cmd->Mask,
-							Cmd->Value);
-			}
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("Wr failed. Addr: 0x%lx, Mask: 0x%x,"
-						"Value: 0x%x\n", Cmd->RegOff,
-						Cmd->Mask, Cmd->Value);
-				return RC;
-			}
-			break;
-		case XAIE_IO_BLOCKWRITE:
-			RC = Backend->Ops.BlockWrite32((void *)DevInst->IOInst,
-					Cmd->RegOff,
-					(u32 *)(uintptr_t)Cmd->DataPtr,
-					Cmd->Size);
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("Block Wr failed. Addr: 0x%lx\n",
-						Cmd->RegOff);
-				return RC;
-			}
+#ifndef __AIEBAREMETAL__
+	struct XAie_TxnLocks *Locks = DevInst->TxnLocks;
 
-			if(!(Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
-				free((void *)Cmd->DataPtr);
-			}
-			break;
-		case XAIE_IO_BLOCKSET:
-			RC = Backend->Ops.BlockSet32((void *)DevInst->IOInst,
-					Cmd->RegOff, Cmd->Value,
-					Cmd->Size);
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("Block Wr failed. Addr: 0x%lx\n",
-						Cmd->RegOff);
-				return RC;
-			}
-			break;
-		default:
-			XAIE_ERROR("Invalid transaction opcode\n");
-			return XAIE_ERR;
+	if(Locks == NULL) {
+		return;
 	}
 
-	return XAIE_OK;
+	pthread_mutex_destroy(&Locks->List);
+	for(u32 i = 0U; i < XAIE_TXN_HASH_SIZE; i++) {
+		pthread_mutex_destroy(&Locks->Bucket[i]);
+	}
+	free(Locks);
+#endif
+	DevInst->TxnLocks = NULL;
 }
 
 /*****************************************************************************/
 /**
-* This API executes all the commands in the command buffer and resets the number
-* of commands.
+* This API locks the transaction list of a device instance.
 *
-* @param        DevInst: Device instance pointer
-* @param        TxnInst: Pointer to the transaction instance
+* @param        DevInst: Device Instance
 *
-* @return       XAIE_OK on success and XAIE_ERR on failure
+* @return       None
 *
-* @note         Internal only. This API does not allocate, reallocate or free
-*		any buffer.
+* @note         Internal only.
 *
 ******************************************************************************/
-static AieRC _XAie_Txn_FlushCmdBuf(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+static inline void _XAie_TxnListLock(XAie_DevInst *DevInst)
 {
-	AieRC RC;
-	const XAie_Backend *Backend = DevInst->Backend;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_lock(&DevInst->TxnLocks->List);
+#else
+	(void)DevInst;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* This API unlocks the transaction list of a device instance.
+*
+* @param        DevInst: Device Instance
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline void _XAie_TxnListUnlock(XAie_DevInst *DevInst)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_unlock(&DevInst->TxnLocks->List);
+#else
+	(void)DevInst;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* This API locks a transaction hash bucket of a device instance.
+*
+* @param        DevInst: Device Instance
+* @param        Idx: Index of the bucket
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline void _XAie_TxnBucketLock(XAie_DevInst *DevInst, u32 Idx)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_lock(&DevInst->TxnLocks->Bucket[Idx]);
+#else
+	(void)DevInst;
+	(void)Idx;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* This API unlocks a transaction hash bucket of a device instance.
+*
+* @param        DevInst: Device Instance
+* @param        Idx: Index of the bucket
+*
+* @return       None
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline void _XAie_TxnBucketUnlock(XAie_DevInst *DevInst, u32 Idx)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_unlock(&DevInst->TxnLocks->Bucket[Idx]);
+#else
+	(void)DevInst;
+	(void)Idx;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a device instance has no transaction instance. It is
+* called for every register access, so it does not lock the list. The head of
+* the list is accessed atomically, a thread which has a transaction instance
+* always finds the list not empty.
+*
+* @param        DevInst: Device Instance
+*
+* @return       XAIE_ENABLE if the list is empty, XAIE_DISABLE otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline u8 _XAie_TxnListIsEmpty(XAie_DevInst *DevInst)
+{
+	if(__atomic_load_n(&DevInst->TxnList.Next, __ATOMIC_RELAXED) == NULL) {
+		return XAIE_ENABLE;
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API inserts a transaction node to the linked list.
+*
+* @param        DevInst: Device Instance
+* @param        TxnNode: Pointer to the transaction node to be inserted
+*
+* @return       None
+*
+* @note         Internal only. The transaction instance belongs to the calling
+*		thread.
+*
+******************************************************************************/
+static void _XAie_AppendTxnInstToList(XAie_DevInst *DevInst, XAie_TxnInst *Inst)
+{
+	u32 Idx = _XAie_TxnHash(Inst->Tid);
+	XAie_List *Node = &DevInst->TxnList;
+	XAie_List *Bucket = &DevInst->TxnHash[Idx];
+
+	Inst->Node.Next = NULL;
+	_XAie_TxnListLock(DevInst);
+	while(Node->Next != NULL) {
+		Node = Node->Next;
+	}
+	__atomic_store_n(&Node->Next, &Inst->Node, __ATOMIC_RELAXED);
+	_XAie_TxnListUnlock(DevInst);
+
+	_XAie_TxnBucketLock(DevInst, Idx);
+	Inst->HashNode.Next = Bucket->Next;
+	Bucket->Next = &Inst->HashNode;
+	_XAie_TxnBucketUnlock(DevInst, Idx);
+
+	TxnLookupCache.DevInst = DevInst;
+	TxnLookupCache.Inst = Inst;
+	TxnLookupCache.Gen = DevInst->TxnGen;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the transaction list from the linked list based on the thread
+* id.
+*
+* @param        DevInst: Device instance pointer
+* @param	Tid: Thread id.
+*
+* @return       Pointer to transaction instance on success and NULL on failure
+*
+* @note         Internal only. The instance of the last lookup of the calling
+*		thread is checked first if the transaction list has not been
+*		freed since, after which only the hash bucket of the thread id
+*		is searched.
+*
+******************************************************************************/
+static XAie_TxnInst *_XAie_GetTxnInst(XAie_DevInst *DevInst, u64 Tid)
+{
+	u32 Idx;
+	XAie_List *NodePtr;
+	XAie_TxnInst *TxnInst = NULL;
+
+	if((TxnLookupCache.DevInst == DevInst) &&
+			(TxnLookupCache.Gen == DevInst->TxnGen) &&
+			(TxnLookupCache.Inst->Tid == Tid)) {
+		return TxnLookupCache.Inst;
+	}
+
+	Idx = _XAie_TxnHash(Tid);
+	_XAie_TxnBucketLock(DevInst, Idx);
+	NodePtr = DevInst->TxnHash[Idx].Next;
+	while(NodePtr != NULL) {
+		XAie_TxnInst *Inst = XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst,
+				HashNode);
+
+		if(Inst->Tid == Tid) {
+			TxnInst = Inst;
+			break;
+		}
+
+		NodePtr = NodePtr->Next;
+	}
+	_XAie_TxnBucketUnlock(DevInst, Idx);
+
+	if(TxnInst != NULL) {
+		TxnLookupCache.DevInst = DevInst;
+		TxnLookupCache.Inst = TxnInst;
+		TxnLookupCache.Gen = DevInst->TxnGen;
+	}
+
+	return TxnInst;
+}
+
+/*****************************************************************************/
+/**
+* This API removes a node from the linked list if the thread id is found.
+*
+* @param        DevInst: Device instance pointer
+* @param	Tid: Thread id.
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only. The thread id is the one of the calling thread.
+*
+******************************************************************************/
+static AieRC _XAie_RemoveTxnInstFromList(XAie_DevInst *DevInst, u64 Tid)
+{
+	u32 Idx = _XAie_TxnHash(Tid);
+	XAie_List *NodePtr, *Prev;
+	XAie_TxnInst *Inst = NULL;
+
+	_XAie_TxnListLock(DevInst);
+	Prev = &DevInst->TxnList;
+	NodePtr = Prev->Next;
+	while(NodePtr != NULL) {
+		Inst = (XAie_TxnInst *)XAIE_CONTAINER_OF(NodePtr, XAie_TxnInst,
+				Node);
+		if(Inst->Tid == Tid) {
+			__atomic_store_n(&Prev->Next, NodePtr->Next,
+					__ATOMIC_RELAXED);
+			break;
+		}
+
+		Prev = NodePtr;
+		NodePtr = NodePtr->Next;
+	}
+	_XAie_TxnListUnlock(DevInst);
+
+	if(NodePtr == NULL) {
+		XAIE_ERROR("Cannot find node to delete from list\n");
+		return XAIE_ERR;
+	}
+
+	_XAie_TxnBucketLock(DevInst, Idx);
+	Prev = &DevInst->TxnHash[Idx];
+	while(Prev->Next != NULL) {
+		if(Prev->Next == &Inst->HashNode) {
+			Prev->Next = Inst->HashNode.Next;
+			break;
+		}
+
+		Prev = Prev->Next;
+	}
+	_XAie_TxnBucketUnlock(DevInst, Idx);
+
+	if(TxnLookupCache.Inst == Inst) {
+		TxnLookupCache.DevInst = NULL;
+		TxnLookupCache.Inst = NULL;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API rellaocates the command buffer associated with the given transaction
+* instance. The capacity of the command buffer is doubled every time, so the
+* number of reallocations grows logarithmically with the number of commands.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_ReallocCmdBuf(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnCmd *CmdBuf;
+	u32 MaxCmds = TxnInst->MaxCmds * 2U;
+
+	CmdBuf = (XAie_TxnCmd *)realloc((void *)TxnInst->CmdBuf,
+			sizeof(XAie_TxnCmd) * MaxCmds);
+	if(CmdBuf == NULL) {
+		XAIE_ERROR("Failed reallocate memory for transaction buffer "
+				"with id: %d\n", TxnInst->Tid);
+		return XAIE_ERR;
+	}
+
+	TxnInst->CmdBuf = CmdBuf;
+	TxnInst->MaxCmds = MaxCmds;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API allocates space for a command payload from the payload arena of the
+* transaction instance. If the current chunk of the arena cannot hold the
+* payload, a new chunk at least twice the size of the current one is added.
+* Payloads are 8 byte aligned, so they can hold the arguments of shim DMA BD
+* and memory sync commands.
+*
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Size: Size of the payload in bytes
+*
+* @return       Pointer to the payload space on success and NULL on failure
+*
+* @note         Internal only.
+*
+******************************************************************************/
+void *_XAie_TxnArenaAlloc(XAie_TxnInst *TxnInst, u64 Size)
+{
+	XAie_TxnArena *Chunk = TxnInst->Arena;
+	u64 ChunkSize;
+	void *Ptr;
+
+	Size = (Size + XAIE_TXN_ARENA_ALIGN - 1U) &
+		~((u64)XAIE_TXN_ARENA_ALIGN - 1U);
+	if((Chunk == NULL) || (Chunk->Size - Chunk->Used < Size)) {
+		ChunkSize = XAIE_TXN_ARENA_MIN_SIZE;
+		if(Chunk != NULL) {
+			ChunkSize = Chunk->Size * 2U;
+		}
+		if(ChunkSize < Size) {
+			ChunkSize = Size;
+		}
+
+		Chunk = (XAie_TxnArena *)malloc(sizeof(*Chunk) + ChunkSize);
+		if(Chunk == NULL) {
+			XAIE_ERROR("Failed to allocate memory for transaction "
+					"payload arena\n");
+			return NULL;
+		}
+
+		Chunk->Size = ChunkSize;
+		Chunk->Used = 0U;
+		Chunk->Next = TxnInst->Arena;
+		TxnInst->Arena = Chunk;
+	}
+
+	Ptr = (void *)((u8 *)(Chunk + 1) + Chunk->Used);
+	Chunk->Used += Size;
+
+	return Ptr;
+}
+
+/*****************************************************************************/
+/**
+* This API releases all the chunks of the payload arena of a transaction
+* instance.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+void _XAie_TxnArenaFree(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnArena *Chunk = TxnInst->Arena;
+
+	while(Chunk != NULL) {
+		XAie_TxnArena *Next = Chunk->Next;
+
+		free(Chunk);
+		Chunk = Next;
+	}
+
+	TxnInst->Arena = NULL;
+}
+
+/*****************************************************************************/
+/**
+* This API empties the command buffer of a transaction instance after its
+* commands are flushed. The largest arena chunk is kept for the commands
+* recorded after the flush, all the others are released.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnResetCmdBuf(XAie_TxnInst *TxnInst)
+{
+	XAie_TxnArena *Chunk = TxnInst->Arena;
+
+	TxnInst->NumCmds = 0U;
+	if(Chunk == NULL) {
+		return;
+	}
+
+	TxnInst->Arena = Chunk->Next;
+	_XAie_TxnArenaFree(TxnInst);
+	Chunk->Next = NULL;
+	Chunk->Used = 0U;
+	TxnInst->Arena = Chunk;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api allocates the memory to store the IO transaction commands
+* when the driver is configured to execute in transaction mode.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Flags - Flags passed by the user.
+*
+* @return	Pointer to transaction instance on success and NULL on error.
+*
+* @note		Internal Only.
+*
+******************************************************************************/
+AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags)
+{
+	XAie_TxnInst *Inst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	Inst = (XAie_TxnInst*)malloc(sizeof(*Inst));
+	if(Inst == NULL) {
+		XAIE_ERROR("Failed to allocate memory for txn instance\n");
+		return XAIE_ERR;
+	}
+
+	Inst->CmdBuf = (XAie_TxnCmd*)calloc(XAIE_DEFAULT_NUM_CMDS,
+			sizeof(*Inst->CmdBuf));
+	if(Inst->CmdBuf == NULL) {
+		XAIE_ERROR("Failed to allocate memory for command buffer\n");
+		free(Inst);
+		return XAIE_ERR;
+	}
+
+	Inst->NumCmds = 0U;
+	Inst->MaxCmds = XAIE_DEFAULT_NUM_CMDS;
+	Inst->StartCol = 0U;
+	Inst->Arena = NULL;
+	Inst->Tid = Backend->Ops.GetTid();
+
+	XAIE_DBG("Transaction buffer allocated with id: %ld\n", Inst->Tid);
+	Inst->Flags = Flags;
+	if(Flags & XAIE_TXN_AUTO_FLUSH_MASK) {
+		XAIE_DBG("Auto flush is enabled for transaction buffer with "
+				"id: %ld\n", Inst->Tid);
+	} else {
+		XAIE_DBG("Auto flush is disabled for transaction buffer with "
+				"id: %ld\n", Inst->Tid);
+	}
+
+	_XAie_AppendTxnInstToList(DevInst, Inst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API decodes the command type and executes the IO operation.
+*
+* @param        DevInst: Device instance pointer
+* @param        Cmd: Pointer to the transaction command structure
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd)
+{
+	AieRC RC;
+
+	switch(Cmd->Opcode)
+	{
+		case XAIE_IO_WRITE:
+			if(!Cmd->Mask) {
+				RC = _XAie_IOWrite32(DevInst,
+						Cmd->RegOff, Cmd->Value);
+			} else {
+
+				RC = _XAie_IOMaskWrite32(DevInst,
+							Cmd->RegOff, Cmd->Mask,
+							Cmd->Value);
+			}
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Wr failed. Addr: 0x%lx, Mask: 0x%x,"
+						"Value: 0x%x\n", Cmd->RegOff,
+						Cmd->Mask, Cmd->Value);
+				return RC;
+			}
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			RC = _XAie_IOBlockWrite32(DevInst,
+					Cmd->RegOff,
+					(u32 *)(uintptr_t)Cmd->DataPtr,
+					Cmd->Size);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Block Wr failed. Addr: 0x%lx\n",
+						Cmd->RegOff);
+				return RC;
+			}
+			break;
+		case XAIE_IO_BLOCKSET:
+			RC = _XAie_IOBlockSet32(DevInst,
+					Cmd->RegOff, Cmd->Value,
+					Cmd->Size);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Block Wr failed. Addr: 0x%lx\n",
+						Cmd->RegOff);
+				return RC;
+			}
+			break;
+		case XAIE_IO_READ:
+			RC = _XAie_IORead32(DevInst,
+					Cmd->RegOff, (u32 *)(uintptr_t)Cmd->DataPtr);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Rd failed. Addr: 0x%lx\n",
+						Cmd->RegOff);
+				return RC;
+			}
+			break;
+		case XAIE_IO_MASKPOLL:
+			RC = _XAie_IOMaskPoll(DevInst,
+					Cmd->RegOff, Cmd->Mask, Cmd->Value,
+					Cmd->Size);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Mask poll failed. Addr: 0x%lx, "
+						"Mask: 0x%x, Value: 0x%x\n",
+						Cmd->RegOff, Cmd->Mask,
+						Cmd->Value);
+				return RC;
+			}
+			break;
+		case XAIE_IO_SHIMDMABD:
+			RC = DevInst->Backend->Ops.RunOp(DevInst->IOInst,
+					DevInst, XAIE_BACKEND_OP_CONFIG_SHIMDMABD,
+					(void *)(uintptr_t)Cmd->DataPtr);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Shim DMA BD failed. Addr: 0x%lx\n",
+						Cmd->RegOff);
+				return RC;
+			}
+			break;
+		case XAIE_IO_MEMSYNC:
+			RC = XAie_MemSyncBatch((const XAie_MemSyncRange *)
+					(uintptr_t)Cmd->DataPtr, 1U);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Memory sync failed\n");
+				return RC;
+			}
+			break;
+		default:
+			XAIE_ERROR("Invalid transaction opcode\n");
+			return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API folds a write command into the previous write command to the same
+* register. A plain write overrides the previous command, a mask write is
+* merged into the value and the mask of the previous command.
+*
+* @param        Prev: Previous write command to the same register
+* @param        Cmd: Write command to be folded into Prev
+*
+* @return       None.
+*
+* @note         Internal only. A mask of 0 denotes a plain write.
+*
+******************************************************************************/
+static void _XAie_TxnFoldWrite(XAie_TxnCmd *Prev, const XAie_TxnCmd *Cmd)
+{
+	if(Cmd->Mask == 0U) {
+		Prev->Value = Cmd->Value;
+		Prev->Mask = 0U;
+	} else if(Prev->Mask == 0U) {
+		Prev->Value = (Prev->Value & ~Cmd->Mask) |
+			(Cmd->Value & Cmd->Mask);
+	} else {
+		Prev->Value = (Prev->Value & Prev->Mask & ~Cmd->Mask) |
+			(Cmd->Value & Cmd->Mask);
+		Prev->Mask |= Cmd->Mask;
+		if(Prev->Mask == 0xFFFFFFFFU) {
+			Prev->Mask = 0U;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API returns the number of plain write commands starting at a given
+* command which write consecutive registers of the same tile.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+* @param        Start: Index of the first command of the run
+*
+* @return       Number of commands in the run.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u32 _XAie_TxnGetWriteRunLen(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, u32 Start)
+{
+	const XAie_TxnCmd *First = &TxnInst->CmdBuf[Start];
+	u64 TileMask = ~((1ULL << DevInst->DevProp.RowShift) - 1U);
+	u32 Len = 0U;
+
+	for(u32 i = Start; i < TxnInst->NumCmds; i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+
+		if((Cmd->Opcode != XAIE_IO_WRITE) || (Cmd->Mask != 0U) ||
+				(Cmd->RegOff != First->RegOff + 4U * Len) ||
+				((Cmd->RegOff & TileMask) !=
+				 (First->RegOff & TileMask))) {
+			break;
+		}
+		Len++;
+	}
+
+	return Len;
+}
+
+/*****************************************************************************/
+/**
+* This API runs a peephole optimization pass over the command buffer of a
+* transaction instance. Back to back writes to the same register are folded
+* into one command with the last writer winning, and runs of plain writes to
+* consecutive registers of a tile are coalesced into block writes. The command
+* buffer is compacted in place.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None.
+*
+* @note         Internal only. Only adjacent commands are merged, so the order
+*		of accesses to different registers is preserved. The pass is
+*		only enabled with XAIE_TRANSACTION_ENABLE_OPTIMIZE since
+*		registers with side effects on write must not be folded. If
+*		the payload allocation of a block write fails, the remaining
+*		writes are left as they are.
+*
+******************************************************************************/
+static void _XAie_TxnOptimize(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+{
+	u32 NumCmds = 0U;
+
+	/* Fold back to back writes to the same register */
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+
+		if((NumCmds > 0U) && (Cmd->Opcode == XAIE_IO_WRITE)) {
+			XAie_TxnCmd *Prev = &TxnInst->CmdBuf[NumCmds - 1U];
+
+			if((Prev->Opcode == XAIE_IO_WRITE) &&
+					(Prev->RegOff == Cmd->RegOff)) {
+				_XAie_TxnFoldWrite(Prev, Cmd);
+				continue;
+			}
+		}
+
+		TxnInst->CmdBuf[NumCmds++] = *Cmd;
+	}
+	TxnInst->NumCmds = NumCmds;
+
+	/* Coalesce writes to consecutive registers into block writes */
+	NumCmds = 0U;
+	for(u32 i = 0U; i < TxnInst->NumCmds;) {
+		u32 Len = _XAie_TxnGetWriteRunLen(DevInst, TxnInst, i);
+		u32 *Buf = NULL;
+
+		if(Len >= XAIE_TXN_MIN_COALESCE_CMDS) {
+			Buf = (u32 *)_XAie_TxnArenaAlloc(TxnInst,
+					sizeof(u32) * Len);
+		}
+
+		if(Buf == NULL) {
+			TxnInst->CmdBuf[NumCmds++] = TxnInst->CmdBuf[i++];
+			continue;
+		}
+
+		for(u32 j = 0U; j < Len; j++) {
+			Buf[j] = TxnInst->CmdBuf[i + j].Value;
+		}
+
+		TxnInst->CmdBuf[NumCmds].Opcode = XAIE_IO_BLOCKWRITE;
+		TxnInst->CmdBuf[NumCmds].RegOff = TxnInst->CmdBuf[i].RegOff;
+		TxnInst->CmdBuf[NumCmds].DataPtr = (u64)(uintptr_t)Buf;
+		TxnInst->CmdBuf[NumCmds].Size = Len;
+		TxnInst->CmdBuf[NumCmds].Mask = 0U;
+		NumCmds++;
+		i += Len;
+	}
+
+	XAIE_DBG("Transaction optimized from %d to %d commands\n",
+			TxnInst->NumCmds, NumCmds);
+	TxnInst->NumCmds = NumCmds;
+}
+
+/*****************************************************************************/
+/**
+* This API executes all the commands in the command buffer and resets the number
+* of commands.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and XAIE_ERR on failure
+*
+* @note         Internal only. This API does not allocate, reallocate or free
+*		any buffer, except for the block write payloads added by the
+*		optimization pass.
+*
+******************************************************************************/
+static AieRC _XAie_Txn_FlushCmdBuf(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+{
+	AieRC RC;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	if(TxnInst->Flags & XAIE_TXN_OPTIMIZE_MASK) {
+		_XAie_TxnOptimize(DevInst, TxnInst);
+	}
 
 	XAIE_DBG("Flushing %d commands from transaction buffer\n",
 			TxnInst->NumCmds);
 
 	if(Backend->Ops.SubmitTxn != NULL) {
-		return Backend->Ops.SubmitTxn(DevInst->IOInst, TxnInst);
+		RC = Backend->Ops.SubmitTxn(DevInst->IOInst, TxnInst);
+		_XAie_ShadowInvalidateAll(DevInst);
+		_XAie_BdShadowInvalidateAll(DevInst);
+		return RC;
 	}
 
 	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
-		RC = _XAie_ExecuteCmd(DevInst, &TxnInst->CmdBuf[i],
-				TxnInst->Flags);
+		RC = _XAie_ExecuteCmd(DevInst, &TxnInst->CmdBuf[i]);
 		if (RC != XAIE_OK) {
-			 return RC;
+			_XAie_ShadowInvalidateAll(DevInst);
+			_XAie_BdShadowInvalidateAll(DevInst);
+			return RC;
 		}
 	}
 
+	/* The commands bypass the shadow caches */
+	_XAie_ShadowInvalidateAll(DevInst);
+	_XAie_BdShadowInvalidateAll(DevInst);
+
 	return XAIE_OK;
 }
 
@@ -738,6 +1558,7 @@ AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
 		return RC;
 	}
 
+	_XAie_TxnArenaFree(Inst);
 	free(Inst->CmdBuf);
 	free(Inst);
 	return XAIE_OK;
@@ -745,12 +1566,46 @@ AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
 
 /*****************************************************************************/
 /**
+* This API returns the size of the payload a command keeps in the payload arena
+* of its transaction instance.
 *
-* This api copies an existing transaction instance and returns a copy of the
-* instance with all the commands for users to save the commands and use them
-* at a later point.
+* @param        Cmd: Pointer to the transaction command
 *
-* @param	DevInst - Device instance pointer.
+* @return       Size of the payload in bytes, rounded up to the alignment of
+*		the arena, 0 if the command has no payload in the arena.
+*
+* @note         Internal only. Deferred reads store to the word of the caller.
+*
+******************************************************************************/
+static u64 _XAie_TxnPayloadSize(const XAie_TxnCmd *Cmd)
+{
+	u64 Size;
+
+	switch(Cmd->Opcode) {
+	case XAIE_IO_BLOCKWRITE:
+		Size = sizeof(u32) * Cmd->Size;
+		break;
+	case XAIE_IO_SHIMDMABD:
+		Size = sizeof(XAie_ShimDmaBdArgs) + sizeof(u32) * Cmd->Size;
+		break;
+	case XAIE_IO_MEMSYNC:
+		Size = sizeof(XAie_MemSyncRange);
+		break;
+	default:
+		return 0U;
+	}
+
+	return (Size + XAIE_TXN_ARENA_ALIGN - 1U) &
+		~((u64)XAIE_TXN_ARENA_ALIGN - 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This api copies a transaction instance with its commands and payloads. The
+* copy is flagged as exported.
+*
+* @param	TmpInst - Transaction instance to copy.
 *
 * @return	Pointer to copy of transaction instance on success and NULL
 *		on error.
@@ -758,17 +1613,11 @@ AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
 * @note		Internal only.
 *
 ******************************************************************************/
-XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst)
+XAie_TxnInst* _XAie_TxnClone(const XAie_TxnInst *TmpInst)
 {
-	XAie_TxnInst *Inst, *TmpInst;
-	const XAie_Backend *Backend = DevInst->Backend;
-
-	TmpInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
-	if(TmpInst == NULL) {
-		XAIE_ERROR("Failed to get the correct transaction instance "
-				"from internal list\n");
-		return NULL;
-	}
+	XAie_TxnInst *Inst;
+	u64 PayloadSize = 0U;
+	u8 *Payload = NULL;
 
 	Inst = (XAie_TxnInst *)malloc(sizeof(*Inst));
 	if(Inst == NULL) {
@@ -788,25 +1637,41 @@ XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst)
 			(void *)TmpInst->CmdBuf,
 			TmpInst->NumCmds * sizeof(*Inst->CmdBuf));
 
+	/* Copy all the payloads into a single arena chunk */
+	Inst->Arena = NULL;
+	for(u32 i = 0U; i < TmpInst->NumCmds; i++) {
+		PayloadSize += _XAie_TxnPayloadSize(&TmpInst->CmdBuf[i]);
+	}
+
+	if(PayloadSize > 0U) {
+		Payload = (u8 *)_XAie_TxnArenaAlloc(Inst, PayloadSize);
+		if(Payload == NULL) {
+			XAIE_ERROR("Failed to allocate memory to copy "
+					"transaction payloads\n");
+			free(Inst->CmdBuf);
+			free(Inst);
+			return NULL;
+		}
+	}
+
 	for(u32 i = 0U; i < TmpInst->NumCmds; i++) {
 		XAie_TxnCmd *TmpCmd = &TmpInst->CmdBuf[i];
 		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
-		if(TmpCmd->Opcode == XAIE_IO_BLOCKWRITE) {
-			Cmd->DataPtr = (u64)(uintptr_t)malloc(
-					sizeof(u32) * TmpCmd->Size);
-			if((void *)(uintptr_t)Cmd->DataPtr == NULL) {
-				XAIE_ERROR("Failed to allocate memory to copy "
-						"command %d\n", i);
-				free(Inst->CmdBuf);
-				free(Inst);
-				return NULL;
-			}
+		u64 Size = _XAie_TxnPayloadSize(TmpCmd);
+
+		if(Size == 0U) {
+			continue;
+		}
 
-			Cmd->DataPtr = (u64)(uintptr_t)memcpy(
-					(void *)Cmd->DataPtr,
-					(void *)TmpCmd->DataPtr,
-					sizeof(u32) * TmpCmd->Size);
+		memcpy((void *)Payload, (void *)(uintptr_t)TmpCmd->DataPtr,
+				Size);
+		Cmd->DataPtr = (u64)(uintptr_t)Payload;
+		if(TmpCmd->Opcode == XAIE_IO_SHIMDMABD) {
+			XAie_ShimDmaBdArgs *Args = (XAie_ShimDmaBdArgs *)Payload;
+
+			Args->BdWords = (u32 *)(Args + 1);
 		}
+		Payload += Size;
 	}
 
 	Inst->Tid = TmpInst->Tid;
@@ -814,11 +1679,47 @@ XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst)
 	Inst->Flags |= XAIE_TXN_INSTANCE_EXPORTED;
 	Inst->NumCmds = TmpInst->NumCmds;
 	Inst->MaxCmds = TmpInst->MaxCmds;
+	Inst->StartCol = TmpInst->StartCol;
 	Inst->Node.Next = NULL;
+	Inst->HashNode.Next = NULL;
 
 	return Inst;
 }
 
+/*****************************************************************************/
+/**
+*
+* This api copies an existing transaction instance and returns a copy of the
+* instance with all the commands for users to save the commands and use them
+* at a later point.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	Pointer to copy of transaction instance on success and NULL
+*		on error.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst)
+{
+	XAie_TxnInst *TmpInst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	TmpInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
+	if(TmpInst == NULL) {
+		XAIE_ERROR("Failed to get the correct transaction instance "
+				"from internal list\n");
+		return NULL;
+	}
+
+	if(TmpInst->Flags & XAIE_TXN_OPTIMIZE_MASK) {
+		_XAie_TxnOptimize(DevInst, TmpInst);
+	}
+
+	return _XAie_TxnClone(TmpInst);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -839,20 +1740,77 @@ AieRC _XAie_TxnFree(XAie_TxnInst *Inst)
 		return XAIE_ERR;
 	}
 
-	for(u32 i = 0; i < Inst->NumCmds; i++) {
-		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
-		if((Cmd->Opcode == XAIE_IO_BLOCKWRITE) &&
-				((void *)(uintptr_t)Cmd->DataPtr != NULL)) {
-			free((void *)(uintptr_t)Cmd->DataPtr);
-		}
-	}
-
+	_XAie_TxnArenaFree(Inst);
 	free(Inst->CmdBuf);
 	free(Inst);
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This api detaches the transaction instance of the calling thread from the
+* device instance. The instance is flagged as exported, so it can be executed
+* with _XAie_Txn_Submit() from any thread and released with _XAie_TxnFree().
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	Pointer to the transaction instance on success and NULL on
+*		error.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+XAie_TxnInst* _XAie_TxnDetach(XAie_DevInst *DevInst)
+{
+	XAie_TxnInst *Inst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	Inst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
+	if(Inst == NULL) {
+		XAIE_ERROR("Failed to get the correct transaction instance "
+				"from internal list\n");
+		return NULL;
+	}
+
+	if(_XAie_RemoveTxnInstFromList(DevInst, Inst->Tid) != XAIE_OK) {
+		return NULL;
+	}
+
+	Inst->Flags |= XAIE_TXN_INSTANCE_EXPORTED;
+	Inst->Node.Next = NULL;
+	Inst->HashNode.Next = NULL;
+
+	return Inst;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api checks if the calling thread has a transaction open on the device
+* instance.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_ENABLE if a transaction is open, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+u8 _XAie_TxnIsActive(XAie_DevInst *DevInst)
+{
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	if((_XAie_TxnListIsEmpty(DevInst) == XAIE_ENABLE) ||
+			(_XAie_GetTxnInst(DevInst, Backend->Ops.GetTid()) ==
+			 NULL)) {
+		return XAIE_DISABLE;
+	}
+
+	return XAIE_ENABLE;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -877,18 +1835,144 @@ void _XAie_TxnResourceCleanup(XAie_DevInst *DevInst)
 			continue;
 		}
 
-		for(u32 i = 0; i < TxnInst->NumCmds; i++) {
-			XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
-			if((Cmd->Opcode == XAIE_IO_BLOCKWRITE) &&
-					((void *)(uintptr_t)Cmd->DataPtr != NULL)) {
-				free((void *)(uintptr_t)Cmd->DataPtr);
-			}
-		}
-
+		_XAie_TxnArenaFree(TxnInst);
 		NodePtr = NodePtr->Next;
 		free(TxnInst->CmdBuf);
 		free(TxnInst);
 	}
+
+	DevInst->TxnList.Next = NULL;
+	for(u32 i = 0U; i < XAIE_TXN_HASH_SIZE; i++) {
+		DevInst->TxnHash[i].Next = NULL;
+	}
+	DevInst->TxnGen = _XAie_TxnNewGen();
+
+	if(TxnLookupCache.DevInst == DevInst) {
+		TxnLookupCache.DevInst = NULL;
+		TxnLookupCache.Inst = NULL;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes a register through the backend unless the shadow cache
+* holds the same value for it.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset to write to.
+* @param	Value: Value to write.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BackendWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
+{
+	AieRC RC;
+	u32 Cached;
+
+	if(DevInst->BdShadow != NULL) {
+		_XAie_BdShadowInvalidate(DevInst, RegOff, 1U);
+	}
+
+	if(DevInst->Shadow == NULL) {
+		return _XAie_IOWrite32(DevInst, RegOff, Value);
+	}
+
+	if((_XAie_ShadowLookup(DevInst, RegOff, &Cached) == XAIE_ENABLE) &&
+			(Cached == Value)) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_IOWrite32(DevInst, RegOff, Value);
+	if(RC == XAIE_OK) {
+		_XAie_ShadowUpdate(DevInst, RegOff, Value);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function masks writes a register through the backend. If the shadow
+* cache holds the register, the write is elided when it does not change the
+* value and is issued as a plain write otherwise.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset to write to.
+* @param	Mask: Mask of the bits to update.
+* @param	Value: Value of the bits to update.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BackendMaskWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Mask, u32 Value)
+{
+	AieRC RC;
+	u32 Cached, RegVal;
+
+	if(DevInst->BdShadow != NULL) {
+		_XAie_BdShadowInvalidate(DevInst, RegOff, 1U);
+	}
+
+	if((DevInst->Shadow == NULL) ||
+			(_XAie_ShadowLookup(DevInst, RegOff, &Cached) ==
+			 XAIE_DISABLE)) {
+		return _XAie_IOMaskWrite32(DevInst, RegOff, Mask, Value);
+	}
+
+	RegVal = (Cached & ~Mask) | Value;
+	if(RegVal == Cached) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_IOWrite32(DevInst, RegOff, RegVal);
+	if(RC == XAIE_OK) {
+		_XAie_ShadowUpdate(DevInst, RegOff, RegVal);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads a register from the shadow cache or, if the cache does
+* not hold it, through the backend.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the register value.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BackendRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
+{
+	AieRC RC;
+
+	if(DevInst->Shadow == NULL) {
+		return _XAie_IORead32(DevInst, RegOff, Data);
+	}
+
+	if(_XAie_ShadowLookup(DevInst, RegOff, Data) == XAIE_ENABLE) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_IORead32(DevInst, RegOff, Data);
+	if(RC == XAIE_OK) {
+		_XAie_ShadowUpdate(DevInst, RegOff, *Data);
+	}
+
+	return RC;
 }
 
 AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
@@ -898,14 +1982,16 @@ AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	XAIE_IO_STATS_CALLER();
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Mask writing "
 					"to register\n");
-			return Backend->Ops.Write32((void*)(DevInst->IOInst), RegOff, Value);
+			return _XAie_BackendWrite32(DevInst, RegOff, Value);
 		}
 
 		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
@@ -923,7 +2009,7 @@ AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.Write32((void*)(DevInst->IOInst), RegOff, Value);
+	return _XAie_BackendWrite32(DevInst, RegOff, Value);
 }
 
 AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
@@ -933,14 +2019,16 @@ AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	XAIE_IO_STATS_CALLER();
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Reading "
 					"from register\n");
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+			return _XAie_BackendRead32(DevInst, RegOff, Data);
 		}
 
 		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
@@ -954,35 +2042,151 @@ AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
 				return RC;
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+			_XAie_TxnResetCmdBuf(TxnInst);
+			return _XAie_BackendRead32(DevInst, RegOff, Data);
 		} else if(TxnInst->NumCmds == 0) {
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+			return _XAie_BackendRead32(DevInst, RegOff, Data);
 		} else {
 			XAIE_ERROR("Read operation is not supported "
 					"when auto flush is disabled\n");
 			return XAIE_ERR;
 		}
 	}
-	return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+	return _XAie_BackendRead32(DevInst, RegOff, Data);
 }
 
 AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
 {
 	AieRC RC;
-	u64 Tid;
+	u64 Tid;
+	XAie_TxnInst *TxnInst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	XAIE_IO_STATS_CALLER();
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
+		Tid = Backend->Ops.GetTid();
+		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
+		if(TxnInst == NULL) {
+			XAIE_DBG("Could not find transaction instance "
+					"associated with thread. Writing "
+					"to register\n");
+			return _XAie_BackendMaskWrite32(DevInst, RegOff, Mask,
+					Value);
+		}
+
+		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
+			RC = _XAie_ReallocCmdBuf(TxnInst);
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		TxnInst->CmdBuf[TxnInst->NumCmds].Opcode = XAIE_IO_WRITE;
+		TxnInst->CmdBuf[TxnInst->NumCmds].RegOff = RegOff;
+		TxnInst->CmdBuf[TxnInst->NumCmds].Mask = Mask;
+		TxnInst->CmdBuf[TxnInst->NumCmds].Value = Value;
+		TxnInst->NumCmds++;
+
+		return XAIE_OK;
+	}
+	return _XAie_BackendMaskWrite32(DevInst, RegOff, Mask, Value);
+}
+
+AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
+		u32 TimeOutUs)
+{
+	AieRC RC;
+	u64 Tid;
+	XAie_TxnInst *TxnInst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	XAIE_IO_STATS_CALLER();
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
+		Tid = Backend->Ops.GetTid();
+		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
+		if(TxnInst == NULL) {
+			XAIE_DBG("Could not find transaction instance "
+					"associated with thread. Polling "
+					"from register\n");
+			return _XAie_IOMaskPoll(DevInst, RegOff, Mask,
+					Value, TimeOutUs);
+		}
+
+		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
+				(TxnInst->NumCmds > 0)) {
+			/* Flush command buffer */
+			XAIE_DBG("Auto flushing contents of the transaction "
+					"buffer.\n");
+			RC = _XAie_Txn_FlushCmdBuf(DevInst, TxnInst);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Failed to flush cmd buffer\n");
+				return RC;
+			}
+
+			_XAie_TxnResetCmdBuf(TxnInst);
+			return _XAie_IOMaskPoll(DevInst, RegOff, Mask,
+					Value, TimeOutUs);
+		} else if(TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) {
+			return _XAie_IOMaskPoll(DevInst, RegOff, Mask,
+					Value, TimeOutUs);
+		}
+
+		/* Record the poll, a timeout is reported on submission */
+		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
+			RC = _XAie_ReallocCmdBuf(TxnInst);
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		TxnInst->CmdBuf[TxnInst->NumCmds].Opcode = XAIE_IO_MASKPOLL;
+		TxnInst->CmdBuf[TxnInst->NumCmds].RegOff = RegOff;
+		TxnInst->CmdBuf[TxnInst->NumCmds].Mask = Mask;
+		TxnInst->CmdBuf[TxnInst->NumCmds].Value = Value;
+		TxnInst->CmdBuf[TxnInst->NumCmds].Size = TimeOutUs;
+		TxnInst->NumCmds++;
+
+		return XAIE_OK;
+	}
+	return _XAie_IOMaskPoll(DevInst, RegOff, Mask, Value, TimeOutUs);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads a register without flushing the transaction of the calling
+* thread. Inside a transaction, the read is recorded in order with the other
+* commands and the register value is stored to Data when the transaction is
+* submitted. Outside of a transaction, the register is read right away.
+*
+* @param	DevInst: Device Instance
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to the word the register value is stored to. It
+*		must stay valid until the transaction is submitted.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Use XAie_Read32() if the value is needed to generate the
+*		following commands.
+*
+******************************************************************************/
+AieRC XAie_TxnRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
+{
+	AieRC RC;
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
-		Tid = Backend->Ops.GetTid();
-		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
+	XAIE_IO_STATS_CALLER();
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
+		TxnInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
-					"associated with thread. Writing "
-					"to register\n");
-			return Backend->Ops.MaskWrite32((void *)(DevInst->IOInst), RegOff, Mask,
-					Value);
+					"associated with thread. Reading "
+					"from register\n");
+			return _XAie_IORead32(DevInst, RegOff, Data);
 		}
 
 		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
@@ -992,62 +2196,83 @@ AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
 			}
 		}
 
-		TxnInst->CmdBuf[TxnInst->NumCmds].Opcode = XAIE_IO_WRITE;
+		TxnInst->CmdBuf[TxnInst->NumCmds].Opcode = XAIE_IO_READ;
 		TxnInst->CmdBuf[TxnInst->NumCmds].RegOff = RegOff;
-		TxnInst->CmdBuf[TxnInst->NumCmds].Mask = Mask;
-		TxnInst->CmdBuf[TxnInst->NumCmds].Value = Value;
+		TxnInst->CmdBuf[TxnInst->NumCmds].DataPtr = (u64)(uintptr_t)Data;
+		TxnInst->CmdBuf[TxnInst->NumCmds].Mask = 0U;
 		TxnInst->NumCmds++;
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.MaskWrite32((void *)(DevInst->IOInst), RegOff, Mask,
-			Value);
+	return _XAie_IORead32(DevInst, RegOff, Data);
 }
 
-AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
-		u32 TimeOutUs)
+/*****************************************************************************/
+/**
+*
+* This API syncs a range of a memory buffer in order with the register
+* accesses of the transaction of the calling thread. Inside a transaction, the
+* sync is recorded and executed when the transaction is submitted, so a sync
+* for device can be submitted asynchronously together with the shim DMA BDs
+* and the queue writes which use the buffer. Outside of a transaction, the
+* range is synced right away.
+*
+* @param	DevInst: Device Instance
+* @param	Range: Range of the memory buffer to sync. It is copied to the
+*		transaction.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The memory instance has to stay valid until the transaction
+*		is submitted.
+*
+******************************************************************************/
+AieRC XAie_TxnMemSync(XAie_DevInst *DevInst, const XAie_MemSyncRange *Range)
 {
 	AieRC RC;
-	u64 Tid;
 	XAie_TxnInst *TxnInst;
+	XAie_MemSyncRange *Copy;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
-		Tid = Backend->Ops.GetTid();
-		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
+	if((Range == XAIE_NULL) || (Range->MemInst == XAIE_NULL) ||
+			(Range->MemInst->DevInst != DevInst)) {
+		XAIE_ERROR("Invalid memory sync range\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
+		TxnInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
-					"associated with thread. Polling "
-					"from register\n");
-			return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-					Value, TimeOutUs);
+					"associated with thread. Syncing "
+					"memory\n");
+			return XAie_MemSyncBatch(Range, 1U);
 		}
 
-		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
-				(TxnInst->NumCmds > 0)) {
-			/* Flush command buffer */
-			XAIE_DBG("Auto flushing contents of the transaction "
-					"buffer.\n");
-			RC = _XAie_Txn_FlushCmdBuf(DevInst, TxnInst);
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("Failed to flush cmd buffer\n");
+		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
+			RC = _XAie_ReallocCmdBuf(TxnInst);
+			if (RC != XAIE_OK) {
 				return RC;
 			}
+		}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-					Value, TimeOutUs);
-		} else if(TxnInst->NumCmds == 0) {
-			return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-					Value, TimeOutUs);
-		} else {
-			XAIE_ERROR("MaskPoll operation is not supported "
-					"when auto flush is disabled\n");
+		Copy = (XAie_MemSyncRange *)_XAie_TxnArenaAlloc(TxnInst,
+				sizeof(*Copy));
+		if(Copy == NULL) {
 			return XAIE_ERR;
 		}
+		*Copy = *Range;
+
+		TxnInst->CmdBuf[TxnInst->NumCmds].Opcode = XAIE_IO_MEMSYNC;
+		TxnInst->CmdBuf[TxnInst->NumCmds].RegOff = 0U;
+		TxnInst->CmdBuf[TxnInst->NumCmds].DataPtr =
+			(u64)(uintptr_t)Copy;
+		TxnInst->CmdBuf[TxnInst->NumCmds].Mask = 0U;
+		TxnInst->NumCmds++;
+
+		return XAIE_OK;
 	}
-	return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-			Value, TimeOutUs);
+	return XAie_MemSyncBatch(Range, 1U);
 }
 
 AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32 Size)
@@ -1058,14 +2283,18 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	XAIE_IO_STATS_CALLER();
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Block write "
 					"to register\n");
-			return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
+			_XAie_ShadowInvalidate(DevInst, RegOff, Size);
+			_XAie_BdShadowInvalidate(DevInst, RegOff, Size);
+			return _XAie_IOBlockWrite32(DevInst, RegOff,
 					Data, Size);
 		}
 
@@ -1081,8 +2310,10 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 				}
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
+			_XAie_TxnResetCmdBuf(TxnInst);
+			_XAie_ShadowInvalidate(DevInst, RegOff, Size);
+			_XAie_BdShadowInvalidate(DevInst, RegOff, Size);
+			return _XAie_IOBlockWrite32(DevInst, RegOff,
 					Data, Size);
 		}
 
@@ -1093,7 +2324,7 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 			}
 		}
 
-		Buf = (u32 *)malloc(sizeof(u32) * Size);
+		Buf = (u32 *)_XAie_TxnArenaAlloc(TxnInst, sizeof(u32) * Size);
 		if(Buf == NULL) {
 			XAIE_ERROR("Memory allocation for block write failed\n");
 			return XAIE_ERR;
@@ -1109,8 +2340,143 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
-			Data, Size);
+	_XAie_ShadowInvalidate(DevInst, RegOff, Size);
+	_XAie_BdShadowInvalidate(DevInst, RegOff, Size);
+	return _XAie_IOBlockWrite32(DevInst, RegOff, Data, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a block of registers without copying the payload into the
+* transaction of the calling thread. Inside a transaction without auto flush,
+* the command references Data directly, so that many block writes of the same
+* source buffer share one payload, also in the kernel transaction ioctl.
+* Otherwise, it behaves like XAie_BlockWrite32().
+*
+* @param	DevInst: Device Instance
+* @param	RegOff: Register offset to write to.
+* @param	Data: Pointer to the payload. It must stay valid and unchanged
+*		until the transaction is submitted, or until the fence of an
+*		asynchronous submission completes.
+* @param	Size: Number of words to write.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Exported transaction instances still get their own copy of
+*		the payload.
+*
+******************************************************************************/
+AieRC XAie_BlockWrite32Shared(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	AieRC RC;
+	XAie_TxnInst *TxnInst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_ENABLE) {
+		return XAie_BlockWrite32(DevInst, RegOff, Data, Size);
+	}
+
+	TxnInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
+	if((TxnInst == NULL) || (TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK)) {
+		return XAie_BlockWrite32(DevInst, RegOff, Data, Size);
+	}
+
+	if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
+		RC = _XAie_ReallocCmdBuf(TxnInst);
+		if (RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	TxnInst->CmdBuf[TxnInst->NumCmds].Opcode = XAIE_IO_BLOCKWRITE;
+	TxnInst->CmdBuf[TxnInst->NumCmds].RegOff = RegOff;
+	TxnInst->CmdBuf[TxnInst->NumCmds].DataPtr = (u64)(uintptr_t)Data;
+	TxnInst->CmdBuf[TxnInst->NumCmds].Size = Size;
+	TxnInst->CmdBuf[TxnInst->NumCmds].Mask = 0U;
+	TxnInst->NumCmds++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a block of registers from a buffer passed by the caller of a
+* driver API. Inside a transaction started with XAIE_TRANSACTION_SHARE_PAYLOADS,
+* the command references Data like XAie_BlockWrite32Shared(). Otherwise, the
+* payload is copied like XAie_BlockWrite32().
+*
+* @param	DevInst: Device Instance
+* @param	RegOff: Register offset to write to.
+* @param	Data: Pointer to the payload of the caller.
+* @param	Size: Number of words to write.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. Must not be used for buffers of the driver
+*		which are released before the transaction is submitted.
+*
+******************************************************************************/
+AieRC _XAie_BlockWrite32User(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	XAie_TxnInst *TxnInst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
+		TxnInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
+		if((TxnInst != NULL) &&
+				(TxnInst->Flags & XAIE_TXN_SHARE_PAYLOADS_MASK)) {
+			return XAie_BlockWrite32Shared(DevInst, RegOff, Data,
+					Size);
+		}
+	}
+
+	return XAie_BlockWrite32(DevInst, RegOff, Data, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets whether the transaction of the calling thread references the
+* buffers passed by the callers of driver APIs, for the driver APIs which write
+* from a temporary buffer of their own.
+*
+* @param	DevInst: Device Instance
+* @param	Share: XAIE_ENABLE to reference the buffers, XAIE_DISABLE to
+*		copy them.
+*
+* @return	Previous setting, XAIE_DISABLE outside of a transaction.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+u8 _XAie_TxnSetSharePayloads(XAie_DevInst *DevInst, u8 Share)
+{
+	XAie_TxnInst *TxnInst;
+	const XAie_Backend *Backend = DevInst->Backend;
+	u8 Prev;
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_ENABLE) {
+		return XAIE_DISABLE;
+	}
+
+	TxnInst = _XAie_GetTxnInst(DevInst, Backend->Ops.GetTid());
+	if(TxnInst == NULL) {
+		return XAIE_DISABLE;
+	}
+
+	Prev = (TxnInst->Flags & XAIE_TXN_SHARE_PAYLOADS_MASK) ?
+		XAIE_ENABLE : XAIE_DISABLE;
+	if(Share == XAIE_ENABLE) {
+		TxnInst->Flags |= XAIE_TXN_SHARE_PAYLOADS_MASK;
+	} else {
+		TxnInst->Flags &= ~XAIE_TXN_SHARE_PAYLOADS_MASK;
+	}
+
+	return Prev;
 }
 
 AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
@@ -1120,15 +2486,18 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	XAIE_IO_STATS_CALLER();
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Block set "
 					"to register\n");
-			return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
-					Size);
+			_XAie_ShadowInvalidate(DevInst, RegOff, Size);
+			_XAie_BdShadowInvalidate(DevInst, RegOff, Size);
+			return _XAie_IOBlockSet32(DevInst, RegOff, Data, Size);
 		}
 
 		if(TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) {
@@ -1143,9 +2512,10 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 				}
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
-					Size);
+			_XAie_TxnResetCmdBuf(TxnInst);
+			_XAie_ShadowInvalidate(DevInst, RegOff, Size);
+			_XAie_BdShadowInvalidate(DevInst, RegOff, Size);
+			return _XAie_IOBlockSet32(DevInst, RegOff, Data, Size);
 		}
 
 		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
@@ -1164,8 +2534,97 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
-			Size);
+	_XAie_ShadowInvalidate(DevInst, RegOff, Size);
+	_XAie_BdShadowInvalidate(DevInst, RegOff, Size);
+	return _XAie_IOBlockSet32(DevInst, RegOff, Data, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads a block of 32-bit words with the backend block read
+* operation, or word by word if the backend does not provide one.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BackendBlockRead32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 *Data, u32 Size)
+{
+	const XAie_Backend *Backend = DevInst->Backend;
+	AieRC RC;
+
+	if(Backend->Ops.BlockRead32 != NULL) {
+		u64 Start = XAIE_IO_STATS_START(DevInst);
+
+		RC = Backend->Ops.BlockRead32((void *)(DevInst->IOInst),
+				RegOff, Data, Size);
+		XAIE_IO_STATS_END(DevInst, XAIE_IO_STATS_BLOCKREAD32,
+				(u64)Size * 4U, Start);
+		return RC;
+	}
+
+	for(u32 i = 0U; i < Size; i++) {
+		RC = _XAie_IORead32(DevInst, RegOff + i * 4U, &Data[i]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+AieRC XAie_BlockRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data, u32 Size)
+{
+	u64 Tid;
+	AieRC RC;
+	XAie_TxnInst *TxnInst;
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	XAIE_IO_STATS_CALLER();
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
+		Tid = Backend->Ops.GetTid();
+		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
+		if(TxnInst == NULL) {
+			XAIE_DBG("Could not find transaction instance "
+					"associated with thread. Block read "
+					"from register\n");
+			return _XAie_BackendBlockRead32(DevInst, RegOff, Data,
+					Size);
+		}
+
+		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
+				(TxnInst->NumCmds > 0)) {
+			/* Flush command buffer */
+			XAIE_DBG("Auto flushing contents of the transaction "
+					"buffer.\n");
+			RC = _XAie_Txn_FlushCmdBuf(DevInst, TxnInst);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Failed to flush cmd buffer\n");
+				return RC;
+			}
+
+			_XAie_TxnResetCmdBuf(TxnInst);
+			return _XAie_BackendBlockRead32(DevInst, RegOff, Data,
+					Size);
+		} else if(TxnInst->NumCmds == 0) {
+			return _XAie_BackendBlockRead32(DevInst, RegOff, Data,
+					Size);
+		} else {
+			XAIE_ERROR("Block read operation is not supported "
+					"when auto flush is disabled\n");
+			return XAIE_ERR;
+		}
+	}
+	return _XAie_BackendBlockRead32(DevInst, RegOff, Data, Size);
 }
 
 AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
@@ -1176,7 +2635,7 @@ AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
@@ -1198,7 +2657,7 @@ AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 				return RC;
 			}
 
-			TxnInst->NumCmds = 0;
+			_XAie_TxnResetCmdBuf(TxnInst);
 			return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
 					Command, CmdWd0, CmdWd1, CmdStr);
 		} else if(TxnInst->NumCmds == 0U) {
@@ -1214,6 +2673,144 @@ AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 			Command, CmdWd0, CmdWd1, CmdStr);
 }
 
+/*****************************************************************************/
+/**
+*
+* This function runs a backend operation and drops the shadow caches unless
+* the operation leaves the device registers untouched. Shim BD operations drop
+* the BD shadow of the BDs they write only.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Op: Backend operation code.
+* @param	Arg: Argument of the operation.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BackendRunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op,
+		void *Arg)
+{
+	const XAie_Backend *Backend = DevInst->Backend;
+	u64 Start = XAIE_IO_STATS_START(DevInst);
+	AieRC RC;
+
+	if((Op == XAIE_BACKEND_OP_CONFIG_SHIMDMABD_BATCH) &&
+			(Backend->Type != XAIE_IO_BACKEND_LINUX)) {
+		/* Only the linux backend takes the batch, submit BD by BD */
+		XAie_BackendShimDmaBdBatch *Batch =
+			(XAie_BackendShimDmaBdBatch *)Arg;
+
+		RC = XAIE_OK;
+		for(u32 i = 0U; (i < Batch->NumBds) && (RC == XAIE_OK); i++) {
+			RC = Backend->Ops.RunOp(DevInst->IOInst, DevInst,
+					XAIE_BACKEND_OP_CONFIG_SHIMDMABD,
+					&Batch->BdArgs[i]);
+		}
+	} else {
+		RC = Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+	}
+	XAIE_IO_STATS_END(DevInst, XAIE_IO_STATS_RUNOP, 0U, Start);
+
+	switch(Op) {
+	case XAIE_BACKEND_OP_NPIMASKPOLL32:
+	case XAIE_BACKEND_OP_REQUEST_RESOURCE:
+	case XAIE_BACKEND_OP_RELEASE_RESOURCE:
+	case XAIE_BACKEND_OP_FREE_RESOURCE:
+	case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
+	case XAIE_BACKEND_OP_GET_RSC_STAT:
+	case XAIE_BACKEND_OP_CONFIG_REG_MMAP:
+	case XAIE_BACKEND_OP_CONFIG_WRITE_COMBINE:
+	case XAIE_BACKEND_OP_FLUSH_WRITES:
+	case XAIE_BACKEND_OP_CONFIG_POLL:
+	case XAIE_BACKEND_OP_CONFIG_IO_RECORD:
+	case XAIE_BACKEND_OP_CONFIG_HUGE_PAGES:
+		break;
+	case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
+	{
+		XAie_ShimDmaBdArgs *BdArgs = (XAie_ShimDmaBdArgs *)Arg;
+
+		_XAie_ShadowInvalidateAll(DevInst);
+		_XAie_BdShadowInvalidate(DevInst, BdArgs->Addr,
+				BdArgs->NumBdWords);
+		break;
+	}
+	case XAIE_BACKEND_OP_CONFIG_SHIMDMABD_BATCH:
+	{
+		XAie_BackendShimDmaBdBatch *Batch =
+			(XAie_BackendShimDmaBdBatch *)Arg;
+
+		_XAie_ShadowInvalidateAll(DevInst);
+		for(u32 i = 0U; i < Batch->NumBds; i++) {
+			_XAie_BdShadowInvalidate(DevInst,
+					Batch->BdArgs[i].Addr,
+					Batch->BdArgs[i].NumBdWords);
+		}
+		break;
+	}
+	default:
+		_XAie_ShadowInvalidateAll(DevInst);
+		_XAie_BdShadowInvalidateAll(DevInst);
+		break;
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records the configuration of a shim DMA BD in a transaction. The
+* arguments and the BD words are copied to the payload arena of the
+* transaction instance.
+*
+* @param	TxnInst: Pointer to the transaction instance.
+* @param	Args: Arguments of the shim DMA BD.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. The memory instance of the BD has to stay
+*		attached until the transaction is submitted.
+*
+*******************************************************************************/
+static AieRC _XAie_TxnRecordShimDmaBd(XAie_TxnInst *TxnInst,
+		const XAie_ShimDmaBdArgs *Args)
+{
+	XAie_ShimDmaBdArgs *Copy;
+	XAie_TxnCmd *Cmd;
+	AieRC RC;
+
+	if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
+		RC = _XAie_ReallocCmdBuf(TxnInst);
+		if (RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	Copy = (XAie_ShimDmaBdArgs *)_XAie_TxnArenaAlloc(TxnInst,
+			sizeof(*Copy) + sizeof(u32) * Args->NumBdWords);
+	if(Copy == NULL) {
+		return XAIE_ERR;
+	}
+
+	*Copy = *Args;
+	Copy->BdWords = (u32 *)(Copy + 1);
+	memcpy((void *)Copy->BdWords, (const void *)Args->BdWords,
+			sizeof(u32) * Args->NumBdWords);
+
+	Cmd = &TxnInst->CmdBuf[TxnInst->NumCmds];
+	Cmd->Opcode = XAIE_IO_SHIMDMABD;
+	Cmd->RegOff = Args->Addr;
+	Cmd->DataPtr = (u64)(uintptr_t)Copy;
+	Cmd->Mask = 0U;
+	Cmd->Value = 0U;
+	Cmd->Size = Args->NumBdWords;
+	TxnInst->NumCmds++;
+
+	return XAIE_OK;
+}
+
 AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 {
 	AieRC RC;
@@ -1221,13 +2818,15 @@ AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
-	if(DevInst->TxnList.Next != NULL) {
+	XAIE_IO_STATS_CALLER();
+
+	if(_XAie_TxnListIsEmpty(DevInst) == XAIE_DISABLE) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Running Op.\n");
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+			return _XAie_BackendRunOp(DevInst, Op, Arg);
 		}
 
 		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
@@ -1239,18 +2838,40 @@ AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 				return RC;
 			}
 
-			TxnInst->NumCmds = 0;
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
-		} else if(TxnInst->NumCmds == 0) {
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+			_XAie_TxnResetCmdBuf(TxnInst);
+			return _XAie_BackendRunOp(DevInst, Op, Arg);
 		} else if((Op == XAIE_BACKEND_OP_CONFIG_SHIMDMABD) &&
-				(Backend->Type != XAIE_IO_BACKEND_LINUX)) {
+				(Backend->Type == XAIE_IO_BACKEND_LINUX)) {
+			/*
+			 * The transaction ioctl has no shim dma operation, so
+			 * the linux kernel backend configures the BD with its
+			 * own ioctl when the transaction is submitted. It is
+			 * recorded even as the first command, so that it is
+			 * ordered after the transactions still queued for
+			 * asynchronous submission.
+			 */
+			return _XAie_TxnRecordShimDmaBd(TxnInst,
+					(XAie_ShimDmaBdArgs *)Arg);
+		} else if((Op == XAIE_BACKEND_OP_CONFIG_SHIMDMABD_BATCH) &&
+				(Backend->Type == XAIE_IO_BACKEND_LINUX)) {
+			XAie_BackendShimDmaBdBatch *Batch =
+				(XAie_BackendShimDmaBdBatch *)Arg;
+
+			for(u32 i = 0U; i < Batch->NumBds; i++) {
+				RC = _XAie_TxnRecordShimDmaBd(TxnInst,
+						&Batch->BdArgs[i]);
+				if(RC != XAIE_OK) {
+					return RC;
+				}
+			}
+			return XAIE_OK;
+		} else if(TxnInst->NumCmds == 0) {
+			return _XAie_BackendRunOp(DevInst, Op, Arg);
+		} else if(Op == XAIE_BACKEND_OP_CONFIG_SHIMDMABD) {
 			/*
-			 * NOTE: shim dma configuration can be added as register
+			 * NOTE: shim dma configuration is added as register
 			 * write commands for all backends except linux kernel
-			 * backend. to enable this for linux kernel backend,
-			 * kernel has to support shim dma configuration as a new
-			 * operation in transaction ioctl.
+			 * backend.
 			 */
 			XAie_ShimDmaBdArgs *BdArgs =
 				(XAie_ShimDmaBdArgs *)Arg;
@@ -1260,13 +2881,26 @@ AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 						BdArgs->BdWords[i]);
 			}
 			return XAIE_OK;
+		} else if(Op == XAIE_BACKEND_OP_CONFIG_SHIMDMABD_BATCH) {
+			XAie_BackendShimDmaBdBatch *Batch =
+				(XAie_BackendShimDmaBdBatch *)Arg;
+			for(u32 i = 0U; i < Batch->NumBds; i++) {
+				XAie_ShimDmaBdArgs *BdArgs = &Batch->BdArgs[i];
+
+				for(u8 j = 0; j < BdArgs->NumBdWords; j++) {
+					XAie_Write32(DevInst,
+							BdArgs->Addr + j * 4,
+							BdArgs->BdWords[j]);
+				}
+			}
+			return XAIE_OK;
 		} else {
 			XAIE_ERROR("Run Op operation is not supported "
 					"when auto flush is disabled\n");
 			return XAIE_ERR;
 		}
 	}
-	return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+	return _XAie_BackendRunOp(DevInst, Op, Arg);
 }
 
 /** @} */
@@ -33,36 +33,74 @@
 #define XAIEHELPER_H
 
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+
+#include "xaie_device_aie.h"
+#include "xaie_device_aieml.h"
+#include "xaie_feature_config.h"
 #include "xaie_io.h"
+#include "xaie_log.h"
 #include "xaiegbl_regdef.h"
 
 /***************************** Macro Definitions *****************************/
 #define CheckBit(bitmap, pos)   ((bitmap)[(pos) / (sizeof((bitmap)[0]) * 8U)] & \
 				 (1U << (pos) % (sizeof((bitmap)[0]) * 8U)))
 
-#define XAIE_ERROR(...)							      \
+/*
+ * Logs a message of a level compiled in. The message is skipped before its
+ * arguments are formatted when its level is above the runtime level, or when
+ * its call site exceeded the rate limit.
+ */
+#define _XAIE_LOG(Fd, Level, Prefix, ...)				      \
 	do {								      \
-		XAie_Log(stderr, "[AIE ERROR]", __func__, __LINE__,	      \
-				__VA_ARGS__);				      \
+		static XAie_LogSite _XAie_Site;				      \
+		if((Level) <= _XAie_LogLevel &&				      \
+				_XAie_LogSiteCheck(&_XAie_Site, Fd, Prefix,   \
+					__func__, __LINE__)) {		      \
+			XAie_Log(Fd, Prefix, __func__, __LINE__,	      \
+					__VA_ARGS__);			      \
+		}							      \
 	} while(0)
 
+#if XAIE_LOG_COMPILE_LEVEL >= XAIE_LOG_LEVEL_ERROR
+#define XAIE_ERROR(...)							      \
+	_XAIE_LOG(stderr, XAIE_LOG_LEVEL_ERROR, "[AIE ERROR]", __VA_ARGS__)
+#else
+#define XAIE_ERROR(...) do { } while(0)
+#endif
+
+#if XAIE_LOG_COMPILE_LEVEL >= XAIE_LOG_LEVEL_WARN
 #define XAIE_WARN(...)							      \
-	do {								      \
-		XAie_Log(stderr, "[AIE WARNING]", __func__, __LINE__,	      \
-				__VA_ARGS__);				      \
-	} while(0)
+	_XAIE_LOG(stderr, XAIE_LOG_LEVEL_WARN, "[AIE WARNING]", __VA_ARGS__)
+#else
+#define XAIE_WARN(...) do { } while(0)
+#endif
+
+#if XAIE_LOG_COMPILE_LEVEL >= XAIE_LOG_LEVEL_DEBUG
+#define XAIE_DBG(...)							      \
+	_XAIE_LOG(stdout, XAIE_LOG_LEVEL_DEBUG, "[AIE DEBUG]", __VA_ARGS__)
+#else
+#define XAIE_DBG(...) do { } while(0)
+#endif
 
 #ifdef XAIE_DEBUG
 
-#define XAIE_DBG(...)							      \
+/*
+ * Checks the arguments of the unchecked fast path APIs. Debug builds abort on
+ * a failed check, other builds do not check.
+ */
+#define XAIE_ASSERT(Cond)						      \
 	do {								      \
-		XAie_Log(stdout, "[AIE DEBUG]", __func__, __LINE__,	      \
-				__VA_ARGS__);				      \
+		if(!(Cond)) {						      \
+			XAie_Log(stderr, "[AIE ASSERT]", __func__, __LINE__,  \
+					"%s\n", #Cond);			      \
+			abort();					      \
+		}							      \
 	} while(0)
 
 #else
 
-#define XAIE_DBG(DevInst, ...) {}
+#define XAIE_ASSERT(Cond) do { } while(0)
 
 #endif /* XAIE_DEBUG */
 
@@ -83,11 +121,20 @@
 /* Generate value with a set bit at given Index */
 #define BIT(Index)		(1 << (Index))
 
+/* Flag set on transaction instances owned by the user */
+#define XAIE_TXN_INSTANCE_EXPORTED	0b10U
+#define XAIE_TXN_INST_EXPORTED_MASK XAIE_TXN_INSTANCE_EXPORTED
+
 /**************************** Type Definitions *******************************/
 typedef enum {
 	XAIE_IO_WRITE,
 	XAIE_IO_BLOCKWRITE,
 	XAIE_IO_BLOCKSET,
+	XAIE_IO_READ,		/* Read RegOff into the word at DataPtr */
+	XAIE_IO_MASKPOLL,	/* Poll RegOff, Size holds the timeout in us */
+	XAIE_IO_SHIMDMABD,	/* Configure the shim DMA BD at RegOff through the
+				 * backend, DataPtr holds the XAie_ShimDmaBdArgs */
+	XAIE_IO_MEMSYNC,	/* Sync the XAie_MemSyncRange at DataPtr */
 } XAie_TxnOpcode;
 
 struct XAie_TxnCmd {
@@ -99,6 +146,17 @@ struct XAie_TxnCmd {
 	u32 Size;
 };
 
+/*
+ * Typedef to capture one chunk of the transaction payload arena. Block write
+ * payloads are appended to the chunk right after this header. Chunks are never
+ * moved once allocated, so DataPtr of the recorded commands stays valid.
+ */
+struct XAie_TxnArena {
+	struct XAie_TxnArena *Next;
+	u64 Size;	/* Payload capacity of the chunk in bytes */
+	u64 Used;	/* Payload bytes in use */
+};
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -110,13 +168,125 @@ struct XAie_TxnCmd {
 * @param	C: Column
 * @return	TileAddr
 *
-* @note		Internal API only.
+* @note		Internal API only. Builds with XAIE_DEV_STATIC use the shifts
+*		of the static geometry.
 *
 ******************************************************************************/
 static inline u64 _XAie_GetTileAddr(XAie_DevInst *DevInst, u8 R, u8 C)
 {
+#ifdef XAIE_DEV_STATIC
+	(void)DevInst;
+	return (((u64)R & 0xFF) << XAIE_DEV_STATIC_ROW_SHIFT) |
+		(((u64)C & 0xFF) << XAIE_DEV_STATIC_COL_SHIFT);
+#else
 	return (((u64)R & 0xFF) << DevInst->DevProp.RowShift) |
 		(((u64)C & 0xFF) << DevInst->DevProp.ColShift);
+#endif
+}
+
+#ifdef XAIE_DEV_STATIC
+/*****************************************************************************/
+/**
+*
+* Computes the tile type of a location from the static geometry, with the
+* same rules as the runtime lookup of the device generation the driver is
+* built for.
+*
+* @param	Loc: Location of the tile.
+* @return	Tile type, XAIEGBL_TILE_TYPE_MAX if the location is outside of
+*		the partition.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline u8 _XAie_StaticTileType(XAie_LocType Loc)
+{
+	u8 ColType;
+
+	if((Loc.Col >= XAIE_DEV_STATIC_NUM_COLS) ||
+			(Loc.Row >= XAIE_DEV_STATIC_NUM_ROWS)) {
+		return XAIEGBL_TILE_TYPE_MAX;
+	}
+
+	if(Loc.Row == 0U) {
+		ColType = (XAIE_DEV_STATIC_START_COL + Loc.Col) % 4U;
+		return ((ColType == 0U) || (ColType == 1U)) ?
+			XAIEGBL_TILE_TYPE_SHIMPL : XAIEGBL_TILE_TYPE_SHIMNOC;
+#if XAIE_DEV_STATIC_MEM_TILE_NUM_ROWS > 0
+	} else if((Loc.Row >= XAIE_DEV_STATIC_MEM_TILE_ROW_START) &&
+			(Loc.Row < XAIE_DEV_STATIC_MEM_TILE_ROW_START +
+			 XAIE_DEV_STATIC_MEM_TILE_NUM_ROWS)) {
+		return XAIEGBL_TILE_TYPE_MEMTILE;
+#endif
+	} else if((Loc.Row >= XAIE_DEV_STATIC_AIE_TILE_ROW_START) &&
+			(Loc.Row < XAIE_DEV_STATIC_AIE_TILE_ROW_START +
+			 XAIE_DEV_STATIC_AIE_TILE_NUM_ROWS)) {
+		return XAIEGBL_TILE_TYPE_AIETILE;
+	}
+
+	return XAIEGBL_TILE_TYPE_MAX;
+}
+#endif /* XAIE_DEV_STATIC */
+
+/*****************************************************************************/
+/**
+*
+* Looks up the tile type of a location in the tile types of the partition.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @return	Tile type, or XAIEGBL_TILE_TYPE_MAX if the location is out of
+*		the partition or the table is not built.
+*
+* @note		Internal API only. Builds with XAIE_DEV_STATIC compute the
+*		tile type from the static geometry instead.
+*
+******************************************************************************/
+static inline u8 _XAie_LookupTileType(XAie_DevInst *DevInst, XAie_LocType Loc)
+{
+#ifdef XAIE_DEV_STATIC
+	(void)DevInst;
+	return _XAie_StaticTileType(Loc);
+#else
+	if((DevInst->TileTypes == NULL) || (Loc.Col >= DevInst->NumCols) ||
+			(Loc.Row >= DevInst->NumRows)) {
+		return XAIEGBL_TILE_TYPE_MAX;
+	}
+
+	return DevInst->TileTypes[(u32)Loc.Col * DevInst->NumRows + Loc.Row];
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* Gets the tile type of a location from the tile types of the partition. On a
+* miss, which reports the error, builds for a single device generation call
+* the function of that generation directly instead of through the device ops.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @return	Tile type on success and XAIEGBL_TILE_TYPE_MAX on error.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline u8 _XAie_DevGetTTypefromLoc(XAie_DevInst *DevInst,
+		XAie_LocType Loc)
+{
+	u8 TileType = _XAie_LookupTileType(DevInst, Loc);
+
+	if(TileType != XAIEGBL_TILE_TYPE_MAX) {
+		return TileType;
+	}
+
+#if defined(XAIE_DEV_AIEML_ENABLE) && !defined(XAIE_DEV_AIE_ENABLE)
+	return _XAieMl_GetTTypefromLoc(DevInst, Loc);
+#elif defined(XAIE_DEV_AIE_ENABLE) && !defined(XAIE_DEV_AIEML_ENABLE)
+	return _XAie_GetTTypefromLoc(DevInst, Loc);
+#else
+	return DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+#endif
 }
 
 /*****************************************************************************/
@@ -146,9 +316,113 @@ static inline u32 first_set_bit(u64 Value)
 	return Index;
 }
 
-void XAie_Log(FILE *Fd, const char *prefix, const char *func, u32 line,
-		const char *Format, ...);
+/*****************************************************************************/
+/**
+*
+* Calculates the number of trailing zero bits of a word.
+*
+* @param	Value: Value, must not be 0.
+* @return	Index of the least significant set bit, starting from 0.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline u32 _XAie_CountTrailingZeros32(u32 Value)
+{
+#if defined(__GNUC__)
+	return (u32)__builtin_ctz(Value);
+#else
+	u32 Count = 0U;
+
+	if((Value & 0xFFFFU) == 0U) {
+		Count += 16U;
+		Value >>= 16U;
+	}
+	if((Value & 0xFFU) == 0U) {
+		Count += 8U;
+		Value >>= 8U;
+	}
+	if((Value & 0xFU) == 0U) {
+		Count += 4U;
+		Value >>= 4U;
+	}
+	if((Value & 0x3U) == 0U) {
+		Count += 2U;
+		Value >>= 2U;
+	}
+
+	return Count + ((Value & 0x1U) ^ 0x1U);
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* Finds the most significant set bit of a word.
+*
+* @param	Value: Value, must not be 0.
+* @return	Index of the most significant set bit, starting from 0.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline u32 _XAie_GetLastSetBit32(u32 Value)
+{
+#if defined(__GNUC__)
+	return 31U - (u32)__builtin_clz(Value);
+#else
+	u32 Index = 0U;
+
+	if((Value & 0xFFFF0000U) != 0U) {
+		Index += 16U;
+		Value >>= 16U;
+	}
+	if((Value & 0xFF00U) != 0U) {
+		Index += 8U;
+		Value >>= 8U;
+	}
+	if((Value & 0xF0U) != 0U) {
+		Index += 4U;
+		Value >>= 4U;
+	}
+	if((Value & 0xCU) != 0U) {
+		Index += 2U;
+		Value >>= 2U;
+	}
+
+	return Index + ((Value >> 1U) & 0x1U);
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* Calculates the number of set bits of a word.
+*
+* @param	Value: Value
+* @return	Number of set bits.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline u32 _XAie_PopCount32(u32 Value)
+{
+#if defined(__GNUC__)
+	return (u32)__builtin_popcount(Value);
+#else
+	Value = Value - ((Value >> 1U) & 0x55555555U);
+	Value = (Value & 0x33333333U) + ((Value >> 2U) & 0x33333333U);
+	Value = (Value + (Value >> 4U)) & 0x0F0F0F0FU;
+
+	return (Value * 0x01010101U) >> 24U;
+#endif
+}
+
 u8 _XAie_GetTileTypefromLoc(XAie_DevInst *DevInst, XAie_LocType Loc);
+AieRC _XAie_TileTypesInit(XAie_DevInst *DevInst);
+void _XAie_TileTypesFinish(XAie_DevInst *DevInst);
+AieRC _XAie_TileBitmapsInit(XAie_DevInst *DevInst);
+void _XAie_TileBitmapsFinish(XAie_DevInst *DevInst);
 AieRC _XAie_CheckModule(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module);
 AieRC _XAie_GetSlaveIdx(const XAie_StrmMod *StrmMod, StrmSwPortType Slave,
@@ -160,22 +434,39 @@ u32 _XAie_GetFatalGroupErrors(XAie_DevInst *DevInst, XAie_LocType Loc,
 u32 _XAie_GetTileBitPosFromLoc(XAie_DevInst *DevInst, XAie_LocType Loc);
 void _XAie_SetBitInBitmap(u32 *Bitmap, u32 StartSetBit, u32 NumSetBit);
 void _XAie_ClrBitInBitmap(u32 *Bitmap, u32 StartSetBit, u32 NumSetBit);
+void _XAie_SetBitInBitmapAtomic(u32 *Bitmap, u32 StartBit, u32 NumBit);
+void _XAie_ClrBitInBitmapAtomic(u32 *Bitmap, u32 StartBit, u32 NumBit);
 AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value);
 AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data);
 AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value);
 AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 		u32 TimeOutUs);
+AieRC XAie_TxnRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data);
+AieRC XAie_TxnMemSync(XAie_DevInst *DevInst, const XAie_MemSyncRange *Range);
 AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data,
 			u32 Size);
+AieRC XAie_BlockWrite32Shared(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Size);
+AieRC _XAie_BlockWrite32User(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Size);
+u8 _XAie_TxnSetSharePayloads(XAie_DevInst *DevInst, u8 Share);
 AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size);
+AieRC XAie_BlockRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data, u32 Size);
 AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 		u32 CmdWd0, u32 CmdWd1, const char *CmdStr);
 AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg);
 AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags);
 AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
 XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst);
+XAie_TxnInst* _XAie_TxnClone(const XAie_TxnInst *TmpInst);
 AieRC _XAie_TxnFree(XAie_TxnInst *Inst);
+XAie_TxnInst* _XAie_TxnDetach(XAie_DevInst *DevInst);
+u8 _XAie_TxnIsActive(XAie_DevInst *DevInst);
 void _XAie_TxnResourceCleanup(XAie_DevInst *DevInst);
+AieRC _XAie_TxnLocksInit(XAie_DevInst *DevInst);
+void _XAie_TxnLocksFinish(XAie_DevInst *DevInst);
+void *_XAie_TxnArenaAlloc(XAie_TxnInst *TxnInst, u64 Size);
+void _XAie_TxnArenaFree(XAie_TxnInst *TxnInst);
 u32 _XAie_GetNumRows(XAie_DevInst *DevInst, u8 TileType);
 u32 _XAie_GetStartRow(XAie_DevInst *DevInst, u8 TileType);
 
@@ -0,0 +1,226 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_iorecord.c
+* @{
+*
+* This file contains routines for the binary recording of register accesses
+* by the debug backend. Instead of printing every access, the backend stores
+* a fixed size record per access in a ring owned by the caller. The records
+* are decoded to text or replayed on a device instance offline.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "xaie_helper.h"
+#include "xaie_io.h"
+#include "xaie_iorecord.h"
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This function returns the index of the oldest record of a ring and the
+* number of records the ring holds.
+*
+* @param	Ring: Ring of records.
+* @param	Num: Pointer to return the number of records.
+*
+* @return	Index of the oldest record.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_IORecordFirst(const XAie_IORecordRing *Ring, u32 *Num)
+{
+	if(Ring->NumWritten <= Ring->NumRecords) {
+		*Num = (u32)Ring->NumWritten;
+		return 0U;
+	}
+
+	*Num = Ring->NumRecords;
+	return (u32)(Ring->NumWritten % Ring->NumRecords);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts or stops the binary recording of the register accesses of
+* the debug backend. While recording, the backend stores one record per access
+* in the ring instead of printing it.
+*
+* @param	DevInst: Device Instance
+* @param	Ring: Ring of records owned by the caller, NULL stops recording
+*		and goes back to printing the accesses.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the backend
+*		does not record accesses and error code on failure.
+*
+* @note		Only supported by the debug backend. NumWritten of the ring is
+*		reset when recording starts and updated by every access. The
+*		ring has to stay valid until recording is stopped.
+*
+*******************************************************************************/
+AieRC XAie_ConfigIORecord(XAie_DevInst *DevInst, XAie_IORecordRing *Ring)
+{
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Ring != XAIE_NULL) && ((Ring->Records == XAIE_NULL) ||
+				(Ring->NumRecords == 0U))) {
+		XAIE_ERROR("Invalid record ring\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_IO_RECORD,
+			(void *)Ring);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API decodes the records of a ring to text, from the oldest to the
+* newest. The accesses are printed in the format of the debug backend,
+* prefixed with their time stamp.
+*
+* @param	Ring: Ring of records.
+* @param	Fd: File to print to.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_IORecordPrint(const XAie_IORecordRing *Ring, FILE *Fd)
+{
+	u32 Idx, Num;
+
+	if((Ring == XAIE_NULL) || (Ring->Records == XAIE_NULL) ||
+			(Ring->NumRecords == 0U) || (Fd == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Idx = _XAie_IORecordFirst(Ring, &Num);
+	for(u32 i = 0U; i < Num; i++) {
+		const XAie_IORecord *Rec = &Ring->Records[Idx];
+
+		fprintf(Fd, "%" PRIu64 " ", Rec->TimeStamp);
+		switch(Rec->Op) {
+		case XAIE_IO_RECORD_WRITE:
+			fprintf(Fd, "W: 0x%" PRIx64 ", 0x%x\n", Rec->RegOff,
+					Rec->Value);
+			break;
+		case XAIE_IO_RECORD_MASKWRITE:
+			fprintf(Fd, "MW: 0x%" PRIx64 ", 0x%x, 0x%x\n",
+					Rec->RegOff, Rec->Mask, Rec->Value);
+			break;
+		case XAIE_IO_RECORD_READ:
+			fprintf(Fd, "R: 0x%" PRIx64 ", 0x%x\n", Rec->RegOff,
+					Rec->Value);
+			break;
+		case XAIE_IO_RECORD_MASKPOLL:
+			fprintf(Fd, "MP: 0x%" PRIx64 ", 0x%x, 0x%x, %u\n",
+					Rec->RegOff, Rec->Mask, Rec->Value,
+					Rec->Size);
+			break;
+		case XAIE_IO_RECORD_BLOCKSET:
+			fprintf(Fd, "BS: 0x%" PRIx64 ", 0x%x, %u\n",
+					Rec->RegOff, Rec->Value, Rec->Size);
+			break;
+		case XAIE_IO_RECORD_NPIWRITE:
+			fprintf(Fd, "NPIMW: 0x%" PRIx64 ", 0x%x\n",
+					Rec->RegOff, Rec->Value);
+			break;
+		case XAIE_IO_RECORD_NPIMASKPOLL:
+			fprintf(Fd, "NPIMP: 0x%" PRIx64 ", 0x%x, 0x%x, %u\n",
+					Rec->RegOff, Rec->Mask, Rec->Value,
+					Rec->Size);
+			break;
+		default:
+			fprintf(Fd, "Invalid record op %u\n", Rec->Op);
+			break;
+		}
+
+		Idx = (Idx + 1U == Ring->NumRecords) ? 0U : Idx + 1U;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API replays the records of a ring on a device instance, from the oldest
+* to the newest. Writes, mask writes, block sets and mask polls are issued
+* again, reads and NPI accesses are skipped.
+*
+* @param	DevInst: Device Instance
+* @param	Ring: Ring of records.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The replay can be captured in a transaction by calling it
+*		between XAie_StartTransaction() and XAie_SubmitTransaction().
+*		It stops at the first access which fails.
+*
+*******************************************************************************/
+AieRC XAie_IORecordReplay(XAie_DevInst *DevInst,
+		const XAie_IORecordRing *Ring)
+{
+	u32 Idx, Num;
+	AieRC RC = XAIE_OK;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Ring == XAIE_NULL) || (Ring->Records == XAIE_NULL) ||
+			(Ring->NumRecords == 0U)) {
+		XAIE_ERROR("Invalid record ring\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Idx = _XAie_IORecordFirst(Ring, &Num);
+	for(u32 i = 0U; (i < Num) && (RC == XAIE_OK); i++) {
+		const XAie_IORecord *Rec = &Ring->Records[Idx];
+
+		switch(Rec->Op) {
+		case XAIE_IO_RECORD_WRITE:
+			RC = XAie_Write32(DevInst, Rec->RegOff, Rec->Value);
+			break;
+		case XAIE_IO_RECORD_MASKWRITE:
+			RC = XAie_MaskWrite32(DevInst, Rec->RegOff, Rec->Mask,
+					Rec->Value);
+			break;
+		case XAIE_IO_RECORD_MASKPOLL:
+			RC = XAie_MaskPoll(DevInst, Rec->RegOff, Rec->Mask,
+					Rec->Value, Rec->Size);
+			break;
+		case XAIE_IO_RECORD_BLOCKSET:
+			RC = XAie_BlockSet32(DevInst, Rec->RegOff, Rec->Value,
+					Rec->Size);
+			break;
+		default:
+			break;
+		}
+
+		Idx = (Idx + 1U == Ring->NumRecords) ? 0U : Idx + 1U;
+	}
+
+	return RC;
+}
+
+/** @} */
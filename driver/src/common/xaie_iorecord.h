@@ -0,0 +1,71 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_iorecord.h
+* @{
+*
+* This file contains the binary record format of the register accesses
+* captured by the debug backend, and the routines to decode and replay them.
+*
+******************************************************************************/
+#ifndef XAIE_IORECORD_H
+#define XAIE_IORECORD_H
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+
+#include "xaiegbl.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * This enum captures the register accesses of the debug backend records.
+ */
+typedef enum {
+	XAIE_IO_RECORD_WRITE,		/* Write32 or a word of a block write */
+	XAIE_IO_RECORD_MASKWRITE,
+	XAIE_IO_RECORD_READ,
+	XAIE_IO_RECORD_MASKPOLL,	/* Size holds the timeout in us */
+	XAIE_IO_RECORD_BLOCKSET,	/* Size holds the number of words */
+	XAIE_IO_RECORD_NPIWRITE,
+	XAIE_IO_RECORD_NPIMASKPOLL,	/* Size holds the timeout in us */
+} XAie_IORecordOp;
+
+/*
+ * This typedef captures one recorded register access. RegOff is relative to
+ * the partition base address, or to the NPI base address for NPI accesses.
+ */
+typedef struct {
+	u64 TimeStamp;	/* Monotonic time of the access in ns, 0 if unknown */
+	u64 RegOff;
+	u32 Value;
+	u32 Mask;
+	u32 Size;
+	u8 Op;		/* XAie_IORecordOp */
+	u8 Rsvd[3];
+} XAie_IORecord;
+
+/*
+ * This typedef captures a ring of records owned by the caller. The records
+ * can live in any memory, e.g. a mmapped file. Once the ring is full, the
+ * oldest records are overwritten.
+ */
+typedef struct {
+	XAie_IORecord *Records;
+	u32 NumRecords;		/* Capacity of the ring */
+	u64 NumWritten;		/* Records written since recording started */
+} XAie_IORecordRing;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_ConfigIORecord(XAie_DevInst *DevInst, XAie_IORecordRing *Ring);
+AieRC XAie_IORecordPrint(const XAie_IORecordRing *Ring, FILE *Fd);
+AieRC XAie_IORecordReplay(XAie_DevInst *DevInst,
+		const XAie_IORecordRing *Ring);
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -0,0 +1,387 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_iostats.c
+* @{
+*
+* This file contains routines for the statistics of the register accesses
+* issued to the IO backend. Every backend operation is counted with its
+* register bytes and latency, and attributed to the driver API which entered
+* the register access layer on the calling thread. The hooks are compiled in
+* with XAIE_FEATURE_IO_STATS_ENABLE only, and cost a NULL check per access
+* until the statistics are enabled.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_iostats.h"
+
+#ifdef XAIE_FEATURE_IO_STATS_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_IO_STATS_NS_PER_SEC	1000000000ULL
+
+/**************************** Type Definitions *******************************/
+struct XAie_IOStatsInst {
+	XAie_IOStats Stats;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+#endif
+};
+
+/************************** Variable Definitions *****************************/
+#ifndef __AIEBAREMETAL__
+static __thread const void *_XAie_IOStatsCaller;
+#else
+static const void *_XAie_IOStatsCaller;
+#endif
+
+/************************** Function Definitions *****************************/
+#ifndef __AIEBAREMETAL__
+static inline void _XAie_IOStatsLock(XAie_IOStatsInst *Inst)
+{
+	pthread_mutex_lock(&Inst->Lock);
+}
+
+static inline void _XAie_IOStatsUnlock(XAie_IOStatsInst *Inst)
+{
+	pthread_mutex_unlock(&Inst->Lock);
+}
+#else
+static inline void _XAie_IOStatsLock(XAie_IOStatsInst *Inst)
+{
+	(void)Inst;
+}
+
+static inline void _XAie_IOStatsUnlock(XAie_IOStatsInst *Inst)
+{
+	(void)Inst;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API records the driver API which enters the register access layer on
+* the calling thread. The following backend operations of the thread are
+* attributed to it.
+*
+* @param	Caller: Return address into the driver API.
+*
+* @return	None.
+*
+* @note		Internal only. Called with XAIE_IO_STATS_CALLER().
+*
+******************************************************************************/
+void _XAie_IOStatsSetCaller(const void *Caller)
+{
+	_XAie_IOStatsCaller = Caller;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the time stamp at the start of a backend operation.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	Host monotonic time in nanoseconds, 0 on baremetal.
+*
+* @note		Internal only. Called with XAIE_IO_STATS_START().
+*
+******************************************************************************/
+u64 _XAie_IOStatsStart(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+#ifndef __AIEBAREMETAL__
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * XAIE_IO_STATS_NS_PER_SEC + (u64)Ts.tv_nsec;
+#else
+	return 0U;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the entry of a caller in the caller table, adding it if
+* the table has room.
+*
+* @param	Stats: Statistics of the device instance.
+* @param	Caller: Return address into the driver API.
+*
+* @return	Pointer to the entry, NULL if the table is full.
+*
+* @note		Internal only. The table is searched linearly from a slot
+*		hashed from the caller, entries are never removed before the
+*		statistics are reset.
+*
+******************************************************************************/
+static XAie_IOCallerStats* _XAie_IOStatsCallerEntry(XAie_IOStats *Stats,
+		const void *Caller)
+{
+	u32 Slot = (u32)(((uintptr_t)Caller >> 2U) %
+			XAIE_IO_STATS_MAX_CALLERS);
+
+	for(u32 i = 0U; i < XAIE_IO_STATS_MAX_CALLERS; i++) {
+		XAie_IOCallerStats *Entry = &Stats->Callers[Slot];
+
+		if(Entry->Caller == Caller) {
+			return Entry;
+		}
+
+		if(Entry->Caller == NULL) {
+			Entry->Caller = Caller;
+			Stats->NumCallers++;
+			return Entry;
+		}
+
+		Slot = (Slot + 1U) % XAIE_IO_STATS_MAX_CALLERS;
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API accounts a completed backend operation.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Op: Backend operation.
+* @param	Bytes: Register bytes written or read by the operation.
+* @param	Start: Time stamp returned by _XAie_IOStatsStart().
+*
+* @return	None.
+*
+* @note		Internal only. Called with XAIE_IO_STATS_END().
+*
+******************************************************************************/
+void _XAie_IOStatsEnd(XAie_DevInst *DevInst, XAie_IOStatsOp Op, u64 Bytes,
+		u64 Start)
+{
+	XAie_IOStatsInst *Inst = DevInst->IOStats;
+	XAie_IOCallerStats *Entry;
+	XAie_IOOpStats *OpStats;
+	u64 Ns = _XAie_IOStatsStart(DevInst) - Start;
+	u32 Bucket = 0U;
+
+	while(((Ns >> (Bucket + 1U)) != 0U) &&
+			(Bucket < XAIE_IO_STATS_NUM_BUCKETS - 1U)) {
+		Bucket++;
+	}
+
+	_XAie_IOStatsLock(Inst);
+	OpStats = &Inst->Stats.Op[Op];
+	OpStats->Count++;
+	OpStats->Bytes += Bytes;
+	OpStats->TotalNs += Ns;
+	if(Ns > OpStats->MaxNs) {
+		OpStats->MaxNs = Ns;
+	}
+	OpStats->Hist[Bucket]++;
+
+	Entry = _XAie_IOStatsCallerEntry(&Inst->Stats, _XAie_IOStatsCaller);
+	if(Entry != NULL) {
+		Entry->Count[Op]++;
+		Entry->TotalNs += Ns;
+	} else {
+		Inst->Stats.UntrackedCalls++;
+	}
+	_XAie_IOStatsUnlock(Inst);
+}
+
+#endif /* XAIE_FEATURE_IO_STATS_ENABLE */
+
+/*****************************************************************************/
+/**
+*
+* This API enables or disables the statistics of the register accesses of a
+* device instance. Once enabled, every Write32, Read32, MaskWrite32, MaskPoll,
+* BlockWrite32, BlockSet32, BlockRead32 and RunOp operation issued to the
+* backend is counted with its register bytes and latency.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Enable: XAIE_ENABLE to enable the statistics, XAIE_DISABLE to
+*		disable them.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the driver is
+*		built without XAIE_FEATURE_IO_STATS_ENABLE and error code on
+*		failure.
+*
+* @note		The statistics are disabled by default and dropped when they
+*		are disabled. Register accesses recorded into a transaction
+*		are only counted when the transaction is submitted, as part
+*		of the operations which reach the backend.
+*
+******************************************************************************/
+AieRC XAie_ConfigIOStats(XAie_DevInst *DevInst, u8 Enable)
+{
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+#ifdef XAIE_FEATURE_IO_STATS_ENABLE
+	XAie_IOStatsInst *Inst;
+
+	if(Enable == XAIE_DISABLE) {
+		_XAie_IOStatsFinish(DevInst);
+		return XAIE_OK;
+	}
+
+	if(DevInst->IOStats != NULL) {
+		return XAIE_OK;
+	}
+
+	Inst = (XAie_IOStatsInst *)calloc(1U, sizeof(*Inst));
+	if(Inst == NULL) {
+		XAIE_ERROR("Failed to allocate the IO statistics\n");
+		return XAIE_ERR;
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_init(&Inst->Lock, NULL);
+#endif
+	DevInst->IOStats = Inst;
+
+	return XAIE_OK;
+#else
+	(void)Enable;
+	XAIE_ERROR("IO statistics are not supported in this build\n");
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the statistics of the register accesses of a device
+* instance.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Stats: Pointer to return the statistics.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the driver is
+*		built without XAIE_FEATURE_IO_STATS_ENABLE and error code on
+*		failure.
+*
+* @note		The latencies are 0 on baremetal.
+*
+******************************************************************************/
+AieRC XAie_IOStatsGet(XAie_DevInst *DevInst, XAie_IOStats *Stats)
+{
+	if((DevInst == XAIE_NULL) || (Stats == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+#ifdef XAIE_FEATURE_IO_STATS_ENABLE
+	XAie_IOStatsInst *Inst = DevInst->IOStats;
+
+	if(Inst == NULL) {
+		XAIE_ERROR("IO statistics are not enabled\n");
+		return XAIE_ERR;
+	}
+
+	_XAie_IOStatsLock(Inst);
+	*Stats = Inst->Stats;
+	_XAie_IOStatsUnlock(Inst);
+
+	return XAIE_OK;
+#else
+	XAIE_ERROR("IO statistics are not supported in this build\n");
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the statistics of the register accesses of a device
+* instance. The statistics stay enabled.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the driver is
+*		built without XAIE_FEATURE_IO_STATS_ENABLE and error code on
+*		failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_IOStatsReset(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+#ifdef XAIE_FEATURE_IO_STATS_ENABLE
+	XAie_IOStatsInst *Inst = DevInst->IOStats;
+
+	if(Inst == NULL) {
+		return XAIE_OK;
+	}
+
+	_XAie_IOStatsLock(Inst);
+	memset(&Inst->Stats, 0, sizeof(Inst->Stats));
+	_XAie_IOStatsUnlock(Inst);
+
+	return XAIE_OK;
+#else
+	XAIE_ERROR("IO statistics are not supported in this build\n");
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees the statistics of the register accesses of a device instance.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_IOStatsFinish(XAie_DevInst *DevInst)
+{
+#ifdef XAIE_FEATURE_IO_STATS_ENABLE
+	XAie_IOStatsInst *Inst = DevInst->IOStats;
+
+	if(Inst == NULL) {
+		return;
+	}
+
+	DevInst->IOStats = NULL;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_destroy(&Inst->Lock);
+#endif
+	free(Inst);
+#else
+	(void)DevInst;
+#endif
+}
+
+/** @} */
@@ -0,0 +1,109 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_iostats.h
+* @{
+*
+* This file contains the statistics of the register accesses issued to the IO
+* backend. The statistics are compiled in with XAIE_FEATURE_IO_STATS_ENABLE
+* and collected once enabled with XAie_ConfigIOStats().
+*
+******************************************************************************/
+#ifndef XAIE_IOSTATS_H
+#define XAIE_IOSTATS_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_IO_STATS_NUM_BUCKETS	32U
+#define XAIE_IO_STATS_MAX_CALLERS	64U
+
+/**************************** Type Definitions *******************************/
+/*
+ * This enum captures the backend operations counted by the statistics.
+ */
+typedef enum {
+	XAIE_IO_STATS_WRITE32,
+	XAIE_IO_STATS_READ32,
+	XAIE_IO_STATS_MASKWRITE32,
+	XAIE_IO_STATS_MASKPOLL,
+	XAIE_IO_STATS_BLOCKWRITE32,
+	XAIE_IO_STATS_BLOCKSET32,
+	XAIE_IO_STATS_BLOCKREAD32,
+	XAIE_IO_STATS_RUNOP,
+	XAIE_IO_STATS_MAX_OPS
+} XAie_IOStatsOp;
+
+/*
+ * This typedef captures the statistics of one backend operation. Bucket i of
+ * the latency histogram counts the calls which took from 2^i up to 2^(i+1)
+ * nanoseconds, bucket 0 also counts the calls of less than 1ns and the last
+ * bucket all the longer calls.
+ */
+typedef struct {
+	u64 Count;
+	u64 Bytes;	/* Register bytes written or read */
+	u64 TotalNs;
+	u64 MaxNs;
+	u64 Hist[XAIE_IO_STATS_NUM_BUCKETS];
+} XAie_IOOpStats;
+
+/*
+ * This typedef captures the backend operations issued on behalf of one caller
+ * of the register access layer. Caller is the return address into the driver
+ * API, which can be resolved to a function name with dladdr() or addr2line.
+ */
+typedef struct {
+	const void *Caller;
+	u64 Count[XAIE_IO_STATS_MAX_OPS];
+	u64 TotalNs;
+} XAie_IOCallerStats;
+
+/*
+ * This typedef captures the statistics of the register accesses of a device
+ * instance.
+ */
+typedef struct {
+	XAie_IOOpStats Op[XAIE_IO_STATS_MAX_OPS];
+	XAie_IOCallerStats Callers[XAIE_IO_STATS_MAX_CALLERS];
+	u32 NumCallers;
+	u64 UntrackedCalls;	/* Calls of callers beyond the caller table */
+} XAie_IOStats;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_ConfigIOStats(XAie_DevInst *DevInst, u8 Enable);
+AieRC XAie_IOStatsGet(XAie_DevInst *DevInst, XAie_IOStats *Stats);
+AieRC XAie_IOStatsReset(XAie_DevInst *DevInst);
+void _XAie_IOStatsFinish(XAie_DevInst *DevInst);
+
+#ifdef XAIE_FEATURE_IO_STATS_ENABLE
+void _XAie_IOStatsSetCaller(const void *Caller);
+u64 _XAie_IOStatsStart(XAie_DevInst *DevInst);
+void _XAie_IOStatsEnd(XAie_DevInst *DevInst, XAie_IOStatsOp Op, u64 Bytes,
+		u64 Start);
+
+#define XAIE_IO_STATS_CALLER()	\
+	_XAie_IOStatsSetCaller(__builtin_return_address(0))
+#define XAIE_IO_STATS_START(DevInst)	\
+	(((DevInst)->IOStats != NULL) ? _XAie_IOStatsStart(DevInst) : 0U)
+#define XAIE_IO_STATS_END(DevInst, Op, Bytes, Start)	\
+	do { \
+		if((DevInst)->IOStats != NULL) { \
+			_XAie_IOStatsEnd((DevInst), (Op), (Bytes), (Start)); \
+		} \
+	} while(0)
+#else
+#define XAIE_IO_STATS_CALLER()
+#define XAIE_IO_STATS_START(DevInst)			0U
+#define XAIE_IO_STATS_END(DevInst, Op, Bytes, Start)	(void)(Start)
+#endif /* XAIE_FEATURE_IO_STATS_ENABLE */
+
+#endif		/* end of protection macro */
+
+/** @} */
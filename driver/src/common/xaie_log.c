@@ -0,0 +1,438 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_log.c
+* @{
+*
+* This file contains the routines which write the log messages of the driver,
+* with the runtime level, the rate limit of the call sites and the optional
+* log thread.
+*
+* The log state is global, as messages are logged by code without a device
+* instance. With the log thread, messages are copied to a ring of fixed size
+* entries and written by the thread; messages which do not fit are dropped
+* and counted as suppressed.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifndef __AIEBAREMETAL__
+#define  _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#include "xaie_helper.h"
+#include "xaie_log.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_LOG_DEFAULT_BURST		100U
+#define XAIE_LOG_DEFAULT_PERIOD_NS	1000000000U
+
+/**************************** Type Definitions *******************************/
+/* Message queued to the log thread */
+typedef struct {
+	FILE *Fd;
+	char Msg[XAIE_LOG_MAX_LEN];
+} XAie_LogEntry;
+
+/* Ring of messages written by the log thread */
+typedef struct {
+	XAie_LogEntry *Entries;
+	u32 NumEntries;
+	u32 Head;		/* Oldest message */
+	u32 Count;		/* Messages queued */
+	u8 Stop;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+	pthread_cond_t Cond;
+	pthread_t Thread;
+#endif
+} XAie_LogAsync;
+
+/***************************** Global Variables ******************************/
+u8 _XAie_LogLevel = XAIE_LOG_COMPILE_LEVEL;
+static u32 _XAie_LogBurst = XAIE_LOG_DEFAULT_BURST;
+static u64 _XAie_LogPeriodNs = XAIE_LOG_DEFAULT_PERIOD_NS;
+static u64 _XAie_LogSuppressed;
+#ifndef __AIEBAREMETAL__
+static XAie_LogAsync *_XAie_LogRing;
+#endif
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the current time for the rate limit of the call sites.
+*
+* @return	Monotonic time in nanoseconds, 0 without a clock.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u64 _XAie_LogNowNs(void)
+{
+#ifndef __AIEBAREMETAL__
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * 1000000000U + (u64)Ts.tv_nsec;
+#else
+	return 0U;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a formatted message, or queues it to the log thread.
+*
+* @param	Fd: File to write the message to.
+* @param	Msg: Message.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_LogWrite(FILE *Fd, const char *Msg)
+{
+#ifndef __AIEBAREMETAL__
+	XAie_LogAsync *Ring = __atomic_load_n(&_XAie_LogRing, __ATOMIC_ACQUIRE);
+
+	if(Ring != NULL) {
+		pthread_mutex_lock(&Ring->Lock);
+		if(Ring->Stop == 0U) {
+			if(Ring->Count < Ring->NumEntries) {
+				XAie_LogEntry *E = &Ring->Entries[(Ring->Head +
+						Ring->Count) % Ring->NumEntries];
+
+				E->Fd = Fd;
+				strcpy(E->Msg, Msg);
+				Ring->Count++;
+				pthread_cond_signal(&Ring->Cond);
+			} else {
+				__atomic_fetch_add(&_XAie_LogSuppressed, 1U,
+						__ATOMIC_RELAXED);
+			}
+			pthread_mutex_unlock(&Ring->Lock);
+			return;
+		}
+		pthread_mutex_unlock(&Ring->Lock);
+	}
+#endif
+
+	fputs(Msg, Fd);
+}
+
+void XAie_Log(FILE *Fd, const char *prefix, const char *func, u32 line,
+		const char *Format, ...)
+{
+	char Msg[XAIE_LOG_MAX_LEN];
+	va_list ArgPtr;
+	int Len;
+
+	/*
+	 * Format the whole message before writing it with a single call, so
+	 * that messages of instances logging from different threads do not
+	 * interleave. Messages longer than the buffer are truncated.
+	 */
+	Len = snprintf(Msg, sizeof(Msg), "%s %s():%u: ", prefix, func, line);
+	if(Len < 0) {
+		return;
+	}
+
+	if((u32)Len < sizeof(Msg)) {
+		va_start(ArgPtr, Format);
+		vsnprintf(Msg + Len, sizeof(Msg) - (u32)Len, Format, ArgPtr);
+		va_end(ArgPtr);
+	}
+
+	_XAie_LogWrite(Fd, Msg);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API applies the rate limit of a call site. Once the burst of messages
+* of a period was logged, the messages of the call site are suppressed until
+* the next period, which starts with a count of the suppressed messages.
+*
+* @param	Site: Rate limit state of the call site.
+* @param	Fd: File of the messages of the call site.
+* @param	Prefix: Prefix of the messages of the call site.
+* @param	Func: Function of the call site.
+* @param	Line: Line of the call site.
+*
+* @return	1 if the message can be logged, 0 if it is suppressed.
+*
+* @note		Internal only, called by the log macros.
+*
+******************************************************************************/
+u8 _XAie_LogSiteCheck(XAie_LogSite *Site, FILE *Fd, const char *Prefix,
+		const char *Func, u32 Line)
+{
+	u32 Burst = __atomic_load_n(&_XAie_LogBurst, __ATOMIC_RELAXED);
+	u64 Start, Now;
+
+	if(Burst == 0U) {
+		return 1U;
+	}
+
+	Now = _XAie_LogNowNs();
+	Start = __atomic_load_n(&Site->WindowNs, __ATOMIC_RELAXED);
+	if(Now - Start >= __atomic_load_n(&_XAie_LogPeriodNs,
+				__ATOMIC_RELAXED) &&
+			__atomic_compare_exchange_n(&Site->WindowNs, &Start,
+				Now, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+		u32 Dropped;
+
+		__atomic_store_n(&Site->Count, 0U, __ATOMIC_RELAXED);
+		Dropped = __atomic_exchange_n(&Site->Suppressed, 0U,
+				__ATOMIC_RELAXED);
+		if(Dropped != 0U) {
+			XAie_Log(Fd, Prefix, Func, Line,
+					"%u messages suppressed\n", Dropped);
+		}
+	}
+
+	if(__atomic_fetch_add(&Site->Count, 1U, __ATOMIC_RELAXED) < Burst) {
+		return 1U;
+	}
+
+	__atomic_fetch_add(&Site->Suppressed, 1U, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&_XAie_LogSuppressed, 1U, __ATOMIC_RELAXED);
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the highest level of the messages logged. Messages of levels
+* above it are skipped before their arguments are formatted.
+*
+* @param	Level: XAIE_LOG_LEVEL_NONE, XAIE_LOG_LEVEL_ERROR,
+*		XAIE_LOG_LEVEL_WARN or XAIE_LOG_LEVEL_DEBUG.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Messages above XAIE_LOG_COMPILE_LEVEL are compiled out and
+*		cannot be enabled at runtime.
+*
+******************************************************************************/
+AieRC XAie_LogSetLevel(u8 Level)
+{
+	if(Level > XAIE_LOG_LEVEL_DEBUG) {
+		XAIE_ERROR("Invalid log level\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	__atomic_store_n(&_XAie_LogLevel, Level, __ATOMIC_RELAXED);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the rate limit of the call sites of the log messages.
+*
+* @param	Burst: Messages a call site can log in a period, 0 for no
+*		limit.
+* @param	PeriodMs: Period in milliseconds.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The limit defaults to 100 messages per second. Baremetal
+*		builds have no clock, so a call site logs Burst messages in
+*		all.
+*
+******************************************************************************/
+AieRC XAie_LogSetRateLimit(u32 Burst, u32 PeriodMs)
+{
+	if(Burst != 0U && PeriodMs == 0U) {
+		XAIE_ERROR("Invalid log rate limit period\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	__atomic_store_n(&_XAie_LogPeriodNs, (u64)PeriodMs * 1000000U,
+			__ATOMIC_RELAXED);
+	__atomic_store_n(&_XAie_LogBurst, Burst, __ATOMIC_RELAXED);
+
+	return XAIE_OK;
+}
+
+#ifndef __AIEBAREMETAL__
+/*****************************************************************************/
+/**
+*
+* This API is the log thread. It writes the queued messages until it is
+* stopped and the ring is empty.
+*
+* @param	Arg: Ring of messages.
+*
+* @return	NULL.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void *_XAie_LogThread(void *Arg)
+{
+	XAie_LogAsync *Ring = (XAie_LogAsync *)Arg;
+	XAie_LogEntry E;
+
+	pthread_mutex_lock(&Ring->Lock);
+	while(1) {
+		while(Ring->Count == 0U && Ring->Stop == 0U) {
+			pthread_cond_wait(&Ring->Cond, &Ring->Lock);
+		}
+		if(Ring->Count == 0U) {
+			break;
+		}
+
+		E = Ring->Entries[Ring->Head];
+		Ring->Head = (Ring->Head + 1U) % Ring->NumEntries;
+		Ring->Count--;
+
+		/* Write without the lock so loggers are not held */
+		pthread_mutex_unlock(&Ring->Lock);
+		fputs(E.Msg, E.Fd);
+		pthread_mutex_lock(&Ring->Lock);
+	}
+	pthread_mutex_unlock(&Ring->Lock);
+
+	return NULL;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API starts the log thread. Messages are then queued to a ring and
+* written by the thread, so the callers do not wait for the write.
+*
+* @param	NumMsgs: Number of messages of the ring. Messages logged while
+*		the ring is full are dropped.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Not supported in baremetal builds.
+*
+******************************************************************************/
+AieRC XAie_LogAsyncStart(u32 NumMsgs)
+{
+#ifndef __AIEBAREMETAL__
+	XAie_LogAsync *Ring;
+
+	if(NumMsgs == 0U) {
+		XAIE_ERROR("Invalid number of log messages\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(__atomic_load_n(&_XAie_LogRing, __ATOMIC_ACQUIRE) != NULL) {
+		XAIE_ERROR("Log thread already started\n");
+		return XAIE_ERR;
+	}
+
+	Ring = (XAie_LogAsync *)calloc(1U, sizeof(*Ring));
+	if(Ring == NULL) {
+		XAIE_ERROR("Memory allocation for log ring failed\n");
+		return XAIE_ERR;
+	}
+
+	Ring->Entries = (XAie_LogEntry *)malloc(NumMsgs *
+			sizeof(*Ring->Entries));
+	if(Ring->Entries == NULL) {
+		XAIE_ERROR("Memory allocation for log ring failed\n");
+		free(Ring);
+		return XAIE_ERR;
+	}
+	Ring->NumEntries = NumMsgs;
+	pthread_mutex_init(&Ring->Lock, NULL);
+	pthread_cond_init(&Ring->Cond, NULL);
+
+	if(pthread_create(&Ring->Thread, NULL, _XAie_LogThread, Ring) != 0) {
+		XAIE_ERROR("Unable to create log thread\n");
+		pthread_cond_destroy(&Ring->Cond);
+		pthread_mutex_destroy(&Ring->Lock);
+		free(Ring->Entries);
+		free(Ring);
+		return XAIE_ERR;
+	}
+
+	__atomic_store_n(&_XAie_LogRing, Ring, __ATOMIC_RELEASE);
+
+	return XAIE_OK;
+#else
+	(void)NumMsgs;
+	XAIE_ERROR("Log thread is not supported\n");
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stops the log thread after it wrote the queued messages. Messages
+* are written by their callers again.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		It must not be called while other threads log, as they may
+*		still hold the ring.
+*
+******************************************************************************/
+AieRC XAie_LogAsyncStop(void)
+{
+#ifndef __AIEBAREMETAL__
+	XAie_LogAsync *Ring = __atomic_exchange_n(&_XAie_LogRing, NULL,
+			__ATOMIC_ACQ_REL);
+
+	if(Ring == NULL) {
+		return XAIE_OK;
+	}
+
+	pthread_mutex_lock(&Ring->Lock);
+	Ring->Stop = 1U;
+	pthread_cond_signal(&Ring->Cond);
+	pthread_mutex_unlock(&Ring->Lock);
+	pthread_join(Ring->Thread, NULL);
+
+	pthread_cond_destroy(&Ring->Cond);
+	pthread_mutex_destroy(&Ring->Lock);
+	free(Ring->Entries);
+	free(Ring);
+#endif
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the number of messages suppressed by the rate limit or
+* dropped as the ring of the log thread was full.
+*
+* @return	Number of messages not logged.
+*
+* @note		None.
+*
+******************************************************************************/
+u64 XAie_LogGetSuppressed(void)
+{
+	return __atomic_load_n(&_XAie_LogSuppressed, __ATOMIC_RELAXED);
+}
+
+/** @} */
@@ -0,0 +1,67 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_log.h
+* @{
+*
+* This file contains the control of the driver log messages. Messages above
+* XAIE_LOG_COMPILE_LEVEL are compiled out, messages above the runtime level
+* are skipped before they are formatted, and every call site is limited to a
+* burst of messages per period. Messages can be written by a thread of their
+* own, off the path of the caller.
+*
+******************************************************************************/
+#ifndef XAIE_LOG_H
+#define XAIE_LOG_H
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+
+#include "xaiegbl.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_LOG_LEVEL_NONE		0U
+#define XAIE_LOG_LEVEL_ERROR		1U
+#define XAIE_LOG_LEVEL_WARN		2U
+#define XAIE_LOG_LEVEL_DEBUG		3U
+
+/* Highest level of the messages compiled in */
+#ifndef XAIE_LOG_COMPILE_LEVEL
+#ifdef XAIE_DEBUG
+#define XAIE_LOG_COMPILE_LEVEL		XAIE_LOG_LEVEL_DEBUG
+#else
+#define XAIE_LOG_COMPILE_LEVEL		XAIE_LOG_LEVEL_WARN
+#endif
+#endif
+
+#define XAIE_LOG_MAX_LEN		256U
+
+/**************************** Type Definitions *******************************/
+/* Rate limit state of a call site, one static instance per call site */
+typedef struct {
+	u64 WindowNs;		/* Start of the current period */
+	u32 Count;		/* Messages in the current period */
+	u32 Suppressed;		/* Messages suppressed in the current period */
+} XAie_LogSite;
+
+/* Highest level of the messages logged, set by XAie_LogSetLevel() */
+extern u8 _XAie_LogLevel;
+
+/************************** Function Prototypes  *****************************/
+void XAie_Log(FILE *Fd, const char *prefix, const char *func, u32 line,
+		const char *Format, ...);
+u8 _XAie_LogSiteCheck(XAie_LogSite *Site, FILE *Fd, const char *Prefix,
+		const char *Func, u32 Line);
+AieRC XAie_LogSetLevel(u8 Level);
+AieRC XAie_LogSetRateLimit(u32 Burst, u32 PeriodMs);
+AieRC XAie_LogAsyncStart(u32 NumMsgs);
+AieRC XAie_LogAsyncStop(void);
+u64 XAie_LogGetSuppressed(void);
+
+#endif		/* end of protection macro */
+/** @} */
@@ -0,0 +1,415 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_mempool.c
+* @{
+*
+* This file contains routines for the pool of memory buffers allocated with
+* XAie_MemAllocate(). Freed buffers are kept with their backend mapping in
+* buckets of size class and cache property, and handed out again to later
+* allocations of the same class instead of going to the backend allocator.
+* Sizes are rounded up to a class, four classes per power of two from 4KB to
+* 128MB. Larger buffers always go to the backend.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#endif
+
+#include "xaie_helper.h"
+#include "xaie_io.h"
+#include "xaie_mempool.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_MEMPOOL_MIN_SHIFT		12U
+#define XAIE_MEMPOOL_MAX_SHIFT		27U
+#define XAIE_MEMPOOL_STEPS		4U
+#define XAIE_MEMPOOL_NUM_CLASSES	\
+	((XAIE_MEMPOOL_MAX_SHIFT - XAIE_MEMPOOL_MIN_SHIFT) * \
+	 XAIE_MEMPOOL_STEPS + 1U)
+#define XAIE_MEMPOOL_MAX_PER_CLASS	8U
+#define XAIE_MEMPOOL_MAX_BYTES		(256ULL * 1024U * 1024U)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	XAie_MemInst *Bufs[XAIE_MEMPOOL_MAX_PER_CLASS];
+	u32 NumBufs;
+} XAie_MemPoolBucket;
+
+struct XAie_MemPool {
+	XAie_MemPoolBucket Bucket[XAIE_MEMPOOL_NUM_CLASSES]
+		[XAIE_MEM_NONCACHEABLE + 1U];
+	XAie_MemPoolStats Stats;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+#endif
+};
+
+/************************** Function Definitions *****************************/
+#ifndef __AIEBAREMETAL__
+static inline void _XAie_MemPoolLock(XAie_MemPool *Pool)
+{
+	pthread_mutex_lock(&Pool->Lock);
+}
+
+static inline void _XAie_MemPoolUnlock(XAie_MemPool *Pool)
+{
+	pthread_mutex_unlock(&Pool->Lock);
+}
+#else
+static inline void _XAie_MemPoolLock(XAie_MemPool *Pool)
+{
+	(void)Pool;
+}
+
+static inline void _XAie_MemPoolUnlock(XAie_MemPool *Pool)
+{
+	(void)Pool;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API returns the size class of a buffer size.
+*
+* @param	Size: Size of the buffer in bytes.
+* @param	ClassSize: Pointer to return the size of the class.
+*
+* @return	Index of the class, XAIE_MEMPOOL_NUM_CLASSES if the size is too
+*		large to be pooled.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u32 _XAie_MemPoolClass(u64 Size, u64 *ClassSize)
+{
+	u64 Max = Size - 1U;
+	u32 Shift = 0U;
+	u32 Step;
+
+	if(Size <= (1ULL << XAIE_MEMPOOL_MIN_SHIFT)) {
+		*ClassSize = 1ULL << XAIE_MEMPOOL_MIN_SHIFT;
+		return 0U;
+	}
+
+	if(Size > (1ULL << XAIE_MEMPOOL_MAX_SHIFT)) {
+		return XAIE_MEMPOOL_NUM_CLASSES;
+	}
+
+	/* 2^Shift <= Size - 1 < 2^(Shift + 1) */
+	while((Max >> (Shift + 1U)) != 0U) {
+		Shift++;
+	}
+
+	Step = (u32)(Max >> (Shift - 2U)) & (XAIE_MEMPOOL_STEPS - 1U);
+	*ClassSize = (1ULL << Shift) + ((u64)(Step + 1U) << (Shift - 2U));
+
+	return (Shift - XAIE_MEMPOOL_MIN_SHIFT) * XAIE_MEMPOOL_STEPS + Step +
+		1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the buffers held by the pool to the backend.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Pool: Pointer to the memory pool.
+*
+* @return	None.
+*
+* @note		Internal only. The pool lock must be held.
+*
+******************************************************************************/
+static void _XAie_MemPoolRelease(XAie_DevInst *DevInst, XAie_MemPool *Pool)
+{
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	for(u32 C = 0U; C < XAIE_MEMPOOL_NUM_CLASSES; C++) {
+		for(u32 P = 0U; P <= (u32)XAIE_MEM_NONCACHEABLE; P++) {
+			XAie_MemPoolBucket *Bucket = &Pool->Bucket[C][P];
+
+			while(Bucket->NumBufs > 0U) {
+				Bucket->NumBufs--;
+				Backend->Ops.MemFree(
+					Bucket->Bufs[Bucket->NumBufs]);
+				Pool->Stats.Released++;
+			}
+		}
+	}
+
+	Pool->Stats.CachedBytes = 0U;
+	Pool->Stats.CachedBufs = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API enables or disables the pool of memory buffers. Once enabled, the
+* buffers freed with XAie_MemFree() are kept with their mapping and reused by
+* XAie_MemAllocate() calls of the same size class and cache property. The
+* buffers held by the pool are returned to the backend when it is disabled.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Enable: XAIE_ENABLE to enable the pool, XAIE_DISABLE to
+*		disable it.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The pool is disabled by default. While it is enabled, the size
+*		of an allocated buffer is rounded up to its size class, and the
+*		content of a reused buffer is not cleared. At most 8 buffers
+*		per class and cache property, and 256MB in total, are kept.
+*
+******************************************************************************/
+AieRC XAie_ConfigMemPool(XAie_DevInst *DevInst, u8 Enable)
+{
+	XAie_MemPool *Pool;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Enable == XAIE_DISABLE) {
+		_XAie_MemPoolFinish(DevInst);
+		return XAIE_OK;
+	}
+
+	if(DevInst->MemPool != NULL) {
+		return XAIE_OK;
+	}
+
+	Pool = (XAie_MemPool *)calloc(1U, sizeof(*Pool));
+	if(Pool == NULL) {
+		XAIE_ERROR("Failed to allocate the memory pool\n");
+		return XAIE_ERR;
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_init(&Pool->Lock, NULL);
+#endif
+	DevInst->MemPool = Pool;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the statistics of the pool of memory buffers.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Stats: Pointer to return the statistics.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The statistics are reset when the pool is disabled.
+*
+******************************************************************************/
+AieRC XAie_MemPoolGetStats(XAie_DevInst *DevInst, XAie_MemPoolStats *Stats)
+{
+	XAie_MemPool *Pool;
+
+	if((DevInst == XAIE_NULL) || (Stats == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Pool = DevInst->MemPool;
+	if(Pool == NULL) {
+		XAIE_ERROR("Memory pool is not enabled\n");
+		return XAIE_ERR;
+	}
+
+	_XAie_MemPoolLock(Pool);
+	*Stats = Pool->Stats;
+	_XAie_MemPoolUnlock(Pool);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns all the buffers held by the pool of memory buffers to the
+* backend. The pool stays enabled.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_MemPoolTrim(XAie_DevInst *DevInst)
+{
+	XAie_MemPool *Pool;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Pool = DevInst->MemPool;
+	if(Pool == NULL) {
+		return XAIE_OK;
+	}
+
+	_XAie_MemPoolLock(Pool);
+	_XAie_MemPoolRelease(DevInst, Pool);
+	_XAie_MemPoolUnlock(Pool);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API allocates a memory buffer from the pool, or from the backend if the
+* pool holds no buffer of the size class and cache property.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Size: Size of the memory.
+* @param	Cache: Buffer to be cacheable or not.
+*
+* @return	Pointer to the memory instance, NULL on failure.
+*
+* @note		Internal only. The pool must be enabled.
+*
+******************************************************************************/
+XAie_MemInst* _XAie_MemPoolAllocate(XAie_DevInst *DevInst, u64 Size,
+		XAie_MemCacheProp Cache)
+{
+	XAie_MemPool *Pool = DevInst->MemPool;
+	XAie_MemPoolBucket *Bucket;
+	XAie_MemInst *MemInst = NULL;
+	u64 ClassSize = Size;
+	u32 Class;
+
+	Class = _XAie_MemPoolClass(Size, &ClassSize);
+
+	_XAie_MemPoolLock(Pool);
+	if(Class < XAIE_MEMPOOL_NUM_CLASSES) {
+		Bucket = &Pool->Bucket[Class][Cache];
+		if(Bucket->NumBufs > 0U) {
+			Bucket->NumBufs--;
+			MemInst = Bucket->Bufs[Bucket->NumBufs];
+			Pool->Stats.CachedBytes -= ClassSize;
+			Pool->Stats.CachedBufs--;
+			Pool->Stats.Hits++;
+		}
+	}
+	if(MemInst == NULL) {
+		Pool->Stats.Misses++;
+	}
+	_XAie_MemPoolUnlock(Pool);
+
+	if(MemInst == NULL) {
+		MemInst = DevInst->Backend->Ops.MemAllocate(DevInst,
+				ClassSize, Cache);
+		/* Not all the backends record them, the bucket is found by them */
+		if(MemInst != NULL) {
+			MemInst->Size = ClassSize;
+			MemInst->Cache = Cache;
+		}
+	}
+
+	return MemInst;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API gives a freed memory buffer to the pool.
+*
+* @param	MemInst: Memory instance pointer.
+*
+* @return	XAIE_ENABLE if the pool keeps the buffer, XAIE_DISABLE if the
+*		caller has to return it to the backend.
+*
+* @note		Internal only. Only buffers whose size is a size class are
+*		kept, which leaves out the buffers allocated before the pool
+*		was enabled, unless their size happens to be a class.
+*
+******************************************************************************/
+u8 _XAie_MemPoolFree(XAie_MemInst *MemInst)
+{
+	XAie_MemPool *Pool = MemInst->DevInst->MemPool;
+	XAie_MemPoolBucket *Bucket;
+	u64 ClassSize = 0U;
+	u8 Kept = XAIE_DISABLE;
+	u32 Class;
+
+	if((Pool == NULL) || (MemInst->Size == 0U) ||
+			(MemInst->Cache > XAIE_MEM_NONCACHEABLE)) {
+		return XAIE_DISABLE;
+	}
+
+	Class = _XAie_MemPoolClass(MemInst->Size, &ClassSize);
+	if((Class == XAIE_MEMPOOL_NUM_CLASSES) ||
+			(ClassSize != MemInst->Size)) {
+		return XAIE_DISABLE;
+	}
+
+	_XAie_MemPoolLock(Pool);
+	Bucket = &Pool->Bucket[Class][MemInst->Cache];
+	if((Bucket->NumBufs < XAIE_MEMPOOL_MAX_PER_CLASS) &&
+			(Pool->Stats.CachedBytes + ClassSize <=
+			 XAIE_MEMPOOL_MAX_BYTES)) {
+		Bucket->Bufs[Bucket->NumBufs] = MemInst;
+		Bucket->NumBufs++;
+		Pool->Stats.CachedBytes += ClassSize;
+		Pool->Stats.CachedBufs++;
+		Pool->Stats.Recycled++;
+		Kept = XAIE_ENABLE;
+	} else {
+		Pool->Stats.Released++;
+	}
+	_XAie_MemPoolUnlock(Pool);
+
+	return Kept;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the buffers held by the pool to the backend and frees the
+* pool.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only. It has to be called before the backend is
+*		closed.
+*
+******************************************************************************/
+void _XAie_MemPoolFinish(XAie_DevInst *DevInst)
+{
+	XAie_MemPool *Pool = DevInst->MemPool;
+
+	if(Pool == NULL) {
+		return;
+	}
+
+	_XAie_MemPoolRelease(DevInst, Pool);
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_destroy(&Pool->Lock);
+#endif
+	free(Pool);
+	DevInst->MemPool = NULL;
+}
+
+/** @} */
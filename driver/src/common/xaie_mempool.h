@@ -0,0 +1,46 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_mempool.h
+* @{
+*
+* This file contains the routines for the pool of memory buffers allocated
+* with XAie_MemAllocate().
+*
+******************************************************************************/
+#ifndef XAIE_MEMPOOL_H
+#define XAIE_MEMPOOL_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef contains the statistics of the memory buffer pool.
+ */
+typedef struct {
+	u64 Hits;	/* Allocations served with a cached buffer */
+	u64 Misses;	/* Allocations which went to the backend */
+	u64 Recycled;	/* Frees which kept the buffer in the pool */
+	u64 Released;	/* Frees which returned the buffer to the backend */
+	u64 CachedBytes; /* Size of the buffers held by the pool */
+	u32 CachedBufs;	/* Number of buffers held by the pool */
+} XAie_MemPoolStats;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_ConfigMemPool(XAie_DevInst *DevInst, u8 Enable);
+AieRC XAie_MemPoolGetStats(XAie_DevInst *DevInst, XAie_MemPoolStats *Stats);
+AieRC XAie_MemPoolTrim(XAie_DevInst *DevInst);
+XAie_MemInst* _XAie_MemPoolAllocate(XAie_DevInst *DevInst, u64 Size,
+		XAie_MemCacheProp Cache);
+u8 _XAie_MemPoolFree(XAie_MemInst *MemInst);
+void _XAie_MemPoolFinish(XAie_DevInst *DevInst);
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -0,0 +1,242 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_partgroup.c
+* @{
+*
+* This file contains routines to configure a group of partitions, such as the
+* replicas of a graph across the columns of a device or across devices, with
+* one recorded transaction. The transaction is relocated to the start column of
+* every member if needed, and submitted to all the members at once through the
+* asynchronous submission worker of each partition, so the members are
+* configured concurrently.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+
+#include "xaie_helper.h"
+#include "xaie_partgroup.h"
+#include "xaie_txn.h"
+
+/**************************** Type Definitions *******************************/
+/* Submission of a transaction to one member */
+typedef struct {
+	XAie_TxnInst *TxnInst;	/* Relocated copy, NULL if not relocated */
+	XAie_TxnFence *Fence;
+} XAie_PartGroupSubmission;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API initializes a group of partitions. All the members must be of the
+* same device generation and geometry, and must be initialized with
+* XAie_CfgInitialize().
+*
+* @param	Group: Group to initialize.
+* @param	Members: Array of the members of the group, owned by the
+*		caller.
+* @param	NumMembers: Number of members.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_PartGroupInit(XAie_PartGroup *Group, XAie_PartGroupMember *Members,
+		u32 NumMembers)
+{
+	const XAie_DevInst *First;
+
+	if((Group == XAIE_NULL) || (Members == XAIE_NULL) ||
+			(NumMembers == 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	First = Members[0U].DevInst;
+	for(u32 i = 0U; i < NumMembers; i++) {
+		const XAie_DevInst *DevInst = Members[i].DevInst;
+
+		if((DevInst == XAIE_NULL) ||
+				(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+			XAIE_ERROR("Invalid device instance of member %d\n", i);
+			return XAIE_INVALID_ARGS;
+		}
+
+		if((DevInst->DevProp.DevGen != First->DevProp.DevGen) ||
+				(DevInst->DevProp.RowShift !=
+				 First->DevProp.RowShift) ||
+				(DevInst->DevProp.ColShift !=
+				 First->DevProp.ColShift) ||
+				(DevInst->NumRows != First->NumRows)) {
+			XAIE_ERROR("Member %d is not of the device of the "
+					"group\n", i);
+			return XAIE_INVALID_DEVICE;
+		}
+
+		if(Members[i].StartCol >= DevInst->NumCols) {
+			XAIE_ERROR("Start column %d of member %d is out of the "
+					"partition\n", Members[i].StartCol, i);
+			return XAIE_INVALID_ARGS;
+		}
+
+		Members[i].Status = XAIE_OK;
+	}
+
+	Group->Members = Members;
+	Group->NumMembers = NumMembers;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the last column addressed by a transaction, relative to its
+* start column.
+*
+* @param	DevInst: Device instance of the group.
+* @param	TxnInst: Transaction instance.
+*
+* @return	Number of columns spanned by the commands.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u32 _XAie_PartGroupTxnCols(const XAie_DevInst *DevInst,
+		const XAie_TxnInst *TxnInst)
+{
+	u32 NumCols = 0U;
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		u32 Col = (u32)(TxnInst->CmdBuf[i].RegOff >>
+				DevInst->DevProp.ColShift);
+
+		if((Col >= TxnInst->StartCol) &&
+				(Col - TxnInst->StartCol + 1U > NumCols)) {
+			NumCols = Col - TxnInst->StartCol + 1U;
+		}
+	}
+
+	return NumCols;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API submits a transaction to all the members of a group and waits for
+* all of them to execute it. The transaction is placed at the start column of
+* each member, relocated copies are made for the members whose start column
+* differs from the one of the transaction. The result of every member is
+* returned in its Status.
+*
+* @param	Group: Group initialized with XAie_PartGroupInit().
+* @param	TxnInst: Exported or loaded transaction instance, usually
+*		recorded on one of the members.
+*
+* @return	XAIE_OK if all the members executed the transaction, XAIE_ERR
+*		if some of them failed.
+*
+* @note		Transactions with deferred reads, shim DMA BDs or memory syncs
+*		reference memory of a single partition and are rejected. The
+*		optimization flag is cleared from TxnInst, since the commands
+*		were already optimized when exported and the instance is
+*		executed by several workers at once.
+*
+******************************************************************************/
+AieRC XAie_PartGroupSubmit(XAie_PartGroup *Group, XAie_TxnInst *TxnInst)
+{
+	XAie_PartGroupSubmission *Sub;
+	AieRC RC = XAIE_OK;
+	u32 NumCols;
+
+	if((Group == XAIE_NULL) || (Group->Members == XAIE_NULL) ||
+			(TxnInst == XAIE_NULL) ||
+			!(TxnInst->Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
+		XAIE_ERROR("Invalid group or not exported transaction\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_TxnOpcode Opcode = TxnInst->CmdBuf[i].Opcode;
+
+		if((Opcode == XAIE_IO_READ) || (Opcode == XAIE_IO_SHIMDMABD) ||
+				(Opcode == XAIE_IO_MEMSYNC)) {
+			XAIE_ERROR("Transactions with reads or memory instances "
+					"cannot be submitted to a group\n");
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	Sub = (XAie_PartGroupSubmission *)calloc(Group->NumMembers,
+			sizeof(*Sub));
+	if(Sub == NULL) {
+		XAIE_ERROR("Failed to allocate memory for group submission\n");
+		return XAIE_ERR;
+	}
+
+	TxnInst->Flags &= ~XAIE_TRANSACTION_ENABLE_OPTIMIZE;
+	NumCols = _XAie_PartGroupTxnCols(Group->Members[0U].DevInst, TxnInst);
+
+	for(u32 i = 0U; i < Group->NumMembers; i++) {
+		XAie_PartGroupMember *Member = &Group->Members[i];
+		XAie_TxnInst *Inst = TxnInst;
+
+		Member->Status = XAIE_OK;
+		if(Member->StartCol != TxnInst->StartCol) {
+			Sub[i].TxnInst = _XAie_TxnClone(TxnInst);
+			if(Sub[i].TxnInst == NULL) {
+				Member->Status = XAIE_ERR;
+				continue;
+			}
+
+			Member->Status = XAie_TxnRelocate(Member->DevInst,
+					Sub[i].TxnInst, Member->StartCol);
+			if(Member->Status != XAIE_OK) {
+				continue;
+			}
+			Inst = Sub[i].TxnInst;
+		} else if(Member->StartCol + NumCols >
+				Member->DevInst->NumCols) {
+			XAIE_ERROR("Transaction does not fit in member %d\n",
+					i);
+			Member->Status = XAIE_INVALID_ARGS;
+			continue;
+		}
+
+		Sub[i].Fence = XAie_SubmitTransactionAsync(Member->DevInst,
+				Inst, NULL, NULL);
+		if(Sub[i].Fence == NULL) {
+			Member->Status = XAIE_ERR;
+		}
+	}
+
+	for(u32 i = 0U; i < Group->NumMembers; i++) {
+		if(Sub[i].Fence != NULL) {
+			Group->Members[i].Status = XAie_TxnFenceWait(
+					Sub[i].Fence);
+			XAie_TxnFenceFree(Sub[i].Fence);
+		}
+
+		if(Sub[i].TxnInst != NULL) {
+			_XAie_TxnFree(Sub[i].TxnInst);
+		}
+
+		if(Group->Members[i].Status != XAIE_OK) {
+			RC = XAIE_ERR;
+		}
+	}
+
+	free(Sub);
+
+	return RC;
+}
+
+/** @} */
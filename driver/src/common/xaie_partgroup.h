@@ -0,0 +1,50 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_partgroup.h
+* @{
+*
+* This file contains the routines to submit one recorded configuration to a
+* group of partitions.
+*
+******************************************************************************/
+#ifndef XAIE_PARTGROUP_H
+#define XAIE_PARTGROUP_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * Typedef to capture one partition of a group. StartCol is the column of the
+ * partition the recorded configuration is placed at, and Status holds the
+ * result of the last submission to the partition.
+ */
+typedef struct {
+	XAie_DevInst *DevInst;
+	u8 StartCol;
+	AieRC Status;
+} XAie_PartGroupMember;
+
+/*
+ * Typedef to capture a group of partitions of the same device generation, on
+ * one or more devices, configured with the same transactions.
+ */
+typedef struct {
+	XAie_PartGroupMember *Members;
+	u32 NumMembers;
+} XAie_PartGroup;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_PartGroupInit(XAie_PartGroup *Group, XAie_PartGroupMember *Members,
+		u32 NumMembers);
+AieRC XAie_PartGroupSubmit(XAie_PartGroup *Group, XAie_TxnInst *TxnInst);
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -0,0 +1,582 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_shadow.c
+* @{
+*
+* This file contains routines for the shadow cache of the configuration
+* registers. The cache keeps the last value written to or read from the
+* stream switch, event, performance counter, trace and tile control registers
+* so that writes of an unchanged value and reads of a known value do not reach
+* the device. Status, counter, lock and DMA registers change under the device
+* and are never cached.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#endif
+
+#include "xaie_helper.h"
+#include "xaie_shadow.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_SHADOW_ENTRY_BITS		12U
+#define XAIE_SHADOW_NUM_ENTRIES		(1U << XAIE_SHADOW_ENTRY_BITS)
+#define XAIE_SHADOW_MAX_RANGES		96U
+
+/**************************** Type Definitions *******************************/
+/* Range of cacheable register offsets within a tile, End is exclusive */
+typedef struct {
+	u32 Start;
+	u32 End;
+} XAie_ShadowRange;
+
+typedef struct {
+	u64 RegOff;
+	u32 Value;
+	u8 Valid;
+} XAie_ShadowEntry;
+
+struct XAie_ShadowCache {
+	XAie_ShadowRange Range[XAIEGBL_TILE_TYPE_MAX][XAIE_SHADOW_MAX_RANGES];
+	u8 NumRanges[XAIEGBL_TILE_TYPE_MAX];
+	XAie_ShadowEntry Entry[XAIE_SHADOW_NUM_ENTRIES];
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+#endif
+};
+
+/************************** Function Definitions *****************************/
+#ifndef __AIEBAREMETAL__
+static inline void _XAie_ShadowLock(XAie_ShadowCache *Shadow)
+{
+	pthread_mutex_lock(&Shadow->Lock);
+}
+
+static inline void _XAie_ShadowUnlock(XAie_ShadowCache *Shadow)
+{
+	pthread_mutex_unlock(&Shadow->Lock);
+}
+#else
+static inline void _XAie_ShadowLock(XAie_ShadowCache *Shadow)
+{
+	(void)Shadow;
+}
+
+static inline void _XAie_ShadowUnlock(XAie_ShadowCache *Shadow)
+{
+	(void)Shadow;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API returns the slot of a register offset in the shadow cache.
+*
+* @param	RegOff: Register offset.
+*
+* @return	Index of the cache entry.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline u32 _XAie_ShadowIndex(u64 RegOff)
+{
+	return (u32)(((RegOff >> 2U) * 0x9E3779B97F4A7C15ULL) >>
+			(64U - XAIE_SHADOW_ENTRY_BITS));
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds a range of registers to the cacheable ranges of a tile type.
+*
+* @param	Shadow: Pointer to the shadow cache.
+* @param	TileType: Type of the tile.
+* @param	Start: Offset of the first register within the tile.
+* @param	NumRegs: Number of registers in the range.
+*
+* @return	None.
+*
+* @note		Internal only. The ranges are merged once all of them are
+*		added.
+*
+******************************************************************************/
+static void _XAie_ShadowAddRange(XAie_ShadowCache *Shadow, u8 TileType,
+		u32 Start, u32 NumRegs)
+{
+	u8 Num = Shadow->NumRanges[TileType];
+
+	if((NumRegs == 0U) || (Num == XAIE_SHADOW_MAX_RANGES)) {
+		return;
+	}
+
+	Shadow->Range[TileType][Num].Start = Start;
+	Shadow->Range[TileType][Num].End = Start + NumRegs * 4U;
+	Shadow->NumRanges[TileType]++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the configuration registers of a stream switch to the
+* cacheable ranges of a tile type.
+*
+* @param	Shadow: Pointer to the shadow cache.
+* @param	TileType: Type of the tile.
+* @param	StrmSw: Pointer to the stream switch module.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_ShadowAddStrmSw(XAie_ShadowCache *Shadow, u8 TileType,
+		const XAie_StrmMod *StrmSw)
+{
+	const XAie_StrmPort *Port;
+
+	for(u8 i = 0U; i < (u8)SS_PORT_TYPE_MAX; i++) {
+		Port = &StrmSw->MstrConfig[i];
+		if(Port->NumPorts != 0U) {
+			_XAie_ShadowAddRange(Shadow, TileType,
+					Port->PortBaseAddr, Port->NumPorts *
+					(StrmSw->PortOffset / 4U));
+		}
+
+		Port = &StrmSw->SlvConfig[i];
+		if(Port->NumPorts != 0U) {
+			_XAie_ShadowAddRange(Shadow, TileType,
+					Port->PortBaseAddr, Port->NumPorts *
+					(StrmSw->PortOffset / 4U));
+		}
+
+		Port = &StrmSw->SlvSlotConfig[i];
+		if(Port->NumPorts != 0U) {
+			_XAie_ShadowAddRange(Shadow, TileType,
+					Port->PortBaseAddr, Port->NumPorts *
+					(StrmSw->SlotOffsetPerPort / 4U));
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the configuration registers of the event, performance counter
+* and trace modules of a tile type to its cacheable ranges.
+*
+* @param	Shadow: Pointer to the shadow cache.
+* @param	TileType: Type of the tile.
+* @param	TileMod: Pointer to the modules of the tile type.
+*
+* @return	None.
+*
+* @note		Internal only. Event generate, broadcast block and the
+*		performance counter values are left out as they have side
+*		effects or change under the device.
+*
+******************************************************************************/
+static void _XAie_ShadowAddModules(XAie_ShadowCache *Shadow, u8 TileType,
+		const XAie_TileMod *TileMod)
+{
+	const XAie_EvntMod *EvntMod;
+	const XAie_PerfMod *PerfMod;
+	const XAie_TraceMod *TraceMod;
+
+	for(u8 i = 0U; i < TileMod->NumModules; i++) {
+		if(TileMod->EvntMod != NULL) {
+			EvntMod = &TileMod->EvntMod[i];
+			_XAie_ShadowAddRange(Shadow, TileType,
+					EvntMod->BaseBroadcastRegOff,
+					EvntMod->NumBroadcastIds);
+			_XAie_ShadowAddRange(Shadow, TileType,
+					EvntMod->BaseGroupEventRegOff,
+					EvntMod->NumGroupEvents);
+			_XAie_ShadowAddRange(Shadow, TileType,
+					EvntMod->ComboInputRegOff, 1U);
+			_XAie_ShadowAddRange(Shadow, TileType,
+					EvntMod->ComboCtrlRegOff, 1U);
+			if((EvntMod->NumStrmPortSelectIds != 0U) &&
+					(EvntMod->StrmPortSelectIdsPerReg != 0U)) {
+				_XAie_ShadowAddRange(Shadow, TileType,
+					EvntMod->BaseStrmPortSelectRegOff,
+					(EvntMod->NumStrmPortSelectIds +
+					 EvntMod->StrmPortSelectIdsPerReg - 1U) /
+					EvntMod->StrmPortSelectIdsPerReg);
+			}
+		}
+
+		if((TileMod->PerfMod != NULL) &&
+				(TileMod->PerfMod[i].MaxCounterVal != 0U)) {
+			PerfMod = &TileMod->PerfMod[i];
+			_XAie_ShadowAddRange(Shadow, TileType,
+					PerfMod->PerfCtrlBaseAddr,
+					(PerfMod->PerfCtrlOffsetAdd / 4U) *
+					((PerfMod->MaxCounterVal + 1U) / 2U));
+			_XAie_ShadowAddRange(Shadow, TileType,
+					PerfMod->PerfCtrlResetBaseAddr,
+					(PerfMod->MaxCounterVal + 3U) / 4U);
+			_XAie_ShadowAddRange(Shadow, TileType,
+					PerfMod->PerfCounterEvtValBaseAddr,
+					PerfMod->MaxCounterVal *
+					(PerfMod->PerfCounterOffsetAdd / 4U));
+		}
+
+		if(TileMod->TraceMod != NULL) {
+			TraceMod = &TileMod->TraceMod[i];
+			_XAie_ShadowAddRange(Shadow, TileType,
+					TraceMod->CtrlRegOff, 1U);
+			_XAie_ShadowAddRange(Shadow, TileType,
+					TraceMod->PktConfigRegOff, 1U);
+			if((TraceMod->EventRegOffs != NULL) &&
+					(TraceMod->NumEventsPerSlot != 0U)) {
+				for(u8 j = 0U; j < TraceMod->NumTraceSlotIds /
+						TraceMod->NumEventsPerSlot; j++) {
+					_XAie_ShadowAddRange(Shadow, TileType,
+						TraceMod->EventRegOffs[j], 1U);
+				}
+			}
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sorts and merges the cacheable ranges of a tile type.
+*
+* @param	Shadow: Pointer to the shadow cache.
+* @param	TileType: Type of the tile.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_ShadowMergeRanges(XAie_ShadowCache *Shadow, u8 TileType)
+{
+	XAie_ShadowRange *Range = Shadow->Range[TileType];
+	XAie_ShadowRange Tmp;
+	u8 Num = Shadow->NumRanges[TileType];
+	u8 Merged = 0U;
+
+	for(u8 i = 1U; i < Num; i++) {
+		Tmp = Range[i];
+		u8 j = i;
+		while((j > 0U) && (Range[j - 1U].Start > Tmp.Start)) {
+			Range[j] = Range[j - 1U];
+			j--;
+		}
+		Range[j] = Tmp;
+	}
+
+	for(u8 i = 0U; i < Num; i++) {
+		if((Merged > 0U) &&
+				(Range[i].Start <= Range[Merged - 1U].End)) {
+			if(Range[i].End > Range[Merged - 1U].End) {
+				Range[Merged - 1U].End = Range[i].End;
+			}
+			continue;
+		}
+		Range[Merged++] = Range[i];
+	}
+
+	Shadow->NumRanges[TileType] = Merged;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if a register offset can be held in the shadow cache.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset relative to the partition.
+*
+* @return	XAIE_ENABLE if the register is cacheable, XAIE_DISABLE
+*		otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u8 _XAie_ShadowIsCacheable(XAie_DevInst *DevInst, u64 RegOff)
+{
+	XAie_ShadowCache *Shadow = DevInst->Shadow;
+	XAie_LocType Loc;
+	u8 RowShift = DevInst->DevProp.RowShift;
+	u8 ColShift = DevInst->DevProp.ColShift;
+	u8 TileType;
+	u32 TileOff;
+
+	Loc.Col = (u8)(RegOff >> ColShift);
+	Loc.Row = (u8)((RegOff >> RowShift) &
+			((1U << (ColShift - RowShift)) - 1U));
+	if((Loc.Col >= DevInst->NumCols) || (Loc.Row >= DevInst->NumRows)) {
+		return XAIE_DISABLE;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType >= XAIEGBL_TILE_TYPE_MAX) {
+		return XAIE_DISABLE;
+	}
+
+	TileOff = (u32)(RegOff & ((1U << RowShift) - 1U));
+	for(u8 i = 0U; i < Shadow->NumRanges[TileType]; i++) {
+		if(TileOff < Shadow->Range[TileType][i].Start) {
+			break;
+		}
+		if(TileOff < Shadow->Range[TileType][i].End) {
+			return XAIE_ENABLE;
+		}
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API enables or disables the shadow cache of the configuration
+* registers. Once enabled, writes of the value the cache holds for a register
+* are elided and reads of a cached register are served without accessing the
+* device. The cache is dropped when it is disabled.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Enable: XAIE_ENABLE to enable the cache, XAIE_DISABLE to
+*		disable it.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The cache is disabled by default. It only tracks the accesses
+*		issued through this driver instance, applications which
+*		access the partition through another instance or another
+*		agent must not enable it. Block writes, block sets, backend
+*		operations, submitted transactions and partition resets
+*		invalidate the cache. It is not supported for the CDO backend
+*		as its reads do not return the register values.
+*
+******************************************************************************/
+AieRC XAie_ConfigShadowCache(XAie_DevInst *DevInst, u8 Enable)
+{
+	XAie_ShadowCache *Shadow;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Enable == XAIE_DISABLE) {
+		_XAie_ShadowFinish(DevInst);
+		return XAIE_OK;
+	}
+
+	if(DevInst->Backend->Type == XAIE_IO_BACKEND_CDO) {
+		XAIE_ERROR("Shadow cache is not supported for CDO backend\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	if(DevInst->Shadow != NULL) {
+		return XAIE_OK;
+	}
+
+	Shadow = (XAie_ShadowCache *)calloc(1U, sizeof(*Shadow));
+	if(Shadow == NULL) {
+		XAIE_ERROR("Failed to allocate the shadow cache\n");
+		return XAIE_ERR;
+	}
+
+	for(u8 TileType = 0U; TileType < XAIEGBL_TILE_TYPE_MAX; TileType++) {
+		const XAie_TileMod *TileMod =
+			&DevInst->DevProp.DevMod[TileType];
+
+		if(TileMod->StrmSw != NULL) {
+			_XAie_ShadowAddStrmSw(Shadow, TileType,
+					TileMod->StrmSw);
+		}
+		_XAie_ShadowAddModules(Shadow, TileType, TileMod);
+		if(TileMod->TileCtrlMod != NULL) {
+			_XAie_ShadowAddRange(Shadow, TileType,
+					TileMod->TileCtrlMod->TileCtrlRegOff,
+					1U);
+		}
+		_XAie_ShadowMergeRanges(Shadow, TileType);
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_init(&Shadow->Lock, NULL);
+#endif
+	DevInst->Shadow = Shadow;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API looks up the value of a register in the shadow cache.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset relative to the partition.
+* @param	Value: Pointer to return the cached value.
+*
+* @return	XAIE_ENABLE if the value is cached, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+u8 _XAie_ShadowLookup(XAie_DevInst *DevInst, u64 RegOff, u32 *Value)
+{
+	XAie_ShadowCache *Shadow = DevInst->Shadow;
+	XAie_ShadowEntry *Entry;
+	u8 Hit = XAIE_DISABLE;
+
+	if(Shadow == NULL) {
+		return XAIE_DISABLE;
+	}
+
+	Entry = &Shadow->Entry[_XAie_ShadowIndex(RegOff)];
+	_XAie_ShadowLock(Shadow);
+	if((Entry->Valid != 0U) && (Entry->RegOff == RegOff)) {
+		*Value = Entry->Value;
+		Hit = XAIE_ENABLE;
+	}
+	_XAie_ShadowUnlock(Shadow);
+
+	return Hit;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records the value of a register in the shadow cache if the
+* register is cacheable.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset relative to the partition.
+* @param	Value: Value of the register on the device.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_ShadowUpdate(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
+{
+	XAie_ShadowCache *Shadow = DevInst->Shadow;
+	XAie_ShadowEntry *Entry;
+
+	if((Shadow == NULL) ||
+			(_XAie_ShadowIsCacheable(DevInst, RegOff) ==
+			 XAIE_DISABLE)) {
+		return;
+	}
+
+	Entry = &Shadow->Entry[_XAie_ShadowIndex(RegOff)];
+	_XAie_ShadowLock(Shadow);
+	Entry->RegOff = RegOff;
+	Entry->Value = Value;
+	Entry->Valid = 1U;
+	_XAie_ShadowUnlock(Shadow);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API drops the cached values of a range of registers.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Offset of the first register relative to the partition.
+* @param	Size: Number of registers.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_ShadowInvalidate(XAie_DevInst *DevInst, u64 RegOff, u32 Size)
+{
+	XAie_ShadowCache *Shadow = DevInst->Shadow;
+	XAie_ShadowEntry *Entry;
+
+	if(Shadow == NULL) {
+		return;
+	}
+
+	if(Size >= XAIE_SHADOW_NUM_ENTRIES) {
+		_XAie_ShadowInvalidateAll(DevInst);
+		return;
+	}
+
+	_XAie_ShadowLock(Shadow);
+	for(u32 i = 0U; i < Size; i++) {
+		Entry = &Shadow->Entry[_XAie_ShadowIndex(RegOff + i * 4U)];
+		if(Entry->RegOff == RegOff + i * 4U) {
+			Entry->Valid = 0U;
+		}
+	}
+	_XAie_ShadowUnlock(Shadow);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API drops all the cached register values.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_ShadowInvalidateAll(XAie_DevInst *DevInst)
+{
+	XAie_ShadowCache *Shadow = DevInst->Shadow;
+
+	if(Shadow == NULL) {
+		return;
+	}
+
+	_XAie_ShadowLock(Shadow);
+	memset(Shadow->Entry, 0, sizeof(Shadow->Entry));
+	_XAie_ShadowUnlock(Shadow);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees the shadow cache of a device instance.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_ShadowFinish(XAie_DevInst *DevInst)
+{
+	XAie_ShadowCache *Shadow = DevInst->Shadow;
+
+	if(Shadow == NULL) {
+		return;
+	}
+
+	DevInst->Shadow = NULL;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_destroy(&Shadow->Lock);
+#endif
+	free(Shadow);
+}
+
+/** @} */
@@ -0,0 +1,32 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_shadow.h
+* @{
+*
+* This file contains the routines for the shadow cache of the configuration
+* registers.
+*
+******************************************************************************/
+#ifndef XAIE_SHADOW_H
+#define XAIE_SHADOW_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_ConfigShadowCache(XAie_DevInst *DevInst, u8 Enable);
+u8 _XAie_ShadowLookup(XAie_DevInst *DevInst, u64 RegOff, u32 *Value);
+void _XAie_ShadowUpdate(XAie_DevInst *DevInst, u64 RegOff, u32 Value);
+void _XAie_ShadowInvalidate(XAie_DevInst *DevInst, u64 RegOff, u32 Size);
+void _XAie_ShadowInvalidateAll(XAie_DevInst *DevInst);
+void _XAie_ShadowFinish(XAie_DevInst *DevInst);
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -0,0 +1,1989 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_txn.c
+* @{
+*
+* This file contains routines to serialize transaction instances into a
+* versioned binary format, to load and replay them on a partition, to
+* submit transactions asynchronously and to submit chains of transactions.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#endif
+
+#include "xaie_helper.h"
+#include "xaie_txn.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TXN_RECORD_ALIGN		8U
+#define XAIE_TXN_COMPACT_OP_MASK	0x7U
+#define XAIE_TXN_COMPACT_HAS_MASK	0x8U	/* Nonzero mask follows */
+#define XAIE_TXN_COMPACT_NEW_TILE	0x10U	/* Absolute tile offset follows */
+#define XAIE_TXN_COMPACT_MIN_RECORD	3U
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_TXN_ALIGN(Size) \
+	(((Size) + XAIE_TXN_RECORD_ALIGN - 1U) & ~((u64)XAIE_TXN_RECORD_ALIGN - 1U))
+
+/**************************** Type Definitions *******************************/
+/* Access to a register by a single write, a read or a poll */
+typedef struct {
+	u64 RegOff;
+	u32 Idx;	/* Index of the command */
+} XAie_TxnRegAccess;
+
+struct XAie_TxnFence {
+	XAie_DevInst *DevInst;
+	XAie_TxnInst *TxnInst;
+	XAie_TxnCallback Cb;
+	void *Priv;
+	AieRC Status;
+	u8 Done;
+	u8 OwnInst;	/* TxnInst was detached from the submitting thread */
+	struct XAie_TxnFence *Next;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+	pthread_cond_t Cond;
+#endif
+};
+
+/*
+ * Typedef to capture a chain of transaction segments. The commands of the
+ * segments are gathered in Cmds, the block write payloads stay in the segments.
+ * The first NumValid segments are gathered and are only gathered again if
+ * they are replaced or changed.
+ */
+struct XAie_TxnChain {
+	XAie_DevInst *DevInst;
+	XAie_TxnInst **Segs;
+	const XAie_TxnCmd **SegCmdBuf;	/* Command buffer of each gathered segment */
+	u32 *SegNumCmds;	/* Number of commands of each gathered segment */
+	u32 *SegStart;		/* Index of the first command of each segment */
+	u8 *SegStartCol;	/* Start column of each gathered segment */
+	u32 NumSegs;
+	u32 NumValid;
+	XAie_TxnCmd *Cmds;
+	u32 MaxCmds;
+};
+
+#ifndef __AIEBAREMETAL__
+/*
+ * Typedef to capture the worker which executes the asynchronous submissions of
+ * a device instance in submission order.
+ */
+struct XAie_TxnQueue {
+	pthread_t Thread;
+	pthread_mutex_t Lock;
+	pthread_cond_t Cond;
+	XAie_TxnFence *Head;
+	XAie_TxnFence *Tail;
+	u8 Exit;
+};
+#endif
+
+/************************** Variable Definitions *****************************/
+#ifndef __AIEBAREMETAL__
+/* Serializes the creation of the submission workers of the device instances */
+static pthread_mutex_t _XAie_TxnQueueCreateLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the size of the serialized record of a command.
+*
+* @param	Cmd: Pointer to the transaction command.
+*
+* @return	Size of the record in bytes, including the inline payload.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u64 _XAie_TxnRecordSize(const XAie_TxnCmd *Cmd)
+{
+	u64 RecSize = sizeof(XAie_TxnCmdRecord);
+
+	if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+		RecSize += XAIE_TXN_ALIGN((u64)Cmd->Size * sizeof(u32));
+	}
+
+	return RecSize;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a variable length unsigned integer, 7 bits per byte with the
+* top bit set on all the bytes but the last.
+*
+* @param	Ptr: Destination, NULL to only return the length.
+* @param	Val: Value to write.
+*
+* @return	Number of bytes of the encoded value.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u64 _XAie_TxnPutVarint(u8 *Ptr, u64 Val)
+{
+	u64 Len = 0U;
+
+	do {
+		u8 Byte = (u8)(Val & 0x7FU);
+
+		Val >>= 7U;
+		if(Val != 0U) {
+			Byte |= 0x80U;
+		}
+		if(Ptr != NULL) {
+			Ptr[Len] = Byte;
+		}
+		Len++;
+	} while(Val != 0U);
+
+	return Len;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads a variable length unsigned integer written by
+* _XAie_TxnPutVarint().
+*
+* @param	Ptr: Serialized transaction.
+* @param	End: Size of the serialized transaction in bytes.
+* @param	Off: Pointer to the offset to read from, updated past the value.
+* @param	Val: Pointer to return the value.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the value is truncated or
+*		longer than 64 bits.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnGetVarint(const u8 *Ptr, u64 End, u64 *Off, u64 *Val)
+{
+	u64 V = 0U;
+
+	for(u32 Shift = 0U; Shift < 64U; Shift += 7U) {
+		u8 Byte;
+
+		if(*Off >= End) {
+			return XAIE_ERR;
+		}
+
+		Byte = Ptr[*Off];
+		(*Off)++;
+		V |= (u64)(Byte & 0x7FU) << Shift;
+		if((Byte & 0x80U) == 0U) {
+			*Val = V;
+			return XAIE_OK;
+		}
+	}
+
+	return XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API encodes the commands of a transaction instance in the compact format.
+* Each command starts with a byte holding the opcode and the
+* XAIE_TXN_COMPACT_* flags. It is followed by the tile and the tile local
+* offset as varints when the tile differs from the previous command, or else
+* by the zigzag varint of the difference to the previous tile local offset.
+* The mask follows if it is not zero, then the value for all but block writes
+* and the size for all but single writes. Block write payloads follow
+* unaligned.
+*
+* @param	DevInst: Device Instance.
+* @param	TxnInst: Transaction instance to encode.
+* @param	Buf: Destination, NULL to only return the size.
+*
+* @return	Size of the encoded commands in bytes.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u64 _XAie_TxnEncodeCompact(XAie_DevInst *DevInst,
+		const XAie_TxnInst *TxnInst, u8 *Buf)
+{
+	u8 RowShift = DevInst->DevProp.RowShift;
+	u64 TileMask = ((u64)1U << RowShift) - 1U;
+	u64 PrevTile = ~(u64)0U;
+	u64 PrevOff = 0U;
+	u64 Len = 0U;
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		u64 Tile = Cmd->RegOff >> RowShift;
+		u64 TileOff = Cmd->RegOff & TileMask;
+		u8 Op = (u8)Cmd->Opcode;
+
+		if(Cmd->Mask != 0U) {
+			Op |= XAIE_TXN_COMPACT_HAS_MASK;
+		}
+		if(Tile != PrevTile) {
+			Op |= XAIE_TXN_COMPACT_NEW_TILE;
+		}
+		if(Buf != NULL) {
+			Buf[Len] = Op;
+		}
+		Len++;
+
+		if(Op & XAIE_TXN_COMPACT_NEW_TILE) {
+			Len += _XAie_TxnPutVarint((Buf != NULL) ? Buf + Len :
+					NULL, Tile);
+			Len += _XAie_TxnPutVarint((Buf != NULL) ? Buf + Len :
+					NULL, TileOff);
+		} else if(TileOff >= PrevOff) {
+			Len += _XAie_TxnPutVarint((Buf != NULL) ? Buf + Len :
+					NULL, (TileOff - PrevOff) << 1U);
+		} else {
+			Len += _XAie_TxnPutVarint((Buf != NULL) ? Buf + Len :
+					NULL, ((PrevOff - TileOff) << 1U) - 1U);
+		}
+		PrevTile = Tile;
+		PrevOff = TileOff;
+
+		if(Cmd->Mask != 0U) {
+			Len += _XAie_TxnPutVarint((Buf != NULL) ? Buf + Len :
+					NULL, Cmd->Mask);
+		}
+		if(Cmd->Opcode != XAIE_IO_BLOCKWRITE) {
+			Len += _XAie_TxnPutVarint((Buf != NULL) ? Buf + Len :
+					NULL, Cmd->Value);
+		}
+		if(Cmd->Opcode != XAIE_IO_WRITE) {
+			Len += _XAie_TxnPutVarint((Buf != NULL) ? Buf + Len :
+					NULL, Cmd->Size);
+		}
+		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			u64 DataSize = (u64)Cmd->Size * sizeof(u32);
+
+			if(Buf != NULL) {
+				memcpy((void *)(Buf + Len),
+					(void *)(uintptr_t)Cmd->DataPtr,
+					DataSize);
+			}
+			Len += DataSize;
+		}
+	}
+
+	return Len;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API serializes a transaction instance in the record or the compact
+* format.
+*
+* @param	DevInst: Device Instance.
+* @param	TxnInst: Transaction instance to serialize.
+* @param	Buf: Destination buffer, NULL to only return the size.
+* @param	Size: Pointer to the size of Buf in bytes. It is updated with
+*		the size of the serialized transaction.
+* @param	Compact: XAIE_ENABLE for the compact format.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if Buf is
+*		too small and XAIE_INVALID_ARGS for invalid arguments.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnSerialize(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		void *Buf, u64 *Size, u8 Compact)
+{
+	XAie_TxnHeader Hdr;
+	u64 TxnSize = sizeof(Hdr);
+	u8 *Ptr;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((TxnInst == XAIE_NULL) || (Size == XAIE_NULL)) {
+		XAIE_ERROR("Invalid transaction instance or size pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		if(TxnInst->CmdBuf[i].Opcode == XAIE_IO_READ) {
+			XAIE_ERROR("Transactions with deferred reads cannot be "
+					"serialized\n");
+			return XAIE_INVALID_ARGS;
+		}
+		if((TxnInst->CmdBuf[i].Opcode == XAIE_IO_SHIMDMABD) ||
+				(TxnInst->CmdBuf[i].Opcode == XAIE_IO_MEMSYNC)) {
+			XAIE_ERROR("Transactions with memory instances cannot "
+					"be serialized\n");
+			return XAIE_INVALID_ARGS;
+		}
+		if(Compact == XAIE_DISABLE) {
+			TxnSize += _XAie_TxnRecordSize(&TxnInst->CmdBuf[i]);
+		}
+	}
+
+	if(Compact == XAIE_ENABLE) {
+		TxnSize += _XAie_TxnEncodeCompact(DevInst, TxnInst, NULL);
+	}
+
+	if(Buf == XAIE_NULL) {
+		*Size = TxnSize;
+		return XAIE_OK;
+	}
+
+	if(*Size < TxnSize) {
+		XAIE_ERROR("Insufficient buffer size, expected %lu bytes\n",
+				TxnSize);
+		*Size = TxnSize;
+		return XAIE_INSUFFICIENT_BUFFER_SIZE;
+	}
+
+	memset((void *)&Hdr, 0, sizeof(Hdr));
+	Hdr.Magic = (Compact == XAIE_ENABLE) ? XAIE_TXN_MAGIC_COMPACT :
+		XAIE_TXN_MAGIC;
+	Hdr.MajorVer = XAIE_TXN_VERSION_MAJOR;
+	Hdr.MinorVer = XAIE_TXN_VERSION_MINOR;
+	Hdr.DevGen = DevInst->DevProp.DevGen;
+	Hdr.NumRows = DevInst->NumRows;
+	Hdr.NumCols = DevInst->NumCols;
+	Hdr.RowShift = DevInst->DevProp.RowShift;
+	Hdr.ColShift = DevInst->DevProp.ColShift;
+	Hdr.StartCol = TxnInst->StartCol;
+	Hdr.NumCmds = TxnInst->NumCmds;
+	Hdr.TxnSize = TxnSize;
+
+	Ptr = (u8 *)Buf;
+	memcpy((void *)Ptr, (void *)&Hdr, sizeof(Hdr));
+	Ptr += sizeof(Hdr);
+
+	if(Compact == XAIE_ENABLE) {
+		(void)_XAie_TxnEncodeCompact(DevInst, TxnInst, Ptr);
+		*Size = TxnSize;
+		return XAIE_OK;
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		XAie_TxnCmdRecord Rec;
+		u64 RecSize = _XAie_TxnRecordSize(Cmd);
+
+		memset((void *)&Rec, 0, sizeof(Rec));
+		Rec.Opcode = (u8)Cmd->Opcode;
+		Rec.Mask = Cmd->Mask;
+		Rec.RegOff = Cmd->RegOff;
+		Rec.Value = Cmd->Value;
+		Rec.Size = Cmd->Size;
+		memcpy((void *)Ptr, (void *)&Rec, sizeof(Rec));
+
+		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			u64 DataSize = (u64)Cmd->Size * sizeof(u32);
+
+			memcpy((void *)(Ptr + sizeof(Rec)),
+					(void *)(uintptr_t)Cmd->DataPtr,
+					DataSize);
+			memset((void *)(Ptr + sizeof(Rec) + DataSize), 0,
+					RecSize - sizeof(Rec) - DataSize);
+		}
+
+		Ptr += RecSize;
+	}
+
+	*Size = TxnSize;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API serializes a transaction instance into a caller provided buffer. The
+* serialized transaction does not reference any host memory and can be stored
+* and loaded with XAie_TxnLoad() or XAie_TxnReplay() on any partition of the
+* same device generation which has all the columns used by the commands.
+*
+* @param	DevInst: Device Instance.
+* @param	TxnInst: Transaction instance to serialize, usually returned by
+*		XAie_ExportTransactionInstance().
+* @param	Buf: Destination buffer. If NULL, only the required size is
+*		returned in Size.
+* @param	Size: Pointer to the size of Buf in bytes. It is updated with
+*		the size of the serialized transaction.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if Buf is
+*		too small and XAIE_INVALID_ARGS for invalid arguments.
+*
+* @note		The data is stored in host byte order.
+*
+******************************************************************************/
+AieRC XAie_TxnSerialize(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		void *Buf, u64 *Size)
+{
+	return _XAie_TxnSerialize(DevInst, TxnInst, Buf, Size, XAIE_DISABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API serializes a transaction instance like XAie_TxnSerialize(), with the
+* commands in the compact format. Commands take a variable number of bytes,
+* register offsets are encoded relative to the tile and to the previous command
+* of the same tile, and zero masks are omitted. A single register write usually
+* takes 4 to 8 bytes instead of 32.
+*
+* @param	DevInst: Device Instance.
+* @param	TxnInst: Transaction instance to serialize, usually returned by
+*		XAie_ExportTransactionInstance().
+* @param	Buf: Destination buffer. If NULL, only the required size is
+*		returned in Size.
+* @param	Size: Pointer to the size of Buf in bytes. It is updated with
+*		the size of the serialized transaction.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if Buf is
+*		too small and XAIE_INVALID_ARGS for invalid arguments.
+*
+* @note		The block write payloads are not aligned in the compact format,
+*		so XAie_TxnReplay() copies them instead of referencing them.
+*
+******************************************************************************/
+AieRC XAie_TxnSerializeCompact(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		void *Buf, u64 *Size)
+{
+	return _XAie_TxnSerialize(DevInst, TxnInst, Buf, Size, XAIE_ENABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API moves the commands of a transaction instance to the tiles of another
+* set of columns. The row and the tile local offset of every command are kept
+* and its column is rebased from the current start column of the instance to
+* StartCol. Register offsets of transactions are relative to the partition, so
+* this is only required to place the recorded configuration at a different
+* column of the partition.
+*
+* @param	DevInst: Device Instance.
+* @param	TxnInst: Exported or loaded transaction instance.
+* @param	StartCol: New start column, relative to the partition.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The instance is left unchanged on failure. The relocation is
+*		rejected if a command would move out of the partition or to a
+*		tile of a different type, such as a SHIM PL tile in place of
+*		a SHIM NOC tile.
+*
+******************************************************************************/
+AieRC XAie_TxnRelocate(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u8 StartCol)
+{
+	u8 RowShift, ColShift;
+	u64 RowMask;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((TxnInst == XAIE_NULL) ||
+			!(TxnInst->Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
+		XAIE_ERROR("Invalid or not exported transaction instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(StartCol == TxnInst->StartCol) {
+		return XAIE_OK;
+	}
+
+	RowShift = DevInst->DevProp.RowShift;
+	ColShift = DevInst->DevProp.ColShift;
+	RowMask = ((u64)1U << (ColShift - RowShift)) - 1U;
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		u64 RegOff = TxnInst->CmdBuf[i].RegOff;
+		u8 Row = (u8)((RegOff >> RowShift) & RowMask);
+		u32 Col = (u32)(RegOff >> ColShift);
+		u32 NewCol;
+
+		if(TxnInst->CmdBuf[i].Opcode == XAIE_IO_MEMSYNC) {
+			continue;
+		}
+
+		if(Col < TxnInst->StartCol) {
+			XAIE_ERROR("Command at offset 0x%lx is before the start "
+					"column of the transaction\n", RegOff);
+			return XAIE_INVALID_ARGS;
+		}
+
+		NewCol = Col - TxnInst->StartCol + StartCol;
+		if(NewCol >= DevInst->NumCols) {
+			XAIE_ERROR("Relocated column %d is out of the "
+					"partition\n", NewCol);
+			return XAIE_INVALID_ARGS;
+		}
+
+		if(_XAie_GetTileTypefromLoc(DevInst, XAie_TileLoc((u8)Col, Row))
+				!= _XAie_GetTileTypefromLoc(DevInst,
+					XAie_TileLoc((u8)NewCol, Row))) {
+			XAIE_ERROR("Tile type of column %d and column %d do not "
+					"match\n", Col, NewCol);
+			return XAIE_INVALID_TILE;
+		}
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		u64 Col = Cmd->RegOff >> ColShift;
+
+		if(Cmd->Opcode == XAIE_IO_MEMSYNC) {
+			continue;
+		}
+
+		Cmd->RegOff &= ((u64)1U << ColShift) - 1U;
+		Cmd->RegOff |= (Col - TxnInst->StartCol + StartCol) << ColShift;
+
+		if(Cmd->Opcode == XAIE_IO_SHIMDMABD) {
+			XAie_ShimDmaBdArgs *Args =
+				(XAie_ShimDmaBdArgs *)(uintptr_t)Cmd->DataPtr;
+
+			Args->Addr = Cmd->RegOff;
+			Args->Loc.Col = (u8)(Col - TxnInst->StartCol +
+					StartCol);
+		}
+	}
+
+	TxnInst->StartCol = StartCol;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks a decoded command against the partition.
+*
+* @param	Cmd: Decoded command.
+* @param	PartSize: Size of the address space of the partition.
+*
+* @return	XAIE_OK on success and XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnCheckCmd(const XAie_TxnCmd *Cmd, u64 PartSize)
+{
+	u64 DataSize;
+
+	if((Cmd->Opcode > XAIE_IO_MASKPOLL) || (Cmd->Opcode == XAIE_IO_READ)) {
+		XAIE_ERROR("Invalid serialized opcode %d\n", Cmd->Opcode);
+		return XAIE_ERR;
+	}
+
+	if((Cmd->Opcode == XAIE_IO_BLOCKWRITE) ||
+			(Cmd->Opcode == XAIE_IO_BLOCKSET)) {
+		DataSize = (u64)Cmd->Size * sizeof(u32);
+	} else {
+		DataSize = sizeof(u32);
+	}
+
+	if((Cmd->RegOff >= PartSize) || (DataSize > PartSize - Cmd->RegOff)) {
+		XAIE_ERROR("Serialized register offset 0x%lx is out of the "
+				"partition\n", Cmd->RegOff);
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API decodes the commands of a serialized transaction in the record
+* format.
+*
+* @param	Ptr: Serialized transaction.
+* @param	Hdr: Validated header of the serialized transaction.
+* @param	Inst: Transaction instance with a command buffer of Hdr->NumCmds
+*		commands.
+* @param	PartSize: Size of the address space of the partition.
+* @param	InPlace: XAIE_ENABLE to reference the payloads from Ptr.
+*
+* @return	XAIE_OK on success and XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnDecodeRecords(const u8 *Ptr, const XAie_TxnHeader *Hdr,
+		XAie_TxnInst *Inst, u64 PartSize, u8 InPlace)
+{
+	u64 Off = sizeof(*Hdr);
+
+	for(u32 i = 0U; i < Hdr->NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
+		XAie_TxnCmdRecord Rec;
+
+		if(Hdr->TxnSize - Off < sizeof(Rec)) {
+			XAIE_ERROR("Serialized transaction is truncated\n");
+			return XAIE_ERR;
+		}
+
+		memcpy((void *)&Rec, (const void *)(Ptr + Off), sizeof(Rec));
+		Off += sizeof(Rec);
+
+		if(Rec.Opcode > (u8)XAIE_IO_MASKPOLL) {
+			XAIE_ERROR("Invalid serialized opcode %d\n", Rec.Opcode);
+			return XAIE_ERR;
+		}
+
+		Cmd->Opcode = (XAie_TxnOpcode)Rec.Opcode;
+		Cmd->Mask = Rec.Mask;
+		Cmd->RegOff = Rec.RegOff;
+		Cmd->Value = Rec.Value;
+		Cmd->Size = Rec.Size;
+		Cmd->DataPtr = 0U;
+
+		if(_XAie_TxnCheckCmd(Cmd, PartSize) != XAIE_OK) {
+			return XAIE_ERR;
+		}
+
+		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			u64 DataSize = (u64)Cmd->Size * sizeof(u32);
+			u64 PadSize = XAIE_TXN_ALIGN(DataSize);
+			void *Data;
+
+			if(Hdr->TxnSize - Off < PadSize) {
+				XAIE_ERROR("Serialized transaction is "
+						"truncated\n");
+				return XAIE_ERR;
+			}
+
+			if(InPlace == XAIE_ENABLE) {
+				Data = (void *)(uintptr_t)(Ptr + Off);
+			} else {
+				Data = _XAie_TxnArenaAlloc(Inst, DataSize);
+				if(Data == NULL) {
+					return XAIE_ERR;
+				}
+				memcpy(Data, (const void *)(Ptr + Off),
+						DataSize);
+			}
+
+			Cmd->DataPtr = (u64)(uintptr_t)Data;
+			Off += PadSize;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API decodes the commands of a serialized transaction in the compact
+* format written by _XAie_TxnEncodeCompact(). The block write payloads are
+* always copied to the payload arena of the instance.
+*
+* @param	DevInst: Device Instance.
+* @param	Ptr: Serialized transaction.
+* @param	Hdr: Validated header of the serialized transaction.
+* @param	Inst: Transaction instance with a command buffer of Hdr->NumCmds
+*		commands.
+* @param	PartSize: Size of the address space of the partition.
+*
+* @return	XAIE_OK on success and XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnDecodeCompact(XAie_DevInst *DevInst, const u8 *Ptr,
+		const XAie_TxnHeader *Hdr, XAie_TxnInst *Inst, u64 PartSize)
+{
+	u8 RowShift = DevInst->DevProp.RowShift;
+	u64 TileOffMax = (u64)1U << RowShift;
+	u64 End = Hdr->TxnSize;
+	u64 Off = sizeof(*Hdr);
+	u64 Tile = 0U;
+	u64 TileOff = 0U;
+
+	for(u32 i = 0U; i < Hdr->NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &Inst->CmdBuf[i];
+		u64 Val;
+		u8 Op;
+
+		if(Off >= End) {
+			goto truncated;
+		}
+		Op = Ptr[Off];
+		Off++;
+
+		if(Op & XAIE_TXN_COMPACT_NEW_TILE) {
+			if((_XAie_TxnGetVarint(Ptr, End, &Off, &Tile) !=
+						XAIE_OK) ||
+					(_XAie_TxnGetVarint(Ptr, End, &Off,
+						&TileOff) != XAIE_OK)) {
+				goto truncated;
+			}
+		} else if(i == 0U) {
+			goto invalid;
+		} else if(_XAie_TxnGetVarint(Ptr, End, &Off, &Val) != XAIE_OK) {
+			goto truncated;
+		} else if(Val & 1U) {
+			if(((Val >> 1U) + 1U) > TileOff) {
+				goto invalid;
+			}
+			TileOff -= (Val >> 1U) + 1U;
+		} else {
+			TileOff += Val >> 1U;
+		}
+
+		if((TileOff >= TileOffMax) || (Tile >= (PartSize >> RowShift))) {
+			goto invalid;
+		}
+
+		Cmd->Opcode = (XAie_TxnOpcode)(Op & XAIE_TXN_COMPACT_OP_MASK);
+		Cmd->RegOff = (Tile << RowShift) | TileOff;
+		Cmd->Mask = 0U;
+		Cmd->Value = 0U;
+		Cmd->Size = 0U;
+		Cmd->DataPtr = 0U;
+
+		if(Op & XAIE_TXN_COMPACT_HAS_MASK) {
+			if(_XAie_TxnGetVarint(Ptr, End, &Off, &Val) != XAIE_OK) {
+				goto truncated;
+			}
+			Cmd->Mask = (u32)Val;
+		}
+		if(Cmd->Opcode != XAIE_IO_BLOCKWRITE) {
+			if(_XAie_TxnGetVarint(Ptr, End, &Off, &Val) != XAIE_OK) {
+				goto truncated;
+			}
+			Cmd->Value = (u32)Val;
+		}
+		if(Cmd->Opcode != XAIE_IO_WRITE) {
+			if(_XAie_TxnGetVarint(Ptr, End, &Off, &Val) != XAIE_OK) {
+				goto truncated;
+			}
+			Cmd->Size = (u32)Val;
+		}
+
+		if(_XAie_TxnCheckCmd(Cmd, PartSize) != XAIE_OK) {
+			return XAIE_ERR;
+		}
+
+		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			u64 DataSize = (u64)Cmd->Size * sizeof(u32);
+			void *Data;
+
+			if(End - Off < DataSize) {
+				goto truncated;
+			}
+
+			Data = _XAie_TxnArenaAlloc(Inst, DataSize);
+			if(Data == NULL) {
+				return XAIE_ERR;
+			}
+			memcpy(Data, (const void *)(Ptr + Off), DataSize);
+
+			Cmd->DataPtr = (u64)(uintptr_t)Data;
+			Off += DataSize;
+		}
+	}
+
+	return XAIE_OK;
+
+truncated:
+	XAIE_ERROR("Serialized transaction is truncated\n");
+	return XAIE_ERR;
+invalid:
+	XAIE_ERROR("Invalid serialized register offset\n");
+	return XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API validates a serialized transaction and decodes it into the command
+* buffer of a transaction instance. Block write payloads are either referenced
+* in place from the serialized buffer or copied to the payload arena of the
+* instance.
+*
+* @param	DevInst: Device Instance.
+* @param	Buf: Serialized transaction.
+* @param	Size: Size of Buf in bytes.
+* @param	Inst: Transaction instance to decode the commands to.
+* @param	InPlace: XAIE_ENABLE to reference the payloads from Buf if it
+*		is suitably aligned, XAIE_DISABLE to always copy them.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. On failure, the command buffer and the arena of
+*		Inst are released. Payloads of the compact format are always
+*		copied.
+*
+******************************************************************************/
+static AieRC _XAie_TxnDecode(XAie_DevInst *DevInst, const void *Buf, u64 Size,
+		XAie_TxnInst *Inst, u8 InPlace)
+{
+	XAie_TxnHeader Hdr;
+	const u8 *Ptr = (const u8 *)Buf;
+	u64 PartSize;
+	u64 MinRecSize;
+	AieRC RC;
+
+	Inst->CmdBuf = NULL;
+	Inst->Arena = NULL;
+	Inst->NumCmds = 0U;
+	Inst->MaxCmds = 0U;
+	Inst->StartCol = 0U;
+
+	if((Buf == XAIE_NULL) || (Size < sizeof(Hdr))) {
+		XAIE_ERROR("Invalid serialized transaction buffer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	memcpy((void *)&Hdr, (const void *)Ptr, sizeof(Hdr));
+	if(Hdr.Magic == XAIE_TXN_MAGIC) {
+		MinRecSize = sizeof(XAie_TxnCmdRecord);
+	} else if(Hdr.Magic == XAIE_TXN_MAGIC_COMPACT) {
+		MinRecSize = XAIE_TXN_COMPACT_MIN_RECORD;
+	} else {
+		XAIE_ERROR("Invalid serialized transaction magic 0x%x\n",
+				Hdr.Magic);
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Hdr.MajorVer != XAIE_TXN_VERSION_MAJOR) {
+		XAIE_ERROR("Unsupported serialized transaction version %d.%d\n",
+				Hdr.MajorVer, Hdr.MinorVer);
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Hdr.TxnSize > Size) || (Hdr.TxnSize < sizeof(Hdr))) {
+		XAIE_ERROR("Serialized transaction is truncated\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Hdr.DevGen != DevInst->DevProp.DevGen) ||
+			(Hdr.RowShift != DevInst->DevProp.RowShift) ||
+			(Hdr.ColShift != DevInst->DevProp.ColShift)) {
+		XAIE_ERROR("Serialized transaction was recorded for a different "
+				"device\n");
+		return XAIE_INVALID_DEVICE;
+	}
+
+	if(Hdr.NumRows > DevInst->NumRows) {
+		XAIE_ERROR("Serialized transaction does not fit in the "
+				"partition\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Hdr.NumCmds > (Hdr.TxnSize - sizeof(Hdr)) / MinRecSize) {
+		XAIE_ERROR("Invalid number of serialized commands\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Inst->MaxCmds = (Hdr.NumCmds > 0U) ? Hdr.NumCmds : 1U;
+	Inst->CmdBuf = (XAie_TxnCmd *)calloc(Inst->MaxCmds,
+			sizeof(*Inst->CmdBuf));
+	if(Inst->CmdBuf == NULL) {
+		XAIE_ERROR("Failed to allocate memory for command buffer\n");
+		return XAIE_ERR;
+	}
+
+	if(((uintptr_t)Buf & (sizeof(u32) - 1U)) != 0U) {
+		InPlace = XAIE_DISABLE;
+	}
+
+	PartSize = (u64)DevInst->NumCols << DevInst->DevProp.ColShift;
+	if(Hdr.Magic == XAIE_TXN_MAGIC_COMPACT) {
+		RC = _XAie_TxnDecodeCompact(DevInst, Ptr, &Hdr, Inst, PartSize);
+	} else {
+		RC = _XAie_TxnDecodeRecords(Ptr, &Hdr, Inst, PartSize, InPlace);
+	}
+	if(RC != XAIE_OK) {
+		_XAie_TxnArenaFree(Inst);
+		free(Inst->CmdBuf);
+		Inst->CmdBuf = NULL;
+		return XAIE_ERR;
+	}
+
+	Inst->NumCmds = Hdr.NumCmds;
+	Inst->StartCol = Hdr.StartCol;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API loads a serialized transaction into a new transaction instance. The
+* instance behaves like an exported one; it can be submitted any number of
+* times with XAie_SubmitTransaction() and must be released with
+* XAie_FreeTransactionInstance().
+*
+* @param	DevInst: Device Instance.
+* @param	Buf: Serialized transaction generated by XAie_TxnSerialize() or
+*		XAie_TxnSerializeCompact().
+* @param	Size: Size of Buf in bytes.
+*
+* @return	Pointer to the transaction instance on success and NULL on
+*		failure.
+*
+* @note		The payloads are copied, Buf can be released once this API
+*		returns.
+*
+******************************************************************************/
+XAie_TxnInst* XAie_TxnLoad(XAie_DevInst *DevInst, const void *Buf, u64 Size)
+{
+	XAie_TxnInst *Inst;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return NULL;
+	}
+
+	Inst = (XAie_TxnInst *)malloc(sizeof(*Inst));
+	if(Inst == NULL) {
+		XAIE_ERROR("Failed to allocate memory for txn instance\n");
+		return NULL;
+	}
+
+	RC = _XAie_TxnDecode(DevInst, Buf, Size, Inst, XAIE_DISABLE);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to load serialized transaction\n");
+		free(Inst);
+		return NULL;
+	}
+
+	Inst->Tid = 0U;
+	Inst->Flags = XAIE_TXN_INSTANCE_EXPORTED;
+	Inst->Node.Next = NULL;
+	Inst->HashNode.Next = NULL;
+
+	return Inst;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API executes a serialized transaction on the partition with a single
+* submission to the backend. The block write payloads of the record format are
+* referenced in place from Buf whenever it is word aligned.
+*
+* @param	DevInst: Device Instance.
+* @param	Buf: Serialized transaction generated by XAie_TxnSerialize() or
+*		XAie_TxnSerializeCompact().
+* @param	Size: Size of Buf in bytes.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_TxnReplay(XAie_DevInst *DevInst, const void *Buf, u64 Size)
+{
+	XAie_TxnInst Inst;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_TxnDecode(DevInst, Buf, Size, &Inst, XAIE_ENABLE);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to decode serialized transaction\n");
+		return RC;
+	}
+
+	Inst.Tid = 0U;
+	Inst.Flags = XAIE_TXN_INSTANCE_EXPORTED;
+	Inst.Node.Next = NULL;
+	Inst.HashNode.Next = NULL;
+
+	RC = _XAie_Txn_Submit(DevInst, &Inst);
+
+	_XAie_TxnArenaFree(&Inst);
+	free(Inst.CmdBuf);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the tile of a command.
+*
+* @param	DevInst: Device Instance.
+* @param	Cmd: Transaction command.
+* @param	Loc: Pointer to return the location of the tile.
+*
+* @return	XAIE_OK if the command addresses a tile of the partition,
+*		XAIE_ERR otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnCmdTile(XAie_DevInst *DevInst, const XAie_TxnCmd *Cmd,
+		XAie_LocType *Loc)
+{
+	u8 RowShift = DevInst->DevProp.RowShift;
+	u8 ColShift = DevInst->DevProp.ColShift;
+	u64 Row = (Cmd->RegOff >> RowShift) &
+		(((u64)1U << (ColShift - RowShift)) - 1U);
+	u64 Col = Cmd->RegOff >> ColShift;
+
+	if((Cmd->Opcode == XAIE_IO_MEMSYNC) || (Col >= DevInst->NumCols) ||
+			(Row >= DevInst->NumRows)) {
+		return XAIE_ERR;
+	}
+
+	*Loc = XAie_TileLoc((u8)Col, (u8)Row);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API orders register accesses by register and then by command index.
+*
+* @param	A: First access.
+* @param	B: Second access.
+*
+* @return	Negative, zero or positive like strcmp().
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static int _XAie_TxnRegAccessCmp(const void *A, const void *B)
+{
+	const XAie_TxnRegAccess *X = (const XAie_TxnRegAccess *)A;
+	const XAie_TxnRegAccess *Y = (const XAie_TxnRegAccess *)B;
+
+	if(X->RegOff != Y->RegOff) {
+		return (X->RegOff < Y->RegOff) ? -1 : 1;
+	}
+
+	return (X->Idx < Y->Idx) ? -1 : (X->Idx > Y->Idx);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds a register to the registers with the most writes.
+*
+* @param	Stats: Statistics to update.
+* @param	RegOff: Register offset.
+* @param	Writes: Number of writes to the register.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnStatsAddReg(XAie_TxnStats *Stats, u64 RegOff, u32 Writes)
+{
+	u32 i = Stats->NumTopRegs;
+
+	if(i == XAIE_TXN_STATS_TOP_REGS) {
+		if(Stats->TopRegs[i - 1U].Writes >= Writes) {
+			return;
+		}
+		i--;
+	} else {
+		Stats->NumTopRegs++;
+	}
+
+	while((i > 0U) && (Stats->TopRegs[i - 1U].Writes < Writes)) {
+		Stats->TopRegs[i] = Stats->TopRegs[i - 1U];
+		i--;
+	}
+
+	Stats->TopRegs[i].RegOff = RegOff;
+	Stats->TopRegs[i].Writes = Writes;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API goes through the single writes, reads and polls of a transaction
+* register by register, in command order. A write is redundant if it is
+* entirely overwritten by the next write to the register with no read or poll
+* of the register in between, or if it writes the bits the previous write of
+* the register already set.
+*
+* @param	TxnInst: Transaction instance.
+* @param	Access: Accesses of the transaction, sorted.
+* @param	NumAccess: Number of accesses.
+* @param	Stats: Statistics to update.
+*
+* @return	None.
+*
+* @note		Internal only. Block writes and block sets over the register
+*		are not taken into account.
+*
+******************************************************************************/
+static void _XAie_TxnStatsRegs(const XAie_TxnInst *TxnInst,
+		const XAie_TxnRegAccess *Access, u32 NumAccess,
+		XAie_TxnStats *Stats)
+{
+	u32 i = 0U;
+
+	while(i < NumAccess) {
+		const XAie_TxnCmd *Prev = NULL;
+		u64 RegOff = Access[i].RegOff;
+		u32 PrevValue = 0U;
+		u32 Writes = 0U;
+
+		for(; (i < NumAccess) && (Access[i].RegOff == RegOff); i++) {
+			const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[Access[i].Idx];
+
+			if(Cmd->Opcode != XAIE_IO_WRITE) {
+				Prev = NULL;
+				continue;
+			}
+
+			Writes++;
+			if(Prev == NULL) {
+				Prev = Cmd;
+				PrevValue = Cmd->Value;
+				continue;
+			}
+
+			if((Prev->Mask == 0U) && (Cmd->Mask != 0U) &&
+					((PrevValue & Cmd->Mask) ==
+					 (Cmd->Value & Cmd->Mask))) {
+				Stats->RedundantWrites++;
+				continue;
+			}
+
+			if(Cmd->Mask == 0U) {
+				Stats->RedundantWrites++;
+				Prev = Cmd;
+				PrevValue = Cmd->Value;
+			} else if(Prev->Mask == 0U) {
+				PrevValue = (PrevValue & ~Cmd->Mask) |
+					(Cmd->Value & Cmd->Mask);
+			} else {
+				Prev = Cmd;
+				PrevValue = Cmd->Value;
+			}
+		}
+
+		if(Writes > 0U) {
+			Stats->NumRegs++;
+			_XAie_TxnStatsAddReg(Stats, RegOff, Writes);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reports what a transaction instance contains: the commands by opcode
+* and by tile type and module, the payload sizes, the registers with the most
+* writes and the number of redundant writes. It can be used to find the call
+* sites worth batching or to compare a transaction before and after the
+* optimization of XAIE_TRANSACTION_ENABLE_OPTIMIZE.
+*
+* @param	DevInst: Device Instance.
+* @param	TxnInst: Exported or loaded transaction instance.
+* @param	Stats: Pointer to return the statistics.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Redundant writes are single writes which are overwritten before
+*		the register is read or polled, or which do not change the value
+*		written by the previous write. Registers with side effects on
+*		write, such as DMA queues, show up as redundant too.
+*
+******************************************************************************/
+AieRC XAie_TxnGetStats(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		XAie_TxnStats *Stats)
+{
+	XAie_TxnRegAccess *Access;
+	u32 NumAccess = 0U;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((TxnInst == XAIE_NULL) || (Stats == XAIE_NULL)) {
+		XAIE_ERROR("Invalid transaction instance or stats pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Access = (XAie_TxnRegAccess *)malloc(sizeof(*Access) *
+			((TxnInst->NumCmds > 0U) ? TxnInst->NumCmds : 1U));
+	if(Access == NULL) {
+		XAIE_ERROR("Failed to allocate memory for register accesses\n");
+		return XAIE_ERR;
+	}
+
+	memset((void *)Stats, 0, sizeof(*Stats));
+	Stats->NumCmds = TxnInst->NumCmds;
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		XAie_LocType Loc;
+
+		if((u32)Cmd->Opcode < XAIE_TXN_STATS_NUM_OPCODES) {
+			Stats->OpCount[Cmd->Opcode]++;
+		}
+
+		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			Stats->PayloadBytes += (u64)Cmd->Size * sizeof(u32);
+		} else if(Cmd->Opcode == XAIE_IO_BLOCKSET) {
+			Stats->BlockSetBytes += (u64)Cmd->Size * sizeof(u32);
+		} else if((Cmd->Opcode == XAIE_IO_WRITE) ||
+				(Cmd->Opcode == XAIE_IO_READ) ||
+				(Cmd->Opcode == XAIE_IO_MASKPOLL)) {
+			Access[NumAccess].RegOff = Cmd->RegOff;
+			Access[NumAccess].Idx = i;
+			NumAccess++;
+		}
+
+		if(_XAie_TxnCmdTile(DevInst, Cmd, &Loc) == XAIE_OK) {
+			u8 TileType = _XAie_GetTileTypefromLoc(DevInst, Loc);
+			u64 TileOff = Cmd->RegOff &
+				(((u64)1U << DevInst->DevProp.RowShift) - 1U);
+			XAie_ModuleType Mod;
+
+			if(TileType >= XAIEGBL_TILE_TYPE_MAX) {
+				continue;
+			}
+
+			if((TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
+					(TileType == XAIEGBL_TILE_TYPE_SHIMPL)) {
+				Mod = XAIE_PL_MOD;
+			} else if((TileType == XAIEGBL_TILE_TYPE_AIETILE) &&
+					(TileOff >= DevInst->DevProp.DevMod[
+					 TileType].CoreMod->ProgMemHostOffset)) {
+				Mod = XAIE_CORE_MOD;
+			} else {
+				Mod = XAIE_MEM_MOD;
+			}
+			Stats->ModCount[TileType][Mod]++;
+		}
+	}
+
+	qsort((void *)Access, NumAccess, sizeof(*Access),
+			_XAie_TxnRegAccessCmp);
+	_XAie_TxnStatsRegs(TxnInst, Access, NumAccess, Stats);
+	free(Access);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API counts the commands of a transaction instance by tile. The count of
+* the tile at column C and row R, relative to the partition, is returned in
+* Hist[C * NumRows + R], with NumRows the number of rows of the partition.
+*
+* @param	DevInst: Device Instance.
+* @param	TxnInst: Exported or loaded transaction instance.
+* @param	Hist: Array to return the counts.
+* @param	NumEntries: Number of entries of Hist, at least the number of
+*		tiles of the partition.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if Hist is
+*		too small and XAIE_INVALID_ARGS for invalid arguments.
+*
+* @note		Memory sync commands are not counted.
+*
+******************************************************************************/
+AieRC XAie_TxnGetTileHist(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 *Hist, u32 NumEntries)
+{
+	u32 NumTiles;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((TxnInst == XAIE_NULL) || (Hist == XAIE_NULL)) {
+		XAIE_ERROR("Invalid transaction instance or histogram\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	NumTiles = (u32)DevInst->NumCols * DevInst->NumRows;
+	if(NumEntries < NumTiles) {
+		XAIE_ERROR("Insufficient histogram size, expected %d entries\n",
+				NumTiles);
+		return XAIE_INSUFFICIENT_BUFFER_SIZE;
+	}
+
+	memset((void *)Hist, 0, sizeof(*Hist) * NumTiles);
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_LocType Loc;
+
+		if(_XAie_TxnCmdTile(DevInst, &TxnInst->CmdBuf[i], &Loc) ==
+				XAIE_OK) {
+			Hist[(u32)Loc.Col * DevInst->NumRows + Loc.Row]++;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API executes the transaction of a fence and signals the fence.
+*
+* @param	Fence: Fence of the asynchronous submission.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TxnFenceExecute(XAie_TxnFence *Fence)
+{
+	AieRC RC;
+
+	RC = _XAie_Txn_Submit(Fence->DevInst, Fence->TxnInst);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Asynchronous transaction submission failed\n");
+	}
+
+	if(Fence->OwnInst == XAIE_ENABLE) {
+		_XAie_TxnFree(Fence->TxnInst);
+		Fence->TxnInst = NULL;
+	}
+
+	if(Fence->Cb != NULL) {
+		Fence->Cb(Fence->Priv, RC);
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_lock(&Fence->Lock);
+	Fence->Status = RC;
+	Fence->Done = XAIE_ENABLE;
+	pthread_cond_broadcast(&Fence->Cond);
+	pthread_mutex_unlock(&Fence->Lock);
+#else
+	Fence->Status = RC;
+	Fence->Done = XAIE_ENABLE;
+#endif
+}
+
+#ifndef __AIEBAREMETAL__
+/*****************************************************************************/
+/**
+*
+* This is the thread function of the submission worker. It executes the queued
+* fences in order and returns once the queue is drained after an exit request.
+*
+* @param	Arg: Pointer to the submission queue.
+*
+* @return	NULL.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void *_XAie_TxnWorker(void *Arg)
+{
+	XAie_TxnQueue *Queue = (XAie_TxnQueue *)Arg;
+	XAie_TxnFence *Fence;
+
+	pthread_mutex_lock(&Queue->Lock);
+	while(1) {
+		while((Queue->Head == NULL) && (Queue->Exit == 0U)) {
+			pthread_cond_wait(&Queue->Cond, &Queue->Lock);
+		}
+
+		Fence = Queue->Head;
+		if(Fence == NULL) {
+			break;
+		}
+
+		Queue->Head = Fence->Next;
+		if(Queue->Head == NULL) {
+			Queue->Tail = NULL;
+		}
+		pthread_mutex_unlock(&Queue->Lock);
+
+		_XAie_TxnFenceExecute(Fence);
+
+		pthread_mutex_lock(&Queue->Lock);
+	}
+	pthread_mutex_unlock(&Queue->Lock);
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the submission worker of the device instance. The worker is
+* started on the first asynchronous submission.
+*
+* @param	DevInst: Device Instance.
+*
+* @return	Pointer to the submission queue on success and NULL on failure.
+*
+* @note		Internal only. Threads submitting their first asynchronous
+*		transaction concurrently share the worker started by the
+*		first one.
+*
+******************************************************************************/
+static XAie_TxnQueue* _XAie_TxnGetQueue(XAie_DevInst *DevInst)
+{
+	XAie_TxnQueue *Queue;
+
+	Queue = __atomic_load_n(&DevInst->TxnQueue, __ATOMIC_ACQUIRE);
+	if(Queue != NULL) {
+		return Queue;
+	}
+
+	pthread_mutex_lock(&_XAie_TxnQueueCreateLock);
+	Queue = DevInst->TxnQueue;
+	if(Queue == NULL) {
+		Queue = (XAie_TxnQueue *)malloc(sizeof(*Queue));
+		if(Queue == NULL) {
+			XAIE_ERROR("Failed to allocate memory for transaction "
+					"submission queue\n");
+			pthread_mutex_unlock(&_XAie_TxnQueueCreateLock);
+			return NULL;
+		}
+
+		Queue->Head = NULL;
+		Queue->Tail = NULL;
+		Queue->Exit = 0U;
+		pthread_mutex_init(&Queue->Lock, NULL);
+		pthread_cond_init(&Queue->Cond, NULL);
+		if(pthread_create(&Queue->Thread, NULL, _XAie_TxnWorker,
+					(void *)Queue) != 0) {
+			XAIE_ERROR("Failed to start transaction submission "
+					"worker\n");
+			pthread_cond_destroy(&Queue->Cond);
+			pthread_mutex_destroy(&Queue->Lock);
+			free(Queue);
+			pthread_mutex_unlock(&_XAie_TxnQueueCreateLock);
+			return NULL;
+		}
+
+		__atomic_store_n(&DevInst->TxnQueue, Queue, __ATOMIC_RELEASE);
+	}
+	pthread_mutex_unlock(&_XAie_TxnQueueCreateLock);
+
+	return Queue;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API queues a fence to the submission worker of the device instance.
+*
+* @param	DevInst: Device Instance.
+* @param	Fence: Fence of the asynchronous submission.
+*
+* @return	XAIE_OK on success and XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TxnQueueFence(XAie_DevInst *DevInst, XAie_TxnFence *Fence)
+{
+	XAie_TxnQueue *Queue = _XAie_TxnGetQueue(DevInst);
+
+	if(Queue == NULL) {
+		return XAIE_ERR;
+	}
+
+	pthread_mutex_lock(&Queue->Lock);
+	if(Queue->Tail != NULL) {
+		Queue->Tail->Next = Fence;
+	} else {
+		Queue->Head = Fence;
+	}
+	Queue->Tail = Fence;
+	pthread_cond_signal(&Queue->Cond);
+	pthread_mutex_unlock(&Queue->Lock);
+
+	return XAIE_OK;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API submits a transaction for execution and returns without waiting for
+* the commands to be executed. Submissions of a device instance are executed in
+* order by a worker thread, so the calling thread can record the next
+* transaction meanwhile.
+*
+* @param	DevInst: Device Instance.
+* @param	TxnInst: Exported or loaded transaction instance. If NULL, the
+*		transaction of the calling thread is submitted and the thread
+*		can start a new transaction right away.
+* @param	Cb: Optional callback invoked from the worker once the
+*		transaction is executed.
+* @param	Priv: Private data passed to Cb.
+*
+* @return	Fence of the submission on success and NULL on failure.
+*
+* @note		An exported TxnInst must not be freed before the fence is
+*		signalled. The fence must be released with
+*		XAie_TxnFenceFree(). Shim DMA BDs and memory syncs recorded
+*		with XAie_TxnMemSync() are executed by the worker in order
+*		with the register writes of the transaction. Without thread support
+*		(__AIEBAREMETAL__), the transaction is executed before this
+*		API returns.
+*
+******************************************************************************/
+XAie_TxnFence* XAie_SubmitTransactionAsync(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, XAie_TxnCallback Cb, void *Priv)
+{
+	XAie_TxnFence *Fence;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return NULL;
+	}
+
+	if((TxnInst != XAIE_NULL) &&
+			!(TxnInst->Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
+		XAIE_ERROR("Transaction instance was not exported.\n");
+		return NULL;
+	}
+
+	Fence = (XAie_TxnFence *)malloc(sizeof(*Fence));
+	if(Fence == NULL) {
+		XAIE_ERROR("Failed to allocate memory for transaction fence\n");
+		return NULL;
+	}
+
+	Fence->DevInst = DevInst;
+	Fence->TxnInst = TxnInst;
+	Fence->Cb = Cb;
+	Fence->Priv = Priv;
+	Fence->Status = XAIE_OK;
+	Fence->Done = XAIE_DISABLE;
+	Fence->OwnInst = XAIE_DISABLE;
+	Fence->Next = NULL;
+
+	if(TxnInst == XAIE_NULL) {
+		Fence->TxnInst = _XAie_TxnDetach(DevInst);
+		if(Fence->TxnInst == NULL) {
+			free(Fence);
+			return NULL;
+		}
+		Fence->OwnInst = XAIE_ENABLE;
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_init(&Fence->Lock, NULL);
+	pthread_cond_init(&Fence->Cond, NULL);
+
+	if(_XAie_TxnQueueFence(DevInst, Fence) != XAIE_OK) {
+		/* Fall back to a synchronous submission */
+		_XAie_TxnFenceExecute(Fence);
+	}
+#else
+	_XAie_TxnFenceExecute(Fence);
+#endif
+
+	return Fence;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if the transaction of a fence is executed.
+*
+* @param	Fence: Fence returned by XAie_SubmitTransactionAsync().
+*
+* @return	XAIE_ENABLE if the transaction is executed, XAIE_DISABLE
+*		otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+u8 XAie_TxnFencePoll(XAie_TxnFence *Fence)
+{
+	u8 Done;
+
+	if(Fence == XAIE_NULL) {
+		XAIE_ERROR("Invalid fence\n");
+		return XAIE_DISABLE;
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_lock(&Fence->Lock);
+	Done = Fence->Done;
+	pthread_mutex_unlock(&Fence->Lock);
+#else
+	Done = Fence->Done;
+#endif
+
+	return Done;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API blocks until the transaction of a fence is executed.
+*
+* @param	Fence: Fence returned by XAie_SubmitTransactionAsync().
+*
+* @return	Status of the execution of the transaction.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_TxnFenceWait(XAie_TxnFence *Fence)
+{
+	AieRC RC;
+
+	if(Fence == XAIE_NULL) {
+		XAIE_ERROR("Invalid fence\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_lock(&Fence->Lock);
+	while(Fence->Done == XAIE_DISABLE) {
+		pthread_cond_wait(&Fence->Cond, &Fence->Lock);
+	}
+	RC = Fence->Status;
+	pthread_mutex_unlock(&Fence->Lock);
+#else
+	RC = Fence->Status;
+#endif
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits for the transaction of a fence to be executed and releases the
+* fence.
+*
+* @param	Fence: Fence returned by XAie_SubmitTransactionAsync().
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_TxnFenceFree(XAie_TxnFence *Fence)
+{
+	if(Fence == XAIE_NULL) {
+		return;
+	}
+
+	(void)XAie_TxnFenceWait(Fence);
+
+#ifndef __AIEBAREMETAL__
+	pthread_cond_destroy(&Fence->Cond);
+	pthread_mutex_destroy(&Fence->Lock);
+#endif
+	free(Fence);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API drains the pending asynchronous submissions of a device instance and
+* stops its submission worker.
+*
+* @param	DevInst: Device Instance.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_TxnQueueFinish(XAie_DevInst *DevInst)
+{
+#ifndef __AIEBAREMETAL__
+	XAie_TxnQueue *Queue = DevInst->TxnQueue;
+
+	if(Queue == NULL) {
+		return;
+	}
+
+	pthread_mutex_lock(&Queue->Lock);
+	Queue->Exit = 1U;
+	pthread_cond_signal(&Queue->Cond);
+	pthread_mutex_unlock(&Queue->Lock);
+
+	pthread_join(Queue->Thread, NULL);
+	pthread_cond_destroy(&Queue->Cond);
+	pthread_mutex_destroy(&Queue->Lock);
+	free(Queue);
+#endif
+	DevInst->TxnQueue = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a chain of transaction segments. A chain submits a list of
+* exported transaction instances, for instance a partition initialization
+* shared by several graphs, the setup of one graph and the buffer descriptor
+* updates of one run, as one transaction without copying their payloads.
+*
+* @param	DevInst: Device Instance.
+* @param	NumSegs: Number of segments of the chain.
+*
+* @return	Pointer to the chain on success, NULL on failure.
+*
+* @note		The segments are set with XAie_TxnChainSet(). The chain must
+*		be freed with XAie_TxnChainFree().
+*
+******************************************************************************/
+XAie_TxnChain* XAie_TxnChainCreate(XAie_DevInst *DevInst, u32 NumSegs)
+{
+	XAie_TxnChain *Chain;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return NULL;
+	}
+
+	if(NumSegs == 0U) {
+		XAIE_ERROR("Invalid number of transaction segments\n");
+		return NULL;
+	}
+
+	Chain = (XAie_TxnChain *)calloc(1U, sizeof(*Chain));
+	if(Chain == NULL) {
+		XAIE_ERROR("Failed to allocate memory for transaction chain\n");
+		return NULL;
+	}
+
+	Chain->Segs = (XAie_TxnInst **)calloc(NumSegs, sizeof(*Chain->Segs));
+	Chain->SegCmdBuf = (const XAie_TxnCmd **)calloc(NumSegs,
+			sizeof(*Chain->SegCmdBuf));
+	Chain->SegNumCmds = (u32 *)calloc(NumSegs, sizeof(u32));
+	Chain->SegStart = (u32 *)calloc(NumSegs + 1U, sizeof(u32));
+	Chain->SegStartCol = (u8 *)calloc(NumSegs, sizeof(u8));
+	if((Chain->Segs == NULL) || (Chain->SegCmdBuf == NULL) ||
+			(Chain->SegNumCmds == NULL) ||
+			(Chain->SegStart == NULL) ||
+			(Chain->SegStartCol == NULL)) {
+		XAIE_ERROR("Failed to allocate memory for transaction chain\n");
+		XAie_TxnChainFree(Chain);
+		return NULL;
+	}
+
+	Chain->DevInst = DevInst;
+	Chain->NumSegs = NumSegs;
+
+	return Chain;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets a segment of a chain. The segment is referenced, not copied:
+* it must stay valid until it is replaced or the chain is freed.
+*
+* @param	Chain: Chain created by XAie_TxnChainCreate().
+* @param	Seg: Index of the segment in the chain.
+* @param	TxnInst: Exported transaction instance, NULL to leave the
+*		segment empty.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The commands of the segments before Seg, typically a shared
+*		prefix, are not gathered again by the next submission. The
+*		same instance can be set in several chains.
+*
+******************************************************************************/
+AieRC XAie_TxnChainSet(XAie_TxnChain *Chain, u32 Seg, XAie_TxnInst *TxnInst)
+{
+	if((Chain == XAIE_NULL) || (Seg >= Chain->NumSegs)) {
+		XAIE_ERROR("Invalid transaction chain segment\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((TxnInst != XAIE_NULL) &&
+			!(TxnInst->Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
+		XAIE_ERROR("Transaction instance was not exported.\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Chain->Segs[Seg] = TxnInst;
+	if(Seg < Chain->NumValid) {
+		Chain->NumValid = Seg;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API gathers the commands of the segments of a chain. The gathered
+* commands of the leading segments which did not change are kept.
+*
+* @param	Chain: Chain of transaction segments.
+*
+* @return	XAIE_OK on success, XAIE_ERR if memory allocation fails.
+*
+* @note		Internal only. A segment changed if its command buffer, its
+*		number of commands or its start column differ from the ones
+*		it was gathered with, which covers XAie_TxnRelocate().
+*
+******************************************************************************/
+static AieRC _XAie_TxnChainGather(XAie_TxnChain *Chain)
+{
+	u32 NumCmds;
+
+	for(u32 i = 0U; i < Chain->NumValid; i++) {
+		const XAie_TxnInst *Inst = Chain->Segs[i];
+
+		if((Inst != NULL) && ((Inst->CmdBuf != Chain->SegCmdBuf[i]) ||
+				(Inst->NumCmds != Chain->SegNumCmds[i]) ||
+				(Inst->StartCol != Chain->SegStartCol[i]))) {
+			Chain->NumValid = i;
+			break;
+		}
+	}
+
+	NumCmds = Chain->SegStart[Chain->NumValid];
+	for(u32 i = Chain->NumValid; i < Chain->NumSegs; i++) {
+		if(Chain->Segs[i] != NULL) {
+			NumCmds += Chain->Segs[i]->NumCmds;
+		}
+	}
+
+	if(NumCmds > Chain->MaxCmds) {
+		XAie_TxnCmd *Cmds;
+
+		Cmds = (XAie_TxnCmd *)realloc((void *)Chain->Cmds,
+				NumCmds * sizeof(*Cmds));
+		if(Cmds == NULL) {
+			XAIE_ERROR("Failed to allocate memory for transaction "
+					"chain\n");
+			return XAIE_ERR;
+		}
+		Chain->Cmds = Cmds;
+		Chain->MaxCmds = NumCmds;
+	}
+
+	for(u32 i = Chain->NumValid; i < Chain->NumSegs; i++) {
+		const XAie_TxnInst *Inst = Chain->Segs[i];
+		u32 Start = Chain->SegStart[i];
+
+		Chain->SegCmdBuf[i] = NULL;
+		Chain->SegNumCmds[i] = 0U;
+		Chain->SegStartCol[i] = 0U;
+		if((Inst != NULL) && (Inst->NumCmds != 0U)) {
+			memcpy((void *)&Chain->Cmds[Start], (void *)Inst->CmdBuf,
+					Inst->NumCmds * sizeof(*Inst->CmdBuf));
+			Chain->SegCmdBuf[i] = Inst->CmdBuf;
+			Chain->SegNumCmds[i] = Inst->NumCmds;
+			Chain->SegStartCol[i] = Inst->StartCol;
+		}
+		Chain->SegStart[i + 1U] = Start + Chain->SegNumCmds[i];
+	}
+	Chain->NumValid = Chain->NumSegs;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API executes the segments of a chain in order, as one transaction. The
+* commands of the segments are gathered in one command buffer, the block write
+* payloads are referenced from the segments. The Linux backend submits the
+* chain in one ioctl, unless it has commands executed between the ioctls of
+* the surrounding writes, as for any transaction.
+*
+* @param	Chain: Chain created by XAie_TxnChainCreate().
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The commands of the leading segments which did not change
+*		since the last submission are not gathered again, so that
+*		resubmitting a chain with a new last segment only costs the
+*		commands of that segment. The chain is not optimized across
+*		segments. A chain must not be used by several threads at once.
+*
+******************************************************************************/
+AieRC XAie_TxnChainSubmit(XAie_TxnChain *Chain)
+{
+	XAie_TxnInst Inst;
+	AieRC RC;
+
+	if(Chain == XAIE_NULL) {
+		XAIE_ERROR("Invalid transaction chain\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_TxnChainGather(Chain);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	memset(&Inst, 0, sizeof(Inst));
+	Inst.Flags = XAIE_TXN_INSTANCE_EXPORTED;
+	Inst.NumCmds = Chain->SegStart[Chain->NumSegs];
+	Inst.MaxCmds = Chain->MaxCmds;
+	Inst.CmdBuf = Chain->Cmds;
+
+	return _XAie_Txn_Submit(Chain->DevInst, &Inst);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees a chain of transaction segments. The segments are not freed.
+*
+* @param	Chain: Chain created by XAie_TxnChainCreate().
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_TxnChainFree(XAie_TxnChain *Chain)
+{
+	if(Chain == XAIE_NULL) {
+		return;
+	}
+
+	free(Chain->Segs);
+	free((void *)Chain->SegCmdBuf);
+	free(Chain->SegNumCmds);
+	free(Chain->SegStart);
+	free(Chain->SegStartCol);
+	free(Chain->Cmds);
+	free(Chain);
+}
+
+/** @} */
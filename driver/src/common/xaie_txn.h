@@ -0,0 +1,135 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_txn.h
+* @{
+*
+* This file contains the serialized transaction format and the routines to
+* save, load, replay and chain transactions.
+*
+******************************************************************************/
+#ifndef XAIE_TXN_H
+#define XAIE_TXN_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TXN_MAGIC			0x4E585441U /* "ATXN" */
+#define XAIE_TXN_MAGIC_COMPACT		0x43585441U /* "ATXC" */
+#define XAIE_TXN_VERSION_MAJOR		1U
+#define XAIE_TXN_VERSION_MINOR		0U
+
+#define XAIE_TXN_STATS_NUM_OPCODES	7U
+#define XAIE_TXN_STATS_NUM_MODS		3U
+#define XAIE_TXN_STATS_TOP_REGS		16U
+
+/**************************** Type Definitions *******************************/
+/*
+ * Typedef to capture the header of a serialized transaction. The header is
+ * followed by NumCmds command records. All the fields are stored in host byte
+ * order and all the records start at an 8 byte boundary from the header.
+ * Transactions serialized in the compact format use XAIE_TXN_MAGIC_COMPACT and
+ * are followed by NumCmds variable length commands instead.
+ */
+typedef struct {
+	u32 Magic;
+	u8 MajorVer;
+	u8 MinorVer;
+	u8 DevGen;	/* Device generation the transaction was recorded for */
+	u8 NumRows;	/* Number of rows of the recording partition */
+	u8 NumCols;	/* Number of columns of the recording partition */
+	u8 RowShift;
+	u8 ColShift;
+	u8 StartCol;	/* Column the commands are placed at */
+	u32 NumCmds;
+	u32 Rsvd;
+	u64 TxnSize;	/* Size of the serialized transaction in bytes */
+} XAie_TxnHeader;
+
+/*
+ * Typedef to capture one serialized command. Block write records are followed
+ * by Size payload words, padded to an 8 byte boundary.
+ */
+typedef struct {
+	u8 Opcode;
+	u8 Rsvd[3];
+	u32 Mask;
+	u64 RegOff;	/* Register offset relative to the partition */
+	u32 Value;
+	u32 Size;	/* Number of words for block write and block set */
+} XAie_TxnCmdRecord;
+
+/*
+ * Typedef to capture the number of writes to a register of a transaction.
+ */
+typedef struct {
+	u64 RegOff;	/* Register offset relative to the partition */
+	u32 Writes;	/* Single and masked writes to the register */
+} XAie_TxnRegStats;
+
+/*
+ * Typedef to capture the content of a transaction instance. The commands are
+ * counted by the XAie_TxnOpcode of the driver, and by tile type and
+ * XAie_ModuleType of the tile they address. Memory sync commands address no
+ * tile. TopRegs lists the registers with the most single writes, in decreasing
+ * order.
+ */
+typedef struct {
+	u32 NumCmds;
+	u32 OpCount[XAIE_TXN_STATS_NUM_OPCODES];
+	u32 ModCount[XAIEGBL_TILE_TYPE_MAX][XAIE_TXN_STATS_NUM_MODS];
+	u64 PayloadBytes;	/* Bytes of the block write payloads */
+	u64 BlockSetBytes;	/* Bytes written by the block sets */
+	u32 NumRegs;		/* Distinct registers with single writes */
+	u32 RedundantWrites;	/* Single writes without effect on the device */
+	u32 NumTopRegs;
+	XAie_TxnRegStats TopRegs[XAIE_TXN_STATS_TOP_REGS];
+} XAie_TxnStats;
+
+/* Fence to track the completion of an asynchronous transaction submission */
+typedef struct XAie_TxnFence XAie_TxnFence;
+
+/*
+ * Callback invoked from the submission worker once an asynchronous
+ * transaction is executed, with the status of the execution.
+ */
+typedef void (*XAie_TxnCallback)(void *Priv, AieRC Status);
+
+/* Chain of transaction segments submitted as one transaction */
+typedef struct XAie_TxnChain XAie_TxnChain;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_TxnSerialize(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		void *Buf, u64 *Size);
+AieRC XAie_TxnSerializeCompact(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		void *Buf, u64 *Size);
+AieRC XAie_TxnRelocate(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u8 StartCol);
+XAie_TxnInst* XAie_TxnLoad(XAie_DevInst *DevInst, const void *Buf, u64 Size);
+AieRC XAie_TxnReplay(XAie_DevInst *DevInst, const void *Buf, u64 Size);
+AieRC XAie_TxnGetStats(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		XAie_TxnStats *Stats);
+AieRC XAie_TxnGetTileHist(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 *Hist, u32 NumEntries);
+AieRC XAie_TxnExportCdo(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 WcDepth);
+XAie_TxnFence* XAie_SubmitTransactionAsync(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, XAie_TxnCallback Cb, void *Priv);
+u8 XAie_TxnFencePoll(XAie_TxnFence *Fence);
+AieRC XAie_TxnFenceWait(XAie_TxnFence *Fence);
+void XAie_TxnFenceFree(XAie_TxnFence *Fence);
+void _XAie_TxnQueueFinish(XAie_DevInst *DevInst);
+XAie_TxnChain* XAie_TxnChainCreate(XAie_DevInst *DevInst, u32 NumSegs);
+AieRC XAie_TxnChainSet(XAie_TxnChain *Chain, u32 Seg, XAie_TxnInst *TxnInst);
+AieRC XAie_TxnChainSubmit(XAie_TxnChain *Chain);
+void XAie_TxnChainFree(XAie_TxnChain *Chain);
+
+#endif		/* end of protection macro */
+
+/** @} */
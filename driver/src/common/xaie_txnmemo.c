@@ -0,0 +1,512 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_txnmemo.c
+* @{
+*
+* This file contains routines for the memoized configuration transactions. A
+* block of configuration calls is wrapped with XAie_TxnMemoBegin() and
+* XAie_TxnMemoEnd() under a key of the caller. The first execution of a key is
+* recorded in a transaction, and later executions of the same key submit the
+* recorded transaction directly, skipping the argument checks, the descriptor
+* encoding and the address computation of the configuration APIs.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#endif
+
+#include "xaie_dma_shadow.h"
+#include "xaie_helper.h"
+#include "xaie_shadow.h"
+#include "xaie_txnmemo.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TXNMEMO_HASH_BITS		8U
+#define XAIE_TXNMEMO_HASH_SIZE		(1U << XAIE_TXNMEMO_HASH_BITS)
+#define XAIE_TXNMEMO_FNV_OFFSET		0xCBF29CE484222325ULL
+#define XAIE_TXNMEMO_FNV_PRIME		0x100000001B3ULL
+
+/**************************** Type Definitions *******************************/
+typedef struct XAie_TxnMemoEntry {
+	struct XAie_TxnMemoEntry *Next;
+	u64 Key;
+	XAie_TxnInst *TxnInst;	/* Exported copy of the recorded block */
+} XAie_TxnMemoEntry;
+
+struct XAie_TxnMemo {
+	XAie_TxnMemoEntry *Hash[XAIE_TXNMEMO_HASH_SIZE];
+	XAie_TxnMemoStats Stats;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+#endif
+};
+
+/************************** Function Definitions *****************************/
+#ifndef __AIEBAREMETAL__
+static inline void _XAie_TxnMemoLock(XAie_TxnMemo *Memo)
+{
+	pthread_mutex_lock(&Memo->Lock);
+}
+
+static inline void _XAie_TxnMemoUnlock(XAie_TxnMemo *Memo)
+{
+	pthread_mutex_unlock(&Memo->Lock);
+}
+#else
+static inline void _XAie_TxnMemoLock(XAie_TxnMemo *Memo)
+{
+	(void)Memo;
+}
+
+static inline void _XAie_TxnMemoUnlock(XAie_TxnMemo *Memo)
+{
+	(void)Memo;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API returns the hash chain of a key.
+*
+* @param	Key: Key of the recorded block.
+*
+* @return	Index of the hash chain.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline u32 _XAie_TxnMemoIndex(u64 Key)
+{
+	return (u32)((Key * 0x9E3779B97F4A7C15ULL) >>
+			(64U - XAIE_TXNMEMO_HASH_BITS));
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the link to the entry of a key in its hash chain.
+*
+* @param	Memo: Pointer to the memoized transactions.
+* @param	Key: Key of the recorded block.
+*
+* @return	Pointer to the link to the entry, the link is NULL if the key
+*		is not recorded.
+*
+* @note		Internal only. The lock must be held.
+*
+******************************************************************************/
+static XAie_TxnMemoEntry **_XAie_TxnMemoFind(XAie_TxnMemo *Memo, u64 Key)
+{
+	XAie_TxnMemoEntry **Link = &Memo->Hash[_XAie_TxnMemoIndex(Key)];
+
+	while((*Link != NULL) && ((*Link)->Key != Key)) {
+		Link = &(*Link)->Next;
+	}
+
+	return Link;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases all the recorded transactions.
+*
+* @param	Memo: Pointer to the memoized transactions.
+*
+* @return	None.
+*
+* @note		Internal only. The lock must be held.
+*
+******************************************************************************/
+static void _XAie_TxnMemoRelease(XAie_TxnMemo *Memo)
+{
+	for(u32 i = 0U; i < XAIE_TXNMEMO_HASH_SIZE; i++) {
+		while(Memo->Hash[i] != NULL) {
+			XAie_TxnMemoEntry *Entry = Memo->Hash[i];
+
+			Memo->Hash[i] = Entry->Next;
+			_XAie_TxnFree(Entry->TxnInst);
+			free(Entry);
+		}
+	}
+
+	Memo->Stats.Entries = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API enables or disables the memoized configuration transactions. The
+* recorded transactions are released when it is disabled.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Enable: XAIE_ENABLE to enable the memoization, XAIE_DISABLE
+*		to disable it.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The memoization is disabled by default. While it is disabled,
+*		XAie_TxnMemoBegin() always lets the block execute directly.
+*
+******************************************************************************/
+AieRC XAie_ConfigTxnMemo(XAie_DevInst *DevInst, u8 Enable)
+{
+	XAie_TxnMemo *Memo;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Enable == XAIE_DISABLE) {
+		_XAie_TxnMemoFinish(DevInst);
+		return XAIE_OK;
+	}
+
+	if(DevInst->TxnMemo != NULL) {
+		return XAIE_OK;
+	}
+
+	Memo = (XAie_TxnMemo *)calloc(1U, sizeof(*Memo));
+	if(Memo == NULL) {
+		XAIE_ERROR("Failed to allocate the memoized transactions\n");
+		return XAIE_ERR;
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_init(&Memo->Lock, NULL);
+#endif
+	DevInst->TxnMemo = Memo;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API hashes the arguments of a configuration block into a key for
+* XAie_TxnMemoBegin(). Keys of blocks made of several calls can be chained by
+* passing the key of the previous arguments as the seed.
+*
+* @param	Seed: Key to extend, 0 to start a new key.
+* @param	Args: Pointer to the arguments.
+* @param	Size: Size of the arguments in bytes.
+*
+* @return	Key of the arguments.
+*
+* @note		The arguments are hashed byte by byte, structures with padding
+*		must be zero initialized. Pointers are hashed by address, not
+*		by the data they point to.
+*
+******************************************************************************/
+u64 XAie_TxnMemoKey(u64 Seed, const void *Args, u64 Size)
+{
+	const u8 *Bytes = (const u8 *)Args;
+	u64 Key = XAIE_TXNMEMO_FNV_OFFSET ^ Seed;
+
+	for(u64 i = 0U; i < Size; i++) {
+		Key ^= Bytes[i];
+		Key *= XAIE_TXNMEMO_FNV_PRIME;
+	}
+
+	return Key;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts a memoized configuration block. If the key was recorded
+* before, the recorded transaction is submitted and Replayed is set, and the
+* caller skips the block. Otherwise, a transaction is started on the calling
+* thread to record the block, which the caller executes and closes with
+* XAie_TxnMemoEnd().
+*
+*	XAie_TxnMemoBegin(DevInst, Key, &Replayed);
+*	if(Replayed == XAIE_DISABLE) {
+*		XAie_DmaWriteBd(DevInst, &DmaDesc, Loc, BdNum);
+*		XAie_StrmConnCctEnable(DevInst, Loc, ...);
+*		XAie_TxnMemoEnd(DevInst, Key);
+*	}
+*
+* @param	DevInst: Device instance pointer.
+* @param	Key: Key of the block, from the arguments of its calls.
+* @param	Replayed: Pointer to return XAIE_ENABLE if the block was
+*		replayed, XAIE_DISABLE if the caller has to execute it.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The calling thread must not have a transaction open. The key
+*		must identify everything the block writes: a replay only writes
+*		the recorded registers, it does not redo the checks of the
+*		configuration APIs nor update the driver state they keep, such
+*		as the resource manager or the data memory checkpoint. Reads
+*		and polls of the block are not replayed, blocks containing
+*		reads are executed but not recorded. The shadow caches are
+*		invalidated before a block is recorded, so it records all its
+*		writes.
+*
+******************************************************************************/
+AieRC XAie_TxnMemoBegin(XAie_DevInst *DevInst, u64 Key, u8 *Replayed)
+{
+	XAie_TxnMemo *Memo;
+	XAie_TxnMemoEntry *Entry;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Replayed == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	*Replayed = XAIE_DISABLE;
+	Memo = DevInst->TxnMemo;
+	if(Memo == NULL) {
+		return XAIE_OK;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE) {
+		XAIE_ERROR("Memoized block started in a transaction\n");
+		return XAIE_ERR;
+	}
+
+	_XAie_TxnMemoLock(Memo);
+	Entry = *_XAie_TxnMemoFind(Memo, Key);
+	if(Entry != NULL) {
+		Memo->Stats.Hits++;
+	} else {
+		Memo->Stats.Misses++;
+	}
+	_XAie_TxnMemoUnlock(Memo);
+
+	if(Entry != NULL) {
+		RC = _XAie_Txn_Submit(DevInst, Entry->TxnInst);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to replay memoized block\n");
+			return RC;
+		}
+
+		*Replayed = XAIE_ENABLE;
+		return XAIE_OK;
+	}
+
+	_XAie_ShadowInvalidateAll(DevInst);
+	_XAie_BdShadowInvalidateAll(DevInst);
+
+	return _XAie_Txn_Start(DevInst, XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API ends a memoized configuration block started with
+* XAie_TxnMemoBegin() which was not replayed. The recorded transaction is
+* submitted and kept for the later blocks of the same key.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Key: Key the block was started with.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		If the recorded transaction cannot be kept, the block is still
+*		submitted and will be recorded again the next time.
+*
+******************************************************************************/
+AieRC XAie_TxnMemoEnd(XAie_DevInst *DevInst, u64 Key)
+{
+	XAie_TxnMemo *Memo;
+	XAie_TxnMemoEntry **Link;
+	XAie_TxnMemoEntry *Entry;
+	XAie_TxnInst *TxnInst;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Memo = DevInst->TxnMemo;
+	if(Memo == NULL) {
+		return XAIE_OK;
+	}
+
+	TxnInst = _XAie_TxnExport(DevInst);
+	if(TxnInst != NULL) {
+		for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+			if(TxnInst->CmdBuf[i].Opcode == XAIE_IO_READ) {
+				XAIE_WARN("Memoized block with reads is not "
+						"recorded\n");
+				_XAie_TxnFree(TxnInst);
+				TxnInst = NULL;
+				break;
+			}
+		}
+	}
+
+	RC = _XAie_Txn_Submit(DevInst, NULL);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to submit memoized block\n");
+		if(TxnInst != NULL) {
+			_XAie_TxnFree(TxnInst);
+		}
+		return RC;
+	}
+
+	Entry = NULL;
+	if(TxnInst != NULL) {
+		Entry = (XAie_TxnMemoEntry *)malloc(sizeof(*Entry));
+		if(Entry == NULL) {
+			_XAie_TxnFree(TxnInst);
+		}
+	}
+
+	_XAie_TxnMemoLock(Memo);
+	if(Entry == NULL) {
+		Memo->Stats.Uncached++;
+		_XAie_TxnMemoUnlock(Memo);
+		return XAIE_OK;
+	}
+
+	/* Another thread may have recorded the same key meanwhile */
+	Link = _XAie_TxnMemoFind(Memo, Key);
+	if(*Link != NULL) {
+		_XAie_TxnMemoUnlock(Memo);
+		_XAie_TxnFree(TxnInst);
+		free(Entry);
+		return XAIE_OK;
+	}
+
+	Entry->Next = NULL;
+	Entry->Key = Key;
+	Entry->TxnInst = TxnInst;
+	*Link = Entry;
+	Memo->Stats.Entries++;
+	_XAie_TxnMemoUnlock(Memo);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the recorded transaction of a key, the next block of the
+* key is executed and recorded again.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Key: Key of the recorded block.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Must not run concurrently with a replay of the same key.
+*
+******************************************************************************/
+AieRC XAie_TxnMemoInvalidate(XAie_DevInst *DevInst, u64 Key)
+{
+	XAie_TxnMemo *Memo;
+	XAie_TxnMemoEntry **Link;
+	XAie_TxnMemoEntry *Entry;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Memo = DevInst->TxnMemo;
+	if(Memo == NULL) {
+		XAIE_ERROR("Memoized transactions are not enabled\n");
+		return XAIE_ERR;
+	}
+
+	_XAie_TxnMemoLock(Memo);
+	Link = _XAie_TxnMemoFind(Memo, Key);
+	Entry = *Link;
+	if(Entry != NULL) {
+		*Link = Entry->Next;
+		Memo->Stats.Entries--;
+	}
+	_XAie_TxnMemoUnlock(Memo);
+
+	if(Entry != NULL) {
+		_XAie_TxnFree(Entry->TxnInst);
+		free(Entry);
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the statistics of the memoized transactions.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Stats: Pointer to return the statistics.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_TxnMemoGetStats(XAie_DevInst *DevInst, XAie_TxnMemoStats *Stats)
+{
+	XAie_TxnMemo *Memo;
+
+	if((DevInst == XAIE_NULL) || (Stats == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Memo = DevInst->TxnMemo;
+	if(Memo == NULL) {
+		XAIE_ERROR("Memoized transactions are not enabled\n");
+		return XAIE_ERR;
+	}
+
+	_XAie_TxnMemoLock(Memo);
+	*Stats = Memo->Stats;
+	_XAie_TxnMemoUnlock(Memo);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the memoized transactions of the device instance.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only. No memoized block may be in progress.
+*
+******************************************************************************/
+void _XAie_TxnMemoFinish(XAie_DevInst *DevInst)
+{
+	XAie_TxnMemo *Memo = DevInst->TxnMemo;
+
+	if(Memo == NULL) {
+		return;
+	}
+
+	_XAie_TxnMemoRelease(Memo);
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_destroy(&Memo->Lock);
+#endif
+	free(Memo);
+	DevInst->TxnMemo = NULL;
+}
+
+/** @} */
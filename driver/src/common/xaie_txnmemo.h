@@ -0,0 +1,43 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_txnmemo.h
+* @{
+*
+* This file contains the routines for the memoized configuration transactions.
+*
+******************************************************************************/
+#ifndef XAIE_TXNMEMO_H
+#define XAIE_TXNMEMO_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef contains the statistics of the memoized transactions.
+ */
+typedef struct {
+	u64 Hits;	/* Blocks replayed from a recorded transaction */
+	u64 Misses;	/* Blocks executed and recorded */
+	u64 Uncached;	/* Recorded blocks which could not be kept */
+	u32 Entries;	/* Number of recorded transactions held */
+} XAie_TxnMemoStats;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_ConfigTxnMemo(XAie_DevInst *DevInst, u8 Enable);
+u64 XAie_TxnMemoKey(u64 Seed, const void *Args, u64 Size);
+AieRC XAie_TxnMemoBegin(XAie_DevInst *DevInst, u64 Key, u8 *Replayed);
+AieRC XAie_TxnMemoEnd(XAie_DevInst *DevInst, u64 Key);
+AieRC XAie_TxnMemoInvalidate(XAie_DevInst *DevInst, u64 Key);
+AieRC XAie_TxnMemoGetStats(XAie_DevInst *DevInst, XAie_TxnMemoStats *Stats);
+void _XAie_TxnMemoFinish(XAie_DevInst *DevInst);
+
+#endif		/* end of protection macro */
+
+/** @} */
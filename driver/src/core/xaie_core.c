@@ -31,14 +31,38 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+
 #include "xaie_core.h"
 #include "xaie_events.h"
 #include "xaie_feature_config.h"
+#include "xaie_rsc.h"
 
 #ifdef XAIE_FEATURE_CORE_ENABLE
 
 /************************** Constant Definitions *****************************/
 #define XAIETILE_CORE_STATUS_DEF_WAIT_USECS 500U
+#define XAIETILE_CORE_WAITMULTI_SLICE_USECS 100U
+
+#define XAIE_CORE_CTRL_DISABLE		0U
+#define XAIE_CORE_CTRL_ENABLE		1U
+#define XAIE_CORE_CTRL_RESET		2U
+#define XAIE_CORE_CTRL_UNRESET		3U
+
+#define XAIE_CORE_SYNC_ENABLE		0U
+#define XAIE_CORE_SYNC_HALT		1U
+#define XAIE_CORE_SYNC_UNHALT		2U
+
+/*
+ * Typedef to capture the done status register of a core waited on by
+ * XAie_CoreWaitForDoneMulti().
+ */
+typedef struct {
+	u64 Addr;
+	u32 Mask;
+	u32 Value;
+	u8 Done;
+} XAie_CoreWaitStatus;
 
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
@@ -69,7 +93,7 @@ static AieRC _XAie_CoreWaitStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
 	const XAie_CoreMod *CoreMod;
 	u8 TileType;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -125,7 +149,7 @@ AieRC XAie_CoreDisable(XAie_DevInst *DevInst, XAie_LocType Loc)
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -167,7 +191,7 @@ AieRC XAie_CoreEnable(XAie_DevInst *DevInst, XAie_LocType Loc)
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -206,7 +230,7 @@ AieRC XAie_CoreReset(XAie_DevInst *DevInst, XAie_LocType Loc)
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -249,7 +273,7 @@ AieRC XAie_CoreUnreset(XAie_DevInst *DevInst, XAie_LocType Loc)
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -292,7 +316,7 @@ AieRC XAie_CoreWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc, u32 TimeOut)
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -344,6 +368,330 @@ AieRC XAie_CoreWaitForDisable(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return _XAie_CoreWaitStatus(DevInst, Loc, TimeOut, Mask, Value);
 }
 
+/*****************************************************************************/
+/*
+*
+* This API checks that all the locations of an array are AIE tiles.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of tile locations.
+* @param	NumLocs: Number of locations in Locs.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CoreCheckLocs(XAie_DevInst *DevInst,
+		const XAie_LocType *Locs, u32 NumLocs)
+{
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Locs == NULL) || (NumLocs == 0U)) {
+		XAIE_ERROR("Invalid tile location array\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		if(_XAie_DevGetTTypefromLoc(DevInst, Locs[i]) !=
+				XAIEGBL_TILE_TYPE_AIETILE) {
+			XAIE_ERROR("Invalid Tile Type (%d, %d)\n",
+					Locs[i].Col, Locs[i].Row);
+			return XAIE_INVALID_TILE;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/*
+*
+* This API applies one core control operation to an array of AIE tiles. The
+* locations are validated before any register is written and the writes of all
+* the tiles are recorded into one transaction, which is submitted before the
+* API returns unless the calling thread already has a transaction open.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of tile locations.
+* @param	NumLocs: Number of locations in Locs.
+* @param	Op: XAIE_CORE_CTRL_DISABLE, XAIE_CORE_CTRL_ENABLE,
+*		XAIE_CORE_CTRL_RESET or XAIE_CORE_CTRL_UNRESET.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CoreCtrlMulti(XAie_DevInst *DevInst,
+		const XAie_LocType *Locs, u32 NumLocs, u8 Op)
+{
+	AieRC RC;
+	u32 Mask, Value;
+	u8 OwnTxn = XAIE_DISABLE;
+	const XAie_CoreMod *CoreMod;
+
+	RC = _XAie_CoreCheckLocs(DevInst, Locs, NumLocs);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	if((Op == XAIE_CORE_CTRL_RESET) || (Op == XAIE_CORE_CTRL_UNRESET)) {
+		Mask = CoreMod->CoreCtrl->CtrlRst.Mask;
+		Value = (Op == XAIE_CORE_CTRL_RESET ? 1U : 0U) <<
+			CoreMod->CoreCtrl->CtrlRst.Lsb;
+	} else {
+		Mask = CoreMod->CoreCtrl->CtrlEn.Mask;
+		Value = 0U << CoreMod->CoreCtrl->CtrlEn.Lsb;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		if(Op == XAIE_CORE_CTRL_ENABLE) {
+			RC = CoreMod->Enable(DevInst, Locs[i], CoreMod);
+		} else {
+			u64 RegAddr = CoreMod->CoreCtrl->RegOff +
+				_XAie_GetTileAddr(DevInst, Locs[i].Row,
+						Locs[i].Col);
+
+			RC = XAie_MaskWrite32(DevInst, RegAddr, Mask, Value);
+		}
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Core control failed for tile (%d, %d)\n",
+					Locs[i].Col, Locs[i].Row);
+			break;
+		}
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/*
+*
+* This API enables the cores of an array of AIE tiles. All the locations are
+* validated first and the core control writes are sent in one batch.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		If the calling thread has a transaction open, the writes are
+*		recorded into it. Otherwise, none of the cores is enabled if
+*		any location is invalid.
+*
+******************************************************************************/
+AieRC XAie_CoreEnableMulti(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs)
+{
+	return _XAie_CoreCtrlMulti(DevInst, Locs, NumLocs,
+			XAIE_CORE_CTRL_ENABLE);
+}
+
+/*****************************************************************************/
+/*
+*
+* This API disables the cores of an array of AIE tiles. All the locations are
+* validated first and the core control writes are sent in one batch.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		If the calling thread has a transaction open, the writes are
+*		recorded into it.
+*
+******************************************************************************/
+AieRC XAie_CoreDisableMulti(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs)
+{
+	return _XAie_CoreCtrlMulti(DevInst, Locs, NumLocs,
+			XAIE_CORE_CTRL_DISABLE);
+}
+
+/*****************************************************************************/
+/*
+*
+* This API resets the cores of an array of AIE tiles. All the locations are
+* validated first and the core control writes are sent in one batch.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		If the calling thread has a transaction open, the writes are
+*		recorded into it.
+*
+******************************************************************************/
+AieRC XAie_CoreResetMulti(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs)
+{
+	return _XAie_CoreCtrlMulti(DevInst, Locs, NumLocs,
+			XAIE_CORE_CTRL_RESET);
+}
+
+/*****************************************************************************/
+/*
+*
+* This API unresets the cores of an array of AIE tiles. All the locations are
+* validated first and the core control writes are sent in one batch.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		If the calling thread has a transaction open, the writes are
+*		recorded into it.
+*
+******************************************************************************/
+AieRC XAie_CoreUnresetMulti(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs)
+{
+	return _XAie_CoreCtrlMulti(DevInst, Locs, NumLocs,
+			XAIE_CORE_CTRL_UNRESET);
+}
+
+/*****************************************************************************/
+/*
+*
+* This API implements a blocking wait for the cores of an array of AIE tiles
+* to be in done state. The done status of all the pending cores is read in one
+* sweep until all of them are done or the timeout elapses.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+* @param	Done: Optional array of NumLocs entries to return XAIE_ENABLE for
+*		the cores found done and XAIE_DISABLE for the others. NULL if
+*		not required.
+* @param	TimeOut: TimeOut in usecs. If set to 0, the default timeout will
+*		be set to 500us. The TimeOut value is for the whole array.
+*
+* @return	XAIE_OK on success, XAIE_CORE_STATUS_TIMEOUT on timeout and
+*		error code on failure.
+*
+* @note		Between two sweeps, the API polls the first pending core for a
+*		short time with the poll strategy of the backend. It cannot be
+*		recorded in a transaction without auto flush, use
+*		XAie_CoreWaitForDone() for each core instead.
+*
+******************************************************************************/
+AieRC XAie_CoreWaitForDoneMulti(XAie_DevInst *DevInst,
+		const XAie_LocType *Locs, u32 NumLocs, u8 *Done, u32 TimeOut)
+{
+	AieRC RC;
+	u32 NumDone = 0U, Pending = 0U;
+	u64 ElapsedUs = 0U;
+	const XAie_CoreMod *CoreMod;
+	XAie_CoreWaitStatus *Status;
+
+	RC = _XAie_CoreCheckLocs(DevInst, Locs, NumLocs);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Status = (XAie_CoreWaitStatus *)malloc(sizeof(*Status) * NumLocs);
+	if(Status == NULL) {
+		XAIE_ERROR("Memory allocation for core status failed\n");
+		return XAIE_ERR;
+	}
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	for(u32 i = 0U; i < NumLocs; i++) {
+		CoreMod->DoneStatus(DevInst, Locs[i], CoreMod, &Status[i].Addr,
+				&Status[i].Mask, &Status[i].Value);
+		Status[i].Done = 0U;
+	}
+
+	if(TimeOut == 0U) {
+		TimeOut = XAIETILE_CORE_STATUS_DEF_WAIT_USECS;
+	}
+
+	while(1) {
+		for(u32 i = Pending; i < NumLocs; i++) {
+			u32 RegVal;
+
+			if(Status[i].Done != 0U) {
+				continue;
+			}
+
+			RC = XAie_Read32(DevInst, Status[i].Addr, &RegVal);
+			if(RC != XAIE_OK) {
+				break;
+			}
+
+			if((RegVal & Status[i].Mask) == Status[i].Value) {
+				Status[i].Done = 1U;
+				NumDone++;
+			}
+		}
+
+		if((RC != XAIE_OK) || (NumDone == NumLocs)) {
+			break;
+		}
+
+		if(ElapsedUs >= TimeOut) {
+			XAIE_DBG("Status poll time out\n");
+			RC = XAIE_CORE_STATUS_TIMEOUT;
+			break;
+		}
+
+		while(Status[Pending].Done != 0U) {
+			Pending++;
+		}
+
+		/* Only the slices which time out are accounted */
+		if(XAie_MaskPoll(DevInst, Status[Pending].Addr,
+					Status[Pending].Mask, Status[Pending].Value,
+					XAIETILE_CORE_WAITMULTI_SLICE_USECS) !=
+				XAIE_OK) {
+			ElapsedUs += XAIETILE_CORE_WAITMULTI_SLICE_USECS;
+		}
+	}
+
+	if(Done != NULL) {
+		for(u32 i = 0U; i < NumLocs; i++) {
+			Done[i] = Status[i].Done ? XAIE_ENABLE : XAIE_DISABLE;
+		}
+	}
+
+	free(Status);
+	return RC;
+}
+
 /*****************************************************************************/
 /*
 *
@@ -371,7 +719,7 @@ static AieRC _XAie_CoreDebugCtrlHalt(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -451,7 +799,7 @@ AieRC XAie_CoreGetDebugHaltStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -504,7 +852,7 @@ AieRC XAie_CoreGetPCValue(XAie_DevInst *DevInst, XAie_LocType Loc, u32 *PCValue)
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -543,7 +891,7 @@ AieRC XAie_CoreReadDoneBit(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -588,7 +936,7 @@ AieRC XAie_CoreConfigDebugControl1(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -671,7 +1019,7 @@ AieRC XAie_CoreClearDebugControl1(XAie_DevInst *DevInst, XAie_LocType Loc)
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -715,7 +1063,7 @@ AieRC XAie_CoreConfigureEnableEvent(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -747,6 +1095,415 @@ AieRC XAie_CoreConfigureEnableEvent(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAie_MaskWrite32(DevInst, RegAddr, Mask, Value);
 }
 
+#ifdef XAIE_FEATURE_RSC_ENABLE
+/*****************************************************************************/
+/*
+*
+* This API maps an event of the core module of AIE tiles to its hardware
+* event number.
+*
+* @param	DevInst: Device Instance
+* @param	Event: Core module event.
+* @param	MappedEvent: Pointer to return the hardware event number.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CoreMapEvent(XAie_DevInst *DevInst, XAie_Events Event,
+		u8 *MappedEvent)
+{
+	const XAie_EvntMod *EvntMod;
+
+	EvntMod = &DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].EvntMod[
+		XAIE_CORE_MOD];
+	if(Event < EvntMod->EventMin || Event > EvntMod->EventMax) {
+		XAIE_ERROR("Invalid event ID\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	*MappedEvent = EvntMod->XAie_EventNumber[Event - EvntMod->EventMin];
+	if(*MappedEvent == XAIE_EVENT_INVALID) {
+		XAIE_ERROR("Invalid event ID\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/*
+*
+* This API records the register writes of a synchronized start: the enable
+* event of all the cores is set to the broadcast channel, a user event of the
+* shim tile is broadcast and generated on the channel, and then the shim
+* broadcast and the enable event of the cores are cleared again.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+* @param	ShimLoc: Location of the shim tile to generate the event from.
+* @param	UserEvent: User event of the shim tile.
+* @param	BcId: Broadcast channel.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CoreSyncEnableCfg(XAie_DevInst *DevInst,
+		const XAie_LocType *Locs, u32 NumLocs, XAie_LocType ShimLoc,
+		XAie_Events UserEvent, u8 BcId)
+{
+	AieRC RC;
+	u8 StartEvent, NoEvent;
+	const XAie_CoreMod *CoreMod;
+
+	RC = _XAie_CoreMapEvent(DevInst, XAIE_EVENT_BROADCAST_0_CORE + BcId,
+			&StartEvent);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_CoreMapEvent(DevInst, XAIE_EVENT_NONE_CORE, &NoEvent);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	for(u32 i = 0U; i < NumLocs; i++) {
+		u64 RegAddr = CoreMod->CoreEvent->EnableEventOff +
+			_XAie_GetTileAddr(DevInst, Locs[i].Row, Locs[i].Col);
+		u32 Mask = CoreMod->CoreEvent->EnableEvent.Mask |
+			CoreMod->CoreEvent->DisableEventOccurred.Mask |
+			CoreMod->CoreEvent->EnableEventOccurred.Mask;
+
+		u32 Value = (u32)StartEvent <<
+			CoreMod->CoreEvent->EnableEvent.Lsb;
+
+		RC = XAie_MaskWrite32(DevInst, RegAddr, Mask, Value);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	RC = XAie_EventBroadcast(DevInst, ShimLoc, XAIE_PL_MOD, BcId,
+			UserEvent);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_EventGenerate(DevInst, ShimLoc, XAIE_PL_MOD, UserEvent);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_EventBroadcastReset(DevInst, ShimLoc, XAIE_PL_MOD, BcId);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	/* Only the enable event is cleared, the occurred bits track done */
+	for(u32 i = 0U; i < NumLocs; i++) {
+		u64 RegAddr = CoreMod->CoreEvent->EnableEventOff +
+			_XAie_GetTileAddr(DevInst, Locs[i].Row, Locs[i].Col);
+
+		u32 Value = (u32)NoEvent << CoreMod->CoreEvent->EnableEvent.Lsb;
+
+		RC = XAie_MaskWrite32(DevInst, RegAddr,
+				CoreMod->CoreEvent->EnableEvent.Mask, Value);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/*
+*
+* This API records the register writes of a synchronized debug halt or resume:
+* the halt event 0 or the resume event of the debug control1 register of all
+* the cores is set to the broadcast channel, a user event of the shim tile is
+* broadcast and generated on the channel, and then the shim broadcast and the
+* debug control1 register of the cores are cleared again.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+* @param	ShimLoc: Location of the shim tile to generate the event from.
+* @param	UserEvent: User event of the shim tile.
+* @param	BcId: Broadcast channel.
+* @param	Halt: XAIE_ENABLE to halt the cores, XAIE_DISABLE to resume.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. The halt state of the cores is held by the
+*		debug unit, so clearing the halt event does not resume them.
+*
+******************************************************************************/
+static AieRC _XAie_CoreSyncDebugCfg(XAie_DevInst *DevInst,
+		const XAie_LocType *Locs, u32 NumLocs, XAie_LocType ShimLoc,
+		XAie_Events UserEvent, u8 BcId, u8 Halt)
+{
+	AieRC RC;
+	XAie_Events BcEvent, HaltEvent, ResumeEvent;
+
+	BcEvent = (XAie_Events)(XAIE_EVENT_BROADCAST_0_CORE + BcId);
+	HaltEvent = (Halt == XAIE_ENABLE) ? BcEvent : XAIE_EVENT_NONE_CORE;
+	ResumeEvent = (Halt == XAIE_ENABLE) ? XAIE_EVENT_NONE_CORE : BcEvent;
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		RC = XAie_CoreConfigDebugControl1(DevInst, Locs[i], HaltEvent,
+				XAIE_EVENT_NONE_CORE, XAIE_EVENT_NONE_CORE,
+				ResumeEvent);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	RC = XAie_EventBroadcast(DevInst, ShimLoc, XAIE_PL_MOD, BcId,
+			UserEvent);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_EventGenerate(DevInst, ShimLoc, XAIE_PL_MOD, UserEvent);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_EventBroadcastReset(DevInst, ShimLoc, XAIE_PL_MOD, BcId);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		RC = XAie_CoreClearDebugControl1(DevInst, Locs[i]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/*
+*
+* This API reserves a broadcast channel free in the whole partition and a user
+* event of the shim tile through the resource manager, records the register
+* writes of a synchronized operation of the cores on them and releases the
+* channel and the user event.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+* @param	ShimLoc: Location of the shim tile to generate the event from.
+* @param	Op: XAIE_CORE_SYNC_ENABLE, XAIE_CORE_SYNC_HALT or
+*		XAIE_CORE_SYNC_UNHALT.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CoreSyncRun(XAie_DevInst *DevInst,
+		const XAie_LocType *Locs, u32 NumLocs, XAie_LocType ShimLoc,
+		u8 Op)
+{
+	AieRC RC, RelRC;
+	u8 TileType, OwnTxn = XAIE_DISABLE;
+	u32 NumBcRscs;
+	XAie_UserRscReq EvntReq = {ShimLoc, XAIE_PL_MOD, 1U};
+	XAie_UserRsc EvntRsc;
+	XAie_UserRsc *BcRscs;
+
+	RC = _XAie_CoreCheckLocs(DevInst, Locs, NumLocs);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, ShimLoc);
+	if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
+			(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	/* Enough entries for the core and memory modules of every tile */
+	NumBcRscs = 2U * DevInst->NumCols * DevInst->NumRows;
+	BcRscs = (XAie_UserRsc *)malloc(NumBcRscs * sizeof(*BcRscs));
+	if(BcRscs == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	RC = XAie_RequestBroadcastChannel(DevInst, &NumBcRscs, BcRscs,
+			XAIE_ENABLE);
+	if(RC != XAIE_OK) {
+		free(BcRscs);
+		return RC;
+	}
+
+	if(NumBcRscs == 0U) {
+		XAIE_ERROR("No tile is requested in the partition\n");
+		free(BcRscs);
+		return XAIE_ERR;
+	}
+
+	RC = XAie_RequestUserEvents(DevInst, 1U, &EvntReq, 1U, &EvntRsc);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to reserve user event for core sync\n");
+		XAie_ReleaseBroadcastChannel(DevInst, NumBcRscs, BcRscs);
+		free(BcRscs);
+		return RC;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC == XAIE_OK) {
+			OwnTxn = XAIE_ENABLE;
+		}
+	}
+
+	if(RC == XAIE_OK) {
+		if(Op == XAIE_CORE_SYNC_ENABLE) {
+			RC = _XAie_CoreSyncEnableCfg(DevInst, Locs, NumLocs,
+					ShimLoc, (XAie_Events)EvntRsc.RscId,
+					(u8)BcRscs[0].RscId);
+		} else {
+			RC = _XAie_CoreSyncDebugCfg(DevInst, Locs, NumLocs,
+					ShimLoc, (XAie_Events)EvntRsc.RscId,
+					(u8)BcRscs[0].RscId,
+					(Op == XAIE_CORE_SYNC_HALT) ?
+					XAIE_ENABLE : XAIE_DISABLE);
+		}
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	RelRC = XAie_ReleaseUserEvents(DevInst, 1U, &EvntRsc);
+	if(XAie_ReleaseBroadcastChannel(DevInst, NumBcRscs, BcRscs) !=
+			XAIE_OK) {
+		RelRC = XAIE_ERR;
+	}
+	free(BcRscs);
+
+	if(RC == XAIE_OK) {
+		RC = RelRC;
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/*
+*
+* This API enables the cores of an array of AIE tiles at the same time. A
+* broadcast channel free in the whole partition and a user event of the shim
+* tile are reserved through the resource manager, the cores are set to be
+* enabled by the broadcast event and the user event is broadcast and
+* generated from the shim tile. The channel and the user event are released
+* before the API returns.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+* @param	ShimLoc: Location of the shim tile to generate the start event
+*		from.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		All the cores see the start event within the broadcast
+*		latency of each other, independently of the number of cores. The
+*		resource requests are backend operations, so the API cannot be
+*		called once commands are recorded in a transaction without
+*		auto flush; otherwise the register writes are sent in one
+*		transaction.
+*
+******************************************************************************/
+AieRC XAie_CoreSyncEnable(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs, XAie_LocType ShimLoc)
+{
+	return _XAie_CoreSyncRun(DevInst, Locs, NumLocs, ShimLoc,
+			XAIE_CORE_SYNC_ENABLE);
+}
+
+/*****************************************************************************/
+/*
+*
+* This API halts the cores of an array of AIE tiles at the same time. The halt
+* event 0 of the debug control1 register of the cores is set to a broadcast
+* channel free in the whole partition, and a user event of the shim tile is
+* broadcast and generated once on the channel. The debug control1 register of
+* the cores is cleared and the channel and the user event are released before
+* the API returns.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+* @param	ShimLoc: Location of the shim tile to generate the halt event
+*		from.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		All the cores halt within the broadcast latency of each other,
+*		independently of the number of cores. The halt is reported by
+*		the event 0 halt bit of XAie_CoreGetDebugHaltStatus(). The
+*		cores are resumed with XAie_CoreSyncDebugUnhalt(). The same
+*		restrictions on transactions as XAie_CoreSyncEnable() apply.
+*
+******************************************************************************/
+AieRC XAie_CoreSyncDebugHalt(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs, XAie_LocType ShimLoc)
+{
+	return _XAie_CoreSyncRun(DevInst, Locs, NumLocs, ShimLoc,
+			XAIE_CORE_SYNC_HALT);
+}
+
+/*****************************************************************************/
+/*
+*
+* This API resumes the cores of an array of AIE tiles at the same time after
+* XAie_CoreSyncDebugHalt(). The resume event of the debug control1 register of
+* the cores is set to a broadcast channel free in the whole partition, and a
+* user event of the shim tile is broadcast and generated once on the channel.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+* @param	ShimLoc: Location of the shim tile to generate the resume event
+*		from.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Cores halted with XAie_CoreDebugHalt() also have the halt bit
+*		of the debug control0 register set and must be released with
+*		XAie_CoreDebugUnhalt() instead.
+*
+******************************************************************************/
+AieRC XAie_CoreSyncDebugUnhalt(XAie_DevInst *DevInst,
+		const XAie_LocType *Locs, u32 NumLocs, XAie_LocType ShimLoc)
+{
+	return _XAie_CoreSyncRun(DevInst, Locs, NumLocs, ShimLoc,
+			XAIE_CORE_SYNC_UNHALT);
+}
+#endif /* XAIE_FEATURE_RSC_ENABLE */
+
 /*****************************************************************************/
 /*
 *
@@ -773,7 +1530,7 @@ AieRC XAie_CoreConfigureDone(XAie_DevInst *DevInst, XAie_LocType Loc)
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -811,7 +1568,7 @@ AieRC XAie_ClearCoreDisableEventOccurred(XAie_DevInst *DevInst,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -859,7 +1616,7 @@ AieRC XAie_CoreConfigAccumulatorControl(XAie_DevInst *DevInst,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -928,7 +1685,7 @@ static AieRC _XAie_CoreProcessorBusConfig(XAie_DevInst *DevInst,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
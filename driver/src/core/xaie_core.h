@@ -89,6 +89,22 @@ AieRC XAie_ClearCoreDisableEventOccurred(XAie_DevInst *DevInst,
 		XAie_LocType Loc);
 AieRC XAie_CoreProcessorBusEnable(XAie_DevInst *DevInst, XAie_LocType Loc);
 AieRC XAie_CoreProcessorBusDisable(XAie_DevInst *DevInst, XAie_LocType Loc);
+AieRC XAie_CoreEnableMulti(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs);
+AieRC XAie_CoreDisableMulti(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs);
+AieRC XAie_CoreResetMulti(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs);
+AieRC XAie_CoreUnresetMulti(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs);
+AieRC XAie_CoreWaitForDoneMulti(XAie_DevInst *DevInst,
+		const XAie_LocType *Locs, u32 NumLocs, u8 *Done, u32 TimeOut);
+AieRC XAie_CoreSyncEnable(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs, XAie_LocType ShimLoc);
+AieRC XAie_CoreSyncDebugHalt(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs, XAie_LocType ShimLoc);
+AieRC XAie_CoreSyncDebugUnhalt(XAie_DevInst *DevInst,
+		const XAie_LocType *Locs, u32 NumLocs, XAie_LocType ShimLoc);
 
 #endif		/* end of protection macro */
 /** @} */
@@ -27,7 +27,7 @@
 #include "xaie_events_aie.h"
 #include "xaie_feature_config.h"
 
-#ifdef XAIE_FEATURE_CORE_ENABLE
+#if defined(XAIE_FEATURE_CORE_ENABLE) && defined(XAIE_DEV_AIE_ENABLE)
 
 /************************** Constant Definitions *****************************/
 
@@ -109,6 +109,35 @@ AieRC _XAie_CoreEnable(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAie_MaskWrite32(DevInst, RegAddr, Mask, Value);
 }
 
+/*****************************************************************************/
+/*
+*
+* This API returns the register, mask and value to poll for the core of an AIE
+* tile to be in done state.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile.
+* @param	CoreMod: Pointer to the core module data structure.
+* @param	Addr: Pointer to return the address of the register to poll.
+* @param	Mask: Pointer to return the mask of the done field.
+* @param	Value: Pointer to return the value of the done field when the
+*		core is done.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_CoreGetDoneStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const struct XAie_CoreMod *CoreMod, u64 *Addr, u32 *Mask,
+		u32 *Value)
+{
+	*Mask = CoreMod->CoreEvent->DisableEventOccurred.Mask;
+	*Value = 1U << CoreMod->CoreEvent->DisableEventOccurred.Lsb;
+	*Addr = CoreMod->CoreEvent->EnableEventOff +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+}
+
 /*****************************************************************************/
 /*
 *
@@ -133,10 +162,8 @@ AieRC _XAie_CoreWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
 	u32 Mask, Value;
 	u64 EventRegAddr;
 
-	Mask = CoreMod->CoreEvent->DisableEventOccurred.Mask;
-	Value = 1U << CoreMod->CoreEvent->DisableEventOccurred.Lsb;
-	EventRegAddr = CoreMod->CoreEvent->EnableEventOff +
-		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	_XAie_CoreGetDoneStatus(DevInst, Loc, CoreMod, &EventRegAddr, &Mask,
+			&Value);
 
 	if(XAie_MaskPoll(DevInst, EventRegAddr, Mask, Value, TimeOut) !=
 			XAIE_OK) {
@@ -186,5 +213,5 @@ AieRC _XAie_CoreReadDoneBit(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAIE_OK;
 }
 
-#endif /* XAIE_FEATURE_CORE_ENABLE */
+#endif /* XAIE_FEATURE_CORE_ENABLE && XAIE_DEV_AIE_ENABLE */
 /** @} */
@@ -24,7 +24,7 @@
 #include "xaie_core_aieml.h"
 #include "xaie_feature_config.h"
 
-#ifdef XAIE_FEATURE_CORE_ENABLE
+#if defined(XAIE_FEATURE_CORE_ENABLE) && defined(XAIE_DEV_AIEML_ENABLE)
 
 /************************** Constant Definitions *****************************/
 
@@ -81,6 +81,35 @@ AieRC _XAieMl_CoreEnable(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAie_MaskWrite32(DevInst, RegAddr, Mask, Value);
 }
 
+/*****************************************************************************/
+/*
+*
+* This API returns the register, mask and value to poll for the core of an AIE
+* tile to be in done state.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile.
+* @param	CoreMod: Pointer to the core module data structure.
+* @param	Addr: Pointer to return the address of the register to poll.
+* @param	Mask: Pointer to return the mask of the done field.
+* @param	Value: Pointer to return the value of the done field when the
+*		core is done.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAieMl_CoreGetDoneStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const struct XAie_CoreMod *CoreMod, u64 *Addr, u32 *Mask,
+		u32 *Value)
+{
+	*Mask = CoreMod->CoreSts->Done.Mask;
+	*Value = 1U << CoreMod->CoreSts->Done.Lsb;
+	*Addr = CoreMod->CoreSts->RegOff +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+}
+
 /*****************************************************************************/
 /*
 *
@@ -105,11 +134,8 @@ AieRC _XAieMl_CoreWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
 	u32 Mask, Value;
 	u64 RegAddr;
 
-	Mask = CoreMod->CoreSts->Done.Mask;
-	Value = 1U << CoreMod->CoreSts->Done.Lsb;
-
-	RegAddr = CoreMod->CoreSts->RegOff +
-		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	_XAieMl_CoreGetDoneStatus(DevInst, Loc, CoreMod, &RegAddr, &Mask,
+			&Value);
 
 	if(XAie_MaskPoll(DevInst, RegAddr, Mask, Value, TimeOut) !=
 			XAIE_OK) {
@@ -156,5 +182,5 @@ AieRC _XAieMl_CoreReadDoneBit(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAIE_OK;
 }
 
-#endif /* XAIE_FEATURE_CORE_ENABLE */
+#endif /* XAIE_FEATURE_CORE_ENABLE && XAIE_DEV_AIEML_ENABLE */
 /** @} */
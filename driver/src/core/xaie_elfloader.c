@@ -32,11 +32,18 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#ifndef __AIEBAREMETAL__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "xaie_elfloader.h"
 #include "xaie_feature_config.h"
 #include "xaie_ecc.h"
 #include "xaie_mem.h"
+#include "xaie_memckpt.h"
 
 #ifdef XAIE_FEATURE_ELF_ENABLE
 /************************** Constant Definitions *****************************/
@@ -120,7 +127,7 @@ static void _XAie_PrintProgSectHdr(const Elf32_Phdr *Phdr)
 * @note		Internal API only.
 *
 *******************************************************************************/
-static AieRC _XAie_GetTargetTileLoc(XAie_DevInst *DevInst, XAie_LocType Loc,
+AieRC _XAie_GetTargetTileLoc(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u32 Addr, XAie_LocType *TgtLoc)
 {
 	u8 CardDir;
@@ -187,7 +194,7 @@ static AieRC _XAie_GetTargetTileLoc(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_ERR;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid tile type for address\n");
 		return XAIE_ERR;
@@ -199,6 +206,132 @@ static AieRC _XAie_GetTargetTileLoc(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This routine adds a tile location to a list of locations unless the list
+* already has it.
+*
+* @param	Locs: List of locations.
+* @param	NumLocs: Pointer to the number of locations in the list.
+* @param	Loc: Location to add.
+*
+* @return	None.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static void _XAie_ElfAddLoc(XAie_LocType *Locs, u32 *NumLocs, XAie_LocType Loc)
+{
+	for(u32 i = 0U; i < *NumLocs; i++) {
+		if((Locs[i].Col == Loc.Col) && (Locs[i].Row == Loc.Row)) {
+			return;
+		}
+	}
+
+	Locs[(*NumLocs)++] = Loc;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine turns ECC On for the data memories written by an elf load, in
+* one pass before any section is written. The perf counters of the loaded
+* cores and of the target tiles are reserved with one resource request, so
+* that turning ECC On for program memory after the load does not need any
+* further request either.
+*
+* @param	DevInst: Device Instance.
+* @param	Tgts: Array of NumLocs + 4 * NumLocs locations. The first NumLocs
+*		entries are the loaded cores, the data memory targets are
+*		filled after them.
+* @param	NumLocs: Number of loaded cores.
+* @param	NumDm: Number of data memory targets after the loaded cores.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfEccOnDataMem(XAie_DevInst *DevInst,
+		const XAie_LocType *Tgts, u32 NumLocs, u32 NumDm)
+{
+	AieRC RC;
+
+	RC = _XAie_EccRequestTiles(DevInst, Tgts, NumLocs + NumDm);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_EccOnTiles(DevInst, Tgts + NumLocs, NumDm, XAIE_ECC_MEM_DM);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to turn ECC On for Data Memory\n");
+		return RC;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine turns ECC On upfront for the data memories written when an elf
+* in memory is loaded to an AIE Tile.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of AIE Tile.
+* @param	ElfMem: Pointer to the Elf contents in memory.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfMemEccOn(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const unsigned char *ElfMem)
+{
+	AieRC RC;
+	u32 NumDm = 0U, AddrMask;
+	XAie_LocType Tgts[5U];
+	const Elf32_Ehdr *Ehdr = (const Elf32_Ehdr *)ElfMem;
+	const XAie_CoreMod *CoreMod;
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	AddrMask = CoreMod->DataMemSize - 1U;
+	Tgts[0U] = Loc;
+
+	for(u32 phnum = 0U; phnum < Ehdr->e_phnum; phnum++) {
+		const Elf32_Phdr *Phdr;
+		u32 Addr, End;
+
+		Phdr = (const Elf32_Phdr*) (ElfMem + sizeof(*Ehdr) +
+			phnum * sizeof(*Phdr));
+		if((Phdr->p_type != PT_LOAD) ||
+				(Phdr->p_paddr < CoreMod->DataMemAddr)) {
+			continue;
+		}
+
+		Addr = Phdr->p_paddr;
+		End = Phdr->p_paddr + Phdr->p_memsz;
+		while((Addr < End) && (NumDm < 4U)) {
+			XAie_LocType TgtLoc;
+
+			RC = _XAie_GetTargetTileLoc(DevInst, Loc, Addr,
+					&TgtLoc);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Failed to get target location for "
+						"p_paddr 0x%x\n", Addr);
+				return RC;
+			}
+
+			_XAie_ElfAddLoc(Tgts + 1U, &NumDm, TgtLoc);
+			Addr = (Addr & ~AddrMask) + CoreMod->DataMemSize;
+		}
+	}
+
+	return _XAie_ElfEccOnDataMem(DevInst, Tgts, 1U, NumDm);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -248,7 +381,7 @@ static AieRC _XAie_WriteProgramSection(XAie_DevInst *DevInst, XAie_LocType Loc,
 		 * memory out of Progsec will not result in a segmentation
 		 * fault.
 		 */
-		RC = XAie_BlockWrite32(DevInst, Addr, (u32 *)ProgSec,
+		RC = _XAie_BlockWrite32User(DevInst, Addr, (u32 *)ProgSec,
 				(Phdr->p_memsz + 4U - 1U) / 4U);
 
 		return RC;
@@ -314,7 +447,6 @@ static AieRC _XAie_WriteProgramSection(XAie_DevInst *DevInst, XAie_LocType Loc,
 	SectionAddr = Phdr->p_paddr + Phdr->p_filesz;
 	while(SectionSize > 0U) {
 
-		void *TempSrc;
 
 		RC = _XAie_GetTargetTileLoc(DevInst, Loc, SectionAddr, &TgtLoc);
 		if(RC != XAIE_OK) {
@@ -344,17 +476,8 @@ static AieRC _XAie_WriteProgramSection(XAie_DevInst *DevInst, XAie_LocType Loc,
 			}
 		}
 
-		/* Allocate temporary buffer and set it to 0 */
-		TempSrc = calloc(BytesToWrite, sizeof(char));
-		if(TempSrc == XAIE_NULL) {
-			XAIE_ERROR("Memory allocation failed for temporary "\
-					"buffer\n");
-			return XAIE_ERR;
-		}
-
-		RC = XAie_DataMemBlockWrite(DevInst, TgtLoc, Addr, TempSrc,
+		RC = XAie_DataMemBlockSet(DevInst, TgtLoc, Addr, 0U,
 				BytesToWrite);
-		free(TempSrc);
 		if(RC != XAIE_OK) {
 			XAIE_ERROR("Write to data memory failed for .bss "
 					"section.\n");
@@ -399,7 +522,7 @@ AieRC XAie_LoadElfMem(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -408,6 +531,17 @@ AieRC XAie_LoadElfMem(XAie_DevInst *DevInst, XAie_LocType Loc,
 	Ehdr = (const Elf32_Ehdr *) ElfMem;
 	_XAie_PrintElfHdr(Ehdr);
 
+	/*
+	 * Turn ECC On for all the target data memories upfront, so the writes
+	 * of the sections are not interleaved with the ECC configuration.
+	 */
+	if(DevInst->EccStatus) {
+		RC = _XAie_ElfMemEccOn(DevInst, Loc, ElfMem);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
 	/* For AIE, turn ECC Off before program memory load */
 	if((DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) &&
 			(DevInst->EccStatus == XAIE_ENABLE)) {
@@ -430,7 +564,7 @@ AieRC XAie_LoadElfMem(XAie_DevInst *DevInst, XAie_LocType Loc,
 
 	/* Turn ECC On after program memory load */
 	if(DevInst->EccStatus) {
-		RC = _XAie_EccOnPM(DevInst, Loc);
+		RC = _XAie_EccOnTiles(DevInst, &Loc, 1U, XAIE_ECC_MEM_PM);
 		if(RC != XAIE_OK) {
 			XAIE_ERROR("Unable to turn ECC On for Program Memory\n");
 			return RC;
@@ -495,6 +629,173 @@ static AieRC XAieSim_GetStackRange(const char *MapPtr,
 }
 #endif
 
+#ifndef __AIEBAREMETAL__
+/*****************************************************************************/
+/**
+*
+* This routine maps an entire elf file read-only into memory. The sections are
+* written to the device directly from the mapping, so the elf contents are
+* never copied into a heap buffer.
+*
+* @param	ElfPtr: Path to the elf file.
+* @param	ElfMemPtr: Pointer to return the mapping of the elf contents.
+* @param	ElfSzPtr: Pointer to return the size of the mapping.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		The mapping has to be released with _XAie_UnmapElfFile().
+*		Internal API only.
+*
+*******************************************************************************/
+AieRC _XAie_MapElfFile(const char *ElfPtr,
+		const unsigned char **ElfMemPtr, u64 *ElfSzPtr)
+{
+	struct stat Stat;
+	void *ElfMem;
+	int Fd;
+
+	Fd = open(ElfPtr, O_RDONLY);
+	if(Fd < 0) {
+		XAIE_ERROR("Unable to open elf file, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_INVALID_ELF;
+	}
+
+	if(fstat(Fd, &Stat) < 0) {
+		XAIE_ERROR("Failed to get size of elf file, %d: %s\n",
+			errno, strerror(errno));
+		close(Fd);
+		return XAIE_INVALID_ELF;
+	}
+
+	if(Stat.st_size == 0) {
+		XAIE_ERROR("Elf file is empty\n");
+		close(Fd);
+		return XAIE_INVALID_ELF;
+	}
+
+	XAIE_DBG("Elf size is %ld bytes\n", (long)Stat.st_size);
+
+	ElfMem = mmap(NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, Fd,
+			0);
+	close(Fd);
+	if(ElfMem == MAP_FAILED) {
+		XAIE_ERROR("Failed to map elf into memory, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_ERR;
+	}
+
+	*ElfMemPtr = (const unsigned char *)ElfMem;
+	*ElfSzPtr = (u64)Stat.st_size;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine releases the mapping of an elf file.
+*
+* @param	ElfMem: Mapping returned by _XAie_MapElfFile().
+* @param	ElfSz: Size returned by _XAie_MapElfFile().
+*
+* @return	None.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+void _XAie_UnmapElfFile(const unsigned char *ElfMem, u64 ElfSz)
+{
+	munmap((void *)ElfMem, (size_t)ElfSz);
+}
+#else
+/*****************************************************************************/
+/**
+*
+* This routine reads an entire elf file into memory.
+*
+* @param	ElfPtr: Path to the elf file.
+* @param	ElfMemPtr: Pointer to return the allocated buffer with the elf
+*		contents.
+* @param	ElfSzPtr: Pointer to return the size of the buffer.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		The buffer has to be released with _XAie_UnmapElfFile().
+*		Internal API only.
+*
+*******************************************************************************/
+AieRC _XAie_MapElfFile(const char *ElfPtr,
+		const unsigned char **ElfMemPtr, u64 *ElfSzPtr)
+{
+	FILE *Fd;
+	int Ret;
+	unsigned char *ElfMem;
+	u64 ElfSz;
+
+	Fd = fopen(ElfPtr, "r");
+	if(Fd == XAIE_NULL) {
+		XAIE_ERROR("Unable to open elf file, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_INVALID_ELF;
+	}
+
+	/* Get the file size of the elf */
+	Ret = fseek(Fd, 0L, SEEK_END);
+	if(Ret != 0U) {
+		XAIE_ERROR("Failed to get end of file, %d: %s\n",
+			errno, strerror(errno));
+		fclose(Fd);
+		return XAIE_INVALID_ELF;
+	}
+
+	ElfSz = ftell(Fd);
+	rewind(Fd);
+	XAIE_DBG("Elf size is %ld bytes\n", ElfSz);
+
+	/* Read entire elf file into memory */
+	ElfMem = (unsigned char*) malloc(ElfSz);
+	if(ElfMem == NULL) {
+		fclose(Fd);
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	Ret = fread((void*)ElfMem, ElfSz, 1U, Fd);
+	if(Ret == 0U) {
+		fclose(Fd);
+		free(ElfMem);
+		XAIE_ERROR("Failed to read Elf into memory\n");
+		return XAIE_ERR;
+	}
+
+	fclose(Fd);
+	*ElfMemPtr = ElfMem;
+	*ElfSzPtr = ElfSz;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine releases the buffer of an elf file.
+*
+* @param	ElfMem: Buffer returned by _XAie_MapElfFile().
+* @param	ElfSz: Size returned by _XAie_MapElfFile().
+*
+* @return	None.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+void _XAie_UnmapElfFile(const unsigned char *ElfMem, u64 ElfSz)
+{
+	(void)ElfSz;
+	free((void *)ElfMem);
+}
+#endif
+
 /*****************************************************************************/
 /**
 *
@@ -515,11 +816,10 @@ static AieRC XAieSim_GetStackRange(const char *MapPtr,
 AieRC XAie_LoadElf(XAie_DevInst *DevInst, XAie_LocType Loc, const char *ElfPtr,
 		u8 LoadSym)
 {
-	FILE *Fd;
-	int Ret;
-	unsigned char *ElfMem;
-	u8 TileType;
+	const unsigned char *ElfMem;
 	u64 ElfSz;
+	u8 TileType;
+	u8 Share;
 	AieRC RC;
 
 	if((DevInst == XAIE_NULL) ||
@@ -528,7 +828,7 @@ AieRC XAie_LoadElf(XAie_DevInst *DevInst, XAie_LocType Loc, const char *ElfPtr,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -586,52 +886,18 @@ AieRC XAie_LoadElf(XAie_DevInst *DevInst, XAie_LocType Loc, const char *ElfPtr,
 	}
 #endif
 	(void)LoadSym;
-	Fd = fopen(ElfPtr, "r");
-	if(Fd == XAIE_NULL) {
-		XAIE_ERROR("Unable to open elf file, %d: %s\n",
-			errno, strerror(errno));
-		return XAIE_INVALID_ELF;
-	}
-
-	/* Get the file size of the elf */
-	Ret = fseek(Fd, 0L, SEEK_END);
-	if(Ret != 0U) {
-		XAIE_ERROR("Failed to get end of file, %d: %s\n",
-			errno, strerror(errno));
-		fclose(Fd);
-		return XAIE_INVALID_ELF;
-	}
-
-	ElfSz = ftell(Fd);
-	rewind(Fd);
-	XAIE_DBG("Elf size is %ld bytes\n", ElfSz);
-
-	/* Read entire elf file into memory */
-	ElfMem = (unsigned char*) malloc(ElfSz);
-	if(ElfMem == NULL) {
-		fclose(Fd);
-		XAIE_ERROR("Memory allocation failed\n");
-		return XAIE_ERR;
-	}
-
-	Ret = fread((void*)ElfMem, ElfSz, 1U, Fd);
-	if(Ret == 0U) {
-		fclose(Fd);
-		free(ElfMem);
-		XAIE_ERROR("Failed to read Elf into memory\n");
-		return XAIE_ERR;
-	}
-
-	fclose(Fd);
-
-	RC = XAie_LoadElfMem(DevInst, Loc, ElfMem);
+	RC = _XAie_MapElfFile(ElfPtr, &ElfMem, &ElfSz);
 	if(RC != XAIE_OK) {
-		free(ElfMem);
 		return RC;
 	}
 
-	free(ElfMem);
-	return XAIE_OK;
+	/* The elf buffer is released before the transaction is submitted */
+	Share = _XAie_TxnSetSharePayloads(DevInst, XAIE_DISABLE);
+	RC = XAie_LoadElfMem(DevInst, Loc, ElfMem);
+	(void)_XAie_TxnSetSharePayloads(DevInst, Share);
+	_XAie_UnmapElfFile(ElfMem, ElfSz);
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -662,7 +928,7 @@ AieRC XAie_LoadElfSection(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -703,7 +969,7 @@ AieRC XAie_LoadElfSectionBlock(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -713,9 +979,1524 @@ AieRC XAie_LoadElfSectionBlock(XAie_DevInst *DevInst, XAie_LocType Loc,
 	Addr = CoreMod->ProgMemHostOffset + TgtAddr +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
-	return XAie_BlockWrite32(DevInst, Addr, (const u32 *)SectionPtr,
+	return _XAie_BlockWrite32User(DevInst, Addr, (const u32 *)SectionPtr,
 			(Size + 4U - 1U) / 4U);
 }
 
+/*****************************************************************************/
+/**
+*
+* This routine splits the program sections of an elf into the segments of an
+* elf image. The sections are validated against the memory map of the device
+* and the data memory sections are split at the data memory boundaries of the
+* tiles.
+*
+* @param	DevInst: Device Instance.
+* @param	Image: Pointer to the elf image.
+* @param	ElfMem: Pointer to the Elf contents in memory.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfImageParse(XAie_DevInst *DevInst, XAie_ElfImage *Image,
+		const unsigned char *ElfMem)
+{
+	u32 MaxSegs = 0U, AddrMask;
+	const Elf32_Ehdr *Ehdr;
+	const Elf32_Phdr *Phdr;
+	const XAie_CoreMod *CoreMod;
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	AddrMask = CoreMod->DataMemSize - 1U;
+	Ehdr = (const Elf32_Ehdr *) ElfMem;
+	_XAie_PrintElfHdr(Ehdr);
+
+	/* Each data section spans at most two more tiles than its length */
+	for(u32 phnum = 0U; phnum < Ehdr->e_phnum; phnum++) {
+		Phdr = (const Elf32_Phdr*) (ElfMem + sizeof(*Ehdr) +
+			phnum * sizeof(*Phdr));
+		if(Phdr->p_type == PT_LOAD) {
+			MaxSegs += 2U * (Phdr->p_memsz / CoreMod->DataMemSize +
+					2U);
+		}
+	}
+
+	Image->Segs = (XAie_ElfImageSeg *)malloc((MaxSegs + 1U) *
+			sizeof(*Image->Segs));
+	if(Image->Segs == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	Image->NumSegs = 0U;
+	for(u32 phnum = 0U; phnum < Ehdr->e_phnum; phnum++) {
+		const unsigned char *SectionPtr;
+		u32 SectionAddr, SectionSize, BytesToWrite;
+
+		Phdr = (const Elf32_Phdr*) (ElfMem + sizeof(*Ehdr) +
+			phnum * sizeof(*Phdr));
+		_XAie_PrintProgSectHdr(Phdr);
+		if(Phdr->p_type != PT_LOAD) {
+			continue;
+		}
+
+		SectionPtr = ElfMem + Phdr->p_offset;
+		if(Phdr->p_paddr < CoreMod->ProgMemSize) {
+			if((Phdr->p_paddr + Phdr->p_memsz) >
+					CoreMod->ProgMemSize) {
+				XAIE_ERROR("Overflow of program memory\n");
+				return XAIE_INVALID_ELF;
+			}
+
+			Image->Segs[Image->NumSegs].Data = SectionPtr;
+			Image->Segs[Image->NumSegs].Addr = Phdr->p_paddr;
+			Image->Segs[Image->NumSegs].Size = Phdr->p_memsz;
+			Image->Segs[Image->NumSegs].Type = XAIE_ELF_SEG_PROG;
+			Image->NumSegs++;
+			continue;
+		}
+
+		if(((Phdr->p_paddr > CoreMod->ProgMemSize) &&
+				(Phdr->p_paddr < CoreMod->DataMemAddr)) ||
+				((Phdr->p_paddr + Phdr->p_memsz) >
+				 (CoreMod->DataMemAddr +
+				  CoreMod->DataMemSize * 4U))) {
+			XAIE_ERROR("Invalid section starting at 0x%x\n",
+					Phdr->p_paddr);
+			return XAIE_INVALID_ELF;
+		}
+
+		/* Initialized part first, then the zero initialized part */
+		SectionAddr = Phdr->p_paddr;
+		SectionSize = Phdr->p_filesz;
+		for(u8 Part = 0U; Part < 2U; Part++) {
+			while(SectionSize > 0U) {
+				XAie_ElfImageSeg *Seg;
+
+				BytesToWrite = CoreMod->DataMemSize -
+					(SectionAddr & AddrMask);
+				if(BytesToWrite > SectionSize) {
+					BytesToWrite = SectionSize;
+				}
+
+				Seg = &Image->Segs[Image->NumSegs];
+				Seg->Addr = SectionAddr;
+				Seg->Size = BytesToWrite;
+				if(Part == 0U) {
+					Seg->Data = SectionPtr;
+					Seg->Type = XAIE_ELF_SEG_DATA;
+					SectionPtr += BytesToWrite;
+				} else {
+					Seg->Data = NULL;
+					Seg->Type = XAIE_ELF_SEG_ZERO;
+				}
+				Image->NumSegs++;
+
+				SectionSize -= BytesToWrite;
+				SectionAddr += BytesToWrite;
+			}
+
+			SectionAddr = Phdr->p_paddr + Phdr->p_filesz;
+			SectionSize = Phdr->p_memsz - Phdr->p_filesz;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates an elf image from an elf in memory. The elf is parsed
+* once and its program sections are split into program memory and data memory
+* segments, so that the image can be loaded to many tiles.
+*
+* @param	DevInst: Device Instance.
+* @param	Image: Pointer to the user allocated elf image.
+* @param	ElfMem: Pointer to the Elf contents in memory.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		The elf contents are not copied. ElfMem must stay valid until
+*		the image is freed with XAie_ElfImageFree().
+*
+*******************************************************************************/
+AieRC XAie_ElfImageCreateMem(XAie_DevInst *DevInst, XAie_ElfImage *Image,
+		const unsigned char *ElfMem)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Image == XAIE_NULL) ||
+			(ElfMem == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Image->ElfMem = NULL;
+	Image->Segs = NULL;
+	Image->ElfSz = 0U;
+	Image->NumSegs = 0U;
+	Image->IsReady = 0U;
+
+	RC = _XAie_ElfImageParse(DevInst, Image, ElfMem);
+	if(RC != XAIE_OK) {
+		free(Image->Segs);
+		Image->Segs = NULL;
+		return RC;
+	}
+
+	Image->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates an elf image from an elf file. The file is read and
+* parsed once, so that the image can be loaded to many tiles.
+*
+* @param	DevInst: Device Instance.
+* @param	Image: Pointer to the user allocated elf image.
+* @param	ElfPtr: Path to the elf file.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		The elf file is mapped read-only on hosted builds and the
+*		segments of the image point into the mapping. The image has to
+*		be freed with XAie_ElfImageFree().
+*
+*******************************************************************************/
+AieRC XAie_ElfImageCreate(XAie_DevInst *DevInst, XAie_ElfImage *Image,
+		const char *ElfPtr)
+{
+	AieRC RC;
+	const unsigned char *ElfMem;
+	u64 ElfSz;
+
+	if((DevInst == XAIE_NULL) || (Image == XAIE_NULL) ||
+			(ElfPtr == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_MapElfFile(ElfPtr, &ElfMem, &ElfSz);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_ElfImageCreateMem(DevInst, Image, ElfMem);
+	if(RC != XAIE_OK) {
+		_XAie_UnmapElfFile(ElfMem, ElfSz);
+		return RC;
+	}
+
+	Image->ElfMem = ElfMem;
+	Image->ElfSz = ElfSz;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine writes a range of one segment of an elf image to an AIE Tile.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the AIE Tile.
+* @param	Seg: Segment to write.
+* @param	Offset: Offset of the range from the start of the segment. It
+*		has to be word aligned for program memory segments.
+* @param	Size: Size of the range in bytes.
+* @param	Shared: XAIE_ENABLE to reference the contents of the segment
+*		from the transaction of the calling thread instead of copying
+*		them, XAIE_DISABLE otherwise.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only. ECC has to be turned On for the target data
+*		memory with _XAie_ElfImageEccOn() beforehand.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfImageWriteSeg(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_ElfImageSeg *Seg, u32 Offset, u32 Size, u8 Shared)
+{
+	AieRC RC;
+	u32 Addr = Seg->Addr + Offset, DmAddr;
+	u64 RegAddr;
+	XAie_LocType TgtLoc;
+	const XAie_CoreMod *CoreMod;
+	const XAie_MemMod *MemMod;
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	MemMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].MemMod;
+
+	if(Seg->Type == XAIE_ELF_SEG_PROG) {
+		RegAddr = CoreMod->ProgMemHostOffset + Addr +
+			_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+		if(Shared == XAIE_ENABLE) {
+			return XAie_BlockWrite32Shared(DevInst, RegAddr,
+					(const u32 *)(Seg->Data + Offset),
+					(Size + 4U - 1U) / 4U);
+		}
+
+		return XAie_BlockWrite32(DevInst, RegAddr,
+				(const u32 *)(Seg->Data + Offset),
+				(Size + 4U - 1U) / 4U);
+	}
+
+	RC = _XAie_GetTargetTileLoc(DevInst, Loc, Addr, &TgtLoc);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to get target location for p_paddr 0x%x\n",
+				Addr);
+		return RC;
+	}
+
+	/* Word aligned data needs no read-modify-write, share it as is */
+	DmAddr = Addr & (CoreMod->DataMemSize - 1U);
+	if((Shared == XAIE_ENABLE) && (Seg->Type == XAIE_ELF_SEG_DATA) &&
+			((DmAddr & XAIE_MEM_WORD_ALIGN_MASK) == 0U) &&
+			((Size & XAIE_MEM_WORD_ALIGN_MASK) == 0U)) {
+		RegAddr = MemMod->MemAddr + DmAddr +
+			_XAie_GetTileAddr(DevInst, TgtLoc.Row, TgtLoc.Col);
+		RC = XAie_BlockWrite32Shared(DevInst, RegAddr,
+				(const u32 *)(Seg->Data + Offset),
+				Size / XAIE_MEM_WORD_ALIGN_SIZE);
+		if(RC == XAIE_OK) {
+			_XAie_MemCkptMark(DevInst, TgtLoc, DmAddr, Size);
+		}
+	} else if(Seg->Type == XAIE_ELF_SEG_DATA) {
+		RC = XAie_DataMemBlockWrite(DevInst, TgtLoc, DmAddr,
+				Seg->Data + Offset, Size);
+	} else {
+		RC = XAie_DataMemBlockSet(DevInst, TgtLoc, DmAddr, 0U, Size);
+	}
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Write to data memory failed\n");
+		return RC;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine turns ECC On upfront for the data memories written when an elf
+* image is loaded to a list of AIE Tiles.
+*
+* @param	DevInst: Device Instance.
+* @param	Image: Pointer to the elf image.
+* @param	Locs: Array of the locations of the AIE Tiles.
+* @param	NumLocs: Number of locations in Locs.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfImageEccOn(XAie_DevInst *DevInst,
+		const XAie_ElfImage *Image, const XAie_LocType *Locs,
+		u32 NumLocs)
+{
+	AieRC RC = XAIE_OK;
+	u32 NumDm = 0U;
+	XAie_LocType *Tgts;
+
+	Tgts = (XAie_LocType *)malloc(NumLocs * 5U * sizeof(*Tgts));
+	if(Tgts == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	memcpy((void *)Tgts, (const void *)Locs, NumLocs * sizeof(*Tgts));
+	for(u32 i = 0U; (i < NumLocs) && (RC == XAIE_OK); i++) {
+		for(u32 s = 0U; s < Image->NumSegs; s++) {
+			const XAie_ElfImageSeg *Seg = &Image->Segs[s];
+			XAie_LocType TgtLoc;
+
+			if(Seg->Type == XAIE_ELF_SEG_PROG) {
+				continue;
+			}
+
+			RC = _XAie_GetTargetTileLoc(DevInst, Locs[i],
+					Seg->Addr, &TgtLoc);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Failed to get target location for "
+						"p_paddr 0x%x\n", Seg->Addr);
+				break;
+			}
+
+			_XAie_ElfAddLoc(Tgts + NumLocs, &NumDm, TgtLoc);
+		}
+	}
+
+	if(RC == XAIE_OK) {
+		RC = _XAie_ElfEccOnDataMem(DevInst, Tgts, NumLocs, NumDm);
+	}
+
+	free(Tgts);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine writes all the segments of an elf image to a list of AIE Tiles.
+*
+* @param	DevInst: Device Instance.
+* @param	Image: Pointer to the elf image.
+* @param	Locs: Array of the locations of the AIE Tiles.
+* @param	NumLocs: Number of locations in Locs.
+* @param	Shared: XAIE_ENABLE to reference the contents of the image
+*		from the transaction of the calling thread instead of copying
+*		them for every tile, XAIE_DISABLE otherwise.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_LoadElfImageTiles(XAie_DevInst *DevInst,
+		const XAie_ElfImage *Image, const XAie_LocType *Locs,
+		u32 NumLocs, u8 Shared)
+{
+	AieRC RC;
+
+	/* Turn ECC On for all the target data memories upfront */
+	if(DevInst->EccStatus) {
+		RC = _XAie_ElfImageEccOn(DevInst, Image, Locs, NumLocs);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		XAie_LocType Loc = Locs[i];
+
+		/* For AIE, turn ECC Off before program memory load */
+		if((DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) &&
+				(DevInst->EccStatus == XAIE_ENABLE)) {
+			_XAie_EccEvntResetPM(DevInst, Loc);
+		}
+
+		for(u32 s = 0U; s < Image->NumSegs; s++) {
+			RC = _XAie_ElfImageWriteSeg(DevInst, Loc,
+					&Image->Segs[s], 0U,
+					Image->Segs[s].Size, Shared);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+	}
+
+	/* Turn ECC On for all the program memories after the load */
+	if(DevInst->EccStatus) {
+		RC = _XAie_EccOnTiles(DevInst, Locs, NumLocs, XAIE_ECC_MEM_PM);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to turn ECC On for Program Memory\n");
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads an elf image to a list of AIE Tiles. The function writes
+* 0 for the unitialized data sections.
+*
+* @param	DevInst: Device Instance.
+* @param	Image: Pointer to the elf image.
+* @param	Locs: Array of the locations of the AIE Tiles.
+* @param	NumLocs: Number of locations in Locs.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		The image is only read by this API. The tiles can be split
+*		between threads which load the same image concurrently, and the
+*		writes of all the tiles can be batched into one transaction by
+*		calling this API within XAie_StartTransaction() and
+*		XAie_SubmitTransaction().
+*
+*******************************************************************************/
+AieRC XAie_LoadElfImage(XAie_DevInst *DevInst, const XAie_ElfImage *Image,
+		const XAie_LocType *Locs, u32 NumLocs)
+{
+	if((DevInst == XAIE_NULL) || (Image == XAIE_NULL) ||
+			(Locs == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Image->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		if(_XAie_DevGetTTypefromLoc(DevInst, Locs[i]) !=
+				XAIEGBL_TILE_TYPE_AIETILE) {
+			XAIE_ERROR("Invalid tile type\n");
+			return XAIE_INVALID_TILE;
+		}
+	}
+
+	return _XAie_LoadElfImageTiles(DevInst, Image, Locs, NumLocs,
+			XAIE_DISABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads the elf from memory to a rectangle of AIE Tiles which
+* run the same kernel. The elf is parsed once and every tile is written from
+* the one source buffer. The writes of all the tiles are batched into one
+* transaction whose block writes reference the elf contents instead of copying
+* them per tile, so the payload is shared by all the tiles, also in the
+* transaction ioctl of the linux kernel backend.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the bottom left AIE Tile of the rectangle.
+* @param	NumCols: Number of columns of the rectangle.
+* @param	NumRows: Number of rows of the rectangle.
+* @param	ElfMem: Pointer to the Elf contents in memory.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		If the calling thread has a transaction open, the writes are
+*		added to it and ElfMem must stay valid until that transaction
+*		is submitted. Otherwise, the function submits its own
+*		transaction before returning. With ECC enabled, the perf
+*		counters for the ECC scrubbing are requested before any write
+*		is recorded, which fails if the open transaction already has
+*		commands and a counter still has to be reserved.
+*
+*******************************************************************************/
+AieRC XAie_LoadElfMemRect(XAie_DevInst *DevInst, XAie_LocType Loc, u8 NumCols,
+		u8 NumRows, const unsigned char *ElfMem)
+{
+	AieRC RC;
+	u8 OwnTxn = XAIE_DISABLE;
+	u32 NumLocs = (u32)NumCols * NumRows;
+	XAie_LocType *Locs;
+	XAie_ElfImage Image;
+
+	if((DevInst == XAIE_NULL) || (ElfMem == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(NumLocs == 0U) ||
+			((u32)Loc.Col + NumCols > DevInst->NumCols) ||
+			((u32)Loc.Row + NumRows > DevInst->NumRows)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Locs = (XAie_LocType *)malloc(NumLocs * sizeof(*Locs));
+	if(Locs == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u8 c = 0U; c < NumCols; c++) {
+		for(u8 r = 0U; r < NumRows; r++) {
+			XAie_LocType *TileLoc = &Locs[c * NumRows + r];
+
+			*TileLoc = XAie_TileLoc(Loc.Col + c, Loc.Row + r);
+			if(_XAie_DevGetTTypefromLoc(DevInst,
+					*TileLoc) != XAIEGBL_TILE_TYPE_AIETILE) {
+				XAIE_ERROR("Invalid tile type\n");
+				free(Locs);
+				return XAIE_INVALID_TILE;
+			}
+		}
+	}
+
+	RC = XAie_ElfImageCreateMem(DevInst, &Image, ElfMem);
+	if(RC != XAIE_OK) {
+		free(Locs);
+		return RC;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	if(RC == XAIE_OK) {
+		RC = _XAie_LoadElfImageTiles(DevInst, &Image, Locs, NumLocs,
+				XAIE_ENABLE);
+		if(OwnTxn == XAIE_ENABLE) {
+			if(RC == XAIE_OK) {
+				RC = _XAie_Txn_Submit(DevInst, NULL);
+			} else {
+				XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+				if(TxnInst != NULL) {
+					_XAie_TxnFree(TxnInst);
+				}
+			}
+		}
+	}
+
+	XAie_ElfImageFree(&Image);
+	free(Locs);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function releases the resources of an elf image.
+*
+* @param	Image: Pointer to the elf image.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_ElfImageFree(XAie_ElfImage *Image)
+{
+	if((Image == XAIE_NULL) || (Image->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(Image->Segs);
+	if(Image->ElfMem != NULL) {
+		_XAie_UnmapElfFile(Image->ElfMem, Image->ElfSz);
+	}
+	Image->Segs = NULL;
+	Image->ElfMem = NULL;
+	Image->ElfSz = 0U;
+	Image->NumSegs = 0U;
+	Image->IsReady = 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine returns the number of chunks which cover the program memory of
+* an AIE Tile.
+*
+* @param	CoreMod: Core module of the AIE Tile.
+*
+* @return	Number of program memory chunks.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static u32 _XAie_ElfNumProgChunks(const XAie_CoreMod *CoreMod)
+{
+	return (CoreMod->ProgMemSize + XAIE_ELF_CHUNK_SIZE - 1U) /
+		XAIE_ELF_CHUNK_SIZE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine maps an address as seen by the core to the chunk which contains
+* it and the address at which that chunk starts. Program memory chunks come
+* first, followed by the chunks of the four data memories the core can reach.
+*
+* @param	CoreMod: Core module of the AIE Tile.
+* @param	Addr: Address as seen by the core.
+* @param	ChunkStart: Pointer to return the start address of the chunk.
+*
+* @return	Index of the chunk.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static u32 _XAie_ElfChunkIdx(const XAie_CoreMod *CoreMod, u32 Addr,
+		u32 *ChunkStart)
+{
+	u32 Base = 0U, FirstIdx = 0U;
+
+	if(Addr >= CoreMod->DataMemAddr) {
+		Base = CoreMod->DataMemAddr;
+		FirstIdx = _XAie_ElfNumProgChunks(CoreMod);
+	}
+
+	*ChunkStart = Base + ((Addr - Base) / XAIE_ELF_CHUNK_SIZE) *
+		XAIE_ELF_CHUNK_SIZE;
+
+	return FirstIdx + (Addr - Base) / XAIE_ELF_CHUNK_SIZE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine folds bytes into a 64-bit FNV-1a hash.
+*
+* @param	Hash: Hash to fold the bytes into.
+* @param	Data: Bytes to fold, NULL for zero bytes.
+* @param	Size: Number of bytes.
+*
+* @return	Updated hash.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static u64 _XAie_ElfHash(u64 Hash, const unsigned char *Data, u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		Hash ^= (Data != NULL) ? Data[i] : 0U;
+		Hash *= 0x100000001B3ULL;
+	}
+
+	return Hash;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine computes the content hash of every chunk covered by an elf
+* image. The hash of a chunk covers the offset, type and contents of every
+* segment part in it. Chunks not covered by the image hash to 0.
+*
+* @param	CoreMod: Core module of the AIE Tile.
+* @param	Image: Elf image.
+* @param	Hash: Array of NumChunks hashes to fill.
+* @param	NumChunks: Number of chunks of an AIE Tile.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfImageHash(const XAie_CoreMod *CoreMod,
+		const XAie_ElfImage *Image, u64 *Hash, u32 NumChunks)
+{
+	memset(Hash, 0, NumChunks * sizeof(*Hash));
+
+	for(u32 s = 0U; s < Image->NumSegs; s++) {
+		const XAie_ElfImageSeg *Seg = &Image->Segs[s];
+		u32 Pos = Seg->Addr, End = Seg->Addr + Seg->Size;
+
+		while(Pos < End) {
+			u32 ChunkStart, Len, Idx;
+			u32 Offset;
+			u8 Type = Seg->Type;
+
+			Idx = _XAie_ElfChunkIdx(CoreMod, Pos, &ChunkStart);
+			if(Idx >= NumChunks) {
+				XAIE_ERROR("Segment at 0x%x is out of range\n",
+						Seg->Addr);
+				return XAIE_INVALID_ELF;
+			}
+
+			Len = ChunkStart + XAIE_ELF_CHUNK_SIZE - Pos;
+			if(Len > End - Pos) {
+				Len = End - Pos;
+			}
+
+			if(Hash[Idx] == 0U) {
+				Hash[Idx] = 0xCBF29CE484222325ULL;
+			}
+			Offset = Pos - ChunkStart;
+			Hash[Idx] = _XAie_ElfHash(Hash[Idx],
+					(const unsigned char *)&Offset,
+					sizeof(Offset));
+			Hash[Idx] = _XAie_ElfHash(Hash[Idx], &Type,
+					sizeof(Type));
+			Hash[Idx] = _XAie_ElfHash(Hash[Idx],
+					(Seg->Data != NULL) ?
+					Seg->Data + (Pos - Seg->Addr) : NULL,
+					Len);
+			/* 0 is reserved for chunks with unknown contents */
+			if(Hash[Idx] == 0U) {
+				Hash[Idx] = 1U;
+			}
+
+			Pos += Len;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine writes the segment parts of an elf image which lie in chunks
+* whose hash differs from the one recorded for the tile. Adjacent differing
+* chunks of a segment are written with one request.
+*
+* @param	DevInst: Device Instance.
+* @param	Image: Elf image.
+* @param	State: Load state of the AIE Tile.
+* @param	Hash: Chunk hashes of the image.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfImageWriteDiff(XAie_DevInst *DevInst,
+		const XAie_ElfImage *Image, const XAie_ElfTileState *State,
+		const u64 *Hash)
+{
+	AieRC RC;
+	const XAie_CoreMod *CoreMod;
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+
+	for(u32 s = 0U; s < Image->NumSegs; s++) {
+		const XAie_ElfImageSeg *Seg = &Image->Segs[s];
+		u32 Pos = Seg->Addr, End = Seg->Addr + Seg->Size;
+		u32 RunStart = 0U, RunLen = 0U;
+
+		while(Pos < End) {
+			u32 ChunkStart, Len, Idx;
+
+			Idx = _XAie_ElfChunkIdx(CoreMod, Pos, &ChunkStart);
+			Len = ChunkStart + XAIE_ELF_CHUNK_SIZE - Pos;
+			if(Len > End - Pos) {
+				Len = End - Pos;
+			}
+
+			if(Hash[Idx] != State->ChunkHash[Idx]) {
+				if(RunLen == 0U) {
+					RunStart = Pos - Seg->Addr;
+				}
+				RunLen += Len;
+			} else if(RunLen != 0U) {
+				RC = _XAie_ElfImageWriteSeg(DevInst, State->Loc,
+						Seg, RunStart, RunLen,
+						XAIE_DISABLE);
+				if(RC != XAIE_OK) {
+					return RC;
+				}
+				RunLen = 0U;
+			}
+
+			Pos += Len;
+		}
+
+		if(RunLen != 0U) {
+			RC = _XAie_ElfImageWriteSeg(DevInst, State->Loc, Seg,
+					RunStart, RunLen, XAIE_DISABLE);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes the load state of an AIE Tile, which records the
+* content hash of every chunk of its program and data memory loaded with
+* XAie_LoadElfImageIncremental(). The contents of all the chunks are unknown
+* initially, so the first incremental load writes the whole image.
+*
+* @param	DevInst: Device Instance.
+* @param	State: Pointer to the user allocated load state.
+* @param	Loc: Location of the AIE Tile.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		The state has to be freed with XAie_ElfTileStateFree().
+*
+*******************************************************************************/
+AieRC XAie_ElfTileStateInit(XAie_DevInst *DevInst, XAie_ElfTileState *State,
+		XAie_LocType Loc)
+{
+	const XAie_CoreMod *CoreMod;
+
+	if((DevInst == XAIE_NULL) || (State == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_DevGetTTypefromLoc(DevInst, Loc) !=
+			XAIEGBL_TILE_TYPE_AIETILE) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+
+	State->NumChunks = _XAie_ElfNumProgChunks(CoreMod) +
+		(CoreMod->DataMemSize * 4U) / XAIE_ELF_CHUNK_SIZE;
+	State->ChunkHash = (u64 *)calloc(State->NumChunks,
+			sizeof(*State->ChunkHash));
+	if(State->ChunkHash == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	State->Loc = Loc;
+	State->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function marks the contents of all the chunks of an AIE Tile as
+* unknown, so that the next incremental load writes the whole image.
+*
+* @param	State: Pointer to the load state.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		This has to be called whenever the memories of the tile are
+*		written by any other means than XAie_LoadElfImageIncremental(),
+*		for example by XAie_LoadElf() or by the application.
+*
+*******************************************************************************/
+AieRC XAie_ElfTileStateReset(XAie_ElfTileState *State)
+{
+	if((State == XAIE_NULL) || (State->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	memset(State->ChunkHash, 0, State->NumChunks *
+			sizeof(*State->ChunkHash));
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function releases the resources of the load state of an AIE Tile.
+*
+* @param	State: Pointer to the load state.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_ElfTileStateFree(XAie_ElfTileState *State)
+{
+	if((State == XAIE_NULL) || (State->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(State->ChunkHash);
+	State->ChunkHash = NULL;
+	State->NumChunks = 0U;
+	State->IsReady = 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads an elf image to a list of AIE Tiles, writing only the
+* parts of the image which differ from what was loaded last on each tile. The
+* memories of a tile are split in chunks of XAIE_ELF_CHUNK_SIZE bytes and the
+* content hash of every chunk of the image is compared against the hash
+* recorded in the load state of the tile. Only the segment parts in chunks
+* which differ are written, and the load state is updated to the image.
+*
+* @param	DevInst: Device Instance.
+* @param	Image: Pointer to the elf image.
+* @param	States: Array of the load states of the AIE Tiles.
+* @param	NumStates: Number of load states in States.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Bytes not covered by any segment of the image are left as they
+*		are, like XAie_LoadElfImage() does. If a write to a tile fails,
+*		its load state is reset so the next load rewrites the image.
+*
+*******************************************************************************/
+AieRC XAie_LoadElfImageIncremental(XAie_DevInst *DevInst,
+		const XAie_ElfImage *Image, XAie_ElfTileState *States,
+		u32 NumStates)
+{
+	AieRC RC = XAIE_OK;
+	u32 NumChunks;
+	u64 *Hash;
+	XAie_LocType *Locs;
+	const XAie_CoreMod *CoreMod;
+
+	if((DevInst == XAIE_NULL) || (Image == XAIE_NULL) ||
+			(States == XAIE_NULL) || (NumStates == 0U) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Image->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	NumChunks = States[0U].NumChunks;
+	for(u32 i = 0U; i < NumStates; i++) {
+		if((States[i].IsReady != XAIE_COMPONENT_IS_READY) ||
+				(States[i].NumChunks != NumChunks)) {
+			XAIE_ERROR("Invalid tile load state\n");
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+
+	Hash = (u64 *)malloc(NumChunks * sizeof(*Hash));
+	if(Hash == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_ElfImageHash(CoreMod, Image, Hash, NumChunks);
+	if(RC != XAIE_OK) {
+		free(Hash);
+		return RC;
+	}
+
+	Locs = (XAie_LocType *)malloc(NumStates * sizeof(*Locs));
+	if(Locs == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		free(Hash);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumStates; i++) {
+		Locs[i] = States[i].Loc;
+	}
+
+	/* Turn ECC On for all the target data memories upfront */
+	if(DevInst->EccStatus) {
+		RC = _XAie_ElfImageEccOn(DevInst, Image, Locs, NumStates);
+	}
+
+	for(u32 i = 0U; (i < NumStates) && (RC == XAIE_OK); i++) {
+		XAie_ElfTileState *State = &States[i];
+
+		/* For AIE, turn ECC Off before program memory load */
+		if((DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) &&
+				(DevInst->EccStatus == XAIE_ENABLE)) {
+			_XAie_EccEvntResetPM(DevInst, State->Loc);
+		}
+
+		RC = _XAie_ElfImageWriteDiff(DevInst, Image, State, Hash);
+		if(RC != XAIE_OK) {
+			memset(State->ChunkHash, 0, NumChunks *
+					sizeof(*State->ChunkHash));
+			break;
+		}
+
+		for(u32 c = 0U; c < NumChunks; c++) {
+			if(Hash[c] != 0U) {
+				State->ChunkHash[c] = Hash[c];
+			}
+		}
+	}
+
+	/* Turn ECC On for all the program memories after the load */
+	if((RC == XAIE_OK) && (DevInst->EccStatus)) {
+		RC = _XAie_EccOnTiles(DevInst, Locs, NumStates,
+				XAIE_ECC_MEM_PM);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to turn ECC On for Program Memory\n");
+		}
+	}
+
+	free(Locs);
+	free(Hash);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine hashes the name of a symbol.
+*
+* @param	Name: Name of the symbol.
+*
+* @return	64-bit FNV-1a hash of the name.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static u64 _XAie_ElfSymHash(const char *Name)
+{
+	return _XAie_ElfHash(0xCBF29CE484222325ULL,
+			(const unsigned char *)Name, (u32)strlen(Name));
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine returns the symbol table of an elf and its string table.
+*
+* @param	ElfMem: Pointer to the Elf contents in memory.
+* @param	Sym: Pointer to return the first entry of the symbol table.
+* @param	NumSyms: Pointer to return the number of entries of the symbol
+*		table.
+* @param	StrTab: Pointer to return the string table of the symbols.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfFindSymTab(const unsigned char *ElfMem,
+		const Elf32_Sym **Sym, u32 *NumSyms, const char **StrTab)
+{
+	const Elf32_Ehdr *Ehdr = (const Elf32_Ehdr *)ElfMem;
+	const Elf32_Shdr *Shdr;
+
+	for(u32 shnum = 0U; shnum < Ehdr->e_shnum; shnum++) {
+		const Elf32_Shdr *StrHdr;
+
+		Shdr = (const Elf32_Shdr *)(ElfMem + Ehdr->e_shoff +
+				shnum * Ehdr->e_shentsize);
+		if((Shdr->sh_type != SHT_SYMTAB) ||
+				(Shdr->sh_link >= Ehdr->e_shnum)) {
+			continue;
+		}
+
+		StrHdr = (const Elf32_Shdr *)(ElfMem + Ehdr->e_shoff +
+				Shdr->sh_link * Ehdr->e_shentsize);
+		*Sym = (const Elf32_Sym *)(ElfMem + Shdr->sh_offset);
+		*NumSyms = Shdr->sh_size / sizeof(Elf32_Sym);
+		*StrTab = (const char *)(ElfMem + StrHdr->sh_offset);
+
+		return XAIE_OK;
+	}
+
+	XAIE_ERROR("Elf has no symbol table\n");
+	return XAIE_INVALID_ELF;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine returns whether an entry of the symbol table is a data memory
+* symbol to keep in a symbol map. These are the named object and untyped
+* symbols whose address is in one of the data memories the core can reach.
+*
+* @param	CoreMod: Core module of the AIE Tile.
+* @param	Sym: Entry of the symbol table.
+* @param	StrTab: String table of the symbols.
+*
+* @return	1 to keep the symbol, 0 otherwise.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static u8 _XAie_ElfIsDataSym(const XAie_CoreMod *CoreMod,
+		const Elf32_Sym *Sym, const char *StrTab)
+{
+	u8 Type = ELF32_ST_TYPE(Sym->st_info);
+
+	if((Sym->st_name == 0U) || (StrTab[Sym->st_name] == '\0') ||
+			(Sym->st_shndx == SHN_UNDEF) ||
+			((Type != STT_OBJECT) && (Type != STT_NOTYPE))) {
+		return 0U;
+	}
+
+	return (Sym->st_value >= CoreMod->DataMemAddr) &&
+		(Sym->st_value < CoreMod->DataMemAddr +
+		 CoreMod->DataMemSize * 4U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates the symbol map of an elf in memory loaded on an AIE
+* Tile. The data memory symbols of the elf are indexed by name, so that they
+* can be accessed with XAie_DataMemWriteSymbol() and XAie_DataMemReadSymbol()
+* instead of hard coded addresses, e.g. for runtime parameters.
+*
+* @param	DevInst: Device Instance.
+* @param	Map: Pointer to the user allocated symbol map.
+* @param	Loc: Location of the AIE Tile the elf is loaded on.
+* @param	ElfMem: Pointer to the Elf contents in memory.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		The symbol names are copied and ElfMem can be released once the
+*		map is created. The map has to be freed with
+*		XAie_ElfSymMapFree().
+*
+*******************************************************************************/
+AieRC XAie_ElfSymMapCreateMem(XAie_DevInst *DevInst, XAie_ElfSymMap *Map,
+		XAie_LocType Loc, const unsigned char *ElfMem)
+{
+	AieRC RC;
+	u8 TileType;
+	u32 NumTabSyms, NumSyms = 0U, NamesSize = 0U, NumBuckets = 1U, Pos = 0U;
+	const Elf32_Sym *TabSyms;
+	const char *StrTab;
+	const XAie_CoreMod *CoreMod;
+
+	if((DevInst == XAIE_NULL) || (Map == XAIE_NULL) ||
+			(ElfMem == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	RC = _XAie_ElfFindSymTab(ElfMem, &TabSyms, &NumTabSyms, &StrTab);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	CoreMod = DevInst->DevProp.DevMod[TileType].CoreMod;
+	for(u32 i = 0U; i < NumTabSyms; i++) {
+		if(_XAie_ElfIsDataSym(CoreMod, &TabSyms[i], StrTab) != 0U) {
+			NumSyms++;
+			NamesSize += (u32)strlen(StrTab + TabSyms[i].st_name) +
+				1U;
+		}
+	}
+
+	/* Keep the buckets at most half full */
+	while(NumBuckets < 2U * NumSyms) {
+		NumBuckets <<= 1U;
+	}
+
+	Map->Syms = (XAie_ElfSym *)malloc((NumSyms + 1U) * sizeof(*Map->Syms));
+	Map->Buckets = (u32 *)malloc(NumBuckets * sizeof(*Map->Buckets));
+	Map->Names = (char *)malloc(NamesSize + 1U);
+	if((Map->Syms == NULL) || (Map->Buckets == NULL) ||
+			(Map->Names == NULL)) {
+		XAIE_ERROR("Memory allocation failed\n");
+		free(Map->Syms);
+		free(Map->Buckets);
+		free(Map->Names);
+		Map->IsReady = 0U;
+		return XAIE_ERR;
+	}
+
+	memset(Map->Buckets, 0xFF, NumBuckets * sizeof(*Map->Buckets));
+	Map->Loc = Loc;
+	Map->NumSyms = 0U;
+	Map->NumBuckets = NumBuckets;
+	for(u32 i = 0U; i < NumTabSyms; i++) {
+		const char *Name = StrTab + TabSyms[i].st_name;
+		XAie_ElfSym *Sym;
+		u32 Len, Bucket;
+
+		if(_XAie_ElfIsDataSym(CoreMod, &TabSyms[i], StrTab) == 0U) {
+			continue;
+		}
+
+		Len = (u32)strlen(Name) + 1U;
+		memcpy(Map->Names + Pos, Name, Len);
+
+		Sym = &Map->Syms[Map->NumSyms];
+		Sym->Name = Map->Names + Pos;
+		Sym->Addr = TabSyms[i].st_value;
+		Sym->Size = TabSyms[i].st_size;
+
+		Bucket = (u32)_XAie_ElfSymHash(Name) & (NumBuckets - 1U);
+		Sym->Next = Map->Buckets[Bucket];
+		Map->Buckets[Bucket] = Map->NumSyms;
+
+		Map->NumSyms++;
+		Pos += Len;
+	}
+
+	XAIE_DBG("Symbol map of %u data memory symbols\n", Map->NumSyms);
+	Map->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates the symbol map of an elf file loaded on an AIE Tile.
+*
+* @param	DevInst: Device Instance.
+* @param	Map: Pointer to the user allocated symbol map.
+* @param	Loc: Location of the AIE Tile the elf is loaded on.
+* @param	ElfPtr: Path to the elf file.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		The elf file is released once the map is created. The map has
+*		to be freed with XAie_ElfSymMapFree().
+*
+*******************************************************************************/
+AieRC XAie_ElfSymMapCreate(XAie_DevInst *DevInst, XAie_ElfSymMap *Map,
+		XAie_LocType Loc, const char *ElfPtr)
+{
+	AieRC RC;
+	const unsigned char *ElfMem;
+	u64 ElfSz;
+
+	if((DevInst == XAIE_NULL) || (Map == XAIE_NULL) ||
+			(ElfPtr == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_MapElfFile(ElfPtr, &ElfMem, &ElfSz);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_ElfSymMapCreateMem(DevInst, Map, Loc, ElfMem);
+	_XAie_UnmapElfFile(ElfMem, ElfSz);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function frees the memory of a symbol map.
+*
+* @param	Map: Pointer to the symbol map.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_ElfSymMapFree(XAie_ElfSymMap *Map)
+{
+	if((Map == XAIE_NULL) || (Map->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(Map->Syms);
+	free(Map->Buckets);
+	free(Map->Names);
+	Map->Syms = NULL;
+	Map->Buckets = NULL;
+	Map->Names = NULL;
+	Map->NumSyms = 0U;
+	Map->NumBuckets = 0U;
+	Map->IsReady = 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function resolves a symbol of a symbol map to the tile which holds it
+* and its address in the data memory of that tile. The handle can then be used
+* with XAie_DataMemWriteSymbolHdl() and XAie_DataMemReadSymbolHdl() to access
+* the symbol with no lookup, e.g. to update runtime parameters every
+* iteration.
+*
+* @param	DevInst: Device Instance.
+* @param	Map: Pointer to the symbol map.
+* @param	Name: Name of the symbol.
+* @param	Hdl: Pointer to return the handle of the symbol.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Symbols which span the data memories of two tiles are not
+*		supported.
+*
+*******************************************************************************/
+AieRC XAie_ElfSymPrepare(XAie_DevInst *DevInst, const XAie_ElfSymMap *Map,
+		const char *Name, XAie_ElfSymHandle *Hdl)
+{
+	AieRC RC;
+	u32 Idx;
+	const XAie_ElfSym *Sym = NULL;
+	const XAie_CoreMod *CoreMod;
+
+	if((DevInst == XAIE_NULL) || (Map == XAIE_NULL) ||
+			(Name == XAIE_NULL) || (Hdl == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Map->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Idx = Map->Buckets[(u32)_XAie_ElfSymHash(Name) &
+		(Map->NumBuckets - 1U)];
+	while(Idx < Map->NumSyms) {
+		if(strcmp(Map->Syms[Idx].Name, Name) == 0) {
+			Sym = &Map->Syms[Idx];
+			break;
+		}
+		Idx = Map->Syms[Idx].Next;
+	}
+
+	if(Sym == NULL) {
+		XAIE_ERROR("Symbol %s not found\n", Name);
+		return XAIE_INVALID_ARGS;
+	}
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	if((Sym->Size != 0U) && ((Sym->Addr / CoreMod->DataMemSize) !=
+			((Sym->Addr + Sym->Size - 1U) / CoreMod->DataMemSize))) {
+		XAIE_ERROR("Symbol %s spans two data memories\n", Name);
+		return XAIE_ERR_OUTOFBOUND;
+	}
+
+	RC = _XAie_GetTargetTileLoc(DevInst, Map->Loc, Sym->Addr, &Hdl->Loc);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Hdl->Addr = Sym->Addr & (CoreMod->DataMemSize - 1U);
+	Hdl->Size = Sym->Size;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes to a symbol resolved with XAie_ElfSymPrepare().
+*
+* @param	DevInst: Device Instance.
+* @param	Hdl: Pointer to the handle of the symbol.
+* @param	Offset: Offset in bytes from the start of the symbol.
+* @param	Src: Source to write data.
+* @param	Size: Size in bytes to write.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		The write has to fit in the size of the symbol.
+*
+*******************************************************************************/
+AieRC XAie_DataMemWriteSymbolHdl(XAie_DevInst *DevInst,
+		const XAie_ElfSymHandle *Hdl, u32 Offset, const void *Src,
+		u32 Size)
+{
+	if(Hdl == XAIE_NULL) {
+		XAIE_ERROR("Invalid symbol handle\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((u64)Offset + Size > Hdl->Size) {
+		XAIE_ERROR("Write overflows the symbol\n");
+		return XAIE_ERR_OUTOFBOUND;
+	}
+
+	return XAie_DataMemBlockWrite(DevInst, Hdl->Loc, Hdl->Addr + Offset,
+			Src, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads from a symbol resolved with XAie_ElfSymPrepare().
+*
+* @param	DevInst: Device Instance.
+* @param	Hdl: Pointer to the handle of the symbol.
+* @param	Offset: Offset in bytes from the start of the symbol.
+* @param	Dst: Destination of the data.
+* @param	Size: Size in bytes to read.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		The read has to fit in the size of the symbol.
+*
+*******************************************************************************/
+AieRC XAie_DataMemReadSymbolHdl(XAie_DevInst *DevInst,
+		const XAie_ElfSymHandle *Hdl, u32 Offset, void *Dst, u32 Size)
+{
+	if(Hdl == XAIE_NULL) {
+		XAIE_ERROR("Invalid symbol handle\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((u64)Offset + Size > Hdl->Size) {
+		XAIE_ERROR("Read overflows the symbol\n");
+		return XAIE_ERR_OUTOFBOUND;
+	}
+
+	return XAie_DataMemBlockRead(DevInst, Hdl->Loc, Hdl->Addr + Offset,
+			Dst, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes to a symbol of an elf loaded on an AIE Tile, looked up
+* by name in its symbol map.
+*
+* @param	DevInst: Device Instance.
+* @param	Map: Pointer to the symbol map of the AIE Tile.
+* @param	Name: Name of the symbol.
+* @param	Offset: Offset in bytes from the start of the symbol.
+* @param	Src: Source to write data.
+* @param	Size: Size in bytes to write.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Symbols written repeatedly should be resolved once with
+*		XAie_ElfSymPrepare() instead.
+*
+*******************************************************************************/
+AieRC XAie_DataMemWriteSymbol(XAie_DevInst *DevInst,
+		const XAie_ElfSymMap *Map, const char *Name, u32 Offset,
+		const void *Src, u32 Size)
+{
+	AieRC RC;
+	XAie_ElfSymHandle Hdl;
+
+	RC = XAie_ElfSymPrepare(DevInst, Map, Name, &Hdl);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	return XAie_DataMemWriteSymbolHdl(DevInst, &Hdl, Offset, Src, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads from a symbol of an elf loaded on an AIE Tile, looked up
+* by name in its symbol map.
+*
+* @param	DevInst: Device Instance.
+* @param	Map: Pointer to the symbol map of the AIE Tile.
+* @param	Name: Name of the symbol.
+* @param	Offset: Offset in bytes from the start of the symbol.
+* @param	Dst: Destination of the data.
+* @param	Size: Size in bytes to read.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_DataMemReadSymbol(XAie_DevInst *DevInst,
+		const XAie_ElfSymMap *Map, const char *Name, u32 Offset,
+		void *Dst, u32 Size)
+{
+	AieRC RC;
+	XAie_ElfSymHandle Hdl;
+
+	RC = XAie_ElfSymPrepare(DevInst, Map, Name, &Hdl);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	return XAie_DataMemReadSymbolHdl(DevInst, &Hdl, Offset, Dst, Size);
+}
+
 #endif /* XAIE_FEATURE_ELF_ENABLE */
 /** @} */
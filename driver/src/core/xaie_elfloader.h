@@ -44,6 +44,84 @@ typedef struct {
 	u32 start;	/**< Stack start address */
 	u32 end;	/**< Stack end address */
 } XAieSim_StackSz;
+
+/* Types of the segments of a pre-parsed elf image */
+#define XAIE_ELF_SEG_PROG	0U	/* Program memory contents */
+#define XAIE_ELF_SEG_DATA	1U	/* Initialized data memory contents */
+#define XAIE_ELF_SEG_ZERO	2U	/* Zero initialized data memory */
+
+/* Granularity at which incremental loads compare and rewrite memories */
+#define XAIE_ELF_CHUNK_SIZE	256U
+
+/*
+ * This typedef captures one pre-split segment of an elf image. A data memory
+ * segment never crosses the boundary of the data memory of a tile, so it can
+ * be written with one data memory block write.
+ */
+typedef struct {
+	const unsigned char *Data;	/* Contents, NULL for zero segments */
+	u32 Addr;	/* Address of the segment as seen by the core */
+	u32 Size;	/* Size of the segment in bytes */
+	u8 Type;
+} XAie_ElfImageSeg;
+
+/*
+ * This typedef captures an elf which is read and parsed once, to be loaded
+ * to any number of tiles with XAie_LoadElfImage().
+ */
+typedef struct {
+	const unsigned char *ElfMem;	/* Mapping owned by the image or NULL */
+	u64 ElfSz;	/* Size of the mapping owned by the image */
+	XAie_ElfImageSeg *Segs;
+	u32 NumSegs;
+	u8 IsReady;
+} XAie_ElfImage;
+
+/*
+ * This typedef captures what was loaded last on an AIE Tile with
+ * XAie_LoadElfImageIncremental(), as the content hash of every chunk of its
+ * program memory and of the data memories the core can reach.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u64 *ChunkHash;	/* Hash of each chunk, 0 if unknown */
+	u32 NumChunks;
+	u8 IsReady;
+} XAie_ElfTileState;
+
+/* Symbol of an elf symbol map */
+typedef struct {
+	const char *Name;	/* Name, in the string pool of the map */
+	u32 Addr;	/* Address of the symbol as seen by the core */
+	u32 Size;	/* Size of the symbol in bytes */
+	u32 Next;	/* Next symbol of the same hash bucket */
+} XAie_ElfSym;
+
+/*
+ * This typedef captures the data memory symbols of an elf loaded on an AIE
+ * Tile, indexed by name. The names are copied, so the map does not reference
+ * the elf once it is created.
+ */
+typedef struct {
+	XAie_LocType Loc;	/* AIE Tile the elf is loaded on */
+	XAie_ElfSym *Syms;
+	u32 *Buckets;	/* First symbol of each hash bucket */
+	char *Names;	/* String pool of the symbol names */
+	u32 NumSyms;
+	u32 NumBuckets;
+	u8 IsReady;
+} XAie_ElfSymMap;
+
+/*
+ * This typedef captures a symbol resolved to the tile which holds it and its
+ * address in the data memory of that tile, so that it can be accessed with no
+ * lookup.
+ */
+typedef struct {
+	XAie_LocType Loc;	/* Tile of the data memory of the symbol */
+	u32 Addr;	/* Address in the data memory of the tile */
+	u32 Size;	/* Size of the symbol in bytes */
+} XAie_ElfSymHandle;
 /************************** Function Prototypes  *****************************/
 
 AieRC XAie_LoadElf(XAie_DevInst *DevInst, XAie_LocType Loc, const char *ElfPtr,
@@ -54,6 +132,45 @@ AieRC XAie_LoadElfSection(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const unsigned char *SectionPtr, const Elf32_Phdr *Phdr);
 AieRC XAie_LoadElfSectionBlock(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const unsigned char* SectionPtr, u64 TgtAddr, u32 Size);
+AieRC XAie_ElfImageCreate(XAie_DevInst *DevInst, XAie_ElfImage *Image,
+		const char *ElfPtr);
+AieRC XAie_ElfImageCreateMem(XAie_DevInst *DevInst, XAie_ElfImage *Image,
+		const unsigned char *ElfMem);
+AieRC XAie_LoadElfImage(XAie_DevInst *DevInst, const XAie_ElfImage *Image,
+		const XAie_LocType *Locs, u32 NumLocs);
+AieRC XAie_LoadElfMemRect(XAie_DevInst *DevInst, XAie_LocType Loc, u8 NumCols,
+		u8 NumRows, const unsigned char *ElfMem);
+AieRC XAie_ElfImageFree(XAie_ElfImage *Image);
+AieRC XAie_ElfTileStateInit(XAie_DevInst *DevInst, XAie_ElfTileState *State,
+		XAie_LocType Loc);
+AieRC XAie_ElfTileStateReset(XAie_ElfTileState *State);
+AieRC XAie_ElfTileStateFree(XAie_ElfTileState *State);
+AieRC XAie_LoadElfImageIncremental(XAie_DevInst *DevInst,
+		const XAie_ElfImage *Image, XAie_ElfTileState *States,
+		u32 NumStates);
+AieRC XAie_ElfSymMapCreate(XAie_DevInst *DevInst, XAie_ElfSymMap *Map,
+		XAie_LocType Loc, const char *ElfPtr);
+AieRC XAie_ElfSymMapCreateMem(XAie_DevInst *DevInst, XAie_ElfSymMap *Map,
+		XAie_LocType Loc, const unsigned char *ElfMem);
+AieRC XAie_ElfSymMapFree(XAie_ElfSymMap *Map);
+AieRC XAie_ElfSymPrepare(XAie_DevInst *DevInst, const XAie_ElfSymMap *Map,
+		const char *Name, XAie_ElfSymHandle *Hdl);
+AieRC XAie_DataMemWriteSymbol(XAie_DevInst *DevInst,
+		const XAie_ElfSymMap *Map, const char *Name, u32 Offset,
+		const void *Src, u32 Size);
+AieRC XAie_DataMemReadSymbol(XAie_DevInst *DevInst,
+		const XAie_ElfSymMap *Map, const char *Name, u32 Offset,
+		void *Dst, u32 Size);
+AieRC XAie_DataMemWriteSymbolHdl(XAie_DevInst *DevInst,
+		const XAie_ElfSymHandle *Hdl, u32 Offset, const void *Src,
+		u32 Size);
+AieRC XAie_DataMemReadSymbolHdl(XAie_DevInst *DevInst,
+		const XAie_ElfSymHandle *Hdl, u32 Offset, void *Dst, u32 Size);
+AieRC _XAie_GetTargetTileLoc(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u32 Addr, XAie_LocType *TgtLoc);
+AieRC _XAie_MapElfFile(const char *ElfPtr, const unsigned char **ElfMemPtr,
+		u64 *ElfSzPtr);
+void _XAie_UnmapElfFile(const unsigned char *ElfMem, u64 ElfSz);
 
 #endif /* XAIE_FEATURE_ELF_ENABLE */
 
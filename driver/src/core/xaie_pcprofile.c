@@ -0,0 +1,900 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_pcprofile.c
+* @{
+*
+* This file contains routines for a sampling profiler of the program counters
+* of AIE cores. The program counters are sampled periodically from a host
+* thread and aggregated into per core histograms, which can be mapped back to
+* the function symbols of the elf loaded to the cores. No PC event, trace or
+* performance counter resource of the cores is used.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifndef __AIEBAREMETAL__
+#define  _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#include "xaie_elfloader.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_pcprofile.h"
+
+#ifdef XAIE_FEATURE_CORE_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_PCPROFILE_MAX_BIN_SHIFT	16U
+
+/**************************** Type Definitions *******************************/
+/* Function symbol of an elf, sorted by address in its symbol table */
+typedef struct {
+	u32 Addr;
+	u32 Size;
+	u32 NameOff;	/* Offset of the name in the string table */
+} XAie_PcProfileSym;
+
+/* Function symbols of one elf, shared by all the cores it is loaded to */
+typedef struct XAie_PcProfileSymTab {
+	struct XAie_PcProfileSymTab *Next;
+	XAie_PcProfileSym *Syms;
+	u32 NumSyms;
+	char *Names;
+} XAie_PcProfileSymTab;
+
+/* Sampling state of one core */
+typedef struct {
+	XAie_LocType Loc;
+	u64 PCAddr;	/* Address of the program counter register */
+	u64 NumSamples;
+	u32 *Hist;
+	const XAie_PcProfileSymTab *SymTab;
+} XAie_PcProfileCore;
+
+struct XAie_PcProfile {
+	XAie_DevInst *DevInst;
+	XAie_PcProfileCore *Cores;
+	u32 NumCores;
+	u32 *Hist;	/* NumCores histograms of NumBins bins */
+	u32 NumBins;
+	u8 BinShift;
+	XAie_PcProfileSymTab *SymTabs;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+	pthread_t Thread;
+	u32 PeriodUs;
+	u8 Running;
+	u8 Stop;
+	AieRC Status;	/* Error which stopped the sampling thread */
+#endif
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API takes the lock protecting the histograms of a profiler.
+*
+* @param	Prof: Profiler.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_PcProfileLock(XAie_PcProfile *Prof)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_lock(&Prof->Lock);
+#else
+	(void)Prof;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the lock protecting the histograms of a profiler.
+*
+* @param	Prof: Profiler.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_PcProfileUnlock(XAie_PcProfile *Prof)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_unlock(&Prof->Lock);
+#else
+	(void)Prof;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a profiler of the program counters of a set of AIE cores.
+* Each core gets a histogram of its program memory with one bin per
+* 2^BinShift bytes, plus one last bin counting the samples outside of the
+* program memory.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of AIE tile locations.
+* @param	NumLocs: Number of locations in Locs.
+* @param	BinShift: Log2 of the number of bytes of program memory per bin.
+*		0 gives one bin per byte; the memory of the profiler is
+*		NumLocs * (ProgMemSize >> BinShift) words.
+*
+* @return	Pointer to the profiler on success, NULL on failure.
+*
+* @note		The profiler has to be released with XAie_PcProfileFree().
+*
+******************************************************************************/
+XAie_PcProfile* XAie_PcProfileCreate(XAie_DevInst *DevInst,
+		const XAie_LocType *Locs, u32 NumLocs, u8 BinShift)
+{
+	const XAie_CoreMod *CoreMod;
+	XAie_PcProfile *Prof;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return NULL;
+	}
+
+	if((Locs == NULL) || (NumLocs == 0U) ||
+			(BinShift > XAIE_PCPROFILE_MAX_BIN_SHIFT)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return NULL;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		if(_XAie_DevGetTTypefromLoc(DevInst, Locs[i]) !=
+				XAIEGBL_TILE_TYPE_AIETILE) {
+			XAIE_ERROR("Invalid Tile Type (%d, %d)\n",
+					Locs[i].Col, Locs[i].Row);
+			return NULL;
+		}
+	}
+
+	Prof = (XAie_PcProfile *)calloc(1U, sizeof(*Prof));
+	if(Prof == NULL) {
+		XAIE_ERROR("Memory allocation for profiler failed\n");
+		return NULL;
+	}
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	Prof->DevInst = DevInst;
+	Prof->NumCores = NumLocs;
+	Prof->BinShift = BinShift;
+	Prof->NumBins = ((CoreMod->ProgMemSize + (1U << BinShift) - 1U) >>
+			BinShift) + 1U;
+	Prof->Cores = (XAie_PcProfileCore *)calloc(NumLocs,
+			sizeof(*Prof->Cores));
+	Prof->Hist = (u32 *)calloc((size_t)NumLocs * Prof->NumBins,
+			sizeof(*Prof->Hist));
+	if((Prof->Cores == NULL) || (Prof->Hist == NULL)) {
+		XAIE_ERROR("Memory allocation for profiler failed\n");
+		free(Prof->Cores);
+		free(Prof->Hist);
+		free(Prof);
+		return NULL;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		Prof->Cores[i].Loc = Locs[i];
+		Prof->Cores[i].PCAddr = CoreMod->CorePCOff +
+			_XAie_GetTileAddr(DevInst, Locs[i].Row, Locs[i].Col);
+		Prof->Cores[i].Hist = &Prof->Hist[(size_t)i * Prof->NumBins];
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_init(&Prof->Lock, NULL);
+#endif
+
+	return Prof;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API takes one sample of the program counter of all the cores of a
+* profiler and adds it to their histograms.
+*
+* @param	Prof: Profiler.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The program counters are read in one sweep with the read
+*		operation of the backend. They are neither recorded in the
+*		transaction of the calling thread nor looked up in the shadow
+*		cache, so sampling can run in a thread of its own. The backend
+*		has to support reads from several threads.
+*
+******************************************************************************/
+AieRC XAie_PcProfileSample(XAie_PcProfile *Prof)
+{
+	AieRC RC = XAIE_OK;
+
+	if(Prof == NULL) {
+		XAIE_ERROR("Invalid profiler\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_PcProfileLock(Prof);
+	for(u32 i = 0U; i < Prof->NumCores; i++) {
+		XAie_PcProfileCore *Core = &Prof->Cores[i];
+		u32 PC, Bin;
+
+		RC = _XAie_IORead32(Prof->DevInst, Core->PCAddr, &PC);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to read PC of core (%d, %d)\n",
+					Core->Loc.Col, Core->Loc.Row);
+			break;
+		}
+
+		Bin = PC >> Prof->BinShift;
+		if(Bin >= Prof->NumBins - 1U) {
+			Bin = Prof->NumBins - 1U;
+		}
+
+		Core->Hist[Bin]++;
+		Core->NumSamples++;
+	}
+	_XAie_PcProfileUnlock(Prof);
+
+	return RC;
+}
+
+#ifndef __AIEBAREMETAL__
+/*****************************************************************************/
+/**
+*
+* This is the body of the sampling thread of a profiler. It samples the cores
+* once per period until it is asked to stop or a sample fails.
+*
+* @param	Arg: Profiler.
+*
+* @return	NULL.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void *_XAie_PcProfileWorker(void *Arg)
+{
+	XAie_PcProfile *Prof = (XAie_PcProfile *)Arg;
+	struct timespec Period;
+
+	Period.tv_sec = Prof->PeriodUs / 1000000U;
+	Period.tv_nsec = (long)(Prof->PeriodUs % 1000000U) * 1000L;
+
+	while(1) {
+		AieRC RC;
+		u8 Stop;
+
+		pthread_mutex_lock(&Prof->Lock);
+		Stop = Prof->Stop;
+		pthread_mutex_unlock(&Prof->Lock);
+		if(Stop != 0U) {
+			break;
+		}
+
+		RC = XAie_PcProfileSample(Prof);
+		if(RC != XAIE_OK) {
+			pthread_mutex_lock(&Prof->Lock);
+			Prof->Status = RC;
+			pthread_mutex_unlock(&Prof->Lock);
+			break;
+		}
+
+		nanosleep(&Period, NULL);
+	}
+
+	return NULL;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API starts a host thread which samples the cores of a profiler
+* periodically.
+*
+* @param	Prof: Profiler.
+* @param	PeriodUs: Period between two samples in microseconds.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The thread has to be stopped with XAie_PcProfileStop(). Not
+*		supported for baremetal, call XAie_PcProfileSample() instead.
+*
+******************************************************************************/
+AieRC XAie_PcProfileStart(XAie_PcProfile *Prof, u32 PeriodUs)
+{
+#ifndef __AIEBAREMETAL__
+	if(Prof == NULL) {
+		XAIE_ERROR("Invalid profiler\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Prof->Running != 0U) {
+		XAIE_ERROR("Profiler is already sampling\n");
+		return XAIE_ERR;
+	}
+
+	Prof->PeriodUs = PeriodUs;
+	Prof->Stop = 0U;
+	Prof->Status = XAIE_OK;
+	if(pthread_create(&Prof->Thread, NULL, _XAie_PcProfileWorker,
+				Prof) != 0) {
+		XAIE_ERROR("Unable to create sampling thread\n");
+		return XAIE_ERR;
+	}
+
+	Prof->Running = 1U;
+	return XAIE_OK;
+#else
+	(void)Prof;
+	(void)PeriodUs;
+	XAIE_ERROR("Sampling thread is not supported for baremetal\n");
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stops the sampling thread of a profiler.
+*
+* @param	Prof: Profiler.
+*
+* @return	XAIE_OK on success, the error which stopped the sampling thread
+*		or error code on failure.
+*
+* @note		The histograms are kept, and sampling can be started again.
+*
+******************************************************************************/
+AieRC XAie_PcProfileStop(XAie_PcProfile *Prof)
+{
+#ifndef __AIEBAREMETAL__
+	if(Prof == NULL) {
+		XAIE_ERROR("Invalid profiler\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Prof->Running == 0U) {
+		return XAIE_OK;
+	}
+
+	pthread_mutex_lock(&Prof->Lock);
+	Prof->Stop = 1U;
+	pthread_mutex_unlock(&Prof->Lock);
+	pthread_join(Prof->Thread, NULL);
+	Prof->Running = 0U;
+
+	return Prof->Status;
+#else
+	(void)Prof;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the histograms of all the cores of a profiler.
+*
+* @param	Prof: Profiler.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_PcProfileReset(XAie_PcProfile *Prof)
+{
+	if(Prof == NULL) {
+		XAIE_ERROR("Invalid profiler\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_PcProfileLock(Prof);
+	memset(Prof->Hist, 0, (size_t)Prof->NumCores * Prof->NumBins *
+			sizeof(*Prof->Hist));
+	for(u32 i = 0U; i < Prof->NumCores; i++) {
+		Prof->Cores[i].NumSamples = 0U;
+	}
+	_XAie_PcProfileUnlock(Prof);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API copies the histogram of a core of a profiler. Bin i counts the
+* samples with a program counter in [i << BinShift, (i + 1) << BinShift) and
+* the last bin the samples outside of the program memory.
+*
+* @param	Prof: Profiler.
+* @param	CoreIdx: Index of the core in the locations of the profiler.
+* @param	Hist: Array to copy the histogram to. NULL to only query the
+*		number of bins.
+* @param	NumBins: Pointer to the size of Hist, updated with the number of
+*		bins of the histogram.
+* @param	NumSamples: Optional pointer to return the number of samples of
+*		the core. NULL if not required.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The copy is consistent even while the sampling thread runs.
+*
+******************************************************************************/
+AieRC XAie_PcProfileGetHist(XAie_PcProfile *Prof, u32 CoreIdx, u32 *Hist,
+		u32 *NumBins, u64 *NumSamples)
+{
+	if((Prof == NULL) || (NumBins == NULL) ||
+			(CoreIdx >= Prof->NumCores)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Hist != NULL) {
+		if(*NumBins < Prof->NumBins) {
+			XAIE_ERROR("Histogram array is too small\n");
+			return XAIE_INVALID_ARGS;
+		}
+
+		_XAie_PcProfileLock(Prof);
+		memcpy(Hist, Prof->Cores[CoreIdx].Hist,
+				Prof->NumBins * sizeof(*Hist));
+		if(NumSamples != NULL) {
+			*NumSamples = Prof->Cores[CoreIdx].NumSamples;
+		}
+		_XAie_PcProfileUnlock(Prof);
+	} else if(NumSamples != NULL) {
+		_XAie_PcProfileLock(Prof);
+		*NumSamples = Prof->Cores[CoreIdx].NumSamples;
+		_XAie_PcProfileUnlock(Prof);
+	}
+
+	*NumBins = Prof->NumBins;
+
+	return XAIE_OK;
+}
+
+#ifdef XAIE_FEATURE_ELF_ENABLE
+/*****************************************************************************/
+/**
+*
+* This API compares two function symbols by address.
+*
+* @param	A: Pointer to the first symbol.
+* @param	B: Pointer to the second symbol.
+*
+* @return	Negative, zero or positive as per qsort().
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static int _XAie_PcProfileSymCmp(const void *A, const void *B)
+{
+	const XAie_PcProfileSym *SA = (const XAie_PcProfileSym *)A;
+	const XAie_PcProfileSym *SB = (const XAie_PcProfileSym *)B;
+
+	return (SA->Addr < SB->Addr) ? -1 : (SA->Addr > SB->Addr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API builds the table of the function symbols of an elf. The names are
+* copied, so the elf can be released once the table is built.
+*
+* @param	ElfMem: Pointer to the elf contents.
+*
+* @return	Pointer to the symbol table on success, NULL on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static XAie_PcProfileSymTab* _XAie_PcProfileSymTabCreate(
+		const unsigned char *ElfMem)
+{
+	const Elf32_Ehdr *Ehdr = (const Elf32_Ehdr *)ElfMem;
+	const Elf32_Shdr *Shdr, *SymShdr = NULL, *StrShdr;
+	const Elf32_Sym *Sym;
+	XAie_PcProfileSymTab *Tab;
+	u32 NumElfSyms;
+
+	if((Ehdr->e_shoff == 0U) || (Ehdr->e_shnum == 0U)) {
+		XAIE_ERROR("Elf has no section headers\n");
+		return NULL;
+	}
+
+	Shdr = (const Elf32_Shdr *)(ElfMem + Ehdr->e_shoff);
+	for(u32 i = 0U; i < Ehdr->e_shnum; i++) {
+		if(Shdr[i].sh_type == SHT_SYMTAB) {
+			SymShdr = &Shdr[i];
+			break;
+		}
+	}
+
+	if((SymShdr == NULL) || (SymShdr->sh_link >= Ehdr->e_shnum) ||
+			(SymShdr->sh_entsize != sizeof(Elf32_Sym))) {
+		XAIE_ERROR("Elf has no symbol table\n");
+		return NULL;
+	}
+
+	StrShdr = &Shdr[SymShdr->sh_link];
+	Sym = (const Elf32_Sym *)(ElfMem + SymShdr->sh_offset);
+	NumElfSyms = SymShdr->sh_size / sizeof(Elf32_Sym);
+
+	Tab = (XAie_PcProfileSymTab *)calloc(1U, sizeof(*Tab));
+	if(Tab == NULL) {
+		XAIE_ERROR("Memory allocation for symbol table failed\n");
+		return NULL;
+	}
+
+	Tab->Syms = (XAie_PcProfileSym *)malloc((NumElfSyms + 1U) *
+			sizeof(*Tab->Syms));
+	Tab->Names = (char *)malloc(StrShdr->sh_size + 1U);
+	if((Tab->Syms == NULL) || (Tab->Names == NULL)) {
+		XAIE_ERROR("Memory allocation for symbol table failed\n");
+		free(Tab->Syms);
+		free(Tab->Names);
+		free(Tab);
+		return NULL;
+	}
+
+	memcpy(Tab->Names, ElfMem + StrShdr->sh_offset, StrShdr->sh_size);
+	Tab->Names[StrShdr->sh_size] = '\0';
+
+	for(u32 i = 0U; i < NumElfSyms; i++) {
+		if((ELF32_ST_TYPE(Sym[i].st_info) != STT_FUNC) ||
+				(Sym[i].st_name >= StrShdr->sh_size)) {
+			continue;
+		}
+
+		Tab->Syms[Tab->NumSyms].Addr = Sym[i].st_value;
+		Tab->Syms[Tab->NumSyms].Size = Sym[i].st_size;
+		Tab->Syms[Tab->NumSyms].NameOff = Sym[i].st_name;
+		Tab->NumSyms++;
+	}
+
+	qsort(Tab->Syms, Tab->NumSyms, sizeof(*Tab->Syms),
+			_XAie_PcProfileSymCmp);
+
+	return Tab;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API attaches the function symbols of an elf in memory to the cores of
+* a profiler it is loaded to, to map their program counters to functions with
+* XAie_PcProfileLookup().
+*
+* @param	Prof: Profiler.
+* @param	ElfMem: Pointer to the elf contents, as passed to
+*		XAie_LoadElfMem().
+* @param	Locs: Locations of the cores the elf is loaded to. They must be
+*		cores of the profiler.
+* @param	NumLocs: Number of locations in Locs.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The symbols are parsed once for all the locations and copied,
+*		so the elf can be released after the call.
+*
+******************************************************************************/
+AieRC XAie_PcProfileSetElfMem(XAie_PcProfile *Prof,
+		const unsigned char *ElfMem, const XAie_LocType *Locs,
+		u32 NumLocs)
+{
+	XAie_PcProfileSymTab *Tab;
+	u32 *Idx;
+
+	if((Prof == NULL) || (ElfMem == NULL) || (Locs == NULL) ||
+			(NumLocs == 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Idx = (u32 *)malloc(NumLocs * sizeof(*Idx));
+	if(Idx == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		for(Idx[i] = 0U; Idx[i] < Prof->NumCores; Idx[i]++) {
+			if((Prof->Cores[Idx[i]].Loc.Col == Locs[i].Col) &&
+					(Prof->Cores[Idx[i]].Loc.Row ==
+					 Locs[i].Row)) {
+				break;
+			}
+		}
+
+		if(Idx[i] == Prof->NumCores) {
+			XAIE_ERROR("Tile (%d, %d) is not profiled\n",
+					Locs[i].Col, Locs[i].Row);
+			free(Idx);
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	Tab = _XAie_PcProfileSymTabCreate(ElfMem);
+	if(Tab == NULL) {
+		free(Idx);
+		return XAIE_INVALID_ELF;
+	}
+
+	_XAie_PcProfileLock(Prof);
+	Tab->Next = Prof->SymTabs;
+	Prof->SymTabs = Tab;
+	for(u32 i = 0U; i < NumLocs; i++) {
+		Prof->Cores[Idx[i]].SymTab = Tab;
+	}
+	_XAie_PcProfileUnlock(Prof);
+
+	free(Idx);
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API attaches the function symbols of an elf file to the cores of a
+* profiler it is loaded to, to map their program counters to functions with
+* XAie_PcProfileLookup().
+*
+* @param	Prof: Profiler.
+* @param	ElfPtr: Path to the elf file, as passed to XAie_LoadElf().
+* @param	Locs: Locations of the cores the elf is loaded to. They must be
+*		cores of the profiler.
+* @param	NumLocs: Number of locations in Locs.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_PcProfileSetElf(XAie_PcProfile *Prof, const char *ElfPtr,
+		const XAie_LocType *Locs, u32 NumLocs)
+{
+	AieRC RC;
+	const unsigned char *ElfMem;
+	u64 ElfSz;
+
+	if((Prof == NULL) || (ElfPtr == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_MapElfFile(ElfPtr, &ElfMem, &ElfSz);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_PcProfileSetElfMem(Prof, ElfMem, Locs, NumLocs);
+	_XAie_UnmapElfFile(ElfMem, ElfSz);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API maps a program counter of a core of a profiler to the function
+* symbol containing it.
+*
+* @param	Prof: Profiler.
+* @param	CoreIdx: Index of the core in the locations of the profiler.
+* @param	PC: Program counter, for instance the start address of a bin.
+* @param	Offset: Optional pointer to return the offset of PC in the
+*		function. NULL if not required.
+*
+* @return	Name of the function, NULL if no symbol of the elf of the core
+*		contains PC.
+*
+* @note		The name stays valid until the profiler is released.
+*
+******************************************************************************/
+const char* XAie_PcProfileLookup(XAie_PcProfile *Prof, u32 CoreIdx, u32 PC,
+		u32 *Offset)
+{
+	const XAie_PcProfileSymTab *Tab;
+	const XAie_PcProfileSym *Sym;
+	u32 Lo = 0U, Hi;
+
+	if((Prof == NULL) || (CoreIdx >= Prof->NumCores)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return NULL;
+	}
+
+	Tab = Prof->Cores[CoreIdx].SymTab;
+	if((Tab == NULL) || (Tab->NumSyms == 0U)) {
+		return NULL;
+	}
+
+	/* Find the last symbol starting at or before PC */
+	Hi = Tab->NumSyms;
+	while(Lo < Hi) {
+		u32 Mid = Lo + (Hi - Lo) / 2U;
+
+		if(Tab->Syms[Mid].Addr <= PC) {
+			Lo = Mid + 1U;
+		} else {
+			Hi = Mid;
+		}
+	}
+
+	if(Lo == 0U) {
+		return NULL;
+	}
+
+	Sym = &Tab->Syms[Lo - 1U];
+	if((Sym->Size != 0U) && (PC - Sym->Addr >= Sym->Size)) {
+		return NULL;
+	}
+
+	if(Offset != NULL) {
+		*Offset = PC - Sym->Addr;
+	}
+
+	return &Tab->Names[Sym->NameOff];
+}
+
+/*****************************************************************************/
+/**
+*
+* This API finds the address range of a function symbol of an elf in memory,
+* for instance to count its cycles with PC range events.
+*
+* @param	ElfMem: Pointer to the elf contents.
+* @param	Name: Name of the function.
+* @param	Addr: Pointer to return the start address of the function.
+* @param	Size: Pointer to return the size of the function in bytes.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_PcProfileFindFunc(const unsigned char *ElfMem, const char *Name,
+		u32 *Addr, u32 *Size)
+{
+	XAie_PcProfileSymTab *Tab;
+	AieRC RC = XAIE_ERR;
+
+	if((ElfMem == NULL) || (Name == NULL) || (Addr == NULL) ||
+			(Size == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Tab = _XAie_PcProfileSymTabCreate(ElfMem);
+	if(Tab == NULL) {
+		return XAIE_INVALID_ELF;
+	}
+
+	for(u32 i = 0U; i < Tab->NumSyms; i++) {
+		if(strcmp(&Tab->Names[Tab->Syms[i].NameOff], Name) == 0) {
+			*Addr = Tab->Syms[i].Addr;
+			*Size = Tab->Syms[i].Size;
+			RC = XAIE_OK;
+			break;
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Function %s not found in elf\n", Name);
+	}
+
+	free(Tab->Syms);
+	free(Tab->Names);
+	free(Tab);
+
+	return RC;
+}
+#else
+AieRC XAie_PcProfileSetElfMem(XAie_PcProfile *Prof,
+		const unsigned char *ElfMem, const XAie_LocType *Locs,
+		u32 NumLocs)
+{
+	(void)Prof;
+	(void)ElfMem;
+	(void)Locs;
+	(void)NumLocs;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+AieRC XAie_PcProfileSetElf(XAie_PcProfile *Prof, const char *ElfPtr,
+		const XAie_LocType *Locs, u32 NumLocs)
+{
+	(void)Prof;
+	(void)ElfPtr;
+	(void)Locs;
+	(void)NumLocs;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+const char* XAie_PcProfileLookup(XAie_PcProfile *Prof, u32 CoreIdx, u32 PC,
+		u32 *Offset)
+{
+	(void)Prof;
+	(void)CoreIdx;
+	(void)PC;
+	(void)Offset;
+	return NULL;
+}
+
+AieRC XAie_PcProfileFindFunc(const unsigned char *ElfMem, const char *Name,
+		u32 *Addr, u32 *Size)
+{
+	(void)ElfMem;
+	(void)Name;
+	(void)Addr;
+	(void)Size;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+#endif /* XAIE_FEATURE_ELF_ENABLE */
+
+/*****************************************************************************/
+/**
+*
+* This API releases a profiler. The sampling thread is stopped first if it is
+* running.
+*
+* @param	Prof: Profiler.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_PcProfileFree(XAie_PcProfile *Prof)
+{
+	XAie_PcProfileSymTab *Tab;
+
+	if(Prof == NULL) {
+		return;
+	}
+
+	(void)XAie_PcProfileStop(Prof);
+
+	Tab = Prof->SymTabs;
+	while(Tab != NULL) {
+		XAie_PcProfileSymTab *Next = Tab->Next;
+
+		free(Tab->Syms);
+		free(Tab->Names);
+		free(Tab);
+		Tab = Next;
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_destroy(&Prof->Lock);
+#endif
+	free(Prof->Cores);
+	free(Prof->Hist);
+	free(Prof);
+}
+
+#endif /* XAIE_FEATURE_CORE_ENABLE */
+/** @} */
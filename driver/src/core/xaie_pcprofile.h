@@ -0,0 +1,51 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_pcprofile.h
+* @{
+*
+* Header file for the sampling program counter profiler of AIE cores.
+*
+******************************************************************************/
+#ifndef XAIEPCPROFILE_H
+#define XAIEPCPROFILE_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+
+/************************** Variable Definitions *****************************/
+/*
+ * Profiler of the program counters of a set of AIE cores. The samples of each
+ * core are counted in a histogram of the program memory, with one bin per
+ * 2^BinShift bytes, so its memory does not grow with the number of samples.
+ */
+typedef struct XAie_PcProfile XAie_PcProfile;
+
+/************************** Function Prototypes  *****************************/
+XAie_PcProfile* XAie_PcProfileCreate(XAie_DevInst *DevInst,
+		const XAie_LocType *Locs, u32 NumLocs, u8 BinShift);
+AieRC XAie_PcProfileSample(XAie_PcProfile *Prof);
+AieRC XAie_PcProfileStart(XAie_PcProfile *Prof, u32 PeriodUs);
+AieRC XAie_PcProfileStop(XAie_PcProfile *Prof);
+AieRC XAie_PcProfileReset(XAie_PcProfile *Prof);
+AieRC XAie_PcProfileGetHist(XAie_PcProfile *Prof, u32 CoreIdx, u32 *Hist,
+		u32 *NumBins, u64 *NumSamples);
+AieRC XAie_PcProfileSetElf(XAie_PcProfile *Prof, const char *ElfPtr,
+		const XAie_LocType *Locs, u32 NumLocs);
+AieRC XAie_PcProfileSetElfMem(XAie_PcProfile *Prof,
+		const unsigned char *ElfMem, const XAie_LocType *Locs,
+		u32 NumLocs);
+const char* XAie_PcProfileLookup(XAie_PcProfile *Prof, u32 CoreIdx, u32 PC,
+		u32 *Offset);
+AieRC XAie_PcProfileFindFunc(const unsigned char *ElfMem, const char *Name,
+		u32 *Addr, u32 *Size);
+void XAie_PcProfileFree(XAie_PcProfile *Prof);
+
+#endif		/* end of protection macro */
+/** @} */
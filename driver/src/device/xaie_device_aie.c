@@ -54,7 +54,7 @@ static AieRC _XAie_PmSetColumnClockBuffer(XAie_DevInst *DevInst,
 	const XAie_PlIfMod *PlIfMod;
 	const XAie_ShimClkBufCntr *ClkBufCntr;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
 	ClkBufCntr = PlIfMod->ClkBufCntr;
 
@@ -69,19 +69,22 @@ static AieRC _XAie_PmSetColumnClockBuffer(XAie_DevInst *DevInst,
 
 /*****************************************************************************/
 /*
-* This API enables clock for all tiles in the given device instance.
+* This API sets the clock buffers of a range of columns in the given device
+* instance.
 *
 * @param        DevInst: Device Instance
-* @param        Loc: Location of AIE tile
+* @param        StartCol: First column, relative to the partition.
+* @param        NumCols: Number of columns.
 * @param        Enable: XAIE_ENABLE to enable column global clock buffer,
 *               XAIE_DISABLE to disable.
 *
-* @note         This is INTERNAL API.
+* @note         This is INTERNAL API. The caller checks the column range.
 *
 *******************************************************************************/
-AieRC _XAie_PmSetPartitionClock(XAie_DevInst *DevInst, u8 Enable)
+AieRC _XAie_PmSetColumnsClock(XAie_DevInst *DevInst, u32 StartCol,
+		u32 NumCols, u8 Enable)
 {
-	for(u32 C = 0; C < DevInst->NumCols; C++) {
+	for(u32 C = StartCol; C < StartCol + NumCols; C++) {
 		XAie_LocType Loc;
 		AieRC RC;
 
@@ -96,6 +99,24 @@ AieRC _XAie_PmSetPartitionClock(XAie_DevInst *DevInst, u8 Enable)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/*
+* This API enables clock for all tiles in the given device instance.
+*
+* @param        DevInst: Device Instance
+* @param        Loc: Location of AIE tile
+* @param        Enable: XAIE_ENABLE to enable column global clock buffer,
+*               XAIE_DISABLE to disable.
+*
+* @note         This is INTERNAL API.
+*
+*******************************************************************************/
+AieRC _XAie_PmSetPartitionClock(XAie_DevInst *DevInst, u8 Enable)
+{
+	return _XAie_PmSetColumnsClock(DevInst, 0U, DevInst->NumCols, Enable);
+}
+
+#ifdef XAIE_DEV_AIE_ENABLE
 /*****************************************************************************/
 /**
 *
@@ -168,7 +189,7 @@ static AieRC _XAie_SetShimReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 	const XAie_PlIfMod *PlIfMod;
 	const XAie_ShimRstMod *ShimTileRst;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
 	ShimTileRst = PlIfMod->ShimTileRst;
 
@@ -260,28 +281,11 @@ AieRC _XAie_SetPartColClockAfterRst(XAie_DevInst *DevInst, u8 Enable)
 ******************************************************************************/
 AieRC _XAie_SetPartIsolationAfterRst(XAie_DevInst *DevInst)
 {
-	AieRC RC = XAIE_OK;
-
-	for(u8 C = 0; C < DevInst->NumCols; C++) {
-		u8 Dir = 0;
-
-		if(C == 0) {
-			Dir = XAIE_ISOLATE_WEST_MASK;
-		} else if(C == (u8)(DevInst->NumCols - 1)) {
-			Dir = XAIE_ISOLATE_EAST_MASK;
-		} else {
-			/* No isolation for tiles by default for AIE */
-			continue;
-		}
+	AieRC RC;
 
-		for(u8 R = 0; R < DevInst->NumRows; R++) {
-			RC = _XAie_TileCtrlSetIsolation(DevInst,
-					XAie_TileLoc(C, R), Dir);
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("Failed to set partition isolation.\n");
-				return RC;
-			}
-		}
+	RC = _XAie_TileCtrlSetPartIsolation(DevInst, XAIE_DISABLE);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to set partition isolation.\n");
 	}
 
 	return RC;
@@ -293,6 +297,8 @@ AieRC _XAie_SetPartIsolationAfterRst(XAie_DevInst *DevInst)
 * This API initialize the memories of the partition to zero.
 *
 * @param	DevInst: Device Instance
+* @param	UsedTiles: Bitmap of the tiles to zeroize, in the layout of the
+*		tiles in use of the device instance. NULL for all the tiles.
 *
 * @return       XAIE_OK on success, error code on failure
 *
@@ -301,7 +307,7 @@ AieRC _XAie_SetPartIsolationAfterRst(XAie_DevInst *DevInst)
 *		Internal API only.
 *
 ******************************************************************************/
-AieRC _XAie_PartMemZeroInit(XAie_DevInst *DevInst)
+AieRC _XAie_PartMemZeroInit(XAie_DevInst *DevInst, const u32 *UsedTiles)
 {
 	AieRC RC = XAIE_OK;
 	const XAie_CoreMod *CoreMod;
@@ -314,6 +320,12 @@ AieRC _XAie_PartMemZeroInit(XAie_DevInst *DevInst)
 		for(u8 R = 1; R < DevInst->NumRows; R++) {
 			u64 RegAddr;
 
+			if((UsedTiles != NULL) && !CheckBit(UsedTiles,
+					_XAie_GetTileBitPosFromLoc(DevInst,
+						XAie_TileLoc(C, R)))) {
+				continue;
+			}
+
 			/* Zeroize program memory */
 			RegAddr = CoreMod->ProgMemHostOffset +
 				_XAie_GetTileAddr(DevInst, R, C);
@@ -363,7 +375,7 @@ static void _XAie_PmGateTiles(XAie_DevInst *DevInst, XAie_LocType Loc)
 
 		TileLoc.Col = Loc.Col;
 		TileLoc.Row = R - 1;
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, TileLoc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, TileLoc);
 		ClockMod = DevInst->DevProp.DevMod[TileType].ClockMod;
 		RegAddr = _XAie_GetTileAddr(DevInst, TileLoc.Row, TileLoc.Col) +
 				ClockMod->ClockRegOff;
@@ -397,7 +409,7 @@ static void _XAie_PmUngateTiles(XAie_DevInst *DevInst, XAie_LocType FromLoc,
 
 		TileLoc.Col = FromLoc.Col;
 		TileLoc.Row = R;
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, TileLoc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, TileLoc);
 		ClockMod = DevInst->DevProp.DevMod[TileType].ClockMod;
 		RegAddr = _XAie_GetTileAddr(DevInst, TileLoc.Row, TileLoc.Col) +
 				ClockMod->ClockRegOff;
@@ -430,7 +442,7 @@ AieRC _XAie_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args)
 		NumTiles = (DevInst->NumRows - 1) * (DevInst->NumCols);
 
 		SetTileStatus = _XAie_GetTileBitPosFromLoc(DevInst, TileLoc);
-		_XAie_SetBitInBitmap(DevInst->DevOps->TilesInUse, SetTileStatus,
+		_XAie_SetBitInBitmapAtomic(DevInst->TilesInUse, SetTileStatus,
 				NumTiles);
 		_XAie_PmSetPartitionClock(DevInst, XAIE_ENABLE);
 
@@ -460,7 +472,7 @@ AieRC _XAie_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args)
 			TileLoc.Row = row;
 			CheckTileStatus = _XAie_GetTileBitPosFromLoc(DevInst,
 					TileLoc);
-			if(CheckBit(DevInst->DevOps->TilesInUse,
+			if(CheckBit(DevInst->TilesInUse,
 						CheckTileStatus)) {
 				flag = 1;
 				if(SetTileStatus > CheckTileStatus) {
@@ -491,7 +503,7 @@ AieRC _XAie_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args)
 		 * Mark the tile and below are ungated.
 		 * Assuming the row starts from 0.
 		 */
-		_XAie_SetBitInBitmap(DevInst->DevOps->TilesInUse,
+		_XAie_SetBitInBitmapAtomic(DevInst->TilesInUse,
 				SetTileStatus - Args->Locs[i].Row + 1,
 				Args->Locs[i].Row);
 	}
@@ -499,5 +511,7 @@ AieRC _XAie_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args)
 	return XAIE_OK;
 }
 
+#endif /* XAIE_DEV_AIE_ENABLE */
+
 #endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
 /** @} */
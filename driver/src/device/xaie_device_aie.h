@@ -24,12 +24,14 @@
 #define XAIE_DEVICE_AIE
 
 /***************************** Include Files *********************************/
+#include "xaie_io.h"
+
 /************************** Function Prototypes  *****************************/
 u8 _XAie_GetTTypefromLoc(XAie_DevInst *DevInst, XAie_LocType Loc);
 AieRC _XAie_SetPartColShimReset(XAie_DevInst *DevInst, u8 Enable);
 AieRC _XAie_SetPartColClockAfterRst(XAie_DevInst *DevInst, u8 Enable);
 AieRC _XAie_SetPartIsolationAfterRst(XAie_DevInst *DevInst);
-AieRC _XAie_PartMemZeroInit(XAie_DevInst *DevInst);
+AieRC _XAie_PartMemZeroInit(XAie_DevInst *DevInst, const u32 *UsedTiles);
 AieRC _XAie_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args);
 
 #endif /* XAIE_DEVICE_AIE */
@@ -26,7 +26,7 @@
 #include "xaie_clock.h"
 #include "xaie_tilectrl.h"
 
-#ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
+#if defined(XAIE_FEATURE_PRIVILEGED_ENABLE) && defined(XAIE_DEV_AIEML_ENABLE)
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -146,25 +146,11 @@ AieRC _XAieMl_SetPartColClockAfterRst(XAie_DevInst *DevInst, u8 Enable)
 ******************************************************************************/
 AieRC _XAieMl_SetPartIsolationAfterRst(XAie_DevInst *DevInst)
 {
-	AieRC RC = XAIE_OK;
-
-	for(u8 C = 0; C < DevInst->NumCols; C++) {
-		u8 Dir = 0;
-
-		if(C == 0) {
-			Dir = XAIE_ISOLATE_WEST_MASK;
-		} else if(C == (u8)(DevInst->NumCols - 1)) {
-			Dir = XAIE_ISOLATE_EAST_MASK;
-		}
+	AieRC RC;
 
-		for(u8 R = 0; R < DevInst->NumRows; R++) {
-			RC = _XAie_TileCtrlSetIsolation(DevInst,
-					XAie_TileLoc(C, R), Dir);
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("Failed to set partition isolation.\n");
-				return RC;
-			}
-		}
+	RC = _XAie_TileCtrlSetPartIsolation(DevInst, XAIE_ENABLE);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to set partition isolation.\n");
 	}
 
 	return RC;
@@ -176,6 +162,8 @@ AieRC _XAieMl_SetPartIsolationAfterRst(XAie_DevInst *DevInst)
 * This API initialize the memories of the partition to zero.
 *
 * @param	DevInst: Device Instance
+* @param	UsedTiles: Bitmap of the tiles to zeroize, in the layout of the
+*		tiles in use of the device instance. NULL for all the tiles.
 *
 * @return       XAIE_OK on success, error code on failure
 *
@@ -184,54 +172,51 @@ AieRC _XAieMl_SetPartIsolationAfterRst(XAie_DevInst *DevInst)
 *		Internal API only.
 *
 ******************************************************************************/
-AieRC _XAieMl_PartMemZeroInit(XAie_DevInst *DevInst)
+AieRC _XAieMl_PartMemZeroInit(XAie_DevInst *DevInst,
+		const u32 *UsedTiles)
 {
-	AieRC RC = XAIE_OK;
+	AieRC RC;
 	const XAie_MemCtrlMod *MCtrlMod;
-	u64 RegAddr;
-	XAie_LocType Loc;
+	u64 RegAddr = 0U;
+	u32 Mask = 0U;
 
 	for(u8 C = 0; C < DevInst->NumCols; C++) {
 		for(u8 R = 1; R < DevInst->NumRows; R++) {
-			u32 FldVal;
+			XAie_LocType Loc = XAie_TileLoc(C, R);
 			u8 TileType, NumMods;
 
-			Loc = XAie_TileLoc(C, R);
-			TileType = DevInst->DevOps->GetTTypefromLoc(DevInst,
+			if((UsedTiles != NULL) && !CheckBit(UsedTiles,
+					_XAie_GetTileBitPosFromLoc(DevInst,
+						Loc))) {
+				continue;
+			}
+
+			TileType = _XAie_DevGetTTypefromLoc(DevInst,
 					Loc);
 			NumMods = DevInst->DevProp.DevMod[TileType].NumModules;
 			MCtrlMod = DevInst->DevProp.DevMod[TileType].MemCtrlMod;
 			for (u8 M = 0; M < NumMods; M++) {
-				RegAddr = MCtrlMod->MemCtrlRegOff +
+				RegAddr = MCtrlMod[M].MemCtrlRegOff +
 					_XAie_GetTileAddr(DevInst, R, C);
-				FldVal = XAie_SetField(XAIE_ENABLE,
-					MCtrlMod->MemZeroisation.Lsb,
-					MCtrlMod->MemZeroisation.Mask);
-				RC = XAie_MaskWrite32(DevInst, RegAddr,
-					MCtrlMod->MemZeroisation.Mask,
-					FldVal);
+				Mask = MCtrlMod[M].MemZeroisation.Mask;
+				RC = XAie_MaskWrite32(DevInst, RegAddr, Mask,
+					XAie_SetField(XAIE_ENABLE,
+						MCtrlMod[M].MemZeroisation.Lsb,
+						Mask));
 				if(RC != XAIE_OK) {
 					XAIE_ERROR("Failed to zeroize partition mems.\n");
 					return RC;
 				}
-				MCtrlMod++;
-				if((C == DevInst->NumCols - 1) &&
-						(R == DevInst->NumRows - 1) &&
-						(M == NumMods - 1)) {
-					RegAddr = MCtrlMod->MemCtrlRegOff +
-						_XAie_GetTileAddr(DevInst,
-								Loc.Row,
-								Loc.Col);
-					return XAie_MaskPoll(DevInst, RegAddr,
-							MCtrlMod->MemZeroisation.Mask,
-							0, 0);
-				}
 			}
 		}
 	}
 
-	/* Code should never reach here. */
-	return XAIE_ERR;
+	if(Mask == 0U) {
+		return XAIE_OK;
+	}
+
+	/* Poll the module zeroized last */
+	return XAie_MaskPoll(DevInst, RegAddr, Mask, 0, 0);
 }
 
 /*****************************************************************************/
@@ -261,7 +246,7 @@ static AieRC _XAieMl_PmSetColumnClockBuffer(XAie_DevInst *DevInst,
 	const XAie_PlIfMod *PlIfMod;
 	const XAie_ShimClkBufCntr *ClkBufCntr;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, ShimLoc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, ShimLoc);
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
 	ClkBufCntr = PlIfMod->ClkBufCntr;
 
@@ -299,7 +284,7 @@ AieRC _XAieMl_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args)
 		NumTiles = (DevInst->NumRows - 1) * (DevInst->NumCols);
 
 		SetTileStatus = _XAie_GetTileBitPosFromLoc(DevInst, TileLoc);
-		_XAie_SetBitInBitmap(DevInst->DevOps->TilesInUse, SetTileStatus,
+		_XAie_SetBitInBitmapAtomic(DevInst->TilesInUse, SetTileStatus,
 				NumTiles);
 
 		return DevInst->DevOps->SetPartColClockAfterRst(DevInst,
@@ -318,7 +303,7 @@ AieRC _XAieMl_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args)
 		 */
 		ColClockStatus = _XAie_GetTileBitPosFromLoc(DevInst,
 				Args->Locs[i]);
-		if (CheckBit(DevInst->DevOps->TilesInUse, ColClockStatus)) {
+		if (CheckBit(DevInst->TilesInUse, ColClockStatus)) {
 			continue;
 		}
 
@@ -330,12 +315,12 @@ AieRC _XAieMl_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args)
 			return RC;
 		}
 
-		_XAie_SetBitInBitmap(DevInst->DevOps->TilesInUse,
+		_XAie_SetBitInBitmapAtomic(DevInst->TilesInUse,
 				ColClockStatus, DevInst->NumRows);
 	}
 
 	return XAIE_OK;
 }
 
-#endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
+#endif /* XAIE_FEATURE_PRIVILEGED_ENABLE && XAIE_DEV_AIEML_ENABLE */
 /** @} */
@@ -24,12 +24,15 @@
 #define XAIE_DEVICE_AIEML
 
 /***************************** Include Files *********************************/
+#include "xaie_io.h"
+
 /************************** Function Prototypes  *****************************/
 u8 _XAieMl_GetTTypefromLoc(XAie_DevInst *DevInst, XAie_LocType Loc);
 AieRC _XAieMl_SetPartColShimReset(XAie_DevInst *DevInst, u8 Enable);
 AieRC _XAieMl_SetPartColClockAfterRst(XAie_DevInst *DevInst, u8 Enable);
 AieRC _XAieMl_SetPartIsolationAfterRst(XAie_DevInst *DevInst);
-AieRC _XAieMl_PartMemZeroInit(XAie_DevInst *DevInst);
+AieRC _XAieMl_PartMemZeroInit(XAie_DevInst *DevInst,
+		const u32 *UsedTiles);
 AieRC _XAieMl_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args);
 
 #endif /* XAIE_DEVICE_AIEML */
@@ -32,8 +32,12 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
 #include <string.h>
 #include "xaie_dma.h"
+#include "xaie_dma_aie.h"
+#include "xaie_dma_aieml.h"
+#include "xaie_dma_shadow.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaiegbl_regdef.h"
@@ -47,6 +51,8 @@
 #define XAIE_SHIM_BLEN_SHIFT				0x3
 #define XAIE_DMA_CHCTRL_NUM_WORDS			2U
 #define XAIE_DMA_WAITFORDONE_DEF_WAIT_TIME_US		1000000U
+#define XAIE_DMA_WAITMULTI_SLICE_US			200U
+#define XAIE_DMA_WAITMULTI_SPAN_WORDS			16U
 
 #define XAIE_DMA_PAD_WORDS_MAX				0x3F /* 6 bits */
 /************************** Function Definitions *****************************/
@@ -77,7 +83,7 @@ AieRC XAie_DmaDescInit(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -740,6 +746,46 @@ AieRC XAie_DmaSetInterleaveEnable(XAie_DmaDesc *DmaDesc, u8 DoubleBuff,
 			IntrleaveCurr);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API writes a Dma Descriptor through the dma module of its tile type.
+* Builds for a single device generation call the function of that generation
+* directly instead of through the dma module.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline AieRC _XAie_DmaModWriteBd(XAie_DevInst *DevInst,
+		XAie_DmaDesc *DmaDesc, XAie_LocType Loc, u8 BdNum)
+{
+#if defined(XAIE_DEV_AIEML_ENABLE) && !defined(XAIE_DEV_AIE_ENABLE)
+	switch(DmaDesc->TileType) {
+	case XAIEGBL_TILE_TYPE_AIETILE:
+		return _XAieMl_TileDmaWriteBd(DevInst, DmaDesc, Loc, BdNum);
+	case XAIEGBL_TILE_TYPE_MEMTILE:
+		return _XAieMl_MemTileDmaWriteBd(DevInst, DmaDesc, Loc, BdNum);
+	default:
+		return _XAieMl_ShimDmaWriteBd(DevInst, DmaDesc, Loc, BdNum);
+	}
+#elif defined(XAIE_DEV_AIE_ENABLE) && !defined(XAIE_DEV_AIEML_ENABLE)
+	if(DmaDesc->TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+		return _XAie_TileDmaWriteBd(DevInst, DmaDesc, Loc, BdNum);
+	}
+
+	return _XAie_ShimDmaWriteBd(DevInst, DmaDesc, Loc, BdNum);
+#else
+	return DmaDesc->DmaMod->WriteBd(DevInst, DmaDesc, Loc, BdNum);
+#endif
+}
+
 /*****************************************************************************/
 /**
 *
@@ -767,7 +813,7 @@ AieRC XAie_DmaWriteBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	if(DmaDesc->TileType != DevInst->DevOps->GetTTypefromLoc(DevInst, Loc)) {
+	if(DmaDesc->TileType != _XAie_DevGetTTypefromLoc(DevInst, Loc)) {
 		XAIE_ERROR("Tile type mismatch\n");
 		return XAIE_INVALID_TILE;
 	}
@@ -778,7 +824,223 @@ AieRC XAie_DmaWriteBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 		return XAIE_INVALID_BD_NUM;
 	}
 
-	return DmaMod->WriteBd(DevInst, DmaDesc, Loc, BdNum);
+	return _XAie_DmaModWriteBd(DevInst, DmaDesc, Loc, BdNum);
+}
+
+/*
+ * Typedef to capture the register address of a buffer descriptor written by
+ * XAie_DmaWriteBds().
+ */
+typedef struct {
+	u64 Addr;
+	u32 Idx;	/* Index of the BD in the array of the caller */
+} XAie_DmaBdWriteOrder;
+
+/*****************************************************************************/
+/**
+*
+* This API compares the buffer descriptors by register address. BDs at the
+* same address are kept in the order of the caller.
+*
+* @param	A: Pointer to the first BD.
+* @param	B: Pointer to the second BD.
+*
+* @return	Negative, zero or positive as per qsort().
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static int _XAie_DmaBdWriteOrderCmp(const void *A, const void *B)
+{
+	const XAie_DmaBdWriteOrder *OA = (const XAie_DmaBdWriteOrder *)A;
+	const XAie_DmaBdWriteOrder *OB = (const XAie_DmaBdWriteOrder *)B;
+
+	if(OA->Addr != OB->Addr) {
+		return (OA->Addr < OB->Addr) ? -1 : 1;
+	}
+
+	return (OA->Idx < OB->Idx) ? -1 : (OA->Idx > OB->Idx);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a batch of Dma Descriptors to the hardware. The BD words of
+* all the descriptors are encoded first, and the BDs which are adjacent in the
+* register space of a tile are written with a single block write.
+*
+* @param	DevInst: Device Instance
+* @param	Bds: Array of the descriptors, locations and BD numbers to write.
+* @param	NumBds: Number of entries in Bds.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		All the entries are validated before any BD is written. If the
+*		same BD is listed more than once, the last entry is written.
+*		Shim BDs are handed to the backend in one batch.
+*
+******************************************************************************/
+AieRC XAie_DmaWriteBds(XAie_DevInst *DevInst, const XAie_DmaBdWrite *Bds,
+		u32 NumBds)
+{
+	AieRC RC = XAIE_OK;
+	u8 NumWords;
+	u32 *Words, NumOrder = 0U, NumShim = 0U, RunLen = 0U, Off = 0U;
+	u64 RunAddr = 0U;
+	XAie_DmaBdWriteOrder *Order;
+	XAie_ShimDmaBdArgs *ShimArgs;
+	const XAie_DmaMod *DmaMod;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Bds == XAIE_NULL) || (NumBds == 0U)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumBds; i++) {
+		const XAie_DmaDesc *DmaDesc = Bds[i].DmaDesc;
+
+		if((DmaDesc == XAIE_NULL) ||
+				(DmaDesc->IsReady != XAIE_COMPONENT_IS_READY)) {
+			XAIE_ERROR("Invalid Arguments\n");
+			return XAIE_INVALID_ARGS;
+		}
+
+		if(DmaDesc->TileType != _XAie_DevGetTTypefromLoc(DevInst,
+					Bds[i].Loc)) {
+			XAIE_ERROR("Tile type mismatch\n");
+			return XAIE_INVALID_TILE;
+		}
+
+		if(Bds[i].BdNum > DmaDesc->DmaMod->NumBds) {
+			XAIE_ERROR("Invalid BD number\n");
+			return XAIE_INVALID_BD_NUM;
+		}
+	}
+
+	Order = (XAie_DmaBdWriteOrder *)malloc(NumBds * sizeof(*Order));
+	ShimArgs = (XAie_ShimDmaBdArgs *)malloc(NumBds * sizeof(*ShimArgs));
+	Words = (u32 *)malloc(NumBds * XAIE_DMA_BD_TEMPLATE_MAX_WORDS *
+			sizeof(u32));
+	if((Order == NULL) || (ShimArgs == NULL) || (Words == NULL)) {
+		XAIE_ERROR("Memory allocation failed\n");
+		free(Order);
+		free(ShimArgs);
+		free(Words);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumBds; i++) {
+		DmaMod = Bds[i].DmaDesc->DmaMod;
+
+		if(DmaMod->EncodeBd == NULL) {
+			RC = _XAie_DmaModWriteBd(DevInst, Bds[i].DmaDesc,
+					Bds[i].Loc, Bds[i].BdNum);
+			if(RC != XAIE_OK) {
+				break;
+			}
+			continue;
+		}
+
+		/*
+		 * Shim BDs need the backend to translate the memory object,
+		 * they are handed to the backend as one batch. Their words are
+		 * kept from the end of the words buffer, the block write runs
+		 * use it from the start.
+		 */
+		if(Bds[i].DmaDesc->TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+			XAie_ShimDmaBdArgs *Args = &ShimArgs[NumShim];
+
+			Args->BdWords = &Words[(NumBds - 1U - NumShim) *
+				XAIE_DMA_BD_TEMPLATE_MAX_WORDS];
+			RC = DmaMod->EncodeBd(DevInst, Bds[i].DmaDesc,
+					Args->BdWords, &Args->NumBdWords);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Failed to encode BD %d\n",
+						Bds[i].BdNum);
+				break;
+			}
+			Args->Loc = Bds[i].Loc;
+			Args->VAddr = Bds[i].DmaDesc->AddrDesc.Address;
+			Args->BdNum = Bds[i].BdNum;
+			Args->Addr = DmaMod->BaseAddr +
+				Bds[i].BdNum * DmaMod->IdxOffset +
+				_XAie_GetTileAddr(DevInst, Bds[i].Loc.Row,
+						Bds[i].Loc.Col);
+			Args->MemInst = Bds[i].DmaDesc->MemInst;
+			NumShim++;
+			continue;
+		}
+
+		Order[NumOrder].Addr = DmaMod->BaseAddr +
+			Bds[i].BdNum * DmaMod->IdxOffset +
+			_XAie_GetTileAddr(DevInst, Bds[i].Loc.Row,
+					Bds[i].Loc.Col);
+		Order[NumOrder].Idx = i;
+		NumOrder++;
+	}
+
+	if((RC == XAIE_OK) && (NumShim != 0U)) {
+		XAie_BackendShimDmaBdBatch Batch = {ShimArgs, NumShim};
+
+		RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_SHIMDMABD_BATCH,
+				(void *)&Batch);
+	}
+	free(ShimArgs);
+
+	if(RC != XAIE_OK) {
+		free(Order);
+		free(Words);
+		return RC;
+	}
+
+	qsort(Order, NumOrder, sizeof(*Order), _XAie_DmaBdWriteOrderCmp);
+
+	for(u32 i = 0U; i < NumOrder; i++) {
+		const XAie_DmaBdWrite *Bd = &Bds[Order[i].Idx];
+
+		if((i > 0U) && (Order[i].Addr == Order[i - 1U].Addr)) {
+			/* Same BD listed again, encode over the previous one */
+		} else if((RunLen != 0U) &&
+				(Order[i].Addr == RunAddr + RunLen * 4U)) {
+			Off = RunLen;
+		} else {
+			if(RunLen != 0U) {
+				RC = XAie_BlockWrite32(DevInst, RunAddr, Words,
+						RunLen);
+				if(RC != XAIE_OK) {
+					break;
+				}
+			}
+			RunAddr = Order[i].Addr;
+			RunLen = 0U;
+			Off = 0U;
+		}
+
+		RC = Bd->DmaDesc->DmaMod->EncodeBd(DevInst, Bd->DmaDesc,
+				&Words[Off], &NumWords);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to encode BD %d\n", Bd->BdNum);
+			break;
+		}
+
+		if(Off == RunLen) {
+			RunLen += NumWords;
+		}
+	}
+
+	if((RC == XAIE_OK) && (RunLen != 0U)) {
+		RC = XAie_BlockWrite32(DevInst, RunAddr, Words, RunLen);
+	}
+
+	free(Order);
+	free(Words);
+	return RC;
 }
 
 /*****************************************************************************/
@@ -821,7 +1083,7 @@ AieRC XAie_DmaChannelReset(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
 			(TileType == XAIEGBL_TILE_TYPE_SHIMNOC)) {
 		XAIE_ERROR("Invalid Tile Type\n");
@@ -876,7 +1138,7 @@ AieRC XAie_DmaChannelResetAll(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -943,7 +1205,7 @@ AieRC XAie_DmaChannelPauseStream(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_ERR;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1006,7 +1268,7 @@ AieRC XAie_DmaChannelPauseMem(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 		return XAIE_ERR;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1065,7 +1327,7 @@ AieRC XAie_DmaChannelPushBdToQueue(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1095,6 +1357,77 @@ AieRC XAie_DmaChannelPushBdToQueue(XAie_DevInst *DevInst, XAie_LocType Loc,
 			BdNum);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API gets the dma module of a tile for the unchecked dma APIs.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number.
+*
+* @return	Pointer to the dma module.
+*
+* @note		Internal only. The arguments are only checked by debug builds.
+*
+******************************************************************************/
+static inline const XAie_DmaMod *_XAie_DmaGetModFast(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u8 BdNum)
+{
+	const XAie_DmaMod *DmaMod;
+	u8 TileType;
+
+	XAIE_ASSERT((DevInst != XAIE_NULL) &&
+			(DevInst->IsReady == XAIE_COMPONENT_IS_READY));
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	XAIE_ASSERT((TileType != XAIEGBL_TILE_TYPE_SHIMPL) &&
+			(TileType != XAIEGBL_TILE_TYPE_MAX));
+
+	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	XAIE_ASSERT(BdNum <= DmaMod->NumBds);
+	(void)BdNum;
+
+	return DmaMod;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API pushes a Buffer Descriptor onto the MM2S or S2MM Channel queue like
+* XAie_DmaChannelPushBdToQueue() without validating the arguments. It is meant
+* for hot loops over channels which the caller has already validated.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of AIE Tile
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
+* @param	BdNum: Bd number to be pushed to the queue.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Invalid arguments are undefined behavior. Builds with
+*		XAIE_DEBUG check the arguments and abort on invalid ones.
+*
+******************************************************************************/
+AieRC XAie_DmaChannelPushBdToQueueFast(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u8 ChNum, XAie_DmaDirection Dir, u8 BdNum)
+{
+	u64 Addr;
+	const XAie_DmaMod *DmaMod = _XAie_DmaGetModFast(DevInst, Loc, BdNum);
+
+	XAIE_ASSERT(Dir < DMA_MAX);
+	XAIE_ASSERT(ChNum <= DmaMod->NumChannels);
+	XAIE_ASSERT(DmaMod->BdChValidity(BdNum, ChNum) == XAIE_OK);
+
+	Addr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		DmaMod->ChCtrlBase + ChNum * DmaMod->ChIdxOffset +
+		Dir * DmaMod->ChIdxOffset * DmaMod->NumChannels;
+
+	return XAie_Write32(DevInst, Addr + (DmaMod->ChProp->StartBd.Idx * 4U),
+			BdNum);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1129,7 +1462,7 @@ static AieRC _XAie_DmaChannelControl(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1227,7 +1560,7 @@ AieRC XAie_DmaGetPendingBdCount(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1275,7 +1608,7 @@ AieRC XAie_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1294,6 +1627,252 @@ AieRC XAie_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 	return DmaMod->WaitforDone(DevInst, Loc, DmaMod, ChNum, Dir, TimeOutUs);
 }
 
+/*
+ * Typedef to capture the status register of a channel waited on by
+ * XAie_DmaWaitForDoneMulti().
+ */
+typedef struct {
+	u64 Addr;
+	u32 Mask;
+	u32 Value;
+	u32 Idx;	/* Index of the channel in the array of the caller */
+	u8 Done;
+} XAie_DmaWaitStatus;
+
+/*****************************************************************************/
+/**
+*
+* This API compares the channel status registers by address, which orders them
+* by column, row and register offset.
+*
+* @param	A: Pointer to the first status.
+* @param	B: Pointer to the second status.
+*
+* @return	Negative, zero or positive as per qsort().
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static int _XAie_DmaWaitStatusCmp(const void *A, const void *B)
+{
+	const XAie_DmaWaitStatus *SA = (const XAie_DmaWaitStatus *)A;
+	const XAie_DmaWaitStatus *SB = (const XAie_DmaWaitStatus *)B;
+
+	if(SA->Addr != SB->Addr) {
+		return (SA->Addr < SB->Addr) ? -1 : 1;
+	}
+
+	return (SA->Idx < SB->Idx) ? -1 : (SA->Idx > SB->Idx);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads the status of all the pending channels once, in address
+* order. The status registers of a tile which are close to each other are
+* read with a single block read.
+*
+* @param	DevInst: Device Instance
+* @param	Status: Array of channel status sorted by address.
+* @param	NumChs: Number of channels.
+* @param	NumDone: Pointer to the number of done channels, updated with
+*		the channels found done.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaWaitSweep(XAie_DevInst *DevInst,
+		XAie_DmaWaitStatus *Status, u32 NumChs, u32 *NumDone)
+{
+	AieRC RC;
+	u32 Span[XAIE_DMA_WAITMULTI_SPAN_WORDS];
+	u32 First, Last, NumWords;
+	u64 TileMask = ~((1ULL << DevInst->DevProp.RowShift) - 1U);
+
+	First = 0U;
+	while(First < NumChs) {
+		if(Status[First].Done != 0U) {
+			First++;
+			continue;
+		}
+
+		/* Extend the span over the pending channels of the tile */
+		Last = First;
+		for(u32 i = First + 1U; i < NumChs; i++) {
+			if(((Status[i].Addr & TileMask) !=
+					(Status[First].Addr & TileMask)) ||
+					(Status[i].Addr - Status[First].Addr >=
+					 XAIE_DMA_WAITMULTI_SPAN_WORDS * 4U)) {
+				break;
+			}
+			if(Status[i].Done == 0U) {
+				Last = i;
+			}
+		}
+
+		NumWords = (u32)((Status[Last].Addr - Status[First].Addr) /
+				4U) + 1U;
+		if(NumWords == 1U) {
+			RC = XAie_Read32(DevInst, Status[First].Addr, Span);
+		} else {
+			RC = XAie_BlockRead32(DevInst, Status[First].Addr, Span,
+					NumWords);
+		}
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		for(u32 i = First; i <= Last; i++) {
+			u32 RegVal = Span[(Status[i].Addr - Status[First].Addr) /
+				4U];
+
+			if((Status[i].Done == 0U) &&
+					((RegVal & Status[i].Mask) ==
+					 Status[i].Value)) {
+				Status[i].Done = 1U;
+				(*NumDone)++;
+			}
+		}
+
+		First = Last + 1U;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API is used to wait on multiple DMA channels to be completed. The status
+* registers of all the pending channels are read in one sweep, in column
+* order, until all or any of the channels are done.
+*
+* @param	DevInst: Device Instance
+* @param	Chs: Array of the DMA channels to wait on.
+* @param	NumChs: Number of channels in Chs.
+* @param	WaitAll: XAIE_ENABLE to wait for all the channels, XAIE_DISABLE
+*		to return once any of them is done.
+* @param	Done: Optional array of NumChs entries to return XAIE_ENABLE for
+*		the channels found done and XAIE_DISABLE for the others. NULL
+*		if not required.
+* @param        TimeOutUs - Minimum timeout value in micro seconds. 0 to use
+*		the default timeout of XAie_DmaWaitForDone().
+*
+* @return	XAIE_OK on success, XAIE_ERR on timeout and error code on
+*		failure.
+*
+* @note		Between two sweeps, the API polls the first pending channel
+*		for a short time with the poll strategy of the backend. It
+*		cannot be recorded in a transaction without auto flush, use
+*		XAie_DmaWaitForDone() for each channel instead.
+*
+******************************************************************************/
+AieRC XAie_DmaWaitForDoneMulti(XAie_DevInst *DevInst,
+		const XAie_DmaWaitCh *Chs, u32 NumChs, u8 WaitAll, u8 *Done,
+		u32 TimeOutUs)
+{
+	AieRC RC;
+	u8 TileType;
+	u32 NumDone = 0U, Pending = 0U;
+	u64 ElapsedUs = 0U;
+	const XAie_DmaMod *DmaMod;
+	XAie_DmaWaitStatus *Status;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Chs == NULL) || (NumChs == 0U)) {
+		XAIE_ERROR("Invalid DMA channel array\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Status = (XAie_DmaWaitStatus *)malloc(sizeof(*Status) * NumChs);
+	if(Status == NULL) {
+		XAIE_ERROR("Memory allocation for channel status failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumChs; i++) {
+		if(Chs[i].Dir >= DMA_MAX) {
+			XAIE_ERROR("Invalid DMA direction\n");
+			free(Status);
+			return XAIE_INVALID_ARGS;
+		}
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				Chs[i].Loc);
+		if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
+				(TileType == XAIEGBL_TILE_TYPE_MAX)) {
+			XAIE_ERROR("Invalid Tile Type\n");
+			free(Status);
+			return XAIE_INVALID_TILE;
+		}
+
+		DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+		if(Chs[i].ChNum >= DmaMod->NumChannels) {
+			XAIE_ERROR("Invalid Channel number\n");
+			free(Status);
+			return XAIE_INVALID_CHANNEL_NUM;
+		}
+
+		DmaMod->DoneStatus(DevInst, Chs[i].Loc, DmaMod, Chs[i].ChNum,
+				Chs[i].Dir, &Status[i].Addr, &Status[i].Mask,
+				&Status[i].Value);
+		Status[i].Idx = i;
+		Status[i].Done = 0U;
+	}
+
+	qsort(Status, NumChs, sizeof(*Status), _XAie_DmaWaitStatusCmp);
+
+	if(TimeOutUs == 0U) {
+		TimeOutUs = XAIE_DMA_WAITFORDONE_DEF_WAIT_TIME_US;
+	}
+
+	while(1) {
+		RC = _XAie_DmaWaitSweep(DevInst, Status, NumChs, &NumDone);
+		if(RC != XAIE_OK) {
+			break;
+		}
+
+		if((NumDone == NumChs) ||
+				((WaitAll == XAIE_DISABLE) && (NumDone > 0U))) {
+			break;
+		}
+
+		if(ElapsedUs >= TimeOutUs) {
+			XAIE_DBG("Wait for done timed out\n");
+			RC = XAIE_ERR;
+			break;
+		}
+
+		while(Status[Pending].Done != 0U) {
+			Pending++;
+		}
+
+		/* Only the slices which time out are accounted */
+		if(XAie_MaskPoll(DevInst, Status[Pending].Addr,
+					Status[Pending].Mask, Status[Pending].Value,
+					XAIE_DMA_WAITMULTI_SLICE_US) != XAIE_OK) {
+			ElapsedUs += XAIE_DMA_WAITMULTI_SLICE_US;
+		}
+	}
+
+	if(Done != NULL) {
+		for(u32 i = 0U; i < NumChs; i++) {
+			Done[Status[i].Idx] = Status[i].Done ? XAIE_ENABLE :
+				XAIE_DISABLE;
+		}
+	}
+
+	free(Status);
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1319,7 +1898,7 @@ AieRC XAie_DmaGetMaxQueueSize(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1406,7 +1985,7 @@ AieRC XAie_DmaChannelSetStartQueueGeneric(XAie_DevInst *DevInst,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL ||
 		TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type to start queue\n");
@@ -1494,7 +2073,7 @@ AieRC XAie_DmaUpdateBdLen(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Len,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1540,7 +2119,7 @@ AieRC XAie_DmaUpdateBdAddr(XAie_DevInst *DevInst, XAie_LocType Loc, u64 Addr,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1564,8 +2143,287 @@ AieRC XAie_DmaUpdateBdAddr(XAie_DevInst *DevInst, XAie_LocType Loc, u64 Addr,
 /*****************************************************************************/
 /**
 *
-* This API initializes the Dma Channel Descriptor for AIE DMAs for a given
-* location.
+* This API updates the length of the buffer descriptor like
+* XAie_DmaUpdateBdLen() without validating the arguments. It is meant for hot
+* loops over BDs which the caller has already validated.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of AIE Tile
+* @param	Len: Length of BD in bytes.
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Invalid arguments are undefined behavior. Builds with
+*		XAIE_DEBUG check the arguments and abort on invalid ones.
+*
+******************************************************************************/
+AieRC XAie_DmaUpdateBdLenFast(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u32 Len, u8 BdNum)
+{
+	const XAie_DmaMod *DmaMod = _XAie_DmaGetModFast(DevInst, Loc, BdNum);
+
+	return DmaMod->UpdateBdLen(DevInst, DmaMod, Loc,
+			(Len >> XAIE_DMA_32BIT_TXFER_LEN) -
+			DmaMod->BdProp->LenActualOffset, BdNum);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API updates the address of the buffer descriptor like
+* XAie_DmaUpdateBdAddr() without validating the arguments. It is meant for hot
+* loops over BDs which the caller has already validated.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of AIE Tile
+* @param	Addr: Buffer address
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Invalid arguments are undefined behavior. Builds with
+*		XAIE_DEBUG check the arguments and abort on invalid ones.
+*
+******************************************************************************/
+AieRC XAie_DmaUpdateBdAddrFast(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u64 Addr, u8 BdNum)
+{
+	const XAie_DmaMod *DmaMod = _XAie_DmaGetModFast(DevInst, Loc, BdNum);
+
+	XAIE_ASSERT(((Addr & DmaMod->BdProp->AddrAlignMask) == 0U) &&
+			(Addr <= DmaMod->BdProp->AddrMax));
+
+	return DmaMod->UpdateBdAddr(DevInst, DmaMod, Loc, Addr, BdNum);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API binds the memory object relative addresses of a batch of shim BDs.
+* The backend translates the address of a BD only when the whole BD is handed
+* to it, so the words of each BD are taken from the BD shadow, or read back
+* from the hardware, patched with the new address and handed to the backend
+* in one batch.
+*
+* @param	DevInst: Device Instance.
+* @param	Bds: Array of the BD addresses.
+* @param	NumBds: Number of entries in Bds.
+* @param	NumMem: Number of entries in Bds with a memory object.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaUpdateBdAddrsMem(XAie_DevInst *DevInst,
+		const XAie_DmaBdAddr *Bds, u32 NumBds, u32 NumMem)
+{
+	AieRC RC = XAIE_OK;
+	u32 *Words, n = 0U;
+	XAie_ShimDmaBdArgs *Args;
+	XAie_BackendShimDmaBdBatch Batch;
+	const XAie_DmaMod *DmaMod;
+	const XAie_DmaBdProp *BdProp;
+
+	DmaMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_SHIMNOC].DmaMod;
+	BdProp = DmaMod->BdProp;
+
+	Args = (XAie_ShimDmaBdArgs *)malloc(NumMem * sizeof(*Args));
+	Words = (u32 *)malloc(NumMem * XAIE_DMA_BD_TEMPLATE_MAX_WORDS *
+			sizeof(u32));
+	if((Args == NULL) || (Words == NULL)) {
+		XAIE_ERROR("Memory allocation failed\n");
+		free(Args);
+		free(Words);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; (i < NumBds) && (RC == XAIE_OK); i++) {
+		XAie_ShimDmaBdArgs *Arg = &Args[n];
+		u32 *BdWords = &Words[n * XAIE_DMA_BD_TEMPLATE_MAX_WORDS];
+		u64 Addr = Bds[i].Addr;
+		u8 NumWords = 0U;
+		u8 Low = BdProp->Buffer->ShimDmaBuff.AddrLow.Idx;
+		u8 High = BdProp->Buffer->ShimDmaBuff.AddrHigh.Idx;
+
+		if(Bds[i].MemInst == XAIE_NULL) {
+			continue;
+		}
+
+		Arg->Addr = DmaMod->BaseAddr + Bds[i].BdNum * DmaMod->IdxOffset +
+			_XAie_GetTileAddr(DevInst, Bds[i].Loc.Row,
+					Bds[i].Loc.Col);
+
+		if(DevInst->BdShadow != NULL) {
+			RC = XAie_DmaGetShadowBd(DevInst, Bds[i].Loc,
+					Bds[i].BdNum, BdWords, &NumWords);
+		}
+
+		if((RC == XAIE_OK) && (NumWords == 0U)) {
+			/* Not in the shadow, read the BD back */
+			NumWords = (u8)(DmaMod->IdxOffset / 4U);
+			for(u8 j = 0U; (j < NumWords) && (RC == XAIE_OK); j++) {
+				RC = XAie_Read32(DevInst, Arg->Addr + j * 4U,
+						&BdWords[j]);
+			}
+		}
+
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to get words of BD %d\n",
+					Bds[i].BdNum);
+			break;
+		}
+
+		BdWords[Low] = (BdWords[Low] &
+				~BdProp->Buffer->ShimDmaBuff.AddrLow.Mask) |
+			XAie_SetField(Addr >>
+					BdProp->Buffer->ShimDmaBuff.AddrLow.Lsb,
+				BdProp->Buffer->ShimDmaBuff.AddrLow.Lsb,
+				BdProp->Buffer->ShimDmaBuff.AddrLow.Mask);
+		BdWords[High] = (BdWords[High] &
+				~BdProp->Buffer->ShimDmaBuff.AddrHigh.Mask) |
+			XAie_SetField(Addr >> 32U,
+				BdProp->Buffer->ShimDmaBuff.AddrHigh.Lsb,
+				BdProp->Buffer->ShimDmaBuff.AddrHigh.Mask);
+
+		Arg->MemInst = Bds[i].MemInst;
+		Arg->NumBdWords = NumWords;
+		Arg->BdWords = BdWords;
+		Arg->Loc = Bds[i].Loc;
+		Arg->VAddr = Addr;
+		Arg->BdNum = Bds[i].BdNum;
+		n++;
+	}
+
+	if(RC == XAIE_OK) {
+		Batch.BdArgs = Args;
+		Batch.NumBds = n;
+		RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_SHIMDMABD_BATCH,
+				(void *)&Batch);
+	}
+
+	free(Args);
+	free(Words);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API updates the addresses of a batch of buffer descriptors, like
+* XAie_DmaUpdateBdAddr() for each of them. All the entries are validated
+* before any BD is updated. The address writes are recorded in one transaction
+* and submitted at once, unless the calling thread is already recording a
+* transaction, and the BDs with a memory object are handed to the backend in
+* one batch.
+*
+* @param	DevInst: Device Instance.
+* @param	Bds: Array of the locations, BD numbers and addresses.
+* @param	NumBds: Number of entries in Bds.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		This API accesses the hardware directly and does not operate
+*		on software descriptors. The BDs with a memory object are
+*		written in full, with their other words taken from the BD
+*		shadow if it holds them or read back from the hardware.
+*
+******************************************************************************/
+AieRC XAie_DmaUpdateBdAddrs(XAie_DevInst *DevInst, const XAie_DmaBdAddr *Bds,
+		u32 NumBds)
+{
+	AieRC RC = XAIE_OK, SubmitRC;
+	u32 NumMem = 0U;
+	u8 OwnTxn = XAIE_DISABLE;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Bds == XAIE_NULL) || (NumBds == 0U)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumBds; i++) {
+		const XAie_DmaMod *DmaMod;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Bds[i].Loc);
+		if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
+				(TileType >= XAIEGBL_TILE_TYPE_MAX)) {
+			XAIE_ERROR("Invalid Tile Type\n");
+			return XAIE_INVALID_TILE;
+		}
+
+		DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+		if(Bds[i].BdNum >= DmaMod->NumBds) {
+			XAIE_ERROR("Invalid BD number\n");
+			return XAIE_INVALID_BD_NUM;
+		}
+
+		if(((Bds[i].Addr & DmaMod->BdProp->AddrAlignMask) != 0U) ||
+				(Bds[i].Addr > DmaMod->BdProp->AddrMax)) {
+			XAIE_ERROR("Invalid Address\n");
+			return XAIE_INVALID_ADDRESS;
+		}
+
+		if(Bds[i].MemInst != XAIE_NULL) {
+			if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) ||
+					(Bds[i].Addr >= Bds[i].MemInst->Size)) {
+				XAIE_ERROR("Invalid memory object offset\n");
+				return XAIE_INVALID_ADDRESS;
+			}
+			NumMem++;
+		}
+	}
+
+	if((NumMem < NumBds) && (_XAie_TxnIsActive(DevInst) == XAIE_DISABLE)) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	for(u32 i = 0U; (i < NumBds) && (RC == XAIE_OK); i++) {
+		const XAie_DmaMod *DmaMod;
+
+		if(Bds[i].MemInst != XAIE_NULL) {
+			continue;
+		}
+
+		DmaMod = DevInst->DevProp.DevMod[_XAie_DevGetTTypefromLoc(
+				DevInst, Bds[i].Loc)].DmaMod;
+		RC = DmaMod->UpdateBdAddr(DevInst, DmaMod, Bds[i].Loc,
+				Bds[i].Addr, Bds[i].BdNum);
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		/* Submit even on failure, the transaction has to be released */
+		SubmitRC = _XAie_Txn_Submit(DevInst, NULL);
+		if(RC == XAIE_OK) {
+			RC = SubmitRC;
+		}
+	}
+
+	if((RC == XAIE_OK) && (NumMem != 0U)) {
+		RC = _XAie_DmaUpdateBdAddrsMem(DevInst, Bds, NumBds, NumMem);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes the Dma Channel Descriptor for AIE DMAs for a given
+* location.
 *
 * @param	DevInst: Device Instance.
 * @param	DmaChannelDesc: Pointer to user allocated dma channel descriptor
@@ -1590,7 +2448,7 @@ AieRC XAie_DmaChannelDescInit(XAie_DevInst *DevInst,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1816,7 +2674,7 @@ AieRC XAie_DmaWriteChannel(XAie_DevInst *DevInst,
 		return XAIE_INVALID_DMA_DESC;
 	}
 
-	if(DmaChannelDesc->TileType != DevInst->DevOps->GetTTypefromLoc(DevInst, Loc)) {
+	if(DmaChannelDesc->TileType != _XAie_DevGetTTypefromLoc(DevInst, Loc)) {
 		XAIE_ERROR("Tile type mismatch\n");
 		return XAIE_INVALID_TILE;
 	}
@@ -2039,5 +2897,254 @@ AieRC XAie_DmaTlastDisable(XAie_DmaDesc *DmaDesc)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API initializes a buffer descriptor template from a Dma Descriptor. The
+* Dma Descriptor is encoded once into the BD register image held by the
+* template, which can be written to any BD of the same tile type afterwards.
+*
+* @param	DevInst: Device Instance
+* @param	Tmpl: Pointer to the user allocated BD template.
+* @param	DmaDesc: Initialized Dma Descriptor.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The Dma Descriptor is not referenced by the template once this
+*		API returns.
+*
+******************************************************************************/
+AieRC XAie_DmaBdTemplateInit(XAie_DevInst *DevInst, XAie_DmaBdTemplate *Tmpl,
+		XAie_DmaDesc *DmaDesc)
+{
+	AieRC RC;
+	const XAie_DmaMod *DmaMod;
+
+	if((DevInst == XAIE_NULL) || (Tmpl == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance or BD template\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((DmaDesc == XAIE_NULL) ||
+			(DmaDesc->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	DmaMod = DmaDesc->DmaMod;
+	if(DmaMod->EncodeBd == NULL) {
+		XAIE_ERROR("BD templates are not supported for the tile type\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	Tmpl->IsReady = 0U;
+	RC = DmaMod->EncodeBd(DevInst, DmaDesc, Tmpl->BdWord, &Tmpl->NumWords);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to encode the BD template\n");
+		return RC;
+	}
+
+	Tmpl->DmaMod = DmaMod;
+	Tmpl->MemInst = DmaDesc->MemInst;
+	Tmpl->VAddr = DmaDesc->AddrDesc.Address;
+	Tmpl->TileType = DmaDesc->TileType;
+	Tmpl->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API validates a BD template against the location and BD number it is
+* about to be written to.
+*
+* @param	DevInst: Device Instance
+* @param	Tmpl: Initialized BD template.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaBdTemplateCheck(XAie_DevInst *DevInst,
+		const XAie_DmaBdTemplate *Tmpl, XAie_LocType Loc, u8 BdNum)
+{
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Tmpl == XAIE_NULL) || (Tmpl->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid BD template\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Tmpl->TileType != _XAie_DevGetTTypefromLoc(DevInst, Loc)) {
+		XAIE_ERROR("Tile type mismatch\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	if(BdNum >= Tmpl->DmaMod->NumBds) {
+		XAIE_ERROR("Invalid BD number\n");
+		return XAIE_INVALID_BD_NUM;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the full register image of a BD template to a buffer
+* descriptor in the hardware.
+*
+* @param	DevInst: Device Instance
+* @param	Tmpl: Initialized BD template.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The BD words are written as a single block write for the tile
+*		and mem tile dmas.
+*
+******************************************************************************/
+AieRC XAie_DmaBdTemplateWrite(XAie_DevInst *DevInst,
+		const XAie_DmaBdTemplate *Tmpl, XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	u64 Addr;
+	u32 BdWord[XAIE_DMA_BD_TEMPLATE_MAX_WORDS];
+	XAie_ShimDmaBdArgs Args;
+	const XAie_DmaMod *DmaMod;
+
+	RC = _XAie_DmaBdTemplateCheck(DevInst, Tmpl, Loc, BdNum);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	DmaMod = Tmpl->DmaMod;
+	Addr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	if(Tmpl->TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
+		return XAie_BlockWrite32(DevInst, Addr, Tmpl->BdWord,
+				Tmpl->NumWords);
+	}
+
+	/* Shim BDs go through the backend to translate the memory object */
+	memcpy(BdWord, Tmpl->BdWord, Tmpl->NumWords * sizeof(u32));
+	Args.NumBdWords = Tmpl->NumWords;
+	Args.BdWords = &BdWord[0U];
+	Args.Loc = Loc;
+	Args.VAddr = Tmpl->VAddr;
+	Args.BdNum = BdNum;
+	Args.Addr = Addr;
+	Args.MemInst = Tmpl->MemInst;
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_SHIMDMABD,
+			(void *)&Args);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API updates the address and the length of a buffer descriptor which was
+* written from a BD template. Only the BD words holding the address and the
+* length fields are written, and the remaining fields of these words are taken
+* from the template image, so no register is read back.
+*
+* @param	DevInst: Device Instance
+* @param	Tmpl: Initialized BD template.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be updated.
+* @param	Addr: Buffer address.
+* @param	Len: Length of the buffer in bytes.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The BD is expected to hold the template image, written with
+*		XAie_DmaBdTemplateWrite(). For shim dmas, Addr is the address
+*		seen by the dma. Patches of many BDs can be batched by issuing
+*		them within a transaction.
+*
+******************************************************************************/
+AieRC XAie_DmaBdTemplatePatch(XAie_DevInst *DevInst,
+		const XAie_DmaBdTemplate *Tmpl, XAie_LocType Loc, u8 BdNum,
+		u64 Addr, u32 Len)
+{
+	AieRC RC;
+	u64 BdAddr, Address;
+	u32 BdWord[XAIE_DMA_BD_TEMPLATE_MAX_WORDS];
+	u32 Length, Dirty = 0U;
+	const XAie_DmaMod *DmaMod;
+	const XAie_DmaBdBuffer *Buffer;
+	const XAie_RegBdFldAttr *Fld;
+
+	RC = _XAie_DmaBdTemplateCheck(DevInst, Tmpl, Loc, BdNum);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	DmaMod = Tmpl->DmaMod;
+	if(((Addr & DmaMod->BdProp->AddrAlignMask) != 0U) ||
+			((Addr + Len) > DmaMod->BdProp->AddrMax)) {
+		XAIE_ERROR("Invalid Address\n");
+		return XAIE_INVALID_ADDRESS;
+	}
+
+	Address = Addr >> DmaMod->BdProp->AddrAlignShift;
+	Length = (Len >> XAIE_DMA_32BIT_TXFER_LEN) -
+		DmaMod->BdProp->LenActualOffset;
+	Buffer = DmaMod->BdProp->Buffer;
+
+	memcpy(BdWord, Tmpl->BdWord, Tmpl->NumWords * sizeof(u32));
+	if(Tmpl->TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+		Fld = &Buffer->ShimDmaBuff.AddrLow;
+		BdWord[Fld->Idx] = (BdWord[Fld->Idx] & ~Fld->Mask) |
+			XAie_SetField(Address >> Fld->Lsb, Fld->Lsb, Fld->Mask);
+		Dirty |= 1U << Fld->Idx;
+
+		Fld = &Buffer->ShimDmaBuff.AddrHigh;
+		BdWord[Fld->Idx] = (BdWord[Fld->Idx] & ~Fld->Mask) |
+			XAie_SetField(Address >> 32U, Fld->Lsb, Fld->Mask);
+		Dirty |= 1U << Fld->Idx;
+
+		Fld = &Buffer->ShimDmaBuff.BufferLen;
+	} else {
+		Fld = &Buffer->TileDmaBuff.BaseAddr;
+		BdWord[Fld->Idx] = (BdWord[Fld->Idx] & ~Fld->Mask) |
+			XAie_SetField(Address, Fld->Lsb, Fld->Mask);
+		Dirty |= 1U << Fld->Idx;
+
+		Fld = &Buffer->TileDmaBuff.BufferLen;
+	}
+	BdWord[Fld->Idx] = (BdWord[Fld->Idx] & ~Fld->Mask) |
+		XAie_SetField(Length, Fld->Lsb, Fld->Mask);
+	Dirty |= 1U << Fld->Idx;
+
+	BdAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	for(u8 i = 0U; i < Tmpl->NumWords; i++) {
+		if((Dirty & (1U << i)) == 0U) {
+			continue;
+		}
+
+		RC = XAie_Write32(DevInst, BdAddr + i * 4U, BdWord[i]);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to patch BD word %d\n", i);
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
 #endif /* XAIE_FEATURE_DMA_ENABLE */
 /** @} */
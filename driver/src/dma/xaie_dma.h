@@ -30,6 +30,9 @@
 #include "xaiegbl.h"
 #include "xaiegbl_defs.h"
 
+/************************** Constant Definitions *****************************/
+#define XAIE_DMA_BD_TEMPLATE_MAX_WORDS	8U
+
 /**************************** Type Definitions *******************************/
 /*
  * This enum captures the DMA Fifo Counters
@@ -40,6 +43,54 @@ typedef enum {
 	XAIE_DMA_FIFO_COUNTER_1 = 3U,
 } XAie_DmaFifoCounter;
 
+/*
+ * This typedef captures a DMA channel to wait on with
+ * XAie_DmaWaitForDoneMulti().
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u8 ChNum;
+	XAie_DmaDirection Dir;
+} XAie_DmaWaitCh;
+
+/*
+ * This typedef captures a buffer descriptor to be written with
+ * XAie_DmaWriteBds().
+ */
+typedef struct {
+	XAie_DmaDesc *DmaDesc;
+	XAie_LocType Loc;
+	u8 BdNum;
+} XAie_DmaBdWrite;
+
+/*
+ * This typedef captures a buffer address to be bound to a BD with
+ * XAie_DmaUpdateBdAddrs(). If MemInst is not NULL, Addr is the offset of the
+ * buffer in the memory object, which is supported for shim BDs only.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u8 BdNum;
+	u64 Addr;
+	XAie_MemInst *MemInst;
+} XAie_DmaBdAddr;
+
+/*
+ * This typedef captures a DMA buffer descriptor template. The template holds
+ * the encoded register image of a buffer descriptor so that it can be written
+ * to many BDs, and only the address and length words are rewritten when the
+ * buffer changes. The template is initialized with XAie_DmaBdTemplateInit().
+ */
+typedef struct {
+	const XAie_DmaMod *DmaMod;
+	XAie_MemInst *MemInst;
+	u64 VAddr;
+	u32 BdWord[XAIE_DMA_BD_TEMPLATE_MAX_WORDS];
+	u8 NumWords;
+	u8 TileType;
+	u8 IsReady;
+} XAie_DmaBdTemplate;
+
 /************************** Function Prototypes  *****************************/
 
 /*****************************************************************************/
@@ -98,6 +149,8 @@ AieRC XAie_DmaSetInterleaveEnable(XAie_DmaDesc *DmaDesc, u8 DoubleBuff,
 		u8 IntrleaveCount, u16 IntrleaveCurr);
 AieRC XAie_DmaWriteBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum);
+AieRC XAie_DmaWriteBds(XAie_DevInst *DevInst, const XAie_DmaBdWrite *Bds,
+		u32 NumBds);
 AieRC XAie_DmaChannelResetAll(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_DmaChReset Reset);
 AieRC XAie_DmaChannelReset(XAie_DevInst *DevInst, XAie_LocType Loc,
@@ -108,12 +161,17 @@ AieRC XAie_DmaChannelPauseMem(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 		XAie_DmaDirection Dir, u8 Pause);
 AieRC XAie_DmaChannelPushBdToQueue(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u8 ChNum, XAie_DmaDirection Dir, u8 BdNum);
+AieRC XAie_DmaChannelPushBdToQueueFast(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u8 ChNum, XAie_DmaDirection Dir, u8 BdNum);
 AieRC XAie_DmaChannelEnable(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 		XAie_DmaDirection Dir);
 AieRC XAie_DmaChannelDisable(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 		XAie_DmaDirection Dir);
 AieRC XAie_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 		XAie_DmaDirection Dir, u32 TimeOutUs);
+AieRC XAie_DmaWaitForDoneMulti(XAie_DevInst *DevInst,
+		const XAie_DmaWaitCh *Chs, u32 NumChs, u8 WaitAll, u8 *Done,
+		u32 TimeOutUs);
 AieRC XAie_DmaGetPendingBdCount(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u8 ChNum, XAie_DmaDirection Dir, u8 *PendingBd);
 AieRC XAie_DmaGetMaxQueueSize(XAie_DevInst *DevInst, XAie_LocType Loc,
@@ -145,5 +203,18 @@ AieRC XAie_DmaUpdateBdLen(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Len,
 		u8 BdNum);
 AieRC XAie_DmaUpdateBdAddr(XAie_DevInst *DevInst, XAie_LocType Loc, u64 Addr,
 		u8 BdNum);
+AieRC XAie_DmaUpdateBdLenFast(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u32 Len, u8 BdNum);
+AieRC XAie_DmaUpdateBdAddrFast(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u64 Addr, u8 BdNum);
+AieRC XAie_DmaUpdateBdAddrs(XAie_DevInst *DevInst, const XAie_DmaBdAddr *Bds,
+		u32 NumBds);
+AieRC XAie_DmaBdTemplateInit(XAie_DevInst *DevInst, XAie_DmaBdTemplate *Tmpl,
+		XAie_DmaDesc *DmaDesc);
+AieRC XAie_DmaBdTemplateWrite(XAie_DevInst *DevInst,
+		const XAie_DmaBdTemplate *Tmpl, XAie_LocType Loc, u8 BdNum);
+AieRC XAie_DmaBdTemplatePatch(XAie_DevInst *DevInst,
+		const XAie_DmaBdTemplate *Tmpl, XAie_LocType Loc, u8 BdNum,
+		u64 Addr, u32 Len);
 
 #endif		/* end of protection macro */
@@ -28,7 +28,7 @@
 #include "xaiegbl.h"
 #include "xaiegbl_regdef.h"
 
-#ifdef XAIE_FEATURE_DMA_ENABLE
+#if defined(XAIE_FEATURE_DMA_ENABLE) && defined(XAIE_DEV_AIE_ENABLE)
 
 /************************** Constant Definitions *****************************/
 #define XAIE_DMA_TILEDMA_2DX_DEFAULT_INCR		0U
@@ -199,35 +199,30 @@ AieRC _XAie_DmaSetInterleaveEnable(XAie_DmaDesc *DmaDesc, u8 DoubleBuff,
 /*****************************************************************************/
 /**
 *
-* This API writes a Dma Descriptor which is initialized and setup by other APIs
-* into the corresponding registers and register fields in the hardware. This API
-* is specific to AIE Shim Tiles only.
+* This API encodes a Dma Descriptor which is initialized and setup by other APIs
+* into the buffer descriptor register words. This API is specific to
+* AIE Shim Tiles only.
 *
 * @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
-* @param	Loc: Location of AIE Tile
-* @param	BdNum: Hardware BD number to be written to.
+* @param	BdWord: Pointer to the buffer to return the BD words. The buffer
+*		must be large enough to hold all the BD words of the tile.
+* @param	NumWords: Pointer to return the number of BD words encoded.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only. For AIE Shim Tiles only.
 *
 ******************************************************************************/
-AieRC _XAie_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
-		XAie_LocType Loc, u8 BdNum)
+AieRC _XAie_ShimDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		u32 *BdWord, u8 *NumWords)
 {
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIE_SHIMDMA_NUM_BD_WORDS];
-	XAie_ShimDmaBdArgs Args;
 	const XAie_DmaMod *DmaMod;
 	const XAie_DmaBdProp *BdProp;
 
 	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
 	BdProp = DmaMod->BdProp;
 
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
-
 	BdWord[0U] = XAie_SetField(DmaDesc->AddrDesc.Address,
 			BdProp->Buffer->ShimDmaBuff.AddrLow.Lsb,
 			BdProp->Buffer->ShimDmaBuff.AddrLow.Mask);
@@ -294,9 +289,48 @@ AieRC _XAie_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->Pkt->EnPkt.Lsb,
 				BdProp->Pkt->EnPkt.Mask);
 
-	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	*NumWords = XAIE_SHIMDMA_NUM_BD_WORDS;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a Dma Descriptor which is initialized and setup by other APIs
+* into the corresponding registers and register fields in the hardware. This API
+* is specific to AIE Shim Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIE Shim Tiles only.
+*
+******************************************************************************/
+AieRC _XAie_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	u64 Addr;
+	u8 NumWords;
+	u32 BdWord[XAIE_SHIMDMA_NUM_BD_WORDS];
+	XAie_ShimDmaBdArgs Args;
+	const XAie_DmaMod *DmaMod;
+
+	RC = _XAie_ShimDmaEncodeBd(DevInst, DmaDesc, BdWord, &NumWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	Addr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
-	Args.NumBdWords = XAIE_SHIMDMA_NUM_BD_WORDS;
+	Args.NumBdWords = NumWords;
 	Args.BdWords = &BdWord[0U];
 	Args.Loc = Loc;
 	Args.VAddr = DmaDesc->AddrDesc.Address;
@@ -312,35 +346,30 @@ AieRC _XAie_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 /*****************************************************************************/
 /**
 *
-* This API writes a Dma Descriptor which is initialized and setup by other APIs
-* into the corresponding registers and register fields in the hardware. This API
-* is specific to AIE Tiles only.
+* This API encodes a Dma Descriptor which is initialized and setup by other APIs
+* into the buffer descriptor register words. This API is specific to
+* AIE Tiles only.
 *
 * @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
-* @param	Loc: Location of AIE Tile
-* @param	BdNum: Hardware BD number to be written to.
+* @param	BdWord: Pointer to the buffer to return the BD words. The buffer
+*		must be large enough to hold all the BD words of the tile.
+* @param	NumWords: Pointer to return the number of BD words encoded.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only. For AIE Tiles only.
 *
 ******************************************************************************/
-AieRC _XAie_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
-		XAie_LocType Loc, u8 BdNum)
+AieRC _XAie_TileDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		u32 *BdWord, u8 *NumWords)
 {
-	AieRC RC;
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIE_TILEDMA_NUM_BD_WORDS];
 	const XAie_DmaMod *DmaMod;
 	const XAie_DmaBdProp *BdProp;
 
 	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
 	BdProp = DmaMod->BdProp;
 
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
-
 	/* AcqLockId and RelLockId are the same in AIE */
 	BdWord[0U] = XAie_SetField(DmaDesc->LockDesc.LockAcqId,
 			BdProp->Lock->AieDmaLock.LckId_A.Lsb,
@@ -454,9 +483,47 @@ AieRC _XAie_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->Buffer->TileDmaBuff.BufferLen.Lsb,
 				BdProp->Buffer->TileDmaBuff.BufferLen.Mask);
 
-	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	*NumWords = XAIE_TILEDMA_NUM_BD_WORDS;
 
-	for(u8 i = 0U; i < XAIE_TILEDMA_NUM_BD_WORDS; i++) {
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a Dma Descriptor which is initialized and setup by other APIs
+* into the corresponding registers and register fields in the hardware. This API
+* is specific to AIE Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIE Tiles only.
+*
+******************************************************************************/
+AieRC _XAie_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	u64 Addr;
+	u8 NumWords;
+	u32 BdWord[XAIE_TILEDMA_NUM_BD_WORDS];
+	const XAie_DmaMod *DmaMod;
+
+	RC = _XAie_TileDmaEncodeBd(DevInst, DmaDesc, BdWord, &NumWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	Addr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	for(u8 i = 0U; i < NumWords; i++) {
 		RC = XAie_Write32(DevInst, Addr + i * 4U, BdWord[i]);
 		if(RC != XAIE_OK) {
 			return RC;
@@ -525,6 +592,41 @@ AieRC _XAie_DmaGetPendingBdCount(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API returns the status register of a DMA channel along with the mask
+* and value the register reads once the channel is done.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	DmaMod: Dma module pointer
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
+* @param	Addr: Pointer to return the address of the status register.
+* @param	Mask: Pointer to return the mask of the status bits.
+* @param	Value: Pointer to return the value of a done channel.
+*
+* @return	None.
+*
+* @note		Internal only. For AIE Tiles only.
+*
+******************************************************************************/
+void _XAie_DmaGetDoneStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
+		u64 *Addr, u32 *Mask, u32 *Value)
+{
+	*Addr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		DmaMod->ChStatusBase + Dir * DmaMod->ChStatusOffset;
+	*Mask = DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.Status.Mask |
+		DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.StartQSize.Mask |
+		DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.Stalled.Mask;
+
+	/* This will check the stalled and start queue size bits to be zero */
+	*Value = XAIE_DMA_STATUS_IDLE <<
+		DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.Status.Lsb;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -549,15 +651,8 @@ AieRC _XAie_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
 	u64 Addr;
 	u32 Mask, Value;
 
-	Addr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
-		DmaMod->ChStatusBase + Dir * DmaMod->ChStatusOffset;
-	Mask = DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.Status.Mask |
-		DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.StartQSize.Mask |
-		DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.Stalled.Mask;
-
-	/* This will check the stalled and start queue size bits to be zero */
-	Value = XAIE_DMA_STATUS_IDLE <<
-		DmaMod->ChProp->DmaChStatus[ChNum].AieDmaChStatus.Status.Lsb;
+	_XAie_DmaGetDoneStatus(DevInst, Loc, DmaMod, ChNum, Dir, &Addr, &Mask,
+			&Value);
 
 	if(XAie_MaskPoll(DevInst, Addr, Mask, Value, TimeOutUs) !=
 			XAIE_OK) {
@@ -768,6 +863,6 @@ AieRC _XAie_DmaSetBdIteration(XAie_DmaDesc *DmaDesc, u32 StepSize, u8 Wrap,
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
 
-#endif /* XAIE_FEATURE_DMA_ENABLE */
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_DEV_AIE_ENABLE */
 
 /** @} */
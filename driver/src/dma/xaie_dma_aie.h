@@ -31,8 +31,12 @@ void _XAie_TileDmaInit(XAie_DmaDesc *Desc);
 void _XAie_ShimDmaInit(XAie_DmaDesc *Desc);
 AieRC _XAie_DmaSetLock(XAie_DmaDesc *DmaDesc, XAie_Lock Acq, XAie_Lock Rel,
 		u8 AcqEn, u8 RelEn);
+AieRC _XAie_ShimDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		u32 *BdWord, u8 *NumWords);
 AieRC _XAie_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum);
+AieRC _XAie_TileDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		u32 *BdWord, u8 *NumWords);
 AieRC _XAie_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum);
 AieRC _XAie_DmaSetInterleaveEnable(XAie_DmaDesc *DmaDesc, u8 DoubleBuff,
@@ -44,6 +48,9 @@ AieRC _XAie_DmaGetPendingBdCount(XAie_DevInst *DevInst, XAie_LocType Loc,
 AieRC _XAie_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
 		u32 TimeOutUs);
+void _XAie_DmaGetDoneStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
+		u64 *Addr, u32 *Mask, u32 *Value);
 AieRC _XAie_DmaCheckBdChValidity(u8 BdNum, u8 ChNum);
 AieRC _XAie_DmaUpdateBdLen(XAie_DevInst *DevInst, const XAie_DmaMod *DmaMod,
 		XAie_LocType Loc, u32 Len, u8 BdNum);
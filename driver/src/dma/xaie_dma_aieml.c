@@ -22,12 +22,13 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include "xaie_dma_shadow.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_io.h"
 #include "xaiegbl_regdef.h"
 
-#ifdef XAIE_FEATURE_DMA_ENABLE
+#if defined(XAIE_FEATURE_DMA_ENABLE) && defined(XAIE_DEV_AIEML_ENABLE)
 
 /************************** Constant Definitions *****************************/
 #define XAIEML_TILEDMA_NUM_BD_WORDS			6U
@@ -248,27 +249,25 @@ static AieRC _XAieMl_DmaMemTileCheckPaddingConfig(XAie_DmaDesc *DmaDesc)
 /*****************************************************************************/
 /**
 *
-* This API writes a Dma Descriptor which is initialized and setup by other APIs
-* into the corresponding registers and register fields in the hardware. This API
-* is specific to AIEML Memory Tiles only.
+* This API encodes a Dma Descriptor which is initialized and setup by other APIs
+* into the buffer descriptor register words. This API is specific to
+* AIEML Mem Tiles only.
 *
 * @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
-* @param	Loc: Location of AIE Tile
-* @param	BdNum: Hardware BD number to be written to.
+* @param	BdWord: Pointer to the buffer to return the BD words. The buffer
+*		must be large enough to hold all the BD words of the tile.
+* @param	NumWords: Pointer to return the number of BD words encoded.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only. For AIEML Mem Tiles only.
 *
 ******************************************************************************/
-AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
-		XAie_LocType Loc, u8 BdNum)
+AieRC _XAieMl_MemTileDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		u32 *BdWord, u8 *NumWords)
 {
 	AieRC RC;
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIEML_MEMTILEDMA_NUM_BD_WORDS];
 	const XAie_DmaMod *DmaMod;
 	const XAie_DmaBdProp *BdProp;
 
@@ -280,8 +279,6 @@ AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
 	BdProp = DmaMod->BdProp;
 
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
-
 	/* Setup BdWord with the right values from DmaDesc */
 	BdWord[0U] = XAie_SetField(DmaDesc->PktDesc.PktEn,
 			BdProp->Pkt->EnPkt.Lsb, BdProp->Pkt->EnPkt.Mask) |
@@ -383,15 +380,94 @@ AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->Lock->AieMlDmaLock.LckAcqEn.Lsb,
 				BdProp->Lock->AieMlDmaLock.LckAcqEn.Mask);
 
-	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	*NumWords = XAIEML_MEMTILEDMA_NUM_BD_WORDS;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the BD words which must be written to the hardware, as the
+* BD shadow does not hold them. The word of the iteration current field is
+* always written for BDs with iterations, as the hardware advances it.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+* @param	BdWord: Encoded BD words.
+* @param	NumWords: Number of BD words.
+*
+* @return	Bitmap of the BD words to write.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u32 _XAieMl_DmaGetDirtyBdWords(XAie_DevInst *DevInst,
+		const XAie_DmaDesc *DmaDesc, XAie_LocType Loc, u8 BdNum,
+		const u32 *BdWord, u8 NumWords)
+{
+	const XAie_DmaBdProp *BdProp;
+	u32 Dirty;
+
+	Dirty = _XAie_BdShadowDiff(DevInst, Loc, BdNum, BdWord, NumWords,
+			DmaDesc->MemInst);
+	if(DmaDesc->MultiDimDesc.AieMlMultiDimDesc.IterDesc.Wrap > 1U) {
+		BdProp = DmaDesc->DmaMod->BdProp;
+		Dirty |= 1U << BdProp->AddrMode->AieMlMultiDimAddr.IterCurr.Idx;
+	}
+
+	return Dirty;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the encoded words of a BD of an AIEML tile or memory tile,
+* skipping the words which the BD already holds according to the BD shadow.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+* @param	BdWord: Encoded BD words.
+* @param	NumWords: Number of BD words.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAieMl_DmaWriteBdWords(XAie_DevInst *DevInst,
+		const XAie_DmaDesc *DmaDesc, XAie_LocType Loc, u8 BdNum,
+		const u32 *BdWord, u8 NumWords)
+{
+	AieRC RC;
+	u64 Addr;
+	u32 Dirty;
+	const XAie_DmaMod *DmaMod;
+
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	Addr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	Dirty = _XAieMl_DmaGetDirtyBdWords(DevInst, DmaDesc, Loc, BdNum, BdWord,
+			NumWords);
+	for(u8 i = 0U; i < NumWords; i++) {
+		if((Dirty & (1U << i)) == 0U) {
+			continue;
+		}
 
-	for(u8 i = 0U; i < XAIEML_MEMTILEDMA_NUM_BD_WORDS; i++) {
 		RC = XAie_Write32(DevInst, Addr + i * 4U, BdWord[i]);
 		if(RC != XAIE_OK) {
 			return RC;
 		}
 	}
 
+	_XAie_BdShadowUpdate(DevInst, Loc, BdNum, BdWord, NumWords,
+			DmaDesc->MemInst);
+
 	return XAIE_OK;
 }
 
@@ -400,7 +476,7 @@ AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 *
 * This API writes a Dma Descriptor which is initialized and setup by other APIs
 * into the corresponding registers and register fields in the hardware. This API
-* is specific to AIEML Tiles only.
+* is specific to AIEML Memory Tiles only.
 *
 * @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
@@ -409,24 +485,52 @@ AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
-* @note		Internal only. For AIEML Tiles only.
+* @note		Internal only. For AIEML Mem Tiles only.
 *
 ******************************************************************************/
-AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum)
 {
 	AieRC RC;
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIEML_TILEDMA_NUM_BD_WORDS];
+	u8 NumWords;
+	u32 BdWord[XAIEML_MEMTILEDMA_NUM_BD_WORDS];
+
+	RC = _XAieMl_MemTileDmaEncodeBd(DevInst, DmaDesc, BdWord, &NumWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	return _XAieMl_DmaWriteBdWords(DevInst, DmaDesc, Loc, BdNum, BdWord,
+			NumWords);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API encodes a Dma Descriptor which is initialized and setup by other APIs
+* into the buffer descriptor register words. This API is specific to
+* AIEML Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	BdWord: Pointer to the buffer to return the BD words. The buffer
+*		must be large enough to hold all the BD words of the tile.
+* @param	NumWords: Pointer to return the number of BD words encoded.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIEML Tiles only.
+*
+******************************************************************************/
+AieRC _XAieMl_TileDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		u32 *BdWord, u8 *NumWords)
+{
 	const XAie_DmaMod *DmaMod;
 	const XAie_DmaBdProp *BdProp;
 
 	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
 	BdProp = DmaMod->BdProp;
 
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
-
 	/* Setup BdWord with the right values from DmaDesc */
 	BdWord[0U] = XAie_SetField(DmaDesc->AddrDesc.Address,
 				BdProp->Buffer->TileDmaBuff.BaseAddr.Lsb,
@@ -503,14 +607,7 @@ AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->BdEn->TlastSuppress.Lsb,
 				BdProp->BdEn->TlastSuppress.Mask);
 
-	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
-
-	for(u8 i = 0U; i < XAIEML_TILEDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Write32(DevInst, Addr + i * 4U, BdWord[i]);
-		if(RC != XAIE_OK) {
-			return RC;
-		}
-	}
+	*NumWords = XAIEML_TILEDMA_NUM_BD_WORDS;
 
 	return XAIE_OK;
 }
@@ -520,7 +617,7 @@ AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 *
 * This API writes a Dma Descriptor which is initialized and setup by other APIs
 * into the corresponding registers and register fields in the hardware. This API
-* is specific to AIEML Shim Tiles only.
+* is specific to AIEML Tiles only.
 *
 * @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
@@ -529,24 +626,52 @@ AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
-* @note		Internal only. For AIEML Shim Tiles only.
+* @note		Internal only. For AIEML Tiles only.
 *
 ******************************************************************************/
-AieRC _XAieMl_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum)
 {
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIEML_SHIMDMA_NUM_BD_WORDS];
-	XAie_ShimDmaBdArgs Args;
+	AieRC RC;
+	u8 NumWords;
+	u32 BdWord[XAIEML_TILEDMA_NUM_BD_WORDS];
+
+	RC = _XAieMl_TileDmaEncodeBd(DevInst, DmaDesc, BdWord, &NumWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	return _XAieMl_DmaWriteBdWords(DevInst, DmaDesc, Loc, BdNum, BdWord,
+			NumWords);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API encodes a Dma Descriptor which is initialized and setup by other APIs
+* into the buffer descriptor register words. This API is specific to
+* AIEML Shim Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	BdWord: Pointer to the buffer to return the BD words. The buffer
+*		must be large enough to hold all the BD words of the tile.
+* @param	NumWords: Pointer to return the number of BD words encoded.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIEML Shim Tiles only.
+*
+******************************************************************************/
+AieRC _XAieMl_ShimDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		u32 *BdWord, u8 *NumWords)
+{
 	const XAie_DmaMod *DmaMod;
 	const XAie_DmaBdProp *BdProp;
 
 	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
 	BdProp = DmaMod->BdProp;
 
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
-
 	/* Setup BdWord with the right values from DmaDesc */
 	BdWord[0U] = XAie_SetField(DmaDesc->AddrDesc.Length,
 			BdProp->Buffer->ShimDmaBuff.BufferLen.Lsb,
@@ -639,9 +764,48 @@ AieRC _XAieMl_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->BdEn->TlastSuppress.Lsb,
 				BdProp->BdEn->TlastSuppress.Mask);
 
-	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	*NumWords = XAIEML_SHIMDMA_NUM_BD_WORDS;
+
+	return XAIE_OK;
+}
 
-	Args.NumBdWords = XAIEML_SHIMDMA_NUM_BD_WORDS;
+/*****************************************************************************/
+/**
+*
+* This API writes a Dma Descriptor which is initialized and setup by other APIs
+* into the corresponding registers and register fields in the hardware. This API
+* is specific to AIEML Shim Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIEML Shim Tiles only.
+*
+******************************************************************************/
+AieRC _XAieMl_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	u64 Addr;
+	u8 NumWords;
+	u32 BdWord[XAIEML_SHIMDMA_NUM_BD_WORDS];
+	XAie_ShimDmaBdArgs Args;
+	const XAie_DmaMod *DmaMod;
+
+	RC = _XAieMl_ShimDmaEncodeBd(DevInst, DmaDesc, BdWord, &NumWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	Addr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	Args.NumBdWords = NumWords;
 	Args.BdWords = &BdWord[0U];
 	Args.Loc = Loc;
 	Args.VAddr = DmaDesc->AddrDesc.Address;
@@ -649,7 +813,19 @@ AieRC _XAieMl_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 	Args.Addr = Addr;
 	Args.MemInst = DmaDesc->MemInst;
 
-	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_SHIMDMABD, (void *)&Args);
+	/* The backend translates the address, so the BD is written in full */
+	if(_XAieMl_DmaGetDirtyBdWords(DevInst, DmaDesc, Loc, BdNum, BdWord,
+				NumWords) == 0U) {
+		return XAIE_OK;
+	}
+
+	RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_SHIMDMABD, (void *)&Args);
+	if(RC == XAIE_OK) {
+		_XAie_BdShadowUpdate(DevInst, Loc, BdNum, BdWord, NumWords,
+				DmaDesc->MemInst);
+	}
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -713,32 +889,32 @@ AieRC _XAieMl_DmaGetPendingBdCount(XAie_DevInst *DevInst, XAie_LocType Loc,
 /*****************************************************************************/
 /**
 *
-* This API is used to wait on Shim DMA channel to be completed.
+* This API returns the status register of a DMA channel along with the mask
+* and value the register reads once the channel is done.
 *
 * @param	DevInst: Device Instance
 * @param	Loc: Location of AIE Tile
 * @param	DmaMod: Dma module pointer
 * @param	ChNum: Channel number of the DMA.
 * @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
-* @param        TimeOutUs - Minimum timeout value in micro seconds.
+* @param	Addr: Pointer to return the address of the status register.
+* @param	Mask: Pointer to return the mask of the status bits.
+* @param	Value: Pointer to return the value of a done channel.
 *
-* @return	XAIE_OK on success, Error code on failure.
+* @return	None.
 *
 * @note		Internal only. For AIEML Tiles only.
 *
 ******************************************************************************/
-AieRC _XAieMl_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
+void _XAieMl_DmaGetDoneStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
-		u32 TimeOutUs)
+		u64 *Addr, u32 *Mask, u32 *Value)
 {
-	u64 Addr;
-	u32 Mask, Value;
-
-	Addr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+	*Addr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
 		DmaMod->ChStatusBase + ChNum * XAIEML_DMA_STATUS_CHNUM_OFFSET +
 		Dir * DmaMod->ChStatusOffset;
 
-	Mask = DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.Status.Mask |
+	*Mask = DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.Status.Mask |
 		DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.TaskQSize.Mask |
 		DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.StalledLockAcq.Mask |
 		DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.StalledLockRel.Mask |
@@ -746,8 +922,36 @@ AieRC _XAieMl_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
 		DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.StalledTCT.Mask;
 
 	/* This will check the stalled and start queue size bits to be zero */
-	Value = XAIEML_DMA_STATUS_IDLE <<
+	*Value = XAIEML_DMA_STATUS_IDLE <<
 		DmaMod->ChProp->DmaChStatus->AieMlDmaChStatus.Status.Lsb;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API is used to wait on Shim DMA channel to be completed.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	DmaMod: Dma module pointer
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
+* @param        TimeOutUs - Minimum timeout value in micro seconds.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIEML Tiles only.
+*
+******************************************************************************/
+AieRC _XAieMl_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
+		u32 TimeOutUs)
+{
+	u64 Addr;
+	u32 Mask, Value;
+
+	_XAieMl_DmaGetDoneStatus(DevInst, Loc, DmaMod, ChNum, Dir, &Addr,
+			&Mask, &Value);
 
 	if(XAie_MaskPoll(DevInst, Addr, Mask, Value, TimeOutUs) !=
 			XAIE_OK) {
@@ -997,6 +1201,6 @@ AieRC _XAieMl_DmaSetBdIteration(XAie_DmaDesc *DmaDesc, u32 StepSize, u8 Wrap,
 	return XAIE_OK;
 }
 
-#endif /* XAIE_FEATURE_DMA_ENABLE */
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_DEV_AIEML_ENABLE */
 
 /** @} */
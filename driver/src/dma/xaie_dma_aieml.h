@@ -33,10 +33,16 @@ void _XAieMl_TileDmaInit(XAie_DmaDesc *Desc);
 void _XAieMl_MemTileDmaInit(XAie_DmaDesc *Desc);
 AieRC _XAieMl_DmaSetLock(XAie_DmaDesc *DmaDesc, XAie_Lock Acq, XAie_Lock Rel,
 		u8 AcqEn, u8 RelEn);
+AieRC _XAieMl_MemTileDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		u32 *BdWord, u8 *NumWords);
 AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum);
+AieRC _XAieMl_TileDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		u32 *BdWord, u8 *NumWords);
 AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum);
+AieRC _XAieMl_ShimDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		u32 *BdWord, u8 *NumWords);
 AieRC _XAieMl_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum);
 AieRC _XAieMl_DmaSetMultiDim(XAie_DmaDesc *DmaDesc, XAie_DmaTensor *Tensor);
@@ -46,6 +52,9 @@ AieRC _XAieMl_DmaGetPendingBdCount(XAie_DevInst *DevInst, XAie_LocType Loc,
 AieRC _XAieMl_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
 		u32 TimeOutUs);
+void _XAieMl_DmaGetDoneStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_DmaMod *DmaMod, u8 ChNum, XAie_DmaDirection Dir,
+		u64 *Addr, u32 *Mask, u32 *Value);
 AieRC _XAieMl_DmaCheckBdChValidity(u8 BdNum, u8 ChNum);
 AieRC _XAieMl_MemTileDmaCheckBdChValidity(u8 BdNum, u8 ChNum);
 AieRC _XAieMl_DmaUpdateBdLen(XAie_DevInst *DevInst, const XAie_DmaMod *DmaMod,
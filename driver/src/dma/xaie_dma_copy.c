@@ -0,0 +1,491 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_copy.c
+* @{
+*
+* This file contains the routines to copy data between the memories of the AIE
+* tiles and memory tiles with their DMAs. Each block is read by the MM2S
+* channel of its source tile and written by the S2MM channel of its
+* destination tile, through a circuit switched stream path, so the data never
+* crosses the host. The blocks are copied in waves with one block per source
+* tile and per destination tile, so independent copies run in parallel.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+
+#include "xaie_dma_copy.h"
+#include "xaie_helper.h"
+#include "xaie_mem.h"
+
+#if defined(XAIE_FEATURE_DMA_ENABLE) && defined(XAIE_FEATURE_SS_ENABLE)
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures a block copied by a wave and the stream path from its
+ * source tile to its destination tile.
+ */
+typedef struct {
+	u32 Req;
+	XAie_StrmFlow *Flows;
+	u32 NumFlows;
+	XAie_StrmRoute Route;
+} XAie_DmaCopySlot;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API checks one side of a block to copy.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @param	Addr: Address of the block in the memory of the tile.
+* @param	Size: Size of the block.
+*
+* @return	XAIE_OK if the block is valid, error code otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaCopyCheckMem(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u32 Addr, u32 Size)
+{
+	const XAie_MemMod *MemMod;
+	u8 TileType;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
+			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	if((Addr & XAIE_MEM_WORD_ALIGN_MASK) != 0U) {
+		XAIE_ERROR("Invalid block to copy\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+	if((u64)Addr + Size > MemMod->Size) {
+		XAIE_ERROR("Block overflows tile data memory\n");
+		return XAIE_ERR_OUTOFBOUND;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks a block to copy.
+*
+* @param	DevInst: Device Instance
+* @param	Req: Block to copy.
+*
+* @return	XAIE_OK if the block is valid, error code otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaCopyCheckReq(XAie_DevInst *DevInst,
+		const XAie_DmaCopyReq *Req)
+{
+	AieRC RC;
+
+	if((Req->Size == 0U) ||
+			((Req->Size & XAIE_MEM_WORD_ALIGN_MASK) != 0U)) {
+		XAIE_ERROR("Invalid block to copy\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_DmaCopyCheckMem(DevInst, Req->SrcLoc, Req->SrcAddr,
+			Req->Size);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_DmaCopyCheckMem(DevInst, Req->DstLoc, Req->DstAddr,
+			Req->Size);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if((Req->SrcLoc.Col == Req->DstLoc.Col) &&
+			(Req->SrcLoc.Row == Req->DstLoc.Row) &&
+			(Req->SrcAddr < Req->DstAddr + Req->Size) &&
+			(Req->DstAddr < Req->SrcAddr + Req->Size)) {
+		XAIE_ERROR("Source and destination of copy overlap\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API picks the blocks of the next wave. A wave has at most one block per
+* source tile and per destination tile, and at most one block per column, and
+* takes the pending blocks for which a stream path can be placed.
+*
+* @param	DevInst: Device Instance
+* @param	Cfg: Copy configuration.
+* @param	Reqs: Blocks to copy.
+* @param	NumReqs: Number of blocks.
+* @param	Done: Blocks already copied.
+* @param	Slots: Array of NumCols slots to return the blocks of the wave.
+*		The Flows of each slot point to room for MaxFlows flows.
+* @param	MaxFlows: Maximum number of flows of a path.
+* @param	NumSlots: Pointer to return the number of blocks of the wave.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The ports of the paths are allocated in the
+*		router.
+*
+******************************************************************************/
+static AieRC _XAie_DmaCopySchedule(XAie_DevInst *DevInst,
+		const XAie_DmaCopyCfg *Cfg, const XAie_DmaCopyReq *Reqs,
+		u32 NumReqs, const u8 *Done, XAie_DmaCopySlot *Slots,
+		u32 MaxFlows, u32 *NumSlots)
+{
+	*NumSlots = 0U;
+	for(u32 i = 0U; (i < NumReqs) && (*NumSlots < DevInst->NumCols); i++) {
+		const XAie_DmaCopyReq *Req = &Reqs[i];
+		XAie_DmaCopySlot *Slot = &Slots[*NumSlots];
+		u8 Busy = XAIE_DISABLE;
+		AieRC RC;
+
+		if(Done[i] == XAIE_ENABLE) {
+			continue;
+		}
+
+		for(u32 s = 0U; s < *NumSlots; s++) {
+			const XAie_DmaCopyReq *Other = &Reqs[Slots[s].Req];
+
+			if(((Other->SrcLoc.Col == Req->SrcLoc.Col) &&
+					(Other->SrcLoc.Row == Req->SrcLoc.Row)) ||
+				((Other->DstLoc.Col == Req->DstLoc.Col) &&
+					(Other->DstLoc.Row == Req->DstLoc.Row))) {
+				Busy = XAIE_ENABLE;
+			}
+		}
+		if(Busy == XAIE_ENABLE) {
+			continue;
+		}
+
+		Slot->NumFlows = MaxFlows;
+		RC = XAie_StrmRouterFindPath(DevInst, Cfg->Router, Req->SrcLoc,
+				DMA, Cfg->SrcCh, Req->DstLoc, DMA, Cfg->DstCh,
+				Slot->Flows, &Slot->NumFlows);
+		if(RC == XAIE_ERR_STREAM_PORT) {
+			continue;
+		} else if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		Slot->Req = i;
+		(*NumSlots)++;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the address of a block of the memory of a tile as seen by
+* the DMA of the tile.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @param	Addr: Address of the block in the memory of the tile.
+*
+* @return	DMA address of the block.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u64 _XAie_DmaCopyDmaAddr(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u32 Addr)
+{
+	u64 DmaAddr = Addr;
+
+	/* The memory tile DMA sees the memory of its west neighbour first */
+	if(_XAie_DevGetTTypefromLoc(DevInst, Loc) ==
+			XAIEGBL_TILE_TYPE_MEMTILE) {
+		DmaAddr += DevInst->DevProp.DevMod[
+			XAIEGBL_TILE_TYPE_MEMTILE].MemMod->Size;
+	}
+
+	return DmaAddr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures the path, the BDs and the channels of a block and starts
+* its transfer.
+*
+* @param	DevInst: Device Instance
+* @param	Cfg: Copy configuration.
+* @param	Req: Block to copy.
+* @param	Slot: Slot of the block.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaCopyStart(XAie_DevInst *DevInst,
+		const XAie_DmaCopyCfg *Cfg, const XAie_DmaCopyReq *Req,
+		XAie_DmaCopySlot *Slot)
+{
+	AieRC RC;
+	XAie_DmaDesc SrcDesc, DstDesc;
+
+	RC = XAie_StrmRouteCompile(DevInst, &Slot->Route, Slot->Flows,
+			Slot->NumFlows);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_StrmRouteApply(DevInst, &Slot->Route);
+
+	RC |= XAie_DmaDescInit(DevInst, &DstDesc, Req->DstLoc);
+	RC |= XAie_DmaSetAddrLen(&DstDesc, _XAie_DmaCopyDmaAddr(DevInst,
+				Req->DstLoc, Req->DstAddr), Req->Size);
+	RC |= XAie_DmaEnableBd(&DstDesc);
+	RC |= XAie_DmaDescInit(DevInst, &SrcDesc, Req->SrcLoc);
+	RC |= XAie_DmaSetAddrLen(&SrcDesc, _XAie_DmaCopyDmaAddr(DevInst,
+				Req->SrcLoc, Req->SrcAddr), Req->Size);
+	RC |= XAie_DmaEnableBd(&SrcDesc);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to configure DMA copy from tile (%d, %d) to "
+				"tile (%d, %d)\n", Req->SrcLoc.Col,
+				Req->SrcLoc.Row, Req->DstLoc.Col,
+				Req->DstLoc.Row);
+		return XAIE_ERR;
+	}
+
+	/* Arm the destination before the source starts to push data */
+	RC = XAie_DmaWriteBd(DevInst, &DstDesc, Req->DstLoc, Cfg->DstBd);
+	RC |= XAie_DmaChannelEnable(DevInst, Req->DstLoc, Cfg->DstCh,
+			DMA_S2MM);
+	RC |= XAie_DmaChannelPushBdToQueue(DevInst, Req->DstLoc, Cfg->DstCh,
+			DMA_S2MM, Cfg->DstBd);
+	RC |= XAie_DmaWriteBd(DevInst, &SrcDesc, Req->SrcLoc, Cfg->SrcBd);
+	RC |= XAie_DmaChannelEnable(DevInst, Req->SrcLoc, Cfg->SrcCh,
+			DMA_MM2S);
+	RC |= XAie_DmaChannelPushBdToQueue(DevInst, Req->SrcLoc, Cfg->SrcCh,
+			DMA_MM2S, Cfg->SrcBd);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to start DMA copy from tile (%d, %d) to "
+				"tile (%d, %d)\n", Req->SrcLoc.Col,
+				Req->SrcLoc.Row, Req->DstLoc.Col,
+				Req->DstLoc.Row);
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the stream paths of a wave.
+*
+* @param	DevInst: Device Instance
+* @param	Cfg: Copy configuration.
+* @param	Slots: Slots of the wave.
+* @param	NumSlots: Number of slots.
+* @param	NumRoutes: Number of slots whose route is compiled.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaCopyRelease(XAie_DevInst *DevInst,
+		const XAie_DmaCopyCfg *Cfg, XAie_DmaCopySlot *Slots,
+		u32 NumSlots, u32 NumRoutes)
+{
+	AieRC RC = XAIE_OK;
+
+	for(u32 s = 0U; s < NumSlots; s++) {
+		if(s < NumRoutes) {
+			RC |= XAie_StrmRouteClear(DevInst, &Slots[s].Route);
+			XAie_StrmRouteFree(&Slots[s].Route);
+		}
+		RC |= XAie_StrmRouterRelease(DevInst, Cfg->Router,
+				Slots[s].Flows, Slots[s].NumFlows);
+	}
+
+	return (RC == XAIE_OK) ? XAIE_OK : XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API copies blocks of data between the memories of AIE tiles and memory
+* tiles with their DMAs, with no data going through the host. The blocks are
+* copied in waves. A wave takes the pending blocks whose source and
+* destination tiles are not used by the wave yet and for which a stream path
+* can be placed, configures all the paths, BDs and channels of the wave in one
+* transaction, and waits for the S2MM channels of the destination tiles and
+* the MM2S channels of the source tiles. The paths are released at the end of
+* each wave.
+*
+* @param	DevInst: Device Instance
+* @param	Cfg: Copy configuration.
+* @param	Reqs: Blocks to copy.
+* @param	NumReqs: Number of blocks.
+*
+* @return	XAIE_OK on success, XAIE_ERR_STREAM_PORT if a block has no free
+*		stream path, error code on failure.
+*
+* @note		The blocks of a call are copied in no particular order, so a
+*		block must not be read or written by another block of the same
+*		call. This API cannot be called while a transaction is active on
+*		the calling thread, since it waits for the transfers.
+*
+******************************************************************************/
+AieRC XAie_DmaCopy(XAie_DevInst *DevInst, const XAie_DmaCopyCfg *Cfg,
+		const XAie_DmaCopyReq *Reqs, u32 NumReqs)
+{
+	AieRC RC = XAIE_OK;
+	u32 MaxFlows, Remaining = NumReqs;
+	u8 *Done;
+	XAie_DmaCopySlot *Slots;
+	XAie_StrmFlow *Flows;
+	XAie_DmaWaitCh *Chs;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Cfg == XAIE_NULL) || (Cfg->Router == XAIE_NULL) ||
+			(Cfg->Router->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Reqs == XAIE_NULL) || (NumReqs == 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE) {
+		XAIE_ERROR("DMA copy cannot be recorded in a transaction\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumReqs; i++) {
+		RC = _XAie_DmaCopyCheckReq(DevInst, &Reqs[i]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	MaxFlows = (u32)DevInst->NumCols * DevInst->NumRows;
+	Done = (u8 *)calloc(NumReqs, sizeof(*Done));
+	Slots = (XAie_DmaCopySlot *)malloc(DevInst->NumCols * sizeof(*Slots));
+	Flows = (XAie_StrmFlow *)malloc((size_t)DevInst->NumCols * MaxFlows *
+			sizeof(*Flows));
+	Chs = (XAie_DmaWaitCh *)malloc(2U * DevInst->NumCols * sizeof(*Chs));
+	if((Done == NULL) || (Slots == NULL) || (Flows == NULL) ||
+			(Chs == NULL)) {
+		XAIE_ERROR("Memory allocation for DMA copy failed\n");
+		free(Done);
+		free(Slots);
+		free(Flows);
+		free(Chs);
+		return XAIE_ERR;
+	}
+
+	for(u32 s = 0U; s < DevInst->NumCols; s++) {
+		Slots[s].Flows = &Flows[(size_t)s * MaxFlows];
+	}
+
+	while((RC == XAIE_OK) && (Remaining > 0U)) {
+		u32 NumSlots, NumRoutes = 0U;
+		AieRC ReleaseRC;
+
+		RC = _XAie_DmaCopySchedule(DevInst, Cfg, Reqs, NumReqs, Done,
+				Slots, MaxFlows, &NumSlots);
+		if(RC != XAIE_OK) {
+			break;
+		}
+
+		if(NumSlots == 0U) {
+			XAIE_ERROR("No free stream path for DMA copy\n");
+			RC = XAIE_ERR_STREAM_PORT;
+			break;
+		}
+
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		for(u32 s = 0U; (s < NumSlots) && (RC == XAIE_OK); s++) {
+			const XAie_DmaCopyReq *Req = &Reqs[Slots[s].Req];
+
+			RC = _XAie_DmaCopyStart(DevInst, Cfg, Req, &Slots[s]);
+			if(RC == XAIE_OK) {
+				NumRoutes++;
+			}
+			Chs[2U * s].Loc = Req->DstLoc;
+			Chs[2U * s].ChNum = Cfg->DstCh;
+			Chs[2U * s].Dir = DMA_S2MM;
+			Chs[2U * s + 1U].Loc = Req->SrcLoc;
+			Chs[2U * s + 1U].ChNum = Cfg->SrcCh;
+			Chs[2U * s + 1U].Dir = DMA_MM2S;
+		}
+
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+			/* Only the compiled routes of the wave were applied */
+			NumRoutes = 0U;
+		}
+
+		if(RC == XAIE_OK) {
+			RC = XAie_DmaWaitForDoneMulti(DevInst, Chs,
+					2U * NumSlots, XAIE_ENABLE, NULL,
+					Cfg->TimeOutUs);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("DMA copy timed out\n");
+			}
+		}
+
+		for(u32 s = 0U; (s < NumSlots) && (RC == XAIE_OK); s++) {
+			Done[Slots[s].Req] = XAIE_ENABLE;
+			Remaining--;
+		}
+
+		ReleaseRC = _XAie_DmaCopyRelease(DevInst, Cfg, Slots, NumSlots,
+				NumRoutes);
+		if(RC == XAIE_OK) {
+			RC = ReleaseRC;
+		}
+	}
+
+	free(Done);
+	free(Slots);
+	free(Flows);
+	free(Chs);
+
+	return RC;
+}
+
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_FEATURE_SS_ENABLE */
+
+/** @} */
@@ -0,0 +1,65 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_copy.h
+* @{
+*
+* This file contains the routines to copy data between the memories of the AIE
+* tiles and memory tiles with their DMAs, without going through the host.
+*
+******************************************************************************/
+#ifndef XAIE_DMA_COPY_H
+#define XAIE_DMA_COPY_H
+
+/***************************** Include Files *********************************/
+#include "xaie_feature_config.h"
+#include "xaiegbl.h"
+#include "xaie_dma.h"
+#include "xaie_ss.h"
+
+#if defined(XAIE_FEATURE_DMA_ENABLE) && defined(XAIE_FEATURE_SS_ENABLE)
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures a block of data to copy from the memory of an AIE
+ * tile or memory tile to the memory of another, or of the same, tile. The
+ * addresses and Size are word aligned.
+ */
+typedef struct {
+	XAie_LocType SrcLoc;
+	u32 SrcAddr;
+	XAie_LocType DstLoc;
+	u32 DstAddr;
+	u32 Size;
+} XAie_DmaCopyReq;
+
+/*
+ * This typedef captures the resources used by XAie_DmaCopy(). Each block is
+ * read by the MM2S channel SrcCh of its source tile with BD SrcBd, through a
+ * stream path placed with Router, into the S2MM channel DstCh of its
+ * destination tile with BD DstBd. These channels and BDs must not be in use
+ * on the tiles copied from and to while the copy runs.
+ */
+typedef struct {
+	XAie_StrmRouter *Router;
+	u8 SrcCh;
+	u8 SrcBd;
+	u8 DstCh;
+	u8 DstBd;
+	u32 TimeOutUs;		/* Time out of each wave, 0 for the default */
+} XAie_DmaCopyCfg;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_DmaCopy(XAie_DevInst *DevInst, const XAie_DmaCopyCfg *Cfg,
+		const XAie_DmaCopyReq *Reqs, u32 NumReqs);
+
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_FEATURE_SS_ENABLE */
+
+#endif		/* end of protection macro */
+
+/** @} */
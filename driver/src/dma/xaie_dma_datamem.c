@@ -0,0 +1,595 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_datamem.c
+* @{
+*
+* This file contains routines for placing DMA buffers in the data memory of
+* the AIE tiles. The data memory is made of banks of consecutive addresses,
+* and the core stalls when the DMA accesses the bank it loads from or stores
+* to. The map of a tile records the ranges taken by the data sections of the
+* elfs loaded on the tile and on its neighbours, so that DMA buffers can be
+* placed in the banks the cores do not use, and BDs sharing a bank with the
+* sections the cores access most can be reported.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <string.h>
+
+#include "xaie_dma_datamem.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaiegbl_regdef.h"
+
+#if defined(XAIE_FEATURE_DMA_ENABLE) && \
+	defined(XAIE_FEATURE_DATAMEM_ENABLE) && \
+	defined(XAIE_FEATURE_ELF_ENABLE)
+
+/************************** Constant Definitions *****************************/
+#define XAIE_DATAMEM_MAP_AIEML_NUM_DIMS		3U
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the bitmap of the banks a range of the data memory spans.
+*
+* @param	Map: Pointer to the data memory map.
+* @param	Offset: Start of the range.
+* @param	Size: Size of the range in bytes.
+*
+* @return	Bitmap of the banks.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u32 _XAie_DataMemMapGetBanks(const XAie_DataMemMap *Map, u32 Offset,
+		u32 Size)
+{
+	u32 First = Offset / Map->BankSize;
+	u32 Last = (Offset + Size - 1U) / Map->BankSize;
+	u32 Banks = 0U;
+
+	for(u32 b = First; b <= Last; b++) {
+		Banks |= 1U << b;
+	}
+
+	return Banks;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API marks the granules covering a range of the data memory as used or
+* free.
+*
+* @param	Map: Pointer to the data memory map.
+* @param	Offset: Start of the range.
+* @param	Size: Size of the range in bytes.
+* @param	Used: XAIE_ENABLE to mark the range used, XAIE_DISABLE to free
+*		it.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_DataMemMapSetUsed(XAie_DataMemMap *Map, u32 Offset, u32 Size,
+		u8 Used)
+{
+	u32 Last = (Offset + Size + XAIE_DATAMEM_MAP_GRANULE - 1U) /
+		XAIE_DATAMEM_MAP_GRANULE;
+
+	for(u32 g = Offset / XAIE_DATAMEM_MAP_GRANULE; g < Last; g++) {
+		if(Used == XAIE_ENABLE) {
+			Map->Used[g / 32U] |= 1U << (g % 32U);
+		} else {
+			Map->Used[g / 32U] &= ~(1U << (g % 32U));
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API searches the lowest free range of granules which does not span the
+* banks to avoid.
+*
+* @param	Map: Pointer to the data memory map.
+* @param	Size: Size of the range in bytes, a multiple of the granule.
+* @param	Align: Alignment of the range, a multiple of the granule.
+* @param	AvoidBanks: Bitmap of the banks the range must not span.
+* @param	Offset: Pointer to return the start of the range.
+*
+* @return	XAIE_OK if a range is found, XAIE_ERR otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DataMemMapFind(const XAie_DataMemMap *Map, u32 Size,
+		u32 Align, u32 AvoidBanks, u32 *Offset)
+{
+	u32 Start = 0U;
+
+	while(Start + Size <= Map->Size) {
+		u32 Avoid = _XAie_DataMemMapGetBanks(Map, Start, Size) &
+			AvoidBanks;
+		u32 End;
+
+		if(Avoid != 0U) {
+			/* Skip past the lowest bank to avoid */
+			End = Map->BankSize;
+			while((Avoid & 1U) == 0U) {
+				Avoid >>= 1U;
+				End += Map->BankSize;
+			}
+		} else {
+			for(End = Start; End < Start + Size;
+					End += XAIE_DATAMEM_MAP_GRANULE) {
+				u32 g = End / XAIE_DATAMEM_MAP_GRANULE;
+
+				if((Map->Used[g / 32U] &
+						(1U << (g % 32U))) != 0U) {
+					break;
+				}
+			}
+			if(End == Start + Size) {
+				*Offset = Start;
+				return XAIE_OK;
+			}
+			End += XAIE_DATAMEM_MAP_GRANULE;
+		}
+
+		Start = (End + Align - 1U) & ~(Align - 1U);
+	}
+
+	return XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records a range of data memory addresses, as seen by a core, in the
+* maps of the tiles holding it.
+*
+* @param	DevInst: Device Instance.
+* @param	Maps: Array of the data memory maps.
+* @param	NumMaps: Number of maps.
+* @param	CoreLoc: Location of the AIE tile of the core.
+* @param	Addr: Start of the range as seen by the core.
+* @param	Size: Size of the range in bytes.
+* @param	Hot: XAIE_ENABLE if the core accesses the range most,
+*		XAIE_DISABLE otherwise.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The parts of the range in tiles without a map
+*		are ignored.
+*
+******************************************************************************/
+static AieRC _XAie_DataMemMapMark(XAie_DevInst *DevInst, XAie_DataMemMap *Maps,
+		u32 NumMaps, XAie_LocType CoreLoc, u32 Addr, u32 Size, u8 Hot)
+{
+	const XAie_CoreMod *CoreMod;
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+
+	while(Size > 0U) {
+		AieRC RC;
+		XAie_LocType TgtLoc;
+		u32 Offset = Addr & (CoreMod->DataMemSize - 1U);
+		u32 Chunk = CoreMod->DataMemSize - Offset;
+
+		if(Chunk > Size) {
+			Chunk = Size;
+		}
+
+		RC = _XAie_GetTargetTileLoc(DevInst, CoreLoc, Addr, &TgtLoc);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		for(u32 i = 0U; i < NumMaps; i++) {
+			XAie_DataMemMap *Map = &Maps[i];
+			u32 Banks;
+
+			if((Map->IsReady != XAIE_COMPONENT_IS_READY) ||
+					(Map->Loc.Col != TgtLoc.Col) ||
+					(Map->Loc.Row != TgtLoc.Row)) {
+				continue;
+			}
+
+			Banks = _XAie_DataMemMapGetBanks(Map, Offset, Chunk);
+			_XAie_DataMemMapSetUsed(Map, Offset, Chunk, XAIE_ENABLE);
+			Map->ElfBanks |= Banks;
+			if(Hot == XAIE_ENABLE) {
+				Map->HotBanks |= Banks;
+			}
+		}
+
+		Addr += Chunk;
+		Size -= Chunk;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the bitmap of the banks one buffer of a BD spans.
+*
+* @param	Map: Pointer to the data memory map.
+* @param	DmaDesc: Dma descriptor of the BD.
+* @param	AddrDesc: Buffer of the BD.
+* @param	Banks: Pointer to return the bitmap of the banks.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ADDRESS if the buffer is not
+*		in the data memory of the tile.
+*
+* @note		Internal only. For multi dimensional AIE-ML BDs, the range
+*		from the lowest to the highest address the BD accesses is
+*		used.
+*
+******************************************************************************/
+static AieRC _XAie_DataMemMapGetBdBanks(const XAie_DataMemMap *Map,
+		const XAie_DmaDesc *DmaDesc, const XAie_AddrDesc *AddrDesc,
+		u32 *Banks)
+{
+	const XAie_DmaBdProp *BdProp = DmaDesc->DmaMod->BdProp;
+	u64 Start = AddrDesc->Address << BdProp->AddrAlignShift;
+	u64 Words = (u64)DmaDesc->AddrDesc.Length + BdProp->LenActualOffset;
+	u64 Span = Words;
+
+	if(Map->DevGen != XAIE_DEV_GEN_AIE) {
+		const XAie_AieMlMultiDimDesc *Desc =
+			&DmaDesc->MultiDimDesc.AieMlMultiDimDesc;
+		u64 Count = 1U, Max = 0U;
+		u8 d;
+
+		for(d = 0U; (d < XAIE_DATAMEM_MAP_AIEML_NUM_DIMS) &&
+				(Desc->DimDesc[d].Wrap != 0U); d++) {
+			Max += (u64)(Desc->DimDesc[d].Wrap - 1U) *
+				Desc->DimDesc[d].StepSize;
+			Count *= Desc->DimDesc[d].Wrap;
+		}
+
+		if(d > 0U) {
+			/* The first dimension without a wrap runs to the end */
+			Max += ((Words + Count - 1U) / Count - 1U) *
+				Desc->DimDesc[d].StepSize;
+			Span = Max + 1U;
+		}
+
+		if(Desc->IterDesc.Wrap > 1U) {
+			Span += (u64)(Desc->IterDesc.Wrap - 1U) *
+				Desc->IterDesc.StepSize;
+		}
+	}
+
+	Span *= sizeof(u32);
+	if((Span == 0U) || (Start + Span > Map->Size)) {
+		XAIE_ERROR("BD is not in the data memory of tile (%d, %d)\n",
+				Map->Loc.Col, Map->Loc.Row);
+		return XAIE_INVALID_ADDRESS;
+	}
+
+	*Banks = _XAie_DataMemMapGetBanks(Map, (u32)Start, (u32)Span);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes the map of the data memory of an AIE tile. All the
+* memory is free.
+*
+* @param	DevInst: Device Instance.
+* @param	Map: Pointer to the user allocated data memory map.
+* @param	Loc: Location of the AIE tile.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_DataMemMapInit(XAie_DevInst *DevInst, XAie_DataMemMap *Map,
+		XAie_LocType Loc)
+{
+	const XAie_MemMod *MemMod;
+
+	if((DevInst == XAIE_NULL) || (Map == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_DevGetTTypefromLoc(DevInst, Loc) !=
+			XAIEGBL_TILE_TYPE_AIETILE) {
+		XAIE_ERROR("Invalid tile type, expected an AIE tile\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	MemMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].MemMod;
+	if((MemMod == XAIE_NULL) || (MemMod->NumBanks == 0U) ||
+			(MemMod->NumBanks > XAIE_DATAMEM_MAP_MAX_BANKS) ||
+			(MemMod->Size > XAIE_DATAMEM_MAP_MAX_SIZE)) {
+		XAIE_ERROR("Data memory map is not supported\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	memset((void *)Map, 0U, sizeof(*Map));
+	Map->Loc = Loc;
+	Map->Size = MemMod->Size;
+	Map->NumBanks = MemMod->NumBanks;
+	Map->BankSize = MemMod->Size / MemMod->NumBanks;
+	Map->DevGen = DevInst->DevProp.DevGen;
+	Map->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records the data memory sections of an elf image loaded on a core
+* in the maps of the data memories they land in. The sections of a core can
+* land in the data memory of its own tile and of its neighbours.
+*
+* @param	DevInst: Device Instance.
+* @param	Maps: Array of the data memory maps.
+* @param	NumMaps: Number of maps.
+* @param	CoreLoc: Location of the AIE tile the elf is loaded on.
+* @param	Image: Elf image loaded on the core.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		An elf loaded with XAie_LoadElf() is recorded from the image
+*		of the same file, created with XAie_ElfImageCreate(). The
+*		sections in tiles without a map are ignored. The stack and the
+*		heap are recorded only as far as the elf has segments for
+*		them.
+*
+******************************************************************************/
+AieRC XAie_DataMemMapAddElf(XAie_DevInst *DevInst, XAie_DataMemMap *Maps,
+		u32 NumMaps, XAie_LocType CoreLoc, const XAie_ElfImage *Image)
+{
+	if((DevInst == XAIE_NULL) || (Maps == XAIE_NULL) ||
+			(Image == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Image->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < Image->NumSegs; i++) {
+		const XAie_ElfImageSeg *Seg = &Image->Segs[i];
+		AieRC RC;
+
+		if((Seg->Type == XAIE_ELF_SEG_PROG) || (Seg->Size == 0U)) {
+			continue;
+		}
+
+		RC = _XAie_DataMemMapMark(DevInst, Maps, NumMaps, CoreLoc,
+				Seg->Addr, Seg->Size, XAIE_DISABLE);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to map segment at 0x%x\n", Seg->Addr);
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API marks a range of data memory, for instance the stack or the buffers
+* of the inner loop of a kernel, as accessed most by a core. DMA buffers are
+* kept out of its banks first, and BDs sharing its banks are reported by
+* XAie_DataMemMapCheckBd().
+*
+* @param	DevInst: Device Instance.
+* @param	Maps: Array of the data memory maps.
+* @param	NumMaps: Number of maps.
+* @param	CoreLoc: Location of the AIE tile of the core.
+* @param	Addr: Start of the range as seen by the core, for instance the
+*		address of a symbol of the elf.
+* @param	Size: Size of the range in bytes.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The range is also marked used.
+*
+******************************************************************************/
+AieRC XAie_DataMemMapMarkHot(XAie_DevInst *DevInst, XAie_DataMemMap *Maps,
+		u32 NumMaps, XAie_LocType CoreLoc, u32 Addr, u32 Size)
+{
+	if((DevInst == XAIE_NULL) || (Maps == XAIE_NULL) || (Size == 0U) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return _XAie_DataMemMapMark(DevInst, Maps, NumMaps, CoreLoc, Addr,
+			Size, XAIE_ENABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API allocates a DMA buffer in the data memory of an AIE tile. The
+* buffer is placed in the banks without elf sections if there is room, else in
+* the banks without hot sections, else anywhere free.
+*
+* @param	Map: Pointer to the data memory map.
+* @param	Size: Size of the buffer in bytes.
+* @param	Align: Alignment of the buffer, a power of two. 0 for the
+*		granule of the map.
+* @param	AvoidBanks: Bitmap of the banks the buffer must not span, for
+*		instance the banks of the buffers accessed by the other
+*		channels at the same time.
+* @param	Buf: Pointer to return the buffer.
+*
+* @return	XAIE_OK on success, XAIE_ERR if there is no room, error code
+*		on failure.
+*
+* @note		The size and the alignment are rounded up to the granule of
+*		the map. The offset of the buffer is its address for the DMA
+*		of the tile.
+*
+******************************************************************************/
+AieRC XAie_DataMemMapAllocBuf(XAie_DataMemMap *Map, u32 Size, u32 Align,
+		u32 AvoidBanks, XAie_DataMemBuf *Buf)
+{
+	AieRC RC = XAIE_ERR;
+	u32 Offset = 0U;
+	u32 Avoid[3U];
+
+	if((Map == XAIE_NULL) || (Buf == XAIE_NULL) ||
+			(Map->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Size == 0U) || (Size > Map->Size) ||
+			((Align & (Align - 1U)) != 0U) || (Align > Map->Size)) {
+		XAIE_ERROR("Invalid size or alignment\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Size = (Size + XAIE_DATAMEM_MAP_GRANULE - 1U) &
+		~(XAIE_DATAMEM_MAP_GRANULE - 1U);
+	if(Align < XAIE_DATAMEM_MAP_GRANULE) {
+		Align = XAIE_DATAMEM_MAP_GRANULE;
+	}
+
+	Avoid[0U] = AvoidBanks | Map->ElfBanks;
+	Avoid[1U] = AvoidBanks | Map->HotBanks;
+	Avoid[2U] = AvoidBanks;
+	for(u8 i = 0U; (i < 3U) && (RC != XAIE_OK); i++) {
+		RC = _XAie_DataMemMapFind(Map, Size, Align, Avoid[i], &Offset);
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("No room for 0x%x bytes in data memory of tile (%d, %d)\n",
+				Size, Map->Loc.Col, Map->Loc.Row);
+		return RC;
+	}
+
+	_XAie_DataMemMapSetUsed(Map, Offset, Size, XAIE_ENABLE);
+	Buf->Loc = Map->Loc;
+	Buf->Offset = Offset;
+	Buf->Size = Size;
+	Buf->Banks = _XAie_DataMemMapGetBanks(Map, Offset, Size);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees a DMA buffer allocated from a data memory map.
+*
+* @param	Map: Pointer to the data memory map.
+* @param	Buf: Buffer to free.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_DataMemMapFreeBuf(XAie_DataMemMap *Map, const XAie_DataMemBuf *Buf)
+{
+	if((Map == XAIE_NULL) || (Buf == XAIE_NULL) ||
+			(Map->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Buf->Loc.Col != Map->Loc.Col) || (Buf->Loc.Row != Map->Loc.Row) ||
+			(Buf->Size == 0U) ||
+			((Buf->Offset % XAIE_DATAMEM_MAP_GRANULE) != 0U) ||
+			((Buf->Size % XAIE_DATAMEM_MAP_GRANULE) != 0U) ||
+			(Buf->Offset + Buf->Size > Map->Size)) {
+		XAIE_ERROR("Buffer does not belong to the map\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_DataMemMapSetUsed(Map, Buf->Offset, Buf->Size, XAIE_DISABLE);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks whether a BD of the DMA of an AIE tile shares a bank with the
+* hot sections of the data memory of the tile, and warns if it does. The core
+* stalls on such a bank each time the DMA accesses it.
+*
+* @param	Map: Pointer to the data memory map of the tile of the DMA.
+* @param	DmaDesc: Initialized dma descriptor of the BD.
+* @param	HotBanks: Pointer to return the bitmap of the hot banks the BD
+*		shares. Can be NULL.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		A shared bank is not an error, the BD works but slows down
+*		the core.
+*
+******************************************************************************/
+AieRC XAie_DataMemMapCheckBd(const XAie_DataMemMap *Map,
+		const XAie_DmaDesc *DmaDesc, u32 *HotBanks)
+{
+	AieRC RC;
+	u32 Banks, Shared;
+
+	if((Map == XAIE_NULL) || (DmaDesc == XAIE_NULL) ||
+			(Map->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(DmaDesc->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(DmaDesc->TileType != XAIEGBL_TILE_TYPE_AIETILE)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_DataMemMapGetBdBanks(Map, DmaDesc, &DmaDesc->AddrDesc,
+			&Banks);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(DmaDesc->EnDoubleBuff == XAIE_ENABLE) {
+		u32 Banks2;
+
+		RC = _XAie_DataMemMapGetBdBanks(Map, DmaDesc,
+				&DmaDesc->AddrDesc_2, &Banks2);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		Banks |= Banks2;
+	}
+
+	Shared = Banks & Map->HotBanks;
+	if(Shared != 0U) {
+		XAIE_WARN("BD shares banks 0x%x with hot sections of tile (%d, %d)\n",
+				Shared, Map->Loc.Col, Map->Loc.Row);
+	}
+
+	if(HotBanks != XAIE_NULL) {
+		*HotBanks = Shared;
+	}
+
+	return XAIE_OK;
+}
+
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_FEATURE_DATAMEM_ENABLE &&
+	  XAIE_FEATURE_ELF_ENABLE */
+
+/** @} */
@@ -0,0 +1,86 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_datamem.h
+* @{
+*
+* This file contains the routines for placing DMA buffers in the data memory
+* of the AIE tiles, away from the banks used by the elf loaded on the cores.
+*
+******************************************************************************/
+#ifndef XAIE_DMA_DATAMEM_H
+#define XAIE_DMA_DATAMEM_H
+
+/***************************** Include Files *********************************/
+#include "xaie_feature_config.h"
+#include "xaiegbl.h"
+#include "xaie_dma.h"
+#include "xaie_elfloader.h"
+
+#if defined(XAIE_FEATURE_DMA_ENABLE) && \
+	defined(XAIE_FEATURE_DATAMEM_ENABLE) && \
+	defined(XAIE_FEATURE_ELF_ENABLE)
+
+/************************** Constant Definitions *****************************/
+#define XAIE_DATAMEM_MAP_GRANULE	32U
+#define XAIE_DATAMEM_MAP_MAX_SIZE	0x10000U
+#define XAIE_DATAMEM_MAP_WORDS		(XAIE_DATAMEM_MAP_MAX_SIZE / \
+		XAIE_DATAMEM_MAP_GRANULE / 32U)
+#define XAIE_DATAMEM_MAP_MAX_BANKS	16U
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures a DMA buffer in the data memory of an AIE tile. Offset
+ * is relative to the data memory of the tile and Banks is the bitmap of the
+ * banks the buffer spans.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u32 Offset;
+	u32 Size;
+	u32 Banks;
+} XAie_DataMemBuf;
+
+/*
+ * This typedef captures the map of the data memory of one AIE tile. The
+ * memory is split in granules of XAIE_DATAMEM_MAP_GRANULE bytes, Used is the
+ * bitmap of the granules taken by elf sections or DMA buffers. ElfBanks is the
+ * bitmap of the banks holding elf sections and HotBanks the bitmap of the
+ * banks holding sections the core accesses most.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u32 Size;
+	u32 BankSize;
+	u8 NumBanks;
+	u8 DevGen;
+	u32 Used[XAIE_DATAMEM_MAP_WORDS];
+	u32 ElfBanks;
+	u32 HotBanks;
+	u8 IsReady;
+} XAie_DataMemMap;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_DataMemMapInit(XAie_DevInst *DevInst, XAie_DataMemMap *Map,
+		XAie_LocType Loc);
+AieRC XAie_DataMemMapAddElf(XAie_DevInst *DevInst, XAie_DataMemMap *Maps,
+		u32 NumMaps, XAie_LocType CoreLoc, const XAie_ElfImage *Image);
+AieRC XAie_DataMemMapMarkHot(XAie_DevInst *DevInst, XAie_DataMemMap *Maps,
+		u32 NumMaps, XAie_LocType CoreLoc, u32 Addr, u32 Size);
+AieRC XAie_DataMemMapAllocBuf(XAie_DataMemMap *Map, u32 Size, u32 Align,
+		u32 AvoidBanks, XAie_DataMemBuf *Buf);
+AieRC XAie_DataMemMapFreeBuf(XAie_DataMemMap *Map, const XAie_DataMemBuf *Buf);
+AieRC XAie_DataMemMapCheckBd(const XAie_DataMemMap *Map,
+		const XAie_DmaDesc *DmaDesc, u32 *HotBanks);
+
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_FEATURE_DATAMEM_ENABLE &&
+	  XAIE_FEATURE_ELF_ENABLE */
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -0,0 +1,477 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_load.c
+* @{
+*
+* This file contains the routines to load data in the memories of the AIE
+* tiles and memory tiles with the shim DMAs. The data is staged in a memory
+* object, and each block is pulled by a shim DMA MM2S channel and written by
+* the S2MM channel of the target tile, through a circuit switched stream
+* path. The blocks are loaded in waves with one block per shim DMA, so the
+* columns load in parallel and the load is bounded by the NoC bandwidth
+* rather than by the bandwidth of the register writes of the host.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_dma_load.h"
+#include "xaie_helper.h"
+#include "xaie_mem.h"
+#include "xaie_plif.h"
+
+#if defined(XAIE_FEATURE_DMA_ENABLE) && defined(XAIE_FEATURE_SS_ENABLE) && \
+	defined(XAIE_FEATURE_PL_ENABLE)
+
+/************************** Constant Definitions *****************************/
+/* South slave port of the shim stream switch fed by each shim DMA MM2S */
+#define XAIE_DMA_LOAD_SHIM_PORT(Ch)	(((Ch) == 0U) ? 3U : 7U)
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures a block loaded by a wave: the shim tile pulling it
+ * and the stream path to its target tile.
+ */
+typedef struct {
+	u32 Req;
+	XAie_LocType ShimLoc;
+	XAie_StrmFlow *Flows;
+	u32 NumFlows;
+	XAie_StrmRoute Route;
+} XAie_DmaLoadSlot;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API checks a block to load.
+*
+* @param	DevInst: Device Instance
+* @param	Req: Block to load.
+*
+* @return	XAIE_OK if the block is valid, error code otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaLoadCheckReq(XAie_DevInst *DevInst,
+		const XAie_DmaLoadReq *Req)
+{
+	const XAie_MemMod *MemMod;
+	u8 TileType;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Req->Loc);
+	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
+			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	if((Req->Src == XAIE_NULL) || (Req->Size == 0U) ||
+			((Req->Addr & XAIE_MEM_WORD_ALIGN_MASK) != 0U) ||
+			((Req->Size & XAIE_MEM_WORD_ALIGN_MASK) != 0U)) {
+		XAIE_ERROR("Invalid block to load\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+	if((u64)Req->Addr + Req->Size > MemMod->Size) {
+		XAIE_ERROR("Block overflows tile data memory\n");
+		return XAIE_ERR_OUTOFBOUND;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API picks the blocks of the next wave. Each block pending is given the
+* free shim DMA closest to the column of its target tile from which a stream
+* path to the target tile can be placed. A wave has at most one block per
+* shim tile and per target tile.
+*
+* @param	DevInst: Device Instance
+* @param	Cfg: Load configuration.
+* @param	Reqs: Blocks to load.
+* @param	NumReqs: Number of blocks.
+* @param	Done: Blocks already loaded.
+* @param	Slots: Array of NumCols slots to return the blocks of the wave.
+*		The Flows of each slot point to room for MaxFlows flows.
+* @param	MaxFlows: Maximum number of flows of a path.
+* @param	NumSlots: Pointer to return the number of blocks of the wave.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The ports of the paths are allocated in the
+*		router.
+*
+******************************************************************************/
+static AieRC _XAie_DmaLoadSchedule(XAie_DevInst *DevInst,
+		const XAie_DmaLoadCfg *Cfg, const XAie_DmaLoadReq *Reqs,
+		u32 NumReqs, const u8 *Done, XAie_DmaLoadSlot *Slots,
+		u32 MaxFlows, u32 *NumSlots)
+{
+	u8 ShimPort = XAIE_DMA_LOAD_SHIM_PORT(Cfg->ShimCh);
+
+	*NumSlots = 0U;
+	for(u32 i = 0U; (i < NumReqs) && (*NumSlots < DevInst->NumCols); i++) {
+		XAie_LocType Loc = Reqs[i].Loc;
+		u8 Busy = XAIE_DISABLE;
+
+		if(Done[i] == XAIE_ENABLE) {
+			continue;
+		}
+
+		for(u32 s = 0U; s < *NumSlots; s++) {
+			XAie_LocType Other = Reqs[Slots[s].Req].Loc;
+
+			if((Other.Col == Loc.Col) && (Other.Row == Loc.Row)) {
+				Busy = XAIE_ENABLE;
+			}
+		}
+		if(Busy == XAIE_ENABLE) {
+			continue;
+		}
+
+		for(u32 Dist = 0U; Dist < 2U * DevInst->NumCols; Dist++) {
+			XAie_DmaLoadSlot *Slot = &Slots[*NumSlots];
+			s32 Col = (s32)Loc.Col + (((Dist % 2U) == 0U) ?
+					(s32)(Dist / 2U) :
+					-(s32)(Dist / 2U + 1U));
+			XAie_LocType ShimLoc;
+			AieRC RC;
+
+			if((Col < 0) || (Col >= (s32)DevInst->NumCols)) {
+				continue;
+			}
+
+			ShimLoc = XAie_TileLoc((u8)Col, DevInst->ShimRow);
+			if(_XAie_DevGetTTypefromLoc(DevInst, ShimLoc) !=
+					XAIEGBL_TILE_TYPE_SHIMNOC) {
+				continue;
+			}
+
+			Busy = XAIE_DISABLE;
+			for(u32 s = 0U; s < *NumSlots; s++) {
+				if(Slots[s].ShimLoc.Col == ShimLoc.Col) {
+					Busy = XAIE_ENABLE;
+				}
+			}
+			if(Busy == XAIE_ENABLE) {
+				continue;
+			}
+
+			Slot->NumFlows = MaxFlows;
+			RC = XAie_StrmRouterFindPath(DevInst, Cfg->Router,
+					ShimLoc, SOUTH, ShimPort, Loc, DMA,
+					Cfg->TileCh, Slot->Flows,
+					&Slot->NumFlows);
+			if(RC == XAIE_ERR_STREAM_PORT) {
+				continue;
+			} else if(RC != XAIE_OK) {
+				return RC;
+			}
+
+			Slot->Req = i;
+			Slot->ShimLoc = ShimLoc;
+			(*NumSlots)++;
+			break;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures the path, the BDs and the channels of a block and starts
+* its transfer.
+*
+* @param	DevInst: Device Instance
+* @param	Cfg: Load configuration.
+* @param	Req: Block to load.
+* @param	Offset: Offset of the block in the staging buffer.
+* @param	Slot: Slot of the block.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaLoadStart(XAie_DevInst *DevInst,
+		const XAie_DmaLoadCfg *Cfg, const XAie_DmaLoadReq *Req,
+		u64 Offset, XAie_DmaLoadSlot *Slot)
+{
+	AieRC RC;
+	XAie_DmaDesc TileDesc, ShimDesc;
+	u64 DmaAddr = Req->Addr;
+
+	/* The memory tile DMA sees the memory of its west neighbour first */
+	if(_XAie_DevGetTTypefromLoc(DevInst, Req->Loc) ==
+			XAIEGBL_TILE_TYPE_MEMTILE) {
+		DmaAddr += DevInst->DevProp.DevMod[
+			XAIEGBL_TILE_TYPE_MEMTILE].MemMod->Size;
+	}
+
+	RC = XAie_StrmRouteCompile(DevInst, &Slot->Route, Slot->Flows,
+			Slot->NumFlows);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_StrmRouteApply(DevInst, &Slot->Route);
+	RC |= XAie_EnableShimDmaToAieStrmPort(DevInst, Slot->ShimLoc,
+			XAIE_DMA_LOAD_SHIM_PORT(Cfg->ShimCh));
+
+	RC |= XAie_DmaDescInit(DevInst, &TileDesc, Req->Loc);
+	RC |= XAie_DmaSetAddrLen(&TileDesc, DmaAddr, Req->Size);
+	RC |= XAie_DmaEnableBd(&TileDesc);
+	RC |= XAie_DmaDescInit(DevInst, &ShimDesc, Slot->ShimLoc);
+	RC |= XAie_DmaSetAddrOffsetLen(&ShimDesc, Cfg->MemInst, Offset,
+			Req->Size);
+	RC |= XAie_DmaEnableBd(&ShimDesc);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to configure DMA load of tile (%d, %d)\n",
+				Req->Loc.Col, Req->Loc.Row);
+		return XAIE_ERR;
+	}
+
+	RC = XAie_DmaWriteBd(DevInst, &TileDesc, Req->Loc, Cfg->TileBd);
+	RC |= XAie_DmaChannelEnable(DevInst, Req->Loc, Cfg->TileCh,
+			DMA_S2MM);
+	RC |= XAie_DmaChannelPushBdToQueue(DevInst, Req->Loc, Cfg->TileCh,
+			DMA_S2MM, Cfg->TileBd);
+	RC |= XAie_DmaWriteBd(DevInst, &ShimDesc, Slot->ShimLoc, Cfg->ShimBd);
+	RC |= XAie_DmaChannelEnable(DevInst, Slot->ShimLoc, Cfg->ShimCh,
+			DMA_MM2S);
+	RC |= XAie_DmaChannelPushBdToQueue(DevInst, Slot->ShimLoc,
+			Cfg->ShimCh, DMA_MM2S, Cfg->ShimBd);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to start DMA load of tile (%d, %d)\n",
+				Req->Loc.Col, Req->Loc.Row);
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the stream paths of a wave.
+*
+* @param	DevInst: Device Instance
+* @param	Cfg: Load configuration.
+* @param	Slots: Slots of the wave.
+* @param	NumSlots: Number of slots.
+* @param	NumRoutes: Number of slots whose route is compiled.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaLoadRelease(XAie_DevInst *DevInst,
+		const XAie_DmaLoadCfg *Cfg, XAie_DmaLoadSlot *Slots,
+		u32 NumSlots, u32 NumRoutes)
+{
+	AieRC RC = XAIE_OK;
+
+	for(u32 s = 0U; s < NumSlots; s++) {
+		if(s < NumRoutes) {
+			RC |= XAie_StrmRouteClear(DevInst, &Slots[s].Route);
+			XAie_StrmRouteFree(&Slots[s].Route);
+		}
+		RC |= XAie_StrmRouterRelease(DevInst, Cfg->Router,
+				Slots[s].Flows, Slots[s].NumFlows);
+	}
+
+	return (RC == XAIE_OK) ? XAIE_OK : XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API loads blocks of data in the memories of AIE tiles and memory tiles
+* with the shim DMAs. The blocks are copied to the staging buffer, then loaded
+* in waves. A wave gives each pending block the closest free shim DMA from
+* which a stream path to its target tile can be placed, configures all the
+* paths, BDs and channels of the wave in one transaction, and waits for the
+* S2MM channels of the target tiles. The paths are released at the end of
+* each wave.
+*
+* @param	DevInst: Device Instance
+* @param	Cfg: Load configuration.
+* @param	Reqs: Blocks to load.
+* @param	NumReqs: Number of blocks.
+*
+* @return	XAIE_OK on success, XAIE_ERR_STREAM_PORT if a block has no free
+*		stream path, error code on failure.
+*
+* @note		The program memories are not reachable by the tile DMAs, use
+*		XAie_DataMemBlockWrite() or the elf loader for them. This API
+*		cannot be called while a transaction is active on the calling
+*		thread, since it waits for the transfers.
+*
+******************************************************************************/
+AieRC XAie_DmaLoad(XAie_DevInst *DevInst, const XAie_DmaLoadCfg *Cfg,
+		const XAie_DmaLoadReq *Reqs, u32 NumReqs)
+{
+	AieRC RC = XAIE_OK;
+	u32 MaxFlows, Remaining = NumReqs;
+	u64 Size = 0U;
+	u64 *Offsets;
+	u8 *Done;
+	XAie_DmaLoadSlot *Slots;
+	XAie_StrmFlow *Flows;
+	XAie_DmaWaitCh *Chs;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Cfg == XAIE_NULL) || (Cfg->MemInst == XAIE_NULL) ||
+			(Cfg->MemInst->VAddr == NULL) ||
+			(Cfg->Router == XAIE_NULL) ||
+			(Cfg->Router->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Cfg->ShimCh > 1U) || (Reqs == XAIE_NULL) ||
+			(NumReqs == 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE) {
+		XAIE_ERROR("DMA load cannot be recorded in a transaction\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumReqs; i++) {
+		RC = _XAie_DmaLoadCheckReq(DevInst, &Reqs[i]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		Size += Reqs[i].Size;
+	}
+
+	if(Size > Cfg->MemInst->Size) {
+		XAIE_ERROR("Staging buffer smaller than the blocks to load\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	MaxFlows = (u32)DevInst->NumCols * DevInst->NumRows;
+	Offsets = (u64 *)malloc(NumReqs * sizeof(*Offsets));
+	Done = (u8 *)calloc(NumReqs, sizeof(*Done));
+	Slots = (XAie_DmaLoadSlot *)malloc(DevInst->NumCols * sizeof(*Slots));
+	Flows = (XAie_StrmFlow *)malloc((size_t)DevInst->NumCols * MaxFlows *
+			sizeof(*Flows));
+	Chs = (XAie_DmaWaitCh *)malloc(DevInst->NumCols * sizeof(*Chs));
+	if((Offsets == NULL) || (Done == NULL) || (Slots == NULL) ||
+			(Flows == NULL) || (Chs == NULL)) {
+		XAIE_ERROR("Memory allocation for DMA load failed\n");
+		free(Offsets);
+		free(Done);
+		free(Slots);
+		free(Flows);
+		free(Chs);
+		return XAIE_ERR;
+	}
+
+	Size = 0U;
+	for(u32 i = 0U; i < NumReqs; i++) {
+		Offsets[i] = Size;
+		memcpy((u8 *)Cfg->MemInst->VAddr + Size, Reqs[i].Src,
+				Reqs[i].Size);
+		Size += Reqs[i].Size;
+	}
+	for(u32 s = 0U; s < DevInst->NumCols; s++) {
+		Slots[s].Flows = &Flows[(size_t)s * MaxFlows];
+	}
+
+	RC = XAie_MemSyncForDev(Cfg->MemInst);
+	while((RC == XAIE_OK) && (Remaining > 0U)) {
+		u32 NumSlots, NumRoutes = 0U;
+		AieRC ReleaseRC;
+
+		RC = _XAie_DmaLoadSchedule(DevInst, Cfg, Reqs, NumReqs, Done,
+				Slots, MaxFlows, &NumSlots);
+		if(RC != XAIE_OK) {
+			break;
+		}
+
+		if(NumSlots == 0U) {
+			XAIE_ERROR("No free stream path for DMA load\n");
+			RC = XAIE_ERR_STREAM_PORT;
+			break;
+		}
+
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		for(u32 s = 0U; (s < NumSlots) && (RC == XAIE_OK); s++) {
+			const XAie_DmaLoadReq *Req = &Reqs[Slots[s].Req];
+
+			RC = _XAie_DmaLoadStart(DevInst, Cfg, Req,
+					Offsets[Slots[s].Req], &Slots[s]);
+			if(RC == XAIE_OK) {
+				NumRoutes++;
+			}
+			Chs[s].Loc = Req->Loc;
+			Chs[s].ChNum = Cfg->TileCh;
+			Chs[s].Dir = DMA_S2MM;
+		}
+
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+			/* Only the compiled routes of the wave were applied */
+			NumRoutes = 0U;
+		}
+
+		if(RC == XAIE_OK) {
+			RC = XAie_DmaWaitForDoneMulti(DevInst, Chs, NumSlots,
+					XAIE_ENABLE, NULL, Cfg->TimeOutUs);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("DMA load timed out\n");
+			}
+		}
+
+		for(u32 s = 0U; (s < NumSlots) && (RC == XAIE_OK); s++) {
+			Done[Slots[s].Req] = XAIE_ENABLE;
+			Remaining--;
+		}
+
+		ReleaseRC = _XAie_DmaLoadRelease(DevInst, Cfg, Slots, NumSlots,
+				NumRoutes);
+		if(RC == XAIE_OK) {
+			RC = ReleaseRC;
+		}
+	}
+
+	free(Offsets);
+	free(Done);
+	free(Slots);
+	free(Flows);
+	free(Chs);
+
+	return RC;
+}
+
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_FEATURE_SS_ENABLE &&
+	  XAIE_FEATURE_PL_ENABLE */
+
+/** @} */
@@ -0,0 +1,66 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_load.h
+* @{
+*
+* This file contains the routines to load data in the memories of the AIE
+* tiles and memory tiles with the shim DMAs instead of register writes.
+*
+******************************************************************************/
+#ifndef XAIE_DMA_LOAD_H
+#define XAIE_DMA_LOAD_H
+
+/***************************** Include Files *********************************/
+#include "xaie_feature_config.h"
+#include "xaiegbl.h"
+#include "xaie_dma.h"
+#include "xaie_ss.h"
+
+#if defined(XAIE_FEATURE_DMA_ENABLE) && defined(XAIE_FEATURE_SS_ENABLE) && \
+	defined(XAIE_FEATURE_PL_ENABLE)
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures a block of data to load in the memory of an AIE tile
+ * or memory tile. Addr and Size are word aligned.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u32 Addr;
+	const void *Src;
+	u32 Size;
+} XAie_DmaLoadReq;
+
+/*
+ * This typedef captures the resources used by XAie_DmaLoad(). The data is
+ * staged in MemInst and pulled by the shim DMA MM2S channel ShimCh with BD
+ * ShimBd, through a stream path placed with Router, into the S2MM channel
+ * TileCh of the target tile with BD TileBd. These channels and BDs must not
+ * be in use while the load runs.
+ */
+typedef struct {
+	XAie_MemInst *MemInst;
+	XAie_StrmRouter *Router;
+	u8 ShimCh;
+	u8 ShimBd;
+	u8 TileCh;
+	u8 TileBd;
+	u32 TimeOutUs;		/* Time out of each wave, 0 for the default */
+} XAie_DmaLoadCfg;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_DmaLoad(XAie_DevInst *DevInst, const XAie_DmaLoadCfg *Cfg,
+		const XAie_DmaLoadReq *Reqs, u32 NumReqs);
+
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_FEATURE_SS_ENABLE &&
+	  XAIE_FEATURE_PL_ENABLE */
+
+#endif		/* end of protection macro */
+
+/** @} */
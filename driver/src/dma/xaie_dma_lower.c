@@ -0,0 +1,361 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_lower.c
+* @{
+*
+* This file contains routines for lowering a strided access to a tensor into
+* a chain of DMA descriptors. The access is first normalized, the dimensions
+* of one element are dropped and the dimensions contiguous in the buffer are
+* merged, so the innermost dimension moves the longest bursts. The innermost
+* dimensions are then mapped onto the address dimensions of the BD, splitting
+* the ones larger than a wrap, the outermost remaining dimension onto the BD
+* iteration, and any dimension left is unrolled into a chain of BDs.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include "xaie_dma_lower.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaiegbl_regdef.h"
+
+#ifdef XAIE_FEATURE_DMA_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_DMA_LOWER_WORD_SHIFT	2U
+#define XAIE_DMA_LOWER_MAX_HW_DIMS	4U
+/* Every split of a dimension for a wrap adds one dimension */
+#define XAIE_DMA_LOWER_MAX_DIMS		(XAIE_DMA_ACCESS_MAX_DIMS + \
+		XAIE_DMA_LOWER_MAX_HW_DIMS)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u32 Size;
+	u32 Stride;
+	u8 Before;
+	u8 After;
+} XAie_DmaLowerDim;
+
+/************************** Function Definitions *****************************/
+static inline u8 _XAie_DmaLowerIsPadded(const XAie_DmaLowerDim *Dim)
+{
+	return (Dim->Before != 0U) || (Dim->After != 0U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the largest factor of a dimension size which fits a wrap.
+*
+* @param	Size: Size of the dimension.
+* @param	WrapMax: Largest wrap of the BD.
+*
+* @return	Largest factor, 1 if the size has no factor which fits.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u32 _XAie_DmaLowerWrapFactor(u32 Size, u32 WrapMax)
+{
+	for(u32 Factor = (Size < WrapMax) ? Size : WrapMax; Factor > 1U;
+			Factor--) {
+		if((Size % Factor) == 0U) {
+			return Factor;
+		}
+	}
+
+	return 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API lowers a strided access to a tensor into the chain of DMA
+* descriptors with the fewest BDs. The descriptors use the address
+* dimensions, the iteration and the zero padding of the BDs of the tile of
+* the template descriptor as far as the hardware limits allow.
+*
+* @param	DevInst: Device Instance
+* @param	Tmpl: Initialized Dma Descriptor. Every descriptor is copied
+*		from the template, with the lock, packet and other settings
+*		which are not set up by the lowering. The template must not
+*		set up address dimensions, padding or iteration.
+* @param	Access: Access to lower.
+* @param	Addr: Address of the first element of the tensor. For shim
+*		tiles, it is the device address of the buffer.
+* @param	Descs: Array to return the descriptors, in chain order.
+* @param	NumDescs: Pointer to the number of descriptors in Descs. It
+*		returns the number of descriptors of the chain, also when
+*		Descs is too small for it.
+* @param	RepeatCount: Pointer to return the repeat count to start the
+*		chain with, when the outermost dimension is mapped onto the
+*		BD iteration. It is 1 otherwise.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if Descs is
+*		too small for the chain, Error code on failure.
+*
+* @note		The descriptors are not chained and not written to the
+*		hardware. Chain and start them with XAie_DmaSchedSubmit(), or
+*		with XAie_DmaSetNextBd(), XAie_DmaWriteBds() and
+*		XAie_DmaChannelSetStartQueue() with the repeat count.
+*		The length of each BD is that of its padded access.
+*		On AIE, only contiguous runs are lowered into BDs, one per run.
+*
+******************************************************************************/
+AieRC XAie_DmaLowerAccess(XAie_DevInst *DevInst, const XAie_DmaDesc *Tmpl,
+		const XAie_DmaAccess *Access, u64 Addr, XAie_DmaDesc *Descs,
+		u8 *NumDescs, u32 *RepeatCount)
+{
+	AieRC RC;
+	u8 NumHwDims, NumHw = 0U, Padded = 0U, Iter = 0U;
+	u32 N = 0U, i = 0U, StepMax, WrapMax, ChainEnd;
+	u64 Base = 0U, Len = 1U, NumBds = 1U;
+	const XAie_DmaMod *DmaMod;
+	const XAie_DmaBdProp *BdProp;
+	XAie_DmaLowerDim Dims[XAIE_DMA_LOWER_MAX_DIMS];
+	XAie_DmaDimDesc HwDims[XAIE_DMA_LOWER_MAX_HW_DIMS];
+	XAie_PadDesc HwPads[XAIE_DMA_LOWER_MAX_HW_DIMS];
+	XAie_DmaTensor Tensor;
+	XAie_DmaPadTensor PadTensor;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Tmpl == XAIE_NULL) || (Tmpl->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Dma Descriptor\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Access == XAIE_NULL) || (Access->Dim == XAIE_NULL) ||
+			(Access->NumDim == 0U) ||
+			(Access->NumDim > XAIE_DMA_ACCESS_MAX_DIMS) ||
+			(Descs == XAIE_NULL) || (NumDescs == XAIE_NULL) ||
+			(RepeatCount == XAIE_NULL)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	DmaMod = Tmpl->DmaMod;
+	BdProp = DmaMod->BdProp;
+
+	/* Drop the dimensions of one element and merge contiguous ones */
+	for(u8 d = 0U; d < Access->NumDim; d++) {
+		const XAie_DmaAccessDim *A = &Access->Dim[d];
+		XAie_DmaLowerDim Dim = {A->Size, A->Stride, A->Before,
+			A->After};
+
+		if((A->Size == 0U) ||
+				((u64)A->Offset + A->Size > A->Extent)) {
+			XAIE_ERROR("Invalid window for dimension %d\n", d);
+			return XAIE_INVALID_ARGS;
+		}
+
+		if(_XAie_DmaLowerIsPadded(&Dim)) {
+			if(DmaMod->Padding == XAIE_FEATURE_UNAVAILABLE) {
+				XAIE_ERROR("Padding is not supported for the tile\n");
+				return XAIE_FEATURE_NOT_SUPPORTED;
+			}
+			Padded = 1U;
+		}
+
+		Base += (u64)A->Offset * A->Stride;
+		if((A->Size == 1U) && (_XAie_DmaLowerIsPadded(&Dim) == 0U)) {
+			continue;
+		}
+
+		if((N > 0U) && (_XAie_DmaLowerIsPadded(&Dim) == 0U) &&
+				(_XAie_DmaLowerIsPadded(&Dims[N - 1U]) == 0U) &&
+				((u64)Dims[N - 1U].Stride * Dims[N - 1U].Size ==
+				 A->Stride) &&
+				((u64)Dims[N - 1U].Size * A->Size <= 0xFFFFFFFFU)) {
+			Dims[N - 1U].Size *= A->Size;
+			continue;
+		}
+
+		Dims[N++] = Dim;
+	}
+
+	if(N == 0U) {
+		Dims[0U].Size = 1U;
+		Dims[0U].Stride = 1U;
+		Dims[0U].Before = 0U;
+		Dims[0U].After = 0U;
+		N = 1U;
+	}
+
+	/* AIE BDs are lowered as contiguous runs only */
+	if(DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) {
+		NumHwDims = 1U;
+		StepMax = 1U;
+		WrapMax = 0U;
+	} else {
+		NumHwDims = DmaMod->NumAddrDim;
+		StepMax = BdProp->StepSizeMax;
+		WrapMax = BdProp->WrapMax;
+	}
+
+	/*
+	 * Map the innermost dimensions onto the BD address dimensions. All of
+	 * them but the outermost one have a wrap, the outermost one is bounded
+	 * by the length of the BD.
+	 */
+	while((i < N) && (NumHw < NumHwDims)) {
+		XAie_DmaLowerDim *D = &Dims[i];
+		u8 HasWrap = (NumHw + 1U < NumHwDims);
+		u8 Outer = (HasWrap == 0U) || (i + 1U == N);
+		u32 Factor;
+
+		if((D->Stride == 0U) || (D->Stride > StepMax)) {
+			break;
+		}
+
+		if((Outer != 0U) && (_XAie_DmaLowerIsPadded(D) == 0U)) {
+			HwDims[NumHw].AieMlDimDesc.StepSize = D->Stride;
+			HwDims[NumHw].AieMlDimDesc.Wrap = 0U;
+			HwPads[NumHw].Before = 0U;
+			HwPads[NumHw].After = 0U;
+			Len *= D->Size;
+			NumHw++;
+			i++;
+			break;
+		}
+
+		if((HasWrap != 0U) && (D->Size <= WrapMax)) {
+			HwDims[NumHw].AieMlDimDesc.StepSize = D->Stride;
+			HwDims[NumHw].AieMlDimDesc.Wrap = (u16)D->Size;
+			HwPads[NumHw].Before = D->Before;
+			HwPads[NumHw].After = D->After;
+			Len *= (u64)D->Size + D->Before + D->After;
+			NumHw++;
+			i++;
+			continue;
+		}
+
+		if(_XAie_DmaLowerIsPadded(D) != 0U) {
+			break;
+		}
+
+		/* Split the dimension so that its inner part fits a wrap */
+		Factor = _XAie_DmaLowerWrapFactor(D->Size, WrapMax);
+		if((Factor > 1U) && (N < XAIE_DMA_LOWER_MAX_DIMS)) {
+			for(u32 j = N; j > i + 1U; j--) {
+				Dims[j] = Dims[j - 1U];
+			}
+			Dims[i + 1U].Size = D->Size / Factor;
+			Dims[i + 1U].Stride = D->Stride * Factor;
+			Dims[i + 1U].Before = 0U;
+			Dims[i + 1U].After = 0U;
+			D->Size = Factor;
+			N++;
+			continue;
+		}
+
+		HwDims[NumHw].AieMlDimDesc.StepSize = D->Stride;
+		HwDims[NumHw].AieMlDimDesc.Wrap = 0U;
+		HwPads[NumHw].Before = 0U;
+		HwPads[NumHw].After = 0U;
+		Len *= D->Size;
+		NumHw++;
+		i++;
+		break;
+	}
+
+	if(Len > (0xFFFFFFFFU >> XAIE_DMA_LOWER_WORD_SHIFT)) {
+		XAIE_ERROR("Invalid length of the access\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 j = i; j < N; j++) {
+		if(_XAie_DmaLowerIsPadded(&Dims[j]) != 0U) {
+			XAIE_ERROR("Padding of dimension %d exceeds the BD dimensions\n",
+					j);
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	/* Map the outermost remaining dimension onto the BD iteration */
+	ChainEnd = N;
+	if((i < N) && (BdProp->IterWrapMax != 0U) &&
+			(Dims[N - 1U].Stride != 0U) &&
+			(Dims[N - 1U].Stride <= BdProp->IterStepSizeMax) &&
+			(Dims[N - 1U].Size <= BdProp->IterWrapMax)) {
+		Iter = 1U;
+		ChainEnd = N - 1U;
+	}
+
+	for(u32 j = i; j < ChainEnd; j++) {
+		NumBds *= Dims[j].Size;
+		if(NumBds > 0xFFU) {
+			break;
+		}
+	}
+
+	if(NumBds > *NumDescs) {
+		XAIE_ERROR("Not enough descriptors for the access\n");
+		*NumDescs = (NumBds > 0xFFU) ? 0xFFU : (u8)NumBds;
+		return XAIE_INSUFFICIENT_BUFFER_SIZE;
+	}
+
+	Tensor.NumDim = NumHw;
+	Tensor.Dim = HwDims;
+	PadTensor.NumDim = NumHw;
+	PadTensor.PadDesc = HwPads;
+
+	for(u32 b = 0U; b < NumBds; b++) {
+		XAie_DmaDesc *Desc = &Descs[b];
+		u64 Off = Base;
+		u32 Rem = b;
+
+		for(u32 j = i; j < ChainEnd; j++) {
+			Off += (u64)(Rem % Dims[j].Size) * Dims[j].Stride;
+			Rem /= Dims[j].Size;
+		}
+
+		*Desc = *Tmpl;
+		Desc->MemInst = XAIE_NULL;
+		if((NumHw == 0U) || ((NumHw == 1U) &&
+				(HwDims[0U].AieMlDimDesc.StepSize == 1U))) {
+			RC = XAie_DmaSetAddrLen(Desc,
+					Addr + (Off << XAIE_DMA_LOWER_WORD_SHIFT),
+					(u32)(Len << XAIE_DMA_LOWER_WORD_SHIFT));
+		} else {
+			RC = XAie_DmaSetMultiDimAddr(Desc, &Tensor,
+					Addr + (Off << XAIE_DMA_LOWER_WORD_SHIFT),
+					(u32)(Len << XAIE_DMA_LOWER_WORD_SHIFT));
+		}
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		if(Padded != 0U) {
+			RC = XAie_DmaSetPadding(Desc, &PadTensor);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		if(Iter != 0U) {
+			RC = XAie_DmaSetBdIteration(Desc, Dims[N - 1U].Stride,
+					(u8)Dims[N - 1U].Size, 0U);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+	}
+
+	*NumDescs = (u8)NumBds;
+	*RepeatCount = (Iter != 0U) ? Dims[N - 1U].Size : 1U;
+
+	return XAIE_OK;
+}
+
+#endif /* XAIE_FEATURE_DMA_ENABLE */
+/** @} */
@@ -0,0 +1,60 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_lower.h
+* @{
+*
+* This file contains the routines for lowering a strided access to a tensor
+* into a chain of DMA descriptors.
+*
+******************************************************************************/
+#ifndef XAIE_DMA_LOWER_H
+#define XAIE_DMA_LOWER_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaie_dma.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_DMA_ACCESS_MAX_DIMS	8U
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures one dimension of an access to a tensor. The access
+ * moves the window of Size elements from Offset, out of the Extent elements
+ * of the dimension. Stride is the distance between two elements of the
+ * dimension in the buffer, in 32 bit words. Before and After are the
+ * elements of zeros padded around the window, for the tiles which support
+ * zero padding.
+ */
+typedef struct {
+	u32 Extent;
+	u32 Offset;
+	u32 Size;
+	u32 Stride;
+	u8 Before;
+	u8 After;
+} XAie_DmaAccessDim;
+
+/*
+ * This typedef captures an access to a tensor. Dim[0] is the innermost
+ * dimension.
+ */
+typedef struct {
+	u8 NumDim;
+	const XAie_DmaAccessDim *Dim;
+} XAie_DmaAccess;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_DmaLowerAccess(XAie_DevInst *DevInst, const XAie_DmaDesc *Tmpl,
+		const XAie_DmaAccess *Access, u64 Addr, XAie_DmaDesc *Descs,
+		u8 *NumDescs, u32 *RepeatCount);
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -0,0 +1,621 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_memtile.c
+* @{
+*
+* This file contains routines for allocating DMA buffers in the memory of the
+* memory tiles. The memory of a memory tile is made of banks of consecutive
+* addresses, and two DMA channels accessing the same bank at the same time
+* slow each other down. The allocator keeps track of the bytes allocated in
+* each bank, so that buffers can be spread over the banks, kept away from the
+* banks of other buffers, and ping and pong buffers placed in different
+* banks. The memory tile DMAs also reach the memory of their west and east
+* neighbours, which the allocator uses when the memory of a tile is full.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <string.h>
+
+#include "xaie_dma_memtile.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaiegbl_regdef.h"
+
+#if defined(XAIE_FEATURE_DMA_ENABLE) && defined(XAIE_FEATURE_DATAMEM_ENABLE)
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the bitmap of the banks a range of the memory spans.
+*
+* @param	Alloc: Pointer to the allocator.
+* @param	Offset: Start of the range.
+* @param	Size: Size of the range in bytes.
+*
+* @return	Bitmap of the banks.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u32 _XAie_MemTileGetBanks(const XAie_MemTileAlloc *Alloc, u32 Offset,
+		u32 Size)
+{
+	u32 First = Offset / Alloc->BankSize;
+	u32 Last = (Offset + Size - 1U) / Alloc->BankSize;
+	u32 Banks = 0U;
+
+	for(u32 b = First; b <= Last; b++) {
+		Banks |= 1U << b;
+	}
+
+	return Banks;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API marks a range of granules as allocated or free, and accounts the
+* bytes of the range to the banks it spans.
+*
+* @param	Alloc: Pointer to the allocator.
+* @param	Offset: Start of the range, aligned to the granule.
+* @param	Size: Size of the range in bytes, a multiple of the granule.
+* @param	Used: XAIE_ENABLE to allocate the range, XAIE_DISABLE to free
+*		it.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_MemTileMark(XAie_MemTileAlloc *Alloc, u32 Offset, u32 Size,
+		u8 Used)
+{
+	for(u32 g = Offset / XAIE_MEMTILE_ALLOC_GRANULE;
+			g < (Offset + Size) / XAIE_MEMTILE_ALLOC_GRANULE; g++) {
+		if(Used == XAIE_ENABLE) {
+			Alloc->Used[g / 32U] |= 1U << (g % 32U);
+		} else {
+			Alloc->Used[g / 32U] &= ~(1U << (g % 32U));
+		}
+	}
+
+	for(u32 Start = Offset; Start < Offset + Size;) {
+		u32 Bank = Start / Alloc->BankSize;
+		u32 End = (Bank + 1U) * Alloc->BankSize;
+
+		if(End > Offset + Size) {
+			End = Offset + Size;
+		}
+		if(Used == XAIE_ENABLE) {
+			Alloc->BankLoad[Bank] += End - Start;
+		} else {
+			Alloc->BankLoad[Bank] -= End - Start;
+		}
+		Start = End;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API searches the lowest free range of granules which starts between
+* two offsets and does not span the banks to avoid.
+*
+* @param	Alloc: Pointer to the allocator.
+* @param	Lo: Lowest start of the range.
+* @param	Hi: Highest start of the range, exclusive.
+* @param	Size: Size of the range in bytes, a multiple of the granule.
+* @param	Align: Alignment of the range, a multiple of the granule.
+* @param	AvoidBanks: Bitmap of the banks the range must not span.
+* @param	Offset: Pointer to return the start of the range.
+*
+* @return	XAIE_OK if a range is found, XAIE_ERR otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_MemTileFind(const XAie_MemTileAlloc *Alloc, u32 Lo, u32 Hi,
+		u32 Size, u32 Align, u32 AvoidBanks, u32 *Offset)
+{
+	u32 Start = (Lo + Align - 1U) & ~(Align - 1U);
+
+	while((Start < Hi) && (Start + Size <= Alloc->Size)) {
+		u32 Avoid = _XAie_MemTileGetBanks(Alloc, Start, Size) &
+			AvoidBanks;
+		u32 End;
+
+		if(Avoid != 0U) {
+			/* Skip past the lowest bank to avoid */
+			End = Alloc->BankSize;
+			while((Avoid & 1U) == 0U) {
+				Avoid >>= 1U;
+				End += Alloc->BankSize;
+			}
+		} else {
+			for(End = Start; End < Start + Size;
+					End += XAIE_MEMTILE_ALLOC_GRANULE) {
+				u32 g = End / XAIE_MEMTILE_ALLOC_GRANULE;
+
+				if((Alloc->Used[g / 32U] &
+						(1U << (g % 32U))) != 0U) {
+					break;
+				}
+			}
+			if(End == Start + Size) {
+				*Offset = Start;
+				return XAIE_OK;
+			}
+			End += XAIE_MEMTILE_ALLOC_GRANULE;
+		}
+
+		Start = (End + Align - 1U) & ~(Align - 1U);
+	}
+
+	return XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API allocates a buffer without reporting a full memory.
+*
+* @param	Alloc: Pointer to the allocator.
+* @param	Size: Size of the buffer in bytes, a multiple of the granule.
+* @param	Align: Alignment of the buffer, a multiple of the granule.
+* @param	Policy: Placement policy.
+* @param	AvoidBanks: Bitmap of the banks the buffer must not span.
+* @param	Buf: Pointer to return the buffer.
+*
+* @return	XAIE_OK on success, XAIE_ERR if there is no room.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_MemTileAlloc(XAie_MemTileAlloc *Alloc, u32 Size, u32 Align,
+		XAie_MemTileAllocPolicy Policy, u32 AvoidBanks,
+		XAie_MemTileBuf *Buf)
+{
+	AieRC RC = XAIE_ERR;
+	u8 Order[XAIE_MEMTILE_ALLOC_MAX_BANKS];
+	u32 Offset = 0U;
+
+	if(Policy == XAIE_MEMTILE_ALLOC_FIRST_FIT) {
+		RC = _XAie_MemTileFind(Alloc, 0U, Alloc->Size, Size, Align,
+				AvoidBanks, &Offset);
+	} else {
+		/* Try the banks from the least loaded one */
+		for(u8 i = 0U; i < Alloc->NumBanks; i++) {
+			u8 j = i;
+
+			while((j > 0U) && (Alloc->BankLoad[Order[j - 1U]] >
+						Alloc->BankLoad[i])) {
+				Order[j] = Order[j - 1U];
+				j--;
+			}
+			Order[j] = i;
+		}
+
+		for(u8 i = 0U; (i < Alloc->NumBanks) && (RC != XAIE_OK); i++) {
+			u32 Bank = Order[i];
+
+			if((AvoidBanks & (1U << Bank)) != 0U) {
+				continue;
+			}
+			RC = _XAie_MemTileFind(Alloc, Bank * Alloc->BankSize,
+					(Bank + 1U) * Alloc->BankSize, Size,
+					Align, AvoidBanks, &Offset);
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	_XAie_MemTileMark(Alloc, Offset, Size, XAIE_ENABLE);
+	Buf->Loc = Alloc->Loc;
+	Buf->Offset = Offset;
+	Buf->Size = Size;
+	Buf->Banks = _XAie_MemTileGetBanks(Alloc, Offset, Size);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks the arguments of a buffer allocation and rounds the size and
+* the alignment up to the granule.
+*
+* @param	Alloc: Pointer to the allocator.
+* @param	Size: Pointer to the size of the buffer in bytes.
+* @param	Align: Pointer to the alignment of the buffer, a power of two.
+*		0 for the granule.
+* @param	Policy: Placement policy.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_MemTileAllocCheck(const XAie_MemTileAlloc *Alloc,
+		u32 *Size, u32 *Align, XAie_MemTileAllocPolicy Policy)
+{
+	if((Alloc == XAIE_NULL) || (Alloc->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid memory tile allocator\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((*Size == 0U) || (*Size > Alloc->Size) ||
+			((*Align & (*Align - 1U)) != 0U) ||
+			(*Align > Alloc->Size) ||
+			(Policy >= XAIE_MEMTILE_ALLOC_POLICY_MAX)) {
+		XAIE_ERROR("Invalid size, alignment or policy\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	*Size = (*Size + XAIE_MEMTILE_ALLOC_GRANULE - 1U) &
+		~(XAIE_MEMTILE_ALLOC_GRANULE - 1U);
+	if(*Align < XAIE_MEMTILE_ALLOC_GRANULE) {
+		*Align = XAIE_MEMTILE_ALLOC_GRANULE;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes the allocator of the memory of a memory tile. All the
+* memory is free.
+*
+* @param	DevInst: Device Instance.
+* @param	Alloc: Pointer to the user allocated allocator.
+* @param	Loc: Location of the memory tile.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The allocator only tracks the buffers it hands out, memory
+*		used by other means must be allocated from it first.
+*
+******************************************************************************/
+AieRC XAie_MemTileAllocInit(XAie_DevInst *DevInst, XAie_MemTileAlloc *Alloc,
+		XAie_LocType Loc)
+{
+	const XAie_MemMod *MemMod;
+
+	if((DevInst == XAIE_NULL) || (Alloc == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_DevGetTTypefromLoc(DevInst, Loc) !=
+			XAIEGBL_TILE_TYPE_MEMTILE) {
+		XAIE_ERROR("Invalid tile type, expected a memory tile\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	MemMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_MEMTILE].MemMod;
+	if((MemMod == XAIE_NULL) || (MemMod->NumBanks == 0U) ||
+			(MemMod->NumBanks > XAIE_MEMTILE_ALLOC_MAX_BANKS) ||
+			(MemMod->Size > XAIE_MEMTILE_ALLOC_MAX_SIZE)) {
+		XAIE_ERROR("Memory tile allocation is not supported\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	memset((void *)Alloc, 0U, sizeof(*Alloc));
+	Alloc->Loc = Loc;
+	Alloc->Size = MemMod->Size;
+	Alloc->NumBanks = MemMod->NumBanks;
+	Alloc->BankSize = MemMod->Size / MemMod->NumBanks;
+	Alloc->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API allocates a buffer in the memory of a memory tile.
+*
+* @param	Alloc: Pointer to the allocator.
+* @param	Size: Size of the buffer in bytes.
+* @param	Align: Alignment of the buffer, a power of two. 0 for the
+*		granule of the allocator.
+* @param	Policy: Placement policy.
+* @param	AvoidBanks: Bitmap of the banks the buffer must not span, for
+*		instance the banks of the buffers accessed by the other
+*		channels at the same time.
+* @param	Buf: Pointer to return the buffer.
+*
+* @return	XAIE_OK on success, XAIE_ERR if there is no room, error code
+*		on failure.
+*
+* @note		The size and the alignment are rounded up to the granule of
+*		the allocator.
+*
+******************************************************************************/
+AieRC XAie_MemTileAllocBuf(XAie_MemTileAlloc *Alloc, u32 Size, u32 Align,
+		XAie_MemTileAllocPolicy Policy, u32 AvoidBanks,
+		XAie_MemTileBuf *Buf)
+{
+	AieRC RC;
+
+	if(Buf == XAIE_NULL) {
+		XAIE_ERROR("Invalid buffer pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_MemTileAllocCheck(Alloc, &Size, &Align, Policy);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_MemTileAlloc(Alloc, Size, Align, Policy, AvoidBanks, Buf);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("No room for 0x%x bytes in memory tile (%d, %d)\n",
+				Size, Alloc->Loc.Col, Alloc->Loc.Row);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API allocates a buffer for the DMA of a memory tile, in its own memory
+* or, if it is full, in the memory of its west or east neighbour.
+*
+* @param	Allocs: Array of the allocators of the memory tiles.
+* @param	NumAllocs: Number of allocators.
+* @param	DmaLoc: Location of the memory tile of the DMA.
+* @param	Size: Size of the buffer in bytes.
+* @param	Align: Alignment of the buffer, a power of two. 0 for the
+*		granule of the allocator.
+* @param	Policy: Placement policy.
+* @param	AvoidBanks: Bitmap of the banks the buffer must not span.
+* @param	Buf: Pointer to return the buffer.
+*
+* @return	XAIE_OK on success, XAIE_ERR if there is no room, error code
+*		on failure.
+*
+* @note		The address of the buffer for the DMA is returned by
+*		XAie_MemTileBufGetDmaAddr().
+*
+******************************************************************************/
+AieRC XAie_MemTileAllocBufNear(XAie_MemTileAlloc *Allocs, u8 NumAllocs,
+		XAie_LocType DmaLoc, u32 Size, u32 Align,
+		XAie_MemTileAllocPolicy Policy, u32 AvoidBanks,
+		XAie_MemTileBuf *Buf)
+{
+	/* Column offsets of the tile itself, its west and east neighbours */
+	const s8 ColOff[] = {0, -1, 1};
+
+	if((Allocs == XAIE_NULL) || (Buf == XAIE_NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u8 n = 0U; n < sizeof(ColOff) / sizeof(ColOff[0]); n++) {
+		for(u8 i = 0U; i < NumAllocs; i++) {
+			XAie_MemTileAlloc *Alloc = &Allocs[i];
+			u32 BufSize = Size, BufAlign = Align;
+			AieRC RC;
+
+			if((Alloc->Loc.Row != DmaLoc.Row) ||
+					((s32)Alloc->Loc.Col !=
+					 (s32)DmaLoc.Col + ColOff[n])) {
+				continue;
+			}
+
+			RC = _XAie_MemTileAllocCheck(Alloc, &BufSize,
+					&BufAlign, Policy);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+
+			if(_XAie_MemTileAlloc(Alloc, BufSize, BufAlign, Policy,
+						AvoidBanks, Buf) == XAIE_OK) {
+				return XAIE_OK;
+			}
+		}
+	}
+
+	XAIE_ERROR("No room for 0x%x bytes near memory tile (%d, %d)\n", Size,
+			DmaLoc.Col, DmaLoc.Row);
+	return XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API allocates a pair of ping and pong buffers of the same size in the
+* memory of a memory tile. The buffers are placed in different banks when
+* there is room, so that the channels writing one buffer and reading the other
+* one do not conflict.
+*
+* @param	Alloc: Pointer to the allocator.
+* @param	Size: Size of each buffer in bytes.
+* @param	Align: Alignment of the buffers, a power of two. 0 for the
+*		granule of the allocator.
+* @param	AvoidBanks: Bitmap of the banks the buffers must not span.
+* @param	Ping: Pointer to return the ping buffer.
+* @param	Pong: Pointer to return the pong buffer.
+*
+* @return	XAIE_OK on success, XAIE_ERR if there is no room, error code
+*		on failure.
+*
+* @note		The buffers share banks only if there is no room otherwise,
+*		which shows in their Banks bitmaps.
+*
+******************************************************************************/
+AieRC XAie_MemTileAllocPingPong(XAie_MemTileAlloc *Alloc, u32 Size,
+		u32 Align, u32 AvoidBanks, XAie_MemTileBuf *Ping,
+		XAie_MemTileBuf *Pong)
+{
+	AieRC RC;
+
+	if((Ping == XAIE_NULL) || (Pong == XAIE_NULL)) {
+		XAIE_ERROR("Invalid buffer pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_MemTileAllocCheck(Alloc, &Size, &Align,
+			XAIE_MEMTILE_ALLOC_BANK_SPREAD);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_MemTileAlloc(Alloc, Size, Align,
+			XAIE_MEMTILE_ALLOC_BANK_SPREAD, AvoidBanks, Ping);
+	if(RC == XAIE_OK) {
+		RC = _XAie_MemTileAlloc(Alloc, Size, Align,
+				XAIE_MEMTILE_ALLOC_BANK_SPREAD,
+				AvoidBanks | Ping->Banks, Pong);
+		if(RC != XAIE_OK) {
+			RC = _XAie_MemTileAlloc(Alloc, Size, Align,
+					XAIE_MEMTILE_ALLOC_BANK_SPREAD,
+					AvoidBanks, Pong);
+		}
+		if(RC != XAIE_OK) {
+			_XAie_MemTileMark(Alloc, Ping->Offset, Ping->Size,
+					XAIE_DISABLE);
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("No room for 2 x 0x%x bytes in memory tile (%d, %d)\n",
+				Size, Alloc->Loc.Col, Alloc->Loc.Row);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees a buffer allocated from a memory tile allocator.
+*
+* @param	Alloc: Pointer to the allocator.
+* @param	Buf: Buffer to free.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_MemTileFreeBuf(XAie_MemTileAlloc *Alloc, const XAie_MemTileBuf *Buf)
+{
+	if((Alloc == XAIE_NULL) || (Buf == XAIE_NULL) ||
+			(Alloc->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Buf->Loc.Col != Alloc->Loc.Col) ||
+			(Buf->Loc.Row != Alloc->Loc.Row) ||
+			(Buf->Size == 0U) ||
+			((Buf->Offset % XAIE_MEMTILE_ALLOC_GRANULE) != 0U) ||
+			((Buf->Size % XAIE_MEMTILE_ALLOC_GRANULE) != 0U) ||
+			(Buf->Offset + Buf->Size > Alloc->Size)) {
+		XAIE_ERROR("Buffer does not belong to the allocator\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_MemTileMark(Alloc, Buf->Offset, Buf->Size, XAIE_DISABLE);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the address of a buffer for the DMA of a memory tile. The
+* memory tile DMA sees the memory of its west neighbour, its own memory and the
+* memory of its east neighbour one after the other.
+*
+* @param	Alloc: Allocator of the buffer.
+* @param	Buf: Buffer.
+* @param	DmaLoc: Location of the memory tile of the DMA.
+* @param	Addr: Pointer to return the address of the buffer.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_MemTileBufGetDmaAddr(const XAie_MemTileAlloc *Alloc,
+		const XAie_MemTileBuf *Buf, XAie_LocType DmaLoc, u64 *Addr)
+{
+	s32 Dist;
+
+	if((Alloc == XAIE_NULL) || (Buf == XAIE_NULL) || (Addr == XAIE_NULL) ||
+			(Alloc->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Dist = (s32)Buf->Loc.Col - (s32)DmaLoc.Col;
+	if((Buf->Loc.Row != DmaLoc.Row) || (Dist < -1) || (Dist > 1)) {
+		XAIE_ERROR("Buffer is not reachable by the DMA\n");
+		return XAIE_INVALID_ADDRESS;
+	}
+
+	*Addr = (u64)(Dist + 1) * Alloc->Size + Buf->Offset;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API updates the address and the length of a BD written from a BD
+* template to a buffer of a memory tile allocator.
+*
+* @param	DevInst: Device Instance
+* @param	Tmpl: Initialized BD template.
+* @param	Loc: Location of the memory tile of the DMA.
+* @param	BdNum: Hardware BD number to be updated.
+* @param	Alloc: Allocator of the buffer.
+* @param	Buf: Buffer.
+* @param	Len: Length of the transfer in bytes, at most the size of the
+*		buffer.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The BD is expected to hold the template image, written with
+*		XAie_DmaBdTemplateWrite().
+*
+******************************************************************************/
+AieRC XAie_MemTileBufPatchBd(XAie_DevInst *DevInst,
+		const XAie_DmaBdTemplate *Tmpl, XAie_LocType Loc, u8 BdNum,
+		const XAie_MemTileAlloc *Alloc, const XAie_MemTileBuf *Buf,
+		u32 Len)
+{
+	AieRC RC;
+	u64 Addr;
+
+	RC = XAie_MemTileBufGetDmaAddr(Alloc, Buf, Loc, &Addr);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Len > Buf->Size) {
+		XAIE_ERROR("Transfer length exceeds the buffer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_DmaBdTemplatePatch(DevInst, Tmpl, Loc, BdNum, Addr, Len);
+}
+
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_FEATURE_DATAMEM_ENABLE */
+
+/** @} */
@@ -0,0 +1,96 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_memtile.h
+* @{
+*
+* This file contains the routines for allocating DMA buffers in the memory of
+* the memory tiles.
+*
+******************************************************************************/
+#ifndef XAIE_DMA_MEMTILE_H
+#define XAIE_DMA_MEMTILE_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaie_dma.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_MEMTILE_ALLOC_GRANULE	64U
+#define XAIE_MEMTILE_ALLOC_MAX_SIZE	0x80000U
+#define XAIE_MEMTILE_ALLOC_MAP_WORDS	(XAIE_MEMTILE_ALLOC_MAX_SIZE / \
+		XAIE_MEMTILE_ALLOC_GRANULE / 32U)
+#define XAIE_MEMTILE_ALLOC_MAX_BANKS	32U
+
+/**************************** Type Definitions *******************************/
+/*
+ * This enum contains the placement policies of the memory tile allocator.
+ *	XAIE_MEMTILE_ALLOC_FIRST_FIT: Lowest free address.
+ *	XAIE_MEMTILE_ALLOC_BANK_SPREAD: Lowest free address in the least
+ *		loaded bank, so that buffers used at the same time tend to sit
+ *		in different banks.
+ */
+typedef enum {
+	XAIE_MEMTILE_ALLOC_FIRST_FIT,
+	XAIE_MEMTILE_ALLOC_BANK_SPREAD,
+	XAIE_MEMTILE_ALLOC_POLICY_MAX
+} XAie_MemTileAllocPolicy;
+
+/*
+ * This typedef captures a buffer in the memory of a memory tile. Offset is
+ * relative to the memory of the tile and Banks is the bitmap of the banks the
+ * buffer spans.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u32 Offset;
+	u32 Size;
+	u32 Banks;
+} XAie_MemTileBuf;
+
+/*
+ * This typedef captures the allocator of the memory of one memory tile. The
+ * memory is split in granules of XAIE_MEMTILE_ALLOC_GRANULE bytes, Used is
+ * the bitmap of the allocated granules and BankLoad the number of bytes
+ * allocated in each bank.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u32 Size;
+	u32 BankSize;
+	u8 NumBanks;
+	u32 Used[XAIE_MEMTILE_ALLOC_MAP_WORDS];
+	u32 BankLoad[XAIE_MEMTILE_ALLOC_MAX_BANKS];
+	u8 IsReady;
+} XAie_MemTileAlloc;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_MemTileAllocInit(XAie_DevInst *DevInst, XAie_MemTileAlloc *Alloc,
+		XAie_LocType Loc);
+AieRC XAie_MemTileAllocBuf(XAie_MemTileAlloc *Alloc, u32 Size, u32 Align,
+		XAie_MemTileAllocPolicy Policy, u32 AvoidBanks,
+		XAie_MemTileBuf *Buf);
+AieRC XAie_MemTileAllocBufNear(XAie_MemTileAlloc *Allocs, u8 NumAllocs,
+		XAie_LocType DmaLoc, u32 Size, u32 Align,
+		XAie_MemTileAllocPolicy Policy, u32 AvoidBanks,
+		XAie_MemTileBuf *Buf);
+AieRC XAie_MemTileAllocPingPong(XAie_MemTileAlloc *Alloc, u32 Size,
+		u32 Align, u32 AvoidBanks, XAie_MemTileBuf *Ping,
+		XAie_MemTileBuf *Pong);
+AieRC XAie_MemTileFreeBuf(XAie_MemTileAlloc *Alloc,
+		const XAie_MemTileBuf *Buf);
+AieRC XAie_MemTileBufGetDmaAddr(const XAie_MemTileAlloc *Alloc,
+		const XAie_MemTileBuf *Buf, XAie_LocType DmaLoc, u64 *Addr);
+AieRC XAie_MemTileBufPatchBd(XAie_DevInst *DevInst,
+		const XAie_DmaBdTemplate *Tmpl, XAie_LocType Loc, u8 BdNum,
+		const XAie_MemTileAlloc *Alloc, const XAie_MemTileBuf *Buf,
+		u32 Len);
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -0,0 +1,300 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_profile.c
+* @{
+*
+* This file contains routines for configuring a DMA channel for a kind of
+* transfer in one call, and for building and checking the BDs which the
+* channel runs. Compressed transfers need the compression bit of the channel
+* and of its BDs to agree. Out of order transfers need the S2MM channel to
+* take its BDs from the packet headers, and the MM2S BDs feeding it to send
+* packets with the receiving BD in their header.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include "xaie_dma_profile.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaiegbl_regdef.h"
+
+#ifdef XAIE_FEATURE_DMA_ENABLE
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API checks that a DMA module supports a channel profile.
+*
+* @param	DmaMod: Dma module of the tile.
+* @param	Dir: Direction of the DMA channel.
+* @param	Profile: Channel profile.
+*
+* @return	XAIE_OK if the profile is supported, error code otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaProfileCheck(const XAie_DmaMod *DmaMod,
+		XAie_DmaDirection Dir, const XAie_DmaChProfile *Profile)
+{
+	if((Dir >= DMA_MAX) || (Profile->Type >= XAIE_DMA_CH_PROFILE_MAX)) {
+		XAIE_ERROR("Invalid DMA direction or channel profile\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Dir == DMA_MM2S) && (Profile->FoTMode != DMA_FoT_DISABLED)) {
+		XAIE_ERROR("FoT mode applies to S2MM channels only\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	switch(Profile->Type) {
+	case XAIE_DMA_CH_PROFILE_COMPRESSED:
+		if((DmaMod->Compression == XAIE_FEATURE_UNAVAILABLE) ||
+				(DmaMod->ChProp->HasEnCompression ==
+				 XAIE_FEATURE_UNAVAILABLE)) {
+			XAIE_ERROR("Compression is not supported\n");
+			return XAIE_FEATURE_NOT_SUPPORTED;
+		}
+		break;
+	case XAIE_DMA_CH_PROFILE_OUT_OF_ORDER:
+		if(((Dir == DMA_S2MM) &&
+				(DmaMod->ChProp->HasEnOutOfOrder ==
+				 XAIE_FEATURE_UNAVAILABLE)) ||
+				((Dir == DMA_MM2S) &&
+				 (DmaMod->OutofOrderBdId ==
+				  XAIE_FEATURE_UNAVAILABLE))) {
+			XAIE_ERROR("Out of order mode is not supported\n");
+			return XAIE_FEATURE_NOT_SUPPORTED;
+		}
+		break;
+	default:
+		break;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures a DMA channel for the transfers of a channel profile. It
+* sets the compression, out of order, FoT mode and controller id fields of the
+* channel together, so that they agree with the BDs built by
+* XAie_DmaProfileDescInit() for the same profile.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of AIE Tile
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
+* @param	Profile: Channel profile.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Only the S2MM channel is put in out of order mode, the MM2S
+*		channel feeding it runs in order. The channel must be idle.
+*		This API works only for AIE-ML.
+*
+******************************************************************************/
+AieRC XAie_DmaChannelSetProfile(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u8 ChNum, XAie_DmaDirection Dir,
+		const XAie_DmaChProfile *Profile)
+{
+	AieRC RC;
+	XAie_DmaChannelDesc ChDesc;
+	const XAie_DmaMod *DmaMod;
+
+	if((DevInst == XAIE_NULL) || (Profile == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) {
+		XAIE_ERROR("Feature not supported\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	RC = XAie_DmaChannelDescInit(DevInst, &ChDesc, Loc);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	DmaMod = ChDesc.DmaMod;
+	if((DmaMod == XAIE_NULL) || (ChNum >= DmaMod->NumChannels)) {
+		XAIE_ERROR("Invalid tile or channel number\n");
+		return XAIE_INVALID_CHANNEL_NUM;
+	}
+
+	RC = _XAie_DmaProfileCheck(DmaMod, Dir, Profile);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Profile->Type == XAIE_DMA_CH_PROFILE_COMPRESSED) {
+		RC = XAie_DmaChannelEnCompression(&ChDesc, XAIE_ENABLE);
+	} else if((Profile->Type == XAIE_DMA_CH_PROFILE_OUT_OF_ORDER) &&
+			(Dir == DMA_S2MM)) {
+		RC = XAie_DmaChannelEnOutofOrder(&ChDesc, XAIE_ENABLE);
+	}
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Profile->FoTMode != DMA_FoT_DISABLED) {
+		RC = XAie_DmaChannelSetFoTMode(&ChDesc, Profile->FoTMode);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	if(Profile->ControllerId != 0U) {
+		RC = XAie_DmaChannelSetControllerId(&ChDesc,
+				Profile->ControllerId);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAie_DmaWriteChannel(DevInst, &ChDesc, Loc, ChNum, Dir);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes a DMA descriptor for a BD run by a channel configured
+* with XAie_DmaChannelSetProfile(). The BD of a compressed profile has the
+* compression bit set. The BD of an MM2S channel of an out of order profile
+* sends packets with the given packet id and type, whose header carries the BD
+* to run at the receiving S2MM channel. The other fields of the descriptor are
+* set up by the other DMA APIs as usual.
+*
+* @param	DevInst: Device Instance.
+* @param	DmaDesc: Pointer to the user allocated dma descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	Dir: Direction of the DMA Channel running the BD.
+* @param	Profile: Channel profile.
+* @param	Pkt: Packet of the BD. Only used for MM2S BDs of an out of
+*		order profile.
+* @param	OutofOrderBdId: BD to run at the receiving channel. Only used
+*		for MM2S BDs of an out of order profile.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		This API works only for AIE-ML.
+*
+******************************************************************************/
+AieRC XAie_DmaProfileDescInit(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, XAie_DmaDirection Dir,
+		const XAie_DmaChProfile *Profile, XAie_Packet Pkt,
+		u8 OutofOrderBdId)
+{
+	AieRC RC;
+	const XAie_DmaBdEnProp *BdEn;
+
+	if((DevInst == XAIE_NULL) || (DmaDesc == XAIE_NULL) ||
+			(Profile == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) {
+		XAIE_ERROR("Feature not supported\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	RC = XAie_DmaDescInit(DevInst, DmaDesc, Loc);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_DmaProfileCheck(DmaDesc->DmaMod, Dir, Profile);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Profile->Type == XAIE_DMA_CH_PROFILE_COMPRESSED) {
+		return XAie_DmaEnableCompression(DmaDesc);
+	}
+
+	if((Profile->Type != XAIE_DMA_CH_PROFILE_OUT_OF_ORDER) ||
+			(Dir != DMA_MM2S)) {
+		return XAIE_OK;
+	}
+
+	BdEn = DmaDesc->DmaMod->BdProp->BdEn;
+	if(OutofOrderBdId > (BdEn->OutofOrderBdId.Mask >>
+				BdEn->OutofOrderBdId.Lsb)) {
+		XAIE_ERROR("Invalid out of order BD id\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = XAie_DmaSetPkt(DmaDesc, Pkt);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	return XAie_DmaSetOutofOrderBdId(DmaDesc, OutofOrderBdId);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks that a DMA descriptor agrees with the profile of the channel
+* which runs it. It is meant for descriptors which are not built by
+* XAie_DmaProfileDescInit(), before they are written to the hardware.
+*
+* @param	DmaDesc: Initialized dma descriptor.
+* @param	Dir: Direction of the DMA Channel running the BD.
+* @param	Profile: Channel profile.
+*
+* @return	XAIE_OK if the descriptor agrees with the profile,
+*		XAIE_INVALID_DMA_DESC if it does not, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_DmaProfileCheckDesc(const XAie_DmaDesc *DmaDesc,
+		XAie_DmaDirection Dir, const XAie_DmaChProfile *Profile)
+{
+	AieRC RC;
+	u8 EnCompression;
+
+	if((DmaDesc == XAIE_NULL) || (Profile == XAIE_NULL) ||
+			(DmaDesc->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_DmaProfileCheck(DmaDesc->DmaMod, Dir, Profile);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	EnCompression = (Profile->Type == XAIE_DMA_CH_PROFILE_COMPRESSED) ?
+		XAIE_ENABLE : XAIE_DISABLE;
+	if(DmaDesc->EnCompression != EnCompression) {
+		XAIE_ERROR("Compression of the BD does not match the channel\n");
+		return XAIE_INVALID_DMA_DESC;
+	}
+
+	if((Profile->Type == XAIE_DMA_CH_PROFILE_OUT_OF_ORDER) &&
+			(Dir == DMA_MM2S) &&
+			((DmaDesc->PktDesc.PktEn == XAIE_DISABLE) ||
+			 (DmaDesc->EnOutofOrderBdId == XAIE_DISABLE))) {
+		XAIE_ERROR("Out of order BD must send packets with a BD id\n");
+		return XAIE_INVALID_DMA_DESC;
+	}
+
+	return XAIE_OK;
+}
+
+#endif /* XAIE_FEATURE_DMA_ENABLE */
+
+/** @} */
@@ -0,0 +1,65 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_profile.h
+* @{
+*
+* This file contains the routines for configuring a DMA channel and its BDs
+* for compressed or out of order transfers.
+*
+******************************************************************************/
+#ifndef XAIE_DMA_PROFILE_H
+#define XAIE_DMA_PROFILE_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaie_dma.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * This enum contains the kinds of transfers a DMA channel can be configured
+ * for.
+ *	XAIE_DMA_CH_PROFILE_DEFAULT: In order transfers of uncompressed data.
+ *	XAIE_DMA_CH_PROFILE_COMPRESSED: MM2S channels compress the data they
+ *		read from memory, S2MM channels decompress the data they write
+ *		to memory.
+ *	XAIE_DMA_CH_PROFILE_OUT_OF_ORDER: MM2S channels send packets carrying
+ *		the BD to use at the receiver, S2MM channels run the BD given
+ *		by the header of each packet they receive.
+ */
+typedef enum {
+	XAIE_DMA_CH_PROFILE_DEFAULT,
+	XAIE_DMA_CH_PROFILE_COMPRESSED,
+	XAIE_DMA_CH_PROFILE_OUT_OF_ORDER,
+	XAIE_DMA_CH_PROFILE_MAX
+} XAie_DmaChProfileType;
+
+/*
+ * This typedef captures the configuration of a DMA channel. FoTMode only
+ * applies to S2MM channels and must be DMA_FoT_DISABLED for MM2S channels.
+ */
+typedef struct {
+	XAie_DmaChProfileType Type;
+	XAie_DmaChannelFoTMode FoTMode;
+	u32 ControllerId;
+} XAie_DmaChProfile;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_DmaChannelSetProfile(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u8 ChNum, XAie_DmaDirection Dir,
+		const XAie_DmaChProfile *Profile);
+AieRC XAie_DmaProfileDescInit(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, XAie_DmaDirection Dir,
+		const XAie_DmaChProfile *Profile, XAie_Packet Pkt,
+		u8 OutofOrderBdId);
+AieRC XAie_DmaProfileCheckDesc(const XAie_DmaDesc *DmaDesc,
+		XAie_DmaDirection Dir, const XAie_DmaChProfile *Profile);
+
+#endif		/* end of protection macro */
+
+/** @} */
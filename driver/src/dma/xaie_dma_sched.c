@@ -0,0 +1,371 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_sched.c
+* @{
+*
+* This file contains routines for scheduling logical DMA transfers onto the
+* limited BDs and task queue of a DMA channel. The host submits transfers as
+* lists of descriptors, and the scheduler allocates BDs for them, chains the
+* BDs, and pushes the chains to the task queue as the BDs and the queue have
+* room. The BDs of a transfer are recycled once the hardware completes it.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include "xaie_dma_sched.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaiegbl_regdef.h"
+
+#ifdef XAIE_FEATURE_DMA_ENABLE
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API writes the BDs of a transfer, chained in the order of its
+* descriptors, from the next free BDs of the scheduler.
+*
+* @param	DevInst: Device Instance
+* @param	Sched: Pointer to the scheduler.
+* @param	Xfer: Transfer to write.
+* @param	StartBd: Pointer to return the first BD of the chain.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. The caller checks the scheduler has enough free
+*		BDs. The descriptors of the transfer are not modified.
+*
+******************************************************************************/
+static AieRC _XAie_DmaSchedWriteXfer(XAie_DevInst *DevInst,
+		XAie_DmaSched *Sched, const XAie_DmaSchedXfer *Xfer,
+		u8 *StartBd)
+{
+	AieRC RC;
+	XAie_DmaDesc Descs[XAIE_DMA_SCHED_MAX_XFER_BDS];
+	XAie_DmaBdWrite Bds[XAIE_DMA_SCHED_MAX_XFER_BDS];
+
+	for(u8 i = 0U; i < Xfer->NumDescs; i++) {
+		u32 Idx = Sched->BdAllocIdx + i;
+		u8 NextBd = Sched->BdNums[(Idx + 1U) % Sched->NumBds];
+
+		Descs[i] = Xfer->Descs[i];
+		RC = XAie_DmaSetNextBd(&Descs[i], NextBd,
+				(i + 1U < Xfer->NumDescs) ?
+				XAIE_ENABLE : XAIE_DISABLE);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RC = XAie_DmaEnableBd(&Descs[i]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		Bds[i].DmaDesc = &Descs[i];
+		Bds[i].Loc = Sched->Loc;
+		Bds[i].BdNum = Sched->BdNums[Idx % Sched->NumBds];
+	}
+
+	*StartBd = Bds[0].BdNum;
+
+	return XAie_DmaWriteBds(DevInst, Bds, Xfer->NumDescs);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes a DMA scheduler for a channel.
+*
+* @param	DevInst: Device Instance
+* @param	Sched: Pointer to the user allocated scheduler.
+* @param	Loc: Location of the tile.
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
+* @param	BdNums: Array of the hardware BD numbers owned by the
+*		scheduler.
+* @param	NumBds: Number of BDs in BdNums.
+* @param	Xfers: Array to keep the submitted transfers until they
+*		complete. The array must stay valid while the scheduler is in
+*		use.
+* @param	NumXfers: Number of transfers in Xfers.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The BDs must be usable by the channel and must not be used by
+*		any other user of the tile. The channel is not enabled by this
+*		API. The task queue with repeat count is required, so the
+*		scheduler is not supported for AIE tiles.
+*
+******************************************************************************/
+AieRC XAie_DmaSchedInit(XAie_DevInst *DevInst, XAie_DmaSched *Sched,
+		XAie_LocType Loc, u8 ChNum, XAie_DmaDirection Dir,
+		const u8 *BdNums, u8 NumBds, XAie_DmaSchedXfer *Xfers,
+		u32 NumXfers)
+{
+	AieRC RC;
+	u8 TileType;
+	const XAie_DmaMod *DmaMod;
+
+	if((DevInst == XAIE_NULL) || (Sched == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance or scheduler\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((BdNums == XAIE_NULL) || (NumBds == 0U) ||
+			(NumBds > XAIE_DMA_SCHED_MAX_BDS) ||
+			(Xfers == XAIE_NULL) || (NumXfers == 0U) ||
+			(Dir >= DMA_MAX)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
+			(TileType == XAIEGBL_TILE_TYPE_MAX)) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	if(DmaMod->RepeatCount == XAIE_FEATURE_UNAVAILABLE) {
+		XAIE_ERROR("DMA scheduler is not supported for this device generation\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	if(ChNum >= DmaMod->NumChannels) {
+		XAIE_ERROR("Invalid Channel number\n");
+		return XAIE_INVALID_CHANNEL_NUM;
+	}
+
+	for(u8 i = 0U; i < NumBds; i++) {
+		if(BdNums[i] >= DmaMod->NumBds) {
+			XAIE_ERROR("Invalid BD number\n");
+			return XAIE_INVALID_BD_NUM;
+		}
+
+		RC = DmaMod->BdChValidity(BdNums[i], ChNum);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		Sched->BdNums[i] = BdNums[i];
+	}
+
+	RC = XAie_DmaGetMaxQueueSize(DevInst, Loc, &Sched->QueueSize);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Sched->Xfers = Xfers;
+	Sched->NumXfers = NumXfers;
+	Sched->ProdIdx = 0U;
+	Sched->IssueIdx = 0U;
+	Sched->ConsIdx = 0U;
+	Sched->BdAllocIdx = 0U;
+	Sched->BdFreeIdx = 0U;
+	Sched->Loc = Loc;
+	Sched->Dir = Dir;
+	Sched->TileType = TileType;
+	Sched->ChNum = ChNum;
+	Sched->NumBds = NumBds;
+	Sched->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API recycles the BDs of the transfers completed by the hardware and
+* issues the submitted transfers as the free BDs and the task queue of the
+* channel allow.
+*
+* @param	DevInst: Device Instance
+* @param	Sched: Pointer to an initialized scheduler.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The API does not wait. It should be called periodically, or
+*		whenever the host needs the latest consumer index. Transfers
+*		are issued in the order of submission, a transfer waiting for
+*		BDs holds back the ones submitted after it.
+*
+******************************************************************************/
+AieRC XAie_DmaSchedService(XAie_DevInst *DevInst, XAie_DmaSched *Sched)
+{
+	AieRC RC;
+	u8 Pending;
+	u32 InFlight;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Sched == XAIE_NULL) ||
+			(Sched->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid scheduler\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	InFlight = Sched->IssueIdx - Sched->ConsIdx;
+	if(InFlight != 0U) {
+		RC = XAie_DmaGetPendingBdCount(DevInst, Sched->Loc,
+				Sched->ChNum, Sched->Dir, &Pending);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		/* Chained BDs are counted as one pending task */
+		while(InFlight > Pending) {
+			Sched->BdFreeIdx += Sched->Xfers[Sched->ConsIdx %
+				Sched->NumXfers].NumDescs;
+			Sched->ConsIdx++;
+			InFlight--;
+		}
+	}
+
+	while((Sched->IssueIdx != Sched->ProdIdx) &&
+			(InFlight < Sched->QueueSize)) {
+		const XAie_DmaSchedXfer *Xfer = &Sched->Xfers[Sched->IssueIdx %
+			Sched->NumXfers];
+		u32 FreeBds = Sched->NumBds -
+			(Sched->BdAllocIdx - Sched->BdFreeIdx);
+		u8 StartBd;
+
+		if(Xfer->NumDescs > FreeBds) {
+			break;
+		}
+
+		RC = _XAie_DmaSchedWriteXfer(DevInst, Sched, Xfer, &StartBd);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to write the BDs of transfer %d\n",
+					Sched->IssueIdx);
+			return RC;
+		}
+
+		XAie_DmaDeclareQueueConfig(DmaQueueDesc, StartBd,
+				Xfer->RepeatCount, Xfer->EnTokenIssue,
+				XAIE_DISABLE);
+		RC = XAie_DmaChannelSetStartQueueGeneric(DevInst, Sched->Loc,
+				Sched->ChNum, Sched->Dir, &DmaQueueDesc);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to push transfer %d\n",
+					Sched->IssueIdx);
+			return RC;
+		}
+
+		Sched->BdAllocIdx += Xfer->NumDescs;
+		Sched->IssueIdx++;
+		InFlight++;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API submits a transfer to a scheduler. The transfer is issued to the
+* hardware as the free BDs and the task queue of the channel allow.
+*
+* @param	DevInst: Device Instance
+* @param	Sched: Pointer to an initialized scheduler.
+* @param	Xfer: Transfer to submit. It is copied to the scheduler, the
+*		descriptors it points to are not.
+* @param	XferIdx: Pointer to return the index of the transfer, which
+*		is complete once the consumer index is past it. Can be NULL.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the scheduler has no room for
+*		the transfer, Error code on failure.
+*
+* @note		The descriptors must be initialized for the tile of the
+*		scheduler, their next BD settings are overridden.
+*
+******************************************************************************/
+AieRC XAie_DmaSchedSubmit(XAie_DevInst *DevInst, XAie_DmaSched *Sched,
+		const XAie_DmaSchedXfer *Xfer, u32 *XferIdx)
+{
+	if((Sched == XAIE_NULL) ||
+			(Sched->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid scheduler\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Xfer == XAIE_NULL) || (Xfer->Descs == XAIE_NULL) ||
+			(Xfer->NumDescs == 0U) ||
+			(Xfer->NumDescs > XAIE_DMA_SCHED_MAX_XFER_BDS) ||
+			(Xfer->NumDescs > Sched->NumBds) ||
+			(Xfer->RepeatCount == 0U)) {
+		XAIE_ERROR("Invalid transfer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u8 i = 0U; i < Xfer->NumDescs; i++) {
+		if((Xfer->Descs[i].IsReady != XAIE_COMPONENT_IS_READY) ||
+				(Xfer->Descs[i].TileType != Sched->TileType)) {
+			XAIE_ERROR("Invalid Dma Descriptor %d of the transfer\n",
+					i);
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	if(Sched->ProdIdx - Sched->ConsIdx >= Sched->NumXfers) {
+		XAIE_ERROR("No room for the transfer in the scheduler\n");
+		return XAIE_ERR;
+	}
+
+	Sched->Xfers[Sched->ProdIdx % Sched->NumXfers] = *Xfer;
+	if(XferIdx != XAIE_NULL) {
+		*XferIdx = Sched->ProdIdx;
+	}
+	Sched->ProdIdx++;
+
+	return XAie_DmaSchedService(DevInst, Sched);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the producer and consumer indices of a scheduler. The
+* transfers from the consumer index up to the producer index are owned by the
+* scheduler, all the others are complete.
+*
+* @param	Sched: Pointer to an initialized scheduler.
+* @param	ProdIdx: Pointer to return the producer index. Can be NULL.
+* @param	ConsIdx: Pointer to return the consumer index. Can be NULL.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The consumer index is updated by XAie_DmaSchedService().
+*
+******************************************************************************/
+AieRC XAie_DmaSchedGetIndices(const XAie_DmaSched *Sched, u32 *ProdIdx,
+		u32 *ConsIdx)
+{
+	if((Sched == XAIE_NULL) ||
+			(Sched->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid scheduler\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(ProdIdx != XAIE_NULL) {
+		*ProdIdx = Sched->ProdIdx;
+	}
+
+	if(ConsIdx != XAIE_NULL) {
+		*ConsIdx = Sched->ConsIdx;
+	}
+
+	return XAIE_OK;
+}
+
+#endif /* XAIE_FEATURE_DMA_ENABLE */
+/** @} */
@@ -0,0 +1,83 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_sched.h
+* @{
+*
+* This file contains the routines for scheduling DMA transfers onto the BDs
+* and the task queue of a DMA channel.
+*
+******************************************************************************/
+#ifndef XAIE_DMA_SCHED_H
+#define XAIE_DMA_SCHED_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaie_dma.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_DMA_SCHED_MAX_BDS		48U
+#define XAIE_DMA_SCHED_MAX_XFER_BDS	8U
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures a logical DMA transfer. The descriptors are written
+ * to BDs allocated by the scheduler, chained in the order of the array, and
+ * the chain is pushed to the task queue as one task. The descriptors must
+ * stay valid until the transfer is issued.
+ */
+typedef struct {
+	XAie_DmaDesc *Descs;
+	u8 NumDescs;
+	u32 RepeatCount;
+	u8 EnTokenIssue;
+} XAie_DmaSchedXfer;
+
+/*
+ * This typedef captures a DMA scheduler of one channel. The scheduler owns a
+ * set of BDs of the channel, which are allocated to the transfers as they are
+ * issued and recycled as they complete. Both happen in order, so the free
+ * BDs are kept as a ring of BdNums. The indices are free running counters,
+ * the ring slot of a transfer index is the index modulo NumXfers:
+ *	ProdIdx: transfers submitted by the host.
+ *	IssueIdx: transfers pushed to the hardware queue.
+ *	ConsIdx: transfers completed by the hardware.
+ * BdAllocIdx and BdFreeIdx count the BDs allocated and recycled.
+ */
+typedef struct {
+	XAie_DmaSchedXfer *Xfers;
+	u32 NumXfers;
+	u32 ProdIdx;
+	u32 IssueIdx;
+	u32 ConsIdx;
+	u32 BdAllocIdx;
+	u32 BdFreeIdx;
+	XAie_LocType Loc;
+	XAie_DmaDirection Dir;
+	u8 TileType;
+	u8 ChNum;
+	u8 QueueSize;
+	u8 NumBds;
+	u8 BdNums[XAIE_DMA_SCHED_MAX_BDS];
+	u8 IsReady;
+} XAie_DmaSched;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_DmaSchedInit(XAie_DevInst *DevInst, XAie_DmaSched *Sched,
+		XAie_LocType Loc, u8 ChNum, XAie_DmaDirection Dir,
+		const u8 *BdNums, u8 NumBds, XAie_DmaSchedXfer *Xfers,
+		u32 NumXfers);
+AieRC XAie_DmaSchedSubmit(XAie_DevInst *DevInst, XAie_DmaSched *Sched,
+		const XAie_DmaSchedXfer *Xfer, u32 *XferIdx);
+AieRC XAie_DmaSchedService(XAie_DevInst *DevInst, XAie_DmaSched *Sched);
+AieRC XAie_DmaSchedGetIndices(const XAie_DmaSched *Sched, u32 *ProdIdx,
+		u32 *ConsIdx);
+
+#endif		/* end of protection macro */
+
+/** @} */
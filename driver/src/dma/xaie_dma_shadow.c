@@ -0,0 +1,463 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_shadow.c
+* @{
+*
+* This file contains routines for the shadow of the programmed DMA buffer
+* descriptors. The shadow keeps the words last written to each BD of a tile,
+* so that rewriting a BD with the same contents does not reach the device and
+* a BD which differs only in a few words gets only those words written. It
+* also answers what a BD holds without reading it back. Any other write to
+* the BD registers drops the shadow of the BDs it covers.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#endif
+
+#include "xaie_dma_shadow.h"
+#include "xaie_helper.h"
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u32 Words[XAIE_BD_SHADOW_MAX_BDS][XAIE_BD_SHADOW_MAX_WORDS];
+	XAie_MemInst *MemInst[XAIE_BD_SHADOW_MAX_BDS];
+	u8 NumWords[XAIE_BD_SHADOW_MAX_BDS];
+	u64 Valid;
+} XAie_BdShadowTile;
+
+struct XAie_BdShadow {
+	XAie_BdShadowTile **Tile; /* Shadow of each tile, allocated on use */
+	u32 NumTiles;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+#endif
+};
+
+/************************** Function Definitions *****************************/
+#ifndef __AIEBAREMETAL__
+static inline void _XAie_BdShadowLock(XAie_BdShadow *Shadow)
+{
+	pthread_mutex_lock(&Shadow->Lock);
+}
+
+static inline void _XAie_BdShadowUnlock(XAie_BdShadow *Shadow)
+{
+	pthread_mutex_unlock(&Shadow->Lock);
+}
+#else
+static inline void _XAie_BdShadowLock(XAie_BdShadow *Shadow)
+{
+	(void)Shadow;
+}
+
+static inline void _XAie_BdShadowUnlock(XAie_BdShadow *Shadow)
+{
+	(void)Shadow;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API returns the index of a tile in the BD shadow.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Loc: Location of the tile.
+*
+* @return	Index of the tile.
+*
+* @note		Internal only. The location must be within the partition.
+*
+******************************************************************************/
+static inline u32 _XAie_BdShadowTileIdx(XAie_DevInst *DevInst,
+		XAie_LocType Loc)
+{
+	return (u32)Loc.Col * DevInst->NumRows + Loc.Row;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API enables or disables the shadow of the programmed DMA buffer
+* descriptors. Once enabled, the BDs written with XAie_DmaWriteBd() are
+* recorded, a BD which is written again with the same contents is not
+* written to the device, and a BD which differs from its shadow only gets the
+* changed words written. The shadow is dropped when it is disabled.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Enable: XAIE_ENABLE to enable the shadow, XAIE_DISABLE to
+*		disable it.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The shadow is disabled by default. It is only populated for
+*		AIEML tiles. It only tracks the accesses issued through this
+*		driver instance, applications which program the BDs through
+*		another instance or another agent must not enable it. Writes
+*		to the BD registers through other APIs, backend operations,
+*		submitted transactions and partition resets invalidate it.
+*		BDs written while the calling thread records a transaction
+*		are always written in full. It is not supported for the CDO
+*		backend as the generated commands may be replayed on a device
+*		in any state.
+*
+******************************************************************************/
+AieRC XAie_ConfigBdShadow(XAie_DevInst *DevInst, u8 Enable)
+{
+	XAie_BdShadow *Shadow;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Enable == XAIE_DISABLE) {
+		_XAie_BdShadowFinish(DevInst);
+		return XAIE_OK;
+	}
+
+	if(DevInst->Backend->Type == XAIE_IO_BACKEND_CDO) {
+		XAIE_ERROR("BD shadow is not supported for CDO backend\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	if(DevInst->BdShadow != NULL) {
+		return XAIE_OK;
+	}
+
+	Shadow = (XAie_BdShadow *)calloc(1U, sizeof(*Shadow));
+	if(Shadow == NULL) {
+		XAIE_ERROR("Failed to allocate the BD shadow\n");
+		return XAIE_ERR;
+	}
+
+	Shadow->NumTiles = (u32)DevInst->NumCols * DevInst->NumRows;
+	Shadow->Tile = (XAie_BdShadowTile **)calloc(Shadow->NumTiles,
+			sizeof(*Shadow->Tile));
+	if(Shadow->Tile == NULL) {
+		XAIE_ERROR("Failed to allocate the BD shadow\n");
+		free(Shadow);
+		return XAIE_ERR;
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_init(&Shadow->Lock, NULL);
+#endif
+	DevInst->BdShadow = Shadow;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the words the BD shadow holds for a BD, which are the words
+* last written to the BD through XAie_DmaWriteBd().
+*
+* @param	DevInst: Device instance pointer.
+* @param	Loc: Location of the tile.
+* @param	BdNum: BD number.
+* @param	Words: Buffer to return the BD words. It must hold
+*		XAIE_BD_SHADOW_MAX_WORDS words.
+* @param	NumWords: Pointer to return the number of BD words. It is 0
+*		if the shadow does not hold the BD.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The iteration current field is the one last written, the
+*		hardware advances it as the BD runs. The address of a shim BD
+*		is the address given to the driver, before the backend
+*		translates it.
+*
+******************************************************************************/
+AieRC XAie_DmaGetShadowBd(XAie_DevInst *DevInst, XAie_LocType Loc, u8 BdNum,
+		u32 *Words, u8 *NumWords)
+{
+	XAie_BdShadow *Shadow;
+	XAie_BdShadowTile *Tile;
+
+	if((DevInst == XAIE_NULL) || (Words == NULL) || (NumWords == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Loc.Col >= DevInst->NumCols) || (Loc.Row >= DevInst->NumRows) ||
+			(BdNum >= XAIE_BD_SHADOW_MAX_BDS)) {
+		XAIE_ERROR("Invalid tile location or BD number\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Shadow = DevInst->BdShadow;
+	if(Shadow == NULL) {
+		XAIE_ERROR("BD shadow is not enabled\n");
+		return XAIE_ERR;
+	}
+
+	*NumWords = 0U;
+	_XAie_BdShadowLock(Shadow);
+	Tile = Shadow->Tile[_XAie_BdShadowTileIdx(DevInst, Loc)];
+	if((Tile != NULL) && ((Tile->Valid & (1ULL << BdNum)) != 0U)) {
+		*NumWords = Tile->NumWords[BdNum];
+		memcpy(Words, Tile->Words[BdNum], *NumWords * sizeof(u32));
+	}
+	_XAie_BdShadowUnlock(Shadow);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API compares the words to write to a BD with its shadow.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Loc: Location of the tile.
+* @param	BdNum: BD number.
+* @param	Words: BD words to write.
+* @param	NumWords: Number of BD words.
+* @param	MemInst: Memory instance of the BD address, NULL if none.
+*
+* @return	Bitmap of the words which differ from the shadow. All the words
+*		differ if the shadow does not hold the BD or if the calling
+*		thread records a transaction.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+u32 _XAie_BdShadowDiff(XAie_DevInst *DevInst, XAie_LocType Loc, u8 BdNum,
+		const u32 *Words, u8 NumWords, const XAie_MemInst *MemInst)
+{
+	XAie_BdShadow *Shadow = DevInst->BdShadow;
+	XAie_BdShadowTile *Tile;
+	u32 Dirty = (1U << NumWords) - 1U;
+
+	if((Shadow == NULL) || (BdNum >= XAIE_BD_SHADOW_MAX_BDS) ||
+			(NumWords > XAIE_BD_SHADOW_MAX_WORDS) ||
+			(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE)) {
+		return Dirty;
+	}
+
+	_XAie_BdShadowLock(Shadow);
+	Tile = Shadow->Tile[_XAie_BdShadowTileIdx(DevInst, Loc)];
+	if((Tile != NULL) && ((Tile->Valid & (1ULL << BdNum)) != 0U) &&
+			(Tile->NumWords[BdNum] == NumWords) &&
+			(Tile->MemInst[BdNum] == MemInst)) {
+		for(u8 i = 0U; i < NumWords; i++) {
+			if(Tile->Words[BdNum][i] == Words[i]) {
+				Dirty &= ~(1U << i);
+			}
+		}
+	}
+	_XAie_BdShadowUnlock(Shadow);
+
+	return Dirty;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records the words written to a BD in its shadow. The BD is dropped
+* from the shadow instead if the calling thread records a transaction, as
+* the words only reach the device once the transaction is submitted.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Loc: Location of the tile.
+* @param	BdNum: BD number.
+* @param	Words: BD words written.
+* @param	NumWords: Number of BD words.
+* @param	MemInst: Memory instance of the BD address, NULL if none.
+*
+* @return	None.
+*
+* @note		Internal only. The BD is left out of the shadow if the tile
+*		shadow cannot be allocated.
+*
+******************************************************************************/
+void _XAie_BdShadowUpdate(XAie_DevInst *DevInst, XAie_LocType Loc, u8 BdNum,
+		const u32 *Words, u8 NumWords, XAie_MemInst *MemInst)
+{
+	XAie_BdShadow *Shadow = DevInst->BdShadow;
+	XAie_BdShadowTile **Tile;
+	u8 InTxn;
+
+	if((Shadow == NULL) || (BdNum >= XAIE_BD_SHADOW_MAX_BDS) ||
+			(NumWords > XAIE_BD_SHADOW_MAX_WORDS)) {
+		return;
+	}
+
+	InTxn = _XAie_TxnIsActive(DevInst);
+
+	_XAie_BdShadowLock(Shadow);
+	Tile = &Shadow->Tile[_XAie_BdShadowTileIdx(DevInst, Loc)];
+	if(InTxn == XAIE_ENABLE) {
+		if(*Tile != NULL) {
+			(*Tile)->Valid &= ~(1ULL << BdNum);
+		}
+		_XAie_BdShadowUnlock(Shadow);
+		return;
+	}
+
+	if(*Tile == NULL) {
+		*Tile = (XAie_BdShadowTile *)calloc(1U, sizeof(**Tile));
+		if(*Tile == NULL) {
+			_XAie_BdShadowUnlock(Shadow);
+			return;
+		}
+	}
+
+	memcpy((*Tile)->Words[BdNum], Words, NumWords * sizeof(u32));
+	(*Tile)->MemInst[BdNum] = MemInst;
+	(*Tile)->NumWords[BdNum] = NumWords;
+	(*Tile)->Valid |= 1ULL << BdNum;
+	_XAie_BdShadowUnlock(Shadow);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API drops the shadow of the BDs covered by a range of registers.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Offset of the first register relative to the partition.
+* @param	Size: Number of registers.
+*
+* @return	None.
+*
+* @note		Internal only. A range crossing a tile boundary drops the
+*		whole shadow.
+*
+******************************************************************************/
+void _XAie_BdShadowInvalidate(XAie_DevInst *DevInst, u64 RegOff, u32 Size)
+{
+	XAie_BdShadow *Shadow = DevInst->BdShadow;
+	XAie_BdShadowTile *Tile;
+	const XAie_DmaMod *DmaMod;
+	XAie_LocType Loc;
+	u8 RowShift = DevInst->DevProp.RowShift;
+	u8 ColShift = DevInst->DevProp.ColShift;
+	u8 TileType;
+	u64 TileOff, End, BdEnd;
+	u32 First, Last;
+
+	if((Shadow == NULL) || (Size == 0U)) {
+		return;
+	}
+
+	Loc.Col = (u8)(RegOff >> ColShift);
+	Loc.Row = (u8)((RegOff >> RowShift) &
+			((1U << (ColShift - RowShift)) - 1U));
+	if((Loc.Col >= DevInst->NumCols) || (Loc.Row >= DevInst->NumRows)) {
+		return;
+	}
+
+	TileOff = RegOff & ((1ULL << RowShift) - 1U);
+	End = TileOff + (u64)Size * 4U;
+	if(End > (1ULL << RowShift)) {
+		_XAie_BdShadowInvalidateAll(DevInst);
+		return;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType >= XAIEGBL_TILE_TYPE_MAX) {
+		return;
+	}
+
+	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	if(DmaMod == NULL) {
+		return;
+	}
+
+	BdEnd = DmaMod->BaseAddr + (u64)DmaMod->NumBds * DmaMod->IdxOffset;
+	if((End <= DmaMod->BaseAddr) || (TileOff >= BdEnd)) {
+		return;
+	}
+
+	First = (TileOff < DmaMod->BaseAddr) ? 0U :
+		(u32)((TileOff - DmaMod->BaseAddr) / DmaMod->IdxOffset);
+	Last = (u32)((((End < BdEnd) ? End : BdEnd) - 1U - DmaMod->BaseAddr) /
+			DmaMod->IdxOffset);
+
+	_XAie_BdShadowLock(Shadow);
+	Tile = Shadow->Tile[_XAie_BdShadowTileIdx(DevInst, Loc)];
+	if(Tile != NULL) {
+		for(u32 i = First; (i <= Last) && (i < XAIE_BD_SHADOW_MAX_BDS);
+				i++) {
+			Tile->Valid &= ~(1ULL << i);
+		}
+	}
+	_XAie_BdShadowUnlock(Shadow);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API drops the shadow of all the BDs.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_BdShadowInvalidateAll(XAie_DevInst *DevInst)
+{
+	XAie_BdShadow *Shadow = DevInst->BdShadow;
+
+	if(Shadow == NULL) {
+		return;
+	}
+
+	_XAie_BdShadowLock(Shadow);
+	for(u32 i = 0U; i < Shadow->NumTiles; i++) {
+		if(Shadow->Tile[i] != NULL) {
+			Shadow->Tile[i]->Valid = 0U;
+		}
+	}
+	_XAie_BdShadowUnlock(Shadow);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees the BD shadow of a device instance.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+void _XAie_BdShadowFinish(XAie_DevInst *DevInst)
+{
+	XAie_BdShadow *Shadow = DevInst->BdShadow;
+
+	if(Shadow == NULL) {
+		return;
+	}
+
+	DevInst->BdShadow = NULL;
+	for(u32 i = 0U; i < Shadow->NumTiles; i++) {
+		free(Shadow->Tile[i]);
+	}
+	free(Shadow->Tile);
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_destroy(&Shadow->Lock);
+#endif
+	free(Shadow);
+}
+
+/** @} */
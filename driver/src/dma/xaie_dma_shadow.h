@@ -0,0 +1,40 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_shadow.h
+* @{
+*
+* This file contains the routines for the shadow of the programmed DMA buffer
+* descriptors.
+*
+******************************************************************************/
+#ifndef XAIE_DMA_SHADOW_H
+#define XAIE_DMA_SHADOW_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_BD_SHADOW_MAX_BDS		48U
+#define XAIE_BD_SHADOW_MAX_WORDS	8U
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_ConfigBdShadow(XAie_DevInst *DevInst, u8 Enable);
+AieRC XAie_DmaGetShadowBd(XAie_DevInst *DevInst, XAie_LocType Loc, u8 BdNum,
+		u32 *Words, u8 *NumWords);
+u32 _XAie_BdShadowDiff(XAie_DevInst *DevInst, XAie_LocType Loc, u8 BdNum,
+		const u32 *Words, u8 NumWords, const XAie_MemInst *MemInst);
+void _XAie_BdShadowUpdate(XAie_DevInst *DevInst, XAie_LocType Loc, u8 BdNum,
+		const u32 *Words, u8 NumWords, XAie_MemInst *MemInst);
+void _XAie_BdShadowInvalidate(XAie_DevInst *DevInst, u64 RegOff, u32 Size);
+void _XAie_BdShadowInvalidateAll(XAie_DevInst *DevInst);
+void _XAie_BdShadowFinish(XAie_DevInst *DevInst);
+
+#endif		/* end of protection macro */
+
+/** @} */
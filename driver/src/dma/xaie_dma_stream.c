@@ -0,0 +1,327 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_stream.c
+* @{
+*
+* This file contains routines for streaming a ring of buffers through a shim
+* DMA channel. The host hands buffers over by advancing the producer index,
+* and the stream keeps the hardware task queue of the channel filled from the
+* ring. When the ring has no more buffers than the stream has BDs, every
+* buffer is bound to its own BD once, and refilling the queue only pushes the
+* BD numbers.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include "xaie_dma_stream.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaiegbl_regdef.h"
+
+#ifdef XAIE_FEATURE_DMA_ENABLE
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API writes the BD of a stream for a ring slot.
+*
+* @param	DevInst: Device Instance
+* @param	Stream: Pointer to the stream.
+* @param	Slot: Ring slot of the buffer.
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DmaStreamWriteBd(XAie_DevInst *DevInst,
+		XAie_DmaStream *Stream, u32 Slot, u8 BdNum)
+{
+	AieRC RC;
+	const XAie_DmaStreamBuf *Buf = &Stream->Bufs[Slot];
+
+	RC = XAie_DmaSetAddrOffsetLen(&Stream->Desc, Buf->MemInst, Buf->Offset,
+			Buf->Len);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Invalid buffer %d of the stream\n", Slot);
+		return RC;
+	}
+
+	return XAie_DmaWriteBd(DevInst, &Stream->Desc, Stream->Loc, BdNum);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes a DMA stream over a ring of buffers for a shim DMA
+* channel.
+*
+* @param	DevInst: Device Instance
+* @param	Stream: Pointer to the user allocated stream.
+* @param	DmaDesc: Initialized Dma Descriptor. All the BDs of the stream
+*		are written with the settings of the descriptor other than the
+*		buffer address and length.
+* @param	Loc: Location of the shim tile.
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
+* @param	BdNums: Array of the hardware BD numbers owned by the stream.
+* @param	NumBds: Number of BDs in BdNums.
+* @param	Bufs: Array of the ring buffers. The array must stay valid
+*		while the stream is in use.
+* @param	NumBufs: Number of buffers in the ring.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The BDs must not be chained and must not be used by any other
+*		user of the channel. The channel is not enabled by this API.
+*
+******************************************************************************/
+AieRC XAie_DmaStreamInit(XAie_DevInst *DevInst, XAie_DmaStream *Stream,
+		XAie_DmaDesc *DmaDesc, XAie_LocType Loc, u8 ChNum,
+		XAie_DmaDirection Dir, const u8 *BdNums, u8 NumBds,
+		const XAie_DmaStreamBuf *Bufs, u32 NumBufs)
+{
+	AieRC RC;
+	u8 TileType;
+	const XAie_DmaMod *DmaMod;
+
+	if((DevInst == XAIE_NULL) || (Stream == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance or stream\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((DmaDesc == XAIE_NULL) ||
+			(DmaDesc->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Dma Descriptor\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((BdNums == XAIE_NULL) || (NumBds == 0U) ||
+			(NumBds > XAIE_DMA_STREAM_MAX_BDS) ||
+			(Bufs == XAIE_NULL) || (NumBufs == 0U) ||
+			(Dir >= DMA_MAX)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) ||
+			(DmaDesc->TileType != TileType)) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	if(ChNum >= DmaMod->NumChannels) {
+		XAIE_ERROR("Invalid Channel number\n");
+		return XAIE_INVALID_CHANNEL_NUM;
+	}
+
+	for(u8 i = 0U; i < NumBds; i++) {
+		if(BdNums[i] >= DmaMod->NumBds) {
+			XAIE_ERROR("Invalid BD number\n");
+			return XAIE_INVALID_BD_NUM;
+		}
+		Stream->BdNums[i] = BdNums[i];
+	}
+
+	RC = XAie_DmaGetMaxQueueSize(DevInst, Loc, &Stream->QueueSize);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Stream->Desc = *DmaDesc;
+	Stream->Bufs = Bufs;
+	Stream->NumBufs = NumBufs;
+	Stream->ProdIdx = 0U;
+	Stream->IssueIdx = 0U;
+	Stream->ConsIdx = 0U;
+	Stream->Loc = Loc;
+	Stream->Dir = Dir;
+	Stream->ChNum = ChNum;
+	Stream->NumBds = NumBds;
+	Stream->IsReady = 0U;
+
+	/* Bind every buffer to its own BD if the ring is small enough */
+	if(NumBufs <= NumBds) {
+		for(u32 i = 0U; i < NumBufs; i++) {
+			RC = _XAie_DmaStreamWriteBd(DevInst, Stream, i,
+					Stream->BdNums[i]);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+	}
+
+	Stream->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API retires the buffers completed by the hardware and refills the task
+* queue of the channel with the buffers handed over by the host.
+*
+* @param	DevInst: Device Instance
+* @param	Stream: Pointer to an initialized stream.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The API does not wait. It should be called periodically, or
+*		whenever the host needs the latest consumer index.
+*
+******************************************************************************/
+AieRC XAie_DmaStreamService(XAie_DevInst *DevInst, XAie_DmaStream *Stream)
+{
+	AieRC RC;
+	u8 Pending, InFlightMax;
+	u32 InFlight;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Stream == XAIE_NULL) ||
+			(Stream->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid stream\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = XAie_DmaGetPendingBdCount(DevInst, Stream->Loc, Stream->ChNum,
+			Stream->Dir, &Pending);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	InFlight = Stream->IssueIdx - Stream->ConsIdx;
+	if(Pending < InFlight) {
+		Stream->ConsIdx += InFlight - Pending;
+		InFlight = Pending;
+	}
+
+	/*
+	 * A BD is reused once the tasks issued after it fill the queue, so the
+	 * stream never runs ahead of its BDs.
+	 */
+	InFlightMax = (Stream->QueueSize < Stream->NumBds) ?
+		Stream->QueueSize : Stream->NumBds;
+
+	while((Stream->IssueIdx != Stream->ProdIdx) &&
+			(InFlight < InFlightMax)) {
+		u32 Slot = Stream->IssueIdx % Stream->NumBufs;
+		u8 BdNum;
+
+		if(Stream->NumBufs <= Stream->NumBds) {
+			BdNum = Stream->BdNums[Slot];
+		} else {
+			BdNum = Stream->BdNums[Stream->IssueIdx %
+				Stream->NumBds];
+			RC = _XAie_DmaStreamWriteBd(DevInst, Stream, Slot,
+					BdNum);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		RC = XAie_DmaChannelPushBdToQueue(DevInst, Stream->Loc,
+				Stream->ChNum, Stream->Dir, BdNum);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to push BD %d of the stream\n",
+					BdNum);
+			return RC;
+		}
+
+		Stream->IssueIdx++;
+		InFlight++;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API hands buffers of the ring over to the hardware. For MM2S channels
+* the buffers hold the data to send, for S2MM channels they are free to
+* receive data.
+*
+* @param	DevInst: Device Instance
+* @param	Stream: Pointer to an initialized stream.
+* @param	Count: Number of buffers to hand over, from the producer index.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the ring does not have Count
+*		free buffers, Error code on failure.
+*
+* @note		The buffers are queued to the hardware as the queue has room.
+*
+******************************************************************************/
+AieRC XAie_DmaStreamSubmit(XAie_DevInst *DevInst, XAie_DmaStream *Stream,
+		u32 Count)
+{
+	if((Stream == XAIE_NULL) ||
+			(Stream->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid stream\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Count > Stream->NumBufs -
+			(Stream->ProdIdx - Stream->ConsIdx)) {
+		XAIE_ERROR("Not enough free buffers in the stream\n");
+		return XAIE_ERR;
+	}
+
+	Stream->ProdIdx += Count;
+
+	return XAie_DmaStreamService(DevInst, Stream);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the producer and consumer indices of a stream. The buffers
+* from the consumer index up to the producer index are owned by the hardware,
+* all the others by the host.
+*
+* @param	Stream: Pointer to an initialized stream.
+* @param	ProdIdx: Pointer to return the producer index. Can be NULL.
+* @param	ConsIdx: Pointer to return the consumer index. Can be NULL.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The consumer index is updated by XAie_DmaStreamService().
+*
+******************************************************************************/
+AieRC XAie_DmaStreamGetIndices(const XAie_DmaStream *Stream, u32 *ProdIdx,
+		u32 *ConsIdx)
+{
+	if((Stream == XAIE_NULL) ||
+			(Stream->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid stream\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(ProdIdx != XAIE_NULL) {
+		*ProdIdx = Stream->ProdIdx;
+	}
+
+	if(ConsIdx != XAIE_NULL) {
+		*ConsIdx = Stream->ConsIdx;
+	}
+
+	return XAIE_OK;
+}
+
+#endif /* XAIE_FEATURE_DMA_ENABLE */
+/** @} */
@@ -0,0 +1,75 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_stream.h
+* @{
+*
+* This file contains the routines for streaming a ring of buffers through a
+* shim DMA channel.
+*
+******************************************************************************/
+#ifndef XAIE_DMA_STREAM_H
+#define XAIE_DMA_STREAM_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaie_dma.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_DMA_STREAM_MAX_BDS		16U
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures one buffer of a DMA stream ring, as a range of a
+ * memory object.
+ */
+typedef struct {
+	XAie_MemInst *MemInst;
+	u64 Offset;
+	u32 Len;
+} XAie_DmaStreamBuf;
+
+/*
+ * This typedef captures a DMA stream. The stream owns a ring of BDs of one
+ * shim DMA channel and moves the ring buffers through them. The indices are
+ * free running counters, the ring slot of an index is the index modulo
+ * NumBufs:
+ *	ProdIdx: buffers handed over by the host.
+ *	IssueIdx: buffers pushed to the hardware queue.
+ *	ConsIdx: buffers completed by the hardware.
+ */
+typedef struct {
+	XAie_DmaDesc Desc;
+	const XAie_DmaStreamBuf *Bufs;
+	u32 NumBufs;
+	u32 ProdIdx;
+	u32 IssueIdx;
+	u32 ConsIdx;
+	XAie_LocType Loc;
+	XAie_DmaDirection Dir;
+	u8 ChNum;
+	u8 QueueSize;
+	u8 NumBds;
+	u8 BdNums[XAIE_DMA_STREAM_MAX_BDS];
+	u8 IsReady;
+} XAie_DmaStream;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_DmaStreamInit(XAie_DevInst *DevInst, XAie_DmaStream *Stream,
+		XAie_DmaDesc *DmaDesc, XAie_LocType Loc, u8 ChNum,
+		XAie_DmaDirection Dir, const u8 *BdNums, u8 NumBds,
+		const XAie_DmaStreamBuf *Bufs, u32 NumBufs);
+AieRC XAie_DmaStreamSubmit(XAie_DevInst *DevInst, XAie_DmaStream *Stream,
+		u32 Count);
+AieRC XAie_DmaStreamService(XAie_DevInst *DevInst, XAie_DmaStream *Stream);
+AieRC XAie_DmaStreamGetIndices(const XAie_DmaStream *Stream, u32 *ProdIdx,
+		u32 *ConsIdx);
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -28,6 +28,9 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+
+#include "xaie_clock.h"
 #include "xaie_events.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
@@ -37,12 +40,18 @@
 /***************************** Macro Definitions *****************************/
 #define XAIE_EVENT_PC_RESET		0xFFFF
 
+/* Tile flags of the broadcast route search, above the direction bits */
+#define XAIE_EVENT_BROADCAST_ROUTE_IN_TREE	0x10U
+#define XAIE_EVENT_BROADCAST_ROUTE_DST		0x20U
+#define XAIE_EVENT_BROADCAST_ROUTE_SEEN		0x40U
+
 /************************** Constant Definitions *****************************/
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
 *
-* This API is used to trigger an event the given module
+* This API computes the register write which triggers an event of the given
+* module, so that it can be issued later with XAie_EventGenerateFast().
 *
 * @param	DevInst: Device Instance
 * @param	Loc: Location of AIE Tile
@@ -51,18 +60,19 @@
 *			for Shim tile - XAIE_PL_MOD,
 *			for Mem tile - XAIE_MEM_MOD.
 * @param	Event: Event to be triggered
+* @param	Hdl: Pointer to return the register write.
 *
 * @return	XAIE_OK on success, error code on failure.
 *
 * @note		None.
 *
 ******************************************************************************/
-AieRC XAie_EventGenerate(XAie_DevInst *DevInst, XAie_LocType Loc,
-		XAie_ModuleType Module, XAie_Events Event)
+AieRC XAie_EventGenerateHandle(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Event,
+		XAie_EventGenHandle *Hdl)
 {
 	AieRC RC;
-	u64 RegAddr;
-	u32 RegOffset, FldVal, FldMask;
+	u32 RegOffset, FldMask;
 	u8 TileType, MappedEvent;
 	const XAie_EvntMod *EvntMod;
 
@@ -72,7 +82,12 @@ AieRC XAie_EventGenerate(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	if(Hdl == XAIE_NULL) {
+		XAIE_ERROR("Invalid event generate handle\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -103,10 +118,67 @@ AieRC XAie_EventGenerate(XAie_DevInst *DevInst, XAie_LocType Loc,
 
 	RegOffset = EvntMod->GenEventRegOff;
 	FldMask = EvntMod->GenEvent.Mask;
-	FldVal = XAie_SetField(MappedEvent, EvntMod->GenEvent.Lsb, FldMask);
-	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOffset;
+	Hdl->Val = XAie_SetField(MappedEvent, EvntMod->GenEvent.Lsb, FldMask);
+	Hdl->RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		RegOffset;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API is used to trigger an event the given module
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Module: Module of tile.
+*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			for Shim tile - XAIE_PL_MOD,
+*			for Mem tile - XAIE_MEM_MOD.
+* @param	Event: Event to be triggered
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_EventGenerate(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Event)
+{
+	XAie_EventGenHandle Hdl;
+	AieRC RC;
+
+	RC = XAie_EventGenerateHandle(DevInst, Loc, Module, Event, &Hdl);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	return XAie_Write32(DevInst, Hdl.RegAddr, Hdl.Val);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API triggers an event with a register write computed by
+* XAie_EventGenerateHandle(), without validating the arguments. It is meant
+* for hot paths such as host markers in a trace.
+*
+* @param	DevInst: Device Instance
+* @param	Hdl: Register write returned by XAie_EventGenerateHandle().
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Invalid arguments are undefined behavior. Builds with
+*		XAIE_DEBUG check the arguments and abort on invalid ones.
+*
+******************************************************************************/
+AieRC XAie_EventGenerateFast(XAie_DevInst *DevInst,
+		const XAie_EventGenHandle *Hdl)
+{
+	XAIE_ASSERT(DevInst != XAIE_NULL && Hdl != XAIE_NULL);
 
-	return XAie_Write32(DevInst, RegAddr, FldVal);
+	return XAie_Write32(DevInst, Hdl->RegAddr, Hdl->Val);
 }
 
 /*****************************************************************************/
@@ -147,7 +219,7 @@ static AieRC _XAie_EventComboControl(XAie_DevInst *DevInst, XAie_LocType Loc,
 	u8 TileType, Event1Lsb, Event2Lsb, MappedEvent1, MappedEvent2;
 	const XAie_EvntMod *EvntMod;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 
 	RC = _XAie_CheckModule(DevInst, Loc, Module);
 	if(RC != XAIE_OK) {
@@ -246,7 +318,7 @@ AieRC XAie_EventComboConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -284,7 +356,7 @@ AieRC XAie_EventGetComboEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -335,7 +407,7 @@ AieRC XAie_EventComboReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -406,7 +478,7 @@ static AieRC _XAie_EventSelectStrmPortConfig(XAie_DevInst *DevInst,
 		return XAIE_ERR_STREAM_PORT;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if (TileType == XAIEGBL_TILE_TYPE_AIETILE) {
 		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[XAIE_CORE_MOD];
 	} else {
@@ -483,7 +555,7 @@ AieRC XAie_EventSelectStrmPort(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -521,7 +593,7 @@ AieRC XAie_EventSelectStrmPortReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if (TileType == XAIEGBL_TILE_TYPE_AIETILE) {
 		Port = CORE;
 	} else if (TileType == XAIEGBL_TILE_TYPE_SHIMPL ||
@@ -566,7 +638,7 @@ AieRC XAie_EventGetIdlePortEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -618,7 +690,7 @@ static AieRC _XAie_EventBroadcastConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 	u8 TileType, MappedEvent;
 	const XAie_EvntMod *EvntMod;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 
 	RC = _XAie_CheckModule(DevInst, Loc, Module);
 	if(RC != XAIE_OK) {
@@ -684,7 +756,7 @@ AieRC XAie_EventBroadcast(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -724,7 +796,7 @@ AieRC XAie_EventBroadcastReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -794,7 +866,7 @@ AieRC XAie_EventBroadcastBlockDir(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -884,7 +956,7 @@ AieRC XAie_EventBroadcastBlockMapDir(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -974,7 +1046,7 @@ AieRC XAie_EventBroadcastUnblockDir(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -1023,138 +1095,126 @@ AieRC XAie_EventBroadcastUnblockDir(XAie_DevInst *DevInst, XAie_LocType Loc,
 /*****************************************************************************/
 /**
 *
-* This API enables, disables or resets events in a group event in the given
-* module.
+* This API computes the directions a broadcast channel has to be blocked in for
+* a module so that an event broadcast on the channel reaches every tile of the
+* partition exactly once. AIE tiles of checkerboard devices alternate the
+* east/west blocking between memory and core modules every row, non
+* checkerboard AIE tiles always block east in the memory module and west in the
+* core module, other tiles above the shim row block east and west.
 *
 * @param	DevInst: Device Instance
-* @param	Loc: Location of AIE Tile
+* @param	TileType: Type of the tile.
 * @param	Module: Module of tile.
-*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
-*			for Shim tile - XAIE_PL_MOD,
-*			for Mem tile - XAIE_MEM_MOD.
-* @param	GroupEvent: Group event ID.
-* @param	GroupBitMap: Bit mask.
-* @param	Reset: XAIE_RESETENABLE or XAIE_RESETDISABLE to reset or unreset
-*		       PC event register
-
-* @return	XAIE_OK on success, error code on failure.
+* @param	OddRow: 1 if the tile is on an odd row, 0 otherwise.
 *
-* @note		Internal Only.
+* @return	Directions to block.
+*
+* @note		Internal Only
 *
 ******************************************************************************/
-static AieRC _XAie_EventGroupConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
-		XAie_ModuleType Module, XAie_Events GroupEvent, u32 GroupBitMap,
-		u8 Reset)
+static u8 _XAie_EventBroadcastChannelBlockDir(XAie_DevInst *DevInst,
+		u8 TileType, XAie_ModuleType Module, u8 OddRow)
 {
-	AieRC RC;
-	u64 RegAddr;
-	u32 RegOffset, FldVal;
-	u8 TileType;
-	const XAie_EvntMod *EvntMod;
-
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-
-	RC = _XAie_CheckModule(DevInst, Loc, Module);
-	if(RC != XAIE_OK) {
-		return XAIE_INVALID_ARGS;
-	}
+	if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+		if(DevInst->DevOps->IsCheckerBoard && (OddRow == 0U)) {
+			return (Module == XAIE_MEM_MOD) ?
+				XAIE_EVENT_BROADCAST_WEST :
+				XAIE_EVENT_BROADCAST_EAST;
+		}
 
-	if (Module == XAIE_PL_MOD) {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
-	} else {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+		return (Module == XAIE_MEM_MOD) ? XAIE_EVENT_BROADCAST_EAST :
+			XAIE_EVENT_BROADCAST_WEST;
 	}
 
-	for(u32 Index = 0; Index < EvntMod->NumGroupEvents; Index++) {
-		if(GroupEvent == EvntMod->Group[Index].GroupEvent) {
-			RegOffset = EvntMod->BaseGroupEventRegOff +
-					EvntMod->Group[Index].GroupOff * 4U;
-			RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
-					RegOffset;
-
-			if (Reset == XAIE_RESETENABLE) {
-				FldVal = EvntMod->Group[Index].ResetValue;
-			} else {
-				FldVal = XAie_SetField(GroupBitMap, 0U,
-					 EvntMod->Group[Index].GroupMask);
-			}
-
-			RC = XAie_Write32(DevInst, RegAddr, FldVal);
-			if(RC != XAIE_OK) {
-				return RC;
-			}
-
-			return XAIE_OK;
-		}
+	if((TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
+			(TileType == XAIEGBL_TILE_TYPE_SHIMPL)) {
+		return 0U;
 	}
 
-	XAIE_ERROR("Invalid group event ID\n");
-	return XAIE_INVALID_ARGS;
+	return XAIE_EVENT_BROADCAST_WEST | XAIE_EVENT_BROADCAST_EAST;
 }
 
 /*****************************************************************************/
 /**
 *
-* This API enables or disables events in a group event in the given module.
+* This API blocks a broadcast channel of switch A of a module in the given
+* directions and unblocks it in the others.
 *
 * @param	DevInst: Device Instance
-* @param	Loc: Location of AIE Tile
-* @param	Module: Module of tile.
-*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
-*			for Shim tile - XAIE_PL_MOD,
-*			for Mem tile - XAIE_MEM_MOD.
-* @param	GroupEvent: Group event ID.
-* @param	GroupBitMap: Bit mask.
+* @param	EvntMod: Event module of the module.
+* @param	TileAddr: Address of the tile.
+* @param	BroadcastId: Broadcast index.
+* @param	BlockDir: Directions to block.
 *
 * @return	XAIE_OK on success, error code on failure.
 *
-* @note		None.
+* @note		Internal Only
 *
 ******************************************************************************/
-AieRC XAie_EventGroupControl(XAie_DevInst *DevInst, XAie_LocType Loc,
-		XAie_ModuleType Module, XAie_Events GroupEvent, u32 GroupBitMap)
+static AieRC _XAie_EventBroadcastBlockWrite(XAie_DevInst *DevInst,
+		const XAie_EvntMod *EvntMod, u64 TileAddr, u8 BroadcastId,
+		u8 BlockDir)
 {
-	u8 TileType;
+	AieRC RC;
 
-	if((DevInst == XAIE_NULL) ||
-			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
-		XAIE_ERROR("Invalid device instance\n");
-		return XAIE_INVALID_ARGS;
-	}
+	for(u8 DirShift = 0U; DirShift < 4U; DirShift++) {
+		u32 RegOffset;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
-		XAIE_ERROR("Invalid tile type\n");
-		return XAIE_INVALID_TILE;
-	}
+		if(BlockDir & (1U << DirShift)) {
+			RegOffset = EvntMod->BaseBroadcastSwBlockRegOff +
+				DirShift * EvntMod->BroadcastSwBlockOff;
+		} else {
+			RegOffset = EvntMod->BaseBroadcastSwUnblockRegOff +
+				DirShift * EvntMod->BroadcastSwUnblockOff;
+		}
 
-	return _XAie_EventGroupConfig(DevInst, Loc, Module, GroupEvent,
-			GroupBitMap, XAIE_RESETDISABLE);
+		RC = XAie_Write32(DevInst, TileAddr + RegOffset,
+				XAIE_ENABLE << BroadcastId);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
 
+	return XAIE_OK;
 }
 
 /*****************************************************************************/
 /**
 *
-* This API resets group event register in the given module.
+* This API programs one broadcast channel on a list of modules. The per tile
+* type event module, block masks and mapped event are computed once, all the
+* modules are validated before any write and the register writes are sent in
+* one optimized transaction.
 *
 * @param	DevInst: Device Instance
-* @param	Loc: Location of AIE Tile
-* @param	Module: Module of tile.
-*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
-*			for Shim tile - XAIE_PL_MOD,
-*			for Mem tile - XAIE_MEM_MOD.
-* @param	GroupEvent: Group event ID.
+* @param	Rscs: List of modules to program. Only the Loc and Mod fields
+*		are used, so the list returned by XAie_RequestBroadcastChannel()
+*		can be passed as is.
+* @param	NumRscs: Number of entries in Rscs.
+* @param	BroadcastId: Broadcast index.
+* @param	Event: Event to broadcast. It is mapped to the channel in every
+*		module of the list the event belongs to, e.g. a PL event is
+*		only mapped in the shim tiles. The event has to belong to at
+*		least one module of the list.
+* @param	Reset: XAIE_ENABLE to unblock the channel in all directions and
+*		reset its event in every module instead, Event is ignored.
 *
 * @return	XAIE_OK on success, error code on failure.
 *
-* @note		None.
+* @note		Internal Only
 *
 ******************************************************************************/
-AieRC XAie_EventGroupReset(XAie_DevInst *DevInst, XAie_LocType Loc,
-		XAie_ModuleType Module, XAie_Events GroupEvent)
+static AieRC _XAie_EventBroadcastChannel(XAie_DevInst *DevInst,
+		const XAie_UserRsc *Rscs, u32 NumRscs, u8 BroadcastId,
+		XAie_Events Event, u8 Reset)
 {
-	u8 TileType;
+	AieRC RC = XAIE_OK;
+	u8 OwnTxn = XAIE_DISABLE, EventUsed = XAIE_DISABLE;
+	struct {
+		const XAie_EvntMod *EvntMod;
+		u8 MappedEvent;
+		u8 BlockDir[2U];
+	} Mods[XAIEGBL_TILE_TYPE_MAX][XAIE_PL_MOD];
 
 	if((DevInst == XAIE_NULL) ||
 			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
@@ -1162,102 +1222,937 @@ AieRC XAie_EventGroupReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
-		XAIE_ERROR("Invalid tile type\n");
-		return XAIE_INVALID_TILE;
+	if((Rscs == XAIE_NULL) || (NumRscs == 0U)) {
+		XAIE_ERROR("Invalid broadcast channel module list\n");
+		return XAIE_INVALID_ARGS;
 	}
 
-	return _XAie_EventGroupConfig(DevInst, Loc, Module, GroupEvent, 0U,
-			XAIE_RESETENABLE);
-}
+	for(u8 TileType = 0U; TileType < XAIEGBL_TILE_TYPE_MAX; TileType++) {
+		for(u8 M = 0U; M < XAIE_PL_MOD; M++) {
+			Mods[TileType][M].EvntMod = XAIE_NULL;
+		}
+	}
 
-/*****************************************************************************/
-/**
-*
-* This API enables, disables or resets the program counter event in the given
-* module.
-*
-* @param	DevInst: Device Instance
-* @param	Loc: Location of AIE Tile
-* @param	Module: Module of tile.
-*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
-*			for Shim tile - XAIE_PL_MOD,
-*			for Mem tile - XAIE_MEM_MOD.
-* @param	PCEventId: PC Event index.
-* @param	PCAddr: PC event on this instruction address.
-* @param	Valid: XAIE_ENABLE or XAIE_DISABLE to enable or disable PC
-*		       event.
-*
-* @return	XAIE_OK on success, error code on failure.
-*
-* @note		Internal Only.
-*
-******************************************************************************/
-static AieRC _XAie_EventPCConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
-		u8 PCEventId, u16 PCAddr, u8 Valid)
-{
-	AieRC RC;
-	u64 RegAddr;
-	u32 RegOffset, FldVal;
-	u8 TileType;
-	const XAie_EvntMod *EvntMod;
+	for(u32 i = 0U; i < NumRscs; i++) {
+		XAie_ModuleType Module = (XAie_ModuleType)Rscs[i].Mod;
+		const XAie_EvntMod *EvntMod;
+		u8 TileType, M;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				Rscs[i].Loc);
+		if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+			XAIE_ERROR("Invalid tile type\n");
+			return XAIE_INVALID_TILE;
+		}
 
-	EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[XAIE_CORE_MOD];
+		if(_XAie_CheckModule(DevInst, Rscs[i].Loc, Module) != XAIE_OK) {
+			return XAIE_INVALID_ARGS;
+		}
 
-	if(PCEventId >= EvntMod->NumPCEvents) {
-		XAIE_ERROR("Invalid PC event ID\n");
-		return XAIE_INVALID_ARGS;
-	}
+		M = (Module == XAIE_PL_MOD) ? 0U : (u8)Module;
+		if(Mods[TileType][M].EvntMod != XAIE_NULL) {
+			continue;
+		}
 
-	RegOffset = EvntMod->BasePCEventRegOff + PCEventId * 4U;
-	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOffset;
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[M];
+		if(BroadcastId >= EvntMod->NumBroadcastIds) {
+			XAIE_ERROR("Invalid broadcast ID\n");
+			return XAIE_INVALID_ARGS;
+		}
 
-	if(Valid == XAIE_DISABLE) {
-		FldVal = XAie_SetField(Valid, EvntMod->PCValid.Lsb,
-				EvntMod->PCValid.Mask);
+		Mods[TileType][M].EvntMod = EvntMod;
+		Mods[TileType][M].MappedEvent = XAIE_EVENT_INVALID;
+		if((Reset == XAIE_DISABLE) && (Event >= EvntMod->EventMin) &&
+				(Event <= EvntMod->EventMax)) {
+			Mods[TileType][M].MappedEvent =
+				EvntMod->XAie_EventNumber[Event -
+				EvntMod->EventMin];
+		}
+		if(Mods[TileType][M].MappedEvent != XAIE_EVENT_INVALID) {
+			EventUsed = XAIE_ENABLE;
+		}
 
-		if(PCAddr == XAIE_EVENT_PC_RESET) {
-			FldVal |= XAie_SetField(0U, EvntMod->PCAddr.Lsb,
-						EvntMod->PCAddr.Mask);
-			RC = XAie_Write32(DevInst, RegAddr, FldVal);
+		for(u8 OddRow = 0U; OddRow < 2U; OddRow++) {
+			Mods[TileType][M].BlockDir[OddRow] =
+				(Reset == XAIE_ENABLE) ? 0U :
+				_XAie_EventBroadcastChannelBlockDir(DevInst,
+						TileType, Module, OddRow);
+		}
+	}
+
+	if((Reset == XAIE_DISABLE) && (EventUsed == XAIE_DISABLE)) {
+		XAIE_ERROR("Event does not belong to any module of the list\n");
+		return XAIE_INVALID_ARGS;
+	}
 
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH |
+				XAIE_TRANSACTION_ENABLE_OPTIMIZE);
+		if(RC != XAIE_OK) {
 			return RC;
 		}
+		OwnTxn = XAIE_ENABLE;
+	}
 
-		RC = XAie_MaskWrite32(DevInst, RegAddr, EvntMod->PCValid.Mask,
-				FldVal);
+	for(u32 i = 0U; (i < NumRscs) && (RC == XAIE_OK); i++) {
+		XAie_ModuleType Module = (XAie_ModuleType)Rscs[i].Mod;
+		const XAie_EvntMod *EvntMod;
+		u64 TileAddr;
+		u8 TileType, M, BlockDir, MappedEvent;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				Rscs[i].Loc);
+		M = (Module == XAIE_PL_MOD) ? 0U : (u8)Module;
+		EvntMod = Mods[TileType][M].EvntMod;
+		BlockDir = Mods[TileType][M].BlockDir[Rscs[i].Loc.Row % 2U];
+		TileAddr = _XAie_GetTileAddr(DevInst, Rscs[i].Loc.Row,
+				Rscs[i].Loc.Col);
+
+		RC = _XAie_EventBroadcastBlockWrite(DevInst, EvntMod, TileAddr,
+				BroadcastId, BlockDir);
 		if(RC != XAIE_OK) {
-			return RC;
+			break;
 		}
-	} else {
-		FldVal = XAie_SetField(PCAddr, EvntMod->PCAddr.Lsb,
-				EvntMod->PCAddr.Mask) |
-			 XAie_SetField(Valid, EvntMod->PCValid.Lsb,
-				EvntMod->PCValid.Mask);
-		RC = XAie_Write32(DevInst, RegAddr, FldVal);
 
-		return RC;
+		/* The broadcast event register of NONE events is zero */
+		MappedEvent = (Reset == XAIE_ENABLE) ? 0U :
+			Mods[TileType][M].MappedEvent;
+		if(MappedEvent != XAIE_EVENT_INVALID) {
+			RC = XAie_Write32(DevInst, TileAddr +
+					EvntMod->BaseBroadcastRegOff +
+					BroadcastId * 4U, MappedEvent);
+		}
 	}
 
-	return XAIE_OK;
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to configure broadcast channel %d\n",
+				BroadcastId);
+	}
+
+	return RC;
 }
 
 /*****************************************************************************/
 /**
 *
-* This API sets up program counter event in the given module
+* This API configures a broadcast channel over a list of modules, typically
+* every module of a partition. In every module the channel is unblocked in
+* the directions required to cover the list and blocked in the others, and the
+* event is mapped to the channel in every module it belongs to. The list is
+* validated first and the configuration is written in one transaction.
 *
 * @param	DevInst: Device Instance
-* @param	Loc: Location of AIE Tile
-* @param	PCEventId: PC Event index.
-* @param	PCAddr: PC event on this instruction address.
+* @param	Rscs: List of modules to program. Only the Loc and Mod fields
+*		are used.
+* @param	NumRscs: Number of entries in Rscs.
+* @param	BroadcastId: Broadcast index.
+* @param	Event: Event to broadcast. It must belong to at least one
+*		module of the list, e.g. a PL event is mapped to the channel in
+*		the shim tiles of the list.
 *
 * @return	XAIE_OK on success, error code on failure.
 *
-* @note		None.
+* @note		Only switch A of the modules is configured. If the calling
+*		thread has a transaction open, the writes are recorded into it.
+*
+******************************************************************************/
+AieRC XAie_EventBroadcastChannelConfig(XAie_DevInst *DevInst,
+		const XAie_UserRsc *Rscs, u32 NumRscs, u8 BroadcastId,
+		XAie_Events Event)
+{
+	return _XAie_EventBroadcastChannel(DevInst, Rscs, NumRscs, BroadcastId,
+			Event, XAIE_DISABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API undoes XAie_EventBroadcastChannelConfig(). The channel is unblocked
+* in all directions and its event is reset in every module of the list, with
+* all the writes sent in one transaction.
+*
+* @param	DevInst: Device Instance
+* @param	Rscs: List of modules to reset. Only the Loc and Mod fields are
+*		used.
+* @param	NumRscs: Number of entries in Rscs.
+* @param	BroadcastId: Broadcast index.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Only switch A of the modules is reset.
+*
+******************************************************************************/
+AieRC XAie_EventBroadcastChannelReset(XAie_DevInst *DevInst,
+		const XAie_UserRsc *Rscs, u32 NumRscs, u8 BroadcastId)
+{
+	return _XAie_EventBroadcastChannel(DevInst, Rscs, NumRscs, BroadcastId,
+			XAIE_EVENT_NONE_CORE, XAIE_ENABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the index of the neighbour of a tile of the partition in a
+* broadcast direction. Tiles are indexed column by column.
+*
+* @param	DevInst: Device Instance
+* @param	Idx: Index of the tile.
+* @param	DirShift: Bit position of the direction in XAie_BroadcastDir.
+* @param	Next: Pointer to return the index of the neighbour.
+*
+* @return	XAIE_ENABLE if the neighbour is in the partition, XAIE_DISABLE
+*		otherwise.
+*
+* @note		Internal Only
+*
+******************************************************************************/
+static u8 _XAie_EventBroadcastRouteNext(XAie_DevInst *DevInst, u32 Idx,
+		u8 DirShift, u32 *Next)
+{
+	u32 Col = Idx / DevInst->NumRows;
+	u32 Row = Idx % DevInst->NumRows;
+
+	switch(1U << DirShift) {
+	case XAIE_EVENT_BROADCAST_SOUTH:
+		if(Row == 0U) {
+			return XAIE_DISABLE;
+		}
+		*Next = Idx - 1U;
+		break;
+	case XAIE_EVENT_BROADCAST_NORTH:
+		if(Row + 1U >= DevInst->NumRows) {
+			return XAIE_DISABLE;
+		}
+		*Next = Idx + 1U;
+		break;
+	case XAIE_EVENT_BROADCAST_WEST:
+		if(Col == 0U) {
+			return XAIE_DISABLE;
+		}
+		*Next = Idx - DevInst->NumRows;
+		break;
+	default:
+		if(Col + 1U >= DevInst->NumCols) {
+			return XAIE_DISABLE;
+		}
+		*Next = Idx + DevInst->NumRows;
+		break;
+	}
+
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks that a location is a requested tile of the partition.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+*
+* @return	XAIE_OK if the tile can be used by a route, error code otherwise.
+*
+* @note		Internal Only
+*
+******************************************************************************/
+static AieRC _XAie_EventBroadcastRouteCheckLoc(XAie_DevInst *DevInst,
+		XAie_LocType Loc)
+{
+	if((Loc.Col >= DevInst->NumCols) || (Loc.Row >= DevInst->NumRows)) {
+		XAIE_ERROR("Invalid tile location (%u, %u)\n", Loc.Col,
+				Loc.Row);
+		return XAIE_INVALID_TILE;
+	}
+
+	if(_XAie_PmIsTileRequested(DevInst, Loc) == XAIE_DISABLE) {
+		XAIE_ERROR("Tile (%u, %u) is not requested\n", Loc.Col,
+				Loc.Row);
+		return XAIE_INVALID_TILE;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API computes the tiles a broadcast event has to go through to reach a
+* set of destination tiles from a source module, and the directions each
+* module of these tiles has to block so that the event does not leave them.
+* The tiles are joined one destination at a time by a shortest path of
+* requested tiles from the tiles already reached, which gives a tree close to
+* the smallest one. Event broadcast over the tree uses the same connections
+* within AIE tiles as XAie_EventBroadcastChannelConfig(): both modules of an
+* AIE tile are reached and the east and west connections are taken by the
+* module on that side of the tile.
+*
+* @param	DevInst: Device Instance
+* @param	Route: Pointer to the route to set up.
+* @param	Src: Location of the tile generating the event.
+* @param	SrcMod: Module generating the event.
+* @param	Dsts: Array of destination tile locations.
+* @param	NumDsts: Number of locations in Dsts.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Route->Rscs holds the modules of the route and can be passed
+*		to XAie_RequestBroadcastChannel() with BroadcastAllFlag 0 to
+*		reserve a channel on these modules only, so the same channel
+*		can be used by other routes over disjoint tiles. The route is
+*		released with XAie_EventBroadcastRouteFree().
+*
+******************************************************************************/
+AieRC XAie_EventBroadcastRoutePlan(XAie_DevInst *DevInst,
+		XAie_BroadcastRoute *Route, XAie_LocType Src,
+		XAie_ModuleType SrcMod, const XAie_LocType *Dsts, u32 NumDsts)
+{
+	AieRC RC = XAIE_OK;
+	u32 NumTiles, NumPending = 0U, NumRscs = 0U, Index = 0U;
+	u32 *Prev, *Queue;
+	u8 *Flags;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Route == XAIE_NULL) || (Dsts == XAIE_NULL) || (NumDsts == 0U)) {
+		XAIE_ERROR("Invalid broadcast route arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_EventBroadcastRouteCheckLoc(DevInst, Src);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(_XAie_CheckModule(DevInst, Src, SrcMod) != XAIE_OK) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumDsts; i++) {
+		RC = _XAie_EventBroadcastRouteCheckLoc(DevInst, Dsts[i]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	NumTiles = (u32)DevInst->NumCols * DevInst->NumRows;
+	Flags = (u8 *)calloc(NumTiles, sizeof(*Flags));
+	Prev = (u32 *)malloc(NumTiles * sizeof(*Prev));
+	Queue = (u32 *)malloc(NumTiles * sizeof(*Queue));
+	if((Flags == NULL) || (Prev == NULL) || (Queue == NULL)) {
+		XAIE_ERROR("Memory allocation failed\n");
+		free(Flags);
+		free(Prev);
+		free(Queue);
+		return XAIE_ERR;
+	}
+
+	/* The low bits of Flags are the directions of the tree neighbours */
+	Flags[Src.Col * DevInst->NumRows + Src.Row] =
+		XAIE_EVENT_BROADCAST_ROUTE_IN_TREE;
+	for(u32 i = 0U; i < NumDsts; i++) {
+		u32 Idx = Dsts[i].Col * DevInst->NumRows + Dsts[i].Row;
+
+		if((Flags[Idx] & (XAIE_EVENT_BROADCAST_ROUTE_IN_TREE |
+				XAIE_EVENT_BROADCAST_ROUTE_DST)) == 0U) {
+			Flags[Idx] |= XAIE_EVENT_BROADCAST_ROUTE_DST;
+			NumPending++;
+		}
+	}
+
+	while(NumPending > 0U) {
+		u32 Head = 0U, Tail = 0U, Found = NumTiles;
+
+		/* Search from all the tiles of the tree at once */
+		for(u32 i = 0U; i < NumTiles; i++) {
+			Flags[i] &= (u8)~XAIE_EVENT_BROADCAST_ROUTE_SEEN;
+			if(Flags[i] & XAIE_EVENT_BROADCAST_ROUTE_IN_TREE) {
+				Flags[i] |= XAIE_EVENT_BROADCAST_ROUTE_SEEN;
+				Queue[Tail++] = i;
+			}
+		}
+
+		while((Head < Tail) && (Found == NumTiles)) {
+			u32 Cur = Queue[Head++];
+
+			for(u8 DirShift = 0U; DirShift < 4U; DirShift++) {
+				u32 Next;
+
+				if((_XAie_EventBroadcastRouteNext(DevInst, Cur,
+						DirShift, &Next) == XAIE_DISABLE) ||
+						(Flags[Next] &
+						 XAIE_EVENT_BROADCAST_ROUTE_SEEN)) {
+					continue;
+				}
+
+				if(_XAie_PmIsTileRequested(DevInst,
+						XAie_TileLoc(Next /
+							DevInst->NumRows,
+							Next %
+							DevInst->NumRows)) ==
+						XAIE_DISABLE) {
+					continue;
+				}
+
+				Flags[Next] |= XAIE_EVENT_BROADCAST_ROUTE_SEEN;
+				Prev[Next] = Cur;
+				Queue[Tail++] = Next;
+				if(Flags[Next] & XAIE_EVENT_BROADCAST_ROUTE_DST) {
+					Found = Next;
+					break;
+				}
+			}
+		}
+
+		if(Found == NumTiles) {
+			XAIE_ERROR("Broadcast destination is not reachable\n");
+			RC = XAIE_ERR;
+			break;
+		}
+
+		/* Add the path to the tree, it ends on a tile of the tree */
+		for(u32 Cur = Found;
+				!(Flags[Cur] & XAIE_EVENT_BROADCAST_ROUTE_IN_TREE);
+				Cur = Prev[Cur]) {
+			u32 P = Prev[Cur];
+
+			for(u8 DirShift = 0U; DirShift < 4U; DirShift++) {
+				u32 Next;
+
+				if((_XAie_EventBroadcastRouteNext(DevInst, Cur,
+						DirShift, &Next) == XAIE_ENABLE) &&
+						(Next == P)) {
+					Flags[Cur] |= (u8)(1U << DirShift);
+					Flags[P] |= (u8)(1U <<
+						((DirShift + 2U) % 4U));
+					break;
+				}
+			}
+
+			if(Flags[Cur] & XAIE_EVENT_BROADCAST_ROUTE_DST) {
+				NumPending--;
+			}
+			Flags[Cur] = (Flags[Cur] &
+				(u8)~XAIE_EVENT_BROADCAST_ROUTE_DST) |
+				XAIE_EVENT_BROADCAST_ROUTE_IN_TREE;
+		}
+	}
+
+	free(Prev);
+	free(Queue);
+	if(RC != XAIE_OK) {
+		free(Flags);
+		return RC;
+	}
+
+	for(u32 i = 0U; i < NumTiles; i++) {
+		if(Flags[i] & XAIE_EVENT_BROADCAST_ROUTE_IN_TREE) {
+			NumRscs += (_XAie_DevGetTTypefromLoc(DevInst,
+					XAie_TileLoc(i / DevInst->NumRows,
+						i % DevInst->NumRows)) ==
+					XAIEGBL_TILE_TYPE_AIETILE) ? 2U : 1U;
+		}
+	}
+
+	Route->Rscs = (XAie_UserRsc *)calloc(NumRscs, sizeof(*Route->Rscs));
+	Route->BlockDir = (u8 *)malloc(NumRscs * sizeof(*Route->BlockDir));
+	if((Route->Rscs == NULL) || (Route->BlockDir == NULL)) {
+		XAIE_ERROR("Memory allocation failed\n");
+		free(Route->Rscs);
+		free(Route->BlockDir);
+		free(Flags);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumTiles; i++) {
+		XAie_LocType Loc = XAie_TileLoc(i / DevInst->NumRows,
+				i % DevInst->NumRows);
+		u8 Adj = Flags[i] & XAIE_EVENT_BROADCAST_ALL;
+		u8 TileType;
+
+		if(!(Flags[i] & XAIE_EVENT_BROADCAST_ROUTE_IN_TREE)) {
+			continue;
+		}
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+		if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+			const XAie_ModuleType Mods[] = {XAIE_CORE_MOD,
+				XAIE_MEM_MOD};
+
+			for(u8 M = 0U; M < 2U; M++) {
+				/* Module side east or west, other side inner */
+				u8 Outer = _XAie_EventBroadcastChannelBlockDir(
+						DevInst, TileType, Mods[M],
+						Loc.Row % 2U);
+				u8 Unblock = (Adj & (XAIE_EVENT_BROADCAST_NORTH |
+						XAIE_EVENT_BROADCAST_SOUTH |
+						Outer)) |
+					((XAIE_EVENT_BROADCAST_WEST |
+					  XAIE_EVENT_BROADCAST_EAST) & ~Outer);
+
+				Route->Rscs[Index].Loc = Loc;
+				Route->Rscs[Index].Mod = Mods[M];
+				Route->Rscs[Index].RscType =
+					XAIE_BCAST_CHANNEL_RSC;
+				Route->BlockDir[Index++] =
+					XAIE_EVENT_BROADCAST_ALL & ~Unblock;
+			}
+		} else {
+			Route->Rscs[Index].Loc = Loc;
+			Route->Rscs[Index].Mod =
+				((TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
+				 (TileType == XAIEGBL_TILE_TYPE_SHIMPL)) ?
+				XAIE_PL_MOD : XAIE_MEM_MOD;
+			Route->Rscs[Index].RscType = XAIE_BCAST_CHANNEL_RSC;
+			Route->BlockDir[Index++] = XAIE_EVENT_BROADCAST_ALL &
+				~Adj;
+		}
+	}
+
+	free(Flags);
+
+	Route->Src = Src;
+	Route->SrcMod = SrcMod;
+	Route->NumRscs = NumRscs;
+	Route->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API programs or resets a broadcast channel along a route. All the
+* writes are sent in one transaction.
+*
+* @param	DevInst: Device Instance
+* @param	Route: Route set up by XAie_EventBroadcastRoutePlan().
+* @param	BroadcastId: Broadcast index.
+* @param	Event: Event of the source module to broadcast.
+* @param	Reset: XAIE_ENABLE to reset the channel, Event is ignored.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal Only
+*
+******************************************************************************/
+static AieRC _XAie_EventBroadcastRoute(XAie_DevInst *DevInst,
+		const XAie_BroadcastRoute *Route, u8 BroadcastId,
+		XAie_Events Event, u8 Reset)
+{
+	AieRC RC = XAIE_OK;
+	u8 OwnTxn = XAIE_DISABLE;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Route == XAIE_NULL) ||
+			(Route->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid broadcast route\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < Route->NumRscs; i++) {
+		u8 TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				Route->Rscs[i].Loc);
+		u8 M = (Route->Rscs[i].Mod == XAIE_PL_MOD) ? 0U :
+			(u8)Route->Rscs[i].Mod;
+
+		if(BroadcastId >=
+			DevInst->DevProp.DevMod[TileType].EvntMod[M].
+			NumBroadcastIds) {
+			XAIE_ERROR("Invalid broadcast ID\n");
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	/* The event is only mapped once the channel is confined to the route */
+	if(Reset == XAIE_ENABLE) {
+		RC = XAie_EventBroadcastReset(DevInst, Route->Src,
+				Route->SrcMod, BroadcastId);
+	}
+
+	for(u32 i = 0U; (i < Route->NumRscs) && (RC == XAIE_OK); i++) {
+		u8 TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				Route->Rscs[i].Loc);
+		u8 M = (Route->Rscs[i].Mod == XAIE_PL_MOD) ? 0U :
+			(u8)Route->Rscs[i].Mod;
+
+		RC = _XAie_EventBroadcastBlockWrite(DevInst,
+				&DevInst->DevProp.DevMod[TileType].EvntMod[M],
+				_XAie_GetTileAddr(DevInst,
+					Route->Rscs[i].Loc.Row,
+					Route->Rscs[i].Loc.Col), BroadcastId,
+				(Reset == XAIE_ENABLE) ? 0U :
+				Route->BlockDir[i]);
+	}
+
+	if((RC == XAIE_OK) && (Reset == XAIE_DISABLE)) {
+		RC = XAie_EventBroadcast(DevInst, Route->Src, Route->SrcMod,
+				BroadcastId, Event);
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures a broadcast channel along a route: every module of the
+* route blocks the channel in the directions leaving the route, and the event
+* of the source module is then mapped to the channel.
+*
+* @param	DevInst: Device Instance
+* @param	Route: Route set up by XAie_EventBroadcastRoutePlan().
+* @param	BroadcastId: Broadcast index.
+* @param	Event: Event of the source module to broadcast.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Only switch A of the modules is configured. Modules outside
+*		the route are not written and the channel is not used there.
+*
+******************************************************************************/
+AieRC XAie_EventBroadcastRouteConfig(XAie_DevInst *DevInst,
+		const XAie_BroadcastRoute *Route, u8 BroadcastId,
+		XAie_Events Event)
+{
+	return _XAie_EventBroadcastRoute(DevInst, Route, BroadcastId, Event,
+			XAIE_DISABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API undoes XAie_EventBroadcastRouteConfig(). The event of the source
+* module is reset first and the channel is then unblocked in all directions in
+* every module of the route.
+*
+* @param	DevInst: Device Instance
+* @param	Route: Route set up by XAie_EventBroadcastRoutePlan().
+* @param	BroadcastId: Broadcast index.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Only switch A of the modules is reset.
+*
+******************************************************************************/
+AieRC XAie_EventBroadcastRouteReset(XAie_DevInst *DevInst,
+		const XAie_BroadcastRoute *Route, u8 BroadcastId)
+{
+	return _XAie_EventBroadcastRoute(DevInst, Route, BroadcastId,
+			XAIE_EVENT_NONE_CORE, XAIE_ENABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the memory of a route set up by
+* XAie_EventBroadcastRoutePlan().
+*
+* @param	Route: Pointer to the route.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_EventBroadcastRouteFree(XAie_BroadcastRoute *Route)
+{
+	if((Route == XAIE_NULL) ||
+			(Route->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid broadcast route\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(Route->Rscs);
+	free(Route->BlockDir);
+	Route->Rscs = XAIE_NULL;
+	Route->BlockDir = XAIE_NULL;
+	Route->NumRscs = 0U;
+	Route->IsReady = 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API enables, disables or resets events in a group event in the given
+* module.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Module: Module of tile.
+*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			for Shim tile - XAIE_PL_MOD,
+*			for Mem tile - XAIE_MEM_MOD.
+* @param	GroupEvent: Group event ID.
+* @param	GroupBitMap: Bit mask.
+* @param	Reset: XAIE_RESETENABLE or XAIE_RESETDISABLE to reset or unreset
+*		       PC event register
+
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal Only.
+*
+******************************************************************************/
+static AieRC _XAie_EventGroupConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events GroupEvent, u32 GroupBitMap,
+		u8 Reset)
+{
+	AieRC RC;
+	u64 RegAddr;
+	u32 RegOffset, FldVal;
+	u8 TileType;
+	const XAie_EvntMod *EvntMod;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+
+	RC = _XAie_CheckModule(DevInst, Loc, Module);
+	if(RC != XAIE_OK) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	if (Module == XAIE_PL_MOD) {
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+	} else {
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+	}
+
+	for(u32 Index = 0; Index < EvntMod->NumGroupEvents; Index++) {
+		if(GroupEvent == EvntMod->Group[Index].GroupEvent) {
+			RegOffset = EvntMod->BaseGroupEventRegOff +
+					EvntMod->Group[Index].GroupOff * 4U;
+			RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+					RegOffset;
+
+			if (Reset == XAIE_RESETENABLE) {
+				FldVal = EvntMod->Group[Index].ResetValue;
+			} else {
+				FldVal = XAie_SetField(GroupBitMap, 0U,
+					 EvntMod->Group[Index].GroupMask);
+			}
+
+			RC = XAie_Write32(DevInst, RegAddr, FldVal);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+
+			return XAIE_OK;
+		}
+	}
+
+	XAIE_ERROR("Invalid group event ID\n");
+	return XAIE_INVALID_ARGS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API enables or disables events in a group event in the given module.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Module: Module of tile.
+*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			for Shim tile - XAIE_PL_MOD,
+*			for Mem tile - XAIE_MEM_MOD.
+* @param	GroupEvent: Group event ID.
+* @param	GroupBitMap: Bit mask.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_EventGroupControl(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events GroupEvent, u32 GroupBitMap)
+{
+	u8 TileType;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	return _XAie_EventGroupConfig(DevInst, Loc, Module, GroupEvent,
+			GroupBitMap, XAIE_RESETDISABLE);
+
+}
+
+/*****************************************************************************/
+/**
+*
+* This API resets group event register in the given module.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Module: Module of tile.
+*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			for Shim tile - XAIE_PL_MOD,
+*			for Mem tile - XAIE_MEM_MOD.
+* @param	GroupEvent: Group event ID.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_EventGroupReset(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events GroupEvent)
+{
+	u8 TileType;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	return _XAie_EventGroupConfig(DevInst, Loc, Module, GroupEvent, 0U,
+			XAIE_RESETENABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API enables, disables or resets the program counter event in the given
+* module.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Module: Module of tile.
+*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			for Shim tile - XAIE_PL_MOD,
+*			for Mem tile - XAIE_MEM_MOD.
+* @param	PCEventId: PC Event index.
+* @param	PCAddr: PC event on this instruction address.
+* @param	Valid: XAIE_ENABLE or XAIE_DISABLE to enable or disable PC
+*		       event.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal Only.
+*
+******************************************************************************/
+static AieRC _XAie_EventPCConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u8 PCEventId, u16 PCAddr, u8 Valid)
+{
+	AieRC RC;
+	u64 RegAddr;
+	u32 RegOffset, FldVal;
+	u8 TileType;
+	const XAie_EvntMod *EvntMod;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+
+	EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[XAIE_CORE_MOD];
+
+	if(PCEventId >= EvntMod->NumPCEvents) {
+		XAIE_ERROR("Invalid PC event ID\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RegOffset = EvntMod->BasePCEventRegOff + PCEventId * 4U;
+	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOffset;
+
+	if(Valid == XAIE_DISABLE) {
+		FldVal = XAie_SetField(Valid, EvntMod->PCValid.Lsb,
+				EvntMod->PCValid.Mask);
+
+		if(PCAddr == XAIE_EVENT_PC_RESET) {
+			FldVal |= XAie_SetField(0U, EvntMod->PCAddr.Lsb,
+						EvntMod->PCAddr.Mask);
+			RC = XAie_Write32(DevInst, RegAddr, FldVal);
+
+			return RC;
+		}
+
+		RC = XAie_MaskWrite32(DevInst, RegAddr, EvntMod->PCValid.Mask,
+				FldVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	} else {
+		FldVal = XAie_SetField(PCAddr, EvntMod->PCAddr.Lsb,
+				EvntMod->PCAddr.Mask) |
+			 XAie_SetField(Valid, EvntMod->PCValid.Lsb,
+				EvntMod->PCValid.Mask);
+		RC = XAie_Write32(DevInst, RegAddr, FldVal);
+
+		return RC;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets up program counter event in the given module
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	PCEventId: PC Event index.
+* @param	PCAddr: PC event on this instruction address.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
 *
 ******************************************************************************/
 AieRC XAie_EventPCEnable(XAie_DevInst *DevInst, XAie_LocType Loc, u8 PCEventId,
@@ -1271,20 +2166,54 @@ AieRC XAie_EventPCEnable(XAie_DevInst *DevInst, XAie_LocType Loc, u8 PCEventId,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	return _XAie_EventPCConfig(DevInst, Loc, PCEventId, PCAddr,
+			XAIE_ENABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API disables program counter event in the given module
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	PCEventId: PC Event index.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_EventPCDisable(XAie_DevInst *DevInst, XAie_LocType Loc, u8 PCEventId)
+{
+	u8 TileType;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	return _XAie_EventPCConfig(DevInst, Loc, PCEventId, PCAddr,
-			XAIE_ENABLE);
+	return _XAie_EventPCConfig(DevInst, Loc, PCEventId, 0U, XAIE_DISABLE);
 }
 
 /*****************************************************************************/
 /**
 *
-* This API disables program counter event in the given module
+* This API resets program counter event register in the given module. Valid and
+* PC address bit fields are set to zero.
 *
 * @param	DevInst: Device Instance
 * @param	Loc: Location of AIE Tile
@@ -1292,99 +2221,368 @@ AieRC XAie_EventPCEnable(XAie_DevInst *DevInst, XAie_LocType Loc, u8 PCEventId,
 *
 * @return	XAIE_OK on success, error code on failure.
 *
-* @note		None.
-*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_EventPCReset(XAie_DevInst *DevInst, XAie_LocType Loc, u8 PCEventId)
+{
+	u8 TileType;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	return _XAie_EventPCConfig(DevInst, Loc, PCEventId,
+					XAIE_EVENT_PC_RESET, XAIE_DISABLE);
+}
+/*****************************************************************************/
+/**
+* This API is used to convert XAie_Events enum to hardware event id.
+*
+* @param        DevInst: Device Instance
+* @param        Loc: Location of the tile
+* @param        Module: Module of tile.
+* @param        Event: Event to be converted
+* @param        HwEvent: Pointer to store physical event id
+*
+* @return       XAIE_OK on success
+*
+* @note
+*
+******************************************************************************/
+AieRC XAie_EventLogicalToPhysicalConv(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Event, u8 *HwEvent)
+{
+	AieRC RC;
+	u8 TileType;
+	const XAie_EvntMod *EvntMod;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		return XAIE_INVALID_TILE;
+	}
+
+	/* check for module and tiletype combination */
+	RC = _XAie_CheckModule(DevInst, Loc, Module);
+	if(RC != XAIE_OK) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Module == XAIE_PL_MOD) {
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+	} else {
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+	}
+	/* check if the event passed as input is corresponding to the module */
+	if(Event < EvntMod->EventMin || Event > EvntMod->EventMax) {
+		XAIE_ERROR("Invalid Event id\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Subtract the module offset from event number */
+	Event -= EvntMod->EventMin;
+
+	/* Getting the true event number from the enum to array mapping */
+	*HwEvent = EvntMod->XAie_EventNumber[Event];
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API is used to convert hardware event id to XAie_Events enum.
+*
+* @param        DevInst: Device Instance
+* @param        Loc: Location of the tile
+* @param        Module: Module of tile.
+* @param        PhysicalEvent: Physical event id to be converted
+* @param        EnumEvent: Pointer to store converted event
+*
+* @return       XAIE_OK on success
+*
+* @note
+*
+******************************************************************************/
+AieRC XAie_EventPhysicalToLogicalConv(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, u8 HwEvent, XAie_Events *EnumEvent)
+{
+	AieRC RC;
+	u8 TileType;
+	const XAie_EvntMod *EvntMod;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		return XAIE_INVALID_TILE;
+	}
+
+	/* check for module and tiletype combination */
+	RC = _XAie_CheckModule(DevInst, Loc, Module);
+	if(RC != XAIE_OK) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Module == XAIE_PL_MOD) {
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+	} else {
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+	}
+
+	for(u32 i = EvntMod->EventMin; i <= EvntMod->EventMax; i++) {
+		if(EvntMod->XAie_EventNumber[i - EvntMod->EventMin] == HwEvent) {
+			*EnumEvent = i;
+			return XAIE_OK;
+		}
+	}
+	XAIE_ERROR("Could not convert Physical event:%u to Logical event.\n", HwEvent);
+
+	return XAIE_INVALID_ARGS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the address of the status register of an event and the
+* bit of the event in it.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Module: Module of tile.
+* @param	Events: Event.
+* @param	RegAddr: Pointer to store the address of the status register.
+* @param	Bit: Pointer to store the bit of the event.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+******************************************************************************/
+static AieRC _XAie_EventGetStatusReg(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Events, u64 *RegAddr,
+		u8 *Bit)
+{
+	AieRC RC;
+	u32 RegOff;
+	u8 TileType, PhyEvent;
+	const XAie_EvntMod *EvntMod;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	RC = _XAie_CheckModule(DevInst, Loc, Module);
+	if(RC != XAIE_OK) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	if (Module == XAIE_PL_MOD) {
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+	} else {
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+	}
+
+	RC = XAie_EventLogicalToPhysicalConv(DevInst, Loc, Module, Events,
+								&PhyEvent);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Invalid event ID\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RegOff = EvntMod->BaseStatusRegOff + (PhyEvent / 32U) * 4U;
+	*RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOff;
+	*Bit = PhyEvent % 32U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the status of event.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Module: Module of tile.
+*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			for Shim tile - XAIE_PL_MOD.
+*			for Mem tile - XAIE_MEM_MOD.
+* @param	Events: List of XAie_Events.
+* @param	Status: Buffer to return status of event.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None
+******************************************************************************/
+AieRC XAie_EventReadStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Events, u8 *Status)
+{
+	AieRC RC;
+	u64 RegAddr;
+	u32 RegVal;
+	u8 Bit;
+
+	if((Status == XAIE_NULL) || (DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ) {
+		XAIE_ERROR("Invalid device instance or buffer pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_EventGetStatusReg(DevInst, Loc, Module, Events, &RegAddr,
+			&Bit);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_Read32(DevInst, RegAddr, &RegVal);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	*Status =  (u8)(RegVal >> Bit) & 1U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the status of an event, so that XAie_EventReadStatus() only
+* reports the next occurrence of the event.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Module: Module of tile.
+*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			for Shim tile - XAIE_PL_MOD.
+*			for Mem tile - XAIE_MEM_MOD.
+* @param	Events: Event to clear.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The status registers are write 1 to clear, the status of the
+*		other events is left as is.
 ******************************************************************************/
-AieRC XAie_EventPCDisable(XAie_DevInst *DevInst, XAie_LocType Loc, u8 PCEventId)
+AieRC XAie_EventClearStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Events)
 {
-	u8 TileType;
+	AieRC RC;
+	u64 RegAddr;
+	u8 Bit;
 
 	if((DevInst == XAIE_NULL) ||
-			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ) {
 		XAIE_ERROR("Invalid device instance\n");
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
-		XAIE_ERROR("Invalid tile type\n");
-		return XAIE_INVALID_TILE;
+	RC = _XAie_EventGetStatusReg(DevInst, Loc, Module, Events, &RegAddr,
+			&Bit);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	return _XAie_EventPCConfig(DevInst, Loc, PCEventId, 0U, XAIE_DISABLE);
+	return XAie_Write32(DevInst, RegAddr, 1U << Bit);
 }
 
 /*****************************************************************************/
 /**
 *
-* This API resets program counter event register in the given module. Valid and
-* PC address bit fields are set to zero.
+* This API returns the user base event based on the tile location
 *
 * @param	DevInst: Device Instance
 * @param	Loc: Location of AIE Tile
-* @param	PCEventId: PC Event index.
-*
-* @return	XAIE_OK on success, error code on failure.
+* @param	Module: Module of tile.
+*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			for Shim tile - XAIE_PL_MOD.
+* @param	Event: Base event of tile
 *
-* @note		None.
+* @return	XAIE_OK, error code on failure
 *
+* @note		None
 ******************************************************************************/
-AieRC XAie_EventPCReset(XAie_DevInst *DevInst, XAie_LocType Loc, u8 PCEventId)
+AieRC XAie_EventGetUserEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events *Event)
 {
+	AieRC RC;
 	u8 TileType;
 
-	if((DevInst == XAIE_NULL) ||
+	if((DevInst == XAIE_NULL) || (Event == NULL) ||
 			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
-		XAIE_ERROR("Invalid device instance\n");
+		XAIE_ERROR("Invalid arguments\n");
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	return _XAie_EventPCConfig(DevInst, Loc, PCEventId,
-					XAIE_EVENT_PC_RESET, XAIE_DISABLE);
+	RC = _XAie_CheckModule(DevInst, Loc, Module);
+	if(RC != XAIE_OK) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	if (TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+		*Event = DevInst->DevProp.DevMod[TileType].EvntMod[Module].UserEventBase;
+	} else {
+		*Event = DevInst->DevProp.DevMod[TileType].EvntMod[0U].UserEventBase;
+	}
+
+	return RC;
 }
+
 /*****************************************************************************/
 /**
-* This API is used to convert XAie_Events enum to hardware event id.
 *
-* @param        DevInst: Device Instance
-* @param        Loc: Location of the tile
-* @param        Module: Module of tile.
-* @param        Event: Event to be converted
-* @param        HwEvent: Pointer to store physical event id
+* This API returns the event module of an entry of an event status snapshot
+* and the number of status registers of that module. The number of registers
+* is derived from the largest physical event of the module.
 *
-* @return       XAIE_OK on success
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Module: Module of tile.
+* @param	NumRegs: Pointer to return the number of status registers.
 *
-* @note
+* @return	Pointer to the event module, NULL if Loc or Module is invalid.
+*
+* @note		Internal Only.
 *
 ******************************************************************************/
-AieRC XAie_EventLogicalToPhysicalConv(XAie_DevInst *DevInst, XAie_LocType Loc,
-		XAie_ModuleType Module, XAie_Events Event, u8 *HwEvent)
+static const XAie_EvntMod* _XAie_EventStatusGetMod(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_ModuleType Module, u8 *NumRegs)
 {
-	AieRC RC;
-	u8 TileType;
 	const XAie_EvntMod *EvntMod;
+	u8 TileType, MaxEvent = 0U;
 
-	if((DevInst == XAIE_NULL) ||
-		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
-		XAIE_ERROR("Invalid Device Instance\n");
-		return XAIE_INVALID_ARGS;
-	}
-
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
-		return XAIE_INVALID_TILE;
+		XAIE_ERROR("Invalid tile type\n");
+		return NULL;
 	}
 
-	/* check for module and tiletype combination */
-	RC = _XAie_CheckModule(DevInst, Loc, Module);
-	if(RC != XAIE_OK) {
-		return XAIE_INVALID_ARGS;
+	if(_XAie_CheckModule(DevInst, Loc, Module) != XAIE_OK) {
+		return NULL;
 	}
 
 	if(Module == XAIE_PL_MOD) {
@@ -1392,142 +2590,219 @@ AieRC XAie_EventLogicalToPhysicalConv(XAie_DevInst *DevInst, XAie_LocType Loc,
 	} else {
 		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
 	}
-	/* check if the event passed as input is corresponding to the module */
-	if(Event < EvntMod->EventMin || Event > EvntMod->EventMax) {
-		XAIE_ERROR("Invalid Event id\n");
-		return XAIE_INVALID_ARGS;
-	}
 
-	/* Subtract the module offset from event number */
-	Event -= EvntMod->EventMin;
+	for(u32 i = 0U; i <= EvntMod->EventMax - EvntMod->EventMin; i++) {
+		u8 HwEvent = EvntMod->XAie_EventNumber[i];
 
-	/* Getting the true event number from the enum to array mapping */
-	*HwEvent = EvntMod->XAie_EventNumber[Event];
+		if((HwEvent != XAIE_EVENT_INVALID) && (HwEvent > MaxEvent)) {
+			MaxEvent = HwEvent;
+		}
+	}
+	*NumRegs = MaxEvent / 32U + 1U;
 
-	return XAIE_OK;
+	return EvntMod;
 }
 
 /*****************************************************************************/
 /**
-* This API is used to convert hardware event id to XAie_Events enum.
 *
-* @param        DevInst: Device Instance
-* @param        Loc: Location of the tile
-* @param        Module: Module of tile.
-* @param        PhysicalEvent: Physical event id to be converted
-* @param        EnumEvent: Pointer to store converted event
+* This API sets up a snapshot of the event status registers of a set of
+* modules. The modules are validated and the register addresses are computed
+* once, so reading the snapshot only issues one block read per module.
 *
-* @return       XAIE_OK on success
+* @param	DevInst: Device Instance
+* @param	Snap: Caller owned snapshot to set up.
+* @param	Locs: Location of the tile of each entry.
+* @param	Modules: Module of each entry.
+*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			for Shim tile - XAIE_PL_MOD.
+*			for Mem tile - XAIE_MEM_MOD.
+* @param	NumEntries: Number of entries in Locs and Modules.
 *
-* @note
+* @return	XAIE_OK on success
+*		XAIE_INVALID_ARGS if any argument is invalid
+*		XAIE_ERR if memory allocation fails
+*
+* @note		The snapshot has to be released with
+*		XAie_EventStatusSnapshotFree().
 *
 ******************************************************************************/
-AieRC XAie_EventPhysicalToLogicalConv(XAie_DevInst *DevInst, XAie_LocType Loc,
-		XAie_ModuleType Module, u8 HwEvent, XAie_Events *EnumEvent)
+AieRC XAie_EventStatusSnapshotInit(XAie_DevInst *DevInst,
+		XAie_EventStatusSnapshot *Snap, const XAie_LocType *Locs,
+		const XAie_ModuleType *Modules, u32 NumEntries)
 {
-	AieRC RC;
-	u8 TileType;
-	const XAie_EvntMod *EvntMod;
+	u8 RegsPerEntry = 0U;
 
 	if((DevInst == XAIE_NULL) ||
-		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
 		XAIE_ERROR("Invalid Device Instance\n");
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
-		return XAIE_INVALID_TILE;
-	}
-
-	/* check for module and tiletype combination */
-	RC = _XAie_CheckModule(DevInst, Loc, Module);
-	if(RC != XAIE_OK) {
+	if((Snap == XAIE_NULL) || (Locs == XAIE_NULL) ||
+			(Modules == XAIE_NULL) || (NumEntries == 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
 		return XAIE_INVALID_ARGS;
 	}
 
-	if(Module == XAIE_PL_MOD) {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
-	} else {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
-	}
+	for(u32 i = 0U; i < NumEntries; i++) {
+		u8 NumRegs;
 
-	for(u32 i = EvntMod->EventMin; i <= EvntMod->EventMax; i++) {
-		if(EvntMod->XAie_EventNumber[i - EvntMod->EventMin] == HwEvent) {
-			*EnumEvent = i;
-			return XAIE_OK;
+		if(_XAie_EventStatusGetMod(DevInst, Locs[i], Modules[i],
+					&NumRegs) == NULL) {
+			return XAIE_INVALID_ARGS;
+		}
+		if(NumRegs > RegsPerEntry) {
+			RegsPerEntry = NumRegs;
 		}
 	}
-	XAIE_ERROR("Could not convert Physical event:%u to Logical event.\n", HwEvent);
 
-	return XAIE_INVALID_ARGS;
+	Snap->IsReady = 0U;
+	Snap->NumEntries = NumEntries;
+	Snap->RegsPerEntry = RegsPerEntry;
+	Snap->Status = (u32 *)calloc((size_t)NumEntries * RegsPerEntry,
+			sizeof(u32));
+	Snap->RegAddrs = (u64 *)malloc(NumEntries * sizeof(u64));
+	Snap->NumRegs = (u8 *)malloc(NumEntries * sizeof(u8));
+	Snap->Locs = (XAie_LocType *)malloc(NumEntries * sizeof(XAie_LocType));
+	Snap->Modules = (XAie_ModuleType *)malloc(NumEntries *
+			sizeof(XAie_ModuleType));
+	if((Snap->Status == NULL) || (Snap->RegAddrs == NULL) ||
+			(Snap->NumRegs == NULL) || (Snap->Locs == NULL) ||
+			(Snap->Modules == NULL)) {
+		XAIE_ERROR("Memory allocation for snapshot failed\n");
+		free(Snap->Status);
+		free(Snap->RegAddrs);
+		free(Snap->NumRegs);
+		free(Snap->Locs);
+		free(Snap->Modules);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumEntries; i++) {
+		const XAie_EvntMod *EvntMod;
+
+		EvntMod = _XAie_EventStatusGetMod(DevInst, Locs[i], Modules[i],
+				&Snap->NumRegs[i]);
+		Snap->RegAddrs[i] = _XAie_GetTileAddr(DevInst, Locs[i].Row,
+				Locs[i].Col) + EvntMod->BaseStatusRegOff;
+		Snap->Locs[i] = Locs[i];
+		Snap->Modules[i] = Modules[i];
+	}
+
+	Snap->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
 }
 
 /*****************************************************************************/
 /**
 *
-* This API returns the status of event.
+* This API reads the event status registers of all the entries of a snapshot,
+* with one block read per module. The status registers are sticky, so a bit
+* stays set once its event has occurred until it is cleared.
 *
 * @param	DevInst: Device Instance
-* @param	Loc: Location of AIE Tile
-* @param	Module: Module of tile.
-*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
-*			for Shim tile - XAIE_PL_MOD.
-*			for Mem tile - XAIE_MEM_MOD.
-* @param	Events: List of XAie_Events.
-* @param	Status: Buffer to return status of event.
+* @param	Snap: Snapshot set up by XAie_EventStatusSnapshotInit().
+* @param	ClearOnRead: XAIE_ENABLE to clear the status bits which were
+*		read as set, so the next read only reports the events which
+*		occurred in between.
 *
 * @return	XAIE_OK on success, error code on failure.
 *
-* @note		None
+* @note		The status registers are write 1 to clear. Clearing writes back
+*		the value read, so an event which occurs between the read and
+*		the write is kept for the next read.
+*
 ******************************************************************************/
-AieRC XAie_EventReadStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
-		XAie_ModuleType Module, XAie_Events Events, u8 *Status)
+AieRC XAie_EventStatusSnapshotRead(XAie_DevInst *DevInst,
+		XAie_EventStatusSnapshot *Snap, u8 ClearOnRead)
 {
-	AieRC RC;
-	u64 RegAddr;
-	u32 RegOff, RegVal;
-	u8 TileType, PhyEvent;
-	const XAie_EvntMod *EvntMod;
+	AieRC RC = XAIE_OK;
 
-	if((Status == XAIE_NULL) || (DevInst == XAIE_NULL) ||
-			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ) {
-		XAIE_ERROR("Invalid device instance or buffer pointer\n");
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
-		XAIE_ERROR("Invalid tile type\n");
-		return XAIE_INVALID_TILE;
-	}
-
-	RC = _XAie_CheckModule(DevInst, Loc, Module);
-	if(RC != XAIE_OK) {
+	if((Snap == XAIE_NULL) || (Snap->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid snapshot\n");
 		return XAIE_INVALID_ARGS;
 	}
 
-	if (Module == XAIE_PL_MOD) {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
-	} else {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+	for(u32 i = 0U; i < Snap->NumEntries; i++) {
+		u32 *Status = &Snap->Status[(size_t)i * Snap->RegsPerEntry];
+
+		RC = XAie_BlockRead32(DevInst, Snap->RegAddrs[i], Status,
+				Snap->NumRegs[i]);
+		if(RC != XAIE_OK) {
+			break;
+		}
+
+		if(ClearOnRead == XAIE_ENABLE) {
+			u32 Set = 0U;
+
+			for(u8 r = 0U; r < Snap->NumRegs[i]; r++) {
+				Set |= Status[r];
+			}
+			if(Set == 0U) {
+				continue;
+			}
+
+			RC = XAie_BlockWrite32(DevInst, Snap->RegAddrs[i],
+					Status, Snap->NumRegs[i]);
+			if(RC != XAIE_OK) {
+				break;
+			}
+		}
 	}
 
-	RC = XAie_EventLogicalToPhysicalConv(DevInst, Loc, Module, Events,
-								&PhyEvent);
 	if(RC != XAIE_OK) {
-		XAIE_ERROR("Invalid event ID\n");
+		XAIE_ERROR("Unable to read event status snapshot\n");
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API computes the events set in a snapshot which were not set in a
+* previous snapshot of the same modules.
+*
+* @param	Cur: Current snapshot.
+* @param	Prev: Previous snapshot, set up with the same modules as Cur.
+* @param	Bits: Buffer of Cur->NumEntries * Cur->RegsPerEntry words to
+*		return the bitmap of newly set events, in the layout of
+*		Cur->Status.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if the snapshots do not
+*		match.
+*
+* @note		Swapping Cur and Prev returns the events which were cleared.
+*
+******************************************************************************/
+AieRC XAie_EventStatusSnapshotDiff(const XAie_EventStatusSnapshot *Cur,
+		const XAie_EventStatusSnapshot *Prev, u32 *Bits)
+{
+	if((Cur == XAIE_NULL) || (Prev == XAIE_NULL) || (Bits == XAIE_NULL) ||
+			(Cur->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Prev->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid snapshot or buffer pointer\n");
 		return XAIE_INVALID_ARGS;
 	}
 
-	RegOff = EvntMod->BaseStatusRegOff + (PhyEvent / 32U) * 4U;
-	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOff;
-	RC = XAie_Read32(DevInst, RegAddr, &RegVal);
-	if(RC != XAIE_OK) {
-		return RC;
+	if((Cur->NumEntries != Prev->NumEntries) ||
+			(Cur->RegsPerEntry != Prev->RegsPerEntry)) {
+		XAIE_ERROR("Snapshots are not of the same modules\n");
+		return XAIE_INVALID_ARGS;
 	}
 
-	*Status =  (u8)(RegVal >> (PhyEvent % 32U)) & 1U;
+	for(size_t i = 0U; i < (size_t)Cur->NumEntries * Cur->RegsPerEntry;
+			i++) {
+		Bits[i] = Cur->Status[i] & ~Prev->Status[i];
+	}
 
 	return XAIE_OK;
 }
@@ -1535,49 +2810,109 @@ AieRC XAie_EventReadStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
 /*****************************************************************************/
 /**
 *
-* This API returns the user base event based on the tile location
+* This API iterates over the set bits of an event status bitmap, such as the
+* Status of a snapshot or the output of XAie_EventStatusSnapshotDiff(), and
+* returns the next set event.
 *
 * @param	DevInst: Device Instance
-* @param	Loc: Location of AIE Tile
-* @param	Module: Module of tile.
-*			for AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
-*			for Shim tile - XAIE_PL_MOD.
-* @param	Event: Base event of tile
+* @param	Snap: Snapshot the bitmap was taken from.
+* @param	Bits: Bitmap in the layout of Snap->Status.
+* @param	Pos: Position of the iterator, 0 to start from the first bit.
+*		It is advanced past the returned event.
+* @param	Loc: Pointer to return the location of the event.
+* @param	Module: Pointer to return the module of the event.
+* @param	Event: Pointer to return the event.
 *
-* @return	XAIE_OK, error code on failure
+* @return	1 if an event was returned, 0 once all the set bits were
+*		visited or if an argument is invalid.
+*
+* @note		Bits of physical events without a logical event are skipped.
 *
-* @note		None
 ******************************************************************************/
-AieRC XAie_EventGetUserEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
-		XAie_ModuleType Module, XAie_Events *Event)
+u8 XAie_EventStatusNext(XAie_DevInst *DevInst,
+		const XAie_EventStatusSnapshot *Snap, const u32 *Bits,
+		u32 *Pos, XAie_LocType *Loc, XAie_ModuleType *Module,
+		XAie_Events *Event)
 {
-	AieRC RC;
-	u8 TileType;
+	u32 BitsPerEntry, Total;
 
-	if((DevInst == XAIE_NULL) || (Event == NULL) ||
-			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+	if((DevInst == XAIE_NULL) || (Snap == XAIE_NULL) ||
+			(Snap->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Bits == XAIE_NULL) || (Pos == XAIE_NULL) ||
+			(Loc == XAIE_NULL) || (Module == XAIE_NULL) ||
+			(Event == XAIE_NULL)) {
 		XAIE_ERROR("Invalid arguments\n");
-		return XAIE_INVALID_ARGS;
+		return 0U;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
-		XAIE_ERROR("Invalid tile type\n");
-		return XAIE_INVALID_TILE;
+	BitsPerEntry = (u32)Snap->RegsPerEntry * 32U;
+	Total = Snap->NumEntries * BitsPerEntry;
+	while(*Pos < Total) {
+		const XAie_EvntMod *EvntMod;
+		u32 Word, Bit, Entry;
+		u8 HwEvent, NumRegs;
+
+		Word = Bits[*Pos / 32U] >> (*Pos % 32U);
+		if(Word == 0U) {
+			*Pos = (*Pos | 31U) + 1U;
+			continue;
+		}
+
+		Bit = *Pos + first_set_bit(Word) - 1U;
+		*Pos = Bit + 1U;
+		Entry = Bit / BitsPerEntry;
+		HwEvent = (u8)(Bit % BitsPerEntry);
+		if(HwEvent >= Snap->NumRegs[Entry] * 32U) {
+			continue;
+		}
+
+		EvntMod = _XAie_EventStatusGetMod(DevInst, Snap->Locs[Entry],
+				Snap->Modules[Entry], &NumRegs);
+		if(EvntMod == NULL) {
+			return 0U;
+		}
+
+		for(u32 i = EvntMod->EventMin; i <= EvntMod->EventMax; i++) {
+			if(EvntMod->XAie_EventNumber[i - EvntMod->EventMin] ==
+					HwEvent) {
+				*Loc = Snap->Locs[Entry];
+				*Module = Snap->Modules[Entry];
+				*Event = (XAie_Events)i;
+				return 1U;
+			}
+		}
 	}
 
-	RC = _XAie_CheckModule(DevInst, Loc, Module);
-	if(RC != XAIE_OK) {
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the memory of an event status snapshot.
+*
+* @param	Snap: Snapshot set up by XAie_EventStatusSnapshotInit().
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if Snap is invalid.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_EventStatusSnapshotFree(XAie_EventStatusSnapshot *Snap)
+{
+	if((Snap == XAIE_NULL) || (Snap->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid snapshot\n");
 		return XAIE_INVALID_ARGS;
 	}
 
-	if (TileType == XAIEGBL_TILE_TYPE_AIETILE) {
-		*Event = DevInst->DevProp.DevMod[TileType].EvntMod[Module].UserEventBase;
-	} else {
-		*Event = DevInst->DevProp.DevMod[TileType].EvntMod[0U].UserEventBase;
-	}
+	free(Snap->Status);
+	free(Snap->RegAddrs);
+	free(Snap->NumRegs);
+	free(Snap->Locs);
+	free(Snap->Modules);
+	Snap->IsReady = 0U;
 
-	return RC;
+	return XAIE_OK;
 }
 
 #endif /* XAIE_FEATURE_EVENTS_ENABLE */
@@ -35,6 +35,7 @@
 
 /***************************** Include Files *********************************/
 #include "xaiegbl.h"
+#include "xaie_rsc.h"
 
 /***************************** Macro Definitions *****************************/
 #define XAIE_EVENT_INVALID		255U
@@ -713,9 +714,55 @@ typedef enum {
 	XAIE_EVENT_BROADCAST_ALL   = 0b1111U,
 } XAie_BroadcastDir;
 
+/*
+ * Snapshot of the event status registers of a set of modules. The status bits
+ * of entry i are stored at i * RegsPerEntry, one bit per physical event. It is
+ * set up by XAie_EventStatusSnapshotInit() and refreshed by
+ * XAie_EventStatusSnapshotRead().
+ */
+typedef struct {
+	u32 NumEntries;		/* Number of modules in the snapshot */
+	u8 RegsPerEntry;	/* Largest number of status registers of a module */
+	u32 *Status;		/* Status register r of entry i at
+				 * i * RegsPerEntry + r */
+	u64 *RegAddrs;		/* Address of status register 0 of each entry */
+	u8 *NumRegs;		/* Number of status registers of each entry */
+	XAie_LocType *Locs;	/* Location of the tile of each entry */
+	XAie_ModuleType *Modules;	/* Module of each entry */
+	u8 IsReady;
+} XAie_EventStatusSnapshot;
+
+/*
+ * Propagation of a broadcast event from a source module to a set of tiles, set
+ * up by XAie_EventBroadcastRoutePlan(). Rscs lists the modules the event goes
+ * through and BlockDir the directions each of them blocks.
+ */
+typedef struct {
+	XAie_LocType Src;
+	XAie_ModuleType SrcMod;
+	XAie_UserRsc *Rscs;	/* Modules of the route */
+	u8 *BlockDir;		/* Directions blocked by each module of Rscs */
+	u32 NumRscs;
+	u8 IsReady;
+} XAie_BroadcastRoute;
+
+/*
+ * Register write generating an event, computed once by
+ * XAie_EventGenerateHandle() and issued by XAie_EventGenerateFast().
+ */
+typedef struct {
+	u64 RegAddr;
+	u32 Val;
+} XAie_EventGenHandle;
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_EventGenerate(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, XAie_Events Event);
+AieRC XAie_EventGenerateHandle(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Event,
+		XAie_EventGenHandle *Hdl);
+AieRC XAie_EventGenerateFast(XAie_DevInst *DevInst,
+		const XAie_EventGenHandle *Hdl);
 AieRC XAie_EventComboConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, XAie_EventComboId ComboId,
 		XAie_EventComboOps Op, XAie_Events Event1, XAie_Events Event2);
@@ -743,6 +790,20 @@ AieRC XAie_EventBroadcastBlockMapDir(XAie_DevInst *DevInst, XAie_LocType Loc,
 AieRC XAie_EventBroadcastUnblockDir(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, XAie_BroadcastSw Switch, u8 BroadcastId,
 		u8 Dir);
+AieRC XAie_EventBroadcastChannelConfig(XAie_DevInst *DevInst,
+		const XAie_UserRsc *Rscs, u32 NumRscs, u8 BroadcastId,
+		XAie_Events Event);
+AieRC XAie_EventBroadcastChannelReset(XAie_DevInst *DevInst,
+		const XAie_UserRsc *Rscs, u32 NumRscs, u8 BroadcastId);
+AieRC XAie_EventBroadcastRoutePlan(XAie_DevInst *DevInst,
+		XAie_BroadcastRoute *Route, XAie_LocType Src,
+		XAie_ModuleType SrcMod, const XAie_LocType *Dsts, u32 NumDsts);
+AieRC XAie_EventBroadcastRouteConfig(XAie_DevInst *DevInst,
+		const XAie_BroadcastRoute *Route, u8 BroadcastId,
+		XAie_Events Event);
+AieRC XAie_EventBroadcastRouteReset(XAie_DevInst *DevInst,
+		const XAie_BroadcastRoute *Route, u8 BroadcastId);
+AieRC XAie_EventBroadcastRouteFree(XAie_BroadcastRoute *Route);
 AieRC XAie_EventGroupControl(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, XAie_Events GroupEvent, u32 GroupBitMap);
 AieRC XAie_EventGroupReset(XAie_DevInst *DevInst, XAie_LocType Loc,
@@ -759,6 +820,20 @@ AieRC XAie_EventLogicalToPhysicalConv(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, XAie_Events Event, u8 *HwEvent);
 AieRC XAie_EventReadStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, XAie_Events Events, u8 *Status);
+AieRC XAie_EventClearStatus(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Events);
 AieRC XAie_EventGetUserEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
 	XAie_ModuleType Module, XAie_Events *Event);
+AieRC XAie_EventStatusSnapshotInit(XAie_DevInst *DevInst,
+		XAie_EventStatusSnapshot *Snap, const XAie_LocType *Locs,
+		const XAie_ModuleType *Modules, u32 NumEntries);
+AieRC XAie_EventStatusSnapshotRead(XAie_DevInst *DevInst,
+		XAie_EventStatusSnapshot *Snap, u8 ClearOnRead);
+AieRC XAie_EventStatusSnapshotDiff(const XAie_EventStatusSnapshot *Cur,
+		const XAie_EventStatusSnapshot *Prev, u32 *Bits);
+u8 XAie_EventStatusNext(XAie_DevInst *DevInst,
+		const XAie_EventStatusSnapshot *Snap, const u32 *Bits,
+		u32 *Pos, XAie_LocType *Loc, XAie_ModuleType *Module,
+		XAie_Events *Event);
+AieRC XAie_EventStatusSnapshotFree(XAie_EventStatusSnapshot *Snap);
 #endif		/* end of protection macro */
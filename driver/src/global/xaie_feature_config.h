@@ -43,6 +43,10 @@
 *    * XAIE_FEATURE_ELF_ENABLE: AIE ELF loader APIs
 *    * XAIE_FEATURE_RSC_ENABLE: AIE resource management APIs
 *    * XAIE_FEATURE_INTR_INIT_ENABLE: AIE interrupt network initialization APIs
+*  * Features which are never enabled by the groups above and have to be
+*    defined explicitly:
+*    * XAIE_FEATURE_IO_STATS_ENABLE: statistics of the register accesses
+*      issued to the IO backend, see xaie_iostats.h
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -124,5 +128,69 @@
 #endif
 #endif
 
+/*
+ * Device generations built into the driver. A build for a single generation
+ * with XAIE_DEV_SINGLE_GEN leaves out the register database and the module
+ * implementations of the other generations.
+ */
+#ifdef XAIE_DEV_SINGLE_GEN
+#include "xaiegbl_defs.h"
+#if XAIE_DEV_SINGLE_GEN == XAIE_DEV_GEN_AIE
+#define XAIE_DEV_AIE_ENABLE
+#elif XAIE_DEV_SINGLE_GEN == XAIE_DEV_GEN_AIEML
+#define XAIE_DEV_AIEML_ENABLE
+#endif
+#else
+#define XAIE_DEV_AIE_ENABLE
+#define XAIE_DEV_AIEML_ENABLE
+#endif /* XAIE_DEV_SINGLE_GEN */
+
+/*
+ * Device and partition geometry fixed at build time. A build for a single
+ * generation with XAIE_DEV_STATIC takes the geometry from the
+ * XAIE_DEV_STATIC_* macros of xaie_dev_static.h, which is provided by the
+ * build like xaie_custom_device.h is for the lite driver. The tile addresses
+ * and tile types of constant locations then fold to constants and no tile
+ * type table is built at runtime. Instances are declared with
+ * XAie_StaticInstDeclare() and initialized with the config of
+ * XAie_SetupStaticConfig().
+ */
+#ifdef XAIE_DEV_STATIC
+#ifndef XAIE_DEV_SINGLE_GEN
+#error "XAIE_DEV_STATIC requires XAIE_DEV_SINGLE_GEN"
+#endif
+#include <xaie_dev_static.h>
+#if !defined(XAIE_DEV_STATIC_BASE_ADDR) || \
+	!defined(XAIE_DEV_STATIC_COL_SHIFT) || \
+	!defined(XAIE_DEV_STATIC_ROW_SHIFT) || \
+	!defined(XAIE_DEV_STATIC_DEV_NUM_COLS) || \
+	!defined(XAIE_DEV_STATIC_NUM_ROWS) || \
+	!defined(XAIE_DEV_STATIC_SHIM_ROW) || \
+	!defined(XAIE_DEV_STATIC_MEM_TILE_ROW_START) || \
+	!defined(XAIE_DEV_STATIC_MEM_TILE_NUM_ROWS) || \
+	!defined(XAIE_DEV_STATIC_AIE_TILE_ROW_START) || \
+	!defined(XAIE_DEV_STATIC_AIE_TILE_NUM_ROWS) || \
+	!defined(XAIE_DEV_STATIC_PART_BASE_ADDR) || \
+	!defined(XAIE_DEV_STATIC_START_COL) || \
+	!defined(XAIE_DEV_STATIC_NUM_COLS)
+#error "XAIE_DEV_STATIC requires the device and partition geometry"
+#endif
+#if (XAIE_DEV_STATIC_START_COL + XAIE_DEV_STATIC_NUM_COLS) > \
+	XAIE_DEV_STATIC_DEV_NUM_COLS
+#error "XAIE_DEV_STATIC partition does not fit in the device"
+#endif
+#endif /* XAIE_DEV_STATIC */
+
+/*
+ * IO backend built into the driver. When the Linux backend is the only one
+ * selected with AIEBACKEND, the register accessors are called directly rather
+ * than through the ops of the backend.
+ */
+#if defined(__AIELINUX__) && !defined(__AIEMETAL__) && !defined(__AIESIM__) && \
+	!defined(__AIECDO__) && !defined(__AIEBAREMETAL__) && \
+	!defined(__AIESOCKET__) && !defined(__AIEDEBUG__)
+#define XAIE_BACKEND_LINUX_ONLY
+#endif
+
 #endif /* XAIE_FEATURE_CONFIG_H */
 /** @} */
@@ -32,9 +32,18 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include "xaie_clock.h"
+#include "xaie_dma_shadow.h"
+#include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_io.h"
+#include "xaie_io_privilege.h"
+#include "xaie_iostats.h"
+#include "xaie_mempool.h"
 #include "xaie_rsc_internal.h"
+#include "xaie_shadow.h"
+#include "xaie_txn.h"
+#include "xaie_txnmemo.h"
 #include "xaiegbl.h"
 #include "xaiegbl_defs.h"
 #include "xaiegbl_regdef.h"
@@ -47,11 +56,14 @@
 #define XAIE_ECC_BROADCAST_ID		6U
 
 /************************** Variable Definitions *****************************/
+#ifdef XAIE_DEV_AIE_ENABLE
 extern XAie_TileMod AieMod[XAIEGBL_TILE_TYPE_MAX];
-extern XAie_TileMod AieMlMod[XAIEGBL_TILE_TYPE_MAX];
-
 extern XAie_DeviceOps AieDevOps;
+#endif
+#ifdef XAIE_DEV_AIEML_ENABLE
+extern XAie_TileMod AieMlMod[XAIEGBL_TILE_TYPE_MAX];
 extern XAie_DeviceOps AieMlDevOps;
+#endif
 
 #if XAIE_DEV_SINGLE_GEN == XAIE_DEV_GEN_AIEML
 #define XAIE_DEV_SINGLE_MOD AieMlMod
@@ -168,6 +180,26 @@ AieRC XAie_CfgInitialize(XAie_DevInst *InstPtr, XAie_Config *ConfigPtr)
 		return XAIE_INVALID_DEVICE;
 	}
 
+#ifdef XAIE_DEV_STATIC
+	if((ConfigPtr->ColShift != XAIE_DEV_STATIC_COL_SHIFT) ||
+			(ConfigPtr->RowShift != XAIE_DEV_STATIC_ROW_SHIFT) ||
+			(ConfigPtr->NumRows != XAIE_DEV_STATIC_NUM_ROWS) ||
+			(ConfigPtr->ShimRowNum != XAIE_DEV_STATIC_SHIM_ROW) ||
+			(ConfigPtr->MemTileRowStart !=
+			 XAIE_DEV_STATIC_MEM_TILE_ROW_START) ||
+			(ConfigPtr->MemTileNumRows !=
+			 XAIE_DEV_STATIC_MEM_TILE_NUM_ROWS) ||
+			(ConfigPtr->AieTileRowStart !=
+			 XAIE_DEV_STATIC_AIE_TILE_ROW_START) ||
+			(ConfigPtr->AieTileNumRows !=
+			 XAIE_DEV_STATIC_AIE_TILE_NUM_ROWS) ||
+			(InstPtr->StartCol != XAIE_DEV_STATIC_START_COL) ||
+			(InstPtr->NumCols != XAIE_DEV_STATIC_NUM_COLS)) {
+		XAIE_ERROR("Device or partition differs from static geometry\n");
+		return XAIE_INVALID_DEVICE;
+	}
+#endif
+
 	InstPtr->IsReady = XAIE_COMPONENT_IS_READY;
 	InstPtr->DevProp.RowShift = ConfigPtr->RowShift;
 	InstPtr->DevProp.ColShift = ConfigPtr->ColShift;
@@ -179,9 +211,46 @@ AieRC XAie_CfgInitialize(XAie_DevInst *InstPtr, XAie_Config *ConfigPtr)
 	InstPtr->AieTileNumRows = ConfigPtr->AieTileNumRows;
 	InstPtr->EccStatus = XAIE_ENABLE;
 	InstPtr->TxnList.Next = NULL;
+	InstPtr->TxnQueue = NULL;
+	InstPtr->Shadow = NULL;
+	InstPtr->BdShadow = NULL;
+	InstPtr->MemPool = NULL;
+	InstPtr->MemCkpt = NULL;
+	InstPtr->TxnMemo = NULL;
+	InstPtr->IOStats = NULL;
+	InstPtr->TileTypes = NULL;
+	InstPtr->TilesInUse = NULL;
+	InstPtr->MemInUse = NULL;
+	InstPtr->CoreInUse = NULL;
+	for(u32 i = 0U; i < XAIE_TXN_HASH_SIZE; i++) {
+		InstPtr->TxnHash[i].Next = NULL;
+	}
+
+	RC = _XAie_TxnLocksInit(InstPtr);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+#ifndef XAIE_DEV_STATIC
+	RC = _XAie_TileTypesInit(InstPtr);
+	if(RC != XAIE_OK) {
+		_XAie_TxnLocksFinish(InstPtr);
+		return RC;
+	}
+#endif
+
+	RC = _XAie_TileBitmapsInit(InstPtr);
+	if(RC != XAIE_OK) {
+		_XAie_TileTypesFinish(InstPtr);
+		_XAie_TxnLocksFinish(InstPtr);
+		return RC;
+	}
 
 	RC = _XAie_RscMgrInit(InstPtr);
 	if(RC != XAIE_OK) {
+		_XAie_TileBitmapsFinish(InstPtr);
+		_XAie_TileTypesFinish(InstPtr);
+		_XAie_TxnLocksFinish(InstPtr);
 		return RC;
 	}
 
@@ -190,12 +259,56 @@ AieRC XAie_CfgInitialize(XAie_DevInst *InstPtr, XAie_Config *ConfigPtr)
 
 	RC = XAie_IOInit(InstPtr);
 	if(RC != XAIE_OK) {
+		_XAie_TileBitmapsFinish(InstPtr);
+		_XAie_TileTypesFinish(InstPtr);
+		_XAie_TxnLocksFinish(InstPtr);
 		return RC;
 	}
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API splits the columns of the partition into groups which raise their
+* error interrupts on separate NoC IRQs, so that the errors of disjoint groups
+* of columns can be handled concurrently, each with
+* XAie_BacktrackErrorInterruptsGroup(). Group g of NumGroups covers the columns
+* for which XAie_ErrorIrqGroup() returns g and raises NoC IRQ
+* XAie_ErrorIrqGroupIrqId(g).
+*
+* @param	DevInst - Device instance pointer.
+* @param	NumGroups - Number of groups, from 1 to XAIE_ERROR_MAX_IRQ_GROUPS
+*		and at most the number of columns.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The groups are applied to the second level interrupt
+*		controllers and the NPI IRQs by XAie_PartitionInitialize(), so
+*		this API has to be called before it. The Linux backend leaves
+*		the error interrupts to the partition driver.
+*
+******************************************************************************/
+AieRC XAie_SetErrorIrqGroups(XAie_DevInst *DevInst, u8 NumGroups)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((NumGroups == 0U) || (NumGroups > XAIE_ERROR_MAX_IRQ_GROUPS) ||
+		(NumGroups > DevInst->NumCols)) {
+		XAIE_ERROR("Invalid number of error IRQ groups %u\n", NumGroups);
+		return XAIE_INVALID_ARGS;
+	}
+
+	DevInst->NumErrIrqGroups = NumGroups;
+
+	return XAIE_OK;
+}
+
 #if !defined(XAIE_FEATURE_LITE) && defined(XAIE_FEATURE_PRIVILEGED_ENABLE)
 /*****************************************************************************/
 /**
@@ -277,6 +390,190 @@ AieRC XAie_PartitionTeardown(XAie_DevInst *DevInst)
 
 	return XAIE_OK;
 }
+
+/*****************************************************************************/
+/**
+*
+* This is the api to teardown the AI engine partition with only the memories
+* of the tiles used since the partition was initialized zeroized. The memories
+* of the other tiles still hold the zeros of the initialization or of the
+* previous teardown, as their clocks were gated. The columns and SHIMs are
+* reset as with XAie_PartitionTeardown(), and the register accesses before
+* and after the SHIM reset are each submitted as one transaction.
+*
+* @param	DevInst - Global AIE device instance pointer.
+* @param	UsedTiles - Bitmap of the used tiles, in the layout of the tiles
+*		in use of the device instance: bit Col * (NumRows - 1) +
+*		Row - 1 for the tiles above the SHIM row. NULL to use the
+*		tiles requested with XAie_PmRequestTiles().
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Tiles released before the teardown are not in the tiles in
+*		use of the device instance, pass them in UsedTiles.
+*
+******************************************************************************/
+AieRC XAie_PartitionTeardownTiles(XAie_DevInst *DevInst,
+		const u32 *UsedTiles)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(UsedTiles == NULL) {
+		UsedTiles = DevInst->TilesInUse;
+	}
+
+	RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_PARTITION_TEARDOWN,
+			(void *)(uintptr_t)UsedTiles);
+	if (RC != XAIE_OK) {
+		XAIE_ERROR("Failed to teardown partition.\n");
+		return RC;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the api to capture the initialization of the AI engine partition for
+* the given options into an initialization cache. The cache records the AI
+* engine register configuration of XAie_PartitionInitialize(), so that
+* partitions of the same geometry can be initialized with
+* XAie_PartitionInitializeReplay() without generating it again. The cache is
+* a plain buffer which can be stored and reused by other processes.
+*
+* @param	DevInst - Global AIE device instance pointer.
+* @param	Opts - AI engine partition initialization options, see
+*		XAie_PartitionInitialize().
+* @param	Buf - Destination buffer. If NULL, only the required size is
+*		returned in Size.
+* @param	Size - Pointer to the size of Buf in bytes. It is updated with
+*		the size of the initialization cache.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if Buf is
+*		too small and error code on failure.
+*
+* @note		The hardware is not accessed, the partition is not
+*		initialized. Not supported with the Linux backend, where the
+*		kernel initializes the partition, or within a transaction.
+*
+******************************************************************************/
+AieRC XAie_PartitionInitializeCapture(XAie_DevInst *DevInst,
+		XAie_PartInitOpts *Opts, void *Buf, u64 *Size)
+{
+	if((DevInst == XAIE_NULL) || (Size == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((DevInst->Backend->Type == XAIE_IO_BACKEND_LINUX) ||
+			(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE)) {
+		XAIE_ERROR("Partition initialization cannot be captured "
+				"with this backend or within a transaction\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	return _XAie_PrivilegeInitPartCapture(DevInst, Opts, Buf, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the api to initialize the AI engine partition from an initialization
+* cache captured with XAie_PartitionInitializeCapture(). The recorded register
+* configuration is submitted in a transaction per step instead of being
+* generated again, and the SHIMs are reset in between.
+*
+* @param	DevInst - Global AIE device instance pointer.
+* @param	Buf - Initialization cache.
+* @param	Size - Size of Buf in bytes.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_DEVICE if the initialization
+*		was captured for another device generation or partition
+*		geometry and error code on failure.
+*
+* @note		The cache is only valid for partitions of the same number of
+*		rows and columns, and at the same start column on devices
+*		where the SHIM tile types depend on the column. Not supported
+*		with the Linux backend or within a transaction.
+*
+******************************************************************************/
+AieRC XAie_PartitionInitializeReplay(XAie_DevInst *DevInst, const void *Buf,
+		u64 Size)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((DevInst->Backend->Type == XAIE_IO_BACKEND_LINUX) ||
+			(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE)) {
+		XAIE_ERROR("Partition initialization cannot be replayed "
+				"with this backend or within a transaction\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	RC = _XAie_PrivilegeInitPartReplay(DevInst, Buf, Size);
+	if (RC != XAIE_OK) {
+		XAIE_ERROR("Failed to initialize partition.\n");
+		return RC;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the api to gate the clocks of a range of columns of the AI engine
+* partition. It matches the API of the lite driver, see XAie_PmGateColumns().
+*
+* @param	DevInst - Global AIE device instance pointer.
+* @param	StartCol - First column, relative to the partition.
+* @param	NumCols - Number of columns.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_PartitionGateColumns(XAie_DevInst *DevInst, u32 StartCol,
+		u32 NumCols)
+{
+	return XAie_PmGateColumns(DevInst, StartCol, NumCols);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the api to ungate the clocks of a range of columns of the AI engine
+* partition. It matches the API of the lite driver, see
+* XAie_PmUngateColumns() to get the ungating latency.
+*
+* @param	DevInst - Global AIE device instance pointer.
+* @param	StartCol - First column, relative to the partition.
+* @param	NumCols - Number of columns.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_PartitionUngateColumns(XAie_DevInst *DevInst, u32 StartCol,
+		u32 NumCols)
+{
+	return XAie_PmUngateColumns(DevInst, StartCol, NumCols, NULL);
+}
 #endif /* !XAIE_FEATURE_LITE && XAIE_FEATURE_PRIVILEGED_ENABLE */
 
 /*****************************************************************************/
@@ -331,7 +628,14 @@ AieRC XAie_Finish(XAie_DevInst *DevInst)
 	}
 
 	/* Free transaction mode resources, if any */
+	_XAie_TxnQueueFinish(DevInst);
+	_XAie_TxnMemoFinish(DevInst);
 	_XAie_TxnResourceCleanup(DevInst);
+	_XAie_TxnLocksFinish(DevInst);
+	_XAie_ShadowFinish(DevInst);
+	_XAie_BdShadowFinish(DevInst);
+	_XAie_MemPoolFinish(DevInst);
+	_XAie_IOStatsFinish(DevInst);
 
 	CurrBackend = DevInst->Backend;
 	RC = CurrBackend->Ops.Finish(DevInst->IOInst);
@@ -345,6 +649,8 @@ AieRC XAie_Finish(XAie_DevInst *DevInst)
 		return RC;
 	}
 
+	_XAie_TileBitmapsFinish(DevInst);
+	_XAie_TileTypesFinish(DevInst);
 	DevInst->IsReady = 0;
 
 	return XAIE_OK;
@@ -381,6 +687,7 @@ AieRC XAie_SetIOBackend(XAie_DevInst *DevInst, XAie_BackendType Backend)
 	}
 
 	/* Release resources for current backend */
+	XAie_MemPoolTrim(DevInst);
 	CurrBackend = DevInst->Backend;
 	RC = CurrBackend->Ops.Finish((void *)(DevInst->IOInst));
 	if(RC != XAIE_OK) {
@@ -435,6 +742,10 @@ XAie_MemInst* XAie_MemAllocate(XAie_DevInst *DevInst, u64 Size,
 		return NULL;
 	}
 
+	if(DevInst->MemPool != NULL) {
+		return _XAie_MemPoolAllocate(DevInst, Size, Cache);
+	}
+
 	Backend = DevInst->Backend;
 
 	return Backend->Ops.MemAllocate(DevInst, Size, Cache);
@@ -461,6 +772,10 @@ AieRC XAie_MemFree(XAie_MemInst *MemInst)
 		return XAIE_ERR;
 	}
 
+	if(_XAie_MemPoolFree(MemInst) == XAIE_ENABLE) {
+		return XAIE_OK;
+	}
+
 	Backend = MemInst->DevInst->Backend;
 
 	return Backend->Ops.MemFree(MemInst);
@@ -518,6 +833,120 @@ AieRC XAie_MemSyncForDev(XAie_MemInst *MemInst)
 	return Backend->Ops.MemSyncForDev(MemInst);
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory function to sync ranges of memory buffers for CPU or for
+* device in one call.
+*
+* @param	Ranges: Array of ranges to sync.
+* @param	NumRanges: Number of ranges.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		All the buffers have to belong to the same device instance.
+*		Nothing is synced if a range is invalid. Backends without
+*		range cache maintenance sync the whole buffer of each range.
+*
+*******************************************************************************/
+AieRC XAie_MemSyncBatch(const XAie_MemSyncRange *Ranges, u32 NumRanges)
+{
+	const XAie_Backend *Backend;
+	AieRC RC;
+
+	if((Ranges == XAIE_NULL) || (NumRanges == 0U)) {
+		XAIE_ERROR("Invalid memory sync ranges\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumRanges; i++) {
+		const XAie_MemInst *MemInst = Ranges[i].MemInst;
+
+		if(MemInst == XAIE_NULL) {
+			XAIE_ERROR("Invalid memory instance\n");
+			return XAIE_ERR;
+		}
+
+		if(MemInst->DevInst != Ranges[0].MemInst->DevInst) {
+			XAIE_ERROR("Memory instances of different devices\n");
+			return XAIE_INVALID_ARGS;
+		}
+
+		if((Ranges[i].Size == 0U) ||
+				(Ranges[i].Offset > MemInst->Size) ||
+				(Ranges[i].Size > MemInst->Size -
+				 Ranges[i].Offset)) {
+			XAIE_ERROR("Invalid memory sync range 0x%lx, 0x%lx\n",
+					Ranges[i].Offset, Ranges[i].Size);
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	Backend = Ranges[0].MemInst->DevInst->Backend;
+	if(Backend->Ops.MemSyncRanges != NULL) {
+		return Backend->Ops.MemSyncRanges(Ranges, NumRanges);
+	}
+
+	for(u32 i = 0U; i < NumRanges; i++) {
+		if(Ranges[i].Dir == XAIE_MEM_SYNC_FOR_CPU) {
+			RC = Backend->Ops.MemSyncForCPU(Ranges[i].MemInst);
+		} else {
+			RC = Backend->Ops.MemSyncForDev(Ranges[i].MemInst);
+		}
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory function to sync a range of the memory for CPU
+*
+* @param	MemInst: Memory instance pointer.
+* @param	Offset: Offset of the range from the start of the buffer.
+* @param	Size: Size of the range in bytes.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Backends without range cache maintenance sync the whole
+*		buffer.
+*
+*******************************************************************************/
+AieRC XAie_MemSyncForCPURange(XAie_MemInst *MemInst, u64 Offset, u64 Size)
+{
+	XAie_MemSyncRange Range = {MemInst, Offset, Size,
+		XAIE_MEM_SYNC_FOR_CPU};
+
+	return XAie_MemSyncBatch(&Range, 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory function to sync a range of the memory for device
+*
+* @param	MemInst: Memory instance pointer.
+* @param	Offset: Offset of the range from the start of the buffer.
+* @param	Size: Size of the range in bytes.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Backends without range cache maintenance sync the whole
+*		buffer.
+*
+*******************************************************************************/
+AieRC XAie_MemSyncForDevRange(XAie_MemInst *MemInst, u64 Offset, u64 Size)
+{
+	XAie_MemSyncRange Range = {MemInst, Offset, Size,
+		XAIE_MEM_SYNC_FOR_DEV};
+
+	return XAie_MemSyncBatch(&Range, 1U);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -743,6 +1172,8 @@ AieRC XAie_TurnEccOn(XAie_DevInst *DevInst)
 * @param	DevInst - Device instance pointer.
 * @param	Flags - Flags passed by the user.
 *			XAIE_TRANSACTION_ENABLE/DISBALE_AUTO_FLUSH
+*			XAIE_TRANSACTION_ENABLE_OPTIMIZE
+*			XAIE_TRANSACTION_SHARE_PAYLOADS
 *
 * @return	XAIE_OK on success and error code on failure.
 *
@@ -754,6 +1185,20 @@ AieRC XAie_TurnEccOn(XAie_DevInst *DevInst)
 *		operation. In both cases, the user has to call
 *		XAie_SubmitTransaction API to flush all the pending IO
 *		operations stored in the command buffer.
+*		If the ENABLE_OPTIMIZE flag is set, back to back writes to the
+*		same register are folded into one write and consecutive
+*		register writes are merged into block writes before the
+*		commands are flushed or exported. It must not be used if the
+*		transaction writes the same register more than once for its
+*		side effects, such as pushing to a DMA queue.
+*		If the SHARE_PAYLOADS flag is set without auto flush, the
+*		block writes of buffers passed by the caller, such as the
+*		sections of XAie_LoadElfMem() and XAie_LoadElfSectionBlock()
+*		and the data of XAie_DataMemBlockWrite(), reference the
+*		buffers instead of copying them. The buffers must stay valid
+*		and unchanged until the transaction is submitted, or until
+*		the fence of an asynchronous submission is signalled.
+*		Exported transaction instances still get their own copy.
 *
 ******************************************************************************/
 AieRC XAie_StartTransaction(XAie_DevInst *DevInst, u32 Flags)
@@ -793,6 +1238,8 @@ AieRC XAie_SubmitTransaction(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
 		return XAIE_INVALID_ARGS;
 	}
 
+	XAIE_IO_STATS_CALLER();
+
 	return _XAie_Txn_Submit(DevInst, TxnInst);
 }
 
@@ -888,4 +1335,204 @@ AieRC XAie_UpdateNpiAddr(XAie_DevInst *DevInst, u64 NpiAddr)
 			(void *)&NpiAddr);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API enables or disables direct register access through a memory mapping
+* of the partition registers. When enabled, the backend writes the registers of
+* the AIE tiles and the memory tiles through the mapping instead of issuing a
+* system call per access. Registers which need the kernel to validate the
+* access, such as the SHIM tile and tile control registers, are still written
+* through the kernel.
+*
+* @param	DevInst - Global AIE device instance pointer.
+* @param	Enable - XAIE_ENABLE to enable the mapping, XAIE_DISABLE to
+*		disable it.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the backend
+*		or the kernel does not allow writable register mappings and
+*		error code on failure.
+*
+* @note		Only supported by the Linux backend. It is disabled by default.
+*
+******************************************************************************/
+AieRC XAie_ConfigRegMmap(XAie_DevInst *DevInst, u8 Enable)
+{
+	if((DevInst == NULL) || (DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_REG_MMAP,
+			(void *)&Enable);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures implicit write combining of register writes issued
+* outside of transactions. The backend buffers up to Depth writes and submits
+* them together, when the buffer is full or before any read, poll, memory
+* access or other backend operation, which keeps the order of the accesses.
+*
+* @param	DevInst - Global AIE device instance pointer.
+* @param	Depth - Number of writes to buffer. 0 disables write combining.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the backend
+*		does not support write combining and error code on failure.
+*
+* @note		Only supported by the Linux, socket and CDO backends. It is
+*		disabled by default.
+*		The CDO backend buffers up to Depth words of writes to
+*		consecutive addresses and emits them as one block write
+*		command.
+*		Errors of buffered writes are returned by the access which
+*		submits them. Use XAie_FlushWrites() before depending on
+*		the side effects of the writes without accessing the device.
+*
+******************************************************************************/
+AieRC XAie_ConfigWriteCombine(XAie_DevInst *DevInst, u32 Depth)
+{
+	if((DevInst == NULL) || (DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_WRITE_COMBINE,
+			(void *)&Depth);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API submits the register writes buffered by write combining.
+*
+* @param	DevInst - Global AIE device instance pointer.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_FlushWrites(XAie_DevInst *DevInst)
+{
+	if((DevInst == NULL) || (DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_FLUSH_WRITES, NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures how the backend polls registers, which is used by the
+* mask poll operations behind the DMA, core and lock wait APIs. Spinning and
+* short sleeps lower the latency of waits which complete quickly, while the
+* backoff strategy keeps the host CPU usage low for the long ones.
+*
+* @param	DevInst - Global AIE device instance pointer.
+* @param	Cfg - Pointer to the poll configuration.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the backend
+*		does not support poll configuration and error code on failure.
+*
+* @note		Supported by the Linux, metal, baremetal and socket backends.
+*		The default is XAIE_POLL_FIXED with a sleep of 200 us. The
+*		timeout of a poll is accounted in the time slept.
+*
+******************************************************************************/
+AieRC XAie_ConfigPoll(XAie_DevInst *DevInst, const XAie_PollCfg *Cfg)
+{
+	if((DevInst == NULL) || (DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Cfg == NULL) || (Cfg->Mode >= XAIE_POLL_MAX) ||
+			(Cfg->MaxSleepUs == 0U) ||
+			((Cfg->Mode == XAIE_POLL_BACKOFF) &&
+			 ((Cfg->MinSleepUs == 0U) ||
+			  (Cfg->MinSleepUs > Cfg->MaxSleepUs)))) {
+		XAIE_ERROR("Invalid poll configuration\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_POLL, (void *)Cfg);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures the cache of dmabuf attachments. With the cache, the
+* backend keeps a dmabuf attached after XAie_MemDetach(), and attaching the
+* same dmabuf again with XAie_MemAttach() reuses the attachment instead of
+* asking the kernel driver. The least recently detached dmabuf is detached
+* when the cache is full.
+*
+* @param	DevInst - Global AIE device instance pointer.
+* @param	NumEntries - Number of dmabufs the cache keeps attached. 0
+*		disables the cache.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the backend
+*		does not support the cache and error code on failure.
+*
+* @note		Only supported by the Linux backend. It is disabled by default.
+*		Reconfiguring the cache detaches the dmabufs it kept, and
+*		fails while dmabufs attached through it are not detached.
+*		The cache holds a duplicate of the dmabuf fd, so a cached
+*		dmabuf stays alive after the application closes its fd,
+*		until it is evicted or the cache is disabled.
+*
+******************************************************************************/
+AieRC XAie_ConfigMemAttachCache(XAie_DevInst *DevInst, u32 NumEntries)
+{
+	if((DevInst == NULL) || (DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_ATTACH_CACHE,
+			(void *)&NumEntries);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures whether the backend allocates the memory of
+* XAie_MemAllocate() from huge pages. Huge pages reduce the TLB misses of the
+* CPU in copy loops over large DMA buffers.
+*
+* @param	DevInst - Global AIE device instance pointer.
+* @param	Enable - XAIE_ENABLE to allocate from huge pages, XAIE_DISABLE
+*		to allocate from regular pages.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the backend
+*		does not support huge pages and error code on failure.
+*
+* @note		Only supported by the Linux backend, which allocates buffers
+*		as udmabuf dmabufs. It is disabled by default. Buffer sizes
+*		are rounded up to 2MB, and a buffer falls back to regular
+*		pages if no huge page is reserved. It applies to the buffers
+*		allocated after the call. The partition memories are mapped
+*		at huge page aligned addresses regardless of this setting.
+*
+******************************************************************************/
+AieRC XAie_ConfigHugePages(XAie_DevInst *DevInst, u8 Enable)
+{
+	if((DevInst == NULL) || (DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Enable > XAIE_ENABLE) {
+		XAIE_ERROR("Invalid huge pages setting\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_HUGE_PAGES,
+			(void *)&Enable);
+}
+
 /** @} */
@@ -51,6 +51,11 @@
 
 #define XAIE_TRANSACTION_ENABLE_AUTO_FLUSH	0b1U
 #define XAIE_TRANSACTION_DISABLE_AUTO_FLUSH	0b0U
+#define XAIE_TRANSACTION_ENABLE_OPTIMIZE	0b100U
+#define XAIE_TRANSACTION_SHARE_PAYLOADS		0b1000U
+
+#define XAIE_TXN_HASH_BITS		4U
+#define XAIE_TXN_HASH_SIZE		(1U << XAIE_TXN_HASH_BITS)
 
 #define XAIE_PART_INIT_OPT_COLUMN_RST		(1U << 0)
 #define XAIE_PART_INIT_OPT_SHIM_RST		(1U << 1)
@@ -62,6 +67,9 @@
 		XAIE_PART_INIT_OPT_BLOCK_NOCAXIMMERR | \
 		XAIE_PART_INIT_OPT_ISOLATE)
 
+/* Column groups of a partition raising their own error IRQ, one per NoC IRQ */
+#define XAIE_ERROR_MAX_IRQ_GROUPS	4U
+
 /**************************** Type Definitions *******************************/
 typedef struct XAie_TileMod XAie_TileMod;
 typedef struct XAie_DeviceOps XAie_DeviceOps;
@@ -69,6 +77,15 @@ typedef struct XAie_DmaMod XAie_DmaMod;
 typedef struct XAie_LockMod XAie_LockMod;
 typedef struct XAie_Backend XAie_Backend;
 typedef struct XAie_TxnCmd XAie_TxnCmd;
+typedef struct XAie_TxnInst XAie_TxnInst;
+typedef struct XAie_TxnArena XAie_TxnArena;
+typedef struct XAie_TxnQueue XAie_TxnQueue;
+typedef struct XAie_ShadowCache XAie_ShadowCache;
+typedef struct XAie_BdShadow XAie_BdShadow;
+typedef struct XAie_MemPool XAie_MemPool;
+typedef struct XAie_MemCkpt XAie_MemCkpt;
+typedef struct XAie_IOStatsInst XAie_IOStatsInst;
+typedef struct XAie_TxnMemo XAie_TxnMemo;
 typedef struct XAie_ResourceManager XAie_ResourceManager;
 
 /*
@@ -118,7 +135,15 @@ typedef struct XAie_List {
 
 /*
  * This typedef contains the attributes for an AIE partition. The structure is
- * setup during intialization.
+ * setup during intialization. All the mutable state of the driver for the
+ * partition is owned by the instance, so separate instances can be used from
+ * separate threads without locking. Threads may also configure different
+ * columns of the partition through the same instance concurrently: each thread
+ * has its own transaction buffer, and the transaction list, the resource
+ * manager, the shadow caches, the memory pool, the I/O statistics and the tile
+ * bitmaps are synchronized internally. Initialization, partition wide
+ * operations and XAie_Finish() must not run concurrently with other calls on
+ * the instance.
  */
 typedef struct {
 	u64 BaseAddr; /* Base address of the partition*/
@@ -132,6 +157,8 @@ typedef struct {
 	u8 AieTileNumRows;  /* Number of aie tile rows in the partition */
 	u8 IsReady;
 	u8 EccStatus;		/* Ecc On/Off status of the partition */
+	u8 NumErrIrqGroups;	/* Column groups with their own error IRQ,
+				 * 0 for one */
 	const XAie_Backend *Backend; /* Backend IO properties */
 	XAie_ResourceManager *RscMapping;
 	void *IOInst;	       /* IO Instance for the backend */
@@ -140,17 +167,34 @@ typedef struct {
 	XAie_DeviceOps *DevOps; /* Device level operations */
 	XAie_PartitionProp PartProp; /* Partition property */
 	XAie_List TxnList; /* Head of the list of txn buffers */
+	XAie_List TxnHash[XAIE_TXN_HASH_SIZE]; /* Txn buffers hashed by tid */
+	struct XAie_TxnLocks *TxnLocks; /* Locks of the txn list and hash */
+	u32 TxnGen; /* Generation of the txn list, renewed when it is freed */
+	XAie_TxnQueue *TxnQueue; /* Worker of asynchronous txn submissions */
+	XAie_TxnMemo *TxnMemo; /* Memoized configuration transactions */
+	XAie_ShadowCache *Shadow; /* Shadow cache of config registers */
+	XAie_BdShadow *BdShadow; /* Shadow of the programmed DMA BDs */
+	XAie_MemPool *MemPool; /* Pool of freed memory buffers */
+	XAie_MemCkpt *MemCkpt; /* Checkpoint tracking the data memory writes */
+	XAie_IOStatsInst *IOStats; /* Register access statistics */
+	u8 *TileTypes; /* Tile types of the partition by column and row */
+	u32 *TilesInUse; /* Bitmap of the tiles requested by the application */
+	u32 *MemInUse; /* Bitmap of the memory modules in use */
+	u32 *CoreInUse; /* Bitmap of the core modules in use */
 } XAie_DevInst;
 
 /* typedef to capture transaction buffer data */
-typedef struct {
+struct XAie_TxnInst {
 	u64 Tid;
 	u32 Flags;
 	u32 NumCmds;
 	u32 MaxCmds;
+	u8 StartCol; /* Column the recorded commands are placed at */
 	XAie_TxnCmd *CmdBuf;
+	XAie_TxnArena *Arena; /* Storage of block write payloads */
 	XAie_List Node;
-} XAie_TxnInst;
+	XAie_List HashNode;
+};
 
 /* enum to capture cache property of allocate memory */
 typedef enum {
@@ -168,6 +212,20 @@ typedef struct {
 	void *BackendHandle; /* Backend specific properties */
 } XAie_MemInst;
 
+/* enum to capture the direction of a memory sync */
+typedef enum {
+	XAIE_MEM_SYNC_FOR_CPU,
+	XAIE_MEM_SYNC_FOR_DEV
+} XAie_MemSyncDir;
+
+/* typedef to capture a range of a memory buffer to sync */
+typedef struct {
+	XAie_MemInst *MemInst;
+	u64 Offset; /* Offset of the range from the start of the buffer */
+	u64 Size; /* Size of the range in bytes */
+	XAie_MemSyncDir Dir;
+} XAie_MemSyncRange;
+
 typedef struct {
 	u8 AieGen;
 	u64 BaseAddr;
@@ -491,12 +549,46 @@ typedef struct {
 	u32 ErrorCount;
 } XAie_ErrorMetaData;
 
+/* Enum to capture the strategies of polling a register */
+typedef enum {
+	XAIE_POLL_FIXED,	/* Sleep MaxSleepUs between the reads */
+	XAIE_POLL_SPIN_SLEEP,	/* Spin SpinCount reads, then poll fixed */
+	XAIE_POLL_BACKOFF,	/* Spin SpinCount reads, then sleep from
+				   MinSleepUs doubling up to MaxSleepUs */
+	XAIE_POLL_MAX,
+} XAie_PollMode;
+
+/*
+ * Data structure to capture the configuration of register polling.
+ * Mode: Polling strategy.
+ * SpinCount: Number of reads without sleeping before the first sleep.
+ * MinSleepUs: First sleep of the backoff strategy in microseconds.
+ * MaxSleepUs: Longest sleep between two reads in microseconds.
+ */
+typedef struct {
+	XAie_PollMode Mode;
+	u32 SpinCount;
+	u32 MinSleepUs;
+	u32 MaxSleepUs;
+} XAie_PollCfg;
+
 /**************************** Function prototypes ***************************/
 AieRC XAie_SetupPartitionConfig(XAie_DevInst *DevInst,
 		u64 PartBaseAddr, u8 PartStartCol, u8 PartNumCols);
 AieRC XAie_CfgInitialize(XAie_DevInst *InstPtr, XAie_Config *ConfigPtr);
 AieRC XAie_PartitionInitialize(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts);
 AieRC XAie_PartitionTeardown(XAie_DevInst *DevInst);
+AieRC XAie_PartitionTeardownTiles(XAie_DevInst *DevInst,
+		const u32 *UsedTiles);
+AieRC XAie_SetErrorIrqGroups(XAie_DevInst *DevInst, u8 NumGroups);
+AieRC XAie_PartitionInitializeCapture(XAie_DevInst *DevInst,
+		XAie_PartInitOpts *Opts, void *Buf, u64 *Size);
+AieRC XAie_PartitionInitializeReplay(XAie_DevInst *DevInst, const void *Buf,
+		u64 Size);
+AieRC XAie_PartitionGateColumns(XAie_DevInst *DevInst, u32 StartCol,
+		u32 NumCols);
+AieRC XAie_PartitionUngateColumns(XAie_DevInst *DevInst, u32 StartCol,
+		u32 NumCols);
 AieRC XAie_Finish(XAie_DevInst *DevInst);
 AieRC XAie_SetIOBackend(XAie_DevInst *DevInst, XAie_BackendType Backend);
 XAie_MemInst* XAie_MemAllocate(XAie_DevInst *DevInst, u64 Size,
@@ -504,6 +596,9 @@ XAie_MemInst* XAie_MemAllocate(XAie_DevInst *DevInst, u64 Size,
 AieRC XAie_MemFree(XAie_MemInst *MemInst);
 AieRC XAie_MemSyncForCPU(XAie_MemInst *MemInst);
 AieRC XAie_MemSyncForDev(XAie_MemInst *MemInst);
+AieRC XAie_MemSyncForCPURange(XAie_MemInst *MemInst, u64 Offset, u64 Size);
+AieRC XAie_MemSyncForDevRange(XAie_MemInst *MemInst, u64 Offset, u64 Size);
+AieRC XAie_MemSyncBatch(const XAie_MemSyncRange *Ranges, u32 NumRanges);
 void* XAie_MemGetVAddr(XAie_MemInst *MemInst);
 u64 XAie_MemGetDevAddr(XAie_MemInst *MemInst);
 AieRC XAie_MemAttach(XAie_DevInst *DevInst, XAie_MemInst *MemInst, u64 DAddr,
@@ -517,6 +612,12 @@ XAie_TxnInst* XAie_ExportTransactionInstance(XAie_DevInst *DevInst);
 AieRC XAie_FreeTransactionInstance(XAie_TxnInst *TxnInst);
 AieRC XAie_IsDeviceCheckerboard(XAie_DevInst *DevInst, u8 *IsCheckerBoard);
 AieRC XAie_UpdateNpiAddr(XAie_DevInst *DevInst, u64 NpiAddr);
+AieRC XAie_ConfigRegMmap(XAie_DevInst *DevInst, u8 Enable);
+AieRC XAie_ConfigWriteCombine(XAie_DevInst *DevInst, u32 Depth);
+AieRC XAie_FlushWrites(XAie_DevInst *DevInst);
+AieRC XAie_ConfigPoll(XAie_DevInst *DevInst, const XAie_PollCfg *Cfg);
+AieRC XAie_ConfigMemAttachCache(XAie_DevInst *DevInst, u32 NumEntries);
+AieRC XAie_ConfigHugePages(XAie_DevInst *DevInst, u8 Enable);
 /*****************************************************************************/
 /*
 *
@@ -579,6 +680,49 @@ static inline XAie_LocType XAie_TileLoc(u8 col, u8 row)
 	return Loc;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API returns the error interrupt group of a column of the partition. The
+* columns are split into contiguous groups of about the same size, as set with
+* XAie_SetErrorIrqGroups().
+*
+* @param	DevInst: Device Instance
+* @param	Col: Column, relative to the partition
+*
+* @return	Group of the column, 0 if the partition has a single group.
+*
+* @note		The errors of a column are raised on the IRQ of the group of
+*		the NoC tile whose second level controller collects them.
+*
+******************************************************************************/
+static inline u8 XAie_ErrorIrqGroup(const XAie_DevInst *DevInst, u8 Col)
+{
+	if((DevInst->NumErrIrqGroups <= 1U) || (Col >= DevInst->NumCols))
+		return 0U;
+
+	return (u8)(((u32)Col * DevInst->NumErrIrqGroups) / DevInst->NumCols);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the NoC IRQ on which the error interrupts of a group are
+* raised.
+*
+* @param	Group: Error interrupt group
+*
+* @return	NoC IRQ ID of the group.
+*
+* @note		Group 0 keeps NoC IRQ 1, the error IRQ of a partition with a
+*		single group.
+*
+******************************************************************************/
+static inline u8 XAie_ErrorIrqGroupIrqId(u8 Group)
+{
+	return (u8)((1U + Group) % XAIE_ERROR_MAX_IRQ_GROUPS);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -673,6 +817,54 @@ static inline void XAie_SetupConfigPartProp(XAie_Config *ConfigPtr, u32 Nid,
 *******************************************************************************/
 #define XAie_InstDeclare(Inst, ConfigPtr) XAie_DevInst Inst = { 0 }
 
+#ifdef XAIE_DEV_STATIC
+/*****************************************************************************/
+/**
+*
+* Macro to setup the configuration of the device the driver is built for with
+* XAIE_DEV_STATIC.
+*
+* @param	Config: XAie_Config structure.
+*
+* @return	None.
+*
+* @note		The macro declares it XAie_Config as a stack variable.
+*
+*******************************************************************************/
+#define XAie_SetupStaticConfig(Config) \
+	XAie_SetupConfig(Config, XAIE_DEV_SINGLE_GEN, \
+			XAIE_DEV_STATIC_BASE_ADDR, XAIE_DEV_STATIC_COL_SHIFT, \
+			XAIE_DEV_STATIC_ROW_SHIFT, \
+			XAIE_DEV_STATIC_DEV_NUM_COLS, \
+			XAIE_DEV_STATIC_NUM_ROWS, XAIE_DEV_STATIC_SHIM_ROW, \
+			XAIE_DEV_STATIC_MEM_TILE_ROW_START, \
+			XAIE_DEV_STATIC_MEM_TILE_NUM_ROWS, \
+			XAIE_DEV_STATIC_AIE_TILE_ROW_START, \
+			XAIE_DEV_STATIC_AIE_TILE_NUM_ROWS)
+
+/*****************************************************************************/
+/**
+*
+* Macro to declare the device instance of the partition the driver is built
+* for with XAIE_DEV_STATIC. The instance is initialized with
+* XAie_CfgInitialize() and the config of XAie_SetupStaticConfig(), which does
+* not build the tile type table of the partition.
+*
+* @param	Inst: Name of the Device Instance variable.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+#define XAie_StaticInstDeclare(Inst) \
+	XAie_DevInst Inst = { \
+		.BaseAddr = XAIE_DEV_STATIC_PART_BASE_ADDR, \
+		.StartCol = XAIE_DEV_STATIC_START_COL, \
+		.NumCols = XAIE_DEV_STATIC_NUM_COLS, \
+	}
+#endif /* XAIE_DEV_STATIC */
+
 /*****************************************************************************/
 /**
 *
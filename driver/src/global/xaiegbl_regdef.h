@@ -246,6 +246,9 @@ typedef struct XAie_CoreMod {
 			u8 *DoneBit, const struct XAie_CoreMod *CoreMod);
 	AieRC (*Enable)(XAie_DevInst *DevInst, XAie_LocType Loc,
 			const struct XAie_CoreMod *CoreMod);
+	void (*DoneStatus)(XAie_DevInst *DevInst, XAie_LocType Loc,
+			const struct XAie_CoreMod *CoreMod, u64 *Addr,
+			u32 *Mask, u32 *Value);
 } XAie_CoreMod;
 
 /*
@@ -520,12 +523,18 @@ struct XAie_DmaMod {
 			u8 IterCurr);
 	AieRC (*WriteBd)(XAie_DevInst *DevInst, XAie_DmaDesc *Desc,
 			XAie_LocType Loc, u8 BdNum);
+	AieRC (*EncodeBd)(XAie_DevInst *DevInst, XAie_DmaDesc *Desc,
+			u32 *BdWord, u8 *NumWords);
 	AieRC (*PendingBd)(XAie_DevInst *DevInst, XAie_LocType Loc,
 			const XAie_DmaMod *DmaMod, u8 ChNum,
 			XAie_DmaDirection Dir, u8 *PendingBd);
 	AieRC (*WaitforDone)(XAie_DevInst *DevINst, XAie_LocType Loc,
 			const XAie_DmaMod *DmaMod, u8 ChNum,
 			XAie_DmaDirection Dir, u32 TimeOutUs);
+	void (*DoneStatus)(XAie_DevInst *DevInst, XAie_LocType Loc,
+			const XAie_DmaMod *DmaMod, u8 ChNum,
+			XAie_DmaDirection Dir, u64 *Addr, u32 *Mask,
+			u32 *Value);
 	AieRC (*BdChValidity)(u8 BdNum, u8 ChNum);
 	AieRC (*UpdateBdLen)(XAie_DevInst *DevInst, const XAie_DmaMod *DmaMod,
 			XAie_LocType Loc, u32 Len, u8 BdNum);
@@ -540,6 +549,7 @@ typedef struct {
 	u32 Size;
 	u32 MemAddr;
 	u32 EccEvntRegOff;
+	u8 NumBanks;
 } XAie_MemMod;
 
 /*
@@ -621,6 +631,12 @@ struct XAie_LockMod {
 	u32 LockSetValBase;	/* Base address of the register to set lock value */
 	u32 LockSetValOff;	/* Offset between lock set value registers */
 	const XAie_RegFldAttr *LockInit; /* Lock intialization reg attributes */
+	u8  NumEventSels;	/* Number of lock event selections, 0 if the
+				 * lock events are not selectable */
+	u32 EventSelBase;	/* Base address of lock event selections */
+	u32 EventSelOff;	/* Offset between lock event selections */
+	const XAie_RegFldAttr *EventSelLock; /* Lock of an event selection */
+	const XAie_RegFldAttr *EventSelValue; /* Value of an event selection */
 	AieRC (*Acquire)(XAie_DevInst *DevInst,
 			const struct XAie_LockMod *LockMod, XAie_LocType Loc,
 			XAie_Lock Lock, u32 TimeOut);
@@ -755,6 +771,7 @@ typedef struct XAie_L1IntrMod {
 	u32 BaseIrqEventMask;
 	u32 BaseBroadcastBlockRegOff;
 	u32 BaseBroadcastUnblockRegOff;
+	u32 BaseStatusRegOff;
 	u8 SwOff;
 	u8 NumIntrIds;
 	u8 NumIrqEvents;
@@ -773,6 +790,7 @@ typedef struct XAie_L2IntrMod {
 	u32 EnableRegOff;
 	u32 DisableRegOff;
 	u32 IrqRegOff;
+	u32 StatusRegOff;
 	u8 NumBroadcastIds;
 	u8 NumNoCIntr;
 } XAie_L2IntrMod;
@@ -801,7 +819,16 @@ typedef struct XAie_MemCtrlMod{
  * This structure captures all attributes related to resource manager.
  */
 struct XAie_ResourceManager {
+	void *Mem;		/* Allocation holding the fields below but the
+				 * locks, or only the bitmap pointers once the
+				 * state is shared */
 	u32 **Bitmaps;
+	struct XAie_RscMgrLocks *Locks;	/* Locks of the bitmaps */
+	u32 *BcChannelUsers;	/* Set bits of each broadcast channel in the
+				 * runtime and static broadcast bitmaps */
+	u8 *Policies;		/* Allocation policy of each resource type */
+	void *Shm;		/* Shared memory holding the state, if any */
+	u8 IsShmOwner;		/* Shared memory created by this instance */
 };
 
 /*
@@ -829,14 +856,11 @@ struct XAie_TileMod {
 
 struct XAie_DeviceOps {
 	u8 IsCheckerBoard;
-	u32 *TilesInUse;
-	u32 *MemInUse;
-	u32 *CoreInUse;
 	u8 (*GetTTypefromLoc)(XAie_DevInst *DevInst, XAie_LocType Loc);
 	AieRC (*SetPartColShimReset)(XAie_DevInst *DevInst, u8 Enable);
 	AieRC (*SetPartColClockAfterRst)(XAie_DevInst *DevInst, u8 Enable);
 	AieRC (*SetPartIsolationAfterRst)(XAie_DevInst *DevInst);
-	AieRC (*PartMemZeroInit)(XAie_DevInst *DevInst);
+	AieRC (*PartMemZeroInit)(XAie_DevInst *DevInst, const u32 *UsedTiles);
 	AieRC (*RequestTiles)(XAie_DevInst *DevInst,
 			XAie_BackendTilesArray *Args);
 };
@@ -66,18 +66,15 @@
 #include "xaiegbl_regdef.h"
 #include "xaiegbl_params.h"
 
+#ifdef XAIE_DEV_AIE_ENABLE
+
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
 
 /**************************** Macro Definitions ******************************/
-#define XAIE_TILES_BITMAPSIZE	32U
 
 /************************** Variable Definitions *****************************/
-/* bitmaps to capture modules being used by the application */
-static u32 AieTilesInUse[XAIE_TILES_BITMAPSIZE];
-static u32 AieMemInUse[XAIE_TILES_BITMAPSIZE];
-static u32 AieCoreInUse[XAIE_TILES_BITMAPSIZE];
 
 #ifdef XAIE_FEATURE_CORE_ENABLE
 /*
@@ -1134,6 +1131,7 @@ static const XAie_CoreMod AieCoreMod =
 	.Enable = &_XAie_CoreEnable,
 	.WaitForDone = &_XAie_CoreWaitForDone,
 	.ReadDoneBit = &_XAie_CoreReadDoneBit,
+	.DoneStatus = &_XAie_CoreGetDoneStatus,
 };
 #endif /* XAIE_FEATURE_CORE_ENABLE */
 
@@ -1144,6 +1142,7 @@ static const XAie_MemMod AieTileMemMod =
 	.Size = 32 * 1024,
 	.MemAddr = XAIEGBL_MEM_DATMEM,
 	.EccEvntRegOff = 0x00012110,
+	.NumBanks = 8U,
 };
 #endif /* XAIE_FEATURE_DATAMEM_ENABLE */
 
@@ -1478,8 +1477,10 @@ static const XAie_DmaMod AieTileDmaMod =
 	.SetMultiDim = &_XAie_DmaSetMultiDim,
 	.SetBdIter = &_XAie_DmaSetBdIteration,
 	.WriteBd = &_XAie_TileDmaWriteBd,
+	.EncodeBd = &_XAie_TileDmaEncodeBd,
 	.PendingBd = &_XAie_DmaGetPendingBdCount,
 	.WaitforDone = &_XAie_DmaWaitForDone,
+	.DoneStatus = &_XAie_DmaGetDoneStatus,
 	.BdChValidity = &_XAie_DmaCheckBdChValidity,
 	.UpdateBdLen = &_XAie_DmaUpdateBdLen,
 	.UpdateBdAddr = &_XAie_DmaUpdateBdAddr,
@@ -1680,8 +1681,10 @@ static const XAie_DmaMod AieShimDmaMod =
 	.SetMultiDim = NULL,
 	.SetBdIter = &_XAie_DmaSetBdIteration,
 	.WriteBd = &_XAie_ShimDmaWriteBd,
+	.EncodeBd = &_XAie_ShimDmaEncodeBd,
 	.PendingBd = &_XAie_DmaGetPendingBdCount,
 	.WaitforDone = &_XAie_DmaWaitForDone,
+	.DoneStatus = &_XAie_DmaGetDoneStatus,
 	.BdChValidity = &_XAie_DmaCheckBdChValidity,
 	.UpdateBdLen = &_XAie_ShimDmaUpdateBdLen,
 	.UpdateBdAddr = &_XAie_ShimDmaUpdateBdAddr,
@@ -3037,6 +3040,7 @@ static const XAie_L1IntrMod AiePlL1IntrMod =
 	.BaseIrqEventMask = XAIEGBL_PL_INTCON1STLEVIRQEVTA_IRQEVT0_MASK,
 	.BaseBroadcastBlockRegOff = XAIEGBL_PL_INTCON1STLEVBLKNORINASET,
 	.BaseBroadcastUnblockRegOff = XAIEGBL_PL_INTCON1STLEVBLKNORINACLR,
+	.BaseStatusRegOff = XAIEGBL_PL_INTCON1STLEVSTAA,
 	.SwOff = 0x30U,
 	.NumIntrIds = 20U,
 	.NumIrqEvents = 4U,
@@ -3061,6 +3065,7 @@ static const XAie_L2IntrMod AieNoCL2IntrMod =
 	.EnableRegOff = XAIEGBL_NOC_INTCON2NDLEVENA,
 	.DisableRegOff = XAIEGBL_NOC_INTCON2NDLEVDIS,
 	.IrqRegOff = XAIEGBL_NOC_INTCON2NDLEVINT,
+	.StatusRegOff = XAIEGBL_NOC_INTCON2NDLEVSTA,
 	.NumBroadcastIds = 16U,
 	.NumNoCIntr = 4U,
 };
@@ -3283,9 +3288,6 @@ XAie_TileMod AieMod[] =
 XAie_DeviceOps AieDevOps =
 {
 	.IsCheckerBoard = 1,
-	.TilesInUse = AieTilesInUse,
-	.MemInUse = AieMemInUse,
-	.CoreInUse = AieCoreInUse,
 	.GetTTypefromLoc = &_XAie_GetTTypefromLoc,
 #ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
 	.SetPartColShimReset = &_XAie_SetPartColShimReset,
@@ -3302,4 +3304,6 @@ XAie_DeviceOps AieDevOps =
 #endif
 };
 
+#endif /* XAIE_DEV_AIE_ENABLE */
+
 /** @} */
@@ -69,18 +69,15 @@
 #include "xaiegbl_regdef.h"
 #include "xaiemlgbl_params.h"
 
+#ifdef XAIE_DEV_AIEML_ENABLE
+
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
 
 /**************************** Macro Definitions ******************************/
-#define XAIEML_TILES_BITMAPSIZE	32U
 
 /************************** Variable Definitions *****************************/
-/* bitmaps to capture modules being used by the application */
-static u32 AieMlTilesInUse[XAIEML_TILES_BITMAPSIZE];
-static u32 AieMlMemInUse[XAIEML_TILES_BITMAPSIZE];
-static u32 AieMlCoreInUse[XAIEML_TILES_BITMAPSIZE];
 
 #ifdef XAIE_FEATURE_CORE_ENABLE
 /*
@@ -414,8 +411,10 @@ static const  XAie_DmaMod AieMlMemTileDmaMod =
 	.SetMultiDim = &_XAieMl_DmaSetMultiDim,
 	.SetBdIter = &_XAieMl_DmaSetBdIteration,
 	.WriteBd = &_XAieMl_MemTileDmaWriteBd,
+	.EncodeBd = &_XAieMl_MemTileDmaEncodeBd,
 	.PendingBd = &_XAieMl_DmaGetPendingBdCount,
 	.WaitforDone = &_XAieMl_DmaWaitForDone,
+	.DoneStatus = &_XAieMl_DmaGetDoneStatus,
 	.BdChValidity = &_XAieMl_MemTileDmaCheckBdChValidity,
 	.UpdateBdLen = &_XAieMl_DmaUpdateBdLen,
 	.UpdateBdAddr = &_XAieMl_DmaUpdateBdAddr,
@@ -643,8 +642,10 @@ static const  XAie_DmaMod AieMlTileDmaMod =
 	.SetMultiDim = &_XAieMl_DmaSetMultiDim,
 	.SetBdIter = &_XAieMl_DmaSetBdIteration,
 	.WriteBd = &_XAieMl_TileDmaWriteBd,
+	.EncodeBd = &_XAieMl_TileDmaEncodeBd,
 	.PendingBd = &_XAieMl_DmaGetPendingBdCount,
 	.WaitforDone = &_XAieMl_DmaWaitForDone,
+	.DoneStatus = &_XAieMl_DmaGetDoneStatus,
 	.BdChValidity = &_XAieMl_DmaCheckBdChValidity,
 	.UpdateBdLen = &_XAieMl_DmaUpdateBdLen,
 	.UpdateBdAddr = &_XAieMl_DmaUpdateBdAddr,
@@ -887,8 +888,10 @@ static const  XAie_DmaMod AieMlShimDmaMod =
 	.SetMultiDim = &_XAieMl_DmaSetMultiDim,
 	.SetBdIter = &_XAieMl_DmaSetBdIteration,
 	.WriteBd = &_XAieMl_ShimDmaWriteBd,
+	.EncodeBd = &_XAieMl_ShimDmaEncodeBd,
 	.PendingBd = &_XAieMl_DmaGetPendingBdCount,
 	.WaitforDone = &_XAieMl_DmaWaitForDone,
+	.DoneStatus = &_XAieMl_DmaGetDoneStatus,
 	.BdChValidity = &_XAieMl_DmaCheckBdChValidity,
 	.UpdateBdLen = &_XAieMl_ShimDmaUpdateBdLen,
 	.UpdateBdAddr = &_XAieMl_ShimDmaUpdateBdAddr,
@@ -2254,6 +2257,7 @@ static const  XAie_CoreMod AieMlCoreMod =
 	.DataMemSize = 64 * 1024,		/* AIEML Tile Memory is 64kB */
 	.DataMemShift = 16,
 	.EccEvntRegOff = XAIEMLGBL_CORE_MODULE_ECC_SCRUBBING_EVENT,
+	.CorePCOff = XAIEMLGBL_CORE_MODULE_CORE_PC,
 	.CoreCtrl = &AieMlCoreCtrlReg,
 	.CoreDebugStatus = &AieMlCoreDebugStatus,
 	.CoreSts = &AieMlCoreStsReg,
@@ -2265,6 +2269,7 @@ static const  XAie_CoreMod AieMlCoreMod =
 	.Enable = &_XAieMl_CoreEnable,
 	.WaitForDone = &_XAieMl_CoreWaitForDone,
 	.ReadDoneBit = &_XAieMl_CoreReadDoneBit,
+	.DoneStatus = &_XAieMl_CoreGetDoneStatus,
 };
 #endif /* XAIE_FEATURE_CORE_ENABLE */
 
@@ -2275,6 +2280,7 @@ static const  XAie_MemMod AieMlTileMemMod =
 	.Size = 0x10000,
 	.MemAddr = XAIEMLGBL_MEMORY_MODULE_DATAMEMORY,
 	.EccEvntRegOff = XAIEMLGBL_MEMORY_MODULE_ECC_SCRUBBING_EVENT,
+	.NumBanks = 8U,
 };
 
 /* Data Memory Module for Mem Tile data memory*/
@@ -2283,6 +2289,7 @@ static const  XAie_MemMod AieMlMemTileMemMod =
 	.Size = 0x80000,
 	.MemAddr = XAIEMLGBL_MEM_TILE_MODULE_DATAMEMORY,
 	.EccEvntRegOff = XAIEMLGBL_MEM_TILE_MODULE_ECC_SCRUBBING_EVENT,
+	.NumBanks = 16U,
 };
 #endif /* XAIE_FEATURE_DATAMEM_ENABLE */
 
@@ -2354,6 +2361,18 @@ static const  XAie_PlIfMod AieMlShimTilePlIfMod =
 #endif /* XAIE_FEATURE_PL_ENABLE */
 
 #ifdef XAIE_FEATURE_LOCK_ENABLE
+static const XAie_RegFldAttr AieMlTileLockEventSelLock =
+{
+	.Lsb = XAIEMLGBL_MEMORY_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_SELECT_LSB,
+	.Mask = XAIEMLGBL_MEMORY_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_SELECT_MASK,
+};
+
+static const XAie_RegFldAttr AieMlTileLockEventSelValue =
+{
+	.Lsb = XAIEMLGBL_MEMORY_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_VALUE_LSB,
+	.Mask = XAIEMLGBL_MEMORY_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_VALUE_MASK,
+};
+
 static const XAie_RegFldAttr AieMlTileLockInit =
 {
 	.Lsb = XAIEMLGBL_MEMORY_MODULE_LOCK0_VALUE_LOCK_VALUE_LSB,
@@ -2373,11 +2392,28 @@ static const  XAie_LockMod AieMlTileLockMod =
 	.LockSetValBase = XAIEMLGBL_MEMORY_MODULE_LOCK0_VALUE,
 	.LockSetValOff = 0x10,
 	.LockInit = &AieMlTileLockInit,
+	.NumEventSels = 8U,
+	.EventSelBase = XAIEMLGBL_MEMORY_MODULE_LOCKS_EVENT_SELECTION_0,
+	.EventSelOff = 0x4,
+	.EventSelLock = &AieMlTileLockEventSelLock,
+	.EventSelValue = &AieMlTileLockEventSelValue,
 	.Acquire = &_XAieMl_LockAcquire,
 	.Release = &_XAieMl_LockRelease,
 	.SetValue = &_XAieMl_LockSetValue,
 };
 
+static const XAie_RegFldAttr AieMlShimNocLockEventSelLock =
+{
+	.Lsb = XAIEMLGBL_NOC_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_SELECT_LSB,
+	.Mask = XAIEMLGBL_NOC_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_SELECT_MASK,
+};
+
+static const XAie_RegFldAttr AieMlShimNocLockEventSelValue =
+{
+	.Lsb = XAIEMLGBL_NOC_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_VALUE_LSB,
+	.Mask = XAIEMLGBL_NOC_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_VALUE_MASK,
+};
+
 static const XAie_RegFldAttr AieMlShimNocLockInit =
 {
 	.Lsb = XAIEMLGBL_NOC_MODULE_LOCK0_VALUE_LOCK_VALUE_LSB,
@@ -2397,11 +2433,28 @@ static const  XAie_LockMod AieMlShimNocLockMod =
 	.LockSetValBase = XAIEMLGBL_NOC_MODULE_LOCK0_VALUE,
 	.LockSetValOff = 0x10,
 	.LockInit = &AieMlShimNocLockInit,
+	.NumEventSels = 6U,
+	.EventSelBase = XAIEMLGBL_NOC_MODULE_LOCKS_EVENT_SELECTION_0,
+	.EventSelOff = 0x4,
+	.EventSelLock = &AieMlShimNocLockEventSelLock,
+	.EventSelValue = &AieMlShimNocLockEventSelValue,
 	.Acquire = &_XAieMl_LockAcquire,
 	.Release = &_XAieMl_LockRelease,
 	.SetValue = &_XAieMl_LockSetValue,
 };
 
+static const XAie_RegFldAttr AieMlMemTileLockEventSelLock =
+{
+	.Lsb = XAIEMLGBL_MEM_TILE_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_SELECT_LSB,
+	.Mask = XAIEMLGBL_MEM_TILE_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_SELECT_MASK,
+};
+
+static const XAie_RegFldAttr AieMlMemTileLockEventSelValue =
+{
+	.Lsb = XAIEMLGBL_MEM_TILE_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_VALUE_LSB,
+	.Mask = XAIEMLGBL_MEM_TILE_MODULE_LOCKS_EVENT_SELECTION_0_LOCK_VALUE_MASK,
+};
+
 static const XAie_RegFldAttr AieMlMemTileLockInit =
 {
 	.Lsb = XAIEMLGBL_MEM_TILE_MODULE_LOCK0_VALUE_LOCK_VALUE_LSB,
@@ -2421,6 +2474,11 @@ static const  XAie_LockMod AieMlMemTileLockMod =
 	.LockSetValBase = XAIEMLGBL_MEM_TILE_MODULE_LOCK0_VALUE,
 	.LockSetValOff = 0x10,
 	.LockInit = &AieMlMemTileLockInit,
+	.NumEventSels = 8U,
+	.EventSelBase = XAIEMLGBL_MEM_TILE_MODULE_LOCKS_EVENT_SELECTION_0,
+	.EventSelOff = 0x4,
+	.EventSelLock = &AieMlMemTileLockEventSelLock,
+	.EventSelValue = &AieMlMemTileLockEventSelValue,
 	.Acquire = &_XAieMl_LockAcquire,
 	.Release = &_XAieMl_LockRelease,
 	.SetValue = &_XAieMl_LockSetValue,
@@ -4122,6 +4180,7 @@ static const XAie_L1IntrMod AieMlPlL1IntrMod =
 	.BaseIrqEventMask = XAIEMLGBL_PL_MODULE_INTERRUPT_CONTROLLER_1ST_LEVEL_IRQ_EVENT_A_IRQ_EVENT0_MASK,
 	.BaseBroadcastBlockRegOff = XAIEMLGBL_PL_MODULE_INTERRUPT_CONTROLLER_1ST_LEVEL_BLOCK_NORTH_IN_A_SET,
 	.BaseBroadcastUnblockRegOff = XAIEMLGBL_PL_MODULE_INTERRUPT_CONTROLLER_1ST_LEVEL_BLOCK_NORTH_IN_A_CLEAR,
+	.BaseStatusRegOff = XAIEMLGBL_PL_MODULE_INTERRUPT_CONTROLLER_1ST_LEVEL_STATUS_A,
 	.SwOff = 0x30U,
 	.NumIntrIds = 20U,
 	.NumIrqEvents = 4U,
@@ -4146,6 +4205,7 @@ static const XAie_L2IntrMod AieMlNoCL2IntrMod =
 	.EnableRegOff = XAIEMLGBL_NOC_MODULE_INTERRUPT_CONTROLLER_2ND_LEVEL_ENABLE,
 	.DisableRegOff = XAIEMLGBL_NOC_MODULE_INTERRUPT_CONTROLLER_2ND_LEVEL_DISABLE,
 	.IrqRegOff = XAIEMLGBL_NOC_MODULE_INTERRUPT_CONTROLLER_2ND_LEVEL_INTERRUPT,
+	.StatusRegOff = XAIEMLGBL_NOC_MODULE_INTERRUPT_CONTROLLER_2ND_LEVEL_STATUS,
 	.NumBroadcastIds = 16U,
 	.NumNoCIntr = 4U,
 };
@@ -4423,9 +4483,6 @@ XAie_TileMod AieMlMod[] =
 XAie_DeviceOps AieMlDevOps =
 {
 	.IsCheckerBoard = 0U,
-	.TilesInUse = AieMlTilesInUse,
-	.MemInUse = AieMlMemInUse,
-	.CoreInUse = AieMlCoreInUse,
 	.GetTTypefromLoc = &_XAieMl_GetTTypefromLoc,
 #ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
 	.SetPartColShimReset = &_XAieMl_SetPartColShimReset,
@@ -4442,4 +4499,6 @@ XAie_DeviceOps AieMlDevOps =
 #endif
 };
 
+#endif /* XAIE_DEV_AIEML_ENABLE */
+
 /** @} */
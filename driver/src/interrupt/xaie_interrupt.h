@@ -29,6 +29,7 @@
 
 /***************************** Include Files *********************************/
 #include "xaie_events.h"
+#include "xaie_timer.h"
 
 /**************************** Type Definitions *******************************/
 #define XAIE_ERROR_BROADCAST_ID			0x0U
@@ -38,6 +39,79 @@
 #define XAIE_ERROR_NPI_INTR_ID			0x1U
 #define XAIE_ERROR_L2_ENABLE			0x3FU
 
+/* Occurrences of one error, counted by an error aggregation */
+typedef struct {
+	XAie_LocType Loc;
+	u8 Module;
+	u8 EventId;
+	u32 Count;
+} XAie_ErrorCount;
+
+/*
+ * Aggregation of backtracked errors into per tile, module and event counters,
+ * with a limit on the errors per period after which error interrupts are
+ * suppressed until the next period. Owned by the caller, set up by
+ * XAie_ErrorAggrInit().
+ */
+typedef struct {
+	XAie_ErrorCount *Entries;	/* Hash table of counters */
+	u32 NumEntries;			/* Power of two */
+	u32 NumDistinct;		/* Counters in use */
+	u32 NumErrors;			/* Errors counted since the last flush */
+	u32 NumDropped;			/* Errors not counted, table full */
+	u32 MaxErrorsPerPeriod;		/* 0 for no limit */
+	u32 PeriodErrors;		/* Errors in the current period */
+	u32 NumSuppressed;		/* Periods which suppressed interrupts */
+	u8 Suppressed;			/* Interrupts suppressed in this period */
+} XAie_ErrorAggr;
+
+/*
+ * Callback of an error dispatcher. It is called with the errors backtracked
+ * for one notification, at most PayloadSize of them per call.
+ */
+typedef void (*XAie_ErrorCallback)(void *Arg, const XAie_ErrorPayload *Payload,
+		u32 NumErrors);
+
+/*
+ * Dispatcher of AIE error interrupts. It waits for error notifications on a
+ * pollable file descriptor, backtracks the errors and passes them to a
+ * callback, from the thread of the caller or from its own thread.
+ */
+typedef struct XAie_ErrorDispatcher XAie_ErrorDispatcher;
+
+/* Configuration of an error dispatcher */
+typedef struct {
+	int SrcFd;		/* Readable on an error interrupt, such as a UIO
+				 * device or an eventfd, -1 if none */
+	u8 SrcIsUio;		/* SrcFd is a UIO device, re-armed after each
+				 * interrupt */
+	u32 PayloadSize;	/* Errors passed per callback */
+	XAie_ErrorCallback Callback;
+	void *CallbackArg;
+} XAie_ErrorDispatcherCfg;
+
+/*
+ * Waiter blocking the calling thread on the interrupt of a partition until an
+ * event of a tile fires. The event is broadcast to the first level interrupt
+ * controller of the shim tile of its column, which raises the interrupt.
+ */
+typedef struct XAie_EventWaiter XAie_EventWaiter;
+
+/* Configuration of an event waiter */
+typedef struct {
+	int SrcFd;		/* Readable on an AIE interrupt, such as a UIO
+				 * device or an eventfd */
+	u8 SrcIsUio;		/* SrcFd is a UIO device, re-armed after each
+				 * interrupt */
+} XAie_EventWaiterCfg;
+
+/*
+ * Condition checked by XAie_EventWait() after each interrupt. Met is set to
+ * XAIE_ENABLE once the wait is over.
+ */
+typedef AieRC (*XAie_EventWaitCond)(XAie_DevInst *DevInst, void *Arg,
+		u8 *Met);
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_IntrCtrlL1Enable(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_BroadcastSw Switch, u8 IntrId);
@@ -60,5 +134,45 @@ void XAie_DisableErrorInterrupts();
 
 AieRC XAie_BacktrackErrorInterrupts(XAie_DevInst *DevInst,
 		XAie_ErrorMetaData *MData);
+AieRC XAie_BacktrackErrorInterruptsGroup(XAie_DevInst *DevInst,
+		XAie_ErrorMetaData *MData, u8 Group);
+AieRC XAie_BacktrackErrorInterruptsBatch(XAie_DevInst *DevInst,
+		XAie_ErrorMetaData *MData);
+AieRC XAie_ErrorAggrInit(XAie_ErrorAggr *Aggr, XAie_ErrorCount *Entries,
+		u32 NumEntries, u32 MaxErrorsPerPeriod);
+AieRC XAie_BacktrackErrorsAggregate(XAie_DevInst *DevInst,
+		XAie_ErrorAggr *Aggr);
+AieRC XAie_ErrorAggrNextPeriod(XAie_DevInst *DevInst, XAie_ErrorAggr *Aggr);
+AieRC XAie_ErrorAggrFlush(XAie_ErrorAggr *Aggr, XAie_ErrorCount *Summary,
+		u32 *Num);
+
+XAie_ErrorDispatcher* XAie_ErrorDispatcherCreate(XAie_DevInst *DevInst,
+		const XAie_ErrorDispatcherCfg *Cfg);
+int XAie_ErrorDispatcherGetFd(XAie_ErrorDispatcher *Disp);
+AieRC XAie_ErrorDispatcherNotify(XAie_ErrorDispatcher *Disp);
+AieRC XAie_ErrorDispatcherRun(XAie_ErrorDispatcher *Disp, int TimeoutMs);
+AieRC XAie_ErrorDispatcherStart(XAie_ErrorDispatcher *Disp);
+AieRC XAie_ErrorDispatcherStop(XAie_ErrorDispatcher *Disp);
+void XAie_ErrorDispatcherFree(XAie_ErrorDispatcher *Disp);
+XAie_EventWaiter* XAie_EventWaiterCreate(XAie_DevInst *DevInst,
+		const XAie_EventWaiterCfg *Cfg);
+AieRC XAie_EventWait(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Event,
+		XAie_EventWaitCond Cond, void *CondArg, u32 TimeOutUs);
+AieRC XAie_EventWaitCoreDone(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		u32 TimeOutUs);
+AieRC XAie_EventWaitLockValue(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		XAie_Events Event, u8 LockId, u8 Value, u32 TimeOutUs);
+AieRC XAie_EventWaitDmaDone(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		u8 ChNum, XAie_DmaDirection Dir, u32 TimeOutUs);
+AieRC XAie_EventWaitCycles(XAie_EventWaiter *Waiter, XAie_TimerWait *Wait,
+		u32 TimeOutUs);
+AieRC XAie_EventWaiterArm(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Event);
+AieRC XAie_EventWaiterDisarm(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		XAie_ModuleType Module);
+AieRC XAie_EventWaiterSleep(XAie_EventWaiter *Waiter, int WakeFd,
+		u32 TimeOutUs, u8 *Fired);
+void XAie_EventWaiterFree(XAie_EventWaiter *Waiter);
 
 #endif		/* end of protection macro */
@@ -18,7 +18,7 @@
 #include "xaie_helper.h"
 #include "xaie_interrupt_aie.h"
 
-#ifdef XAIE_FEATURE_INTR_INIT_ENABLE
+#if defined(XAIE_FEATURE_INTR_INIT_ENABLE) && defined(XAIE_DEV_AIE_ENABLE)
 
 /************************** Constant Definitions *****************************/
 /************************** Function Definitions *****************************/
@@ -57,6 +57,6 @@ u8 _XAie_IntrCtrlL1IrqId(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return IrqId;
 }
 
-#endif /* XAIE_FEATURE_INTR_INIT_ENABLE */
+#endif /* XAIE_FEATURE_INTR_INIT_ENABLE && XAIE_DEV_AIE_ENABLE */
 
 /** @} */
@@ -18,7 +18,7 @@
 #include "xaie_helper.h"
 #include "xaie_interrupt_aieml.h"
 
-#ifdef XAIE_FEATURE_INTR_INIT_ENABLE
+#if defined(XAIE_FEATURE_INTR_INIT_ENABLE) && defined(XAIE_DEV_AIEML_ENABLE)
 
 /************************** Constant Definitions *****************************/
 /************************** Function Definitions *****************************/
@@ -48,7 +48,7 @@
 u8 _XAieMl_IntrCtrlL1IrqId(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_BroadcastSw Switch)
 {
-	u8 TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	u8 TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 
 	if (TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 		if (((Loc.Col / 4) * 4 + 2) < DevInst->NumCols) {
@@ -72,6 +72,6 @@ u8 _XAieMl_IntrCtrlL1IrqId(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 }
 
-#endif /* XAIE_FEATURE_INTR_INIT_ENABLE */
+#endif /* XAIE_FEATURE_INTR_INIT_ENABLE && XAIE_DEV_AIEML_ENABLE */
 
 /** @} */
@@ -33,6 +33,18 @@
 #if defined(XAIE_FEATURE_INTR_BTRK_ENABLE) && defined(XAIE_FEATURE_LITE)
 
 /************************** Constant Definitions *****************************/
+#define XAIE_ERROR_EVENT_STATUS_WORDS		8U	/* 256 events */
+#define XAIE_ERROR_NUM_SWITCHES			2U
+#define XAIE_ERROR_AGGR_PAYLOAD_SIZE		32U
+#define XAIE_ERROR_ALL_IRQ_GROUPS		0xFFU
+
+/**************************** Type Definitions *******************************/
+/* Event status registers of a module read during its backtrack */
+typedef struct {
+	u32 Words[XAIE_ERROR_EVENT_STATUS_WORDS];
+	u8 Valid;	/* Bitmap of the registers read */
+} XAie_LEventStatusCache;
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -127,23 +139,21 @@ static inline void _XAie_LIntrCtrlL1Ack(XAie_DevInst *DevInst,
 /*****************************************************************************/
 /**
 *
-* This API returns the status an event.
+* This API returns the address of the first event status register of a module.
 *
 * @param	DevInst: Device Instance.
 * @param	Loc: Location of AIE tile.
 * @param	Module: Module type.
-* @param	Event: Physical event ID.
 *
-* @return	True is event was asserted, otherwise false.
+* @return	Register address.
 *
 * @note		Internal only.
 *
 ******************************************************************************/
-static inline u8 _XAie_LEventReadStatus(XAie_DevInst *DevInst,
-		XAie_LocType Loc, XAie_ModuleType Module, u8 Event)
+static inline u64 _XAie_LEventStatusAddr(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_ModuleType Module)
 {
-	u64 RegAddr;
-	u32 RegOff, RegVal;
+	u32 RegOff;
 
 	u8 TType = _XAie_LGetTTypefromLoc(DevInst, Loc);
 	if (TType == XAIEGBL_TILE_TYPE_MEMTILE) {
@@ -158,12 +168,71 @@ static inline u8 _XAie_LEventReadStatus(XAie_DevInst *DevInst,
 		RegOff = XAIE_PL_MOD_BASE_EVENT_STATUS;
 	}
 
-	RegAddr = _XAie_LGetTileAddr(Loc.Row, Loc.Col) + RegOff +
+	return _XAie_LGetTileAddr(Loc.Row, Loc.Col) + RegOff;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the status an event.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of AIE tile.
+* @param	Module: Module type.
+* @param	Event: Physical event ID.
+*
+* @return	True is event was asserted, otherwise false.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline u8 _XAie_LEventReadStatus(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_ModuleType Module, u8 Event)
+{
+	u64 RegAddr;
+	u32 RegVal;
+
+	RegAddr = _XAie_LEventStatusAddr(DevInst, Loc, Module) +
 			(Event / 32U) * 4U;
 	RegVal = _XAie_LPartRead32(DevInst, RegAddr);
 	return XAie_GetField(RegVal, (Event % 32U), 1U << (Event % 32U));
 }
 
+/*****************************************************************************/
+/**
+*
+* This API returns the status an event from the event status registers of a
+* module, reading each register at most once per cache.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of AIE tile.
+* @param	Module: Module type.
+* @param	Event: Physical event ID.
+* @param	Cache: Status registers read so far, zeroed for a new module.
+*
+* @return	True is event was asserted, otherwise false.
+*
+* @note		Internal only. The group error events of a module share one or
+*		two status registers, so this saves a read per asserted error.
+*
+******************************************************************************/
+static inline u8 _XAie_LEventReadStatusCached(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_ModuleType Module, u8 Event,
+		XAie_LEventStatusCache *Cache)
+{
+	u32 Word = Event / 32U;
+
+	if (!(Cache->Valid & (1U << Word))) {
+		Cache->Words[Word] = _XAie_LPartRead32(DevInst,
+				_XAie_LEventStatusAddr(DevInst, Loc, Module) +
+				Word * 4U);
+		Cache->Valid |= (u8)(1U << Word);
+	}
+
+	return XAie_GetField(Cache->Words[Word], (Event % 32U),
+			1U << (Event % 32U));
+}
+
 /*****************************************************************************/
 /**
 *
@@ -183,22 +252,9 @@ static inline void _XAie_LEventClearStatus(XAie_DevInst *DevInst,
 		XAie_LocType Loc, XAie_ModuleType Module, u8 Event)
 {
 	u64 RegAddr;
-	u32 RegOff, RegVal;
+	u32 RegVal;
 
-	u8 TType = _XAie_LGetTTypefromLoc(DevInst, Loc);
-	if (TType == XAIEGBL_TILE_TYPE_MEMTILE) {
-		RegOff = XAIE_MEM_TILE_BASE_EVENT_STATUS;
-	} else if (TType == XAIEGBL_TILE_TYPE_AIETILE) {
-		if (Module == XAIE_CORE_MOD) {
-			RegOff = XAIE_CORE_MOD_BASE_EVENT_STATUS;
-		} else {
-			RegOff = XAIE_MEM_MOD_BASE_EVENT_STATUS;
-		}
-	} else {
-		RegOff = XAIE_PL_MOD_BASE_EVENT_STATUS;
-	}
-
-	RegAddr = _XAie_LGetTileAddr(Loc.Row, Loc.Col) + RegOff +
+	RegAddr = _XAie_LEventStatusAddr(DevInst, Loc, Module) +
 			(Event / 32U) * 4U;
 	RegVal = XAie_SetField(1U, (Event % 32U), (1U << (Event % 32U)));
 	_XAie_LPartWrite32(DevInst, RegAddr, RegVal);
@@ -435,12 +491,16 @@ static AieRC _XAie_LBacktrackTile(XAie_DevInst *DevInst,
 	u32 Size = MData->ArraySize - (*Count);
 	u32 Value, Index, ErrorsMap;
 	u8 GroupEvent, Event;
+	XAie_LEventStatusCache Cache;
+
+	Cache.Valid = 0U;
 
 	/* Read event being broadcast on error channel */
 	GroupEvent = _XAie_ReadErrorBroadcastEvent(DevInst, Loc, Module,
 			XAIE_ERROR_BROADCAST_ID);
 
-	if (!_XAie_LEventReadStatus(DevInst, Loc, Module, GroupEvent))
+	if (!_XAie_LEventReadStatusCached(DevInst, Loc, Module, GroupEvent,
+				&Cache))
 		return XAIE_OK;
 
 	ErrorsMap = Value = _XAie_LReadGroupErrors(DevInst, Loc, Module);
@@ -449,7 +509,8 @@ static AieRC _XAie_LBacktrackTile(XAie_DevInst *DevInst,
 		Event = _XAie_LMapGroupErrorsToEventId(DevInst, Loc, Module,
 				Index);
 
-		if (!_XAie_LEventReadStatus(DevInst, Loc, Module, Event))
+		if (!_XAie_LEventReadStatusCached(DevInst, Loc, Module, Event,
+					&Cache))
 			continue;
 
 		XAIE_DBG("%d: Error event %d asserted in module %d at (%d, %d)\n",
@@ -487,26 +548,25 @@ static AieRC _XAie_LBacktrackTile(XAie_DevInst *DevInst,
 /*****************************************************************************/
 /**
 *
-* This API backtracks the source of error interrupt within a column.
+* This API backtracks the source of error interrupt within a column, from the
+* status of its first-level interrupt controller.
 *
 * @param	DevInst: Device Instance.
 * @param	MData: Error metadata.
 * @param	Loc: Location of AIE tile.
 * @param	Switch: Broadcast switch.
+* @param	Status: Status of the first-level interrupt controller.
 *
 * @return	XAIE_OK on success, error code on failure.
 *
 * @note		Internal only.
 *
 ******************************************************************************/
-static AieRC _XAie_LBacktrackIntrCtrlL1(XAie_DevInst *DevInst,
+static AieRC _XAie_LBacktrackL1Status(XAie_DevInst *DevInst,
 		XAie_ErrorMetaData *MData, XAie_LocType Loc,
-		XAie_BroadcastSw Switch)
+		XAie_BroadcastSw Switch, u32 Status)
 {
 	AieRC RC;
-	u32 Status;
-
-	Status = _XAie_LIntrCtrlL1Status(DevInst, Loc, Switch);
 
 	/* Backtrack shim's internal events */
 	if ((Status & XAIE_ERROR_SHIM_INTR_MASK) || (MData->IsNextInfoValid &&
@@ -588,6 +648,106 @@ static AieRC _XAie_LBacktrackIntrCtrlL1(XAie_DevInst *DevInst,
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API backtracks the source of error interrupt within a column.
+*
+* @param	DevInst: Device Instance.
+* @param	MData: Error metadata.
+* @param	Loc: Location of AIE tile.
+* @param	Switch: Broadcast switch.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_LBacktrackIntrCtrlL1(XAie_DevInst *DevInst,
+		XAie_ErrorMetaData *MData, XAie_LocType Loc,
+		XAie_BroadcastSw Switch)
+{
+	return _XAie_LBacktrackL1Status(DevInst, MData, Loc, Switch,
+			_XAie_LIntrCtrlL1Status(DevInst, Loc, Switch));
+}
+
+/*****************************************************************************/
+/**
+*
+* This API backtracks the source of error interrupts raised by the NoC tiles of
+* one error interrupt group, or of all of them.
+*
+* @param	DevInst: Device Instance.
+* @param	MData: Error metadata.
+* @param	Group: Error interrupt group, XAIE_ERROR_ALL_IRQ_GROUPS for the
+*		whole partition.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE code on
+*		failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_LBacktrackGroup(XAie_DevInst *DevInst,
+		XAie_ErrorMetaData *MData, u8 Group)
+{
+	XAIE_ERROR_RETURN((DevInst == NULL || DevInst->NumCols > XAIE_NUM_COLS),
+			XAIE_INVALID_ARGS,
+			"Error interrupt backtracking failed, invalid partition instance\n");
+
+	XAIE_ERROR_RETURN(MData->Payload == NULL || MData->ArraySize == 0U,
+			XAIE_INVALID_ARGS,
+			"Invalid error payload buffer or size\n");
+
+	XAie_LocType L2 = XAie_TileLoc(0, XAIE_SHIM_ROW);
+	XAie_LocType L1 = XAie_TileLoc(0, XAIE_SHIM_ROW);
+
+	/* Reset the total error count from previous backtrack. */
+	MData->ErrorCount = 0U;
+
+	for (L2 = XAie_LPartGetNextNocTile(DevInst, L2);
+	     L2.Col < DevInst->NumCols;
+	     L2 = XAie_LPartGetNextNocTile(DevInst, L2)) {
+		AieRC RC;
+		XAie_BroadcastSw Switch;
+		u32 Enable = 0, Mask, Index;
+
+		/* The other groups are backtracked by their own handlers. */
+		if (Group != XAIE_ERROR_ALL_IRQ_GROUPS &&
+		    XAie_ErrorIrqGroup(DevInst, L2.Col) != Group)
+			continue;
+
+		Mask = _XAie_LIntrCtrlL2Mask(DevInst, L2);
+
+		/* Only backtrack disabled L2 channels. */
+		if (Mask == XAIE_ERROR_L2_ENABLE)
+			continue;
+
+		Mask = (~Mask) & XAIE_ERROR_L2_ENABLE;
+
+		for_each_set_bit(Index, Mask, 32) {
+			_XAie_MapL2MaskToL1(DevInst, Index, L2.Col, &L1.Col,
+					&Switch);
+
+			RC = _XAie_LBacktrackIntrCtrlL1(DevInst, MData, L1,
+					Switch);
+			if (RC == XAIE_INSUFFICIENT_BUFFER_SIZE) {
+				_XAie_LIntrCtrlL2Enable(DevInst, L2, Enable);
+				return RC;
+			}
+
+			Enable |= BIT(Index);
+		}
+
+		_XAie_LIntrCtrlL2Enable(DevInst, L2, Enable);
+	}
+
+	/* Invalidate next info upon successful backtrack. */
+	MData->IsNextInfoValid = 0;
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -623,50 +783,169 @@ static AieRC _XAie_LBacktrackIntrCtrlL1(XAie_DevInst *DevInst,
 AieRC XAie_BacktrackErrorInterrupts(XAie_DevInst *DevInst,
 		XAie_ErrorMetaData *MData)
 {
+	return _XAie_LBacktrackGroup(DevInst, MData, XAIE_ERROR_ALL_IRQ_GROUPS);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API backtracks the source of the error interrupts of one error interrupt
+* group of the partition, raised on NoC IRQ XAie_ErrorIrqGroupIrqId(Group).
+* Only the NoC tiles of the group and the tiles behind their second level
+* controllers are accessed, so the handlers of different groups can backtrack
+* concurrently, each with its own error metadata.
+*
+* @param	DevInst: Device Instance.
+* @param	MData: Error metadata of the group.
+* @param	Group: Error interrupt group, as set with
+*		XAie_SetErrorIrqGroups().
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE code on
+*		failure.
+*
+* @note		Same usage and resume rules as XAie_BacktrackErrorInterrupts(),
+*		per group.
+*
+******************************************************************************/
+AieRC XAie_BacktrackErrorInterruptsGroup(XAie_DevInst *DevInst,
+		XAie_ErrorMetaData *MData, u8 Group)
+{
+	XAIE_ERROR_RETURN((DevInst == NULL ||
+			Group >= XAIE_ERROR_MAX_IRQ_GROUPS ||
+			(Group != 0U && Group >= DevInst->NumErrIrqGroups)),
+			XAIE_INVALID_ARGS,
+			"Error interrupt backtracking failed, invalid group\n");
+
+	return _XAie_LBacktrackGroup(DevInst, MData, Group);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API re-enables the second-level interrupt channels of a NoC tile once
+* they are backtracked, or defers it.
+*
+* @param	DevInst: Device Instance.
+* @param	L2: Location of the NoC tile.
+* @param	Enable: Bitmap of backtracked channels.
+* @param	Enables: Per column bitmaps to add the channels to instead of
+*		enabling them, NULL to enable them now.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline void _XAie_LBacktrackL2Enable(XAie_DevInst *DevInst,
+		XAie_LocType L2, u32 Enable, u32 *Enables)
+{
+	if (Enables != NULL) {
+		Enables[L2.Col] |= Enable;
+	} else {
+		_XAie_LIntrCtrlL2Enable(DevInst, L2, Enable);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API backtracks the source of error interrupts, reading the interrupt
+* controllers in bursts.
+*
+* @param	DevInst: Device Instance.
+* @param	MData: Error metadata.
+* @param	Enables: Per column bitmaps to add the backtracked L2 channels
+*		to instead of enabling them, NULL to enable them.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE code on
+*		failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_LBacktrackBatch(XAie_DevInst *DevInst,
+		XAie_ErrorMetaData *MData, u32 *Enables)
+{
+	u32 L2Mask[XAIE_NUM_COLS];
+	u32 L1Status[XAIE_NUM_COLS][XAIE_ERROR_NUM_SWITCHES];
+	XAie_LocType L2 = XAie_TileLoc(0, XAIE_SHIM_ROW);
+	XAie_LocType L1 = XAie_TileLoc(0, XAIE_SHIM_ROW);
+	XAie_BroadcastSw Switch;
+	u32 Mask, Index;
+
 	XAIE_ERROR_RETURN((DevInst == NULL || DevInst->NumCols > XAIE_NUM_COLS),
 			XAIE_INVALID_ARGS,
 			"Error interrupt backtracking failed, invalid partition instance\n");
 
-	XAIE_ERROR_RETURN(MData->Payload == NULL || ArraySize == NULL,
+	XAIE_ERROR_RETURN(MData->Payload == NULL || MData->ArraySize == 0U,
 			XAIE_INVALID_ARGS,
 			"Invalid error payload buffer or size\n");
 
-	XAie_LocType L2 = XAie_TileLoc(0, XAIE_SHIM_ROW);
-	XAie_LocType L1 = XAie_TileLoc(0, XAIE_SHIM_ROW);
-
 	/* Reset the total error count from previous backtrack. */
 	MData->ErrorCount = 0U;
 
+	/* Read the L2 masks of all NoC tiles. */
 	for (L2 = XAie_LPartGetNextNocTile(DevInst, L2);
 	     L2.Col < DevInst->NumCols;
 	     L2 = XAie_LPartGetNextNocTile(DevInst, L2)) {
-		AieRC RC;
-		XAie_BroadcastSw Switch;
-		u32 Enable = 0, Mask, Index;
+		L2Mask[L2.Col] = _XAie_LIntrCtrlL2Mask(DevInst, L2);
+	}
 
-		Mask = _XAie_LIntrCtrlL2Mask(DevInst, L2);
+	/* Read the L1 status of all switches behind disabled L2 channels. */
+	L2 = XAie_TileLoc(0, XAIE_SHIM_ROW);
+	for (L2 = XAie_LPartGetNextNocTile(DevInst, L2);
+	     L2.Col < DevInst->NumCols;
+	     L2 = XAie_LPartGetNextNocTile(DevInst, L2)) {
+		Mask = (~L2Mask[L2.Col]) & XAIE_ERROR_L2_ENABLE;
+
+		for_each_set_bit(Index, Mask, 32) {
+			_XAie_MapL2MaskToL1(DevInst, Index, L2.Col, &L1.Col,
+					&Switch);
+			if (L1.Col < DevInst->NumCols) {
+				L1Status[L1.Col][Switch] =
+					_XAie_LIntrCtrlL1Status(DevInst, L1,
+							Switch);
+			}
+		}
+	}
+
+	L2 = XAie_TileLoc(0, XAIE_SHIM_ROW);
+	for (L2 = XAie_LPartGetNextNocTile(DevInst, L2);
+	     L2.Col < DevInst->NumCols;
+	     L2 = XAie_LPartGetNextNocTile(DevInst, L2)) {
+		AieRC RC;
+		u32 Enable = 0;
 
 		/* Only backtrack disabled L2 channels. */
-		if (Mask == XAIE_ERROR_L2_ENABLE)
+		if (L2Mask[L2.Col] == XAIE_ERROR_L2_ENABLE)
 			continue;
 
-		Mask = (~Mask) & XAIE_ERROR_L2_ENABLE;
+		Mask = (~L2Mask[L2.Col]) & XAIE_ERROR_L2_ENABLE;
 
 		for_each_set_bit(Index, Mask, 32) {
+			u32 Status;
+
 			_XAie_MapL2MaskToL1(DevInst, Index, L2.Col, &L1.Col,
 					&Switch);
+			if (L1.Col < DevInst->NumCols) {
+				Status = L1Status[L1.Col][Switch];
+			} else {
+				Status = _XAie_LIntrCtrlL1Status(DevInst, L1,
+						Switch);
+			}
 
-			RC = _XAie_LBacktrackIntrCtrlL1(DevInst, MData, L1,
-					Switch);
+			RC = _XAie_LBacktrackL1Status(DevInst, MData, L1,
+					Switch, Status);
 			if (RC == XAIE_INSUFFICIENT_BUFFER_SIZE) {
-				_XAie_LIntrCtrlL2Enable(DevInst, L2, Enable);
+				_XAie_LBacktrackL2Enable(DevInst, L2, Enable,
+						Enables);
 				return RC;
 			}
 
 			Enable |= BIT(Index);
 		}
 
-		_XAie_LIntrCtrlL2Enable(DevInst, L2, Enable);
+		_XAie_LBacktrackL2Enable(DevInst, L2, Enable, Enables);
 	}
 
 	/* Invalidate next info upon successful backtrack. */
@@ -675,6 +954,287 @@ AieRC XAie_BacktrackErrorInterrupts(XAie_DevInst *DevInst,
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API backtracks the source of error interrupts like
+* XAie_BacktrackErrorInterrupts(), reading the interrupt controllers in bursts.
+* The second-level masks of all NoC tiles of the partition are read first,
+* then the first-level status of every switch behind a disabled second-level
+* channel, back to back, before any tile is backtracked. Only the columns
+* which reported an error are then walked.
+*
+* @param	DevInst: Device Instance. Passing valid partition device
+*			instance will only backtrack errors in the given
+*			partition.
+* @param	MData: Error metadata.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE code on
+*		failure.
+*
+* @note		Same usage and resume rules as XAie_BacktrackErrorInterrupts().
+*		Prefer it when many columns raise errors at once: the status
+*		reads of the controllers are issued without waiting on the
+*		backtracking of other columns.
+*
+******************************************************************************/
+AieRC XAie_BacktrackErrorInterruptsBatch(XAie_DevInst *DevInst,
+		XAie_ErrorMetaData *MData)
+{
+	return _XAie_LBacktrackBatch(DevInst, MData, NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes an error aggregation.
+*
+* @param	Aggr: Error aggregation.
+* @param	Entries: Table of error counters, allocated by the caller.
+* @param	NumEntries: Number of counters, a power of two. It bounds the
+*			distinct errors counted between two flushes.
+* @param	MaxErrorsPerPeriod: Errors per period after which the
+*			backtracked L2 channels are left disabled until the
+*			next period, 0 for no limit.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_ErrorAggrInit(XAie_ErrorAggr *Aggr, XAie_ErrorCount *Entries,
+		u32 NumEntries, u32 MaxErrorsPerPeriod)
+{
+	XAIE_ERROR_RETURN(Aggr == NULL || Entries == NULL || NumEntries == 0U ||
+			(NumEntries & (NumEntries - 1U)) != 0U,
+			XAIE_INVALID_ARGS,
+			"Invalid error aggregation table\n");
+
+	for (u32 i = 0U; i < NumEntries; i++)
+		Entries[i].Count = 0U;
+
+	Aggr->Entries = Entries;
+	Aggr->NumEntries = NumEntries;
+	Aggr->NumDistinct = 0U;
+	Aggr->NumErrors = 0U;
+	Aggr->NumDropped = 0U;
+	Aggr->MaxErrorsPerPeriod = MaxErrorsPerPeriod;
+	Aggr->PeriodErrors = 0U;
+	Aggr->NumSuppressed = 0U;
+	Aggr->Suppressed = 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API counts a backtracked error in the counter of its tile, module and
+* event, found by open addressing on the aggregation table.
+*
+* @param	Aggr: Error aggregation.
+* @param	Payload: Backtracked error.
+*
+* @return	None.
+*
+* @note		Internal only. Errors which find the table full are counted
+*		as dropped.
+*
+******************************************************************************/
+static void _XAie_ErrorAggrCount(XAie_ErrorAggr *Aggr,
+		const XAie_ErrorPayload *Payload)
+{
+	u32 Mask = Aggr->NumEntries - 1U;
+	u32 Key, Slot;
+
+	Key = ((u32)Payload->Loc.Col << 24U) | ((u32)Payload->Loc.Row << 16U) |
+		((u32)Payload->Module << 8U) | Payload->EventId;
+	Slot = (Key * 0x9E3779B1U) >> 16U;
+
+	Aggr->NumErrors++;
+	Aggr->PeriodErrors++;
+
+	for (u32 i = 0U; i < Aggr->NumEntries; i++) {
+		XAie_ErrorCount *Entry = &Aggr->Entries[(Slot + i) & Mask];
+
+		if (Entry->Count == 0U) {
+			Entry->Loc = Payload->Loc;
+			Entry->Module = (u8)Payload->Module;
+			Entry->EventId = Payload->EventId;
+			Entry->Count = 1U;
+			Aggr->NumDistinct++;
+			return;
+		}
+
+		if (Entry->Loc.Col == Payload->Loc.Col &&
+				Entry->Loc.Row == Payload->Loc.Row &&
+				Entry->Module == Payload->Module &&
+				Entry->EventId == Payload->EventId) {
+			Entry->Count++;
+			return;
+		}
+	}
+
+	Aggr->NumDropped++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API backtracks the source of error interrupts into an error aggregation
+* instead of returning every error. All active errors are backtracked in one
+* call, through an internal payload buffer, and counted per tile, module and
+* event. Once more errors than the limit of the aggregation are counted in a
+* period, the backtracked L2 channels are left disabled, so an error storm
+* stops raising interrupts until XAie_ErrorAggrNextPeriod() is called.
+*
+* @param	DevInst: Device Instance.
+* @param	Aggr: Error aggregation, initialized by XAie_ErrorAggrInit().
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Disable the error interrupts with XAie_DisableErrorInterrupts()
+*		first, as for XAie_BacktrackErrorInterrupts(). Read the counts
+*		with XAie_ErrorAggrFlush().
+*
+******************************************************************************/
+AieRC XAie_BacktrackErrorsAggregate(XAie_DevInst *DevInst,
+		XAie_ErrorAggr *Aggr)
+{
+	XAie_ErrorPayload Payload[XAIE_ERROR_AGGR_PAYLOAD_SIZE];
+	u32 Enables[XAIE_NUM_COLS];
+	XAie_LocType L2 = XAie_TileLoc(0, XAIE_SHIM_ROW);
+	AieRC RC;
+	XAie_ErrorMetadataInit(MData, Payload, sizeof(Payload));
+
+	XAIE_ERROR_RETURN((DevInst == NULL || DevInst->NumCols > XAIE_NUM_COLS),
+			XAIE_INVALID_ARGS,
+			"Error interrupt backtracking failed, invalid partition instance\n");
+
+	XAIE_ERROR_RETURN(Aggr == NULL || Aggr->Entries == NULL,
+			XAIE_INVALID_ARGS,
+			"Invalid error aggregation\n");
+
+	for (u32 Col = 0U; Col < DevInst->NumCols; Col++)
+		Enables[Col] = 0U;
+
+	do {
+		RC = _XAie_LBacktrackBatch(DevInst, &MData, Enables);
+		for (u32 i = 0U; i < MData.ErrorCount; i++)
+			_XAie_ErrorAggrCount(Aggr, &Payload[i]);
+	} while (RC == XAIE_INSUFFICIENT_BUFFER_SIZE);
+
+	if (RC != XAIE_OK)
+		return RC;
+
+	if (Aggr->MaxErrorsPerPeriod != 0U &&
+			Aggr->PeriodErrors > Aggr->MaxErrorsPerPeriod) {
+		Aggr->Suppressed = 1U;
+		return XAIE_OK;
+	}
+
+	for (L2 = XAie_LPartGetNextNocTile(DevInst, L2);
+	     L2.Col < DevInst->NumCols;
+	     L2 = XAie_LPartGetNextNocTile(DevInst, L2)) {
+		if (Enables[L2.Col] != 0U)
+			_XAie_LIntrCtrlL2Enable(DevInst, L2, Enables[L2.Col]);
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts a new rate period of an error aggregation. If the error
+* interrupts were suppressed in the last period, the L2 channels of all NoC
+* tiles of the partition are enabled again.
+*
+* @param	DevInst: Device Instance.
+* @param	Aggr: Error aggregation.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS on failure.
+*
+* @note		Call it periodically, the period sets the error rate limit
+*		together with MaxErrorsPerPeriod. The errors counted so far
+*		are kept.
+*
+******************************************************************************/
+AieRC XAie_ErrorAggrNextPeriod(XAie_DevInst *DevInst, XAie_ErrorAggr *Aggr)
+{
+	XAie_LocType L2 = XAie_TileLoc(0, XAIE_SHIM_ROW);
+
+	XAIE_ERROR_RETURN((DevInst == NULL || DevInst->NumCols > XAIE_NUM_COLS),
+			XAIE_INVALID_ARGS,
+			"Invalid partition instance\n");
+
+	XAIE_ERROR_RETURN(Aggr == NULL, XAIE_INVALID_ARGS,
+			"Invalid error aggregation\n");
+
+	if (Aggr->Suppressed != 0U) {
+		for (L2 = XAie_LPartGetNextNocTile(DevInst, L2);
+		     L2.Col < DevInst->NumCols;
+		     L2 = XAie_LPartGetNextNocTile(DevInst, L2)) {
+			_XAie_LIntrCtrlL2Enable(DevInst, L2,
+					XAIE_ERROR_L2_ENABLE);
+		}
+		Aggr->NumSuppressed++;
+		Aggr->Suppressed = 0U;
+	}
+	Aggr->PeriodErrors = 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the summary of an error aggregation, one counter per
+* distinct error, and clears the counters.
+*
+* @param	Aggr: Error aggregation.
+* @param	Summary: Buffer to return the counters.
+* @param	Num: Size of Summary as input, number of counters returned as
+*		output.
+*
+* @return	XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if Summary
+*		is too small, in which case Num returns the size needed and
+*		the counters are kept.
+*
+* @note		NumErrors and NumDropped of the aggregation are cleared too,
+*		read them first.
+*
+******************************************************************************/
+AieRC XAie_ErrorAggrFlush(XAie_ErrorAggr *Aggr, XAie_ErrorCount *Summary,
+		u32 *Num)
+{
+	u32 Count = 0U;
+
+	XAIE_ERROR_RETURN(Aggr == NULL || Summary == NULL || Num == NULL,
+			XAIE_INVALID_ARGS,
+			"Invalid error aggregation or summary\n");
+
+	if (*Num < Aggr->NumDistinct) {
+		*Num = Aggr->NumDistinct;
+		return XAIE_INSUFFICIENT_BUFFER_SIZE;
+	}
+
+	for (u32 i = 0U; i < Aggr->NumEntries; i++) {
+		if (Aggr->Entries[i].Count == 0U)
+			continue;
+
+		Summary[Count++] = Aggr->Entries[i];
+		Aggr->Entries[i].Count = 0U;
+	}
+
+	*Num = Count;
+	Aggr->NumDistinct = 0U;
+	Aggr->NumErrors = 0U;
+	Aggr->NumDropped = 0U;
+
+	return XAIE_OK;
+}
+
 #endif /* XAIE_FEATURE_INTR_BTRK_ENABLE */
 
 /** @} */
@@ -0,0 +1,522 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_interrupt_dispatch.c
+* @{
+*
+* This file implements a dispatcher of AIE error interrupts for user space.
+* The error notifications of a partition are gathered on one epoll file
+* descriptor: the interrupt source given by the caller, such as a UIO device,
+* and an eventfd which any other notifier, including a signal handler, can
+* write. The epoll descriptor can be added to the event loop of the
+* application, or a dispatcher thread can wait on it. On each notification,
+* the errors are backtracked and passed to a callback.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_interrupt.h"
+
+#if defined(XAIE_FEATURE_INTR_BTRK_ENABLE) && \
+	defined(XAIE_FEATURE_INTR_CTRL_ENABLE) && \
+	defined(XAIE_FEATURE_LITE) && !defined(__AIEBAREMETAL__)
+
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+/************************** Constant Definitions *****************************/
+#define XAIE_ERROR_DISPATCH_MAX_EVENTS		3U
+
+/**************************** Type Definitions *******************************/
+struct XAie_ErrorDispatcher {
+	XAie_DevInst *DevInst;
+	XAie_ErrorDispatcherCfg Cfg;
+	XAie_ErrorPayload *Payload;
+	int EpollFd;
+	int NotifyFd;		/* Written by XAie_ErrorDispatcherNotify() */
+	int StopFd;		/* Written to stop the dispatcher thread */
+	pthread_mutex_t Lock;	/* Serializes the backtracking */
+	pthread_t Thread;
+	u8 Running;
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API adds a file descriptor to the epoll descriptor of a dispatcher.
+*
+* @param	Disp: Error dispatcher.
+* @param	Fd: File descriptor waited for to be readable.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_ErrorDispatcherAddFd(XAie_ErrorDispatcher *Disp, int Fd)
+{
+	struct epoll_event Event;
+
+	memset(&Event, 0, sizeof(Event));
+	Event.events = EPOLLIN;
+	Event.data.fd = Fd;
+	if(epoll_ctl(Disp->EpollFd, EPOLL_CTL_ADD, Fd, &Event) != 0) {
+		XAIE_ERROR("Unable to wait for fd %d: %s\n", Fd,
+				strerror(errno));
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acknowledges a notification of the interrupt source. A UIO device
+* returns the interrupt count and masks the interrupt, which is unmasked
+* again here. Other sources are read as an eventfd counter.
+*
+* @param	Disp: Error dispatcher.
+*
+* @return	None.
+*
+* @note		Internal only. The interrupt is re-armed before the errors are
+*		backtracked, so an error raised meanwhile is not missed; the
+*		L2 controllers reporting errors are disabled by the
+*		backtracking until it is done.
+*
+******************************************************************************/
+static void _XAie_ErrorDispatcherAckSrc(XAie_ErrorDispatcher *Disp)
+{
+	if(Disp->Cfg.SrcIsUio != 0U) {
+		u32 Count, Enable = 1U;
+
+		if(read(Disp->Cfg.SrcFd, &Count, sizeof(Count)) !=
+				(ssize_t)sizeof(Count)) {
+			return;
+		}
+		if(write(Disp->Cfg.SrcFd, &Enable, sizeof(Enable)) !=
+				(ssize_t)sizeof(Enable)) {
+			XAIE_ERROR("Unable to re-enable UIO interrupt\n");
+		}
+	} else {
+		u64 Count;
+
+		(void)read(Disp->Cfg.SrcFd, &Count, sizeof(Count));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API backtracks the errors of the partition and passes them to the
+* callback of the dispatcher, one payload buffer at a time.
+*
+* @param	Disp: Error dispatcher.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_ErrorDispatcherBacktrack(XAie_ErrorDispatcher *Disp)
+{
+	AieRC RC;
+	XAie_ErrorMetadataInit(MData, Disp->Payload,
+			Disp->Cfg.PayloadSize * sizeof(XAie_ErrorPayload));
+
+	pthread_mutex_lock(&Disp->Lock);
+	XAie_DisableErrorInterrupts();
+	do {
+		RC = XAie_BacktrackErrorInterruptsBatch(Disp->DevInst,
+				&MData);
+		if(MData.ErrorCount > 0U) {
+			Disp->Cfg.Callback(Disp->Cfg.CallbackArg, Disp->Payload,
+					MData.ErrorCount);
+		}
+	} while(RC == XAIE_INSUFFICIENT_BUFFER_SIZE);
+	pthread_mutex_unlock(&Disp->Lock);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits for the notifications of a dispatcher and handles them.
+*
+* @param	Disp: Error dispatcher.
+* @param	TimeoutMs: Time to wait for a notification in milliseconds, 0
+*		to return at once and -1 to wait forever.
+* @param	Stop: Set to 1 if the dispatcher thread was asked to stop.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_ErrorDispatcherWait(XAie_ErrorDispatcher *Disp,
+		int TimeoutMs, u8 *Stop)
+{
+	struct epoll_event Events[XAIE_ERROR_DISPATCH_MAX_EVENTS];
+	u8 Pending = 0U;
+	int Num;
+
+	Num = epoll_wait(Disp->EpollFd, Events, XAIE_ERROR_DISPATCH_MAX_EVENTS,
+			TimeoutMs);
+	if(Num < 0) {
+		if(errno == EINTR) {
+			return XAIE_OK;
+		}
+		XAIE_ERROR("Unable to wait for error notifications: %s\n",
+				strerror(errno));
+		return XAIE_ERR;
+	}
+
+	for(int i = 0; i < Num; i++) {
+		int Fd = Events[i].data.fd;
+		u64 Count;
+
+		if(Fd == Disp->StopFd) {
+			(void)read(Fd, &Count, sizeof(Count));
+			*Stop = 1U;
+		} else if(Fd == Disp->NotifyFd) {
+			(void)read(Fd, &Count, sizeof(Count));
+			Pending = 1U;
+		} else {
+			_XAie_ErrorDispatcherAckSrc(Disp);
+			Pending = 1U;
+		}
+	}
+
+	if(Pending != 0U) {
+		_XAie_ErrorDispatcherBacktrack(Disp);
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates an error dispatcher for a partition.
+*
+* @param	DevInst: Device Instance.
+* @param	Cfg: Dispatcher configuration.
+*
+* @return	Pointer to the dispatcher on success, NULL on failure.
+*
+* @note		The error interrupts have to be set up with
+*		XAie_ErrorHandlingInit(). The source fd is owned by the caller
+*		and has to stay open as long as the dispatcher.
+*
+******************************************************************************/
+XAie_ErrorDispatcher* XAie_ErrorDispatcherCreate(XAie_DevInst *DevInst,
+		const XAie_ErrorDispatcherCfg *Cfg)
+{
+	XAie_ErrorDispatcher *Disp;
+
+	if(DevInst == XAIE_NULL) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return NULL;
+	}
+
+	if((Cfg == NULL) || (Cfg->Callback == NULL) ||
+			(Cfg->PayloadSize == 0U) ||
+			(Cfg->SrcIsUio != 0U && Cfg->SrcFd < 0)) {
+		XAIE_ERROR("Invalid error dispatcher configuration\n");
+		return NULL;
+	}
+
+	Disp = (XAie_ErrorDispatcher *)calloc(1U, sizeof(*Disp));
+	if(Disp == NULL) {
+		XAIE_ERROR("Memory allocation for error dispatcher failed\n");
+		return NULL;
+	}
+
+	Disp->Payload = (XAie_ErrorPayload *)malloc(Cfg->PayloadSize *
+			sizeof(*Disp->Payload));
+	if(Disp->Payload == NULL) {
+		XAIE_ERROR("Memory allocation for error dispatcher failed\n");
+		free(Disp);
+		return NULL;
+	}
+
+	Disp->DevInst = DevInst;
+	Disp->Cfg = *Cfg;
+	Disp->EpollFd = epoll_create1(EPOLL_CLOEXEC);
+	Disp->NotifyFd = eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+	Disp->StopFd = eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+	if((Disp->EpollFd < 0) || (Disp->NotifyFd < 0) ||
+			(Disp->StopFd < 0)) {
+		XAIE_ERROR("Unable to create error dispatcher fds: %s\n",
+				strerror(errno));
+		goto err;
+	}
+
+	if((_XAie_ErrorDispatcherAddFd(Disp, Disp->NotifyFd) != XAIE_OK) ||
+			(Cfg->SrcFd >= 0 &&
+			 _XAie_ErrorDispatcherAddFd(Disp, Cfg->SrcFd) != XAIE_OK)) {
+		goto err;
+	}
+
+	if(pthread_mutex_init(&Disp->Lock, NULL) != 0) {
+		XAIE_ERROR("Unable to create error dispatcher lock\n");
+		goto err;
+	}
+
+	return Disp;
+
+err:
+	if(Disp->EpollFd >= 0) {
+		close(Disp->EpollFd);
+	}
+	if(Disp->NotifyFd >= 0) {
+		close(Disp->NotifyFd);
+	}
+	if(Disp->StopFd >= 0) {
+		close(Disp->StopFd);
+	}
+	free(Disp->Payload);
+	free(Disp);
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the pollable file descriptor of an error dispatcher. It is
+* readable when an error notification is pending.
+*
+* @param	Disp: Error dispatcher.
+*
+* @return	File descriptor on success, -1 on failure.
+*
+* @note		Add it to the event loop of the application and call
+*		XAie_ErrorDispatcherRun() with a zero timeout when it is
+*		readable. Not to be used while the dispatcher thread runs.
+*
+******************************************************************************/
+int XAie_ErrorDispatcherGetFd(XAie_ErrorDispatcher *Disp)
+{
+	if(Disp == NULL) {
+		XAIE_ERROR("Invalid error dispatcher\n");
+		return -1;
+	}
+
+	return Disp->EpollFd;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API notifies an error dispatcher of an error interrupt, for interrupt
+* sources without a file descriptor.
+*
+* @param	Disp: Error dispatcher.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		It only writes an eventfd, so it is safe to call from a signal
+*		handler or another thread.
+*
+******************************************************************************/
+AieRC XAie_ErrorDispatcherNotify(XAie_ErrorDispatcher *Disp)
+{
+	u64 One = 1U;
+
+	if(Disp == NULL) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(write(Disp->NotifyFd, &One, sizeof(One)) != (ssize_t)sizeof(One)) {
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits for the notifications of an error dispatcher and passes the
+* errors they report to its callback, from the thread of the caller.
+*
+* @param	Disp: Error dispatcher.
+* @param	TimeoutMs: Time to wait for a notification in milliseconds, 0
+*		to return at once and -1 to wait forever.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Returns XAIE_OK without calling the callback if no
+*		notification came in time.
+*
+******************************************************************************/
+AieRC XAie_ErrorDispatcherRun(XAie_ErrorDispatcher *Disp, int TimeoutMs)
+{
+	u8 Stop = 0U;
+
+	if(Disp == NULL) {
+		XAIE_ERROR("Invalid error dispatcher\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Disp->Running != 0U) {
+		XAIE_ERROR("Error dispatcher thread is running\n");
+		return XAIE_ERR;
+	}
+
+	return _XAie_ErrorDispatcherWait(Disp, TimeoutMs, &Stop);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the body of the thread of an error dispatcher. It handles the
+* notifications until it is asked to stop.
+*
+* @param	Arg: Error dispatcher.
+*
+* @return	NULL.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void *_XAie_ErrorDispatcherWorker(void *Arg)
+{
+	XAie_ErrorDispatcher *Disp = (XAie_ErrorDispatcher *)Arg;
+	u8 Stop = 0U;
+
+	while(Stop == 0U) {
+		if(_XAie_ErrorDispatcherWait(Disp, -1, &Stop) != XAIE_OK) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts the thread of an error dispatcher, which calls its callback
+* for every notification until the dispatcher is stopped.
+*
+* @param	Disp: Error dispatcher.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The callback runs in the dispatcher thread, so the device
+*		instance must not be used by other threads while it runs.
+*
+******************************************************************************/
+AieRC XAie_ErrorDispatcherStart(XAie_ErrorDispatcher *Disp)
+{
+	if(Disp == NULL) {
+		XAIE_ERROR("Invalid error dispatcher\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Disp->Running != 0U) {
+		XAIE_ERROR("Error dispatcher is already started\n");
+		return XAIE_ERR;
+	}
+
+	if(_XAie_ErrorDispatcherAddFd(Disp, Disp->StopFd) != XAIE_OK) {
+		return XAIE_ERR;
+	}
+
+	if(pthread_create(&Disp->Thread, NULL, _XAie_ErrorDispatcherWorker,
+				Disp) != 0) {
+		XAIE_ERROR("Unable to create error dispatcher thread\n");
+		(void)epoll_ctl(Disp->EpollFd, EPOLL_CTL_DEL, Disp->StopFd,
+				NULL);
+		return XAIE_ERR;
+	}
+	Disp->Running = 1U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stops the thread of an error dispatcher. Notifications pending when
+* it is stopped are left for the next run.
+*
+* @param	Disp: Error dispatcher.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_ErrorDispatcherStop(XAie_ErrorDispatcher *Disp)
+{
+	u64 One = 1U, Count;
+
+	if(Disp == NULL) {
+		XAIE_ERROR("Invalid error dispatcher\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Disp->Running == 0U) {
+		return XAIE_OK;
+	}
+
+	if(write(Disp->StopFd, &One, sizeof(One)) != (ssize_t)sizeof(One)) {
+		XAIE_ERROR("Unable to stop error dispatcher thread\n");
+		return XAIE_ERR;
+	}
+	pthread_join(Disp->Thread, NULL);
+	Disp->Running = 0U;
+
+	(void)epoll_ctl(Disp->EpollFd, EPOLL_CTL_DEL, Disp->StopFd, NULL);
+	(void)read(Disp->StopFd, &Count, sizeof(Count));
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases an error dispatcher. Its thread is stopped first if it is
+* running.
+*
+* @param	Disp: Error dispatcher.
+*
+* @return	None.
+*
+* @note		The source fd is owned by the caller and left open.
+*
+******************************************************************************/
+void XAie_ErrorDispatcherFree(XAie_ErrorDispatcher *Disp)
+{
+	if(Disp == NULL) {
+		return;
+	}
+
+	(void)XAie_ErrorDispatcherStop(Disp);
+
+	pthread_mutex_destroy(&Disp->Lock);
+	close(Disp->EpollFd);
+	close(Disp->NotifyFd);
+	close(Disp->StopFd);
+	free(Disp->Payload);
+	free(Disp);
+}
+
+#endif /* XAIE_FEATURE_INTR_BTRK_ENABLE && XAIE_FEATURE_LITE */
+
+/** @} */
@@ -70,7 +70,7 @@ static AieRC _XAie_IntrCtrlL1Config(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -170,7 +170,7 @@ AieRC XAie_IntrCtrlL1IrqSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -223,7 +223,7 @@ AieRC XAie_IntrCtrlL1Event(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -292,7 +292,7 @@ AieRC XAie_IntrCtrlL1BroadcastBlock(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -352,7 +352,7 @@ AieRC XAie_IntrCtrlL1BroadcastUnblock(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -405,7 +405,7 @@ static AieRC _XAie_IntrCtrlL2Config(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -483,7 +483,8 @@ AieRC XAie_IntrCtrlL2Disable(XAie_DevInst *DevInst, XAie_LocType Loc,
 static AieRC _XAie_GroupErrorInit(XAie_DevInst *DevInst)
 {
 	AieRC RC;
-	u32 GroupErrorEnableMask;
+	u32 GroupErrorEnableMask, AieMemErrors = 0U, AieCoreErrors = 0U,
+	    MemTileErrors = 0U;
 	u8 MemTileStart, MemTileEnd, AieRowStart, AieRowEnd;
 	XAie_LocType Loc;
 
@@ -492,6 +493,23 @@ static AieRC _XAie_GroupErrorInit(XAie_DevInst *DevInst)
 	AieRowStart = DevInst->AieTileRowStart;
 	AieRowEnd = DevInst->AieTileRowStart + DevInst->AieTileNumRows;
 
+	/*
+	 * The fatal group errors only depend on the tile type, compute them
+	 * once for the AIE and mem tiles of the partition.
+	 */
+	if(AieRowStart < AieRowEnd) {
+		Loc = XAie_TileLoc(0U, AieRowStart);
+		AieMemErrors = _XAie_GetFatalGroupErrors(DevInst, Loc,
+				XAIE_MEM_MOD);
+		AieCoreErrors = _XAie_GetFatalGroupErrors(DevInst, Loc,
+				XAIE_CORE_MOD);
+	}
+
+	if(MemTileStart < MemTileEnd) {
+		MemTileErrors = _XAie_GetFatalGroupErrors(DevInst,
+				XAie_TileLoc(0U, MemTileStart), XAIE_MEM_MOD);
+	}
+
 	for(u8 Col = 0; Col < DevInst->NumCols; Col++) {
 		for(u8 Row = AieRowStart; Row < AieRowEnd; Row++) {
 			Loc = XAie_TileLoc(Col, Row);
@@ -499,11 +517,9 @@ static AieRC _XAie_GroupErrorInit(XAie_DevInst *DevInst)
 			if (_XAie_PmIsTileRequested(DevInst, Loc) == XAIE_DISABLE)
 				continue;
 
-			GroupErrorEnableMask = _XAie_GetFatalGroupErrors(DevInst,
-							Loc, XAIE_MEM_MOD);
 			RC = XAie_EventGroupControl(DevInst, Loc, XAIE_MEM_MOD,
 					XAIE_EVENT_GROUP_ERRORS_MEM,
-					GroupErrorEnableMask);
+					AieMemErrors);
 			if(RC != XAIE_OK) {
 				XAIE_ERROR("Failed to configure group errors in memory module\n");
 				return RC;
@@ -517,11 +533,9 @@ static AieRC _XAie_GroupErrorInit(XAie_DevInst *DevInst)
 				return RC;
 			}
 
-			GroupErrorEnableMask = _XAie_GetFatalGroupErrors(DevInst,
-							Loc, XAIE_CORE_MOD);
 			RC = XAie_EventGroupControl(DevInst, Loc, XAIE_CORE_MOD,
 					XAIE_EVENT_GROUP_ERRORS_0_CORE,
-					GroupErrorEnableMask);
+					AieCoreErrors);
 			if(RC != XAIE_OK) {
 				XAIE_ERROR("Failed to configure group error in core module\n");
 				return RC;
@@ -542,11 +556,9 @@ static AieRC _XAie_GroupErrorInit(XAie_DevInst *DevInst)
 			if (_XAie_PmIsTileRequested(DevInst, Loc) == XAIE_DISABLE)
 				continue;
 
-			GroupErrorEnableMask = _XAie_GetFatalGroupErrors(DevInst,
-							Loc, XAIE_MEM_MOD);
 			RC = XAie_EventGroupControl(DevInst, Loc, XAIE_MEM_MOD,
 					XAIE_EVENT_GROUP_ERRORS_MEM_TILE,
-					GroupErrorEnableMask);
+					MemTileErrors);
 			if(RC != XAIE_OK) {
 				XAIE_ERROR("Failed to configure group error in mem tile\n");
 				return RC;
@@ -606,7 +618,7 @@ static AieRC _XAie_FindNextNoCTile(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_LocType *NextLoc)
 {
 	while (++Loc.Col < DevInst->NumCols) {
-		u8 TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		u8 TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 		if (TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
 			NextLoc->Col = Loc.Col;
 			NextLoc->Row = Loc.Row;
@@ -690,7 +702,7 @@ static AieRC XAie_ErrorHandlingReserveRsc(XAie_DevInst *DevInst)
 			XAIE_ERROR("Failed to request SHIM error BC %u.\n", i);
 			for (u32 j = 1; j < i; j++) {
 				for (u32 k = 0; k < ShimUserRscNum; k++) {
-					ShimRscsBc[i].RscId = j;
+					ShimRscsBc[k].RscId = j;
 				}
 				XAie_ReleaseBroadcastChannel(DevInst,
 					ShimUserRscNum, ShimRscsBc);
@@ -709,24 +721,16 @@ static AieRC XAie_ErrorHandlingReserveRsc(XAie_DevInst *DevInst)
 /*****************************************************************************/
 /**
 *
-* This API configures broadcast network to deliver error events as interrupts in
-* NPI. When error occurs, interrupt is raised on NPI interrupt line #5.
+* This API configures the broadcast network of the partition to route error
+* events to the L1 and L2 interrupt controllers of the shim tiles.
 *
 * @param	DevInst: Device Instance
 *
 * @return	XAIE_OK on success, error code on failure.
 *
-* @note		This API assumes the whole AIE as a single partition and the
-*		following broadcast channels to be available. To avoid conflicts,
-*		it is the user's responsibility to make sure none of the below
-*		channels are being used.
-*			* Broadcast channel #0 in AIE array tiles.
-*			* Switch A L1 IRQ 16.
-*			* NPI interrupt line #5.
-*		Currently, this API only supports Linux UIO, CDO, and debug
-*		backends.
+* @note		This function is used internally only.
 ******************************************************************************/
-AieRC XAie_ErrorHandlingInit(XAie_DevInst *DevInst)
+static AieRC _XAie_ErrorHandlingConfig(XAie_DevInst *DevInst)
 {
 	AieRC RC;
 	u8 TileType, L1BroadcastIdSwA, L1BroadcastIdSwB, MemTileStart,
@@ -734,17 +738,6 @@ AieRC XAie_ErrorHandlingInit(XAie_DevInst *DevInst)
 	XAie_LocType Loc;
 	const XAie_L1IntrMod *L1IntrMod;
 
-	if((DevInst == XAIE_NULL) ||
-			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
-		XAIE_ERROR("Invalid device instance\n");
-		return XAIE_INVALID_ARGS;
-	}
-
-	RC = XAie_ErrorHandlingReserveRsc(DevInst);
-	if (RC != XAIE_OK) {
-		return RC;
-	}
-
 	MemTileStart = DevInst->MemTileRowStart;
 	MemTileEnd = DevInst->MemTileRowStart + DevInst->MemTileNumRows;
 	AieRowStart = DevInst->AieTileRowStart;
@@ -857,7 +850,7 @@ AieRC XAie_ErrorHandlingInit(XAie_DevInst *DevInst)
 		 * Compute the broadcast line number on which L1 interrupt
 		 * controller must generate error interrupts.
 		 */
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 		L1IntrMod = DevInst->DevProp.DevMod[TileType].L1IntrMod;
 		if (L1IntrMod == NULL) {
 			XAIE_ERROR("Invalid module type\n");
@@ -957,13 +950,76 @@ AieRC XAie_ErrorHandlingInit(XAie_DevInst *DevInst)
 		}
 	}
 
-	RC =  _XAie_GroupErrorInit(DevInst);
-	if(RC != XAIE_OK) {
-		XAIE_ERROR("Failed to initialize group errors\n");
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures broadcast network to deliver error events as interrupts in
+* NPI. When error occurs, interrupt is raised on NPI interrupt line #5.
+*
+* @param	DevInst: Device Instance
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		This API assumes the whole AIE as a single partition and the
+*		following broadcast channels to be available. To avoid conflicts,
+*		it is the user's responsibility to make sure none of the below
+*		channels are being used.
+*			* Broadcast channel #0 in AIE array tiles.
+*			* Switch A L1 IRQ 16.
+*			* NPI interrupt line #5.
+*		Currently, this API only supports Linux UIO, CDO, and debug
+*		backends. Unless a transaction is already active, the whole
+*		configuration is submitted to the backend as one transaction.
+******************************************************************************/
+AieRC XAie_ErrorHandlingInit(XAie_DevInst *DevInst)
+{
+	AieRC RC;
+	u8 OwnTxn = XAIE_DISABLE;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = XAie_ErrorHandlingReserveRsc(DevInst);
+	if (RC != XAIE_OK) {
 		return RC;
 	}
 
-	return XAIE_OK;
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	RC = _XAie_ErrorHandlingConfig(DevInst);
+	if(RC == XAIE_OK) {
+		RC =  _XAie_GroupErrorInit(DevInst);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to initialize group errors\n");
+		}
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	return RC;
 }
 
 #endif /* XAIE_FEATURE_INTR_INIT_ENABLE */
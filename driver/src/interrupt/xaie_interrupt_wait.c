@@ -0,0 +1,1167 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_interrupt_wait.c
+* @{
+*
+* This file implements waits on AIE events driven by interrupts instead of
+* register polling. The event waited for is broadcast from its tile to the
+* first level interrupt controller of the shim tile of its column, or mapped
+* to it directly for shim events. The first level interrupt controllers raise
+* the second level interrupt controllers as set up by XAie_ErrorHandlingInit(),
+* and the calling thread sleeps on the interrupt file descriptor until the
+* interrupt fires. The condition of the wait, such as the done bit of a core,
+* is read back after each interrupt, so spurious interrupts only cost a
+* register read.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifndef __AIEBAREMETAL__
+#define  _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdlib.h>
+
+#include "xaie_core.h"
+#include "xaie_dma.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_interrupt.h"
+#include "xaie_locks.h"
+#include "xaie_rsc.h"
+#include "xaie_timer.h"
+
+#if defined(XAIE_FEATURE_INTR_INIT_ENABLE) && \
+	defined(XAIE_FEATURE_RSC_ENABLE) && !defined(__AIEBAREMETAL__)
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/************************** Constant Definitions *****************************/
+#define XAIE_EVENT_WAIT_DEF_TIMEOUT_US		1000000U
+#define XAIE_EVENT_WAIT_IRQ_EVENT_ID		1U	/* IRQ17 of switch A */
+#define XAIE_EVENT_WAIT_IRQ_EVENT_BASE		16U
+#define XAIE_EVENT_WAIT_NUM_SWITCHES		2U
+#define XAIE_EVENT_WAIT_MAX_LOCKS		64U
+
+/**************************** Type Definitions *******************************/
+/* Interrupt path of a wait */
+typedef struct {
+	XAie_LocType Loc;
+	XAie_ModuleType Module;
+	XAie_LocType ShimLoc;
+	XAie_LocType L2Loc;
+	u32 L1Bits;		/* Status bits of both switches */
+	u8 NumSw;		/* 1 for shim events on switch A only */
+	u8 IsShim;
+	XAie_Events Event;	/* Event routed along the path */
+} XAie_EventWaitPath;
+
+struct XAie_EventWaiter {
+	XAie_DevInst *DevInst;
+	XAie_EventWaiterCfg Cfg;
+	XAie_UserRsc *BcRscs;	/* Broadcast channel held by the waiter */
+	u32 NumBcRscs;
+	u8 BroadcastId;
+	XAie_EventWaitPath *Armed;	/* Paths routed by XAie_EventWaiterArm() */
+	u32 NumArmed;
+	u32 MaxArmed;
+};
+
+/* Arguments of the conditions of the predefined waits */
+typedef struct {
+	XAie_LocType Loc;
+	u8 LockId;
+	u8 Value;
+	u8 ChNum;
+	XAie_DmaDirection Dir;
+} XAie_EventWaitArg;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the monotonic time of the host in microseconds.
+*
+* @return	Time in microseconds.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u64 _XAie_EventWaitNowUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * 1000000U + (u64)Ts.tv_nsec / 1000U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API finds the shim NoC tile whose second level interrupt controller
+* receives the first level interrupts of a shim tile. It is the tile itself
+* for a shim NoC tile, else the next shim NoC tile to the east, or the last
+* one to the west if there is none, as routed by XAie_ErrorHandlingInit().
+*
+* @param	DevInst: Device Instance
+* @param	ShimLoc: Location of the shim tile.
+* @param	L2Loc: Pointer to return the location of the shim NoC tile.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the partition has no NoC tile.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_EventWaitFindL2(XAie_DevInst *DevInst, XAie_LocType ShimLoc,
+		XAie_LocType *L2Loc)
+{
+	XAie_LocType Loc = ShimLoc;
+
+	for(; Loc.Col < DevInst->NumCols; Loc.Col++) {
+		if(_XAie_DevGetTTypefromLoc(DevInst, Loc) ==
+				XAIEGBL_TILE_TYPE_SHIMNOC) {
+			*L2Loc = Loc;
+			return XAIE_OK;
+		}
+	}
+
+	for(Loc.Col = ShimLoc.Col; Loc.Col > 0U; Loc.Col--) {
+		XAie_LocType West = XAie_TileLoc(Loc.Col - 1U, ShimLoc.Row);
+
+		if(_XAie_DevGetTTypefromLoc(DevInst, West) ==
+				XAIEGBL_TILE_TYPE_SHIMNOC) {
+			*L2Loc = West;
+			return XAIE_OK;
+		}
+	}
+
+	XAIE_ERROR("No second level interrupt controller in the partition\n");
+	return XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acknowledges the interrupt source of a waiter, as done by the error
+* dispatcher. A UIO device is re-armed, other sources are read as an eventfd
+* counter.
+*
+* @param	Waiter: Event waiter.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_EventWaitAckSrc(XAie_EventWaiter *Waiter)
+{
+	if(Waiter->Cfg.SrcIsUio != 0U) {
+		u32 Count, Enable = 1U;
+
+		if(read(Waiter->Cfg.SrcFd, &Count, sizeof(Count)) !=
+				(ssize_t)sizeof(Count)) {
+			return;
+		}
+		if(write(Waiter->Cfg.SrcFd, &Enable, sizeof(Enable)) !=
+				(ssize_t)sizeof(Enable)) {
+			XAIE_ERROR("Unable to re-enable UIO interrupt\n");
+		}
+	} else {
+		u64 Count;
+
+		(void)read(Waiter->Cfg.SrcFd, &Count, sizeof(Count));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acknowledges the interrupt of a wait in the interrupt controllers.
+* The first level status bits of the wait are cleared, and the second level
+* status of a switch is only cleared once its first level controller has no
+* other status pending, so the errors sharing the line are not lost.
+*
+* @param	DevInst: Device Instance
+* @param	Path: Interrupt path of the wait.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_EventWaitAck(XAie_DevInst *DevInst,
+		const XAie_EventWaitPath *Path)
+{
+	AieRC RC;
+	const XAie_L1IntrMod *L1IntrMod;
+	const XAie_L2IntrMod *L2IntrMod;
+	u64 L1Addr = _XAie_GetTileAddr(DevInst, Path->ShimLoc.Row,
+			Path->ShimLoc.Col);
+	u64 L2Addr = _XAie_GetTileAddr(DevInst, Path->L2Loc.Row,
+			Path->L2Loc.Col);
+	u32 L2Bits = 0U;
+
+	L1IntrMod = DevInst->DevProp.DevMod[_XAie_DevGetTTypefromLoc(DevInst,
+			Path->ShimLoc)].L1IntrMod;
+	L2IntrMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_SHIMNOC].L2IntrMod;
+
+	for(u8 Sw = 0U; Sw < Path->NumSw; Sw++) {
+		u64 RegAddr = L1Addr + L1IntrMod->BaseStatusRegOff +
+			Sw * L1IntrMod->SwOff;
+		u32 Status;
+
+		RC = XAie_Write32(DevInst, RegAddr, Path->L1Bits);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RC = XAie_Read32(DevInst, RegAddr, &Status);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		if(Status == 0U) {
+			L2Bits |= 1U << L1IntrMod->IntrCtrlL1IrqId(DevInst,
+					Path->ShimLoc, (XAie_BroadcastSw)Sw);
+		}
+	}
+
+	if(L2Bits == 0U) {
+		return XAIE_OK;
+	}
+
+	return XAie_Write32(DevInst, L2Addr + L2IntrMod->StatusRegOff, L2Bits);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API looks up the armed paths of a waiter sharing interrupt resources
+* with a path. A shim path shares the interrupt event of its shim tile with
+* other shim paths of the tile. A tile path shares the broadcast of its module
+* with other paths of the module, and the first level interrupt controller of
+* its column with other tile paths of the column.
+*
+* @param	Waiter: Event waiter.
+* @param	Path: Interrupt path.
+* @param	SameModule: XAIE_ENABLE to look for a path sharing the
+*		broadcast of the module or the interrupt event of the shim
+*		tile, XAIE_DISABLE to look for a tile path of the column.
+*
+* @return	Index of the armed path found, NumArmed if none.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u32 _XAie_EventWaitFindArmed(const XAie_EventWaiter *Waiter,
+		const XAie_EventWaitPath *Path, u8 SameModule)
+{
+	for(u32 i = 0U; i < Waiter->NumArmed; i++) {
+		const XAie_EventWaitPath *Armed = &Waiter->Armed[i];
+
+		if((Armed->IsShim != Path->IsShim) ||
+				(Armed->ShimLoc.Col != Path->ShimLoc.Col)) {
+			continue;
+		}
+
+		if((SameModule == XAIE_DISABLE) || (Path->IsShim ==
+				XAIE_ENABLE) || ((Armed->Loc.Row ==
+				Path->Loc.Row) && (Armed->Module ==
+				Path->Module))) {
+			return i;
+		}
+	}
+
+	return Waiter->NumArmed;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API computes the interrupt path of an event of a tile.
+*
+* @param	Waiter: Event waiter.
+* @param	Loc: Location of the tile generating the event.
+* @param	Module: Module of the tile generating the event.
+* @param	Event: Event routed along the path.
+* @param	Path: Pointer to return the interrupt path.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_EventWaitGetPath(XAie_EventWaiter *Waiter,
+		XAie_LocType Loc, XAie_ModuleType Module, XAie_Events Event,
+		XAie_EventWaitPath *Path)
+{
+	XAie_DevInst *DevInst = Waiter->DevInst;
+	u8 TileType;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	Path->Loc = Loc;
+	Path->Module = Module;
+	Path->Event = Event;
+	Path->ShimLoc = XAie_TileLoc(Loc.Col, DevInst->ShimRow);
+	if((TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
+			(TileType == XAIEGBL_TILE_TYPE_SHIMPL)) {
+		Path->IsShim = XAIE_ENABLE;
+		Path->NumSw = 1U;
+		Path->L1Bits = 1U << (XAIE_EVENT_WAIT_IRQ_EVENT_BASE +
+				XAIE_EVENT_WAIT_IRQ_EVENT_ID);
+	} else {
+		Path->IsShim = XAIE_DISABLE;
+		Path->NumSw = XAIE_EVENT_WAIT_NUM_SWITCHES;
+		Path->L1Bits = 1U << Waiter->BroadcastId;
+	}
+
+	return _XAie_EventWaitFindL2(DevInst, Path->ShimLoc, &Path->L2Loc);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API routes the event of a wait to the first level interrupt controller
+* of its shim tile, or removes the route.
+*
+* @param	Waiter: Event waiter.
+* @param	Path: Interrupt path of the wait.
+* @param	Event: Event waited for.
+* @param	Enable: XAIE_ENABLE to set up the route, XAIE_DISABLE to remove
+*		it.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The broadcast is blocked at the first level
+*		interrupt controller so that it does not travel along the shim
+*		row.
+*
+******************************************************************************/
+static AieRC _XAie_EventWaitRoute(XAie_EventWaiter *Waiter,
+		const XAie_EventWaitPath *Path, XAie_Events Event, u8 Enable)
+{
+	AieRC RC = XAIE_OK;
+	XAie_DevInst *DevInst = Waiter->DevInst;
+	u8 OwnTxn = XAIE_DISABLE;
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	if(Path->IsShim == XAIE_ENABLE) {
+		if(Enable == XAIE_ENABLE) {
+			RC = XAie_IntrCtrlL1Event(DevInst, Path->ShimLoc,
+					XAIE_EVENT_SWITCH_A,
+					XAIE_EVENT_WAIT_IRQ_EVENT_ID, Event);
+			RC |= XAie_IntrCtrlL1Enable(DevInst, Path->ShimLoc,
+					XAIE_EVENT_SWITCH_A,
+					XAIE_EVENT_WAIT_IRQ_EVENT_BASE +
+					XAIE_EVENT_WAIT_IRQ_EVENT_ID);
+		} else {
+			RC = XAie_IntrCtrlL1Disable(DevInst, Path->ShimLoc,
+					XAIE_EVENT_SWITCH_A,
+					XAIE_EVENT_WAIT_IRQ_EVENT_BASE +
+					XAIE_EVENT_WAIT_IRQ_EVENT_ID);
+			RC |= XAie_IntrCtrlL1Event(DevInst, Path->ShimLoc,
+					XAIE_EVENT_SWITCH_A,
+					XAIE_EVENT_WAIT_IRQ_EVENT_ID,
+					XAIE_EVENT_NONE_PL);
+		}
+	} else if(Enable == XAIE_ENABLE) {
+		for(u8 Sw = 0U; Sw < XAIE_EVENT_WAIT_NUM_SWITCHES; Sw++) {
+			RC |= XAie_IntrCtrlL1BroadcastBlock(DevInst,
+					Path->ShimLoc, (XAie_BroadcastSw)Sw,
+					Path->L1Bits);
+			RC |= XAie_IntrCtrlL1Enable(DevInst, Path->ShimLoc,
+					(XAie_BroadcastSw)Sw,
+					Waiter->BroadcastId);
+		}
+		RC |= XAie_EventBroadcast(DevInst, Path->Loc, Path->Module,
+				Waiter->BroadcastId, Event);
+	} else {
+		RC = XAie_EventBroadcastReset(DevInst, Path->Loc, Path->Module,
+				Waiter->BroadcastId);
+		/* Armed tiles of the column still use the broadcast */
+		for(u8 Sw = 0U; (Sw < XAIE_EVENT_WAIT_NUM_SWITCHES) &&
+				(_XAie_EventWaitFindArmed(Waiter, Path,
+					XAIE_DISABLE) == Waiter->NumArmed);
+				Sw++) {
+			RC |= XAie_IntrCtrlL1Disable(DevInst, Path->ShimLoc,
+					(XAie_BroadcastSw)Sw,
+					Waiter->BroadcastId);
+			RC |= XAie_IntrCtrlL1BroadcastUnblock(DevInst,
+					Path->ShimLoc, (XAie_BroadcastSw)Sw,
+					Path->L1Bits);
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to route event to the interrupt controller\n");
+		RC = XAIE_ERR;
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates an event waiter for a partition. The waiter holds a
+* broadcast channel of the whole partition, used by each wait to carry the
+* event to the shim row.
+*
+* @param	DevInst: Device Instance.
+* @param	Cfg: Waiter configuration.
+*
+* @return	Pointer to the waiter on success, NULL on failure.
+*
+* @note		The routing of the first level interrupts to the second level
+*		interrupt controllers has to be set up with
+*		XAie_ErrorHandlingInit(). The source fd is owned by the caller
+*		and has to stay open as long as the waiter; it must not be
+*		read by another waiter or an error dispatcher meanwhile.
+*
+******************************************************************************/
+XAie_EventWaiter* XAie_EventWaiterCreate(XAie_DevInst *DevInst,
+		const XAie_EventWaiterCfg *Cfg)
+{
+	XAie_EventWaiter *Waiter;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return NULL;
+	}
+
+	if((Cfg == NULL) || (Cfg->SrcFd < 0)) {
+		XAIE_ERROR("Invalid event waiter configuration\n");
+		return NULL;
+	}
+
+	Waiter = (XAie_EventWaiter *)calloc(1U, sizeof(*Waiter));
+	if(Waiter == NULL) {
+		XAIE_ERROR("Memory allocation for event waiter failed\n");
+		return NULL;
+	}
+
+	/* Enough entries for all the modules of every tile */
+	Waiter->NumBcRscs = 3U * DevInst->NumCols * DevInst->NumRows;
+	Waiter->BcRscs = (XAie_UserRsc *)malloc(Waiter->NumBcRscs *
+			sizeof(*Waiter->BcRscs));
+	if(Waiter->BcRscs == NULL) {
+		XAIE_ERROR("Memory allocation for event waiter failed\n");
+		free(Waiter);
+		return NULL;
+	}
+
+	RC = XAie_RequestBroadcastChannel(DevInst, &Waiter->NumBcRscs,
+			Waiter->BcRscs, XAIE_ENABLE);
+	if((RC != XAIE_OK) || (Waiter->NumBcRscs == 0U)) {
+		XAIE_ERROR("Unable to reserve broadcast channel for event waiter\n");
+		free(Waiter->BcRscs);
+		free(Waiter);
+		return NULL;
+	}
+
+	Waiter->DevInst = DevInst;
+	Waiter->Cfg = *Cfg;
+	Waiter->BroadcastId = (u8)Waiter->BcRscs[0].RscId;
+
+	return Waiter;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API blocks the calling thread until a condition is met, sleeping on the
+* interrupt of the partition between the checks. The event given is routed to
+* the interrupt controllers for the time of the wait and has to fire whenever
+* the condition may have become true. The condition is checked once the
+* route is set up, then after each interrupt.
+*
+* @param	Waiter: Event waiter.
+* @param	Loc: Location of the tile generating the event.
+* @param	Module: Module of the tile generating the event.
+* @param	Event: Event waking up the thread.
+* @param	Cond: Condition ending the wait.
+* @param	CondArg: Argument passed to Cond.
+* @param	TimeOutUs: Timeout in microseconds. 0 to use the default.
+*
+* @return	XAIE_OK once the condition is met, XAIE_ERR on timeout, error
+*		code on failure.
+*
+* @note		A waiter runs one wait at a time. This API cannot be called
+*		while a transaction is active on the calling thread, since the
+*		condition is read from the device.
+*
+******************************************************************************/
+AieRC XAie_EventWait(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Event,
+		XAie_EventWaitCond Cond, void *CondArg, u32 TimeOutUs)
+{
+	AieRC RC, RouteRC;
+	XAie_DevInst *DevInst;
+	XAie_EventWaitPath Path;
+	u64 Deadline;
+	u8 Met = XAIE_DISABLE;
+
+	if((Waiter == NULL) || (Cond == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	DevInst = Waiter->DevInst;
+	if(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE) {
+		XAIE_ERROR("Event wait cannot be recorded in a transaction\n");
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_EventWaitGetPath(Waiter, Loc, Module, Event, &Path);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(_XAie_EventWaitFindArmed(Waiter, &Path, XAIE_ENABLE) !=
+			Waiter->NumArmed) {
+		XAIE_ERROR("Event of the module is armed on the waiter\n");
+		return XAIE_ERR;
+	}
+
+	if(TimeOutUs == 0U) {
+		TimeOutUs = XAIE_EVENT_WAIT_DEF_TIMEOUT_US;
+	}
+	Deadline = _XAie_EventWaitNowUs() + TimeOutUs;
+
+	RC = _XAie_EventWaitRoute(Waiter, &Path, Event, XAIE_ENABLE);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	/* Drop an interrupt latched before the wait */
+	RC = _XAie_EventWaitAck(DevInst, &Path);
+
+	while(RC == XAIE_OK) {
+		struct pollfd Pfd;
+		u64 Now;
+		int Num;
+
+		RC = Cond(DevInst, CondArg, &Met);
+		if((RC != XAIE_OK) || (Met == XAIE_ENABLE)) {
+			break;
+		}
+
+		Now = _XAie_EventWaitNowUs();
+		if(Now >= Deadline) {
+			XAIE_DBG("Event wait timed out\n");
+			RC = XAIE_ERR;
+			break;
+		}
+
+		Pfd.fd = Waiter->Cfg.SrcFd;
+		Pfd.events = POLLIN;
+		Pfd.revents = 0;
+		Num = poll(&Pfd, 1U, (int)((Deadline - Now + 999U) / 1000U));
+		if(Num < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			XAIE_ERROR("Unable to wait for interrupt: %s\n",
+					strerror(errno));
+			RC = XAIE_ERR;
+			break;
+		}
+
+		if(Num > 0) {
+			_XAie_EventWaitAckSrc(Waiter);
+			RC = _XAie_EventWaitAck(DevInst, &Path);
+		}
+	}
+
+	RouteRC = _XAie_EventWaitRoute(Waiter, &Path, Event, XAIE_DISABLE);
+	if(RouteRC == XAIE_OK) {
+		RouteRC = _XAie_EventWaitAck(DevInst, &Path);
+	}
+
+	if(RC == XAIE_OK) {
+		RC = RouteRC;
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API arms an event of a tile on a waiter. The event is routed to the
+* interrupt controllers until it is disarmed, so that several events of the
+* partition can raise the interrupt slept on by XAie_EventWaiterSleep(). This
+* lets one thread wait for many events, checking its own conditions after
+* each interrupt.
+*
+* @param	Waiter: Event waiter.
+* @param	Loc: Location of the tile generating the event.
+* @param	Module: Module of the tile generating the event.
+* @param	Event: Event raising the interrupt.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		A module broadcasts one armed event at a time, and a shim
+*		tile maps one armed event at a time. The modules of the armed
+*		events cannot be waited for with XAie_EventWait() until they
+*		are disarmed.
+*
+******************************************************************************/
+AieRC XAie_EventWaiterArm(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		XAie_ModuleType Module, XAie_Events Event)
+{
+	XAie_EventWaitPath Path;
+	AieRC RC;
+
+	if(Waiter == NULL) {
+		XAIE_ERROR("Invalid event waiter\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_TxnIsActive(Waiter->DevInst) == XAIE_ENABLE) {
+		XAIE_ERROR("Event arm cannot be recorded in a transaction\n");
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_EventWaitGetPath(Waiter, Loc, Module, Event, &Path);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(_XAie_EventWaitFindArmed(Waiter, &Path, XAIE_ENABLE) !=
+			Waiter->NumArmed) {
+		XAIE_ERROR("Event of the module is already armed\n");
+		return XAIE_ERR;
+	}
+
+	if(Waiter->NumArmed == Waiter->MaxArmed) {
+		u32 Max = (Waiter->MaxArmed == 0U) ? 16U :
+			2U * Waiter->MaxArmed;
+		XAie_EventWaitPath *Armed;
+
+		Armed = (XAie_EventWaitPath *)realloc(Waiter->Armed,
+				Max * sizeof(*Armed));
+		if(Armed == NULL) {
+			XAIE_ERROR("Memory allocation for armed events failed\n");
+			return XAIE_ERR;
+		}
+		Waiter->Armed = Armed;
+		Waiter->MaxArmed = Max;
+	}
+
+	RC = _XAie_EventWaitRoute(Waiter, &Path, Event, XAIE_ENABLE);
+	if(RC == XAIE_OK) {
+		RC = _XAie_EventWaitAck(Waiter->DevInst, &Path);
+	}
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Waiter->Armed[Waiter->NumArmed++] = Path;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API disarms an event armed with XAie_EventWaiterArm() and removes its
+* route to the interrupt controllers.
+*
+* @param	Waiter: Event waiter.
+* @param	Loc: Location of the tile generating the event.
+* @param	Module: Module of the tile generating the event.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_EventWaiterDisarm(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		XAie_ModuleType Module)
+{
+	XAie_EventWaitPath Path;
+	AieRC RC;
+	u32 Idx;
+
+	if(Waiter == NULL) {
+		XAIE_ERROR("Invalid event waiter\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_TxnIsActive(Waiter->DevInst) == XAIE_ENABLE) {
+		XAIE_ERROR("Event disarm cannot be recorded in a transaction\n");
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_EventWaitGetPath(Waiter, Loc, Module, XAIE_EVENT_NONE_CORE,
+			&Path);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Idx = _XAie_EventWaitFindArmed(Waiter, &Path, XAIE_ENABLE);
+	if((Idx == Waiter->NumArmed) || (Waiter->Armed[Idx].Loc.Row !=
+				Loc.Row) || (Waiter->Armed[Idx].Module !=
+				Module)) {
+		XAIE_ERROR("No event of the module is armed\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* The path leaves the list first so that its column is not in use */
+	Path = Waiter->Armed[Idx];
+	Waiter->Armed[Idx] = Waiter->Armed[--Waiter->NumArmed];
+
+	RC = _XAie_EventWaitRoute(Waiter, &Path, Path.Event, XAIE_DISABLE);
+	if(RC == XAIE_OK) {
+		RC = _XAie_EventWaitAck(Waiter->DevInst, &Path);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sleeps on the interrupt of a waiter until it fires, a wake up file
+* descriptor gets readable or the timeout expires. The interrupt is
+* acknowledged for all the armed events, the caller then checks the
+* conditions it waits for.
+*
+* @param	Waiter: Event waiter.
+* @param	WakeFd: File descriptor waking up the sleep when readable, such
+*		as an eventfd written by another thread, -1 if none. It is not
+*		read by this API.
+* @param	TimeOutUs: Timeout in microseconds. 0 to check the interrupt
+*		without sleeping.
+* @param	Fired: Pointer to return XAIE_ENABLE if the interrupt fired.
+*
+* @return	XAIE_OK on success, also on timeout, error code on failure.
+*
+* @note		The interrupt is level sensitive in the controllers, an armed
+*		event firing between the checks of the caller raises it again.
+*
+******************************************************************************/
+AieRC XAie_EventWaiterSleep(XAie_EventWaiter *Waiter, int WakeFd,
+		u32 TimeOutUs, u8 *Fired)
+{
+	struct pollfd Pfds[2U];
+	AieRC RC = XAIE_OK;
+	nfds_t NumFds = 1U;
+	int Num;
+
+	if((Waiter == NULL) || (Fired == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	*Fired = XAIE_DISABLE;
+
+	Pfds[0U].fd = Waiter->Cfg.SrcFd;
+	Pfds[0U].events = POLLIN;
+	Pfds[0U].revents = 0;
+	if(WakeFd >= 0) {
+		Pfds[1U].fd = WakeFd;
+		Pfds[1U].events = POLLIN;
+		Pfds[1U].revents = 0;
+		NumFds++;
+	}
+
+	Num = poll(Pfds, NumFds, (int)((TimeOutUs + 999U) / 1000U));
+	if(Num < 0) {
+		if(errno == EINTR) {
+			return XAIE_OK;
+		}
+		XAIE_ERROR("Unable to wait for interrupt: %s\n",
+				strerror(errno));
+		return XAIE_ERR;
+	}
+
+	if((Num == 0) || ((Pfds[0U].revents & POLLIN) == 0)) {
+		return XAIE_OK;
+	}
+
+	*Fired = XAIE_ENABLE;
+	_XAie_EventWaitAckSrc(Waiter);
+	for(u32 i = 0U; (i < Waiter->NumArmed) && (RC == XAIE_OK); i++) {
+		RC = _XAie_EventWaitAck(Waiter->DevInst, &Waiter->Armed[i]);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks the done bit of a core for XAie_EventWaitCoreDone().
+*
+* @param	DevInst: Device Instance.
+* @param	Arg: Wait arguments.
+* @param	Met: Pointer to return XAIE_ENABLE if the core is done.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_EventWaitCoreDoneCond(XAie_DevInst *DevInst, void *Arg,
+		u8 *Met)
+{
+	XAie_EventWaitArg *WaitArg = (XAie_EventWaitArg *)Arg;
+
+	return XAie_CoreReadDoneBit(DevInst, WaitArg->Loc, Met);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks the value of a lock for XAie_EventWaitLockValue().
+*
+* @param	DevInst: Device Instance.
+* @param	Arg: Wait arguments.
+* @param	Met: Pointer to return XAIE_ENABLE if the lock has the value.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_EventWaitLockCond(XAie_DevInst *DevInst, void *Arg,
+		u8 *Met)
+{
+	XAie_EventWaitArg *WaitArg = (XAie_EventWaitArg *)Arg;
+	u8 Values[XAIE_EVENT_WAIT_MAX_LOCKS];
+	u32 NumValues = XAIE_EVENT_WAIT_MAX_LOCKS;
+	AieRC RC;
+
+	RC = XAie_LockGetValues(DevInst, WaitArg->Loc, Values, &NumValues);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	*Met = (Values[WaitArg->LockId] == WaitArg->Value) ? XAIE_ENABLE :
+		XAIE_DISABLE;
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks the pending BDs of a DMA channel for
+* XAie_EventWaitDmaDone().
+*
+* @param	DevInst: Device Instance.
+* @param	Arg: Wait arguments.
+* @param	Met: Pointer to return XAIE_ENABLE if no BD is pending.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_EventWaitDmaCond(XAie_DevInst *DevInst, void *Arg,
+		u8 *Met)
+{
+	XAie_EventWaitArg *WaitArg = (XAie_EventWaitArg *)Arg;
+	u8 PendingBd;
+	AieRC RC;
+
+	RC = XAie_DmaGetPendingBdCount(DevInst, WaitArg->Loc, WaitArg->ChNum,
+			WaitArg->Dir, &PendingBd);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	*Met = (PendingBd == 0U) ? XAIE_ENABLE : XAIE_DISABLE;
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits for a core to be done, woken up by the interrupt raised when
+* the core gets disabled.
+*
+* @param	Waiter: Event waiter.
+* @param	Loc: Location of the AIE tile.
+* @param	TimeOutUs: Timeout in microseconds. 0 to use the default.
+*
+* @return	XAIE_OK once the core is done, XAIE_ERR on timeout, error code
+*		on failure.
+*
+* @note		The core must be running when the wait starts, a core which
+*		was never enabled keeps interrupting until it is.
+*
+******************************************************************************/
+AieRC XAie_EventWaitCoreDone(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		u32 TimeOutUs)
+{
+	XAie_EventWaitArg Arg;
+
+	if(Waiter == NULL) {
+		XAIE_ERROR("Invalid event waiter\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_DevGetTTypefromLoc(Waiter->DevInst, Loc) !=
+			XAIEGBL_TILE_TYPE_AIETILE) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	Arg.Loc = Loc;
+	return XAie_EventWait(Waiter, Loc, XAIE_CORE_MOD,
+			XAIE_EVENT_DISABLED_CORE, _XAie_EventWaitCoreDoneCond,
+			&Arg, TimeOutUs);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits for a lock to hold a value, woken up by the interrupt raised
+* by a lock event of the tile.
+*
+* @param	Waiter: Event waiter.
+* @param	Loc: Location of the tile of the lock.
+* @param	Event: Lock event of the memory module of the tile, or of the PL
+*		module for a shim tile, fired when the lock may reach the
+*		value, such as the release of the lock.
+* @param	LockId: Lock index.
+* @param	Value: Lock value waited for.
+* @param	TimeOutUs: Timeout in microseconds. 0 to use the default.
+*
+* @return	XAIE_OK once the lock holds the value, XAIE_ERR on timeout,
+*		error code on failure.
+*
+* @note		The lock events depend on the device, hence the caller picks
+*		the event.
+*
+******************************************************************************/
+AieRC XAie_EventWaitLockValue(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		XAie_Events Event, u8 LockId, u8 Value, u32 TimeOutUs)
+{
+	XAie_EventWaitArg Arg;
+	XAie_ModuleType Module = XAIE_MEM_MOD;
+	const XAie_LockMod *LockMod;
+	u8 TileType;
+
+	if(Waiter == NULL) {
+		XAIE_ERROR("Invalid event waiter\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(Waiter->DevInst, Loc);
+	if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
+			(TileType == XAIEGBL_TILE_TYPE_MAX)) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	LockMod = Waiter->DevInst->DevProp.DevMod[TileType].LockMod;
+	if((LockMod == NULL) || (LockId >= XAIE_EVENT_WAIT_MAX_LOCKS) ||
+			(LockId >= LockMod->NumLocks)) {
+		XAIE_ERROR("Invalid lock ID\n");
+		return XAIE_INVALID_LOCK_ID;
+	}
+
+	if(TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+		Module = XAIE_PL_MOD;
+	}
+
+	Arg.Loc = Loc;
+	Arg.LockId = LockId;
+	Arg.Value = Value;
+	return XAie_EventWait(Waiter, Loc, Module, Event,
+			_XAie_EventWaitLockCond, &Arg, TimeOutUs);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits for a DMA channel to have no BD pending, woken up by the
+* interrupt raised when the channel finishes a BD.
+*
+* @param	Waiter: Event waiter.
+* @param	Loc: Location of the AIE tile or shim NoC tile.
+* @param	ChNum: Channel number, 0 or 1.
+* @param	Dir: Direction of the channel.
+* @param	TimeOutUs: Timeout in microseconds. 0 to use the default.
+*
+* @return	XAIE_OK once the channel is done, XAIE_ERR on timeout, error
+*		code on failure.
+*
+* @note		The DMA events of the memory tiles are selected per channel,
+*		use XAie_EventWait() with the selected event for them.
+*
+******************************************************************************/
+AieRC XAie_EventWaitDmaDone(XAie_EventWaiter *Waiter, XAie_LocType Loc,
+		u8 ChNum, XAie_DmaDirection Dir, u32 TimeOutUs)
+{
+	XAie_EventWaitArg Arg;
+	XAie_ModuleType Module;
+	XAie_Events Event;
+	u8 TileType, EventOff;
+
+	if(Waiter == NULL) {
+		XAIE_ERROR("Invalid event waiter\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((ChNum > 1U) || (Dir >= DMA_MAX)) {
+		XAIE_ERROR("Invalid DMA channel\n");
+		return XAIE_INVALID_CHANNEL_NUM;
+	}
+
+	/* The finished BD events are ordered S2MM 0, S2MM 1, MM2S 0, MM2S 1 */
+	EventOff = ((Dir == DMA_MM2S) ? 2U : 0U) + ChNum;
+
+	TileType = _XAie_DevGetTTypefromLoc(Waiter->DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+		Module = XAIE_MEM_MOD;
+		Event = (XAie_Events)(XAIE_EVENT_DMA_S2MM_0_FINISHED_BD_MEM +
+				EventOff);
+	} else if(TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+		Module = XAIE_PL_MOD;
+		Event = (XAie_Events)(XAIE_EVENT_DMA_S2MM_0_FINISHED_BD_PL +
+				EventOff);
+	} else {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	Arg.Loc = Loc;
+	Arg.ChNum = ChNum;
+	Arg.Dir = Dir;
+	return XAie_EventWait(Waiter, Loc, Module, Event,
+			_XAie_EventWaitDmaCond, &Arg, TimeOutUs);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks the end of a timer wait for XAie_EventWaitCycles().
+*
+* @param	DevInst: Device Instance.
+* @param	Arg: Timer wait handle.
+* @param	Met: Pointer to return XAIE_ENABLE if the wait is over.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_EventWaitCyclesCond(XAie_DevInst *DevInst, void *Arg,
+		u8 *Met)
+{
+	return XAie_WaitCyclesPoll(DevInst, (XAie_TimerWait *)Arg, Met);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API blocks until a wait started with XAie_WaitCyclesStart() is over,
+* woken up by the interrupt raised by the timer value reached event.
+*
+* @param	Waiter: Event waiter.
+* @param	Wait: Timer wait handle.
+* @param	TimeOutUs: Timeout in microseconds. 0 to use the default.
+*
+* @return	XAIE_OK once the wait is over, XAIE_ERR on timeout, error code
+*		on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_EventWaitCycles(XAie_EventWaiter *Waiter, XAie_TimerWait *Wait,
+		u32 TimeOutUs)
+{
+	if((Waiter == NULL) || (Wait == NULL) ||
+			(Wait->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid event waiter or timer wait\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_EventWait(Waiter, Wait->Loc, Wait->Module, Wait->Event,
+			_XAie_EventWaitCyclesCond, Wait, TimeOutUs);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases an event waiter and its broadcast channel. The events
+* still armed are disarmed.
+*
+* @param	Waiter: Event waiter.
+*
+* @return	None.
+*
+* @note		The source fd is owned by the caller and left open.
+*
+******************************************************************************/
+void XAie_EventWaiterFree(XAie_EventWaiter *Waiter)
+{
+	if(Waiter == NULL) {
+		return;
+	}
+
+	while(Waiter->NumArmed > 0U) {
+		const XAie_EventWaitPath *Path =
+			&Waiter->Armed[Waiter->NumArmed - 1U];
+		u32 NumArmed = Waiter->NumArmed;
+
+		if(XAie_EventWaiterDisarm(Waiter, Path->Loc, Path->Module) !=
+				XAIE_OK) {
+			XAIE_ERROR("Unable to disarm event of the waiter\n");
+			Waiter->NumArmed = NumArmed - 1U;
+		}
+	}
+	free(Waiter->Armed);
+
+	if(XAie_ReleaseBroadcastChannel(Waiter->DevInst, Waiter->NumBcRscs,
+				Waiter->BcRscs) != XAIE_OK) {
+		XAIE_ERROR("Unable to release event waiter broadcast channel\n");
+	}
+
+	free(Waiter->BcRscs);
+	free(Waiter);
+}
+
+#endif /* XAIE_FEATURE_INTR_INIT_ENABLE && XAIE_FEATURE_RSC_ENABLE */
+
+/** @} */
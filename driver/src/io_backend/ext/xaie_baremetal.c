@@ -46,49 +46,57 @@
 typedef struct {
 	u64 BaseAddr;
 	u64 NpiBaseAddr;
+	XAie_DevInst *DevInst;
+	XAie_PollCfg PollCfg;
 } XAie_BaremetalIO;
 
 /************************** Variable Definitions *****************************/
-static XAie_BaremetalIO BaremetalIO;
-
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
 *
-* This is the memory IO function to free the global IO instance
+* This is the memory IO function to free the IO instance
 *
 * @param	IOInst: IO Instance pointer.
 *
-* @return	None.
+* @return	XAIE_OK.
 *
-* @note		The global IO instance is a singleton and freed when
-* the reference count reaches a zero. Internal only.
+* @note		Internal only.
 *
 *******************************************************************************/
 static AieRC XAie_BaremetalIO_Finish(void *IOInst)
 {
-	(void)IOInst;
+	free(IOInst);
 	return XAIE_OK;
 }
 
 /*****************************************************************************/
 /**
 *
-* This is the memory IO function to initialize the global IO instance
+* This is the memory IO function to initialize the IO instance
 *
 * @param	DevInst: Device instance pointer.
 *
 * @return	XAIE_OK on success. Error code on failure.
 *
-* @note		Internal only.
+* @note		Each device instance owns its IO instance, so partitions can be
+*		driven in parallel. Internal only.
 *
 *******************************************************************************/
 static AieRC XAie_BaremetalIO_Init(XAie_DevInst *DevInst)
 {
-	XAie_BaremetalIO *IOInst = &BaremetalIO;
+	XAie_BaremetalIO *IOInst;
+
+	IOInst = (XAie_BaremetalIO *)malloc(sizeof(*IOInst));
+	if(IOInst == NULL) {
+		XAIE_ERROR("Initialization failed. Failed to allocate memory.\n");
+		return XAIE_ERR;
+	}
 
 	IOInst->BaseAddr = DevInst->BaseAddr;
 	IOInst->NpiBaseAddr = XAIE_NPI_BASEADDR;
+	IOInst->DevInst = DevInst;
+	_XAie_IOCommon_InitPollCfg(&IOInst->PollCfg);
 	DevInst->IOInst = IOInst;
 
 	return XAIE_OK;
@@ -192,32 +200,10 @@ static AieRC XAie_BaremetalIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_BaremetalIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value, u32 TimeOutUs)
 {
-	AieRC Ret = XAIE_ERR;
-	u32 Count, MinTimeOutUs, RegVal;
-
-	/*
-	 * Any value less than 200 us becomes noticable overhead. This is based
-	 * on some profiling, and it may vary between platforms.
-	 */
-	MinTimeOutUs = 200;
-	Count = ((u64)TimeOutUs + MinTimeOutUs - 1) / MinTimeOutUs;
-
-	while (Count > 0U) {
-		XAie_BaremetalIO_Read32(IOInst, RegOff, &RegVal);
-		if((RegVal & Mask) == Value) {
-			return XAIE_OK;
-		}
-		usleep(MinTimeOutUs);
-		Count--;
-	}
-
-	/* Check for the break from timed-out loop */
-	XAie_BaremetalIO_Read32(IOInst, RegOff, &RegVal);
-	if((RegVal & Mask) == Value) {
-		Ret = XAIE_OK;
-	}
+	XAie_BaremetalIO *BaremetalIOInst = (XAie_BaremetalIO *)IOInst;
 
-	return Ret;
+	return _XAie_IOCommon_MaskPoll(IOInst, XAie_BaremetalIO_Read32,
+			&BaremetalIOInst->PollCfg, RegOff, Mask, Value, TimeOutUs);
 }
 
 /*****************************************************************************/
@@ -238,6 +224,16 @@ static AieRC XAie_BaremetalIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_BaremetalIO_BlockWrite32(void *IOInst, u64 RegOff,
 		const u32 *Data, u32 Size)
 {
+	XAie_BaremetalIO *BaremetalIOInst = (XAie_BaremetalIO *)IOInst;
+
+	if(_XAie_IOCommon_IsTileMem(BaremetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_CopyToDev((void *)(UINTPTR)
+				(BaremetalIOInst->BaseAddr + RegOff), Data,
+				Size);
+		return XAIE_OK;
+	}
+
 	for(u32 i = 0U; i < Size; i++) {
 		XAie_BaremetalIO_Write32(IOInst, RegOff + i * 4U, *Data);
 		Data++;
@@ -265,12 +261,57 @@ static AieRC XAie_BaremetalIO_BlockWrite32(void *IOInst, u64 RegOff,
 static AieRC XAie_BaremetalIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 		u32 Size)
 {
+	XAie_BaremetalIO *BaremetalIOInst = (XAie_BaremetalIO *)IOInst;
+
+	if(_XAie_IOCommon_IsTileMem(BaremetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_SetDev((void *)(UINTPTR)
+				(BaremetalIOInst->BaseAddr + RegOff), Data,
+				Size);
+		return XAIE_OK;
+	}
+
 	for(u32 i = 0U; i < Size; i++)
 		XAie_BaremetalIO_Write32(IOInst, RegOff+ i * 4U, Data);
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_BaremetalIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_BaremetalIO *BaremetalIOInst = (XAie_BaremetalIO *)IOInst;
+
+	if(_XAie_IOCommon_IsTileMem(BaremetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_CopyFromDev(Data, (const void *)(UINTPTR)
+				(BaremetalIOInst->BaseAddr + RegOff), Size);
+		return XAIE_OK;
+	}
+
+	for(u32 i = 0U; i < Size; i++) {
+		Data[i] = Xil_In32(BaremetalIOInst->BaseAddr + RegOff +
+				i * 4U);
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -372,6 +413,36 @@ static AieRC XAie_BaremetalMemSyncForDev(XAie_MemInst *MemInst)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory function to sync ranges of memory for CPU or for device.
+*
+* @param	Ranges: Array of ranges to sync.
+* @param	NumRanges: Number of ranges.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. Only the cache lines of the ranges are
+*		maintained.
+*
+*******************************************************************************/
+static AieRC XAie_BaremetalMemSyncRanges(const XAie_MemSyncRange *Ranges,
+		u32 NumRanges)
+{
+	for(u32 i = 0U; i < NumRanges; i++) {
+		u64 Addr = (u64)Ranges[i].MemInst->VAddr + Ranges[i].Offset;
+
+		if(Ranges[i].Dir == XAIE_MEM_SYNC_FOR_CPU) {
+			Xil_DCacheInvalidateRange(Addr, Ranges[i].Size);
+		} else {
+			Xil_DCacheFlushRange(Addr, Ranges[i].Size);
+		}
+	}
+
+	return XAIE_OK;
+}
+
 static AieRC XAie_BaremetalMemAttach(XAie_MemInst *MemInst, u64 MemHandle)
 {
 	(void)MemInst;
@@ -513,6 +584,11 @@ static AieRC XAie_BaremetalIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 					Req->NpiRegOff, Req->Mask, Req->Val,
 					Req->TimeOutUs);
 		}
+		case XAIE_BACKEND_OP_NPI_REQ_LIST:
+			return _XAie_IOCommon_NpiReqList(IOInst,
+					(XAie_BackendNpiReqList *)Arg,
+					_XAie_BaremetalIO_NpiWrite32,
+					_XAie_BaremetalIO_NpiMaskPoll);
 		case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
 		{
 			XAie_ShimDmaBdArgs *BdArgs =
@@ -535,11 +611,14 @@ static AieRC XAie_BaremetalIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			return _XAie_FreeRscCommon(Arg);
 		case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
 			return _XAie_RequestAllocatedRscCommon(DevInst, Arg);
+		case XAIE_BACKEND_OP_REQUEST_RSC_BATCH:
+			return _XAie_RequestRscBatchCommon(DevInst, Arg);
 		case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
 			return _XAie_PrivilegeInitPart(DevInst,
 					(XAie_PartInitOpts *)Arg);
 		case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
-			return _XAie_PrivilegeTeardownPart(DevInst);
+			return _XAie_PrivilegeTeardownPart(DevInst,
+					(const u32 *)Arg);
 		case XAIE_BACKEND_OP_GET_RSC_STAT:
 			return _XAie_GetRscStatCommon(DevInst, Arg);
 		case XAIE_BACKEND_OP_UPDATE_NPI_ADDR:
@@ -549,6 +628,13 @@ static AieRC XAie_BaremetalIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			BaremetalIOInst->NpiBaseAddr = *((u64 *)Arg);
 			break;
 		}
+		case XAIE_BACKEND_OP_CONFIG_POLL:
+		{
+			XAie_BaremetalIO *BaremetalIOInst =
+				(XAie_BaremetalIO *)IOInst;
+			BaremetalIOInst->PollCfg = *((XAie_PollCfg *)Arg);
+			break;
+		}
 		default:
 			XAIE_ERROR("Baremetal backend doesn't support operation"
 					" %d\n", Op);
@@ -643,6 +729,18 @@ static AieRC XAie_BaremetalIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 	return XAIE_ERR;
 }
 
+static AieRC XAie_BaremetalIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
 static XAie_MemInst* XAie_BaremetalMemAllocate(XAie_DevInst *DevInst, u64 Size,
 		XAie_MemCacheProp Cache)
 {
@@ -670,6 +768,14 @@ static AieRC XAie_BaremetalMemSyncForDev(XAie_MemInst *MemInst)
 	return XAIE_ERR;
 }
 
+static AieRC XAie_BaremetalMemSyncRanges(const XAie_MemSyncRange *Ranges,
+		u32 NumRanges)
+{
+	(void)Ranges;
+	(void)NumRanges;
+	return XAIE_ERR;
+}
+
 static AieRC XAie_BaremetalMemAttach(XAie_MemInst *MemInst, u64 MemHandle)
 {
 	(void)MemInst;
@@ -721,12 +827,14 @@ const XAie_Backend BaremetalBackend =
 	.Ops.MaskPoll = XAie_BaremetalIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_BaremetalIO_BlockWrite32,
 	.Ops.BlockSet32 = XAie_BaremetalIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_BaremetalIO_BlockRead32,
 	.Ops.CmdWrite = XAie_BaremetalIO_CmdWrite,
 	.Ops.RunOp = XAie_BaremetalIO_RunOp,
 	.Ops.MemAllocate = XAie_BaremetalMemAllocate,
 	.Ops.MemFree = XAie_BaremetalMemFree,
 	.Ops.MemSyncForCPU = XAie_BaremetalMemSyncForCPU,
 	.Ops.MemSyncForDev = XAie_BaremetalMemSyncForDev,
+	.Ops.MemSyncRanges = XAie_BaremetalMemSyncRanges,
 	.Ops.MemAttach = XAie_BaremetalMemAttach,
 	.Ops.MemDetach = XAie_BaremetalMemDetach,
 	.Ops.GetTid = XAie_IODummyGetTid,
@@ -38,17 +38,131 @@
 #include "xaie_io_common.h"
 #include "xaie_io_privilege.h"
 #include "xaie_npi.h"
+#include "xaie_txn.h"
 
 /************************** Constant Definitions *****************************/
 /****************************** Type Definitions *****************************/
 typedef struct {
 	u64 BaseAddr;
 	u64 NpiBaseAddr;
+	u32 *WcBuf;	/* Words of the pending run of consecutive writes */
+	u32 WcDepth;	/* Capacity of WcBuf in words, 0 if disabled */
+	u32 WcNumWords;	/* Number of words in the pending run */
+	u64 WcAddr;	/* Register offset of the first word of the run */
 } XAie_CdoIO;
 
 /************************** Function Definitions *****************************/
 #ifdef __AIECDO__
 
+/*****************************************************************************/
+/**
+*
+* This function emits the pending run of consecutive register writes as one
+* CDO command.
+*
+* @param	IOInst: CDO IO instance pointer
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_CdoIO_WcFlush(XAie_CdoIO *IOInst)
+{
+	if(IOInst->WcNumWords == 1U) {
+		cdo_Write32(IOInst->BaseAddr + IOInst->WcAddr,
+				IOInst->WcBuf[0U]);
+	} else if(IOInst->WcNumWords > 1U) {
+		cdo_BlockWrite32(IOInst->BaseAddr + IOInst->WcAddr,
+				IOInst->WcBuf, IOInst->WcNumWords);
+	}
+
+	IOInst->WcNumWords = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds register writes to the pending run. Writes which do not
+* continue the run at the next address emit the run and start a new one.
+*
+* @param	IOInst: CDO IO instance pointer
+* @param	RegOff: Register offset of the first word.
+* @param	Data: Pointer to the words to write.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_CdoIO_WcWrite(XAie_CdoIO *IOInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	while(Size > 0U) {
+		u32 Len;
+
+		if((IOInst->WcNumWords != 0U) && (RegOff != IOInst->WcAddr +
+					IOInst->WcNumWords * 4U)) {
+			_XAie_CdoIO_WcFlush(IOInst);
+		}
+		if(IOInst->WcNumWords == 0U) {
+			IOInst->WcAddr = RegOff;
+		}
+
+		Len = IOInst->WcDepth - IOInst->WcNumWords;
+		if(Len > Size) {
+			Len = Size;
+		}
+		memcpy(&IOInst->WcBuf[IOInst->WcNumWords], Data,
+				Len * sizeof(u32));
+		IOInst->WcNumWords += Len;
+		if(IOInst->WcNumWords == IOInst->WcDepth) {
+			_XAie_CdoIO_WcFlush(IOInst);
+		}
+
+		RegOff += Len * 4U;
+		Data += Len;
+		Size -= Len;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function configures the number of words the pending run of
+* consecutive writes can hold.
+*
+* @param	IOInst: CDO IO instance pointer
+* @param	Depth: Pointer to the number of words, 0 disables write
+*		combining.
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		Internal only. The pending run is emitted first.
+*
+*******************************************************************************/
+static AieRC _XAie_CdoIO_ConfigWc(XAie_CdoIO *IOInst, u32 *Depth)
+{
+	u32 *Buf = NULL;
+
+	if(*Depth != 0U) {
+		Buf = (u32 *)malloc(sizeof(*Buf) * (*Depth));
+		if(Buf == NULL) {
+			XAIE_ERROR("Failed to allocate write combining "
+					"buffer\n");
+			return XAIE_ERR;
+		}
+	}
+
+	_XAie_CdoIO_WcFlush(IOInst);
+	free(IOInst->WcBuf);
+	IOInst->WcBuf = Buf;
+	IOInst->WcDepth = *Depth;
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -64,6 +178,10 @@ typedef struct {
 *******************************************************************************/
 static AieRC XAie_CdoIO_Finish(void *IOInst)
 {
+	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
+
+	_XAie_CdoIO_WcFlush(CdoIOInst);
+	free(CdoIOInst->WcBuf);
 	free(IOInst);
 	return XAIE_OK;
 }
@@ -92,6 +210,10 @@ static AieRC XAie_CdoIO_Init(XAie_DevInst *DevInst)
 
 	IOInst->BaseAddr = DevInst->BaseAddr;
 	IOInst->NpiBaseAddr = XAIE_NPI_BASEADDR;
+	IOInst->WcBuf = NULL;
+	IOInst->WcDepth = 0U;
+	IOInst->WcNumWords = 0U;
+	IOInst->WcAddr = 0U;
 	DevInst->IOInst = IOInst;
 
 	return XAIE_OK;
@@ -116,6 +238,11 @@ static AieRC XAie_CdoIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 {
 	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
 
+	if(CdoIOInst->WcDepth != 0U) {
+		_XAie_CdoIO_WcWrite(CdoIOInst, RegOff, &Value, 1U);
+		return XAIE_OK;
+	}
+
 	cdo_Write32(CdoIOInst->BaseAddr + RegOff, Value);
 
 	return XAIE_OK;
@@ -166,6 +293,8 @@ static AieRC XAie_CdoIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value)
 {
 	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
+
+	_XAie_CdoIO_WcFlush(CdoIOInst);
 	cdo_MaskWrite32(CdoIOInst->BaseAddr + RegOff, Mask, Value);
 
 	return XAIE_OK;
@@ -192,6 +321,8 @@ static AieRC XAie_CdoIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
 		u32 TimeOutUs)
 {
 	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
+
+	_XAie_CdoIO_WcFlush(CdoIOInst);
 	/* Round up to msec */
 	cdo_MaskPoll(CdoIOInst->BaseAddr + RegOff, Mask, Value,
 			(TimeOutUs + 999) / 1000);
@@ -219,6 +350,11 @@ static AieRC XAie_CdoIO_BlockWrite32(void *IOInst, u64 RegOff, const u32 *Data,
 {
 	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
 
+	if(CdoIOInst->WcDepth != 0U) {
+		_XAie_CdoIO_WcWrite(CdoIOInst, RegOff, Data, Size);
+		return XAIE_OK;
+	}
+
 	cdo_BlockWrite32(CdoIOInst->BaseAddr + RegOff, Data, Size);
 
 	return XAIE_OK;
@@ -245,11 +381,37 @@ static AieRC XAie_CdoIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data, u32 Size)
 {
 	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
 
+	_XAie_CdoIO_WcFlush(CdoIOInst);
 	cdo_BlockSet32(CdoIOInst->BaseAddr + RegOff, Data, Size);
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_CdoIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		XAie_CdoIO_Read32(IOInst, RegOff + i * 4U, &Data[i]);
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -271,6 +433,7 @@ static void _XAie_CdoIO_NpiWrite32(void *IOInst, u32 RegOff, u32 RegVal)
 	u64 RegAddr;
 
 	RegAddr = CdoIOInst->NpiBaseAddr + RegOff;
+	_XAie_CdoIO_WcFlush(CdoIOInst);
 	cdo_Write32(RegAddr, RegVal);
 	return;
 }
@@ -296,6 +459,8 @@ static AieRC _XAie_CdoIO_NpiMaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value, u32 TimeOutUs)
 {
 	XAie_CdoIO *CdoIOInst = (XAie_CdoIO *)IOInst;
+
+	_XAie_CdoIO_WcFlush(CdoIOInst);
 	/* Round up to msec */
 	cdo_MaskPoll(CdoIOInst->NpiBaseAddr + RegOff, Mask, Value,
 			(TimeOutUs + 999) / 1000);
@@ -339,6 +504,11 @@ static AieRC XAie_CdoIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			return _XAie_CdoIO_NpiMaskPoll(IOInst, Req->NpiRegOff,
 					Req->Mask, Req->Val, Req->TimeOutUs);
 		}
+		case XAIE_BACKEND_OP_NPI_REQ_LIST:
+			return _XAie_IOCommon_NpiReqList(IOInst,
+					(XAie_BackendNpiReqList *)Arg,
+					_XAie_CdoIO_NpiWrite32,
+					_XAie_CdoIO_NpiMaskPoll);
 		case XAIE_BACKEND_OP_ASSERT_SHIMRST:
 		{
 			u8 RstEnable = (u8)((uintptr_t)Arg & 0xFF);
@@ -371,11 +541,14 @@ static AieRC XAie_CdoIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			return _XAie_FreeRscCommon(Arg);
 		case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
 			return _XAie_RequestAllocatedRscCommon(DevInst, Arg);
+		case XAIE_BACKEND_OP_REQUEST_RSC_BATCH:
+			return _XAie_RequestRscBatchCommon(DevInst, Arg);
 		case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
 			return _XAie_PrivilegeInitPart(DevInst,
 					(XAie_PartInitOpts *)Arg);
 		case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
-			return _XAie_PrivilegeTeardownPart(DevInst);
+			return _XAie_PrivilegeTeardownPart(DevInst,
+					(const u32 *)Arg);
 		case XAIE_BACKEND_OP_GET_RSC_STAT:
 			return _XAie_GetRscStatCommon(DevInst, Arg);
 		case XAIE_BACKEND_OP_UPDATE_NPI_ADDR:
@@ -384,6 +557,11 @@ static AieRC XAie_CdoIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			CdoIOInst->NpiBaseAddr = *((u64 *)Arg);
 			break;
 		}
+		case XAIE_BACKEND_OP_CONFIG_WRITE_COMBINE:
+			return _XAie_CdoIO_ConfigWc(IOInst, (u32 *)Arg);
+		case XAIE_BACKEND_OP_FLUSH_WRITES:
+			_XAie_CdoIO_WcFlush(IOInst);
+			break;
 		default:
 			XAIE_ERROR("CDO backend doesn't support operation"
 					" %u.\n", Op);
@@ -394,6 +572,137 @@ static AieRC XAie_CdoIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 	return RC;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API converts the commands of a transaction instance to CDO commands, so
+* a transaction recorded once can be submitted to the device and written to a
+* boot time CDO without running the configuration again with the CDO backend.
+* Plain writes and block writes to consecutive registers are coalesced into
+* block writes of up to WcDepth words, like with XAie_ConfigWriteCombine() on
+* the CDO backend.
+*
+* @param	DevInst: Device instance pointer, the CDO addresses are based on
+*		its partition base address.
+* @param	TxnInst: Exported or loaded transaction instance.
+* @param	WcDepth: Maximum number of words of a coalesced block write, 0
+*		to emit the commands as they are.
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		The CDO commands are emitted to the CDO opened by the caller
+*		with the CDO runtime. Deferred reads cannot be converted, and
+*		memory syncs have no CDO equivalent and are dropped.
+*
+*******************************************************************************/
+AieRC XAie_TxnExportCdo(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 WcDepth)
+{
+	XAie_CdoIO IOInst;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(TxnInst == XAIE_NULL) {
+		XAIE_ERROR("Invalid transaction instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		if(TxnInst->CmdBuf[i].Opcode == XAIE_IO_READ) {
+			XAIE_ERROR("Transactions with deferred reads cannot be "
+					"converted to CDO\n");
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	IOInst.BaseAddr = DevInst->BaseAddr;
+	IOInst.NpiBaseAddr = XAIE_NPI_BASEADDR;
+	IOInst.WcBuf = NULL;
+	IOInst.WcDepth = 0U;
+	IOInst.WcNumWords = 0U;
+	IOInst.WcAddr = 0U;
+	if(_XAie_CdoIO_ConfigWc(&IOInst, &WcDepth) != XAIE_OK) {
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		u64 Addr = IOInst.BaseAddr + Cmd->RegOff;
+
+		if((IOInst.WcDepth != 0U) && (Cmd->Mask == 0U) &&
+				((Cmd->Opcode == XAIE_IO_WRITE) ||
+				 (Cmd->Opcode == XAIE_IO_BLOCKWRITE))) {
+			if(Cmd->Opcode == XAIE_IO_WRITE) {
+				_XAie_CdoIO_WcWrite(&IOInst, Cmd->RegOff,
+						&Cmd->Value, 1U);
+			} else {
+				_XAie_CdoIO_WcWrite(&IOInst, Cmd->RegOff,
+					(const u32 *)(uintptr_t)Cmd->DataPtr,
+					Cmd->Size);
+			}
+			continue;
+		}
+
+		if((IOInst.WcDepth != 0U) &&
+				(Cmd->Opcode == XAIE_IO_SHIMDMABD)) {
+			const XAie_ShimDmaBdArgs *Args =
+				(const XAie_ShimDmaBdArgs *)(uintptr_t)
+				Cmd->DataPtr;
+
+			_XAie_CdoIO_WcWrite(&IOInst, Args->Addr, Args->BdWords,
+					Args->NumBdWords);
+			continue;
+		}
+
+		_XAie_CdoIO_WcFlush(&IOInst);
+		switch(Cmd->Opcode) {
+		case XAIE_IO_WRITE:
+			if(Cmd->Mask == 0U) {
+				cdo_Write32(Addr, Cmd->Value);
+			} else {
+				cdo_MaskWrite32(Addr, Cmd->Mask, Cmd->Value);
+			}
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			cdo_BlockWrite32(Addr,
+					(const u32 *)(uintptr_t)Cmd->DataPtr,
+					Cmd->Size);
+			break;
+		case XAIE_IO_BLOCKSET:
+			cdo_BlockSet32(Addr, Cmd->Value, Cmd->Size);
+			break;
+		case XAIE_IO_MASKPOLL:
+			/* Round up to msec */
+			cdo_MaskPoll(Addr, Cmd->Mask, Cmd->Value,
+					(Cmd->Size + 999U) / 1000U);
+			break;
+		case XAIE_IO_SHIMDMABD:
+		{
+			const XAie_ShimDmaBdArgs *Args =
+				(const XAie_ShimDmaBdArgs *)(uintptr_t)
+				Cmd->DataPtr;
+
+			for(u8 j = 0U; j < Args->NumBdWords; j++) {
+				cdo_Write32(IOInst.BaseAddr + Args->Addr +
+						j * 4U, Args->BdWords[j]);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	_XAie_CdoIO_WcFlush(&IOInst);
+	free(IOInst.WcBuf);
+
+	return XAIE_OK;
+}
+
 #else
 
 static AieRC XAie_CdoIO_Finish(void *IOInst)
@@ -479,6 +788,18 @@ static AieRC XAie_CdoIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data, u32 Size)
 	return XAIE_ERR;
 }
 
+static AieRC XAie_CdoIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
 static AieRC XAie_CdoIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		     XAie_BackendOpCode Op, void *Arg)
 {
@@ -489,6 +810,15 @@ static AieRC XAie_CdoIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
 
+AieRC XAie_TxnExportCdo(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst,
+		u32 WcDepth)
+{
+	(void)DevInst;
+	(void)TxnInst;
+	(void)WcDepth;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
 #endif /* __AIECDO__ */
 
 static AieRC XAie_CdoIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
@@ -557,12 +887,14 @@ const XAie_Backend CdoBackend =
 	.Ops.MaskPoll = XAie_CdoIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_CdoIO_BlockWrite32,
 	.Ops.BlockSet32 = XAie_CdoIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_CdoIO_BlockRead32,
 	.Ops.CmdWrite = XAie_CdoIO_CmdWrite,
 	.Ops.RunOp = XAie_CdoIO_RunOp,
 	.Ops.MemAllocate = XAie_CdoMemAllocate,
 	.Ops.MemFree = XAie_CdoMemFree,
 	.Ops.MemSyncForCPU = XAie_CdoMemSyncForCPU,
 	.Ops.MemSyncForDev = XAie_CdoMemSyncForDev,
+	.Ops.MemSyncRanges = NULL,
 	.Ops.MemAttach = XAie_CdoMemAttach,
 	.Ops.MemDetach = XAie_CdoMemDetach,
 	.Ops.GetTid = XAie_IODummyGetTid,
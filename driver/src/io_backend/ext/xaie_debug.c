@@ -23,13 +23,16 @@
 ******************************************************************************/
 /***************************** Include Files *********************************/
 #ifdef __linux__
+#define  _POSIX_C_SOURCE 200112L
 #include <pthread.h>
+#include <time.h>
 #endif
 #include <stdio.h>
 #include <stdlib.h>
 
 #include "xaie_helper.h"
 #include "xaie_io.h"
+#include "xaie_iorecord.h"
 #include "xaie_io_common.h"
 #include "xaie_io_privilege.h"
 #include "xaie_npi.h"
@@ -38,9 +41,79 @@
 typedef struct {
 	u64 BaseAddr;
 	u64 NpiBaseAddr;
+	XAie_IORecordRing *Ring;	/* Ring of records, NULL to print */
+	u32 RecIdx;			/* Index of the next record */
 } XAie_DebugIO;
 
 /************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This function stores a register access in the ring of records.
+*
+* @param	IOInst: Debug IO instance pointer
+* @param	Op: Recorded access, XAie_IORecordOp.
+* @param	RegOff: Register offset of the access.
+* @param	Mask: Mask of the access.
+* @param	Value: Value of the access.
+* @param	Size: Number of words or timeout of the access.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_DebugIO_Record(XAie_DebugIO *IOInst, u8 Op, u64 RegOff,
+		u32 Mask, u32 Value, u32 Size)
+{
+	XAie_IORecordRing *Ring = IOInst->Ring;
+	XAie_IORecord *Rec = &Ring->Records[IOInst->RecIdx];
+#ifdef __linux__
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	Rec->TimeStamp = (u64)Ts.tv_sec * 1000000000U + (u64)Ts.tv_nsec;
+#else
+	Rec->TimeStamp = 0U;
+#endif
+	Rec->RegOff = RegOff;
+	Rec->Value = Value;
+	Rec->Mask = Mask;
+	Rec->Size = Size;
+	Rec->Op = Op;
+
+	IOInst->RecIdx++;
+	if(IOInst->RecIdx == Ring->NumRecords) {
+		IOInst->RecIdx = 0U;
+	}
+	Ring->NumWritten++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts or stops recording the register accesses.
+*
+* @param	IOInst: Debug IO instance pointer
+* @param	Ring: Ring of records, NULL to go back to printing.
+*
+* @return	XAIE_OK.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_DebugIO_ConfigRecord(XAie_DebugIO *IOInst,
+		XAie_IORecordRing *Ring)
+{
+	if(Ring != NULL) {
+		Ring->NumWritten = 0U;
+	}
+	IOInst->Ring = Ring;
+	IOInst->RecIdx = 0U;
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -84,6 +157,8 @@ static AieRC XAie_DebugIO_Init(XAie_DevInst *DevInst)
 
 	IOInst->BaseAddr = DevInst->BaseAddr;
 	IOInst->NpiBaseAddr = XAIE_NPI_BASEADDR;
+	IOInst->Ring = NULL;
+	IOInst->RecIdx = 0U;
 	DevInst->IOInst = IOInst;
 
 	return XAIE_OK;
@@ -107,6 +182,12 @@ static AieRC XAie_DebugIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 {
 	XAie_DebugIO *DebugIOInst = (XAie_DebugIO *)IOInst;
 
+	if(DebugIOInst->Ring != NULL) {
+		_XAie_DebugIO_Record(DebugIOInst, XAIE_IO_RECORD_WRITE, RegOff,
+				0U, Value, 1U);
+		return XAIE_OK;
+	}
+
 	printf("W: %p, 0x%x\n", (void *) DebugIOInst->BaseAddr + RegOff, Value);
 
 	return XAIE_OK;
@@ -131,6 +212,12 @@ static AieRC XAie_DebugIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 	XAie_DebugIO *DebugIOInst = (XAie_DebugIO *)IOInst;
 
 	*Data = 0U;
+	if(DebugIOInst->Ring != NULL) {
+		_XAie_DebugIO_Record(DebugIOInst, XAIE_IO_RECORD_READ, RegOff,
+				0U, 0U, 1U);
+		return XAIE_OK;
+	}
+
 	printf("R: %p, 0x%x\n", (void *) DebugIOInst->BaseAddr + RegOff, 0);
 
 	return XAIE_OK;
@@ -157,6 +244,12 @@ static AieRC XAie_DebugIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 {
 	XAie_DebugIO *DebugIOInst = (XAie_DebugIO *)IOInst;
 
+	if(DebugIOInst->Ring != NULL) {
+		_XAie_DebugIO_Record(DebugIOInst, XAIE_IO_RECORD_MASKWRITE,
+				RegOff, Mask, Value, 1U);
+		return XAIE_OK;
+	}
+
 	printf("MW: %p, 0x%x, 0x%x\n", (void *) DebugIOInst->BaseAddr + RegOff,
 			Mask, Value);
 
@@ -184,6 +277,12 @@ static AieRC XAie_DebugIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value
 {
 	XAie_DebugIO *DebugIOInst = (XAie_DebugIO *)IOInst;
 
+	if(DebugIOInst->Ring != NULL) {
+		_XAie_DebugIO_Record(DebugIOInst, XAIE_IO_RECORD_MASKPOLL,
+				RegOff, Mask, Value, TimeOutUs);
+		return XAIE_ERR;
+	}
+
 	printf("MP: %p, 0x%x, 0x%x, 0x%d\n", (void *) DebugIOInst->BaseAddr +
 			RegOff, Mask, Value, TimeOutUs);
 
@@ -235,12 +334,45 @@ static AieRC XAie_DebugIO_BlockWrite32(void *IOInst, u64 RegOff,
 static AieRC XAie_DebugIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 		u32 Size)
 {
+	XAie_DebugIO *DebugIOInst = (XAie_DebugIO *)IOInst;
+
+	if(DebugIOInst->Ring != NULL) {
+		_XAie_DebugIO_Record(DebugIOInst, XAIE_IO_RECORD_BLOCKSET,
+				RegOff, 0U, Data, Size);
+		return XAIE_OK;
+	}
+
 	for(u32 i = 0U; i < Size; i++)
 		XAie_DebugIO_Write32(IOInst, RegOff+ i * 4U, Data);
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_DebugIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		XAie_DebugIO_Read32(IOInst, RegOff + i * 4U, &Data[i]);
+	}
+
+	return XAIE_OK;
+}
+
 static AieRC XAie_DebugIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
 		u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
 {
@@ -276,6 +408,12 @@ static void _XAie_DebugIO_NpiWrite32(void *IOInst, u32 RegOff,
 	XAie_DebugIO *DebugIOInst = (XAie_DebugIO *)IOInst;
 	u64 RegAddr;
 
+	if(DebugIOInst->Ring != NULL) {
+		_XAie_DebugIO_Record(DebugIOInst, XAIE_IO_RECORD_NPIWRITE,
+				RegOff, 0U, RegVal, 1U);
+		return;
+	}
+
 	RegAddr = DebugIOInst->NpiBaseAddr + RegOff;
 	printf("NPIMW: %p, 0x%x\n", (void *) RegAddr, RegVal);
 }
@@ -301,6 +439,12 @@ static AieRC _XAie_DebugIO_NpiMaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 {
 	XAie_DebugIO *DebugIOInst = (XAie_DebugIO *)IOInst;
 
+	if(DebugIOInst->Ring != NULL) {
+		_XAie_DebugIO_Record(DebugIOInst, XAIE_IO_RECORD_NPIMASKPOLL,
+				RegOff, Mask, Value, TimeOutUs);
+		return XAIE_OK;
+	}
+
 	printf("MP: %p, 0x%x, 0x%x, 0x%d\n", (void *) DebugIOInst->NpiBaseAddr +
 			RegOff, Mask, Value, TimeOutUs);
 
@@ -345,6 +489,11 @@ static AieRC XAie_DebugIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			return _XAie_DebugIO_NpiMaskPoll(IOInst, Req->NpiRegOff,
 					Req->Mask, Req->Val, Req->TimeOutUs);
 		}
+		case XAIE_BACKEND_OP_NPI_REQ_LIST:
+			return _XAie_IOCommon_NpiReqList(IOInst,
+					(XAie_BackendNpiReqList *)Arg,
+					_XAie_DebugIO_NpiWrite32,
+					_XAie_DebugIO_NpiMaskPoll);
 		case XAIE_BACKEND_OP_ASSERT_SHIMRST:
 		{
 			u8 RstEnable = (u8)((uintptr_t)Arg & 0xFF);
@@ -378,13 +527,19 @@ static AieRC XAie_DebugIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			return _XAie_FreeRscCommon(Arg);
 		case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
 			return _XAie_RequestAllocatedRscCommon(DevInst, Arg);
+		case XAIE_BACKEND_OP_REQUEST_RSC_BATCH:
+			return _XAie_RequestRscBatchCommon(DevInst, Arg);
 		case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
 			return _XAie_PrivilegeInitPart(DevInst,
 					(XAie_PartInitOpts *)Arg);
 		case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
-			return _XAie_PrivilegeTeardownPart(DevInst);
+			return _XAie_PrivilegeTeardownPart(DevInst,
+					(const u32 *)Arg);
 		case XAIE_BACKEND_OP_GET_RSC_STAT:
 			return _XAie_GetRscStatCommon(DevInst, Arg);
+		case XAIE_BACKEND_OP_CONFIG_IO_RECORD:
+			return _XAie_DebugIO_ConfigRecord(IOInst,
+					(XAie_IORecordRing *)Arg);
 		default:
 			XAIE_ERROR("Debug backend doesn't support operation"
 					" %u.\n", Op);
@@ -533,12 +688,14 @@ const XAie_Backend DebugBackend =
 	.Ops.MaskPoll = XAie_DebugIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_DebugIO_BlockWrite32,
 	.Ops.BlockSet32 = XAie_DebugIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_DebugIO_BlockRead32,
 	.Ops.CmdWrite = XAie_DebugIO_CmdWrite,
 	.Ops.RunOp = XAie_DebugIO_RunOp,
 	.Ops.MemAllocate = XAie_DebugMemAllocate,
 	.Ops.MemFree = XAie_DebugMemFree,
 	.Ops.MemSyncForCPU = XAie_DebugMemSyncForCPU,
 	.Ops.MemSyncForDev = XAie_DebugMemSyncForDev,
+	.Ops.MemSyncRanges = NULL,
 	.Ops.MemAttach = XAie_DebugMemAttach,
 	.Ops.MemDetach = XAie_DebugMemDetach,
 	.Ops.GetTid = XAie_DebugGetTid,
@@ -22,53 +22,148 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#ifndef __AIEBAREMETAL__
+#define  _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef __AIEBAREMETAL__
+#include "sleep.h"
+#else
+#include <time.h>
+#endif
 
 #include "xaie_feature_config.h"
 #include "xaie_io.h"
 #include "xaie_helper.h"
+#include "xaie_io_common.h"
 #include "xaie_rsc_internal.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 /*****************************************************************************/
 /***************************** Macro Definitions *****************************/
 #define XAIE_BROADCAST_CHANNEL_MASK     0xFFFFU
+#define XAIE_BROADCAST_CHANNEL_BITS     16U
+
+/* Copies to device memory are done with 128-bit stores when possible */
+#define XAIE_IO_COPY_VEC_WORDS		4U
+#define XAIE_IO_COPY_VEC_ALIGN_MASK	0xFU
+/* Copies of at least this many words use non-temporal stores */
+#define XAIE_IO_COPY_STREAM_MIN_WORDS	0x1000U
 
 /************************** Function Definitions *****************************/
 #ifdef XAIE_FEATURE_RSC_ENABLE
 /*****************************************************************************/
 /**
-* This API finds free resource after checking static and runtime allocated
-* resource status in bitmap.
+* This API returns the free resources of a word of a tile, after checking the
+* static and runtime allocated halves of the bitmap.
+*
+* @param	Bitmap: Bitmap of the resource
+* @param	StaticBitmapOffset: Offset for static bitmap
+* @param	Pos: Index of the first resource bit in the runtime bitmap
+* @param	NumBits: Number of resources, from 1 to 32
+*
+* @return	Bitmask with bit i set if resource Pos + i is free.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u32 _XAie_GetFreeRscWord(const u32 *Bitmap,
+		u32 StaticBitmapOffset, u32 Pos, u32 NumBits)
+{
+	u32 Used = _XAie_GetBitmapWord(Bitmap, Pos, NumBits) |
+		_XAie_GetBitmapWord(Bitmap, Pos + StaticBitmapOffset, NumBits);
+
+	return ~Used & XAIE_RSC_WORD_MASK(NumBits);
+}
+
+/*****************************************************************************/
+/**
+* This API finds free resources after checking static and runtime allocated
+* resource status in bitmap. The bitmap is scanned a word at a time, in the
+* order of the allocation policy.
 *
 * @param	Bitmap: Bitmap of the resource
 * @param	StaticBitmapOffset: Offset for static bitmap
 * @param	StartBit: Index for the resource start bit in the bitmap
 * @param	MaxRscVal: Number of resource per tile
-* @param	Index: Pointer to store free resource found
+* @param	NumRscs: Number of free resources to find
+* @param	Index: Array to store the free resources found
+* @param	Policy: Allocation policy, XAie_RscPolicy
+* @param	PreferMask: Ids below 32 to find first with the common free
+*			    policy
 *
-* @return	XAIE_OK on success.
+* @return	XAIE_OK on success, XAIE_ERR if less than NumRscs are free.
 *
 * @note		Internal only.
 *
 *******************************************************************************/
 static AieRC _XAie_FindAvailableRsc(u32 *Bitmap, u32 StaticBitmapOffset,
-		u32 StartBit, u32 MaxRscVal, u32 *Index)
+		u32 StartBit, u32 MaxRscVal, u32 NumRscs, u32 *Index,
+		u8 Policy, u32 PreferMask)
 {
-	for(u32 i = StartBit; i < StartBit + MaxRscVal; i++) {
-		if(!((CheckBit(Bitmap, i)) |
-				CheckBit(Bitmap, (i + StaticBitmapOffset)))) {
-			*Index = i - StartBit;
-			return XAIE_OK;
+	u32 Found = 0U, NumWords, Taken = 0U;
+
+	if((Policy == XAIE_RSC_POLICY_COMMON_FREE) && (PreferMask != 0U)) {
+		u32 NumBits = (MaxRscVal < XAIE_RSC_WORD_BITS) ? MaxRscVal :
+			XAIE_RSC_WORD_BITS;
+		u32 Free = _XAie_GetFreeRscWord(Bitmap, StaticBitmapOffset,
+				StartBit, NumBits) & PreferMask;
+
+		while((Free != 0U) && (Found < NumRscs)) {
+			Index[Found] = _XAie_CountTrailingZeros32(Free);
+			Taken |= 1U << Index[Found++];
+			Free &= Free - 1U;
 		}
 	}
 
-	return XAIE_ERR;
+	NumWords = (MaxRscVal + XAIE_RSC_WORD_BITS - 1U) / XAIE_RSC_WORD_BITS;
+	for(u32 w = 0U; (w < NumWords) && (Found < NumRscs); w++) {
+		u32 Off, NumBits, Free;
+
+		if(Policy == XAIE_RSC_POLICY_HIGHEST) {
+			Off = (NumWords - 1U - w) * XAIE_RSC_WORD_BITS;
+		} else {
+			Off = w * XAIE_RSC_WORD_BITS;
+		}
+		NumBits = MaxRscVal - Off;
+		if(NumBits > XAIE_RSC_WORD_BITS) {
+			NumBits = XAIE_RSC_WORD_BITS;
+		}
+
+		Free = _XAie_GetFreeRscWord(Bitmap, StaticBitmapOffset,
+				StartBit + Off, NumBits);
+		if(Off == 0U) {
+			Free &= ~Taken;
+		}
+		while((Free != 0U) && (Found < NumRscs)) {
+			u32 Bit;
+
+			if(Policy == XAIE_RSC_POLICY_HIGHEST) {
+				Bit = _XAie_GetLastSetBit32(Free);
+			} else {
+				Bit = _XAie_CountTrailingZeros32(Free);
+			}
+			Index[Found++] = Off + Bit;
+			Free &= ~(1U << Bit);
+		}
+	}
+
+	return (Found == NumRscs) ? XAIE_OK : XAIE_ERR;
 }
 
 /*****************************************************************************/
 /**
 * This API finds free resource after checking static and runtime allocated
-* resource status in bitmap. This API checks for contiguous free bits.
+* resource status in bitmap. This API checks for contiguous free bits, aligned
+* to the run length and to an even index. The runs are found a word at a time
+* by folding the free bits onto the first bit of each run.
 *
 * @param	Bitmap: Bitmap of the resource
 * @param	SBmOff: Offset for static bitmap
@@ -79,33 +174,52 @@ static AieRC _XAie_FindAvailableRsc(u32 *Bitmap, u32 StaticBitmapOffset,
 *
 * @return	XAIE_OK on success.
 *
-* @note		Internal only.
+* @note		Internal only. Only PC and combo events are allocated in
+*		contiguous runs.
 *
 *******************************************************************************/
 static AieRC _XAie_FindAvailableRscContig(u32 *Bitmap, u32 SBmOff,
 		u32 StartBit, u32 MaxRscVal, u32 *Index, u8 NumContigRscs,
 		XAie_RscType RscType)
 {
-	for(u32 i = StartBit; i < StartBit + MaxRscVal; i += NumContigRscs) {
-		u32 j;
-
-		if(!((CheckBit(Bitmap, i)) |
-				CheckBit(Bitmap, (i + SBmOff)))) {
-			*Index = i - StartBit;
-			for(j = i + 1; j < i + NumContigRscs; j++) {
-				if (CheckBit(Bitmap, j) ||
-						CheckBit(Bitmap, (j + SBmOff))) {
-					break;
-				}
-			}
+	u32 Align, Step, AlignMask = 0U;
 
-			if(j == (i + NumContigRscs)) {
-				if ((RscType == XAIE_PC_EVENTS_RSC ||
-					  RscType == XAIE_COMBO_EVENTS_RSC) &&
-					  *Index % 2 == 0) {
-					return XAIE_OK;
-				}
-			}
+	if(((RscType != XAIE_PC_EVENTS_RSC) &&
+			(RscType != XAIE_COMBO_EVENTS_RSC)) ||
+			(NumContigRscs == 0U) ||
+			(NumContigRscs > XAIE_RSC_WORD_BITS)) {
+		return XAIE_ERR;
+	}
+
+	Align = ((NumContigRscs % 2U) == 0U) ? NumContigRscs :
+		2U * NumContigRscs;
+	for(u32 i = 0U; i < XAIE_RSC_WORD_BITS; i += Align) {
+		AlignMask |= 1U << i;
+	}
+
+	/*
+	 * Consecutive words overlap so that runs crossing a word boundary are
+	 * found, and each word starts on an aligned index.
+	 */
+	Step = ((XAIE_RSC_WORD_BITS - NumContigRscs) / Align + 1U) * Align;
+	for(u32 Off = 0U; Off < MaxRscVal; Off += Step) {
+		u32 NumBits = MaxRscVal - Off;
+		u32 Free, Runs;
+
+		if(NumBits > XAIE_RSC_WORD_BITS) {
+			NumBits = XAIE_RSC_WORD_BITS;
+		}
+
+		Free = _XAie_GetFreeRscWord(Bitmap, SBmOff, StartBit + Off,
+				NumBits);
+		Runs = Free & AlignMask;
+		for(u32 k = 1U; (k < NumContigRscs) && (Runs != 0U); k++) {
+			Runs &= Free >> k;
+		}
+
+		if(Runs != 0U) {
+			*Index = Off + _XAie_CountTrailingZeros32(Runs);
+			return XAIE_OK;
 		}
 	}
 
@@ -123,6 +237,8 @@ static AieRC _XAie_FindAvailableRscContig(u32 *Bitmap, u32 SBmOff,
 * @param	NumRscPerTile: Number of resource requested per tile
 * @param	MaxRscVal: Maximum number of resource per tile
 * @param	RscArrPerTile: Pointer to store available resource
+* @param	Policy: Allocation policy, XAie_RscPolicy
+* @param	PreferMask: Ids to grant first with the common free policy
 *
 * @return	XAIE_OK on success.
 *
@@ -131,20 +247,16 @@ static AieRC _XAie_FindAvailableRscContig(u32 *Bitmap, u32 SBmOff,
 *******************************************************************************/
 static AieRC _XAie_RequestRsc(u32 *Bitmap, u32 StartBit,
 		u32 StaticBitmapOffset, u32 NumRscPerTile, u32 MaxRscVal,
-		u32 *RscArrPerTile)
+		u32 *RscArrPerTile, u8 Policy, u32 PreferMask)
 {
 	AieRC RC;
 
 	/* Check for the requested resource in the bitmap locally */
-	for(u32 i = 0; i < NumRscPerTile; i++) {
-		u32 Index;
-		RC = _XAie_FindAvailableRsc(Bitmap, StaticBitmapOffset,
-				StartBit, MaxRscVal, &Index);
-		if (RC != XAIE_OK) {
-			return XAIE_ERR;
-		}
-
-		RscArrPerTile[i] = Index;
+	RC = _XAie_FindAvailableRsc(Bitmap, StaticBitmapOffset, StartBit,
+			MaxRscVal, NumRscPerTile, RscArrPerTile, Policy,
+			PreferMask);
+	if (RC != XAIE_OK) {
+		return XAIE_ERR;
 	}
 
 	for(u32 i = 0; i < NumRscPerTile; i++) {
@@ -187,17 +299,19 @@ AieRC _XAie_RequestRscContig(u32 *Bitmaps, u32 StartBit,
 				StartBit, MaxRscVal, &Index, NumContigRscs,
 				RscType);
 		if (RC != XAIE_OK) {
+			/* Release the runs granted so far */
+			for(u32 j = 0U; j < i; j++) {
+				_XAie_ClrBitInBitmap(Bitmaps,
+						RscArrPerTile[j] + StartBit, 1U);
+			}
 			return XAIE_ERR;
 		}
 
+		/* Mark the run so the next one is searched past it */
 		for(u8 j = 0U; j < NumContigRscs; j++) {
 			RscArrPerTile[i + j] = Index + j;
 		}
-	}
-
-	/* Set the bit as allocated if the request was successful*/
-	for(u32 i = 0U; i < NumRscPerTile; i++) {
-		_XAie_SetBitInBitmap(Bitmaps, RscArrPerTile[i] + StartBit, 1U);
+		_XAie_SetBitInBitmap(Bitmaps, Index + StartBit, NumContigRscs);
 	}
 
 	return XAIE_OK;
@@ -223,14 +337,13 @@ AieRC _XAie_RequestRscContig(u32 *Bitmaps, u32 StartBit,
 static u32 _XAie_GetChannelStatusPerMod(u32 *Bitmap, u32 StaticBitmapOffset,
 		u32 StartBit, u8 StaticAllocCheckFlag)
 {
-	u32 Size = sizeof(Bitmap[0]) * 8U;
-	u32 ChannelStatus = (XAIE_BROADCAST_CHANNEL_MASK &
-			(Bitmap[StartBit / Size] >> (StartBit % Size)));
+	u32 ChannelStatus = _XAie_GetBitmapWord(Bitmap, StartBit,
+			XAIE_BROADCAST_CHANNEL_BITS);
 
 	if (StaticAllocCheckFlag) {
-		return ChannelStatus | (XAIE_BROADCAST_CHANNEL_MASK &
-			(Bitmap[(StartBit  + StaticBitmapOffset) / Size] >>
-			((StartBit + StaticBitmapOffset) % Size)));
+		return ChannelStatus | _XAie_GetBitmapWord(Bitmap,
+				StartBit + StaticBitmapOffset,
+				XAIE_BROADCAST_CHANNEL_BITS);
 	}
 
 	return ChannelStatus;
@@ -246,23 +359,26 @@ static u32 _XAie_GetChannelStatusPerMod(u32 *Bitmap, u32 StaticBitmapOffset,
 * @param        Rscs: pointer to UserRsc array
 * @param        StaticAllocCheckFlag: 1 - To check static and runtime bitmap
 *                                     0 - To check runtime bitmap only
+* @param        ChannelMask: Channels to check
 *
-* @return       XAIE_OK on success and XAIE_ERR on failure.
+* @return       Bitmask of the channels of ChannelMask busy on any tile.
 *
-* @note         Internal only.
+* @note         Internal only. The tiles are no longer visited once all the
+*		channels of ChannelMask are found busy.
 *
 *******************************************************************************/
 static u32 _XAie_GetCommonChannelStatus(XAie_DevInst *DevInst, u32 *UserRscNum,
-		XAie_UserRsc *Rscs, u8 StaticAllocCheckFlag)
+		XAie_UserRsc *Rscs, u8 StaticAllocCheckFlag, u32 ChannelMask)
 {
 	u8 TileType;
 	u32 ChannelStatus = 0, TotalRscs = *UserRscNum;
 	u32 *Bitmap;
 	XAie_BitmapOffsets Offsets;
 
-	for(u32 i = 0; i < TotalRscs; i++) {
+	for(u32 i = 0; (i < TotalRscs) &&
+			((ChannelStatus & ChannelMask) != ChannelMask); i++) {
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Rscs[i].Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Rscs[i].Loc);
 		Bitmap = DevInst->RscMapping[TileType].
 				Bitmaps[XAIE_BCAST_CHANNEL_RSC];
 		_XAie_RscMgr_GetBitmapOffsets(DevInst, XAIE_BCAST_CHANNEL_RSC,
@@ -272,7 +388,7 @@ static u32 _XAie_GetCommonChannelStatus(XAie_DevInst *DevInst, u32 *UserRscNum,
 				StaticAllocCheckFlag);
 	}
 
-	return ChannelStatus;
+	return ChannelStatus & ChannelMask;
 }
 
 /*****************************************************************************/
@@ -283,27 +399,30 @@ static u32 _XAie_GetCommonChannelStatus(XAie_DevInst *DevInst, u32 *UserRscNum,
 * @param        MaxRscVal: Max number of channels
 * @param        ChannelStatus: Common broadcast channel status
 * @param        ChannelIndex: Pointer to store common broadcast channel
+* @param        Policy: Allocation policy, XAie_RscPolicy
 *
 * @return       XAIE_OK on success and XAIE_ERR on failure.
 *
-* @note         Internal only.
+* @note         Internal only. A broadcast channel is always common to the
+*		tiles, so the common free policy picks the lowest channel.
 *
 *******************************************************************************/
 static AieRC _XAie_FindCommonChannel(u32 MaxRscVal, u32 ChannelStatus,
-		                u32 *ChannelIndex)
+		                u32 *ChannelIndex, u8 Policy)
 {
-	u32 i;
+	u32 Free = ~ChannelStatus & XAIE_RSC_WORD_MASK(MaxRscVal);
 
-	for(i = 0; i < MaxRscVal; i++) {
-		if(ChannelStatus & 1U) {
-			ChannelStatus >>= 1U;
-		} else {
-			*ChannelIndex = i;
-			return XAIE_OK;
-		}
+	if(Free == 0U) {
+		return XAIE_ERR;
 	}
 
-	return XAIE_ERR;
+	if(Policy == XAIE_RSC_POLICY_HIGHEST) {
+		*ChannelIndex = _XAie_GetLastSetBit32(Free);
+	} else {
+		*ChannelIndex = _XAie_CountTrailingZeros32(Free);
+	}
+
+	return XAIE_OK;
 }
 
 /*****************************************************************************/
@@ -323,10 +442,15 @@ static AieRC _XAie_FindCommonChannel(u32 MaxRscVal, u32 ChannelStatus,
 AieRC _XAie_RequestSpecificBroadcastChannel(XAie_DevInst *DevInst,
 		                XAie_BackendTilesRsc *Args)
 {
-	u32 ChannelStatus;
-
-	ChannelStatus = _XAie_GetCommonChannelStatus(DevInst, Args->UserRscNum,
-			                        Args->Rscs, XAIE_DISABLE);
+	u32 ChannelStatus = 0U;
+
+	/* A channel unused across the partition needs no per tile check */
+	if((_XAie_RscMgr_GetBcChannelsInUse(DevInst) &
+				(1U << Args->RscId)) != 0U) {
+		ChannelStatus = _XAie_GetCommonChannelStatus(DevInst,
+				Args->UserRscNum, Args->Rscs, XAIE_DISABLE,
+				1U << Args->RscId);
+	}
 	if(ChannelStatus & (1U << Args->RscId)) {
 		 XAIE_ERROR("Broadcast Channel:%d busy\n", Args->RscId);
 		 return XAIE_ERR;
@@ -357,12 +481,17 @@ static AieRC _XAie_RequestBroadcastChannelRscCommon(XAie_DevInst *DevInst,
 		                XAie_BackendTilesRsc *Args)
 {
 	AieRC RC;
-	u32 ChannelStatus, ChannelIndex;
-
-	ChannelStatus = _XAie_GetCommonChannelStatus(DevInst, Args->UserRscNum,
-			                Args->Rscs, XAIE_ENABLE);
+	u32 ChannelStatus, ChannelIndex, ChannelMask;
+
+	ChannelMask = _XAie_RscMgr_GetBcCheckMask(DevInst, Args->Policy);
+	ChannelStatus = 0U;
+	if(ChannelMask != 0U) {
+		ChannelStatus = _XAie_GetCommonChannelStatus(DevInst,
+				Args->UserRscNum, Args->Rscs, XAIE_ENABLE,
+				ChannelMask);
+	}
 	RC = _XAie_FindCommonChannel(XAIE_NUM_BROADCAST_CHANNELS,
-			                ChannelStatus, &ChannelIndex);
+			                ChannelStatus, &ChannelIndex, Args->Policy);
 	if(RC != XAIE_OK) {
 		XAIE_ERROR("Unable to find common channel for broadcast\n");
 		return RC;
@@ -392,12 +521,14 @@ static AieRC _XAie_RequestBroadcastChannelRscCommon(XAie_DevInst *DevInst,
 AieRC _XAie_RequestRscCommon(XAie_DevInst *DevInst, XAie_BackendTilesRsc *Args)
 {
 	AieRC RC;
-	u32 RscArrPerTile[Args->NumRscPerTile];
 
 	if (Args->RscType == XAIE_BCAST_CHANNEL_RSC) {
 		return _XAie_RequestBroadcastChannelRscCommon(DevInst, Args);
 	}
 
+	/* Broadcast requests have no per tile count to size the array with */
+	u32 RscArrPerTile[Args->NumRscPerTile];
+
 	/*
 	* RscArrPerTile initalized to zeros by memset to avoid MISRA violation.
 	* RscArrPerTile gets properly intialized in _XAie_RequestRscContig.
@@ -424,7 +555,7 @@ AieRC _XAie_RequestRscCommon(XAie_DevInst *DevInst, XAie_BackendTilesRsc *Args)
 
 	RC = _XAie_RequestRsc(Args->Bitmap,
 		Args->StartBit, Args->StaticBitmapOffset, Args->NumRscPerTile,
-		Args->MaxRscVal, RscArrPerTile);
+		Args->MaxRscVal, RscArrPerTile, Args->Policy, Args->PreferMask);
 	if(RC == XAIE_OK) {
 		/* Return resource granted to caller by populating UserRsc */
 		for(u32 j = 0; j < Args->NumRscPerTile; j++) {
@@ -509,6 +640,57 @@ AieRC _XAie_RequestAllocatedRscCommon(XAie_DevInst *DevInst,
 	return XAIE_INVALID_ARGS;
 }
 
+/*****************************************************************************/
+/**
+* The API grants a batch of resources, all of them or none. On failure the
+* runtime bits marked by the batch are cleared again.
+*
+* @param	DevInst: Device Instance
+* @param	Args: Contains the batch of requests
+*
+* @return	XAIE_OK on success
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_RequestRscBatchCommon(XAie_DevInst *DevInst,
+		XAie_BackendRscBatch *Args)
+{
+	AieRC RC = XAIE_OK;
+	u32 i;
+
+	for(i = 0U; i < Args->NumRscs; i++) {
+		XAie_BackendTilesRsc *TilesRsc = &Args->TilesRsc[i];
+
+		if(TilesRsc->RscId == XAIE_RSC_ID_ANY) {
+			RC = _XAie_RequestRscCommon(DevInst, TilesRsc);
+		} else {
+			RC = _XAie_RequestAllocatedRscCommon(DevInst,
+					TilesRsc);
+		}
+		if(RC != XAIE_OK) {
+			break;
+		}
+	}
+
+	if(RC == XAIE_OK) {
+		return XAIE_OK;
+	}
+
+	while(i > 0U) {
+		XAie_BackendTilesRsc *TilesRsc = &Args->TilesRsc[--i];
+		u32 Bit = TilesRsc->StartBit;
+
+		/* Specific requests have the id in their start bit already */
+		if(TilesRsc->RscId == XAIE_RSC_ID_ANY) {
+			Bit += TilesRsc->Rscs->RscId;
+		}
+		_XAie_ClrBitInBitmap(TilesRsc->Bitmap, Bit, 1U);
+	}
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 * This API gets number of available resource from a resource bitmap
@@ -530,11 +712,16 @@ static u32 _XAie_GetAvailRscsFromBitmap(u32 *Bitmap,
 	u32 MaxRscVal = Offsets->MaxRscVal;
 	u32 Count = 0;
 
-	for(u32 i = StartBit; i < StartBit + MaxRscVal; i++) {
-		if(!((CheckBit(Bitmap, i)) |
-			CheckBit(Bitmap, (i + StaticBitmapOffset)))) {
-			Count++;
+	for(u32 Off = 0U; Off < MaxRscVal; Off += XAIE_RSC_WORD_BITS) {
+		u32 NumBits = MaxRscVal - Off;
+
+		if(NumBits > XAIE_RSC_WORD_BITS) {
+			NumBits = XAIE_RSC_WORD_BITS;
 		}
+
+		Count += _XAie_PopCount32(_XAie_GetFreeRscWord(Bitmap,
+					StaticBitmapOffset, StartBit + Off,
+					NumBits));
 	}
 
 	return Count;
@@ -559,10 +746,16 @@ static u32 _XAie_GetStaticRscsFromBitmap(u32 *Bitmap,
 	u32 StartBit = Offsets->StartBit + Offsets->StaticBitmapOffset;
 	u32 Count = 0;
 
-	for(u32 i = StartBit; i < StartBit + Offsets->MaxRscVal; i++) {
-		if(CheckBit(Bitmap, i)) {
-			Count++;
+	for(u32 Off = 0U; Off < Offsets->MaxRscVal;
+			Off += XAIE_RSC_WORD_BITS) {
+		u32 NumBits = Offsets->MaxRscVal - Off;
+
+		if(NumBits > XAIE_RSC_WORD_BITS) {
+			NumBits = XAIE_RSC_WORD_BITS;
 		}
+
+		Count += _XAie_PopCount32(_XAie_GetBitmapWord(Bitmap,
+					StartBit + Off, NumBits));
 	}
 
 	return Count;
@@ -590,7 +783,7 @@ AieRC _XAie_GetRscStatCommon(XAie_DevInst *DevInst, XAie_BackendRscStat *Arg)
 		u32 *Bitmap;
 		XAie_BitmapOffsets Offsets;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst,
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
 				RscStats[i].Loc);
 		_XAie_RscMgr_GetBitmapOffsets(DevInst,
 				(XAie_RscType)(RscStats[i].RscType),
@@ -641,7 +834,7 @@ void _XAie_IOCommon_MarkTilesInUse(XAie_DevInst *DevInst,
 		/* Loc is NULL, it suggests all tiles are requested */
 		StartBit = _XAie_GetTileBitPosFromLoc(DevInst,
 					XAie_TileLoc(0, 1));
-		_XAie_SetBitInBitmap(DevInst->DevOps->TilesInUse, StartBit,
+		_XAie_SetBitInBitmapAtomic(DevInst->TilesInUse, StartBit,
 				NumTiles);
 	} else {
 		for(u32 i = 0; i < Args->NumTiles; i++) {
@@ -657,10 +850,440 @@ void _XAie_IOCommon_MarkTilesInUse(XAie_DevInst *DevInst,
 			 */
 			Bit = _XAie_GetTileBitPosFromLoc(DevInst,
 					XAie_TileLoc(Args->Locs[i].Col, 1));
-			_XAie_SetBitInBitmap(DevInst->DevOps->TilesInUse,
+			_XAie_SetBitInBitmapAtomic(DevInst->TilesInUse,
 					Bit, Args->Locs[i].Row);
 		}
 	}
 }
 
+/*****************************************************************************/
+/**
+*
+* This function checks if a block of 32-bit words is within the program memory
+* or data memory of a single AIE tile or memory tile.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	RegOff: Register offset of the block.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_ENABLE if the block is within tile memory, otherwise
+*		XAIE_DISABLE.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+u8 _XAie_IOCommon_IsTileMem(XAie_DevInst *DevInst, u64 RegOff, u32 Size)
+{
+	const XAie_CoreMod *CoreMod;
+	const XAie_MemMod *MemMod;
+	u64 TileOff, End;
+	u8 Row, TileType;
+
+	Row = (u8)((RegOff >> DevInst->DevProp.RowShift) &
+			((1U << (DevInst->DevProp.ColShift -
+				  DevInst->DevProp.RowShift)) - 1U));
+	TileType = _XAie_GetTileTypefromLoc(DevInst,
+			XAie_TileLoc((u8)(RegOff >> DevInst->DevProp.ColShift),
+				Row));
+	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
+			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
+		return XAIE_DISABLE;
+	}
+
+	TileOff = RegOff & ((1ULL << DevInst->DevProp.RowShift) - 1U);
+	End = TileOff + (u64)Size * sizeof(u32);
+
+	MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+	if((MemMod != NULL) && (TileOff >= MemMod->MemAddr) &&
+			(End <= (u64)MemMod->MemAddr + MemMod->Size)) {
+		return XAIE_ENABLE;
+	}
+
+	CoreMod = DevInst->DevProp.DevMod[TileType].CoreMod;
+	if((CoreMod != NULL) && (TileOff >= CoreMod->ProgMemHostOffset) &&
+			(End <= (u64)CoreMod->ProgMemHostOffset +
+			 CoreMod->ProgMemSize)) {
+		return XAIE_ENABLE;
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies 128-bit aligned vectors to device memory.
+*
+* @param	Dest: 128-bit aligned destination.
+* @param	Src: Source buffer, aligned to 32-bit.
+* @param	NumVecs: Number of 128-bit vectors.
+* @param	Stream: XAIE_ENABLE to use non-temporal stores.
+*
+* @return	None.
+*
+* @note		Internal only. Without SSE2 or NEON, the copy is done with
+*		memcpy.
+*
+*******************************************************************************/
+static void _XAie_IOCommon_CopyVecs(u32 *Dest, const u32 *Src, u32 NumVecs,
+		u8 Stream)
+{
+#if defined(__SSE2__)
+	__m128i *VDest = (__m128i *)Dest;
+	const __m128i *VSrc = (const __m128i *)Src;
+
+	if(Stream == XAIE_ENABLE) {
+		for(u32 i = 0U; i < NumVecs; i++) {
+			_mm_stream_si128(&VDest[i], _mm_loadu_si128(&VSrc[i]));
+		}
+		_mm_sfence();
+		return;
+	}
+
+	for(u32 i = 0U; i < NumVecs; i++) {
+		_mm_store_si128(&VDest[i], _mm_loadu_si128(&VSrc[i]));
+	}
+#elif defined(__ARM_NEON)
+	/*
+	 * NEON has no non-temporal store intrinsic. Device memory is mapped
+	 * non-cacheable, so the plain stores do not pollute the caches.
+	 */
+	(void)Stream;
+	for(u32 i = 0U; i < NumVecs; i++) {
+		vst1q_u32(Dest + i * XAIE_IO_COPY_VEC_WORDS,
+				vld1q_u32(Src + i * XAIE_IO_COPY_VEC_WORDS));
+	}
+#else
+	(void)Stream;
+	memcpy((void *)Dest, (const void *)Src,
+			NumVecs * XAIE_IO_COPY_VEC_WORDS * sizeof(u32));
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies a block of 32-bit words to memory mapped device memory.
+* The words before the first and after the last 128-bit boundary of the
+* destination are written with single 32-bit stores, and the rest with 128-bit
+* stores. Large blocks are written with non-temporal stores where available.
+*
+* @param	Dest: Destination address, aligned to 32-bit.
+* @param	Src: Source buffer, aligned to 32-bit.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_IOCommon_CopyToDev(void *Dest, const u32 *Src, u32 Size)
+{
+	volatile u32 *WDest = (volatile u32 *)Dest;
+	u32 HeadWords = 0U, NumVecs;
+	u8 Stream;
+
+	if(((uintptr_t)Dest & XAIE_IO_COPY_VEC_ALIGN_MASK) != 0U) {
+		HeadWords = (u32)(((XAIE_IO_COPY_VEC_ALIGN_MASK + 1U) -
+				((uintptr_t)Dest & XAIE_IO_COPY_VEC_ALIGN_MASK)) /
+				sizeof(u32));
+	}
+
+	for(; (HeadWords > 0U) && (Size > 0U); HeadWords--, Size--) {
+		*WDest++ = *Src++;
+	}
+
+	NumVecs = Size / XAIE_IO_COPY_VEC_WORDS;
+	if(NumVecs > 0U) {
+		Stream = (Size >= XAIE_IO_COPY_STREAM_MIN_WORDS) ?
+			XAIE_ENABLE : XAIE_DISABLE;
+		_XAie_IOCommon_CopyVecs((u32 *)WDest, Src, NumVecs, Stream);
+		WDest += NumVecs * XAIE_IO_COPY_VEC_WORDS;
+		Src += NumVecs * XAIE_IO_COPY_VEC_WORDS;
+		Size -= NumVecs * XAIE_IO_COPY_VEC_WORDS;
+	}
+
+	for(; Size > 0U; Size--) {
+		*WDest++ = *Src++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets a block of memory mapped device memory to a 32-bit value.
+* The words before the first and after the last 128-bit boundary of the
+* destination are written with single 32-bit stores, and the rest with 128-bit
+* stores. Large blocks are written with non-temporal stores where available.
+*
+* @param	Dest: Destination address, aligned to 32-bit.
+* @param	Value: 32-bit value to write.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_IOCommon_SetDev(void *Dest, u32 Value, u32 Size)
+{
+	volatile u32 *WDest = (volatile u32 *)Dest;
+	u32 HeadWords = 0U, NumVecs;
+
+	if(((uintptr_t)Dest & XAIE_IO_COPY_VEC_ALIGN_MASK) != 0U) {
+		HeadWords = (u32)(((XAIE_IO_COPY_VEC_ALIGN_MASK + 1U) -
+				((uintptr_t)Dest & XAIE_IO_COPY_VEC_ALIGN_MASK)) /
+				sizeof(u32));
+	}
+
+	for(; (HeadWords > 0U) && (Size > 0U); HeadWords--, Size--) {
+		*WDest++ = Value;
+	}
+
+	NumVecs = Size / XAIE_IO_COPY_VEC_WORDS;
+	if(NumVecs > 0U) {
+#if defined(__SSE2__)
+		__m128i *VDest = (__m128i *)(uintptr_t)WDest;
+		__m128i Vec = _mm_set1_epi32((int)Value);
+
+		if(Size >= XAIE_IO_COPY_STREAM_MIN_WORDS) {
+			for(u32 i = 0U; i < NumVecs; i++) {
+				_mm_stream_si128(&VDest[i], Vec);
+			}
+			_mm_sfence();
+		} else {
+			for(u32 i = 0U; i < NumVecs; i++) {
+				_mm_store_si128(&VDest[i], Vec);
+			}
+		}
+#elif defined(__ARM_NEON)
+		uint32x4_t Vec = vdupq_n_u32(Value);
+
+		for(u32 i = 0U; i < NumVecs; i++) {
+			vst1q_u32((u32 *)(uintptr_t)WDest +
+					i * XAIE_IO_COPY_VEC_WORDS, Vec);
+		}
+#else
+		for(u32 i = 0U; i < NumVecs * XAIE_IO_COPY_VEC_WORDS; i++) {
+			WDest[i] = Value;
+		}
+#endif
+		WDest += NumVecs * XAIE_IO_COPY_VEC_WORDS;
+		Size -= NumVecs * XAIE_IO_COPY_VEC_WORDS;
+	}
+
+	for(; Size > 0U; Size--) {
+		*WDest++ = Value;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies a block of 32-bit words from memory mapped device
+* memory. The words before the first and after the last 128-bit boundary of
+* the source are read with single 32-bit loads, and the rest with 128-bit
+* loads, so that the device is never accessed with narrower loads.
+*
+* @param	Dest: Destination buffer, aligned to 32-bit.
+* @param	Src: Source address, aligned to 32-bit.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_IOCommon_CopyFromDev(u32 *Dest, const void *Src, u32 Size)
+{
+	const volatile u32 *WSrc = (const volatile u32 *)Src;
+	u32 HeadWords = 0U, NumVecs;
+
+	if(((uintptr_t)Src & XAIE_IO_COPY_VEC_ALIGN_MASK) != 0U) {
+		HeadWords = (u32)(((XAIE_IO_COPY_VEC_ALIGN_MASK + 1U) -
+				((uintptr_t)Src & XAIE_IO_COPY_VEC_ALIGN_MASK)) /
+				sizeof(u32));
+	}
+
+	for(; (HeadWords > 0U) && (Size > 0U); HeadWords--, Size--) {
+		*Dest++ = *WSrc++;
+	}
+
+	NumVecs = Size / XAIE_IO_COPY_VEC_WORDS;
+	for(u32 i = 0U; i < NumVecs; i++) {
+#if defined(__SSE2__)
+		_mm_storeu_si128((__m128i *)Dest, _mm_load_si128(
+					(const __m128i *)(uintptr_t)WSrc));
+#elif defined(__ARM_NEON)
+		vst1q_u32(Dest, vld1q_u32((const u32 *)(uintptr_t)WSrc));
+#else
+		for(u32 j = 0U; j < XAIE_IO_COPY_VEC_WORDS; j++) {
+			Dest[j] = WSrc[j];
+		}
+#endif
+		Dest += XAIE_IO_COPY_VEC_WORDS;
+		WSrc += XAIE_IO_COPY_VEC_WORDS;
+	}
+	Size -= NumVecs * XAIE_IO_COPY_VEC_WORDS;
+
+	for(; Size > 0U; Size--) {
+		*Dest++ = *WSrc++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets a poll configuration to the default strategy of the backends,
+* a fixed sleep between the reads.
+*
+* @param	Cfg: Pointer to the poll configuration.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_IOCommon_InitPollCfg(XAie_PollCfg *Cfg)
+{
+	Cfg->Mode = XAIE_POLL_FIXED;
+	Cfg->SpinCount = 0U;
+	Cfg->MinSleepUs = XAIE_IO_POLL_DEFAULT_SLEEP_US;
+	Cfg->MaxSleepUs = XAIE_IO_POLL_DEFAULT_SLEEP_US;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sleeps for a number of micro seconds.
+*
+* @param	Us: Time to sleep in micro seconds.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_IOCommon_SleepUs(u32 Us)
+{
+#ifdef __AIEBAREMETAL__
+	usleep(Us);
+#else
+	struct timespec Ts;
+
+	Ts.tv_sec = Us / 1000000U;
+	Ts.tv_nsec = (long)(Us % 1000000U) * 1000L;
+	nanosleep(&Ts, NULL);
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API polls a register until the masked value matches, following the
+* poll strategy of the backend.
+*
+* @param	IOInst: IO instance pointer.
+* @param	Read32: Read operation of the backend.
+* @param	Cfg: Pointer to the poll configuration.
+* @param	RegOff: Register offset to read from.
+* @param	Mask: Mask to be applied to the register value.
+* @param	Value: Value to wait for.
+* @param	TimeOutUs: Timeout in micro seconds.
+*
+* @return	XAIE_OK if the value matches, XAIE_ERR on timeout and error code
+*		if a read fails.
+*
+* @note		Internal only. The register is read once more after the last
+*		sleep, so a poll with TimeOutUs of 0 reads the register once.
+*
+*******************************************************************************/
+AieRC _XAie_IOCommon_MaskPoll(void *IOInst,
+		AieRC (*Read32)(void *IOInst, u64 RegOff, u32 *Data),
+		const XAie_PollCfg *Cfg, u64 RegOff, u32 Mask, u32 Value,
+		u32 TimeOutUs)
+{
+	AieRC RC;
+	u32 RegVal, SleepUs, Spins = 0U;
+	u64 ElapsedUs = 0U;
+
+	if(Cfg->Mode == XAIE_POLL_BACKOFF) {
+		SleepUs = Cfg->MinSleepUs;
+	} else {
+		SleepUs = Cfg->MaxSleepUs;
+	}
+
+	while(1) {
+		RC = Read32(IOInst, RegOff, &RegVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		if((RegVal & Mask) == Value) {
+			return XAIE_OK;
+		}
+
+		if((Cfg->Mode != XAIE_POLL_FIXED) && (Spins < Cfg->SpinCount)) {
+			Spins++;
+			continue;
+		}
+
+		if(ElapsedUs >= TimeOutUs) {
+			break;
+		}
+
+		_XAie_IOCommon_SleepUs(SleepUs);
+		ElapsedUs += SleepUs;
+		if((Cfg->Mode == XAIE_POLL_BACKOFF) &&
+				(SleepUs < Cfg->MaxSleepUs)) {
+			SleepUs = (SleepUs > (Cfg->MaxSleepUs >> 1U)) ?
+				Cfg->MaxSleepUs : (SleepUs << 1U);
+		}
+	}
+
+	return XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API runs an NPI request list with the NPI operations of a backend.
+*
+* @param	IOInst: IO instance pointer.
+* @param	List: NPI request list.
+* @param	NpiWrite32: NPI write operation of the backend.
+* @param	NpiMaskPoll: NPI mask poll operation of the backend.
+*
+* @return	XAIE_OK on success, error code of the first mask poll which
+*		fails otherwise.
+*
+* @note		Internal only. The requests after a failed mask poll are not
+*		run.
+*
+*******************************************************************************/
+AieRC _XAie_IOCommon_NpiReqList(void *IOInst,
+		const XAie_BackendNpiReqList *List,
+		void (*NpiWrite32)(void *IOInst, u32 RegOff, u32 RegVal),
+		AieRC (*NpiMaskPoll)(void *IOInst, u64 RegOff, u32 Mask,
+			u32 Value, u32 TimeOutUs))
+{
+	AieRC RC;
+
+	for(u32 i = 0U; i < List->NumReqs; i++) {
+		const XAie_BackendNpiReq *Req = &List->Reqs[i];
+
+		if(Req->Type == XAIE_BACKEND_NPI_REQ_WR32) {
+			NpiWrite32(IOInst, Req->NpiRegOff, Req->Val);
+			continue;
+		}
+
+		RC = NpiMaskPoll(IOInst, Req->NpiRegOff, Req->Mask, Req->Val,
+				Req->TimeOutUs);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
 /** @} */
@@ -24,6 +24,9 @@
 #ifndef XAIE_IO_COMMON_H
 #define XAIE_IO_COMMON_H
 
+/* Sleep between two reads of a register poll, unless configured otherwise */
+#define XAIE_IO_POLL_DEFAULT_SLEEP_US	200U
+
 static inline u64 XAie_IODummyGetTid(void)
 {
 	return 0;
@@ -31,6 +34,20 @@ static inline u64 XAie_IODummyGetTid(void)
 
 void _XAie_IOCommon_MarkTilesInUse(XAie_DevInst *DevInst,
 		XAie_BackendTilesArray *Args);
+u8 _XAie_IOCommon_IsTileMem(XAie_DevInst *DevInst, u64 RegOff, u32 Size);
+void _XAie_IOCommon_CopyToDev(void *Dest, const u32 *Src, u32 Size);
+void _XAie_IOCommon_SetDev(void *Dest, u32 Value, u32 Size);
+void _XAie_IOCommon_CopyFromDev(u32 *Dest, const void *Src, u32 Size);
+void _XAie_IOCommon_InitPollCfg(XAie_PollCfg *Cfg);
+AieRC _XAie_IOCommon_MaskPoll(void *IOInst,
+		AieRC (*Read32)(void *IOInst, u64 RegOff, u32 *Data),
+		const XAie_PollCfg *Cfg, u64 RegOff, u32 Mask, u32 Value,
+		u32 TimeOutUs);
+AieRC _XAie_IOCommon_NpiReqList(void *IOInst,
+		const XAie_BackendNpiReqList *List,
+		void (*NpiWrite32)(void *IOInst, u32 RegOff, u32 RegVal),
+		AieRC (*NpiMaskPoll)(void *IOInst, u64 RegOff, u32 Mask,
+			u32 Value, u32 TimeOutUs));
 
 #ifndef XAIE_FEATURE_RSC_ENABLE
 static inline AieRC _XAie_RequestRscCommon(XAie_DevInst *DevInst,
@@ -59,6 +76,12 @@ static inline AieRC _XAie_GetRscStatCommon(XAie_DevInst *DevInst,
 	(void)Arg;
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
+static inline AieRC _XAie_RequestRscBatchCommon(XAie_DevInst *DevInst,
+		XAie_BackendRscBatch *Arg) {
+	(void)DevInst;
+	(void)Arg;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
 #else /* XAIE_FEATURE_RSC_ENABLE */
 AieRC _XAie_RequestRscCommon(XAie_DevInst *DevInst, XAie_BackendTilesRsc *Arg);
 AieRC _XAie_ReleaseRscCommon(XAie_BackendTilesRsc *Arg);
@@ -66,6 +89,8 @@ AieRC _XAie_FreeRscCommon(XAie_BackendTilesRsc *Arg);
 AieRC _XAie_RequestAllocatedRscCommon(XAie_DevInst *DevInst,
 		XAie_BackendTilesRsc *Arg);
 AieRC _XAie_GetRscStatCommon(XAie_DevInst *DevInst, XAie_BackendRscStat *Arg);
+AieRC _XAie_RequestRscBatchCommon(XAie_DevInst *DevInst,
+		XAie_BackendRscBatch *Arg);
 #endif /* XAIE_FEATURE_RSC_ENABLE */
 
 #endif /* XAIE_IO_COMMON_H */
@@ -24,10 +24,15 @@
 /***************************** Include Files *********************************/
 #ifdef __AIELINUX__
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE	/* memfd_create() and file seals */
+#endif
+
 #include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
 #include <linux/dma-buf.h>
+#include <linux/udmabuf.h>
 #include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
@@ -47,7 +52,21 @@
 #include "xaie_npi.h"
 
 /***************************** Macro Definitions *****************************/
-#define XAIE_128BIT_ALIGN_MASK 0xFF
+/*
+ * The driver calls the register accessors directly when the Linux backend is
+ * the only IO backend of the build.
+ */
+#ifdef XAIE_BACKEND_LINUX_ONLY
+#define XAIE_LINUX_IO_ACCESSOR
+#else
+#define XAIE_LINUX_IO_ACCESSOR	static
+#endif
+
+/*
+ * Size of the huge pages used for the memory mappings and the buffers
+ * allocated by the backend.
+ */
+#define XAIE_LINUX_HUGE_PAGE_SIZE	0x200000U
 
 /****************************** Type Definitions *****************************/
 #ifdef __AIELINUX__
@@ -63,6 +82,15 @@ typedef struct XAie_LinuxIO {
 	int DeviceFd;		/* File descriptor of the device */
 	int PartitionFd;	/* File descriptor of the partition */
 	XAie_MemMap RegMap;	/* Read only mapping of registers */
+	XAie_MemMap RegMapWr;	/* Writable mapping of registers, if enabled */
+	XAie_TxnCmd *WcBuf;	/* Buffer of combined register writes */
+	u32 WcDepth;		/* Capacity of WcBuf, 0 if disabled */
+	u32 WcNumCmds;		/* Number of buffered writes */
+	pthread_mutex_t WcLock;
+	XAie_PollCfg PollCfg;	/* Strategy of register polls */
+	struct XAie_LinuxAttachCache *AttachCache; /* Attached dmabufs kept
+						     * for reuse, if enabled */
+	u8 HugePages;		/* Allocate buffers from huge pages */
 	XAie_MemMap ProgMem;	/* Mapping of program memory of aie */
 	XAie_MemMap DataMem;  	/* Mapping of data memory of aie */
 	XAie_MemMap MemTileMem;	/* Mapping of memory tile mem */
@@ -82,13 +110,418 @@ typedef struct XAie_LinuxIO {
 
 typedef struct XAie_LinuxMem {
 	int BufferFd;
+	s32 CacheIdx;	/* Entry of the attachment cache, -1 if not cached */
+	int MemFd;	/* memfd backing a buffer allocated by the backend, -1
+			 * for attached dmabufs */
+	u64 MapSize;	/* Size of the memfd and of its mapping */
 } XAie_LinuxMem;
 
+/*
+ * Attachment of a dmabuf kept by the attachment cache. The entry holds a
+ * duplicate of the dmabuf fd, so the dmabuf stays alive and can be detached
+ * after the application closed its fd.
+ */
+typedef struct XAie_LinuxAttach {
+	int Fd;		/* Duplicate of the dmabuf fd */
+	ino_t Ino;	/* Inode of the dmabuf, unique while it is alive */
+	u32 Refs;	/* Attachments not detached by the application */
+	s32 HashNext;	/* Next entry of the hash chain or of the free list */
+	s32 LruPrev;	/* Previous idle entry, towards the least recent */
+	s32 LruNext;	/* Next idle entry, towards the most recent */
+} XAie_LinuxAttach;
+
+typedef struct XAie_LinuxAttachCache {
+	XAie_LinuxAttach *Entries;
+	s32 *Hash;	/* Heads of the hash chains */
+	u32 NumEntries;
+	u32 HashBits;
+	s32 Free;	/* First unused entry */
+	s32 LruHead;	/* Least recently detached idle entry */
+	s32 LruTail;	/* Most recently detached idle entry */
+} XAie_LinuxAttachCache;
+
 #endif /* __AIELINUX__ */
 
 /************************** Function Definitions *****************************/
 #ifdef __AIELINUX__
 
+/*****************************************************************************/
+/**
+*
+* This is the IO function to submit a range of transaction commands to the
+* kernel driver for execution.
+*
+* @param	LinuxIOInst: Linux IO instance pointer
+* @param	Cmds: Pointer to the first command.
+* @param	NumCmds: Number of commands.
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxSubmitCmds(XAie_LinuxIO *LinuxIOInst,
+		XAie_TxnCmd *Cmds, u32 NumCmds)
+{
+	int Ret;
+	struct aie_txn_inst Args;
+
+	if(NumCmds == 0U) {
+		return XAIE_OK;
+	}
+
+	Args.num_cmds = NumCmds;
+	Args.cmdsptr = (u64)Cmds;
+
+	Ret = ioctl(LinuxIOInst->PartitionFd, AIE_TRANSACTION_IOCTL, &Args);
+	if(Ret < 0) {
+		XAIE_ERROR("Submitting transaction to device failed, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits the buffered register writes to the kernel driver.
+*
+* @param	IOInst: Linux IO instance pointer
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		Internal only. The buffer is emptied even if the submission
+*		fails.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_WcFlush(XAie_LinuxIO *IOInst)
+{
+	AieRC RC = XAIE_OK;
+
+	pthread_mutex_lock(&IOInst->WcLock);
+	if(IOInst->WcDepth != 0U) {
+		RC = _XAie_LinuxSubmitCmds(IOInst, IOInst->WcBuf,
+				IOInst->WcNumCmds);
+		IOInst->WcNumCmds = 0U;
+	}
+	pthread_mutex_unlock(&IOInst->WcLock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a register write to the write combining buffer and
+* submits the buffer once it is full.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	RegOff: Register offset to write to.
+* @param	Mask: Mask of the write, 0 for a plain write.
+* @param	Value: 32-bit data to be written.
+* @param	Queued: Pointer to return XAIE_ENABLE if the write is buffered,
+*		XAIE_DISABLE if write combining is disabled and the caller
+*		has to issue the write.
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		Internal only. The depth is checked under the lock, as the
+*		buffer may be reconfigured concurrently.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_WcWrite(XAie_LinuxIO *IOInst, u64 RegOff, u32 Mask,
+		u32 Value, u8 *Queued)
+{
+	XAie_TxnCmd *Cmd;
+	AieRC RC = XAIE_OK;
+
+	pthread_mutex_lock(&IOInst->WcLock);
+	if(IOInst->WcDepth == 0U) {
+		pthread_mutex_unlock(&IOInst->WcLock);
+		*Queued = XAIE_DISABLE;
+		return XAIE_OK;
+	}
+
+	*Queued = XAIE_ENABLE;
+	Cmd = &IOInst->WcBuf[IOInst->WcNumCmds++];
+	Cmd->Opcode = XAIE_IO_WRITE;
+	Cmd->Mask = Mask;
+	Cmd->RegOff = RegOff;
+	Cmd->Value = Value;
+	Cmd->DataPtr = 0U;
+	Cmd->Size = 0U;
+
+	if(IOInst->WcNumCmds == IOInst->WcDepth) {
+		RC = _XAie_LinuxSubmitCmds(IOInst, IOInst->WcBuf,
+				IOInst->WcNumCmds);
+		IOInst->WcNumCmds = 0U;
+	}
+	pthread_mutex_unlock(&IOInst->WcLock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function configures the depth of the write combining buffer.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	Depth: Pointer to the number of writes to buffer, 0 disables
+*		write combining.
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		Internal only. The pending writes are submitted first.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_ConfigWc(XAie_LinuxIO *IOInst, u32 *Depth)
+{
+	XAie_TxnCmd *Buf = NULL;
+	AieRC RC;
+
+	if(*Depth != 0U) {
+		Buf = (XAie_TxnCmd *)malloc(sizeof(*Buf) * (*Depth));
+		if(Buf == NULL) {
+			XAIE_ERROR("Failed to allocate write combining "
+					"buffer\n");
+			return XAIE_ERR;
+		}
+	}
+
+	RC = _XAie_LinuxIO_WcFlush(IOInst);
+
+	pthread_mutex_lock(&IOInst->WcLock);
+	free(IOInst->WcBuf);
+	IOInst->WcBuf = Buf;
+	IOInst->WcDepth = *Depth;
+	IOInst->WcNumCmds = 0U;
+	pthread_mutex_unlock(&IOInst->WcLock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the hash chain of a dmabuf in the attachment cache.
+*
+* @param	Cache: Attachment cache pointer
+* @param	Ino: Inode of the dmabuf
+*
+* @return	Index of the hash chain.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u32 _XAie_LinuxAttachHash(XAie_LinuxAttachCache *Cache,
+		ino_t Ino)
+{
+	return (u32)(((u64)Ino * 0x9E3779B97F4A7C15ULL) >>
+			(64U - Cache->HashBits));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function unlinks an entry from the list of idle entries of the
+* attachment cache.
+*
+* @param	Cache: Attachment cache pointer
+* @param	Idx: Index of the entry
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_LinuxAttachLruRemove(XAie_LinuxAttachCache *Cache, s32 Idx)
+{
+	XAie_LinuxAttach *E = &Cache->Entries[Idx];
+
+	if(E->LruPrev >= 0) {
+		Cache->Entries[E->LruPrev].LruNext = E->LruNext;
+	} else {
+		Cache->LruHead = E->LruNext;
+	}
+	if(E->LruNext >= 0) {
+		Cache->Entries[E->LruNext].LruPrev = E->LruPrev;
+	} else {
+		Cache->LruTail = E->LruPrev;
+	}
+	E->LruPrev = -1;
+	E->LruNext = -1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function detaches the dmabuf of an entry of the attachment cache and
+* returns the entry to the free list.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	Idx: Index of the entry
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The entry has to be out of the idle list.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxAttachEvict(XAie_LinuxIO *IOInst, s32 Idx)
+{
+	XAie_LinuxAttachCache *Cache = IOInst->AttachCache;
+	XAie_LinuxAttach *E = &Cache->Entries[Idx];
+	u32 H = _XAie_LinuxAttachHash(Cache, E->Ino);
+	s32 *Link = &Cache->Hash[H];
+	AieRC RC = XAIE_OK;
+
+	while(*Link != Idx) {
+		Link = &Cache->Entries[*Link].HashNext;
+	}
+	*Link = E->HashNext;
+
+	if(ioctl(IOInst->PartitionFd, AIE_DETACH_DMABUF_IOCTL, E->Fd) != 0) {
+		XAIE_ERROR("Failed to detach dmabuf, %d: %s\n",
+			errno, strerror(errno));
+		RC = XAIE_ERR;
+	}
+	close(E->Fd);
+
+	E->Fd = -1;
+	E->Refs = 0U;
+	E->HashNext = Cache->Free;
+	Cache->Free = Idx;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function detaches all the dmabufs kept by the attachment cache and
+* frees it.
+*
+* @param	IOInst: Linux IO instance pointer
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxAttachCacheFinish(XAie_LinuxIO *IOInst)
+{
+	XAie_LinuxAttachCache *Cache = IOInst->AttachCache;
+	AieRC RC = XAIE_OK;
+
+	if(Cache == NULL) {
+		return XAIE_OK;
+	}
+
+	for(u32 i = 0U; i < Cache->NumEntries; i++) {
+		if(Cache->Entries[i].Fd >= 0) {
+			if(_XAie_LinuxAttachEvict(IOInst, (s32)i) != XAIE_OK) {
+				RC = XAIE_ERR;
+			}
+		}
+	}
+
+	free(Cache->Entries);
+	free(Cache->Hash);
+	free(Cache);
+	IOInst->AttachCache = NULL;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function configures the number of dmabuf attachments the attachment
+* cache keeps.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	NumEntries: Pointer to the number of attachments, 0 disables
+*		the cache.
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		Internal only. The dmabufs kept by the previous cache are
+*		detached. It fails if the application still has dmabufs
+*		attached through the cache.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_ConfigAttachCache(XAie_LinuxIO *IOInst,
+		u32 *NumEntries)
+{
+	XAie_LinuxAttachCache *Cache = IOInst->AttachCache;
+	u32 HashBits = 1U;
+
+	if(Cache != NULL) {
+		for(u32 i = 0U; i < Cache->NumEntries; i++) {
+			if(Cache->Entries[i].Refs != 0U) {
+				XAIE_ERROR("dmabufs are attached through the "
+						"attachment cache\n");
+				return XAIE_ERR;
+			}
+		}
+	}
+
+	if(_XAie_LinuxAttachCacheFinish(IOInst) != XAIE_OK) {
+		XAIE_WARN("Failed to detach cached dmabufs\n");
+	}
+
+	if(*NumEntries == 0U) {
+		return XAIE_OK;
+	}
+
+	if(*NumEntries > (u32)INT32_MAX) {
+		XAIE_ERROR("Invalid number of attachment cache entries\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	while((1U << HashBits) < *NumEntries * 2U && HashBits < 31U) {
+		HashBits++;
+	}
+
+	Cache = (XAie_LinuxAttachCache *)calloc(1U, sizeof(*Cache));
+	if(Cache == NULL) {
+		XAIE_ERROR("Failed to allocate attachment cache\n");
+		return XAIE_ERR;
+	}
+	Cache->Entries = (XAie_LinuxAttach *)malloc(sizeof(*Cache->Entries) *
+			(*NumEntries));
+	Cache->Hash = (s32 *)malloc(sizeof(*Cache->Hash) * (1U << HashBits));
+	if((Cache->Entries == NULL) || (Cache->Hash == NULL)) {
+		XAIE_ERROR("Failed to allocate attachment cache\n");
+		free(Cache->Entries);
+		free(Cache->Hash);
+		free(Cache);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < *NumEntries; i++) {
+		Cache->Entries[i].Fd = -1;
+		Cache->Entries[i].Refs = 0U;
+		Cache->Entries[i].LruPrev = -1;
+		Cache->Entries[i].LruNext = -1;
+		Cache->Entries[i].HashNext = (i + 1U < *NumEntries) ?
+			(s32)(i + 1U) : -1;
+	}
+	for(u32 i = 0U; i < (1U << HashBits); i++) {
+		Cache->Hash[i] = -1;
+	}
+	Cache->NumEntries = *NumEntries;
+	Cache->HashBits = HashBits;
+	Cache->Free = 0;
+	Cache->LruHead = -1;
+	Cache->LruTail = -1;
+	IOInst->AttachCache = Cache;
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -106,9 +539,23 @@ static AieRC XAie_LinuxIO_Finish(void *IOInst)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
 
+	_XAie_LinuxIO_WcFlush(LinuxIOInst);
+	free(LinuxIOInst->WcBuf);
+	pthread_mutex_destroy(&LinuxIOInst->WcLock);
+	_XAie_LinuxAttachCacheFinish(LinuxIOInst);
+
 	munmap(LinuxIOInst->RegMap.VAddr, LinuxIOInst->RegMap.MapSize);
+	if(LinuxIOInst->RegMapWr.VAddr != NULL) {
+		munmap(LinuxIOInst->RegMapWr.VAddr,
+				LinuxIOInst->RegMapWr.MapSize);
+	}
 	munmap(LinuxIOInst->ProgMem.VAddr, LinuxIOInst->ProgMem.MapSize);
 	munmap(LinuxIOInst->DataMem.VAddr, LinuxIOInst->DataMem.MapSize);
+	if(LinuxIOInst->MemTileMem.VAddr != NULL) {
+		munmap(LinuxIOInst->MemTileMem.VAddr,
+				LinuxIOInst->MemTileMem.MapSize);
+		close(LinuxIOInst->MemTileMem.Fd);
+	}
 
 	close(LinuxIOInst->ProgMem.Fd);
 	close(LinuxIOInst->DataMem.Fd);
@@ -184,6 +631,58 @@ static AieRC _XAie_LinuxIO_GetPartition(XAie_DevInst *DevInst,
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function maps a memory of the partition. Memories of at least the size
+* of a huge page are mapped at an address aligned to the huge page size, so
+* the kernel driver can back the mapping with huge page table entries.
+*
+* @param	Fd: File descriptor of the memory.
+* @param	Size: Size of the mapping.
+*
+* @return	Address of the mapping on success, MAP_FAILED on failure.
+*
+* @note		Internal only. The alignment is obtained by reserving an
+*		address range larger by one huge page and mapping the memory
+*		over the aligned part of it.
+*
+*******************************************************************************/
+static void *_XAie_LinuxIO_MmapAligned(int Fd, u64 Size)
+{
+	u8 *Resv;
+	u64 Head, ResvSize;
+
+	if(Size < XAIE_LINUX_HUGE_PAGE_SIZE) {
+		return mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_SHARED,
+				Fd, 0);
+	}
+
+	ResvSize = Size + XAIE_LINUX_HUGE_PAGE_SIZE;
+	Resv = (u8 *)mmap(NULL, ResvSize, PROT_NONE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if(Resv == MAP_FAILED) {
+		return mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_SHARED,
+				Fd, 0);
+	}
+
+	Head = (XAIE_LINUX_HUGE_PAGE_SIZE -
+		((uintptr_t)Resv & (XAIE_LINUX_HUGE_PAGE_SIZE - 1U))) &
+		(XAIE_LINUX_HUGE_PAGE_SIZE - 1U);
+	if(mmap(Resv + Head, Size, PROT_READ | PROT_WRITE,
+				MAP_SHARED | MAP_FIXED, Fd, 0) == MAP_FAILED) {
+		munmap(Resv, ResvSize);
+		return MAP_FAILED;
+	}
+
+	if(Head != 0U) {
+		munmap(Resv, Head);
+	}
+	munmap(Resv + Head + Size, ResvSize - Head - Size);
+
+	return (void *)(Resv + Head);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -240,8 +739,7 @@ static AieRC _XAie_LinuxIO_MapMemory(XAie_DevInst *DevInst,
 
 		XAIE_DBG("Mapping memory: Offset: 0x%x, Size: 0x%x, MMapSize: 0x%lx\n",
 				Mem->offset, Mem->size, MMapSize);
-		MemVAddr = mmap(NULL, MMapSize, PROT_READ | PROT_WRITE,
-				MAP_SHARED, Mem->fd, 0);
+		MemVAddr = _XAie_LinuxIO_MmapAligned(Mem->fd, MMapSize);
 		if(MemVAddr == MAP_FAILED) {
 			XAIE_ERROR("Failed to mmap memory. Offset 0x%x, %d: %s\n",
 					Mem->offset, errno, strerror(errno));
@@ -331,6 +829,15 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 	IOInst->ColShift = DevInst->DevProp.ColShift;
 	IOInst->BaseAddr = DevInst->BaseAddr;
 	IOInst->DeviceFd = Fd;
+	IOInst->RegMapWr.VAddr = NULL;
+	IOInst->RegMapWr.MapSize = 0U;
+	IOInst->WcBuf = NULL;
+	IOInst->WcDepth = 0U;
+	IOInst->WcNumCmds = 0U;
+	IOInst->AttachCache = NULL;
+	IOInst->HugePages = 0U;
+	IOInst->MemTileMem.VAddr = NULL;
+	pthread_mutex_init(&IOInst->WcLock, NULL);
 
 	RC = _XAie_LinuxIO_GetPartition(DevInst, IOInst);
 	if(RC != XAIE_OK) {
@@ -347,6 +854,7 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 		return XAIE_ERR;
 	}
 
+	_XAie_IOCommon_InitPollCfg(&IOInst->PollCfg);
 	DevInst->IOInst = (void *)IOInst;
 	IOInst->DevInst = DevInst;
 
@@ -356,65 +864,180 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 /*****************************************************************************/
 /**
 *
-* This is the memory IO function to write 32bit data to the specified address.
+* This function returns the address of a register in the writable register
+* mapping, if the register can be written without the kernel.
 *
 * @param	IOInst: IO instance pointer
-* @param	RegOff: Register offset to read from.
-* @param	Data: 32-bit data to be written.
+* @param	RegOff: Register offset.
 *
-* @return	None.
+* @return	Pointer to the register if the mapping is enabled and the
+*		register is permitted, NULL otherwise.
 *
-* @note		Internal only.
+* @note		Internal only. Only the registers of the AIE tiles and the
+*		memory tiles are permitted, except for their tile control
+*		register which configures the isolation of the tile.
 *
 *******************************************************************************/
-static AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value)
+static inline volatile u32 *_XAie_LinuxIO_GetMmapReg(XAie_LinuxIO *IOInst,
+		u64 RegOff)
 {
-	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
-	int Ret;
-	struct aie_reg_args Args;
+	XAie_DevInst *DevInst = IOInst->DevInst;
+	const XAie_TileCtrlMod *TileCtrlMod;
+	u64 RowMask = (1ULL << (IOInst->ColShift - IOInst->RowShift)) - 1U;
+	u64 TileOff = RegOff & ((1ULL << IOInst->RowShift) - 1U);
+	u8 Row, TileType;
+
+	if((IOInst->RegMapWr.VAddr == NULL) ||
+			(RegOff + sizeof(u32) > IOInst->RegMapWr.MapSize)) {
+		return NULL;
+	}
 
-	Args.op = AIE_REG_WRITE;
-	Args.offset = RegOff;
-	Args.val = Value;
-	Args.mask = 0; /* mask must be 0 for register write */
+	Row = (u8)((RegOff >> IOInst->RowShift) & RowMask);
+	TileType = _XAie_GetTileTypefromLoc(DevInst,
+			XAie_TileLoc((u8)(RegOff >> IOInst->ColShift), Row));
+	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
+			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
+		return NULL;
+	}
 
-	/*
-	 * TBD: Is the check of ioctl call required here? Other backends do not
-	 * check for errors. Kernels prints error messages anyway.
-	 */
-	Ret = ioctl(LinuxIOInst->PartitionFd, AIE_REG_IOCTL, &Args);
-	if(Ret < 0) {
-		XAIE_ERROR("Register write failed for offset 0x%lx, %d: %s\n",
-			RegOff, errno, strerror(errno));
-		return XAIE_ERR;
+	TileCtrlMod = DevInst->DevProp.DevMod[TileType].TileCtrlMod;
+	if((TileCtrlMod != NULL) && (TileOff == TileCtrlMod->TileCtrlRegOff)) {
+		return NULL;
 	}
 
-	return XAIE_OK;
+	return (volatile u32 *)((u8 *)IOInst->RegMapWr.VAddr + RegOff);
 }
 
 /*****************************************************************************/
 /**
 *
-* This is the memory IO function to read 32bit data from the specified address.
+* This function enables or disables the writable mapping of the partition
+* registers.
 *
 * @param	IOInst: IO instance pointer
-* @param	RegOff: Register offset to read from.
-* @param	Data: Pointer to store the 32 bit value
+* @param	Enable: Pointer to XAIE_ENABLE or XAIE_DISABLE.
 *
-* @return	XAIE_OK on success.
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the kernel
+*		does not allow a writable mapping.
 *
 * @note		Internal only.
 *
 *******************************************************************************/
-static AieRC XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
+static AieRC _XAie_LinuxIO_ConfigRegMmap(XAie_LinuxIO *IOInst, u8 *Enable)
 {
-	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	void *VAddr;
 
-	*Data = *((u32 *)(LinuxIOInst->RegMap.VAddr + RegOff));
+	if(*Enable == XAIE_DISABLE) {
+		if(IOInst->RegMapWr.VAddr != NULL) {
+			munmap(IOInst->RegMapWr.VAddr,
+					IOInst->RegMapWr.MapSize);
+			IOInst->RegMapWr.VAddr = NULL;
+			IOInst->RegMapWr.MapSize = 0U;
+		}
+		return XAIE_OK;
+	}
+
+	if(IOInst->RegMapWr.VAddr != NULL) {
+		return XAIE_OK;
+	}
+
+	VAddr = mmap(NULL, IOInst->RegMap.MapSize, PROT_READ | PROT_WRITE,
+			MAP_SHARED, IOInst->PartitionFd, 0);
+	if(VAddr == MAP_FAILED) {
+		XAIE_ERROR("Failed to map register space for write operations, "
+				"%d: %s\n", errno, strerror(errno));
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	IOInst->RegMapWr.VAddr = VAddr;
+	IOInst->RegMapWr.MapSize = IOInst->RegMap.MapSize;
+	XAIE_DBG("Registers mapped as read-write to %p\n", VAddr);
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write 32bit data to the specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: 32-bit data to be written.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+XAIE_LINUX_IO_ACCESSOR
+AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value)
+{
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	volatile u32 *Reg;
+	AieRC RC;
+	int Ret;
+	u8 Queued;
+	struct aie_reg_args Args;
+
+	Reg = _XAie_LinuxIO_GetMmapReg(LinuxIOInst, RegOff);
+	if(Reg != NULL) {
+		RC = _XAie_LinuxIO_WcFlush(LinuxIOInst);
+		*Reg = Value;
+		return RC;
+	}
+
+	RC = _XAie_LinuxIO_WcWrite(LinuxIOInst, RegOff, 0U, Value, &Queued);
+	if(Queued == XAIE_ENABLE) {
+		return RC;
+	}
+
+	Args.op = AIE_REG_WRITE;
+	Args.offset = RegOff;
+	Args.val = Value;
+	Args.mask = 0; /* mask must be 0 for register write */
+
+	/*
+	 * TBD: Is the check of ioctl call required here? Other backends do not
+	 * check for errors. Kernels prints error messages anyway.
+	 */
+	Ret = ioctl(LinuxIOInst->PartitionFd, AIE_REG_IOCTL, &Args);
+	if(Ret < 0) {
+		XAIE_ERROR("Register write failed for offset 0x%lx, %d: %s\n",
+			RegOff, errno, strerror(errno));
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read 32bit data from the specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the 32 bit value
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+XAIE_LINUX_IO_ACCESSOR
+AieRC XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
+{
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	AieRC RC;
+
+	RC = _XAie_LinuxIO_WcFlush(LinuxIOInst);
+
+	*Data = *((u32 *)(LinuxIOInst->RegMap.VAddr + RegOff));
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -431,13 +1054,29 @@ static AieRC XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 * @note		Internal only.
 *
 *******************************************************************************/
-static AieRC XAie_LinuxIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
+XAIE_LINUX_IO_ACCESSOR
+AieRC XAie_LinuxIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	volatile u32 *Reg;
+	AieRC RC;
 	int Ret;
+	u8 Queued;
 	struct aie_reg_args Args;
 
+	Reg = _XAie_LinuxIO_GetMmapReg(LinuxIOInst, RegOff);
+	if(Reg != NULL) {
+		RC = _XAie_LinuxIO_WcFlush(LinuxIOInst);
+		*Reg = (*Reg & ~Mask) | (Value & Mask);
+		return RC;
+	}
+
+	RC = _XAie_LinuxIO_WcWrite(LinuxIOInst, RegOff, Mask, Value, &Queued);
+	if(Queued == XAIE_ENABLE) {
+		return RC;
+	}
+
 	Args.op = AIE_REG_WRITE;
 	Args.offset = RegOff;
 	Args.val = Value;
@@ -473,37 +1112,20 @@ static AieRC XAie_LinuxIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 * @note		Internal only.
 *
 *******************************************************************************/
-static AieRC XAie_LinuxIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
+XAIE_LINUX_IO_ACCESSOR
+AieRC XAie_LinuxIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
 		u32 TimeOutUs)
 {
-	AieRC Ret = XAIE_ERR;
-	u32 Count, MinTimeOutUs, RegVal;
-
-	/*
-	 * Any value less than 200 us becomes noticable overhead. This is based
-	 * on some profiling, and it may vary between platforms.
-	 */
-	MinTimeOutUs = 200;
-	Count = ((u64)TimeOutUs + MinTimeOutUs - 1) / MinTimeOutUs;
-
-	while (Count > 0U) {
-		XAie_LinuxIO_Read32(IOInst, RegOff, &RegVal);
-		if((RegVal & Mask) == Value) {
-			Ret = XAIE_OK;
-			break;
-		}
-		usleep(MinTimeOutUs);
-		Count--;
-	}
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	AieRC RC;
 
-	/* Check for the break from timed-out loop */
-	XAie_LinuxIO_Read32(IOInst, RegOff, &RegVal);
-	if((Ret == XAIE_ERR) && ((RegVal & Mask) ==
-			 Value)) {
-		Ret = XAIE_OK;
+	RC = _XAie_LinuxIO_WcFlush(LinuxIOInst);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	return Ret;
+	return _XAie_IOCommon_MaskPoll(IOInst, XAie_LinuxIO_Read32,
+			&LinuxIOInst->PollCfg, RegOff, Mask, Value, TimeOutUs);
 }
 
 /*****************************************************************************/
@@ -596,68 +1218,6 @@ static inline u64 _XAie_GetMemOffset(XAie_LinuxIO *IOInst, u8 TileType, u8 Col,
 	return 0;
 }
 
-/*****************************************************************************/
-/**
-*
-* This function copies data to the device using memcpy. The function accepts
-* a 32 bit aligned address. 128bit unaligned addresses are managed within the
-* funtion.
-*
-* @param	Dest: Pointer to the destination address.
-* @param	Src: Pointer to the source buffer.
-* @param	Size: Number of 32-bit words.
-*
-* @return	None.
-*
-* @note		Internal only.
-*
-*******************************************************************************/
-static void _XAie_CopyDataToMem(u32 *Dest, const u32 *Src, u32 Size)
-{
-	u32 StartExtraWrds = 0, EndExtraWrds = 0;
-
-	if((u64)Dest & XAIE_128BIT_ALIGN_MASK) {
-		StartExtraWrds = ((XAIE_128BIT_ALIGN_MASK + 1) -
-				(((u64)Dest) & XAIE_128BIT_ALIGN_MASK)) / 4;
-	}
-
-	if(StartExtraWrds > 0) {
-		for(u8 i = 0; i < StartExtraWrds && Size > 0;  i++) {
-			*Dest = *Src;
-			Dest++;
-			Src++;
-			Size--;
-		}
-	}
-
-	if((u64)(Dest + Size) & XAIE_128BIT_ALIGN_MASK) {
-		EndExtraWrds = (((u64)(Dest + Size)) &
-				XAIE_128BIT_ALIGN_MASK) / 4;
-	}
-
-	if(Size >= (XAIE_128BIT_ALIGN_MASK + 1)) {
-		memcpy((void *)Dest, (void *)Src,
-				(Size - EndExtraWrds) * sizeof(u32));
-		Dest += Size - EndExtraWrds;
-		Src += Size - EndExtraWrds;
-		Size -= Size - EndExtraWrds;
-	}
-
-	if(Size > 0) {
-		for(u8 i = 0; Size > 0; i++) {
-			*Dest = *Src;
-			Dest++;
-			Src++;
-			Size--;
-		}
-	}
-
-	if(Size != 0) {
-		XAIE_ERROR("Copying data to memory failed. %u words not"
-				"written to device\n", Size);
-	}
-}
-
 /*****************************************************************************/
 /**
 *
@@ -685,7 +1245,7 @@ static u32* _XAie_GetVirtAddrFromOffset(XAie_LinuxIO *IOInst, u64 RegOff,
 	XAie_LocType Loc = {Row, Col};
 	u8 TileType;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MEMTILE) {
 		MemOffset = _XAie_GetMemOffset(IOInst, TileType, Col, Row,
 				IOInst->MemTileMemSize);
@@ -730,117 +1290,535 @@ static u32* _XAie_GetVirtAddrFromOffset(XAie_LinuxIO *IOInst, u64 RegOff,
 * @note		Internal only.
 *
 *******************************************************************************/
-static AieRC XAie_LinuxIO_BlockWrite32(void *IOInst, u64 RegOff,
+XAIE_LINUX_IO_ACCESSOR
+AieRC XAie_LinuxIO_BlockWrite32(void *IOInst, u64 RegOff,
 		const u32 *Data, u32 Size)
 {
 	XAie_LinuxIO *Inst = (XAie_LinuxIO *)IOInst;
 	u32 *VirtAddr;
+	AieRC RC;
+
+	/* Handle PM and DM sections */
+	VirtAddr =  _XAie_GetVirtAddrFromOffset(Inst, RegOff, Size);
+	if(VirtAddr != NULL) {
+		/* Keep the order with the buffered register writes */
+		RC = _XAie_LinuxIO_WcFlush(Inst);
+		_XAie_IOCommon_CopyToDev(VirtAddr, Data, Size);
+		return RC;
+	}
+
+	/* Handle other registers */
+	for(u32 i = 0; i < Size; i++) {
+		XAie_LinuxIO_Write32(IOInst, RegOff + i * 4U, *Data);
+		Data++;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to initialize a chunk of aie address space with
+* a specified value.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Data to initialize a chunk of aie address space..
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+XAIE_LINUX_IO_ACCESSOR
+AieRC XAie_LinuxIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
+		u32 Size)
+{
+	XAie_LinuxIO *Inst = (XAie_LinuxIO *)IOInst;
+	u32 *VirtAddr;
+	AieRC RC;
 
 	/* Handle PM and DM sections */
 	VirtAddr =  _XAie_GetVirtAddrFromOffset(Inst, RegOff, Size);
 	if(VirtAddr != NULL) {
-		_XAie_CopyDataToMem(VirtAddr, Data, Size);
+		/* Keep the order with the buffered register writes */
+		RC = _XAie_LinuxIO_WcFlush(Inst);
+		for(u32 i = 0; i < Size; i++) {
+			*VirtAddr++ = Data;
+		}
+		return RC;
+	}
+
+	/* Handle other registers */
+	for(u32 i = 0; i < Size; i++) {
+		XAie_LinuxIO_Write32(IOInst, RegOff + i * 4U, Data);
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_LinuxIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_LinuxIO *Inst = (XAie_LinuxIO *)IOInst;
+	const volatile u32 *Reg;
+	u32 *VirtAddr;
+	AieRC RC;
+
+	RC = _XAie_LinuxIO_WcFlush(Inst);
+
+	/* Handle PM and DM sections */
+	VirtAddr =  _XAie_GetVirtAddrFromOffset(Inst, RegOff, Size);
+	if(VirtAddr != NULL) {
+		_XAie_IOCommon_CopyFromDev(Data, (const void *)VirtAddr, Size);
+		return RC;
+	}
+
+	/* Handle other registers */
+	Reg = (const volatile u32 *)((u8 *)Inst->RegMap.VAddr + RegOff);
+	for(u32 i = 0; i < Size; i++) {
+		Data[i] = Reg[i];
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is function to attach the allocated memory descriptor to kernel driver
+*
+* @param	IOInst: IO instance pointer
+* @param	MemInst: Linux Memory instance pointer.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxMemAttach(XAie_LinuxIO *IOInst, XAie_LinuxMem *MemInst)
+{
+	int Ret;
+
+	Ret = ioctl(IOInst->PartitionFd, AIE_ATTACH_DMABUF_IOCTL,
+			MemInst->BufferFd);
+	if(Ret != 0) {
+		XAIE_ERROR("Failed to attach to dmabuf, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is function to attach the allocated memory descriptor to kernel driver
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	MemInst: Linux Memory instance pointer.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxMemDetach(XAie_LinuxIO *IOInst, XAie_LinuxMem *MemInst)
+{
+	int Ret;
+
+	Ret = ioctl(IOInst->PartitionFd, AIE_DETACH_DMABUF_IOCTL,
+			MemInst->BufferFd);
+	if(Ret != 0) {
+		XAIE_ERROR("Failed to detach dmabuf, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory function to attach the external memory to device
+*
+* @param	MemInst: Memory instance pointer.
+* @param	MemHandle: dmabuf fd
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_LinuxMemAttach(XAie_MemInst *MemInst, u64 MemHandle)
+{
+	XAie_DevInst *DevInst = MemInst->DevInst;
+	XAie_LinuxIO *IOInst = (XAie_LinuxIO *)DevInst->IOInst;
+	XAie_LinuxAttachCache *Cache = IOInst->AttachCache;
+	XAie_LinuxMem *LinuxMemInst;
+	struct stat Stat;
+	s32 Idx = -1;
+	AieRC RC;
+
+	if((Cache != NULL) && (fstat((int)MemHandle, &Stat) != 0)) {
+		/* Not a file, leave the attachment out of the cache */
+		Cache = NULL;
+	}
+
+	LinuxMemInst = (XAie_LinuxMem *)malloc(sizeof(*LinuxMemInst));
+	if(LinuxMemInst == NULL) {
+		XAIE_ERROR("Memory attachmeent failed, Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	LinuxMemInst->BufferFd = MemHandle;
+	LinuxMemInst->CacheIdx = -1;
+	LinuxMemInst->MemFd = -1;
+	LinuxMemInst->MapSize = 0U;
+
+	if(Cache != NULL) {
+		Idx = Cache->Hash[_XAie_LinuxAttachHash(Cache, Stat.st_ino)];
+		while((Idx >= 0) && (Cache->Entries[Idx].Ino != Stat.st_ino)) {
+			Idx = Cache->Entries[Idx].HashNext;
+		}
+		if(Idx >= 0) {
+			/* Known dmabuf, still attached */
+			if(Cache->Entries[Idx].Refs == 0U) {
+				_XAie_LinuxAttachLruRemove(Cache, Idx);
+			}
+			Cache->Entries[Idx].Refs++;
+			LinuxMemInst->CacheIdx = Idx;
+			MemInst->BackendHandle = (void *)LinuxMemInst;
+			return XAIE_OK;
+		}
+	}
+
+	RC = _XAie_LinuxMemAttach(IOInst, LinuxMemInst);
+	if(RC != XAIE_OK) {
+		free(LinuxMemInst);
+		return XAIE_ERR;
+	}
+
+	if(Cache != NULL) {
+		if((Cache->Free < 0) && (Cache->LruHead >= 0)) {
+			Idx = Cache->LruHead;
+			_XAie_LinuxAttachLruRemove(Cache, Idx);
+			_XAie_LinuxAttachEvict(IOInst, Idx);
+		}
+		Idx = Cache->Free;
+		if(Idx >= 0) {
+			XAie_LinuxAttach *E = &Cache->Entries[Idx];
+			u32 H = _XAie_LinuxAttachHash(Cache, Stat.st_ino);
+
+			E->Fd = dup((int)MemHandle);
+			if(E->Fd >= 0) {
+				Cache->Free = E->HashNext;
+				E->Ino = Stat.st_ino;
+				E->Refs = 1U;
+				E->HashNext = Cache->Hash[H];
+				Cache->Hash[H] = Idx;
+				LinuxMemInst->CacheIdx = Idx;
+			}
+		}
+	}
+
+	MemInst->BackendHandle = (void *)LinuxMemInst;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory function to detach the memory from device
+*
+* @param	MemInst: Memory instance pointer.
+*
+* @return	XAIE_OK for success
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC XAie_LinuxMemDetach(XAie_MemInst *MemInst)
+{
+	XAie_DevInst *DevInst = MemInst->DevInst;
+	XAie_LinuxIO *IOInst = (XAie_LinuxIO *)DevInst->IOInst;
+	XAie_LinuxMem *LinuxMemInst =
+		(XAie_LinuxMem *)MemInst->BackendHandle;
+	AieRC RC;
+
+	if(LinuxMemInst->CacheIdx >= 0) {
+		XAie_LinuxAttachCache *Cache = IOInst->AttachCache;
+		s32 Idx = LinuxMemInst->CacheIdx;
+		XAie_LinuxAttach *E = &Cache->Entries[Idx];
+
+		/* Keep the dmabuf attached until the entry is evicted */
+		E->Refs--;
+		if(E->Refs == 0U) {
+			E->LruPrev = Cache->LruTail;
+			E->LruNext = -1;
+			if(Cache->LruTail >= 0) {
+				Cache->Entries[Cache->LruTail].LruNext = Idx;
+			} else {
+				Cache->LruHead = Idx;
+			}
+			Cache->LruTail = Idx;
+		}
+		free(LinuxMemInst);
 		return XAIE_OK;
 	}
 
-	/* Handle other registers */
-	for(u32 i = 0; i < Size; i++) {
-		XAie_LinuxIO_Write32(IOInst, RegOff + i * 4U, *Data);
-		Data++;
+	RC = _XAie_LinuxMemDetach(IOInst, LinuxMemInst);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	free(LinuxMemInst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates the memfd backing a buffer allocated by the backend.
+* With huge pages enabled, the memfd is created from huge pages and falls back
+* to regular pages if no huge page is available.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	Size: Size of the buffer.
+* @param	MapSize: Pointer to return the size of the memfd, rounded up
+*		to its page size.
+*
+* @return	File descriptor of the memfd on success, -1 on failure.
+*
+* @note		Internal only. The memfd is sealed against shrinking, which
+*		udmabuf requires.
+*
+*******************************************************************************/
+static int _XAie_LinuxMemCreateFd(XAie_LinuxIO *IOInst, u64 Size,
+		u64 *MapSize)
+{
+	u64 PageSize = (u64)sysconf(_SC_PAGESIZE);
+	int Fd = -1;
+
+	if(IOInst->HugePages != 0U) {
+		Fd = memfd_create("xaie_mem",
+				MFD_CLOEXEC | MFD_ALLOW_SEALING | MFD_HUGETLB);
+		*MapSize = (Size + XAIE_LINUX_HUGE_PAGE_SIZE - 1U) &
+			~((u64)XAIE_LINUX_HUGE_PAGE_SIZE - 1U);
+		if((Fd >= 0) && (ftruncate(Fd, (off_t)*MapSize) != 0)) {
+			close(Fd);
+			Fd = -1;
+		}
+		if(Fd < 0) {
+			XAIE_DBG("No huge pages for buffer of size 0x%lx, %d: "
+					"%s\n", Size, errno, strerror(errno));
+		}
+	}
+
+	if(Fd < 0) {
+		Fd = memfd_create("xaie_mem", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+		*MapSize = (Size + PageSize - 1U) & ~(PageSize - 1U);
+		if((Fd >= 0) && (ftruncate(Fd, (off_t)*MapSize) != 0)) {
+			close(Fd);
+			Fd = -1;
+		}
+	}
+
+	if(Fd < 0) {
+		XAIE_ERROR("Failed to create buffer memory, %d: %s\n",
+				errno, strerror(errno));
+		return -1;
+	}
+
+	if(fcntl(Fd, F_ADD_SEALS, F_SEAL_SHRINK) != 0) {
+		XAIE_ERROR("Failed to seal buffer memory, %d: %s\n",
+				errno, strerror(errno));
+		close(Fd);
+		return -1;
 	}
 
-	return XAIE_OK;
+	return Fd;
 }
 
 /*****************************************************************************/
 /**
 *
-* This is the memory IO function to initialize a chunk of aie address space with
-* a specified value.
+* This is the memory function to allocate a memory buffer. The buffer is a
+* memfd exported as a dmabuf through udmabuf and attached to the partition.
 *
-* @param	IOInst: IO instance pointer
-* @param	RegOff: Register offset to read from.
-* @param	Data: Data to initialize a chunk of aie address space..
-* @param	Size: Number of 32-bit words.
+* @param	DevInst: Device Instance
+* @param	Size: Size of the memory
+* @param	Cache: Buffer to be cacheable or not
 *
-* @return	None.
+* @return	Pointer to the allocated memory instance, NULL on failure.
 *
-* @note		Internal only.
+* @note		Internal only. The buffer is always cacheable, the cache
+*		property is ignored. The CPU mapping is of the memfd, so it
+*		uses huge page table entries for buffers from huge pages. The
+*		device address is 0, the offset to the start of the dmabuf.
 *
 *******************************************************************************/
-static AieRC XAie_LinuxIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
-		u32 Size)
+static XAie_MemInst* XAie_LinuxMemAllocate(XAie_DevInst *DevInst, u64 Size,
+		XAie_MemCacheProp Cache)
 {
-	XAie_LinuxIO *Inst = (XAie_LinuxIO *)IOInst;
-	u32 *VirtAddr;
+	XAie_LinuxIO *IOInst = (XAie_LinuxIO *)DevInst->IOInst;
+	struct udmabuf_create Create;
+	XAie_LinuxMem *LinuxMemInst;
+	XAie_MemInst *MemInst;
+	int UdmabufFd;
 
-	/* Handle PM and DM sections */
-	VirtAddr =  _XAie_GetVirtAddrFromOffset(Inst, RegOff, Size);
-	if(VirtAddr != NULL) {
-		for(u32 i = 0; i < Size; i++) {
-			*VirtAddr++ = Data;
-		}
-		return XAIE_OK;
+	if(Size == 0U) {
+		XAIE_ERROR("Invalid memory size\n");
+		return NULL;
 	}
 
-	/* Handle other registers */
-	for(u32 i = 0; i < Size; i++) {
-		XAie_LinuxIO_Write32(IOInst, RegOff + i * 4U, Data);
+	MemInst = (XAie_MemInst *)malloc(sizeof(*MemInst));
+	LinuxMemInst = (XAie_LinuxMem *)malloc(sizeof(*LinuxMemInst));
+	if((MemInst == NULL) || (LinuxMemInst == NULL)) {
+		XAIE_ERROR("Memory allocation failed\n");
+		goto free_inst;
 	}
 
-	return XAIE_OK;
+	LinuxMemInst->CacheIdx = -1;
+	LinuxMemInst->MemFd = _XAie_LinuxMemCreateFd(IOInst, Size,
+			&LinuxMemInst->MapSize);
+	if(LinuxMemInst->MemFd < 0) {
+		goto free_inst;
+	}
+
+	UdmabufFd = open("/dev/udmabuf", O_RDWR | O_CLOEXEC);
+	if(UdmabufFd < 0) {
+		XAIE_ERROR("Failed to open udmabuf device, %d: %s\n",
+				errno, strerror(errno));
+		goto close_memfd;
+	}
+
+	Create.memfd = (__u32)LinuxMemInst->MemFd;
+	Create.flags = UDMABUF_FLAGS_CLOEXEC;
+	Create.offset = 0U;
+	Create.size = LinuxMemInst->MapSize;
+	LinuxMemInst->BufferFd = ioctl(UdmabufFd, UDMABUF_CREATE, &Create);
+	close(UdmabufFd);
+	if(LinuxMemInst->BufferFd < 0) {
+		XAIE_ERROR("Failed to create dmabuf, %d: %s\n",
+				errno, strerror(errno));
+		goto close_memfd;
+	}
+
+	MemInst->VAddr = mmap(NULL, LinuxMemInst->MapSize,
+			PROT_READ | PROT_WRITE, MAP_SHARED, LinuxMemInst->MemFd,
+			0);
+	if(MemInst->VAddr == MAP_FAILED) {
+		XAIE_ERROR("Failed to map buffer, %d: %s\n",
+				errno, strerror(errno));
+		goto close_dmabuf;
+	}
+
+	if(_XAie_LinuxMemAttach(IOInst, LinuxMemInst) != XAIE_OK) {
+		goto unmap;
+	}
+
+	(void)Cache;
+	MemInst->Size = Size;
+	MemInst->DevAddr = 0U;
+	MemInst->Cache = XAIE_MEM_CACHEABLE;
+	MemInst->DevInst = DevInst;
+	MemInst->BackendHandle = (void *)LinuxMemInst;
+
+	return MemInst;
+
+unmap:
+	munmap(MemInst->VAddr, LinuxMemInst->MapSize);
+close_dmabuf:
+	close(LinuxMemInst->BufferFd);
+close_memfd:
+	close(LinuxMemInst->MemFd);
+free_inst:
+	free(LinuxMemInst);
+	free(MemInst);
+	return NULL;
 }
 
 /*****************************************************************************/
 /**
 *
-* This is function to attach the allocated memory descriptor to kernel driver
+* This is the memory function to free a memory buffer allocated by the backend.
 *
-* @param	IOInst: IO instance pointer
-* @param	MemInst: Linux Memory instance pointer.
+* @param	MemInst: Memory instance pointer.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only.
 *
 *******************************************************************************/
-static AieRC _XAie_LinuxMemAttach(XAie_LinuxIO *IOInst, XAie_LinuxMem *MemInst)
+static AieRC XAie_LinuxMemFree(XAie_MemInst *MemInst)
 {
-	int Ret;
+	XAie_LinuxIO *IOInst = (XAie_LinuxIO *)MemInst->DevInst->IOInst;
+	XAie_LinuxMem *LinuxMemInst =
+		(XAie_LinuxMem *)MemInst->BackendHandle;
+	AieRC RC;
 
-	Ret = ioctl(IOInst->PartitionFd, AIE_ATTACH_DMABUF_IOCTL,
-			MemInst->BufferFd);
-	if(Ret != 0) {
-		XAIE_ERROR("Failed to attach to dmabuf, %d: %s\n",
-			errno, strerror(errno));
-		return XAIE_ERR;
+	if(LinuxMemInst->MemFd < 0) {
+		XAIE_ERROR("Memory was not allocated by the backend\n");
+		return XAIE_INVALID_ARGS;
 	}
 
-	return XAIE_OK;
+	RC = _XAie_LinuxMemDetach(IOInst, LinuxMemInst);
+
+	munmap(MemInst->VAddr, LinuxMemInst->MapSize);
+	close(LinuxMemInst->BufferFd);
+	close(LinuxMemInst->MemFd);
+	free(LinuxMemInst);
+	free(MemInst);
+
+	return RC;
 }
 
 /*****************************************************************************/
 /**
 *
-* This is function to attach the allocated memory descriptor to kernel driver
+* This function syncs a dmabuf with the dmabuf sync ioctl.
 *
-* @param	IOInst: Linux IO instance pointer
-* @param	MemInst: Linux Memory instance pointer.
+* @param	MemInst: Memory instance pointer.
+* @param	Flags: DMA_BUF_SYNC_START to start CPU access, DMA_BUF_SYNC_END
+*		to end it.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only.
 *
 *******************************************************************************/
-static AieRC _XAie_LinuxMemDetach(XAie_LinuxIO *IOInst, XAie_LinuxMem *MemInst)
+static AieRC _XAie_LinuxMemSync(XAie_MemInst *MemInst, u64 Flags)
 {
-	int Ret;
+	XAie_LinuxMem *LinuxMemInst =
+		(XAie_LinuxMem *)MemInst->BackendHandle;
+	struct dma_buf_sync Sync;
 
-	Ret = ioctl(IOInst->PartitionFd, AIE_DETACH_DMABUF_IOCTL,
-			MemInst->BufferFd);
-	if(Ret != 0) {
-		XAIE_ERROR("Failed to detach dmabuf, %d: %s\n",
-			errno, strerror(errno));
+	Sync.flags = Flags | DMA_BUF_SYNC_RW;
+	if(ioctl(LinuxMemInst->BufferFd, DMA_BUF_IOCTL_SYNC, &Sync) != 0) {
+		XAIE_ERROR("Failed to sync dmabuf, %d: %s\n",
+				errno, strerror(errno));
 		return XAIE_ERR;
 	}
 
@@ -850,70 +1828,35 @@ static AieRC _XAie_LinuxMemDetach(XAie_LinuxIO *IOInst, XAie_LinuxMem *MemInst)
 /*****************************************************************************/
 /**
 *
-* This is the memory function to attach the external memory to device
+* This is the memory function to sync the memory for CPU.
 *
 * @param	MemInst: Memory instance pointer.
-* @param	MemHandle: dmabuf fd
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only.
 *
 *******************************************************************************/
-static AieRC XAie_LinuxMemAttach(XAie_MemInst *MemInst, u64 MemHandle)
+static AieRC XAie_LinuxMemSyncForCPU(XAie_MemInst *MemInst)
 {
-	XAie_DevInst *DevInst = MemInst->DevInst;
-	XAie_LinuxMem *LinuxMemInst;
-	AieRC RC;
-
-	LinuxMemInst = (XAie_LinuxMem *)malloc(sizeof(*LinuxMemInst));
-	if(LinuxMemInst == NULL) {
-		XAIE_ERROR("Memory attachmeent failed, Memory allocation failed\n");
-		return XAIE_ERR;
-	}
-
-	LinuxMemInst->BufferFd = MemHandle;
-
-	RC = _XAie_LinuxMemAttach((XAie_LinuxIO *)DevInst->IOInst,
-			LinuxMemInst);
-	if(RC != XAIE_OK) {
-		free(LinuxMemInst);
-		return XAIE_ERR;
-	}
-
-	MemInst->BackendHandle = (void *)LinuxMemInst;
-
-	return XAIE_OK;
+	return _XAie_LinuxMemSync(MemInst, DMA_BUF_SYNC_START);
 }
 
 /*****************************************************************************/
 /**
 *
-* This is the memory function to detach the memory from device
+* This is the memory function to sync the memory for device.
 *
 * @param	MemInst: Memory instance pointer.
 *
-* @return	XAIE_OK for success
+* @return	XAIE_OK on success, Error code on failure.
 *
-* @note		None.
+* @note		Internal only.
 *
 *******************************************************************************/
-static AieRC XAie_LinuxMemDetach(XAie_MemInst *MemInst)
+static AieRC XAie_LinuxMemSyncForDev(XAie_MemInst *MemInst)
 {
-	XAie_DevInst *DevInst = MemInst->DevInst;
-	XAie_LinuxMem *LinuxMemInst =
-		(XAie_LinuxMem *)MemInst->BackendHandle;
-	AieRC RC;
-
-	RC = _XAie_LinuxMemDetach((XAie_LinuxIO *)DevInst->IOInst,
-			LinuxMemInst);
-	if(RC != XAIE_OK) {
-		return RC;
-	}
-
-	free(LinuxMemInst);
-
-	return XAIE_OK;
+	return _XAie_LinuxMemSync(MemInst, DMA_BUF_SYNC_END);
 }
 
 /*****************************************************************************/
@@ -981,6 +1924,37 @@ static AieRC _XAie_LinuxIO_ConfigShimDmaBd(void *IOInst,
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is function to configure a batch of shim dma BDs using the linux kernel
+* driver.
+*
+* @param	IOInst: IO instance pointer
+* @param	Batch: Batch of shim dma arguments.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*		The partition driver has no batched BD ioctl, so the BDs are
+*		set one at a time. It stops at the first BD which fails.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_ConfigShimDmaBdBatch(void *IOInst,
+		XAie_BackendShimDmaBdBatch *Batch)
+{
+	AieRC RC;
+
+	for(u32 i = 0U; i < Batch->NumBds; i++) {
+		RC = _XAie_LinuxIO_ConfigShimDmaBd(IOInst, &Batch->BdArgs[i]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1290,6 +2264,56 @@ AieRC _XAie_LinuxIO_RequestAllocatedRsc(void *IOInst,
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* The API grants a batch of resources, all of them or none. The partition
+* driver has no batch request, so the resources are requested one at a time
+* and the ones granted are freed again if a request fails.
+*
+* @param	IOInst: IO instance pointer
+* @param	Args: Contains the batch of requests
+*
+* @return	XAIE_OK on success
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_RequestRscBatch(void *IOInst,
+		XAie_BackendRscBatch *Args)
+{
+	AieRC RC = XAIE_OK;
+	u32 i;
+
+	for(i = 0U; i < Args->NumRscs; i++) {
+		XAie_BackendTilesRsc *TilesRsc = &Args->TilesRsc[i];
+
+		if(TilesRsc->RscId == XAIE_RSC_ID_ANY) {
+			RC = _XAie_LinuxIO_RequestRsc(IOInst, TilesRsc);
+		} else {
+			RC = _XAie_LinuxIO_RequestAllocatedRsc(IOInst,
+					TilesRsc);
+		}
+		if(RC != XAIE_OK) {
+			break;
+		}
+	}
+
+	if(RC == XAIE_OK) {
+		return XAIE_OK;
+	}
+
+	while(i > 0U) {
+		XAie_BackendTilesRsc TilesRsc = Args->TilesRsc[--i];
+
+		if(TilesRsc.RscId == XAIE_RSC_ID_ANY) {
+			TilesRsc.RscId = TilesRsc.Rscs->RscId;
+		}
+		_XAie_LinuxIO_FreeRsc(IOInst, &TilesRsc);
+	}
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 * This API gets requested resource statics information
@@ -1352,9 +2376,16 @@ static AieRC XAie_LinuxIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 {
 	AieRC RC;
 
+	RC = _XAie_LinuxIO_WcFlush((XAie_LinuxIO *)IOInst);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	switch(Op) {
 	case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
 		return _XAie_LinuxIO_ConfigShimDmaBd(IOInst, Arg);
+	case XAIE_BACKEND_OP_CONFIG_SHIMDMABD_BATCH:
+		return _XAie_LinuxIO_ConfigShimDmaBdBatch(IOInst, Arg);
 	case XAIE_BACKEND_OP_REQUEST_TILES:
 		RC = _XAie_LinuxIO_RequestTiles(IOInst, Arg);
 		if(RC == XAIE_OK)
@@ -1371,8 +2402,25 @@ static AieRC XAie_LinuxIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		return _XAie_LinuxIO_FreeRsc(IOInst, Arg);
 	case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
 		return _XAie_LinuxIO_RequestAllocatedRsc(IOInst, Arg);
+	case XAIE_BACKEND_OP_REQUEST_RSC_BATCH:
+		return _XAie_LinuxIO_RequestRscBatch(IOInst, Arg);
 	case XAIE_BACKEND_OP_GET_RSC_STAT:
 		return _XAie_LinuxIO_GetRscStat(IOInst, Arg);
+	case XAIE_BACKEND_OP_CONFIG_REG_MMAP:
+		return _XAie_LinuxIO_ConfigRegMmap(IOInst, (u8 *)Arg);
+	case XAIE_BACKEND_OP_CONFIG_WRITE_COMBINE:
+		return _XAie_LinuxIO_ConfigWc(IOInst, (u32 *)Arg);
+	case XAIE_BACKEND_OP_FLUSH_WRITES:
+		/* Pending writes are flushed on entry */
+		return XAIE_OK;
+	case XAIE_BACKEND_OP_CONFIG_POLL:
+		((XAie_LinuxIO *)IOInst)->PollCfg = *((XAie_PollCfg *)Arg);
+		return XAIE_OK;
+	case XAIE_BACKEND_OP_CONFIG_ATTACH_CACHE:
+		return _XAie_LinuxIO_ConfigAttachCache(IOInst, (u32 *)Arg);
+	case XAIE_BACKEND_OP_CONFIG_HUGE_PAGES:
+		((XAie_LinuxIO *)IOInst)->HugePages = *((u8 *)Arg);
+		return XAIE_OK;
 	default:
 		XAIE_ERROR("Linux backend does not support operation %d\n", Op);
 		return XAIE_FEATURE_NOT_SUPPORTED;
@@ -1395,26 +2443,63 @@ static u64 XAie_LinuxGetTid(void)
 *
 * @return	XAIE_OK for success and error code for failure.
 *
-* @note		Internal only.
+* @note		Internal only. The kernel transaction interface only supports
+*		writes. The commands are submitted in one ioctl unless the
+*		transaction has deferred reads, polls, shim DMA BDs or memory
+*		syncs, which are executed in order between the ioctls of the
+*		surrounding writes.
 *
 *******************************************************************************/
 static AieRC XAie_LinuxSubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
-	int Ret;
-	struct aie_txn_inst Args;
+	u32 Start = 0U;
+	AieRC RC;
 
-	Args.num_cmds = TxnInst->NumCmds;
-	Args.cmdsptr = (u64)TxnInst->CmdBuf;
+	RC = _XAie_LinuxIO_WcFlush(LinuxIOInst);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
 
-	Ret = ioctl(LinuxIOInst->PartitionFd, AIE_TRANSACTION_IOCTL, &Args);
-	if(Ret < 0) {
-		XAIE_ERROR("Submitting transaction to device failed, %d: %s\n",
-			errno, strerror(errno));
-		return XAIE_ERR;
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+
+		if((Cmd->Opcode != XAIE_IO_READ) &&
+				(Cmd->Opcode != XAIE_IO_MASKPOLL) &&
+				(Cmd->Opcode != XAIE_IO_SHIMDMABD) &&
+				(Cmd->Opcode != XAIE_IO_MEMSYNC)) {
+			continue;
+		}
+
+		RC = _XAie_LinuxSubmitCmds(LinuxIOInst,
+				&TxnInst->CmdBuf[Start], i - Start);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		if(Cmd->Opcode == XAIE_IO_READ) {
+			RC = XAie_LinuxIO_Read32(IOInst, Cmd->RegOff,
+					(u32 *)(uintptr_t)Cmd->DataPtr);
+		} else if(Cmd->Opcode == XAIE_IO_MASKPOLL) {
+			RC = XAie_LinuxIO_MaskPoll(IOInst, Cmd->RegOff,
+					Cmd->Mask, Cmd->Value, Cmd->Size);
+		} else if(Cmd->Opcode == XAIE_IO_SHIMDMABD) {
+			RC = _XAie_LinuxIO_ConfigShimDmaBd(IOInst,
+					(XAie_ShimDmaBdArgs *)(uintptr_t)
+					Cmd->DataPtr);
+		} else {
+			RC = XAie_MemSyncBatch((const XAie_MemSyncRange *)
+					(uintptr_t)Cmd->DataPtr, 1U);
+		}
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		Start = i + 1U;
 	}
 
-	return XAIE_OK;
+	return _XAie_LinuxSubmitCmds(LinuxIOInst, &TxnInst->CmdBuf[Start],
+			TxnInst->NumCmds - Start);
 }
 
 #else
@@ -1502,6 +2587,18 @@ static AieRC XAie_LinuxIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 	return XAIE_ERR;
 }
 
+static AieRC XAie_LinuxIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
 static AieRC XAie_LinuxIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		XAie_BackendOpCode Op, void *Arg)
 {
@@ -1537,23 +2634,6 @@ static AieRC XAie_LinuxSubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
 	return XAIE_ERR;
 }
 
-#endif /* __AIELINUX__ */
-
-static AieRC XAie_LinuxIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
-		u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
-{
-	/* no-op */
-	(void)IOInst;
-	(void)Col;
-	(void)Row;
-	(void)Command;
-	(void)CmdWd0;
-	(void)CmdWd1;
-	(void)CmdStr;
-
-	return XAIE_ERR;
-}
-
 static XAie_MemInst* XAie_LinuxMemAllocate(XAie_DevInst *DevInst, u64 Size,
 		XAie_MemCacheProp Cache)
 {
@@ -1581,6 +2661,23 @@ static AieRC XAie_LinuxMemSyncForDev(XAie_MemInst *MemInst)
 	return XAIE_ERR;
 }
 
+#endif /* __AIELINUX__ */
+
+static AieRC XAie_LinuxIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
+		u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)Col;
+	(void)Row;
+	(void)Command;
+	(void)CmdWd0;
+	(void)CmdWd1;
+	(void)CmdStr;
+
+	return XAIE_ERR;
+}
+
 const XAie_Backend LinuxBackend =
 {
 	.Type = XAIE_IO_BACKEND_LINUX,
@@ -1592,12 +2689,14 @@ const XAie_Backend LinuxBackend =
 	.Ops.MaskPoll = XAie_LinuxIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_LinuxIO_BlockWrite32,
 	.Ops.BlockSet32 = XAie_LinuxIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_LinuxIO_BlockRead32,
 	.Ops.CmdWrite = XAie_LinuxIO_CmdWrite,
 	.Ops.RunOp = XAie_LinuxIO_RunOp,
 	.Ops.MemAllocate = XAie_LinuxMemAllocate,
 	.Ops.MemFree = XAie_LinuxMemFree,
 	.Ops.MemSyncForCPU = XAie_LinuxMemSyncForCPU,
 	.Ops.MemSyncForDev = XAie_LinuxMemSyncForDev,
+	.Ops.MemSyncRanges = NULL,
 	.Ops.MemAttach = XAie_LinuxMemAttach,
 	.Ops.MemDetach = XAie_LinuxMemDetach,
 	.Ops.GetTid = XAie_LinuxGetTid,
@@ -57,6 +57,8 @@ typedef struct XAie_MetalIO {
 	u64 MapSize;
 	void *NpiBaseAddr;
 	u64 NpiMapSize;
+	XAie_DevInst *DevInst;
+	XAie_PollCfg PollCfg;
 } XAie_MetalIO;
 
 #endif /* __AIEMETAL__ */
@@ -211,6 +213,8 @@ static AieRC XAie_MetalIO_Init(XAie_DevInst *DevInst)
 	MetalIOInst->BaseAddr = (u64)Addr;
 	MetalIOInst->DevFd = Fd;
 	MetalIOInst->MapSize = Size;
+	MetalIOInst->DevInst = DevInst;
+	_XAie_IOCommon_InitPollCfg(&MetalIOInst->PollCfg);
 
 	_XAie_MetalIO_MapNpi(MetalIOInst);
 
@@ -318,32 +322,10 @@ static AieRC XAie_MetalIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_MetalIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
 		u32 TimeOutUs)
 {
-	AieRC Ret = XAIE_ERR;
-	u32 Count, MinTimeOutUs, RegVal;
-
-	/*
-	 * Any value less than 200 us becomes noticable overhead. This is based
-	 * on some profiling, and it may vary between platforms.
-	 */
-	MinTimeOutUs = 200;
-	Count = ((u64)TimeOutUs + MinTimeOutUs - 1) / MinTimeOutUs;
-
-	while (Count > 0U) {
-		XAie_MetalIO_Read32(IOInst, RegOff, &RegVal);
-		if((RegVal & Mask) == Value) {
-			return XAIE_OK;
-		}
-		usleep(MinTimeOutUs);
-		Count--;
-	}
-
-	/* Check for the break from timed-out loop */
-	XAie_MetalIO_Read32(IOInst, RegOff, &RegVal);
-	if((RegVal & Mask) == Value) {
-		Ret = XAIE_OK;
-	}
+	XAie_MetalIO *MetalIOInst = (XAie_MetalIO *)IOInst;
 
-	return Ret;
+	return _XAie_IOCommon_MaskPoll(IOInst, XAie_MetalIO_Read32,
+			&MetalIOInst->PollCfg, RegOff, Mask, Value, TimeOutUs);
 }
 
 /*****************************************************************************/
@@ -364,6 +346,15 @@ static AieRC XAie_MetalIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value
 static AieRC XAie_MetalIO_BlockWrite32(void *IOInst, u64 RegOff,
 		const u32 *Data, u32 Size)
 {
+	XAie_MetalIO *MetalIOInst = (XAie_MetalIO *)IOInst;
+
+	if(_XAie_IOCommon_IsTileMem(MetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_CopyToDev((void *)(MetalIOInst->BaseAddr +
+					RegOff), Data, Size);
+		return XAIE_OK;
+	}
+
 	for(u32 i = 0; i < Size; i++) {
 		XAie_MetalIO_Write32(IOInst, RegOff + i * 4U, *Data);
 		Data++;
@@ -391,6 +382,15 @@ static AieRC XAie_MetalIO_BlockWrite32(void *IOInst, u64 RegOff,
 static AieRC XAie_MetalIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 		u32 Size)
 {
+	XAie_MetalIO *MetalIOInst = (XAie_MetalIO *)IOInst;
+
+	if(_XAie_IOCommon_IsTileMem(MetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_SetDev((void *)(MetalIOInst->BaseAddr + RegOff),
+				Data, Size);
+		return XAIE_OK;
+	}
+
 	for(u32 i = 0; i < Size; i++) {
 		XAie_MetalIO_Write32(IOInst, RegOff + i * 4U, Data);
 	}
@@ -398,6 +398,41 @@ static AieRC XAie_MetalIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_MetalIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_MetalIO *MetalIOInst = (XAie_MetalIO *)IOInst;
+
+	if(_XAie_IOCommon_IsTileMem(MetalIOInst->DevInst, RegOff, Size) ==
+			XAIE_ENABLE) {
+		_XAie_IOCommon_CopyFromDev(Data,
+				(const void *)(MetalIOInst->BaseAddr + RegOff),
+				Size);
+		return XAIE_OK;
+	}
+
+	for(u32 i = 0; i < Size; i++) {
+		XAie_MetalIO_Read32(IOInst, RegOff + i * 4U, &Data[i]);
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -530,6 +565,14 @@ static AieRC XAie_MetalIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			return _XAie_MetalIO_NpiMaskPoll(IOInst, Req->NpiRegOff,
 					Req->Mask, Req->Val, Req->TimeOutUs);
 		}
+		case XAIE_BACKEND_OP_NPI_REQ_LIST:
+			if (MetalIOInst->NpiBaseAddr == NULL) {
+				break;
+			}
+			return _XAie_IOCommon_NpiReqList(IOInst,
+					(XAie_BackendNpiReqList *)Arg,
+					_XAie_MetalIO_NpiWrite32,
+					_XAie_MetalIO_NpiMaskPoll);
 		case XAIE_BACKEND_OP_ASSERT_SHIMRST:
 		{
 			u8 RstEnable = (u8)((uintptr_t)Arg & 0xFF);
@@ -570,13 +613,20 @@ static AieRC XAie_MetalIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			return _XAie_FreeRscCommon(Arg);
 		case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
 			return _XAie_RequestAllocatedRscCommon(DevInst, Arg);
+		case XAIE_BACKEND_OP_REQUEST_RSC_BATCH:
+			return _XAie_RequestRscBatchCommon(DevInst, Arg);
 		case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
 			return _XAie_PrivilegeInitPart(DevInst,
 					(XAie_PartInitOpts *)Arg);
 		case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
-			return _XAie_PrivilegeTeardownPart(DevInst);
+			return _XAie_PrivilegeTeardownPart(DevInst,
+					(const u32 *)Arg);
 		case XAIE_BACKEND_OP_GET_RSC_STAT:
 			return _XAie_GetRscStatCommon(DevInst, Arg);
+		case XAIE_BACKEND_OP_CONFIG_POLL:
+			MetalIOInst->PollCfg = *((XAie_PollCfg *)Arg);
+			RC = XAIE_OK;
+			break;
 		default:
 			RC = XAIE_FEATURE_NOT_SUPPORTED;
 			break;
@@ -675,6 +725,18 @@ static AieRC XAie_MetalIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 	return XAIE_ERR;
 }
 
+static AieRC XAie_MetalIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
 static AieRC XAie_MetalIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		XAie_BackendOpCode Op, void *Arg)
 {
@@ -753,12 +815,14 @@ const XAie_Backend MetalBackend =
 	.Ops.MaskPoll = XAie_MetalIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_MetalIO_BlockWrite32,
 	.Ops.BlockSet32 = XAie_MetalIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_MetalIO_BlockRead32,
 	.Ops.CmdWrite = XAie_MetalIO_CmdWrite,
 	.Ops.RunOp = XAie_MetalIO_RunOp,
 	.Ops.MemAllocate = XAie_MetalMemAllocate,
 	.Ops.MemFree = XAie_MetalMemFree,
 	.Ops.MemSyncForCPU = XAie_MetalMemSyncForCPU,
 	.Ops.MemSyncForDev = XAie_MetalMemSyncForDev,
+	.Ops.MemSyncRanges = NULL,
 	.Ops.MemAttach = XAie_MetalMemAttach,
 	.Ops.MemDetach = XAie_MetalMemDetach,
 	.Ops.GetTid = XAie_IODummyGetTid,
@@ -10,7 +10,9 @@
 * @{
 *
 * This file contains the data structures and routines for low level IO
-* operations for simulation backend.
+* operations for simulation backend. When the simulator exports the ess block
+* entry points, the driver is built with __AIESIM_BLOCKIO__ so that blocks
+* cross into the simulator in one call instead of one call per word.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -40,6 +42,10 @@
 #include "xaie_io_common.h"
 #include "xaie_npi.h"
 
+/***************************** Macro Definitions *****************************/
+/* Longest run of register writes a transaction submits as one block */
+#define XAIE_SIM_TXN_RUN_WORDS		256U
+
 /****************************** Type Definitions *****************************/
 typedef struct {
 	u64 BaseAddr;
@@ -231,10 +237,16 @@ static AieRC XAie_SimIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
 static AieRC XAie_SimIO_BlockWrite32(void *IOInst, u64 RegOff, const u32 *Data,
 		u32 Size)
 {
+#ifdef __AIESIM_BLOCKIO__
+	XAie_SimIO *SimIOInst = (XAie_SimIO *)IOInst;
+
+	ess_WriteBlock32(SimIOInst->BaseAddr + RegOff, Data, Size);
+#else
 	for(u32 i = 0U; i < Size; i++) {
 		XAie_SimIO_Write32(IOInst, RegOff + i * 4U, *Data);
 		Data++;
 	}
+#endif
 
 	return XAIE_OK;
 }
@@ -257,8 +269,45 @@ static AieRC XAie_SimIO_BlockWrite32(void *IOInst, u64 RegOff, const u32 *Data,
 *******************************************************************************/
 static AieRC XAie_SimIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data, u32 Size)
 {
+#ifdef __AIESIM_BLOCKIO__
+	XAie_SimIO *SimIOInst = (XAie_SimIO *)IOInst;
+
+	ess_SetBlock32(SimIOInst->BaseAddr + RegOff, Data, Size);
+#else
 	for(u32 i = 0U; i < Size; i++)
 		XAie_SimIO_Write32(IOInst, RegOff+ i * 4U, Data);
+#endif
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_SimIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_SimIO *SimIOInst = (XAie_SimIO *)IOInst;
+
+#ifdef __AIESIM_BLOCKIO__
+	ess_ReadBlock32(SimIOInst->BaseAddr + RegOff, Data, Size);
+#else
+	for(u32 i = 0U; i < Size; i++) {
+		Data[i] = ess_Read32(SimIOInst->BaseAddr + RegOff + i * 4U);
+	}
+#endif
 
 	return XAIE_OK;
 }
@@ -399,13 +448,17 @@ static AieRC XAie_SimIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		return _XAie_SimIO_NpiMaskPoll(IOInst, Req->NpiRegOff,
 				Req->Mask, Req->Val, Req->TimeOutUs);
 	}
+	case XAIE_BACKEND_OP_NPI_REQ_LIST:
+		return _XAie_IOCommon_NpiReqList(IOInst,
+				(XAie_BackendNpiReqList *)Arg,
+				_XAie_SimIO_NpiWrite32,
+				_XAie_SimIO_NpiMaskPoll);
 	case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
 	{
 		XAie_ShimDmaBdArgs *BdArgs = (XAie_ShimDmaBdArgs *)Arg;
-		for(u8 i = 0; i < BdArgs->NumBdWords; i++) {
-			XAie_SimIO_Write32(IOInst, BdArgs->Addr + i * 4,
-					BdArgs->BdWords[i]);
-		}
+
+		XAie_SimIO_BlockWrite32(IOInst, BdArgs->Addr,
+				BdArgs->BdWords, BdArgs->NumBdWords);
 		break;
 	}
 	case XAIE_BACKEND_OP_REQUEST_TILES:
@@ -419,11 +472,14 @@ static AieRC XAie_SimIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		return _XAie_FreeRscCommon(Arg);
 	case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
 		return _XAie_RequestAllocatedRscCommon(DevInst, Arg);
+	case XAIE_BACKEND_OP_REQUEST_RSC_BATCH:
+		return _XAie_RequestRscBatchCommon(DevInst, Arg);
 	case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
 		return _XAie_PrivilegeInitPart(DevInst,
 				(XAie_PartInitOpts *)Arg);
 	case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
-		return _XAie_PrivilegeTeardownPart(DevInst);
+		return _XAie_PrivilegeTeardownPart(DevInst,
+				(const u32 *)Arg);
 	case XAIE_BACKEND_OP_GET_RSC_STAT:
 		return _XAie_GetRscStatCommon(DevInst, Arg);
 	case XAIE_BACKEND_OP_UPDATE_NPI_ADDR:
@@ -446,6 +502,96 @@ static u64 XAie_SimIOGetTid(void)
 		return (u64)pthread_self();
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the IO function to submit a transaction to the simulator. Runs of
+* writes to consecutive registers are gathered and written as one block, and
+* the block commands are passed to the simulator as blocks.
+*
+* @param	IOInst: IO instance pointer
+* @param	TxnInst: Pointer to the transaction instance.
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		Internal only. The commands are executed in order, reads and
+*		polls see the writes recorded before them.
+*
+*******************************************************************************/
+static AieRC XAie_SimIO_SubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
+{
+	AieRC RC = XAIE_OK;
+	u32 Run[XAIE_SIM_TXN_RUN_WORDS];
+	u32 RunLen = 0U;
+	u64 RunOff = 0U;
+
+	for(u32 i = 0U; (i < TxnInst->NumCmds) && (RC == XAIE_OK); i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+
+		if((Cmd->Opcode == XAIE_IO_WRITE) && (Cmd->Mask == 0U)) {
+			if((RunLen != 0U) &&
+					((Cmd->RegOff != RunOff + RunLen * 4U) ||
+					 (RunLen == XAIE_SIM_TXN_RUN_WORDS))) {
+				XAie_SimIO_BlockWrite32(IOInst, RunOff, Run,
+						RunLen);
+				RunLen = 0U;
+			}
+			if(RunLen == 0U) {
+				RunOff = Cmd->RegOff;
+			}
+			Run[RunLen++] = Cmd->Value;
+			continue;
+		}
+
+		if(RunLen != 0U) {
+			XAie_SimIO_BlockWrite32(IOInst, RunOff, Run, RunLen);
+			RunLen = 0U;
+		}
+
+		switch(Cmd->Opcode) {
+		case XAIE_IO_WRITE:
+			RC = XAie_SimIO_MaskWrite32(IOInst, Cmd->RegOff,
+					Cmd->Mask, Cmd->Value);
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			RC = XAie_SimIO_BlockWrite32(IOInst, Cmd->RegOff,
+					(const u32 *)(uintptr_t)Cmd->DataPtr,
+					Cmd->Size);
+			break;
+		case XAIE_IO_BLOCKSET:
+			RC = XAie_SimIO_BlockSet32(IOInst, Cmd->RegOff,
+					Cmd->Value, Cmd->Size);
+			break;
+		case XAIE_IO_READ:
+			RC = XAie_SimIO_Read32(IOInst, Cmd->RegOff,
+					(u32 *)(uintptr_t)Cmd->DataPtr);
+			break;
+		case XAIE_IO_MASKPOLL:
+			RC = XAie_SimIO_MaskPoll(IOInst, Cmd->RegOff,
+					Cmd->Mask, Cmd->Value, Cmd->Size);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Mask poll failed. Addr: 0x%lx\n",
+						Cmd->RegOff);
+			}
+			break;
+		case XAIE_IO_MEMSYNC:
+			RC = XAie_MemSyncBatch((const XAie_MemSyncRange *)
+					(uintptr_t)Cmd->DataPtr, 1U);
+			break;
+		default:
+			XAIE_ERROR("Invalid transaction opcode\n");
+			RC = XAIE_ERR;
+			break;
+		}
+	}
+
+	if((RC == XAIE_OK) && (RunLen != 0U)) {
+		XAie_SimIO_BlockWrite32(IOInst, RunOff, Run, RunLen);
+	}
+
+	return RC;
+}
+
 #else
 
 static AieRC XAie_SimIO_Finish(void *IOInst)
@@ -530,6 +676,18 @@ static AieRC XAie_SimIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data, u32 Size)
 	return XAIE_ERR;
 }
 
+static AieRC XAie_SimIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
 static AieRC XAie_SimIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
 		u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
 {
@@ -560,6 +718,14 @@ static u64 XAie_SimIOGetTid(void)
 		return 0;
 }
 
+static AieRC XAie_SimIO_SubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)TxnInst;
+	return XAIE_ERR;
+}
+
 #endif /* __AIESIM__ */
 
 static XAie_MemInst* XAie_SimMemAllocate(XAie_DevInst *DevInst, u64 Size,
@@ -613,16 +779,18 @@ const XAie_Backend SimBackend =
 	.Ops.MaskPoll = XAie_SimIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_SimIO_BlockWrite32,
 	.Ops.BlockSet32 = XAie_SimIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_SimIO_BlockRead32,
 	.Ops.CmdWrite = XAie_SimIO_CmdWrite,
 	.Ops.RunOp = XAie_SimIO_RunOp,
 	.Ops.MemAllocate = XAie_SimMemAllocate,
 	.Ops.MemFree = XAie_SimMemFree,
 	.Ops.MemSyncForCPU = XAie_SimMemSyncForCPU,
 	.Ops.MemSyncForDev = XAie_SimMemSyncForDev,
+	.Ops.MemSyncRanges = NULL,
 	.Ops.MemAttach = XAie_SimMemAttach,
 	.Ops.MemDetach = XAie_SimMemDetach,
 	.Ops.GetTid = XAie_SimIOGetTid,
-	.Ops.SubmitTxn = NULL,
+	.Ops.SubmitTxn = XAie_SimIO_SubmitTxn,
 };
 
 /** @} */
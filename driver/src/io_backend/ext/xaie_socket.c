@@ -47,6 +47,37 @@
 /***************************** Macro Definitions *****************************/
 #define XAIE_IO_SOCKET_CMDBUFSIZE	48U
 #define XAIE_IO_SOCKET_RDBUFSIZE	11U /* "0xDEADBEEF\n" */
+#define XAIE_IO_SOCKET_SENDBUFSIZE	0x10000U
+
+/*
+ * Wire protocols. The text protocol sends one line per register access. The
+ * binary protocol sends frames of a 16 byte header, {Opcode, NumWords, Addr}
+ * as little endian u32, u32 and u64, followed by the payload words:
+ *	WRITE: NumWords words written to consecutive addresses
+ *	READ: no payload. The simulator replies with NumWords words.
+ *	BLOCKSET: one word written to NumWords consecutive addresses
+ *	MASKWRITE: mask and value words for the register at Addr
+ *	MASKPOLL: mask, value and timeout in microseconds words. The register
+ *		at Addr is polled until its masked value matches.
+ *	TXN: NumWords nested frames executed in order by the simulator, Addr
+ *		holds the number of words read by the nested READ frames. The
+ *		simulator replies with a status word, 0 on success or the one
+ *		based index of the nested frame which failed, followed by the
+ *		words of all the nested READ frames.
+ * MASKPOLL frames are only sent nested in TXN frames.
+ * The protocol is selected with the XAIE_SOCKET_PROTOCOL environment
+ * variable, "text" or "binary". The text protocol is the default.
+ */
+#define XAIE_IO_SOCKET_PROTO_TEXT	0U
+#define XAIE_IO_SOCKET_PROTO_BINARY	1U
+
+#define XAIE_IO_SOCKET_BIN_HDRSIZE	16U
+#define XAIE_IO_SOCKET_BIN_WRITE	0x1U
+#define XAIE_IO_SOCKET_BIN_READ		0x2U
+#define XAIE_IO_SOCKET_BIN_BLOCKSET	0x3U
+#define XAIE_IO_SOCKET_BIN_MASKWRITE	0x4U
+#define XAIE_IO_SOCKET_BIN_TXN		0x5U
+#define XAIE_IO_SOCKET_BIN_MASKPOLL	0x6U
 
 /****************************** Type Definitions *****************************/
 #ifdef __AIESOCKET__
@@ -55,12 +86,430 @@ typedef struct XAie_SocketIO {
 	u64 BaseAddr;
 	u64 NpiBaseAddr;
 	int SocketFd;
+	u8 Protocol;		/* Wire protocol of the connection */
+	u32 BatchDepth;		/* Writes to batch per packet, 0 to not batch */
+	u32 NumBatched;		/* Writes queued in the send buffer */
+	u32 SendLen;		/* Bytes queued in the send buffer */
+	pthread_mutex_t Lock;	/* Serializes the accesses of the connection */
+	XAie_PollCfg PollCfg;	/* Strategy of register polls */
+	unsigned char SendBuf[XAIE_IO_SOCKET_SENDBUFSIZE];
 } XAie_SocketIO;
 
 #endif /* __AIESOCKET__ */
 /************************** Function Definitions *****************************/
 #ifdef __AIESOCKET__
 
+/*****************************************************************************/
+/**
+*
+* This is the helper function to send a buffer over the socket. It retries
+* until all the bytes are sent.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Buf: Buffer to send.
+* @param	Len: Number of bytes to send.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_Send(XAie_SocketIO *SocketIOInst, const void *Buf,
+		size_t Len)
+{
+	const unsigned char *Ptr = (const unsigned char *)Buf;
+	ssize_t Ret;
+
+	while(Len > 0U) {
+		Ret = write(SocketIOInst->SocketFd, Ptr, Len);
+		if(Ret < 0) {
+			if(errno == EINTR)
+				continue;
+			XAIE_ERROR("Failed to write to socket, %d: %s\n",
+				errno, strerror(errno));
+			return XAIE_ERR;
+		}
+
+		Ptr += Ret;
+		Len -= (size_t)Ret;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to receive a buffer from the socket. It retries
+* until all the bytes are received.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Buf: Buffer to receive to.
+* @param	Len: Number of bytes to receive.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_Recv(XAie_SocketIO *SocketIOInst, void *Buf,
+		size_t Len)
+{
+	unsigned char *Ptr = (unsigned char *)Buf;
+	ssize_t Ret;
+
+	while(Len > 0U) {
+		Ret = read(SocketIOInst->SocketFd, Ptr, Len);
+		if(Ret < 0) {
+			if(errno == EINTR)
+				continue;
+			XAIE_ERROR("Failed to read from socket, %d: %s\n",
+				errno, strerror(errno));
+			return XAIE_ERR;
+		}
+
+		if(Ret == 0) {
+			XAIE_ERROR("Socket closed by the simulator\n");
+			return XAIE_ERR;
+		}
+
+		Ptr += Ret;
+		Len -= (size_t)Ret;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to send the queued commands to the simulator.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Must be called with the lock held.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_Flush(XAie_SocketIO *SocketIOInst)
+{
+	AieRC RC = XAIE_OK;
+
+	if(SocketIOInst->SendLen != 0U) {
+		RC = _XAie_SocketIO_Send(SocketIOInst, SocketIOInst->SendBuf,
+				SocketIOInst->SendLen);
+	}
+
+	SocketIOInst->SendLen = 0U;
+	SocketIOInst->NumBatched = 0U;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to append bytes to the send buffer. The buffer
+* is sent when it runs out of space.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Buf: Bytes to append.
+* @param	Len: Number of bytes, at most XAIE_IO_SOCKET_SENDBUFSIZE.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Must be called with the lock held.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_Queue(XAie_SocketIO *SocketIOInst, const void *Buf,
+		u32 Len)
+{
+	AieRC RC;
+
+	if(SocketIOInst->SendLen + Len > XAIE_IO_SOCKET_SENDBUFSIZE) {
+		RC = _XAie_SocketIO_Flush(SocketIOInst);
+		if(RC != XAIE_OK)
+			return RC;
+	}
+
+	memcpy(SocketIOInst->SendBuf + SocketIOInst->SendLen, Buf, Len);
+	SocketIOInst->SendLen += Len;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to convert a 32 bit value to little endian
+* bytes.
+*
+* @param	Buf: Buffer to store the bytes to.
+* @param	Value: 32-bit value.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_SocketIO_PutLe32(unsigned char *Buf, u32 Value)
+{
+	Buf[0U] = (unsigned char)(Value & 0xFFU);
+	Buf[1U] = (unsigned char)((Value >> 8U) & 0xFFU);
+	Buf[2U] = (unsigned char)((Value >> 16U) & 0xFFU);
+	Buf[3U] = (unsigned char)((Value >> 24U) & 0xFFU);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to convert little endian bytes to a 32 bit
+* value.
+*
+* @param	Buf: Buffer with the bytes.
+*
+* @return	32-bit value.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_SocketIO_GetLe32(const unsigned char *Buf)
+{
+	return (u32)Buf[0U] | ((u32)Buf[1U] << 8U) | ((u32)Buf[2U] << 16U) |
+		((u32)Buf[3U] << 24U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to queue the header of a binary frame.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Opcode: Frame opcode.
+* @param	Addr: Absolute address the frame accesses.
+* @param	NumWords: Number of 32-bit words the frame accesses.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Must be called with the lock held.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_QueueHdr(XAie_SocketIO *SocketIOInst, u32 Opcode,
+		u64 Addr, u32 NumWords)
+{
+	unsigned char Hdr[XAIE_IO_SOCKET_BIN_HDRSIZE];
+
+	_XAie_SocketIO_PutLe32(&Hdr[0U], Opcode);
+	_XAie_SocketIO_PutLe32(&Hdr[4U], NumWords);
+	_XAie_SocketIO_PutLe32(&Hdr[8U], (u32)(Addr & 0xFFFFFFFFU));
+	_XAie_SocketIO_PutLe32(&Hdr[12U], (u32)(Addr >> 32U));
+
+	return _XAie_SocketIO_Queue(SocketIOInst, Hdr, sizeof(Hdr));
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to queue 32-bit words as the payload of a
+* binary frame.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Data: Pointer to the words.
+* @param	NumWords: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Must be called with the lock held.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_QueueWords(XAie_SocketIO *SocketIOInst,
+		const u32 *Data, u32 NumWords)
+{
+	AieRC RC;
+
+	for(u32 i = 0U; i < NumWords; i++) {
+		if(SocketIOInst->SendLen + sizeof(u32) >
+				XAIE_IO_SOCKET_SENDBUFSIZE) {
+			RC = _XAie_SocketIO_Flush(SocketIOInst);
+			if(RC != XAIE_OK)
+				return RC;
+		}
+
+		_XAie_SocketIO_PutLe32(SocketIOInst->SendBuf +
+				SocketIOInst->SendLen, Data[i]);
+		SocketIOInst->SendLen += sizeof(u32);
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to queue a text write command.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Addr: Absolute address to write to.
+* @param	Value: 32-bit data to be written.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Must be called with the lock held.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_QueueTextWrite(XAie_SocketIO *SocketIOInst,
+		u64 Addr, u32 Value)
+{
+	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
+	int Len;
+
+	Len = snprintf(CmdBuf, sizeof(CmdBuf), "W 0X%016lX 0X%08X\n", Addr,
+			Value);
+	XAIE_DBG("SEND: %s", CmdBuf);
+
+	return _XAie_SocketIO_Queue(SocketIOInst, CmdBuf, (u32)Len);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to complete a write access. The queued commands
+* are sent right away unless write batching is enabled, in which case they
+* are sent once the configured number of accesses is queued.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Must be called with the lock held.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_CommitWrite(XAie_SocketIO *SocketIOInst)
+{
+	SocketIOInst->NumBatched++;
+	if(SocketIOInst->NumBatched < SocketIOInst->BatchDepth)
+		return XAIE_OK;
+
+	return _XAie_SocketIO_Flush(SocketIOInst);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to write a block of 32-bit words to consecutive
+* addresses. The block is sent as one binary frame, or as consecutive text
+* commands in as few packets as the send buffer allows.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Addr: Absolute address to write to.
+* @param	Data: Pointer to the data buffer.
+* @param	NumWords: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Must be called with the lock held.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_WriteWords(XAie_SocketIO *SocketIOInst, u64 Addr,
+		const u32 *Data, u32 NumWords)
+{
+	AieRC RC = XAIE_OK;
+
+	if(SocketIOInst->Protocol == XAIE_IO_SOCKET_PROTO_BINARY) {
+		RC = _XAie_SocketIO_QueueHdr(SocketIOInst,
+				XAIE_IO_SOCKET_BIN_WRITE, Addr, NumWords);
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_QueueWords(SocketIOInst, Data,
+					NumWords);
+		}
+	} else {
+		for(u32 i = 0U; (i < NumWords) && (RC == XAIE_OK); i++) {
+			RC = _XAie_SocketIO_QueueTextWrite(SocketIOInst,
+					Addr + i * 4U, Data[i]);
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to submit socket write to 0x%lx\n", Addr);
+		return RC;
+	}
+
+	return _XAie_SocketIO_CommitWrite(SocketIOInst);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to read a block of 32-bit words from consecutive
+* addresses. The queued commands are sent along with the read request, and
+* all the requests of the block are sent before the replies are received.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Addr: Absolute address to read from.
+* @param	Data: Pointer to store the words.
+* @param	NumWords: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, XAIE_ERR on failure.
+*
+* @note		Internal only. Must be called with the lock held.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_ReadWords(XAie_SocketIO *SocketIOInst, u64 Addr,
+		u32 *Data, u32 NumWords)
+{
+	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
+	char RdBuf[XAIE_IO_SOCKET_RDBUFSIZE + 1U];
+	AieRC RC = XAIE_OK;
+	int Len;
+
+	if(SocketIOInst->Protocol == XAIE_IO_SOCKET_PROTO_BINARY) {
+		RC = _XAie_SocketIO_QueueHdr(SocketIOInst,
+				XAIE_IO_SOCKET_BIN_READ, Addr, NumWords);
+		if(RC == XAIE_OK)
+			RC = _XAie_SocketIO_Flush(SocketIOInst);
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_Recv(SocketIOInst, Data,
+					(size_t)NumWords * sizeof(u32));
+		}
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to read 0x%lx over socket\n", Addr);
+			return RC;
+		}
+
+		/* Each word is converted in place from the little endian bytes */
+		for(u32 i = 0U; i < NumWords; i++) {
+			Data[i] = _XAie_SocketIO_GetLe32(
+					(const unsigned char *)&Data[i]);
+		}
+
+		return XAIE_OK;
+	}
+
+	for(u32 i = 0U; (i < NumWords) && (RC == XAIE_OK); i++) {
+		Len = snprintf(CmdBuf, sizeof(CmdBuf), "R 0X%016lX\n",
+				Addr + i * 4U);
+		XAIE_DBG("SEND: %s", CmdBuf);
+		RC = _XAie_SocketIO_Queue(SocketIOInst, CmdBuf, (u32)Len);
+	}
+	if(RC == XAIE_OK)
+		RC = _XAie_SocketIO_Flush(SocketIOInst);
+
+	for(u32 i = 0U; (i < NumWords) && (RC == XAIE_OK); i++) {
+		RC = _XAie_SocketIO_Recv(SocketIOInst, RdBuf,
+				XAIE_IO_SOCKET_RDBUFSIZE);
+		RdBuf[XAIE_IO_SOCKET_RDBUFSIZE] = '\0';
+		XAIE_DBG("RCVD: %s", RdBuf);
+		Data[i] = (u32)strtoul(RdBuf, NULL, 0);
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to read 0x%lx over socket\n", Addr);
+	}
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -78,6 +527,11 @@ static AieRC XAie_SocketIO_Finish(void *IOInst)
 {
 	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
 
+	pthread_mutex_lock(&SocketIOInst->Lock);
+	_XAie_SocketIO_Flush(SocketIOInst);
+	pthread_mutex_unlock(&SocketIOInst->Lock);
+
+	pthread_mutex_destroy(&SocketIOInst->Lock);
 	close(SocketIOInst->SocketFd);
 	free(IOInst);
 
@@ -103,6 +557,7 @@ static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 	struct addrinfo hints, *slist, *p;
 	u32 FileSize;
 	char *PortNum;
+	char *Protocol;
 	int ret;
 	int SocketFd;
 	FILE *Fd;
@@ -189,6 +644,21 @@ static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 	IOInst->SocketFd = SocketFd;
 	IOInst->BaseAddr = DevInst->BaseAddr;
 	IOInst->NpiBaseAddr = XAIE_NPI_BASEADDR;
+	IOInst->Protocol = XAIE_IO_SOCKET_PROTO_TEXT;
+	IOInst->BatchDepth = 0U;
+	IOInst->NumBatched = 0U;
+	IOInst->SendLen = 0U;
+	_XAie_IOCommon_InitPollCfg(&IOInst->PollCfg);
+	pthread_mutex_init(&IOInst->Lock, NULL);
+
+	Protocol = getenv("XAIE_SOCKET_PROTOCOL");
+	if((Protocol != NULL) && (strcmp(Protocol, "binary") == 0)) {
+		IOInst->Protocol = XAIE_IO_SOCKET_PROTO_BINARY;
+	} else if((Protocol != NULL) && (strcmp(Protocol, "text") != 0)) {
+		XAIE_WARN("Unknown socket protocol %s, using text\n",
+				Protocol);
+	}
+
 	DevInst->IOInst = IOInst;
 
 	freeaddrinfo(slist);
@@ -205,7 +675,7 @@ static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 * @param	RegOff: Register offset to read from.
 * @param	Value: 32-bit data to be written.
 *
-* @return	None.
+* @return	XAIE_OK on success, XAIE_ERR on failure.
 *
 * @note		Internal only.
 *
@@ -213,20 +683,14 @@ static AieRC XAie_SocketIO_Init(XAie_DevInst *DevInst)
 static AieRC XAie_SocketIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 {
 	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
-	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
-	size_t Len;
-
-	sprintf(CmdBuf, "W 0X%016lX 0X%08X\n", SocketIOInst->BaseAddr + RegOff,
-			Value);
-	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
-	if(Len != strlen(CmdBuf)) {
-		XAIE_ERROR("Failed to submit socket command: %s\n", CmdBuf);
-		return XAIE_ERR;
-	}
+	AieRC RC;
 
-	XAIE_DBG("SEND: %s", CmdBuf);
+	pthread_mutex_lock(&SocketIOInst->Lock);
+	RC = _XAie_SocketIO_WriteWords(SocketIOInst,
+			SocketIOInst->BaseAddr + RegOff, &Value, 1U);
+	pthread_mutex_unlock(&SocketIOInst->Lock);
 
-	return XAIE_OK;
+	return RC;
 }
 
 /*****************************************************************************/
@@ -246,31 +710,14 @@ static AieRC XAie_SocketIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 static AieRC XAie_SocketIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 {
 	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
-	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
-	char RdBuf[XAIE_IO_SOCKET_RDBUFSIZE];
-	size_t Len;
-	int Ret;
-
-	sprintf(CmdBuf, "R 0X%016lX\n", SocketIOInst->BaseAddr + RegOff);
-	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
-	if(Len != strlen(CmdBuf)) {
-		XAIE_ERROR("Failed to submit socket command: %s\n", CmdBuf);
-		return XAIE_ERR;
-	}
-
-	XAIE_DBG("SEND: %s", CmdBuf);
-
-	Ret = read(SocketIOInst->SocketFd, RdBuf, XAIE_IO_SOCKET_RDBUFSIZE);
-	if(Ret == -1) {
-		XAIE_ERROR("Failed to read from socket, %d: %s\n",
-			errno, strerror(errno));
-		return XAIE_ERR;
-	}
+	AieRC RC;
 
-	XAIE_DBG("RCVD: %s", RdBuf);
-	*Data = (u32)strtol(RdBuf, NULL, 0);
+	pthread_mutex_lock(&SocketIOInst->Lock);
+	RC = _XAie_SocketIO_ReadWords(SocketIOInst,
+			SocketIOInst->BaseAddr + RegOff, Data, 1U);
+	pthread_mutex_unlock(&SocketIOInst->Lock);
 
-	return XAIE_OK;
+	return RC;
 }
 
 /*****************************************************************************/
@@ -284,26 +731,45 @@ static AieRC XAie_SocketIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 * @param	Mask: Mask to be applied to Data.
 * @param	Value: 32-bit data to be written.
 *
-* @return	None.
+* @return	XAIE_OK on success, XAIE_ERR on failure.
 *
-* @note		Internal only.
+* @note		Internal only. The binary protocol sends the masked write to
+*		the simulator, the text protocol reads the register first.
 *
 *******************************************************************************/
 static AieRC XAie_SocketIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value)
 {
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+	u64 Addr = SocketIOInst->BaseAddr + RegOff;
+	u32 Words[2U];
 	AieRC RC;
 	u32 RegVal;
 
-	RC = XAie_SocketIO_Read32(IOInst, RegOff, &RegVal);
-	if(RC != XAIE_OK) {
-		return RC;
+	pthread_mutex_lock(&SocketIOInst->Lock);
+	if(SocketIOInst->Protocol == XAIE_IO_SOCKET_PROTO_BINARY) {
+		Words[0U] = Mask;
+		Words[1U] = Value;
+		RC = _XAie_SocketIO_QueueHdr(SocketIOInst,
+				XAIE_IO_SOCKET_BIN_MASKWRITE, Addr, 1U);
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_QueueWords(SocketIOInst, Words,
+					2U);
+		}
+		if(RC == XAIE_OK)
+			RC = _XAie_SocketIO_CommitWrite(SocketIOInst);
+	} else {
+		RC = _XAie_SocketIO_ReadWords(SocketIOInst, Addr, &RegVal, 1U);
+		if(RC == XAIE_OK) {
+			RegVal &= ~Mask;
+			RegVal |= Value;
+			RC = _XAie_SocketIO_WriteWords(SocketIOInst, Addr,
+					&RegVal, 1U);
+		}
 	}
+	pthread_mutex_unlock(&SocketIOInst->Lock);
 
-	RegVal &= ~Mask;
-	RegVal |= Value;
-
-	return XAie_SocketIO_Write32(IOInst, RegOff, RegVal);
+	return RC;
 }
 
 /*****************************************************************************/
@@ -325,32 +791,10 @@ static AieRC XAie_SocketIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_SocketIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value, u32 TimeOutUs)
 {
-	AieRC Ret = XAIE_ERR;
-	u32 Count, MinTimeOutUs, RegVal;
-
-	/*
-	 * Any value less than 200 us becomes noticable overhead. This is based
-	 * on some profiling, and it may vary between platforms.
-	 */
-	MinTimeOutUs = 200;
-	Count = ((u64)TimeOutUs + MinTimeOutUs - 1) / MinTimeOutUs;
-
-	while (Count > 0U) {
-		XAie_SocketIO_Read32(IOInst, RegOff, &RegVal);
-		if((RegVal & Mask) == Value) {
-			return XAIE_OK;
-		}
-		usleep(MinTimeOutUs);
-		Count--;
-	}
-
-	/* Check for the break from timed-out loop */
-	XAie_SocketIO_Read32(IOInst, RegOff, &RegVal);
-	if((RegVal & Mask) == Value) {
-		Ret = XAIE_OK;
-	}
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
 
-	return Ret;
+	return _XAie_IOCommon_MaskPoll(IOInst, XAie_SocketIO_Read32,
+			&SocketIOInst->PollCfg, RegOff, Mask, Value, TimeOutUs);
 }
 
 /*****************************************************************************/
@@ -363,7 +807,7 @@ static AieRC XAie_SocketIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 * @param	Data: Pointer to the data buffer.
 * @param	Size: Number of 32-bit words.
 *
-* @return	None.
+* @return	XAIE_OK on success, XAIE_ERR on failure.
 *
 * @note		Internal only.
 *
@@ -371,12 +815,15 @@ static AieRC XAie_SocketIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_SocketIO_BlockWrite32(void *IOInst, u64 RegOff,
 		const u32 *Data, u32 Size)
 {
-	for(u32 i = 0U; i < Size; i++) {
-		XAie_SocketIO_Write32(IOInst, RegOff + i * 4U, *Data);
-		Data++;
-	}
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+	AieRC RC;
 
-	return XAIE_OK;
+	pthread_mutex_lock(&SocketIOInst->Lock);
+	RC = _XAie_SocketIO_WriteWords(SocketIOInst,
+			SocketIOInst->BaseAddr + RegOff, Data, Size);
+	pthread_mutex_unlock(&SocketIOInst->Lock);
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -390,7 +837,7 @@ static AieRC XAie_SocketIO_BlockWrite32(void *IOInst, u64 RegOff,
 * @param	Data: Data to initialize a chunk of aie address space..
 * @param	Size: Number of 32-bit words.
 *
-* @return	None.
+* @return	XAIE_OK on success, XAIE_ERR on failure.
 *
 * @note		Internal only.
 *
@@ -398,10 +845,58 @@ static AieRC XAie_SocketIO_BlockWrite32(void *IOInst, u64 RegOff,
 static AieRC XAie_SocketIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 		u32 Size)
 {
-	for(u32 i = 0U; i < Size; i++)
-		XAie_SocketIO_Write32(IOInst, RegOff+ i * 4U, Data);
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+	u64 Addr = SocketIOInst->BaseAddr + RegOff;
+	AieRC RC = XAIE_OK;
+
+	pthread_mutex_lock(&SocketIOInst->Lock);
+	if(SocketIOInst->Protocol == XAIE_IO_SOCKET_PROTO_BINARY) {
+		RC = _XAie_SocketIO_QueueHdr(SocketIOInst,
+				XAIE_IO_SOCKET_BIN_BLOCKSET, Addr, Size);
+		if(RC == XAIE_OK)
+			RC = _XAie_SocketIO_QueueWords(SocketIOInst, &Data, 1U);
+	} else {
+		for(u32 i = 0U; (i < Size) && (RC == XAIE_OK); i++) {
+			RC = _XAie_SocketIO_QueueTextWrite(SocketIOInst,
+					Addr + i * 4U, Data);
+		}
+	}
 
-	return XAIE_OK;
+	if(RC == XAIE_OK)
+		RC = _XAie_SocketIO_CommitWrite(SocketIOInst);
+	pthread_mutex_unlock(&SocketIOInst->Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of data from aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the data.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only. The block is read with one binary frame, or
+*		with pipelined text commands.
+*
+*******************************************************************************/
+static AieRC XAie_SocketIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+	AieRC RC;
+
+	pthread_mutex_lock(&SocketIOInst->Lock);
+	RC = _XAie_SocketIO_ReadWords(SocketIOInst,
+			SocketIOInst->BaseAddr + RegOff, Data, Size);
+	pthread_mutex_unlock(&SocketIOInst->Lock);
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -421,18 +916,11 @@ static AieRC XAie_SocketIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 static void _XAie_SocketIO_NpiWrite32(void *IOInst, u32 RegOff, u32 RegVal)
 {
 	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
-	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
-	size_t Len;
 
-	sprintf(CmdBuf, "W 0X%016lX 0X%08X\n",
-			SocketIOInst->NpiBaseAddr + RegOff, RegVal);
-	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
-	if(Len != strlen(CmdBuf)) {
-		XAIE_ERROR("Failed to submit socket command: %s\n", CmdBuf);
-		return;
-	}
-
-	XAIE_DBG("SEND NPI: %s", CmdBuf);
+	pthread_mutex_lock(&SocketIOInst->Lock);
+	_XAie_SocketIO_WriteWords(SocketIOInst,
+			SocketIOInst->NpiBaseAddr + RegOff, &RegVal, 1U);
+	pthread_mutex_unlock(&SocketIOInst->Lock);
 }
 
 /*****************************************************************************/
@@ -453,31 +941,14 @@ static void _XAie_SocketIO_NpiWrite32(void *IOInst, u32 RegOff, u32 RegVal)
 static AieRC _XAie_SocketIO_NpiRead32(void *IOInst, u64 RegOff, u32 *Data)
 {
 	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
-	char CmdBuf[XAIE_IO_SOCKET_CMDBUFSIZE];
-	char RdBuf[XAIE_IO_SOCKET_RDBUFSIZE];
-	size_t Len;
-	int Ret;
-
-	sprintf(CmdBuf, "R 0X%016lX\n", SocketIOInst->NpiBaseAddr + RegOff);
-	Len = write(SocketIOInst->SocketFd, CmdBuf, strlen(CmdBuf));
-	if(Len != strlen(CmdBuf)) {
-		XAIE_ERROR("Failed to submit socket command: %s\n", CmdBuf);
-		return XAIE_ERR;
-	}
-
-	XAIE_DBG("SEND NPI: %s", CmdBuf);
-
-	Ret = read(SocketIOInst->SocketFd, RdBuf, XAIE_IO_SOCKET_RDBUFSIZE);
-	if(Ret == -1) {
-		XAIE_ERROR("Failed to read from socket, %d: %s\n",
-			errno, strerror(errno));
-		return XAIE_ERR;
-	}
+	AieRC RC;
 
-	XAIE_DBG("RCVD NPI: %s", RdBuf);
-	*Data = (u32)strtol(RdBuf, NULL, 0);
+	pthread_mutex_lock(&SocketIOInst->Lock);
+	RC = _XAie_SocketIO_ReadWords(SocketIOInst,
+			SocketIOInst->NpiBaseAddr + RegOff, Data, 1U);
+	pthread_mutex_unlock(&SocketIOInst->Lock);
 
-	return XAIE_OK;
+	return RC;
 }
 
 /*****************************************************************************/
@@ -536,12 +1007,9 @@ static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		{
 			XAie_ShimDmaBdArgs *BdArgs =
 				(XAie_ShimDmaBdArgs *)Arg;
-			for(u8 i = 0; i < BdArgs->NumBdWords; i++) {
-				XAie_SocketIO_Write32(IOInst,
-						BdArgs->Addr + i * 4,
-						BdArgs->BdWords[i]);
-			}
-			break;
+
+			return XAie_SocketIO_BlockWrite32(IOInst, BdArgs->Addr,
+					BdArgs->BdWords, BdArgs->NumBdWords);
 		}
 		case XAIE_BACKEND_OP_NPIWR32:
 		{
@@ -559,6 +1027,11 @@ static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 					Req->NpiRegOff, Req->Mask, Req->Val,
 					Req->TimeOutUs);
 		}
+		case XAIE_BACKEND_OP_NPI_REQ_LIST:
+			return _XAie_IOCommon_NpiReqList(IOInst,
+					(XAie_BackendNpiReqList *)Arg,
+					_XAie_SocketIO_NpiWrite32,
+					_XAie_SocketIO_NpiMaskPoll);
 		case XAIE_BACKEND_OP_REQUEST_RESOURCE:
 			return _XAie_RequestRscCommon(DevInst, Arg);
 		case XAIE_BACKEND_OP_RELEASE_RESOURCE:
@@ -567,6 +1040,8 @@ static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			return _XAie_FreeRscCommon(Arg);
 		case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
 			return _XAie_RequestAllocatedRscCommon(DevInst, Arg);
+		case XAIE_BACKEND_OP_REQUEST_RSC_BATCH:
+			return _XAie_RequestRscBatchCommon(DevInst, Arg);
 		case XAIE_BACKEND_OP_GET_RSC_STAT:
 			return _XAie_GetRscStatCommon(DevInst, Arg);
 		case XAIE_BACKEND_OP_REQUEST_TILES:
@@ -576,7 +1051,38 @@ static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 			return _XAie_PrivilegeInitPart(DevInst,
 					(XAie_PartInitOpts *)Arg);
 		case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
-			return _XAie_PrivilegeTeardownPart(DevInst);
+			return _XAie_PrivilegeTeardownPart(DevInst,
+					(const u32 *)Arg);
+		case XAIE_BACKEND_OP_CONFIG_WRITE_COMBINE:
+		{
+			XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+			AieRC RC;
+
+			pthread_mutex_lock(&SocketIOInst->Lock);
+			RC = _XAie_SocketIO_Flush(SocketIOInst);
+			SocketIOInst->BatchDepth = *((u32 *)Arg);
+			pthread_mutex_unlock(&SocketIOInst->Lock);
+
+			return RC;
+		}
+		case XAIE_BACKEND_OP_FLUSH_WRITES:
+		{
+			XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+			AieRC RC;
+
+			pthread_mutex_lock(&SocketIOInst->Lock);
+			RC = _XAie_SocketIO_Flush(SocketIOInst);
+			pthread_mutex_unlock(&SocketIOInst->Lock);
+
+			return RC;
+		}
+		case XAIE_BACKEND_OP_CONFIG_POLL:
+		{
+			XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+
+			SocketIOInst->PollCfg = *((XAie_PollCfg *)Arg);
+			return XAIE_OK;
+		}
 		default:
 			XAIE_ERROR("Socket backend does not support operation "
 					"%d\n", Op);
@@ -586,6 +1092,283 @@ static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the helper function to queue a transaction command as a frame
+* nested in a binary TXN frame.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	Cmd: Transaction command.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. Must be called with the lock held.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_QueueTxnCmd(XAie_SocketIO *SocketIOInst,
+		const XAie_TxnCmd *Cmd)
+{
+	u64 Addr = SocketIOInst->BaseAddr + Cmd->RegOff;
+	u32 Words[3U];
+	AieRC RC;
+
+	switch(Cmd->Opcode) {
+	case XAIE_IO_WRITE:
+		if(Cmd->Mask == 0U) {
+			RC = _XAie_SocketIO_QueueHdr(SocketIOInst,
+					XAIE_IO_SOCKET_BIN_WRITE, Addr, 1U);
+			if(RC == XAIE_OK) {
+				RC = _XAie_SocketIO_QueueWords(SocketIOInst,
+						&Cmd->Value, 1U);
+			}
+			return RC;
+		}
+
+		Words[0U] = Cmd->Mask;
+		Words[1U] = Cmd->Value;
+		RC = _XAie_SocketIO_QueueHdr(SocketIOInst,
+				XAIE_IO_SOCKET_BIN_MASKWRITE, Addr, 1U);
+		if(RC == XAIE_OK)
+			RC = _XAie_SocketIO_QueueWords(SocketIOInst, Words, 2U);
+		return RC;
+	case XAIE_IO_BLOCKWRITE:
+		RC = _XAie_SocketIO_QueueHdr(SocketIOInst,
+				XAIE_IO_SOCKET_BIN_WRITE, Addr, Cmd->Size);
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_QueueWords(SocketIOInst,
+					(const u32 *)(uintptr_t)Cmd->DataPtr,
+					Cmd->Size);
+		}
+		return RC;
+	case XAIE_IO_BLOCKSET:
+		RC = _XAie_SocketIO_QueueHdr(SocketIOInst,
+				XAIE_IO_SOCKET_BIN_BLOCKSET, Addr, Cmd->Size);
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_QueueWords(SocketIOInst,
+					&Cmd->Value, 1U);
+		}
+		return RC;
+	case XAIE_IO_READ:
+		return _XAie_SocketIO_QueueHdr(SocketIOInst,
+				XAIE_IO_SOCKET_BIN_READ, Addr, 1U);
+	case XAIE_IO_MASKPOLL:
+		Words[0U] = Cmd->Mask;
+		Words[1U] = Cmd->Value;
+		Words[2U] = Cmd->Size;
+		RC = _XAie_SocketIO_QueueHdr(SocketIOInst,
+				XAIE_IO_SOCKET_BIN_MASKPOLL, Addr, 1U);
+		if(RC == XAIE_OK)
+			RC = _XAie_SocketIO_QueueWords(SocketIOInst, Words, 3U);
+		return RC;
+	case XAIE_IO_SHIMDMABD:
+	{
+		const XAie_ShimDmaBdArgs *BdArgs = (const XAie_ShimDmaBdArgs *)
+			(uintptr_t)Cmd->DataPtr;
+
+		RC = _XAie_SocketIO_QueueHdr(SocketIOInst,
+				XAIE_IO_SOCKET_BIN_WRITE,
+				SocketIOInst->BaseAddr + BdArgs->Addr,
+				BdArgs->NumBdWords);
+		if(RC == XAIE_OK) {
+			RC = _XAie_SocketIO_QueueWords(SocketIOInst,
+					BdArgs->BdWords, BdArgs->NumBdWords);
+		}
+		return RC;
+	}
+	default:
+		XAIE_ERROR("Invalid transaction opcode\n");
+		return XAIE_ERR;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to run a range of transaction commands on the
+* simulator with one binary TXN frame. The values of the reads are stored to
+* the buffers of the read commands once the reply is received.
+*
+* @param	SocketIOInst: Socket IO instance pointer
+* @param	TxnInst: Pointer to the transaction instance.
+* @param	Start: Index of the first command of the range.
+* @param	End: Index past the last command of the range.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. Must be called with the lock held. The range
+*		must not hold memory sync commands, they run on the host.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_RunTxnFrame(XAie_SocketIO *SocketIOInst,
+		const XAie_TxnInst *TxnInst, u32 Start, u32 End)
+{
+	unsigned char Word[sizeof(u32)];
+	u32 NumReads = 0U;
+	u32 Status;
+	AieRC RC;
+
+	if(Start == End)
+		return XAIE_OK;
+
+	for(u32 i = Start; i < End; i++) {
+		if(TxnInst->CmdBuf[i].Opcode == XAIE_IO_READ)
+			NumReads++;
+	}
+
+	RC = _XAie_SocketIO_QueueHdr(SocketIOInst, XAIE_IO_SOCKET_BIN_TXN,
+			NumReads, End - Start);
+	for(u32 i = Start; (i < End) && (RC == XAIE_OK); i++) {
+		RC = _XAie_SocketIO_QueueTxnCmd(SocketIOInst,
+				&TxnInst->CmdBuf[i]);
+	}
+	if(RC == XAIE_OK)
+		RC = _XAie_SocketIO_Flush(SocketIOInst);
+	if(RC == XAIE_OK)
+		RC = _XAie_SocketIO_Recv(SocketIOInst, Word, sizeof(Word));
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to submit transaction over socket\n");
+		return RC;
+	}
+	Status = _XAie_SocketIO_GetLe32(Word);
+
+	/* The reply holds the words of all the reads, even after a failure */
+	for(u32 i = Start; (i < End) && (RC == XAIE_OK); i++) {
+		const XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+
+		if(Cmd->Opcode != XAIE_IO_READ)
+			continue;
+
+		RC = _XAie_SocketIO_Recv(SocketIOInst, Word, sizeof(Word));
+		if(RC == XAIE_OK) {
+			*(u32 *)(uintptr_t)Cmd->DataPtr =
+				_XAie_SocketIO_GetLe32(Word);
+		}
+	}
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to receive transaction reads over socket\n");
+		return RC;
+	}
+
+	if(Status > End - Start) {
+		XAIE_ERROR("Invalid transaction status %u\n", Status);
+		return XAIE_ERR;
+	} else if(Status != 0U) {
+		XAIE_ERROR("Transaction command failed. Addr: 0x%lx\n",
+				TxnInst->CmdBuf[Start + Status - 1U].RegOff);
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the helper function to run a transaction command with the socket
+* IO operations, one access at a time.
+*
+* @param	IOInst: IO instance pointer
+* @param	Cmd: Transaction command.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. Used with the text protocol.
+*
+*******************************************************************************/
+static AieRC _XAie_SocketIO_RunTxnCmd(void *IOInst, const XAie_TxnCmd *Cmd)
+{
+	switch(Cmd->Opcode) {
+	case XAIE_IO_WRITE:
+		if(Cmd->Mask == 0U) {
+			return XAie_SocketIO_Write32(IOInst, Cmd->RegOff,
+					Cmd->Value);
+		}
+		return XAie_SocketIO_MaskWrite32(IOInst, Cmd->RegOff,
+				Cmd->Mask, Cmd->Value);
+	case XAIE_IO_BLOCKWRITE:
+		return XAie_SocketIO_BlockWrite32(IOInst, Cmd->RegOff,
+				(const u32 *)(uintptr_t)Cmd->DataPtr, Cmd->Size);
+	case XAIE_IO_BLOCKSET:
+		return XAie_SocketIO_BlockSet32(IOInst, Cmd->RegOff,
+				Cmd->Value, Cmd->Size);
+	case XAIE_IO_READ:
+		return XAie_SocketIO_Read32(IOInst, Cmd->RegOff,
+				(u32 *)(uintptr_t)Cmd->DataPtr);
+	case XAIE_IO_MASKPOLL:
+		return XAie_SocketIO_MaskPoll(IOInst, Cmd->RegOff, Cmd->Mask,
+				Cmd->Value, Cmd->Size);
+	case XAIE_IO_SHIMDMABD:
+		return XAie_SocketIO_RunOp(IOInst, NULL,
+				XAIE_BACKEND_OP_CONFIG_SHIMDMABD,
+				(void *)(uintptr_t)Cmd->DataPtr);
+	case XAIE_IO_MEMSYNC:
+		return XAie_MemSyncBatch((const XAie_MemSyncRange *)
+				(uintptr_t)Cmd->DataPtr, 1U);
+	default:
+		XAIE_ERROR("Invalid transaction opcode\n");
+		return XAIE_ERR;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the IO function to submit a transaction to the simulator. With the
+* binary protocol, the commands, including the reads and the polls, are sent
+* in one TXN frame and run by the simulator, and the results come back in one
+* reply. Memory sync commands run on the host, the commands before and after
+* them are sent in separate frames. With the text protocol, the commands are
+* run one access at a time.
+*
+* @param	IOInst: IO instance pointer
+* @param	TxnInst: Pointer to the transaction instance.
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		Internal only. The commands are executed in order, reads and
+*		polls see the writes recorded before them.
+*
+*******************************************************************************/
+static AieRC XAie_SocketIO_SubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
+{
+	XAie_SocketIO *SocketIOInst = (XAie_SocketIO *)IOInst;
+	AieRC RC = XAIE_OK;
+	u32 Start = 0U;
+
+	if(SocketIOInst->Protocol != XAIE_IO_SOCKET_PROTO_BINARY) {
+		for(u32 i = 0U; (i < TxnInst->NumCmds) && (RC == XAIE_OK);
+				i++) {
+			RC = _XAie_SocketIO_RunTxnCmd(IOInst,
+					&TxnInst->CmdBuf[i]);
+		}
+
+		return RC;
+	}
+
+	pthread_mutex_lock(&SocketIOInst->Lock);
+	for(u32 i = 0U; (i < TxnInst->NumCmds) && (RC == XAIE_OK); i++) {
+		if(TxnInst->CmdBuf[i].Opcode != XAIE_IO_MEMSYNC)
+			continue;
+
+		RC = _XAie_SocketIO_RunTxnFrame(SocketIOInst, TxnInst, Start,
+				i);
+		if(RC == XAIE_OK) {
+			RC = XAie_MemSyncBatch((const XAie_MemSyncRange *)
+					(uintptr_t)TxnInst->CmdBuf[i].DataPtr,
+					1U);
+		}
+		Start = i + 1U;
+	}
+	if(RC == XAIE_OK) {
+		RC = _XAie_SocketIO_RunTxnFrame(SocketIOInst, TxnInst, Start,
+				TxnInst->NumCmds);
+	}
+	pthread_mutex_unlock(&SocketIOInst->Lock);
+
+	return RC;
+}
+
 #else
 
 static AieRC XAie_SocketIO_Finish(void *IOInst)
@@ -672,6 +1455,18 @@ static AieRC XAie_SocketIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 	return XAIE_ERR;
 }
 
+static AieRC XAie_SocketIO_BlockRead32(void *IOInst, u64 RegOff, u32 *Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
 static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		XAie_BackendOpCode Op, void *Arg)
 {
@@ -682,6 +1477,15 @@ static AieRC XAie_SocketIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
 
+static AieRC XAie_SocketIO_SubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)TxnInst;
+
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
 #endif /* __AIESOCKET__ */
 
 static XAie_MemInst* XAie_SocketMemAllocate(XAie_DevInst *DevInst, u64 Size,
@@ -750,16 +1554,18 @@ const XAie_Backend SocketBackend =
 	.Ops.MaskPoll = XAie_SocketIO_MaskPoll,
 	.Ops.BlockWrite32 = XAie_SocketIO_BlockWrite32,
 	.Ops.BlockSet32 = XAie_SocketIO_BlockSet32,
+	.Ops.BlockRead32 = XAie_SocketIO_BlockRead32,
 	.Ops.CmdWrite = XAie_SocketIO_CmdWrite,
 	.Ops.RunOp = XAie_SocketIO_RunOp,
 	.Ops.MemAllocate = XAie_SocketMemAllocate,
 	.Ops.MemFree = XAie_SocketMemFree,
 	.Ops.MemSyncForCPU = XAie_SocketMemSyncForCPU,
 	.Ops.MemSyncForDev = XAie_SocketMemSyncForDev,
+	.Ops.MemSyncRanges = NULL,
 	.Ops.MemAttach = XAie_SocketMemAttach,
 	.Ops.MemDetach = XAie_SocketMemDetach,
 	.Ops.GetTid = XAie_IODummyGetTid,
-	.Ops.SubmitTxn = NULL,
+	.Ops.SubmitTxn = XAie_SocketIO_SubmitTxn,
 };
 
 /** @} */
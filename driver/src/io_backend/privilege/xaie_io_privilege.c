@@ -23,12 +23,14 @@
 ******************************************************************************/
 /***************************** Include Files *********************************/
 #include <stdlib.h>
+#include <string.h>
 
 #include "xaie_clock.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_io_privilege.h"
 #include "xaie_npi.h"
+#include "xaie_txn.h"
 
 #if defined(XAIE_FEATURE_PRIVILEGED_ENABLE) && !defined(XAIE_FEATURE_LITE)
 
@@ -41,7 +43,27 @@
 #define XAIE_ISOLATE_SOUTH_MASK	(1U << 0)
 #define XAIE_ISOLATE_ALL_MASK	((1U << 4) - 1)
 
-#define XAIE_ERROR_NPI_INTR_ID	0x1U
+
+#define XAIE_PART_INIT_CACHE_MAGIC	0x43494150U /* "PAIC" */
+
+/**************************** Type Definitions *******************************/
+/*
+ * Typedef to capture the header of a partition initialization cache. It is
+ * followed by the serialized transactions of the column reset, RstSize bytes,
+ * and of the configuration after the SHIM reset, CfgSize bytes.
+ */
+typedef struct {
+	u32 Magic;
+	u8 DevGen;
+	u8 NumRows;
+	u8 NumCols;
+	u8 Rsvd;
+	u32 OptFlags;
+	u32 Rsvd1;
+	u64 RstSize;
+	u64 CfgSize;
+} XAie_PartInitCacheHdr;
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -68,7 +90,7 @@ static AieRC _XAie_PrivilegeSetColReset(XAie_DevInst *DevInst,
 	u64 RegAddr;
 	const XAie_PlIfMod *PlIfMod;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
 	RegAddr = PlIfMod->ColRstOff +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
@@ -173,7 +195,7 @@ static AieRC _XAie_PrivilegeSetBlockAxiMmNsuErr(XAie_DevInst *DevInst,
 	const XAie_PlIfMod *PlIfMod;
 	const XAie_ShimNocAxiMMConfig *ShimNocAxiMM;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
 	ShimNocAxiMM = PlIfMod->ShimNocAxiMM;
 	RegAddr = ShimNocAxiMM->RegOff +
@@ -219,7 +241,7 @@ AieRC _XAie_PrivilegeSetPartBlockAxiMmNsuErr(XAie_DevInst *DevInst,
 		XAie_LocType Loc = XAie_TileLoc(C, 0U);
 		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 		if(TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 			continue;
 		}
@@ -303,7 +325,8 @@ static AieRC _XAie_PrivilegeSetL2IrqId(XAie_DevInst *DevInst, XAie_LocType Loc,
 *
 * @return	XAIE_OK on success, error code on failure.
 *
-* @note		None.
+* @note		Each controller drives the IRQ of the error interrupt group of
+*		its column.
 *
 ******************************************************************************/
 static AieRC _XAie_PrivilegeSetL2ErrIrq(XAie_DevInst *DevInst)
@@ -312,13 +335,14 @@ static AieRC _XAie_PrivilegeSetL2ErrIrq(XAie_DevInst *DevInst)
 	XAie_LocType Loc = XAie_TileLoc(0, DevInst->ShimRow);
 
 	for (Loc.Col = 0; Loc.Col < DevInst->NumCols; Loc.Col++) {
-		u8 TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		u8 TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 		if (TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 			continue;
 		}
 
 		RC = _XAie_PrivilegeSetL2IrqId(DevInst, Loc,
-				XAIE_ERROR_NPI_INTR_ID);
+				XAie_ErrorIrqGroupIrqId(
+					XAie_ErrorIrqGroup(DevInst, Loc.Col)));
 		if(RC != XAIE_OK) {
 			XAIE_ERROR("Failed to configure L2 error IRQ channel\n");
 			return RC;
@@ -330,107 +354,94 @@ static AieRC _XAie_PrivilegeSetL2ErrIrq(XAie_DevInst *DevInst)
 
 /*****************************************************************************/
 /**
-* This API initializes the AI engine partition
+* This API resets the columns of the AI engine partition as the first step of
+* the partition initialization.
 *
 * @param	DevInst: AI engine partition device instance pointer
-* @param	Opts: Initialization options
+* @param	OptFlags: Initialization options
 *
 * @return       XAIE_OK on success, error code on failure
 *
-* @note		This operation does the following steps to initialize an AI
-*		engine partition:
-*		- Clock gate all columns
-*		- Reset Columns
-*		- Ungate all Columns
-*		- Remove columns reset
-*		- Reset shims
-*		- Setup AXI MM not to return errors for AXI decode or slave
-*		  errors, raise events instead.
-*		- ungate all columns
-*		- Setup partition isolation.
-*		- zeroize memory if it is requested
+* @note		Internal only. The caller enables the protected registers.
+*		This step only accesses AI engine registers, so it can be
+*		recorded into a transaction.
 *
 *******************************************************************************/
-AieRC _XAie_PrivilegeInitPart(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
+static AieRC _XAie_PrivilegeInitPartColRst(XAie_DevInst *DevInst,
+		u32 OptFlags)
 {
-	u32 OptFlags;
 	AieRC RC;
 
-	if(Opts != NULL) {
-		OptFlags = Opts->InitOpts;
-	} else {
-		OptFlags = XAIE_PART_INIT_OPT_DEFAULT;
-	}
-
-	RC = _XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_ENABLE);
-	if(RC != XAIE_OK) {
-		XAIE_ERROR("Failed to initialize partition, enable protected registers failed.\n");
-		return RC;
-	}
-
 	if((OptFlags & XAIE_PART_INIT_OPT_COLUMN_RST) != 0) {
 		/* Gate all tiles before resetting columns to quiet traffic*/
 		RC = _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
 		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 			return RC;
 		}
 
 		RC = _XAie_PrivilegeSetPartColReset(DevInst, XAIE_ENABLE);
 		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 			return RC;
 		}
 
 		/* Enable clock buffer before removing column reset */
 		RC = _XAie_PmSetPartitionClock(DevInst, XAIE_ENABLE);
 		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 			return RC;
 		}
 
 		RC = _XAie_PrivilegeSetPartColReset(DevInst, XAIE_DISABLE);
 		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 			return RC;
 		}
 
 	}
 
-	if((OptFlags & XAIE_PART_INIT_OPT_SHIM_RST) != 0) {
-		RC = _XAie_PrivilegeRstPartShims(DevInst);
-		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-			return RC;
-		}
-	}
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API configures the AI engine partition after the SHIMs are reset as the
+* last step of the partition initialization.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	OptFlags: Initialization options
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		Internal only. The caller enables the protected registers.
+*		This step only accesses AI engine registers, so it can be
+*		recorded into a transaction.
+*
+*******************************************************************************/
+static AieRC _XAie_PrivilegeInitPartCfg(XAie_DevInst *DevInst, u32 OptFlags)
+{
+	AieRC RC;
 
 	if((OptFlags & XAIE_PART_INIT_OPT_BLOCK_NOCAXIMMERR) != 0) {
 		RC = _XAie_PrivilegeSetPartBlockAxiMmNsuErr(DevInst,
 			XAIE_ENABLE, XAIE_ENABLE);
 		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 			return RC;
 		}
 	}
 
 	RC = DevInst->DevOps->SetPartColClockAfterRst(DevInst, XAIE_ENABLE);
 	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 		return RC;
 	}
 
 	if ((OptFlags & XAIE_PART_INIT_OPT_ISOLATE) != 0) {
 		RC = DevInst->DevOps->SetPartIsolationAfterRst(DevInst);
 		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
+			return RC;
 		}
 	}
 
 	if ((OptFlags & XAIE_PART_INIT_OPT_ZEROIZEMEM) != 0) {
-		RC = DevInst->DevOps->PartMemZeroInit(DevInst);
+		RC = DevInst->DevOps->PartMemZeroInit(DevInst, NULL);
 		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 			return RC;
 		}
 	}
@@ -441,12 +452,38 @@ AieRC _XAie_PrivilegeInitPart(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
 		return RC;
 	}
 
-	/* Enable NPI interrupt to PS GIC */
-	RC = _XAie_NpiIrqEnable(DevInst, XAIE_ERROR_NPI_INTR_ID,
-				XAIE_ERROR_NPI_INTR_ID);
-	if (RC != XAIE_OK) {
-		XAIE_ERROR("Failed to enable NPI interrupt\n");
-		return RC;
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API completes the AI engine partition initialization once its AI engine
+* registers are configured.
+*
+* @param	DevInst: AI engine partition device instance pointer
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		Internal only. This API enables the NPI interrupt and disables
+*		the protected registers.
+*
+*******************************************************************************/
+static AieRC _XAie_PrivilegeInitPartFinish(XAie_DevInst *DevInst)
+{
+	u8 NumGroups;
+	AieRC RC;
+
+	/* Enable NPI interrupt of each error group to PS GIC */
+	NumGroups = (DevInst->NumErrIrqGroups == 0U) ? 1U :
+		DevInst->NumErrIrqGroups;
+	for(u8 Group = 0U; Group < NumGroups; Group++) {
+		u8 IrqId = XAie_ErrorIrqGroupIrqId(Group);
+
+		RC = _XAie_NpiIrqEnable(DevInst, IrqId, IrqId);
+		if (RC != XAIE_OK) {
+			XAIE_ERROR("Failed to enable NPI interrupt\n");
+			return RC;
+		}
 	}
 
 	RC = _XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
@@ -455,7 +492,51 @@ AieRC _XAie_PrivilegeInitPart(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
 
 /*****************************************************************************/
 /**
-* This API tears down the AI engine partition
+* This API runs one step of the partition initialization. Unless a transaction
+* is already active, the AI engine register writes of the step are submitted
+* to the backend as one transaction.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Step: Initialization step to run.
+* @param	OptFlags: Initialization options
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_PrivilegeInitPartRun(XAie_DevInst *DevInst,
+		AieRC (*Step)(XAie_DevInst *DevInst, u32 OptFlags),
+		u32 OptFlags)
+{
+	XAie_TxnInst *Inst;
+	AieRC RC;
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE) {
+		return Step(DevInst, OptFlags);
+	}
+
+	RC = _XAie_Txn_Start(DevInst, XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = Step(DevInst, OptFlags);
+	if(RC == XAIE_OK) {
+		return _XAie_Txn_Submit(DevInst, NULL);
+	}
+
+	Inst = _XAie_TxnDetach(DevInst);
+	if(Inst != NULL) {
+		_XAie_TxnFree(Inst);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API initializes the AI engine partition
 *
 * @param	DevInst: AI engine partition device instance pointer
 * @param	Opts: Initialization options
@@ -466,67 +547,377 @@ AieRC _XAie_PrivilegeInitPart(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
 *		engine partition:
 *		- Clock gate all columns
 *		- Reset Columns
-*		- Ungate all columns
-*		- Reset shims
+*		- Ungate all Columns
 *		- Remove columns reset
-*		- Ungate all columns
-*		- Zeroize memories
-*		- Clock gate all columns
+*		- Reset shims
+*		- Setup AXI MM not to return errors for AXI decode or slave
+*		  errors, raise events instead.
+*		- ungate all columns
+*		- Setup partition isolation.
+*		- zeroize memory if it is requested
+*		The protected registers are enabled once for the whole
+*		sequence. The steps before and after the SHIM reset are each
+*		submitted as one transaction.
 *
 *******************************************************************************/
-AieRC _XAie_PrivilegeTeardownPart(XAie_DevInst *DevInst)
+AieRC _XAie_PrivilegeInitPart(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
 {
+	u32 OptFlags;
 	AieRC RC;
 
+	if(Opts != NULL) {
+		OptFlags = Opts->InitOpts;
+	} else {
+		OptFlags = XAIE_PART_INIT_OPT_DEFAULT;
+	}
+
 	RC = _XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_ENABLE);
 	if(RC != XAIE_OK) {
-		XAIE_ERROR("Failed to teardown partition, enable protected registers failed.\n");
+		XAIE_ERROR("Failed to initialize partition, enable protected registers failed.\n");
 		return RC;
 	}
 
-	RC = _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
+	RC = _XAie_PrivilegeInitPartRun(DevInst,
+			_XAie_PrivilegeInitPartColRst, OptFlags);
+	if((RC == XAIE_OK) &&
+			((OptFlags & XAIE_PART_INIT_OPT_SHIM_RST) != 0)) {
+		RC = _XAie_PrivilegeRstPartShims(DevInst);
+	}
+	if(RC == XAIE_OK) {
+		RC = _XAie_PrivilegeInitPartRun(DevInst,
+				_XAie_PrivilegeInitPartCfg, OptFlags);
+	}
 	if(RC != XAIE_OK) {
 		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 		return RC;
 	}
 
-	RC = _XAie_PrivilegeSetPartColReset(DevInst, XAIE_ENABLE);
+	return _XAie_PrivilegeInitPartFinish(DevInst);
+}
+
+/*****************************************************************************/
+/**
+* This API records one step of the partition initialization into a
+* transaction without accessing the hardware.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Step: Initialization step to record.
+* @param	OptFlags: Initialization options
+*
+* @return       Exported transaction instance on success, NULL on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static XAie_TxnInst* _XAie_PrivilegeInitPartRecord(XAie_DevInst *DevInst,
+		AieRC (*Step)(XAie_DevInst *DevInst, u32 OptFlags),
+		u32 OptFlags)
+{
+	XAie_TxnInst *Inst = NULL, *Live;
+
+	if(_XAie_Txn_Start(DevInst, XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) !=
+			XAIE_OK) {
+		return NULL;
+	}
+
+	if(Step(DevInst, OptFlags) == XAIE_OK) {
+		Inst = _XAie_TxnExport(DevInst);
+	}
+
+	/* The recorded commands are not executed */
+	Live = _XAie_TxnDetach(DevInst);
+	if(Live != NULL) {
+		_XAie_TxnFree(Live);
+	}
+
+	return Inst;
+}
+
+/*****************************************************************************/
+/**
+* This API records the partition initialization for the given options and
+* serializes it into an initialization cache. The cache is made of a header
+* and the serialized transactions of the steps before and after the SHIM
+* reset, which is done with NPI registers on some devices and is run directly
+* when the cache is replayed.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Opts: Initialization options
+* @param	Buf: Destination buffer. If NULL, only the required size is
+*		returned in Size.
+* @param	Size: Pointer to the size of Buf in bytes. It is updated with
+*		the size of the initialization cache.
+*
+* @return       XAIE_OK on success, XAIE_INSUFFICIENT_BUFFER_SIZE if Buf is
+*		too small and error code on failure.
+*
+* @note		Internal only. The hardware is not accessed.
+*
+*******************************************************************************/
+AieRC _XAie_PrivilegeInitPartCapture(XAie_DevInst *DevInst,
+		XAie_PartInitOpts *Opts, void *Buf, u64 *Size)
+{
+	XAie_PartInitCacheHdr Hdr = {0};
+	XAie_TxnInst *RstInst = NULL, *CfgInst;
+	u64 RstSize = 0U, CfgSize = 0U, CacheSize;
+	u32 OptFlags;
+	AieRC RC;
+
+	if(Opts != NULL) {
+		OptFlags = Opts->InitOpts;
+	} else {
+		OptFlags = XAIE_PART_INIT_OPT_DEFAULT;
+	}
+
+	if((OptFlags & XAIE_PART_INIT_OPT_COLUMN_RST) != 0) {
+		RstInst = _XAie_PrivilegeInitPartRecord(DevInst,
+				_XAie_PrivilegeInitPartColRst, OptFlags);
+		if(RstInst == NULL) {
+			XAIE_ERROR("Failed to record column reset\n");
+			return XAIE_ERR;
+		}
+	}
+
+	CfgInst = _XAie_PrivilegeInitPartRecord(DevInst,
+			_XAie_PrivilegeInitPartCfg, OptFlags);
+	if(CfgInst == NULL) {
+		XAIE_ERROR("Failed to record partition configuration\n");
+		RC = XAIE_ERR;
+		goto out;
+	}
+
+	if(RstInst != NULL) {
+		RC = XAie_TxnSerialize(DevInst, RstInst, NULL, &RstSize);
+		if(RC != XAIE_OK) {
+			goto out;
+		}
+	}
+
+	RC = XAie_TxnSerialize(DevInst, CfgInst, NULL, &CfgSize);
 	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
+		goto out;
+	}
+
+	CacheSize = sizeof(Hdr) + RstSize + CfgSize;
+	if(Buf == NULL) {
+		*Size = CacheSize;
+		goto out;
+	}
+
+	if(*Size < CacheSize) {
+		XAIE_ERROR("Insufficient buffer size, expected %lu bytes\n",
+				CacheSize);
+		*Size = CacheSize;
+		RC = XAIE_INSUFFICIENT_BUFFER_SIZE;
+		goto out;
+	}
+
+	Hdr.Magic = XAIE_PART_INIT_CACHE_MAGIC;
+	Hdr.DevGen = DevInst->DevProp.DevGen;
+	Hdr.NumRows = DevInst->NumRows;
+	Hdr.NumCols = DevInst->NumCols;
+	Hdr.OptFlags = OptFlags;
+	Hdr.RstSize = RstSize;
+	Hdr.CfgSize = CfgSize;
+	memcpy(Buf, (void *)&Hdr, sizeof(Hdr));
+
+	if(RstInst != NULL) {
+		RC = XAie_TxnSerialize(DevInst, RstInst,
+				(u8 *)Buf + sizeof(Hdr), &RstSize);
+		if(RC != XAIE_OK) {
+			goto out;
+		}
+	}
+
+	RC = XAie_TxnSerialize(DevInst, CfgInst,
+			(u8 *)Buf + sizeof(Hdr) + RstSize, &CfgSize);
+	if(RC == XAIE_OK) {
+		*Size = CacheSize;
+	}
+
+out:
+	if(RstInst != NULL) {
+		_XAie_TxnFree(RstInst);
+	}
+	if(CfgInst != NULL) {
+		_XAie_TxnFree(CfgInst);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API initializes the AI engine partition from an initialization cache
+* generated by _XAie_PrivilegeInitPartCapture().
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Buf: Initialization cache.
+* @param	Size: Size of Buf in bytes.
+*
+* @return       XAIE_OK on success, XAIE_INVALID_DEVICE if the cache was
+*		captured for another device generation or partition geometry
+*		and error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_PrivilegeInitPartReplay(XAie_DevInst *DevInst, const void *Buf,
+		u64 Size)
+{
+	XAie_PartInitCacheHdr Hdr;
+	const u8 *Ptr = (const u8 *)Buf;
+	AieRC RC;
+
+	if((Buf == NULL) || (Size < sizeof(Hdr))) {
+		XAIE_ERROR("Invalid partition initialization cache\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	memcpy((void *)&Hdr, Buf, sizeof(Hdr));
+	if((Hdr.Magic != XAIE_PART_INIT_CACHE_MAGIC) ||
+			(Hdr.RstSize > Size - sizeof(Hdr)) ||
+			(Hdr.CfgSize > Size - sizeof(Hdr) - Hdr.RstSize)) {
+		XAIE_ERROR("Invalid partition initialization cache\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Hdr.DevGen != DevInst->DevProp.DevGen) ||
+			(Hdr.NumRows != DevInst->NumRows) ||
+			(Hdr.NumCols != DevInst->NumCols)) {
+		XAIE_ERROR("Partition initialization cache was captured for a "
+				"different device or partition geometry\n");
+		return XAIE_INVALID_DEVICE;
+	}
+
+	RC = _XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_ENABLE);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to initialize partition, enable protected registers failed.\n");
 		return RC;
 	}
 
-	RC = _XAie_PmSetPartitionClock(DevInst, XAIE_ENABLE);
+	Ptr += sizeof(Hdr);
+	if(Hdr.RstSize != 0U) {
+		RC = XAie_TxnReplay(DevInst, Ptr, Hdr.RstSize);
+	}
+	if((RC == XAIE_OK) &&
+			((Hdr.OptFlags & XAIE_PART_INIT_OPT_SHIM_RST) != 0)) {
+		RC = _XAie_PrivilegeRstPartShims(DevInst);
+	}
+	if(RC == XAIE_OK) {
+		RC = XAie_TxnReplay(DevInst, Ptr + Hdr.RstSize, Hdr.CfgSize);
+	}
 	if(RC != XAIE_OK) {
 		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 		return RC;
 	}
 
-	RC = _XAie_PrivilegeSetPartColReset(DevInst, XAIE_DISABLE);
+	return _XAie_PrivilegeInitPartFinish(DevInst);
+}
+
+/*****************************************************************************/
+/**
+* This API clears the AI engine partition after its columns and SHIMs are
+* reset as the last step of the partition teardown.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	UsedTiles: Bitmap of the tiles to zeroize, NULL for all the
+*		tiles.
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		Internal only. The caller enables the protected registers.
+*		This step only accesses AI engine registers, so it can be
+*		recorded into a transaction.
+*
+*******************************************************************************/
+static AieRC _XAie_PrivilegeTeardownPartClear(XAie_DevInst *DevInst,
+		const u32 *UsedTiles)
+{
+	AieRC RC;
+
+	RC = DevInst->DevOps->SetPartColClockAfterRst(DevInst, XAIE_ENABLE);
 	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 		return RC;
 	}
 
-	RC = _XAie_PrivilegeRstPartShims(DevInst);
+	RC = DevInst->DevOps->PartMemZeroInit(DevInst, UsedTiles);
 	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 		return RC;
 	}
 
-	RC = DevInst->DevOps->SetPartColClockAfterRst(DevInst, XAIE_ENABLE);
+	return _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
+}
+
+/*****************************************************************************/
+/**
+* This API tears down the AI engine partition
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	UsedTiles: Bitmap of the tiles used since the partition was
+*		initialized, in the layout of the tiles in use of the device
+*		instance. Only their memories are zeroized. NULL to zeroize
+*		the memories of all the tiles.
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		This operation does the following steps to initialize an AI
+*		engine partition:
+*		- Clock gate all columns
+*		- Reset Columns
+*		- Ungate all columns
+*		- Remove columns reset
+*		- Reset shims
+*		- Ungate all columns
+*		- Zeroize memories
+*		- Clock gate all columns
+*		The protected registers are enabled once for the whole
+*		sequence. The steps before and after the SHIM reset are each
+*		submitted as one transaction.
+*
+*******************************************************************************/
+AieRC _XAie_PrivilegeTeardownPart(XAie_DevInst *DevInst, const u32 *UsedTiles)
+{
+	XAie_TxnInst *Inst;
+	AieRC RC;
+
+	RC = _XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_ENABLE);
 	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
+		XAIE_ERROR("Failed to teardown partition, enable protected registers failed.\n");
 		return RC;
 	}
 
-	RC = DevInst->DevOps->PartMemZeroInit(DevInst);
-	if (RC != XAIE_OK) {
+	RC = _XAie_PrivilegeInitPartRun(DevInst,
+			_XAie_PrivilegeInitPartColRst,
+			XAIE_PART_INIT_OPT_COLUMN_RST);
+	if(RC == XAIE_OK) {
+		RC = _XAie_PrivilegeRstPartShims(DevInst);
+	}
+	if(RC != XAIE_OK) {
 		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 		return RC;
 	}
 
-	RC = _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
+	if(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE) {
+		RC = _XAie_PrivilegeTeardownPartClear(DevInst, UsedTiles);
+	} else {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC == XAIE_OK) {
+			RC = _XAie_PrivilegeTeardownPartClear(DevInst,
+					UsedTiles);
+			if(RC == XAIE_OK) {
+				RC = _XAie_Txn_Submit(DevInst, NULL);
+			}
+			/* A failed transaction is still attached */
+			if(RC != XAIE_OK) {
+				Inst = _XAie_TxnDetach(DevInst);
+				if(Inst != NULL) {
+					_XAie_TxnFree(Inst);
+				}
+			}
+		}
+	}
 	if(RC != XAIE_OK) {
 		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 		return RC;
@@ -581,9 +972,10 @@ AieRC _XAie_PrivilegeInitPart(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
 
-AieRC _XAie_PrivilegeTeardownPart(XAie_DevInst *DevInst)
+AieRC _XAie_PrivilegeTeardownPart(XAie_DevInst *DevInst, const u32 *UsedTiles)
 {
 	(void)DevInst;
+	(void)UsedTiles;
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
 
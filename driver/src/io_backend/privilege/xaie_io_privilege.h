@@ -29,7 +29,11 @@
 #include "xaie_io_privilege.h"
 
 AieRC _XAie_PrivilegeInitPart(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts);
-AieRC _XAie_PrivilegeTeardownPart(XAie_DevInst *DevInst);
+AieRC _XAie_PrivilegeInitPartCapture(XAie_DevInst *DevInst,
+		XAie_PartInitOpts *Opts, void *Buf, u64 *Size);
+AieRC _XAie_PrivilegeInitPartReplay(XAie_DevInst *DevInst, const void *Buf,
+		u64 Size);
+AieRC _XAie_PrivilegeTeardownPart(XAie_DevInst *DevInst, const u32 *UsedTiles);
 AieRC _XAie_PrivilegeRequestTiles(XAie_DevInst *DevInst,
 		XAie_BackendTilesArray *Args);
 
@@ -26,6 +26,8 @@
 #define XAIE_IO_H
 
 /***************************** Include Files *********************************/
+#include "xaie_feature_config.h"
+#include "xaie_iostats.h"
 #include "xaie_rsc.h"
 #include "xaiegbl.h"
 
@@ -53,6 +55,16 @@ typedef enum {
 	XAIE_BACKEND_OP_PARTITION_TEARDOWN,
 	XAIE_BACKEND_OP_GET_RSC_STAT,
 	XAIE_BACKEND_OP_UPDATE_NPI_ADDR,
+	XAIE_BACKEND_OP_CONFIG_REG_MMAP,
+	XAIE_BACKEND_OP_CONFIG_WRITE_COMBINE,
+	XAIE_BACKEND_OP_FLUSH_WRITES,
+	XAIE_BACKEND_OP_CONFIG_POLL,
+	XAIE_BACKEND_OP_REQUEST_RSC_BATCH,
+	XAIE_BACKEND_OP_CONFIG_ATTACH_CACHE,
+	XAIE_BACKEND_OP_CONFIG_SHIMDMABD_BATCH,
+	XAIE_BACKEND_OP_CONFIG_IO_RECORD,
+	XAIE_BACKEND_OP_NPI_REQ_LIST,
+	XAIE_BACKEND_OP_CONFIG_HUGE_PAGES,
 } XAie_BackendOpCode;
 
 /*
@@ -73,6 +85,35 @@ typedef struct XAie_BackendNpiMaskPollReq {
 	u32 TimeOutUs;
 } XAie_BackendNpiMaskPollReq;
 
+/*
+ * Typedef for enum to capture the type of a request of an NPI request list
+ */
+typedef enum {
+	XAIE_BACKEND_NPI_REQ_WR32,
+	XAIE_BACKEND_NPI_REQ_MASKPOLL32,
+} XAie_BackendNpiReqType;
+
+/*
+ * Typedef for structure for one request of an NPI request list. Mask and
+ * TimeOutUs are only used by mask polls.
+ */
+typedef struct XAie_BackendNpiReq {
+	XAie_BackendNpiReqType Type;
+	u32 NpiRegOff;
+	u32 Mask;
+	u32 Val;
+	u32 TimeOutUs;
+} XAie_BackendNpiReq;
+
+/*
+ * Typedef for structure for an NPI request list. The requests are run in order
+ * and the list stops at the first mask poll which times out.
+ */
+typedef struct XAie_BackendNpiReqList {
+	const XAie_BackendNpiReq *Reqs;
+	u32 NumReqs;
+} XAie_BackendNpiReqList;
+
 /*
  * Typedef for structure for tiles array
  */
@@ -96,12 +137,25 @@ typedef struct XAie_BackendTilesRsc {
 	u32 UserRscNumInput;
 	u32 Flags;
 	u8 NumContigRscs;
+	u8 Policy;		/* XAie_RscPolicy of the request */
+	u32 PreferMask;		/* Ids to grant first with the common free
+				 * policy */
 	XAie_RscType RscType;
 	XAie_LocType Loc;
 	XAie_ModuleType Mod;
 	XAie_UserRsc *Rscs;
 } XAie_BackendTilesRsc;
 
+/*
+ * Typedef for structure for a batch of resource requests, granted all or
+ * none. Each element requests one resource, the free resource of its lowest
+ * id if its RscId is XAIE_RSC_ID_ANY, else the resource of its RscId.
+ */
+typedef struct XAie_BackendRscBatch {
+	u32 NumRscs;
+	XAie_BackendTilesRsc *TilesRsc;
+} XAie_BackendRscBatch;
+
 /*
  * Typedef for enum of AIE resoure statistics type
  */
@@ -132,6 +186,7 @@ typedef struct XAie_BackendRscStat {
  * BlockWrite32: IO operation to write a block of data at 32-bit granularity.
  * BlockSet32  : IO operation to initialize a chunk of aie address space with a
  *               a specified value at 32-bit granularity.
+ * BlockRead32 : IO operation to read a block of data at 32-bit granularity.
  * CmdWrite32  : This IO operation is required only in simulation mode. Other
  *               backends should have a no-op.
  * RunOp       : Run operation specified by the operation code
@@ -142,6 +197,9 @@ typedef struct XAie_BackendRscStat {
  *		 by the MemAllocate api.
  * MemSyncForCPU: Backend operation to prepare memory for CPU access.
  * MemSyncForDev: Backend operation to prepare memory for Device access.
+ * MemSyncRanges: Optional backend operation to prepare ranges of memory for
+ *		  CPU or Device access. If it is NULL, the whole buffer of
+ *		  each range is synced with MemSyncForCPU or MemSyncForDev.
  * MemAttach    : Backend operation to attach memory to AI engine device.
  * MemDetach    : Backend operation to detach memory from AI engine device
  * GetTid	: Backend operation to get unique thread id.
@@ -157,6 +215,7 @@ typedef struct XAie_BackendOps {
 			u32 TimeOutUs);
 	AieRC (*BlockWrite32)(void *IOInst, u64 RegOff, const u32 *Data, u32 Size);
 	AieRC (*BlockSet32)(void *IOInst, u64 RegOff, u32 Data, u32 Size);
+	AieRC (*BlockRead32)(void *IOInst, u64 RegOff, u32 *Data, u32 Size);
 	AieRC (*CmdWrite)(void *IOInst, u8 Col, u8 Row, u8 Command, u32 CmdWd0,
 			u32 CmdWd1, const char *CmdStr);
 	AieRC (*RunOp)(void *IOInst, XAie_DevInst *DevInst,
@@ -166,6 +225,7 @@ typedef struct XAie_BackendOps {
 	AieRC (*MemFree)(XAie_MemInst *MemInst);
 	AieRC (*MemSyncForCPU)(XAie_MemInst *MemInst);
 	AieRC (*MemSyncForDev)(XAie_MemInst *MemInst);
+	AieRC (*MemSyncRanges)(const XAie_MemSyncRange *Ranges, u32 NumRanges);
 	AieRC (*MemAttach)(XAie_MemInst *MemInst, u64 MemHandle);
 	AieRC (*MemDetach)(XAie_MemInst *MemInst);
 	u64 (*GetTid)(void);
@@ -189,9 +249,27 @@ typedef struct XAie_ShimDmaBdArgs {
 	u64 Addr;
 } XAie_ShimDmaBdArgs;
 
+/* Typedef to capture a batch of shimdma Bd arguments */
+typedef struct XAie_BackendShimDmaBdBatch {
+	XAie_ShimDmaBdArgs *BdArgs;
+	u32 NumBds;
+} XAie_BackendShimDmaBdBatch;
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_IOInit(XAie_DevInst *DevInst);
 const XAie_Backend* _XAie_GetBackendPtr(XAie_BackendType Backend);
+#ifdef XAIE_BACKEND_LINUX_ONLY
+AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value);
+AieRC XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data);
+AieRC XAie_LinuxIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
+		u32 Value);
+AieRC XAie_LinuxIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
+		u32 TimeOutUs);
+AieRC XAie_LinuxIO_BlockWrite32(void *IOInst, u64 RegOff,
+		const u32 *Data, u32 Size);
+AieRC XAie_LinuxIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
+		u32 Size);
+#endif /* XAIE_BACKEND_LINUX_ONLY */
 
 /*****************************************************************************/
 /**
@@ -243,6 +321,193 @@ _XAie_SetBackendNpiMaskPollReq(u32 RegOff, u32 Mask, u32 RegVal, u32 TimeOutUs)
 	return Req;
 }
 
+/*****************************************************************************/
+/**
+*
+* Write a 32-bit register through the IO backend of the device instance.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset to write to.
+* @param	Value: Value to write.
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal API only. Builds with only the Linux backend call it
+*		directly instead of through the backend ops.
+*
+******************************************************************************/
+static inline AieRC _XAie_IOWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Value)
+{
+	u64 Start = XAIE_IO_STATS_START(DevInst);
+	AieRC RC;
+
+#ifdef XAIE_BACKEND_LINUX_ONLY
+	RC = XAie_LinuxIO_Write32(DevInst->IOInst, RegOff, Value);
+#else
+	RC = DevInst->Backend->Ops.Write32(DevInst->IOInst, RegOff, Value);
+#endif
+	XAIE_IO_STATS_END(DevInst, XAIE_IO_STATS_WRITE32, 4U, Start);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* Read a 32-bit register through the IO backend of the device instance.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the register value.
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline AieRC _XAie_IORead32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 *Data)
+{
+	u64 Start = XAIE_IO_STATS_START(DevInst);
+	AieRC RC;
+
+#ifdef XAIE_BACKEND_LINUX_ONLY
+	RC = XAie_LinuxIO_Read32(DevInst->IOInst, RegOff, Data);
+#else
+	RC = DevInst->Backend->Ops.Read32(DevInst->IOInst, RegOff, Data);
+#endif
+	XAIE_IO_STATS_END(DevInst, XAIE_IO_STATS_READ32, 4U, Start);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* Mask write a 32-bit register through the IO backend of the device instance.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset to write to.
+* @param	Mask: Mask of the bits to update.
+* @param	Value: Value of the bits to update.
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline AieRC _XAie_IOMaskWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Mask, u32 Value)
+{
+	u64 Start = XAIE_IO_STATS_START(DevInst);
+	AieRC RC;
+
+#ifdef XAIE_BACKEND_LINUX_ONLY
+	RC = XAie_LinuxIO_MaskWrite32(DevInst->IOInst, RegOff, Mask, Value);
+#else
+	RC = DevInst->Backend->Ops.MaskWrite32(DevInst->IOInst, RegOff, Mask,
+			Value);
+#endif
+	XAIE_IO_STATS_END(DevInst, XAIE_IO_STATS_MASKWRITE32, 4U, Start);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* Poll a 32-bit register through the IO backend of the device instance.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset to poll.
+* @param	Mask: Mask of the bits to compare.
+* @param	Value: Value to wait for.
+* @param	TimeOutUs: Timeout in micro seconds.
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline AieRC _XAie_IOMaskPoll(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Mask, u32 Value, u32 TimeOutUs)
+{
+	u64 Start = XAIE_IO_STATS_START(DevInst);
+	AieRC RC;
+
+#ifdef XAIE_BACKEND_LINUX_ONLY
+	RC = XAie_LinuxIO_MaskPoll(DevInst->IOInst, RegOff, Mask, Value,
+			TimeOutUs);
+#else
+	RC = DevInst->Backend->Ops.MaskPoll(DevInst->IOInst, RegOff, Mask,
+			Value, TimeOutUs);
+#endif
+	XAIE_IO_STATS_END(DevInst, XAIE_IO_STATS_MASKPOLL, 4U, Start);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* Write a block of 32-bit registers through the IO backend of the device
+* instance.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Offset of the first register.
+* @param	Data: Values to write.
+* @param	Size: Number of registers.
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline AieRC _XAie_IOBlockWrite32(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	u64 Start = XAIE_IO_STATS_START(DevInst);
+	AieRC RC;
+
+#ifdef XAIE_BACKEND_LINUX_ONLY
+	RC = XAie_LinuxIO_BlockWrite32(DevInst->IOInst, RegOff, Data, Size);
+#else
+	RC = DevInst->Backend->Ops.BlockWrite32(DevInst->IOInst, RegOff, Data,
+			Size);
+#endif
+	XAIE_IO_STATS_END(DevInst, XAIE_IO_STATS_BLOCKWRITE32, (u64)Size * 4U, Start);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* Set a block of 32-bit registers to a value through the IO backend of the
+* device instance.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Offset of the first register.
+* @param	Data: Value to set.
+* @param	Size: Number of registers.
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline AieRC _XAie_IOBlockSet32(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Data, u32 Size)
+{
+	u64 Start = XAIE_IO_STATS_START(DevInst);
+	AieRC RC;
+
+#ifdef XAIE_BACKEND_LINUX_ONLY
+	RC = XAie_LinuxIO_BlockSet32(DevInst->IOInst, RegOff, Data, Size);
+#else
+	RC = DevInst->Backend->Ops.BlockSet32(DevInst->IOInst, RegOff, Data,
+			Size);
+#endif
+	XAIE_IO_STATS_END(DevInst, XAIE_IO_STATS_BLOCKSET32, (u64)Size * 4U, Start);
+
+	return RC;
+}
+
 #endif	/* End of protection macro */
 
 /** @} */
@@ -60,6 +60,7 @@
 
 #include "xaie_lite_regdef_aieml.h"
 #include "xaie_lite_regops_aieml.h"
+#include "xaie_lite_rtops_aieml.h"
 
 /************************** Variable Definitions *****************************/
 /************************** Function Prototypes  *****************************/
@@ -69,6 +69,18 @@ static inline u64 _XAie_LPartGetTileAddr(XAie_DevInst *DevInst,
 	return DevInst->BaseAddr + _XAie_LGetTileAddr(Loc.Row, Loc.Col);
 }
 
+__FORCE_INLINE__
+static inline u8 _XAie_LIsTileUsed(const u32 *UsedTiles, u32 Row, u32 Col)
+{
+	u32 Pos = Col * (XAIE_NUM_ROWS - 1U) + Row - 1U;
+
+	if(UsedTiles == NULL) {
+		return XAIE_ENABLE;
+	}
+
+	return (u8)((UsedTiles[Pos / 32U] >> (Pos % 32U)) & 1U);
+}
+
 #if defined(__AIECUSTOMIO__)
 
 extern inline void _XAie_LRawWrite32(u64 RegAddr, u32 Value);
@@ -39,7 +39,6 @@
 #define XAIE_ISOLATE_SOUTH_MASK	(1U << 0)
 #define XAIE_ISOLATE_ALL_MASK	((1U << 4) - 1)
 
-#define XAIE_ERROR_NPI_INTR_ID	0x1U
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -269,7 +268,8 @@ static void _XAie_PrivilegeSetL2IrqId(XAie_DevInst *DevInst, XAie_LocType Loc,
 *
 * @param	DevInst: Device Instance
 *
-* @note		None.
+* @note		Each controller drives the IRQ of the error interrupt group of
+*		its column.
 *
 ******************************************************************************/
 static void _XAie_PrivilegeSetL2ErrIrq(XAie_DevInst *DevInst)
@@ -281,7 +281,8 @@ static void _XAie_PrivilegeSetL2ErrIrq(XAie_DevInst *DevInst)
 		Loc = XAie_LPartGetNextNocTile(DevInst, Loc)) {
 
 		_XAie_PrivilegeSetL2IrqId(DevInst, Loc,
-				XAIE_ERROR_NPI_INTR_ID);
+				XAie_ErrorIrqGroupIrqId(
+					XAie_ErrorIrqGroup(DevInst, Loc.Col)));
 	}
 }
 
@@ -311,6 +312,7 @@ static void _XAie_PrivilegeSetL2ErrIrq(XAie_DevInst *DevInst)
 AieRC XAie_PartitionInitialize(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
 {
 	u32 OptFlags;
+	u8 NumGroups;
 
 	XAIE_ERROR_RETURN((DevInst == NULL || DevInst->NumCols > XAIE_NUM_COLS),
 		XAIE_INVALID_ARGS,
@@ -347,13 +349,18 @@ AieRC XAie_PartitionInitialize(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
 	}
 
 	if ((OptFlags & XAIE_PART_INIT_OPT_ZEROIZEMEM) != 0) {
-		_XAie_LPartMemZeroInit(DevInst);
+		_XAie_LPartMemZeroInit(DevInst, NULL);
 	}
 
 	_XAie_PrivilegeSetL2ErrIrq(DevInst);
 
-	/* Enable NPI interrupt to PS GIC */
-	_XAie_LNpiIrqEnable(XAIE_ERROR_NPI_INTR_ID, XAIE_ERROR_NPI_INTR_ID);
+	/* Enable NPI interrupt of each error group to PS GIC */
+	NumGroups = (DevInst->NumErrIrqGroups == 0U) ? 1U :
+		DevInst->NumErrIrqGroups;
+	for(u8 Group = 0U; Group < NumGroups; Group++) {
+		_XAie_LNpiIrqEnable(XAie_ErrorIrqGroupIrqId(Group),
+				XAie_ErrorIrqGroupIrqId(Group));
+	}
 
 	_XAie_LNpiSetPartProtectedReg(DevInst, XAIE_DISABLE);
 
@@ -365,7 +372,8 @@ AieRC XAie_PartitionInitialize(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
 * This API tears down the AI engine partition
 *
 * @param	DevInst: AI engine partition device instance pointer
-* @param	Opts: Initialization options
+* @param	UsedTiles: Bitmap of the tiles to zeroize, NULL for all the
+*		tiles.
 *
 * @return       XAIE_OK on success, error code on failure
 *
@@ -378,9 +386,10 @@ AieRC XAie_PartitionInitialize(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
 *		- Ungate all columns
 *		- Zeroize memories
 *		- Clock gate all columns
+*		This function is internal to this file.
 *
 *******************************************************************************/
-AieRC XAie_PartitionTeardown(XAie_DevInst *DevInst)
+static AieRC _XAie_LPartTeardown(XAie_DevInst *DevInst, const u32 *UsedTiles)
 {
 
 	XAIE_ERROR_RETURN((DevInst == NULL || DevInst->NumCols > XAIE_NUM_COLS),
@@ -401,7 +410,7 @@ AieRC XAie_PartitionTeardown(XAie_DevInst *DevInst)
 
 	_XAie_PrivilegeSetPartColClkBuf(DevInst, XAIE_ENABLE);
 
-	_XAie_LPartMemZeroInit(DevInst);
+	_XAie_LPartMemZeroInit(DevInst, UsedTiles);
 
 	_XAie_PrivilegeSetPartColClkBuf(DevInst, XAIE_DISABLE);
 
@@ -410,5 +419,121 @@ AieRC XAie_PartitionTeardown(XAie_DevInst *DevInst)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* This API tears down the AI engine partition
+*
+* @param	DevInst: AI engine partition device instance pointer
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		The memories of all the tiles are zeroized.
+*
+*******************************************************************************/
+AieRC XAie_PartitionTeardown(XAie_DevInst *DevInst)
+{
+	return _XAie_LPartTeardown(DevInst, NULL);
+}
+
+/*****************************************************************************/
+/**
+* This API tears down the AI engine partition, zeroizing only the memories of
+* the tiles used since the partition was initialized. The memories of the
+* other tiles still hold the zeros of the initialization or of the previous
+* teardown, as their clocks were gated.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	UsedTiles: Bitmap of the used tiles, bit
+*		Col * (XAIE_NUM_ROWS - 1) + Row - 1 for the tiles above the
+*		SHIM row. NULL for all the tiles, as the lite driver does not
+*		track the requested tiles.
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		The columns and SHIMs are reset as with
+*		XAie_PartitionTeardown().
+*
+*******************************************************************************/
+AieRC XAie_PartitionTeardownTiles(XAie_DevInst *DevInst,
+		const u32 *UsedTiles)
+{
+	return _XAie_LPartTeardown(DevInst, UsedTiles);
+}
+
+/*****************************************************************************/
+/**
+* This API gates the clocks of a range of columns of the AI engine partition.
+* The SHIM tiles stay clocked, so the stream switch routes along the SHIM row
+* through the gated columns keep working.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	StartCol: First column, relative to the partition.
+* @param	NumCols: Number of columns.
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_PartitionGateColumns(XAie_DevInst *DevInst, u32 StartCol,
+		u32 NumCols)
+{
+	XAIE_ERROR_RETURN((DevInst == NULL || NumCols == 0U ||
+		StartCol >= DevInst->NumCols ||
+		NumCols > DevInst->NumCols - StartCol), XAIE_INVALID_ARGS,
+		"Columns gating failed, invalid columns range\n");
+
+	_XAie_LNpiSetPartProtectedReg(DevInst, XAIE_ENABLE);
+
+	for(u32 C = StartCol; C < StartCol + NumCols; C++) {
+		_XAie_PrivilegeSetColClkBuf(DevInst, XAie_TileLoc(C, 0),
+				XAIE_DISABLE);
+	}
+
+	_XAie_LNpiSetPartProtectedReg(DevInst, XAIE_DISABLE);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API ungates the clocks of a range of columns of the AI engine
+* partition before a job starts on them.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	StartCol: First column, relative to the partition.
+* @param	NumCols: Number of columns.
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		The clock buffer of the last column is read back, so the
+*		columns are ungated when this API returns and the caller can
+*		time the ungating around the call.
+*
+*******************************************************************************/
+AieRC XAie_PartitionUngateColumns(XAie_DevInst *DevInst, u32 StartCol,
+		u32 NumCols)
+{
+	XAIE_ERROR_RETURN((DevInst == NULL || NumCols == 0U ||
+		StartCol >= DevInst->NumCols ||
+		NumCols > DevInst->NumCols - StartCol), XAIE_INVALID_ARGS,
+		"Columns ungating failed, invalid columns range\n");
+
+	_XAie_LNpiSetPartProtectedReg(DevInst, XAIE_ENABLE);
+
+	for(u32 C = StartCol; C < StartCol + NumCols; C++) {
+		_XAie_PrivilegeSetColClkBuf(DevInst, XAie_TileLoc(C, 0),
+				XAIE_ENABLE);
+	}
+
+	(void)_XAie_LPartRead32(DevInst,
+			_XAie_LGetTileAddr(0, StartCol + NumCols - 1U) +
+			XAIE_PL_MOD_COL_CLKCNTR_REGOFF);
+
+	_XAie_LNpiSetPartProtectedReg(DevInst, XAIE_DISABLE);
+
+	return XAIE_OK;
+}
+
 #endif /* XAIE_FEATURE_PRIVILEGED_ENABLE && XAIE_FEATURE_LITE */
 /** @} */
@@ -126,6 +126,73 @@
 #define XAIE_TILE_CNTR_ISOLATE_EAST_MASK		XAIE_CORE_MOD_TILE_CNTR_ISOLATE_EAST_MASK
 #define XAIE_TILE_CNTR_ISOLATE_WEST_MASK		XAIE_CORE_MOD_TILE_CNTR_ISOLATE_WEST_MASK
 
+/* Lock request registers */
+#define XAIE_MEM_MOD_LOCK_REQUEST_REGOFF		XAIEMLGBL_MEMORY_MODULE_LOCK_REQUEST
+#define XAIE_MEM_TILE_LOCK_REQUEST_REGOFF		XAIEMLGBL_MEM_TILE_MODULE_LOCK_REQUEST
+#define XAIE_NOC_MOD_LOCK_REQUEST_REGOFF		XAIEMLGBL_NOC_MODULE_LOCK_REQUEST
+#define XAIE_LOCK_ID_OFFSET				0x400U
+#define XAIE_LOCK_ACQ_OFFSET				0x200U
+#define XAIE_LOCK_VALUE_MASK				0x7FU
+#define XAIE_LOCK_VALUE_SHIFT				2U
+#define XAIE_LOCK_RESULT_MASK				0x1U
+
+/* DMA registers, layout of channel control and status is common to tiles */
+#define XAIE_DMA_BD_IDX_OFFSET				0x20U
+#define XAIE_DMA_CH_IDX_OFFSET				0x8U
+#define XAIE_DMA_STATUS_CH_IDX_OFFSET			0x4U
+#define XAIE_DMA_ADDR_ALIGN_SHIFT			2U
+#define XAIE_DMA_LEN_SHIFT				2U
+
+#define XAIE_DMA_STATUS_TASK_QUEUE_SIZE_LSB		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_TASK_QUEUE_SIZE_LSB
+#define XAIE_DMA_STATUS_TASK_QUEUE_SIZE_MASK		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_TASK_QUEUE_SIZE_MASK
+#define XAIE_DMA_STATUS_BUSY_MASK			(XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_STATUS_MASK | \
+		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_STALLED_LOCK_ACQ_MASK | \
+		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_STALLED_LOCK_REL_MASK | \
+		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_STALLED_STREAM_STARVATION_MASK | \
+		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0_STALLED_TCT_OR_COUNT_FIFO_FULL_MASK)
+
+#define XAIE_MEM_MOD_DMA_BD0_REGOFF			XAIEMLGBL_MEMORY_MODULE_DMA_BD0_0
+#define XAIE_MEM_MOD_DMA_BD_ADDR_LSB			XAIEMLGBL_MEMORY_MODULE_DMA_BD0_0_BASE_ADDRESS_LSB
+#define XAIE_MEM_MOD_DMA_BD_ADDR_MASK			XAIEMLGBL_MEMORY_MODULE_DMA_BD0_0_BASE_ADDRESS_MASK
+#define XAIE_MEM_MOD_DMA_BD_LEN_LSB			XAIEMLGBL_MEMORY_MODULE_DMA_BD0_0_BUFFER_LENGTH_LSB
+#define XAIE_MEM_MOD_DMA_BD_LEN_MASK			XAIEMLGBL_MEMORY_MODULE_DMA_BD0_0_BUFFER_LENGTH_MASK
+#define XAIE_MEM_MOD_DMA_START_QUEUE_REGOFF		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_0_START_QUEUE
+#define XAIE_MEM_MOD_DMA_STATUS_REGOFF			XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_STATUS_0
+#define XAIE_MEM_MOD_DMA_STATUS_DIR_OFFSET		0x10U
+#define XAIE_MEM_MOD_DMA_NUM_CH				2U
+
+#define XAIE_MEM_TILE_DMA_BD0_REGOFF			XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_0
+#define XAIE_MEM_TILE_DMA_BD_ADDR_REGOFF		(XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_1 - \
+		XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_0)
+#define XAIE_MEM_TILE_DMA_BD_ADDR_LSB			XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_1_BASE_ADDRESS_LSB
+#define XAIE_MEM_TILE_DMA_BD_ADDR_MASK			XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_1_BASE_ADDRESS_MASK
+#define XAIE_MEM_TILE_DMA_BD_LEN_LSB			XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_0_BUFFER_LENGTH_LSB
+#define XAIE_MEM_TILE_DMA_BD_LEN_MASK			XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_0_BUFFER_LENGTH_MASK
+#define XAIE_MEM_TILE_DMA_START_QUEUE_REGOFF		XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_0_START_QUEUE
+#define XAIE_MEM_TILE_DMA_STATUS_REGOFF			XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_STATUS_0
+#define XAIE_MEM_TILE_DMA_STATUS_DIR_OFFSET		0x20U
+#define XAIE_MEM_TILE_DMA_NUM_CH			6U
+
+#define XAIE_NOC_MOD_DMA_BD0_REGOFF			XAIEMLGBL_NOC_MODULE_DMA_BD0_0
+#define XAIE_NOC_MOD_DMA_BD_ADDR_LOW_REGOFF		(XAIEMLGBL_NOC_MODULE_DMA_BD0_1 - \
+		XAIEMLGBL_NOC_MODULE_DMA_BD0_0)
+#define XAIE_NOC_MOD_DMA_BD_ADDR_LOW_MASK		XAIEMLGBL_NOC_MODULE_DMA_BD0_1_BASE_ADDRESS_LOW_MASK
+#define XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_REGOFF		(XAIEMLGBL_NOC_MODULE_DMA_BD0_2 - \
+		XAIEMLGBL_NOC_MODULE_DMA_BD0_0)
+#define XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_LSB		XAIEMLGBL_NOC_MODULE_DMA_BD0_2_BASE_ADDRESS_HIGH_LSB
+#define XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_MASK		XAIEMLGBL_NOC_MODULE_DMA_BD0_2_BASE_ADDRESS_HIGH_MASK
+#define XAIE_NOC_MOD_DMA_START_QUEUE_REGOFF		XAIEMLGBL_NOC_MODULE_DMA_S2MM_0_TASK_QUEUE
+#define XAIE_NOC_MOD_DMA_STATUS_REGOFF			XAIEMLGBL_NOC_MODULE_DMA_S2MM_STATUS_0
+#define XAIE_NOC_MOD_DMA_STATUS_DIR_OFFSET		0x8U
+#define XAIE_NOC_MOD_DMA_NUM_CH				2U
+
+/* Performance counter registers */
+#define XAIE_CORE_MOD_PERF_CNTR0_REGOFF			XAIEMLGBL_CORE_MODULE_PERFORMANCE_COUNTER0
+#define XAIE_MEM_MOD_PERF_CNTR0_REGOFF			XAIEMLGBL_MEMORY_MODULE_PERFORMANCE_COUNTER0
+#define XAIE_MEM_TILE_PERF_CNTR0_REGOFF			XAIEMLGBL_MEM_TILE_MODULE_PERFORMANCE_COUNTER0
+#define XAIE_PL_MOD_PERF_CNTR0_REGOFF			XAIEMLGBL_PL_MODULE_PERFORMANCE_COUNTER0
+#define XAIE_PERF_CNTR_IDX_OFFSET			0x4U
+
 /************************** Variable Definitions *****************************/
 /************************** Function Prototypes  *****************************/
 
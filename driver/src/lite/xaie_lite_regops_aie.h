@@ -79,10 +79,12 @@ static inline void _XAie_LSetPartIsolationAfterRst(XAie_DevInst *DevInst)
 		u32 RegVal = 0;
 
 		if(C == 0) {
-			RegVal = XAIE_TILE_CNTR_ISOLATE_WEST_MASK;
-		} else if(C == (u8)(DevInst->NumCols - 1)) {
-			RegVal = XAIE_TILE_CNTR_ISOLATE_EAST_MASK;
-		} else {
+			RegVal |= XAIE_TILE_CNTR_ISOLATE_WEST_MASK;
+		}
+		if(C == (u8)(DevInst->NumCols - 1)) {
+			RegVal |= XAIE_TILE_CNTR_ISOLATE_EAST_MASK;
+		}
+		if(RegVal == 0U) {
 			/* No isolation for tiles by default for AIE */
 			continue;
 		}
@@ -107,13 +109,17 @@ static inline void _XAie_LSetPartIsolationAfterRst(XAie_DevInst *DevInst)
 * This API initialize the memories of the partition to zero.
 *
 * @param	DevInst: Device Instance
+* @param	UsedTiles: Bitmap of the tiles to zeroize, bit
+*		Col * (XAIE_NUM_ROWS - 1) + Row - 1 for the tiles above the
+*		SHIM row. NULL for all the tiles.
 *
 * @return       XAIE_OK on success, error code on failure
 *
 * @note		Internal API only.
 *
 ******************************************************************************/
-static inline void  _XAie_LPartMemZeroInit(XAie_DevInst *DevInst)
+static inline void  _XAie_LPartMemZeroInit(XAie_DevInst *DevInst,
+		const u32 *UsedTiles)
 {
 	for(u8 C = 0; C < DevInst->NumCols; C++) {
 		/* Isolate boundrary of CORE tiles */
@@ -121,6 +127,10 @@ static inline void  _XAie_LPartMemZeroInit(XAie_DevInst *DevInst)
 			R < XAIE_NUM_ROWS; R++) {
 			u64 RegAddr;
 
+			if(!_XAie_LIsTileUsed(UsedTiles, R, C)) {
+				continue;
+			}
+
 			RegAddr = _XAie_LGetTileAddr(R, C) +
 				XAIE_CORE_MOD_PMEM_START_ADDR;
 			_XAie_LPartBlockSet32(DevInst, RegAddr, 0,
@@ -74,9 +74,10 @@ static inline void _XAie_LSetPartIsolationAfterRst(XAie_DevInst *DevInst)
 		u32 RegVal = 0;
 
 		if(C == 0) {
-			RegVal = XAIE_TILE_CNTR_ISOLATE_WEST_MASK;
-		} else if(C == (u8)(DevInst->NumCols - 1)) {
-			RegVal = XAIE_TILE_CNTR_ISOLATE_EAST_MASK;
+			RegVal |= XAIE_TILE_CNTR_ISOLATE_WEST_MASK;
+		}
+		if(C == (u8)(DevInst->NumCols - 1)) {
+			RegVal |= XAIE_TILE_CNTR_ISOLATE_EAST_MASK;
 		}
 
 		/* Isolate boundrary of SHIM tiles */
@@ -108,22 +109,30 @@ static inline void _XAie_LSetPartIsolationAfterRst(XAie_DevInst *DevInst)
 * This API initialize the memories of the partition to zero.
 *
 * @param	DevInst: Device Instance
+* @param	UsedTiles: Bitmap of the tiles to zeroize, bit
+*		Col * (XAIE_NUM_ROWS - 1) + Row - 1 for the tiles above the
+*		SHIM row. NULL for all the tiles.
 *
 * @return       XAIE_OK on success, error code on failure
 *
 * @note		Internal API only.
 *
 ******************************************************************************/
-static inline void  _XAie_LPartMemZeroInit(XAie_DevInst *DevInst)
+static inline void  _XAie_LPartMemZeroInit(XAie_DevInst *DevInst,
+		const u32 *UsedTiles)
 {
-	u64 RegAddr;
+	u64 RegAddr, MemTileAddr = 0U, MemModAddr = 0U;
 
 	for(u8 C = 0; C < DevInst->NumCols; C++) {
 		for (u8 R = XAIE_MEM_TILE_ROW_START;
 			R < XAIE_AIE_TILE_ROW_START; R++) {
-			RegAddr = _XAie_LGetTileAddr(R, C) +
+			if(!_XAie_LIsTileUsed(UsedTiles, R, C)) {
+				continue;
+			}
+
+			MemTileAddr = _XAie_LGetTileAddr(R, C) +
 				XAIE_MEM_TILE_MOD_MEM_CNTR_REGOFF;
-			_XAie_LPartMaskWrite32(DevInst, RegAddr,
+			_XAie_LPartMaskWrite32(DevInst, MemTileAddr,
 				XAIE_MEM_TILE_MEM_CNTR_ZEROISATION_MASK,
 				XAIE_MEM_TILE_MEM_CNTR_ZEROISATION_MASK);
 		}
@@ -131,32 +140,33 @@ static inline void  _XAie_LPartMemZeroInit(XAie_DevInst *DevInst)
 		/* Isolate boundrary of CORE tiles */
 		for (u8 R = XAIE_AIE_TILE_ROW_START;
 			R < XAIE_NUM_ROWS; R++) {
+			if(!_XAie_LIsTileUsed(UsedTiles, R, C)) {
+				continue;
+			}
+
 			RegAddr = _XAie_LGetTileAddr(R, C) +
 				XAIE_CORE_MOD_MEM_CNTR_REGOFF;
 			_XAie_LPartMaskWrite32(DevInst, RegAddr,
 				XAIE_CORE_MOD_MEM_CNTR_ZEROISATION_MASK,
 				XAIE_CORE_MOD_MEM_CNTR_ZEROISATION_MASK);
-			RegAddr = _XAie_LGetTileAddr(R, C) +
+			MemModAddr = _XAie_LGetTileAddr(R, C) +
 				XAIE_MEM_MOD_MEM_CNTR_REGOFF;
-			_XAie_LPartMaskWrite32(DevInst, RegAddr,
+			_XAie_LPartMaskWrite32(DevInst, MemModAddr,
 				XAIE_MEM_MOD_MEM_CNTR_ZEROISATION_MASK,
 				XAIE_MEM_MOD_MEM_CNTR_ZEROISATION_MASK);
 		}
 	}
 
-	/* Poll last mem module and last mem tile mem module */
-	RegAddr = _XAie_LGetTileAddr(XAIE_NUM_ROWS - 1,
-			DevInst->NumCols - 1) +
-			XAIE_MEM_MOD_MEM_CNTR_REGOFF;
-	_XAie_LPartPoll32(DevInst, RegAddr,
-			XAIE_MEM_MOD_MEM_CNTR_ZEROISATION_MASK, 0, 800);
-
-	RegAddr = _XAie_LGetTileAddr(XAIE_AIE_TILE_ROW_START - 1,
-			DevInst->NumCols - 1) +
-			XAIE_MEM_TILE_MOD_MEM_CNTR_REGOFF;
-	_XAie_LPartPoll32(DevInst, RegAddr,
-			XAIE_MEM_TILE_MEM_CNTR_ZEROISATION_MASK, 0, 800);
+	/* Poll last zeroized mem module and mem tile mem module */
+	if(MemModAddr != 0U) {
+		_XAie_LPartPoll32(DevInst, MemModAddr,
+				XAIE_MEM_MOD_MEM_CNTR_ZEROISATION_MASK, 0, 800);
+	}
 
+	if(MemTileAddr != 0U) {
+		_XAie_LPartPoll32(DevInst, MemTileAddr,
+				XAIE_MEM_TILE_MEM_CNTR_ZEROISATION_MASK, 0, 800);
+	}
 }
 
 /*****************************************************************************/
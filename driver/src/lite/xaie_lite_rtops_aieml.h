@@ -0,0 +1,370 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_lite_rtops_aieml.h
+* @{
+*
+* This header file defines a lightweight version of the AIEML runtime
+* operations used in per-iteration control loops: buffer descriptor address
+* and length updates, DMA queue push and pending BD count, lock acquire and
+* release, and performance counter reads. The APIs do not validate their
+* arguments and do not use any device instance indirection apart from the
+* partition base address.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   Wendy   10/15/2022  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIE_LITE_RTOPS_AIEML_H
+#define XAIE_LITE_RTOPS_AIEML_H
+
+/***************************** Include Files *********************************/
+#include "xaie_lite_io.h"
+
+/************************** Constant Definitions *****************************/
+/************************** Variable Definitions *****************************/
+/************************** Function Prototypes  *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This API returns the register offset of a buffer descriptor in a tile.
+*
+* @param	Loc: Location of the tile in the partition.
+* @param	BdNum: Hardware BD number.
+*
+* @return	Register offset of the first word of the BD.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline u64 _XAie_LDmaGetBdRegOff(XAie_LocType Loc, u8 BdNum)
+{
+	u64 RegOff = _XAie_LGetTileAddr(Loc.Row, Loc.Col) +
+		BdNum * XAIE_DMA_BD_IDX_OFFSET;
+
+	if(Loc.Row == XAIE_SHIM_ROW) {
+		return RegOff + XAIE_NOC_MOD_DMA_BD0_REGOFF;
+	} else if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		return RegOff + XAIE_MEM_TILE_DMA_BD0_REGOFF;
+	}
+
+	return RegOff + XAIE_MEM_MOD_DMA_BD0_REGOFF;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API updates the buffer address of a buffer descriptor in hardware.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile in the partition.
+* @param	Addr: Buffer address in bytes.
+* @param	BdNum: Hardware BD number.
+*
+* @return	None.
+*
+* @note		The address is not checked for alignment or range.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline void XAie_LDmaUpdateBdAddr(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u64 Addr, u8 BdNum)
+{
+	u64 RegAddr = _XAie_LDmaGetBdRegOff(Loc, BdNum);
+
+	if(Loc.Row == XAIE_SHIM_ROW) {
+		/* Addrlow maps to a single register without other fields. */
+		_XAie_LPartWrite32(DevInst,
+			RegAddr + XAIE_NOC_MOD_DMA_BD_ADDR_LOW_REGOFF,
+			(u32)Addr & XAIE_NOC_MOD_DMA_BD_ADDR_LOW_MASK);
+		_XAie_LPartMaskWrite32(DevInst,
+			RegAddr + XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_REGOFF,
+			XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_MASK,
+			XAie_SetField(Addr >> 32U,
+				XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_LSB,
+				XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_MASK));
+	} else if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		_XAie_LPartMaskWrite32(DevInst,
+			RegAddr + XAIE_MEM_TILE_DMA_BD_ADDR_REGOFF,
+			XAIE_MEM_TILE_DMA_BD_ADDR_MASK,
+			XAie_SetField(Addr >> XAIE_DMA_ADDR_ALIGN_SHIFT,
+				XAIE_MEM_TILE_DMA_BD_ADDR_LSB,
+				XAIE_MEM_TILE_DMA_BD_ADDR_MASK));
+	} else {
+		_XAie_LPartMaskWrite32(DevInst, RegAddr,
+			XAIE_MEM_MOD_DMA_BD_ADDR_MASK,
+			XAie_SetField(Addr >> XAIE_DMA_ADDR_ALIGN_SHIFT,
+				XAIE_MEM_MOD_DMA_BD_ADDR_LSB,
+				XAIE_MEM_MOD_DMA_BD_ADDR_MASK));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API updates the buffer length of a buffer descriptor in hardware.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile in the partition.
+* @param	Len: Length of the buffer in bytes.
+* @param	BdNum: Hardware BD number.
+*
+* @return	None.
+*
+* @note		The length is not checked against the BD length field width.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline void XAie_LDmaUpdateBdLen(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u32 Len, u8 BdNum)
+{
+	u64 RegAddr = _XAie_LDmaGetBdRegOff(Loc, BdNum);
+	u32 Words = Len >> XAIE_DMA_LEN_SHIFT;
+
+	if(Loc.Row == XAIE_SHIM_ROW) {
+		/* BD length register does not have other parameters */
+		_XAie_LPartWrite32(DevInst, RegAddr, Words);
+	} else if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		_XAie_LPartMaskWrite32(DevInst, RegAddr,
+			XAIE_MEM_TILE_DMA_BD_LEN_MASK,
+			XAie_SetField(Words, XAIE_MEM_TILE_DMA_BD_LEN_LSB,
+				XAIE_MEM_TILE_DMA_BD_LEN_MASK));
+	} else {
+		_XAie_LPartMaskWrite32(DevInst, RegAddr,
+			XAIE_MEM_MOD_DMA_BD_LEN_MASK,
+			XAie_SetField(Words, XAIE_MEM_MOD_DMA_BD_LEN_LSB,
+				XAIE_MEM_MOD_DMA_BD_LEN_MASK));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API pushes a buffer descriptor to the start queue of a DMA channel.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile in the partition.
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA channel, DMA_S2MM or DMA_MM2S.
+* @param	BdNum: Hardware BD number to be pushed to the queue.
+*
+* @return	None.
+*
+* @note		The queue is not checked for free entries.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline void XAie_LDmaChannelPushBdToQueue(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u8 ChNum, XAie_DmaDirection Dir, u8 BdNum)
+{
+	u64 RegAddr = _XAie_LGetTileAddr(Loc.Row, Loc.Col);
+
+	if(Loc.Row == XAIE_SHIM_ROW) {
+		RegAddr += XAIE_NOC_MOD_DMA_START_QUEUE_REGOFF +
+			(ChNum + Dir * XAIE_NOC_MOD_DMA_NUM_CH) *
+			XAIE_DMA_CH_IDX_OFFSET;
+	} else if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		RegAddr += XAIE_MEM_TILE_DMA_START_QUEUE_REGOFF +
+			(ChNum + Dir * XAIE_MEM_TILE_DMA_NUM_CH) *
+			XAIE_DMA_CH_IDX_OFFSET;
+	} else {
+		RegAddr += XAIE_MEM_MOD_DMA_START_QUEUE_REGOFF +
+			(ChNum + Dir * XAIE_MEM_MOD_DMA_NUM_CH) *
+			XAIE_DMA_CH_IDX_OFFSET;
+	}
+
+	_XAie_LPartWrite32(DevInst, RegAddr, BdNum);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the number of buffer descriptors pending on a DMA channel,
+* which includes the BD currently being processed by the channel.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile in the partition.
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA channel, DMA_S2MM or DMA_MM2S.
+*
+* @return	Number of pending BDs.
+*
+* @note		None.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline u8 XAie_LDmaGetPendingBdCount(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u8 ChNum, XAie_DmaDirection Dir)
+{
+	u64 RegAddr = _XAie_LGetTileAddr(Loc.Row, Loc.Col) +
+		ChNum * XAIE_DMA_STATUS_CH_IDX_OFFSET;
+	u32 RegVal;
+	u8 PendingBd;
+
+	if(Loc.Row == XAIE_SHIM_ROW) {
+		RegAddr += XAIE_NOC_MOD_DMA_STATUS_REGOFF +
+			Dir * XAIE_NOC_MOD_DMA_STATUS_DIR_OFFSET;
+	} else if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		RegAddr += XAIE_MEM_TILE_DMA_STATUS_REGOFF +
+			Dir * XAIE_MEM_TILE_DMA_STATUS_DIR_OFFSET;
+	} else {
+		RegAddr += XAIE_MEM_MOD_DMA_STATUS_REGOFF +
+			Dir * XAIE_MEM_MOD_DMA_STATUS_DIR_OFFSET;
+	}
+
+	RegVal = _XAie_LPartRead32(DevInst, RegAddr);
+	PendingBd = (u8)XAie_GetField(RegVal,
+			XAIE_DMA_STATUS_TASK_QUEUE_SIZE_LSB,
+			XAIE_DMA_STATUS_TASK_QUEUE_SIZE_MASK);
+
+	/* Check if BD is being used by a channel */
+	if(RegVal & XAIE_DMA_STATUS_BUSY_MASK) {
+		PendingBd++;
+	}
+
+	return PendingBd;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the register offset of a lock request in a tile.
+*
+* @param	Loc: Location of the tile in the partition.
+* @param	Lock: Lock with the lock id and the lock value.
+*
+* @return	Register offset of the lock request.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline u64 _XAie_LLockGetRegOff(XAie_LocType Loc, XAie_Lock Lock)
+{
+	u64 RegOff = _XAie_LGetTileAddr(Loc.Row, Loc.Col) +
+		Lock.LockId * XAIE_LOCK_ID_OFFSET +
+		(((u32)Lock.LockVal & XAIE_LOCK_VALUE_MASK) <<
+		 XAIE_LOCK_VALUE_SHIFT);
+
+	if(Loc.Row == XAIE_SHIM_ROW) {
+		return RegOff + XAIE_NOC_MOD_LOCK_REQUEST_REGOFF;
+	} else if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		return RegOff + XAIE_MEM_TILE_LOCK_REQUEST_REGOFF;
+	}
+
+	return RegOff + XAIE_MEM_MOD_LOCK_REQUEST_REGOFF;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acquires a lock with the lock value. It polls the lock request
+* result until the lock is acquired or the timeout expires.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile in the partition.
+* @param	Lock: Lock with the lock id and the lock value.
+* @param	TimeOut: Timeout value in micro seconds.
+*
+* @return	XAIE_OK if the lock is acquired, XAIE_LOCK_RESULT_FAILED on
+*		timeout.
+*
+* @note		None.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline AieRC XAie_LLockAcquire(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_Lock Lock, u32 TimeOut)
+{
+	u64 RegAddr = _XAie_LLockGetRegOff(Loc, Lock) + XAIE_LOCK_ACQ_OFFSET;
+
+	if(_XAie_LPartPoll32(DevInst, RegAddr, XAIE_LOCK_RESULT_MASK,
+				XAIE_LOCK_RESULT_MASK, TimeOut) != 0U) {
+		return XAIE_LOCK_RESULT_FAILED;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases a lock with the lock value. It polls the lock request
+* result until the lock is released or the timeout expires.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile in the partition.
+* @param	Lock: Lock with the lock id and the lock value.
+* @param	TimeOut: Timeout value in micro seconds.
+*
+* @return	XAIE_OK if the lock is released, XAIE_LOCK_RESULT_FAILED on
+*		timeout.
+*
+* @note		None.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline AieRC XAie_LLockRelease(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_Lock Lock, u32 TimeOut)
+{
+	u64 RegAddr = _XAie_LLockGetRegOff(Loc, Lock);
+
+	if(_XAie_LPartPoll32(DevInst, RegAddr, XAIE_LOCK_RESULT_MASK,
+				XAIE_LOCK_RESULT_MASK, TimeOut) != 0U) {
+		return XAIE_LOCK_RESULT_FAILED;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads the value of a performance counter.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile in the partition.
+* @param	Module: Module of the tile. XAIE_CORE_MOD or XAIE_MEM_MOD for AIE
+*		tiles, XAIE_MEM_MOD for memory tiles and XAIE_PL_MOD for shim
+*		tiles.
+* @param	Counter: Performance counter number.
+*
+* @return	Value of the performance counter.
+*
+* @note		None.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline u32 XAie_LPerfCounterGet(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, u8 Counter)
+{
+	u64 RegAddr = _XAie_LGetTileAddr(Loc.Row, Loc.Col) +
+		Counter * XAIE_PERF_CNTR_IDX_OFFSET;
+
+	if(Module == XAIE_PL_MOD) {
+		RegAddr += XAIE_PL_MOD_PERF_CNTR0_REGOFF;
+	} else if(Module == XAIE_CORE_MOD) {
+		RegAddr += XAIE_CORE_MOD_PERF_CNTR0_REGOFF;
+	} else if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		RegAddr += XAIE_MEM_TILE_PERF_CNTR0_REGOFF;
+	} else {
+		RegAddr += XAIE_MEM_MOD_PERF_CNTR0_REGOFF;
+	}
+
+	return _XAie_LPartRead32(DevInst, RegAddr);
+}
+
+#endif		/* end of protection macro */
+/** @} */
@@ -22,6 +22,8 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_locks.h"
@@ -29,6 +31,11 @@
 
 #ifdef XAIE_FEATURE_LOCK_ENABLE
 /************************** Constant Definitions *****************************/
+#define XAIE_LOCK_MULTI_SLICE_US	100U
+
+#define XAIE_LOCK_OP_ACQUIRE		0U
+#define XAIE_LOCK_OP_RELEASE		1U
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -65,7 +72,7 @@ AieRC XAie_LockAcquire(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -122,7 +129,7 @@ AieRC XAie_LockRelease(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -144,6 +151,96 @@ AieRC XAie_LockRelease(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 	return LockMod->Release(DevInst, LockMod, Loc, Lock, TimeOut);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API gets the lock module of a tile for the unchecked lock APIs.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Lock: Lock data structure with LockId and LockValue.
+*
+* @return	Pointer to the lock module.
+*
+* @note		Internal only. The arguments are only checked by debug builds.
+*
+******************************************************************************/
+static inline const XAie_LockMod *_XAie_LockGetModFast(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_Lock Lock)
+{
+	const XAie_LockMod *LockMod;
+	u8 TileType;
+
+	XAIE_ASSERT((DevInst != XAIE_NULL) &&
+			(DevInst->IsReady == XAIE_COMPONENT_IS_READY));
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	XAIE_ASSERT((TileType != XAIEGBL_TILE_TYPE_SHIMPL) &&
+			(TileType != XAIEGBL_TILE_TYPE_MAX));
+
+	LockMod = DevInst->DevProp.DevMod[TileType].LockMod;
+	XAIE_ASSERT(Lock.LockId <= LockMod->NumLocks);
+	XAIE_ASSERT((Lock.LockVal <= LockMod->LockValUpperBound) &&
+			(Lock.LockVal >= LockMod->LockValLowerBound));
+	(void)Lock;
+
+	return LockMod;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acquires a lock like XAie_LockAcquire() without validating the
+* arguments. It is meant for hot loops over locks which the caller has already
+* validated, for example with a call to XAie_LockAcquire().
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Lock: Lock data structure with LockId and LockValue.
+* @param	TimeOut: Timeout value for which the acquire request needs to be
+*		repeated. Value in usecs.
+*
+* @return	XAIE_OK if Lock Acquired, else XAIE_LOCK_RESULT_FAILED.
+*
+* @note		Invalid arguments are undefined behavior. Builds with
+*		XAIE_DEBUG check the arguments and abort on invalid ones.
+*
+******************************************************************************/
+AieRC XAie_LockAcquireFast(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_Lock Lock, u32 TimeOut)
+{
+	const XAie_LockMod *LockMod = _XAie_LockGetModFast(DevInst, Loc, Lock);
+
+	return LockMod->Acquire(DevInst, LockMod, Loc, Lock, TimeOut);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases a lock like XAie_LockRelease() without validating the
+* arguments. It is meant for hot loops over locks which the caller has already
+* validated, for example with a call to XAie_LockRelease().
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Lock: Lock data structure with LockId and LockValue.
+* @param	TimeOut: Timeout value for which the release request needs to be
+*		repeated. Value in usecs.
+*
+* @return	XAIE_OK if Lock Release, else XAIE_LOCK_RESULT_FAILED.
+*
+* @note		Invalid arguments are undefined behavior. Builds with
+*		XAIE_DEBUG check the arguments and abort on invalid ones.
+*
+******************************************************************************/
+AieRC XAie_LockReleaseFast(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_Lock Lock, u32 TimeOut)
+{
+	const XAie_LockMod *LockMod = _XAie_LockGetModFast(DevInst, Loc, Lock);
+
+	return LockMod->Release(DevInst, LockMod, Loc, Lock, TimeOut);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -169,7 +266,7 @@ AieRC XAie_LockSetValue(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock)
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -185,5 +282,671 @@ AieRC XAie_LockSetValue(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock)
 	return LockMod->SetValue(DevInst, LockMod, Loc, Lock);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API validates an array of lock requests.
+*
+* @param	DevInst: Device Instance
+* @param	Reqs: Array of lock requests.
+* @param	NumReqs: Number of requests in Reqs.
+* @param	CheckVal: XAIE_ENABLE to check the lock values against the
+*		bounds of the lock module, XAIE_DISABLE otherwise.
+*
+* @return	XAIE_OK if all the requests are valid, else error code.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_LockCheckReqs(XAie_DevInst *DevInst,
+		const XAie_LockReq *Reqs, u32 NumReqs, u8 CheckVal)
+{
+	u8 TileType;
+	const XAie_LockMod *LockMod;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Reqs == NULL) || (NumReqs == 0U)) {
+		XAIE_ERROR("Invalid lock request array\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumReqs; i++) {
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				Reqs[i].Loc);
+		if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
+				(TileType == XAIEGBL_TILE_TYPE_MAX)) {
+			XAIE_ERROR("Invalid Tile Type (%d, %d)\n",
+					Reqs[i].Loc.Col, Reqs[i].Loc.Row);
+			return XAIE_INVALID_TILE;
+		}
+
+		LockMod = DevInst->DevProp.DevMod[TileType].LockMod;
+		if(Reqs[i].Lock.LockId >= LockMod->NumLocks) {
+			XAIE_ERROR("Invalid Lock Id\n");
+			return XAIE_INVALID_LOCK_ID;
+		}
+
+		if((CheckVal == XAIE_ENABLE) &&
+				((Reqs[i].Lock.LockVal >
+				  LockMod->LockValUpperBound) ||
+				 (Reqs[i].Lock.LockVal <
+				  LockMod->LockValLowerBound))) {
+			XAIE_ERROR("Lock value out of range\n");
+			return XAIE_INVALID_LOCK_VALUE;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API issues one lock acquire or release request.
+*
+* @param	DevInst: Device Instance
+* @param	Req: Lock request.
+* @param	Op: XAIE_LOCK_OP_ACQUIRE or XAIE_LOCK_OP_RELEASE.
+* @param	TimeOut: Timeout value in usecs.
+*
+* @return	XAIE_OK if the request succeeded, else XAIE_LOCK_RESULT_FAILED.
+*
+* @note		Internal only. The request must have been validated.
+*
+******************************************************************************/
+static AieRC _XAie_LockOp(XAie_DevInst *DevInst, const XAie_LockReq *Req,
+		u8 Op, u32 TimeOut)
+{
+	const XAie_LockMod *LockMod;
+
+	LockMod = DevInst->DevProp.DevMod[_XAie_DevGetTTypefromLoc(
+			DevInst, Req->Loc)].LockMod;
+
+	if(Op == XAIE_LOCK_OP_ACQUIRE) {
+		return LockMod->Acquire(DevInst, LockMod, Req->Loc, Req->Lock,
+				TimeOut);
+	}
+
+	return LockMod->Release(DevInst, LockMod, Req->Loc, Req->Lock,
+			TimeOut);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acquires or releases an array of locks. Each sweep issues one
+* request for every pending lock, so the locks which are available are taken
+* right away instead of after the timeouts of the locks before them. Between
+* two sweeps, the first pending lock is retried for a short time.
+*
+* @param	DevInst: Device Instance
+* @param	Reqs: Array of lock requests.
+* @param	NumReqs: Number of requests in Reqs.
+* @param	Done: Optional array of NumReqs entries. NULL if not required.
+* @param	TimeOut: Timeout value in usecs.
+* @param	Op: XAIE_LOCK_OP_ACQUIRE or XAIE_LOCK_OP_RELEASE.
+*
+* @return	XAIE_OK if all the requests succeeded, else error code.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_LockOpMulti(XAie_DevInst *DevInst,
+		const XAie_LockReq *Reqs, u32 NumReqs, u8 *Done, u32 TimeOut,
+		u8 Op)
+{
+	AieRC RC;
+	u8 *Status;
+	u32 NumDone = 0U, Pending = 0U;
+	u64 ElapsedUs = 0U;
+
+	RC = _XAie_LockCheckReqs(DevInst, Reqs, NumReqs, XAIE_ENABLE);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Status = (u8 *)calloc(NumReqs, sizeof(*Status));
+	if(Status == NULL) {
+		XAIE_ERROR("Memory allocation for lock status failed\n");
+		return XAIE_ERR;
+	}
+
+	/* Polls are recorded one by one in a transaction */
+	if(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE) {
+		for(u32 i = 0U; i < NumReqs; i++) {
+			RC = _XAie_LockOp(DevInst, &Reqs[i], Op, TimeOut);
+			if(RC != XAIE_OK) {
+				break;
+			}
+			Status[i] = 1U;
+		}
+	} else {
+		while(1) {
+			for(u32 i = 0U; i < NumReqs; i++) {
+				if(Status[i] != 0U) {
+					continue;
+				}
+
+				if(_XAie_LockOp(DevInst, &Reqs[i], Op, 0U) ==
+						XAIE_OK) {
+					Status[i] = 1U;
+					NumDone++;
+				}
+			}
+
+			if(NumDone == NumReqs) {
+				RC = XAIE_OK;
+				break;
+			}
+
+			if(ElapsedUs >= TimeOut) {
+				RC = XAIE_LOCK_RESULT_FAILED;
+				break;
+			}
+
+			while(Status[Pending] != 0U) {
+				Pending++;
+			}
+
+			/* Only the slices which time out are accounted */
+			if(_XAie_LockOp(DevInst, &Reqs[Pending], Op,
+						XAIE_LOCK_MULTI_SLICE_US) ==
+					XAIE_OK) {
+				Status[Pending] = 1U;
+				NumDone++;
+			} else {
+				ElapsedUs += XAIE_LOCK_MULTI_SLICE_US;
+			}
+		}
+	}
+
+	if(Done != NULL) {
+		for(u32 i = 0U; i < NumReqs; i++) {
+			Done[i] = Status[i] ? XAIE_ENABLE : XAIE_DISABLE;
+		}
+	}
+
+	free(Status);
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API is used to acquire an array of locks, which can be spread over
+* several tiles. All the requests are validated before any lock is acquired.
+* The pending locks are requested in sweeps until all of them are acquired or
+* the API times out.
+*
+* @param	DevInst: Device Instance
+* @param	Reqs: Array of lock requests with the location, LockId and
+*		LockValue of each lock.
+* @param	NumReqs: Number of requests in Reqs.
+* @param	Done: Optional array of NumReqs entries to return XAIE_ENABLE for
+*		the locks acquired and XAIE_DISABLE for the others. NULL if not
+*		required.
+* @param	TimeOut: Timeout value for which the acquire requests need to be
+*		repeated. Value in usecs.
+*
+* @return	XAIE_OK if all the locks are acquired, XAIE_LOCK_RESULT_FAILED
+*		on timeout, else error code.
+*
+* @note		On timeout, the locks already acquired are not released. Use
+*		Done to release them if needed.
+*
+******************************************************************************/
+AieRC XAie_LockAcquireMulti(XAie_DevInst *DevInst, const XAie_LockReq *Reqs,
+		u32 NumReqs, u8 *Done, u32 TimeOut)
+{
+	return _XAie_LockOpMulti(DevInst, Reqs, NumReqs, Done, TimeOut,
+			XAIE_LOCK_OP_ACQUIRE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API is used to release an array of locks, which can be spread over
+* several tiles. All the requests are validated before any lock is released.
+* The pending locks are requested in sweeps until all of them are released or
+* the API times out.
+*
+* @param	DevInst: Device Instance
+* @param	Reqs: Array of lock requests with the location, LockId and
+*		LockValue of each lock.
+* @param	NumReqs: Number of requests in Reqs.
+* @param	Done: Optional array of NumReqs entries to return XAIE_ENABLE for
+*		the locks released and XAIE_DISABLE for the others. NULL if not
+*		required.
+* @param	TimeOut: Timeout value for which the release requests need to be
+*		repeated. Value in usecs.
+*
+* @return	XAIE_OK if all the locks are released, XAIE_LOCK_RESULT_FAILED
+*		on timeout, else error code.
+*
+* @note 	None.
+*
+******************************************************************************/
+AieRC XAie_LockReleaseMulti(XAie_DevInst *DevInst, const XAie_LockReq *Reqs,
+		u32 NumReqs, u8 *Done, u32 TimeOut)
+{
+	return _XAie_LockOpMulti(DevInst, Reqs, NumReqs, Done, TimeOut,
+			XAIE_LOCK_OP_RELEASE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API is used to initialize an array of locks, which can be spread over
+* several tiles. All the requests are validated first and the writes are sent
+* in one batch.
+*
+* @param	DevInst: Device Instance
+* @param	Reqs: Array of lock requests with the location, LockId and
+*		initial value of each lock.
+* @param	NumReqs: Number of requests in Reqs.
+*
+* @return	XAIE_OK on success, else error code.
+*
+* @note 	If the calling thread has a transaction open, the writes are
+*		recorded into it.
+*
+******************************************************************************/
+AieRC XAie_LockSetValueMulti(XAie_DevInst *DevInst, const XAie_LockReq *Reqs,
+		u32 NumReqs)
+{
+	AieRC RC;
+	u8 OwnTxn = XAIE_DISABLE;
+	const XAie_LockMod *LockMod;
+
+	RC = _XAie_LockCheckReqs(DevInst, Reqs, NumReqs, XAIE_DISABLE);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	for(u32 i = 0U; i < NumReqs; i++) {
+		LockMod = DevInst->DevProp.DevMod[
+			_XAie_DevGetTTypefromLoc(DevInst,
+					Reqs[i].Loc)].LockMod;
+
+		RC = LockMod->SetValue(DevInst, LockMod, Reqs[i].Loc,
+				Reqs[i].Lock);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Lock set value failed for tile (%d, %d)\n",
+					Reqs[i].Loc.Col, Reqs[i].Loc.Row);
+			break;
+		}
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads the values of all the locks of a tile in one block read.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @param	LockMod: Lock module of the tile.
+* @param	Values: Array of LockMod->NumLocks entries to return the values.
+*
+* @return	XAIE_OK on success, else error code.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_LockReadValues(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_LockMod *LockMod, u8 *Values)
+{
+	AieRC RC;
+	u32 *Regs, Stride, NumWords;
+	u64 RegAddr;
+
+	Stride = LockMod->LockSetValOff / 4U;
+	NumWords = (LockMod->NumLocks - 1U) * Stride + 1U;
+	RegAddr = LockMod->LockSetValBase +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	Regs = (u32 *)malloc(NumWords * sizeof(*Regs));
+	if(Regs == NULL) {
+		XAIE_ERROR("Memory allocation for lock values failed\n");
+		return XAIE_ERR;
+	}
+
+	RC = XAie_BlockRead32(DevInst, RegAddr, Regs, NumWords);
+	if(RC == XAIE_OK) {
+		for(u32 i = 0U; i < LockMod->NumLocks; i++) {
+			Values[i] = (u8)XAie_GetField(Regs[i * Stride],
+					LockMod->LockInit->Lsb,
+					LockMod->LockInit->Mask);
+		}
+	} else {
+		XAIE_ERROR("Unable to read lock values of tile (%d, %d)\n",
+				Loc.Col, Loc.Row);
+	}
+
+	free(Regs);
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns a snapshot of the values of all the locks of a tile. The
+* lock value registers are read in one burst.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @param	Values: Array to return the value of each lock, indexed by
+*		LockId. NULL to only query the number of locks.
+* @param	NumValues: Pointer to the size of Values, updated with the
+*		number of locks of the tile.
+*
+* @return	XAIE_OK on success, else error code.
+*
+* @note		The lock values cannot be read back on AIE. The locks may be
+*		acquired or released while the burst is read, so the snapshot
+*		is only consistent if the locks are not in use.
+*
+******************************************************************************/
+AieRC XAie_LockGetValues(XAie_DevInst *DevInst, XAie_LocType Loc, u8 *Values,
+		u32 *NumValues)
+{
+	u8 TileType;
+	const XAie_LockMod *LockMod;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(NumValues == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
+			(TileType == XAIEGBL_TILE_TYPE_MAX)) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	LockMod = DevInst->DevProp.DevMod[TileType].LockMod;
+	if(LockMod->LockInit == NULL) {
+		XAIE_ERROR("Lock values cannot be read on this device\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	if(Values != NULL) {
+		if(*NumValues < LockMod->NumLocks) {
+			XAIE_ERROR("Lock value array is too small\n");
+			return XAIE_INVALID_ARGS;
+		}
+
+		*NumValues = LockMod->NumLocks;
+		return _XAie_LockReadValues(DevInst, Loc, LockMod, Values);
+	}
+
+	*NumValues = LockMod->NumLocks;
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns a snapshot of the values of all the locks of a column. The
+* lock value registers are read in one burst per tile, from the bottom row to
+* the top row. Tiles without locks are skipped.
+*
+* @param	DevInst: Device Instance
+* @param	Col: Column of the partition.
+* @param	Values: Array to return the values of the locks of all the tiles
+*		of the column, one tile after the other. NULL to only query the
+*		number of locks.
+* @param	NumValues: Pointer to the size of Values, updated with the
+*		number of locks of the column.
+* @param	RowOff: Optional array of DevInst->NumRows entries to return the
+*		index in Values of the first lock of each row. Rows without
+*		locks get the index of the next row. NULL if not required.
+*
+* @return	XAIE_OK on success, else error code.
+*
+* @note		The lock values cannot be read back on AIE.
+*
+******************************************************************************/
+AieRC XAie_LockGetColValues(XAie_DevInst *DevInst, u8 Col, u8 *Values,
+		u32 *NumValues, u32 *RowOff)
+{
+	AieRC RC;
+	u8 TileType;
+	u32 Total = 0U;
+	const XAie_LockMod *LockMod;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((NumValues == NULL) || (Col >= DevInst->NumCols)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u8 Row = 0U; Row < DevInst->NumRows; Row++) {
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				XAie_TileLoc(Col, Row));
+		if(RowOff != NULL) {
+			RowOff[Row] = Total;
+		}
+		if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
+				(TileType == XAIEGBL_TILE_TYPE_MAX)) {
+			continue;
+		}
+
+		LockMod = DevInst->DevProp.DevMod[TileType].LockMod;
+		if(LockMod->LockInit == NULL) {
+			XAIE_ERROR("Lock values cannot be read on this device\n");
+			return XAIE_FEATURE_NOT_SUPPORTED;
+		}
+		Total += LockMod->NumLocks;
+	}
+
+	if(Values == NULL) {
+		*NumValues = Total;
+		return XAIE_OK;
+	}
+
+	if(*NumValues < Total) {
+		XAIE_ERROR("Lock value array is too small\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	*NumValues = Total;
+	Total = 0U;
+	for(u8 Row = 0U; Row < DevInst->NumRows; Row++) {
+		XAie_LocType Loc = XAie_TileLoc(Col, Row);
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+		if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
+				(TileType == XAIEGBL_TILE_TYPE_MAX)) {
+			continue;
+		}
+
+		LockMod = DevInst->DevProp.DevMod[TileType].LockMod;
+		RC = _XAie_LockReadValues(DevInst, Loc, LockMod,
+				&Values[Total]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		Total += LockMod->NumLocks;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the lock module of a tile which supports lock event
+* selections.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @param	LockMod: Pointer to return the lock module.
+*
+* @return	XAIE_OK on success, else error code.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_LockGetEventSelMod(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_LockMod **LockMod)
+{
+	u8 TileType;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
+			(TileType == XAIEGBL_TILE_TYPE_MAX)) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	*LockMod = DevInst->DevProp.DevMod[TileType].LockMod;
+	if((*LockMod)->NumEventSels == 0U) {
+		XAIE_ERROR("Lock event selection is not supported\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the number of lock event selections of a tile. Each
+* selection generates the acquire, release and equal to value events of one
+* lock of the tile.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @param	NumSels: Pointer to return the number of lock event selections.
+*
+* @return	XAIE_OK on success, else error code.
+*
+* @note		The lock events are not selectable on AIE, each lock has its
+*		own acquire and release events.
+*
+******************************************************************************/
+AieRC XAie_LockGetNumEventSels(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u8 *NumSels)
+{
+	AieRC RC;
+	const XAie_LockMod *LockMod;
+
+	if(NumSels == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_LockGetEventSelMod(DevInst, Loc, &LockMod);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	*NumSels = LockMod->NumEventSels;
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API selects the lock of a lock event selection. The lock events of the
+* selection are then generated for the operations on that lock.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @param	Sel: Lock event selection.
+* @param	LockId: Lock to generate the events for.
+* @param	Value: Lock value for the equal to value event of the selection.
+*
+* @return	XAIE_OK on success, else error code.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_LockEventSelect(XAie_DevInst *DevInst, XAie_LocType Loc, u8 Sel,
+		u8 LockId, u8 Value)
+{
+	AieRC RC;
+	u32 RegVal;
+	u64 RegAddr;
+	const XAie_LockMod *LockMod;
+
+	RC = _XAie_LockGetEventSelMod(DevInst, Loc, &LockMod);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Sel >= LockMod->NumEventSels) {
+		XAIE_ERROR("Invalid lock event selection\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(LockId >= LockMod->NumLocks) {
+		XAIE_ERROR("Invalid Lock Id\n");
+		return XAIE_INVALID_LOCK_ID;
+	}
+
+	if(((u32)Value << LockMod->EventSelValue->Lsb) &
+			~LockMod->EventSelValue->Mask) {
+		XAIE_ERROR("Invalid lock value\n");
+		return XAIE_INVALID_LOCK_VALUE;
+	}
+
+	RegVal = XAie_SetField(LockId, LockMod->EventSelLock->Lsb,
+			LockMod->EventSelLock->Mask) |
+		XAie_SetField(Value, LockMod->EventSelValue->Lsb,
+			LockMod->EventSelValue->Mask);
+	RegAddr = LockMod->EventSelBase + Sel * LockMod->EventSelOff +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	return XAie_Write32(DevInst, RegAddr, RegVal);
+}
+
 #endif /* XAIE_FEATURE_LOCK_ENABLE */
 /** @} */
@@ -28,12 +28,38 @@
 #include "xaiegbl.h"
 #include "xaiegbl_defs.h"
 /**************************** Type Definitions *******************************/
+/*
+ * This typedef captures a lock of a tile for the batched lock APIs.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	XAie_Lock Lock;
+} XAie_LockReq;
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_LockAcquire(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 		u32 TimeOut);
 AieRC XAie_LockRelease(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 		u32 TimeOut);
+AieRC XAie_LockAcquireFast(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_Lock Lock, u32 TimeOut);
+AieRC XAie_LockReleaseFast(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_Lock Lock, u32 TimeOut);
 AieRC XAie_LockSetValue(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_Lock Lock);
+AieRC XAie_LockAcquireMulti(XAie_DevInst *DevInst, const XAie_LockReq *Reqs,
+		u32 NumReqs, u8 *Done, u32 TimeOut);
+AieRC XAie_LockReleaseMulti(XAie_DevInst *DevInst, const XAie_LockReq *Reqs,
+		u32 NumReqs, u8 *Done, u32 TimeOut);
+AieRC XAie_LockSetValueMulti(XAie_DevInst *DevInst, const XAie_LockReq *Reqs,
+		u32 NumReqs);
+AieRC XAie_LockGetValues(XAie_DevInst *DevInst, XAie_LocType Loc, u8 *Values,
+		u32 *NumValues);
+AieRC XAie_LockGetColValues(XAie_DevInst *DevInst, u8 Col, u8 *Values,
+		u32 *NumValues, u32 *RowOff);
+AieRC XAie_LockGetNumEventSels(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u8 *NumSels);
+AieRC XAie_LockEventSelect(XAie_DevInst *DevInst, XAie_LocType Loc, u8 Sel,
+		u8 LockId, u8 Value);
 
 #endif		/* end of protection macro */
@@ -27,7 +27,7 @@
 #include "xaie_locks.h"
 #include "xaiegbl_defs.h"
 
-#ifdef XAIE_FEATURE_LOCK_ENABLE
+#if defined(XAIE_FEATURE_LOCK_ENABLE) && defined(XAIE_DEV_AIE_ENABLE)
 
 /************************** Constant Definitions *****************************/
 #define XAIE_LOCK_WITH_VALUE_OFF	0x20
@@ -168,5 +168,5 @@ AieRC _XAie_LockSetValue(XAie_DevInst *DevInst, const XAie_LockMod *LockMod,
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
 
-#endif /* XAIE_FEATURE_LOCK_ENABLE */
+#endif /* XAIE_FEATURE_LOCK_ENABLE && XAIE_DEV_AIE_ENABLE */
 /** @} */
@@ -29,7 +29,7 @@
 #include "xaie_locks.h"
 #include "xaiegbl_defs.h"
 
-#ifdef XAIE_FEATURE_LOCK_ENABLE
+#if defined(XAIE_FEATURE_LOCK_ENABLE) && defined(XAIE_DEV_AIEML_ENABLE)
 /************************** Constant Definitions *****************************/
 #define XAIEML_LOCK_VALUE_MASK		0x7FU
 #define XAIEML_LOCK_VALUE_SHIFT		0x2U
@@ -163,5 +163,5 @@ AieRC _XAieMl_LockSetValue(XAie_DevInst *DevInst, const XAie_LockMod *LockMod,
 	return XAie_Write32(DevInst, RegAddr, RegVal);
 }
 
-#endif /* XAIE_FEATURE_LOCK_ENABLE */
+#endif /* XAIE_FEATURE_LOCK_ENABLE && XAIE_DEV_AIEML_ENABLE */
 /** @} */
@@ -28,12 +28,20 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_mem.h"
+#include "xaie_memckpt.h"
 
 #ifdef XAIE_FEATURE_DATAMEM_ENABLE
 
+/************************** Constant Definitions *****************************/
+#define XAIE_MEM_BLOCKREAD_BOUNCE_WORDS		64U
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -54,6 +62,7 @@
 AieRC XAie_DataMemWrWord(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u32 Addr, u32 Data)
 {
+	AieRC RC;
 	u64 RegAddr;
 	const XAie_MemMod *MemMod;
 	u8 TileType;
@@ -64,7 +73,7 @@ AieRC XAie_DataMemWrWord(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
 			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)){
 		XAIE_ERROR("Invalid Tile Type\n");
@@ -80,7 +89,12 @@ AieRC XAie_DataMemWrWord(XAie_DevInst *DevInst, XAie_LocType Loc,
 	RegAddr = MemMod->MemAddr + Addr +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
-	return XAie_Write32(DevInst, RegAddr, Data);
+	RC = XAie_Write32(DevInst, RegAddr, Data);
+	if(RC == XAIE_OK) {
+		_XAie_MemCkptMark(DevInst, Loc, Addr, sizeof(u32));
+	}
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -112,7 +126,7 @@ AieRC XAie_DataMemRdWord(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
 			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)){
 		XAIE_ERROR("Invalid Tile Type\n");
@@ -169,7 +183,7 @@ AieRC XAie_DataMemBlockWrite(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
 			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
 		XAIE_ERROR("Invalid tile type\n");
@@ -211,7 +225,7 @@ AieRC XAie_DataMemBlockWrite(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 	}
 
 	/* Aligned bytes */
-	RC = XAie_BlockWrite32(DevInst, DmAddrRoundUp,
+	RC = _XAie_BlockWrite32User(DevInst, DmAddrRoundUp,
 			(const u32 *)(CharSrc + BytePtr),
 			(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE));
 	if(RC != XAIE_OK) {
@@ -237,6 +251,111 @@ AieRC XAie_DataMemBlockWrite(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 		}
 	}
 
+	_XAie_MemCkptMark(DevInst, Loc, Addr, Size);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API fills a block of the specified data memory location of the selected
+* tile with a byte value. The aligned part of the block is filled with a single
+* block-set request so that no host-side buffer of the block size is needed.
+* For unaligned data memory offsets, this API implements read-modify-write
+* operation.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Loc of AIE Tiles
+* @param	Addr: Address in data memory to fill.
+* @param	Data - Byte value to fill the block with.
+* @param	Size - Size in bytes to fill.
+*
+* @return	XAIE_OK on success and error code on failure
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_DataMemBlockSet(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
+		u8 Data, u32 Size)
+{
+	AieRC RC;
+	u64 DmAddrRoundDown, DmAddrRoundUp;
+	u32 Mask = 0;
+	u32 RemBytes = Size;
+	u32 Word = Data * 0x01010101U;
+	u8 FirstWriteOffset = Addr & XAIE_MEM_WORD_ALIGN_MASK;
+	u8 TileType;
+	const XAie_MemMod *MemMod;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
+			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+
+	/* Check for any size overflow */
+	if((u64)Addr + Size > MemMod->Size) {
+		XAIE_ERROR("Size of block overflows tile data memory\n");
+		return XAIE_ERR_OUTOFBOUND;
+	}
+
+	DmAddrRoundDown =  MemMod->MemAddr + XAIE_MEM_WORD_ROUND_DOWN(Addr) +
+				_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	DmAddrRoundUp = MemMod->MemAddr + XAIE_MEM_WORD_ROUND_UP(Addr) +
+				_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	/* Unaligned start bytes */
+	if(FirstWriteOffset) {
+		for(u32 UnalignedByte = FirstWriteOffset;
+			UnalignedByte < XAIE_MEM_WORD_ALIGN_SIZE && RemBytes;
+			UnalignedByte++, RemBytes--) {
+			Mask |= 0xFFU << (UnalignedByte * 8);
+		}
+		RC = XAie_MaskWrite32(DevInst, DmAddrRoundDown, Mask,
+				Word & Mask);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	/* Aligned bytes */
+	if(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE) {
+		RC = XAie_BlockSet32(DevInst, DmAddrRoundUp, Word,
+				(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE));
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	/* Remaining unaligned bytes */
+	if(RemBytes % XAIE_MEM_WORD_ALIGN_SIZE) {
+		DmAddrRoundDown = DmAddrRoundUp + XAIE_MEM_WORD_ALIGN_SIZE *
+					(RemBytes / XAIE_MEM_WORD_ALIGN_SIZE);
+		Mask = 0;
+		for (u32 UnalignedByte = 0;
+			 UnalignedByte < RemBytes % XAIE_MEM_WORD_ALIGN_SIZE;
+			 UnalignedByte++) {
+			Mask |= 0xFFU << (UnalignedByte * 8);
+		}
+		RC = XAie_MaskWrite32(DevInst, DmAddrRoundDown, Mask,
+				Word & Mask);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	_XAie_MemCkptMark(DevInst, Loc, Addr, Size);
+
 	return XAIE_OK;
 }
 
@@ -266,6 +385,8 @@ AieRC XAie_DataMemBlockRead(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 	u32 BytePtr = 0;
 	u32 RemBytes = Size;
 	u32 TempWord;
+	u32 NumWords, Chunk;
+	u32 BounceBuf[XAIE_MEM_BLOCKREAD_BOUNCE_WORDS];
 	u8 FirstReadOffset = (u8)Addr & XAIE_MEM_WORD_ALIGN_MASK;
 	u8 TileType;
 	unsigned char *CharDst = (unsigned char *)Dst;
@@ -278,7 +399,7 @@ AieRC XAie_DataMemBlockRead(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
 			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
 		XAIE_ERROR("Invalid tile type\n");
@@ -317,13 +438,33 @@ AieRC XAie_DataMemBlockRead(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 	}
 
 	/* Aligned bytes */
-	for(u32 AlignedWord = 0; AlignedWord < RemBytes / 4;
-		AlignedWord++, BytePtr += 4, DmAddrRoundUp += 4) {
-		RC = XAie_Read32(DevInst, DmAddrRoundUp,
-				(u32 *)(CharDst + BytePtr));
+	NumWords = RemBytes / XAIE_MEM_WORD_ALIGN_SIZE;
+	if(((uintptr_t)(CharDst + BytePtr) & XAIE_MEM_WORD_ALIGN_MASK) == 0U) {
+		RC = XAie_BlockRead32(DevInst, DmAddrRoundUp,
+				(u32 *)(CharDst + BytePtr), NumWords);
 		if(RC != XAIE_OK) {
 			return RC;
 		}
+		DmAddrRoundUp += XAIE_MEM_WORD_ALIGN_SIZE * NumWords;
+		BytePtr += XAIE_MEM_WORD_ALIGN_SIZE * NumWords;
+	} else {
+		/* Bounce the words for a destination which is not aligned */
+		while(NumWords > 0U) {
+			Chunk = NumWords < XAIE_MEM_BLOCKREAD_BOUNCE_WORDS ?
+				NumWords : XAIE_MEM_BLOCKREAD_BOUNCE_WORDS;
+
+			RC = XAie_BlockRead32(DevInst, DmAddrRoundUp,
+					BounceBuf, Chunk);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+
+			memcpy(CharDst + BytePtr, BounceBuf,
+					Chunk * XAIE_MEM_WORD_ALIGN_SIZE);
+			DmAddrRoundUp += XAIE_MEM_WORD_ALIGN_SIZE * Chunk;
+			BytePtr += XAIE_MEM_WORD_ALIGN_SIZE * Chunk;
+			NumWords -= Chunk;
+		}
 	}
 
 	/* Remaining bytes */
@@ -344,5 +485,308 @@ AieRC XAie_DataMemBlockRead(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 	return XAIE_OK;
 }
 
+/*
+ * Typedef to capture the register address of a word accessed by
+ * XAie_DataMemScatter() or XAie_DataMemGather().
+ */
+typedef struct {
+	u64 Addr;
+	u32 Idx;	/* Index of the word in the array of the caller */
+} XAie_DataMemWordOrder;
+
+/*****************************************************************************/
+/**
+*
+* This API compares the data memory words by register address. Words at the
+* same address are kept in the order of the caller.
+*
+* @param	A: Pointer to the first word.
+* @param	B: Pointer to the second word.
+*
+* @return	Negative, zero or positive as per qsort().
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static int _XAie_DataMemWordOrderCmp(const void *A, const void *B)
+{
+	const XAie_DataMemWordOrder *OA = (const XAie_DataMemWordOrder *)A;
+	const XAie_DataMemWordOrder *OB = (const XAie_DataMemWordOrder *)B;
+
+	if(OA->Addr != OB->Addr) {
+		return (OA->Addr < OB->Addr) ? -1 : 1;
+	}
+
+	return (OA->Idx < OB->Idx) ? -1 : (OA->Idx > OB->Idx);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API validates an array of data memory words and sorts them by register
+* address, which orders them by tile and by address in the tile.
+*
+* @param	DevInst: Device Instance
+* @param	Words: Array of the words.
+* @param	NumWords: Number of entries in Words.
+* @param	OrderPtr: Pointer to return the sorted words, to be freed by
+*		the caller.
+* @param	ValsPtr: Pointer to return a buffer of NumWords values, to be
+*		freed by the caller.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DataMemWordsSort(XAie_DevInst *DevInst,
+		const XAie_DataMemWord *Words, u32 NumWords,
+		XAie_DataMemWordOrder **OrderPtr, u32 **ValsPtr)
+{
+	XAie_DataMemWordOrder *Order;
+	const XAie_MemMod *MemMod;
+	u8 TileType;
+
+	if((DevInst == XAIE_NULL) || (Words == XAIE_NULL) ||
+			(NumWords == 0U) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumWords; i++) {
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Words[i].Loc);
+		if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
+				(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
+			XAIE_ERROR("Invalid Tile Type of word %u\n", i);
+			return XAIE_INVALID_TILE;
+		}
+
+		MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+		if((Words[i].Addr >= MemMod->Size) ||
+				((Words[i].Addr & XAIE_MEM_WORD_ALIGN_MASK) !=
+				 0U)) {
+			XAIE_ERROR("Invalid address of word %u\n", i);
+			return XAIE_INVALID_DATA_MEM_ADDR;
+		}
+	}
+
+	Order = (XAie_DataMemWordOrder *)malloc(NumWords * sizeof(*Order));
+	*ValsPtr = (u32 *)malloc(NumWords * sizeof(u32));
+	if((Order == NULL) || (*ValsPtr == NULL)) {
+		XAIE_ERROR("Memory allocation failed\n");
+		free(Order);
+		free(*ValsPtr);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumWords; i++) {
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Words[i].Loc);
+		MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+
+		Order[i].Addr = MemMod->MemAddr + Words[i].Addr +
+			_XAie_GetTileAddr(DevInst, Words[i].Loc.Row,
+					Words[i].Loc.Col);
+		Order[i].Idx = i;
+	}
+
+	qsort(Order, NumWords, sizeof(*Order), _XAie_DataMemWordOrderCmp);
+	*OrderPtr = Order;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API accesses the distinct words of a sorted array of data memory words,
+* as one block access per run of adjacent words.
+*
+* @param	DevInst: Device Instance
+* @param	Words: Array of the words of the caller.
+* @param	Order: Sorted words.
+* @param	NumWords: Number of entries in Order.
+* @param	Vals: Values of the distinct words, in address order.
+* @param	Write: XAIE_ENABLE to write the values, XAIE_DISABLE to read
+*		them.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_DataMemWordRuns(XAie_DevInst *DevInst,
+		const XAie_DataMemWord *Words,
+		const XAie_DataMemWordOrder *Order, u32 NumWords, u32 *Vals,
+		u8 Write)
+{
+	AieRC RC;
+	u32 RunStart = 0U, RunLen = 0U, RunIdx = 0U;
+
+	for(u32 i = 0U; i <= NumWords; i++) {
+		if((i > 0U) && (i < NumWords) &&
+				(Order[i].Addr == Order[i - 1U].Addr)) {
+			continue;
+		}
+
+		if((i < NumWords) && (RunLen != 0U) &&
+				(Order[i].Addr ==
+				 Order[RunIdx].Addr + RunLen * 4U)) {
+			RunLen++;
+			continue;
+		}
+
+		if(RunLen != 0U) {
+			const XAie_DataMemWord *First =
+				&Words[Order[RunIdx].Idx];
+
+			if(Write == XAIE_ENABLE) {
+				RC = XAie_BlockWrite32(DevInst,
+						Order[RunIdx].Addr,
+						&Vals[RunStart], RunLen);
+				if(RC == XAIE_OK) {
+					_XAie_MemCkptMark(DevInst, First->Loc,
+							First->Addr,
+							RunLen * 4U);
+				}
+			} else {
+				RC = XAie_BlockRead32(DevInst,
+						Order[RunIdx].Addr,
+						&Vals[RunStart], RunLen);
+			}
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		RunStart += RunLen;
+		RunIdx = i;
+		RunLen = 1U;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a batch of words scattered over the data memories of many
+* tiles. The words are sorted by tile and address, adjacent words are merged
+* into block writes, and all the writes are sent in one transaction.
+*
+* @param	DevInst: Device Instance
+* @param	Words: Array of the locations, addresses and values of the
+*		words.
+* @param	NumWords: Number of entries in Words.
+*
+* @return	XAIE_OK on success and error code on failure
+*
+* @note		All the entries are validated before any word is written. If
+*		the same word is listed more than once, the last entry is
+*		written. If the calling thread has a transaction open, the
+*		writes are recorded into it.
+*
+*******************************************************************************/
+AieRC XAie_DataMemScatter(XAie_DevInst *DevInst,
+		const XAie_DataMemWord *Words, u32 NumWords)
+{
+	AieRC RC;
+	u8 OwnTxn = XAIE_DISABLE;
+	u32 *Vals, NumVals = 0U;
+	XAie_DataMemWordOrder *Order;
+
+	RC = _XAie_DataMemWordsSort(DevInst, Words, NumWords, &Order, &Vals);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	/* Entries of a word are sorted in order, so the last one is kept */
+	for(u32 i = 0U; i < NumWords; i++) {
+		if((i == 0U) || (Order[i].Addr != Order[i - 1U].Addr)) {
+			NumVals++;
+		}
+		Vals[NumVals - 1U] = Words[Order[i].Idx].Value;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			free(Order);
+			free(Vals);
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	RC = _XAie_DataMemWordRuns(DevInst, Words, Order, NumWords, Vals,
+			XAIE_ENABLE);
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	free(Order);
+	free(Vals);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads a batch of words scattered over the data memories of many
+* tiles. The words are sorted by tile and address and adjacent words are read
+* with one block read.
+*
+* @param	DevInst: Device Instance
+* @param	Words: Array of the locations and addresses of the words. The
+*		value of each entry is set to the word read.
+* @param	NumWords: Number of entries in Words.
+*
+* @return	XAIE_OK on success and error code on failure
+*
+* @note		All the entries are validated before any word is read. A word
+*		listed more than once is read once.
+*
+*******************************************************************************/
+AieRC XAie_DataMemGather(XAie_DevInst *DevInst, XAie_DataMemWord *Words,
+		u32 NumWords)
+{
+	AieRC RC;
+	u32 *Vals, NumVals = 0U;
+	XAie_DataMemWordOrder *Order;
+
+	RC = _XAie_DataMemWordsSort(DevInst, Words, NumWords, &Order, &Vals);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_DataMemWordRuns(DevInst, Words, Order, NumWords, Vals,
+			XAIE_DISABLE);
+	if(RC == XAIE_OK) {
+		for(u32 i = 0U; i < NumWords; i++) {
+			if((i == 0U) ||
+					(Order[i].Addr != Order[i - 1U].Addr)) {
+				NumVals++;
+			}
+			Words[Order[i].Idx].Value = Vals[NumVals - 1U];
+		}
+	}
+
+	free(Order);
+	free(Vals);
+
+	return RC;
+}
+
 #endif /* XAIE_FEATURE_DATAMEM_ENABLE */
 /** @} */
@@ -37,6 +37,17 @@
 						~XAIE_MEM_WORD_ALIGN_MASK)
 #define XAIE_MEM_WORD_ROUND_DOWN(Addr)	((Addr) & (~XAIE_MEM_WORD_ALIGN_MASK))
 
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures a word of the data memory of a tile accessed by the
+ * scatter and gather APIs.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u32 Addr;	/* Word aligned address in the data memory */
+	u32 Value;	/* Value to write, or value read */
+} XAie_DataMemWord;
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_DataMemWrWord(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u32 Addr, u32 Data);
@@ -44,8 +55,14 @@ AieRC XAie_DataMemRdWord(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u32 Addr, u32 *Data);
 AieRC XAie_DataMemBlockWrite(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 		const void *Src, u32 Size);
+AieRC XAie_DataMemBlockSet(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
+		u8 Data, u32 Size);
 AieRC XAie_DataMemBlockRead(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 		void *Dst, u32 Size);
+AieRC XAie_DataMemScatter(XAie_DevInst *DevInst,
+		const XAie_DataMemWord *Words, u32 NumWords);
+AieRC XAie_DataMemGather(XAie_DevInst *DevInst, XAie_DataMemWord *Words,
+		u32 NumWords);
 
 #endif		/* end of protection macro */
 
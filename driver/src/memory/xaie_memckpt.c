@@ -0,0 +1,637 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_memckpt.c
+* @{
+*
+* This file contains routines to checkpoint the data memories of AIE tiles and
+* memory tiles. Only the regions written through the data memory APIs, or
+* declared live by the application, are saved and restored, so the cost of a
+* checkpoint follows the live data rather than the size of the memories.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_helper.h"
+#include "xaie_mem.h"
+#include "xaie_memckpt.h"
+
+#ifdef XAIE_FEATURE_DATAMEM_ENABLE
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the index of a tile in a checkpoint.
+*
+* @param	Ckpt: Checkpoint.
+* @param	Loc: Location of the tile.
+* @param	Idx: Pointer to return the index of the tile.
+*
+* @return	XAIE_ENABLE if the tile is part of the checkpoint, XAIE_DISABLE
+*		otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u8 _XAie_MemCkptGetTile(const XAie_MemCkpt *Ckpt, XAie_LocType Loc,
+		u32 *Idx)
+{
+	u32 TileIdx;
+
+	if((Loc.Col >= Ckpt->NumCols) || (Loc.Row >= Ckpt->NumRows)) {
+		return XAIE_DISABLE;
+	}
+
+	TileIdx = Ckpt->TileIdx[Loc.Col * Ckpt->NumRows + Loc.Row];
+	if(TileIdx == 0U) {
+		return XAIE_DISABLE;
+	}
+
+	*Idx = TileIdx - 1U;
+
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API marks the granules of a region of the memory of a tile as live.
+*
+* @param	Ckpt: Checkpoint.
+* @param	Idx: Index of the tile in the checkpoint.
+* @param	Addr: Start address of the region.
+* @param	Size: Size of the region in bytes.
+*
+* @return	None.
+*
+* @note		Internal only. The bitmap is updated atomically, so threads
+*		writing to different tiles can mark them concurrently.
+*
+******************************************************************************/
+static void _XAie_MemCkptSetLive(XAie_MemCkpt *Ckpt, u32 Idx, u32 Addr,
+		u32 Size)
+{
+	u32 Start = Addr / XAIE_MEM_CKPT_GRANULE;
+	u32 End = (u32)(((u64)Addr + Size + XAIE_MEM_CKPT_GRANULE - 1U) /
+			XAIE_MEM_CKPT_GRANULE);
+
+	_XAie_SetBitInBitmapAtomic(&Ckpt->Live[Ckpt->LiveOff[Idx]], Start,
+			End - Start);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API marks a region of the memory of a tile written by the data memory
+* APIs as live in the checkpoint attached to the device instance.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the tile.
+* @param	Addr: Start address of the region.
+* @param	Size: Size of the region in bytes.
+*
+* @return	None.
+*
+* @note		Internal only. The caller validates the region.
+*
+******************************************************************************/
+void _XAie_MemCkptMark(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
+		u32 Size)
+{
+	XAie_MemCkpt *Ckpt = DevInst->MemCkpt;
+	u32 Idx;
+
+	if((Ckpt == NULL) || (Size == 0U) ||
+			(_XAie_MemCkptGetTile(Ckpt, Loc, &Idx) == XAIE_DISABLE)) {
+		return;
+	}
+
+	_XAie_MemCkptSetLive(Ckpt, Idx, Addr, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets up a checkpoint of the data memories of a set of tiles and
+* attaches it to the device instance. From then on, the regions written by
+* XAie_DataMemWrWord(), XAie_DataMemBlockWrite() and XAie_DataMemBlockSet()
+* to these tiles are live and saved by XAie_MemCkptSave().
+*
+* @param	DevInst: Device Instance.
+* @param	Ckpt: Checkpoint to set up.
+* @param	Locs: Locations of the AIE tiles and memory tiles.
+* @param	NumLocs: Number of tiles.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The checkpoint replaces the one attached to the device
+*		instance, if any.
+*
+******************************************************************************/
+AieRC XAie_MemCkptInit(XAie_DevInst *DevInst, XAie_MemCkpt *Ckpt,
+		const XAie_LocType *Locs, u32 NumLocs)
+{
+	u32 NumWords = 0U;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Ckpt == XAIE_NULL) || (Locs == XAIE_NULL) || (NumLocs == 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		u8 TileType = _XAie_DevGetTTypefromLoc(DevInst, Locs[i]);
+
+		if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
+				(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
+			XAIE_ERROR("Invalid tile type\n");
+			return XAIE_INVALID_TILE;
+		}
+	}
+
+	memset((void *)Ckpt, 0, sizeof(*Ckpt));
+	Ckpt->NumTiles = NumLocs;
+	Ckpt->NumCols = DevInst->NumCols;
+	Ckpt->NumRows = DevInst->NumRows;
+	Ckpt->Locs = (XAie_LocType *)malloc(NumLocs * sizeof(XAie_LocType));
+	Ckpt->MemSizes = (u32 *)malloc(NumLocs * sizeof(u32));
+	Ckpt->LiveOff = (u32 *)malloc(NumLocs * sizeof(u32));
+	Ckpt->TileIdx = (u32 *)calloc((size_t)DevInst->NumCols *
+			DevInst->NumRows, sizeof(u32));
+	if((Ckpt->Locs == NULL) || (Ckpt->MemSizes == NULL) ||
+			(Ckpt->LiveOff == NULL) || (Ckpt->TileIdx == NULL)) {
+		XAIE_ERROR("Memory allocation for checkpoint failed\n");
+		free(Ckpt->Locs);
+		free(Ckpt->MemSizes);
+		free(Ckpt->LiveOff);
+		free(Ckpt->TileIdx);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		u8 TileType = _XAie_DevGetTTypefromLoc(DevInst, Locs[i]);
+		u32 *TileIdx = &Ckpt->TileIdx[Locs[i].Col * DevInst->NumRows +
+			Locs[i].Row];
+
+		if(*TileIdx != 0U) {
+			XAIE_ERROR("Tile (%d, %d) listed twice\n",
+					Locs[i].Col, Locs[i].Row);
+			free(Ckpt->Locs);
+			free(Ckpt->MemSizes);
+			free(Ckpt->LiveOff);
+			free(Ckpt->TileIdx);
+			return XAIE_INVALID_ARGS;
+		}
+
+		*TileIdx = i + 1U;
+		Ckpt->Locs[i] = Locs[i];
+		Ckpt->MemSizes[i] = DevInst->DevProp.DevMod[TileType].MemMod->Size;
+		Ckpt->LiveOff[i] = NumWords;
+		NumWords += (Ckpt->MemSizes[i] / XAIE_MEM_CKPT_GRANULE + 31U) /
+			32U;
+	}
+
+	Ckpt->Live = (u32 *)calloc(NumWords, sizeof(u32));
+	if(Ckpt->Live == NULL) {
+		XAIE_ERROR("Memory allocation for checkpoint failed\n");
+		free(Ckpt->Locs);
+		free(Ckpt->MemSizes);
+		free(Ckpt->LiveOff);
+		free(Ckpt->TileIdx);
+		return XAIE_ERR;
+	}
+
+	Ckpt->IsReady = XAIE_COMPONENT_IS_READY;
+	DevInst->MemCkpt = Ckpt;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API attaches a checkpoint to the device instance, so that the data
+* memory writes mark the regions they write as live in it. Each context
+* sharing a partition keeps its own checkpoint and attaches it when it is
+* switched in.
+*
+* @param	DevInst: Device Instance.
+* @param	Ckpt: Checkpoint set up by XAie_MemCkptInit(), or NULL to stop
+*		tracking the writes.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS otherwise.
+*
+* @note		This API must not run concurrently with data memory writes.
+*
+******************************************************************************/
+AieRC XAie_MemCkptAttach(XAie_DevInst *DevInst, XAie_MemCkpt *Ckpt)
+{
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Ckpt != XAIE_NULL) && (Ckpt->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid checkpoint\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	DevInst->MemCkpt = Ckpt;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API declares a region of the memory of a tile as live, for instance a
+* buffer written by a DMA or by the cores.
+*
+* @param	Ckpt: Checkpoint.
+* @param	Loc: Location of the tile.
+* @param	Addr: Start address of the region in the memory of the tile.
+* @param	Size: Size of the region in bytes.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The region is rounded out to XAIE_MEM_CKPT_GRANULE bytes.
+*
+******************************************************************************/
+AieRC XAie_MemCkptMarkLive(XAie_MemCkpt *Ckpt, XAie_LocType Loc, u32 Addr,
+		u32 Size)
+{
+	u32 Idx;
+
+	if((Ckpt == XAIE_NULL) || (Ckpt->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid checkpoint\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_MemCkptGetTile(Ckpt, Loc, &Idx) == XAIE_DISABLE) {
+		XAIE_ERROR("Tile (%d, %d) is not part of the checkpoint\n",
+				Loc.Col, Loc.Row);
+		return XAIE_INVALID_TILE;
+	}
+
+	if((Size == 0U) || ((u64)Addr + Size > Ckpt->MemSizes[Idx])) {
+		XAIE_ERROR("Region overflows tile data memory\n");
+		return XAIE_ERR_OUTOFBOUND;
+	}
+
+	_XAie_MemCkptSetLive(Ckpt, Idx, Addr, Size);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the live regions of a checkpoint, for instance once the
+* buffers of a completed run are no longer needed.
+*
+* @param	Ckpt: Checkpoint.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS otherwise.
+*
+* @note		The content saved last is kept and can still be restored.
+*
+******************************************************************************/
+AieRC XAie_MemCkptClear(XAie_MemCkpt *Ckpt)
+{
+	u32 NumWords;
+
+	if((Ckpt == XAIE_NULL) || (Ckpt->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid checkpoint\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	NumWords = Ckpt->LiveOff[Ckpt->NumTiles - 1U] +
+		(Ckpt->MemSizes[Ckpt->NumTiles - 1U] / XAIE_MEM_CKPT_GRANULE +
+		 31U) / 32U;
+	memset((void *)Ckpt->Live, 0, NumWords * sizeof(u32));
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API lists the live regions of a checkpoint, merging consecutive live
+* granules of a tile in one region.
+*
+* @param	Ckpt: Checkpoint.
+* @param	Regions: Array to return the regions, NULL to count them only.
+* @param	NumRegions: Pointer to return the number of regions.
+* @param	Size: Pointer to return the size of the regions in bytes.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_MemCkptListRegions(const XAie_MemCkpt *Ckpt,
+		XAie_MemCkptRegion *Regions, u32 *NumRegions, u64 *Size)
+{
+	*NumRegions = 0U;
+	*Size = 0U;
+
+	for(u32 t = 0U; t < Ckpt->NumTiles; t++) {
+		const u32 *Live = &Ckpt->Live[Ckpt->LiveOff[t]];
+		u32 NumGranules = Ckpt->MemSizes[t] / XAIE_MEM_CKPT_GRANULE;
+		u32 g = 0U;
+
+		while(g < NumGranules) {
+			u32 Start;
+
+			if(Live[g / 32U] == 0U) {
+				g = (g / 32U + 1U) * 32U;
+				continue;
+			}
+
+			if(CheckBit(Live, g) == 0U) {
+				g++;
+				continue;
+			}
+
+			Start = g;
+			while((g < NumGranules) && (CheckBit(Live, g) != 0U)) {
+				g++;
+			}
+
+			if(Regions != NULL) {
+				XAie_MemCkptRegion *Region =
+					&Regions[*NumRegions];
+
+				Region->Loc = Ckpt->Locs[t];
+				Region->Addr = Start * XAIE_MEM_CKPT_GRANULE;
+				Region->Size = (g - Start) *
+					XAIE_MEM_CKPT_GRANULE;
+				Region->DataOff = *Size;
+			}
+			(*NumRegions)++;
+			*Size += (u64)(g - Start) * XAIE_MEM_CKPT_GRANULE;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the size of the live regions of a checkpoint, which is the
+* size of the buffer needed to stage them with XAie_MemCkptSave().
+*
+* @param	Ckpt: Checkpoint.
+* @param	Size: Pointer to return the size in bytes.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_MemCkptGetSize(const XAie_MemCkpt *Ckpt, u64 *Size)
+{
+	u32 NumRegions;
+
+	if((Ckpt == XAIE_NULL) || (Ckpt->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Size == XAIE_NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_MemCkptListRegions(Ckpt, NULL, &NumRegions, Size);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API saves the content of the live regions of a checkpoint. Each region
+* is read with one block read.
+*
+* @param	DevInst: Device Instance.
+* @param	Ckpt: Checkpoint.
+* @param	MemInst: Buffer to stage the content in, or NULL to keep it in
+*		memory allocated by the checkpoint. The buffer must hold the
+*		size returned by XAie_MemCkptGetSize(), it is synced for the
+*		device once the content is saved.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The tiles are expected to be quiet, with their cores and DMA
+*		channels stopped, while they are saved.
+*
+******************************************************************************/
+AieRC XAie_MemCkptSave(XAie_DevInst *DevInst, XAie_MemCkpt *Ckpt,
+		XAie_MemInst *MemInst)
+{
+	AieRC RC = XAIE_OK;
+	XAie_MemCkptRegion *Regions = NULL;
+	u32 NumRegions;
+	u64 Size;
+	u8 *Dst;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Ckpt == XAIE_NULL) || (Ckpt->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid checkpoint\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_MemCkptListRegions(Ckpt, NULL, &NumRegions, &Size);
+	if((MemInst != XAIE_NULL) && ((MemInst->VAddr == NULL) ||
+				(MemInst->Size < Size))) {
+		XAIE_ERROR("Staging buffer smaller than checkpoint\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(NumRegions != 0U) {
+		Regions = (XAie_MemCkptRegion *)malloc(NumRegions *
+				sizeof(*Regions));
+		if(Regions == NULL) {
+			XAIE_ERROR("Memory allocation for checkpoint failed\n");
+			return XAIE_ERR;
+		}
+		_XAie_MemCkptListRegions(Ckpt, Regions, &NumRegions, &Size);
+	}
+
+	Ckpt->IsSaved = XAIE_DISABLE;
+	free(Ckpt->Regions);
+	Ckpt->Regions = Regions;
+	Ckpt->NumRegions = NumRegions;
+	Ckpt->DataSize = Size;
+	Ckpt->MemInst = MemInst;
+
+	if(MemInst != XAIE_NULL) {
+		free(Ckpt->Data);
+		Ckpt->Data = NULL;
+		Dst = (u8 *)MemInst->VAddr;
+	} else {
+		Dst = (u8 *)realloc((void *)Ckpt->Data, (Size != 0U) ?
+				(size_t)Size : 1U);
+		if(Dst == NULL) {
+			XAIE_ERROR("Memory allocation for checkpoint failed\n");
+			return XAIE_ERR;
+		}
+		Ckpt->Data = Dst;
+	}
+
+	for(u32 i = 0U; (i < NumRegions) && (RC == XAIE_OK); i++) {
+		RC = XAie_DataMemBlockRead(DevInst, Regions[i].Loc,
+				Regions[i].Addr, &Dst[Regions[i].DataOff],
+				Regions[i].Size);
+	}
+
+	if((RC == XAIE_OK) && (MemInst != XAIE_NULL)) {
+		RC = XAie_MemSyncForDev(MemInst);
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to save data memory checkpoint\n");
+		return RC;
+	}
+
+	Ckpt->IsSaved = XAIE_ENABLE;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API restores the content saved by the last XAie_MemCkptSave(). The
+* regions are written with one block write each, in one transaction.
+*
+* @param	DevInst: Device Instance.
+* @param	Ckpt: Checkpoint.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		If a transaction is active on the calling thread, the writes
+*		are recorded in it instead. A staging buffer given to the save
+*		must be kept until the restore is submitted.
+*
+******************************************************************************/
+AieRC XAie_MemCkptRestore(XAie_DevInst *DevInst, XAie_MemCkpt *Ckpt)
+{
+	AieRC RC = XAIE_OK;
+	const u8 *Src;
+	u8 OwnTxn = XAIE_DISABLE;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Ckpt == XAIE_NULL) || (Ckpt->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Ckpt->IsSaved != XAIE_ENABLE)) {
+		XAIE_ERROR("Invalid checkpoint\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Ckpt->MemInst != XAIE_NULL) {
+		RC = XAie_MemSyncForCPU(Ckpt->MemInst);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		Src = (const u8 *)Ckpt->MemInst->VAddr;
+	} else {
+		Src = Ckpt->Data;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	for(u32 i = 0U; (i < Ckpt->NumRegions) && (RC == XAIE_OK); i++) {
+		const XAie_MemCkptRegion *Region = &Ckpt->Regions[i];
+
+		RC = XAie_DataMemBlockWrite(DevInst, Region->Loc, Region->Addr,
+				&Src[Region->DataOff], Region->Size);
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to restore data memory checkpoint\n");
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the memory of a checkpoint and detaches it from the device
+* instance.
+*
+* @param	DevInst: Device Instance.
+* @param	Ckpt: Checkpoint.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS otherwise.
+*
+* @note		A staging buffer given to XAie_MemCkptSave() is owned by the
+*		caller and not released.
+*
+******************************************************************************/
+AieRC XAie_MemCkptFree(XAie_DevInst *DevInst, XAie_MemCkpt *Ckpt)
+{
+	if((DevInst == XAIE_NULL) || (Ckpt == XAIE_NULL) ||
+			(Ckpt->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->MemCkpt == Ckpt) {
+		DevInst->MemCkpt = NULL;
+	}
+
+	free(Ckpt->Locs);
+	free(Ckpt->TileIdx);
+	free(Ckpt->MemSizes);
+	free(Ckpt->LiveOff);
+	free(Ckpt->Live);
+	free(Ckpt->Regions);
+	free(Ckpt->Data);
+	memset((void *)Ckpt, 0, sizeof(*Ckpt));
+
+	return XAIE_OK;
+}
+
+#endif /* XAIE_FEATURE_DATAMEM_ENABLE */
+
+/** @} */
@@ -0,0 +1,86 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_memckpt.h
+* @{
+*
+* This file contains routines to checkpoint the live regions of the data
+* memories of AIE tiles and memory tiles.
+*
+******************************************************************************/
+#ifndef XAIE_MEMCKPT_H
+#define XAIE_MEMCKPT_H
+
+/***************************** Include Files *********************************/
+#include "xaie_feature_config.h"
+#include "xaiegbl.h"
+
+#ifdef XAIE_FEATURE_DATAMEM_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_MEM_CKPT_GRANULE		64U
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures a region of the data memory of a tile saved in a
+ * checkpoint. Its content is stored from byte DataOff of the checkpoint data.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u32 Addr;
+	u32 Size;
+	u64 DataOff;
+} XAie_MemCkptRegion;
+
+/*
+ * This structure captures a checkpoint of the data memories of a set of tiles.
+ * The memories are split in granules of XAIE_MEM_CKPT_GRANULE bytes and Live
+ * is the bitmap of the granules to save, one bitmap per tile from LiveOff of
+ * the tile. The granules written by the data memory APIs while the checkpoint
+ * is attached to the device instance, and the ones declared with
+ * XAie_MemCkptMarkLive(), are live. The content of the live regions is stored
+ * by XAie_MemCkptSave() in Data, or in MemInst if one is given.
+ */
+struct XAie_MemCkpt {
+	XAie_LocType *Locs;
+	u32 NumTiles;
+	u8 NumCols;
+	u8 NumRows;
+	u32 *TileIdx;		/* Index + 1 of each tile of the partition */
+	u32 *MemSizes;		/* Size of the memory of each tile */
+	u32 *LiveOff;		/* First word of the bitmap of each tile */
+	u32 *Live;
+	XAie_MemCkptRegion *Regions;
+	u32 NumRegions;
+	u8 *Data;
+	XAie_MemInst *MemInst;	/* Staging buffer of the last save, if any */
+	u64 DataSize;
+	u8 IsSaved;
+	u8 IsReady;
+};
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_MemCkptInit(XAie_DevInst *DevInst, XAie_MemCkpt *Ckpt,
+		const XAie_LocType *Locs, u32 NumLocs);
+AieRC XAie_MemCkptAttach(XAie_DevInst *DevInst, XAie_MemCkpt *Ckpt);
+AieRC XAie_MemCkptMarkLive(XAie_MemCkpt *Ckpt, XAie_LocType Loc, u32 Addr,
+		u32 Size);
+AieRC XAie_MemCkptClear(XAie_MemCkpt *Ckpt);
+AieRC XAie_MemCkptGetSize(const XAie_MemCkpt *Ckpt, u64 *Size);
+AieRC XAie_MemCkptSave(XAie_DevInst *DevInst, XAie_MemCkpt *Ckpt,
+		XAie_MemInst *MemInst);
+AieRC XAie_MemCkptRestore(XAie_DevInst *DevInst, XAie_MemCkpt *Ckpt);
+AieRC XAie_MemCkptFree(XAie_DevInst *DevInst, XAie_MemCkpt *Ckpt);
+void _XAie_MemCkptMark(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
+		u32 Size);
+
+#endif /* XAIE_FEATURE_DATAMEM_ENABLE */
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -0,0 +1,369 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_rtp.c
+* @{
+*
+* This file contains routines for the double buffered runtime parameter
+* channels of AIE tiles. An update is written to the buffer the core does not
+* use and published with a lock release, so the core is never stalled by the
+* host. The updates of many channels can be sent in one transaction.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include "xaie_helper.h"
+#include "xaie_locks.h"
+#include "xaie_mem.h"
+#include "xaie_rtp.h"
+
+#if defined(XAIE_FEATURE_DATAMEM_ENABLE) && defined(XAIE_FEATURE_LOCK_ENABLE)
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API initializes a runtime parameter channel on two buffers of the data
+* memory of a tile and two locks of the same tile. The locks are set to 0, so
+* no update is published.
+*
+* @param	DevInst: Device Instance
+* @param	Chan: Pointer to the user allocated channel.
+* @param	Loc: Location of the AIE tile or memory tile.
+* @param	BufAddr: Array of the data memory addresses of the two buffers.
+* @param	Size: Size of each buffer in bytes.
+* @param	LockId: Array of the locks of the two buffers.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Locks of AIE devices cannot be set and have to be released with
+*		value 0, as they are after reset.
+*
+******************************************************************************/
+AieRC XAie_RtpChannelInit(XAie_DevInst *DevInst, XAie_RtpChannel *Chan,
+		XAie_LocType Loc, const u32 *BufAddr, u32 Size,
+		const u8 *LockId)
+{
+	AieRC RC;
+	u8 TileType;
+	const XAie_MemMod *MemMod;
+	const XAie_LockMod *LockMod;
+
+	if((DevInst == XAIE_NULL) || (Chan == XAIE_NULL) ||
+			(BufAddr == XAIE_NULL) || (LockId == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
+			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+	LockMod = DevInst->DevProp.DevMod[TileType].LockMod;
+	if((Size == 0U) || ((u64)BufAddr[0U] + Size > MemMod->Size) ||
+			((u64)BufAddr[1U] + Size > MemMod->Size)) {
+		XAIE_ERROR("Invalid runtime parameter buffers\n");
+		return XAIE_ERR_OUTOFBOUND;
+	}
+
+	if(((u64)BufAddr[0U] + Size > BufAddr[1U]) &&
+			((u64)BufAddr[1U] + Size > BufAddr[0U])) {
+		XAIE_ERROR("Runtime parameter buffers overlap\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((LockId[0U] >= LockMod->NumLocks) ||
+			(LockId[1U] >= LockMod->NumLocks) ||
+			(LockId[0U] == LockId[1U])) {
+		XAIE_ERROR("Invalid runtime parameter locks\n");
+		return XAIE_INVALID_LOCK_ID;
+	}
+
+	if(DevInst->DevProp.DevGen != XAIE_DEV_GEN_AIE) {
+		for(u8 i = 0U; i < 2U; i++) {
+			RC = XAie_LockSetValue(DevInst, Loc,
+					XAie_LockInit(LockId[i], 0));
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+		/* Acquire greater or equal to 1 and decrement */
+		Chan->ReclaimVal = -1;
+	} else {
+		Chan->ReclaimVal = 1;
+	}
+
+	Chan->Loc = Loc;
+	Chan->BufAddr[0U] = BufAddr[0U];
+	Chan->BufAddr[1U] = BufAddr[1U];
+	Chan->Size = Size;
+	Chan->LockId[0U] = LockId[0U];
+	Chan->LockId[1U] = LockId[1U];
+	Chan->Next = 0U;
+	Chan->Pending = 0U;
+	Chan->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+#ifdef XAIE_FEATURE_ELF_ENABLE
+/*****************************************************************************/
+/**
+*
+* This API initializes a runtime parameter channel on two symbols of an elf,
+* e.g. the ping and pong buffers of a kernel parameter.
+*
+* @param	DevInst: Device Instance
+* @param	Chan: Pointer to the user allocated channel.
+* @param	Map: Symbol map of the elf.
+* @param	Name0: Name of the symbol of the first buffer.
+* @param	Name1: Name of the symbol of the second buffer.
+* @param	LockId: Array of the locks of the two buffers, on the tile of
+*		the symbols.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Both symbols have to be in the data memory of the same tile
+*		and of the same size.
+*
+******************************************************************************/
+AieRC XAie_RtpChannelInitSym(XAie_DevInst *DevInst, XAie_RtpChannel *Chan,
+		const XAie_ElfSymMap *Map, const char *Name0,
+		const char *Name1, const u8 *LockId)
+{
+	AieRC RC;
+	u32 BufAddr[2U];
+	XAie_ElfSymHandle Hdl[2U];
+
+	RC = XAie_ElfSymPrepare(DevInst, Map, Name0, &Hdl[0U]);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_ElfSymPrepare(DevInst, Map, Name1, &Hdl[1U]);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if((Hdl[0U].Loc.Col != Hdl[1U].Loc.Col) ||
+			(Hdl[0U].Loc.Row != Hdl[1U].Loc.Row) ||
+			(Hdl[0U].Size != Hdl[1U].Size)) {
+		XAIE_ERROR("Symbols %s and %s are not buffers of one channel\n",
+				Name0, Name1);
+		return XAIE_INVALID_ARGS;
+	}
+
+	BufAddr[0U] = Hdl[0U].Addr;
+	BufAddr[1U] = Hdl[1U].Addr;
+
+	return XAie_RtpChannelInit(DevInst, Chan, Hdl[0U].Loc, BufAddr,
+			Hdl[0U].Size, LockId);
+}
+#endif /* XAIE_FEATURE_ELF_ENABLE */
+
+/*****************************************************************************/
+/**
+*
+* This API selects the buffer an update of a channel is written to. If the
+* last update is still published, it is taken back with a non-blocking lock
+* acquire and its buffer is rewritten. Otherwise the core took it and the next
+* update goes to the other buffer.
+*
+* @param	DevInst: Device Instance
+* @param	Chan: Runtime parameter channel.
+*
+* @return	None.
+*
+* @note		Internal only. Chan->Next is the buffer to write, owned by the
+*		host. It has to be called out of a transaction, as it
+*		needs the result of the lock acquire.
+*
+******************************************************************************/
+static void _XAie_RtpGetBuffer(XAie_DevInst *DevInst, XAie_RtpChannel *Chan)
+{
+	if(Chan->Pending != 0U) {
+		Chan->Pending = 0U;
+		if(XAie_LockAcquire(DevInst, Chan->Loc,
+					XAie_LockInit(Chan->LockId[Chan->Next],
+						Chan->ReclaimVal),
+					0U) != XAIE_OK) {
+			Chan->Next ^= 1U;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes an update to a buffer of a channel and publishes it.
+*
+* @param	DevInst: Device Instance
+* @param	Chan: Runtime parameter channel.
+* @param	Src: Update of Chan->Size bytes.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_RtpPublish(XAie_DevInst *DevInst, XAie_RtpChannel *Chan,
+		const void *Src)
+{
+	AieRC RC;
+	u8 Buf = Chan->Next;
+
+	RC = XAie_DataMemBlockWrite(DevInst, Chan->Loc, Chan->BufAddr[Buf],
+			Src, Chan->Size);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	return XAie_LockRelease(DevInst, Chan->Loc,
+			XAie_LockInit(Chan->LockId[Buf], 1), 0U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sends an update of a runtime parameter channel. The update is
+* written to the buffer the core does not use and published with a lock
+* release, so the core takes it at its next iteration without waiting.
+*
+* @param	DevInst: Device Instance
+* @param	Chan: Runtime parameter channel.
+* @param	Src: Update of the size of the buffers of the channel.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		It cannot be recorded in a transaction opened by the caller.
+*		Updates of many channels should be sent with
+*		XAie_RtpUpdateMulti().
+*
+******************************************************************************/
+AieRC XAie_RtpUpdate(XAie_DevInst *DevInst, XAie_RtpChannel *Chan,
+		const void *Src)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Chan == XAIE_NULL) ||
+			(Src == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Chan->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE) {
+		XAIE_ERROR("Runtime parameter update in a transaction\n");
+		return XAIE_ERR;
+	}
+
+	_XAie_RtpGetBuffer(DevInst, Chan);
+	RC = _XAie_RtpPublish(DevInst, Chan, Src);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Chan->Pending = 1U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sends the updates of many runtime parameter channels, which can be
+* spread over several tiles. The buffers to write are chosen first, then the
+* buffer writes and lock releases of all the channels are sent in one
+* transaction.
+*
+* @param	DevInst: Device Instance
+* @param	Chans: Array of pointers to the channels.
+* @param	Srcs: Array of the updates of the channels.
+* @param	NumChans: Number of channels.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		A channel can appear once per call. On failure, none of the
+*		updates is considered published and the next update of each
+*		channel rewrites the same buffer.
+*
+******************************************************************************/
+AieRC XAie_RtpUpdateMulti(XAie_DevInst *DevInst,
+		XAie_RtpChannel *const *Chans, const void *const *Srcs,
+		u32 NumChans)
+{
+	AieRC RC = XAIE_OK;
+
+	if((DevInst == XAIE_NULL) || (Chans == XAIE_NULL) ||
+			(Srcs == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumChans; i++) {
+		if((Chans[i] == XAIE_NULL) || (Srcs[i] == XAIE_NULL) ||
+				(Chans[i]->IsReady !=
+				 XAIE_COMPONENT_IS_READY)) {
+			XAIE_ERROR("Invalid runtime parameter channel %u\n",
+					i);
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE) {
+		XAIE_ERROR("Runtime parameter update in a transaction\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumChans; i++) {
+		_XAie_RtpGetBuffer(DevInst, Chans[i]);
+	}
+
+	RC = _XAie_Txn_Start(DevInst, XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	for(u32 i = 0U; i < NumChans; i++) {
+		RC = _XAie_RtpPublish(DevInst, Chans[i], Srcs[i]);
+		if(RC != XAIE_OK) {
+			break;
+		}
+	}
+
+	if(RC == XAIE_OK) {
+		RC = _XAie_Txn_Submit(DevInst, NULL);
+	} else {
+		XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+		if(TxnInst != NULL) {
+			_XAie_TxnFree(TxnInst);
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Runtime parameter updates failed\n");
+		return RC;
+	}
+
+	for(u32 i = 0U; i < NumChans; i++) {
+		Chans[i]->Pending = 1U;
+	}
+
+	return XAIE_OK;
+}
+
+#endif /* XAIE_FEATURE_DATAMEM_ENABLE && XAIE_FEATURE_LOCK_ENABLE */
+
+/** @} */
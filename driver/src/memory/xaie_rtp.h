@@ -0,0 +1,68 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_rtp.h
+* @{
+*
+* This file contains routines for the double buffered runtime parameter
+* channels of AIE tiles.
+*
+******************************************************************************/
+#ifndef XAIE_RTP_H
+#define XAIE_RTP_H
+
+/***************************** Include Files *********************************/
+#include "xaie_feature_config.h"
+#include "xaiegbl.h"
+
+#if defined(XAIE_FEATURE_DATAMEM_ENABLE) && defined(XAIE_FEATURE_LOCK_ENABLE)
+
+#include "xaie_elfloader.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures a runtime parameter channel. The channel owns two
+ * buffers in the data memory of a tile and one lock per buffer on the same
+ * tile. The host writes the buffer the core does not use and releases its
+ * lock to publish it. The core takes an update by acquiring the lock of the
+ * other buffer than the one it uses, without blocking, at the start of an
+ * iteration; AIE cores then release that lock with value 0. An update the
+ * core did not take yet is taken back by the host and rewritten, so the core
+ * never waits on the host and always takes the latest update.
+ */
+typedef struct {
+	XAie_LocType Loc;	/* Tile of the buffers and locks */
+	u32 BufAddr[2U];	/* Data memory address of each buffer */
+	u32 Size;		/* Size of each buffer in bytes */
+	u8 LockId[2U];		/* Lock of each buffer */
+	s8 ReclaimVal;		/* Acquire value which takes an update back */
+	u8 Next;		/* Buffer the core takes next */
+	u8 Pending;		/* Next is published, not taken yet */
+	u8 IsReady;
+} XAie_RtpChannel;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_RtpChannelInit(XAie_DevInst *DevInst, XAie_RtpChannel *Chan,
+		XAie_LocType Loc, const u32 *BufAddr, u32 Size,
+		const u8 *LockId);
+#ifdef XAIE_FEATURE_ELF_ENABLE
+AieRC XAie_RtpChannelInitSym(XAie_DevInst *DevInst, XAie_RtpChannel *Chan,
+		const XAie_ElfSymMap *Map, const char *Name0,
+		const char *Name1, const u8 *LockId);
+#endif
+AieRC XAie_RtpUpdate(XAie_DevInst *DevInst, XAie_RtpChannel *Chan,
+		const void *Src);
+AieRC XAie_RtpUpdateMulti(XAie_DevInst *DevInst,
+		XAie_RtpChannel *const *Chans, const void *const *Srcs,
+		u32 NumChans);
+
+#endif /* XAIE_FEATURE_DATAMEM_ENABLE && XAIE_FEATURE_LOCK_ENABLE */
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -21,11 +21,17 @@
 #ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
 
 /************************** Constant Definitions *****************************/
+#define XAIE_NPI_REQ_LIST_MAX		8U
+
 /****************************** Type Definitions *****************************/
 
 /************************** Variable Definitions *****************************/
+#ifdef XAIE_DEV_AIE_ENABLE
 extern XAie_NpiMod _XAieNpiMod;
+#endif
+#ifdef XAIE_DEV_AIEML_ENABLE
 extern XAie_NpiMod _XAieMlNpiMod;
+#endif
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -47,11 +53,16 @@ static XAie_NpiMod *_XAie_NpiGetMod(XAie_DevInst *DevInst)
 		return NULL;
 	}
 
+#ifdef XAIE_DEV_AIE_ENABLE
 	if (DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) {
 		return &_XAieNpiMod;
-	} else if (DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIEML) {
+	}
+#endif
+#ifdef XAIE_DEV_AIEML_ENABLE
+	if (DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIEML) {
 		return &_XAieMlNpiMod;
 	}
+#endif
 
 	XAIE_ERROR("failed to get NPI module, invalid dev version.\n");
 	return NULL;
@@ -95,6 +106,105 @@ static AieRC _XAie_NpiSetLock(XAie_DevInst *DevInst, u8 Lock)
 	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_NPIMASKPOLL32, &MPReq);
 }
 
+/*****************************************************************************/
+/**
+*
+* This is function to append an NPI write to an NPI request list
+*
+* @param	Reqs : NPI request list
+* @param	NumReqs : Pointer to the number of requests of the list
+* @param	RegOff : NPI register offset
+* @param	RegVal : Value to write
+*
+* @return	None.
+*
+* @note		The caller makes sure the list is large enough.
+*******************************************************************************/
+static void _XAie_NpiAddWrReq(XAie_BackendNpiReq *Reqs, u32 *NumReqs,
+		u32 RegOff, u32 RegVal)
+{
+	XAie_BackendNpiReq *Req = &Reqs[(*NumReqs)++];
+
+	Req->Type = XAIE_BACKEND_NPI_REQ_WR32;
+	Req->NpiRegOff = RegOff;
+	Req->Mask = 0U;
+	Req->Val = RegVal;
+	Req->TimeOutUs = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is function to append an NPI mask poll to an NPI request list
+*
+* @param	Reqs : NPI request list
+* @param	NumReqs : Pointer to the number of requests of the list
+* @param	RegOff : NPI register offset
+* @param	Mask : Mask to apply to the register value
+* @param	RegVal : Value to poll for
+*
+* @return	None.
+*
+* @note		The caller makes sure the list is large enough.
+*******************************************************************************/
+static void _XAie_NpiAddMaskPollReq(XAie_BackendNpiReq *Reqs, u32 *NumReqs,
+		u32 RegOff, u32 Mask, u32 RegVal)
+{
+	XAie_BackendNpiReq *Req = &Reqs[(*NumReqs)++];
+
+	Req->Type = XAIE_BACKEND_NPI_REQ_MASKPOLL32;
+	Req->NpiRegOff = RegOff;
+	Req->Mask = Mask;
+	Req->Val = RegVal;
+	Req->TimeOutUs = XAIE_NPI_TIMEOUT_US;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is function to run NPI requests between unlocking and locking the PCSR
+* register, with a single backend operation.
+*
+* @param	DevInst : AI engine device pointer
+* @param	NpiMod : NPI module
+* @param	Reqs : NPI requests to run while the PCSR register is unlocked
+* @param	NumReqs : Number of requests, at most XAIE_NPI_REQ_LIST_MAX
+*
+* @return	XAIE_OK for success, and error value for failure
+*
+* @note		If a request fails, the PCSR register is locked again before
+*		returning.
+*******************************************************************************/
+static AieRC _XAie_NpiRunLocked(XAie_DevInst *DevInst,
+		const XAie_NpiMod *NpiMod, const XAie_BackendNpiReq *Reqs,
+		u32 NumReqs)
+{
+	XAie_BackendNpiReq List[XAIE_NPI_REQ_LIST_MAX + 4U];
+	XAie_BackendNpiReqList ReqList;
+	u32 Num = 0U;
+	AieRC RC;
+
+	/* TODO: Use proper mask to verify if bit is set correctly */
+	_XAie_NpiAddWrReq(List, &Num, NpiMod->PcsrLockOff,
+			NpiMod->PcsrUnlockCode);
+	_XAie_NpiAddMaskPollReq(List, &Num, NpiMod->PcsrLockOff, 0U, 0U);
+	for(u32 i = 0U; i < NumReqs; i++) {
+		List[Num++] = Reqs[i];
+	}
+	_XAie_NpiAddWrReq(List, &Num, NpiMod->PcsrLockOff, 0U);
+	_XAie_NpiAddMaskPollReq(List, &Num, NpiMod->PcsrLockOff, 0U, 0U);
+
+	ReqList.Reqs = List;
+	ReqList.NumReqs = Num;
+	RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_NPI_REQ_LIST,
+			(void *)&ReqList);
+	if(RC != XAIE_OK) {
+		_XAie_NpiSetLock(DevInst, XAIE_ENABLE);
+	}
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -116,37 +226,21 @@ static AieRC _XAie_NpiSetLock(XAie_DevInst *DevInst, u8 Lock)
 static AieRC _XAie_NpiWritePcsr(XAie_DevInst *DevInst, u32 RegVal, u32 Mask)
 {
 	XAie_NpiMod *NpiMod;
-	XAie_BackendNpiWrReq Req;
-	XAie_BackendNpiMaskPollReq MPReq;
-	AieRC RC;
+	XAie_BackendNpiReq Reqs[XAIE_NPI_REQ_LIST_MAX];
+	u32 NumReqs = 0U;
 
 	NpiMod = _XAie_NpiGetMod(DevInst);
 	if (NpiMod == NULL) {
 		return XAIE_ERR;
 	}
 
-	RC = _XAie_NpiSetLock(DevInst, XAIE_DISABLE);
-	if (RC != XAIE_OK) {
-		return RC;
-	}
-
-	Req = _XAie_SetBackendNpiWrReq(NpiMod->PcsrMaskOff, Mask);
-	XAie_RunOp(DevInst, XAIE_BACKEND_OP_NPIWR32, &Req);
-
-	Req = _XAie_SetBackendNpiWrReq(NpiMod->PcsrCntrOff, RegVal);
-	XAie_RunOp(DevInst, XAIE_BACKEND_OP_NPIWR32, &Req);
-
-	Req = _XAie_SetBackendNpiWrReq(NpiMod->PcsrMaskOff, 0);
-	XAie_RunOp(DevInst, XAIE_BACKEND_OP_NPIWR32, &Req);
-
+	_XAie_NpiAddWrReq(Reqs, &NumReqs, NpiMod->PcsrMaskOff, Mask);
+	_XAie_NpiAddWrReq(Reqs, &NumReqs, NpiMod->PcsrCntrOff, RegVal);
+	_XAie_NpiAddWrReq(Reqs, &NumReqs, NpiMod->PcsrMaskOff, 0U);
 	/* TODO: Use proper mask to verify if bit is set correctly */
-	MPReq = _XAie_SetBackendNpiMaskPollReq(NpiMod->PcsrCntrOff, 0U,
-			0U, XAIE_NPI_TIMEOUT_US);
-
-	RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_NPIMASKPOLL32, &MPReq);
-	_XAie_NpiSetLock(DevInst, XAIE_ENABLE);
+	_XAie_NpiAddMaskPollReq(Reqs, &NumReqs, NpiMod->PcsrCntrOff, 0U, 0U);
 
-	return RC;
+	return _XAie_NpiRunLocked(DevInst, NpiMod, Reqs, NumReqs);
 }
 
 /*****************************************************************************/
@@ -195,10 +289,9 @@ AieRC _XAie_NpiSetShimReset(XAie_DevInst *DevInst, u8 RstEnable)
 AieRC _XAie_NpiSetProtectedRegEnable(XAie_DevInst *DevInst,
 				    XAie_NpiProtRegReq *Req)
 {
-	u32 RegVal;
+	u32 RegVal, NumReqs = 0U;
 	XAie_NpiMod *NpiMod;
-	XAie_BackendNpiWrReq IOReq;
-	XAie_BackendNpiMaskPollReq MPReq;
+	XAie_BackendNpiReq Reqs[XAIE_NPI_REQ_LIST_MAX];
 	AieRC RC;
 
 	NpiMod = _XAie_NpiGetMod(DevInst);
@@ -211,27 +304,11 @@ AieRC _XAie_NpiSetProtectedRegEnable(XAie_DevInst *DevInst,
 		return RC;
 	}
 
-	IOReq = _XAie_SetBackendNpiWrReq(NpiMod->ProtRegOff, RegVal);
-
-	RC = _XAie_NpiSetLock(DevInst, XAIE_DISABLE);
-	if (RC != XAIE_OK) {
-		return RC;
-	}
-
-	RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_NPIWR32, &IOReq);
-	if (RC != XAIE_OK) {
-		_XAie_NpiSetLock(DevInst, XAIE_ENABLE);
-		return RC;
-	}
-
+	_XAie_NpiAddWrReq(Reqs, &NumReqs, NpiMod->ProtRegOff, RegVal);
 	/* TODO: Use proper mask to verify if bit is set correctly */
-	MPReq = _XAie_SetBackendNpiMaskPollReq(NpiMod->ProtRegOff, 0U,
-			0U, XAIE_NPI_TIMEOUT_US);
-
-	RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_NPIMASKPOLL32, &MPReq);
-	_XAie_NpiSetLock(DevInst, XAIE_ENABLE);
+	_XAie_NpiAddMaskPollReq(Reqs, &NumReqs, NpiMod->ProtRegOff, 0U, 0U);
 
-	return RC;
+	return _XAie_NpiRunLocked(DevInst, NpiMod, Reqs, NumReqs);
 }
 
 /*****************************************************************************/
@@ -253,10 +330,9 @@ AieRC _XAie_NpiSetProtectedRegEnable(XAie_DevInst *DevInst,
 static AieRC _XAie_NpiIrqConfig(XAie_DevInst *DevInst, u8 Ops, u8 NpiIrqID,
 				u8 AieIrqID)
 {
-	u32 RegOff;
+	u32 RegOff, NumReqs = 0U;
 	XAie_NpiMod *NpiMod;
-	XAie_BackendNpiWrReq IOReq;
-	AieRC RC;
+	XAie_BackendNpiReq Req;
 
 	NpiMod = _XAie_NpiGetMod(DevInst);
 	if (NpiMod == NULL) {
@@ -289,17 +365,9 @@ static AieRC _XAie_NpiIrqConfig(XAie_DevInst *DevInst, u8 Ops, u8 NpiIrqID,
 				(NpiIrqID + 1) * NpiMod->IrqDisableOff;
 	}
 
-	IOReq = _XAie_SetBackendNpiWrReq(RegOff, 1U << AieIrqID);
-
-	RC = _XAie_NpiSetLock(DevInst, XAIE_DISABLE);
-	if (RC != XAIE_OK) {
-		return RC;
-	}
-
-	RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_NPIWR32, &IOReq);
-	_XAie_NpiSetLock(DevInst, XAIE_ENABLE);
+	_XAie_NpiAddWrReq(&Req, &NumReqs, RegOff, 1U << AieIrqID);
 
-	return RC;
+	return _XAie_NpiRunLocked(DevInst, NpiMod, &Req, NumReqs);
 }
 
 /*****************************************************************************/
@@ -19,7 +19,7 @@
 #include "xaie_npi.h"
 #include "xaiegbl.h"
 
-#ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
+#if defined(XAIE_FEATURE_PRIVILEGED_ENABLE) && defined(XAIE_DEV_AIE_ENABLE)
 
 /************************** Constant Definitions *****************************/
 #define XAIE_NPI_PCSR_MASK				0x00000000U
@@ -91,5 +91,5 @@ static AieRC _XAie_NpiSetProtectedRegField(XAie_DevInst *DevInst,
 	return XAIE_OK;
 }
 
-#endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
+#endif /* XAIE_FEATURE_PRIVILEGED_ENABLE && XAIE_DEV_AIE_ENABLE */
 /** @} */
@@ -19,7 +19,7 @@
 #include "xaie_npi.h"
 #include "xaiegbl.h"
 
-#ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
+#if defined(XAIE_FEATURE_PRIVILEGED_ENABLE) && defined(XAIE_DEV_AIEML_ENABLE)
 
 /************************** Constant Definitions *****************************/
 #define XAIEML_NPI_PCSR_UNLOCK_CODE			0xF9E8D7C6U
@@ -117,5 +117,5 @@ static AieRC _XAieMl_NpiSetProtectedRegField(XAie_DevInst *DevInst,
 	return XAIE_OK;
 }
 
-#endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
+#endif /* XAIE_FEATURE_PRIVILEGED_ENABLE && XAIE_DEV_AIEML_ENABLE */
 /** @} */
@@ -27,6 +27,8 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+
 #include "xaie_feature_config.h"
 #include "xaie_perfcnt.h"
 #include "xaie_events.h"
@@ -70,7 +72,7 @@ AieRC XAie_PerfCounterGet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -141,7 +143,7 @@ AieRC XAie_PerfCounterControlSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -245,7 +247,7 @@ AieRC XAie_PerfCounterResetControlSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -343,7 +345,7 @@ AieRC XAie_PerfCounterSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -410,7 +412,7 @@ AieRC XAie_PerfCounterEventValueSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -523,7 +525,7 @@ AieRC XAie_PerfCounterResetControlReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -584,7 +586,7 @@ AieRC XAie_PerfCounterControlReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -655,7 +657,7 @@ AieRC XAie_PerfCounterGetControlConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		return XAIE_INVALID_TILE;
 	}
@@ -756,7 +758,7 @@ AieRC XAie_PerfCounterGetEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -776,4 +778,233 @@ AieRC XAie_PerfCounterGetEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return RC;
 }
 
+/*****************************************************************************/
+/* This API sets up a snapshot of the performance counters, and optionally the
+*  timers, of a set of modules. The modules are validated and the register
+*  addresses are computed once, so reading the snapshot only issues the reads.
+*
+* @param	DevInst: Device Instance
+* @param	Snap: Caller owned snapshot to set up.
+* @param	Locs: Location of the tile of each entry.
+* @param	Modules: Module of each entry.
+*			For AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			For Pl or Shim tile - XAIE_PL_MOD,
+*			For Mem tile - XAIE_MEM_MOD.
+* @param	NumEntries: Number of entries in Locs and Modules.
+* @param	NumCounters: Number of counters read per entry, starting from
+*		counter 0. Can be 0 to read timers only.
+* @param	ReadTimers: XAIE_ENABLE to also read the timer of each module.
+* @return	XAIE_OK on success
+*		XAIE_INVALID_ARGS if any argument is invalid
+*		XAIE_INVALID_TILE if tile type from Loc is invalid
+*		XAIE_ERR if memory allocation fails
+*
+* @note		The snapshot has to be released with XAie_PerfSnapshotFree().
+*
+******************************************************************************/
+AieRC XAie_PerfSnapshotInit(XAie_DevInst *DevInst, XAie_PerfSnapshot *Snap,
+		const XAie_LocType *Locs, const XAie_ModuleType *Modules,
+		u32 NumEntries, u8 NumCounters, u8 ReadTimers)
+{
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Snap == XAIE_NULL) || (Locs == XAIE_NULL) ||
+			(Modules == XAIE_NULL) || (NumEntries == 0U) ||
+			((NumCounters == 0U) && (ReadTimers == XAIE_DISABLE))) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumEntries; i++) {
+		const XAie_PerfMod *PerfMod;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Locs[i]);
+		if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+			XAIE_ERROR("Invalid Tile Type\n");
+			return XAIE_INVALID_TILE;
+		}
+
+		if(_XAie_CheckModule(DevInst, Locs[i], Modules[i]) != XAIE_OK) {
+			return XAIE_INVALID_ARGS;
+		}
+
+		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[
+			(Modules[i] == XAIE_PL_MOD) ? 0U : Modules[i]];
+		if(NumCounters > PerfMod->MaxCounterVal) {
+			XAIE_ERROR("Invalid number of counters: %d\n",
+					NumCounters);
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	Snap->IsReady = 0U;
+	Snap->NumEntries = NumEntries;
+	Snap->NumCounters = NumCounters;
+	Snap->CounterVals = NULL;
+	Snap->TimerVals = NULL;
+	Snap->CounterAddrs = (u64 *)malloc(NumEntries * sizeof(u64));
+	Snap->TimerAddrs = (u64 *)malloc(2U * NumEntries * sizeof(u64));
+	Snap->Strides = (u8 *)malloc(NumEntries * sizeof(u8));
+	if(NumCounters > 0U) {
+		Snap->CounterVals = (u32 *)calloc((size_t)NumEntries *
+				NumCounters, sizeof(u32));
+	}
+	if(ReadTimers == XAIE_ENABLE) {
+		Snap->TimerVals = (u64 *)calloc(NumEntries, sizeof(u64));
+	}
+	if((Snap->CounterAddrs == NULL) || (Snap->TimerAddrs == NULL) ||
+			(Snap->Strides == NULL) ||
+			((NumCounters > 0U) && (Snap->CounterVals == NULL)) ||
+			((ReadTimers == XAIE_ENABLE) &&
+			 (Snap->TimerVals == NULL))) {
+		XAIE_ERROR("Memory allocation for snapshot failed\n");
+		free(Snap->CounterAddrs);
+		free(Snap->TimerAddrs);
+		free(Snap->Strides);
+		free(Snap->CounterVals);
+		free(Snap->TimerVals);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumEntries; i++) {
+		const XAie_PerfMod *PerfMod;
+		const XAie_TimerMod *TimerMod;
+		u64 TileAddr;
+		u8 TileType, Mod;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Locs[i]);
+		Mod = (Modules[i] == XAIE_PL_MOD) ? 0U : (u8)Modules[i];
+		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[Mod];
+		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[Mod];
+		TileAddr = _XAie_GetTileAddr(DevInst, Locs[i].Row, Locs[i].Col);
+
+		Snap->CounterAddrs[i] = TileAddr + PerfMod->PerfCounterBaseAddr;
+		Snap->Strides[i] = PerfMod->PerfCounterOffsetAdd;
+		Snap->TimerAddrs[2U * i] = TileAddr + TimerMod->LowOff;
+		Snap->TimerAddrs[2U * i + 1U] = TileAddr + TimerMod->HighOff;
+	}
+
+	Snap->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/* This API reads the counters and timers of all the entries of a snapshot.
+*  The counters of a module, and the two halves of its timer, are fetched with
+*  one block read when they are contiguous, so a snapshot costs one or two
+*  reads per module.
+*
+* @param	DevInst: Device Instance
+* @param	Snap: Snapshot set up by XAie_PerfSnapshotInit().
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The timer of an entry is read right after its counters, so
+*		rates can be derived per entry even if the modules are read at
+*		different times.
+*
+******************************************************************************/
+AieRC XAie_PerfSnapshotRead(XAie_DevInst *DevInst, XAie_PerfSnapshot *Snap)
+{
+	AieRC RC = XAIE_OK;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Snap == XAIE_NULL) || (Snap->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid snapshot\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; (i < Snap->NumEntries) && (RC == XAIE_OK); i++) {
+		if(Snap->NumCounters > 0U) {
+			u32 *Vals = &Snap->CounterVals[(size_t)i *
+				Snap->NumCounters];
+
+			if(Snap->Strides[i] == sizeof(u32)) {
+				RC = XAie_BlockRead32(DevInst,
+						Snap->CounterAddrs[i], Vals,
+						Snap->NumCounters);
+			} else {
+				for(u8 c = 0U; (c < Snap->NumCounters) &&
+						(RC == XAIE_OK); c++) {
+					RC = XAie_Read32(DevInst,
+						Snap->CounterAddrs[i] +
+						(u64)c * Snap->Strides[i],
+						&Vals[c]);
+				}
+			}
+			if(RC != XAIE_OK) {
+				break;
+			}
+		}
+
+		if(Snap->TimerVals != NULL) {
+			u32 Timer[2U];
+			const u64 *Addrs = &Snap->TimerAddrs[2U * i];
+
+			if(Addrs[1U] == Addrs[0U] + sizeof(u32)) {
+				RC = XAie_BlockRead32(DevInst, Addrs[0U],
+						Timer, 2U);
+			} else {
+				RC = XAie_Read32(DevInst, Addrs[0U],
+						&Timer[0U]);
+				if(RC == XAIE_OK) {
+					RC = XAie_Read32(DevInst, Addrs[1U],
+							&Timer[1U]);
+				}
+			}
+			if(RC != XAIE_OK) {
+				break;
+			}
+			Snap->TimerVals[i] = ((u64)Timer[1U] << 32U) | Timer[0U];
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to read performance snapshot\n");
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/* This API releases the memory of a snapshot.
+*
+* @param	Snap: Snapshot set up by XAie_PerfSnapshotInit().
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if Snap is invalid.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_PerfSnapshotFree(XAie_PerfSnapshot *Snap)
+{
+	if((Snap == XAIE_NULL) || (Snap->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid snapshot\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(Snap->CounterAddrs);
+	free(Snap->TimerAddrs);
+	free(Snap->Strides);
+	free(Snap->CounterVals);
+	free(Snap->TimerVals);
+	Snap->CounterAddrs = NULL;
+	Snap->TimerAddrs = NULL;
+	Snap->Strides = NULL;
+	Snap->CounterVals = NULL;
+	Snap->TimerVals = NULL;
+	Snap->IsReady = 0U;
+
+	return XAIE_OK;
+}
+
 #endif /* XAIE_FEATURE_PERFCOUNT_ENABLE */
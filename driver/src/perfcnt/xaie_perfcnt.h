@@ -30,6 +30,23 @@
 #include "xaiegbl_defs.h"
 #include "xaiegbl_defs.h"
 
+/**************************** Type Definitions *******************************/
+/*
+ * Snapshot of the performance counters and timers of a set of modules. The
+ * values are stored as one array per quantity, indexed by entry. It is set up
+ * by XAie_PerfSnapshotInit() and refreshed by XAie_PerfSnapshotRead().
+ */
+typedef struct {
+	u32 NumEntries;		/* Number of modules in the snapshot */
+	u8 NumCounters;		/* Counters 0 to NumCounters - 1 are read */
+	u32 *CounterVals;	/* Counter c of entry i at i * NumCounters + c */
+	u64 *TimerVals;		/* Timer of entry i, NULL if timers not read */
+	u64 *CounterAddrs;	/* Address of counter 0 of each entry */
+	u64 *TimerAddrs;	/* Timer low and high address of each entry */
+	u8 *Strides;		/* Counter register stride of each entry */
+	u8 IsReady;
+} XAie_PerfSnapshot;
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_PerfCounterGet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, u8 Counter, u32 *CounterVal);
@@ -55,4 +72,9 @@ AieRC XAie_PerfCounterGetControlConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_Events *StopEvent, XAie_Events *ResetEvent);
 AieRC XAie_PerfCounterGetEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, XAie_Events *Event);
+AieRC XAie_PerfSnapshotInit(XAie_DevInst *DevInst, XAie_PerfSnapshot *Snap,
+		const XAie_LocType *Locs, const XAie_ModuleType *Modules,
+		u32 NumEntries, u8 NumCounters, u8 ReadTimers);
+AieRC XAie_PerfSnapshotRead(XAie_DevInst *DevInst, XAie_PerfSnapshot *Snap);
+AieRC XAie_PerfSnapshotFree(XAie_PerfSnapshot *Snap);
 #endif		/* end of protection macro */
@@ -0,0 +1,504 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_perfcnt64.c
+* @{
+*
+* This file contains routines for 64-bit virtual performance counters. Each
+* virtual counter samples a free running 32-bit hardware counter and adds the
+* increment since the previous sample, modulo 2^32, to a 64-bit value on the
+* host. The hardware counter has to be sampled at least once per wrap period
+* of the counter, which a host thread can do in the background.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifndef __AIEBAREMETAL__
+#define  _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdlib.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_perfcnt64.h"
+
+#ifdef XAIE_FEATURE_PERFCOUNT_ENABLE
+
+/**************************** Type Definitions *******************************/
+/* State of one virtual counter */
+typedef struct {
+	u64 RegAddr;	/* Address of the hardware counter */
+	u64 Val;	/* 64-bit value */
+	u32 Last;	/* Hardware value at the previous sample */
+} XAie_PerfCounter64Entry;
+
+struct XAie_PerfCounter64 {
+	XAie_DevInst *DevInst;
+	XAie_PerfCounter64Entry *Entries;
+	u32 NumEntries;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+	pthread_t Thread;
+	u32 PeriodUs;
+	u8 Running;
+	u8 Stop;
+	AieRC Status;	/* Error which stopped the sampling thread */
+#endif
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API takes the lock protecting the values of a set of virtual counters.
+*
+* @param	Cntr: Virtual counters.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_PerfCounter64Lock(XAie_PerfCounter64 *Cntr)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_lock(&Cntr->Lock);
+#else
+	(void)Cntr;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the lock protecting the values of a set of virtual
+* counters.
+*
+* @param	Cntr: Virtual counters.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_PerfCounter64Unlock(XAie_PerfCounter64 *Cntr)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_unlock(&Cntr->Lock);
+#else
+	(void)Cntr;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API samples the hardware counter of one virtual counter and accumulates
+* its increment.
+*
+* @param	Cntr: Virtual counters.
+* @param	Entry: Virtual counter to update.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. The caller holds the lock of the counters.
+*
+******************************************************************************/
+static AieRC _XAie_PerfCounter64Sample(XAie_PerfCounter64 *Cntr,
+		XAie_PerfCounter64Entry *Entry)
+{
+	AieRC RC;
+	u32 Cur;
+
+	RC = _XAie_IORead32(Cntr->DevInst, Entry->RegAddr, &Cur);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to read performance counter\n");
+		return RC;
+	}
+
+	/* Unsigned subtraction gives the increment across a wrap */
+	Entry->Val += (u32)(Cur - Entry->Last);
+	Entry->Last = Cur;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a set of 64-bit virtual counters over hardware performance
+* counters. Each virtual counter starts at the current value of its hardware
+* counter.
+*
+* @param	DevInst: Device Instance
+* @param	Rscs: Hardware counters, as returned by XAie_RequestPerfcnt().
+*		Loc and Mod select the module, RscId the counter.
+* @param	NumRscs: Number of counters in Rscs.
+*
+* @return	Pointer to the virtual counters on success, NULL on failure.
+*
+* @note		The hardware counters must be free running, i.e. have no reset
+*		event, as a reset would be accumulated as a wrap. The virtual
+*		counters have to be released with XAie_PerfCounter64Free().
+*
+******************************************************************************/
+XAie_PerfCounter64* XAie_PerfCounter64Create(XAie_DevInst *DevInst,
+		const XAie_UserRsc *Rscs, u32 NumRscs)
+{
+	XAie_PerfCounter64 *Cntr;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return NULL;
+	}
+
+	if((Rscs == NULL) || (NumRscs == 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return NULL;
+	}
+
+	for(u32 i = 0U; i < NumRscs; i++) {
+		const XAie_PerfMod *PerfMod;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				Rscs[i].Loc);
+		if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+			XAIE_ERROR("Invalid Tile Type\n");
+			return NULL;
+		}
+
+		if(_XAie_CheckModule(DevInst, Rscs[i].Loc,
+					(XAie_ModuleType)Rscs[i].Mod) != XAIE_OK) {
+			return NULL;
+		}
+
+		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[
+			(Rscs[i].Mod == XAIE_PL_MOD) ? 0U : Rscs[i].Mod];
+		if(Rscs[i].RscId >= PerfMod->MaxCounterVal) {
+			XAIE_ERROR("Invalid Counter number: %d\n",
+					Rscs[i].RscId);
+			return NULL;
+		}
+	}
+
+	Cntr = (XAie_PerfCounter64 *)calloc(1U, sizeof(*Cntr));
+	if(Cntr == NULL) {
+		XAIE_ERROR("Memory allocation for virtual counters failed\n");
+		return NULL;
+	}
+
+	Cntr->Entries = (XAie_PerfCounter64Entry *)calloc(NumRscs,
+			sizeof(*Cntr->Entries));
+	if(Cntr->Entries == NULL) {
+		XAIE_ERROR("Memory allocation for virtual counters failed\n");
+		free(Cntr);
+		return NULL;
+	}
+
+	Cntr->DevInst = DevInst;
+	Cntr->NumEntries = NumRscs;
+	for(u32 i = 0U; i < NumRscs; i++) {
+		const XAie_PerfMod *PerfMod;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				Rscs[i].Loc);
+		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[
+			(Rscs[i].Mod == XAIE_PL_MOD) ? 0U : Rscs[i].Mod];
+		Cntr->Entries[i].RegAddr = _XAie_GetTileAddr(DevInst,
+				Rscs[i].Loc.Row, Rscs[i].Loc.Col) +
+			PerfMod->PerfCounterBaseAddr +
+			Rscs[i].RscId * PerfMod->PerfCounterOffsetAdd;
+
+		if(_XAie_PerfCounter64Sample(Cntr, &Cntr->Entries[i]) !=
+				XAIE_OK) {
+			free(Cntr->Entries);
+			free(Cntr);
+			return NULL;
+		}
+	}
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_init(&Cntr->Lock, NULL);
+#endif
+
+	return Cntr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API samples all the hardware counters of a set of virtual counters and
+* accumulates their increments.
+*
+* @param	Cntr: Virtual counters.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Has to be called at least once per wrap period of the hardware
+*		counters, unless the sampling thread is running. The reads go
+*		to the backend directly, they are neither recorded in the
+*		transaction of the calling thread nor looked up in the shadow
+*		cache.
+*
+******************************************************************************/
+AieRC XAie_PerfCounter64Update(XAie_PerfCounter64 *Cntr)
+{
+	AieRC RC = XAIE_OK;
+
+	if(Cntr == NULL) {
+		XAIE_ERROR("Invalid virtual counters\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_PerfCounter64Lock(Cntr);
+	for(u32 i = 0U; i < Cntr->NumEntries; i++) {
+		RC = _XAie_PerfCounter64Sample(Cntr, &Cntr->Entries[i]);
+		if(RC != XAIE_OK) {
+			break;
+		}
+	}
+	_XAie_PerfCounter64Unlock(Cntr);
+
+	return RC;
+}
+
+#ifndef __AIEBAREMETAL__
+/*****************************************************************************/
+/**
+*
+* This is the body of the sampling thread of a set of virtual counters. It
+* updates the counters once per period until it is asked to stop or an update
+* fails.
+*
+* @param	Arg: Virtual counters.
+*
+* @return	NULL.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void *_XAie_PerfCounter64Worker(void *Arg)
+{
+	XAie_PerfCounter64 *Cntr = (XAie_PerfCounter64 *)Arg;
+	struct timespec Period;
+
+	while(1) {
+		AieRC RC;
+		u8 Stop;
+
+		pthread_mutex_lock(&Cntr->Lock);
+		Stop = Cntr->Stop;
+		pthread_mutex_unlock(&Cntr->Lock);
+		if(Stop != 0U) {
+			break;
+		}
+
+		RC = XAie_PerfCounter64Update(Cntr);
+		if(RC != XAIE_OK) {
+			pthread_mutex_lock(&Cntr->Lock);
+			Cntr->Status = RC;
+			pthread_mutex_unlock(&Cntr->Lock);
+			break;
+		}
+
+		Period.tv_sec = Cntr->PeriodUs / 1000000U;
+		Period.tv_nsec = (long)(Cntr->PeriodUs % 1000000U) * 1000L;
+		nanosleep(&Period, NULL);
+	}
+
+	return NULL;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API starts a host thread which updates a set of virtual counters
+* periodically.
+*
+* @param	Cntr: Virtual counters.
+* @param	PeriodUs: Period between two updates in microseconds. Must be
+*		shorter than the wrap period of the hardware counters.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The thread has to be stopped with XAie_PerfCounter64Stop().
+*		Not supported for baremetal, call XAie_PerfCounter64Update()
+*		instead.
+*
+******************************************************************************/
+AieRC XAie_PerfCounter64Start(XAie_PerfCounter64 *Cntr, u32 PeriodUs)
+{
+#ifndef __AIEBAREMETAL__
+	if(Cntr == NULL) {
+		XAIE_ERROR("Invalid virtual counters\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Cntr->Running != 0U) {
+		XAIE_ERROR("Virtual counters are already sampling\n");
+		return XAIE_ERR;
+	}
+
+	Cntr->PeriodUs = PeriodUs;
+	Cntr->Stop = 0U;
+	Cntr->Status = XAIE_OK;
+	if(pthread_create(&Cntr->Thread, NULL, _XAie_PerfCounter64Worker,
+				Cntr) != 0) {
+		XAIE_ERROR("Unable to create sampling thread\n");
+		return XAIE_ERR;
+	}
+
+	Cntr->Running = 1U;
+	return XAIE_OK;
+#else
+	(void)Cntr;
+	(void)PeriodUs;
+	XAIE_ERROR("Sampling thread is not supported for baremetal\n");
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stops the sampling thread of a set of virtual counters.
+*
+* @param	Cntr: Virtual counters.
+*
+* @return	XAIE_OK on success, the error which stopped the sampling thread
+*		or error code on failure.
+*
+* @note		The values are kept, and sampling can be started again.
+*
+******************************************************************************/
+AieRC XAie_PerfCounter64Stop(XAie_PerfCounter64 *Cntr)
+{
+#ifndef __AIEBAREMETAL__
+	if(Cntr == NULL) {
+		XAIE_ERROR("Invalid virtual counters\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Cntr->Running == 0U) {
+		return XAIE_OK;
+	}
+
+	pthread_mutex_lock(&Cntr->Lock);
+	Cntr->Stop = 1U;
+	pthread_mutex_unlock(&Cntr->Lock);
+	pthread_join(Cntr->Thread, NULL);
+	Cntr->Running = 0U;
+
+	return Cntr->Status;
+#else
+	(void)Cntr;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the current value of one virtual counter. Its hardware
+* counter is sampled first, so the value is up to date.
+*
+* @param	Cntr: Virtual counters.
+* @param	Idx: Index of the counter in the Rscs array it was created with.
+* @param	Val: Pointer to return the 64-bit value.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_PerfCounter64Get(XAie_PerfCounter64 *Cntr, u32 Idx, u64 *Val)
+{
+	AieRC RC;
+
+	if((Cntr == NULL) || (Val == NULL) || (Idx >= Cntr->NumEntries)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_PerfCounter64Lock(Cntr);
+	RC = _XAie_PerfCounter64Sample(Cntr, &Cntr->Entries[Idx]);
+	*Val = Cntr->Entries[Idx].Val;
+	_XAie_PerfCounter64Unlock(Cntr);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the values of all the virtual counters as of their last
+* update, without accessing the hardware.
+*
+* @param	Cntr: Virtual counters.
+* @param	Vals: Array of one value per counter, in the order of the Rscs
+*		array the counters were created with.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Call XAie_PerfCounter64Update() first to get current values if
+*		the sampling thread is not running.
+*
+******************************************************************************/
+AieRC XAie_PerfCounter64GetAll(XAie_PerfCounter64 *Cntr, u64 *Vals)
+{
+	if((Cntr == NULL) || (Vals == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_PerfCounter64Lock(Cntr);
+	for(u32 i = 0U; i < Cntr->NumEntries; i++) {
+		Vals[i] = Cntr->Entries[i].Val;
+	}
+	_XAie_PerfCounter64Unlock(Cntr);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases a set of virtual counters. The sampling thread is stopped
+* first if it is running.
+*
+* @param	Cntr: Virtual counters.
+*
+* @return	None.
+*
+* @note		The hardware counters are left untouched.
+*
+******************************************************************************/
+void XAie_PerfCounter64Free(XAie_PerfCounter64 *Cntr)
+{
+	if(Cntr == NULL) {
+		return;
+	}
+
+	(void)XAie_PerfCounter64Stop(Cntr);
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_destroy(&Cntr->Lock);
+#endif
+	free(Cntr->Entries);
+	free(Cntr);
+}
+
+#endif /* XAIE_FEATURE_PERFCOUNT_ENABLE */
@@ -0,0 +1,41 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_perfcnt64.h
+* @{
+*
+* Header file for 64-bit virtual performance counters.
+*
+******************************************************************************/
+#ifndef XAIEPERFCNT64_H
+#define XAIEPERFCNT64_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+#include "xaie_rsc.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * Set of 64-bit virtual counters, each extending a 32-bit hardware
+ * performance counter by accumulating its increments on the host.
+ */
+typedef struct XAie_PerfCounter64 XAie_PerfCounter64;
+
+/************************** Function Prototypes  *****************************/
+XAie_PerfCounter64* XAie_PerfCounter64Create(XAie_DevInst *DevInst,
+		const XAie_UserRsc *Rscs, u32 NumRscs);
+AieRC XAie_PerfCounter64Update(XAie_PerfCounter64 *Cntr);
+AieRC XAie_PerfCounter64Start(XAie_PerfCounter64 *Cntr, u32 PeriodUs);
+AieRC XAie_PerfCounter64Stop(XAie_PerfCounter64 *Cntr);
+AieRC XAie_PerfCounter64Get(XAie_PerfCounter64 *Cntr, u32 Idx, u64 *Val);
+AieRC XAie_PerfCounter64GetAll(XAie_PerfCounter64 *Cntr, u64 *Vals);
+void XAie_PerfCounter64Free(XAie_PerfCounter64 *Cntr);
+
+#endif		/* end of protection macro */
+/** @} */
@@ -25,6 +25,8 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+
 #include "xaie_feature_config.h"
 #include "xaie_plif.h"
 #include "xaiegbl_defs.h"
@@ -45,7 +47,67 @@
 #define XAIE_STREAM_SOUTH_PORT_6	6U
 #define XAIE_STREAM_SOUTH_PORT_7	7U
 
+#define XAIE_PLIF_REG_DOWNSZR		0U
+#define XAIE_PLIF_REG_DOWNSZR_EN	1U
+#define XAIE_PLIF_REG_UPSZR		2U
+#define XAIE_PLIF_REG_BYPASS		3U
+#define XAIE_PLIF_REG_MUX		4U
+#define XAIE_PLIF_REG_DEMUX		5U
+#define XAIE_PLIF_REG_MAX		6U
+
+/****************************** Type Definitions *****************************/
+/*
+ * Typedef to capture the value of one shim interface register planned by
+ * XAie_PlIfConfigPorts(). Mask is the set of fields configured by the ports.
+ */
+typedef struct {
+	u32 Mask;
+	u32 Val;
+} XAie_PlIfRegPlan;
+
 /************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API computes the field of a stream port in the BLI bypass register of
+* the PL2ME interface.
+*
+* @param	PlIfMod: PL interface module of the tile
+* @param        PortNum: Stream Port Number (0, 1, 2, 4, 5, 6)
+* @param	Enable: XAIE_DISABLE for disable, XAIE_ENABLE for enable
+* @param	Mask: Pointer to return the field mask
+* @param	FldVal: Pointer to return the field value
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static AieRC _XAie_PlIfBliBypassFld(const XAie_PlIfMod *PlIfMod, u8 PortNum,
+		u8 Enable, u32 *Mask, u32 *FldVal)
+{
+	/*
+	 * Ports 3 and 7 BLI Bypass is enabled in the hardware by default.
+	 * Check and return error if the portnum is invalid.
+	 */
+	if((PortNum > PlIfMod->MaxByPassPortNum) || (PortNum == 3U) ||
+			(PortNum == 7U)) {
+		XAIE_ERROR("Invalid Port Number\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	/* Port number 4-6 are mapped to bits 3-5 */
+	if (PortNum > 3U) {
+		PortNum--;
+	}
+
+	*Mask = PlIfMod->DownSzrByPass[PortNum].Mask;
+	*FldVal = XAie_SetField(Enable, PlIfMod->DownSzrByPass[PortNum].Lsb,
+			*Mask);
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -65,6 +127,7 @@
 static AieRC _XAie_PlIfBliBypassConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u8 PortNum, u8 Enable)
 {
+	AieRC RC;
 	u8 TileType;
 	u64 RegAddr;
 	u32 FldVal;
@@ -77,7 +140,7 @@ static AieRC _XAie_PlIfBliBypassConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
 			(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
 		XAIE_ERROR("Invalid Tile Type\n");
@@ -85,26 +148,11 @@ static AieRC _XAie_PlIfBliBypassConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
-
-	/*
-	 * Ports 3 and 7 BLI Bypass is enabled in the hardware by default.
-	 * Check and return error if the portnum is invalid.
-	 */
-	if((PortNum > PlIfMod->MaxByPassPortNum) || (PortNum == 3U) ||
-			(PortNum == 7U)) {
-		XAIE_ERROR("Invalid Port Number\n");
-		return XAIE_ERR_STREAM_PORT;
-	}
-
-	/* Port number 4-6 are mapped to bits 3-5 */
-	if (PortNum > 3U) {
-		PortNum--;
+	RC = _XAie_PlIfBliBypassFld(PlIfMod, PortNum, Enable, &Mask, &FldVal);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	Mask = PlIfMod->DownSzrByPass[PortNum].Mask;
-	FldVal = XAie_SetField(Enable, PlIfMod->DownSzrByPass[PortNum].Lsb,
-			Mask);
-
 	/* Compute register address */
 	RegAddr = PlIfMod->DownSzrByPassOff +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
@@ -112,6 +160,38 @@ static AieRC _XAie_PlIfBliBypassConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAie_MaskWrite32(DevInst, RegAddr, Mask, FldVal);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API computes the field of a stream port in the Downsizer Enable register
+* of the PL2AIE interface.
+*
+* @param	PlIfMod: PL interface module of the tile
+* @param        PortNum: Stream Port Number (0-7)
+* @param	Enable: XAIE_DISABLE for disable, XAIE_ENABLE for enable
+* @param	Mask: Pointer to return the field mask
+* @param	FldVal: Pointer to return the field value
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static AieRC _XAie_PlIfDownSzrEnFld(const XAie_PlIfMod *PlIfMod, u8 PortNum,
+		u8 Enable, u32 *Mask, u32 *FldVal)
+{
+	if((PortNum > PlIfMod->NumDownSzrPorts)) {
+		XAIE_ERROR("Invalid Port Number\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	/* Enable or Disable stream port in PL2ME downsizer enable register */
+	*Mask = PlIfMod->DownSzrEn[PortNum].Mask;
+	*FldVal = XAie_SetField(Enable, PlIfMod->DownSzrEn[PortNum].Lsb, *Mask);
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -131,6 +211,7 @@ static AieRC _XAie_PlIfBliBypassConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 static AieRC _XAie_PlIfDownSzrPortEnableReg(XAie_DevInst *DevInst,
 		XAie_LocType Loc, u8 PortNum, u8 Enable)
 {
+	AieRC RC;
 	u8 TileType;
 	u64 RegAddr;
 	u32 FldVal;
@@ -143,7 +224,7 @@ static AieRC _XAie_PlIfDownSzrPortEnableReg(XAie_DevInst *DevInst,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
 			(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
 		XAIE_ERROR("Invalid Tile Type\n");
@@ -151,15 +232,11 @@ static AieRC _XAie_PlIfDownSzrPortEnableReg(XAie_DevInst *DevInst,
 	}
 
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
-	if((PortNum > PlIfMod->NumDownSzrPorts)) {
-		XAIE_ERROR("Invalid Port Number\n");
-		return XAIE_ERR_STREAM_PORT;
+	RC = _XAie_PlIfDownSzrEnFld(PlIfMod, PortNum, Enable, &Mask, &FldVal);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	/* Enable or Disable stream port in PL2ME downsizer enable register */
-	Mask = PlIfMod->DownSzrEn[PortNum].Mask;
-	FldVal = XAie_SetField(Enable, PlIfMod->DownSzrEn[PortNum].Lsb, Mask);
-
 	/* Compute register address */
 	RegAddr = PlIfMod->DownSzrEnOff +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
@@ -170,47 +247,26 @@ static AieRC _XAie_PlIfDownSzrPortEnableReg(XAie_DevInst *DevInst,
 /*****************************************************************************/
 /**
 *
-* This API configures the stream width for AIE->PL interfaces. The upsizer
-* register is configured with the PortNumber provided. This is an internal API
-* only and can be used to Enable or Disable AIE->PL interface.
+* This API computes the field of a stream port in the upsizer register of the
+* AIE->PL interface.
 *
-* @param	DevInst: Device Instance
-* @param	Loc: Loc of AIE Tiles
+* @param	PlIfMod: PL interface module of the tile
 * @param        PortNum: Stream Port Number (0-5)
 * @param	Width: Supported widths are 32, 64 and 128
 *		(PLIF_WIDTH_32/64/128)
 * @param	Enable: XAIE_ENABLE or XAIE_DISABLE
+* @param	FldMask: Pointer to return the field mask
+* @param	FldVal: Pointer to return the field value
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
-* @note		When the width is 128 bits, port number can be any one of the
-*		valid port numbers. Ex: For 4_5 combo, port number can be 4 or
-*		5. Internal API only.
+* @note		Internal API only.
 *
 ******************************************************************************/
-static AieRC _XAie_AieToPlIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
-		u8 PortNum, XAie_PlIfWidth Width, u8 Enable)
+static AieRC _XAie_AieToPlIntfFld(const XAie_PlIfMod *PlIfMod, u8 PortNum,
+		XAie_PlIfWidth Width, u8 Enable, u32 *FldMask, u32 *FldVal)
 {
-	u8 TileType;
 	u8 Idx;
-	u32 FldVal;
-	u32 FldMask;
-	u32 RegOff;
-	u64 RegAddr;
-	const XAie_PlIfMod *PlIfMod;
-
-	if((DevInst == XAIE_NULL) ||
-			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
-		XAIE_ERROR("Invalid Device Instance\n");
-		return XAIE_INVALID_ARGS;
-	}
-
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
-			(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
-		XAIE_ERROR("Invalid Tile Type\n");
-		return XAIE_INVALID_TILE;
-	}
 
 	/* Check Width for validity */
 	if((Width != PLIF_WIDTH_32) && (Width != PLIF_WIDTH_64) &&
@@ -219,8 +275,6 @@ static AieRC _XAie_AieToPlIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_PLIF_WIDTH;
 	}
 
-	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
-
 	/* Setup field mask and field value for aie to pl interface */
 	if(PortNum >= PlIfMod->NumDownSzrPorts) {
 		XAIE_ERROR("Invalid stream port\n");
@@ -235,67 +289,54 @@ static AieRC _XAie_AieToPlIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		 * get a 128 Bit port.
 		 */
 		Idx = PortNum / 2U;
-		FldMask = PlIfMod->UpSzr128Bit[Idx].Mask;
-		FldVal = XAie_SetField(Enable,
+		*FldMask = PlIfMod->UpSzr128Bit[Idx].Mask;
+		*FldVal = XAie_SetField(Enable,
 				PlIfMod->UpSzr128Bit[Idx].Lsb,
-				FldMask);
+				*FldMask);
 	} else {
-		FldMask = PlIfMod->UpSzr32_64Bit[PortNum].Mask;
+		*FldMask = PlIfMod->UpSzr32_64Bit[PortNum].Mask;
 		/*
 		 * Field Value has to be set to 1 for 64 Bit interface
 		 * and 0 for 32 Bit interface
 		 */
-		FldVal = XAie_SetField(Width >> XAIE_PLIF_WIDTH_64SHIFT,
+		*FldVal = XAie_SetField(Width >> XAIE_PLIF_WIDTH_64SHIFT,
 				PlIfMod->UpSzr32_64Bit[PortNum].Lsb,
-				FldMask);
+				*FldMask);
 	}
 
-	RegOff = PlIfMod->UpSzrOff;
-
-	RegAddr = RegOff + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
-
-	/* Mask write to the upsizer register */
-	return XAie_MaskWrite32(DevInst, RegAddr, FldMask, FldVal);
+	return XAIE_OK;
 }
 
 /*****************************************************************************/
 /**
 *
-* This API configures the stream width for PL->AIE interfaces. The downsizer
-* register is configured with the port number provided by the user.
-* Once the downsizer register is configured, the API also enables the ports in
-* the downsizer enable register. The api configures the interface for a range
-* of AIE Tiles.
+* This API configures the stream width for AIE->PL interfaces. The upsizer
+* register is configured with the PortNumber provided. This is an internal API
+* only and can be used to Enable or Disable AIE->PL interface.
 *
 * @param	DevInst: Device Instance
 * @param	Loc: Loc of AIE Tiles
-* @param        PortNum: Stream Port Number (0-7)
+* @param        PortNum: Stream Port Number (0-5)
 * @param	Width: Supported widths are 32, 64 and 128
 *		(PLIF_WIDTH_32/64/128)
 * @param	Enable: XAIE_ENABLE or XAIE_DISABLE
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
-* @note		If this API is used to configure PLTOAIE interfaces, explicit
-*		call to enable stream ports in downsizer enable register is not
-*		required. When configuring for 128 bit width, the user has to
-*		provide one valid port. The api enables the other port by
-*		default. Internal API only.
+* @note		When the width is 128 bits, port number can be any one of the
+*		valid port numbers. Ex: For 4_5 combo, port number can be 4 or
+*		5. Internal API only.
 *
 ******************************************************************************/
-static AieRC _XAie_PlToAieIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
+static AieRC _XAie_AieToPlIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u8 PortNum, XAie_PlIfWidth Width, u8 Enable)
 {
 	AieRC RC;
 	u8 TileType;
-	u8 Idx;
 	u32 FldVal;
 	u32 FldMask;
-	u32 DwnSzrEnMask;
-	u32 DwnSzrEnVal;
 	u32 RegOff;
 	u64 RegAddr;
-	u64 DwnSzrEnRegAddr;
 	const XAie_PlIfMod *PlIfMod;
 
 	if((DevInst == XAIE_NULL) ||
@@ -304,13 +345,56 @@ static AieRC _XAie_PlToAieIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
 			(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
+	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
+	RC = _XAie_AieToPlIntfFld(PlIfMod, PortNum, Width, Enable, &FldMask,
+			&FldVal);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RegOff = PlIfMod->UpSzrOff;
+
+	RegAddr = RegOff + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	/* Mask write to the upsizer register */
+	return XAie_MaskWrite32(DevInst, RegAddr, FldMask, FldVal);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API computes the fields of a stream port in the downsizer and downsizer
+* enable registers of the PL->AIE interface.
+*
+* @param	PlIfMod: PL interface module of the tile
+* @param        PortNum: Stream Port Number (0-7)
+* @param	Width: Supported widths are 32, 64 and 128
+*		(PLIF_WIDTH_32/64/128)
+* @param	Enable: XAIE_ENABLE or XAIE_DISABLE
+* @param	FldMask: Pointer to return the downsizer field mask
+* @param	FldVal: Pointer to return the downsizer field value
+* @param	EnMask: Pointer to return the downsizer enable field mask
+* @param	EnVal: Pointer to return the downsizer enable field value
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		When the width is 128 bits, the enable fields cover both
+*		ports. Internal API only.
+*
+******************************************************************************/
+static AieRC _XAie_PlToAieIntfFld(const XAie_PlIfMod *PlIfMod, u8 PortNum,
+		XAie_PlIfWidth Width, u8 Enable, u32 *FldMask, u32 *FldVal,
+		u32 *EnMask, u32 *EnVal)
+{
+	u8 Idx;
+
 	/* Check Width for validity */
 	if((Width != PLIF_WIDTH_32) && (Width != PLIF_WIDTH_64) &&
 			(Width != PLIF_WIDTH_128)) {
@@ -318,8 +402,6 @@ static AieRC _XAie_PlToAieIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_PLIF_WIDTH;
 	}
 
-	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
-
 	/* Setup field mask and field value for pl to aie interface */
 	if(PortNum >= PlIfMod->NumDownSzrPorts) {
 		XAIE_ERROR("Invalid stream port\n");
@@ -334,20 +416,20 @@ static AieRC _XAie_PlToAieIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		 * get a 128 Bit port.
 		 */
 		Idx = PortNum / 2U;
-		FldMask = PlIfMod->DownSzr128Bit[Idx].Mask;
-		FldVal = XAie_SetField(Enable,
+		*FldMask = PlIfMod->DownSzr128Bit[Idx].Mask;
+		*FldVal = XAie_SetField(Enable,
 				PlIfMod->DownSzr128Bit[Idx].Lsb,
-				FldMask);
+				*FldMask);
 	} else {
-		FldMask = PlIfMod->DownSzr32_64Bit[PortNum].Mask;
+		*FldMask = PlIfMod->DownSzr32_64Bit[PortNum].Mask;
 		/*
 		 * Field Value has to be set to 1 for 64 Bit interface
 		 * and 0 for 32 Bit interface. Width is shifted to move 64(2^6)
 		 * to LSB. When width is 32, the shift results in 0.
 		 */
-		FldVal = XAie_SetField(Width >> XAIE_PLIF_WIDTH_64SHIFT,
+		*FldVal = XAie_SetField(Width >> XAIE_PLIF_WIDTH_64SHIFT,
 				PlIfMod->DownSzr32_64Bit[PortNum].Lsb,
-				FldMask);
+				*FldMask);
 	}
 
 	/*
@@ -355,20 +437,82 @@ static AieRC _XAie_PlToAieIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 	 * bits corresponding to the stream ports have to enabled in the
 	 * downsizer enable register.
 	 */
-	DwnSzrEnMask = PlIfMod->DownSzrEn[PortNum].Mask;
-	DwnSzrEnVal = XAie_SetField(Enable,
-			PlIfMod->DownSzrEn[PortNum].Lsb, DwnSzrEnMask);
+	*EnMask = PlIfMod->DownSzrEn[PortNum].Mask;
+	*EnVal = XAie_SetField(Enable, PlIfMod->DownSzrEn[PortNum].Lsb,
+			*EnMask);
 
 	/* If width is 128 bits, enable both ports */
 	if(Width == PLIF_WIDTH_128) {
 		PortNum = (PortNum % 2U) ? (PortNum - 1U) : (PortNum + 1U);
 
-		DwnSzrEnMask |= PlIfMod->DownSzrEn[PortNum].Mask;
-		DwnSzrEnVal |= XAie_SetField(Enable,
+		*EnMask |= PlIfMod->DownSzrEn[PortNum].Mask;
+		*EnVal |= XAie_SetField(Enable,
 				PlIfMod->DownSzrEn[PortNum].Lsb,
 				PlIfMod->DownSzrEn[PortNum].Mask);
 	}
 
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures the stream width for PL->AIE interfaces. The downsizer
+* register is configured with the port number provided by the user.
+* Once the downsizer register is configured, the API also enables the ports in
+* the downsizer enable register. The api configures the interface for a range
+* of AIE Tiles.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Loc of AIE Tiles
+* @param        PortNum: Stream Port Number (0-7)
+* @param	Width: Supported widths are 32, 64 and 128
+*		(PLIF_WIDTH_32/64/128)
+* @param	Enable: XAIE_ENABLE or XAIE_DISABLE
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		If this API is used to configure PLTOAIE interfaces, explicit
+*		call to enable stream ports in downsizer enable register is not
+*		required. When configuring for 128 bit width, the user has to
+*		provide one valid port. The api enables the other port by
+*		default. Internal API only.
+*
+******************************************************************************/
+static AieRC _XAie_PlToAieIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u8 PortNum, XAie_PlIfWidth Width, u8 Enable)
+{
+	AieRC RC;
+	u8 TileType;
+	u32 FldVal;
+	u32 FldMask;
+	u32 DwnSzrEnMask;
+	u32 DwnSzrEnVal;
+	u32 RegOff;
+	u64 RegAddr;
+	u64 DwnSzrEnRegAddr;
+	const XAie_PlIfMod *PlIfMod;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
+			(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
+	RC = _XAie_PlToAieIntfFld(PlIfMod, PortNum, Width, Enable, &FldMask,
+			&FldVal, &DwnSzrEnMask, &DwnSzrEnVal);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	RegOff = PlIfMod->DownSzrOff;
 
 	RegAddr = RegOff + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
@@ -576,6 +720,91 @@ AieRC XAie_PlIfBliBypassDisable(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return _XAie_PlIfBliBypassConfig(DevInst, Loc, PortNum, XAIE_DISABLE);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API computes the field of an input stream port in the Mux register of
+* the AIE Shim NoC tiles.
+*
+* @param	PlIfMod: PL interface module of the tile
+* @param        PortNum: Stream Port Number (2, 3, 6, 7)
+* @param	InputConnectionType: XAIE_MUX_DEMUX_CONFIG_TYPE_PL,
+*		XAIE_MUX_DEMUX_CONFIG_TYPE_DMA or XAIE_MUX_DEMUX_CONFIG_TYPE_NOC
+* @param	FldMask: Pointer to return the field mask
+* @param	FldVal: Pointer to return the field value
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal API Only.
+*
+******************************************************************************/
+static AieRC _XAie_ShimNocMuxFld(const XAie_PlIfMod *PlIfMod, u8 PortNum,
+		u8 InputConnectionType, u32 *FldMask, u32 *FldVal)
+{
+	*FldMask = 0U;
+	*FldVal = 0U;
+	if((PortNum != XAIE_STREAM_SOUTH_PORT_2) &&
+			(PortNum != XAIE_STREAM_SOUTH_PORT_3) &&
+			(PortNum != XAIE_STREAM_SOUTH_PORT_6) &&
+			(PortNum != XAIE_STREAM_SOUTH_PORT_7)) {
+		XAIE_ERROR("Invalid port number for Mux\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	/* Map the port numbers to 0, 1, 2, 3 */
+	if(PortNum > 3U) {
+		PortNum -= 4U;
+	} else {
+		PortNum -= 2U;
+	}
+
+	*FldVal = (u32)InputConnectionType << PlIfMod->ShimNocMux[PortNum].Lsb;
+	*FldMask = PlIfMod->ShimNocMux[PortNum].Mask;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API computes the field of an output stream port in the DeMux register
+* of the AIE Shim NoC tiles.
+*
+* @param	PlIfMod: PL interface module of the tile
+* @param        PortNum: Stream Port Number (2, 3, 4, 5)
+* @param	OutputConnectionType: XAIE_MUX_DEMUX_CONFIG_TYPE_PL,
+*		XAIE_MUX_DEMUX_CONFIG_TYPE_DMA or XAIE_MUX_DEMUX_CONFIG_TYPE_NOC
+* @param	FldMask: Pointer to return the field mask
+* @param	FldVal: Pointer to return the field value
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal API Only.
+*
+******************************************************************************/
+static AieRC _XAie_ShimNocDeMuxFld(const XAie_PlIfMod *PlIfMod, u8 PortNum,
+		u8 OutputConnectionType, u32 *FldMask, u32 *FldVal)
+{
+	*FldMask = 0U;
+	*FldVal = 0U;
+	if((PortNum != XAIE_STREAM_SOUTH_PORT_2) &&
+			(PortNum != XAIE_STREAM_SOUTH_PORT_3) &&
+			(PortNum != XAIE_STREAM_SOUTH_PORT_4) &&
+			(PortNum != XAIE_STREAM_SOUTH_PORT_5)) {
+		XAIE_ERROR("Invalid port number\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	/* Map the port numbers to 0, 1, 2, 3 */
+	PortNum -= 2U;
+
+	*FldVal = (u32)OutputConnectionType <<
+		PlIfMod->ShimNocDeMux[PortNum].Lsb;
+	*FldMask = PlIfMod->ShimNocDeMux[PortNum].Mask;
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -597,6 +826,7 @@ AieRC XAie_PlIfBliBypassDisable(XAie_DevInst *DevInst, XAie_LocType Loc,
 static AieRC _XAie_ConfigShimNocMux(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u8 PortNum, u8 InputConnectionType)
 {
+	AieRC RC;
 	u8 TileType;
 	u32 FldVal;
 	u32 FldMask;
@@ -609,31 +839,18 @@ static AieRC _XAie_ConfigShimNocMux(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	if((PortNum != XAIE_STREAM_SOUTH_PORT_2) &&
-			(PortNum != XAIE_STREAM_SOUTH_PORT_3) &&
-			(PortNum != XAIE_STREAM_SOUTH_PORT_6) &&
-			(PortNum != XAIE_STREAM_SOUTH_PORT_7)) {
-		XAIE_ERROR("Invalid port number for Mux\n");
-		return XAIE_ERR_STREAM_PORT;
-	}
-
-	/* Map the port numbers to 0, 1, 2, 3 */
-	if(PortNum > 3U) {
-		PortNum -= 4U;
-	} else {
-		PortNum -= 2U;
-	}
-
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
-
-	FldVal = InputConnectionType << PlIfMod->ShimNocMux[PortNum].Lsb;
-	FldMask = PlIfMod->ShimNocMux[PortNum].Mask;
+	RC = _XAie_ShimNocMuxFld(PlIfMod, PortNum, InputConnectionType,
+			&FldMask, &FldVal);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
 
 	RegAddr = PlIfMod->ShimNocMuxOff +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
@@ -663,6 +880,7 @@ static AieRC _XAie_ConfigShimNocMux(XAie_DevInst *DevInst, XAie_LocType Loc,
 static AieRC _XAie_ConfigShimNocDeMux(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u8 PortNum, u8 OutputConnectionType)
 {
+	AieRC RC;
 	u8 TileType;
 	u32 FldVal;
 	u32 FldMask;
@@ -675,27 +893,18 @@ static AieRC _XAie_ConfigShimNocDeMux(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	if((PortNum != XAIE_STREAM_SOUTH_PORT_2) &&
-			(PortNum != XAIE_STREAM_SOUTH_PORT_3) &&
-			(PortNum != XAIE_STREAM_SOUTH_PORT_4) &&
-			(PortNum != XAIE_STREAM_SOUTH_PORT_5)) {
-		XAIE_ERROR("Invalid port number\n");
-		return XAIE_ERR_STREAM_PORT;
-	}
-
-	/* Map the port numbers to 0, 1, 2, 3 */
-	PortNum -= 2U;
-
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
-
-	FldVal = OutputConnectionType << PlIfMod->ShimNocDeMux[PortNum].Lsb;
-	FldMask = PlIfMod->ShimNocDeMux[PortNum].Mask;
+	RC = _XAie_ShimNocDeMuxFld(PlIfMod, PortNum, OutputConnectionType,
+			&FldMask, &FldVal);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
 
 	RegAddr = PlIfMod->ShimNocDeMuxOff +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
@@ -854,5 +1063,284 @@ AieRC XAie_EnableAieToPlStrmPort(XAie_DevInst *DevInst, XAie_LocType Loc,
 			XAIE_MUX_DEMUX_CONFIG_TYPE_PL);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API merges a field into a planned shim interface register.
+*
+* @param	Plan: Planned register
+* @param	FldMask: Field mask
+* @param	FldVal: Field value
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if the field was already
+*		planned with another value.
+*
+* @note		Internal API Only.
+*
+******************************************************************************/
+static AieRC _XAie_PlIfPlanFld(XAie_PlIfRegPlan *Plan, u32 FldMask,
+		u32 FldVal)
+{
+	if(((Plan->Mask & FldMask) != 0U) &&
+			(((Plan->Val ^ FldVal) & Plan->Mask & FldMask) != 0U)) {
+		XAIE_ERROR("Conflicting shim interface port configurations\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Plan->Mask |= FldMask;
+	Plan->Val = (Plan->Val & ~FldMask) | (FldVal & FldMask);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API plans one shim interface port configuration into the registers of
+* its column.
+*
+* @param	PlIfMod: PL interface module of the tile
+* @param	TileType: Type of the tile
+* @param	Cfg: Port configuration
+* @param	Plan: Planned registers of the column
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal API Only.
+*
+******************************************************************************/
+static AieRC _XAie_PlIfPlanPort(const XAie_PlIfMod *PlIfMod, u8 TileType,
+		const XAie_PlIfPortCfg *Cfg, XAie_PlIfRegPlan *Plan)
+{
+	AieRC RC;
+	u32 FldMask, FldVal, EnMask, EnVal;
+
+	if(((Cfg->Type == XAIE_PLIF_PORT_MUX) ||
+			(Cfg->Type == XAIE_PLIF_PORT_DEMUX)) &&
+			((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) ||
+			 (Cfg->Conn >= XAIE_PLIF_STRM_MAX))) {
+		XAIE_ERROR("Invalid Tile Type or stream connection\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	switch(Cfg->Type) {
+	case XAIE_PLIF_PORT_PL_TO_AIE:
+		RC = _XAie_PlToAieIntfFld(PlIfMod, Cfg->PortNum, Cfg->Width,
+				Cfg->Enable, &FldMask, &FldVal, &EnMask,
+				&EnVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RC = _XAie_PlIfPlanFld(&Plan[XAIE_PLIF_REG_DOWNSZR], FldMask,
+				FldVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		return _XAie_PlIfPlanFld(&Plan[XAIE_PLIF_REG_DOWNSZR_EN],
+				EnMask, EnVal);
+	case XAIE_PLIF_PORT_AIE_TO_PL:
+		RC = _XAie_AieToPlIntfFld(PlIfMod, Cfg->PortNum, Cfg->Width,
+				Cfg->Enable, &FldMask, &FldVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		return _XAie_PlIfPlanFld(&Plan[XAIE_PLIF_REG_UPSZR], FldMask,
+				FldVal);
+	case XAIE_PLIF_PORT_BLI_BYPASS:
+		RC = _XAie_PlIfBliBypassFld(PlIfMod, Cfg->PortNum,
+				Cfg->Enable, &FldMask, &FldVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		return _XAie_PlIfPlanFld(&Plan[XAIE_PLIF_REG_BYPASS], FldMask,
+				FldVal);
+	case XAIE_PLIF_PORT_MUX:
+		RC = _XAie_ShimNocMuxFld(PlIfMod, Cfg->PortNum,
+				(u8)Cfg->Conn, &FldMask, &FldVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		return _XAie_PlIfPlanFld(&Plan[XAIE_PLIF_REG_MUX], FldMask,
+				FldVal);
+	case XAIE_PLIF_PORT_DEMUX:
+		RC = _XAie_ShimNocDeMuxFld(PlIfMod, Cfg->PortNum,
+				(u8)Cfg->Conn, &FldMask, &FldVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		return _XAie_PlIfPlanFld(&Plan[XAIE_PLIF_REG_DEMUX], FldMask,
+				FldVal);
+	default:
+		XAIE_ERROR("Invalid shim interface port type\n");
+		return XAIE_INVALID_ARGS;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the planned shim interface registers of a column.
+*
+* @param	DevInst: Device Instance
+* @param	PlIfMod: PL interface module of the shim tile of the column
+* @param	Loc: Location of the shim tile of the column
+* @param	Plan: Planned registers of the column
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal API Only.
+*
+******************************************************************************/
+static AieRC _XAie_PlIfWritePlan(XAie_DevInst *DevInst,
+		const XAie_PlIfMod *PlIfMod, XAie_LocType Loc,
+		const XAie_PlIfRegPlan *Plan)
+{
+	AieRC RC;
+	u64 TileAddr;
+	u32 RegOffs[XAIE_PLIF_REG_MAX];
+
+	RegOffs[XAIE_PLIF_REG_DOWNSZR] = PlIfMod->DownSzrOff;
+	RegOffs[XAIE_PLIF_REG_DOWNSZR_EN] = PlIfMod->DownSzrEnOff;
+	RegOffs[XAIE_PLIF_REG_UPSZR] = PlIfMod->UpSzrOff;
+	RegOffs[XAIE_PLIF_REG_BYPASS] = PlIfMod->DownSzrByPassOff;
+	RegOffs[XAIE_PLIF_REG_MUX] = PlIfMod->ShimNocMuxOff;
+	RegOffs[XAIE_PLIF_REG_DEMUX] = PlIfMod->ShimNocDeMuxOff;
+
+	TileAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	for(u8 Reg = 0U; Reg < XAIE_PLIF_REG_MAX; Reg++) {
+		if(Plan[Reg].Mask == 0U) {
+			continue;
+		}
+
+		RC = XAie_Write32(DevInst, TileAddr + RegOffs[Reg],
+				Plan[Reg].Val);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures a list of shim interface ports of any columns at once.
+* The final values of the downsizer, downsizer enable, upsizer, BLI bypass,
+* mux and demux registers of every column are computed from the list, and each
+* register used by the list is written once, without reading it back.
+*
+* @param	DevInst: Device Instance
+* @param	Cfgs: Array of port configurations
+* @param	NumCfgs: Number of port configurations
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The list describes the whole configuration of the registers
+*		it uses: in such a register, the fields of the ports missing
+*		from the list are written with their reset value of 0, which
+*		is a 32 bit PL connection without BLI bypass. Registers not
+*		used by the list are not accessed. The list is checked before
+*		any register is written. Unless a transaction is already
+*		active, the registers are submitted as one transaction.
+*
+******************************************************************************/
+AieRC XAie_PlIfConfigPorts(XAie_DevInst *DevInst,
+		const XAie_PlIfPortCfg *Cfgs, u32 NumCfgs)
+{
+	AieRC RC = XAIE_OK;
+	u8 OwnTxn = XAIE_DISABLE;
+	XAie_PlIfRegPlan *Plans;
+
+	if((DevInst == XAIE_NULL) || (Cfgs == XAIE_NULL) || (NumCfgs == 0U) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Plans = (XAie_PlIfRegPlan *)calloc((size_t)DevInst->NumCols *
+			XAIE_PLIF_REG_MAX, sizeof(*Plans));
+	if(Plans == NULL) {
+		XAIE_ERROR("Memory allocation for shim interface plan failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumCfgs; i++) {
+		u8 TileType;
+
+		if(Cfgs[i].Loc.Col >= DevInst->NumCols) {
+			XAIE_ERROR("Invalid column %u\n", Cfgs[i].Loc.Col);
+			RC = XAIE_INVALID_ARGS;
+			goto out;
+		}
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Cfgs[i].Loc);
+		if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
+				(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
+			XAIE_ERROR("Invalid Tile Type\n");
+			RC = XAIE_INVALID_TILE;
+			goto out;
+		}
+
+		RC = _XAie_PlIfPlanPort(DevInst->DevProp.DevMod[TileType].PlIfMod,
+				TileType, &Cfgs[i],
+				&Plans[Cfgs[i].Loc.Col * XAIE_PLIF_REG_MAX]);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Invalid shim interface port configuration "
+					"%u\n", i);
+			goto out;
+		}
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			goto out;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	for(u8 Col = 0U; Col < DevInst->NumCols; Col++) {
+		XAie_LocType Loc = XAie_TileLoc(Col, DevInst->ShimRow);
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+		if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
+				(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
+			continue;
+		}
+
+		RC = _XAie_PlIfWritePlan(DevInst,
+				DevInst->DevProp.DevMod[TileType].PlIfMod, Loc,
+				&Plans[Col * XAIE_PLIF_REG_MAX]);
+		if(RC != XAIE_OK) {
+			break;
+		}
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+out:
+	free(Plans);
+	return RC;
+}
+
 #endif /* XAIE_FEATURE_PL_ENABLE */
 /** @} */
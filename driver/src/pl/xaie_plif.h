@@ -38,6 +38,49 @@ typedef enum {
 	PLIF_WIDTH_128 = 128
 } XAie_PlIfWidth;
 
+/*
+ * This enum captures the kinds of shim interface port configurations of
+ * XAie_PlIfConfigPorts().
+ *	XAIE_PLIF_PORT_PL_TO_AIE: Downsizer width and enable of a PL->AIE port.
+ *	XAIE_PLIF_PORT_AIE_TO_PL: Upsizer width of an AIE->PL port.
+ *	XAIE_PLIF_PORT_BLI_BYPASS: BLI bypass of a PL->AIE port.
+ *	XAIE_PLIF_PORT_MUX: Source of a shim NoC input stream port.
+ *	XAIE_PLIF_PORT_DEMUX: Destination of a shim NoC output stream port.
+ */
+typedef enum {
+	XAIE_PLIF_PORT_PL_TO_AIE,
+	XAIE_PLIF_PORT_AIE_TO_PL,
+	XAIE_PLIF_PORT_BLI_BYPASS,
+	XAIE_PLIF_PORT_MUX,
+	XAIE_PLIF_PORT_DEMUX,
+	XAIE_PLIF_PORT_MAX
+} XAie_PlIfPortType;
+
+/*
+ * This enum captures the connections of the shim NoC stream ports in the mux
+ * and demux registers.
+ */
+typedef enum {
+	XAIE_PLIF_STRM_PL,
+	XAIE_PLIF_STRM_DMA,
+	XAIE_PLIF_STRM_NOC,
+	XAIE_PLIF_STRM_MAX
+} XAie_PlIfStrmConn;
+
+/*
+ * This typedef captures one shim interface port configuration. Width is only
+ * used by PL->AIE and AIE->PL ports, Conn by mux and demux ports and Enable by
+ * all but mux and demux ports.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	XAie_PlIfPortType Type;
+	u8 PortNum;
+	XAie_PlIfWidth Width;
+	XAie_PlIfStrmConn Conn;
+	u8 Enable;
+} XAie_PlIfPortCfg;
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_PlIfBliBypassEnable(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u8 PortNum);
@@ -67,4 +110,6 @@ AieRC XAie_EnablePlToAieStrmPort(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u8 PortNum);
 AieRC XAie_EnableAieToPlStrmPort(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u8 PortNum);
+AieRC XAie_PlIfConfigPorts(XAie_DevInst *DevInst,
+		const XAie_PlIfPortCfg *Cfgs, u32 NumCfgs);
 #endif		/* end of protection macro */
@@ -0,0 +1,701 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_cfgsnap.c
+* @{
+*
+* This file contains routines to save the configuration of a set of tiles and
+* to restore it later. The registers to save are listed from the register
+* database of the device: lock values, buffer descriptors and channel controls
+* of the DMAs, stream switch ports and slots, event, performance counter and
+* timer controls, trace controls and optionally the memories.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+
+#include "xaie_cfgsnap.h"
+#include "xaie_helper.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_CFG_SNAP_MIN_RANGES	64U
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API adds a run of consecutive registers to a snapshot. The run is merged
+* with the last run of the snapshot if it starts right after it.
+*
+* @param	Snap: Snapshot being set up.
+* @param	MaxRanges: Number of ranges allocated in the snapshot.
+* @param	RegOff: Partition relative address of the first register.
+* @param	NumWords: Number of registers.
+*
+* @return	XAIE_OK on success, XAIE_ERR if memory allocation fails.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CfgSnapAddRange(XAie_CfgSnapshot *Snap, u32 *MaxRanges,
+		u64 RegOff, u32 NumWords)
+{
+	XAie_CfgSnapRange *Range;
+
+	if(NumWords == 0U) {
+		return XAIE_OK;
+	}
+
+	if(Snap->NumRanges > 0U) {
+		Range = &Snap->Ranges[Snap->NumRanges - 1U];
+		if(Range->RegOff + Range->NumWords * sizeof(u32) == RegOff) {
+			Range->NumWords += NumWords;
+			Snap->NumWords += NumWords;
+			return XAIE_OK;
+		}
+	}
+
+	if(Snap->NumRanges == *MaxRanges) {
+		u32 NewMax = (*MaxRanges == 0U) ? XAIE_CFG_SNAP_MIN_RANGES :
+			*MaxRanges * 2U;
+
+		Range = (XAie_CfgSnapRange *)realloc((void *)Snap->Ranges,
+				NewMax * sizeof(*Range));
+		if(Range == NULL) {
+			XAIE_ERROR("Memory allocation for snapshot failed\n");
+			return XAIE_ERR;
+		}
+		Snap->Ranges = Range;
+		*MaxRanges = NewMax;
+	}
+
+	Range = &Snap->Ranges[Snap->NumRanges++];
+	Range->RegOff = RegOff;
+	Range->NumWords = NumWords;
+	Range->DataOff = Snap->NumWords;
+	Snap->NumWords += NumWords;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds registers spaced by a constant stride to a snapshot.
+*
+* @param	Snap: Snapshot being set up.
+* @param	MaxRanges: Number of ranges allocated in the snapshot.
+* @param	RegOff: Partition relative address of the first register.
+* @param	Count: Number of registers.
+* @param	Stride: Offset between consecutive registers.
+*
+* @return	XAIE_OK on success, XAIE_ERR if memory allocation fails.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CfgSnapAddStrided(XAie_CfgSnapshot *Snap, u32 *MaxRanges,
+		u64 RegOff, u32 Count, u32 Stride)
+{
+	AieRC RC = XAIE_OK;
+
+	if(Stride == sizeof(u32)) {
+		return _XAie_CfgSnapAddRange(Snap, MaxRanges, RegOff, Count);
+	}
+
+	for(u32 i = 0U; (i < Count) && (RC == XAIE_OK); i++) {
+		RC = _XAie_CfgSnapAddRange(Snap, MaxRanges,
+				RegOff + (u64)i * Stride, 1U);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the stream switch port and slot registers of a tile to a
+* snapshot.
+*
+* @param	Snap: Snapshot being set up.
+* @param	MaxRanges: Number of ranges allocated in the snapshot.
+* @param	TileAddr: Address of the tile.
+* @param	StrmMod: Stream switch module of the tile.
+*
+* @return	XAIE_OK on success, XAIE_ERR if memory allocation fails.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CfgSnapAddStrmSw(XAie_CfgSnapshot *Snap, u32 *MaxRanges,
+		u64 TileAddr, const XAie_StrmMod *StrmMod)
+{
+	AieRC RC;
+	u32 SlotBase = 0U;
+	u8 HasSlots = XAIE_DISABLE;
+
+	RC = _XAie_CfgSnapAddStrided(Snap, MaxRanges,
+			TileAddr + StrmMod->MstrConfigBaseAddr,
+			StrmMod->MaxMasterPhyPortId + 1U, StrmMod->PortOffset);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_CfgSnapAddStrided(Snap, MaxRanges,
+			TileAddr + StrmMod->SlvConfigBaseAddr,
+			StrmMod->MaxSlavePhyPortId + 1U, StrmMod->PortOffset);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	/* The slots of all the slave ports follow the slots of port 0 */
+	for(u8 Type = 0U; Type < (u8)SS_PORT_TYPE_MAX; Type++) {
+		const XAie_StrmPort *Slot = &StrmMod->SlvSlotConfig[Type];
+
+		if((Slot->NumPorts != 0U) && ((HasSlots == XAIE_DISABLE) ||
+					(Slot->PortBaseAddr < SlotBase))) {
+			SlotBase = Slot->PortBaseAddr;
+			HasSlots = XAIE_ENABLE;
+		}
+	}
+
+	for(u32 Port = 0U; (Port <= StrmMod->MaxSlavePhyPortId) &&
+			(HasSlots == XAIE_ENABLE) && (RC == XAIE_OK); Port++) {
+		RC = _XAie_CfgSnapAddStrided(Snap, MaxRanges, TileAddr +
+				SlotBase + Port * StrmMod->SlotOffsetPerPort,
+				StrmMod->NumSlaveSlots, StrmMod->SlotOffset);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the event, performance counter and timer control registers of
+* a module to a snapshot. The registers generating events on write are left
+* out.
+*
+* @param	Snap: Snapshot being set up.
+* @param	MaxRanges: Number of ranges allocated in the snapshot.
+* @param	TileAddr: Address of the tile.
+* @param	EvntMod: Events module.
+* @param	PerfMod: Performance counter module.
+* @param	TimerMod: Timer module.
+*
+* @return	XAIE_OK on success, XAIE_ERR if memory allocation fails.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CfgSnapAddEvents(XAie_CfgSnapshot *Snap, u32 *MaxRanges,
+		u64 TileAddr, const XAie_EvntMod *EvntMod,
+		const XAie_PerfMod *PerfMod, const XAie_TimerMod *TimerMod)
+{
+	AieRC RC = XAIE_OK;
+
+	if(TimerMod != NULL) {
+		RC = _XAie_CfgSnapAddRange(Snap, MaxRanges,
+				TileAddr + TimerMod->CtrlOff, 1U);
+		RC |= _XAie_CfgSnapAddRange(Snap, MaxRanges,
+				TileAddr + TimerMod->TrigEventLowValOff, 1U);
+		RC |= _XAie_CfgSnapAddRange(Snap, MaxRanges,
+				TileAddr + TimerMod->TrigEventHighValOff, 1U);
+	}
+
+	if((PerfMod != NULL) && (PerfMod->MaxCounterVal != 0U)) {
+		RC |= _XAie_CfgSnapAddStrided(Snap, MaxRanges,
+				TileAddr + PerfMod->PerfCtrlBaseAddr,
+				(PerfMod->MaxCounterVal + 1U) / 2U,
+				PerfMod->PerfCtrlOffsetAdd);
+		RC |= _XAie_CfgSnapAddRange(Snap, MaxRanges,
+				TileAddr + PerfMod->PerfCtrlResetBaseAddr,
+				(PerfMod->MaxCounterVal * PerfMod->ResetShift +
+				 31U) / 32U);
+		RC |= _XAie_CfgSnapAddStrided(Snap, MaxRanges,
+				TileAddr + PerfMod->PerfCounterBaseAddr,
+				PerfMod->MaxCounterVal,
+				PerfMod->PerfCounterOffsetAdd);
+		RC |= _XAie_CfgSnapAddStrided(Snap, MaxRanges,
+				TileAddr + PerfMod->PerfCounterEvtValBaseAddr,
+				PerfMod->MaxCounterVal,
+				PerfMod->PerfCounterOffsetAdd);
+	}
+
+	if(EvntMod != NULL) {
+		RC |= _XAie_CfgSnapAddRange(Snap, MaxRanges,
+				TileAddr + EvntMod->ComboInputRegOff, 1U);
+		RC |= _XAie_CfgSnapAddRange(Snap, MaxRanges,
+				TileAddr + EvntMod->ComboCtrlRegOff, 1U);
+		if(EvntMod->StrmPortSelectIdsPerReg != 0U) {
+			RC |= _XAie_CfgSnapAddRange(Snap, MaxRanges,
+					TileAddr +
+					EvntMod->BaseStrmPortSelectRegOff,
+					(EvntMod->NumStrmPortSelectIds +
+					 EvntMod->StrmPortSelectIdsPerReg -
+					 1U) / EvntMod->StrmPortSelectIdsPerReg);
+		}
+		RC |= _XAie_CfgSnapAddRange(Snap, MaxRanges,
+				TileAddr + EvntMod->BaseBroadcastRegOff,
+				EvntMod->NumBroadcastIds);
+		RC |= _XAie_CfgSnapAddRange(Snap, MaxRanges,
+				TileAddr + EvntMod->BaseGroupEventRegOff,
+				EvntMod->NumGroupEvents);
+		RC |= _XAie_CfgSnapAddRange(Snap, MaxRanges,
+				TileAddr + EvntMod->BasePCEventRegOff,
+				EvntMod->NumPCEvents);
+	}
+
+	return (RC == XAIE_OK) ? XAIE_OK : XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the registers of a tile to a snapshot. The DMA channel controls
+* are added separately, after the registers of all the tiles, so that restoring
+* a snapshot enables the channels once the rest of the configuration is back.
+*
+* @param	DevInst: Device Instance.
+* @param	Snap: Snapshot being set up.
+* @param	MaxRanges: Number of ranges allocated in the snapshot.
+* @param	Loc: Location of the tile.
+* @param	ChCtrl: XAIE_ENABLE to add the DMA channel controls only,
+*		XAIE_DISABLE to add all the other registers.
+*
+* @return	XAIE_OK on success, XAIE_ERR if memory allocation fails.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CfgSnapAddTile(XAie_DevInst *DevInst,
+		XAie_CfgSnapshot *Snap, u32 *MaxRanges, XAie_LocType Loc,
+		u8 ChCtrl)
+{
+	AieRC RC = XAIE_OK;
+	const XAie_TileMod *TileMod;
+	u64 TileAddr;
+	u8 TileType;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	TileMod = &DevInst->DevProp.DevMod[TileType];
+	TileAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	if(ChCtrl == XAIE_ENABLE) {
+		const XAie_DmaMod *DmaMod = TileMod->DmaMod;
+
+		if(((Snap->Flags & XAIE_CFG_SNAP_DMA) == 0U) ||
+				(DmaMod == NULL)) {
+			return XAIE_OK;
+		}
+
+		/* The start queue words are left out, they push tasks */
+		for(u32 Ch = 0U; (Ch < 2U * DmaMod->NumChannels) &&
+				(RC == XAIE_OK); Ch++) {
+			RC = _XAie_CfgSnapAddRange(Snap, MaxRanges, TileAddr +
+					DmaMod->ChCtrlBase +
+					Ch * DmaMod->ChIdxOffset, 1U);
+		}
+
+		return RC;
+	}
+
+	if(((Snap->Flags & XAIE_CFG_SNAP_LOCKS) != 0U) &&
+			(TileMod->LockMod != NULL) &&
+			(TileMod->LockMod->LockSetValOff != 0U)) {
+		RC = _XAie_CfgSnapAddStrided(Snap, MaxRanges,
+				TileAddr + TileMod->LockMod->LockSetValBase,
+				TileMod->LockMod->NumLocks,
+				TileMod->LockMod->LockSetValOff);
+	}
+
+	if((RC == XAIE_OK) && ((Snap->Flags & XAIE_CFG_SNAP_DMA) != 0U) &&
+			(TileMod->DmaMod != NULL)) {
+		RC = _XAie_CfgSnapAddRange(Snap, MaxRanges,
+				TileAddr + TileMod->DmaMod->BaseAddr,
+				TileMod->DmaMod->NumBds *
+				TileMod->DmaMod->IdxOffset / (u32)sizeof(u32));
+	}
+
+	if((RC == XAIE_OK) && ((Snap->Flags & XAIE_CFG_SNAP_STRMSW) != 0U) &&
+			(TileMod->StrmSw != NULL)) {
+		RC = _XAie_CfgSnapAddStrmSw(Snap, MaxRanges, TileAddr,
+				TileMod->StrmSw);
+	}
+
+	for(u8 Mod = 0U; (Mod < TileMod->NumModules) && (RC == XAIE_OK);
+			Mod++) {
+		if((Snap->Flags & XAIE_CFG_SNAP_EVENTS) != 0U) {
+			RC = _XAie_CfgSnapAddEvents(Snap, MaxRanges, TileAddr,
+					(TileMod->EvntMod != NULL) ?
+					&TileMod->EvntMod[Mod] : NULL,
+					(TileMod->PerfMod != NULL) ?
+					&TileMod->PerfMod[Mod] : NULL,
+					(TileMod->TimerMod != NULL) ?
+					&TileMod->TimerMod[Mod] : NULL);
+		}
+
+		if((RC == XAIE_OK) &&
+				((Snap->Flags & XAIE_CFG_SNAP_TRACE) != 0U) &&
+				(TileMod->TraceMod != NULL)) {
+			const XAie_TraceMod *TraceMod = &TileMod->TraceMod[Mod];
+
+			RC = _XAie_CfgSnapAddRange(Snap, MaxRanges,
+					TileAddr + TraceMod->CtrlRegOff, 1U);
+			if(RC == XAIE_OK) {
+				RC = _XAie_CfgSnapAddRange(Snap, MaxRanges,
+						TileAddr +
+						TraceMod->PktConfigRegOff, 1U);
+			}
+			for(u8 i = 0U; (RC == XAIE_OK) &&
+					(i < TraceMod->NumTraceSlotIds /
+					 TraceMod->NumEventsPerSlot); i++) {
+				RC = _XAie_CfgSnapAddRange(Snap, MaxRanges,
+						TileAddr +
+						TraceMod->EventRegOffs[i], 1U);
+			}
+		}
+	}
+
+	if((RC == XAIE_OK) && ((Snap->Flags & XAIE_CFG_SNAP_MEM) != 0U)) {
+		if(TileMod->MemMod != NULL) {
+			RC = _XAie_CfgSnapAddRange(Snap, MaxRanges,
+					TileAddr + TileMod->MemMod->MemAddr,
+					TileMod->MemMod->Size /
+					(u32)sizeof(u32));
+		}
+		if((RC == XAIE_OK) && (TileMod->CoreMod != NULL)) {
+			RC = _XAie_CfgSnapAddRange(Snap, MaxRanges,
+					TileAddr +
+					TileMod->CoreMod->ProgMemHostOffset,
+					TileMod->CoreMod->ProgMemSize /
+					(u32)sizeof(u32));
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if a tile of the partition is in use.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the tile.
+*
+* @return	XAIE_ENABLE if the tile is in use, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u8 _XAie_CfgSnapTileInUse(XAie_DevInst *DevInst, XAie_LocType Loc)
+{
+	u8 TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		return XAIE_DISABLE;
+	}
+
+	if((TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
+			(TileType == XAIEGBL_TILE_TYPE_SHIMPL)) {
+		return XAIE_ENABLE;
+	}
+
+	return (CheckBit(DevInst->TilesInUse,
+			_XAie_GetTileBitPosFromLoc(DevInst, Loc)) != 0U) ?
+		XAIE_ENABLE : XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets up a snapshot of the configuration of a set of tiles. The
+* registers of the requested parts of the configuration are listed from the
+* register database and merged in runs of consecutive registers, and the
+* memory to hold their values is allocated. The values are read by
+* XAie_CfgSnapshotSave().
+*
+* @param	DevInst: Device Instance.
+* @param	Snap: Snapshot to set up.
+* @param	Locs: Locations of the tiles. If NULL, all the tiles of the
+*		partition in use are taken.
+* @param	NumLocs: Number of tiles, 0 if Locs is NULL.
+* @param	Flags: Parts of the configuration to save, OR of:
+*			XAIE_CFG_SNAP_LOCKS: Lock values.
+*			XAIE_CFG_SNAP_DMA: Buffer descriptors and channel
+*			controls.
+*			XAIE_CFG_SNAP_STRMSW: Stream switch ports and slots.
+*			XAIE_CFG_SNAP_EVENTS: Event, performance counter and
+*			timer controls.
+*			XAIE_CFG_SNAP_TRACE: Trace controls.
+*			XAIE_CFG_SNAP_MEM: Data and program memories.
+*		XAIE_CFG_SNAP_DEFAULT takes all of them but the memories.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The lock values are only saved on devices where they can be
+*		set, from AIEML on. The start queues of the DMA channels, the
+*		core controls and the broadcast switch blocking are not saved:
+*		after a restore, the caller enqueues the DMA tasks and enables
+*		the cores again.
+*
+******************************************************************************/
+AieRC XAie_CfgSnapshotInit(XAie_DevInst *DevInst, XAie_CfgSnapshot *Snap,
+		const XAie_LocType *Locs, u32 NumLocs, u32 Flags)
+{
+	AieRC RC = XAIE_OK;
+	u32 MaxRanges = 0U;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Snap == XAIE_NULL) || ((Locs == XAIE_NULL) != (NumLocs == 0U)) ||
+			(Flags == 0U) || ((Flags & ~(XAIE_CFG_SNAP_DEFAULT |
+				XAIE_CFG_SNAP_MEM)) != 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		if(_XAie_DevGetTTypefromLoc(DevInst, Locs[i]) ==
+				XAIEGBL_TILE_TYPE_MAX) {
+			XAIE_ERROR("Invalid Tile Type\n");
+			return XAIE_INVALID_TILE;
+		}
+	}
+
+	Snap->Ranges = NULL;
+	Snap->NumRanges = 0U;
+	Snap->Data = NULL;
+	Snap->NumWords = 0U;
+	Snap->Flags = Flags;
+	Snap->IsSaved = XAIE_DISABLE;
+	Snap->IsReady = 0U;
+
+	for(u8 ChCtrl = XAIE_DISABLE; (ChCtrl <= XAIE_ENABLE) &&
+			(RC == XAIE_OK); ChCtrl++) {
+		if(Locs != XAIE_NULL) {
+			for(u32 i = 0U; (i < NumLocs) && (RC == XAIE_OK);
+					i++) {
+				RC = _XAie_CfgSnapAddTile(DevInst, Snap,
+						&MaxRanges, Locs[i], ChCtrl);
+			}
+			continue;
+		}
+
+		for(u8 Col = 0U; (Col < DevInst->NumCols) && (RC == XAIE_OK);
+				Col++) {
+			for(u8 Row = 0U; (Row < DevInst->NumRows) &&
+					(RC == XAIE_OK); Row++) {
+				XAie_LocType Loc = XAie_TileLoc(Col, Row);
+
+				if(_XAie_CfgSnapTileInUse(DevInst, Loc) ==
+						XAIE_ENABLE) {
+					RC = _XAie_CfgSnapAddTile(DevInst,
+							Snap, &MaxRanges, Loc,
+							ChCtrl);
+				}
+			}
+		}
+	}
+
+	if((RC == XAIE_OK) && (Snap->NumWords == 0U)) {
+		XAIE_ERROR("No register to save in the snapshot\n");
+		RC = XAIE_INVALID_ARGS;
+	}
+
+	if(RC == XAIE_OK) {
+		Snap->Data = (u32 *)calloc(Snap->NumWords, sizeof(u32));
+		if(Snap->Data == NULL) {
+			XAIE_ERROR("Memory allocation for snapshot failed\n");
+			RC = XAIE_ERR;
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		free(Snap->Ranges);
+		Snap->Ranges = NULL;
+		Snap->NumRanges = 0U;
+		return RC;
+	}
+
+	XAIE_DBG("Configuration snapshot of %d words in %d ranges\n",
+			Snap->NumWords, Snap->NumRanges);
+	Snap->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API saves the configuration of the tiles of a snapshot. Each run of
+* consecutive registers is fetched with one block read.
+*
+* @param	DevInst: Device Instance.
+* @param	Snap: Snapshot set up by XAie_CfgSnapshotInit().
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The snapshot can be saved any number of times, the last save
+*		is restored. The tiles are expected to be quiet, with their
+*		cores and DMA channels stopped, while they are saved.
+*
+******************************************************************************/
+AieRC XAie_CfgSnapshotSave(XAie_DevInst *DevInst, XAie_CfgSnapshot *Snap)
+{
+	AieRC RC = XAIE_OK;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Snap == XAIE_NULL) || (Snap->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid snapshot\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Snap->IsSaved = XAIE_DISABLE;
+	for(u32 i = 0U; (i < Snap->NumRanges) && (RC == XAIE_OK); i++) {
+		const XAie_CfgSnapRange *Range = &Snap->Ranges[i];
+
+		if(Range->NumWords == 1U) {
+			RC = XAie_Read32(DevInst, Range->RegOff,
+					&Snap->Data[Range->DataOff]);
+		} else {
+			RC = XAie_BlockRead32(DevInst, Range->RegOff,
+					&Snap->Data[Range->DataOff],
+					Range->NumWords);
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to save configuration snapshot\n");
+		return RC;
+	}
+
+	Snap->IsSaved = XAIE_ENABLE;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API restores the configuration saved in a snapshot. The registers are
+* written back in one transaction, with the optimization pass enabled so that
+* the single registers next to each other are coalesced in block writes.
+*
+* @param	DevInst: Device Instance.
+* @param	Snap: Snapshot saved by XAie_CfgSnapshotSave().
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		If a transaction is active on the calling thread, the writes
+*		are recorded in it instead. The DMA channel controls are
+*		written last, the start queues are not restored.
+*
+******************************************************************************/
+AieRC XAie_CfgSnapshotRestore(XAie_DevInst *DevInst,
+		const XAie_CfgSnapshot *Snap)
+{
+	AieRC RC = XAIE_OK;
+	u8 OwnTxn = XAIE_DISABLE;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Snap == XAIE_NULL) || (Snap->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Snap->IsSaved != XAIE_ENABLE)) {
+		XAIE_ERROR("Invalid snapshot\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH |
+				XAIE_TRANSACTION_ENABLE_OPTIMIZE);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	for(u32 i = 0U; (i < Snap->NumRanges) && (RC == XAIE_OK); i++) {
+		const XAie_CfgSnapRange *Range = &Snap->Ranges[i];
+
+		if(Range->NumWords == 1U) {
+			RC = XAie_Write32(DevInst, Range->RegOff,
+					Snap->Data[Range->DataOff]);
+		} else {
+			RC = XAie_BlockWrite32(DevInst, Range->RegOff,
+					&Snap->Data[Range->DataOff],
+					Range->NumWords);
+		}
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to restore configuration snapshot\n");
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the memory of a snapshot.
+*
+* @param	Snap: Snapshot set up by XAie_CfgSnapshotInit().
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if Snap is invalid.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_CfgSnapshotFree(XAie_CfgSnapshot *Snap)
+{
+	if((Snap == XAIE_NULL) || (Snap->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid snapshot\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(Snap->Ranges);
+	free(Snap->Data);
+	Snap->Ranges = NULL;
+	Snap->Data = NULL;
+	Snap->NumRanges = 0U;
+	Snap->NumWords = 0U;
+	Snap->IsSaved = XAIE_DISABLE;
+	Snap->IsReady = 0U;
+
+	return XAIE_OK;
+}
+
+/** @} */
@@ -0,0 +1,71 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_cfgsnap.h
+* @{
+*
+* This file contains routines to save the configuration of a set of tiles and
+* to restore it later, for instance to switch between the contexts sharing a
+* partition.
+*
+******************************************************************************/
+#ifndef XAIE_CFGSNAP_H
+#define XAIE_CFGSNAP_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_CFG_SNAP_LOCKS		(1U << 0)
+#define XAIE_CFG_SNAP_DMA		(1U << 1)
+#define XAIE_CFG_SNAP_STRMSW		(1U << 2)
+#define XAIE_CFG_SNAP_EVENTS		(1U << 3)
+#define XAIE_CFG_SNAP_TRACE		(1U << 4)
+#define XAIE_CFG_SNAP_MEM		(1U << 5)
+#define XAIE_CFG_SNAP_DEFAULT		(XAIE_CFG_SNAP_LOCKS | \
+		XAIE_CFG_SNAP_DMA | XAIE_CFG_SNAP_STRMSW | \
+		XAIE_CFG_SNAP_EVENTS | XAIE_CFG_SNAP_TRACE)
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures a run of consecutive registers of a configuration
+ * snapshot. Its values are stored from word DataOff of the snapshot data.
+ */
+typedef struct {
+	u64 RegOff;		/* Partition relative address of the first word */
+	u32 NumWords;
+	u32 DataOff;
+} XAie_CfgSnapRange;
+
+/*
+ * This typedef captures the configuration of a set of tiles. The registers to
+ * save are taken from the register database once by XAie_CfgSnapshotInit() and
+ * merged in runs of consecutive registers. XAie_CfgSnapshotSave() reads one
+ * block per run and XAie_CfgSnapshotRestore() writes them back.
+ */
+typedef struct {
+	XAie_CfgSnapRange *Ranges;
+	u32 NumRanges;
+	u32 *Data;
+	u32 NumWords;
+	u32 Flags;		/* XAIE_CFG_SNAP_* parts of the configuration */
+	u8 IsSaved;		/* XAIE_ENABLE once Data holds a saved state */
+	u8 IsReady;
+} XAie_CfgSnapshot;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_CfgSnapshotInit(XAie_DevInst *DevInst, XAie_CfgSnapshot *Snap,
+		const XAie_LocType *Locs, u32 NumLocs, u32 Flags);
+AieRC XAie_CfgSnapshotSave(XAie_DevInst *DevInst, XAie_CfgSnapshot *Snap);
+AieRC XAie_CfgSnapshotRestore(XAie_DevInst *DevInst,
+		const XAie_CfgSnapshot *Snap);
+AieRC XAie_CfgSnapshotFree(XAie_CfgSnapshot *Snap);
+
+#endif		/* end of protection macro */
+
+/** @} */
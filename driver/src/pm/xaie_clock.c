@@ -22,14 +22,26 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#ifndef __AIEBAREMETAL__
+#define  _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdlib.h>
+#ifndef __AIEBAREMETAL__
+#include <time.h>
+#endif
+
 #include "xaie_clock.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
+#include "xaie_npi.h"
 
 #ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
 
 /*****************************************************************************/
 /***************************** Macro Definitions *****************************/
+#define XAIE_CLOCK_NS_PER_SEC		1000000000ULL
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -107,7 +119,7 @@ u8 _XAie_PmIsTileRequested(XAie_DevInst *DevInst, XAie_LocType Loc)
 		return XAIE_DISABLE;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if (TileType == XAIEGBL_TILE_TYPE_MAX) {
 		return XAIE_DISABLE;
 	}
@@ -118,12 +130,277 @@ u8 _XAie_PmIsTileRequested(XAie_DevInst *DevInst, XAie_LocType Loc)
 	}
 
 	TileBit = Loc.Col * (DevInst->NumRows - 1) + Loc.Row - 1;
-	if (CheckBit(DevInst->DevOps->TilesInUse, TileBit)) {
+	if (CheckBit(DevInst->TilesInUse, TileBit)) {
 		return XAIE_ENABLE;
 	}
 
 	return XAIE_DISABLE;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API returns the host monotonic time.
+*
+* @return	Host time in nanoseconds, 0 on baremetal.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u64 _XAie_PmHostNs(void)
+{
+#ifndef __AIEBAREMETAL__
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * XAIE_CLOCK_NS_PER_SEC + (u64)Ts.tv_nsec;
+#else
+	return 0U;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks the arguments of the column clock gating APIs.
+*
+* @param	DevInst: Device Instance
+* @param	StartCol: First column, relative to the partition.
+* @param	NumCols: Number of columns.
+*
+* @return	XAIE_OK if the arguments are valid, error code otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_PmCheckColumns(XAie_DevInst *DevInst, u32 StartCol,
+		u32 NumCols)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((NumCols == 0U) || (StartCol >= DevInst->NumCols) ||
+			(NumCols > DevInst->NumCols - StartCol)) {
+		XAIE_ERROR("Invalid columns range, start %d, number %d\n",
+				StartCol, NumCols);
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API passes the tiles above the SHIM row of a range of columns to the
+* Linux kernel to request or release them.
+*
+* @param	DevInst: Device Instance
+* @param	StartCol: First column, relative to the partition.
+* @param	NumCols: Number of columns.
+* @param	Op: XAIE_BACKEND_OP_REQUEST_TILES or
+*		XAIE_BACKEND_OP_RELEASE_TILES.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The kernel owns the clock buffers of the
+*		partition with the Linux backend.
+*
+*******************************************************************************/
+static AieRC _XAie_PmRunColumnsOp(XAie_DevInst *DevInst, u32 StartCol,
+		u32 NumCols, XAie_BackendOpCode Op)
+{
+	XAie_BackendTilesArray TilesArray;
+	XAie_LocType *Locs;
+	u32 NumTiles = NumCols * (DevInst->NumRows - 1U);
+	AieRC RC;
+
+	Locs = malloc(NumTiles * sizeof(*Locs));
+	if(Locs == NULL) {
+		XAIE_ERROR("Failed to allocate memory for tiles\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 C = 0U; C < NumCols; C++) {
+		for(u32 R = 1U; R < DevInst->NumRows; R++) {
+			Locs[C * (DevInst->NumRows - 1U) + R - 1U] =
+				XAie_TileLoc(StartCol + C, R);
+		}
+	}
+
+	TilesArray.NumTiles = NumTiles;
+	TilesArray.Locs = Locs;
+	RC = XAie_RunOp(DevInst, Op, (void *)&TilesArray);
+	free(Locs);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the clock buffers of a range of columns, enabling the
+* protected registers around the writes for the devices which need it.
+*
+* @param	DevInst: Device Instance
+* @param	StartCol: First column, relative to the partition.
+* @param	NumCols: Number of columns.
+* @param	Enable: XAIE_ENABLE to ungate the columns, XAIE_DISABLE to gate
+*		them.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_PmSetColumnsClockProt(XAie_DevInst *DevInst, u32 StartCol,
+		u32 NumCols, u8 Enable)
+{
+	XAie_NpiProtRegReq ProtRegReq = {0};
+	AieRC RC;
+
+	if(DevInst->DevProp.DevGen != XAIE_DEV_GEN_AIE) {
+		ProtRegReq.Enable = XAIE_ENABLE;
+		XAie_RunOp(DevInst, XAIE_BACKEND_OP_SET_PROTREG,
+				(void *)&ProtRegReq);
+	}
+
+	RC = _XAie_PmSetColumnsClock(DevInst, StartCol, NumCols, Enable);
+
+	if(DevInst->DevProp.DevGen != XAIE_DEV_GEN_AIE) {
+		ProtRegReq.Enable = XAIE_DISABLE;
+		XAie_RunOp(DevInst, XAIE_BACKEND_OP_SET_PROTREG,
+				(void *)&ProtRegReq);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API gates the clocks of a range of columns of the partition, e.g. to
+* keep idle columns cool while other columns run. The column clock buffers
+* gate the tiles above the SHIM row. The SHIM tiles stay clocked, so the
+* stream switch routes along the SHIM row through the gated columns keep
+* working. Routes through the stream switches of the gated tiles stop.
+*
+* @param	DevInst: Device Instance
+* @param	StartCol: First column, relative to the partition.
+* @param	NumCols: Number of columns.
+*
+* @return	XAIE_OK on success.
+*		XAIE_INVALID_ARGS if any argument is invalid
+*
+* @note		The tiles of the gated columns are no longer requested, so the
+*		other APIs do not access them until the columns are ungated
+*		with XAie_PmUngateColumns().
+*
+*******************************************************************************/
+AieRC XAie_PmGateColumns(XAie_DevInst *DevInst, u32 StartCol, u32 NumCols)
+{
+	AieRC RC;
+
+	RC = _XAie_PmCheckColumns(DevInst, StartCol, NumCols);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(DevInst->Backend->Type == XAIE_IO_BACKEND_LINUX) {
+		RC = _XAie_PmRunColumnsOp(DevInst, StartCol, NumCols,
+				XAIE_BACKEND_OP_RELEASE_TILES);
+	} else {
+		RC = _XAie_PmSetColumnsClockProt(DevInst, StartCol, NumCols,
+				XAIE_DISABLE);
+	}
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to gate columns\n");
+		return RC;
+	}
+
+	_XAie_ClrBitInBitmapAtomic(DevInst->TilesInUse,
+			StartCol * (DevInst->NumRows - 1U),
+			NumCols * (DevInst->NumRows - 1U));
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API ungates the clocks of a range of columns of the partition before a
+* job starts on them, and marks their tiles as requested.
+*
+* @param	DevInst: Device Instance
+* @param	StartCol: First column, relative to the partition.
+* @param	NumCols: Number of columns.
+* @param	LatencyNs: Pointer to return the host time taken to ungate the
+*		columns in nanoseconds, NULL if not needed. It is 0 on
+*		baremetal.
+*
+* @return	XAIE_OK on success.
+*		XAIE_INVALID_ARGS if any argument is invalid
+*
+* @note		The clock buffer of the last column is read back before the
+*		latency is taken, so the latency includes the completion of
+*		the posted writes. Within a transaction, the latency only
+*		covers recording the writes.
+*
+*******************************************************************************/
+AieRC XAie_PmUngateColumns(XAie_DevInst *DevInst, u32 StartCol, u32 NumCols,
+		u64 *LatencyNs)
+{
+	u64 StartNs;
+	AieRC RC;
+
+	RC = _XAie_PmCheckColumns(DevInst, StartCol, NumCols);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	StartNs = _XAie_PmHostNs();
+	if(DevInst->Backend->Type == XAIE_IO_BACKEND_LINUX) {
+		/* The backend marks the tiles in use */
+		RC = _XAie_PmRunColumnsOp(DevInst, StartCol, NumCols,
+				XAIE_BACKEND_OP_REQUEST_TILES);
+	} else {
+		RC = _XAie_PmSetColumnsClockProt(DevInst, StartCol, NumCols,
+				XAIE_ENABLE);
+		if((RC == XAIE_OK) &&
+				(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE)) {
+			const XAie_ShimClkBufCntr *ClkBufCntr;
+			u8 TileType;
+			u32 RegVal;
+
+			TileType = _XAie_DevGetTTypefromLoc(DevInst,
+					XAie_TileLoc(StartCol + NumCols - 1U,
+						0U));
+			ClkBufCntr = DevInst->DevProp.DevMod[TileType].
+				PlIfMod->ClkBufCntr;
+			RC = XAie_Read32(DevInst, ClkBufCntr->RegOff +
+					_XAie_GetTileAddr(DevInst, 0U,
+						StartCol + NumCols - 1U),
+					&RegVal);
+		}
+	}
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to ungate columns\n");
+		return RC;
+	}
+
+	if(LatencyNs != NULL) {
+		*LatencyNs = _XAie_PmHostNs() - StartNs;
+	}
+
+	_XAie_SetBitInBitmapAtomic(DevInst->TilesInUse,
+			StartCol * (DevInst->NumRows - 1U),
+			NumCols * (DevInst->NumRows - 1U));
+
+	return XAIE_OK;
+}
+
 #endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
 /** @} */
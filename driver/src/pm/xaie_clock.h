@@ -30,6 +30,11 @@
 
 /************************** Function Prototypes  *****************************/
 AieRC _XAie_PmSetPartitionClock(XAie_DevInst *DevInst, u8 Enable);
+AieRC _XAie_PmSetColumnsClock(XAie_DevInst *DevInst, u32 StartCol,
+		u32 NumCols, u8 Enable);
+AieRC XAie_PmGateColumns(XAie_DevInst *DevInst, u32 StartCol, u32 NumCols);
+AieRC XAie_PmUngateColumns(XAie_DevInst *DevInst, u32 StartCol, u32 NumCols,
+		u64 *LatencyNs);
 AieRC XAie_PmRequestTiles(XAie_DevInst *DevInst, XAie_LocType *Loc,
 		u32 NumTiles);
 u8 _XAie_PmIsTileRequested(XAie_DevInst *DevInst, XAie_LocType Loc);
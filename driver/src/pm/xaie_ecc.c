@@ -22,10 +22,14 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+
+#include "xaie_clock.h"
 #include "xaie_feature_config.h"
 #include "xaie_ecc.h"
 #include "xaie_events.h"
 #include "xaie_helper.h"
+#include "xaie_mem.h"
 #include "xaie_perfcnt.h"
 
 #if defined(XAIE_FEATURE_PRIVILEGED_ENABLE) && \
@@ -38,6 +42,7 @@
 #define XAIE_BROADCAST_CHANNEL_6		6U
 #define XAIE_ECC_SCRUB_CLOCK_COUNT		1000000U
 #define XAIE_ECC_PERFCOUNTER_ID			0U
+#define XAIE_ECC_SCRUB_DEF_CHUNK_SIZE		64U
 
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
@@ -47,6 +52,8 @@
 *
 * @param        DevInst: Device Instance
 * @param        Loc: Location of AIE tile
+* @param        Reserve: XAIE_ENABLE to reserve the perf counter, XAIE_DISABLE
+*               if it was reserved with _XAie_EccRequestTiles().
 *
 * @return       none
 *
@@ -55,17 +62,20 @@
 *
 *
 ******************************************************************************/
-static AieRC _XAie_EccPerfCntConfig(XAie_DevInst *DevInst, XAie_LocType Loc)
+static AieRC _XAie_EccPerfCntConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u8 Reserve)
 {
 	AieRC RC;
 
 	/* Reserve perf counter 0 of Core Module for ECC */
 	XAie_UserRsc ReturnRsc = {Loc, XAIE_CORE_MOD, XAIE_PERFCNT_RSC,
 		XAIE_ECC_PERFCOUNTER_ID};
-	RC = XAie_RequestAllocatedPerfcnt(DevInst, 1U, &ReturnRsc);
-	if(RC != XAIE_OK) {
-		XAIE_ERROR("Unable to reserve perf counter for ECC\n");
-		return XAIE_ERR;
+	if(Reserve == XAIE_ENABLE) {
+		RC = XAie_RequestAllocatedPerfcnt(DevInst, 1U, &ReturnRsc);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to reserve perf counter for ECC\n");
+			return XAIE_ERR;
+		}
 	}
 
 	/*
@@ -111,6 +121,8 @@ static AieRC _XAie_EccPerfCntConfig(XAie_DevInst *DevInst, XAie_LocType Loc)
 *
 * @param        DevInst: Device Instance
 * @param        Loc: Location of AIE tile
+* @param        Reserve: XAIE_ENABLE to reserve the perf counter, XAIE_DISABLE
+*               if it was reserved with _XAie_EccRequestTiles().
 *
 * @return       none
 *
@@ -123,7 +135,8 @@ static AieRC _XAie_EccPerfCntConfig(XAie_DevInst *DevInst, XAie_LocType Loc)
 *               with that generated event.
 *
 ******************************************************************************/
-AieRC _XAie_EccOnDM(XAie_DevInst *DevInst, XAie_LocType Loc)
+static AieRC _XAie_EccOnDMCfg(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u8 Reserve)
 {
 	AieRC RC;
 	u8 Dir, TileType;
@@ -132,7 +145,7 @@ AieRC _XAie_EccOnDM(XAie_DevInst *DevInst, XAie_LocType Loc)
 	const XAie_MemMod *MemMod;
 	const XAie_EvntMod *EvntMod;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 
 	/* Check if tile is shim noc or shim pl */
 	if((TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
@@ -143,7 +156,7 @@ AieRC _XAie_EccOnDM(XAie_DevInst *DevInst, XAie_LocType Loc)
 
 	/* Check bitmap for data memory already in use */
 	CheckTileEccStatus = _XAie_GetTileBitPosFromLoc(DevInst, Loc);
-	if(CheckBit(DevInst->DevOps->MemInUse, CheckTileEccStatus)) {
+	if(CheckBit(DevInst->MemInUse, CheckTileEccStatus)) {
 		return XAIE_OK;
 	}
 
@@ -199,25 +212,44 @@ AieRC _XAie_EccOnDM(XAie_DevInst *DevInst, XAie_LocType Loc)
 	 * Skip perf counter 0 configuration in core module if program memory
 	 * already in use.
 	 */
-	if(CheckBit(DevInst->DevOps->CoreInUse, CheckTileEccStatus)) {
-		_XAie_SetBitInBitmap(DevInst->DevOps->MemInUse,
+	if(CheckBit(DevInst->CoreInUse, CheckTileEccStatus)) {
+		_XAie_SetBitInBitmapAtomic(DevInst->MemInUse,
 				CheckTileEccStatus, 1U);
 		return XAIE_OK;
 	}
 
 	/* Configure Performance counter 0 to generate event to trigger ECC */
-	RC = _XAie_EccPerfCntConfig(DevInst, Loc);
+	RC = _XAie_EccPerfCntConfig(DevInst, Loc, Reserve);
 	if(RC != XAIE_OK) {
 		XAIE_ERROR("Unable to configure performance counter for ECC\n");
 		return RC;
 	}
 
 	/* Set bit corresponding to tile in MemInUse bitmap */
-	_XAie_SetBitInBitmap(DevInst->DevOps->MemInUse, CheckTileEccStatus, 1U);
+	_XAie_SetBitInBitmapAtomic(DevInst->MemInUse, CheckTileEccStatus, 1U);
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* This API configures registers to turn ECC On for Data memory of the given
+* tile.
+*
+* @param        DevInst: Device Instance
+* @param        Loc: Location of AIE tile
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         This API is internal, hence all the argument checks are taken
+*               care of in the caller API.
+*
+******************************************************************************/
+AieRC _XAie_EccOnDM(XAie_DevInst *DevInst, XAie_LocType Loc)
+{
+	return _XAie_EccOnDMCfg(DevInst, Loc, XAIE_ENABLE);
+}
+
 /*****************************************************************************/
 /**
 * This API configures registers to turn ECC On for Program memory of the given
@@ -225,6 +257,8 @@ AieRC _XAie_EccOnDM(XAie_DevInst *DevInst, XAie_LocType Loc)
 *
 * @param        DevInst: Device Instance
 * @param        Loc: Location of tile
+* @param        Reserve: XAIE_ENABLE to reserve the perf counter, XAIE_DISABLE
+*               if it was reserved with _XAie_EccRequestTiles().
 *
 * @return       none
 *
@@ -236,7 +270,8 @@ AieRC _XAie_EccOnDM(XAie_DevInst *DevInst, XAie_LocType Loc)
 *               register of core module is configured with that generated event.
 *
 ******************************************************************************/
-AieRC _XAie_EccOnPM(XAie_DevInst *DevInst, XAie_LocType Loc)
+static AieRC _XAie_EccOnPMCfg(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u8 Reserve)
 {
 	AieRC RC;
 	u8 TileType;
@@ -245,7 +280,7 @@ AieRC _XAie_EccOnPM(XAie_DevInst *DevInst, XAie_LocType Loc)
 	const XAie_CoreMod *CoreMod;
 	const XAie_EvntMod *EvntMod;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 
 	/* Check if tile is shim noc or shim pl */
 	if((TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
@@ -268,24 +303,43 @@ AieRC _XAie_EccOnPM(XAie_DevInst *DevInst, XAie_LocType Loc)
 
 	/* Before configuring performance counter check if the DM in use */
 	CheckTileEccStatus = _XAie_GetTileBitPosFromLoc(DevInst, Loc);
-	if(CheckBit(DevInst->DevOps->MemInUse, CheckTileEccStatus)) {
+	if(CheckBit(DevInst->MemInUse, CheckTileEccStatus)) {
 		return XAIE_OK;
 	}
 
 	/* Configure Performance counter 0 to generate event to trigger ECC */
-	RC = _XAie_EccPerfCntConfig(DevInst, Loc);
+	RC = _XAie_EccPerfCntConfig(DevInst, Loc, Reserve);
 	if(RC != XAIE_OK) {
 		XAIE_ERROR("Unable to configure performance counter for ECC\n");
 		return RC;
 	}
 
 	/* Set bit corresponding to tile in CoreInUse bitmap */
-	_XAie_SetBitInBitmap(DevInst->DevOps->CoreInUse, CheckTileEccStatus,
+	_XAie_SetBitInBitmapAtomic(DevInst->CoreInUse, CheckTileEccStatus,
 			1U);
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* This API configures registers to turn ECC On for Program memory of the given
+* tile.
+*
+* @param        DevInst: Device Instance
+* @param        Loc: Location of tile
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         This API is internal, hence all the argument checks are taken
+*               care of in the caller API.
+*
+******************************************************************************/
+AieRC _XAie_EccOnPM(XAie_DevInst *DevInst, XAie_LocType Loc)
+{
+	return _XAie_EccOnPMCfg(DevInst, Loc, XAIE_ENABLE);
+}
+
 /*****************************************************************************/
 /**
 * This API configures the register to turn ECC Off for Program memory of the
@@ -309,7 +363,7 @@ void _XAie_EccEvntResetPM(XAie_DevInst *DevInst, XAie_LocType Loc)
 	u64 RegAddr;
 	const XAie_CoreMod *CoreMod;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	CoreMod = DevInst->DevProp.DevMod[TileType].CoreMod;
 
 	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
@@ -396,7 +450,7 @@ AieRC _XAie_EccOnMemTile(XAie_DevInst *DevInst, XAie_LocType Loc)
 	const XAie_MemMod *MemMod;
 	const XAie_EvntMod *EvntMod;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	/* Check if tile type is Mem tile */
 	if(TileType != XAIEGBL_TILE_TYPE_MEMTILE) {
 		XAIE_ERROR("ECC cannot be enabled for this tile.\n");
@@ -425,5 +479,448 @@ AieRC _XAie_EccOnMemTile(XAie_DevInst *DevInst, XAie_LocType Loc)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* This API reserves, in one request, perf counter 0 of the core module of all
+* the AIE tiles of a list whose ECC perf counter is not configured yet. It has
+* to be called before _XAie_EccOnTiles(), so that turning ECC on does not have
+* to issue a resource request per tile.
+*
+* @param        DevInst: Device Instance
+* @param        Locs: Array of tile locations. Locations which are not AIE
+*               tiles are skipped and duplicates are reserved once.
+* @param        NumLocs: Number of locations in Locs.
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         This API is internal, hence all the argument checks are taken
+*               care of in the caller API. The resource request is a backend
+*               operation, so with a transaction open it has to be called
+*               before any command is recorded.
+*
+******************************************************************************/
+AieRC _XAie_EccRequestTiles(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs)
+{
+	AieRC RC;
+	u32 NumRsc = 0U;
+	XAie_UserRsc *Rscs;
+
+	if(NumLocs == 0U) {
+		return XAIE_OK;
+	}
+
+	Rscs = (XAie_UserRsc *)malloc(NumLocs * sizeof(*Rscs));
+	if(Rscs == NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		u32 BitPos;
+		u32 j;
+
+		if(_XAie_DevGetTTypefromLoc(DevInst, Locs[i]) !=
+				XAIEGBL_TILE_TYPE_AIETILE) {
+			continue;
+		}
+
+		BitPos = _XAie_GetTileBitPosFromLoc(DevInst, Locs[i]);
+		if(CheckBit(DevInst->MemInUse, BitPos) ||
+				CheckBit(DevInst->CoreInUse, BitPos)) {
+			continue;
+		}
+
+		for(j = 0U; j < NumRsc; j++) {
+			if((Rscs[j].Loc.Col == Locs[i].Col) &&
+					(Rscs[j].Loc.Row == Locs[i].Row)) {
+				break;
+			}
+		}
+		if(j < NumRsc) {
+			continue;
+		}
+
+		Rscs[NumRsc].Loc = Locs[i];
+		Rscs[NumRsc].Mod = XAIE_CORE_MOD;
+		Rscs[NumRsc].RscType = XAIE_PERFCNT_RSC;
+		Rscs[NumRsc].RscId = XAIE_ECC_PERFCOUNTER_ID;
+		NumRsc++;
+	}
+
+	RC = XAIE_OK;
+	if(NumRsc > 0U) {
+		RC = XAie_RequestAllocatedPerfcnt(DevInst, NumRsc, Rscs);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to reserve perf counters for ECC\n");
+			RC = XAIE_ERR;
+		}
+	}
+
+	free(Rscs);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API turns ECC On for a list of tiles. The register writes of all the
+* tiles are recorded into one transaction, which is submitted before the API
+* returns unless the calling thread already has a transaction open.
+*
+* @param        DevInst: Device Instance
+* @param        Locs: Array of tile locations.
+* @param        NumLocs: Number of locations in Locs.
+* @param        Mem: XAIE_ECC_MEM_DM or XAIE_ECC_MEM_PM for the memory of the
+*               AIE tiles to turn ECC On for. It is ignored for Mem tiles.
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         This API is internal, hence all the argument checks are taken
+*               care of in the caller API. The perf counters of the AIE tiles
+*               must have been reserved with _XAie_EccRequestTiles().
+*
+******************************************************************************/
+AieRC _XAie_EccOnTiles(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs, u8 Mem)
+{
+	AieRC RC = XAIE_OK;
+	u8 OwnTxn = XAIE_DISABLE;
+
+	if(NumLocs == 0U) {
+		return XAIE_OK;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Locs[i]);
+		if(TileType == XAIEGBL_TILE_TYPE_MEMTILE) {
+			RC = _XAie_EccOnMemTile(DevInst, Locs[i]);
+		} else if(Mem == XAIE_ECC_MEM_DM) {
+			RC = _XAie_EccOnDMCfg(DevInst, Locs[i], XAIE_DISABLE);
+		} else {
+			RC = _XAie_EccOnPMCfg(DevInst, Locs[i], XAIE_DISABLE);
+		}
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to turn ECC On for tile (%d, %d)\n",
+					Locs[i].Col, Locs[i].Row);
+			break;
+		}
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API initializes the context of the ECC scrubber. The cursor is set to
+* the first tile of the partition.
+*
+* @param        DevInst: Device Instance
+* @param        Ctx: Pointer to the scrubber context.
+* @param        ChunkSize: Number of bytes read and written back per access.
+*               It must be word aligned and at most
+*               XAIE_ECC_SCRUB_MAX_CHUNK_SIZE. If 0, 64 bytes are used.
+* @param        StepBudget: Number of bytes scrubbed at most by one call to
+*               XAie_EccScrubStep(). If 0, it is set to ChunkSize.
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         The budget bounds the memory traffic of the scrubber per step,
+*               the caller sets the bandwidth by how often it calls
+*               XAie_EccScrubStep().
+*
+******************************************************************************/
+AieRC XAie_EccScrubInit(XAie_DevInst *DevInst, XAie_EccScrubCtx *Ctx,
+		u32 ChunkSize, u32 StepBudget)
+{
+	if((DevInst == XAIE_NULL) || (Ctx == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance or scrubber context\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(ChunkSize == 0U) {
+		ChunkSize = XAIE_ECC_SCRUB_DEF_CHUNK_SIZE;
+	}
+
+	if((ChunkSize > XAIE_ECC_SCRUB_MAX_CHUNK_SIZE) ||
+			((ChunkSize % sizeof(u32)) != 0U)) {
+		XAIE_ERROR("Invalid ECC scrub chunk size %u\n", ChunkSize);
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(StepBudget == 0U) {
+		StepBudget = ChunkSize;
+	}
+
+	Ctx->ChunkSize = ChunkSize;
+	Ctx->StepBudget = StepBudget;
+	Ctx->Cursor = XAie_TileLoc(0U, 0U);
+	Ctx->Offset = 0U;
+	Ctx->NumSweeps = 0U;
+	Ctx->ScrubbedBytes = 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API checks if the data memory of a tile can be scrubbed. The tile has
+* to be requested, to have ECC on for its data memory, and to be idle, with
+* no pending BD on any of its DMA channels and, for AIE tiles, the core
+* disabled or done.
+*
+* @param        DevInst: Device Instance
+* @param        Loc: Location of the tile.
+*
+* @return       XAIE_ENABLE if the tile can be scrubbed, XAIE_DISABLE
+*               otherwise.
+*
+* @note         Internal only. A failure to read the status of the tile
+*               counts as busy.
+*
+******************************************************************************/
+static u8 _XAie_EccScrubTileIsIdle(XAie_DevInst *DevInst, XAie_LocType Loc)
+{
+	const XAie_DmaMod *DmaMod;
+	u8 TileType;
+	AieRC RC;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+		if(!CheckBit(DevInst->MemInUse,
+				_XAie_GetTileBitPosFromLoc(DevInst, Loc))) {
+			return XAIE_DISABLE;
+		}
+	} else if(TileType != XAIEGBL_TILE_TYPE_MEMTILE) {
+		return XAIE_DISABLE;
+	}
+
+	if(_XAie_PmIsTileRequested(DevInst, Loc) == XAIE_DISABLE) {
+		return XAIE_DISABLE;
+	}
+
+	if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+		const XAie_RegCoreSts *CoreSts;
+		u32 RegVal;
+
+		CoreSts = DevInst->DevProp.DevMod[TileType].CoreMod->CoreSts;
+		RC = XAie_Read32(DevInst, _XAie_GetTileAddr(DevInst, Loc.Row,
+				Loc.Col) + CoreSts->RegOff, &RegVal);
+		if(RC != XAIE_OK) {
+			return XAIE_DISABLE;
+		}
+
+		if(((RegVal & CoreSts->En.Mask) != 0U) &&
+				((RegVal & CoreSts->Done.Mask) == 0U)) {
+			return XAIE_DISABLE;
+		}
+	}
+
+	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	for(u8 Ch = 0U; Ch < DmaMod->NumChannels; Ch++) {
+		for(u8 Dir = 0U; Dir < (u8)DMA_MAX; Dir++) {
+			u8 PendingBd;
+
+			RC = DmaMod->PendingBd(DevInst, Loc, DmaMod, Ch,
+					(XAie_DmaDirection)Dir, &PendingBd);
+			if((RC != XAIE_OK) || (PendingBd != 0U)) {
+				return XAIE_DISABLE;
+			}
+		}
+	}
+
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API moves the cursor of the scrubber to the next tile of the partition,
+* column by column. A sweep is counted when the cursor wraps around.
+*
+* @param        DevInst: Device Instance
+* @param        Ctx: Pointer to the scrubber context.
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static void _XAie_EccScrubNextTile(XAie_DevInst *DevInst,
+		XAie_EccScrubCtx *Ctx)
+{
+	Ctx->Offset = 0U;
+	Ctx->Cursor.Row++;
+	if(Ctx->Cursor.Row < DevInst->NumRows) {
+		return;
+	}
+
+	Ctx->Cursor.Row = 0U;
+	Ctx->Cursor.Col++;
+	if(Ctx->Cursor.Col >= DevInst->NumCols) {
+		Ctx->Cursor.Col = 0U;
+		Ctx->NumSweeps++;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API runs one step of the ECC scrubber. From its cursor, the scrubber
+* reads the data memory of the idle tiles with ECC on a chunk at a time and
+* writes the data back, so that the words with a correctable error are
+* stored again with a valid ECC. The step ends once the budget of the context
+* is spent or every tile of the partition was visited. Busy tiles are
+* skipped and scrubbed on a later sweep.
+*
+* @param        DevInst: Device Instance
+* @param        Ctx: Pointer to the scrubber context initialized with
+*               XAie_EccScrubInit().
+* @param        NumBytes: Pointer to return the number of bytes scrubbed by
+*               this step. Can be NULL.
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         The scrubbing is done with host accesses, it cannot be run
+*               with a transaction open. A tile is checked for idleness once
+*               per step. The accesses of the neighbouring cores to the data
+*               memory of an AIE tile are not tracked, the cores accessing it
+*               must be idle when it is scrubbed.
+*
+******************************************************************************/
+AieRC XAie_EccScrubStep(XAie_DevInst *DevInst, XAie_EccScrubCtx *Ctx,
+		u32 *NumBytes)
+{
+	u32 Buf[XAIE_ECC_SCRUB_MAX_CHUNK_SIZE / sizeof(u32)];
+	u32 Budget, NumTiles;
+	AieRC RC = XAIE_OK;
+
+	if((DevInst == XAIE_NULL) || (Ctx == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+		(Ctx->ChunkSize == 0U)) {
+		XAIE_ERROR("Invalid Device Instance or scrubber context\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->EccStatus != XAIE_ENABLE) {
+		XAIE_ERROR("ECC is not on for the partition\n");
+		return XAIE_ERR;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_ENABLE) {
+		XAIE_ERROR("ECC scrubbing cannot be run in a transaction\n");
+		return XAIE_ERR;
+	}
+
+	if((Ctx->Cursor.Col >= DevInst->NumCols) ||
+			(Ctx->Cursor.Row >= DevInst->NumRows)) {
+		Ctx->Cursor = XAie_TileLoc(0U, 0U);
+		Ctx->Offset = 0U;
+	}
+
+	Budget = Ctx->StepBudget;
+	NumTiles = (u32)DevInst->NumCols * DevInst->NumRows;
+	for(u32 i = 0U; (i < NumTiles) && (Budget > 0U); i++) {
+		const XAie_MemMod *MemMod;
+		u8 TileType;
+
+		if(_XAie_EccScrubTileIsIdle(DevInst, Ctx->Cursor) ==
+				XAIE_DISABLE) {
+			_XAie_EccScrubNextTile(DevInst, Ctx);
+			continue;
+		}
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Ctx->Cursor);
+		MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+		while((Budget > 0U) && (Ctx->Offset < MemMod->Size)) {
+			u32 Size = Ctx->ChunkSize;
+
+			if(Size > Budget) {
+				Size = Budget;
+			}
+			if(Size > MemMod->Size - Ctx->Offset) {
+				Size = MemMod->Size - Ctx->Offset;
+			}
+
+			RC = XAie_DataMemBlockRead(DevInst, Ctx->Cursor,
+					Ctx->Offset, Buf, Size);
+			if(RC == XAIE_OK) {
+				RC = XAie_DataMemBlockWrite(DevInst,
+						Ctx->Cursor, Ctx->Offset, Buf,
+						Size);
+			}
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Failed to scrub tile (%d, %d)\n",
+						Ctx->Cursor.Col,
+						Ctx->Cursor.Row);
+				break;
+			}
+
+			Ctx->Offset += Size;
+			Ctx->ScrubbedBytes += Size;
+			Budget -= Size;
+		}
+
+		if(RC != XAIE_OK) {
+			break;
+		}
+
+		if(Ctx->Offset >= MemMod->Size) {
+			_XAie_EccScrubNextTile(DevInst, Ctx);
+		}
+	}
+
+	if(NumBytes != NULL) {
+		*NumBytes = Ctx->StepBudget - Budget;
+	}
+
+	return RC;
+}
+
+#else
+
+AieRC XAie_EccScrubInit(XAie_DevInst *DevInst, XAie_EccScrubCtx *Ctx,
+		u32 ChunkSize, u32 StepBudget)
+{
+	(void)DevInst;
+	(void)Ctx;
+	(void)ChunkSize;
+	(void)StepBudget;
+
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+AieRC XAie_EccScrubStep(XAie_DevInst *DevInst, XAie_EccScrubCtx *Ctx,
+		u32 *NumBytes)
+{
+	(void)DevInst;
+	(void)Ctx;
+	(void)NumBytes;
+
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
 #endif /* XAIE_FEATURE_PRIVILEGED_ENABLE && XAIE_FEATURE_PERFCOUNT_ENABLE &&
 	* XAIE_FEATURE_EVENTS_ENABLE && XAIE_FEATURE_RSC_ENABLE */
@@ -26,10 +26,42 @@
 /***************************** Include Files *********************************/
 #include "xaiegbl.h"
 
+/************************** Constant Definitions *****************************/
+/* Memories of an AIE tile to turn ECC On for with _XAie_EccOnTiles() */
+#define XAIE_ECC_MEM_DM		0U
+#define XAIE_ECC_MEM_PM		1U
+
+/* Largest chunk the ECC scrubber reads and writes back in one access */
+#define XAIE_ECC_SCRUB_MAX_CHUNK_SIZE	256U
+
 /************************** Enum *********************************************/
 
+/************************** Variable Definitions *****************************/
+/*
+ * This typedef holds the state of the ECC scrubber. The scrubber walks the
+ * data memories of the partition a chunk at a time, one XAie_EccScrubStep()
+ * at a time, and resumes from its cursor on the next step.
+ */
+typedef struct {
+	u32 ChunkSize;		/* Bytes scrubbed per access, word aligned */
+	u32 StepBudget;		/* Bytes scrubbed at most per step */
+	XAie_LocType Cursor;	/* Tile the next step starts from */
+	u32 Offset;		/* Offset of the next chunk in the cursor tile */
+	u32 NumSweeps;		/* Number of completed partition sweeps */
+	u64 ScrubbedBytes;	/* Total number of bytes scrubbed */
+} XAie_EccScrubCtx;
+
 /************************** Function Prototypes  *****************************/
 void _XAie_EccEvntResetPM(XAie_DevInst *DevInst, XAie_LocType Loc);
 AieRC _XAie_EccOnPM(XAie_DevInst *DevInst, XAie_LocType Loc);
 AieRC _XAie_EccOnDM(XAie_DevInst *DevInst, XAie_LocType Loc);
+AieRC _XAie_EccOnMemTile(XAie_DevInst *DevInst, XAie_LocType Loc);
+AieRC _XAie_EccRequestTiles(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs);
+AieRC _XAie_EccOnTiles(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs, u8 Mem);
+AieRC XAie_EccScrubInit(XAie_DevInst *DevInst, XAie_EccScrubCtx *Ctx,
+		u32 ChunkSize, u32 StepBudget);
+AieRC XAie_EccScrubStep(XAie_DevInst *DevInst, XAie_EccScrubCtx *Ctx,
+		u32 *NumBytes);
 #endif		/* end of protection macro */
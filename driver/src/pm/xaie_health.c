@@ -0,0 +1,719 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_health.c
+* @{
+*
+* This file contains routines to scan the health of a set of tiles. For each
+* tile, the core status, debug status and program counter, the DMA channel
+* status, the lock values and the event status words holding the group error
+* events are listed from the register database. The registers of a tile which
+* are close to each other are merged in one run, so a scan costs a few block
+* reads per tile.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_events.h"
+#include "xaie_health.h"
+#include "xaie_helper.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_HEALTH_MIN_RANGES		64U
+#define XAIE_HEALTH_MAX_GAP_WORDS	8U
+#define XAIE_HEALTH_MAX_TILE_REGS	(6U + XAIE_HEALTH_MAX_ERROR_REGS)
+
+/**************************** Type Definitions *******************************/
+/* Registers of a tile to add to a scan, with the word index to set */
+typedef struct {
+	u64 RegOff;
+	u32 NumWords;
+	u32 *Word;
+} XAie_HealthReg;
+
+/************************** Variable Definitions *****************************/
+static const XAie_Events XAie_HealthErrorEvents[] = {
+	XAIE_EVENT_GROUP_ERRORS_0_CORE,
+	XAIE_EVENT_GROUP_ERRORS_1_CORE,
+	XAIE_EVENT_GROUP_ERRORS_MEM,
+	XAIE_EVENT_GROUP_ERRORS_PL,
+	XAIE_EVENT_GROUP_ERRORS_MEM_TILE,
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API adds a run of consecutive registers to a scan. The run is merged
+* with the last run of the scan if it starts right after it, or a few words
+* after it, in which case the words in between are read too.
+*
+* @param	Scan: Scan being set up.
+* @param	MaxRanges: Number of ranges allocated in the scan.
+* @param	RegOff: Partition relative address of the first register.
+* @param	NumWords: Number of registers.
+* @param	Word: Pointer to return the index of the first register in the
+*		scan data.
+*
+* @return	XAIE_OK on success, XAIE_ERR if memory allocation fails.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_HealthAddRange(XAie_HealthScan *Scan, u32 *MaxRanges,
+		u64 RegOff, u32 NumWords, u32 *Word)
+{
+	XAie_CfgSnapRange *Range;
+
+	if(Scan->NumRanges > 0U) {
+		u64 End;
+
+		Range = &Scan->Ranges[Scan->NumRanges - 1U];
+		End = Range->RegOff + Range->NumWords * sizeof(u32);
+		if((RegOff >= End) && (RegOff - End <=
+				XAIE_HEALTH_MAX_GAP_WORDS * sizeof(u32))) {
+			u32 Gap = (u32)((RegOff - End) / sizeof(u32));
+
+			*Word = Scan->NumWords + Gap;
+			Range->NumWords += Gap + NumWords;
+			Scan->NumWords += Gap + NumWords;
+			return XAIE_OK;
+		}
+	}
+
+	if(Scan->NumRanges == *MaxRanges) {
+		u32 NewMax = (*MaxRanges == 0U) ? XAIE_HEALTH_MIN_RANGES :
+			*MaxRanges * 2U;
+
+		Range = (XAie_CfgSnapRange *)realloc((void *)Scan->Ranges,
+				NewMax * sizeof(*Range));
+		if(Range == NULL) {
+			XAIE_ERROR("Memory allocation for health scan failed\n");
+			return XAIE_ERR;
+		}
+		Scan->Ranges = Range;
+		*MaxRanges = NewMax;
+	}
+
+	Range = &Scan->Ranges[Scan->NumRanges++];
+	Range->RegOff = RegOff;
+	Range->NumWords = NumWords;
+	Range->DataOff = Scan->NumWords;
+	*Word = Scan->NumWords;
+	Scan->NumWords += NumWords;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API lists the event status words of a tile holding the group error
+* events of its modules.
+*
+* @param	TileMod: Modules of the tile.
+* @param	TileAddr: Address of the tile.
+* @param	Regs: Registers of the tile, the status words are appended.
+* @param	NumRegs: Number of registers of the tile, updated.
+* @param	TRegs: Register indexes of the tile, the error masks are set.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_HealthListErrors(const XAie_TileMod *TileMod, u64 TileAddr,
+		XAie_HealthReg *Regs, u8 *NumRegs, XAie_HealthTileRegs *TRegs)
+{
+	for(u8 Mod = 0U; (Mod < TileMod->NumModules) &&
+			(TileMod->EvntMod != NULL); Mod++) {
+		const XAie_EvntMod *EvntMod = &TileMod->EvntMod[Mod];
+
+		for(u32 i = 0U; i < sizeof(XAie_HealthErrorEvents) /
+				sizeof(XAie_HealthErrorEvents[0U]); i++) {
+			u32 Event = (u32)XAie_HealthErrorEvents[i];
+			u64 RegOff;
+			u8 HwEvent, k;
+
+			if((Event < EvntMod->EventMin) ||
+					(Event > EvntMod->EventMax)) {
+				continue;
+			}
+
+			HwEvent = EvntMod->XAie_EventNumber[Event -
+				EvntMod->EventMin];
+			if(HwEvent == XAIE_EVENT_INVALID) {
+				continue;
+			}
+
+			RegOff = TileAddr + EvntMod->BaseStatusRegOff +
+				(HwEvent / 32U) * sizeof(u32);
+			for(k = 0U; k < TRegs->NumErrRegs; k++) {
+				if(Regs[*NumRegs - TRegs->NumErrRegs + k].RegOff ==
+						RegOff) {
+					break;
+				}
+			}
+
+			if(k == TRegs->NumErrRegs) {
+				if(k == XAIE_HEALTH_MAX_ERROR_REGS) {
+					continue;
+				}
+				Regs[*NumRegs].RegOff = RegOff;
+				Regs[*NumRegs].NumWords = 1U;
+				Regs[*NumRegs].Word = &TRegs->ErrWord[k];
+				(*NumRegs)++;
+				TRegs->NumErrRegs++;
+			}
+			TRegs->ErrMask[k] |= 1U << (HwEvent % 32U);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the status registers of a tile to a scan. The registers are
+* added by increasing address, so the close ones are merged in one run.
+*
+* @param	DevInst: Device Instance.
+* @param	Scan: Scan being set up.
+* @param	MaxRanges: Number of ranges allocated in the scan.
+* @param	Idx: Index of the tile in the scan.
+* @param	Loc: Location of the tile.
+*
+* @return	XAIE_OK on success, XAIE_ERR if memory allocation fails.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_HealthAddTile(XAie_DevInst *DevInst, XAie_HealthScan *Scan,
+		u32 *MaxRanges, u32 Idx, XAie_LocType Loc)
+{
+	AieRC RC = XAIE_OK;
+	XAie_HealthReg Regs[XAIE_HEALTH_MAX_TILE_REGS];
+	XAie_HealthTileRegs *TRegs = &Scan->TileRegs[Idx];
+	const XAie_TileMod *TileMod;
+	u64 TileAddr;
+	u8 NumRegs = 0U;
+
+	TRegs->TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	TileMod = &DevInst->DevProp.DevMod[TRegs->TileType];
+	TileAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	TRegs->CoreSts = XAIE_HEALTH_NO_REG;
+	TRegs->CoreDbg = XAIE_HEALTH_NO_REG;
+	TRegs->CorePC = XAIE_HEALTH_NO_REG;
+	TRegs->DmaSts[0U] = XAIE_HEALTH_NO_REG;
+	TRegs->DmaSts[1U] = XAIE_HEALTH_NO_REG;
+	TRegs->Locks = XAIE_HEALTH_NO_REG;
+	TRegs->NumErrRegs = 0U;
+	memset(TRegs->ErrMask, 0, sizeof(TRegs->ErrMask));
+	Scan->Tiles[Idx].Loc = Loc;
+
+	if(TileMod->CoreMod != NULL) {
+		const XAie_CoreMod *CoreMod = TileMod->CoreMod;
+
+		Regs[NumRegs++] = (XAie_HealthReg){TileAddr +
+			CoreMod->CoreSts->RegOff, 1U, &TRegs->CoreSts};
+		Regs[NumRegs++] = (XAie_HealthReg){TileAddr +
+			CoreMod->CoreDebugStatus->RegOff, 1U,
+			&TRegs->CoreDbg};
+		if(CoreMod->CorePCOff != 0U) {
+			Regs[NumRegs++] = (XAie_HealthReg){TileAddr +
+				CoreMod->CorePCOff, 1U, &TRegs->CorePC};
+		}
+	}
+
+	if(TileMod->DmaMod != NULL) {
+		const XAie_DmaMod *DmaMod = TileMod->DmaMod;
+		u32 NumWords = (DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) ?
+			1U : DmaMod->NumChannels;
+
+		for(u8 Dir = 0U; Dir < 2U; Dir++) {
+			Regs[NumRegs++] = (XAie_HealthReg){TileAddr +
+				DmaMod->ChStatusBase +
+				Dir * DmaMod->ChStatusOffset, NumWords,
+				&TRegs->DmaSts[Dir]};
+		}
+	}
+
+	if((TileMod->LockMod != NULL) && (TileMod->LockMod->LockInit != NULL)) {
+		const XAie_LockMod *LockMod = TileMod->LockMod;
+
+		Regs[NumRegs++] = (XAie_HealthReg){TileAddr +
+			LockMod->LockSetValBase, (LockMod->NumLocks - 1U) *
+			(LockMod->LockSetValOff / 4U) + 1U, &TRegs->Locks};
+	}
+
+	_XAie_HealthListErrors(TileMod, TileAddr, Regs, &NumRegs, TRegs);
+
+	/* Insertion sort, a tile has a handful of registers */
+	for(u8 i = 1U; i < NumRegs; i++) {
+		XAie_HealthReg Reg = Regs[i];
+		u8 j = i;
+
+		while((j > 0U) && (Regs[j - 1U].RegOff > Reg.RegOff)) {
+			Regs[j] = Regs[j - 1U];
+			j--;
+		}
+		Regs[j] = Reg;
+	}
+
+	for(u8 i = 0U; (i < NumRegs) && (RC == XAIE_OK); i++) {
+		RC = _XAie_HealthAddRange(Scan, MaxRanges, Regs[i].RegOff,
+				Regs[i].NumWords, Regs[i].Word);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API decodes the DMA channel status of a tile from the scan data.
+*
+* @param	DevInst: Device Instance.
+* @param	DmaMod: DMA module of the tile.
+* @param	Sts: Status words of the tile, indexed by direction.
+* @param	Tile: Status of the tile to update.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_HealthDecodeDma(XAie_DevInst *DevInst,
+		const XAie_DmaMod *DmaMod, const u32 *Sts[2U],
+		XAie_HealthTile *Tile)
+{
+	const XAie_DmaChStatus *ChSts = DmaMod->ChProp->DmaChStatus;
+
+	for(u8 Dir = 0U; Dir < 2U; Dir++) {
+		for(u8 Ch = 0U; Ch < DmaMod->NumChannels; Ch++) {
+			u16 Bit = (u16)(1U << (Dir * DmaMod->NumChannels + Ch));
+			u32 Busy, Stalled;
+
+			if(DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) {
+				const XAie_AieDmaChStatus *S =
+					&ChSts[Ch].AieDmaChStatus;
+
+				Busy = Sts[Dir][0U] & (S->Status.Mask |
+						S->StartQSize.Mask |
+						S->Stalled.Mask);
+				Stalled = Sts[Dir][0U] & S->Stalled.Mask;
+			} else {
+				const XAie_AieMlDmaChStatus *S =
+					&ChSts->AieMlDmaChStatus;
+
+				Busy = Sts[Dir][Ch] & (S->Status.Mask |
+						S->TaskQSize.Mask |
+						S->StalledLockAcq.Mask |
+						S->StalledLockRel.Mask |
+						S->StalledStreamStarve.Mask |
+						S->StalledTCT.Mask);
+				Stalled = Sts[Dir][Ch] &
+					(S->StalledLockAcq.Mask |
+					 S->StalledLockRel.Mask);
+			}
+
+			if(Busy != 0U) {
+				Tile->DmaBusy |= Bit;
+			}
+			if(Stalled != 0U) {
+				Tile->DmaStalled |= Bit;
+			}
+		}
+	}
+
+	if(Tile->DmaBusy != 0U) {
+		Tile->Flags |= XAIE_HEALTH_DMA_BUSY;
+	}
+	if(Tile->DmaStalled != 0U) {
+		Tile->Flags |= XAIE_HEALTH_DMA_LOCK_STALL;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API decodes the status of a tile from the scan data. The stuck flags
+* are set from the previous scan of the tile, if any.
+*
+* @param	DevInst: Device Instance.
+* @param	Scan: Scan just read.
+* @param	Idx: Index of the tile in the scan.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_HealthDecodeTile(XAie_DevInst *DevInst,
+		XAie_HealthScan *Scan, u32 Idx)
+{
+	const XAie_HealthTileRegs *TRegs = &Scan->TileRegs[Idx];
+	const XAie_TileMod *TileMod = &DevInst->DevProp.DevMod[TRegs->TileType];
+	const XAie_HealthTile *Prev = &Scan->Prev[Idx];
+	XAie_HealthTile *Tile = &Scan->Tiles[Idx];
+	const u32 *Regs = Scan->Regs;
+
+	Tile->Loc = Prev->Loc;
+	Tile->Flags = 0U;
+	Tile->CorePC = 0U;
+	Tile->DmaBusy = 0U;
+	Tile->DmaStalled = 0U;
+	Tile->LockSet = 0U;
+
+	if(TRegs->CoreSts != XAIE_HEALTH_NO_REG) {
+		const XAie_CoreMod *CoreMod = TileMod->CoreMod;
+		u32 Sts = Regs[TRegs->CoreSts];
+
+		if((Sts & CoreMod->CoreSts->En.Mask) != 0U) {
+			Tile->Flags |= XAIE_HEALTH_CORE_ENABLED;
+		}
+		if((Sts & CoreMod->CoreSts->Done.Mask) != 0U) {
+			Tile->Flags |= XAIE_HEALTH_CORE_DONE;
+		}
+		if((Regs[TRegs->CoreDbg] &
+				CoreMod->CoreDebugStatus->DbgHalt.Mask) != 0U) {
+			Tile->Flags |= XAIE_HEALTH_CORE_HALTED;
+		}
+		if(TRegs->CorePC != XAIE_HEALTH_NO_REG) {
+			Tile->CorePC = Regs[TRegs->CorePC];
+		}
+
+		/* A running core which did not move since the last scan */
+		if((Scan->NumScans > 0U) &&
+				(TRegs->CorePC != XAIE_HEALTH_NO_REG) &&
+				((Tile->Flags & (XAIE_HEALTH_CORE_ENABLED |
+				  XAIE_HEALTH_CORE_DONE |
+				  XAIE_HEALTH_CORE_HALTED)) ==
+				 XAIE_HEALTH_CORE_ENABLED) &&
+				(Prev->Flags == Tile->Flags) &&
+				(Prev->CorePC == Tile->CorePC)) {
+			Tile->Flags |= XAIE_HEALTH_CORE_STUCK;
+		}
+	}
+
+	if(TRegs->DmaSts[0U] != XAIE_HEALTH_NO_REG) {
+		const u32 *Sts[2U] = {
+			&Regs[TRegs->DmaSts[0U]], &Regs[TRegs->DmaSts[1U]]
+		};
+
+		_XAie_HealthDecodeDma(DevInst, TileMod->DmaMod, Sts, Tile);
+	}
+
+	if(TRegs->Locks != XAIE_HEALTH_NO_REG) {
+		const XAie_LockMod *LockMod = TileMod->LockMod;
+		u32 Stride = LockMod->LockSetValOff / 4U;
+
+		for(u32 i = 0U; (i < LockMod->NumLocks) && (i < 64U); i++) {
+			if(XAie_GetField(Regs[TRegs->Locks + i * Stride],
+					LockMod->LockInit->Lsb,
+					LockMod->LockInit->Mask) != 0U) {
+				Tile->LockSet |= (u64)1U << i;
+			}
+		}
+	}
+
+	/* Channels stalled on locks which did not change since the last scan */
+	if((Scan->NumScans > 0U) &&
+			((Tile->DmaStalled & Prev->DmaStalled) != 0U) &&
+			(Tile->LockSet == Prev->LockSet)) {
+		Tile->Flags |= XAIE_HEALTH_DMA_STUCK;
+	}
+
+	for(u8 i = 0U; i < TRegs->NumErrRegs; i++) {
+		if((Regs[TRegs->ErrWord[i]] & TRegs->ErrMask[i]) != 0U) {
+			Tile->Flags |= XAIE_HEALTH_ERROR;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if a tile of the partition is in use.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the tile.
+*
+* @return	XAIE_ENABLE if the tile is in use, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u8 _XAie_HealthTileInUse(XAie_DevInst *DevInst, XAie_LocType Loc)
+{
+	u8 TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		return XAIE_DISABLE;
+	}
+
+	if((TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
+			(TileType == XAIEGBL_TILE_TYPE_SHIMPL)) {
+		return XAIE_ENABLE;
+	}
+
+	return (CheckBit(DevInst->TilesInUse,
+			_XAie_GetTileBitPosFromLoc(DevInst, Loc)) != 0U) ?
+		XAIE_ENABLE : XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets up a health scan of a set of tiles. The status registers of
+* the tiles are listed from the register database and merged in runs of close
+* registers, and the memory to hold their values and the decoded status is
+* allocated. The tiles are scanned by XAie_HealthScanRead().
+*
+* @param	DevInst: Device Instance.
+* @param	Scan: Scan to set up.
+* @param	Locs: Locations of the tiles. If NULL, all the tiles of the
+*		partition in use are taken, column by column.
+* @param	NumLocs: Number of tiles, 0 if Locs is NULL.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The lock values are only scanned on devices where they can be
+*		read, from AIEML on. The group error events are only latched
+*		in the event status registers if the error groups are enabled,
+*		as done by XAie_ErrorHandlingInit().
+*
+******************************************************************************/
+AieRC XAie_HealthScanInit(XAie_DevInst *DevInst, XAie_HealthScan *Scan,
+		const XAie_LocType *Locs, u32 NumLocs)
+{
+	AieRC RC = XAIE_OK;
+	u32 MaxRanges = 0U, NumTiles = NumLocs;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Scan == XAIE_NULL) || ((Locs == XAIE_NULL) != (NumLocs == 0U))) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		if(_XAie_DevGetTTypefromLoc(DevInst, Locs[i]) ==
+				XAIEGBL_TILE_TYPE_MAX) {
+			XAIE_ERROR("Invalid Tile Type\n");
+			return XAIE_INVALID_TILE;
+		}
+	}
+
+	if(Locs == XAIE_NULL) {
+		for(u8 Col = 0U; Col < DevInst->NumCols; Col++) {
+			for(u8 Row = 0U; Row < DevInst->NumRows; Row++) {
+				if(_XAie_HealthTileInUse(DevInst,
+						XAie_TileLoc(Col, Row)) ==
+						XAIE_ENABLE) {
+					NumTiles++;
+				}
+			}
+		}
+	}
+
+	if(NumTiles == 0U) {
+		XAIE_ERROR("No tile to scan\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	memset(Scan, 0, sizeof(*Scan));
+	Scan->NumTiles = NumTiles;
+	Scan->Tiles = (XAie_HealthTile *)calloc(NumTiles,
+			sizeof(XAie_HealthTile));
+	Scan->Prev = (XAie_HealthTile *)calloc(NumTiles,
+			sizeof(XAie_HealthTile));
+	Scan->Changed = (u32 *)calloc(NumTiles, sizeof(u32));
+	Scan->TileRegs = (XAie_HealthTileRegs *)calloc(NumTiles,
+			sizeof(XAie_HealthTileRegs));
+	if((Scan->Tiles == NULL) || (Scan->Prev == NULL) ||
+			(Scan->Changed == NULL) || (Scan->TileRegs == NULL)) {
+		XAIE_ERROR("Memory allocation for health scan failed\n");
+		RC = XAIE_ERR;
+	}
+
+	if((RC == XAIE_OK) && (Locs != XAIE_NULL)) {
+		for(u32 i = 0U; (i < NumLocs) && (RC == XAIE_OK); i++) {
+			RC = _XAie_HealthAddTile(DevInst, Scan, &MaxRanges, i,
+					Locs[i]);
+		}
+	} else if(RC == XAIE_OK) {
+		u32 Idx = 0U;
+
+		for(u8 Col = 0U; (Col < DevInst->NumCols) && (RC == XAIE_OK);
+				Col++) {
+			for(u8 Row = 0U; (Row < DevInst->NumRows) &&
+					(RC == XAIE_OK); Row++) {
+				XAie_LocType Loc = XAie_TileLoc(Col, Row);
+
+				if(_XAie_HealthTileInUse(DevInst, Loc) ==
+						XAIE_ENABLE) {
+					RC = _XAie_HealthAddTile(DevInst, Scan,
+							&MaxRanges, Idx++, Loc);
+				}
+			}
+		}
+	}
+
+	if(RC == XAIE_OK) {
+		/* Tiles is overwritten by the first read, Prev keeps Loc */
+		memcpy(Scan->Prev, Scan->Tiles, NumTiles * sizeof(*Scan->Prev));
+		Scan->Regs = (u32 *)calloc(Scan->NumWords, sizeof(u32));
+		if(Scan->Regs == NULL) {
+			XAIE_ERROR("Memory allocation for health scan failed\n");
+			RC = XAIE_ERR;
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		free(Scan->Tiles);
+		free(Scan->Prev);
+		free(Scan->Changed);
+		free(Scan->TileRegs);
+		free(Scan->Ranges);
+		memset(Scan, 0, sizeof(*Scan));
+		return RC;
+	}
+
+	XAIE_DBG("Health scan of %d tiles, %d words in %d ranges\n",
+			Scan->NumTiles, Scan->NumWords, Scan->NumRanges);
+	Scan->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API scans the health of the tiles of a scan. Each run of registers is
+* fetched with one block read, then the status of the tiles is decoded:
+*	- XAIE_HEALTH_CORE_ENABLED, XAIE_HEALTH_CORE_DONE: core status.
+*	- XAIE_HEALTH_CORE_HALTED: the core is halted by its debug control.
+*	- XAIE_HEALTH_CORE_STUCK: the core is enabled, not done nor halted,
+*	  and its status and program counter did not change since the last
+*	  scan.
+*	- XAIE_HEALTH_DMA_BUSY: a DMA channel is running or has queued tasks.
+*	- XAIE_HEALTH_DMA_LOCK_STALL: a DMA channel waits on a lock.
+*	- XAIE_HEALTH_DMA_STUCK: a DMA channel waits on a lock since the last
+*	  scan and no lock of the tile changed state.
+*	- XAIE_HEALTH_ERROR: a group error event of the tile is latched.
+* The status of the last scan is kept in Prev, the indexes of the tiles whose
+* flags, DMA channels or locks changed are listed in Changed.
+*
+* @param	DevInst: Device Instance.
+* @param	Scan: Scan set up by XAie_HealthScanInit().
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The stuck flags are heuristics, a core in a long loop or a
+*		channel waiting on a slow producer is reported stuck if the
+*		scans are closer than the expected progress. The program
+*		counter is not compared for the diff, it changes on every scan
+*		of a running core. If the read fails, the scan is unchanged.
+*
+******************************************************************************/
+AieRC XAie_HealthScanRead(XAie_DevInst *DevInst, XAie_HealthScan *Scan)
+{
+	AieRC RC = XAIE_OK;
+	XAie_HealthTile *Tmp;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Scan == XAIE_NULL) || (Scan->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid health scan\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; (i < Scan->NumRanges) && (RC == XAIE_OK); i++) {
+		const XAie_CfgSnapRange *Range = &Scan->Ranges[i];
+
+		if(Range->NumWords == 1U) {
+			RC = XAie_Read32(DevInst, Range->RegOff,
+					&Scan->Regs[Range->DataOff]);
+		} else {
+			RC = XAie_BlockRead32(DevInst, Range->RegOff,
+					&Scan->Regs[Range->DataOff],
+					Range->NumWords);
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to read health scan\n");
+		return RC;
+	}
+
+	Tmp = Scan->Prev;
+	Scan->Prev = Scan->Tiles;
+	Scan->Tiles = Tmp;
+	Scan->NumChanged = 0U;
+	Scan->Summary = 0U;
+
+	for(u32 i = 0U; i < Scan->NumTiles; i++) {
+		const XAie_HealthTile *Prev = &Scan->Prev[i];
+		const XAie_HealthTile *Tile = &Scan->Tiles[i];
+
+		_XAie_HealthDecodeTile(DevInst, Scan, i);
+		Scan->Summary |= Tile->Flags;
+		if((Tile->Flags != Prev->Flags) ||
+				(Tile->DmaBusy != Prev->DmaBusy) ||
+				(Tile->DmaStalled != Prev->DmaStalled) ||
+				(Tile->LockSet != Prev->LockSet)) {
+			Scan->Changed[Scan->NumChanged++] = i;
+		}
+	}
+	Scan->NumScans++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the memory of a health scan.
+*
+* @param	Scan: Scan set up by XAie_HealthScanInit().
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if Scan is invalid.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_HealthScanFree(XAie_HealthScan *Scan)
+{
+	if((Scan == XAIE_NULL) || (Scan->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid health scan\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(Scan->Tiles);
+	free(Scan->Prev);
+	free(Scan->Changed);
+	free(Scan->TileRegs);
+	free(Scan->Ranges);
+	free(Scan->Regs);
+	memset(Scan, 0, sizeof(*Scan));
+
+	return XAIE_OK;
+}
+
+/** @} */
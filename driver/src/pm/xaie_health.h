@@ -0,0 +1,98 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_health.h
+* @{
+*
+* This file contains routines to scan the status of the cores, DMA channels,
+* locks and error events of a set of tiles in one sweep, for watchdogs
+* checking the health of a partition periodically.
+*
+******************************************************************************/
+#ifndef XAIE_HEALTH_H
+#define XAIE_HEALTH_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaie_cfgsnap.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_HEALTH_CORE_ENABLED	(1U << 0)
+#define XAIE_HEALTH_CORE_DONE		(1U << 1)
+#define XAIE_HEALTH_CORE_HALTED		(1U << 2)
+#define XAIE_HEALTH_CORE_STUCK		(1U << 3)
+#define XAIE_HEALTH_DMA_BUSY		(1U << 4)
+#define XAIE_HEALTH_DMA_LOCK_STALL	(1U << 5)
+#define XAIE_HEALTH_DMA_STUCK		(1U << 6)
+#define XAIE_HEALTH_ERROR		(1U << 7)
+
+#define XAIE_HEALTH_NO_REG		0xFFFFFFFFU
+#define XAIE_HEALTH_MAX_ERROR_REGS	3U
+
+/**************************** Type Definitions *******************************/
+/*
+ * This typedef captures the status of a tile at one scan.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u32 Flags;		/* XAIE_HEALTH_* status flags */
+	u32 CorePC;		/* Program counter of the core */
+	u16 DmaBusy;		/* Busy channels, bit Dir * NumChannels + Ch */
+	u16 DmaStalled;		/* Channels stalled on a lock, same bits */
+	u64 LockSet;		/* Locks with a non zero value, bit LockId */
+} XAie_HealthTile;
+
+/*
+ * This typedef captures where the registers of a tile are stored in the scan
+ * data, as word indexes, XAIE_HEALTH_NO_REG for the registers the tile does
+ * not have.
+ */
+typedef struct {
+	u32 CoreSts;
+	u32 CoreDbg;
+	u32 CorePC;
+	u32 DmaSts[2U];		/* First status word of each direction */
+	u32 Locks;		/* Value word of lock 0 */
+	u32 ErrWord[XAIE_HEALTH_MAX_ERROR_REGS];
+	u32 ErrMask[XAIE_HEALTH_MAX_ERROR_REGS];	/* Group error bits */
+	u8 NumErrRegs;
+	u8 TileType;
+} XAie_HealthTileRegs;
+
+/*
+ * This typedef captures a health scan of a set of tiles. The status registers
+ * are listed once by XAie_HealthScanInit() and merged in runs of close
+ * registers, so XAie_HealthScanRead() reads the tiles column by column with
+ * few block reads. Each read decodes Tiles, keeps the previous scan in Prev
+ * and lists in Changed the indexes of the tiles whose status changed.
+ */
+typedef struct {
+	XAie_HealthTile *Tiles;
+	XAie_HealthTile *Prev;
+	u32 NumTiles;
+	u32 *Changed;
+	u32 NumChanged;
+	u32 Summary;		/* OR of the flags of all the tiles */
+	u32 NumScans;
+	XAie_CfgSnapRange *Ranges;
+	u32 NumRanges;
+	u32 *Regs;
+	u32 NumWords;
+	XAie_HealthTileRegs *TileRegs;
+	u8 IsReady;
+} XAie_HealthScan;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_HealthScanInit(XAie_DevInst *DevInst, XAie_HealthScan *Scan,
+		const XAie_LocType *Locs, u32 NumLocs);
+AieRC XAie_HealthScanRead(XAie_DevInst *DevInst, XAie_HealthScan *Scan);
+AieRC XAie_HealthScanFree(XAie_HealthScan *Scan);
+
+#endif		/* end of protection macro */
+
+/** @} */
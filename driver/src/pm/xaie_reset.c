@@ -13,17 +13,36 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#endif
+
 #include "xaie_clock.h"
+#include "xaie_dma_shadow.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_npi.h"
 #include "xaie_reset.h"
+#include "xaie_shadow.h"
 #include "xaiegbl.h"
 
 #ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
 
 /*****************************************************************************/
 /***************************** Macro Definitions *****************************/
+/**************************** Type Definitions *******************************/
+/* Worker clearing the memories of every NumWorkers-th column */
+typedef struct {
+	XAie_DevInst *DevInst;
+	u32 FirstCol;
+	u32 NumWorkers;
+	AieRC RC;
+#ifndef __AIEBAREMETAL__
+	pthread_t Thread;
+#endif
+} XAie_ClearMemWorker;
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -49,7 +68,7 @@ static void  _XAie_RstSetColumnReset(XAie_DevInst *DevInst,
 	u64 RegAddr;
 	const XAie_PlIfMod *PlIfMod;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
 	RegAddr = PlIfMod->ColRstOff +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
@@ -110,7 +129,7 @@ static void _XAie_RstSetBlockShimNocAxiMmNsuErr(XAie_DevInst *DevInst,
 	const XAie_PlIfMod *PlIfMod;
 	const XAie_ShimNocAxiMMConfig *ShimNocAxiMM;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
 	ShimNocAxiMM = PlIfMod->ShimNocAxiMM;
 	RegAddr = ShimNocAxiMM->RegOff +
@@ -157,7 +176,7 @@ static void  _XAie_RstSetBlockAllShimsNocAxiMmNsuErr(XAie_DevInst *DevInst,
 		XAie_LocType Loc = XAie_TileLoc(C, 0);
 		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 		if (TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 			continue;
 		}
@@ -188,7 +207,7 @@ static AieRC _XAie_RstAllShims(XAie_DevInst *DevInst)
 	const XAie_ShimRstMod *ShimTileRst;
 	XAie_LocType Loc = XAie_TileLoc(0, 0);
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	ShimTileRst = DevInst->DevProp.DevMod[TileType].PlIfMod->ShimTileRst;
 
 	return ShimTileRst->RstShims(DevInst, 0, DevInst->NumCols);
@@ -248,6 +267,10 @@ AieRC XAie_ResetPartition(XAie_DevInst *DevInst)
 
 	_XAie_RstSetBlockAllShimsNocAxiMmNsuErr(DevInst, XAIE_ENABLE);
 
+	/* The reset restores the registers to their default values */
+	_XAie_ShadowInvalidateAll(DevInst);
+	_XAie_BdShadowInvalidateAll(DevInst);
+
 	return _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
 }
 
@@ -255,25 +278,71 @@ AieRC XAie_ResetPartition(XAie_DevInst *DevInst)
 /*****************************************************************************/
 /**
 *
-* This API clears an AI engine tile data memory
+* This API returns the address and size of an AI engine tile data memory
 *
 * @param	DevInst: Device Instance
+* @param	Loc: Location of the tile
+* @param	RegAddr: Pointer to return the address of the memory
 *
-* @return	None.
+* @return	Size of the memory in 32-bit words.
 *
 * @note		internal to this file.
 *******************************************************************************/
-static void _XAie_ClearDataMem(XAie_DevInst *DevInst, XAie_LocType Loc)
+static u32 _XAie_GetDataMem(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u64 *RegAddr)
 {
 	const XAie_MemMod *MemMod;
-	u64 RegAddr;
 	u8 TileType;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
-	RegAddr = MemMod->MemAddr +
+	*RegAddr = MemMod->MemAddr +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
-	XAie_BlockSet32(DevInst, RegAddr, 0, MemMod->Size / 4);
+	return MemMod->Size / 4;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the address and size of an AI engine tile program memory
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile
+* @param	RegAddr: Pointer to return the address of the memory
+*
+* @return	Size of the memory in 32-bit words.
+*
+* @note		internal to this file.
+*******************************************************************************/
+static u32 _XAie_GetProgMem(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u64 *RegAddr)
+{
+	const XAie_CoreMod *CoreMod;
+
+	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	*RegAddr = CoreMod->ProgMemHostOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	return CoreMod->ProgMemSize / 4;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears an AI engine tile data memory
+*
+* @param	DevInst: Device Instance
+*
+* @return	None.
+*
+* @note		internal to this file.
+*******************************************************************************/
+static void _XAie_ClearDataMem(XAie_DevInst *DevInst, XAie_LocType Loc)
+{
+	u64 RegAddr;
+	u32 Size;
+
+	Size = _XAie_GetDataMem(DevInst, Loc, &RegAddr);
+	XAie_BlockSet32(DevInst, RegAddr, 0, Size);
 }
 
 /*****************************************************************************/
@@ -289,13 +358,83 @@ static void _XAie_ClearDataMem(XAie_DevInst *DevInst, XAie_LocType Loc)
 *******************************************************************************/
 static void _XAie_ClearProgMem(XAie_DevInst *DevInst, XAie_LocType Loc)
 {
-	const XAie_CoreMod *CoreMod;
 	u64 RegAddr;
+	u32 Size;
 
-	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
-	RegAddr = CoreMod->ProgMemHostOffset +
-		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
-	XAie_BlockSet32(DevInst, RegAddr, 0, CoreMod->ProgMemSize / 4);
+	Size = _XAie_GetProgMem(DevInst, Loc, &RegAddr);
+	XAie_BlockSet32(DevInst, RegAddr, 0, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the type of a tile whose memories are cleared with the
+* partition.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile
+* @param	UsedTiles: Bitmap of the tiles to clear, NULL for all of them.
+*
+* @return	Tile type, XAIEGBL_TILE_TYPE_MAX if the tile has no memory to
+*		clear, is not requested or is not in UsedTiles.
+*
+* @note		internal to this file.
+*******************************************************************************/
+static u8 _XAie_GetClearTileType(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const u32 *UsedTiles)
+{
+	u8 TileType;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_SHIMNOC ||
+	   TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
+		return XAIEGBL_TILE_TYPE_MAX;
+	}
+
+	if((UsedTiles != NULL) && !CheckBit(UsedTiles,
+				_XAie_GetTileBitPosFromLoc(DevInst, Loc))) {
+		return XAIEGBL_TILE_TYPE_MAX;
+	}
+
+	if(_XAie_PmIsTileRequested(DevInst, Loc) == XAIE_DISABLE) {
+		return XAIEGBL_TILE_TYPE_MAX;
+	}
+
+	return TileType;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the data and program memories of the requested tiles of the
+* partition.
+*
+* @param	DevInst: Device Instance
+* @param	UsedTiles: Bitmap of the tiles to clear, NULL for all of them.
+*
+* @return	None.
+*
+* @note		internal to this file.
+*******************************************************************************/
+static void _XAie_ClearMems(XAie_DevInst *DevInst, const u32 *UsedTiles)
+{
+	for(u32 C = 0; C < DevInst->NumCols; C++) {
+		for(u32 R = 0; R < DevInst->NumRows; R++) {
+			XAie_LocType Loc = XAie_TileLoc(C, R);
+			u8 TileType;
+
+			TileType = _XAie_GetClearTileType(DevInst, Loc,
+					UsedTiles);
+			if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+				continue;
+			}
+
+			_XAie_ClearDataMem(DevInst, Loc);
+			if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+				_XAie_ClearProgMem(DevInst, Loc);
+			}
+		}
+	}
 }
 
 /*****************************************************************************/
@@ -319,30 +458,387 @@ AieRC XAie_ClearPartitionMems(XAie_DevInst *DevInst)
 		return XAIE_INVALID_ARGS;
 	}
 
-	for(u32 C = 0; C < DevInst->NumCols; C++) {
+	_XAie_ClearMems(DevInst, NULL);
+
+	return XAIE_OK;
+}
+
+#ifndef __AIEBAREMETAL__
+/*****************************************************************************/
+/**
+*
+* This API clears the memories of the columns of a worker by block sets issued
+* straight to the backend.
+*
+* @param	Arg: Worker.
+*
+* @return	NULL.
+*
+* @note		internal to this file. The shadow registers of the memories
+*		are invalidated by the caller.
+*******************************************************************************/
+static void *_XAie_ClearMemWorkerRun(void *Arg)
+{
+	XAie_ClearMemWorker *Worker = (XAie_ClearMemWorker *)Arg;
+	XAie_DevInst *DevInst = Worker->DevInst;
+
+	Worker->RC = XAIE_OK;
+	for(u32 C = Worker->FirstCol; C < DevInst->NumCols;
+			C += Worker->NumWorkers) {
 		for(u32 R = 0; R < DevInst->NumRows; R++) {
 			XAie_LocType Loc = XAie_TileLoc(C, R);
+			u64 RegAddr;
+			u32 Size;
 			u8 TileType;
 
-			TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-			if(TileType == XAIEGBL_TILE_TYPE_SHIMNOC ||
-			   TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
+			TileType = _XAie_GetClearTileType(DevInst, Loc, NULL);
+			if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 				continue;
 			}
 
-			if(_XAie_PmIsTileRequested(DevInst, Loc) ==
-			   XAIE_DISABLE) {
+			Size = _XAie_GetDataMem(DevInst, Loc, &RegAddr);
+			Worker->RC |= _XAie_IOBlockSet32(DevInst, RegAddr, 0,
+					Size);
+			if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+				Size = _XAie_GetProgMem(DevInst, Loc, &RegAddr);
+				Worker->RC |= _XAie_IOBlockSet32(DevInst,
+						RegAddr, 0, Size);
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the memories of the partition with worker threads, each one
+* clearing every NumWorkers-th column.
+*
+* @param	DevInst: Device Instance
+* @param	NumWorkers: Number of worker threads.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		internal to this file. Only used for backends accessing the
+*		device by memory mapped IO, whose block sets can run
+*		concurrently.
+*******************************************************************************/
+static AieRC _XAie_ClearPartitionMemsParallel(XAie_DevInst *DevInst,
+		u32 NumWorkers)
+{
+	XAie_ClearMemWorker *Workers;
+	AieRC RC = XAIE_OK;
+	u32 NumStarted = 0U;
+
+	Workers = (XAie_ClearMemWorker *)calloc(NumWorkers, sizeof(*Workers));
+	if(Workers == NULL) {
+		XAIE_ERROR("Memory allocation for clear workers failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 C = 0; C < DevInst->NumCols; C++) {
+		for(u32 R = 0; R < DevInst->NumRows; R++) {
+			XAie_LocType Loc = XAie_TileLoc(C, R);
+			u64 RegAddr;
+			u32 Size;
+			u8 TileType;
+
+			TileType = _XAie_GetClearTileType(DevInst, Loc, NULL);
+			if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 				continue;
 			}
 
-			_XAie_ClearDataMem(DevInst, Loc);
+			Size = _XAie_GetDataMem(DevInst, Loc, &RegAddr);
+			_XAie_ShadowInvalidate(DevInst, RegAddr, Size);
 			if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
-				_XAie_ClearProgMem(DevInst, Loc);
+				Size = _XAie_GetProgMem(DevInst, Loc, &RegAddr);
+				_XAie_ShadowInvalidate(DevInst, RegAddr, Size);
 			}
 		}
 	}
 
-	return XAIE_OK;
+	for(u32 i = 0U; i < NumWorkers; i++) {
+		Workers[i].DevInst = DevInst;
+		Workers[i].FirstCol = i;
+		Workers[i].NumWorkers = NumWorkers;
+	}
+
+	/* The calling thread clears the columns of the first worker. */
+	for(u32 i = 1U; i < NumWorkers; i++) {
+		if(pthread_create(&Workers[i].Thread, NULL,
+					_XAie_ClearMemWorkerRun,
+					&Workers[i]) != 0) {
+			break;
+		}
+		NumStarted++;
+	}
+
+	/* Columns of workers which failed to start are cleared here. */
+	for(u32 i = NumStarted + 1U; i < NumWorkers; i++) {
+		(void)_XAie_ClearMemWorkerRun(&Workers[i]);
+	}
+	(void)_XAie_ClearMemWorkerRun(&Workers[0]);
+
+	for(u32 i = 1U; i <= NumStarted; i++) {
+		pthread_join(Workers[i].Thread, NULL);
+	}
+
+	for(u32 i = 0U; i < NumWorkers; i++) {
+		if(Workers[i].RC != XAIE_OK) {
+			XAIE_ERROR("Failed to clear partition memories\n");
+			RC = XAIE_ERR;
+			break;
+		}
+	}
+
+	free(Workers);
+	return RC;
+}
+#endif /* !__AIEBAREMETAL__ */
+
+/*****************************************************************************/
+/**
+*
+* This API clears AI engine partition pointed by the AI enigne device instance,
+* like XAie_ClearPartitionMems(), with fewer round trips to the device. The
+* block sets of all the tile memories are recorded into one transaction which
+* is submitted at once, unless the calling thread already has a transaction
+* open, in which case they are added to it. For backends accessing the device
+* by memory mapped IO, the columns are instead spread over worker threads
+* when more than one worker is requested.
+*
+* @param	DevInst: Device Instance
+* @param	NumWorkers: Number of threads to clear the columns with, 0 or 1
+*		for the calling thread only. Capped to the number of columns.
+*
+* @return	XAIE_OK on success.
+*		XAIE_INVALID_ARGS if any argument is invalid
+*
+* @note		Worker threads are not used for other backends, for baremetal
+*		or within an open transaction, where the transaction is used.
+*******************************************************************************/
+AieRC XAie_ClearPartitionMemsFast(XAie_DevInst *DevInst, u32 NumWorkers)
+{
+	AieRC RC = XAIE_OK;
+	u8 OwnTxn = XAIE_DISABLE;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(NumWorkers > DevInst->NumCols) {
+		NumWorkers = DevInst->NumCols;
+	}
+
+#ifndef __AIEBAREMETAL__
+	if((NumWorkers > 1U) &&
+			(DevInst->Backend->Type == XAIE_IO_BACKEND_METAL) &&
+			(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE)) {
+		return _XAie_ClearPartitionMemsParallel(DevInst, NumWorkers);
+	}
+#endif
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	_XAie_ClearMems(DevInst, NULL);
+
+	if(OwnTxn == XAIE_ENABLE) {
+		RC = _XAie_Txn_Submit(DevInst, NULL);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if any tile of a column is set in a tile bitmap.
+*
+* @param	DevInst: Device Instance
+* @param	UsedTiles: Bitmap of tiles, in the layout of the tiles in use.
+* @param	Col: Column.
+*
+* @return	XAIE_ENABLE if a tile of the column is set, XAIE_DISABLE
+*		otherwise.
+*
+* @note		internal to this file.
+*******************************************************************************/
+static u8 _XAie_IsColUsed(XAie_DevInst *DevInst, const u32 *UsedTiles, u32 Col)
+{
+	for(u32 R = 1; R < DevInst->NumRows; R++) {
+		if(CheckBit(UsedTiles, _XAie_GetTileBitPosFromLoc(DevInst,
+					XAie_TileLoc(Col, R)))) {
+			return XAIE_ENABLE;
+		}
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API resets the columns of the AI engine partition used by a previous
+* job, following the sequence of XAie_ResetPartition(). Only the columns with
+* a used tile are reset, which resets their cores, DMAs and locks, and only
+* their SHIMs are reset and configured to block NSU errors. The other columns
+* are left as they are, apart from being clock gated with the partition.
+*
+* @param	DevInst: Device Instance
+* @param	UsedTiles: Bitmap of the used tiles, in the layout of the tiles
+*		in use of the device instance: bit Col * (NumRows - 1) +
+*		Row - 1 for the tiles above the SHIM row. NULL to use the
+*		tiles requested with XAie_PmRequestTiles().
+*
+* @return	XAIE_OK on success.
+*		XAIE_INVALID_ARGS if any argument is invalid
+*
+* @note		Clear the memories of the used tiles with
+*		XAie_ClearPartitionMemsTiles() first, while the tiles are
+*		still requested. The SHIM reset of AIE-ML devices applies to
+*		the whole partition, so all SHIMs are reset there if any
+*		column is used.
+*******************************************************************************/
+AieRC XAie_ResetPartitionTiles(XAie_DevInst *DevInst, const u32 *UsedTiles)
+{
+	const XAie_ShimRstMod *ShimTileRst;
+	XAie_NpiProtRegReq ProtRegReq = {0};
+	u32 RunStart = 0U, NumUsed = 0U;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(UsedTiles == NULL) {
+		UsedTiles = DevInst->TilesInUse;
+	}
+
+	for(u32 C = 0; C < DevInst->NumCols; C++) {
+		NumUsed += _XAie_IsColUsed(DevInst, UsedTiles, C);
+	}
+	if(NumUsed == 0U) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	for(u32 C = 0; C < DevInst->NumCols; C++) {
+		if(_XAie_IsColUsed(DevInst, UsedTiles, C) == XAIE_ENABLE) {
+			_XAie_RstSetColumnReset(DevInst, XAie_TileLoc(C, 0),
+					XAIE_ENABLE);
+		}
+	}
+
+	RC = _XAie_PmSetPartitionClock(DevInst, XAIE_ENABLE);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	ShimTileRst = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_SHIMPL].
+		PlIfMod->ShimTileRst;
+	if(DevInst->DevProp.DevGen != XAIE_DEV_GEN_AIE) {
+		_XAie_RstAllShims(DevInst);
+	} else {
+		/* Reset the SHIMs of each run of used columns at once */
+		for(u32 C = 0; C <= DevInst->NumCols; C++) {
+			if((C < DevInst->NumCols) &&
+					_XAie_IsColUsed(DevInst, UsedTiles, C)) {
+				continue;
+			}
+
+			if(C > RunStart) {
+				ShimTileRst->RstShims(DevInst, RunStart,
+						C - RunStart);
+			}
+			RunStart = C + 1U;
+		}
+	}
+
+	ProtRegReq.Enable = XAIE_ENABLE;
+	XAie_RunOp(DevInst, XAIE_BACKEND_OP_SET_PROTREG, (void *)&ProtRegReq);
+	for(u32 C = 0; C < DevInst->NumCols; C++) {
+		XAie_LocType Loc = XAie_TileLoc(C, 0);
+
+		if((_XAie_DevGetTTypefromLoc(DevInst, Loc) ==
+					XAIEGBL_TILE_TYPE_SHIMNOC) &&
+				_XAie_IsColUsed(DevInst, UsedTiles, C)) {
+			_XAie_RstSetBlockShimNocAxiMmNsuErr(DevInst, Loc,
+					XAIE_ENABLE);
+		}
+	}
+	ProtRegReq.Enable = XAIE_DISABLE;
+	XAie_RunOp(DevInst, XAIE_BACKEND_OP_SET_PROTREG, (void *)&ProtRegReq);
+
+	/* The reset restores the registers to their default values */
+	_XAie_ShadowInvalidateAll(DevInst);
+	_XAie_BdShadowInvalidateAll(DevInst);
+
+	return _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the data and program memories of the tiles used by a
+* previous job, recorded into one transaction like
+* XAie_ClearPartitionMemsFast().
+*
+* @param	DevInst: Device Instance
+* @param	UsedTiles: Bitmap of the used tiles, in the layout described for
+*		XAie_ResetPartitionTiles(). NULL to clear all the requested
+*		tiles.
+*
+* @return	XAIE_OK on success.
+*		XAIE_INVALID_ARGS if any argument is invalid
+*
+* @note		Tiles which are not requested are skipped, as their memories
+*		cannot be accessed.
+*******************************************************************************/
+AieRC XAie_ClearPartitionMemsTiles(XAie_DevInst *DevInst,
+		const u32 *UsedTiles)
+{
+	AieRC RC = XAIE_OK;
+	u8 OwnTxn = XAIE_DISABLE;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	_XAie_ClearMems(DevInst, UsedTiles);
+
+	if(OwnTxn == XAIE_ENABLE) {
+		RC = _XAie_Txn_Submit(DevInst, NULL);
+	}
+
+	return RC;
 }
 
 #endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
@@ -21,6 +21,10 @@
 /************************** Function Prototypes  *****************************/
 AieRC XAie_ResetPartition(XAie_DevInst *DevInst);
 AieRC XAie_ClearPartitionMems(XAie_DevInst *DevInst);
+AieRC XAie_ClearPartitionMemsFast(XAie_DevInst *DevInst, u32 NumWorkers);
+AieRC XAie_ResetPartitionTiles(XAie_DevInst *DevInst, const u32 *UsedTiles);
+AieRC XAie_ClearPartitionMemsTiles(XAie_DevInst *DevInst,
+		const u32 *UsedTiles);
 #endif		/* end of protection macro */
 
 /** @} */
@@ -17,7 +17,7 @@
 #include "xaie_helper.h"
 #include "xaiegbl.h"
 
-#ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
+#if defined(XAIE_FEATURE_PRIVILEGED_ENABLE) && defined(XAIE_DEV_AIE_ENABLE)
 
 /*****************************************************************************/
 /***************************** Macro Definitions *****************************/
@@ -47,7 +47,7 @@ static void _XAie_RstSetShimReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 	const XAie_PlIfMod *PlIfMod;
 	const XAie_ShimRstMod *ShimTileRst;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
 	ShimTileRst = PlIfMod->ShimTileRst;
 
@@ -105,5 +105,5 @@ AieRC _XAie_RstShims(XAie_DevInst *DevInst, u32 StartCol, u32 NumCols)
 	return XAIE_OK;
 }
 
-#endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
+#endif /* XAIE_FEATURE_PRIVILEGED_ENABLE && XAIE_DEV_AIE_ENABLE */
 /** @} */
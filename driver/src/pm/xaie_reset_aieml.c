@@ -18,7 +18,7 @@
 #include "xaie_npi.h"
 #include "xaiegbl.h"
 
-#ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
+#if defined(XAIE_FEATURE_PRIVILEGED_ENABLE) && defined(XAIE_DEV_AIEML_ENABLE)
 
 /*****************************************************************************/
 /***************************** Macro Definitions *****************************/
@@ -71,5 +71,5 @@ AieRC _XAieMl_RstShims(XAie_DevInst *DevInst, u32 StartCol, u32 NumCols)
 	return XAIE_OK;
 }
 
-#endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
+#endif /* XAIE_FEATURE_PRIVILEGED_ENABLE && XAIE_DEV_AIEML_ENABLE */
 /** @} */
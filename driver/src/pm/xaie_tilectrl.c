@@ -62,7 +62,7 @@ AieRC _XAie_TileCtrlSetIsolation(XAie_DevInst *DevInst, XAie_LocType Loc,
 	u64 RegAddr;
 	u8 TileType;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Failed to set tile isolation, invalid tile type\n");
 		return XAIE_ERR;
@@ -83,5 +83,109 @@ AieRC _XAie_TileCtrlSetIsolation(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAie_Write32(DevInst, RegAddr, FldVal);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API sets the isolation boundary of all the tiles of a partition. The
+* tiles of the first column are isolated from the west and the tiles of the
+* last column from the east.
+*
+* @param	DevInst: Device Instance
+* @param	InnerCols: XAIE_ENABLE to also clear the isolation of the tiles of
+*			   the other columns, XAIE_DISABLE to leave them as is.
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		The register address and isolation fields are computed once
+*		per tile type. Unless a transaction is already active, the
+*		writes are submitted as one transaction.
+*		This is INTERNAL function.
+*
+******************************************************************************/
+AieRC _XAie_TileCtrlSetPartIsolation(XAie_DevInst *DevInst, u8 InnerCols)
+{
+	const XAie_TileCtrlMod *TCtrlMod;
+	u32 RegOff[XAIEGBL_TILE_TYPE_MAX], Mask[XAIEGBL_TILE_TYPE_MAX];
+	u8 Lsb[XAIEGBL_TILE_TYPE_MAX], OwnTxn = XAIE_DISABLE;
+	AieRC RC = XAIE_OK;
+
+	for(u8 TileType = 0U; TileType < XAIEGBL_TILE_TYPE_MAX; TileType++) {
+		TCtrlMod = DevInst->DevProp.DevMod[TileType].TileCtrlMod;
+		if(TCtrlMod == NULL) {
+			continue;
+		}
+
+		RegOff[TileType] = TCtrlMod->TileCtrlRegOff;
+		Mask[TileType] = TCtrlMod->IsolateEast.Mask |
+			TCtrlMod->IsolateNorth.Mask |
+			TCtrlMod->IsolateWest.Mask |
+			TCtrlMod->IsolateSouth.Mask;
+		Lsb[TileType] = TCtrlMod->IsolateSouth.Lsb;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	for(u8 C = 0U; (C < DevInst->NumCols) && (RC == XAIE_OK); C++) {
+		u8 Dir = 0U;
+
+		if(C == 0U) {
+			Dir |= XAIE_ISOLATE_WEST_MASK;
+		}
+		if(C == (u8)(DevInst->NumCols - 1U)) {
+			Dir |= XAIE_ISOLATE_EAST_MASK;
+		}
+		if((Dir == 0U) && (InnerCols == XAIE_DISABLE)) {
+			continue;
+		}
+
+		for(u8 R = 0U; R < DevInst->NumRows; R++) {
+			XAie_LocType Loc = XAie_TileLoc(C, R);
+			u8 TileType;
+
+			TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+			if((TileType == XAIEGBL_TILE_TYPE_MAX) ||
+					(DevInst->DevProp.DevMod[TileType].TileCtrlMod ==
+					 NULL)) {
+				XAIE_ERROR("Failed to set tile isolation, invalid tile type\n");
+				RC = XAIE_ERR;
+				break;
+			}
+
+			/*
+			 * The Dir masks match the register isolation mask, there
+			 * is no need to calculate each direction bit.
+			 */
+			RC = XAie_Write32(DevInst, RegOff[TileType] +
+					_XAie_GetTileAddr(DevInst, R, C),
+					XAie_SetField(Dir, Lsb[TileType],
+						Mask[TileType]));
+			if(RC != XAIE_OK) {
+				break;
+			}
+		}
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	return RC;
+}
+
 #endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
 /** @} */
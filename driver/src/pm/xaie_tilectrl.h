@@ -37,5 +37,6 @@
 /************************** Function Prototypes  *****************************/
 AieRC _XAie_TileCtrlSetIsolation(XAie_DevInst *DevInst, XAie_LocType Loc,
 		u8 Dir);
+AieRC _XAie_TileCtrlSetPartIsolation(XAie_DevInst *DevInst, u8 InnerCols);
 
 #endif		/* end of protection macro */
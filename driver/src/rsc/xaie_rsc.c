@@ -22,11 +22,24 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#ifndef __AIEBAREMETAL__
+#define  _POSIX_C_SOURCE 200809L
+#endif
+
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-
+#ifndef __AIEBAREMETAL__
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include "xaie_clock.h"
 #include "xaie_feature_config.h"
 #include "xaie_rsc.h"
 #include "xaie_rsc_internal.h"
@@ -37,6 +50,7 @@
 /***************************** Macro Definitions *****************************/
 #define XAIE_TRACE_CTRL_RSCS_PER_MOD	1U
 #define XAIE_COMBO_EVENTS_PER_MOD	4U
+#define XAIE_RSC_CACHE_LINE_SIZE	64U
 
 #define XAIE_RSC_HEADER_TILE_TYPE_SHIFT	0U
 #define XAIE_RSC_HEADER_TILE_TYPE_MASK	0xF
@@ -47,6 +61,15 @@
 #define XAIE_RSC_HEADER_SIZE_SHIFT	16U
 #define XAIE_RSC_HEADER_SIZE_MASK	0xFFFFFFFF
 
+#define XAIE_RSC_SNAPSHOT_MAGIC		0x53524941U /* "AIRS" */
+#define XAIE_RSC_SNAPSHOT_VERSION	1U
+#define XAIE_RSC_SNAPSHOT_ALIGN		64U
+#define XAIE_RSC_SNAPSHOT_MAX_SECTIONS	(XAIEGBL_TILE_TYPE_MAX * XAIE_MAX_RSC)
+
+#define XAIE_RSC_SHM_MAGIC		0x4d485352U /* "RSHM" */
+#define XAIE_RSC_SHM_VERSION		1U
+#define XAIE_RSC_SHM_NAME_MAX		64U
+
 /*
  * This typedef defines a resource bitmaps meta data header
  */
@@ -57,6 +80,53 @@ typedef struct XAieRscMetaHeader {
 			* element */
 } XAieRscMetaHeader;
 
+/*
+ * This typedef defines the header of a resource snapshot. The header is
+ * followed by the section table and then by the sections, each of them
+ * starting at a XAIE_RSC_SNAPSHOT_ALIGN bytes aligned offset. A section is
+ * the bitmap of a resource type of a tile type as it is laid out in memory,
+ * runtime and static halves of every module included, so that a snapshot can
+ * be saved straight from the bitmaps and used in place once mapped.
+ */
+typedef struct XAieRscSnapshotHeader {
+	u32 Magic;
+	u16 Version;
+	u16 NumSections;
+	u8 DevGen;
+	u8 NumCols;
+	u8 NumRows;
+	u8 AieTileNumRows;
+	u8 MemTileNumRows;
+	u8 Reserved[3];
+	u64 Size; /* size of the snapshot in bytes */
+} XAieRscSnapshotHeader;
+
+/*
+ * This typedef defines a resource snapshot section table entry
+ */
+typedef struct XAieRscSnapshotSection {
+	u8 TileType;
+	u8 RscType;
+	u16 Reserved;
+	u32 NumWords; /* length of the bitmap in 32 bit words */
+	u64 Offset; /* offset of the bitmap from the start of the snapshot */
+} XAieRscSnapshotSection;
+
+/*
+ * Locks of the resource bitmaps of a tile type, one per resource type. Shim
+ * NoC and shim PL tiles share their bitmaps and so their locks. A request
+ * takes the lock of its resource type for each tile type it touches, in
+ * increasing tile type order. Requests which need the locks of several
+ * resource types take them in increasing resource type order.
+ */
+struct XAie_RscMgrLocks {
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock[XAIE_MAX_RSC];
+#else
+	u8 Unused;
+#endif
+};
+
 /*
  * This typedef defines a resource bitmap element
  */
@@ -67,6 +137,37 @@ typedef struct XAieRscBitmap {
 	u64 Bitmap[0]; /* the pointer of bitmap of the resource */
 } XAieRscBitmap;
 
+/*
+ * This typedef defines the header of a shared resource state. The header is
+ * followed, for each tile type but the shim NoC one, by a XAieRscShmTileType
+ * and then by the bitmaps of the tile type, each of them starting on a cache
+ * line. The layout only depends on the partition, so every process computes
+ * the same offsets.
+ */
+typedef struct XAieRscShmHeader {
+	u32 Magic;
+	u16 Version;
+	u8 DevGen;
+	u8 StartCol;
+	u8 NumCols;
+	u8 NumRows;
+	u8 AieTileNumRows;
+	u8 MemTileNumRows;
+	u32 IsReady; /* set by the owner once the state is initialized */
+	u32 Size; /* size of the shared state in bytes */
+	char Name[XAIE_RSC_SHM_NAME_MAX]; /* name of the shared memory object */
+} XAieRscShmHeader;
+
+/*
+ * This typedef defines the shared state of a tile type which precedes its
+ * bitmaps. The locks are process shared.
+ */
+typedef struct XAieRscShmTileType {
+	struct XAie_RscMgrLocks Locks;
+	u32 BcChannelUsers[XAIE_NUM_BROADCAST_CHANNELS];
+	u8 Policies[XAIE_MAX_RSC];
+} XAieRscShmTileType;
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -166,6 +267,65 @@ u32 _XAie_GetTotalNumRscs(XAie_DevInst *DevInst, u8 TileType,
 	}
 }
 
+/*****************************************************************************/
+/**
+* This API returns the length of the bitmap of a tile type and resource type.
+* The bitmap holds a runtime and a static bit for every resource of every tile
+* of the tile type in the partition.
+*
+* @param	DevInst: Device Instance
+* @param	TileType: Tile type
+* @param	RscType: Resource type.
+*
+* @return	Length of the bitmap in 32 bit words.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_RscMgr_GetBitmapWords(XAie_DevInst *DevInst, u8 TileType,
+		XAie_RscType RscType)
+{
+	u32 BitmapSize;
+
+	BitmapSize = _XAie_NearestRoundUp(_XAie_GetNumRows(DevInst, TileType) *
+			_XAie_GetTotalNumRscs(DevInst, TileType, RscType) *
+			DevInst->NumCols * 2U, 8 * sizeof(u32));
+
+	return BitmapSize / (8 * sizeof(u32));
+}
+
+/*****************************************************************************/
+/**
+* This API unmaps the shared resource state of the partition, if any. The
+* owner of the state also removes its shared memory object, so that no
+* process attaches to it any more. The processes which are attached keep
+* their mapping.
+*
+* @param	DevInst: Device Instance
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_RscShm_Release(XAie_DevInst *DevInst)
+{
+#ifndef __AIEBAREMETAL__
+	XAie_ResourceManager *RscMap =
+		&DevInst->RscMapping[XAIEGBL_TILE_TYPE_AIETILE];
+	XAieRscShmHeader *Header = (XAieRscShmHeader *)RscMap->Shm;
+
+	if(Header == XAIE_NULL)
+		return;
+
+	if(RscMap->IsShmOwner == XAIE_ENABLE)
+		shm_unlink(Header->Name);
+	munmap(Header, Header->Size);
+#else
+	(void)DevInst;
+#endif
+}
+
 /*****************************************************************************/
 /**
 * This API deallocates memory for all resource bitmaps.
@@ -185,16 +345,93 @@ AieRC _XAie_RscMgrFinish(XAie_DevInst *DevInst)
 		if(i == XAIEGBL_TILE_TYPE_SHIMNOC)
 			continue;
 
+		free(RscMap->Mem);
+		if(RscMap->Shm != XAIE_NULL)
+			continue;
+
+#ifndef __AIEBAREMETAL__
 		for(u8 RscType = 0U; RscType < XAIE_MAX_RSC; RscType++) {
-			free(RscMap->Bitmaps[RscType]);
+			pthread_mutex_destroy(&RscMap->Locks->Lock[RscType]);
 		}
-		free(RscMap->Bitmaps);
+#endif
+		free(RscMap->Locks);
 	}
 
+	_XAie_RscShm_Release(DevInst);
 	free(DevInst->RscMapping);
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* This API allocates the bitmaps of a tile type. The bitmap pointers, the
+* broadcast channel occupancy summary, the allocation policies and the bitmaps
+* of every resource type share a single zeroed allocation. Each bitmap starts on a cache line, so the
+* bitmaps of a tile type are packed together rather than spread over the heap.
+*
+* @param	DevInst: Device Instance
+* @param	TileType: Tile type
+* @param	RscMap: Resource manager of the tile type
+*
+* @return	XAIE_OK on success, XAIE_ERR if the allocation failed.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_RscMgr_AllocBitmaps(XAie_DevInst *DevInst, u8 TileType,
+		XAie_ResourceManager *RscMap)
+{
+	u32 MetaSize, Size, Offset[XAIE_MAX_RSC];
+	u8 *Base;
+
+	MetaSize = _XAie_NearestRoundUp(sizeof(u32 *) * XAIE_MAX_RSC +
+			sizeof(u32) * XAIE_NUM_BROADCAST_CHANNELS +
+			sizeof(u8) * XAIE_MAX_RSC, XAIE_RSC_CACHE_LINE_SIZE);
+	Size = MetaSize;
+	for(u8 RscType = 0U; RscType < XAIE_MAX_RSC; RscType++) {
+		u32 BitmapSize;
+
+		/*
+		 * One bitmap is allocated for each tiletype. The size
+		 * of each bitmap is calculated based on number of rows
+		 * and cols in the patition for that tiletype and the
+		 * number of counters per tile. The allocation includes
+		 * static and runtime bitmap and hence the multiplying
+		 * factor 2U. Static bitmap is used to mark the
+		 * resources allocated during compile time and runtime
+		 * bitmap will be updated as per runtime request for a
+		 * resource.
+		 */
+		BitmapSize = _XAie_RscMgr_GetBitmapWords(DevInst, TileType,
+				RscType);
+		XAIE_DBG("TileType: %u, RscType: %u, BitmapSize: 0x%x\n",
+				TileType, RscType, BitmapSize);
+		Offset[RscType] = Size;
+		Size += _XAie_NearestRoundUp(BitmapSize * sizeof(u32),
+				XAIE_RSC_CACHE_LINE_SIZE);
+	}
+
+	/* Over allocate to align the start to a cache line */
+	RscMap->Mem = calloc(1U, Size + XAIE_RSC_CACHE_LINE_SIZE - 1U);
+	if(RscMap->Mem == XAIE_NULL) {
+		XAIE_ERROR("Memory allocation failed for tile type:%d\n",
+				TileType);
+		return XAIE_ERR;
+	}
+
+	Base = (u8 *)(((uintptr_t)RscMap->Mem + XAIE_RSC_CACHE_LINE_SIZE -
+				1U) & ~((uintptr_t)XAIE_RSC_CACHE_LINE_SIZE - 1U));
+	RscMap->Bitmaps = (u32 **)Base;
+	RscMap->BcChannelUsers = (u32 *)(Base + sizeof(u32 *) * XAIE_MAX_RSC);
+	RscMap->Policies = (u8 *)(RscMap->BcChannelUsers +
+			XAIE_NUM_BROADCAST_CHANNELS);
+	for(u8 RscType = 0U; RscType < XAIE_MAX_RSC; RscType++) {
+		RscMap->Bitmaps[RscType] = (u32 *)(Base + Offset[RscType]);
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 * This API initializes all resource bitmaps.
@@ -218,59 +455,44 @@ AieRC _XAie_RscMgrInit(XAie_DevInst *DevInst)
 	}
 
 	for(i = 0U; i < XAIEGBL_TILE_TYPE_MAX; i++) {
-		u32 NumRows;
 		XAie_ResourceManager *RscMap;
 		if(i == XAIEGBL_TILE_TYPE_SHIMNOC)
 			continue;
 
-		NumRows = _XAie_GetNumRows(DevInst, i);
 		RscMap = &DevInst->RscMapping[i];
-		RscMap->Bitmaps = (u32 **)malloc(sizeof(u32*) * XAIE_MAX_RSC);
-		if(RscMap == XAIE_NULL) {
+		RscMap->Locks = (struct XAie_RscMgrLocks *)malloc(
+				sizeof(*RscMap->Locks));
+		if((RscMap->Locks == XAIE_NULL) ||
+				(_XAie_RscMgr_AllocBitmaps(DevInst, i, RscMap) !=
+				 XAIE_OK)) {
 			XAIE_ERROR("Memory allocation failed for tile "
 					"type:%d\n", i);
+			free(RscMap->Locks);
 			for(u8 k = 0U; k < i; k++) {
-				free(DevInst->RscMapping[k].Bitmaps);
+				if(k == XAIEGBL_TILE_TYPE_SHIMNOC)
+					continue;
+				free(DevInst->RscMapping[k].Mem);
+#ifndef __AIEBAREMETAL__
+				for(u8 RscType = 0U; RscType < XAIE_MAX_RSC;
+						RscType++) {
+					pthread_mutex_destroy(&DevInst->
+						RscMapping[k].Locks->
+						Lock[RscType]);
+				}
+#endif
+				free(DevInst->RscMapping[k].Locks);
 			}
 			free(DevInst->RscMapping);
 			return XAIE_ERR;
 		}
 
+#ifndef __AIEBAREMETAL__
 		for(u8 RscType = 0U; RscType < XAIE_MAX_RSC; RscType++) {
-			u32 BitmapSize, NumRscs;
-
-			NumRscs = _XAie_GetTotalNumRscs(DevInst, i, RscType);
-			/*
-			 * One bitmap is allocated for each tiletype. The size
-			 * of each bitmap is calculated based on number of rows
-			 * and cols in the patition for that tiletype and the
-			 * number of counters per tile. The allocation includes
-			 * static and runtime bitmap and hence the multiplying
-			 * factor 2U. Static bitmap is used to mark the
-			 * resources allocated during compile time and runtime
-			 * bitmap will be updated as per runtime request for a
-			 * resource.
-			 */
-			BitmapSize = _XAie_NearestRoundUp(NumRows * NumRscs *
-					DevInst->NumCols * 2U, 8 * sizeof(u32));
-			BitmapSize /= 8 * sizeof(u32);
-			XAIE_DBG("TileType: %u, RscType: %u, BitmapSize: 0x%x\n",
-					i, RscType, BitmapSize);
-			RscMap->Bitmaps[RscType] = (u32 *)calloc(BitmapSize,
-					sizeof(u32));
-			if(RscMap->Bitmaps[RscType] == XAIE_NULL) {
-				XAIE_ERROR("Calloc failed for TileType: %u, "
-						"RscType: %u\n", i, RscType);
-				for(u8 k = 0U; k < RscType; k++) {
-					free(RscMap->Bitmaps[k]);
-				}
-				for(u8 k = 0U; k < i; k++) {
-					free(DevInst->RscMapping[k].Bitmaps);
-				}
-				free(DevInst->RscMapping);
-				return XAIE_ERR;
-			}
+			pthread_mutex_init(&RscMap->Locks->Lock[RscType], NULL);
 		}
+#endif
+		RscMap->Shm = XAIE_NULL;
+		RscMap->IsShmOwner = XAIE_DISABLE;
 	}
 
 	DevInst->RscMapping[XAIEGBL_TILE_TYPE_SHIMNOC] =
@@ -325,7 +547,7 @@ u32 _XAie_GetStartBit(XAie_DevInst *DevInst, XAie_LocType Loc, u32 MaxRscVal)
 	u8 TileType;
 	u32 StartRow, BitmapNumRows;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	StartRow = _XAie_GetStartRow(DevInst, TileType);
 	BitmapNumRows = _XAie_GetNumRows(DevInst, TileType);
 
@@ -351,20 +573,24 @@ u32 _XAie_GetStartBit(XAie_DevInst *DevInst, XAie_LocType Loc, u32 MaxRscVal)
 void _XAie_MarkChannelBitmapAndRscId(XAie_DevInst *DevInst,
 		u32 UserRscNum, XAie_UserRsc *Rscs, u32 ChannelIndex)
 {
-	u8 TileType;
+	u8 TileType, WasSet;
 	u32 *Bitmap;
 	XAie_BitmapOffsets Offsets;
 
 	for(u32 i = 0; i < UserRscNum; i++) {
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Rscs[i].Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Rscs[i].Loc);
 		Bitmap = DevInst->RscMapping[TileType].
 				Bitmaps[XAIE_BCAST_CHANNEL_RSC];
 		_XAie_RscMgr_GetBitmapOffsets(DevInst, XAIE_BCAST_CHANNEL_RSC,
 				Rscs[i].Loc, Rscs[i].Mod, &Offsets);
 
 		/* Mark allocation for common channel id in BC channel bitmap */
+		WasSet = (CheckBit(Bitmap, ChannelIndex + Offsets.StartBit) !=
+				0U) ? 1U : 0U;
 		_XAie_SetBitInBitmap(Bitmap, ChannelIndex + Offsets.StartBit,
 				1U);
+		_XAie_RscMgr_TrackBcChannelBit(DevInst, TileType,
+				ChannelIndex + Offsets.StartBit, WasSet);
 		/* Return resource granted to caller by populating RscId */
 		Rscs[i].RscId = ChannelIndex;
 	}
@@ -372,301 +598,668 @@ void _XAie_MarkChannelBitmapAndRscId(XAie_DevInst *DevInst,
 
 /*****************************************************************************/
 /**
-* This API checks the validity of all the arugments passed to the resource
-* manager request APIs.
+* This API keeps the broadcast channel occupancy summary in sync with a bit of
+* a broadcast channel bitmap, after the bit was set or cleared.
 *
-* @param	DevInst: Device Instance
-* @param	RscReq: Contains parameters related to resource request.
-* 			tile loc, module, no. of resource request per tile.
-* @param	NumReq: Number of requests
-* @param	UserRscNum: Size of Rscs array. Must be NumReq * NumRscPerTile
-* @param	Rscs: Contains parameters to return reource such as counter ids,
-* 		      Location, Module, resource type.
-* 		      It needs to be allocated from user application.
+* @param        DevInst: Device Instance
+* @param        TileType: Tile type of the bitmap
+* @param        Bit: Runtime or static bit of the bitmap which was updated
+* @param        WasSet: Value of the bit before the update
 *
-* @return	XAIE_OK on success.
+* @return       None.
 *
-* @note		Internal only.
+* @note         Internal only. Every module owns a 16 bit aligned field of the
+*		bitmap, so the channel of a bit is its index modulo 16.
 *
 *******************************************************************************/
-AieRC _XAie_RscMgrRequestApi_CheckArgs(XAie_DevInst *DevInst, u32 NumReq,
-		XAie_UserRscReq *RscReq, u32 UserRscNum, XAie_UserRsc *Rscs)
+void _XAie_RscMgr_TrackBcChannelBit(XAie_DevInst *DevInst, u8 TileType,
+		u32 Bit, u8 WasSet)
 {
-	u32 TotalReq = 0;
-
-	if((DevInst == XAIE_NULL) || (Rscs == NULL) || (RscReq == NULL) ||
-		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
-		XAIE_ERROR("Invalid pointer\n");
-		return XAIE_INVALID_ARGS;
-	}
-
-	/* Check validity of UserRscNum */
-	for(u32 j = 0; j < NumReq; j++)
-		TotalReq += RscReq[j].NumRscPerTile;
-	if(UserRscNum != TotalReq) {
-		XAIE_ERROR("Invalid UserRscNum: %d\n", UserRscNum);
-		return XAIE_INVALID_ARGS;
+	XAie_ResourceManager *RscMap = &DevInst->RscMapping[TileType];
+	u32 Channel = Bit % XAIE_NUM_BROADCAST_CHANNELS;
+	u8 IsSet;
+
+	IsSet = (CheckBit(RscMap->Bitmaps[XAIE_BCAST_CHANNEL_RSC], Bit) != 0U) ?
+		1U : 0U;
+	if(IsSet == WasSet) {
+		return;
 	}
 
-	/* Check validity of all tiles passed to this API */
-	for(u32 j = 0; j < NumReq; j++) {
-		if(RscReq[j].Loc.Row >= DevInst->NumRows ||
-			RscReq[j].Loc.Col >= DevInst->NumCols) {
-			XAIE_ERROR("Invalid Loc Col:%d Row:%d\n",
-					RscReq[j].Loc.Col, RscReq[j].Loc.Row);
-			return XAIE_INVALID_ARGS;
-		}
+	if(IsSet) {
+		RscMap->BcChannelUsers[Channel]++;
+	} else {
+		RscMap->BcChannelUsers[Channel]--;
 	}
-
-	return XAIE_OK;
 }
 
 /*****************************************************************************/
 /**
-* This API checks the validity of all the arugments passed to the resource
-* manager APIs.
+* This API returns the broadcast channels which are allocated, statically or
+* at runtime, on at least one module of the partition.
 *
-* @param	DevInst: Device Instance
-* @param	RscNum: Size of Rscs array.
-* @param	Rscs: Contains parameters to return reource such as counter ids,
-* 		      Location, Module, resource type.
-* 		      It needs to be allocated from user application.
-* @param	RscType: Resource type
+* @param        DevInst: Device Instance
 *
-* @return	XAIE_OK on success.
+* @return       Bitmask of the channels in use somewhere in the partition.
 *
-* @note		Internal only.
+* @note         Internal only. A channel not in the mask is free on every
+*		module, so it is common to any set of tiles. The counts of the
+*		tile types not locked by the caller may change concurrently,
+*		which only affects tiles outside of the caller's request.
 *
 *******************************************************************************/
-AieRC _XAie_RscMgrRscApi_CheckArgs(XAie_DevInst *DevInst, u32 RscNum,
-		XAie_UserRsc *Rscs, XAie_RscType RscType)
+u32 _XAie_RscMgr_GetBcChannelsInUse(XAie_DevInst *DevInst)
 {
-	AieRC RC;
+	u32 InUse = 0U;
 
-	if((DevInst == XAIE_NULL) || (Rscs == NULL) ||
-		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
-		XAIE_ERROR("Invalid pointer\n");
-		return XAIE_INVALID_ARGS;
-	}
+	for(u8 i = 0U; i < XAIEGBL_TILE_TYPE_MAX; i++) {
+		const u32 *Users;
 
-	/* Check validity of all tiles passed to this API */
-	RC = _XAie_CheckLocsValidity(DevInst, RscNum, Rscs);
-	if(RC != XAIE_OK)
-		return RC;
+		/* Shim NoC tiles share the bitmaps of shim PL tiles */
+		if(i == XAIEGBL_TILE_TYPE_SHIMNOC)
+			continue;
 
-	for(u32 i = 0U; i < RscNum; i++) {
-		RC = _XAie_CheckModule(DevInst, Rscs[i].Loc, Rscs[i].Mod);
-		if(RC != XAIE_OK) {
-			return RC;
-		}
-		if(Rscs[i].RscType != RscType) {
-			XAIE_ERROR("Resource type mismatch\n");
-			return XAIE_ERR;
+		Users = DevInst->RscMapping[i].BcChannelUsers;
+		for(u32 c = 0U; c < XAIE_NUM_BROADCAST_CHANNELS; c++) {
+			if(Users[c] != 0U) {
+				InUse |= 1U << c;
+			}
 		}
 	}
 
-	return XAIE_OK;
+	return InUse;
 }
 
 /*****************************************************************************/
 /**
-* This API checks the validity of modules in all resources requested by the
-* user.
+* This API returns the bit of a tile type in a mask of tile types, for the
+* resource manager locks.
 *
-* @param	DevInst: Device Instance
-* @param	NumReq: Number of requests
-* @param	RscReq: Contains parameters related to resource request.
-* 			tile loc, module, no. of resource request per tile.
+* @param        TileType: Tile type
 *
-* @return	XAIE_OK on success.
+* @return       Bit of the tile type.
 *
-* @note		Internal only.
+* @note         Internal only. Shim NoC tiles map to the bit of shim PL tiles
+*		as they share their bitmaps.
 *
 *******************************************************************************/
-AieRC _XAie_RscMgr_CheckModforReqs(XAie_DevInst *DevInst, u32 NumReq,
-		XAie_UserRscReq *RscReq)
+static inline u32 _XAie_RscMgr_TileTypeBit(u8 TileType)
 {
-	AieRC RC;
-
-	/* check for module and tiletype combination */
-	for(u32 i = 0U; i < NumReq; i++) {
-		RC = _XAie_CheckModule(DevInst, RscReq[i].Loc, RscReq[i].Mod);
-		if(RC != XAIE_OK) {
-			return RC;
-		}
+	if(TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+		TileType = XAIEGBL_TILE_TYPE_SHIMPL;
 	}
 
-	return XAIE_OK;
+	return 1U << TileType;
 }
 
 /*****************************************************************************/
 /**
-* This API gets PerfMod from device instance, TileType and Module
+* This API returns the mask of the tile types of a list of resources.
 *
-* @param	DevInst: Device Instance
-* @param	TileType: Type of tile
-* @param	Mod: Module - MEM, CORE or PL.
+* @param        DevInst: Device Instance
+* @param        RscNum: Size of Rscs array.
+* @param        Rscs: Resources
 *
-* @return	Pointer to performance counter module
+* @return       Mask of tile types, as expected by _XAie_RscMgr_Lock().
 *
-* @note		Internal only.
+* @note         Internal only.
 *
 *******************************************************************************/
-static const XAie_PerfMod *_XAie_GetPerfMod(XAie_DevInst *DevInst, u8 TileType,
-		XAie_ModuleType Mod)
+u32 _XAie_RscMgr_GetTileTypes(XAie_DevInst *DevInst, u32 RscNum,
+		const XAie_UserRsc *Rscs)
 {
-	if(Mod == XAIE_PL_MOD)
-		return &DevInst->DevProp.DevMod[TileType].PerfMod[0U];
-	else
-		return &DevInst->DevProp.DevMod[TileType].PerfMod[Mod];
+	u32 TileTypes = 0U;
+
+	for(u32 i = 0U; i < RscNum; i++) {
+		TileTypes |= _XAie_RscMgr_TileTypeBit(
+			_XAie_DevGetTTypefromLoc(DevInst, Rscs[i].Loc));
+	}
+
+	return TileTypes;
 }
 
 /*****************************************************************************/
 /**
-* This API gets EventMod from device instance, TileType and Module
+* This API returns the broadcast channels which have to be checked tile by
+* tile to find a channel common to a set of tiles with a policy.
 *
-* @param	DevInst: Device Instance
-* @param	TileType: Type of tile
-* @param	Mod: Module - MEM, CORE or PL.
+* @param        DevInst: Device Instance
+* @param        Policy: Allocation policy, XAie_RscPolicy
 *
-* @return	Pointer to performance counter module
+* @return       Bitmask of the channels to check.
 *
-* @note		Internal only.
+* @note         Internal only. The lowest channel unused across the partition
+*		is common to all the tiles, so only the channels below it need
+*		to be checked per tile. Likewise for the channels above the
+*		highest unused channel when the highest channel is wanted.
 *
 *******************************************************************************/
-static const XAie_EvntMod *_XAie_GetEventMod(XAie_DevInst *DevInst, u8 TileType,
-		XAie_ModuleType Mod)
+u32 _XAie_RscMgr_GetBcCheckMask(XAie_DevInst *DevInst, u8 Policy)
 {
-	if(Mod == XAIE_PL_MOD)
-		return &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
-	else
-		return &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+	u32 Mask = XAIE_RSC_WORD_MASK(XAIE_NUM_BROADCAST_CHANNELS);
+	u32 Free = ~_XAie_RscMgr_GetBcChannelsInUse(DevInst) & Mask;
+
+	if(Free == 0U) {
+		return Mask;
+	} else if(Policy == XAIE_RSC_POLICY_HIGHEST) {
+		return Mask & ~((2U << _XAie_GetLastSetBit32(Free)) - 1U);
+	}
+
+	return (Free & (~Free + 1U)) - 1U;
 }
 
 /*****************************************************************************/
 /**
-* This API returns the max resource value for a give location, resource type and
-* module.
+* This API checks the arguments of a resource region.
 *
-* @param	DevInst: Device Instance
-* @param	RscType: Resource type
-* @param	TileType: Type of tile
-* @param	Mod: Module - MEM, CORE or PL.
+* @param        DevInst: Device Instance
+* @param        Region: Resource region
 *
-* @return	Max number of resources.
+* @return       XAIE_OK if the region is within the partition and selects
+*		modules, XAIE_INVALID_ARGS otherwise.
 *
-* @note		Internal only.
+* @note         Internal only.
 *
 *******************************************************************************/
-u32 _XAie_RscMgr_GetMaxRscVal(XAie_DevInst *DevInst, XAie_RscType RscType,
-		XAie_LocType Loc, XAie_ModuleType Mod)
+AieRC _XAie_RscMgr_CheckRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region)
 {
-	switch(RscType) {
-	case XAIE_PERFCNT_RSC:
-	{
-		const XAie_PerfMod *PerfMod;
-		u8 TileType;
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-		PerfMod = _XAie_GetPerfMod(DevInst, TileType, Mod);
-		return PerfMod->MaxCounterVal;
+	if(Region == NULL) {
+		XAIE_ERROR("Invalid resource region\n");
+		return XAIE_INVALID_ARGS;
 	}
-	case XAIE_USER_EVENTS_RSC:
-	{
-		const XAie_EvntMod *EventMod;
-		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
-		return EventMod->NumUserEvents;
+	if((Region->NumCols == 0U) || (Region->NumRows == 0U) ||
+		((u32)Region->Start.Col + Region->NumCols > DevInst->NumCols) ||
+		((u32)Region->Start.Row + Region->NumRows > DevInst->NumRows)) {
+		XAIE_ERROR("Resource region out of the partition\n");
+		return XAIE_INVALID_ARGS;
 	}
-	case XAIE_PC_EVENTS_RSC:
-	{
-		const XAie_EvntMod *EventMod;
-		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
-		return EventMod->NumPCEvents;
-	}
-	case XAIE_TRACE_CTRL_RSC:
-	{
-		return XAIE_TRACE_CTRL_RSCS_PER_MOD;
+	if(((Region->ModMask & XAIE_RSC_REGION_ALL_MODS) == 0U) ||
+		((Region->ModMask & ~XAIE_RSC_REGION_ALL_MODS) != 0U)) {
+		XAIE_ERROR("Invalid module mask of resource region\n");
+		return XAIE_INVALID_ARGS;
 	}
-	case XAIE_SS_EVENT_PORTS_RSC:
-	{
-		const XAie_EvntMod *EventMod;
-		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
-		return EventMod->NumStrmPortSelectIds;
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the modules of a tile which are part of a resource region,
+* the modules of the tile type selected by the module mask of the region.
+*
+* @param        DevInst: Device Instance
+* @param        Region: Resource region
+* @param        Loc: Location of a tile of the region
+* @param        Mods: Returns the modules, XAIE_RSC_REGION_MAX_TILE_MODS at
+*		most
+*
+* @return       Number of modules returned, 0 for a gated tile.
+*
+* @note         Internal only. The core module comes first, as in the lists
+*		of the broadcast APIs.
+*
+*******************************************************************************/
+u8 _XAie_RscMgr_GetRegionTileMods(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, XAie_LocType Loc,
+		XAie_ModuleType *Mods)
+{
+	u8 NumMods = 0U;
+
+	if(_XAie_PmIsTileRequested(DevInst, Loc) == XAIE_DISABLE) {
+		return 0U;
 	}
-	case XAIE_GROUP_EVENTS_RSC:
-	{
-		const XAie_EvntMod *EventMod;
-		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
-		return EventMod->NumGroupEvents;
+	switch(_XAie_DevGetTTypefromLoc(DevInst, Loc)) {
+	case XAIEGBL_TILE_TYPE_AIETILE:
+		if((Region->ModMask & XAIE_RSC_REGION_MOD(XAIE_CORE_MOD)) != 0U)
+			Mods[NumMods++] = XAIE_CORE_MOD;
+		if((Region->ModMask & XAIE_RSC_REGION_MOD(XAIE_MEM_MOD)) != 0U)
+			Mods[NumMods++] = XAIE_MEM_MOD;
+		break;
+	case XAIEGBL_TILE_TYPE_MEMTILE:
+		if((Region->ModMask & XAIE_RSC_REGION_MOD(XAIE_MEM_MOD)) != 0U)
+			Mods[NumMods++] = XAIE_MEM_MOD;
+		break;
+	case XAIEGBL_TILE_TYPE_SHIMNOC:
+	case XAIEGBL_TILE_TYPE_SHIMPL:
+		if((Region->ModMask & XAIE_RSC_REGION_MOD(XAIE_PL_MOD)) != 0U)
+			Mods[NumMods++] = XAIE_PL_MOD;
+		break;
+	default:
+		break;
 	}
-	case XAIE_COMBO_EVENTS_RSC:
-	{
-		return XAIE_COMBO_EVENTS_PER_MOD;
+
+	return NumMods;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the mask of the tile types of a resource region.
+*
+* @param        DevInst: Device Instance
+* @param        Region: Resource region, checked by the caller
+*
+* @return       Mask of tile types, as expected by _XAie_RscMgr_Lock().
+*
+* @note         Internal only. The tile type only depends on the row.
+*
+*******************************************************************************/
+u32 _XAie_RscMgr_GetRegionTileTypes(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region)
+{
+	u32 TileTypes = 0U;
+
+	for(u8 r = 0U; r < Region->NumRows; r++) {
+		TileTypes |= _XAie_RscMgr_TileTypeBit(_XAie_DevGetTTypefromLoc(
+				DevInst, XAie_TileLoc(Region->Start.Col,
+					Region->Start.Row + r)));
 	}
-	case XAIE_BCAST_CHANNEL_RSC:
-		return XAIE_NUM_BROADCAST_CHANNELS;
-	default:
-		return 0U;
+
+	return TileTypes;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the number of modules of a resource region whose resources
+* are managed, stopping at the first ones found.
+*
+* @param        DevInst: Device Instance
+* @param        Region: Resource region, checked by the caller
+*
+* @return       0 if no ungated tile of the region has a module of the mask.
+*
+* @note         Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_RscMgr_RegionHasMods(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region)
+{
+	XAie_ModuleType Mods[XAIE_RSC_REGION_MAX_TILE_MODS];
+
+	for(u8 c = 0U; c < Region->NumCols; c++) {
+		for(u8 r = 0U; r < Region->NumRows; r++) {
+			XAie_LocType Loc = XAie_TileLoc(Region->Start.Col + c,
+					Region->Start.Row + r);
+			u8 NumMods;
+
+			NumMods = _XAie_RscMgr_GetRegionTileMods(DevInst,
+					Region, Loc, Mods);
+			if(NumMods != 0U) {
+				return NumMods;
+			}
+		}
 	}
+
+	return 0U;
 }
 
 /*****************************************************************************/
 /**
-* This API returns the bitmap offsets and max resource values for a given
-* resource type, location and module.
+* This API gets which broadcast channels of a mask are busy on any module of a
+* resource region, reading the bitmaps of the modules in place.
 *
-* @param	DevInst: Device Instance
-* @param	RscType: Resource type
-* @param	TileType: Type of tile
-* @param	Mod: Module - MEM, CORE or PL.
-* @param	Offsets: Pointers to internal data structure to store the
-*		offsets
+* @param        DevInst: Device Instance
+* @param        Region: Resource region, checked by the caller
+* @param        StaticAllocCheckFlag: 1 - To check static and runtime bitmap
+*                                     0 - To check runtime bitmap only
+* @param        ChannelMask: Channels to check
 *
-* @return	Max number of resources.
+* @return       Bitmask of the channels of ChannelMask busy on any module.
 *
-* @note		Internal only.
+* @note         Internal only. The caller locks the bitmaps of the tile types
+*		of the region. The tiles are no longer visited once all the
+*		channels of ChannelMask are found busy.
 *
 *******************************************************************************/
-void _XAie_RscMgr_GetBitmapOffsets(XAie_DevInst *DevInst, XAie_RscType RscType,
-		XAie_LocType Loc, XAie_ModuleType Mod,
-		XAie_BitmapOffsets *Offsets)
+static u32 _XAie_RscMgr_GetRegionBcStatus(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u8 StaticAllocCheckFlag,
+		u32 ChannelMask)
 {
-	u32 BitmapOffset = 0U, StartBit, StaticBitmapOffset;
-	u32 MaxRscVal;
-	u8 TileType;
+	XAie_ModuleType Mods[XAIE_RSC_REGION_MAX_TILE_MODS];
+	u32 Status = 0U;
+
+	for(u8 c = 0U; (c < Region->NumCols) &&
+			((Status & ChannelMask) != ChannelMask); c++) {
+		for(u8 r = 0U; r < Region->NumRows; r++) {
+			XAie_LocType Loc = XAie_TileLoc(Region->Start.Col + c,
+					Region->Start.Row + r);
+			u8 TileType, NumMods;
+			u32 *Bitmap;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	MaxRscVal = _XAie_RscMgr_GetMaxRscVal(DevInst, RscType, Loc, Mod);
-	if(Mod == XAIE_CORE_MOD)
-		BitmapOffset = _XAie_GetCoreBitmapOffset(DevInst,
-				_XAie_RscMgr_GetMaxRscVal(DevInst, RscType, Loc,
-					XAIE_MEM_MOD));
+			NumMods = _XAie_RscMgr_GetRegionTileMods(DevInst,
+					Region, Loc, Mods);
+			if(NumMods == 0U) {
+				continue;
+			}
 
-	StartBit = _XAie_GetStartBit(DevInst, Loc, MaxRscVal) + BitmapOffset;
-	StaticBitmapOffset = MaxRscVal * DevInst->NumCols *
-		_XAie_GetNumRows(DevInst, TileType);
+			TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+			Bitmap = DevInst->RscMapping[TileType].
+				Bitmaps[XAIE_BCAST_CHANNEL_RSC];
+			for(u8 m = 0U; m < NumMods; m++) {
+				XAie_BitmapOffsets Offsets;
+
+				_XAie_RscMgr_GetBitmapOffsets(DevInst,
+						XAIE_BCAST_CHANNEL_RSC, Loc,
+						Mods[m], &Offsets);
+				Status |= _XAie_GetBitmapWord(Bitmap,
+						Offsets.StartBit,
+						XAIE_NUM_BROADCAST_CHANNELS);
+				if(StaticAllocCheckFlag) {
+					Status |= _XAie_GetBitmapWord(Bitmap,
+						Offsets.StartBit +
+						Offsets.StaticBitmapOffset,
+						XAIE_NUM_BROADCAST_CHANNELS);
+				}
+			}
+		}
+	}
 
-	Offsets->StaticBitmapOffset = StaticBitmapOffset;
-	Offsets->BitmapOffset = BitmapOffset;
-	Offsets->StartBit = StartBit;
-	Offsets->MaxRscVal = MaxRscVal;
+	return Status & ChannelMask;
 }
 
 /*****************************************************************************/
 /**
-* This API shall be used to request a resource from the backend based on the
-* resource type.
+* This API sets or clears a broadcast channel in the bitmaps of the modules of
+* a resource region. Clearing frees the channel from the runtime and static
+* pools, as a release does.
+*
+* @param        DevInst: Device Instance
+* @param        Region: Resource region, checked by the caller
+* @param        Channel: Broadcast channel
+* @param        Set: XAIE_ENABLE to set, XAIE_DISABLE to clear
+*
+* @return       None.
+*
+* @note         Internal only. The caller locks the bitmaps of the tile types
+*		of the region.
+*
+*******************************************************************************/
+static void _XAie_RscMgr_UpdateRegionBc(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 Channel, u8 Set)
+{
+	XAie_ModuleType Mods[XAIE_RSC_REGION_MAX_TILE_MODS];
+
+	for(u8 c = 0U; c < Region->NumCols; c++) {
+		for(u8 r = 0U; r < Region->NumRows; r++) {
+			XAie_LocType Loc = XAie_TileLoc(Region->Start.Col + c,
+					Region->Start.Row + r);
+			u8 TileType, NumMods;
+			u32 *Bitmap;
+
+			NumMods = _XAie_RscMgr_GetRegionTileMods(DevInst,
+					Region, Loc, Mods);
+			if(NumMods == 0U) {
+				continue;
+			}
+
+			TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+			Bitmap = DevInst->RscMapping[TileType].
+				Bitmaps[XAIE_BCAST_CHANNEL_RSC];
+			for(u8 m = 0U; m < NumMods; m++) {
+				XAie_BitmapOffsets Offsets;
+				u32 RtBit, StBit;
+				u8 RtWasSet, StWasSet;
+
+				_XAie_RscMgr_GetBitmapOffsets(DevInst,
+						XAIE_BCAST_CHANNEL_RSC, Loc,
+						Mods[m], &Offsets);
+				RtBit = Offsets.StartBit + Channel;
+				RtWasSet = (CheckBit(Bitmap, RtBit) != 0U) ?
+					1U : 0U;
+				if(Set == XAIE_ENABLE) {
+					_XAie_SetBitInBitmap(Bitmap, RtBit, 1U);
+					_XAie_RscMgr_TrackBcChannelBit(DevInst,
+						TileType, RtBit, RtWasSet);
+					continue;
+				}
+
+				StBit = RtBit + Offsets.StaticBitmapOffset;
+				StWasSet = (CheckBit(Bitmap, StBit) != 0U) ?
+					1U : 0U;
+				_XAie_ClrBitInBitmap(Bitmap, RtBit, 1U);
+				_XAie_ClrBitInBitmap(Bitmap, StBit, 1U);
+				_XAie_RscMgr_TrackBcChannelBit(DevInst,
+						TileType, RtBit, RtWasSet);
+				_XAie_RscMgr_TrackBcChannelBit(DevInst,
+						TileType, StBit, StWasSet);
+			}
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API grants a broadcast channel common to the modules of a resource
+* region, reading and marking the bitmaps of the modules in place, without a
+* list of the modules.
+*
+* @param        DevInst: Device Instance
+* @param        Region: Resource region, checked by the caller
+* @param        BcId: Channel to grant if Specific is set. Returns the
+*		granted channel otherwise.
+* @param        Specific: XAIE_ENABLE to grant the channel of BcId only
+*
+* @return       XAIE_OK on success, XAIE_INVALID_ARGS if the region has no
+*		module and XAIE_ERR if no channel is free.
+*
+* @note         Internal only. As with the lists of modules, a specific
+*		channel may be granted if it was allocated statically.
+*
+*******************************************************************************/
+AieRC _XAie_RscMgr_RequestBcRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 *BcId, u8 Specific)
+{
+	u32 TileTypes, Status = 0U, ChannelMask, Free;
+	AieRC RC = XAIE_OK;
+	u8 Policy;
+
+	if(_XAie_RscMgr_RegionHasMods(DevInst, Region) == 0U) {
+		XAIE_ERROR("No ungated module in resource region\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileTypes = _XAie_RscMgr_GetRegionTileTypes(DevInst, Region);
+	Policy = DevInst->RscMapping[_XAie_DevGetTTypefromLoc(DevInst,
+			Region->Start)].Policies[XAIE_BCAST_CHANNEL_RSC];
+
+	_XAie_RscMgr_Lock(DevInst, XAIE_BCAST_CHANNEL_RSC, TileTypes);
+	if(Specific == XAIE_ENABLE) {
+		ChannelMask = 1U << *BcId;
+		if((_XAie_RscMgr_GetBcChannelsInUse(DevInst) & ChannelMask) !=
+				0U) {
+			Status = _XAie_RscMgr_GetRegionBcStatus(DevInst, Region,
+					XAIE_DISABLE, ChannelMask);
+		}
+		if(Status != 0U) {
+			RC = XAIE_ERR;
+		}
+	} else {
+		ChannelMask = _XAie_RscMgr_GetBcCheckMask(DevInst, Policy);
+		if(ChannelMask != 0U) {
+			Status = _XAie_RscMgr_GetRegionBcStatus(DevInst, Region,
+					XAIE_ENABLE, ChannelMask);
+		}
+
+		Free = ~Status & XAIE_RSC_WORD_MASK(XAIE_NUM_BROADCAST_CHANNELS);
+		if(Free == 0U) {
+			RC = XAIE_ERR;
+		} else if(Policy == XAIE_RSC_POLICY_HIGHEST) {
+			*BcId = _XAie_GetLastSetBit32(Free);
+		} else {
+			*BcId = _XAie_CountTrailingZeros32(Free);
+		}
+	}
+
+	if(RC == XAIE_OK) {
+		_XAie_RscMgr_UpdateRegionBc(DevInst, Region, *BcId,
+				XAIE_ENABLE);
+	}
+	_XAie_RscMgr_Unlock(DevInst, XAIE_BCAST_CHANNEL_RSC, TileTypes);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API frees a broadcast channel of the modules of a resource region from
+* the runtime and static pools.
+*
+* @param        DevInst: Device Instance
+* @param        Region: Resource region, checked by the caller
+* @param        BcId: Broadcast channel
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+*******************************************************************************/
+void _XAie_RscMgr_ReleaseBcRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 BcId)
+{
+	u32 TileTypes = _XAie_RscMgr_GetRegionTileTypes(DevInst, Region);
+
+	_XAie_RscMgr_Lock(DevInst, XAIE_BCAST_CHANNEL_RSC, TileTypes);
+	_XAie_RscMgr_UpdateRegionBc(DevInst, Region, BcId, XAIE_DISABLE);
+	_XAie_RscMgr_Unlock(DevInst, XAIE_BCAST_CHANNEL_RSC, TileTypes);
+}
+
+/*****************************************************************************/
+/**
+* This API returns the mask of the tile types of a list of resource requests.
+*
+* @param        DevInst: Device Instance
+* @param        NumReq: Number of requests
+* @param        RscReq: Resource requests
+*
+* @return       Mask of tile types, as expected by _XAie_RscMgr_Lock().
+*
+* @note         Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_RscMgr_GetReqTileTypes(XAie_DevInst *DevInst, u32 NumReq,
+		const XAie_UserRscReq *RscReq)
+{
+	u32 TileTypes = 0U;
+
+	for(u32 i = 0U; i < NumReq; i++) {
+		TileTypes |= _XAie_RscMgr_TileTypeBit(
+			_XAie_DevGetTTypefromLoc(DevInst,
+				RscReq[i].Loc));
+	}
+
+	return TileTypes;
+}
+
+/*****************************************************************************/
+/**
+* This API locks the bitmaps of a resource type for a set of tile types, so
+* requests of other resource types, or on other tile types, run in parallel.
+*
+* @param        DevInst: Device Instance
+* @param        RscType: Resource type
+* @param        TileTypes: Mask of tile types, from _XAie_RscMgr_GetTileTypes()
+*
+* @return       None.
+*
+* @note         Internal only. The locks are taken in increasing tile type
+*		order. No lock is taken on baremetal.
+*
+*******************************************************************************/
+void _XAie_RscMgr_Lock(XAie_DevInst *DevInst, XAie_RscType RscType,
+		u32 TileTypes)
+{
+#ifndef __AIEBAREMETAL__
+	for(u8 i = 0U; i < XAIEGBL_TILE_TYPE_MAX; i++) {
+		if((TileTypes & (1U << i)) != 0U) {
+			pthread_mutex_t *Lock =
+				&DevInst->RscMapping[i].Locks->Lock[RscType];
+
+			/* A process sharing the state died holding the lock */
+			if(pthread_mutex_lock(Lock) == EOWNERDEAD)
+				pthread_mutex_consistent(Lock);
+		}
+	}
+#else
+	(void)DevInst;
+	(void)RscType;
+	(void)TileTypes;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* This API unlocks the bitmaps locked by _XAie_RscMgr_Lock().
+*
+* @param        DevInst: Device Instance
+* @param        RscType: Resource type
+* @param        TileTypes: Mask of tile types passed to _XAie_RscMgr_Lock()
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+*******************************************************************************/
+void _XAie_RscMgr_Unlock(XAie_DevInst *DevInst, XAie_RscType RscType,
+		u32 TileTypes)
+{
+#ifndef __AIEBAREMETAL__
+	for(u8 i = XAIEGBL_TILE_TYPE_MAX; i > 0U; i--) {
+		if((TileTypes & (1U << (i - 1U))) != 0U) {
+			pthread_mutex_unlock(&DevInst->RscMapping[i - 1U].
+					Locks->Lock[RscType]);
+		}
+	}
+#else
+	(void)DevInst;
+	(void)RscType;
+	(void)TileTypes;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* This API locks the bitmaps of all the resource types of all the tile types.
+*
+* @param        DevInst: Device Instance
+*
+* @return       None.
+*
+* @note         Internal only. Used by the operations on all the bitmaps.
+*
+*******************************************************************************/
+static void _XAie_RscMgr_LockAll(XAie_DevInst *DevInst)
+{
+	for(u8 RscType = 0U; RscType < XAIE_MAX_RSC; RscType++) {
+		_XAie_RscMgr_Lock(DevInst, (XAie_RscType)RscType,
+				XAIE_RSC_MGR_ALL_TILE_TYPES);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API unlocks the bitmaps locked by _XAie_RscMgr_LockAll().
+*
+* @param        DevInst: Device Instance
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+*******************************************************************************/
+static void _XAie_RscMgr_UnlockAll(XAie_DevInst *DevInst)
+{
+	for(u8 RscType = XAIE_MAX_RSC; RscType > 0U; RscType--) {
+		_XAie_RscMgr_Unlock(DevInst, (XAie_RscType)(RscType - 1U),
+				XAIE_RSC_MGR_ALL_TILE_TYPES);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API checks the validity of all the arugments passed to the resource
+* manager request APIs.
 *
 * @param	DevInst: Device Instance
 * @param	RscReq: Contains parameters related to resource request.
@@ -676,109 +1269,1294 @@ void _XAie_RscMgr_GetBitmapOffsets(XAie_DevInst *DevInst, XAie_RscType RscType,
 * @param	Rscs: Contains parameters to return reource such as counter ids,
 * 		      Location, Module, resource type.
 * 		      It needs to be allocated from user application.
-* @param	RscType: Resource type
 *
 * @return	XAIE_OK on success.
 *
-* @note		If any request out of pool requests fails, it returns failure.
-* 		The pool request allocation checks static as well as runtime
-* 		bitmaps for availibity and marks runtime bitmap for any
-* 		granted resource. Internal only.
+* @note		Internal only.
 *
 *******************************************************************************/
-AieRC _XAie_RscMgr_RequestRsc(XAie_DevInst *DevInst, u32 NumReq,
-		XAie_UserRscReq *RscReq, XAie_UserRsc *Rscs,
-		XAie_RscType RscType)
+AieRC _XAie_RscMgrRequestApi_CheckArgs(XAie_DevInst *DevInst, u32 NumReq,
+		XAie_UserRscReq *RscReq, u32 UserRscNum, XAie_UserRsc *Rscs)
 {
-	AieRC RC;
-	u32 UserRscIndex = 0U;
-
-	for(u32 i = 0U; i < NumReq; i++) {
-		XAie_BackendTilesRsc TilesRsc = {0};
-		XAie_BitmapOffsets Offsets;
-		u8 TileType;
+	u32 TotalReq = 0;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, RscReq[i].Loc);
-		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
-				RscReq[i].Loc, RscReq[i].Mod, &Offsets);
+	if((DevInst == XAIE_NULL) || (Rscs == NULL) || (RscReq == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
 
-		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
-		TilesRsc.RscType = RscType;
-		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
-		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
-		TilesRsc.StartBit = Offsets.StartBit;
-		TilesRsc.StaticBitmapOffset = Offsets.StaticBitmapOffset;
-		TilesRsc.Loc = RscReq[i].Loc;
-		TilesRsc.Mod = RscReq[i].Mod;
-		TilesRsc.NumRscPerTile = RscReq[i].NumRscPerTile;
-		TilesRsc.Rscs = &Rscs[UserRscIndex];
+	/* Check validity of UserRscNum */
+	for(u32 j = 0; j < NumReq; j++)
+		TotalReq += RscReq[j].NumRscPerTile;
+	if(UserRscNum != TotalReq) {
+		XAIE_ERROR("Invalid UserRscNum: %d\n", UserRscNum);
+		return XAIE_INVALID_ARGS;
+	}
 
-		RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_REQUEST_RESOURCE,
-				(void *)&TilesRsc);
+	/* Check validity of all tiles passed to this API */
+	for(u32 j = 0; j < NumReq; j++) {
+		if(RscReq[j].Loc.Row >= DevInst->NumRows ||
+			RscReq[j].Loc.Col >= DevInst->NumCols) {
+			XAIE_ERROR("Invalid Loc Col:%d Row:%d\n",
+					RscReq[j].Loc.Col, RscReq[j].Loc.Row);
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API checks the validity of all the arugments passed to the resource
+* manager APIs.
+*
+* @param	DevInst: Device Instance
+* @param	RscNum: Size of Rscs array.
+* @param	Rscs: Contains parameters to return reource such as counter ids,
+* 		      Location, Module, resource type.
+* 		      It needs to be allocated from user application.
+* @param	RscType: Resource type
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_RscMgrRscApi_CheckArgs(XAie_DevInst *DevInst, u32 RscNum,
+		XAie_UserRsc *Rscs, XAie_RscType RscType)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Rscs == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Check validity of all tiles passed to this API */
+	RC = _XAie_CheckLocsValidity(DevInst, RscNum, Rscs);
+	if(RC != XAIE_OK)
+		return RC;
+
+	for(u32 i = 0U; i < RscNum; i++) {
+		RC = _XAie_CheckModule(DevInst, Rscs[i].Loc, Rscs[i].Mod);
 		if(RC != XAIE_OK) {
-			/* Clear resource marking for all previous requests */
-			_XAie_RscMgr_FreeRscs(DevInst, UserRscIndex, Rscs,
-					RscType);
-			XAIE_WARN("Unable to request resources. RscType: %d\n",
-					RscType);
+			return RC;
+		}
+		if(Rscs[i].RscType != RscType) {
+			XAIE_ERROR("Resource type mismatch\n");
+			return XAIE_ERR;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API checks the validity of modules in all resources requested by the
+* user.
+*
+* @param	DevInst: Device Instance
+* @param	NumReq: Number of requests
+* @param	RscReq: Contains parameters related to resource request.
+* 			tile loc, module, no. of resource request per tile.
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_RscMgr_CheckModforReqs(XAie_DevInst *DevInst, u32 NumReq,
+		XAie_UserRscReq *RscReq)
+{
+	AieRC RC;
+
+	/* check for module and tiletype combination */
+	for(u32 i = 0U; i < NumReq; i++) {
+		RC = _XAie_CheckModule(DevInst, RscReq[i].Loc, RscReq[i].Mod);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API gets PerfMod from device instance, TileType and Module
+*
+* @param	DevInst: Device Instance
+* @param	TileType: Type of tile
+* @param	Mod: Module - MEM, CORE or PL.
+*
+* @return	Pointer to performance counter module
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static const XAie_PerfMod *_XAie_GetPerfMod(XAie_DevInst *DevInst, u8 TileType,
+		XAie_ModuleType Mod)
+{
+	if(Mod == XAIE_PL_MOD)
+		return &DevInst->DevProp.DevMod[TileType].PerfMod[0U];
+	else
+		return &DevInst->DevProp.DevMod[TileType].PerfMod[Mod];
+}
+
+/*****************************************************************************/
+/**
+* This API gets EventMod from device instance, TileType and Module
+*
+* @param	DevInst: Device Instance
+* @param	TileType: Type of tile
+* @param	Mod: Module - MEM, CORE or PL.
+*
+* @return	Pointer to performance counter module
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static const XAie_EvntMod *_XAie_GetEventMod(XAie_DevInst *DevInst, u8 TileType,
+		XAie_ModuleType Mod)
+{
+	if(Mod == XAIE_PL_MOD)
+		return &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+	else
+		return &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+}
+
+/*****************************************************************************/
+/**
+* This API returns the max resource value for a give location, resource type and
+* module.
+*
+* @param	DevInst: Device Instance
+* @param	RscType: Resource type
+* @param	TileType: Type of tile
+* @param	Mod: Module - MEM, CORE or PL.
+*
+* @return	Max number of resources.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+u32 _XAie_RscMgr_GetMaxRscVal(XAie_DevInst *DevInst, XAie_RscType RscType,
+		XAie_LocType Loc, XAie_ModuleType Mod)
+{
+	switch(RscType) {
+	case XAIE_PERFCNT_RSC:
+	{
+		const XAie_PerfMod *PerfMod;
+		u8 TileType;
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+		PerfMod = _XAie_GetPerfMod(DevInst, TileType, Mod);
+		return PerfMod->MaxCounterVal;
+	}
+	case XAIE_USER_EVENTS_RSC:
+	{
+		const XAie_EvntMod *EventMod;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
+		return EventMod->NumUserEvents;
+	}
+	case XAIE_PC_EVENTS_RSC:
+	{
+		const XAie_EvntMod *EventMod;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
+		return EventMod->NumPCEvents;
+	}
+	case XAIE_TRACE_CTRL_RSC:
+	{
+		return XAIE_TRACE_CTRL_RSCS_PER_MOD;
+	}
+	case XAIE_SS_EVENT_PORTS_RSC:
+	{
+		const XAie_EvntMod *EventMod;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
+		return EventMod->NumStrmPortSelectIds;
+	}
+	case XAIE_GROUP_EVENTS_RSC:
+	{
+		const XAie_EvntMod *EventMod;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
+		return EventMod->NumGroupEvents;
+	}
+	case XAIE_COMBO_EVENTS_RSC:
+	{
+		return XAIE_COMBO_EVENTS_PER_MOD;
+	}
+	case XAIE_BCAST_CHANNEL_RSC:
+		return XAIE_NUM_BROADCAST_CHANNELS;
+	default:
+		return 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API returns the bitmap offsets and max resource values for a given
+* resource type, location and module.
+*
+* @param	DevInst: Device Instance
+* @param	RscType: Resource type
+* @param	TileType: Type of tile
+* @param	Mod: Module - MEM, CORE or PL.
+* @param	Offsets: Pointers to internal data structure to store the
+*		offsets
+*
+* @return	Max number of resources.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_RscMgr_GetBitmapOffsets(XAie_DevInst *DevInst, XAie_RscType RscType,
+		XAie_LocType Loc, XAie_ModuleType Mod,
+		XAie_BitmapOffsets *Offsets)
+{
+	u32 BitmapOffset = 0U, StartBit, StaticBitmapOffset;
+	u32 MaxRscVal;
+	u8 TileType;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	MaxRscVal = _XAie_RscMgr_GetMaxRscVal(DevInst, RscType, Loc, Mod);
+	if(Mod == XAIE_CORE_MOD)
+		BitmapOffset = _XAie_GetCoreBitmapOffset(DevInst,
+				_XAie_RscMgr_GetMaxRscVal(DevInst, RscType, Loc,
+					XAIE_MEM_MOD));
+
+	StartBit = _XAie_GetStartBit(DevInst, Loc, MaxRscVal) + BitmapOffset;
+	StaticBitmapOffset = MaxRscVal * DevInst->NumCols *
+		_XAie_GetNumRows(DevInst, TileType);
+
+	Offsets->StaticBitmapOffset = StaticBitmapOffset;
+	Offsets->BitmapOffset = BitmapOffset;
+	Offsets->StartBit = StartBit;
+	Offsets->MaxRscVal = MaxRscVal;
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to free a particular runtime allocated resource.
+*
+* @param	DevInst: Device Instance
+* @param	RscNum: Size of Rscs array.
+* @param	Rscs: Contains parameters to release resource such as
+*		      counter ids, Location, Module, resource type.
+* 		      It needs to be allocated from user application.
+* @param	RscType: Resource type
+*
+* @return	None.
+*
+* @note		Freeing a particular resource, frees that resource from
+* 		runtime pool of resources only. That resource may still be
+* 		available for use if allocated statically. Internal only, the
+*		caller locks the bitmaps.
+*
+*******************************************************************************/
+static void _XAie_RscMgr_ClearRscs(XAie_DevInst *DevInst, u32 RscNum,
+		XAie_UserRsc *Rscs, XAie_RscType RscType)
+{
+	for(u32 i =0U; i < RscNum; i++) {
+		XAie_BackendTilesRsc TilesRsc = {0};
+		XAie_BitmapOffsets Offsets;
+		u8 TileType, RtWasSet = 0U;
+		u32 RtBit = 0U;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Rscs[i].Loc);
+		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
+				Rscs[i].Loc, Rscs[i].Mod, &Offsets);
+
+		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
+		TilesRsc.RscType = RscType;
+		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
+		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
+		TilesRsc.StartBit = Offsets.StartBit;
+		TilesRsc.Loc = Rscs[i].Loc;
+		TilesRsc.Mod = Rscs[i].Mod;
+		TilesRsc.RscId = Rscs[i].RscId;
+		if(RscType == XAIE_BCAST_CHANNEL_RSC) {
+			RtBit = Offsets.StartBit + Rscs[i].RscId;
+			RtWasSet = (CheckBit(TilesRsc.Bitmap, RtBit) != 0U) ?
+				1U : 0U;
+		}
+		/*
+		 * NOTE: No need to check the return value from run op function
+		 * as free resource is always successful.
+		 */
+		XAie_RunOp(DevInst, XAIE_BACKEND_OP_FREE_RESOURCE,
+				(void *)&TilesRsc);
+		if(RscType == XAIE_BCAST_CHANNEL_RSC) {
+			_XAie_RscMgr_TrackBcChannelBit(DevInst, TileType, RtBit,
+					RtWasSet);
+		}
+	}
+
+}
+
+/*****************************************************************************/
+/**
+* This API finds the ids free on every tile of a request, for each tile type
+* and module of the request, when the resource type uses the common free
+* allocation policy.
+*
+* @param	DevInst: Device Instance
+* @param	NumReq: Number of requests
+* @param	RscReq: Resource requests
+* @param	RscType: Resource type
+* @param	CommonFree: Returns the ids below 32 free on every tile of the
+*			    request, by tile type and module, 0 if the policy
+*			    is not common free.
+*
+* @return	None.
+*
+* @note		Internal only. The caller locks the bitmaps.
+*
+*******************************************************************************/
+static void _XAie_RscMgr_GetCommonFree(XAie_DevInst *DevInst, u32 NumReq,
+		const XAie_UserRscReq *RscReq, XAie_RscType RscType,
+		u32 CommonFree[XAIEGBL_TILE_TYPE_MAX][XAIE_PL_MOD + 1U])
+{
+	for(u8 i = 0U; i < XAIEGBL_TILE_TYPE_MAX; i++) {
+		for(u8 j = 0U; j <= XAIE_PL_MOD; j++) {
+			CommonFree[i][j] = XAIE_RSC_WORD_MASK(XAIE_RSC_WORD_BITS);
+		}
+	}
+
+	for(u32 i = 0U; i < NumReq; i++) {
+		XAie_BitmapOffsets Offsets;
+		u32 *Bitmap, NumBits, Used;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				RscReq[i].Loc);
+		if(DevInst->RscMapping[TileType].Policies[RscType] !=
+				XAIE_RSC_POLICY_COMMON_FREE) {
+			CommonFree[TileType][RscReq[i].Mod] = 0U;
+			continue;
+		}
+
+		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType, RscReq[i].Loc,
+				RscReq[i].Mod, &Offsets);
+		if(Offsets.MaxRscVal == 0U) {
+			continue;
+		}
+
+		Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
+		NumBits = (Offsets.MaxRscVal < XAIE_RSC_WORD_BITS) ?
+			Offsets.MaxRscVal : XAIE_RSC_WORD_BITS;
+		Used = _XAie_GetBitmapWord(Bitmap, Offsets.StartBit, NumBits) |
+			_XAie_GetBitmapWord(Bitmap, Offsets.StartBit +
+					Offsets.StaticBitmapOffset, NumBits);
+		CommonFree[TileType][RscReq[i].Mod] &= ~Used &
+			XAIE_RSC_WORD_MASK(NumBits);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to request a resource from the backend based on the
+* resource type.
+*
+* @param	DevInst: Device Instance
+* @param	RscReq: Contains parameters related to resource request.
+* 			tile loc, module, no. of resource request per tile.
+* @param	NumReq: Number of requests
+* @param	UserRscNum: Size of Rscs array. Must be NumReq * NumRscPerTile
+* @param	Rscs: Contains parameters to return reource such as counter ids,
+* 		      Location, Module, resource type.
+* 		      It needs to be allocated from user application.
+* @param	RscType: Resource type
+*
+* @return	XAIE_OK on success.
+*
+* @note		If any request out of pool requests fails, it returns failure.
+* 		The pool request allocation checks static as well as runtime
+* 		bitmaps for availibity and marks runtime bitmap for any
+* 		granted resource. Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_RscMgr_RequestRsc(XAie_DevInst *DevInst, u32 NumReq,
+		XAie_UserRscReq *RscReq, XAie_UserRsc *Rscs,
+		XAie_RscType RscType)
+{
+	AieRC RC = XAIE_OK;
+	u32 UserRscIndex = 0U, TileTypes;
+	u32 CommonFree[XAIEGBL_TILE_TYPE_MAX][XAIE_PL_MOD + 1U];
+
+	TileTypes = _XAie_RscMgr_GetReqTileTypes(DevInst, NumReq, RscReq);
+	_XAie_RscMgr_Lock(DevInst, RscType, TileTypes);
+	_XAie_RscMgr_GetCommonFree(DevInst, NumReq, RscReq, RscType,
+			CommonFree);
+	for(u32 i = 0U; i < NumReq; i++) {
+		XAie_BackendTilesRsc TilesRsc = {0};
+		XAie_BitmapOffsets Offsets;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, RscReq[i].Loc);
+		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
+				RscReq[i].Loc, RscReq[i].Mod, &Offsets);
+
+		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
+		TilesRsc.RscType = RscType;
+		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
+		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
+		TilesRsc.StartBit = Offsets.StartBit;
+		TilesRsc.StaticBitmapOffset = Offsets.StaticBitmapOffset;
+		TilesRsc.Loc = RscReq[i].Loc;
+		TilesRsc.Mod = RscReq[i].Mod;
+		TilesRsc.NumRscPerTile = RscReq[i].NumRscPerTile;
+		TilesRsc.Rscs = &Rscs[UserRscIndex];
+		TilesRsc.Policy = DevInst->RscMapping[TileType].Policies[RscType];
+		TilesRsc.PreferMask = CommonFree[TileType][RscReq[i].Mod];
+
+		RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_REQUEST_RESOURCE,
+				(void *)&TilesRsc);
+		if(RC != XAIE_OK) {
+			/* Clear resource marking for all previous requests */
+			_XAie_RscMgr_ClearRscs(DevInst, UserRscIndex, Rscs,
+					RscType);
+			XAIE_WARN("Unable to request resources. RscType: %d\n",
+					RscType);
+			RC = XAIE_INVALID_ARGS;
+			break;
+		}
+		for(u32 j = 0U; j < RscReq[i].NumRscPerTile; j++) {
+			Rscs[UserRscIndex].Loc = RscReq[i].Loc;
+			Rscs[UserRscIndex].Mod = RscReq[i].Mod;
+			Rscs[UserRscIndex].RscType = RscType;
+			UserRscIndex++;
+		}
+	}
+	_XAie_RscMgr_Unlock(DevInst, RscType, TileTypes);
+
+	return RC;
+}
+
+AieRC _XAie_RscMgr_RequestRscContiguous(XAie_DevInst *DevInst, u32 NumReq,
+		XAie_UserRscReq *RscReq, XAie_UserRsc *Rscs,
+		XAie_RscType RscType)
+{
+	AieRC RC = XAIE_OK;
+	u32 UserRscIndex = 0U, TileTypes;
+
+	TileTypes = _XAie_RscMgr_GetReqTileTypes(DevInst, NumReq, RscReq);
+	_XAie_RscMgr_Lock(DevInst, RscType, TileTypes);
+	for(u32 i = 0U; i < NumReq; i++) {
+		XAie_BackendTilesRsc TilesRsc = {0};
+		XAie_BitmapOffsets Offsets;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, RscReq[i].Loc);
+		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
+				RscReq[i].Loc, RscReq[i].Mod, &Offsets);
+
+		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
+		TilesRsc.RscType = RscType;
+		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
+		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
+		TilesRsc.StartBit = Offsets.StartBit;
+		TilesRsc.StaticBitmapOffset = Offsets.StaticBitmapOffset;
+		TilesRsc.Loc = RscReq[i].Loc;
+		TilesRsc.Mod = RscReq[i].Mod;
+		TilesRsc.NumRscPerTile = RscReq[i].NumRscPerTile;
+		TilesRsc.Flags = XAIE_RSC_MGR_CONTIG_FLAG;
+		TilesRsc.NumContigRscs = RscReq[i].NumRscPerTile;
+		TilesRsc.Rscs = &Rscs[UserRscIndex];
+
+		RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_REQUEST_RESOURCE,
+				(void *)&TilesRsc);
+		if(RC != XAIE_OK) {
+			/* Clear resource marking for all previous requests */
+			_XAie_RscMgr_ClearRscs(DevInst, UserRscIndex, Rscs,
+					RscType);
+			XAIE_WARN("Unable to request resources. RscType: %d\n",
+					RscType);
+			RC = XAIE_INVALID_ARGS;
+			break;
+		}
+		for(u32 j = 0U; j < RscReq[i].NumRscPerTile; j++) {
+			Rscs[UserRscIndex].Loc = RscReq[i].Loc;
+			Rscs[UserRscIndex].Mod = RscReq[i].Mod;
+			Rscs[UserRscIndex].RscType = RscType;
+			UserRscIndex++;
+		}
+	}
+	_XAie_RscMgr_Unlock(DevInst, RscType, TileTypes);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to free a particular runtime allocated resource.
+*
+* @param	DevInst: Device Instance
+* @param	RscNum: Size of Rscs array.
+* @param	Rscs: Contains parameters to release resource such as
+*		      counter ids, Location, Module, resource type.
+* 		      It needs to be allocated from user application.
+* @param	RscType: Resource type
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only. Locked version of _XAie_RscMgr_ClearRscs().
+*
+*******************************************************************************/
+AieRC _XAie_RscMgr_FreeRscs(XAie_DevInst *DevInst, u32 RscNum,
+		XAie_UserRsc *Rscs, XAie_RscType RscType)
+{
+	u32 TileTypes = _XAie_RscMgr_GetTileTypes(DevInst, RscNum, Rscs);
+
+	_XAie_RscMgr_Lock(DevInst, RscType, TileTypes);
+	_XAie_RscMgr_ClearRscs(DevInst, RscNum, Rscs, RscType);
+	_XAie_RscMgr_Unlock(DevInst, RscType, TileTypes);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to free a particular resource.
+*
+* @param	DevInst: Device Instance
+* @param	RscNum: Size of Rscs array.
+* @param	Rscs: Contains parameters to release resource such as
+*		      counter ids, Location, Module, resource type.
+* 		      It needs to be allocated from user application.
+* @param	RscType: Resource type
+*
+* @return	XAIE_OK on success.
+*
+* @note		Freeing a particular resource, frees that resource from
+* 		runtime pool of resources only. That resource may still be
+* 		available for use if allocated statically. Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_RscMgr_ReleaseRscs(XAie_DevInst *DevInst, u32 RscNum,
+		XAie_UserRsc *Rscs, XAie_RscType RscType)
+{
+	u32 TileTypes = _XAie_RscMgr_GetTileTypes(DevInst, RscNum, Rscs);
+
+	_XAie_RscMgr_Lock(DevInst, RscType, TileTypes);
+	for(u32 i =0U; i < RscNum; i++) {
+		XAie_BackendTilesRsc TilesRsc = {0};
+		XAie_BitmapOffsets Offsets;
+		u8 TileType, RtWasSet = 0U, StWasSet = 0U;
+		u32 RtBit = 0U, StBit = 0U;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Rscs[i].Loc);
+		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
+				Rscs[i].Loc, Rscs[i].Mod, &Offsets);
+
+		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
+		TilesRsc.RscType = RscType;
+		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
+		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
+		TilesRsc.StartBit = Offsets.StartBit;
+		TilesRsc.StaticBitmapOffset = Offsets.StaticBitmapOffset;
+		TilesRsc.Loc = Rscs[i].Loc;
+		TilesRsc.Mod = Rscs[i].Mod;
+		TilesRsc.RscId = Rscs[i].RscId;
+		if(RscType == XAIE_BCAST_CHANNEL_RSC) {
+			RtBit = Offsets.StartBit + Rscs[i].RscId;
+			RtWasSet = (CheckBit(TilesRsc.Bitmap, RtBit) != 0U) ?
+				1U : 0U;
+			StBit = RtBit + Offsets.StaticBitmapOffset;
+			StWasSet = (CheckBit(TilesRsc.Bitmap, StBit) != 0U) ?
+				1U : 0U;
+		}
+		/*
+		 * NOTE: No need to check the return value from run op function
+		 * as free resource is always successful.
+		 */
+		XAie_RunOp(DevInst, XAIE_BACKEND_OP_RELEASE_RESOURCE,
+				(void *)&TilesRsc);
+		if(RscType == XAIE_BCAST_CHANNEL_RSC) {
+			_XAie_RscMgr_TrackBcChannelBit(DevInst, TileType, RtBit,
+					RtWasSet);
+			_XAie_RscMgr_TrackBcChannelBit(DevInst, TileType, StBit,
+					StWasSet);
+		}
+	}
+	_XAie_RscMgr_Unlock(DevInst, RscType, TileTypes);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to request particular resource that was allocated
+* statically.
+*
+* @param	DevInst: Device Instance
+* @param	NumReq: Number of requests
+* @param	Rscs: Contains parameters to return reource such as counter ids,
+* 		      Location, Module, resource type.
+* 		      It needs to be allocated from user application.
+* @param	RscType: Resource type
+*
+* @return	XAIE_OK on success.
+*
+* @note		If any request fails, it returns failure.
+* 		A statically allocated resource is granted if that resource was
+* 		requested during compile time. After granting, this API marks
+* 		that resource as allocated in the runtime pool of resources.
+*
+*******************************************************************************/
+AieRC _XAie_RscMgr_RequestAllocatedRsc(XAie_DevInst *DevInst, u32 NumReq,
+		XAie_UserRsc *Rscs, XAie_RscType RscType)
+{
+	AieRC RC = XAIE_OK;
+	u32 UserRscIndex = 0U, TileTypes;
+
+	TileTypes = _XAie_RscMgr_GetTileTypes(DevInst, NumReq, Rscs);
+	_XAie_RscMgr_Lock(DevInst, RscType, TileTypes);
+	for(u32 i =0U; i < NumReq; i++) {
+		XAie_BackendTilesRsc TilesRsc = {0};
+		XAie_BitmapOffsets Offsets;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Rscs[i].Loc);
+		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
+				Rscs[i].Loc, Rscs[i].Mod, &Offsets);
+
+		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
+		TilesRsc.RscType = RscType;
+		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
+		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
+		TilesRsc.StartBit = Offsets.StartBit + Rscs[i].RscId;
+		TilesRsc.StaticBitmapOffset = Offsets.StaticBitmapOffset;
+		TilesRsc.Loc = Rscs[i].Loc;
+		TilesRsc.Mod = Rscs[i].Mod;
+		TilesRsc.RscId = Rscs[i].RscId;
+
+		RC = XAie_RunOp(DevInst,
+				XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE,
+				(void *)&TilesRsc);
+		if(RC != XAIE_OK) {
+			/* Clear resource marking for all previous requests */
+			_XAie_RscMgr_ClearRscs(DevInst, UserRscIndex, Rscs,
+					RscType);
+			XAIE_WARN("Unable to request resources. RscType: %d\n",
+					RscType);
+			RC = XAIE_INVALID_ARGS;
+			break;
+		}
+
+		UserRscIndex++;
+	}
+	_XAie_RscMgr_Unlock(DevInst, RscType, TileTypes);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to request a batch of resources of any types, which
+* are granted all or none with a single backend operation. Each element of
+* Rscs requests one resource of its tile, module and resource type: any free
+* one if its RscId is XAIE_RSC_ID_ANY, else the one of its RscId, as
+* XAie_RequestAllocated*() does.
+*
+* @param	DevInst: Device Instance
+* @param	NumRscs: Size of Rscs array.
+* @param	Rscs: Resources to request. The RscId of the XAIE_RSC_ID_ANY
+*		      elements is set to the granted resource.
+*
+* @return	XAIE_OK on success and error code on failure. On failure, no
+*		resource of the batch stays allocated.
+*
+* @note		Broadcast channels are not supported, as they span tiles. The
+*		bitmaps of the resource types of the batch are locked in
+*		increasing resource type order.
+*
+*******************************************************************************/
+AieRC XAie_RequestRscBatch(XAie_DevInst *DevInst, u32 NumRscs,
+		XAie_UserRsc *Rscs)
+{
+	XAie_BackendRscBatch Batch;
+	XAie_BackendTilesRsc *TilesRsc;
+	u32 TileTypes[XAIE_MAX_RSC] = {0U};
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Rscs == NULL) || (NumRscs == 0U) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments for resource batch\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_CheckLocsValidity(DevInst, NumRscs, Rscs);
+	if(RC != XAIE_OK)
+		return RC;
+
+	for(u32 i = 0U; i < NumRscs; i++) {
+		RC = _XAie_CheckModule(DevInst, Rscs[i].Loc, Rscs[i].Mod);
+		if(RC != XAIE_OK)
+			return RC;
+
+		if((Rscs[i].RscType >= XAIE_MAX_RSC) ||
+				(Rscs[i].RscType == XAIE_BCAST_CHANNEL_RSC)) {
+			XAIE_ERROR("Invalid resource type %u in batch\n",
+					Rscs[i].RscType);
+			return XAIE_INVALID_ARGS;
+		}
+
+		if((Rscs[i].RscId != XAIE_RSC_ID_ANY) &&
+				(Rscs[i].RscId >= _XAie_RscMgr_GetMaxRscVal(
+					DevInst, Rscs[i].RscType, Rscs[i].Loc,
+					Rscs[i].Mod))) {
+			XAIE_ERROR("Invalid resource id %u in batch\n",
+					Rscs[i].RscId);
+			return XAIE_INVALID_ARGS;
+		}
+
+		TileTypes[Rscs[i].RscType] |= _XAie_RscMgr_GetTileTypes(DevInst,
+				1U, &Rscs[i]);
+	}
+
+	TilesRsc = (XAie_BackendTilesRsc *)calloc(NumRscs, sizeof(*TilesRsc));
+	if(TilesRsc == NULL) {
+		XAIE_ERROR("Memory allocation for resource batch failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumRscs; i++) {
+		XAie_BitmapOffsets Offsets;
+		u8 TileType;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				Rscs[i].Loc);
+		_XAie_RscMgr_GetBitmapOffsets(DevInst, Rscs[i].RscType,
+				Rscs[i].Loc, Rscs[i].Mod, &Offsets);
+
+		TilesRsc[i].Bitmap =
+			DevInst->RscMapping[TileType].Bitmaps[Rscs[i].RscType];
+		TilesRsc[i].RscType = Rscs[i].RscType;
+		TilesRsc[i].MaxRscVal = Offsets.MaxRscVal;
+		TilesRsc[i].BitmapOffset = Offsets.BitmapOffset;
+		TilesRsc[i].StartBit = Offsets.StartBit;
+		TilesRsc[i].StaticBitmapOffset = Offsets.StaticBitmapOffset;
+		TilesRsc[i].Loc = Rscs[i].Loc;
+		TilesRsc[i].Mod = Rscs[i].Mod;
+		TilesRsc[i].RscId = Rscs[i].RscId;
+		TilesRsc[i].Policy =
+			DevInst->RscMapping[TileType].Policies[Rscs[i].RscType];
+		if(Rscs[i].RscId == XAIE_RSC_ID_ANY) {
+			TilesRsc[i].NumRscPerTile = 1U;
+			TilesRsc[i].Rscs = &Rscs[i];
+		} else {
+			TilesRsc[i].StartBit += Rscs[i].RscId;
+		}
+	}
+
+	Batch.NumRscs = NumRscs;
+	Batch.TilesRsc = TilesRsc;
+	for(u8 RscType = 0U; RscType < XAIE_MAX_RSC; RscType++) {
+		_XAie_RscMgr_Lock(DevInst, RscType, TileTypes[RscType]);
+	}
+	RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_REQUEST_RSC_BATCH,
+			(void *)&Batch);
+	for(u8 RscType = XAIE_MAX_RSC; RscType > 0U; RscType--) {
+		_XAie_RscMgr_Unlock(DevInst, RscType - 1U,
+				TileTypes[RscType - 1U]);
+	}
+
+	free(TilesRsc);
+	if(RC != XAIE_OK) {
+		XAIE_WARN("Unable to request resource batch\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the 64 bit header for a given TileType, module type, resource
+* type and Size of the bitmap in number of 64 bit words.
+*
+*
+* @param	TileType: Tile type
+* @param	ModType: Module type
+* @param	RscType: Resource Type
+* @param	Size: Number of 32 bit words.
+*
+* @return	64 bit resource header.
+*
+* @note		Internal only. The size of the bitmap is adjusted if the 32bit
+*		size value is odd and divided by two convert it to number of
+*		64 bit words.
+*
+*******************************************************************************/
+static inline u64 _XAie_CreateRscHeader(u8 TileType, XAie_ModuleType ModType,
+		u8 RscType, u32 Size)
+{
+	Size = (Size % 2U) ? Size + 1 : Size;
+	Size /= 2U;
+
+	return ((TileType & XAIE_RSC_HEADER_TILE_TYPE_MASK) <<
+			XAIE_RSC_HEADER_TILE_TYPE_SHIFT) |
+		((ModType & XAIE_RSC_HEADER_MOD_TYPE_MASK) <<
+		 XAIE_RSC_HEADER_MOD_TYPE_SHIFT) |
+		((RscType & XAIE_RSC_HEADER_RSC_TYPE_MASK) <<
+		 XAIE_RSC_HEADER_RSC_TYPE_SHIFT) |
+		((Size & XAIE_RSC_HEADER_SIZE_MASK) <<
+		 XAIE_RSC_HEADER_SIZE_SHIFT);
+}
+
+/*****************************************************************************/
+/**
+* This API returns the number of resources for a give tile type, module type and
+* resource type.
+*
+* @param	DevInst: Device Instance
+* @param	TileType: Type of tile
+* @param	Mod: Module - MEM, CORE or PL.
+* @param	RscType: Resource type
+*
+* @return	Max number of resources.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_GetNumRscs(XAie_DevInst *DevInst, u8 TileType,
+		XAie_ModuleType Mod, XAie_RscType RscType)
+{
+	switch(RscType) {
+	case XAIE_PERFCNT_RSC:
+	{
+		const XAie_PerfMod *PerfMod;
+
+		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[Mod];
+		return PerfMod->MaxCounterVal;
+	}
+	case XAIE_USER_EVENTS_RSC:
+	{
+		const XAie_EvntMod *EventMod;
+
+		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+		return EventMod->NumUserEvents;
+	}
+	case XAIE_PC_EVENTS_RSC:
+	{
+		const XAie_EvntMod *EventMod;
+
+		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+		return EventMod->NumPCEvents;
+	}
+	case XAIE_TRACE_CTRL_RSC:
+	{
+		return XAIE_TRACE_CTRL_RSCS_PER_MOD;
+	}
+	case XAIE_SS_EVENT_PORTS_RSC:
+	{
+		const XAie_EvntMod *EventMod;
+
+		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+		return EventMod->NumStrmPortSelectIds;
+	}
+	case XAIE_GROUP_EVENTS_RSC:
+	{
+		const XAie_EvntMod *EventMod;
+
+		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+		return EventMod->NumGroupEvents;
+	}
+	case XAIE_COMBO_EVENTS_RSC:
+	{
+		return XAIE_COMBO_EVENTS_PER_MOD;
+	}
+	case XAIE_BCAST_CHANNEL_RSC:
+	{
+		return XAIE_NUM_BROADCAST_CHANNELS;
+	}
+	default:
+		return 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API returns module type for a given tile type and module index from the
+* tile property.
+*
+* @param	TileType: Type of tile
+* @param	ModIndex: Index of the module in TileMod
+*
+* @return	Module type.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static XAie_ModuleType _XAie_GetModTypefromModIndex(u8 TileType, u8 ModIndex)
+{
+	switch(TileType) {
+		case XAIEGBL_TILE_TYPE_AIETILE:
+			{
+				if(ModIndex == 0U)
+					return XAIE_MEM_MOD;
+				else if(ModIndex == 1U)
+					return XAIE_CORE_MOD;
+
+				break;
+			}
+		case XAIEGBL_TILE_TYPE_SHIMNOC:
+		case XAIEGBL_TILE_TYPE_SHIMPL:
+			{
+				if(ModIndex == 0U)
+					return XAIE_PL_MOD;
+
+				break;
+			}
+		case XAIEGBL_TILE_TYPE_MEMTILE:
+			{
+				if(ModIndex == 0U)
+					return XAIE_MEM_MOD;
+
+				break;
+			}
+		default:
+			XAIE_ERROR("Invalid tile type\n");
+			break;
+		}
+
+	return XAIE_PL_MOD + 1U;
+}
+
+/*****************************************************************************/
+/**
+* This API is used to dump the total allocated resources to a file.
+*
+* @param	DevInst: Device Instance
+* @param	File: Path of the file which will contain the information of
+*		      all the allocated resources.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. The caller locks the bitmaps.
+*
+*******************************************************************************/
+static AieRC _XAie_SaveAllocatedRscsToFile(XAie_DevInst *DevInst,
+		const char *File)
+{
+	FILE *F;
+	size_t Ret;
+	u64 NumRscsInFile = 0U;
+	const u64 FirstRscsOffset = 0x10;
+
+	if((DevInst == XAIE_NULL) || (File == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	F = fopen(File, "w");
+	if (F == NULL) {
+		XAIE_ERROR("Not able to open file to dump resources, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Write NumRscs and first offset value to file */
+	Ret = fwrite(&NumRscsInFile, sizeof(NumRscsInFile), 1U, F);
+	if(Ret != 1U) {
+		XAIE_ERROR("Failed to write resource bitmaps to file, %d: %s\n",
+			errno, strerror(errno));
+		fclose(F);
+		return XAIE_ERR;
+	}
+	Ret = fwrite(&FirstRscsOffset, sizeof(FirstRscsOffset), 1U, F);
+	if(Ret != 1U) {
+		XAIE_ERROR("Failed to write resource bitmaps to file, %d: %s\n",
+			errno, strerror(errno));
+		fclose(F);
+		return XAIE_ERR;
+	}
+	for(u8 i = 0U; i < XAIEGBL_TILE_TYPE_MAX; i++) {
+		u32 NumRows;
+		XAie_ResourceManager *RscMap;
+
+		if (i == XAIEGBL_TILE_TYPE_SHIMNOC)
+			continue;
+
+		NumRows = _XAie_GetNumRows(DevInst, i);
+		RscMap = &DevInst->RscMapping[i];
+		for(u8 j = 0U; j < XAIE_MAX_RSC; j++) {
+			u32 *Bitmap;
+			u8 NumMods;
+
+			Bitmap = RscMap->Bitmaps[j];
+			NumMods = DevInst->DevProp.DevMod[i].NumModules;
+			for(u8 k = 0U; k < NumMods; k++) {
+				u32 NumRscs;
+				u32 BitmapSize;
+				u64 RscHeader;
+				XAie_ModuleType Mod;
+				u32 BitmapOffset = 0U;
+
+				NumRscs = _XAie_GetNumRscs(DevInst, i, k, j);
+				/* Save only runtime bitmap */
+				BitmapSize = _XAie_NearestRoundUp(NumRows *
+						NumRscs * DevInst->NumCols,
+						8 * sizeof(u32));
+				BitmapSize /= 8U * sizeof(u32);
+				if(BitmapSize == 0U)
+					continue;
+
+				Mod = _XAie_GetModTypefromModIndex(i, k);
+				RscHeader = _XAie_CreateRscHeader(i, Mod, j,
+						BitmapSize);
+				XAIE_DBG("RSC HEADER: 0x%lx\n", RscHeader);
+				Ret = fwrite(&RscHeader, sizeof(RscHeader), 1U,
+					       F);
+				if(Ret != 1U) {
+					XAIE_ERROR("Failed to write resource bitmaps to file, %d: %s\n",
+						errno, strerror(errno));
+					fclose(F);
+					return XAIE_ERR;
+				}
+
+				if(Mod == XAIE_CORE_MOD) {
+					u32 MemModRscs;
+
+					MemModRscs = _XAie_GetNumRscs(DevInst,
+							i, XAIE_MEM_MOD, j);
+					BitmapOffset =
+						_XAie_GetCoreBitmapOffset(
+								DevInst,
+								MemModRscs);
+					BitmapOffset = (BitmapOffset/8) /
+						sizeof(u32);
+				}
+
+				Bitmap += BitmapOffset;
+				for(u32 Word = 0U; Word < BitmapSize; Word += 2) {
+					u64 Payload;
+
+					/*
+					 * if bitmap size is odd number of 32
+					 * bit values, zero pad additional 32
+					 * bits to for a 64 bit payload.
+					 */
+					if(Word != BitmapSize - 1U)
+						Payload = Bitmap[Word] |
+							((u64)Bitmap[Word + 1] << 32);
+					else
+						Payload = Bitmap[Word];
+
+					Ret = fwrite(&Payload, sizeof(Payload),
+								1U, F);
+					if(Ret != 1U) {
+						free(DevInst->RscMapping);
+						XAIE_ERROR("Memory allocation for resource manager bitmaps failed, %d: %s\n",
+							errno, strerror(errno));
+						return XAIE_ERR;
+					}
+				}
+
+				NumRscsInFile++;
+			}
+		}
+	}
+
+	/* Update Number of Rscs entries */
+	rewind(F);
+	Ret = fwrite(&NumRscsInFile, sizeof(NumRscsInFile), 1U, F);
+	if(Ret != 1U) {
+		XAIE_ERROR("Failed to write resource bitmaps to file, %d: %s\n",
+			errno, strerror(errno));
+		fclose(F);
+		return XAIE_ERR;
+	}
+
+	fclose(F);
+	return XAIE_OK;
+
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to save the allocated resources of the partition to
+* a file.
+*
+* @param	DevInst: Device Instance
+* @param	File: Path of the file which will contain the information of
+*		      all the allocated resources.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The bitmaps are locked while they are saved.
+*
+*******************************************************************************/
+AieRC XAie_SaveAllocatedRscsToFile(XAie_DevInst *DevInst, const char *File)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_RscMgr_LockAll(DevInst);
+	RC = _XAie_SaveAllocatedRscsToFile(DevInst, File);
+	_XAie_RscMgr_UnlockAll(DevInst);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API is used to apply resource meta data to resource static bitmaps
+*
+* @param	DevInst: Device Instance
+* @param	MetaData: pointer to the AI engine resource meta data memory
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Internal only. The caller locks the bitmaps.
+*
+*******************************************************************************/
+static AieRC _XAie_LoadStaticRscfromMem(XAie_DevInst *DevInst,
+		const char *MetaData)
+{
+	const XAieRscMetaHeader *Header = (XAieRscMetaHeader *)MetaData;
+	const XAieRscBitmap *Bitmap;
+	u64 NumBitmaps, BitmapsOffset;
+
+	if((DevInst == XAIE_NULL) || (Header == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments for loading static resources\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	/*
+	 * For now, the stat field of the header only contains the number of
+	 * bitmaps.
+	 */
+	NumBitmaps = Header->Stat;
+	BitmapsOffset = Header->BitmapOff;
+	if(!NumBitmaps || BitmapsOffset < sizeof(*Header)) {
+		XAIE_ERROR("failed to get static resources, invalid header.\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Bitmap = (const XAieRscBitmap *)(MetaData + BitmapsOffset);
+	for(u32 i = 0; i < NumBitmaps; i++) {
+		u64 RscHeader = Bitmap->Header;
+		u32 RscLen, ModType, RscType, ModId;
+		u32 NumRows, NumRscs;
+		u32 BitmapSize, Bitmap64Size;
+		u32 BitmapOffset = 0U;
+		u8 TileType;
+		const u64 *Bits64;
+		u32 *Bits32;
+		XAie_ResourceManager *RscMap;
+
+
+		TileType = (RscHeader >> XAIE_RSC_HEADER_TILE_TYPE_SHIFT) &
+			XAIE_RSC_HEADER_TILE_TYPE_MASK;
+		ModType = (RscHeader >> XAIE_RSC_HEADER_MOD_TYPE_SHIFT) &
+			XAIE_RSC_HEADER_MOD_TYPE_MASK;
+		RscType = (RscHeader >> XAIE_RSC_HEADER_RSC_TYPE_SHIFT) &
+			XAIE_RSC_HEADER_RSC_TYPE_MASK;
+		RscLen =  (RscHeader >> XAIE_RSC_HEADER_SIZE_SHIFT) &
+			XAIE_RSC_HEADER_SIZE_MASK;
+
+		if(!RscLen) {
+			XAIE_ERROR("invalid static bitmap[%u], length is 0.\n",
+				i);
+			return XAIE_INVALID_ARGS;
+		}
+		if(TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+			XAIE_ERROR("invalid tile type SHIMNOC in rsc"
+				"metadata.\n");
+			return XAIE_INVALID_ARGS;
+		}
+
+		RscMap = &DevInst->RscMapping[TileType];
+		Bits32 = RscMap->Bitmaps[RscType];
+		/*
+		 * If Module type is PL, it the module field of _XAie_GetNumRscs
+		 * needs to be 0 as SHIM only have single module for resources.
+		 */
+		ModId = ModType;
+		if(ModType == XAIE_PL_MOD) {
+			ModId = 0;
+		}
+		NumRscs = _XAie_GetNumRscs(DevInst, TileType, ModId, RscType);
+		NumRows = _XAie_GetNumRows(DevInst, TileType);
+		BitmapSize = NumRows * NumRscs * DevInst->NumCols;
+		Bitmap64Size = _XAie_NearestRoundUp(BitmapSize, 8 * sizeof(u64))
+			/ (8U * sizeof(u64));
+		if((u64)(Bitmap64Size) != RscLen) {
+			XAIE_ERROR("Rsc %u of Tile type %u, Mod %u, "
+				"Invalid bitmap size, expect %u, actual %lu.\n",
+				RscType, TileType, ModType,
+				Bitmap64Size, RscLen);
 			return XAIE_INVALID_ARGS;
 		}
-		for(u32 j = 0U; j < RscReq[i].NumRscPerTile; j++) {
-			Rscs[UserRscIndex].Loc = RscReq[i].Loc;
-			Rscs[UserRscIndex].Mod = RscReq[i].Mod;
-			Rscs[UserRscIndex].RscType = RscType;
-			UserRscIndex++;
-		}
-	}
 
-	return XAIE_OK;
-}
+		if(ModType == (u32)XAIE_CORE_MOD) {
+			u32 MemModRscs;
 
-AieRC _XAie_RscMgr_RequestRscContiguous(XAie_DevInst *DevInst, u32 NumReq,
-		XAie_UserRscReq *RscReq, XAie_UserRsc *Rscs,
-		XAie_RscType RscType)
-{
-	AieRC RC;
-	u32 UserRscIndex = 0U;
+			MemModRscs = _XAie_GetNumRscs(DevInst, TileType,
+				XAIE_MEM_MOD, RscType);
+			BitmapOffset = _XAie_GetCoreBitmapOffset(DevInst,
+								MemModRscs);
+		}
 
-	for(u32 i = 0U; i < NumReq; i++) {
-		XAie_BackendTilesRsc TilesRsc = {0};
-		XAie_BitmapOffsets Offsets;
-		u8 TileType;
+		/* Locate static bitmap */
+		BitmapOffset += BitmapSize;
+		Bits64 = Bitmap->Bitmap;
+		/*
+		 * Cannot just copy, as the static bitmap may not start as
+		 * 32bit aligned.
+		 */
+		for(u32 j = 0; j < RscLen; j++) {
+			u64 lBits64Val = Bits64[j];
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, RscReq[i].Loc);
-		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
-				RscReq[i].Loc, RscReq[i].Mod, &Offsets);
+			for(u32 k = 0; k < 8 * sizeof(u64); k++) {
+				u32 Pos = k + j * 8 * sizeof(u64);
 
-		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
-		TilesRsc.RscType = RscType;
-		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
-		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
-		TilesRsc.StartBit = Offsets.StartBit;
-		TilesRsc.StaticBitmapOffset = Offsets.StaticBitmapOffset;
-		TilesRsc.Loc = RscReq[i].Loc;
-		TilesRsc.Mod = RscReq[i].Mod;
-		TilesRsc.NumRscPerTile = RscReq[i].NumRscPerTile;
-		TilesRsc.Flags = XAIE_RSC_MGR_CONTIG_FLAG;
-		TilesRsc.NumContigRscs = RscReq[i].NumRscPerTile;
-		TilesRsc.Rscs = &Rscs[UserRscIndex];
+				if (Pos >= BitmapSize) {
+					break;
+				}
+				if (lBits64Val & 1LU) {
+					u8 WasSet = (CheckBit(Bits32,
+						Pos + BitmapOffset) != 0U) ?
+						1U : 0U;
 
-		RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_REQUEST_RESOURCE,
-				(void *)&TilesRsc);
-		if(RC != XAIE_OK) {
-			/* Clear resource marking for all previous requests */
-			_XAie_RscMgr_FreeRscs(DevInst, UserRscIndex, Rscs,
-					RscType);
-			XAIE_WARN("Unable to request resources. RscType: %d\n",
-					RscType);
-			return XAIE_INVALID_ARGS;
-		}
-		for(u32 j = 0U; j < RscReq[i].NumRscPerTile; j++) {
-			Rscs[UserRscIndex].Loc = RscReq[i].Loc;
-			Rscs[UserRscIndex].Mod = RscReq[i].Mod;
-			Rscs[UserRscIndex].RscType = RscType;
-			UserRscIndex++;
+					_XAie_SetBitInBitmap(Bits32,
+						Pos + BitmapOffset, 1);
+					if(RscType == XAIE_BCAST_CHANNEL_RSC) {
+						_XAie_RscMgr_TrackBcChannelBit(
+							DevInst, TileType,
+							Pos + BitmapOffset,
+							WasSet);
+					}
+				}
+				lBits64Val >>= 1;
+			}
 		}
+
+		Bitmap = (const XAieRscBitmap *)((const char *)Bitmap +
+				sizeof(RscHeader) + RscLen * sizeof(u64));
 	}
 
 	return XAIE_OK;
@@ -786,161 +2564,214 @@ AieRC _XAie_RscMgr_RequestRscContiguous(XAie_DevInst *DevInst, u32 NumReq,
 
 /*****************************************************************************/
 /**
-* This API shall be used to free a particular runtime allocated resource.
+* This API shall be used to load the statically allocated resources of the
+* partition from the AI engine resource meta data.
 *
 * @param	DevInst: Device Instance
-* @param	RscNum: Size of Rscs array.
-* @param	Rscs: Contains parameters to release resource such as
-*		      counter ids, Location, Module, resource type.
-* 		      It needs to be allocated from user application.
-* @param	RscType: Resource type
+* @param	MetaData: pointer to the AI engine resource meta data memory
 *
-* @return	XAIE_OK on success.
+* @return	XAIE_OK on success and error code on failure.
 *
-* @note		Freeing a particular resource, frees that resource from
-* 		runtime pool of resources only. That resource may still be
-* 		available for use if allocated statically. Internal only.
+* @note		This function should be called before calling any resource
+*		requesting functions. The bitmaps are locked while they are
+*		loaded.
 *
 *******************************************************************************/
-AieRC _XAie_RscMgr_FreeRscs(XAie_DevInst *DevInst, u32 RscNum,
-		XAie_UserRsc *Rscs, XAie_RscType RscType)
+AieRC XAie_LoadStaticRscfromMem(XAie_DevInst *DevInst, const char *MetaData)
 {
-	for(u32 i =0U; i < RscNum; i++) {
-		XAie_BackendTilesRsc TilesRsc = {0};
-		XAie_BitmapOffsets Offsets;
-		u8 TileType;
-
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Rscs[i].Loc);
-		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
-				Rscs[i].Loc, Rscs[i].Mod, &Offsets);
+	AieRC RC;
 
-		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
-		TilesRsc.RscType = RscType;
-		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
-		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
-		TilesRsc.StartBit = Offsets.StartBit;
-		TilesRsc.Loc = Rscs[i].Loc;
-		TilesRsc.Mod = Rscs[i].Mod;
-		TilesRsc.RscId = Rscs[i].RscId;
-		/*
-		 * NOTE: No need to check the return value from run op function
-		 * as free resource is always successful.
-		 */
-		XAie_RunOp(DevInst, XAIE_BACKEND_OP_FREE_RESOURCE,
-				(void *)&TilesRsc);
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments for loading static resources\n");
+		return XAIE_INVALID_ARGS;
 	}
 
-	return XAIE_OK;
+	_XAie_RscMgr_LockAll(DevInst);
+	RC = _XAie_LoadStaticRscfromMem(DevInst, MetaData);
+	_XAie_RscMgr_UnlockAll(DevInst);
+
+	return RC;
 }
 
 /*****************************************************************************/
 /**
-* This API shall be used to free a particular resource.
+* This API merges the bitmap of a resource snapshot section into the static
+* bitmap of its tile type and resource type. Runtime and static allocations of
+* the snapshot both become static allocations.
 *
 * @param	DevInst: Device Instance
-* @param	RscNum: Size of Rscs array.
-* @param	Rscs: Contains parameters to release resource such as
-*		      counter ids, Location, Module, resource type.
-* 		      It needs to be allocated from user application.
-* @param	RscType: Resource type
+* @param	TileType: Tile type of the section
+* @param	RscType: Resource type of the section
+* @param	Src: Bitmap of the section
 *
-* @return	XAIE_OK on success.
+* @return	None.
 *
-* @note		Freeing a particular resource, frees that resource from
-* 		runtime pool of resources only. That resource may still be
-* 		available for use if allocated statically. Internal only.
+* @note		Internal only. The halves are merged a word at a time as the
+*		static half of a module may not start 32 bit aligned.
 *
 *******************************************************************************/
-AieRC _XAie_RscMgr_ReleaseRscs(XAie_DevInst *DevInst, u32 RscNum,
-		XAie_UserRsc *Rscs, XAie_RscType RscType)
+static void _XAie_RscMgr_MergeStaticBitmap(XAie_DevInst *DevInst, u8 TileType,
+		XAie_RscType RscType, const u32 *Src)
 {
-	for(u32 i =0U; i < RscNum; i++) {
-		XAie_BackendTilesRsc TilesRsc = {0};
-		XAie_BitmapOffsets Offsets;
-		u8 TileType;
-
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Rscs[i].Loc);
-		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
-				Rscs[i].Loc, Rscs[i].Mod, &Offsets);
+	u32 *Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
+	u32 NumRows = _XAie_GetNumRows(DevInst, TileType);
+	u8 NumMods = DevInst->DevProp.DevMod[TileType].NumModules;
+	u32 ModStart = 0U;
+
+	for(u8 Mod = 0U; Mod < NumMods; Mod++) {
+		u32 Size, Static;
+
+		Size = _XAie_GetNumRscs(DevInst, TileType, (XAie_ModuleType)Mod,
+				RscType) * NumRows * DevInst->NumCols;
+		Static = ModStart + Size;
+		for(u32 Pos = 0U; Pos < Size; Pos += XAIE_RSC_WORD_BITS) {
+			u32 NumBits, Bits;
+
+			NumBits = (Size - Pos < XAIE_RSC_WORD_BITS) ?
+				(Size - Pos) : XAIE_RSC_WORD_BITS;
+			Bits = _XAie_GetBitmapWord(Src, ModStart + Pos,
+					NumBits) |
+				_XAie_GetBitmapWord(Src, Static + Pos, NumBits);
+			if(Bits != 0U) {
+				_XAie_OrBitmapWord(Bitmap, Static + Pos, Bits,
+						NumBits);
+			}
+		}
 
-		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
-		TilesRsc.RscType = RscType;
-		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
-		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
-		TilesRsc.StartBit = Offsets.StartBit;
-		TilesRsc.StaticBitmapOffset = Offsets.StaticBitmapOffset;
-		TilesRsc.Loc = Rscs[i].Loc;
-		TilesRsc.Mod = Rscs[i].Mod;
-		TilesRsc.RscId = Rscs[i].RscId;
-		/*
-		 * NOTE: No need to check the return value from run op function
-		 * as free resource is always successful.
-		 */
-		XAie_RunOp(DevInst, XAIE_BACKEND_OP_RELEASE_RESOURCE,
-				(void *)&TilesRsc);
+		/* Runtime half of the next module follows this static half */
+		ModStart = Static + Size;
 	}
+}
 
-	return XAIE_OK;
+/*****************************************************************************/
+/**
+* This API recounts the broadcast channel occupancy summary of a tile type
+* from its broadcast channel bitmap.
+*
+* @param	DevInst: Device Instance
+* @param	TileType: Tile type
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_RscMgr_CountBcChannels(XAie_DevInst *DevInst, u8 TileType)
+{
+	XAie_ResourceManager *RscMap = &DevInst->RscMapping[TileType];
+	u32 *Bitmap = RscMap->Bitmaps[XAIE_BCAST_CHANNEL_RSC];
+	u32 NumWords;
+
+	NumWords = _XAie_RscMgr_GetBitmapWords(DevInst, TileType,
+			XAIE_BCAST_CHANNEL_RSC);
+	memset(RscMap->BcChannelUsers, 0,
+			XAIE_NUM_BROADCAST_CHANNELS * sizeof(u32));
+	for(u32 i = 0U; i < NumWords; i++) {
+		u32 Word = Bitmap[i];
+
+		while(Word != 0U) {
+			u32 Bit = i * XAIE_RSC_WORD_BITS +
+				_XAie_CountTrailingZeros32(Word);
+
+			RscMap->BcChannelUsers[Bit %
+				XAIE_NUM_BROADCAST_CHANNELS]++;
+			Word &= Word - 1U;
+		}
+	}
 }
 
 /*****************************************************************************/
 /**
-* This API shall be used to request particular resource that was allocated
-* statically.
+* This API is used to apply a resource snapshot to the static bitmaps.
 *
 * @param	DevInst: Device Instance
-* @param	NumReq: Number of requests
-* @param	Rscs: Contains parameters to return reource such as counter ids,
-* 		      Location, Module, resource type.
-* 		      It needs to be allocated from user application.
-* @param	RscType: Resource type
+* @param	Snapshot: Resource snapshot
+* @param	Size: Size of the snapshot memory in bytes
 *
-* @return	XAIE_OK on success.
+* @return	XAIE_OK on success and error code on failure.
 *
-* @note		If any request fails, it returns failure.
-* 		A statically allocated resource is granted if that resource was
-* 		requested during compile time. After granting, this API marks
-* 		that resource as allocated in the runtime pool of resources.
+* @note		Internal only. The caller locks the bitmaps. The snapshot is
+*		checked completely before any bitmap is updated.
 *
 *******************************************************************************/
-AieRC _XAie_RscMgr_RequestAllocatedRsc(XAie_DevInst *DevInst, u32 NumReq,
-		XAie_UserRsc *Rscs, XAie_RscType RscType)
+static AieRC _XAie_LoadRscSnapshot(XAie_DevInst *DevInst, const u8 *Snapshot,
+		u64 Size)
 {
-	AieRC RC;
-	u32 UserRscIndex = 0U;
+	const XAieRscSnapshotHeader *Header;
+	const XAieRscSnapshotSection *Sections;
+	u8 BcTileTypes = 0U;
+
+	Header = (const XAieRscSnapshotHeader *)Snapshot;
+	if((Size < sizeof(*Header)) ||
+			(Header->Magic != XAIE_RSC_SNAPSHOT_MAGIC)) {
+		XAIE_ERROR("Invalid resource snapshot\n");
+		return XAIE_INVALID_ARGS;
+	}
 
-	for(u32 i =0U; i < NumReq; i++) {
-		XAie_BackendTilesRsc TilesRsc = {0};
-		XAie_BitmapOffsets Offsets;
-		u8 TileType;
+	if(Header->Version != XAIE_RSC_SNAPSHOT_VERSION) {
+		XAIE_ERROR("Unsupported resource snapshot version %u\n",
+				Header->Version);
+		return XAIE_INVALID_ARGS;
+	}
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Rscs[i].Loc);
-		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
-				Rscs[i].Loc, Rscs[i].Mod, &Offsets);
+	if((Header->Size > Size) ||
+			(Header->NumSections > XAIE_RSC_SNAPSHOT_MAX_SECTIONS) ||
+			(sizeof(*Header) + Header->NumSections *
+			 sizeof(*Sections) > Header->Size)) {
+		XAIE_ERROR("Truncated resource snapshot\n");
+		return XAIE_INVALID_ARGS;
+	}
 
-		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
-		TilesRsc.RscType = RscType;
-		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
-		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
-		TilesRsc.StartBit = Offsets.StartBit + Rscs[i].RscId;
-		TilesRsc.StaticBitmapOffset = Offsets.StaticBitmapOffset;
-		TilesRsc.Loc = Rscs[i].Loc;
-		TilesRsc.Mod = Rscs[i].Mod;
-		TilesRsc.RscId = Rscs[i].RscId;
+	if((Header->DevGen != DevInst->DevProp.DevGen) ||
+			(Header->NumCols != DevInst->NumCols) ||
+			(Header->NumRows != DevInst->NumRows) ||
+			(Header->AieTileNumRows != DevInst->AieTileNumRows) ||
+			(Header->MemTileNumRows != DevInst->MemTileNumRows)) {
+		XAIE_ERROR("Resource snapshot is of a different partition\n");
+		return XAIE_INVALID_ARGS;
+	}
 
-		RC = XAie_RunOp(DevInst,
-				XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE,
-				(void *)&TilesRsc);
-		if(RC != XAIE_OK) {
-			/* Clear resource marking for all previous requests */
-			_XAie_RscMgr_FreeRscs(DevInst, UserRscIndex, Rscs,
-					RscType);
-			XAIE_WARN("Unable to request resources. RscType: %d\n",
-					RscType);
+	Sections = (const XAieRscSnapshotSection *)(Header + 1U);
+	for(u16 i = 0U; i < Header->NumSections; i++) {
+		const XAieRscSnapshotSection *Sec = &Sections[i];
+
+		if((Sec->TileType >= XAIEGBL_TILE_TYPE_MAX) ||
+				(Sec->TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
+				(Sec->RscType >= XAIE_MAX_RSC)) {
+			XAIE_ERROR("Invalid resource snapshot section %u\n",
+					i);
 			return XAIE_INVALID_ARGS;
 		}
 
-		UserRscIndex++;
+		if((Sec->NumWords != _XAie_RscMgr_GetBitmapWords(DevInst,
+					Sec->TileType, Sec->RscType)) ||
+				(Sec->Offset % XAIE_RSC_SNAPSHOT_ALIGN != 0U) ||
+				(Sec->Offset > Header->Size) ||
+				(Header->Size - Sec->Offset <
+				 (u64)Sec->NumWords * sizeof(u32))) {
+			XAIE_ERROR("Invalid bitmap for tile type %u, rsc %u "
+					"in resource snapshot\n",
+					Sec->TileType, Sec->RscType);
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	for(u16 i = 0U; i < Header->NumSections; i++) {
+		const XAieRscSnapshotSection *Sec = &Sections[i];
+
+		_XAie_RscMgr_MergeStaticBitmap(DevInst, Sec->TileType,
+				Sec->RscType,
+				(const u32 *)(Snapshot + Sec->Offset));
+		if(Sec->RscType == XAIE_BCAST_CHANNEL_RSC) {
+			BcTileTypes |= 1U << Sec->TileType;
+		}
+	}
+
+	for(u8 TileType = 0U; TileType < XAIEGBL_TILE_TYPE_MAX; TileType++) {
+		if(BcTileTypes & (1U << TileType)) {
+			_XAie_RscMgr_CountBcChannels(DevInst, TileType);
+		}
 	}
 
 	return XAIE_OK;
@@ -948,435 +2779,595 @@ AieRC _XAie_RscMgr_RequestAllocatedRsc(XAie_DevInst *DevInst, u32 NumReq,
 
 /*****************************************************************************/
 /**
-* This API returns the 64 bit header for a given TileType, module type, resource
-* type and Size of the bitmap in number of 64 bit words.
+* This API shall be used to load the statically allocated resources of the
+* partition from a resource snapshot in memory, such as a mapped snapshot file.
+* The runtime and static allocations of the snapshot become static
+* allocations.
 *
+* @param	DevInst: Device Instance
+* @param	Snapshot: Resource snapshot, at least 8 bytes aligned
+* @param	Size: Size of the snapshot memory in bytes
 *
-* @param	TileType: Tile type
-* @param	ModType: Module type
-* @param	RscType: Resource Type
-* @param	Size: Number of 32 bit words.
-*
-* @return	64 bit resource header.
+* @return	XAIE_OK on success and error code on failure.
 *
-* @note		Internal only. The size of the bitmap is adjusted if the 32bit
-*		size value is odd and divided by two convert it to number of
-*		64 bit words.
+* @note		This function should be called before calling any resource
+*		requesting functions. The bitmaps are locked while they are
+*		loaded.
 *
 *******************************************************************************/
-static inline u64 _XAie_CreateRscHeader(u8 TileType, XAie_ModuleType ModType,
-		u8 RscType, u32 Size)
+AieRC XAie_LoadRscSnapshot(XAie_DevInst *DevInst, const void *Snapshot,
+		u64 Size)
 {
-	Size = (Size % 2U) ? Size + 1 : Size;
-	Size /= 2U;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Snapshot == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments for loading resource snapshot\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(((uintptr_t)Snapshot % sizeof(u64)) != 0U) {
+		XAIE_ERROR("Resource snapshot memory is not aligned\n");
+		return XAIE_INVALID_ARGS;
+	}
 
-	return ((TileType & XAIE_RSC_HEADER_TILE_TYPE_MASK) <<
-			XAIE_RSC_HEADER_TILE_TYPE_SHIFT) |
-		((ModType & XAIE_RSC_HEADER_MOD_TYPE_MASK) <<
-		 XAIE_RSC_HEADER_MOD_TYPE_SHIFT) |
-		((RscType & XAIE_RSC_HEADER_RSC_TYPE_MASK) <<
-		 XAIE_RSC_HEADER_RSC_TYPE_SHIFT) |
-		((Size & XAIE_RSC_HEADER_SIZE_MASK) <<
-		 XAIE_RSC_HEADER_SIZE_SHIFT);
+	_XAie_RscMgr_LockAll(DevInst);
+	RC = _XAie_LoadRscSnapshot(DevInst, (const u8 *)Snapshot, Size);
+	_XAie_RscMgr_UnlockAll(DevInst);
+
+	return RC;
 }
 
+#ifndef __AIEBAREMETAL__
 /*****************************************************************************/
 /**
-* This API returns the number of resources for a give tile type, module type and
-* resource type.
+* This API is used to write the resource bitmaps to a file as a resource
+* snapshot, with a single vectored write straight from the bitmaps.
 *
 * @param	DevInst: Device Instance
-* @param	TileType: Type of tile
-* @param	Mod: Module - MEM, CORE or PL.
-* @param	RscType: Resource type
+* @param	Fd: File descriptor to write to
 *
-* @return	Max number of resources.
+* @return	XAIE_OK on success and error code on failure.
 *
-* @note		Internal only.
+* @note		Internal only. The caller locks the bitmaps.
 *
 *******************************************************************************/
-static u32 _XAie_GetNumRscs(XAie_DevInst *DevInst, u8 TileType,
-		XAie_ModuleType Mod, XAie_RscType RscType)
+static AieRC _XAie_SaveRscSnapshot(XAie_DevInst *DevInst, int Fd)
 {
-	switch(RscType) {
-	case XAIE_PERFCNT_RSC:
-	{
-		const XAie_PerfMod *PerfMod;
+	static const u8 Pad[XAIE_RSC_SNAPSHOT_ALIGN];
+	struct {
+		XAieRscSnapshotHeader Header;
+		XAieRscSnapshotSection Sections[XAIE_RSC_SNAPSHOT_MAX_SECTIONS];
+	} Meta;
+	struct iovec Iov[2U * XAIE_RSC_SNAPSHOT_MAX_SECTIONS + 2U];
+	u32 NumIov = 0U, Idx = 0U;
+	u16 NumSections = 0U;
+	u64 MetaSize, Off;
+
+	memset(&Meta, 0, sizeof(Meta));
+	for(u8 i = 0U; i < XAIEGBL_TILE_TYPE_MAX; i++) {
+		if(i == XAIEGBL_TILE_TYPE_SHIMNOC)
+			continue;
 
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[Mod];
-		return PerfMod->MaxCounterVal;
-	}
-	case XAIE_USER_EVENTS_RSC:
-	{
-		const XAie_EvntMod *EventMod;
+		for(u8 j = 0U; j < XAIE_MAX_RSC; j++) {
+			u32 NumWords;
 
-		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
-		return EventMod->NumUserEvents;
-	}
-	case XAIE_PC_EVENTS_RSC:
-	{
-		const XAie_EvntMod *EventMod;
+			NumWords = _XAie_RscMgr_GetBitmapWords(DevInst, i, j);
+			if(NumWords == 0U)
+				continue;
 
-		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
-		return EventMod->NumPCEvents;
-	}
-	case XAIE_TRACE_CTRL_RSC:
-	{
-		return XAIE_TRACE_CTRL_RSCS_PER_MOD;
+			Meta.Sections[NumSections].TileType = i;
+			Meta.Sections[NumSections].RscType = j;
+			Meta.Sections[NumSections].NumWords = NumWords;
+			NumSections++;
+		}
 	}
-	case XAIE_SS_EVENT_PORTS_RSC:
-	{
-		const XAie_EvntMod *EventMod;
 
-		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
-		return EventMod->NumStrmPortSelectIds;
+	MetaSize = sizeof(Meta.Header) + NumSections * sizeof(Meta.Sections[0]);
+	Off = _XAie_NearestRoundUp(MetaSize, XAIE_RSC_SNAPSHOT_ALIGN);
+	Iov[NumIov].iov_base = &Meta;
+	Iov[NumIov++].iov_len = MetaSize;
+	Iov[NumIov].iov_base = (void *)Pad;
+	Iov[NumIov++].iov_len = Off - MetaSize;
+	for(u16 i = 0U; i < NumSections; i++) {
+		XAieRscSnapshotSection *Sec = &Meta.Sections[i];
+		u64 Len = (u64)Sec->NumWords * sizeof(u32);
+
+		Sec->Offset = Off;
+		Iov[NumIov].iov_base =
+			DevInst->RscMapping[Sec->TileType].Bitmaps[Sec->RscType];
+		Iov[NumIov++].iov_len = Len;
+		Off += Len;
+		if(Off % XAIE_RSC_SNAPSHOT_ALIGN != 0U) {
+			Iov[NumIov].iov_base = (void *)Pad;
+			Iov[NumIov++].iov_len = XAIE_RSC_SNAPSHOT_ALIGN -
+				Off % XAIE_RSC_SNAPSHOT_ALIGN;
+			Off += Iov[NumIov - 1U].iov_len;
+		}
 	}
-	case XAIE_GROUP_EVENTS_RSC:
-	{
-		const XAie_EvntMod *EventMod;
 
-		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
-		return EventMod->NumGroupEvents;
-	}
-	case XAIE_COMBO_EVENTS_RSC:
-	{
-		return XAIE_COMBO_EVENTS_PER_MOD;
-	}
-	case XAIE_BCAST_CHANNEL_RSC:
-	{
-		return XAIE_NUM_BROADCAST_CHANNELS;
-	}
-	default:
-		return 0U;
+	Meta.Header.Magic = XAIE_RSC_SNAPSHOT_MAGIC;
+	Meta.Header.Version = XAIE_RSC_SNAPSHOT_VERSION;
+	Meta.Header.NumSections = NumSections;
+	Meta.Header.DevGen = DevInst->DevProp.DevGen;
+	Meta.Header.NumCols = DevInst->NumCols;
+	Meta.Header.NumRows = DevInst->NumRows;
+	Meta.Header.AieTileNumRows = DevInst->AieTileNumRows;
+	Meta.Header.MemTileNumRows = DevInst->MemTileNumRows;
+	Meta.Header.Size = Off;
+
+	/* Resume after a short write with the rest of the vector */
+	while(Idx < NumIov) {
+		ssize_t Ret = writev(Fd, &Iov[Idx], (int)(NumIov - Idx));
+
+		if(Ret < 0) {
+			if(errno == EINTR)
+				continue;
+
+			XAIE_ERROR("Failed to write resource snapshot, %d: %s\n",
+				errno, strerror(errno));
+			return XAIE_ERR;
+		}
+
+		while((Idx < NumIov) && ((size_t)Ret >= Iov[Idx].iov_len)) {
+			Ret -= (ssize_t)Iov[Idx].iov_len;
+			Idx++;
+		}
+		if(Ret > 0) {
+			Iov[Idx].iov_base = (u8 *)Iov[Idx].iov_base + Ret;
+			Iov[Idx].iov_len -= (size_t)Ret;
+		}
 	}
+
+	return XAIE_OK;
 }
+#endif /* !__AIEBAREMETAL__ */
 
 /*****************************************************************************/
 /**
-* This API returns module type for a given tile type and module index from the
-* tile property.
+* This API shall be used to save the allocated resources of the partition to
+* a resource snapshot file, which XAie_LoadRscSnapshotFile() or, once the file
+* is mapped, XAie_LoadRscSnapshot() load as static resources.
 *
-* @param	TileType: Type of tile
-* @param	ModIndex: Index of the module in TileMod
+* @param	DevInst: Device Instance
+* @param	File: Path of the snapshot file
 *
-* @return	Module type.
+* @return	XAIE_OK on success and error code on failure.
 *
-* @note		Internal only.
+* @note		The bitmaps are locked while they are saved.
 *
 *******************************************************************************/
-static XAie_ModuleType _XAie_GetModTypefromModIndex(u8 TileType, u8 ModIndex)
+AieRC XAie_SaveRscSnapshot(XAie_DevInst *DevInst, const char *File)
 {
-	switch(TileType) {
-		case XAIEGBL_TILE_TYPE_AIETILE:
-			{
-				if(ModIndex == 0U)
-					return XAIE_MEM_MOD;
-				else if(ModIndex == 1U)
-					return XAIE_CORE_MOD;
+#ifndef __AIEBAREMETAL__
+	AieRC RC;
+	int Fd;
 
-				break;
-			}
-		case XAIEGBL_TILE_TYPE_SHIMNOC:
-		case XAIEGBL_TILE_TYPE_SHIMPL:
-			{
-				if(ModIndex == 0U)
-					return XAIE_PL_MOD;
+	if((DevInst == XAIE_NULL) || (File == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid pointer\n");
+		return XAIE_INVALID_ARGS;
+	}
 
-				break;
-			}
-		case XAIEGBL_TILE_TYPE_MEMTILE:
-			{
-				if(ModIndex == 0U)
-					return XAIE_MEM_MOD;
+	Fd = open(File, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if(Fd < 0) {
+		XAIE_ERROR("Not able to open file to save resources, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_INVALID_ARGS;
+	}
 
-				break;
-			}
-		default:
-			XAIE_ERROR("Invalid tile type\n");
-			break;
-		}
+	_XAie_RscMgr_LockAll(DevInst);
+	RC = _XAie_SaveRscSnapshot(DevInst, Fd);
+	_XAie_RscMgr_UnlockAll(DevInst);
 
-	return XAIE_PL_MOD + 1U;
+	if(close(Fd) != 0) {
+		XAIE_ERROR("Failed to close resource snapshot, %d: %s\n",
+			errno, strerror(errno));
+		RC = XAIE_ERR;
+	}
+
+	return RC;
+#else
+	(void)DevInst;
+	(void)File;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
 }
 
 /*****************************************************************************/
 /**
-* This API is used to dump the total allocated resources to a file.
+* This API shall be used to load the statically allocated resources of the
+* partition from a resource snapshot file. The file is mapped rather than
+* read.
 *
 * @param	DevInst: Device Instance
-* @param	File: Path of the file which will contain the information of
-*		      all the allocated resources.
+* @param	File: Path of the snapshot file
 *
 * @return	XAIE_OK on success and error code on failure.
 *
+* @note		This function should be called before calling any resource
+*		requesting functions.
+*
 *******************************************************************************/
-AieRC XAie_SaveAllocatedRscsToFile(XAie_DevInst *DevInst, const char *File)
+AieRC XAie_LoadRscSnapshotFile(XAie_DevInst *DevInst, const char *File)
 {
-	FILE *F;
-	size_t Ret;
-	u64 NumRscsInFile = 0U;
-	const u64 FirstRscsOffset = 0x10;
+#ifndef __AIEBAREMETAL__
+	struct stat St;
+	void *Snapshot;
+	AieRC RC;
+	int Fd;
 
 	if((DevInst == XAIE_NULL) || (File == NULL) ||
 		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
-		XAIE_ERROR("Invalid pointer\n");
+		XAIE_ERROR("Invalid arguments for loading resource snapshot\n");
 		return XAIE_INVALID_ARGS;
 	}
 
-	F = fopen(File, "w");
-	if (F == NULL) {
-		XAIE_ERROR("Not able to open file to dump resources, %d: %s\n",
+	Fd = open(File, O_RDONLY);
+	if(Fd < 0) {
+		XAIE_ERROR("Not able to open resource snapshot, %d: %s\n",
 			errno, strerror(errno));
 		return XAIE_INVALID_ARGS;
 	}
 
-	/* Write NumRscs and first offset value to file */
-	Ret = fwrite(&NumRscsInFile, sizeof(NumRscsInFile), 1U, F);
-	if(Ret != 1U) {
-		XAIE_ERROR("Failed to write resource bitmaps to file, %d: %s\n",
-			errno, strerror(errno));
-		fclose(F);
-		return XAIE_ERR;
+	if((fstat(Fd, &St) != 0) || (St.st_size <= 0)) {
+		XAIE_ERROR("Invalid resource snapshot file %s\n", File);
+		close(Fd);
+		return XAIE_INVALID_ARGS;
 	}
-	Ret = fwrite(&FirstRscsOffset, sizeof(FirstRscsOffset), 1U, F);
-	if(Ret != 1U) {
-		XAIE_ERROR("Failed to write resource bitmaps to file, %d: %s\n",
+
+	Snapshot = mmap(NULL, (size_t)St.st_size, PROT_READ, MAP_PRIVATE, Fd,
+			0);
+	close(Fd);
+	if(Snapshot == MAP_FAILED) {
+		XAIE_ERROR("Failed to map resource snapshot, %d: %s\n",
 			errno, strerror(errno));
-		fclose(F);
 		return XAIE_ERR;
 	}
-	for(u8 i = 0U; i < XAIEGBL_TILE_TYPE_MAX; i++) {
-		u32 NumRows;
-		XAie_ResourceManager *RscMap;
 
-		if (i == XAIEGBL_TILE_TYPE_SHIMNOC)
-			continue;
+	RC = XAie_LoadRscSnapshot(DevInst, Snapshot, (u64)St.st_size);
+	munmap(Snapshot, (size_t)St.st_size);
 
-		NumRows = _XAie_GetNumRows(DevInst, i);
-		RscMap = &DevInst->RscMapping[i];
-		for(u8 j = 0U; j < XAIE_MAX_RSC; j++) {
-			u32 *Bitmap;
-			u8 NumMods;
+	return RC;
+#else
+	(void)DevInst;
+	(void)File;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
 
-			Bitmap = RscMap->Bitmaps[j];
-			NumMods = DevInst->DevProp.DevMod[i].NumModules;
-			for(u8 k = 0U; k < NumMods; k++) {
-				u32 NumRscs;
-				u32 BitmapSize;
-				u64 RscHeader;
-				XAie_ModuleType Mod;
-				u32 BitmapOffset = 0U;
+#ifndef __AIEBAREMETAL__
+/*****************************************************************************/
+/**
+* This API computes the layout of the shared resource state of the partition.
+*
+* @param	DevInst: Device Instance
+* @param	TileOff: Offset of the XAieRscShmTileType of each tile type
+* @param	BitmapOff: Offset of each bitmap of each tile type
+*
+* @return	Size of the shared resource state in bytes.
+*
+* @note		Internal only. The shim NoC tile type has no entry, it shares
+*		the state of the shim PL tile type.
+*
+*******************************************************************************/
+static u32 _XAie_RscShm_GetLayout(XAie_DevInst *DevInst,
+		u32 TileOff[XAIEGBL_TILE_TYPE_MAX],
+		u32 BitmapOff[XAIEGBL_TILE_TYPE_MAX][XAIE_MAX_RSC])
+{
+	u32 Off;
 
-				NumRscs = _XAie_GetNumRscs(DevInst, i, k, j);
-				/* Save only runtime bitmap */
-				BitmapSize = _XAie_NearestRoundUp(NumRows *
-						NumRscs * DevInst->NumCols,
-						8 * sizeof(u32));
-				BitmapSize /= 8U * sizeof(u32);
-				if(BitmapSize == 0U)
-					continue;
+	Off = _XAie_NearestRoundUp(sizeof(XAieRscShmHeader),
+			XAIE_RSC_CACHE_LINE_SIZE);
+	for(u8 i = 0U; i < XAIEGBL_TILE_TYPE_MAX; i++) {
+		if(i == XAIEGBL_TILE_TYPE_SHIMNOC)
+			continue;
 
-				Mod = _XAie_GetModTypefromModIndex(i, k);
-				RscHeader = _XAie_CreateRscHeader(i, Mod, j,
-						BitmapSize);
-				XAIE_DBG("RSC HEADER: 0x%lx\n", RscHeader);
-				Ret = fwrite(&RscHeader, sizeof(RscHeader), 1U,
-					       F);
-				if(Ret != 1U) {
-					XAIE_ERROR("Failed to write resource bitmaps to file, %d: %s\n",
-						errno, strerror(errno));
-					fclose(F);
-					return XAIE_ERR;
-				}
+		TileOff[i] = Off;
+		Off += _XAie_NearestRoundUp(sizeof(XAieRscShmTileType),
+				XAIE_RSC_CACHE_LINE_SIZE);
+		for(u8 j = 0U; j < XAIE_MAX_RSC; j++) {
+			BitmapOff[i][j] = Off;
+			Off += _XAie_NearestRoundUp(
+				_XAie_RscMgr_GetBitmapWords(DevInst, i, j) *
+				sizeof(u32), XAIE_RSC_CACHE_LINE_SIZE);
+		}
+	}
 
-				if(Mod == XAIE_CORE_MOD) {
-					u32 MemModRscs;
+	return Off;
+}
 
-					MemModRscs = _XAie_GetNumRscs(DevInst,
-							i, XAIE_MEM_MOD, j);
-					BitmapOffset =
-						_XAie_GetCoreBitmapOffset(
-								DevInst,
-								MemModRscs);
-					BitmapOffset = (BitmapOffset/8) /
-						sizeof(u32);
-				}
+/*****************************************************************************/
+/**
+* This API points the resource manager of the partition to a shared resource
+* state. The owner of the state first copies its own state into it. The local
+* locks are released, the local bitmaps stay allocated with the bitmap
+* pointers until the resource manager is finished.
+*
+* @param	DevInst: Device Instance
+* @param	Base: Mapping of the shared resource state
+* @param	IsOwner: XAIE_ENABLE if the instance created the state
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_RscShm_Bind(XAie_DevInst *DevInst, u8 *Base, u8 IsOwner)
+{
+	u32 TileOff[XAIEGBL_TILE_TYPE_MAX];
+	u32 BitmapOff[XAIEGBL_TILE_TYPE_MAX][XAIE_MAX_RSC];
 
-				Bitmap += BitmapOffset;
-				for(u32 Word = 0U; Word < BitmapSize; Word += 2) {
-					u64 Payload;
+	(void)_XAie_RscShm_GetLayout(DevInst, TileOff, BitmapOff);
+	for(u8 i = 0U; i < XAIEGBL_TILE_TYPE_MAX; i++) {
+		XAie_ResourceManager *RscMap = &DevInst->RscMapping[i];
+		XAieRscShmTileType *Shared;
 
-					/*
-					 * if bitmap size is odd number of 32
-					 * bit values, zero pad additional 32
-					 * bits to for a 64 bit payload.
-					 */
-					if(Word != BitmapSize - 1U)
-						Payload = Bitmap[Word] |
-							((u64)Bitmap[Word + 1] << 32);
-					else
-						Payload = Bitmap[Word];
+		if(i == XAIEGBL_TILE_TYPE_SHIMNOC)
+			continue;
 
-					Ret = fwrite(&Payload, sizeof(Payload),
-								1U, F);
-					if(Ret != 1U) {
-						free(DevInst->RscMapping);
-						XAIE_ERROR("Memory allocation for resource manager bitmaps failed, %d: %s\n",
-							errno, strerror(errno));
-						return XAIE_ERR;
-					}
-				}
+		Shared = (XAieRscShmTileType *)(Base + TileOff[i]);
+		if(IsOwner == XAIE_ENABLE) {
+			memcpy(Shared->BcChannelUsers, RscMap->BcChannelUsers,
+					sizeof(Shared->BcChannelUsers));
+			memcpy(Shared->Policies, RscMap->Policies,
+					sizeof(Shared->Policies));
+		}
+
+		for(u8 j = 0U; j < XAIE_MAX_RSC; j++) {
+			u32 *Bitmap = (u32 *)(Base + BitmapOff[i][j]);
 
-				NumRscsInFile++;
+			if(IsOwner == XAIE_ENABLE) {
+				memcpy(Bitmap, RscMap->Bitmaps[j],
+					_XAie_RscMgr_GetBitmapWords(DevInst, i,
+						j) * sizeof(u32));
 			}
+			RscMap->Bitmaps[j] = Bitmap;
+			pthread_mutex_destroy(&RscMap->Locks->Lock[j]);
 		}
-	}
 
-	/* Update Number of Rscs entries */
-	rewind(F);
-	Ret = fwrite(&NumRscsInFile, sizeof(NumRscsInFile), 1U, F);
-	if(Ret != 1U) {
-		XAIE_ERROR("Failed to write resource bitmaps to file, %d: %s\n",
-			errno, strerror(errno));
-		fclose(F);
-		return XAIE_ERR;
+		free(RscMap->Locks);
+		RscMap->Locks = &Shared->Locks;
+		RscMap->BcChannelUsers = Shared->BcChannelUsers;
+		RscMap->Policies = Shared->Policies;
+		RscMap->Shm = Base;
+		RscMap->IsShmOwner = IsOwner;
 	}
 
-	fclose(F);
-	return XAIE_OK;
-
+	DevInst->RscMapping[XAIEGBL_TILE_TYPE_SHIMNOC] =
+		DevInst->RscMapping[XAIEGBL_TILE_TYPE_SHIMPL];
 }
 
 /*****************************************************************************/
 /**
-* This API is used to apply resource meta data to resource static bitmaps
+* This API checks the arguments of the shared resource state APIs.
 *
 * @param	DevInst: Device Instance
-* @param	MetaData: pointer to the AI engine resource meta data memory
+* @param	Name: Name of the shared memory object
 *
 * @return	XAIE_OK on success and error code on failure.
 *
-* @note		This function should be called before calling any resource
-*		requesting functions.
+* @note		Internal only.
 *
 *******************************************************************************/
-AieRC XAie_LoadStaticRscfromMem(XAie_DevInst *DevInst, const char *MetaData)
+static AieRC _XAie_RscShm_CheckArgs(XAie_DevInst *DevInst, const char *Name)
 {
-	const XAieRscMetaHeader *Header = (XAieRscMetaHeader *)MetaData;
-	const XAieRscBitmap *Bitmap;
-	u64 NumBitmaps, BitmapsOffset;
-
-	if((DevInst == XAIE_NULL) || (Header == NULL) ||
+	if((DevInst == XAIE_NULL) || (Name == NULL) ||
 		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
-		XAIE_ERROR("Invalid arguments for loading static resources\n");
+		XAIE_ERROR("Invalid arguments for shared resource state\n");
 		return XAIE_INVALID_ARGS;
 	}
 
-	/*
-	 * For now, the stat field of the header only contains the number of
-	 * bitmaps.
-	 */
-	NumBitmaps = Header->Stat;
-	BitmapsOffset = Header->BitmapOff;
-	if(!NumBitmaps || BitmapsOffset < sizeof(*Header)) {
-		XAIE_ERROR("failed to get static resources, invalid header.\n");
+	if((Name[0] != '/') || (strlen(Name) >= XAIE_RSC_SHM_NAME_MAX)) {
+		XAIE_ERROR("Invalid shared resource state name %s\n", Name);
 		return XAIE_INVALID_ARGS;
 	}
 
-	Bitmap = (const XAieRscBitmap *)(MetaData + BitmapsOffset);
-	for(u32 i = 0; i < NumBitmaps; i++) {
-		u64 RscHeader = Bitmap->Header;
-		u32 RscLen, ModType, RscType, ModId;
-		u32 NumRows, NumRscs;
-		u32 BitmapSize, Bitmap64Size;
-		u32 BitmapOffset = 0U;
-		u8 TileType;
-		const u64 *Bits64;
-		u32 *Bits32;
-		XAie_ResourceManager *RscMap;
+	if(DevInst->RscMapping[XAIEGBL_TILE_TYPE_AIETILE].Shm != XAIE_NULL) {
+		XAIE_ERROR("Resource state is already shared\n");
+		return XAIE_INVALID_ARGS;
+	}
 
+	return XAIE_OK;
+}
+#endif /* !__AIEBAREMETAL__ */
 
-		TileType = (RscHeader >> XAIE_RSC_HEADER_TILE_TYPE_SHIFT) &
-			XAIE_RSC_HEADER_TILE_TYPE_MASK;
-		ModType = (RscHeader >> XAIE_RSC_HEADER_MOD_TYPE_SHIFT) &
-			XAIE_RSC_HEADER_MOD_TYPE_MASK;
-		RscType = (RscHeader >> XAIE_RSC_HEADER_RSC_TYPE_SHIFT) &
-			XAIE_RSC_HEADER_RSC_TYPE_MASK;
-		RscLen =  (RscHeader >> XAIE_RSC_HEADER_SIZE_SHIFT) &
-			XAIE_RSC_HEADER_SIZE_MASK;
+/*****************************************************************************/
+/**
+* This API shall be used to share the resource state of the partition with
+* other processes. It creates a shared memory object holding the resource
+* bitmaps, the broadcast channel occupancy and the allocation policies of the
+* partition, along with process shared locks, and moves the current state of
+* the instance into it. Other processes, once they have initialized an
+* instance of the same partition, attach to the state with
+* XAie_AttachRscState() instead of loading it again, and from then on every
+* resource request of every process sees the allocations of the others.
+*
+* @param	DevInst: Device Instance
+* @param	Name: Name of the shared memory object, starting with a '/'
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The instance owns the state. Its shared memory object is
+*		removed when the instance is finished, the processes which are
+*		attached keep using the state. The API must be called before
+*		other threads use the instance.
+*
+*******************************************************************************/
+AieRC XAie_ShareRscState(XAie_DevInst *DevInst, const char *Name)
+{
+#ifndef __AIEBAREMETAL__
+	u32 TileOff[XAIEGBL_TILE_TYPE_MAX];
+	u32 BitmapOff[XAIEGBL_TILE_TYPE_MAX][XAIE_MAX_RSC];
+	pthread_mutexattr_t Attr;
+	XAieRscShmHeader *Header;
+	u32 Size;
+	AieRC RC;
+	u8 *Base;
+	int Fd;
 
-		if(!RscLen) {
-			XAIE_ERROR("invalid static bitmap[%u], length is 0.\n",
-				i);
-			return XAIE_INVALID_ARGS;
-		}
-		if(TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
-			XAIE_ERROR("invalid tile type SHIMNOC in rsc"
-				"metadata.\n");
-			return XAIE_INVALID_ARGS;
-		}
+	RC = _XAie_RscShm_CheckArgs(DevInst, Name);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
 
-		RscMap = &DevInst->RscMapping[TileType];
-		Bits32 = RscMap->Bitmaps[RscType];
-		/*
-		 * If Module type is PL, it the module field of _XAie_GetNumRscs
-		 * needs to be 0 as SHIM only have single module for resources.
-		 */
-		ModId = ModType;
-		if(ModType == XAIE_PL_MOD) {
-			ModId = 0;
-		}
-		NumRscs = _XAie_GetNumRscs(DevInst, TileType, ModId, RscType);
-		NumRows = _XAie_GetNumRows(DevInst, TileType);
-		BitmapSize = NumRows * NumRscs * DevInst->NumCols;
-		Bitmap64Size = _XAie_NearestRoundUp(BitmapSize, 8 * sizeof(u64))
-			/ (8U * sizeof(u64));
-		if((u64)(Bitmap64Size) != RscLen) {
-			XAIE_ERROR("Rsc %u of Tile type %u, Mod %u, "
-				"Invalid bitmap size, expect %u, actual %lu.\n",
-				RscType, TileType, ModType,
-				Bitmap64Size, RscLen);
-			return XAIE_INVALID_ARGS;
-		}
+	Size = _XAie_RscShm_GetLayout(DevInst, TileOff, BitmapOff);
+	Fd = shm_open(Name, O_RDWR | O_CREAT | O_EXCL, 0600);
+	if(Fd < 0) {
+		XAIE_ERROR("Failed to create shared resource state %s, %d: %s\n",
+			Name, errno, strerror(errno));
+		return XAIE_ERR;
+	}
 
-		if(ModType == (u32)XAIE_CORE_MOD) {
-			u32 MemModRscs;
+	if(ftruncate(Fd, (off_t)Size) != 0) {
+		XAIE_ERROR("Failed to size shared resource state, %d: %s\n",
+			errno, strerror(errno));
+		close(Fd);
+		shm_unlink(Name);
+		return XAIE_ERR;
+	}
 
-			MemModRscs = _XAie_GetNumRscs(DevInst, TileType,
-				XAIE_MEM_MOD, RscType);
-			BitmapOffset = _XAie_GetCoreBitmapOffset(DevInst,
-								MemModRscs);
-		}
+	Base = (u8 *)mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd,
+			0);
+	close(Fd);
+	if(Base == MAP_FAILED) {
+		XAIE_ERROR("Failed to map shared resource state, %d: %s\n",
+			errno, strerror(errno));
+		shm_unlink(Name);
+		return XAIE_ERR;
+	}
 
-		/* Locate static bitmap */
-		BitmapOffset += BitmapSize;
-		Bits64 = Bitmap->Bitmap;
-		/*
-		 * Cannot just copy, as the static bitmap may not start as
-		 * 32bit aligned.
-		 */
-		for(u32 j = 0; j < RscLen; j++) {
-			u64 lBits64Val = Bits64[j];
+	/* Robust locks, so a process dying with a lock held blocks no one */
+	pthread_mutexattr_init(&Attr);
+	pthread_mutexattr_setpshared(&Attr, PTHREAD_PROCESS_SHARED);
+	pthread_mutexattr_setrobust(&Attr, PTHREAD_MUTEX_ROBUST);
+	for(u8 i = 0U; i < XAIEGBL_TILE_TYPE_MAX; i++) {
+		XAieRscShmTileType *Shared;
 
-			for(u32 k = 0; k < 8 * sizeof(u64); k++) {
-				u32 Pos = k + j * 8 * sizeof(u64);
+		if(i == XAIEGBL_TILE_TYPE_SHIMNOC)
+			continue;
 
-				if (Pos >= BitmapSize) {
-					break;
-				}
-				if (lBits64Val & 1LU) {
-					_XAie_SetBitInBitmap(Bits32,
-						Pos + BitmapOffset, 1);
-				}
-				lBits64Val >>= 1;
-			}
+		Shared = (XAieRscShmTileType *)(Base + TileOff[i]);
+		for(u8 j = 0U; j < XAIE_MAX_RSC; j++) {
+			pthread_mutex_init(&Shared->Locks.Lock[j], &Attr);
 		}
+	}
+	pthread_mutexattr_destroy(&Attr);
+
+	Header = (XAieRscShmHeader *)Base;
+	Header->Magic = XAIE_RSC_SHM_MAGIC;
+	Header->Version = XAIE_RSC_SHM_VERSION;
+	Header->DevGen = DevInst->DevProp.DevGen;
+	Header->StartCol = DevInst->StartCol;
+	Header->NumCols = DevInst->NumCols;
+	Header->NumRows = DevInst->NumRows;
+	Header->AieTileNumRows = DevInst->AieTileNumRows;
+	Header->MemTileNumRows = DevInst->MemTileNumRows;
+	Header->Size = Size;
+	strcpy(Header->Name, Name);
+
+	_XAie_RscShm_Bind(DevInst, Base, XAIE_ENABLE);
+	__atomic_store_n(&Header->IsReady, XAIE_COMPONENT_IS_READY,
+			__ATOMIC_RELEASE);
 
-		Bitmap = (const XAieRscBitmap *)((const char *)Bitmap +
-				sizeof(RscHeader) + RscLen * sizeof(u64));
+	return XAIE_OK;
+#else
+	(void)DevInst;
+	(void)Name;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to attach to the resource state shared by another
+* process with XAie_ShareRscState(). The resource manager of the instance then
+* works on the shared state, its own state is dropped.
+*
+* @param	DevInst: Device Instance
+* @param	Name: Name of the shared memory object, starting with a '/'
+*
+* @return	XAIE_OK on success, XAIE_ERR if the state does not exist or is
+*		not initialized yet, error code on failure.
+*
+* @note		The instance must be of the same partition as the owner of the
+*		state. The API should be called before calling any resource
+*		requesting functions.
+*
+*******************************************************************************/
+AieRC XAie_AttachRscState(XAie_DevInst *DevInst, const char *Name)
+{
+#ifndef __AIEBAREMETAL__
+	u32 TileOff[XAIEGBL_TILE_TYPE_MAX];
+	u32 BitmapOff[XAIEGBL_TILE_TYPE_MAX][XAIE_MAX_RSC];
+	const XAieRscShmHeader *Header;
+	struct stat St;
+	u32 Size;
+	AieRC RC;
+	u8 *Base;
+	int Fd;
+
+	RC = _XAie_RscShm_CheckArgs(DevInst, Name);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Size = _XAie_RscShm_GetLayout(DevInst, TileOff, BitmapOff);
+	Fd = shm_open(Name, O_RDWR, 0);
+	if(Fd < 0) {
+		XAIE_ERROR("Failed to open shared resource state %s, %d: %s\n",
+			Name, errno, strerror(errno));
+		return XAIE_ERR;
+	}
+
+	if((fstat(Fd, &St) != 0) || ((u64)St.st_size != Size)) {
+		XAIE_ERROR("Shared resource state %s is not of the partition "
+			"or is not initialized yet\n", Name);
+		close(Fd);
+		return XAIE_ERR;
+	}
+
+	Base = (u8 *)mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd,
+			0);
+	close(Fd);
+	if(Base == MAP_FAILED) {
+		XAIE_ERROR("Failed to map shared resource state, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_ERR;
+	}
+
+	Header = (const XAieRscShmHeader *)Base;
+	if(__atomic_load_n(&Header->IsReady, __ATOMIC_ACQUIRE) !=
+			XAIE_COMPONENT_IS_READY) {
+		XAIE_ERROR("Shared resource state %s is not initialized yet\n",
+			Name);
+		munmap(Base, Size);
+		return XAIE_ERR;
+	}
+
+	if((Header->Magic != XAIE_RSC_SHM_MAGIC) ||
+		(Header->Version != XAIE_RSC_SHM_VERSION) ||
+		(Header->DevGen != DevInst->DevProp.DevGen) ||
+		(Header->StartCol != DevInst->StartCol) ||
+		(Header->NumCols != DevInst->NumCols) ||
+		(Header->NumRows != DevInst->NumRows) ||
+		(Header->AieTileNumRows != DevInst->AieTileNumRows) ||
+		(Header->MemTileNumRows != DevInst->MemTileNumRows) ||
+		(Header->Size != Size)) {
+		XAIE_ERROR("Shared resource state %s is not of the partition\n",
+			Name);
+		munmap(Base, Size);
+		return XAIE_INVALID_ARGS;
 	}
 
+	_XAie_RscShm_Bind(DevInst, Base, XAIE_DISABLE);
+
 	return XAIE_OK;
+#else
+	(void)DevInst;
+	(void)Name;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
 }
 
 /*****************************************************************************/
@@ -1400,6 +3391,7 @@ static AieRC _XAie_GetRscsStat(XAie_DevInst *DevInst, u32 NumRscStat,
 		XAie_UserRscStat *RscStats,
 		XAie_BackendRscStatType RscStatType)
 {
+	AieRC RC;
 	XAie_BackendRscStat BRscStats = {0};
 
 	if((DevInst == XAIE_NULL) || (NumRscStat == 0) ||
@@ -1421,8 +3413,12 @@ static AieRC _XAie_GetRscsStat(XAie_DevInst *DevInst, u32 NumRscStat,
 	BRscStats.NumRscStats = NumRscStat;
 	BRscStats.RscStatType = RscStatType;
 	BRscStats.RscStats = RscStats;
-	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_GET_RSC_STAT,
+	_XAie_RscMgr_LockAll(DevInst);
+	RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_GET_RSC_STAT,
 			(void *)&BRscStats);
+	_XAie_RscMgr_UnlockAll(DevInst);
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -1467,6 +3463,181 @@ AieRC XAie_GetAvailRscStat(XAie_DevInst *DevInst, u32 NumRscStat,
 			XAIE_BACKEND_RSC_STAT_AVAIL);
 }
 
+/*****************************************************************************/
+/**
+* This API sets the policy used to pick the ids of the resources of a resource
+* type granted by the resource requesting functions. Requests for any free
+* resource pick the lowest free ids by default, which tends to leave the low
+* ids of a few tiles taken and the ids free on every tile scattered. The
+* highest first policy keeps allocations away from the ids other users take
+* lowest first, and the common free policy first grants the ids free on every
+* tile of a request, so the tiles of a request get the same ids.
+*
+* @param	DevInst: Device Instance
+* @param	RscType: Resource type
+* @param	Policy: Allocation policy
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		Contiguous requests keep granting the lowest free runs. A
+*		broadcast channel is free on every tile of its request, so the
+*		common free policy picks the lowest one. The Linux backend
+*		leaves the allocation to the partition driver, which ignores
+*		the policy.
+*
+*******************************************************************************/
+AieRC XAie_SetRscPolicy(XAie_DevInst *DevInst, XAie_RscType RscType,
+		XAie_RscPolicy Policy)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid device instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((RscType >= XAIE_MAX_RSC) || (Policy >= XAIE_RSC_POLICY_MAX)) {
+		XAIE_ERROR("Invalid resource type or policy\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_RscMgr_Lock(DevInst, RscType, XAIE_RSC_MGR_ALL_TILE_TYPES);
+	for(u8 i = 0U; i < XAIEGBL_TILE_TYPE_MAX; i++) {
+		/* Shim NoC tiles share the bitmaps of shim PL tiles */
+		if(i == XAIEGBL_TILE_TYPE_SHIMNOC)
+			continue;
+
+		DevInst->RscMapping[i].Policies[RscType] = (u8)Policy;
+	}
+	_XAie_RscMgr_Unlock(DevInst, RscType, XAIE_RSC_MGR_ALL_TILE_TYPES);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API is used to get how fragmented the free resources of a resource type
+* of a module are over the tiles of a tile type. Long running users can watch
+* NumCommonFree, the ids still free on every tile, to keep ids available for
+* requests spanning many tiles.
+*
+* @param	DevInst: Device Instance
+* @param	TileType: Tile type
+* @param	Mod: Module type
+* @param	RscType: Resource type
+* @param	Stat: Returns the fragmentation statistics
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The statistics come from the bitmaps of the library, so they
+*		are not available with the Linux backend, where the partition
+*		driver allocates the resources. XAie_GetAvailRscStat() returns
+*		the free resources of each tile with any backend.
+*
+*******************************************************************************/
+AieRC XAie_GetRscFragStat(XAie_DevInst *DevInst, u8 TileType,
+		XAie_ModuleType Mod, XAie_RscType RscType,
+		XAie_RscFragStat *Stat)
+{
+	u32 *Bitmap, NumRows, StartRow, MaxRscVal = 0U;
+	XAie_LocType First;
+
+	if((DevInst == XAIE_NULL) || (Stat == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments for fragmentation stat\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DevInst->Backend->Type == XAIE_IO_BACKEND_LINUX) {
+		XAIE_ERROR("Fragmentation stat not supported by backend\n");
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	if((TileType >= XAIEGBL_TILE_TYPE_MAX) || (RscType >= XAIE_MAX_RSC)) {
+		XAIE_ERROR("Invalid tile type or resource type\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	switch(TileType) {
+	case XAIEGBL_TILE_TYPE_AIETILE:
+		StartRow = DevInst->AieTileRowStart;
+		break;
+	case XAIEGBL_TILE_TYPE_MEMTILE:
+		StartRow = DevInst->MemTileRowStart;
+		break;
+	default:
+		StartRow = 0U;
+		break;
+	}
+
+	NumRows = _XAie_GetNumRows(DevInst, TileType);
+	memset(Stat, 0, sizeof(*Stat));
+	if(NumRows == 0U) {
+		return XAIE_OK;
+	}
+
+	First = XAie_TileLoc(0U, StartRow);
+	if(_XAie_CheckModule(DevInst, First, Mod) != XAIE_OK) {
+		XAIE_ERROR("Invalid module for tile type\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	MaxRscVal = _XAie_RscMgr_GetMaxRscVal(DevInst, RscType, First, Mod);
+	Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
+	Stat->MaxRscVal = MaxRscVal;
+
+	_XAie_RscMgr_Lock(DevInst, RscType, _XAie_RscMgr_TileTypeBit(TileType));
+	for(u32 Off = 0U; Off < MaxRscVal; Off += XAIE_RSC_WORD_BITS) {
+		u32 NumBits, Common;
+
+		NumBits = MaxRscVal - Off;
+		if(NumBits > XAIE_RSC_WORD_BITS) {
+			NumBits = XAIE_RSC_WORD_BITS;
+		}
+		Common = XAIE_RSC_WORD_MASK(NumBits);
+
+		for(u8 Col = 0U; Col < DevInst->NumCols; Col++) {
+			for(u32 Row = StartRow; Row < StartRow + NumRows;
+					Row++) {
+				XAie_LocType Loc = XAie_TileLoc(Col, (u8)Row);
+				XAie_BitmapOffsets Offsets;
+				u32 Free;
+
+				/* Shim NoC and PL tiles are on the same row */
+				if(_XAie_DevGetTTypefromLoc(DevInst,
+							Loc) != TileType) {
+					continue;
+				}
+
+				_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
+						Loc, Mod, &Offsets);
+				Free = ~(_XAie_GetBitmapWord(Bitmap,
+						Offsets.StartBit + Off,
+						NumBits) |
+					_XAie_GetBitmapWord(Bitmap,
+						Offsets.StartBit + Off +
+						Offsets.StaticBitmapOffset,
+						NumBits)) &
+					XAIE_RSC_WORD_MASK(NumBits);
+				Stat->NumFree += _XAie_PopCount32(Free);
+				Common &= Free;
+				if(Off == 0U) {
+					Stat->NumTiles++;
+				}
+			}
+		}
+
+		Stat->NumCommonFree += _XAie_PopCount32(Common);
+	}
+	_XAie_RscMgr_Unlock(DevInst, RscType,
+			_XAie_RscMgr_TileTypeBit(TileType));
+
+	if(Stat->NumTiles == 0U) {
+		Stat->NumCommonFree = 0U;
+	}
+
+	return XAIE_OK;
+}
+
 #endif /* XAIE_FEATURE_RSC_ENABLE */
 
 /** @} */
@@ -28,6 +28,15 @@
 #include "xaie_feature_config.h"
 
 /***************************** Macro Definitions *****************************/
+/* Resource id of a batch request for any free resource */
+#define XAIE_RSC_ID_ANY		(-1U)
+
+/* Module mask bits of a resource region */
+#define XAIE_RSC_REGION_MOD(Mod)	(1U << (Mod))
+#define XAIE_RSC_REGION_ALL_MODS	(XAIE_RSC_REGION_MOD(XAIE_MEM_MOD) | \
+					 XAIE_RSC_REGION_MOD(XAIE_CORE_MOD) | \
+					 XAIE_RSC_REGION_MOD(XAIE_PL_MOD))
+
 /**************************** Type Definitions *******************************/
 /*
  * This structure is used to return resource as per availibility from the
@@ -47,6 +56,18 @@ typedef struct {
 	u32 NumRscPerTile;
 } XAie_UserRscReq;
 
+/*
+ * This structure is used to request a resource on the modules of a rectangle
+ * of tiles. Only the ungated tiles of the rectangle are part of the request,
+ * and of each, the modules selected by ModMask which the tile type has.
+ */
+typedef struct {
+	XAie_LocType Start;	/* Bottom left tile of the region */
+	u8 NumCols;
+	u8 NumRows;
+	u8 ModMask;		/* XAIE_RSC_REGION_MOD() of the modules */
+} XAie_RscRegion;
+
 /************************** Enum *********************************************/
 /* This enum is used to capture all resource types managed by resource manager*/
 typedef enum {
@@ -61,6 +82,27 @@ typedef enum {
 	XAIE_MAX_RSC,
 } XAie_RscType;
 
+/* This enum captures the policies to pick the ids of the granted resources */
+typedef enum {
+	XAIE_RSC_POLICY_LOWEST,		/* Lowest free ids, the default */
+	XAIE_RSC_POLICY_HIGHEST,	/* Highest free ids */
+	XAIE_RSC_POLICY_COMMON_FREE,	/* Ids free on every tile of the request
+					 * first, then the lowest free ids */
+	XAIE_RSC_POLICY_MAX,
+} XAie_RscPolicy;
+
+/*
+ * This structure returns how fragmented a resource type of a module is over
+ * the tiles of a tile type. An id free on every tile can still be granted to
+ * any set of tiles with the same id.
+ */
+typedef struct {
+	u32 NumTiles;		/* Tiles of the tile type in the partition */
+	u32 MaxRscVal;		/* Resources of the module of a tile */
+	u32 NumFree;		/* Free resources of all the tiles */
+	u32 NumCommonFree;	/* Ids free on every tile */
+} XAie_RscFragStat;
+
 /*
  * This structure is used to request the statistics of a resource type of a
  * module of a tile.
@@ -111,6 +153,61 @@ static inline AieRC XAie_SaveAllocatedRscsToFile(XAie_DevInst *DevInst,
 	(void)File;
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
+static inline AieRC XAie_RequestRscBatch(XAie_DevInst *DevInst,
+		u32 NumRscs, XAie_UserRsc *Rscs) {
+	(void)DevInst;
+	(void)NumRscs;
+	(void)Rscs;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline AieRC XAie_SetRscPolicy(XAie_DevInst *DevInst,
+		XAie_RscType RscType, XAie_RscPolicy Policy) {
+	(void)DevInst;
+	(void)RscType;
+	(void)Policy;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline AieRC XAie_GetRscFragStat(XAie_DevInst *DevInst, u8 TileType,
+		XAie_ModuleType Mod, XAie_RscType RscType,
+		XAie_RscFragStat *Stat) {
+	(void)DevInst;
+	(void)TileType;
+	(void)Mod;
+	(void)RscType;
+	(void)Stat;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline AieRC XAie_SaveRscSnapshot(XAie_DevInst *DevInst,
+		const char *File) {
+	(void)DevInst;
+	(void)File;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline AieRC XAie_LoadRscSnapshot(XAie_DevInst *DevInst,
+		const void *Snapshot, u64 Size) {
+	(void)DevInst;
+	(void)Snapshot;
+	(void)Size;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline AieRC XAie_LoadRscSnapshotFile(XAie_DevInst *DevInst,
+		const char *File) {
+	(void)DevInst;
+	(void)File;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline AieRC XAie_ShareRscState(XAie_DevInst *DevInst,
+		const char *Name) {
+	(void)DevInst;
+	(void)Name;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline AieRC XAie_AttachRscState(XAie_DevInst *DevInst,
+		const char *Name) {
+	(void)DevInst;
+	(void)Name;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
 
 /* User Events resource management APIs */
 static inline AieRC XAie_RequestUserEvents(XAie_DevInst *DevInst, u32 NumReq,
@@ -324,6 +421,30 @@ static inline AieRC XAie_ReleaseBroadcastChannel(XAie_DevInst *DevInst, u32 User
 	(void)Rscs;
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
+static inline AieRC XAie_RequestBroadcastChannelRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 *BcId)
+{
+	(void)DevInst;
+	(void)Region;
+	(void)BcId;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline AieRC XAie_RequestSpecificBroadcastChannelRegion(
+		XAie_DevInst *DevInst, const XAie_RscRegion *Region, u32 BcId)
+{
+	(void)DevInst;
+	(void)Region;
+	(void)BcId;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline AieRC XAie_ReleaseBroadcastChannelRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 BcId)
+{
+	(void)DevInst;
+	(void)Region;
+	(void)BcId;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
 
 static inline AieRC XAie_GetStaticRscStat(XAie_DevInst *DevInst, u32 NumRscStat,
 		XAie_UserRscStat *RscStats)
@@ -354,6 +475,14 @@ AieRC XAie_FreePerfcnt(XAie_DevInst *DevInst, u32 UserRscNum,
 AieRC XAie_RequestAllocatedPerfcnt(XAie_DevInst *DevInst, u32 NumReq,
 		XAie_UserRsc *RscReq);
 AieRC XAie_SaveAllocatedRscsToFile(XAie_DevInst *DevInst, const char *File);
+AieRC XAie_RequestRscBatch(XAie_DevInst *DevInst, u32 NumRscs,
+		XAie_UserRsc *Rscs);
+AieRC XAie_SaveRscSnapshot(XAie_DevInst *DevInst, const char *File);
+AieRC XAie_LoadRscSnapshot(XAie_DevInst *DevInst, const void *Snapshot,
+		u64 Size);
+AieRC XAie_LoadRscSnapshotFile(XAie_DevInst *DevInst, const char *File);
+AieRC XAie_ShareRscState(XAie_DevInst *DevInst, const char *Name);
+AieRC XAie_AttachRscState(XAie_DevInst *DevInst, const char *Name);
 
 /* User Events resource management APIs */
 AieRC XAie_RequestUserEvents(XAie_DevInst *DevInst, u32 NumReq,
@@ -420,6 +549,12 @@ AieRC XAie_RequestSpecificBroadcastChannel(XAie_DevInst *DevInst, u32 BcId,
 		u32 *UserRscNum, XAie_UserRsc *Rscs, u8 BroadcastAllFlag);
 AieRC XAie_ReleaseBroadcastChannel(XAie_DevInst *DevInst, u32 UserRscNum,
 		XAie_UserRsc *Rscs);
+AieRC XAie_RequestBroadcastChannelRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 *BcId);
+AieRC XAie_RequestSpecificBroadcastChannelRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 BcId);
+AieRC XAie_ReleaseBroadcastChannelRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 BcId);
 
 /*****************************************************************************/
 /*
@@ -448,5 +583,10 @@ AieRC XAie_GetStaticRscStat(XAie_DevInst *DevInst, u32 NumRscStat,
 		XAie_UserRscStat *RscStats);
 AieRC XAie_GetAvailRscStat(XAie_DevInst *DevInst, u32 NumRscStat,
 		XAie_UserRscStat *RscStats);
+AieRC XAie_SetRscPolicy(XAie_DevInst *DevInst, XAie_RscType RscType,
+		XAie_RscPolicy Policy);
+AieRC XAie_GetRscFragStat(XAie_DevInst *DevInst, u8 TileType,
+		XAie_ModuleType Mod, XAie_RscType RscType,
+		XAie_RscFragStat *Stat);
 #endif /* XAIE_FEATURE_RSC_ENABLE */
 #endif		/* end of protection macro */
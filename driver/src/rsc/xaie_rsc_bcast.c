@@ -71,7 +71,7 @@ static AieRC _XAie_GetUngatedTilesInPartition(XAie_DevInst *DevInst,
 					return XAIE_INVALID_ARGS;
 				}
 
-				TileType = DevInst->DevOps->GetTTypefromLoc(
+				TileType = _XAie_DevGetTTypefromLoc(
 						DevInst, Loc);
 				if((TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
 					(TileType == XAIEGBL_TILE_TYPE_SHIMPL)) {
@@ -130,6 +130,7 @@ AieRC XAie_RequestBroadcastChannel(XAie_DevInst *DevInst, u32 *UserRscNum,
 		XAie_UserRsc *Rscs, u8 BroadcastAllFlag)
 {
 	AieRC RC;
+	u32 TileTypes;
 	XAie_BackendTilesRsc TilesRsc = {0};
 
 	if((DevInst == XAIE_NULL) || (Rscs == NULL) ||
@@ -156,9 +157,24 @@ AieRC XAie_RequestBroadcastChannel(XAie_DevInst *DevInst, u32 *UserRscNum,
 	TilesRsc.UserRscNum = UserRscNum;
 	TilesRsc.Rscs = Rscs;
 	TilesRsc.Flags = BroadcastAllFlag;
+	if(*UserRscNum != 0U) {
+		u8 TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				Rscs[0].Loc);
 
+		TilesRsc.Policy = DevInst->RscMapping[TileType].
+			Policies[XAIE_BCAST_CHANNEL_RSC];
+	}
+
+	/*
+	 * The channel has to be free on all the tiles of the request, so the
+	 * bitmaps of all their tile types are locked.
+	 */
+	TileTypes = BroadcastAllFlag ? XAIE_RSC_MGR_ALL_TILE_TYPES :
+		_XAie_RscMgr_GetTileTypes(DevInst, *UserRscNum, Rscs);
+	_XAie_RscMgr_Lock(DevInst, XAIE_BCAST_CHANNEL_RSC, TileTypes);
 	RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_REQUEST_RESOURCE,
 		(void *)&TilesRsc);
+	_XAie_RscMgr_Unlock(DevInst, XAIE_BCAST_CHANNEL_RSC, TileTypes);
 	if(RC != XAIE_OK) {
 		XAIE_ERROR("Unable to find free broadcast channel\n");
 		return XAIE_ERR;
@@ -196,6 +212,7 @@ AieRC XAie_RequestSpecificBroadcastChannel(XAie_DevInst *DevInst, u32 BcId,
 		u32 *UserRscNum, XAie_UserRsc *Rscs, u8 BroadcastAllFlag)
 {
 	AieRC RC;
+	u32 TileTypes;
 	XAie_BackendTilesRsc TilesRsc = {0};
 
 	if((UserRscNum == XAIE_NULL) || (DevInst == XAIE_NULL) ||
@@ -231,8 +248,16 @@ AieRC XAie_RequestSpecificBroadcastChannel(XAie_DevInst *DevInst, u32 BcId,
 	TilesRsc.RscId = BcId;
 	TilesRsc.Flags = BroadcastAllFlag;
 
+	/*
+	 * The channel has to be free on all the tiles of the request, so the
+	 * bitmaps of all their tile types are locked.
+	 */
+	TileTypes = BroadcastAllFlag ? XAIE_RSC_MGR_ALL_TILE_TYPES :
+		_XAie_RscMgr_GetTileTypes(DevInst, *UserRscNum, Rscs);
+	_XAie_RscMgr_Lock(DevInst, XAIE_BCAST_CHANNEL_RSC, TileTypes);
 	RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE,
 		(void *)&TilesRsc);
+	_XAie_RscMgr_Unlock(DevInst, XAIE_BCAST_CHANNEL_RSC, TileTypes);
 	if(RC != XAIE_OK) {
 		XAIE_ERROR("Broadcast channel:%d busy\n", BcId);
 		return XAIE_ERR;
@@ -270,6 +295,250 @@ AieRC XAie_ReleaseBroadcastChannel(XAie_DevInst *DevInst, u32 UserRscNum,
 	return _XAie_RscMgr_ReleaseRscs(DevInst, UserRscNum, Rscs,
 			XAIE_BCAST_CHANNEL_RSC);
 }
+
+/*****************************************************************************/
+/**
+* This API lists the modules of a resource region, for the backends which
+* allocate the resources themselves from a list of modules.
+*
+* @param	DevInst: Device Instance
+* @param	Region: Resource region, checked by the caller
+* @param	UserRscNum: Returns the size of the list
+*
+* @return	List of modules, to be freed by the caller, or NULL on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static XAie_UserRsc *_XAie_GetRegionRscs(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 *UserRscNum)
+{
+	XAie_ModuleType Mods[XAIE_RSC_REGION_MAX_TILE_MODS];
+	XAie_UserRsc *Rscs;
+	u32 Index = 0U;
+
+	Rscs = (XAie_UserRsc *)malloc((u32)Region->NumCols * Region->NumRows *
+			XAIE_RSC_REGION_MAX_TILE_MODS * sizeof(*Rscs));
+	if(Rscs == NULL) {
+		XAIE_ERROR("Unable to allocate memory for resource region\n");
+		return NULL;
+	}
+
+	for(u8 c = 0U; c < Region->NumCols; c++) {
+		for(u8 r = 0U; r < Region->NumRows; r++) {
+			XAie_LocType Loc = XAie_TileLoc(Region->Start.Col + c,
+					Region->Start.Row + r);
+			u8 NumMods;
+
+			NumMods = _XAie_RscMgr_GetRegionTileMods(DevInst,
+					Region, Loc, Mods);
+			for(u8 m = 0U; m < NumMods; m++) {
+				Rscs[Index].Loc = Loc;
+				Rscs[Index].Mod = Mods[m];
+				Rscs[Index].RscType = XAIE_BCAST_CHANNEL_RSC;
+				Index++;
+			}
+		}
+	}
+
+	*UserRscNum = Index;
+
+	return Rscs;
+}
+
+/*****************************************************************************/
+/**
+* This API runs a broadcast channel request or release of a resource region
+* with a list of its modules, for the backends which allocate the resources
+* themselves.
+*
+* @param	DevInst: Device Instance
+* @param	Region: Resource region, checked by the caller
+* @param	BcId: Channel to request if Op is
+*		XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE or to release.
+*		Returns the granted channel otherwise.
+* @param	Op: XAIE_BACKEND_OP_REQUEST_RESOURCE,
+*		XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE or
+*		XAIE_BACKEND_OP_RELEASE_RESOURCE
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BcRegionWithRscs(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 *BcId, XAie_BackendOpCode Op)
+{
+	XAie_UserRsc *Rscs;
+	u32 UserRscNum;
+	AieRC RC;
+
+	Rscs = _XAie_GetRegionRscs(DevInst, Region, &UserRscNum);
+	if(Rscs == NULL) {
+		return XAIE_ERR;
+	}
+
+	if(UserRscNum == 0U) {
+		XAIE_ERROR("No ungated module in resource region\n");
+		free(Rscs);
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Op == XAIE_BACKEND_OP_REQUEST_RESOURCE) {
+		RC = XAie_RequestBroadcastChannel(DevInst, &UserRscNum, Rscs,
+				0U);
+		if(RC == XAIE_OK) {
+			*BcId = Rscs[0].RscId;
+		}
+	} else if(Op == XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE) {
+		RC = XAie_RequestSpecificBroadcastChannel(DevInst, *BcId,
+				&UserRscNum, Rscs, 0U);
+	} else {
+		for(u32 i = 0U; i < UserRscNum; i++) {
+			Rscs[i].RscId = *BcId;
+		}
+		RC = XAie_ReleaseBroadcastChannel(DevInst, UserRscNum, Rscs);
+	}
+	free(Rscs);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to request a broadcast channel common to the modules
+* of a region of tiles. The API grants the channel based on availability and
+* marks it allocated on every module of the region.
+*
+* @param	DevInst: Device Instance
+* @param	Region: Rectangle of tiles and mask of the modules. Only the
+*		ungated tiles of the region are part of the request.
+* @param	BcId: Returns the granted broadcast channel
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if any argument is
+*		invalid and XAIE_ERR if no common channel is free.
+*
+* @note		Unlike XAie_RequestBroadcastChannel(), no list of the modules
+*		is built or returned, the bitmaps of the modules are checked
+*		and marked in place. The region has to be released with
+*		XAie_ReleaseBroadcastChannelRegion() while the same tiles are
+*		ungated.
+*
+*******************************************************************************/
+AieRC XAie_RequestBroadcastChannelRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 *BcId)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (BcId == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_RscMgr_CheckRegion(DevInst, Region);
+	if(RC != XAIE_OK)
+		return RC;
+
+	/* The partition driver owns the bitmaps of the Linux backend */
+	if(DevInst->Backend->Type == XAIE_IO_BACKEND_LINUX) {
+		return _XAie_BcRegionWithRscs(DevInst, Region, BcId,
+				XAIE_BACKEND_OP_REQUEST_RESOURCE);
+	}
+
+	RC = _XAie_RscMgr_RequestBcRegion(DevInst, Region, BcId, XAIE_DISABLE);
+	if(RC == XAIE_ERR) {
+		XAIE_ERROR("Unable to find free broadcast channel\n");
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to request a specific broadcast channel on the
+* modules of a region of tiles. The API grants the channel if it is available
+* on every module of the region and marks it allocated.
+*
+* @param	DevInst: Device Instance
+* @param	Region: Rectangle of tiles and mask of the modules. Only the
+*		ungated tiles of the region are part of the request.
+* @param	BcId: ID of the broadcast channel to be requested
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if any argument is
+*		invalid and XAIE_ERR if the channel is busy.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_RequestSpecificBroadcastChannelRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 BcId)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (BcId >= XAIE_NUM_BROADCAST_CHANNELS) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_RscMgr_CheckRegion(DevInst, Region);
+	if(RC != XAIE_OK)
+		return RC;
+
+	if(DevInst->Backend->Type == XAIE_IO_BACKEND_LINUX) {
+		return _XAie_BcRegionWithRscs(DevInst, Region, &BcId,
+				XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE);
+	}
+
+	RC = _XAie_RscMgr_RequestBcRegion(DevInst, Region, &BcId, XAIE_ENABLE);
+	if(RC == XAIE_ERR) {
+		XAIE_ERROR("Broadcast channel:%d busy\n", BcId);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to release a broadcast channel of the modules of a
+* region of tiles, requested with XAie_RequestBroadcastChannelRegion() or
+* XAie_RequestSpecificBroadcastChannelRegion().
+*
+* @param	DevInst: Device Instance
+* @param	Region: Region of the request
+* @param	BcId: Broadcast channel of the request
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if any argument is
+*		invalid.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_ReleaseBroadcastChannelRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 BcId)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (BcId >= XAIE_NUM_BROADCAST_CHANNELS) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_RscMgr_CheckRegion(DevInst, Region);
+	if(RC != XAIE_OK)
+		return RC;
+
+	if(DevInst->Backend->Type == XAIE_IO_BACKEND_LINUX) {
+		return _XAie_BcRegionWithRscs(DevInst, Region, &BcId,
+				XAIE_BACKEND_OP_RELEASE_RESOURCE);
+	}
+
+	_XAie_RscMgr_ReleaseBcRegion(DevInst, Region, BcId);
+
+	return XAIE_OK;
+}
 #endif /* XAIE_FEATURE_RSC_ENABLE */
 
 /** @} */
@@ -55,7 +55,7 @@ static XAie_Events _XAie_GetUserEventfromRscId(XAie_DevInst *DevInst,
 	u8 TileType;
 	const XAie_EvntMod *EvntMod;
 
-	TileType =  DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType =  _XAie_DevGetTTypefromLoc(DevInst, Loc);
 
 	if(Mod == XAIE_PL_MOD)
 		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
@@ -86,7 +86,7 @@ static u8 _XAie_GetRscIdfromUserEvents(XAie_DevInst *DevInst,
 	u8 TileType;
 	const XAie_EvntMod *EvntMod;
 
-	TileType =  DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType =  _XAie_DevGetTTypefromLoc(DevInst, Loc);
 
 	if(Mod == XAIE_PL_MOD)
 		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
@@ -116,7 +116,7 @@ static XAie_Events _XAie_GetPCEventfromRscId(XAie_DevInst *DevInst,
 	u8 TileType;
 	const XAie_EvntMod *EvntMod;
 
-	TileType =  DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType =  _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
 
 	return EvntMod->PCEventMap->Event + RscId -
@@ -143,7 +143,7 @@ static u8 _XAie_GetRscIdfromPCEvents(XAie_DevInst *DevInst,
 	u8 TileType;
 	const XAie_EvntMod *EvntMod;
 
-	TileType =  DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType =  _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
 
 	return Event - EvntMod->PCEventMap->Event;
@@ -352,7 +352,7 @@ AieRC XAie_RequestAllocatedUserEvents(XAie_DevInst *DevInst, u32 NumReq,
 	/* Check validity of the user events passed by the user */
 	for(u32 i = 0U; i < NumReq; i++) {
 		RC = _XAie_CheckEventValidity(DevInst,
-				DevInst->DevOps->GetTTypefromLoc(DevInst, RscReq[i].Loc),
+				_XAie_DevGetTTypefromLoc(DevInst, RscReq[i].Loc),
 				RscReq[i].Mod, RscReq[i].RscId);
 		if(RC != XAIE_OK)
 			return RC;
@@ -530,7 +530,7 @@ AieRC XAie_RequestAllocatedPCEvents(XAie_DevInst *DevInst, u32 NumReq,
 	/* Check validity of the user events passed by the user */
 	for(u32 i = 0U; i < NumReq; i++) {
 		RC = _XAie_CheckEventValidity(DevInst,
-				DevInst->DevOps->GetTTypefromLoc(DevInst, RscReq[i].Loc),
+				_XAie_DevGetTTypefromLoc(DevInst, RscReq[i].Loc),
 				RscReq[i].Mod, RscReq[i].RscId);
 		if(RC != XAIE_OK)
 			return RC;
@@ -704,7 +704,7 @@ static u8 _XAie_GetRscIdfromGroupEvents(XAie_DevInst *DevInst,
 	u8 TileType;
 	const XAie_EvntMod *EvntMod;
 
-	TileType =  DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType =  _XAie_DevGetTTypefromLoc(DevInst, Loc);
 
 	if(Mod == XAIE_PL_MOD)
 		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
@@ -751,7 +751,7 @@ AieRC XAie_RequestAllocatedGroupEvents(XAie_DevInst *DevInst, u32 NumReq,
 	/* Check validity of the user events passed by the user */
 	for(u32 i = 0U; i < NumReq; i++) {
 		RC = _XAie_CheckEventValidity(DevInst,
-				DevInst->DevOps->GetTTypefromLoc(DevInst,
+				_XAie_DevGetTTypefromLoc(DevInst,
 					RscReq[i].Loc), RscReq[i].Mod,
 				RscReq[i].RscId);
 		if(RC != XAIE_OK)
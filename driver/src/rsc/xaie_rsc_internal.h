@@ -29,6 +29,13 @@
 
 /************************** Macro Definitions ********************************/
 #define XAIE_NUM_BROADCAST_CHANNELS     16U
+#define XAIE_RSC_WORD_BITS		32U
+#define XAIE_RSC_WORD_MASK(NumBits)	((u32)((1ULL << (NumBits)) - 1U))
+/* Tile types with their own bitmaps, shim NoC tiles use the shim PL ones */
+#define XAIE_RSC_MGR_ALL_TILE_TYPES	(((1U << XAIEGBL_TILE_TYPE_MAX) - 1U) & \
+					 ~(1U << XAIEGBL_TILE_TYPE_SHIMNOC))
+/* Modules of a tile in a resource region, the core and memory of AIE tiles */
+#define XAIE_RSC_REGION_MAX_TILE_MODS	2U
 
 /************************** Enum *********************************************/
 /**************************** Type Definitions *******************************/
@@ -161,6 +168,81 @@ static inline void _XAie_MarkChannelBitmapAndRscId(XAie_DevInst *DevInst,
 	(void)ChannelIndex;
 	return;
 }
+static inline void _XAie_RscMgr_TrackBcChannelBit(XAie_DevInst *DevInst,
+		u8 TileType, u32 Bit, u8 WasSet) {
+	(void)DevInst;
+	(void)TileType;
+	(void)Bit;
+	(void)WasSet;
+	return;
+}
+static inline u32 _XAie_RscMgr_GetBcChannelsInUse(XAie_DevInst *DevInst) {
+	(void)DevInst;
+	return 0U;
+}
+static inline u32 _XAie_RscMgr_GetTileTypes(XAie_DevInst *DevInst,
+		u32 RscNum, const XAie_UserRsc *Rscs) {
+	(void)DevInst;
+	(void)RscNum;
+	(void)Rscs;
+	return 0U;
+}
+static inline u32 _XAie_RscMgr_GetBcCheckMask(XAie_DevInst *DevInst,
+		u8 Policy) {
+	(void)DevInst;
+	(void)Policy;
+	return 0U;
+}
+static inline AieRC _XAie_RscMgr_CheckRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region) {
+	(void)DevInst;
+	(void)Region;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline u8 _XAie_RscMgr_GetRegionTileMods(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, XAie_LocType Loc,
+		XAie_ModuleType *Mods) {
+	(void)DevInst;
+	(void)Region;
+	(void)Loc;
+	(void)Mods;
+	return 0U;
+}
+static inline u32 _XAie_RscMgr_GetRegionTileTypes(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region) {
+	(void)DevInst;
+	(void)Region;
+	return 0U;
+}
+static inline AieRC _XAie_RscMgr_RequestBcRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 *BcId, u8 Specific) {
+	(void)DevInst;
+	(void)Region;
+	(void)BcId;
+	(void)Specific;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline void _XAie_RscMgr_ReleaseBcRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 BcId) {
+	(void)DevInst;
+	(void)Region;
+	(void)BcId;
+	return;
+}
+static inline void _XAie_RscMgr_Lock(XAie_DevInst *DevInst,
+		XAie_RscType RscType, u32 TileTypes) {
+	(void)DevInst;
+	(void)RscType;
+	(void)TileTypes;
+	return;
+}
+static inline void _XAie_RscMgr_Unlock(XAie_DevInst *DevInst,
+		XAie_RscType RscType, u32 TileTypes) {
+	(void)DevInst;
+	(void)RscType;
+	(void)TileTypes;
+	return;
+}
 #else /* !XAIE_RSC_DISABLE */
 /* Global resource management APIs */
 AieRC _XAie_RscMgrInit(XAie_DevInst *DevInst);
@@ -195,6 +277,27 @@ void _XAie_RscMgr_GetBitmapOffsets(XAie_DevInst *DevInst, XAie_RscType RscType,
 		XAie_BitmapOffsets *Offsets);
 void _XAie_MarkChannelBitmapAndRscId(XAie_DevInst *DevInst, u32 UserRscNum,
 		XAie_UserRsc *Rscs, u32 ChannelIndex);
+void _XAie_RscMgr_TrackBcChannelBit(XAie_DevInst *DevInst, u8 TileType,
+		u32 Bit, u8 WasSet);
+u32 _XAie_RscMgr_GetBcChannelsInUse(XAie_DevInst *DevInst);
+u32 _XAie_RscMgr_GetTileTypes(XAie_DevInst *DevInst, u32 RscNum,
+		const XAie_UserRsc *Rscs);
+u32 _XAie_RscMgr_GetBcCheckMask(XAie_DevInst *DevInst, u8 Policy);
+AieRC _XAie_RscMgr_CheckRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region);
+u8 _XAie_RscMgr_GetRegionTileMods(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, XAie_LocType Loc,
+		XAie_ModuleType *Mods);
+u32 _XAie_RscMgr_GetRegionTileTypes(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region);
+AieRC _XAie_RscMgr_RequestBcRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 *BcId, u8 Specific);
+void _XAie_RscMgr_ReleaseBcRegion(XAie_DevInst *DevInst,
+		const XAie_RscRegion *Region, u32 BcId);
+void _XAie_RscMgr_Lock(XAie_DevInst *DevInst, XAie_RscType RscType,
+		u32 TileTypes);
+void _XAie_RscMgr_Unlock(XAie_DevInst *DevInst, XAie_RscType RscType,
+		u32 TileTypes);
 #endif /* XAIE_RSC_DISABLE */
 
 /*****************************************************************************/
@@ -253,4 +356,58 @@ static inline u32 _XAie_GetTileRscStartBitPosFromLoc(u32 BitmapNumRows,
 	return ((Loc.Col * BitmapNumRows + (Loc.Row - StartRow)) * MaxRscVal);
 }
 
+/*****************************************************************************/
+/**
+* This API extracts up to a word of bits from a bitmap, starting at any bit.
+*
+* @param	Bitmap: Bitmap of the resource
+* @param	Pos: Index of the first bit
+* @param	NumBits: Number of bits, from 1 to 32
+*
+* @return	Bits Pos to Pos + NumBits - 1 of the bitmap, in the low bits.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u32 _XAie_GetBitmapWord(const u32 *Bitmap, u32 Pos,
+		u32 NumBits)
+{
+	u32 Word = Pos / XAIE_RSC_WORD_BITS;
+	u32 Shift = Pos % XAIE_RSC_WORD_BITS;
+	u64 Bits = Bitmap[Word] >> Shift;
+
+	if(Shift + NumBits > XAIE_RSC_WORD_BITS) {
+		Bits |= (u64)Bitmap[Word + 1U] << (XAIE_RSC_WORD_BITS - Shift);
+	}
+
+	return (u32)Bits & XAIE_RSC_WORD_MASK(NumBits);
+}
+
+/*****************************************************************************/
+/**
+* This API sets up to a word of bits of a bitmap, starting at any bit.
+*
+* @param	Bitmap: Bitmap of the resource
+* @param	Pos: Index of the first bit
+* @param	Bits: Bits to set, in the low NumBits bits
+* @param	NumBits: Number of bits, from 1 to 32
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline void _XAie_OrBitmapWord(u32 *Bitmap, u32 Pos, u32 Bits,
+		u32 NumBits)
+{
+	u32 Word = Pos / XAIE_RSC_WORD_BITS;
+	u32 Shift = Pos % XAIE_RSC_WORD_BITS;
+
+	Bits &= XAIE_RSC_WORD_MASK(NumBits);
+	Bitmap[Word] |= Bits << Shift;
+	if(Shift + NumBits > XAIE_RSC_WORD_BITS) {
+		Bitmap[Word + 1U] |= Bits >> (XAIE_RSC_WORD_BITS - Shift);
+	}
+}
+
 #endif		/* end of protection macro */
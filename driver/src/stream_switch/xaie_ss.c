@@ -33,6 +33,8 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+
 #include "xaie_events.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
@@ -53,6 +55,68 @@
 
 #define XAIE_SS_DETERMINISTIC_MERGE_MAX_PKT_CNT (64U - 1U) /* 6 bits */
 
+#define XAIE_SS_ROUTE_NUM_ARBITORS		6U
+#define XAIE_SS_ROUTE_NUM_MSELS			(XAIE_SS_MSEL_MAX + 1U)
+#define XAIE_SS_ROUTE_MAX_PKT_MSTRS		32U	/* Bits of a set mask */
+
+/**************************** Type Definitions *******************************/
+/* Flow of a route, sorted by tile during compilation */
+typedef struct {
+	u32 Tile;	/* Column and row of the flow */
+	u32 Idx;	/* Index of the flow in the array of the caller */
+} XAie_StrmRouteFlowKey;
+
+/* Master port of a tile used by a route */
+typedef struct {
+	u32 Off;
+	StrmSwPortType Type;
+	u8 PortNum;
+	u8 PktEn;
+	u8 DropHeader;
+	u8 Config;	/* Slave index for circuit, arbitor for packet switch */
+	u8 MSelEn;	/* Msels the master port takes, packet switch only */
+} XAie_StrmRouteMstr;
+
+/* Slave port of a tile used by a route */
+typedef struct {
+	u32 Off;
+	StrmSwPortType Type;
+	u8 PortNum;
+	u8 PktEn;
+	u8 NumSlots;
+} XAie_StrmRouteSlv;
+
+/* Slave slot of a tile used by a route */
+typedef struct {
+	XAie_StrmRouteSlv *Slv;
+	u32 MstrMask;	/* Master ports the packet id is routed to */
+	u32 Set;	/* Index of the master port set of MstrMask */
+	u8 PktId;
+	u8 Mask;
+	u8 Arbitor;
+	u8 MSel;
+	u8 SlotNum;
+} XAie_StrmRouteSlot;
+
+/* Set of master ports packets are routed to, with its arbitor and msel */
+typedef struct {
+	u32 MstrMask;
+	u32 Load;	/* Number of packet ids routed to the set */
+	u8 Root;	/* Master port of the group of sets sharing masters */
+	u8 MSel;
+} XAie_StrmRoutePktSet;
+
+/* Stream switch state of one tile while a route is compiled */
+typedef struct {
+	XAie_StrmRouteMstr *Mstrs;
+	XAie_StrmRouteSlv *Slvs;
+	XAie_StrmRouteSlot *Slots;
+	XAie_StrmRoutePktSet *Sets;
+	u32 NumMstrs;
+	u32 NumSlvs;
+	u32 NumSlots;
+} XAie_StrmRouteTile;
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -209,7 +273,7 @@ static AieRC _XAie_StreamSwitchConfigureCct(XAie_DevInst *DevInst,
 		return XAIE_ERR_STREAM_PORT;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -358,7 +422,7 @@ static AieRC _XAie_StrmSlavePortConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_ERR_STREAM_PORT;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -488,7 +552,7 @@ static AieRC _XAie_StrmPktSwMstrPortConfig(XAie_DevInst *DevInst,
 		return XAIE_ERR_STREAM_PORT;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -621,7 +685,7 @@ static AieRC _XAie_StrmSlaveSlotConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -753,7 +817,7 @@ AieRC XAie_StrmSwLogicalToPhysicalPort(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_ERR_STREAM_PORT;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		return XAIE_INVALID_TILE;
 	}
@@ -809,7 +873,7 @@ AieRC XAie_StrmSwPhysicalToLogicalPort(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_ERR_STREAM_PORT;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		return XAIE_INVALID_TILE;
 	}
@@ -871,7 +935,7 @@ AieRC XAie_StrmSwDeterministicMergeConfig(XAie_DevInst *DevInst,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -958,7 +1022,7 @@ static AieRC _XAie_StrmSwDeterministicMergeCtrl(XAie_DevInst *DevInst,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1029,5 +1093,1151 @@ AieRC XAie_StrmSwDeterministicMergeDisable(XAie_DevInst *DevInst,
 			XAIE_DISABLE);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API compares two flows of a route by tile and then by their position
+* in the array of the caller.
+*
+* @param	A: Pointer to the first flow key.
+* @param	B: Pointer to the second flow key.
+*
+* @return	Negative, zero or positive as per qsort().
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static int _XAie_StrmRouteFlowCmp(const void *A, const void *B)
+{
+	const XAie_StrmRouteFlowKey *KA = (const XAie_StrmRouteFlowKey *)A;
+	const XAie_StrmRouteFlowKey *KB = (const XAie_StrmRouteFlowKey *)B;
+
+	if(KA->Tile != KB->Tile) {
+		return (KA->Tile < KB->Tile) ? -1 : 1;
+	}
+
+	return (KA->Idx < KB->Idx) ? -1 : (KA->Idx > KB->Idx);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API compares two register writes of a route by address.
+*
+* @param	A: Pointer to the first register write.
+* @param	B: Pointer to the second register write.
+*
+* @return	Negative, zero or positive as per qsort().
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static int _XAie_StrmRouteRegCmp(const void *A, const void *B)
+{
+	const XAie_StrmRouteReg *RA = (const XAie_StrmRouteReg *)A;
+	const XAie_StrmRouteReg *RB = (const XAie_StrmRouteReg *)B;
+
+	return (RA->RegAddr < RB->RegAddr) ? -1 :
+		(RA->RegAddr > RB->RegAddr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API resolves the flows of one tile of a route into the state of its
+* master ports, slave ports and slave slots, and checks them for conflicts.
+*
+* @param	StrmMod: Stream switch module of the tile.
+* @param	Flow: Flow to add to the state of the tile.
+* @param	State: State of the tile.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouteAddFlow(const XAie_StrmMod *StrmMod,
+		const XAie_StrmFlow *Flow, XAie_StrmRouteTile *State)
+{
+	AieRC RC;
+	u8 SlaveIdx;
+	u32 MstrOff, SlvOff, RegVal, i;
+	XAie_StrmRouteMstr *Mstr = NULL;
+	XAie_StrmRouteSlv *Slv = NULL;
+
+	if((Flow->Slave >= SS_PORT_TYPE_MAX) ||
+			(Flow->Master >= SS_PORT_TYPE_MAX)) {
+		XAIE_ERROR("Invalid Stream Switch Ports\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	if((Flow->PktEn == XAIE_ENABLE) &&
+			((Flow->PktId > XAIE_PACKET_ID_MAX) ||
+			 (Flow->DropHeader > XAIE_SS_PKT_DROP_HEADER))) {
+		XAIE_ERROR("Invalid packet id or drop header\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _StrmConfigMstr(StrmMod, Flow->Master, Flow->MstrPortNum,
+			XAIE_DISABLE, XAIE_DISABLE, 0U, &RegVal, &MstrOff);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_StrmConfigSlv(StrmMod, Flow->Slave, Flow->SlvPortNum,
+			XAIE_DISABLE, XAIE_DISABLE, &RegVal, &SlvOff);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Flow->PktEn != XAIE_ENABLE) {
+		RC = StrmMod->PortVerify(Flow->Slave, Flow->SlvPortNum,
+				Flow->Master, Flow->MstrPortNum);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Slave port(Type: %d, Number: %d) can't connect to Master port(Type: %d, Number: %d).\n",
+					Flow->Slave, Flow->SlvPortNum,
+					Flow->Master, Flow->MstrPortNum);
+			return RC;
+		}
+
+		RC = _XAie_GetSlaveIdx(StrmMod, Flow->Slave, Flow->SlvPortNum,
+				&SlaveIdx);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to compute Slave Index\n");
+			return RC;
+		}
+	}
+
+	for(i = 0U; i < State->NumMstrs; i++) {
+		if(State->Mstrs[i].Off == MstrOff) {
+			Mstr = &State->Mstrs[i];
+			break;
+		}
+	}
+
+	for(i = 0U; i < State->NumSlvs; i++) {
+		if(State->Slvs[i].Off == SlvOff) {
+			Slv = &State->Slvs[i];
+			break;
+		}
+	}
+
+	if(((Mstr != NULL) && (Mstr->PktEn != Flow->PktEn)) ||
+			((Slv != NULL) && (Slv->PktEn != Flow->PktEn))) {
+		XAIE_ERROR("Port used in both circuit and packet switch mode\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	if(Mstr == NULL) {
+		Mstr = &State->Mstrs[State->NumMstrs++];
+		Mstr->Off = MstrOff;
+		Mstr->Type = Flow->Master;
+		Mstr->PortNum = Flow->MstrPortNum;
+		Mstr->PktEn = Flow->PktEn;
+		Mstr->DropHeader = (u8)Flow->DropHeader;
+		Mstr->Config = (Flow->PktEn != XAIE_ENABLE) ? SlaveIdx : 0U;
+		Mstr->MSelEn = 0U;
+	} else if(Flow->PktEn != XAIE_ENABLE) {
+		if(Mstr->Config != SlaveIdx) {
+			XAIE_ERROR("Master port driven by two slave ports\n");
+			return XAIE_ERR_STREAM_PORT;
+		}
+	} else if(Mstr->DropHeader != (u8)Flow->DropHeader) {
+		XAIE_ERROR("Conflicting drop header on master port\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	if(Slv == NULL) {
+		Slv = &State->Slvs[State->NumSlvs++];
+		Slv->Off = SlvOff;
+		Slv->Type = Flow->Slave;
+		Slv->PortNum = Flow->SlvPortNum;
+		Slv->PktEn = Flow->PktEn;
+		Slv->NumSlots = 0U;
+	}
+
+	if(Flow->PktEn != XAIE_ENABLE) {
+		return XAIE_OK;
+	}
+
+	i = (u32)(Mstr - State->Mstrs);
+	if(i >= XAIE_SS_ROUTE_MAX_PKT_MSTRS) {
+		XAIE_ERROR("Too many master ports in the tile\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	/* Packet ids routed to several master ports are merged later */
+	State->Slots[State->NumSlots].Slv = Slv;
+	State->Slots[State->NumSlots].MstrMask = 1U << i;
+	State->Slots[State->NumSlots].PktId = Flow->PktId;
+	State->NumSlots++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the root of the group of a master port, compressing the
+* path on the way.
+*
+* @param	Parent: Parent of each master port.
+* @param	Idx: Index of the master port.
+*
+* @return	Index of the root master port.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_StrmRouteFindRoot(u8 *Parent, u8 Idx)
+{
+	while(Parent[Idx] != Idx) {
+		Parent[Idx] = Parent[Parent[Idx]];
+		Idx = Parent[Idx];
+	}
+
+	return Idx;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the index of the first master port of a set.
+*
+* @param	MstrMask: Mask of the master ports of the set, not 0.
+*
+* @return	Index of the lowest bit set.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_StrmRouteFirstMstr(u32 MstrMask)
+{
+	u8 Idx = 0U;
+
+	while((MstrMask & (1U << Idx)) == 0U) {
+		Idx++;
+	}
+
+	return Idx;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API allocates the arbitors, msels and slave slots of the packet
+* switched flows of one tile of a route.
+*
+* Each packet id of a slave port is routed to a set of master ports. Master
+* ports sharing a set have to share an arbitor and each set of an arbitor
+* takes one of its msels, the master ports of a set enable its msel. Groups of
+* master ports with no set in common get an arbitor each, so a stalled master
+* port does not block the others, until the arbitors run out. Then the
+* groups, the most loaded first, share the least loaded arbitor with msels
+* left. Finally, the slots of a slave port which lead to the same set and
+* whose packet ids differ by one bit are merged with the slot mask.
+*
+* @param	StrmMod: Stream switch module of the tile.
+* @param	State: State of the tile, with one slot per packet flow.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouteAllocPkt(const XAie_StrmMod *StrmMod,
+		XAie_StrmRouteTile *State)
+{
+	u8 Parent[XAIE_SS_ROUTE_MAX_PKT_MSTRS];
+	u8 ClusterArb[XAIE_SS_ROUTE_MAX_PKT_MSTRS];
+	u32 ClusterLoad[XAIE_SS_ROUTE_MAX_PKT_MSTRS];
+	u32 ClusterSets[XAIE_SS_ROUTE_MAX_PKT_MSTRS];
+	u32 ArbLoad[XAIE_SS_ROUTE_NUM_ARBITORS] = {0U};
+	u32 ArbSels[XAIE_SS_ROUTE_NUM_ARBITORS] = {0U};
+	u32 NumSlots = 0U, NumSets = 0U, NumArbs = 0U, NumMstrs;
+	u8 Merged;
+
+	if(State->NumSlots == 0U) {
+		return XAIE_OK;
+	}
+
+	/* Merge the master ports of the same packet id of a slave port */
+	for(u32 i = 0U; i < State->NumSlots; i++) {
+		XAie_StrmRouteSlot *Slot = &State->Slots[i];
+		u32 j;
+
+		for(j = 0U; j < NumSlots; j++) {
+			if((State->Slots[j].Slv == Slot->Slv) &&
+					(State->Slots[j].PktId ==
+					 Slot->PktId)) {
+				State->Slots[j].MstrMask |= Slot->MstrMask;
+				break;
+			}
+		}
+
+		if(j == NumSlots) {
+			State->Slots[NumSlots++] = *Slot;
+		}
+	}
+	State->NumSlots = NumSlots;
+
+	NumMstrs = (State->NumMstrs < XAIE_SS_ROUTE_MAX_PKT_MSTRS) ?
+		State->NumMstrs : XAIE_SS_ROUTE_MAX_PKT_MSTRS;
+	for(u32 i = 0U; i < NumMstrs; i++) {
+		Parent[i] = (u8)i;
+		ClusterArb[i] = XAIE_SS_ROUTE_NUM_ARBITORS;
+		ClusterLoad[i] = 0U;
+		ClusterSets[i] = 0U;
+	}
+
+	/* Distinct master port sets, grouped when they share master ports */
+	for(u32 i = 0U; i < State->NumSlots; i++) {
+		XAie_StrmRouteSlot *Slot = &State->Slots[i];
+		u32 j;
+
+		for(j = 0U; j < NumSets; j++) {
+			if(State->Sets[j].MstrMask == Slot->MstrMask) {
+				break;
+			}
+		}
+
+		if(j == NumSets) {
+			State->Sets[j].MstrMask = Slot->MstrMask;
+			State->Sets[j].Load = 0U;
+			NumSets++;
+		}
+		State->Sets[j].Load++;
+		Slot->Set = j;
+	}
+
+	for(u32 i = 0U; i < NumSets; i++) {
+		u32 Mask = State->Sets[i].MstrMask;
+		u8 First = _XAie_StrmRouteFirstMstr(Mask);
+
+		for(u8 m = First + 1U; m < NumMstrs; m++) {
+			if((Mask & (1U << m)) != 0U) {
+				Parent[_XAie_StrmRouteFindRoot(Parent, m)] =
+					_XAie_StrmRouteFindRoot(Parent, First);
+			}
+		}
+	}
+
+	for(u32 i = 0U; i < NumSets; i++) {
+		XAie_StrmRoutePktSet *Set = &State->Sets[i];
+
+		Set->Root = _XAie_StrmRouteFindRoot(Parent,
+				_XAie_StrmRouteFirstMstr(Set->MstrMask));
+		ClusterLoad[Set->Root] += Set->Load;
+		ClusterSets[Set->Root]++;
+	}
+
+	/* Place the groups of master ports, the most loaded first */
+	for(;;) {
+		u32 Best = XAIE_SS_ROUTE_MAX_PKT_MSTRS, Arb;
+
+		for(u32 i = 0U; i < NumMstrs; i++) {
+			if((ClusterSets[i] != 0U) &&
+					(ClusterArb[i] ==
+					 XAIE_SS_ROUTE_NUM_ARBITORS) &&
+					((Best == XAIE_SS_ROUTE_MAX_PKT_MSTRS) ||
+					 (ClusterLoad[i] > ClusterLoad[Best]))) {
+				Best = i;
+			}
+		}
+
+		if(Best == XAIE_SS_ROUTE_MAX_PKT_MSTRS) {
+			break;
+		}
+
+		Arb = XAIE_SS_ROUTE_NUM_ARBITORS;
+		if(NumArbs < XAIE_SS_ROUTE_NUM_ARBITORS) {
+			Arb = NumArbs++;
+		} else {
+			for(u32 a = 0U; a < XAIE_SS_ROUTE_NUM_ARBITORS; a++) {
+				if((ArbSels[a] + ClusterSets[Best] <=
+						XAIE_SS_ROUTE_NUM_MSELS) &&
+						((Arb ==
+						  XAIE_SS_ROUTE_NUM_ARBITORS) ||
+						 (ArbLoad[a] < ArbLoad[Arb]))) {
+					Arb = a;
+				}
+			}
+		}
+
+		if((Arb == XAIE_SS_ROUTE_NUM_ARBITORS) ||
+				(ArbSels[Arb] + ClusterSets[Best] >
+				 XAIE_SS_ROUTE_NUM_MSELS)) {
+			XAIE_ERROR("No free stream switch arbitor\n");
+			return XAIE_ERR_STREAM_PORT;
+		}
+
+		ClusterArb[Best] = (u8)Arb;
+		ArbLoad[Arb] += ClusterLoad[Best];
+		ArbSels[Arb] += ClusterSets[Best];
+	}
+
+	/* Hand out the msels of each arbitor to its sets */
+	for(u32 a = 0U; a < XAIE_SS_ROUTE_NUM_ARBITORS; a++) {
+		ArbSels[a] = 0U;
+	}
+
+	for(u32 i = 0U; i < NumSets; i++) {
+		XAie_StrmRoutePktSet *Set = &State->Sets[i];
+		u8 Arb = ClusterArb[Set->Root];
+
+		Set->MSel = (u8)ArbSels[Arb]++;
+		for(u8 m = 0U; m < NumMstrs; m++) {
+			if((Set->MstrMask & (1U << m)) != 0U) {
+				State->Mstrs[m].Config = Arb;
+				State->Mstrs[m].MSelEn |= (u8)(1U << Set->MSel);
+			}
+		}
+	}
+
+	for(u32 i = 0U; i < State->NumSlots; i++) {
+		XAie_StrmRouteSlot *Slot = &State->Slots[i];
+
+		Slot->Arbitor = ClusterArb[State->Sets[Slot->Set].Root];
+		Slot->MSel = State->Sets[Slot->Set].MSel;
+		Slot->Mask = XAIE_SS_MASK;
+	}
+
+	/* Merge the slots whose packet ids differ by one bit */
+	do {
+		Merged = XAIE_DISABLE;
+		for(u32 i = 0U; i < State->NumSlots; i++) {
+			XAie_StrmRouteSlot *A = &State->Slots[i];
+
+			for(u32 j = i + 1U; j < State->NumSlots; j++) {
+				XAie_StrmRouteSlot *B = &State->Slots[j];
+				u8 Diff = (A->PktId ^ B->PktId) & A->Mask;
+
+				if((A->Slv != B->Slv) || (A->Set != B->Set) ||
+						(A->Mask != B->Mask) ||
+						(Diff == 0U) ||
+						((Diff & (Diff - 1U)) != 0U)) {
+					continue;
+				}
+
+				A->Mask &= (u8)~Diff;
+				A->PktId &= A->Mask;
+				State->Slots[j] =
+					State->Slots[--State->NumSlots];
+				Merged = XAIE_ENABLE;
+				break;
+			}
+		}
+	} while(Merged == XAIE_ENABLE);
+
+	for(u32 i = 0U; i < State->NumSlots; i++) {
+		XAie_StrmRouteSlot *Slot = &State->Slots[i];
+
+		if(Slot->Slv->NumSlots == StrmMod->NumSlaveSlots) {
+			XAIE_ERROR("No free slot on slave port(Type: %d, Number: %d)\n",
+					Slot->Slv->Type, Slot->Slv->PortNum);
+			return XAIE_ERR_STREAM_PORT;
+		}
+		Slot->SlotNum = Slot->Slv->NumSlots++;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API emits the register writes of the state of one tile of a route.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @param	StrmMod: Stream switch module of the tile.
+* @param	State: State of the tile.
+* @param	Regs: Array to append the register writes to.
+* @param	NumRegs: Pointer to the number of writes in Regs, updated.
+*
+* @return	None.
+*
+* @note		Internal only. The ports of the state have been validated.
+*
+*******************************************************************************/
+static void _XAie_StrmRouteEmitTile(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_StrmMod *StrmMod, const XAie_StrmRouteTile *State,
+		XAie_StrmRouteReg *Regs, u32 *NumRegs)
+{
+	u64 TileAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	u32 RegOff, RegVal, Config;
+
+	for(u32 i = 0U; i < State->NumMstrs; i++) {
+		const XAie_StrmRouteMstr *Mstr = &State->Mstrs[i];
+
+		Config = Mstr->Config;
+		if(Mstr->PktEn == XAIE_ENABLE) {
+			Config = XAie_SetField(Mstr->DropHeader,
+					StrmMod->DrpHdr.Lsb,
+					StrmMod->DrpHdr.Mask) |
+				XAie_SetField(Mstr->Config,
+					XAIE_SS_MASTER_PORT_ARBITOR_LSB,
+					XAIE_SS_MASTER_PORT_ARBITOR_MASK) |
+				XAie_SetField(Mstr->MSelEn,
+					XAIE_SS_MASTER_PORT_MSELEN_LSB,
+					XAIE_SS_MASTER_PORT_MSELEN_MASK);
+		}
+
+		(void)_StrmConfigMstr(StrmMod, Mstr->Type, Mstr->PortNum,
+				XAIE_ENABLE, Mstr->PktEn, (u8)Config, &RegVal,
+				&RegOff);
+		Regs[*NumRegs].RegAddr = TileAddr + RegOff;
+		Regs[*NumRegs].RegVal = RegVal;
+		(*NumRegs)++;
+	}
+
+	for(u32 i = 0U; i < State->NumSlvs; i++) {
+		const XAie_StrmRouteSlv *Slv = &State->Slvs[i];
+
+		(void)_XAie_StrmConfigSlv(StrmMod, Slv->Type, Slv->PortNum,
+				XAIE_ENABLE, Slv->PktEn, &RegVal, &RegOff);
+		Regs[*NumRegs].RegAddr = TileAddr + RegOff;
+		Regs[*NumRegs].RegVal = RegVal;
+		(*NumRegs)++;
+	}
+
+	for(u32 i = 0U; i < State->NumSlots; i++) {
+		const XAie_StrmRouteSlot *Slot = &State->Slots[i];
+
+		Regs[*NumRegs].RegAddr = TileAddr +
+			StrmMod->SlvSlotConfig[Slot->Slv->Type].PortBaseAddr +
+			Slot->Slv->PortNum * StrmMod->SlotOffsetPerPort +
+			Slot->SlotNum * StrmMod->SlotOffset;
+		Regs[*NumRegs].RegVal = XAie_SetField(Slot->PktId,
+				StrmMod->SlotPktId.Lsb,
+				StrmMod->SlotPktId.Mask) |
+			XAie_SetField(Slot->Mask, StrmMod->SlotMask.Lsb,
+					StrmMod->SlotMask.Mask) |
+			XAie_SetField(XAIE_ENABLE, StrmMod->SlotEn.Lsb,
+					StrmMod->SlotEn.Mask) |
+			XAie_SetField(Slot->MSel, StrmMod->SlotMsel.Lsb,
+					StrmMod->SlotMsel.Mask) |
+			XAie_SetField(Slot->Arbitor,
+					StrmMod->SlotArbitor.Lsb,
+					StrmMod->SlotArbitor.Mask);
+		(*NumRegs)++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API compiles a set of stream switch flows into the register writes
+* which configure them. The flows of each tile are resolved into the
+* configuration of its master ports, slave ports and slave slots, and checked
+* for conflicts, before any register is written. The compiled route can be
+* applied and cleared any number of times, so the flows of a graph only need
+* to be compiled once.
+*
+* @param	DevInst: Device Instance
+* @param	Route: Pointer to the route to compile to.
+* @param	Flows: Array of flows. In circuit switch mode, a slave port can
+*		drive several master ports but a master port is driven by one
+*		slave port. In packet switch mode, a packet id of a slave port
+*		can be routed to several master ports. The packet ids of a
+*		slave port take its slots, ids with the same master ports are
+*		merged into one slot when they differ by one bit, and the
+*		master ports share the arbitors of the tile as needed.
+* @param	NumFlows: Number of flows in Flows.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Duplicate flows are ignored. A port cannot be used in both
+*		circuit and packet switch mode. The route has to be released
+*		with XAie_StrmRouteFree().
+*
+*******************************************************************************/
+AieRC XAie_StrmRouteCompile(XAie_DevInst *DevInst, XAie_StrmRoute *Route,
+		const XAie_StrmFlow *Flows, u32 NumFlows)
+{
+	AieRC RC = XAIE_OK;
+	u8 TileType;
+	u32 First, Last, NumRegs = 0U;
+	const XAie_StrmMod *StrmMod;
+	XAie_StrmRouteFlowKey *Keys;
+	XAie_StrmRouteReg *Regs;
+	XAie_StrmRouteTile State;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Route == XAIE_NULL) || (Flows == NULL) || (NumFlows == 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Keys = (XAie_StrmRouteFlowKey *)malloc(NumFlows * sizeof(*Keys));
+	Regs = (XAie_StrmRouteReg *)malloc(3U * NumFlows * sizeof(*Regs));
+	State.Mstrs = (XAie_StrmRouteMstr *)malloc(NumFlows *
+			sizeof(*State.Mstrs));
+	State.Slvs = (XAie_StrmRouteSlv *)malloc(NumFlows *
+			sizeof(*State.Slvs));
+	State.Slots = (XAie_StrmRouteSlot *)malloc(NumFlows *
+			sizeof(*State.Slots));
+	State.Sets = (XAie_StrmRoutePktSet *)malloc(NumFlows *
+			sizeof(*State.Sets));
+	if((Keys == NULL) || (Regs == NULL) || (State.Mstrs == NULL) ||
+			(State.Slvs == NULL) || (State.Slots == NULL) ||
+			(State.Sets == NULL)) {
+		XAIE_ERROR("Memory allocation for route failed\n");
+		RC = XAIE_ERR;
+		goto Exit;
+	}
+
+	for(u32 i = 0U; i < NumFlows; i++) {
+		Keys[i].Tile = ((u32)Flows[i].Loc.Col << 8U) | Flows[i].Loc.Row;
+		Keys[i].Idx = i;
+	}
+	qsort(Keys, NumFlows, sizeof(*Keys), _XAie_StrmRouteFlowCmp);
+
+	for(First = 0U; First < NumFlows; First = Last) {
+		XAie_LocType Loc = Flows[Keys[First].Idx].Loc;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+		if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+			XAIE_ERROR("Invalid Tile Type (%d, %d)\n", Loc.Col,
+					Loc.Row);
+			RC = XAIE_INVALID_TILE;
+			goto Exit;
+		}
+
+		StrmMod = DevInst->DevProp.DevMod[TileType].StrmSw;
+		State.NumMstrs = 0U;
+		State.NumSlvs = 0U;
+		State.NumSlots = 0U;
+
+		for(Last = First; (Last < NumFlows) &&
+				(Keys[Last].Tile == Keys[First].Tile); Last++) {
+			RC = _XAie_StrmRouteAddFlow(StrmMod,
+					&Flows[Keys[Last].Idx], &State);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Invalid flow %d on tile (%d, %d)\n",
+						Keys[Last].Idx, Loc.Col,
+						Loc.Row);
+				goto Exit;
+			}
+		}
+
+		RC = _XAie_StrmRouteAllocPkt(StrmMod, &State);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to allocate packet switching of tile (%d, %d)\n",
+					Loc.Col, Loc.Row);
+			goto Exit;
+		}
+
+		_XAie_StrmRouteEmitTile(DevInst, Loc, StrmMod, &State, Regs,
+				&NumRegs);
+	}
+
+	qsort(Regs, NumRegs, sizeof(*Regs), _XAie_StrmRouteRegCmp);
+
+	Route->Regs = Regs;
+	Route->NumRegs = NumRegs;
+	Route->IsReady = XAIE_COMPONENT_IS_READY;
+	Regs = NULL;
+
+Exit:
+	free(Keys);
+	free(Regs);
+	free(State.Mstrs);
+	free(State.Slvs);
+	free(State.Slots);
+	free(State.Sets);
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks the nodes of a deterministic merge tree are linked as a tree
+* and that the packet count of each input fed by a node covers whole rounds of
+* that node, so the merge order repeats at every level of the tree.
+*
+* @param	Merges: Array of merge nodes.
+* @param	NumMerges: Number of nodes in Merges.
+* @param	Parent: Array of NumMerges entries to hold the parent of each
+*		node.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. The packet counts of the nodes are checked by
+*		the caller.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmDetMergeCheckTree(const XAie_StrmDetMerge *Merges,
+		u32 NumMerges, u32 *Parent)
+{
+	for(u32 i = 0U; i < NumMerges; i++) {
+		Parent[i] = XAIE_SS_DET_MERGE_NO_CHILD;
+	}
+
+	for(u32 i = 0U; i < NumMerges; i++) {
+		for(u8 j = 0U; j < Merges[i].NumInputs; j++) {
+			const XAie_StrmDetMergeIn *In = &Merges[i].Inputs[j];
+			u32 Round = 0U;
+
+			if(In->Child == XAIE_SS_DET_MERGE_NO_CHILD) {
+				continue;
+			}
+
+			if((In->Child >= NumMerges) || (In->Child == i) ||
+					(Parent[In->Child] !=
+					 XAIE_SS_DET_MERGE_NO_CHILD)) {
+				XAIE_ERROR("Invalid child %d of merge %d\n",
+						In->Child, i);
+				return XAIE_INVALID_ARGS;
+			}
+			Parent[In->Child] = i;
+
+			for(u8 k = 0U; k < Merges[In->Child].NumInputs; k++) {
+				Round += Merges[In->Child].Inputs[k].PktCount;
+			}
+
+			if((In->PktCount % Round) != 0U) {
+				XAIE_ERROR("Packet count %d of merge %d input %d is not a multiple of the round of %d packets of merge %d\n",
+						In->PktCount, i, j, Round,
+						In->Child);
+				return XAIE_INVALID_ARGS;
+			}
+		}
+	}
+
+	for(u32 i = 0U; i < NumMerges; i++) {
+		u32 Node = i;
+
+		for(u32 Steps = 0U; Parent[Node] != XAIE_SS_DET_MERGE_NO_CHILD;
+				Steps++) {
+			if(Steps == NumMerges) {
+				XAIE_ERROR("Merge %d is part of a cycle\n", i);
+				return XAIE_INVALID_ARGS;
+			}
+			Node = Parent[Node];
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API compiles a tree of deterministic merges into the register writes of
+* the arbitors of the tiles, to be applied in one transaction with
+* XAie_StrmRouteApply(). Each node configures the positions of one arbitor
+* with the slave ports and packet counts of its inputs and enables the
+* arbitor.
+*
+* @param	DevInst: Device Instance
+* @param	Route: Pointer to the route to initialize.
+* @param	Merges: Array of merge nodes. An input fed by another node
+*		must take a multiple of the packets merged by that node in one
+*		round, the sum of its packet counts, so that the downstream
+*		merge always switches port at a round boundary.
+* @param	NumMerges: Number of nodes in Merges.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		An arbitor can be used by one node only. The packet switching
+*		of the ports, including the master port driven by the
+*		arbitor, is configured separately. XAie_StrmRouteClear()
+*		disables the arbitors of the route. The route has to be
+*		released with XAie_StrmRouteFree().
+*
+*******************************************************************************/
+AieRC XAie_StrmDetMergeCompile(XAie_DevInst *DevInst, XAie_StrmRoute *Route,
+		const XAie_StrmDetMerge *Merges, u32 NumMerges)
+{
+	AieRC RC = XAIE_OK;
+	u8 TileType, SlvIdx;
+	u32 NumRegs = 0U, *Parent;
+	u64 TileAddr;
+	const XAie_StrmMod *StrmMod;
+	const XAie_StrmSwDetMerge *DetMerge;
+	XAie_StrmRouteReg *Regs;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Route == XAIE_NULL) || (Merges == NULL) || (NumMerges == 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Regs = (XAie_StrmRouteReg *)malloc(3U * NumMerges * sizeof(*Regs));
+	Parent = (u32 *)malloc(NumMerges * sizeof(*Parent));
+	if((Regs == NULL) || (Parent == NULL)) {
+		XAIE_ERROR("Memory allocation for merge route failed\n");
+		RC = XAIE_ERR;
+		goto Exit;
+	}
+
+	for(u32 i = 0U; i < NumMerges; i++) {
+		const XAie_StrmDetMerge *Merge = &Merges[i];
+		u32 Config[2U] = {0U, 0U}, Round = 0U;
+		u64 ConfigAddr;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Merge->Loc);
+		if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+			XAIE_ERROR("Invalid Tile Type (%d, %d)\n",
+					Merge->Loc.Col, Merge->Loc.Row);
+			RC = XAIE_INVALID_TILE;
+			goto Exit;
+		}
+
+		StrmMod = DevInst->DevProp.DevMod[TileType].StrmSw;
+		if(StrmMod->DetMergeFeature == XAIE_FEATURE_UNAVAILABLE) {
+			XAIE_ERROR("Deterministic merge feature is not available\n");
+			RC = XAIE_FEATURE_NOT_SUPPORTED;
+			goto Exit;
+		}
+
+		DetMerge = StrmMod->DetMerge;
+		if((Merge->Arbitor >= DetMerge->NumArbitors) ||
+				(Merge->NumInputs == 0U) ||
+				(Merge->NumInputs > DetMerge->NumPositions) ||
+				(Merge->NumInputs >
+				 XAIE_SS_DET_MERGE_MAX_INPUTS)) {
+			XAIE_ERROR("Invalid Arbitor or number of inputs of merge %d\n",
+					i);
+			RC = XAIE_INVALID_ARGS;
+			goto Exit;
+		}
+
+		for(u8 j = 0U; j < Merge->NumInputs; j++) {
+			const XAie_StrmDetMergeIn *In = &Merge->Inputs[j];
+
+			if((In->Slave >= SS_PORT_TYPE_MAX) ||
+					(In->SlvPortNum >=
+					 StrmMod->SlvConfig[In->Slave].NumPorts)) {
+				XAIE_ERROR("Invalid stream port type and port number of merge %d\n",
+						i);
+				RC = XAIE_ERR_STREAM_PORT;
+				goto Exit;
+			}
+
+			if((In->PktCount == 0U) || (In->PktCount >
+					XAIE_SS_DETERMINISTIC_MERGE_MAX_PKT_CNT)) {
+				XAIE_ERROR("Invalid PktCount of merge %d input %d\n",
+						i, j);
+				RC = XAIE_INVALID_ARGS;
+				goto Exit;
+			}
+
+			for(u8 k = 0U; k < j; k++) {
+				if((Merge->Inputs[k].Slave == In->Slave) &&
+						(Merge->Inputs[k].SlvPortNum ==
+						 In->SlvPortNum)) {
+					XAIE_ERROR("Slave port used twice by merge %d\n",
+							i);
+					RC = XAIE_INVALID_ARGS;
+					goto Exit;
+				}
+			}
+
+			RC = _XAie_GetSlaveIdx(StrmMod, In->Slave,
+					In->SlvPortNum, &SlvIdx);
+			if(RC != XAIE_OK) {
+				goto Exit;
+			}
+
+			if((j % 2U) == 0U) {
+				Config[j / 2U] |= XAie_SetField(SlvIdx,
+						DetMerge->SlvId0.Lsb,
+						DetMerge->SlvId0.Mask) |
+					XAie_SetField(In->PktCount,
+						DetMerge->PktCount0.Lsb,
+						DetMerge->PktCount0.Mask);
+			} else {
+				Config[j / 2U] |= XAie_SetField(SlvIdx,
+						DetMerge->SlvId1.Lsb,
+						DetMerge->SlvId1.Mask) |
+					XAie_SetField(In->PktCount,
+						DetMerge->PktCount1.Lsb,
+						DetMerge->PktCount1.Mask);
+			}
+			Round += In->PktCount;
+		}
+
+		XAIE_DBG("Merge %d: tile (%d, %d) arbitor %d, %d inputs, round of %d packets\n",
+				i, Merge->Loc.Col, Merge->Loc.Row,
+				Merge->Arbitor, Merge->NumInputs, Round);
+
+		TileAddr = _XAie_GetTileAddr(DevInst, Merge->Loc.Row,
+				Merge->Loc.Col);
+		ConfigAddr = DetMerge->ConfigBase +
+			DetMerge->ArbConfigOffset * Merge->Arbitor + TileAddr;
+		Regs[NumRegs].RegAddr = ConfigAddr;
+		Regs[NumRegs++].RegVal = Config[0U];
+		Regs[NumRegs].RegAddr = ConfigAddr + 0x4U;
+		Regs[NumRegs++].RegVal = Config[1U];
+		Regs[NumRegs].RegAddr = DetMerge->EnableBase +
+			DetMerge->ArbConfigOffset * Merge->Arbitor + TileAddr;
+		Regs[NumRegs++].RegVal = XAie_SetField(XAIE_ENABLE,
+				DetMerge->Enable.Lsb, DetMerge->Enable.Mask);
+	}
+
+	RC = _XAie_StrmDetMergeCheckTree(Merges, NumMerges, Parent);
+	if(RC != XAIE_OK) {
+		goto Exit;
+	}
+
+	qsort(Regs, NumRegs, sizeof(*Regs), _XAie_StrmRouteRegCmp);
+	for(u32 i = 1U; i < NumRegs; i++) {
+		if(Regs[i].RegAddr == Regs[i - 1U].RegAddr) {
+			XAIE_ERROR("Arbitor used by several merges\n");
+			RC = XAIE_INVALID_ARGS;
+			goto Exit;
+		}
+	}
+
+	Route->Regs = Regs;
+	Route->NumRegs = NumRegs;
+	Route->IsReady = XAIE_COMPONENT_IS_READY;
+	Regs = NULL;
+
+Exit:
+	free(Regs);
+	free(Parent);
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the register values of a compiled route, or resets them.
+*
+* @param	DevInst: Device Instance
+* @param	Route: Pointer to the compiled route.
+* @param	Enable: XAIE_ENABLE to apply the route, XAIE_DISABLE to reset
+*		the registers of the route.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouteWrite(XAie_DevInst *DevInst,
+		const XAie_StrmRoute *Route, u8 Enable)
+{
+	AieRC RC = XAIE_OK;
+	u8 OwnTxn = XAIE_DISABLE;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Route == XAIE_NULL) ||
+			(Route->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid route\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Sorted writes are merged into block writes by the transaction */
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH |
+				XAIE_TRANSACTION_ENABLE_OPTIMIZE);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	for(u32 i = 0U; i < Route->NumRegs; i++) {
+		RC = XAie_Write32(DevInst, Route->Regs[i].RegAddr,
+				(Enable == XAIE_ENABLE) ?
+				Route->Regs[i].RegVal : 0U);
+		if(RC != XAIE_OK) {
+			break;
+		}
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures the stream switches with a compiled route. All the
+* register writes of the route are sent in one transaction.
+*
+* @param	DevInst: Device Instance
+* @param	Route: Pointer to the route compiled with
+*		XAie_StrmRouteCompile().
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		If the calling thread has a transaction open, the writes are
+*		recorded into it.
+*
+*******************************************************************************/
+AieRC XAie_StrmRouteApply(XAie_DevInst *DevInst, const XAie_StrmRoute *Route)
+{
+	return _XAie_StrmRouteWrite(DevInst, Route, XAIE_ENABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API disables all the ports and slots configured by a compiled route,
+* by writing their reset values in one transaction.
+*
+* @param	DevInst: Device Instance
+* @param	Route: Pointer to the route compiled with
+*		XAie_StrmRouteCompile().
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		If the calling thread has a transaction open, the writes are
+*		recorded into it.
+*
+*******************************************************************************/
+AieRC XAie_StrmRouteClear(XAie_DevInst *DevInst, const XAie_StrmRoute *Route)
+{
+	return _XAie_StrmRouteWrite(DevInst, Route, XAIE_DISABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reconfigures the stream switches from a compiled route to another
+* one, writing only the registers which differ. The registers used only by the
+* current route are reset, the registers whose value changes or which are used
+* only by the target route are written, and the registers with the same value
+* in both routes are left untouched. All the writes are sent in one
+* transaction.
+*
+* @param	DevInst: Device Instance
+* @param	From: Pointer to the route currently applied.
+* @param	To: Pointer to the route to switch to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The registers are assumed to hold the values of From. Ports
+*		configured outside of the routes are not changed. With the
+*		shadow cache enabled, the writes of values already in the
+*		device are dropped as well. If the calling thread has a
+*		transaction open, the writes are recorded into it.
+*
+*******************************************************************************/
+AieRC XAie_StrmRouteSwitch(XAie_DevInst *DevInst, const XAie_StrmRoute *From,
+		const XAie_StrmRoute *To)
+{
+	AieRC RC = XAIE_OK;
+	u8 OwnTxn = XAIE_DISABLE;
+	u32 i = 0U, j = 0U;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((From == XAIE_NULL) || (To == XAIE_NULL) ||
+			(From->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(To->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid route\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH |
+				XAIE_TRANSACTION_ENABLE_OPTIMIZE);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		OwnTxn = XAIE_ENABLE;
+	}
+
+	/* Both routes are sorted by address, walk them together */
+	while((RC == XAIE_OK) && ((i < From->NumRegs) || (j < To->NumRegs))) {
+		if((j == To->NumRegs) || ((i < From->NumRegs) &&
+				(From->Regs[i].RegAddr < To->Regs[j].RegAddr))) {
+			RC = XAie_Write32(DevInst, From->Regs[i].RegAddr, 0U);
+			i++;
+		} else if((i == From->NumRegs) ||
+				(To->Regs[j].RegAddr < From->Regs[i].RegAddr)) {
+			RC = XAie_Write32(DevInst, To->Regs[j].RegAddr,
+					To->Regs[j].RegVal);
+			j++;
+		} else {
+			if(From->Regs[i].RegVal != To->Regs[j].RegVal) {
+				RC = XAie_Write32(DevInst, To->Regs[j].RegAddr,
+						To->Regs[j].RegVal);
+			}
+			i++;
+			j++;
+		}
+	}
+
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the resources of a compiled route.
+*
+* @param	Route: Pointer to the route.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_StrmRouteFree(XAie_StrmRoute *Route)
+{
+	if((Route == XAIE_NULL) ||
+			(Route->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(Route->Regs);
+	Route->Regs = NULL;
+	Route->NumRegs = 0U;
+	Route->IsReady = 0U;
+
+	return XAIE_OK;
+}
+
 #endif /* XAIE_FEATURE_SS_ENABLE */
 /** @} */
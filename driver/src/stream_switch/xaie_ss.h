@@ -31,6 +31,14 @@
 #include "xaiegbl_defs.h"
 #include "xaie_helper.h"
 
+/************************** Constant Definitions *****************************/
+/* Packet id of a packet flow to be allocated by XAie_StrmPktPlan() */
+#define XAIE_SS_PKT_ID_AUTO	0xFFU
+/* Maximum number of inputs of a deterministic merge node */
+#define XAIE_SS_DET_MERGE_MAX_INPUTS	4U
+/* Input of a deterministic merge node which is not fed by another node */
+#define XAIE_SS_DET_MERGE_NO_CHILD	0xFFFFFFFFU
+
 /**************************** Type Definitions *******************************/
 /* Typedef to capture Packet drop header */
 typedef enum {
@@ -38,6 +46,93 @@ typedef enum {
 	XAIE_SS_PKT_DROP_HEADER
 } XAie_StrmSwPktHeader;
 
+/*
+ * This typedef captures one flow of a route through the stream switch of a
+ * tile, from a slave port to a master port, for XAie_StrmRouteCompile().
+ */
+typedef struct {
+	XAie_LocType Loc;
+	StrmSwPortType Slave;
+	u8 SlvPortNum;
+	StrmSwPortType Master;
+	u8 MstrPortNum;
+	u8 PktEn;	/* XAIE_ENABLE for packet switching, else circuit */
+	u8 PktId;	/* Packet ID routed, packet switching only */
+	XAie_StrmSwPktHeader DropHeader;	/* Packet switching only */
+} XAie_StrmFlow;
+
+/* Register write of a compiled route */
+typedef struct {
+	u64 RegAddr;
+	u32 RegVal;
+} XAie_StrmRouteReg;
+
+/*
+ * This typedef captures a set of flows compiled once into the stream switch
+ * register writes, sorted by address, to be applied any number of times
+ * with XAie_StrmRouteApply().
+ */
+typedef struct {
+	XAie_StrmRouteReg *Regs;
+	u32 NumRegs;
+	u8 IsReady;
+} XAie_StrmRoute;
+
+/*
+ * This typedef captures the stream switch ports of a partition allocated by
+ * the circuit switched paths placed with XAie_StrmRouterFindPath(). The
+ * bitmaps hold one bit per port number, per port type of each tile.
+ */
+typedef struct {
+	u32 *MstrUsed;
+	u32 *SlvUsed;
+	u8 NumCols;
+	u8 NumRows;
+	u8 IsReady;
+} XAie_StrmRouter;
+
+/* Destination master port of a packet flow */
+typedef struct {
+	XAie_LocType Loc;
+	StrmSwPortType Master;
+	u8 MstrPortNum;
+	XAie_StrmSwPktHeader DropHeader;
+} XAie_StrmPktDst;
+
+/*
+ * This typedef captures a packet switched flow from a slave port of a tile to
+ * one or several master ports, for XAie_StrmPktPlan().
+ */
+typedef struct {
+	XAie_LocType SrcLoc;
+	StrmSwPortType Slave;
+	u8 SlvPortNum;
+	const XAie_StrmPktDst *Dsts;
+	u32 NumDsts;
+	u8 PktId;	/* Packet id, XAIE_SS_PKT_ID_AUTO to allocate one */
+} XAie_StrmPktFlow;
+
+/* Input of a deterministic merge node, in the order of its positions */
+typedef struct {
+	StrmSwPortType Slave;
+	u8 SlvPortNum;
+	u8 PktCount;	/* Packets taken from the port per round */
+	u32 Child;	/* Index of the node feeding the port, or
+			   XAIE_SS_DET_MERGE_NO_CHILD */
+} XAie_StrmDetMergeIn;
+
+/*
+ * This typedef captures the deterministic merge done by one arbitor of a tile
+ * as a node of a merge tree, for XAie_StrmDetMergeCompile(). The output of a
+ * node can feed an input of a node downstream.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u8 Arbitor;
+	u8 NumInputs;
+	XAie_StrmDetMergeIn Inputs[XAIE_SS_DET_MERGE_MAX_INPUTS];
+} XAie_StrmDetMerge;
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_StrmConnCctEnable(XAie_DevInst *DevInst, XAie_LocType Loc,
 		StrmSwPortType Slave, u8 SlvPortNum, StrmSwPortType Master,
@@ -79,5 +174,26 @@ AieRC XAie_StrmSwDeterministicMergeEnable(XAie_DevInst *DevInst,
 		XAie_LocType Loc, u8 Arbitor);
 AieRC XAie_StrmSwDeterministicMergeDisable(XAie_DevInst *DevInst,
 		XAie_LocType Loc, u8 Arbitor);
+AieRC XAie_StrmRouteCompile(XAie_DevInst *DevInst, XAie_StrmRoute *Route,
+		const XAie_StrmFlow *Flows, u32 NumFlows);
+AieRC XAie_StrmRouteApply(XAie_DevInst *DevInst, const XAie_StrmRoute *Route);
+AieRC XAie_StrmRouteClear(XAie_DevInst *DevInst, const XAie_StrmRoute *Route);
+AieRC XAie_StrmRouteSwitch(XAie_DevInst *DevInst, const XAie_StrmRoute *From,
+		const XAie_StrmRoute *To);
+AieRC XAie_StrmRouteFree(XAie_StrmRoute *Route);
+AieRC XAie_StrmRouterInit(XAie_DevInst *DevInst, XAie_StrmRouter *Router);
+AieRC XAie_StrmRouterFindPath(XAie_DevInst *DevInst, XAie_StrmRouter *Router,
+		XAie_LocType SrcLoc, StrmSwPortType Slave, u8 SlvPortNum,
+		XAie_LocType DstLoc, StrmSwPortType Master, u8 MstrPortNum,
+		XAie_StrmFlow *Flows, u32 *NumFlows);
+AieRC XAie_StrmRouterReserve(XAie_DevInst *DevInst, XAie_StrmRouter *Router,
+		const XAie_StrmFlow *Flows, u32 NumFlows);
+AieRC XAie_StrmRouterRelease(XAie_DevInst *DevInst, XAie_StrmRouter *Router,
+		const XAie_StrmFlow *Flows, u32 NumFlows);
+AieRC XAie_StrmRouterFree(XAie_StrmRouter *Router);
+AieRC XAie_StrmPktPlan(XAie_DevInst *DevInst, XAie_StrmRouter *Router,
+		XAie_StrmPktFlow *Flows, u32 NumFlows, XAie_StrmRoute *Route);
+AieRC XAie_StrmDetMergeCompile(XAie_DevInst *DevInst, XAie_StrmRoute *Route,
+		const XAie_StrmDetMerge *Merges, u32 NumMerges);
 
 #endif		/* end of protection macro */
@@ -23,7 +23,7 @@
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 
-#ifdef XAIE_FEATURE_SS_ENABLE
+#if defined(XAIE_FEATURE_SS_ENABLE) && defined(XAIE_DEV_AIE_ENABLE)
 /************************** Constant Definitions *****************************/
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
@@ -55,4 +55,4 @@ AieRC _XAie_StrmSwCheckPortValidity(StrmSwPortType Slave, u8 SlvPortNum,
 	return XAIE_OK;
 }
 
-#endif /* XAIE_FEATURE_SS_ENABLE */
+#endif /* XAIE_FEATURE_SS_ENABLE && XAIE_DEV_AIE_ENABLE */
@@ -23,7 +23,7 @@
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 
-#ifdef XAIE_FEATURE_SS_ENABLE
+#if defined(XAIE_FEATURE_SS_ENABLE) && defined(XAIE_DEV_AIEML_ENABLE)
 
 /************************** Constant Definitions *****************************/
 /************************** Function Definitions *****************************/
@@ -208,4 +208,4 @@ AieRC _XAieMl_ShimTile_StrmSwCheckPortValidity(StrmSwPortType Slave,
 	return RC;
 }
 
-#endif /* XAIE_FEATURE_SS_ENABLE */
+#endif /* XAIE_FEATURE_SS_ENABLE && XAIE_DEV_AIEML_ENABLE */
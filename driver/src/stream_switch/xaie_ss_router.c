@@ -0,0 +1,1343 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_ss_router.c
+* @{
+*
+* This file contains routines to place circuit switched stream paths between
+* the tiles of a partition. The paths are searched over the port model of the
+* stream switch modules, avoiding the ports already allocated to other paths
+* and preferring the directions which are less used. It also plans packet
+* switched flows, with their paths and packet ids.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_ss.h"
+
+#ifdef XAIE_FEATURE_SS_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_SS_ROUTER_MAX_PORTS	8U	/* Ports per direction */
+#define XAIE_SS_ROUTER_NUM_DIRS		4U	/* SOUTH, WEST, NORTH, EAST */
+#define XAIE_SS_ROUTER_SRC_ENTRY	\
+	(XAIE_SS_ROUTER_NUM_DIRS * XAIE_SS_ROUTER_MAX_PORTS)
+#define XAIE_SS_ROUTER_NUM_ENTRIES	(XAIE_SS_ROUTER_SRC_ENTRY + 1U)
+#define XAIE_SS_ROUTER_NO_STATE		0xFFFFFFFFU
+
+/* Cost of one hop and of each port already used in the same direction */
+#define XAIE_SS_ROUTER_HOP_COST		4U
+#define XAIE_SS_ROUTER_CONGESTION_COST	1U
+
+/**************************** Type Definitions *******************************/
+/*
+ * A search state is a tile with the slave port the path enters it from.
+ * Entries 0 to XAIE_SS_ROUTER_SRC_ENTRY - 1 are the slave ports of the four
+ * directions, XAIE_SS_ROUTER_SRC_ENTRY is the source slave port of the path.
+ */
+typedef struct {
+	u32 Dist;
+	u32 State;
+} XAie_StrmRouterHeapNode;
+
+typedef struct {
+	XAie_StrmRouterHeapNode *Nodes;
+	u32 Size;
+	u32 MaxSize;
+} XAie_StrmRouterHeap;
+
+/* Hops of the packet flows of a plan, one flow per tile and master port */
+typedef struct {
+	XAie_StrmFlow *Hops;
+	u32 NumHops;
+	u32 MaxHops;
+	u32 *Keys;	/* Slave port of each hop, sorted per flow */
+	u32 *First;	/* First hop of each flow, and the end of the last */
+	u16 *Load;	/* Packet flows per master port of each direction */
+} XAie_StrmPktPlanState;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API pushes a search state to the heap of the router.
+*
+* @param	Heap: Heap of the search.
+* @param	Dist: Cost of the state.
+* @param	State: Search state.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the heap cannot grow.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouterHeapPush(XAie_StrmRouterHeap *Heap, u32 Dist,
+		u32 State)
+{
+	u32 i;
+
+	if(Heap->Size == Heap->MaxSize) {
+		XAie_StrmRouterHeapNode *Nodes;
+
+		Nodes = (XAie_StrmRouterHeapNode *)realloc(Heap->Nodes,
+				2U * Heap->MaxSize * sizeof(*Nodes));
+		if(Nodes == NULL) {
+			XAIE_ERROR("Memory allocation for route search failed\n");
+			return XAIE_ERR;
+		}
+		Heap->Nodes = Nodes;
+		Heap->MaxSize *= 2U;
+	}
+
+	i = Heap->Size++;
+	while(i > 0U) {
+		u32 Parent = (i - 1U) / 2U;
+
+		if(Heap->Nodes[Parent].Dist <= Dist) {
+			break;
+		}
+		Heap->Nodes[i] = Heap->Nodes[Parent];
+		i = Parent;
+	}
+	Heap->Nodes[i].Dist = Dist;
+	Heap->Nodes[i].State = State;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API pops the search state of lowest cost from the heap of the router.
+*
+* @param	Heap: Heap of the search. It must not be empty.
+*
+* @return	Node of lowest cost.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static XAie_StrmRouterHeapNode _XAie_StrmRouterHeapPop(
+		XAie_StrmRouterHeap *Heap)
+{
+	XAie_StrmRouterHeapNode Top = Heap->Nodes[0];
+	XAie_StrmRouterHeapNode Last = Heap->Nodes[--Heap->Size];
+	u32 i = 0U;
+
+	while(1) {
+		u32 Child = 2U * i + 1U;
+
+		if(Child >= Heap->Size) {
+			break;
+		}
+		if((Child + 1U < Heap->Size) &&
+				(Heap->Nodes[Child + 1U].Dist <
+				 Heap->Nodes[Child].Dist)) {
+			Child++;
+		}
+		if(Last.Dist <= Heap->Nodes[Child].Dist) {
+			break;
+		}
+		Heap->Nodes[i] = Heap->Nodes[Child];
+		i = Child;
+	}
+	if(Heap->Size > 0U) {
+		Heap->Nodes[i] = Last;
+	}
+
+	return Top;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the stream switch module of a tile of the partition.
+*
+* @param	DevInst: Device Instance
+* @param	Col: Column of the tile.
+* @param	Row: Row of the tile.
+*
+* @return	Stream switch module, NULL for an invalid tile.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static const XAie_StrmMod *_XAie_StrmRouterGetMod(XAie_DevInst *DevInst,
+		u8 Col, u8 Row)
+{
+	u8 TileType;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst,
+			XAie_TileLoc(Col, Row));
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		return NULL;
+	}
+
+	return DevInst->DevProp.DevMod[TileType].StrmSw;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the bitmap of the used ports of a type of a tile.
+*
+* @param	Router: Router.
+* @param	Used: MstrUsed or SlvUsed bitmaps of the router.
+* @param	Loc: Location of the tile.
+* @param	Type: Port type.
+*
+* @return	Pointer to the bitmap.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 *_XAie_StrmRouterUsed(const XAie_StrmRouter *Router, u32 *Used,
+		XAie_LocType Loc, StrmSwPortType Type)
+{
+	return &Used[((u32)Loc.Col * Router->NumRows + Loc.Row) *
+		SS_PORT_TYPE_MAX + Type];
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the number of bits set in a port bitmap.
+*
+* @param	Bits: Port bitmap.
+*
+* @return	Number of bits set.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_StrmRouterCount(u32 Bits)
+{
+	u32 Count = 0U;
+
+	while(Bits != 0U) {
+		Bits &= Bits - 1U;
+		Count++;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes a router of circuit switched stream paths for the
+* partition of a device instance, with all the ports free.
+*
+* @param	DevInst: Device Instance
+* @param	Router: Pointer to the router.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The router has to be released with XAie_StrmRouterFree().
+*
+*******************************************************************************/
+AieRC XAie_StrmRouterInit(XAie_DevInst *DevInst, XAie_StrmRouter *Router)
+{
+	u32 NumWords;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Router == XAIE_NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	NumWords = (u32)DevInst->NumCols * DevInst->NumRows * SS_PORT_TYPE_MAX;
+	Router->MstrUsed = (u32 *)calloc(NumWords, sizeof(u32));
+	Router->SlvUsed = (u32 *)calloc(NumWords, sizeof(u32));
+	if((Router->MstrUsed == NULL) || (Router->SlvUsed == NULL)) {
+		XAIE_ERROR("Memory allocation for router failed\n");
+		free(Router->MstrUsed);
+		free(Router->SlvUsed);
+		return XAIE_ERR;
+	}
+
+	Router->NumCols = DevInst->NumCols;
+	Router->NumRows = DevInst->NumRows;
+	Router->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API validates the arguments common to the router APIs.
+*
+* @param	DevInst: Device Instance
+* @param	Router: Router.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouterCheck(XAie_DevInst *DevInst,
+		const XAie_StrmRouter *Router)
+{
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Router == XAIE_NULL) ||
+			(Router->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Router->NumCols != DevInst->NumCols) ||
+			(Router->NumRows != DevInst->NumRows)) {
+		XAIE_ERROR("Invalid router\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API validates a port of a tile for the router.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @param	Port: XAIE_STRMSW_SLAVE or XAIE_STRMSW_MASTER.
+* @param	Type: Port type.
+* @param	PortNum: Port number.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouterCheckPort(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_StrmPortIntf Port, StrmSwPortType Type,
+		u8 PortNum)
+{
+	const XAie_StrmMod *StrmMod;
+	const XAie_StrmPort *PortPtr;
+
+	if((Loc.Col >= DevInst->NumCols) || (Loc.Row >= DevInst->NumRows)) {
+		XAIE_ERROR("Invalid tile (%d, %d)\n", Loc.Col, Loc.Row);
+		return XAIE_INVALID_TILE;
+	}
+
+	StrmMod = _XAie_StrmRouterGetMod(DevInst, Loc.Col, Loc.Row);
+	if(StrmMod == NULL) {
+		XAIE_ERROR("Invalid Tile Type (%d, %d)\n", Loc.Col, Loc.Row);
+		return XAIE_INVALID_TILE;
+	}
+
+	if(Type >= SS_PORT_TYPE_MAX) {
+		XAIE_ERROR("Invalid Stream Switch Ports\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	PortPtr = (Port == XAIE_STRMSW_SLAVE) ? &StrmMod->SlvConfig[Type] :
+		&StrmMod->MstrConfig[Type];
+	if(PortNum >= PortPtr->NumPorts) {
+		XAIE_ERROR("Invalid Stream Port\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the slave port a search state enters its tile from.
+*
+* @param	Entry: Entry of the search state.
+* @param	SrcSlave: Source slave port type of the path.
+* @param	SrcPortNum: Source slave port number of the path.
+* @param	Type: Pointer to return the slave port type.
+* @param	PortNum: Pointer to return the slave port number.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_StrmRouterEntryPort(u32 Entry, StrmSwPortType SrcSlave,
+		u8 SrcPortNum, StrmSwPortType *Type, u8 *PortNum)
+{
+	if(Entry == XAIE_SS_ROUTER_SRC_ENTRY) {
+		*Type = SrcSlave;
+		*PortNum = SrcPortNum;
+	} else {
+		*Type = (StrmSwPortType)(SOUTH +
+				Entry / XAIE_SS_ROUTER_MAX_PORTS);
+		*PortNum = (u8)(Entry % XAIE_SS_ROUTER_MAX_PORTS);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API finds a circuit switched path from a slave port of a tile to a
+* master port of another tile, or of the same tile, and allocates its ports
+* in the router. The search minimizes the number of hops, with a penalty for
+* the directions of a tile whose master ports are already used by other
+* paths, so that the paths are spread over the array. Ports allocated to
+* earlier paths are never reused, so paths can be placed one after the other.
+*
+* @param	DevInst: Device Instance
+* @param	Router: Router tracking the allocated ports.
+* @param	SrcLoc: Location of the source tile.
+* @param	Slave: Source slave port type, for instance DMA.
+* @param	SlvPortNum: Source slave port number.
+* @param	DstLoc: Location of the destination tile.
+* @param	Master: Destination master port type, for instance DMA.
+* @param	MstrPortNum: Destination master port number.
+* @param	Flows: Array to return one circuit flow per tile of the path,
+*		from the source to the destination tile. The flows can be
+*		compiled with XAie_StrmRouteCompile().
+* @param	NumFlows: Pointer to the size of Flows, updated with the number
+*		of flows of the path.
+*
+* @return	XAIE_OK on success, XAIE_ERR_STREAM_PORT if there is no free
+*		path, Error code on failure.
+*
+* @note		No register is written. A path enters each intermediate tile
+*		from the first port number found free, so two paths whose
+*		search states would merge on a tile are not both explored.
+*
+*******************************************************************************/
+AieRC XAie_StrmRouterFindPath(XAie_DevInst *DevInst, XAie_StrmRouter *Router,
+		XAie_LocType SrcLoc, StrmSwPortType Slave, u8 SlvPortNum,
+		XAie_LocType DstLoc, StrmSwPortType Master, u8 MstrPortNum,
+		XAie_StrmFlow *Flows, u32 *NumFlows)
+{
+	static const s8 DCol[XAIE_SS_ROUTER_NUM_DIRS] = {0, -1, 0, 1};
+	static const s8 DRow[XAIE_SS_ROUTER_NUM_DIRS] = {-1, 0, 1, 0};
+	AieRC RC;
+	u32 NumStates, Found = XAIE_SS_ROUTER_NO_STATE, Len, State;
+	u32 *Dist, *Prev;
+	XAie_StrmRouterHeap Heap;
+
+	RC = _XAie_StrmRouterCheck(DevInst, Router);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if((Flows == NULL) || (NumFlows == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_StrmRouterCheckPort(DevInst, SrcLoc, XAIE_STRMSW_SLAVE,
+			Slave, SlvPortNum);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_StrmRouterCheckPort(DevInst, DstLoc, XAIE_STRMSW_MASTER,
+			Master, MstrPortNum);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if((*_XAie_StrmRouterUsed(Router, Router->SlvUsed, SrcLoc, Slave) &
+				(1U << SlvPortNum)) ||
+			(*_XAie_StrmRouterUsed(Router, Router->MstrUsed, DstLoc,
+				Master) & (1U << MstrPortNum))) {
+		XAIE_ERROR("Source or destination port is already used\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	NumStates = (u32)Router->NumCols * Router->NumRows *
+		XAIE_SS_ROUTER_NUM_ENTRIES;
+	Dist = (u32 *)malloc(NumStates * sizeof(*Dist));
+	Prev = (u32 *)malloc(NumStates * sizeof(*Prev));
+	Heap.MaxSize = 64U;
+	Heap.Size = 0U;
+	Heap.Nodes = (XAie_StrmRouterHeapNode *)malloc(Heap.MaxSize *
+			sizeof(*Heap.Nodes));
+	if((Dist == NULL) || (Prev == NULL) || (Heap.Nodes == NULL)) {
+		XAIE_ERROR("Memory allocation for route search failed\n");
+		RC = XAIE_ERR;
+		goto Exit;
+	}
+
+	for(u32 i = 0U; i < NumStates; i++) {
+		Dist[i] = XAIE_SS_ROUTER_NO_STATE;
+	}
+
+	State = ((u32)SrcLoc.Col * Router->NumRows + SrcLoc.Row) *
+		XAIE_SS_ROUTER_NUM_ENTRIES + XAIE_SS_ROUTER_SRC_ENTRY;
+	Dist[State] = 0U;
+	Prev[State] = XAIE_SS_ROUTER_NO_STATE;
+	RC = _XAie_StrmRouterHeapPush(&Heap, 0U, State);
+
+	while((RC == XAIE_OK) && (Heap.Size > 0U)) {
+		XAie_StrmRouterHeapNode Node = _XAie_StrmRouterHeapPop(&Heap);
+		u32 Tile = Node.State / XAIE_SS_ROUTER_NUM_ENTRIES;
+		u32 Entry = Node.State % XAIE_SS_ROUTER_NUM_ENTRIES;
+		XAie_LocType Loc = XAie_TileLoc((u8)(Tile / Router->NumRows),
+				(u8)(Tile % Router->NumRows));
+		const XAie_StrmMod *StrmMod;
+		StrmSwPortType InType;
+		u8 InNum;
+
+		if(Node.Dist != Dist[Node.State]) {
+			continue;
+		}
+
+		StrmMod = _XAie_StrmRouterGetMod(DevInst, Loc.Col, Loc.Row);
+		_XAie_StrmRouterEntryPort(Entry, Slave, SlvPortNum, &InType,
+				&InNum);
+
+		if((Loc.Col == DstLoc.Col) && (Loc.Row == DstLoc.Row) &&
+				(StrmMod->PortVerify(InType, InNum, Master,
+					MstrPortNum) == XAIE_OK)) {
+			Found = Node.State;
+			break;
+		}
+
+		for(u32 Dir = 0U; Dir < XAIE_SS_ROUTER_NUM_DIRS; Dir++) {
+			StrmSwPortType Out = (StrmSwPortType)(SOUTH + Dir);
+			StrmSwPortType In = (StrmSwPortType)(SOUTH +
+					((Dir + 2U) % XAIE_SS_ROUTER_NUM_DIRS));
+			const XAie_StrmMod *NextMod;
+			XAie_LocType Next;
+			u32 MstrUsed, SlvUsed, NumPorts, Cost;
+			s32 Col = (s32)Loc.Col + DCol[Dir];
+			s32 Row = (s32)Loc.Row + DRow[Dir];
+
+			if((Col < 0) || (Col >= Router->NumCols) ||
+					(Row < 0) || (Row >= Router->NumRows)) {
+				continue;
+			}
+
+			Next = XAie_TileLoc((u8)Col, (u8)Row);
+			NextMod = _XAie_StrmRouterGetMod(DevInst, Next.Col,
+					Next.Row);
+			if(NextMod == NULL) {
+				continue;
+			}
+
+			NumPorts = StrmMod->MstrConfig[Out].NumPorts;
+			if(NextMod->SlvConfig[In].NumPorts < NumPorts) {
+				NumPorts = NextMod->SlvConfig[In].NumPorts;
+			}
+
+			MstrUsed = *_XAie_StrmRouterUsed(Router,
+					Router->MstrUsed, Loc, Out);
+			SlvUsed = *_XAie_StrmRouterUsed(Router,
+					Router->SlvUsed, Next, In);
+			Cost = Node.Dist + XAIE_SS_ROUTER_HOP_COST +
+				XAIE_SS_ROUTER_CONGESTION_COST *
+				_XAie_StrmRouterCount(MstrUsed);
+
+			for(u32 Port = 0U; Port < NumPorts; Port++) {
+				u32 NextState;
+
+				if(((MstrUsed | SlvUsed) & (1U << Port)) ||
+						(StrmMod->PortVerify(InType,
+							InNum, Out, (u8)Port) !=
+						 XAIE_OK)) {
+					continue;
+				}
+
+				NextState = ((u32)Next.Col * Router->NumRows +
+						Next.Row) *
+					XAIE_SS_ROUTER_NUM_ENTRIES +
+					(((In - SOUTH) *
+					  XAIE_SS_ROUTER_MAX_PORTS) + Port);
+				if(Cost >= Dist[NextState]) {
+					continue;
+				}
+
+				Dist[NextState] = Cost;
+				Prev[NextState] = Node.State;
+				RC = _XAie_StrmRouterHeapPush(&Heap, Cost,
+						NextState);
+				if(RC != XAIE_OK) {
+					break;
+				}
+			}
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		goto Exit;
+	}
+
+	if(Found == XAIE_SS_ROUTER_NO_STATE) {
+		XAIE_ERROR("No free stream path from tile (%d, %d) to (%d, %d)\n",
+				SrcLoc.Col, SrcLoc.Row, DstLoc.Col,
+				DstLoc.Row);
+		RC = XAIE_ERR_STREAM_PORT;
+		goto Exit;
+	}
+
+	Len = 0U;
+	for(State = Found; State != XAIE_SS_ROUTER_NO_STATE;
+			State = Prev[State]) {
+		Len++;
+	}
+
+	if(*NumFlows < Len) {
+		XAIE_ERROR("Flow array is too small, %d flows needed\n", Len);
+		*NumFlows = Len;
+		RC = XAIE_INVALID_ARGS;
+		goto Exit;
+	}
+
+	*NumFlows = Len;
+	State = Found;
+	for(u32 i = Len; i > 0U; i--) {
+		u32 Tile = State / XAIE_SS_ROUTER_NUM_ENTRIES;
+		XAie_StrmFlow *Flow = &Flows[i - 1U];
+
+		Flow->Loc = XAie_TileLoc((u8)(Tile / Router->NumRows),
+				(u8)(Tile % Router->NumRows));
+		_XAie_StrmRouterEntryPort(State % XAIE_SS_ROUTER_NUM_ENTRIES,
+				Slave, SlvPortNum, &Flow->Slave,
+				&Flow->SlvPortNum);
+		Flow->PktEn = XAIE_DISABLE;
+		Flow->PktId = 0U;
+		Flow->DropHeader = XAIE_SS_PKT_DONOT_DROP_HEADER;
+		State = Prev[State];
+	}
+
+	/* A tile exits towards the port the next tile is entered from */
+	for(u32 i = 0U; i < Len; i++) {
+		if(i == Len - 1U) {
+			Flows[i].Master = Master;
+			Flows[i].MstrPortNum = MstrPortNum;
+		} else {
+			Flows[i].Master = (StrmSwPortType)(SOUTH +
+					((Flows[i + 1U].Slave - SOUTH + 2U) %
+					 XAIE_SS_ROUTER_NUM_DIRS));
+			Flows[i].MstrPortNum = Flows[i + 1U].SlvPortNum;
+		}
+
+		*_XAie_StrmRouterUsed(Router, Router->SlvUsed, Flows[i].Loc,
+				Flows[i].Slave) |= 1U << Flows[i].SlvPortNum;
+		*_XAie_StrmRouterUsed(Router, Router->MstrUsed, Flows[i].Loc,
+				Flows[i].Master) |= 1U << Flows[i].MstrPortNum;
+	}
+
+	RC = XAIE_OK;
+
+Exit:
+	free(Dist);
+	free(Prev);
+	free(Heap.Nodes);
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API marks the ports of a set of circuit flows as used or free in a
+* router.
+*
+* @param	DevInst: Device Instance
+* @param	Router: Router.
+* @param	Flows: Array of flows.
+* @param	NumFlows: Number of flows in Flows.
+* @param	Reserve: XAIE_ENABLE to mark the ports used, XAIE_DISABLE to
+*		mark them free.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouterMark(XAie_DevInst *DevInst,
+		XAie_StrmRouter *Router, const XAie_StrmFlow *Flows,
+		u32 NumFlows, u8 Reserve)
+{
+	AieRC RC;
+
+	RC = _XAie_StrmRouterCheck(DevInst, Router);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if((Flows == NULL) || (NumFlows == 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumFlows; i++) {
+		RC = _XAie_StrmRouterCheckPort(DevInst, Flows[i].Loc,
+				XAIE_STRMSW_SLAVE, Flows[i].Slave,
+				Flows[i].SlvPortNum);
+		if(RC == XAIE_OK) {
+			RC = _XAie_StrmRouterCheckPort(DevInst, Flows[i].Loc,
+					XAIE_STRMSW_MASTER, Flows[i].Master,
+					Flows[i].MstrPortNum);
+		}
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	for(u32 i = 0U; i < NumFlows; i++) {
+		u32 *Slv = _XAie_StrmRouterUsed(Router, Router->SlvUsed,
+				Flows[i].Loc, Flows[i].Slave);
+		u32 *Mstr = _XAie_StrmRouterUsed(Router, Router->MstrUsed,
+				Flows[i].Loc, Flows[i].Master);
+
+		if(Reserve == XAIE_ENABLE) {
+			*Slv |= 1U << Flows[i].SlvPortNum;
+			*Mstr |= 1U << Flows[i].MstrPortNum;
+		} else {
+			*Slv &= ~(1U << Flows[i].SlvPortNum);
+			*Mstr &= ~(1U << Flows[i].MstrPortNum);
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API marks the ports of flows placed without the router as used, so
+* that the paths found later do not use them.
+*
+* @param	DevInst: Device Instance
+* @param	Router: Router.
+* @param	Flows: Array of flows.
+* @param	NumFlows: Number of flows in Flows.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_StrmRouterReserve(XAie_DevInst *DevInst, XAie_StrmRouter *Router,
+		const XAie_StrmFlow *Flows, u32 NumFlows)
+{
+	return _XAie_StrmRouterMark(DevInst, Router, Flows, NumFlows,
+			XAIE_ENABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API marks the ports of flows as free, for instance the flows of a path
+* found with XAie_StrmRouterFindPath() which is torn down.
+*
+* @param	DevInst: Device Instance
+* @param	Router: Router.
+* @param	Flows: Array of flows.
+* @param	NumFlows: Number of flows in Flows.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_StrmRouterRelease(XAie_DevInst *DevInst, XAie_StrmRouter *Router,
+		const XAie_StrmFlow *Flows, u32 NumFlows)
+{
+	return _XAie_StrmRouterMark(DevInst, Router, Flows, NumFlows,
+			XAIE_DISABLE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the resources of a router.
+*
+* @param	Router: Pointer to the router.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_StrmRouterFree(XAie_StrmRouter *Router)
+{
+	if((Router == XAIE_NULL) ||
+			(Router->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(Router->MstrUsed);
+	free(Router->SlvUsed);
+	Router->MstrUsed = NULL;
+	Router->SlvUsed = NULL;
+	Router->IsReady = 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API appends a hop to a packet flow of a plan, unless the flow already
+* has it.
+*
+* @param	Plan: Plan state.
+* @param	Start: First hop of the flow.
+* @param	Hop: Hop to append.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the hops cannot grow.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmPktPlanAddHop(XAie_StrmPktPlanState *Plan, u32 Start,
+		const XAie_StrmFlow *Hop)
+{
+	for(u32 i = Start; i < Plan->NumHops; i++) {
+		const XAie_StrmFlow *H = &Plan->Hops[i];
+
+		if((H->Loc.Col == Hop->Loc.Col) &&
+				(H->Loc.Row == Hop->Loc.Row) &&
+				(H->Master == Hop->Master) &&
+				(H->MstrPortNum == Hop->MstrPortNum) &&
+				(H->DropHeader == Hop->DropHeader)) {
+			return XAIE_OK;
+		}
+	}
+
+	if(Plan->NumHops == Plan->MaxHops) {
+		u32 MaxHops = Plan->MaxHops * 2U;
+		XAie_StrmFlow *Hops;
+
+		Hops = (XAie_StrmFlow *)realloc(Plan->Hops, MaxHops *
+				sizeof(*Hops));
+		if(Hops == NULL) {
+			XAIE_ERROR("Memory allocation for packet plan failed\n");
+			return XAIE_ERR;
+		}
+
+		Plan->Hops = Hops;
+		Plan->MaxHops = MaxHops;
+	}
+
+	Plan->Hops[Plan->NumHops++] = *Hop;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API picks the port a packet flow leaves a tile from towards one of its
+* neighbours. A flow which already leaves the tile in that direction keeps
+* its port, otherwise the port with the fewest packet flows is taken, among
+* the ports not used by the router.
+*
+* @param	DevInst: Device Instance
+* @param	Router: Router of the circuit switched paths, or NULL.
+* @param	Plan: Plan state.
+* @param	Start: First hop of the flow.
+* @param	Loc: Location of the tile.
+* @param	Out: Direction of the master port.
+* @param	Port: Pointer to return the port number.
+*
+* @return	XAIE_OK on success, XAIE_ERR_STREAM_PORT if no port is free.
+*
+* @note		Internal only. The neighbour tile is in the partition.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmPktPlanPickPort(XAie_DevInst *DevInst,
+		const XAie_StrmRouter *Router, XAie_StrmPktPlanState *Plan,
+		u32 Start, XAie_LocType Loc, StrmSwPortType Out, u8 *Port)
+{
+	static const s8 DCol[XAIE_SS_ROUTER_NUM_DIRS] = {0, -1, 0, 1};
+	static const s8 DRow[XAIE_SS_ROUTER_NUM_DIRS] = {-1, 0, 1, 0};
+	const XAie_StrmMod *StrmMod, *NextMod;
+	StrmSwPortType In;
+	XAie_LocType Next;
+	u32 Dir = (u32)(Out - SOUTH), NumPorts, Best;
+	u16 *Load;
+
+	for(u32 i = Start; i < Plan->NumHops; i++) {
+		if((Plan->Hops[i].Loc.Col == Loc.Col) &&
+				(Plan->Hops[i].Loc.Row == Loc.Row) &&
+				(Plan->Hops[i].Master == Out)) {
+			*Port = Plan->Hops[i].MstrPortNum;
+			return XAIE_OK;
+		}
+	}
+
+	Next = XAie_TileLoc((u8)(Loc.Col + DCol[Dir]),
+			(u8)(Loc.Row + DRow[Dir]));
+	In = (StrmSwPortType)(SOUTH + ((Dir + 2U) % XAIE_SS_ROUTER_NUM_DIRS));
+	StrmMod = _XAie_StrmRouterGetMod(DevInst, Loc.Col, Loc.Row);
+	NextMod = _XAie_StrmRouterGetMod(DevInst, Next.Col, Next.Row);
+	if(NextMod == NULL) {
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	NumPorts = StrmMod->MstrConfig[Out].NumPorts;
+	if(NextMod->SlvConfig[In].NumPorts < NumPorts) {
+		NumPorts = NextMod->SlvConfig[In].NumPorts;
+	}
+	if(NumPorts > XAIE_SS_ROUTER_MAX_PORTS) {
+		NumPorts = XAIE_SS_ROUTER_MAX_PORTS;
+	}
+
+	Load = &Plan->Load[(((u32)Loc.Col * DevInst->NumRows + Loc.Row) *
+			XAIE_SS_ROUTER_NUM_DIRS + Dir) *
+		XAIE_SS_ROUTER_MAX_PORTS];
+	Best = NumPorts;
+	for(u32 p = 0U; p < NumPorts; p++) {
+		if((Router != NULL) &&
+				((*_XAie_StrmRouterUsed(Router,
+					Router->MstrUsed, Loc, Out) |
+				  *_XAie_StrmRouterUsed(Router,
+					Router->SlvUsed, Next, In)) &
+				 (1U << p))) {
+			continue;
+		}
+
+		if((Best == NumPorts) || (Load[p] < Load[Best])) {
+			Best = p;
+		}
+	}
+
+	if(Best == NumPorts) {
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	Load[Best]++;
+	*Port = (u8)Best;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API places the hops of a packet flow. The path to each destination goes
+* along the row of the source first, then along the column of the
+* destination, so the paths of a multicast flow share their common part and
+* each tile is entered once. Flows from a tile without east and west ports,
+* such as a memory tile, go along the column of the source first instead.
+*
+* @param	DevInst: Device Instance
+* @param	Router: Router of the circuit switched paths, or NULL.
+* @param	Plan: Plan state.
+* @param	Flow: Packet flow.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmPktPlanFlow(XAie_DevInst *DevInst,
+		const XAie_StrmRouter *Router, XAie_StrmPktPlanState *Plan,
+		const XAie_StrmPktFlow *Flow)
+{
+	const XAie_StrmMod *StrmMod;
+	u32 Start = Plan->NumHops;
+	u8 RowFirst;
+	AieRC RC;
+
+	if((Flow->Dsts == NULL) || (Flow->NumDsts == 0U) ||
+			((Flow->PktId != XAIE_SS_PKT_ID_AUTO) &&
+			 (Flow->PktId > XAIE_PACKET_ID_MAX))) {
+		XAIE_ERROR("Invalid destinations or packet id\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_StrmRouterCheckPort(DevInst, Flow->SrcLoc,
+			XAIE_STRMSW_SLAVE, Flow->Slave, Flow->SlvPortNum);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	StrmMod = _XAie_StrmRouterGetMod(DevInst, Flow->SrcLoc.Col,
+			Flow->SrcLoc.Row);
+	RowFirst = ((StrmMod->MstrConfig[EAST].NumPorts != 0U) ||
+			(StrmMod->MstrConfig[WEST].NumPorts != 0U)) ?
+		XAIE_ENABLE : XAIE_DISABLE;
+
+	for(u32 d = 0U; d < Flow->NumDsts; d++) {
+		const XAie_StrmPktDst *Dst = &Flow->Dsts[d];
+		XAie_StrmFlow Hop;
+
+		RC = _XAie_StrmRouterCheckPort(DevInst, Dst->Loc,
+				XAIE_STRMSW_MASTER, Dst->Master,
+				Dst->MstrPortNum);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		if(Dst->DropHeader > XAIE_SS_PKT_DROP_HEADER) {
+			XAIE_ERROR("Invalid drop header\n");
+			return XAIE_INVALID_ARGS;
+		}
+
+		Hop.Loc = Flow->SrcLoc;
+		Hop.Slave = Flow->Slave;
+		Hop.SlvPortNum = Flow->SlvPortNum;
+		Hop.PktEn = XAIE_ENABLE;
+		Hop.PktId = 0U;
+		Hop.DropHeader = XAIE_SS_PKT_DONOT_DROP_HEADER;
+
+		while((Hop.Loc.Col != Dst->Loc.Col) ||
+				(Hop.Loc.Row != Dst->Loc.Row)) {
+			u8 Horizontal = (Dst->Loc.Col != Hop.Loc.Col) &&
+				((RowFirst == XAIE_ENABLE) ||
+				 (Dst->Loc.Row == Hop.Loc.Row));
+
+			if(Horizontal) {
+				Hop.Master = (Dst->Loc.Col > Hop.Loc.Col) ?
+					EAST : WEST;
+			} else {
+				Hop.Master = (Dst->Loc.Row > Hop.Loc.Row) ?
+					NORTH : SOUTH;
+			}
+
+			RC = _XAie_StrmPktPlanPickPort(DevInst, Router, Plan,
+					Start, Hop.Loc, Hop.Master,
+					&Hop.MstrPortNum);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("No packet path from tile (%d, %d) to (%d, %d)\n",
+						Flow->SrcLoc.Col,
+						Flow->SrcLoc.Row,
+						Dst->Loc.Col, Dst->Loc.Row);
+				return RC;
+			}
+
+			RC = _XAie_StrmPktPlanAddHop(Plan, Start, &Hop);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+
+			/* The next tile is entered from the opposite side */
+			Hop.Slave = (StrmSwPortType)(SOUTH +
+					((Hop.Master - SOUTH + 2U) %
+					 XAIE_SS_ROUTER_NUM_DIRS));
+			Hop.SlvPortNum = Hop.MstrPortNum;
+			if(Hop.Master == EAST) {
+				Hop.Loc.Col++;
+			} else if(Hop.Master == WEST) {
+				Hop.Loc.Col--;
+			} else if(Hop.Master == NORTH) {
+				Hop.Loc.Row++;
+			} else {
+				Hop.Loc.Row--;
+			}
+		}
+
+		Hop.Master = Dst->Master;
+		Hop.MstrPortNum = Dst->MstrPortNum;
+		Hop.DropHeader = Dst->DropHeader;
+		RC = _XAie_StrmPktPlanAddHop(Plan, Start, &Hop);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API compares two slave port keys of a packet plan.
+*
+* @param	A: Pointer to the first key.
+* @param	B: Pointer to the second key.
+*
+* @return	Negative, zero or positive as per qsort().
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static int _XAie_StrmPktPlanKeyCmp(const void *A, const void *B)
+{
+	u32 KA = *(const u32 *)A;
+	u32 KB = *(const u32 *)B;
+
+	return (KA < KB) ? -1 : (KA > KB);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if two packet flows of a plan go through a common slave
+* port, in which case they need different packet ids.
+*
+* @param	Plan: Plan state, with the keys of each flow sorted.
+* @param	A: Index of the first flow.
+* @param	B: Index of the second flow.
+*
+* @return	XAIE_ENABLE if the flows share a slave port, else XAIE_DISABLE.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_StrmPktPlanConflict(const XAie_StrmPktPlanState *Plan, u32 A,
+		u32 B)
+{
+	u32 i = Plan->First[A], j = Plan->First[B];
+
+	while((i < Plan->First[A + 1U]) && (j < Plan->First[B + 1U])) {
+		if(Plan->Keys[i] == Plan->Keys[j]) {
+			return XAIE_ENABLE;
+		}
+
+		if(Plan->Keys[i] < Plan->Keys[j]) {
+			i++;
+		} else {
+			j++;
+		}
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API allocates the packet ids of the flows of a plan. Only flows which
+* share a slave port need different ids, so ids are reused across the array.
+* The flows with the most conflicts are given an id first, each takes the
+* lowest id not taken by the flows it conflicts with.
+*
+* @param	Plan: Plan state.
+* @param	Flows: Array of packet flows, updated with their ids.
+* @param	NumFlows: Number of flows in Flows.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmPktPlanIds(XAie_StrmPktPlanState *Plan,
+		XAie_StrmPktFlow *Flows, u32 NumFlows)
+{
+	u32 *Degree;
+
+	for(u32 f = 0U; f < NumFlows; f++) {
+		for(u32 i = Plan->First[f]; i < Plan->First[f + 1U]; i++) {
+			const XAie_StrmFlow *H = &Plan->Hops[i];
+
+			Plan->Keys[i] = ((u32)H->Loc.Col << 24U) |
+				((u32)H->Loc.Row << 16U) |
+				((u32)H->Slave << 8U) | H->SlvPortNum;
+		}
+		qsort(&Plan->Keys[Plan->First[f]],
+				Plan->First[f + 1U] - Plan->First[f],
+				sizeof(*Plan->Keys), _XAie_StrmPktPlanKeyCmp);
+	}
+
+	Degree = (u32 *)calloc(NumFlows, sizeof(*Degree));
+	if(Degree == NULL) {
+		XAIE_ERROR("Memory allocation for packet plan failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 a = 0U; a < NumFlows; a++) {
+		for(u32 b = a + 1U; b < NumFlows; b++) {
+			if(_XAie_StrmPktPlanConflict(Plan, a, b) ==
+					XAIE_DISABLE) {
+				continue;
+			}
+
+			if((Flows[a].PktId != XAIE_SS_PKT_ID_AUTO) &&
+					(Flows[a].PktId == Flows[b].PktId)) {
+				XAIE_ERROR("Packet flows %d and %d share a slave port with packet id %d\n",
+						a, b, Flows[a].PktId);
+				free(Degree);
+				return XAIE_ERR_STREAM_PORT;
+			}
+			Degree[a]++;
+			Degree[b]++;
+		}
+	}
+
+	for(;;) {
+		u32 Best = NumFlows, Taken = 0U, Id;
+
+		for(u32 f = 0U; f < NumFlows; f++) {
+			if((Flows[f].PktId == XAIE_SS_PKT_ID_AUTO) &&
+					((Best == NumFlows) ||
+					 (Degree[f] > Degree[Best]))) {
+				Best = f;
+			}
+		}
+
+		if(Best == NumFlows) {
+			break;
+		}
+
+		for(u32 f = 0U; f < NumFlows; f++) {
+			if((f != Best) &&
+					(Flows[f].PktId != XAIE_SS_PKT_ID_AUTO) &&
+					(_XAie_StrmPktPlanConflict(Plan, Best,
+						f) == XAIE_ENABLE)) {
+				Taken |= 1U << Flows[f].PktId;
+			}
+		}
+
+		for(Id = 0U; Id <= XAIE_PACKET_ID_MAX; Id++) {
+			if((Taken & (1U << Id)) == 0U) {
+				break;
+			}
+		}
+
+		if(Id > XAIE_PACKET_ID_MAX) {
+			XAIE_ERROR("No free packet id for packet flow %d\n",
+					Best);
+			free(Degree);
+			return XAIE_ERR_STREAM_PORT;
+		}
+
+		Flows[Best].PktId = (u8)Id;
+	}
+
+	free(Degree);
+
+	for(u32 f = 0U; f < NumFlows; f++) {
+		for(u32 i = Plan->First[f]; i < Plan->First[f + 1U]; i++) {
+			Plan->Hops[i].PktId = Flows[f].PktId;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API plans a set of packet switched flows and compiles them into a
+* route. The paths of the flows are placed with the ports of each direction
+* balanced between the flows, the packet ids left to the planner are
+* allocated so that the flows sharing a slave port have different ids, and
+* the slots, arbitors and msels of every traversed tile are allocated by
+* XAie_StrmRouteCompile(). The whole configuration is applied in one batch
+* with XAie_StrmRouteApply().
+*
+* @param	DevInst: Device Instance
+* @param	Router: Router of the circuit switched paths, or NULL. The
+*		ports used by its paths are avoided, and the ports of the plan
+*		are reserved in it on success.
+* @param	Flows: Array of packet flows. The flows with a packet id of
+*		XAIE_SS_PKT_ID_AUTO are updated with the id allocated, which
+*		the source has to send the packets with.
+* @param	NumFlows: Number of flows in Flows.
+* @param	Route: Pointer to the route to compile to.
+*
+* @return	XAIE_OK on success, XAIE_ERR_STREAM_PORT if the flows do not
+*		fit, Error code on failure.
+*
+* @note		No register is written. The ports used by the flows of the
+*		plan are shared between them. The route has to be released
+*		with XAie_StrmRouteFree().
+*
+*******************************************************************************/
+AieRC XAie_StrmPktPlan(XAie_DevInst *DevInst, XAie_StrmRouter *Router,
+		XAie_StrmPktFlow *Flows, u32 NumFlows, XAie_StrmRoute *Route)
+{
+	XAie_StrmPktPlanState Plan;
+	AieRC RC = XAIE_OK;
+	u8 *AutoIds;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Flows == NULL) || (NumFlows == 0U) || (Route == XAIE_NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Router != NULL) {
+		RC = _XAie_StrmRouterCheck(DevInst, Router);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	Plan.NumHops = 0U;
+	Plan.MaxHops = 4U * NumFlows;
+	Plan.Hops = (XAie_StrmFlow *)malloc(Plan.MaxHops *
+			sizeof(*Plan.Hops));
+	Plan.Keys = NULL;
+	Plan.First = (u32 *)malloc((NumFlows + 1U) * sizeof(*Plan.First));
+	Plan.Load = (u16 *)calloc((u32)DevInst->NumCols * DevInst->NumRows *
+			XAIE_SS_ROUTER_NUM_DIRS * XAIE_SS_ROUTER_MAX_PORTS,
+			sizeof(*Plan.Load));
+	AutoIds = (u8 *)malloc(NumFlows * sizeof(*AutoIds));
+	if((Plan.Hops == NULL) || (Plan.First == NULL) ||
+			(Plan.Load == NULL) || (AutoIds == NULL)) {
+		XAIE_ERROR("Memory allocation for packet plan failed\n");
+		RC = XAIE_ERR;
+		goto Exit;
+	}
+
+	for(u32 f = 0U; f < NumFlows; f++) {
+		AutoIds[f] = (Flows[f].PktId == XAIE_SS_PKT_ID_AUTO) ?
+			XAIE_ENABLE : XAIE_DISABLE;
+		Plan.First[f] = Plan.NumHops;
+		RC = _XAie_StrmPktPlanFlow(DevInst, Router, &Plan, &Flows[f]);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to plan packet flow %d\n", f);
+			goto Exit;
+		}
+	}
+	Plan.First[NumFlows] = Plan.NumHops;
+
+	Plan.Keys = (u32 *)malloc(Plan.NumHops * sizeof(*Plan.Keys));
+	if(Plan.Keys == NULL) {
+		XAIE_ERROR("Memory allocation for packet plan failed\n");
+		RC = XAIE_ERR;
+		goto Exit;
+	}
+
+	RC = _XAie_StrmPktPlanIds(&Plan, Flows, NumFlows);
+	if(RC == XAIE_OK) {
+		RC = XAie_StrmRouteCompile(DevInst, Route, Plan.Hops,
+				Plan.NumHops);
+	}
+	if((RC == XAIE_OK) && (Router != NULL)) {
+		RC = XAie_StrmRouterReserve(DevInst, Router, Plan.Hops,
+				Plan.NumHops);
+		if(RC != XAIE_OK) {
+			(void)XAie_StrmRouteFree(Route);
+		}
+	}
+
+Exit:
+	/* The ids are only handed out when the plan succeeds */
+	if((RC != XAIE_OK) && (AutoIds != NULL)) {
+		for(u32 f = 0U; f < NumFlows; f++) {
+			if(AutoIds[f] == XAIE_ENABLE) {
+				Flows[f].PktId = XAIE_SS_PKT_ID_AUTO;
+			}
+		}
+	}
+
+	free(Plan.Hops);
+	free(Plan.Keys);
+	free(Plan.First);
+	free(Plan.Load);
+	free(AutoIds);
+	return RC;
+}
+
+#endif /* XAIE_FEATURE_SS_ENABLE */
+/** @} */
@@ -0,0 +1,904 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_timecal.c
+* @{
+*
+* This file contains routines to correlate the timer of AIE tiles with the
+* host monotonic clock. The timer of a reference tile is sampled together with
+* the host clock, and a line is fitted through a window of the latest samples
+* to get the offset and drift of the timer with an error bound. Once the
+* timers of the partition are synchronized, the fit converts the timestamps
+* of any tile, e.g. from trace packets, to host time.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifndef __AIEBAREMETAL__
+#define  _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdlib.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_timecal.h"
+
+#ifdef XAIE_FEATURE_TIMER_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TIMECAL_NS_PER_SEC		1000000000ULL
+#define XAIE_TIMECAL_SKEW_DEF_SAMPLES	16U
+
+/**************************** Type Definitions *******************************/
+/* Timer value and host time of one sample */
+typedef struct {
+	u64 Cycles;
+	u64 HostNs;	/* Middle of the host time interval of the read */
+	u64 HalfNs;	/* Half of the host time interval of the read */
+} XAie_TimeCalPoint;
+
+struct XAie_TimeCal {
+	XAie_DevInst *DevInst;
+	XAie_LocType Loc;
+	u64 LowAddr;	/* Address of the timer low register */
+	u64 HighAddr;	/* Address of the timer high register */
+	XAie_TimeCalPoint *Samples;	/* Ring of the latest samples */
+	u32 WindowSize;
+	u32 NumSamples;
+	u32 Head;	/* Index of the oldest sample */
+	XAie_TimeCalFit Fit;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+	pthread_t Thread;
+	u32 PeriodUs;
+	u8 Running;
+	u8 Stop;
+	AieRC Status;	/* Error which stopped the sampling thread */
+#endif
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API takes the lock protecting the samples and the fit of a calibration.
+*
+* @param	Cal: Calibration.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TimeCalLock(XAie_TimeCal *Cal)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_lock(&Cal->Lock);
+#else
+	(void)Cal;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the lock protecting the samples and the fit of a
+* calibration.
+*
+* @param	Cal: Calibration.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TimeCalUnlock(XAie_TimeCal *Cal)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_unlock(&Cal->Lock);
+#else
+	(void)Cal;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the host monotonic time.
+*
+* @return	Host time in nanoseconds.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u64 _XAie_TimeCalHostNs(void)
+{
+#ifndef __AIEBAREMETAL__
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * XAIE_TIMECAL_NS_PER_SEC + (u64)Ts.tv_nsec;
+#else
+	return 0U;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API fits a line through the sample window of a calibration with least
+* squares. The error bound is the largest distance of a sample to the line
+* plus the largest uncertainty of the host time of a sample.
+*
+* @param	Cal: Calibration.
+*
+* @return	None.
+*
+* @note		Internal only. The caller holds the lock of the calibration.
+*		The samples are taken relative to the oldest one so the sums
+*		keep their precision.
+*
+******************************************************************************/
+static void _XAie_TimeCalRefit(XAie_TimeCal *Cal)
+{
+	const XAie_TimeCalPoint *Base = &Cal->Samples[Cal->Head];
+	double SumX = 0.0, SumY = 0.0, Sxx = 0.0, Sxy = 0.0;
+	double MeanX, MeanY, Slope, MaxRes = 0.0;
+	u64 MaxHalf = 0U;
+	u32 N = Cal->NumSamples;
+
+	for(u32 i = 0U; i < N; i++) {
+		const XAie_TimeCalPoint *S =
+			&Cal->Samples[(Cal->Head + i) % Cal->WindowSize];
+
+		SumX += (double)(S->Cycles - Base->Cycles);
+		SumY += (double)(S->HostNs - Base->HostNs);
+	}
+	MeanX = SumX / N;
+	MeanY = SumY / N;
+
+	for(u32 i = 0U; i < N; i++) {
+		const XAie_TimeCalPoint *S =
+			&Cal->Samples[(Cal->Head + i) % Cal->WindowSize];
+		double X = (double)(S->Cycles - Base->Cycles) - MeanX;
+		double Y = (double)(S->HostNs - Base->HostNs) - MeanY;
+
+		Sxx += X * X;
+		Sxy += X * Y;
+	}
+
+	Slope = (Sxx > 0.0) ? (Sxy / Sxx) : 0.0;
+
+	for(u32 i = 0U; i < N; i++) {
+		const XAie_TimeCalPoint *S =
+			&Cal->Samples[(Cal->Head + i) % Cal->WindowSize];
+		double Res = (double)(S->HostNs - Base->HostNs) - MeanY -
+			Slope * ((double)(S->Cycles - Base->Cycles) - MeanX);
+
+		if(Res < 0.0) {
+			Res = -Res;
+		}
+		if(Res > MaxRes) {
+			MaxRes = Res;
+		}
+		if(S->HalfNs > MaxHalf) {
+			MaxHalf = S->HalfNs;
+		}
+	}
+
+	Cal->Fit.CycleRef = Base->Cycles + (u64)(MeanX + 0.5);
+	Cal->Fit.HostRefNs = Base->HostNs + (u64)(MeanY + 0.5);
+	Cal->Fit.NsPerCycle = Slope;
+	Cal->Fit.ErrNs = (u64)(MaxRes + 0.5) + MaxHalf + 1U;
+	Cal->Fit.NumSamples = N;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a calibration of the timer of a reference tile against the
+* host monotonic clock.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the reference tile, usually a shim tile.
+* @param	Module: Module of the timer.
+*			For AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			For Pl or Shim tile - XAIE_PL_MOD,
+*			For Mem tile - XAIE_MEM_MOD.
+* @param	WindowSize: Number of latest samples the fit is computed on.
+*		Must be at least 2.
+*
+* @return	Pointer to the calibration on success, NULL on failure.
+*
+* @note		The calibration has to be released with XAie_TimeCalFree().
+*		Not supported for baremetal as there is no host clock.
+*
+******************************************************************************/
+XAie_TimeCal* XAie_TimeCalCreate(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, u32 WindowSize)
+{
+#ifndef __AIEBAREMETAL__
+	const XAie_TimerMod *TimerMod;
+	XAie_TimeCal *Cal;
+	u64 TileAddr;
+	u8 TileType;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return NULL;
+	}
+
+	if(WindowSize < 2U) {
+		XAIE_ERROR("Invalid calibration window size\n");
+		return NULL;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return NULL;
+	}
+
+	if(_XAie_CheckModule(DevInst, Loc, Module) != XAIE_OK) {
+		return NULL;
+	}
+
+	Cal = (XAie_TimeCal *)calloc(1U, sizeof(*Cal));
+	if(Cal == NULL) {
+		XAIE_ERROR("Memory allocation for calibration failed\n");
+		return NULL;
+	}
+
+	Cal->Samples = (XAie_TimeCalPoint *)calloc(WindowSize,
+			sizeof(*Cal->Samples));
+	if(Cal->Samples == NULL) {
+		XAIE_ERROR("Memory allocation for calibration failed\n");
+		free(Cal);
+		return NULL;
+	}
+
+	if(Module == XAIE_PL_MOD) {
+		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[0U];
+	} else {
+		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[Module];
+	}
+
+	TileAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	Cal->DevInst = DevInst;
+	Cal->Loc = Loc;
+	Cal->LowAddr = TileAddr + TimerMod->LowOff;
+	Cal->HighAddr = TileAddr + TimerMod->HighOff;
+	Cal->WindowSize = WindowSize;
+
+	pthread_mutex_init(&Cal->Lock, NULL);
+
+	return Cal;
+#else
+	(void)DevInst;
+	(void)Loc;
+	(void)Module;
+	(void)WindowSize;
+	XAIE_ERROR("Timer calibration is not supported for baremetal\n");
+	return NULL;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API takes one sample of the timer of the reference tile and the host
+* clock, adds it to the sample window and refits the calibration. Once the
+* window is full the oldest sample is dropped.
+*
+* @param	Cal: Calibration.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		A sample is two register reads, in the same order as
+*		XAie_ReadTimer(), bracketed by two host clock reads. The reads
+*		go to the backend directly, so they are neither recorded in
+*		the transaction of the calling thread nor looked up in the
+*		shadow cache, and sampling can run in a thread of its own.
+*
+******************************************************************************/
+AieRC XAie_TimeCalSample(XAie_TimeCal *Cal)
+{
+	AieRC RC;
+	XAie_TimeCalPoint *S;
+	u32 Low, High;
+	u64 Start, End;
+
+	if(Cal == NULL) {
+		XAIE_ERROR("Invalid calibration\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_TimeCalLock(Cal);
+	Start = _XAie_TimeCalHostNs();
+	RC = _XAie_IORead32(Cal->DevInst, Cal->LowAddr, &Low);
+	if(RC == XAIE_OK) {
+		RC = _XAie_IORead32(Cal->DevInst, Cal->HighAddr, &High);
+	}
+	End = _XAie_TimeCalHostNs();
+	if(RC != XAIE_OK) {
+		_XAie_TimeCalUnlock(Cal);
+		XAIE_ERROR("Unable to read timer of tile (%d, %d)\n",
+				Cal->Loc.Col, Cal->Loc.Row);
+		return RC;
+	}
+
+	if(Cal->NumSamples < Cal->WindowSize) {
+		S = &Cal->Samples[(Cal->Head + Cal->NumSamples) %
+			Cal->WindowSize];
+		Cal->NumSamples++;
+	} else {
+		S = &Cal->Samples[Cal->Head];
+		Cal->Head = (Cal->Head + 1U) % Cal->WindowSize;
+	}
+
+	S->Cycles = ((u64)High << 32U) | Low;
+	S->HostNs = Start + (End - Start) / 2U;
+	S->HalfNs = (End - Start + 1U) / 2U;
+
+	if(Cal->NumSamples >= 2U) {
+		_XAie_TimeCalRefit(Cal);
+	}
+	_XAie_TimeCalUnlock(Cal);
+
+	return XAIE_OK;
+}
+
+#ifndef __AIEBAREMETAL__
+/*****************************************************************************/
+/**
+*
+* This is the body of the sampling thread of a calibration. It samples the
+* timer once per period until it is asked to stop or a sample fails.
+*
+* @param	Arg: Calibration.
+*
+* @return	NULL.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void *_XAie_TimeCalWorker(void *Arg)
+{
+	XAie_TimeCal *Cal = (XAie_TimeCal *)Arg;
+	struct timespec Period;
+
+	while(1) {
+		AieRC RC;
+		u8 Stop;
+
+		pthread_mutex_lock(&Cal->Lock);
+		Stop = Cal->Stop;
+		pthread_mutex_unlock(&Cal->Lock);
+		if(Stop != 0U) {
+			break;
+		}
+
+		RC = XAie_TimeCalSample(Cal);
+		if(RC != XAIE_OK) {
+			pthread_mutex_lock(&Cal->Lock);
+			Cal->Status = RC;
+			pthread_mutex_unlock(&Cal->Lock);
+			break;
+		}
+
+		Period.tv_sec = Cal->PeriodUs / 1000000U;
+		Period.tv_nsec = (long)(Cal->PeriodUs % 1000000U) * 1000L;
+		nanosleep(&Period, NULL);
+	}
+
+	return NULL;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API starts a host thread which refreshes a calibration periodically.
+*
+* @param	Cal: Calibration.
+* @param	PeriodUs: Period between two samples in microseconds.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The thread has to be stopped with XAie_TimeCalStop().
+*
+******************************************************************************/
+AieRC XAie_TimeCalStart(XAie_TimeCal *Cal, u32 PeriodUs)
+{
+#ifndef __AIEBAREMETAL__
+	if(Cal == NULL) {
+		XAIE_ERROR("Invalid calibration\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Cal->Running != 0U) {
+		XAIE_ERROR("Calibration is already sampling\n");
+		return XAIE_ERR;
+	}
+
+	Cal->PeriodUs = PeriodUs;
+	Cal->Stop = 0U;
+	Cal->Status = XAIE_OK;
+	if(pthread_create(&Cal->Thread, NULL, _XAie_TimeCalWorker,
+				Cal) != 0) {
+		XAIE_ERROR("Unable to create sampling thread\n");
+		return XAIE_ERR;
+	}
+
+	Cal->Running = 1U;
+	return XAIE_OK;
+#else
+	(void)Cal;
+	(void)PeriodUs;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stops the sampling thread of a calibration.
+*
+* @param	Cal: Calibration.
+*
+* @return	XAIE_OK on success, the error which stopped the sampling thread
+*		or error code on failure.
+*
+* @note		The samples and the fit are kept.
+*
+******************************************************************************/
+AieRC XAie_TimeCalStop(XAie_TimeCal *Cal)
+{
+#ifndef __AIEBAREMETAL__
+	if(Cal == NULL) {
+		XAIE_ERROR("Invalid calibration\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Cal->Running == 0U) {
+		return XAIE_OK;
+	}
+
+	pthread_mutex_lock(&Cal->Lock);
+	Cal->Stop = 1U;
+	pthread_mutex_unlock(&Cal->Lock);
+	pthread_join(Cal->Thread, NULL);
+	Cal->Running = 0U;
+
+	return Cal->Status;
+#else
+	(void)Cal;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API synchronizes the timers of the partition and restarts a
+* calibration, as the fit of the reference timer is not valid once it has been
+* reset. After this every tile timer shares the calibrated base.
+*
+* @param	Cal: Calibration.
+* @param	SyncCtx: Timer sync context from XAie_TimerSyncInit(), or NULL
+*		to synchronize with XAie_SyncTimer().
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The sampling thread, if running, keeps running and refits from
+*		the new samples.
+*
+******************************************************************************/
+AieRC XAie_TimeCalResync(XAie_TimeCal *Cal, XAie_TimerSyncCtx *SyncCtx)
+{
+	AieRC RC;
+
+	if(Cal == NULL) {
+		XAIE_ERROR("Invalid calibration\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_TimeCalLock(Cal);
+	if(SyncCtx == NULL) {
+		RC = XAie_SyncTimer(Cal->DevInst);
+	} else {
+		RC = XAie_TimerSync(Cal->DevInst, SyncCtx);
+	}
+	Cal->NumSamples = 0U;
+	Cal->Head = 0U;
+	Cal->Fit.NumSamples = 0U;
+	_XAie_TimeCalUnlock(Cal);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the current fit of a calibration.
+*
+* @param	Cal: Calibration.
+* @param	Fit: Pointer to return the fit.
+*
+* @return	XAIE_OK on success, XAIE_ERR if fewer than two samples have been
+*		taken, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_TimeCalGetFit(XAie_TimeCal *Cal, XAie_TimeCalFit *Fit)
+{
+	AieRC RC = XAIE_OK;
+
+	if((Cal == NULL) || (Fit == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_TimeCalLock(Cal);
+	if(Cal->Fit.NumSamples < 2U) {
+		XAIE_ERROR("Calibration needs at least two samples\n");
+		RC = XAIE_ERR;
+	} else {
+		*Fit = Cal->Fit;
+	}
+	_XAie_TimeCalUnlock(Cal);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API converts a timer value of the partition to host monotonic time.
+*
+* @param	Cal: Calibration.
+* @param	Cycles: Timer value, of the reference tile or of any tile whose
+*		timer is synchronized with it.
+* @param	HostNs: Pointer to return the host time in nanoseconds.
+* @param	ErrNs: Pointer to return the error bound in nanoseconds, or
+*		NULL.
+*
+* @return	XAIE_OK on success, XAIE_ERR if fewer than two samples have been
+*		taken, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_TimeCalToHost(XAie_TimeCal *Cal, u64 Cycles, u64 *HostNs,
+		u64 *ErrNs)
+{
+	AieRC RC;
+	XAie_TimeCalFit Fit;
+	double Delta;
+
+	if(HostNs == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = XAie_TimeCalGetFit(Cal, &Fit);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Cycles >= Fit.CycleRef) {
+		Delta = (double)(Cycles - Fit.CycleRef) * Fit.NsPerCycle;
+	} else {
+		Delta = -(double)(Fit.CycleRef - Cycles) * Fit.NsPerCycle;
+	}
+
+	*HostNs = (u64)((double)Fit.HostRefNs + Delta + 0.5);
+	if(ErrNs != NULL) {
+		*ErrNs = Fit.ErrNs;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API converts a host monotonic time to a timer value of the partition.
+*
+* @param	Cal: Calibration.
+* @param	HostNs: Host time in nanoseconds.
+* @param	Cycles: Pointer to return the timer value.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the calibration has no usable
+*		fit yet, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_TimeCalToCycles(XAie_TimeCal *Cal, u64 HostNs, u64 *Cycles)
+{
+	AieRC RC;
+	XAie_TimeCalFit Fit;
+	double Delta;
+
+	if(Cycles == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = XAie_TimeCalGetFit(Cal, &Fit);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Fit.NsPerCycle <= 0.0) {
+		XAIE_ERROR("Timer did not advance over the calibration window\n");
+		return XAIE_ERR;
+	}
+
+	if(HostNs >= Fit.HostRefNs) {
+		Delta = (double)(HostNs - Fit.HostRefNs) / Fit.NsPerCycle;
+	} else {
+		Delta = -(double)(Fit.HostRefNs - HostNs) / Fit.NsPerCycle;
+	}
+
+	*Cycles = (u64)((double)Fit.CycleRef + Delta + 0.5);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases a calibration. The sampling thread is stopped first if it
+* is running.
+*
+* @param	Cal: Calibration.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_TimeCalFree(XAie_TimeCal *Cal)
+{
+	if(Cal == NULL) {
+		return;
+	}
+
+	(void)XAie_TimeCalStop(Cal);
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_destroy(&Cal->Lock);
+#endif
+	free(Cal->Samples);
+	free(Cal);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the address of the low register of the timer of a tile
+* used for the skew measurement. The core module timer is used for AIE tiles
+* and the only timer of the tile otherwise.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the tile.
+* @param	Addr: Pointer to return the address.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TimerSkewLowAddr(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u64 *Addr)
+{
+	const XAie_TimerMod *TimerMod;
+	u8 TileType;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		XAIE_ERROR("Invalid Tile Type (%d, %d)\n", Loc.Col, Loc.Row);
+		return XAIE_INVALID_TILE;
+	}
+
+	if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[
+			XAIE_CORE_MOD];
+	} else {
+		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[0U];
+	}
+
+	*Addr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + TimerMod->LowOff;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API measures the skew of the timers of a list of tiles against the
+* timer of a reference tile and stores the compensation of each tile in a
+* table. A sample reads the low timer word of the reference tile, of the tile
+* and of the reference tile again; the tile is compared with the middle of
+* the two reference reads. The sample with the tightest reference reads is
+* kept, its half width is the uncertainty of the compensation.
+*
+* @param	DevInst: Device Instance.
+* @param	RefLoc: Location of the reference tile.
+* @param	Locs: Array of tile locations.
+* @param	NumLocs: Number of locations in Locs.
+* @param	NumSamples: Number of samples per tile. If 0, 16 are taken.
+* @param	Table: Pointer to the table to fill. Its previous skews are
+*		released.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The timers have to be synchronized, with XAie_SyncTimer() or
+*		XAie_TimerSync(), before the calibration and not since reset,
+*		so the table stays valid until the next synchronization. The
+*		resolution is bounded by the latency of a register read. The
+*		reads go to the backend directly, they are not recorded in the
+*		transaction of the calling thread.
+*
+******************************************************************************/
+AieRC XAie_TimerSkewCalibrate(XAie_DevInst *DevInst, XAie_LocType RefLoc,
+		const XAie_LocType *Locs, u32 NumLocs, u32 NumSamples,
+		XAie_TimerSkewTable *Table)
+{
+	XAie_TimerSkew *Skews;
+	u64 RefAddr;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Table == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance or skew table\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Locs == NULL) || (NumLocs == 0U)) {
+		XAIE_ERROR("Invalid tile location array\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(NumSamples == 0U) {
+		NumSamples = XAIE_TIMECAL_SKEW_DEF_SAMPLES;
+	}
+
+	RC = _XAie_TimerSkewLowAddr(DevInst, RefLoc, &RefAddr);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Skews = (XAie_TimerSkew *)calloc(NumLocs, sizeof(*Skews));
+	if(Skews == NULL) {
+		XAIE_ERROR("Memory allocation for skew table failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumLocs; i++) {
+		u32 Best = 0xFFFFFFFFU;
+		u64 Addr;
+
+		RC = _XAie_TimerSkewLowAddr(DevInst, Locs[i], &Addr);
+		if(RC != XAIE_OK) {
+			free(Skews);
+			return RC;
+		}
+
+		Skews[i].Loc = Locs[i];
+		for(u32 j = 0U; j < NumSamples; j++) {
+			u32 Ref0, Val, Ref1, Width;
+
+			RC = _XAie_IORead32(DevInst, RefAddr, &Ref0);
+			if(RC == XAIE_OK) {
+				RC = _XAie_IORead32(DevInst, Addr, &Val);
+			}
+			if(RC == XAIE_OK) {
+				RC = _XAie_IORead32(DevInst, RefAddr, &Ref1);
+			}
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Unable to read timer of tile "
+						"(%d, %d)\n", Locs[i].Col,
+						Locs[i].Row);
+				free(Skews);
+				return RC;
+			}
+
+			/* Differences of the low words are modulo 2^32 */
+			Width = Ref1 - Ref0;
+			if(Width >= Best) {
+				continue;
+			}
+
+			Best = Width;
+			Skews[i].Comp = (u64)(s32)(Ref0 +
+					Width / 2U - Val);
+			Skews[i].ErrCycles = (Width + 1U) / 2U;
+		}
+	}
+
+	XAie_TimerSkewFree(Table);
+	Table->RefLoc = RefLoc;
+	Table->Skews = Skews;
+	Table->NumSkews = NumLocs;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the compensation of a tile from a skew table.
+*
+* @param	Table: Skew table.
+* @param	Loc: Location of the tile.
+* @param	Comp: Pointer to return the cycles to add to the timer values
+*		of the tile, in two's complement when negative.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_TILE if the tile is not in
+*		the table.
+*
+* @note		The reference tile has a compensation of 0.
+*
+******************************************************************************/
+AieRC XAie_TimerSkewGet(const XAie_TimerSkewTable *Table, XAie_LocType Loc,
+		u64 *Comp)
+{
+	if((Table == NULL) || (Comp == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Loc.Col == Table->RefLoc.Col) && (Loc.Row == Table->RefLoc.Row)) {
+		*Comp = 0U;
+		return XAIE_OK;
+	}
+
+	for(u32 i = 0U; i < Table->NumSkews; i++) {
+		if((Table->Skews[i].Loc.Col == Loc.Col) &&
+				(Table->Skews[i].Loc.Row == Loc.Row)) {
+			*Comp = Table->Skews[i].Comp;
+			return XAIE_OK;
+		}
+	}
+
+	return XAIE_INVALID_TILE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the skews of a skew table.
+*
+* @param	Table: Skew table.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_TimerSkewFree(XAie_TimerSkewTable *Table)
+{
+	if(Table == NULL) {
+		return;
+	}
+
+	free(Table->Skews);
+	Table->Skews = NULL;
+	Table->NumSkews = 0U;
+}
+
+#endif /* XAIE_FEATURE_TIMER_ENABLE */
@@ -0,0 +1,80 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_timecal.h
+* @{
+*
+* Header file for the correlation of AIE timer cycles with host time.
+*
+******************************************************************************/
+#ifndef XAIETIMECAL_H
+#define XAIETIMECAL_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+#include "xaie_timer.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * Calibration of the timer of a reference tile against the host monotonic
+ * clock. It keeps a window of the latest samples and fits a line through them.
+ */
+typedef struct XAie_TimeCal XAie_TimeCal;
+
+/*
+ * Fit of a calibration. A timer value Cycles maps to the host time
+ * HostRefNs + (Cycles - CycleRef) * NsPerCycle, within ErrNs.
+ */
+typedef struct {
+	u64 CycleRef;		/* Timer value of the reference point */
+	u64 HostRefNs;		/* Host time of the reference point */
+	double NsPerCycle;	/* Drift corrected timer period */
+	u64 ErrNs;		/* Error bound over the sample window */
+	u32 NumSamples;		/* Samples in the window */
+} XAie_TimeCalFit;
+
+/* Timer skew of a tile against the reference tile of a skew table */
+typedef struct {
+	XAie_LocType Loc;
+	u64 Comp;		/* Cycles to add to the timer values of the tile,
+				   in two's complement when negative */
+	u32 ErrCycles;		/* Uncertainty of Comp */
+} XAie_TimerSkew;
+
+/*
+ * Compensation table of the timer skews left by the propagation of the sync
+ * broadcast, measured once with XAie_TimerSkewCalibrate().
+ */
+typedef struct {
+	XAie_LocType RefLoc;	/* Tile the skews are measured against */
+	XAie_TimerSkew *Skews;
+	u32 NumSkews;
+} XAie_TimerSkewTable;
+
+/************************** Function Prototypes  *****************************/
+XAie_TimeCal* XAie_TimeCalCreate(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, u32 WindowSize);
+AieRC XAie_TimeCalSample(XAie_TimeCal *Cal);
+AieRC XAie_TimeCalStart(XAie_TimeCal *Cal, u32 PeriodUs);
+AieRC XAie_TimeCalStop(XAie_TimeCal *Cal);
+AieRC XAie_TimeCalResync(XAie_TimeCal *Cal, XAie_TimerSyncCtx *SyncCtx);
+AieRC XAie_TimeCalGetFit(XAie_TimeCal *Cal, XAie_TimeCalFit *Fit);
+AieRC XAie_TimeCalToHost(XAie_TimeCal *Cal, u64 Cycles, u64 *HostNs,
+		u64 *ErrNs);
+AieRC XAie_TimeCalToCycles(XAie_TimeCal *Cal, u64 HostNs, u64 *Cycles);
+void XAie_TimeCalFree(XAie_TimeCal *Cal);
+AieRC XAie_TimerSkewCalibrate(XAie_DevInst *DevInst, XAie_LocType RefLoc,
+		const XAie_LocType *Locs, u32 NumLocs, u32 NumSamples,
+		XAie_TimerSkewTable *Table);
+AieRC XAie_TimerSkewGet(const XAie_TimerSkewTable *Table, XAie_LocType Loc,
+		u64 *Comp);
+void XAie_TimerSkewFree(XAie_TimerSkewTable *Table);
+
+#endif		/* end of protection macro */
+/** @} */
@@ -40,6 +40,7 @@
 /***************************** Macro Definitions *****************************/
 #define XAIE_TIMER_32BIT_SHIFT		32U
 #define XAIE_WAIT_CYCLE_MAX_VAL		0xFFFFFFFFFFFF
+#define XAIE_TIMER_WAIT_DEF_TIMEOUT_US	1000000U
 
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
@@ -82,7 +83,7 @@ AieRC XAie_SetTimerTrigEventVal(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -149,7 +150,7 @@ AieRC XAie_ResetTimer(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -221,7 +222,7 @@ AieRC XAie_SetTimerResetEvent(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -307,7 +308,7 @@ AieRC XAie_ReadTimer(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -382,7 +383,7 @@ AieRC XAie_WaitCycles(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -445,314 +446,587 @@ AieRC XAie_WaitCycles(XAie_DevInst *DevInst, XAie_LocType Loc,
 
 /*****************************************************************************/
 /**
-* This API returns the broadcast event enum given a resource id from the
-* event map.
+* This API returns the timer value reached event of a module.
 *
-* @param        DevInst: Device Instance
-* @param        Loc: Location of Tile
-* @param        Mod: Module type
-* @param        RscId: Specific resource to be requested
+* @param        DevInst - Device Instance.
+* @param        Loc - Location of tile.
+* @param        Module - Module of the tile.
 *
-* @return       Event enum on success.
+* @return       Event enum.
 *
 * @note         Internal only.
 *
-*******************************************************************************/
-static XAie_Events _XAie_GetBroadcastEventfromRscId(XAie_DevInst *DevInst,
-		XAie_LocType Loc, XAie_ModuleType Mod, u8 RscId)
+******************************************************************************/
+static XAie_Events _XAie_GetTimerValueReachedEvent(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_ModuleType Module)
 {
-	u8 TileType;
+	if(Module == XAIE_CORE_MOD) {
+		return XAIE_EVENT_TIMER_VALUE_REACHED_CORE;
+	} else if(Module == XAIE_PL_MOD) {
+		return XAIE_EVENT_TIMER_VALUE_REACHED_PL;
+	} else if(_XAie_DevGetTTypefromLoc(DevInst, Loc) ==
+			XAIEGBL_TILE_TYPE_MEMTILE) {
+		return XAIE_EVENT_TIMER_VALUE_REACHED_MEM_TILE;
+	}
+
+	return XAIE_EVENT_TIMER_VALUE_REACHED_MEM;
+}
+
+/*****************************************************************************/
+/**
+* This API starts a wait of the given number of cycles timed by the device.
+* The timer trigger value of the module is set to the end of the wait and the
+* sticky status of the timer value reached event is cleared, so the end of
+* the wait is then known from one status read, with XAie_WaitCyclesPoll(), or
+* by blocking in XAie_WaitCyclesEnd() or XAie_EventWaitCycles().
+*
+* @param        DevInst - Device Instance.
+* @param        Loc - Location of tile.
+* @param        Module - Module of the tile
+*                        For AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*                        For Pl or Shim tile - XAIE_PL_MOD,
+*                        For Mem tile - XAIE_MEM_MOD.
+* @param        CycleCnt - No. of timer clock cycles to elapse.
+* @param        Wait - Pointer to the caller owned wait handle.
+*
+* @return       XAIE_OK on success
+*               XAIE_INVALID_ARGS if any argument is invalid
+*               XAIE_INVALID_TILE if tile type from Loc is invalid
+*
+* @note         The trigger value is shared by the users of the module timer,
+*		one wait can run per module at a time. The timer is read once
+*		after the trigger value is set, so a wait shorter than the
+*		register accesses is already done on return.
+*
+******************************************************************************/
+AieRC XAie_WaitCyclesStart(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, u64 CycleCnt, XAie_TimerWait *Wait)
+{
+	u64 StartVal, CurVal;
+	u8 TileType, PhyEvent;
+	AieRC RC;
 	const XAie_EvntMod *EvntMod;
 
-	TileType =  DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	if((DevInst == XAIE_NULL) || (Wait == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance or wait handle\n");
+		return XAIE_INVALID_ARGS;
+	}
 
-	if(Mod == XAIE_PL_MOD)
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	/* check for module and tiletype combination */
+	RC = _XAie_CheckModule(DevInst, Loc, Module);
+	if(RC != XAIE_OK) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(CycleCnt > XAIE_WAIT_CYCLE_MAX_VAL) {
+		XAIE_ERROR("CycleCnt above max value\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Wait->IsReady = 0U;
+	Wait->Loc = Loc;
+	Wait->Module = Module;
+	Wait->Event = _XAie_GetTimerValueReachedEvent(DevInst, Loc, Module);
+
+	RC = XAie_EventLogicalToPhysicalConv(DevInst, Loc, Module, Wait->Event,
+			&PhyEvent);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	if(Module == XAIE_PL_MOD) {
 		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
-	else
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+	} else {
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+	}
 
-	return EvntMod->BroadcastEventMap->Event + RscId;
+	Wait->StatusAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		EvntMod->BaseStatusRegOff + (PhyEvent / 32U) * 4U;
+	Wait->StatusMask = 1U << (PhyEvent % 32U);
+
+	RC = XAie_ReadTimer(DevInst, Loc, Module, &StartVal);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Wait->EndVal = StartVal + CycleCnt;
+	RC = XAie_SetTimerTrigEventVal(DevInst, Loc, Module,
+			(u32)Wait->EndVal,
+			(u32)(Wait->EndVal >> XAIE_TIMER_32BIT_SHIFT));
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	/* The event status is sticky and cleared by writing its bit */
+	RC = XAie_Write32(DevInst, Wait->StatusAddr, Wait->StatusMask);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	/* Catch an end reached before the status was cleared */
+	RC = XAie_ReadTimer(DevInst, Loc, Module, &CurVal);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Wait->Done = (CurVal >= Wait->EndVal) ? XAIE_ENABLE : XAIE_DISABLE;
+
+	Wait->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
 }
 
 /*****************************************************************************/
 /**
-* This API clears broadcast configuration for shim tiles till the mentioned
-* column.
+* This API checks if a wait started with XAie_WaitCyclesStart() is over, with
+* one read of the event status.
 *
+* @param        DevInst - Device Instance.
+* @param        Wait - Wait handle.
+* @param        Done - Pointer to return XAIE_ENABLE if the wait is over.
 *
-* @param        DevInst: Device Instance
-* @param        StartCol: Start column from where broadcast conf needs to be
-* 			  cleared
-* @param        EndCol: End column till where broadcast conf needs to be cleared
-* @param        BcastChannelId: ID of broadcast channel
+* @return       XAIE_OK on success, error code on failure.
 *
-* @return       None
+* @note         None.
 *
-* @note         Internal only.
+******************************************************************************/
+AieRC XAie_WaitCyclesPoll(XAie_DevInst *DevInst, XAie_TimerWait *Wait,
+		u8 *Done)
+{
+	u32 RegVal;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Wait == XAIE_NULL) ||
+			(Done == XAIE_NULL) ||
+			(Wait->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance or wait handle\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Wait->Done == XAIE_DISABLE) {
+		RC = XAie_Read32(DevInst, Wait->StatusAddr, &RegVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		if((RegVal & Wait->StatusMask) != 0U) {
+			Wait->Done = XAIE_ENABLE;
+		}
+	}
+
+	*Done = Wait->Done;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API blocks until a wait started with XAie_WaitCyclesStart() is over.
+* The event status is polled with the poll strategy of the device instance,
+* which can sleep between the reads, instead of reading the 64-bit timer.
 *
-*******************************************************************************/
-static void _XAie_ClearShimBroadcast(XAie_DevInst *DevInst, u8 StartCol,
-		u8 EndCol, u32 BcastChannelId)
+* @param        DevInst - Device Instance.
+* @param        Wait - Wait handle.
+* @param        TimeOutUs - Timeout in micro seconds, 0 to use the default.
+*
+* @return       XAIE_OK once the wait is over, XAIE_ERR on timeout, error code
+*		on failure.
+*
+* @note         None.
+*
+******************************************************************************/
+AieRC XAie_WaitCyclesEnd(XAie_DevInst *DevInst, XAie_TimerWait *Wait,
+		u32 TimeOutUs)
 {
-	for(u32 i = StartCol; i < EndCol; i++) {
-		XAie_LocType Loc = XAie_TileLoc(i, 0);
-		XAie_EventBroadcast(DevInst, Loc, XAIE_PL_MOD,
-			BcastChannelId, XAIE_EVENT_NONE_PL);
+	AieRC RC;
+	u8 Done;
+
+	RC = XAie_WaitCyclesPoll(DevInst, Wait, &Done);
+	if((RC != XAIE_OK) || (Done == XAIE_ENABLE)) {
+		return RC;
+	}
+
+	if(TimeOutUs == 0U) {
+		TimeOutUs = XAIE_TIMER_WAIT_DEF_TIMEOUT_US;
 	}
+
+	RC = XAie_MaskPoll(DevInst, Wait->StatusAddr, Wait->StatusMask,
+			Wait->StatusMask, TimeOutUs);
+	if(RC != XAIE_OK) {
+		XAIE_DBG("Wait cycles timed out\n");
+		return XAIE_ERR;
+	}
+
+	Wait->Done = XAIE_ENABLE;
+
+	return XAIE_OK;
 }
 
 /*****************************************************************************/
 /**
-* This API clears timer configuration for all the locations in Rscs list from
-* start till the index mentioned.
+* This API returns the broadcast event enum given a resource id from the
+* event map.
 *
 * @param        DevInst: Device Instance
-* @param        Index: End index till where timer conf needs to be cleared
-* @param        RscBC: list of resource
+* @param        Loc: Location of Tile
+* @param        Mod: Module type
+* @param        RscId: Specific resource to be requested
 *
-* @return       None
+* @return       Event enum on success.
 *
 * @note         Internal only.
 *
 *******************************************************************************/
-static void _XAie_ClearTimerConfig(XAie_DevInst *DevInst, u32 Index,
-		XAie_UserRsc *RscsBC)
+static XAie_Events _XAie_GetBroadcastEventfromRscId(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_ModuleType Mod, u8 RscId)
 {
-	const XAie_EvntMod *EvntMod;
 	u8 TileType;
+	const XAie_EvntMod *EvntMod;
 
-	for(u32 k = 0; k < Index; k++) {
+	TileType =  _XAie_DevGetTTypefromLoc(DevInst, Loc);
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, RscsBC[k].Loc);
-		if(RscsBC[k].Mod == XAIE_PL_MOD)
-			EvntMod = &DevInst->DevProp.DevMod[TileType].
-				EvntMod[0U];
-		else
-			EvntMod = &DevInst->DevProp.DevMod[TileType].
-				EvntMod[RscsBC[k].Mod];
+	if(Mod == XAIE_PL_MOD)
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+	else
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
 
-		XAie_SetTimerResetEvent(DevInst, RscsBC[k].Loc,
-			RscsBC[k].Mod, EvntMod->EventMin, XAIE_RESETDISABLE);
-	}
+	return EvntMod->BroadcastEventMap->Event + RscId;
 }
 
 /*****************************************************************************/
 /**
-* This API synchronizes timer for all tiles for all modules in the partition.
+* This API returns the resource region of the PL modules of the shim row, which
+* carries the channel of the trigger event of a timer sync context.
+*
+* @param	DevInst - Device Instance.
+*
+* @return       Resource region of the shim row.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static XAie_RscRegion _XAie_TimerShimRegion(XAie_DevInst *DevInst)
+{
+	XAie_RscRegion Region;
+
+	Region.Start = XAie_TileLoc(0, 0);
+	Region.NumCols = DevInst->NumCols;
+	Region.NumRows = 1U;
+	Region.ModMask = XAIE_RSC_REGION_MOD(XAIE_PL_MOD);
+
+	return Region;
+}
+
+/*****************************************************************************/
+/**
+* This API initializes a timer synchronization context. It reserves a broadcast
+* channel across the partition and one in the shim row, routes the partition
+* channel to every module, maps the trigger event in the shim tiles and
+* precomputes the timer control values used by XAie_TimerSync(). The channels
+* stay reserved and routed until XAie_TimerSyncFree() is called.
 *
 * @param	DevInst - Device Instance.
+* @param	Ctx - Pointer to the caller owned context.
 *
 * @return       XAIE_OK on success
 *               XAIE_INVALID_ARGS if any argument is invalid
-*               XAIE_INVALID_TILE if tile type from Loc is invalid
+*               XAIE_ERR if memory allocation fails
 *
 * @note		None
 *
 ******************************************************************************/
-AieRC XAie_SyncTimer(XAie_DevInst *DevInst)
+AieRC XAie_TimerSyncInit(XAie_DevInst *DevInst, XAie_TimerSyncCtx *Ctx)
 {
+	XAie_RscRegion ShimRegion;
 	AieRC RC;
-	u32 UserRscNum = 0, UserRscNumShim;
-	u32 BcastChannelId, BcastChannelIdShim;
-	XAie_Events BcastEvent, ShimBcastEvent;
-	XAie_UserRsc *RscsBC, *RscsBCShim;
+	u32 NumRscs = 0U;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Ctx == XAIE_NULL) {
+		XAIE_ERROR("Invalid timer sync context\n");
+		return XAIE_INVALID_ARGS;
+	}
 
 	for(u8 i = 0; i < XAIEGBL_TILE_TYPE_MAX; i++) {
 		if(i == XAIEGBL_TILE_TYPE_SHIMNOC)
 			continue;
-		UserRscNum += (DevInst->DevProp.DevMod[i].NumModules) *
+		NumRscs += (DevInst->DevProp.DevMod[i].NumModules) *
 			_XAie_GetNumRows(DevInst, i) * DevInst->NumCols;
 	}
 
-	RscsBC = (XAie_UserRsc *)malloc(UserRscNum * sizeof(XAie_UserRsc));
-	if(RscsBC == NULL) {
+	Ctx->IsReady = 0U;
+	Ctx->NumRscs = NumRscs;
+	Ctx->Rscs = (XAie_UserRsc *)malloc(NumRscs * sizeof(XAie_UserRsc));
+	Ctx->Regs = (XAie_TimerSyncReg *)malloc(NumRscs *
+			sizeof(XAie_TimerSyncReg));
+	if((Ctx->Rscs == NULL) || (Ctx->Regs == NULL)) {
 		XAIE_ERROR("Unable to allocate memory for resource\n");
+		free(Ctx->Rscs);
+		free(Ctx->Regs);
 		return XAIE_ERR;
 	}
 
-	UserRscNumShim = DevInst->NumCols;
-	RscsBCShim = (XAie_UserRsc *)malloc(DevInst->NumCols *
-			sizeof(XAie_UserRsc));
-	if(RscsBCShim == NULL) {
-		XAIE_ERROR("Unable to allocate memory for resource\n");
-		free(RscsBC);
-		return XAIE_ERR;
-	}
 	/* Reserve a free BC across partition */
-	RC = XAie_RequestBroadcastChannel(DevInst, &UserRscNum, RscsBC, 1U);
+	RC = XAie_RequestBroadcastChannel(DevInst, &Ctx->NumRscs, Ctx->Rscs,
+			1U);
 	if(RC != XAIE_OK) {
-		free(RscsBC);
-		free(RscsBCShim);
+		free(Ctx->Rscs);
+		free(Ctx->Regs);
 		return RC;
 	}
-	BcastChannelId = RscsBC[0].RscId;
+	Ctx->BcastChannelId = Ctx->Rscs[0].RscId;
 
-	/* Reserve a free BC across partition */
-	for(u32 i = 0; i < UserRscNumShim; i++) {
-		RscsBCShim[i].Loc = XAie_TileLoc(i, 0);
-		RscsBCShim[i].Mod = XAIE_PL_MOD;
-		RscsBCShim[i].RscType = XAIE_BCAST_CHANNEL_RSC;
+	/* Reserve a free BC in the shim row */
+	ShimRegion = _XAie_TimerShimRegion(DevInst);
+	RC = XAie_RequestBroadcastChannelRegion(DevInst, &ShimRegion,
+			&Ctx->ShimBcastChannelId);
+	if(RC != XAIE_OK) {
+		XAie_ReleaseBroadcastChannel(DevInst, Ctx->NumRscs, Ctx->Rscs);
+		free(Ctx->Rscs);
+		free(Ctx->Regs);
+		return RC;
+	}
+
+	Ctx->ShimBcastEvent = _XAie_GetBroadcastEventfromRscId(DevInst,
+		XAie_TileLoc(0, 0), XAIE_PL_MOD, Ctx->ShimBcastChannelId);
+
+	/* Timer control values armed with and cleared from the trigger event */
+	for(u32 j = 0; j < Ctx->NumRscs; j++) {
+		const XAie_TimerMod *TimerMod;
+		const XAie_EvntMod *EvntMod;
+		XAie_Events BcastEvent;
+		u8 TileType, Mod;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				Ctx->Rscs[j].Loc);
+		Mod = (Ctx->Rscs[j].Mod == XAIE_PL_MOD) ? 0U :
+			(u8)Ctx->Rscs[j].Mod;
+		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[Mod];
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+		BcastEvent = _XAie_GetBroadcastEventfromRscId(DevInst,
+				Ctx->Rscs[j].Loc, Ctx->Rscs[j].Mod,
+				Ctx->BcastChannelId);
+
+		Ctx->Regs[j].RegAddr = _XAie_GetTileAddr(DevInst,
+				Ctx->Rscs[j].Loc.Row, Ctx->Rscs[j].Loc.Col) +
+			TimerMod->CtrlOff;
+		Ctx->Regs[j].ArmVal = XAie_SetField(
+				EvntMod->XAie_EventNumber[BcastEvent -
+				EvntMod->EventMin],
+				TimerMod->CtrlResetEvent.Lsb,
+				TimerMod->CtrlResetEvent.Mask);
+		Ctx->Regs[j].ClearVal = XAie_SetField(
+				EvntMod->XAie_EventNumber[0U],
+				TimerMod->CtrlResetEvent.Lsb,
+				TimerMod->CtrlResetEvent.Mask);
+	}
+
+	/*
+	 * Map the trigger event in the shim tiles and block the channel so
+	 * that it reaches every module of the partition once.
+	 */
+	RC = XAie_EventBroadcastChannelConfig(DevInst, Ctx->Rscs, Ctx->NumRscs,
+			Ctx->BcastChannelId, Ctx->ShimBcastEvent);
+	if(RC == XAIE_OK) {
+		RC = XAie_EventBroadcast(DevInst, XAie_TileLoc(0, 0),
+				XAIE_PL_MOD, Ctx->ShimBcastChannelId,
+				Ctx->ShimBcastEvent);
 	}
-	RC = XAie_RequestBroadcastChannel(DevInst, &UserRscNumShim,
-			RscsBCShim, 0U);
 	if(RC != XAIE_OK) {
-		free(RscsBC);
-		free(RscsBCShim);
+		XAIE_ERROR("Unable to setup broadcast for timer sync.\n");
+		XAie_EventBroadcastChannelReset(DevInst, Ctx->Rscs,
+				Ctx->NumRscs, Ctx->BcastChannelId);
+		XAie_ReleaseBroadcastChannel(DevInst, Ctx->NumRscs, Ctx->Rscs);
+		XAie_ReleaseBroadcastChannelRegion(DevInst, &ShimRegion,
+				Ctx->ShimBcastChannelId);
+		free(Ctx->Rscs);
+		free(Ctx->Regs);
 		return RC;
 	}
-	BcastChannelIdShim = RscsBCShim[0].RscId;
-
-	ShimBcastEvent = _XAie_GetBroadcastEventfromRscId(DevInst,
-		XAie_TileLoc(0, 0), XAIE_PL_MOD, BcastChannelIdShim);
-
-	for(u32 j = 0; j < UserRscNum; j++) {
-		u8 TileType =  DevInst->DevOps->GetTTypefromLoc(DevInst,
-				RscsBC[j].Loc);
-		AieRC lRC = XAIE_OK;
-
-		/* Blocking unncessary broadcasting */
-		if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
-			if(DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) {
-				/* Checker board structure */
-				if((RscsBC[j].Loc.Row % 2) == 0) {
-					if(RscsBC[j].Mod == XAIE_MEM_MOD) {
-						lRC |= XAie_EventBroadcastBlockDir(
-							DevInst, RscsBC[j].Loc,
-							RscsBC[j].Mod,
-							XAIE_EVENT_SWITCH_A,
-							BcastChannelId,
-							XAIE_EVENT_BROADCAST_WEST);
-					} else {
-						lRC |= XAie_EventBroadcastBlockDir(
-							DevInst, RscsBC[j].Loc,
-							RscsBC[j].Mod,
-							XAIE_EVENT_SWITCH_A,
-							BcastChannelId,
-							XAIE_EVENT_BROADCAST_EAST);
-					}
-				} else {
-					if(RscsBC[j].Mod == XAIE_MEM_MOD) {
-						lRC |= XAie_EventBroadcastBlockDir(
-							DevInst, RscsBC[j].Loc,
-							RscsBC[j].Mod,
-							XAIE_EVENT_SWITCH_A,
-							BcastChannelId,
-							XAIE_EVENT_BROADCAST_EAST);
-					} else {
-						lRC |= XAie_EventBroadcastBlockDir(
-							DevInst, RscsBC[j].Loc,
-							RscsBC[j].Mod,
-							XAIE_EVENT_SWITCH_A,
-							BcastChannelId,
-							XAIE_EVENT_BROADCAST_WEST);
-					}
-				}
-			} else {
-				if(RscsBC[j].Mod == XAIE_MEM_MOD) {
-					lRC |= XAie_EventBroadcastBlockDir(
-						DevInst, RscsBC[j].Loc,
-						RscsBC[j].Mod,
-						XAIE_EVENT_SWITCH_A,
-						BcastChannelId,
-						XAIE_EVENT_BROADCAST_EAST);
-				} else {
-					lRC |= XAie_EventBroadcastBlockDir(
-						DevInst, RscsBC[j].Loc,
-						RscsBC[j].Mod,
-						XAIE_EVENT_SWITCH_A,
-						BcastChannelId,
-						XAIE_EVENT_BROADCAST_WEST);
-				}
-			}
-		} else if(RscsBC[j].Loc.Row != 0) {
-			lRC |= XAie_EventBroadcastBlockDir(
-				DevInst, RscsBC[j].Loc,
-				RscsBC[j].Mod,
-				XAIE_EVENT_SWITCH_A,
-				BcastChannelId,
-				XAIE_EVENT_BROADCAST_WEST |
-				XAIE_EVENT_BROADCAST_EAST);
-		}
-		if (lRC != XAIE_OK) {
-			XAIE_ERROR("Unable to setup broadcast for timer sync.\n");
-			free(RscsBC);
-			free(RscsBCShim);
-			return RC;
-		}
+
+	Ctx->IsReady = XAIE_COMPONENT_IS_READY;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API synchronizes the timers of all the modules of the partition using a
+* context set up by XAie_TimerSyncInit(). It arms the timer reset event of
+* every module, generates the trigger event and clears the reset event again,
+* all in one transaction.
+*
+* @param	DevInst - Device Instance.
+* @param	Ctx - Initialized timer sync context.
+*
+* @return       XAIE_OK on success
+*               XAIE_INVALID_ARGS if any argument is invalid
+*
+* @note		The timer control registers are written twice, so the writes
+*		must not be recorded into a transaction started with
+*		XAIE_TRANSACTION_ENABLE_OPTIMIZE.
+*
+******************************************************************************/
+AieRC XAie_TimerSync(XAie_DevInst *DevInst, XAie_TimerSyncCtx *Ctx)
+{
+	AieRC RC = XAIE_OK;
+	u8 OwnTxn = XAIE_DISABLE;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
 	}
 
-	for(u32 i = 0; i < DevInst->NumCols; i++) {
-		XAie_LocType Loc = XAie_TileLoc(i, 0);
+	if((Ctx == XAIE_NULL) || (Ctx->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid timer sync context\n");
+		return XAIE_INVALID_ARGS;
+	}
 
-		RC = XAie_EventBroadcast(DevInst, Loc, XAIE_PL_MOD,
-				BcastChannelId, ShimBcastEvent);
-		if(i == 0) {
-			RC = XAie_EventBroadcast(DevInst, Loc, XAIE_PL_MOD,
-				BcastChannelIdShim, ShimBcastEvent);
-		}
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
 		if(RC != XAIE_OK) {
-			XAIE_ERROR("Unable to configure broadcast event for timer sync\n");
-			free(RscsBC);
-			free(RscsBCShim);
 			return RC;
 		}
+		OwnTxn = XAIE_ENABLE;
 	}
 
 	/* Configure the timer control with the trigger event */
-	for(u32 j = 0; j < UserRscNum; j++) {
-		BcastEvent = _XAie_GetBroadcastEventfromRscId(DevInst,
-				RscsBC[j].Loc, RscsBC[j].Mod, BcastChannelId);
-		RC = XAie_SetTimerResetEvent(DevInst, RscsBC[j].Loc,
-			RscsBC[j].Mod, BcastEvent, XAIE_RESETDISABLE);
-		if(RC != XAIE_OK) {
-			XAIE_ERROR("Unable to set timer control\n");
-			free(RscsBC);
-			free(RscsBCShim);
-			return RC;
-		}
+	for(u32 j = 0; (j < Ctx->NumRscs) && (RC == XAIE_OK); j++) {
+		RC = XAie_Write32(DevInst, Ctx->Regs[j].RegAddr,
+				Ctx->Regs[j].ArmVal);
 	}
 
 	/* Trigger Event */
-	RC = XAie_EventGenerate(DevInst, XAie_TileLoc(0, 0), XAIE_PL_MOD,
-			ShimBcastEvent);
-	if(RC != XAIE_OK) {
-		XAIE_ERROR("Unable to trigger event\n");
-		free(RscsBC);
-		free(RscsBCShim);
-		return RC;
+	if(RC == XAIE_OK) {
+		RC = XAie_EventGenerate(DevInst, XAie_TileLoc(0, 0),
+				XAIE_PL_MOD, Ctx->ShimBcastEvent);
 	}
 
 	/* Clear timer reset event register */
-	_XAie_ClearTimerConfig(DevInst, UserRscNum, RscsBC);
+	for(u32 j = 0; (j < Ctx->NumRscs) && (RC == XAIE_OK); j++) {
+		RC = XAie_Write32(DevInst, Ctx->Regs[j].RegAddr,
+				Ctx->Regs[j].ClearVal);
+	}
 
-	/* Clear broadcast setting */
-	for(u32 j = 0; j < UserRscNum; j++) {
-		if(RscsBC[j].Loc.Row == 0) {
-			/* If it is SHIM tile, skip */
-			continue;
-		}
-		RC = XAie_EventBroadcastUnblockDir(DevInst,
-			RscsBC[j].Loc, RscsBC[j].Mod,
-			XAIE_EVENT_SWITCH_A, BcastChannelId,
-			XAIE_EVENT_BROADCAST_WEST | XAIE_EVENT_BROADCAST_EAST);
-		if(RC != XAIE_OK) {
-			XAIE_ERROR("Failed to clear broadcast setting for timer sync.\n");
-			/* Will continue clearning even if it failes */
+	if(OwnTxn == XAIE_ENABLE) {
+		if(RC == XAIE_OK) {
+			RC = _XAie_Txn_Submit(DevInst, NULL);
+		} else {
+			XAie_TxnInst *TxnInst = _XAie_TxnDetach(DevInst);
+
+			if(TxnInst != NULL) {
+				_XAie_TxnFree(TxnInst);
+			}
 		}
 	}
 
-	/* Clear shim broadcast configuration */
-	_XAie_ClearShimBroadcast(DevInst, 0, DevInst->NumCols, BcastChannelId);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to synchronize timers\n");
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API clears the broadcast configuration of a timer sync context, releases
+* its broadcast channels and frees its memory.
+*
+* @param	DevInst - Device Instance.
+* @param	Ctx - Initialized timer sync context.
+*
+* @return       XAIE_OK on success
+*               XAIE_INVALID_ARGS if any argument is invalid
+*
+* @note		The context is released even if clearing the broadcast
+*		configuration fails.
+*
+******************************************************************************/
+AieRC XAie_TimerSyncFree(XAie_DevInst *DevInst, XAie_TimerSyncCtx *Ctx)
+{
+	XAie_RscRegion ShimRegion;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Ctx == XAIE_NULL) || (Ctx->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid timer sync context\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Clear broadcast setting */
+	RC = XAie_EventBroadcastChannelReset(DevInst, Ctx->Rscs, Ctx->NumRscs,
+			Ctx->BcastChannelId);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to clear broadcast setting for timer sync.\n");
+	}
 	XAie_EventBroadcast(DevInst, XAie_TileLoc(0, 0), XAIE_PL_MOD,
-		BcastChannelIdShim, XAIE_EVENT_NONE_PL);
+		Ctx->ShimBcastChannelId, XAIE_EVENT_NONE_PL);
 
 	/* Release broadcast channel across partition */
-	XAie_ReleaseBroadcastChannel(DevInst, UserRscNum, RscsBC);
-	XAie_ReleaseBroadcastChannel(DevInst, UserRscNumShim, RscsBCShim);
-	free(RscsBC);
-	free(RscsBCShim);
+	XAie_ReleaseBroadcastChannel(DevInst, Ctx->NumRscs, Ctx->Rscs);
+	ShimRegion = _XAie_TimerShimRegion(DevInst);
+	XAie_ReleaseBroadcastChannelRegion(DevInst, &ShimRegion,
+			Ctx->ShimBcastChannelId);
+	free(Ctx->Rscs);
+	free(Ctx->Regs);
+	Ctx->Rscs = NULL;
+	Ctx->Regs = NULL;
+	Ctx->IsReady = 0U;
+
+	return RC;
+}
 
-	return XAIE_OK;
+/*****************************************************************************/
+/**
+* This API synchronizes timer for all tiles for all modules in the partition.
+* Applications that resynchronize periodically should keep a context with
+* XAie_TimerSyncInit() and call XAie_TimerSync() instead.
+*
+* @param	DevInst - Device Instance.
+*
+* @return       XAIE_OK on success
+*               XAIE_INVALID_ARGS if any argument is invalid
+*               XAIE_INVALID_TILE if tile type from Loc is invalid
+*
+* @note		None
+*
+******************************************************************************/
+AieRC XAie_SyncTimer(XAie_DevInst *DevInst)
+{
+	AieRC RC;
+	XAie_TimerSyncCtx Ctx;
+
+	RC = XAie_TimerSyncInit(DevInst, &Ctx);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_TimerSync(DevInst, &Ctx);
+	if(RC != XAIE_OK) {
+		XAie_TimerSyncFree(DevInst, &Ctx);
+		return RC;
+	}
+
+	return XAie_TimerSyncFree(DevInst, &Ctx);
 }
 
 #endif /* XAIE_FEATURE_TIMER_ENABLE */
@@ -29,6 +29,48 @@
 
 /************************** Enum *********************************************/
 
+/**************************** Type Definitions *******************************/
+/*
+ * Timer control register of one module with the values written to arm and
+ * clear the timer reset on the sync broadcast event.
+ */
+typedef struct {
+	u64 RegAddr;
+	u32 ArmVal;
+	u32 ClearVal;
+} XAie_TimerSyncReg;
+
+/*
+ * Timer synchronization context. It keeps the broadcast channels used to
+ * reset the timers reserved and routed across the partition between
+ * synchronizations.
+ */
+typedef struct {
+	XAie_UserRsc *Rscs;		/* Modules on the partition channel */
+	XAie_TimerSyncReg *Regs;	/* Timer control of each of Rscs */
+	u32 NumRscs;
+	u32 BcastChannelId;
+	u32 ShimBcastChannelId;
+	XAie_Events ShimBcastEvent;	/* Event generated to sync */
+	u8 IsReady;
+} XAie_TimerSyncCtx;
+
+/*
+ * Handle of a wait timed by the timer of a module, started with
+ * XAie_WaitCyclesStart(). The wait is over once the timer value reached event
+ * of the module is set in its event status.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	XAie_ModuleType Module;
+	XAie_Events Event;		/* Timer value reached event */
+	u64 StatusAddr;			/* Event status register of Event */
+	u32 StatusMask;
+	u64 EndVal;			/* Timer value ending the wait */
+	u8 Done;
+	u8 IsReady;
+} XAie_TimerWait;
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_SetTimerTrigEventVal(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, u32 LowEventValue, u32 HighEventValue);
@@ -41,6 +83,15 @@ AieRC XAie_ReadTimer(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, u64 *TimerVal);
 AieRC XAie_WaitCycles(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, u64 CycleCnt);
+AieRC XAie_WaitCyclesStart(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, u64 CycleCnt, XAie_TimerWait *Wait);
+AieRC XAie_WaitCyclesPoll(XAie_DevInst *DevInst, XAie_TimerWait *Wait,
+		u8 *Done);
+AieRC XAie_WaitCyclesEnd(XAie_DevInst *DevInst, XAie_TimerWait *Wait,
+		u32 TimeOutUs);
 AieRC XAie_SyncTimer(XAie_DevInst *DevInst);
+AieRC XAie_TimerSyncInit(XAie_DevInst *DevInst, XAie_TimerSyncCtx *Ctx);
+AieRC XAie_TimerSync(XAie_DevInst *DevInst, XAie_TimerSyncCtx *Ctx);
+AieRC XAie_TimerSyncFree(XAie_DevInst *DevInst, XAie_TimerSyncCtx *Ctx);
 
 #endif		/* end of protection macro */
@@ -0,0 +1,1131 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_tracecmp.c
+* @{
+*
+* This file contains routines to compress offloaded trace streams on the host.
+* The compression stage is a trace sink, placed between a trace offload and
+* the sink storing the trace. The trace is cut in blocks which are compressed
+* by a separate thread, so the offload thread is only held up by a copy.
+*
+* Trace packets repeat their header and most of their payload from one packet
+* to the next, so each word is coded as its XOR with the same word of the
+* previous packet. The XORs are coded two at a time, with a control byte
+* holding which of their bytes are not zero, followed by these bytes. Runs of
+* zero XORs, such as repeated packets or the filler at the end of a buffer,
+* are coded with a count. The coding needs no dictionary and is reset at each
+* block, so blocks are decoded on their own.
+*
+* The container is a file header, the blocks, each with a header, then an
+* index of the blocks and a footer locating the index. The index allows
+* seeking to a block from its offset in the trace. Without the index, for a
+* container cut short, the blocks are found from their headers.
+*
+* All the fields of the container are little endian:
+*	File header:	Magic, Version (16 bits), PktWords (16 bits),
+*			BlockWords, Reserved
+*	Block header:	Magic, Flags, RawBytes, CmpBytes, RawOffset (64 bits)
+*	Index entry:	RawOffset (64 bits), Offset (64 bits), RawBytes,
+*			CmpBytes
+*	Footer:		IndexOffset (64 bits), NumBlocks, Magic
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifndef __AIEBAREMETAL__
+#define  _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#ifndef __AIEBAREMETAL__
+#include <pthread.h>
+#endif
+
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_tracecmp.h"
+
+#ifdef XAIE_FEATURE_TRACE_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TRACECMP_MAGIC		0x5A544941U
+#define XAIE_TRACECMP_BLOCK_MAGIC	0x4B4C4254U
+#define XAIE_TRACECMP_FOOTER_MAGIC	0x58444954U
+#define XAIE_TRACECMP_VERSION		1U
+
+#define XAIE_TRACECMP_HDR_SIZE		16U
+#define XAIE_TRACECMP_BLOCK_HDR_SIZE	24U
+#define XAIE_TRACECMP_INDEX_SIZE	24U
+#define XAIE_TRACECMP_FOOTER_SIZE	16U
+
+#define XAIE_TRACECMP_FLAG_CODED	0x1U
+
+#define XAIE_TRACECMP_DEF_BLOCK_WORDS	65536U
+#define XAIE_TRACECMP_DEF_NUM_BLOCKS	4U
+#define XAIE_TRACECMP_DEF_PKT_WORDS	8U
+#define XAIE_TRACECMP_MAX_RUN		255U
+
+/**************************** Type Definitions *******************************/
+struct XAie_TraceCmp {
+	XAie_TraceCmpCfg Cfg;
+	u32 *Bufs;		/* Ring of blocks, BlockWords each */
+	u32 *Fill;		/* Words written to each block */
+	u8 *Out;		/* Block header and payload being written */
+	XAie_TraceCmpBlock *Index;
+	u32 IndexSize;		/* Entries allocated for the index */
+	u32 Head;		/* Oldest block full and not yet written */
+	u32 NumReady;		/* Blocks full and not yet written */
+	u64 RawOffset;		/* Trace offset of the next block written */
+	u64 Offset;		/* Container offset of the next block */
+	u8 Finished;
+	AieRC Status;		/* Error which stopped the compression */
+	XAie_TraceCmpStats Stats;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+	pthread_cond_t Cond;
+	pthread_t Thread;
+	u8 Running;
+	u8 Stop;
+#endif
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API takes the lock protecting the state of a trace compression stage.
+*
+* @param	Cmp: Trace compression stage.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TraceCmpLock(XAie_TraceCmp *Cmp)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_lock(&Cmp->Lock);
+#else
+	(void)Cmp;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the lock protecting the state of a trace compression
+* stage.
+*
+* @param	Cmp: Trace compression stage.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TraceCmpUnlock(XAie_TraceCmp *Cmp)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_unlock(&Cmp->Lock);
+#else
+	(void)Cmp;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stores a 32 bit little endian field of the container.
+*
+* @param	Ptr: Location of the field.
+* @param	Val: Value of the field.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TraceCmpPut32(u8 *Ptr, u32 Val)
+{
+	Ptr[0U] = (u8)Val;
+	Ptr[1U] = (u8)(Val >> 8U);
+	Ptr[2U] = (u8)(Val >> 16U);
+	Ptr[3U] = (u8)(Val >> 24U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stores a 64 bit little endian field of the container.
+*
+* @param	Ptr: Location of the field.
+* @param	Val: Value of the field.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TraceCmpPut64(u8 *Ptr, u64 Val)
+{
+	_XAie_TraceCmpPut32(Ptr, (u32)Val);
+	_XAie_TraceCmpPut32(Ptr + 4U, (u32)(Val >> 32U));
+}
+
+/*****************************************************************************/
+/**
+*
+* This API loads a 32 bit little endian field of the container.
+*
+* @param	Ptr: Location of the field.
+*
+* @return	Value of the field.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u32 _XAie_TraceCmpGet32(const u8 *Ptr)
+{
+	return (u32)Ptr[0U] | ((u32)Ptr[1U] << 8U) | ((u32)Ptr[2U] << 16U) |
+		((u32)Ptr[3U] << 24U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API loads a 64 bit little endian field of the container.
+*
+* @param	Ptr: Location of the field.
+*
+* @return	Value of the field.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u64 _XAie_TraceCmpGet64(const u8 *Ptr)
+{
+	return (u64)_XAie_TraceCmpGet32(Ptr) |
+		((u64)_XAie_TraceCmpGet32(Ptr + 4U) << 32U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API codes the words of a block.
+*
+* @param	Words: Words of the block.
+* @param	NumWords: Number of words of the block.
+* @param	Stride: Words per trace packet.
+* @param	Out: Buffer for the coded block. It has to hold MaxBytes plus
+*		one coded pair, 9 bytes.
+* @param	MaxBytes: Size the coded block has to stay below.
+*
+* @return	Size of the coded block in bytes, or MaxBytes if the coded block
+*		is not smaller than MaxBytes.
+*
+* @note		Internal only. An odd last word is coded with a zero pair.
+*
+******************************************************************************/
+static u32 _XAie_TraceCmpEncode(const u32 *Words, u32 NumWords, u32 Stride,
+		u8 *Out, u32 MaxBytes)
+{
+	u32 Len = 0U;
+	u32 i = 0U;
+
+	while(i < NumWords) {
+		u32 Res[2U];
+
+		for(u32 k = 0U; k < 2U; k++) {
+			u32 j = i + k;
+
+			Res[k] = 0U;
+			if(j < NumWords) {
+				Res[k] = Words[j] ^
+					((j >= Stride) ? Words[j - Stride] : 0U);
+			}
+		}
+
+		if((Res[0U] | Res[1U]) == 0U) {
+			u32 Run = 0U;
+
+			i += 2U;
+			while((Run < XAIE_TRACECMP_MAX_RUN) && (i < NumWords)) {
+				u32 Next = 0U;
+
+				if(i >= Stride) {
+					Next = Words[i - Stride];
+				}
+				if(Words[i] != Next) {
+					break;
+				}
+				if(i + 1U < NumWords) {
+					Next = (i + 1U >= Stride) ?
+						Words[i + 1U - Stride] : 0U;
+					if(Words[i + 1U] != Next) {
+						break;
+					}
+				}
+				Run++;
+				i += 2U;
+			}
+
+			Out[Len++] = 0U;
+			Out[Len++] = (u8)Run;
+		} else {
+			u32 Ctrl = Len++;
+
+			Out[Ctrl] = 0U;
+			for(u32 k = 0U; k < 2U; k++) {
+				for(u32 b = 0U; b < 4U; b++) {
+					u8 Byte = (u8)(Res[k] >> (b * 8U));
+
+					if(Byte != 0U) {
+						Out[Ctrl] |= (u8)(1U <<
+								(k * 4U + b));
+						Out[Len++] = Byte;
+					}
+				}
+			}
+			i += 2U;
+		}
+
+		if(Len >= MaxBytes) {
+			return MaxBytes;
+		}
+	}
+
+	return Len;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API decodes the words of a block.
+*
+* @param	In: Coded block.
+* @param	Len: Size of the coded block in bytes.
+* @param	Stride: Words per trace packet.
+* @param	Words: Buffer for the words of the block.
+* @param	NumWords: Number of words of the block.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TraceCmpDecode(const u8 *In, u32 Len, u32 Stride,
+		u32 *Words, u32 NumWords)
+{
+	u32 Pos = 0U;
+	u32 i = 0U;
+
+	while(i < NumWords) {
+		u8 Ctrl;
+
+		if(Pos >= Len) {
+			return XAIE_ERR;
+		}
+		Ctrl = In[Pos++];
+
+		if(Ctrl == 0U) {
+			u32 Count;
+
+			if(Pos >= Len) {
+				return XAIE_ERR;
+			}
+			Count = ((u32)In[Pos++] + 1U) * 2U;
+			if(i + Count > NumWords) {
+				/* Only the odd last word may be padded */
+				if(i + Count != NumWords + 1U) {
+					return XAIE_ERR;
+				}
+				Count--;
+			}
+
+			for(u32 k = 0U; k < Count; k++, i++) {
+				Words[i] = (i >= Stride) ? Words[i - Stride] : 0U;
+			}
+			continue;
+		}
+
+		for(u32 k = 0U; k < 2U; k++, i++) {
+			u32 Res = 0U;
+
+			for(u32 b = 0U; b < 4U; b++) {
+				if((Ctrl & (1U << (k * 4U + b))) == 0U) {
+					continue;
+				}
+				if(Pos >= Len) {
+					return XAIE_ERR;
+				}
+				Res |= (u32)In[Pos++] << (b * 8U);
+			}
+
+			if(i < NumWords) {
+				Words[i] = Res ^
+					((i >= Stride) ? Words[i - Stride] : 0U);
+			} else if(Res != 0U) {
+				return XAIE_ERR;
+			}
+		}
+	}
+
+	return (Pos == Len) ? XAIE_OK : XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API passes a part of the container to the sink of a trace compression
+* stage and accounts for it.
+*
+* @param	Cmp: Trace compression stage.
+* @param	Data: Part of the container.
+* @param	Size: Size of the part in bytes.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TraceCmpOutput(XAie_TraceCmp *Cmp, const void *Data,
+		u64 Size)
+{
+	AieRC RC;
+
+	RC = Cmp->Cfg.Sink(Cmp->Cfg.SinkArg, Data, Size);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to write compressed trace to sink\n");
+		return RC;
+	}
+
+	_XAie_TraceCmpLock(Cmp);
+	Cmp->Stats.CmpBytes += Size;
+	_XAie_TraceCmpUnlock(Cmp);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API compresses a block of the ring, passes it to the sink and adds it
+* to the index. Blocks the coding does not make smaller are stored as is.
+*
+* @param	Cmp: Trace compression stage.
+* @param	Slot: Block of the ring.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. Called by the compression thread without the
+*		lock, the block is not touched by the producer until it is
+*		released.
+*
+******************************************************************************/
+static AieRC _XAie_TraceCmpWriteBlock(XAie_TraceCmp *Cmp, u32 Slot)
+{
+	const u32 *Words = Cmp->Bufs + (u64)Slot * Cmp->Cfg.BlockWords;
+	u8 *Payload = Cmp->Out + XAIE_TRACECMP_BLOCK_HDR_SIZE;
+	u32 NumWords = Cmp->Fill[Slot];
+	u32 RawBytes = NumWords * (u32)sizeof(u32);
+	XAie_TraceCmpBlock *Block;
+	u32 Flags = XAIE_TRACECMP_FLAG_CODED;
+	u32 CmpBytes;
+	AieRC RC;
+
+	CmpBytes = _XAie_TraceCmpEncode(Words, NumWords, Cmp->Cfg.PktWords,
+			Payload, RawBytes);
+	if(CmpBytes == RawBytes) {
+		for(u32 i = 0U; i < NumWords; i++) {
+			_XAie_TraceCmpPut32(Payload + i * sizeof(u32), Words[i]);
+		}
+		Flags = 0U;
+	}
+
+	_XAie_TraceCmpPut32(Cmp->Out, XAIE_TRACECMP_BLOCK_MAGIC);
+	_XAie_TraceCmpPut32(Cmp->Out + 4U, Flags);
+	_XAie_TraceCmpPut32(Cmp->Out + 8U, RawBytes);
+	_XAie_TraceCmpPut32(Cmp->Out + 12U, CmpBytes);
+	_XAie_TraceCmpPut64(Cmp->Out + 16U, Cmp->RawOffset);
+
+	if(Cmp->Stats.NumBlocks == Cmp->IndexSize) {
+		u32 Size = (Cmp->IndexSize == 0U) ? 64U : Cmp->IndexSize * 2U;
+
+		Block = (XAie_TraceCmpBlock *)realloc(Cmp->Index,
+				Size * sizeof(*Block));
+		if(Block == NULL) {
+			XAIE_ERROR("Memory allocation for trace index failed\n");
+			return XAIE_ERR;
+		}
+		Cmp->Index = Block;
+		Cmp->IndexSize = Size;
+	}
+
+	RC = _XAie_TraceCmpOutput(Cmp, Cmp->Out,
+			XAIE_TRACECMP_BLOCK_HDR_SIZE + CmpBytes);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Block = &Cmp->Index[Cmp->Stats.NumBlocks];
+	Block->RawOffset = Cmp->RawOffset;
+	Block->Offset = Cmp->Offset;
+	Block->RawBytes = RawBytes;
+	Block->CmpBytes = CmpBytes;
+	Cmp->RawOffset += RawBytes;
+	Cmp->Offset += XAIE_TRACECMP_BLOCK_HDR_SIZE + CmpBytes;
+
+	_XAie_TraceCmpLock(Cmp);
+	Cmp->Stats.NumBlocks++;
+	_XAie_TraceCmpUnlock(Cmp);
+
+	return XAIE_OK;
+}
+
+#ifndef __AIEBAREMETAL__
+/*****************************************************************************/
+/**
+*
+* This is the body of the compression thread. It writes the full blocks of
+* the ring in order until it is asked to stop and no block is left, or a
+* write fails.
+*
+* @param	Arg: Trace compression stage.
+*
+* @return	NULL.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void *_XAie_TraceCmpWorker(void *Arg)
+{
+	XAie_TraceCmp *Cmp = (XAie_TraceCmp *)Arg;
+
+	pthread_mutex_lock(&Cmp->Lock);
+	while(1) {
+		AieRC RC;
+		u32 Slot;
+
+		while((Cmp->NumReady == 0U) && (Cmp->Stop == 0U)) {
+			pthread_cond_wait(&Cmp->Cond, &Cmp->Lock);
+		}
+		if(Cmp->NumReady == 0U) {
+			break;
+		}
+
+		Slot = Cmp->Head;
+		pthread_mutex_unlock(&Cmp->Lock);
+		RC = _XAie_TraceCmpWriteBlock(Cmp, Slot);
+		pthread_mutex_lock(&Cmp->Lock);
+
+		if(RC != XAIE_OK) {
+			Cmp->Status = RC;
+			pthread_cond_broadcast(&Cmp->Cond);
+			break;
+		}
+
+		Cmp->Fill[Slot] = 0U;
+		Cmp->Head = (Cmp->Head + 1U) % Cmp->Cfg.NumBlocks;
+		Cmp->NumReady--;
+		pthread_cond_broadcast(&Cmp->Cond);
+	}
+	pthread_mutex_unlock(&Cmp->Lock);
+
+	return NULL;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API marks the block being filled as full. It is handed to the
+* compression thread, or written right away for baremetal.
+*
+* @param	Cmp: Trace compression stage.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. Must be called with the lock held.
+*
+******************************************************************************/
+static AieRC _XAie_TraceCmpQueue(XAie_TraceCmp *Cmp)
+{
+#ifndef __AIEBAREMETAL__
+	Cmp->NumReady++;
+	pthread_cond_broadcast(&Cmp->Cond);
+
+	return XAIE_OK;
+#else
+	AieRC RC;
+
+	RC = _XAie_TraceCmpWriteBlock(Cmp, Cmp->Head);
+	Cmp->Fill[Cmp->Head] = 0U;
+	if(RC != XAIE_OK) {
+		Cmp->Status = RC;
+	}
+
+	return RC;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a trace compression stage and writes the header of the
+* container to its sink. For Linux, the compression thread is started.
+*
+* @param	Cfg: Configuration of the trace compression stage.
+*
+* @return	Trace compression stage on success, NULL on failure.
+*
+* @note		The stage is passed as the argument of XAie_TraceCmpSink(),
+*		for instance as the sink of a trace offload. Blocks hold a
+*		whole number of trace buffers at best, so the trace of a
+*		buffer is compressed at once.
+*
+******************************************************************************/
+XAie_TraceCmp* XAie_TraceCmpCreate(const XAie_TraceCmpCfg *Cfg)
+{
+	XAie_TraceCmp *Cmp;
+	u8 Hdr[XAIE_TRACECMP_HDR_SIZE];
+	u64 BufWords;
+
+	if((Cfg == NULL) || (Cfg->Sink == NULL)) {
+		XAIE_ERROR("Invalid trace compression configuration\n");
+		return NULL;
+	}
+
+	Cmp = (XAie_TraceCmp *)calloc(1U, sizeof(*Cmp));
+	if(Cmp == NULL) {
+		XAIE_ERROR("Memory allocation for trace compression failed\n");
+		return NULL;
+	}
+
+	Cmp->Cfg = *Cfg;
+	if(Cmp->Cfg.BlockWords == 0U) {
+		Cmp->Cfg.BlockWords = XAIE_TRACECMP_DEF_BLOCK_WORDS;
+	}
+	if(Cmp->Cfg.NumBlocks == 0U) {
+		Cmp->Cfg.NumBlocks = XAIE_TRACECMP_DEF_NUM_BLOCKS;
+	}
+	if(Cmp->Cfg.PktWords == 0U) {
+		Cmp->Cfg.PktWords = XAIE_TRACECMP_DEF_PKT_WORDS;
+	}
+
+	if(Cmp->Cfg.BlockWords > (0xFFFFFFFFU - XAIE_TRACECMP_BLOCK_HDR_SIZE -
+				16U) / sizeof(u32)) {
+		XAIE_ERROR("Invalid trace compression block size\n");
+		free(Cmp);
+		return NULL;
+	}
+
+	BufWords = (u64)Cmp->Cfg.BlockWords * Cmp->Cfg.NumBlocks;
+	Cmp->Bufs = (u32 *)malloc(BufWords * sizeof(u32));
+	Cmp->Fill = (u32 *)calloc(Cmp->Cfg.NumBlocks, sizeof(u32));
+	Cmp->Out = (u8 *)malloc(XAIE_TRACECMP_BLOCK_HDR_SIZE +
+			Cmp->Cfg.BlockWords * sizeof(u32) + 16U);
+	if((Cmp->Bufs == NULL) || (Cmp->Fill == NULL) || (Cmp->Out == NULL)) {
+		XAIE_ERROR("Memory allocation for trace compression failed\n");
+		goto err;
+	}
+
+#ifndef __AIEBAREMETAL__
+	if(pthread_mutex_init(&Cmp->Lock, NULL) != 0) {
+		XAIE_ERROR("Unable to create trace compression lock\n");
+		goto err;
+	}
+	if(pthread_cond_init(&Cmp->Cond, NULL) != 0) {
+		XAIE_ERROR("Unable to create trace compression condition\n");
+		pthread_mutex_destroy(&Cmp->Lock);
+		goto err;
+	}
+#endif
+
+	_XAie_TraceCmpPut32(Hdr, XAIE_TRACECMP_MAGIC);
+	_XAie_TraceCmpPut32(Hdr + 4U, XAIE_TRACECMP_VERSION |
+			((u32)Cmp->Cfg.PktWords << 16U));
+	_XAie_TraceCmpPut32(Hdr + 8U, Cmp->Cfg.BlockWords);
+	_XAie_TraceCmpPut32(Hdr + 12U, 0U);
+	if(_XAie_TraceCmpOutput(Cmp, Hdr, sizeof(Hdr)) != XAIE_OK) {
+		goto err_lock;
+	}
+	Cmp->Offset = sizeof(Hdr);
+	Cmp->Status = XAIE_OK;
+
+#ifndef __AIEBAREMETAL__
+	if(pthread_create(&Cmp->Thread, NULL, _XAie_TraceCmpWorker,
+				Cmp) != 0) {
+		XAIE_ERROR("Unable to create trace compression thread\n");
+		goto err_lock;
+	}
+	Cmp->Running = 1U;
+#endif
+
+	return Cmp;
+
+err_lock:
+#ifndef __AIEBAREMETAL__
+	pthread_cond_destroy(&Cmp->Cond);
+	pthread_mutex_destroy(&Cmp->Lock);
+#endif
+err:
+	free(Cmp->Out);
+	free(Cmp->Fill);
+	free(Cmp->Bufs);
+	free(Cmp);
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API is a trace sink feeding a trace compression stage. The trace is
+* copied to the ring of blocks, full blocks are compressed by the compression
+* thread. If the ring is full, it waits for a block to be written.
+*
+* @param	Arg: Trace compression stage.
+* @param	Data: Trace to write.
+* @param	Size: Size of the trace in bytes, a multiple of 4.
+*
+* @return	XAIE_OK on success, the error which stopped the compression or
+*		error code on failure.
+*
+* @note		The waits are counted as stalls; a ring stalling often needs
+*		more blocks or a faster sink. Calls must not overlap, as with
+*		the sink of a trace offload.
+*
+******************************************************************************/
+AieRC XAie_TraceCmpSink(void *Arg, const void *Data, u64 Size)
+{
+	XAie_TraceCmp *Cmp = (XAie_TraceCmp *)Arg;
+	const u32 *Words = (const u32 *)Data;
+	u64 NumWords = Size / sizeof(u32);
+	AieRC RC = XAIE_OK;
+
+	if((Cmp == NULL) || (Data == NULL && Size > 0U) ||
+			(Size % sizeof(u32) != 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_TraceCmpLock(Cmp);
+	if(Cmp->Finished != 0U) {
+		XAIE_ERROR("Trace compression is finished\n");
+		RC = XAIE_ERR;
+	} else {
+		Cmp->Stats.RawBytes += Size;
+	}
+
+	while((NumWords > 0U) && (RC == XAIE_OK)) {
+		u32 Slot;
+		u32 Count;
+
+#ifndef __AIEBAREMETAL__
+		if((Cmp->NumReady == Cmp->Cfg.NumBlocks) &&
+				(Cmp->Status == XAIE_OK)) {
+			Cmp->Stats.Stalls++;
+			while((Cmp->NumReady == Cmp->Cfg.NumBlocks) &&
+					(Cmp->Status == XAIE_OK)) {
+				pthread_cond_wait(&Cmp->Cond, &Cmp->Lock);
+			}
+		}
+#endif
+		RC = Cmp->Status;
+		if(RC != XAIE_OK) {
+			break;
+		}
+
+		Slot = (Cmp->Head + Cmp->NumReady) % Cmp->Cfg.NumBlocks;
+		Count = Cmp->Cfg.BlockWords - Cmp->Fill[Slot];
+		if(Count > NumWords) {
+			Count = (u32)NumWords;
+		}
+
+		/* The block being filled is not touched by the thread */
+		_XAie_TraceCmpUnlock(Cmp);
+		memcpy(Cmp->Bufs + (u64)Slot * Cmp->Cfg.BlockWords +
+				Cmp->Fill[Slot], Words, Count * sizeof(u32));
+		_XAie_TraceCmpLock(Cmp);
+
+		Cmp->Fill[Slot] += Count;
+		Words += Count;
+		NumWords -= Count;
+		if(Cmp->Fill[Slot] == Cmp->Cfg.BlockWords) {
+			RC = _XAie_TraceCmpQueue(Cmp);
+		}
+	}
+	_XAie_TraceCmpUnlock(Cmp);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API finishes the container of a trace compression stage. The partial
+* block is compressed, the compression thread is stopped and the index and
+* footer are written to the sink.
+*
+* @param	Cmp: Trace compression stage.
+*
+* @return	XAIE_OK on success, the error which stopped the compression or
+*		error code on failure.
+*
+* @note		Called once the trace offload is stopped. Without the index
+*		and footer, such as after a failure, the blocks written can
+*		still be found by XAie_TraceCmpGetBlocks().
+*
+******************************************************************************/
+AieRC XAie_TraceCmpFinish(XAie_TraceCmp *Cmp)
+{
+	u8 Footer[XAIE_TRACECMP_FOOTER_SIZE];
+	u8 Entry[XAIE_TRACECMP_INDEX_SIZE];
+	u64 NumBlocks;
+	AieRC RC;
+
+	if(Cmp == NULL) {
+		XAIE_ERROR("Invalid trace compression\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_TraceCmpLock(Cmp);
+	if(Cmp->Finished != 0U) {
+		_XAie_TraceCmpUnlock(Cmp);
+		return Cmp->Status;
+	}
+	Cmp->Finished = 1U;
+
+	/* The block being filled is never the last free one */
+	if((Cmp->Status == XAIE_OK) &&
+			(Cmp->Fill[(Cmp->Head + Cmp->NumReady) %
+			 Cmp->Cfg.NumBlocks] > 0U)) {
+		(void)_XAie_TraceCmpQueue(Cmp);
+	}
+#ifndef __AIEBAREMETAL__
+	Cmp->Stop = 1U;
+	pthread_cond_broadcast(&Cmp->Cond);
+#endif
+	_XAie_TraceCmpUnlock(Cmp);
+
+#ifndef __AIEBAREMETAL__
+	if(Cmp->Running != 0U) {
+		pthread_join(Cmp->Thread, NULL);
+		Cmp->Running = 0U;
+	}
+#endif
+
+	RC = Cmp->Status;
+	NumBlocks = Cmp->Stats.NumBlocks;
+	for(u32 i = 0U; (i < NumBlocks) && (RC == XAIE_OK); i++) {
+		_XAie_TraceCmpPut64(Entry, Cmp->Index[i].RawOffset);
+		_XAie_TraceCmpPut64(Entry + 8U, Cmp->Index[i].Offset);
+		_XAie_TraceCmpPut32(Entry + 16U, Cmp->Index[i].RawBytes);
+		_XAie_TraceCmpPut32(Entry + 20U, Cmp->Index[i].CmpBytes);
+		RC = _XAie_TraceCmpOutput(Cmp, Entry, sizeof(Entry));
+	}
+
+	if(RC == XAIE_OK) {
+		_XAie_TraceCmpPut64(Footer, Cmp->Offset);
+		_XAie_TraceCmpPut32(Footer + 8U, (u32)NumBlocks);
+		_XAie_TraceCmpPut32(Footer + 12U, XAIE_TRACECMP_FOOTER_MAGIC);
+		RC = _XAie_TraceCmpOutput(Cmp, Footer, sizeof(Footer));
+	}
+	Cmp->Status = RC;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the accounting of a trace compression stage.
+*
+* @param	Cmp: Trace compression stage.
+* @param	Stats: Pointer to store the accounting.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The ratio of RawBytes to CmpBytes is only the compression
+*		ratio once the stage is finished, blocks being compressed
+*		are not counted in CmpBytes.
+*
+******************************************************************************/
+AieRC XAie_TraceCmpGetStats(XAie_TraceCmp *Cmp, XAie_TraceCmpStats *Stats)
+{
+	if((Cmp == NULL) || (Stats == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_TraceCmpLock(Cmp);
+	*Stats = Cmp->Stats;
+	_XAie_TraceCmpUnlock(Cmp);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases a trace compression stage. It is finished first if it is
+* not.
+*
+* @param	Cmp: Trace compression stage.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_TraceCmpFree(XAie_TraceCmp *Cmp)
+{
+	if(Cmp == NULL) {
+		return;
+	}
+
+	(void)XAie_TraceCmpFinish(Cmp);
+
+#ifndef __AIEBAREMETAL__
+	pthread_cond_destroy(&Cmp->Cond);
+	pthread_mutex_destroy(&Cmp->Lock);
+#endif
+	free(Cmp->Index);
+	free(Cmp->Out);
+	free(Cmp->Fill);
+	free(Cmp->Bufs);
+	free(Cmp);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads the index entry of a block from its header.
+*
+* @param	Buf: Container.
+* @param	Size: Size of the container in bytes.
+* @param	Offset: Offset of the block header in the container.
+* @param	Block: Pointer to store the index entry.
+*
+* @return	XAIE_OK on success, XAIE_ERR if there is no whole block at the
+*		offset.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TraceCmpReadBlock(const u8 *Buf, u64 Size, u64 Offset,
+		XAie_TraceCmpBlock *Block)
+{
+	const u8 *Hdr = Buf + Offset;
+
+	if((Offset > Size) || (Size - Offset < XAIE_TRACECMP_BLOCK_HDR_SIZE) ||
+			(_XAie_TraceCmpGet32(Hdr) != XAIE_TRACECMP_BLOCK_MAGIC)) {
+		return XAIE_ERR;
+	}
+
+	Block->RawBytes = _XAie_TraceCmpGet32(Hdr + 8U);
+	Block->CmpBytes = _XAie_TraceCmpGet32(Hdr + 12U);
+	Block->RawOffset = _XAie_TraceCmpGet64(Hdr + 16U);
+	Block->Offset = Offset;
+	if(Size - Offset - XAIE_TRACECMP_BLOCK_HDR_SIZE < Block->CmpBytes) {
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API lists the blocks of a compressed trace container. The blocks are
+* read from the index, or found from their headers if the container has no
+* index, such as when it is cut short.
+*
+* @param	Buf: Container.
+* @param	Size: Size of the container in bytes.
+* @param	Blocks: Array to store the blocks, in trace order. If NULL,
+*		only the number of blocks is returned.
+* @param	NumBlocks: Size of the array on input, number of blocks of the
+*		container on output.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		If the array is too small, it is filled and XAIE_ERR is
+*		returned with the number of blocks of the container.
+*
+******************************************************************************/
+AieRC XAie_TraceCmpGetBlocks(const void *Buf, u64 Size,
+		XAie_TraceCmpBlock *Blocks, u32 *NumBlocks)
+{
+	const u8 *Ptr = (const u8 *)Buf;
+	XAie_TraceCmpBlock Block;
+	u32 Count = 0U;
+	u64 Offset;
+
+	if((Buf == NULL) || (NumBlocks == NULL) ||
+			(Size < XAIE_TRACECMP_HDR_SIZE) ||
+			(_XAie_TraceCmpGet32(Ptr) != XAIE_TRACECMP_MAGIC)) {
+		XAIE_ERROR("Invalid compressed trace\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Size >= XAIE_TRACECMP_HDR_SIZE + XAIE_TRACECMP_FOOTER_SIZE) {
+		const u8 *Footer = Ptr + Size - XAIE_TRACECMP_FOOTER_SIZE;
+		u64 IndexOffset = _XAie_TraceCmpGet64(Footer);
+		u32 Num = _XAie_TraceCmpGet32(Footer + 8U);
+
+		if((_XAie_TraceCmpGet32(Footer + 12U) ==
+					XAIE_TRACECMP_FOOTER_MAGIC) &&
+				(IndexOffset <= Size - XAIE_TRACECMP_FOOTER_SIZE) &&
+				(Size - XAIE_TRACECMP_FOOTER_SIZE - IndexOffset ==
+				 (u64)Num * XAIE_TRACECMP_INDEX_SIZE)) {
+			const u8 *Entry = Ptr + IndexOffset;
+
+			for(u32 i = 0U; (Blocks != NULL) &&
+					(i < Num) && (i < *NumBlocks); i++) {
+				Blocks[i].RawOffset = _XAie_TraceCmpGet64(Entry);
+				Blocks[i].Offset = _XAie_TraceCmpGet64(Entry + 8U);
+				Blocks[i].RawBytes = _XAie_TraceCmpGet32(Entry +
+						16U);
+				Blocks[i].CmpBytes = _XAie_TraceCmpGet32(Entry +
+						20U);
+				Entry += XAIE_TRACECMP_INDEX_SIZE;
+			}
+			Count = Num;
+			goto out;
+		}
+	}
+
+	Offset = XAIE_TRACECMP_HDR_SIZE;
+	while(_XAie_TraceCmpReadBlock(Ptr, Size, Offset, &Block) == XAIE_OK) {
+		if((Blocks != NULL) && (Count < *NumBlocks)) {
+			Blocks[Count] = Block;
+		}
+		Count++;
+		Offset += XAIE_TRACECMP_BLOCK_HDR_SIZE + Block.CmpBytes;
+	}
+
+out:
+	if((Blocks != NULL) && (Count > *NumBlocks)) {
+		*NumBlocks = Count;
+		return XAIE_ERR;
+	}
+	*NumBlocks = Count;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API finds the block holding an offset of the trace.
+*
+* @param	Blocks: Blocks of the container, in trace order.
+* @param	NumBlocks: Number of blocks.
+* @param	RawOffset: Offset in the trace, in bytes.
+*
+* @return	Index of the block, or NumBlocks if the offset is past the end
+*		of the trace.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XAie_TraceCmpFindBlock(const XAie_TraceCmpBlock *Blocks, u32 NumBlocks,
+		u64 RawOffset)
+{
+	u32 Lo = 0U, Hi = NumBlocks;
+
+	if(Blocks == NULL) {
+		return NumBlocks;
+	}
+
+	while(Lo < Hi) {
+		u32 Mid = Lo + (Hi - Lo) / 2U;
+
+		if(Blocks[Mid].RawOffset + Blocks[Mid].RawBytes <= RawOffset) {
+			Lo = Mid + 1U;
+		} else {
+			Hi = Mid;
+		}
+	}
+
+	if((Lo < NumBlocks) && (Blocks[Lo].RawOffset <= RawOffset)) {
+		return Lo;
+	}
+
+	return NumBlocks;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API decodes a block of a compressed trace container.
+*
+* @param	Buf: Container.
+* @param	Size: Size of the container in bytes.
+* @param	Block: Block, from XAie_TraceCmpGetBlocks().
+* @param	Words: Buffer for the trace of the block, RawBytes in size.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_TraceCmpDecodeBlock(const void *Buf, u64 Size,
+		const XAie_TraceCmpBlock *Block, u32 *Words)
+{
+	const u8 *Ptr = (const u8 *)Buf;
+	XAie_TraceCmpBlock Hdr;
+	const u8 *Payload;
+	u32 PktWords;
+	u32 Flags;
+
+	if((Buf == NULL) || (Block == NULL) || (Words == NULL) ||
+			(Size < XAIE_TRACECMP_HDR_SIZE) ||
+			(_XAie_TraceCmpGet32(Ptr) != XAIE_TRACECMP_MAGIC)) {
+		XAIE_ERROR("Invalid compressed trace\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((_XAie_TraceCmpReadBlock(Ptr, Size, Block->Offset, &Hdr) !=
+				XAIE_OK) ||
+			(Hdr.RawBytes != Block->RawBytes) ||
+			(Hdr.CmpBytes != Block->CmpBytes) ||
+			(Hdr.RawBytes % sizeof(u32) != 0U)) {
+		XAIE_ERROR("Invalid compressed trace block\n");
+		return XAIE_ERR;
+	}
+
+	PktWords = _XAie_TraceCmpGet32(Ptr + 4U) >> 16U;
+	Flags = _XAie_TraceCmpGet32(Ptr + Block->Offset + 4U);
+	Payload = Ptr + Block->Offset + XAIE_TRACECMP_BLOCK_HDR_SIZE;
+
+	if((Flags & XAIE_TRACECMP_FLAG_CODED) == 0U) {
+		if(Hdr.CmpBytes != Hdr.RawBytes) {
+			XAIE_ERROR("Invalid compressed trace block\n");
+			return XAIE_ERR;
+		}
+		for(u32 i = 0U; i < Hdr.RawBytes / sizeof(u32); i++) {
+			Words[i] = _XAie_TraceCmpGet32(Payload + i * sizeof(u32));
+		}
+		return XAIE_OK;
+	}
+
+	if((PktWords == 0U) || (_XAie_TraceCmpDecode(Payload, Hdr.CmpBytes,
+				PktWords, Words, Hdr.RawBytes / sizeof(u32)) !=
+				XAIE_OK)) {
+		XAIE_ERROR("Invalid compressed trace block\n");
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+#endif /* XAIE_FEATURE_TRACE_ENABLE */
+/** @} */
@@ -0,0 +1,71 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_tracecmp.h
+* @{
+*
+* Header file for the host side compression of offloaded trace streams.
+*
+******************************************************************************/
+#ifndef XAIETRACECMP_H
+#define XAIETRACECMP_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+#include "xaie_traceoffload.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * Compression stage of a trace offload. It is a trace sink which compresses
+ * the trace into blocks of an indexed container and passes the container to
+ * another sink.
+ */
+typedef struct XAie_TraceCmp XAie_TraceCmp;
+
+/* Configuration of a trace compression stage */
+typedef struct {
+	XAie_TraceSinkFn Sink;	/* Sink of the compressed container */
+	void *SinkArg;
+	u32 BlockWords;		/* Trace words per block, 0 for default */
+	u32 NumBlocks;		/* Blocks buffered for the compression
+				 * thread, 0 for default */
+	u8 PktWords;		/* Words per trace packet, 0 for default */
+} XAie_TraceCmpCfg;
+
+/* Accounting of a trace compression stage */
+typedef struct {
+	u64 RawBytes;		/* Trace bytes taken */
+	u64 CmpBytes;		/* Container bytes passed to the sink */
+	u64 NumBlocks;		/* Blocks written */
+	u64 Stalls;		/* Trace writes which waited for a free block */
+} XAie_TraceCmpStats;
+
+/* Index entry of a block of a compressed trace container */
+typedef struct {
+	u64 RawOffset;		/* Offset of the block in the trace */
+	u64 Offset;		/* Offset of the block in the container */
+	u32 RawBytes;		/* Trace bytes of the block */
+	u32 CmpBytes;		/* Container bytes of the block payload */
+} XAie_TraceCmpBlock;
+
+/************************** Function Prototypes  *****************************/
+XAie_TraceCmp* XAie_TraceCmpCreate(const XAie_TraceCmpCfg *Cfg);
+AieRC XAie_TraceCmpSink(void *Arg, const void *Data, u64 Size);
+AieRC XAie_TraceCmpFinish(XAie_TraceCmp *Cmp);
+AieRC XAie_TraceCmpGetStats(XAie_TraceCmp *Cmp, XAie_TraceCmpStats *Stats);
+void XAie_TraceCmpFree(XAie_TraceCmp *Cmp);
+AieRC XAie_TraceCmpGetBlocks(const void *Buf, u64 Size,
+		XAie_TraceCmpBlock *Blocks, u32 *NumBlocks);
+u32 XAie_TraceCmpFindBlock(const XAie_TraceCmpBlock *Blocks, u32 NumBlocks,
+		u64 RawOffset);
+AieRC XAie_TraceCmpDecodeBlock(const void *Buf, u64 Size,
+		const XAie_TraceCmpBlock *Block, u32 *Words);
+
+#endif		/* end of protection macro */
+/** @} */
@@ -0,0 +1,816 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_tracedec.c
+* @{
+*
+* This file contains routines to decode the trace streams written to memory
+* by the shim DMA into a columnar table of records.
+*
+* With packet switching, a trace packet is a header word followed by seven
+* payload words. The header holds the stream ID in bits 4:0, the packet type
+* in bits 14:12, the source row in bits 20:16, the source column in bits 27:21
+* and an odd parity bit in bit 31. The payload is a byte stream, most
+* significant byte of a word first, made of the frames below. Frames may span
+* words and packets of the same stream.
+*
+* <pre>
+* Frame      Encoding                                    Meaning
+* ---------  ------------------------------------------  ----------------------
+* Single0    0eeetttt                                    slot e after t cycles
+* Single1    1000eeet tttttttt                           slot e after t cycles
+* Single2    1001eeet tttttttt tttttttt                  slot e after t cycles
+* Multiple0  1100tttt eeeeeeee                           slots e after t cycles
+* Multiple1  1101tttt tttttttt eeeeeeee                  slots e after t cycles
+* Multiple2  1110tttt tttttttt tttttttt eeeeeeee         slots e after t cycles
+* Start      11110000 and 7 bytes t                      timer is t
+* Repeat0    111101nn                                    previous frame n+1 times
+* Repeat1    11111000 nnnnnnnn                           previous frame n+1 times
+* EventPC    11111100 00000eee pppppppp pppppppp         slot e at PC p
+* Sync       11111110                                    no-op
+* Filler     11111111                                    no-op
+* </pre>
+*
+* In instruction execution mode the payload is the program flow of the core,
+* which can only be followed with the program image. Its words are stored as
+* raw records.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_tracedec.h"
+
+#ifdef XAIE_FEATURE_TRACE_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TRACEDEC_PKT_PAYLOAD_WORDS		7U
+#define XAIE_TRACEDEC_MAX_STREAMS		0xFFFFU
+#define XAIE_TRACEDEC_MIN_RECORDS		1024U
+#define XAIE_TRACEDEC_FILLER_WORD		0xFFFFFFFFU
+#define XAIE_TRACEDEC_SINGLE0_MASK		0x80808080U
+
+#define XAIE_TRACEDEC_HDR_KEY_MASK		0x0FFF701FU
+#define XAIE_TRACEDEC_HDR_PKTID(H)		((H) & 0x1FU)
+#define XAIE_TRACEDEC_HDR_PKTTYPE(H)		(((H) >> 12U) & 0x7U)
+#define XAIE_TRACEDEC_HDR_ROW(H)		(((H) >> 16U) & 0x1FU)
+#define XAIE_TRACEDEC_HDR_COL(H)		(((H) >> 21U) & 0x7FU)
+
+/**************************** Type Definitions *******************************/
+/* Decoding state of one trace stream */
+typedef struct {
+	u32 Key;		/* Header bits identifying the stream */
+	XAie_TraceMode Mode;
+	u64 Time;		/* Timer value after the last frame */
+	u32 LastDelta;		/* Delta of the last event frame */
+	u8 LastSlots;		/* Slots of the last event frame */
+	u8 Pend[8];		/* Bytes of a frame spanning words */
+	u8 PendLen;
+	u8 FrameLen;		/* Length of the pending frame */
+} XAie_TraceDecStream;
+
+struct XAie_TraceDec {
+	XAie_TraceMode PktMode[32];	/* Mode per stream ID */
+	u8 PktSwitched;
+	XAie_TraceDecStream *Streams;
+	u32 NumStreams;
+	u32 MaxStreams;
+	u32 Cur;		/* Stream of the current packet */
+	u32 WordsLeft;		/* Payload words left in the current packet */
+	u32 LastKey;		/* Key of the last stream looked up */
+	u32 LastIdx;
+	u64 Errors;
+	u8 FrameLen[256];	/* Frame length by first byte, 0 if invalid */
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the length of the trace frame starting with a byte.
+*
+* @param	Byte: First byte of the frame.
+*
+* @return	Length of the frame in bytes, 0 for an invalid frame.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u8 _XAie_TraceDecFrameLen(u8 Byte)
+{
+	if((Byte & 0x80U) == 0U) {
+		return 1U;
+	}
+
+	switch(Byte >> 4U) {
+	case 0x8U:
+		return 2U;
+	case 0x9U:
+		return 3U;
+	case 0xCU:
+		return 2U;
+	case 0xDU:
+		return 3U;
+	case 0xEU:
+		return 4U;
+	default:
+		break;
+	}
+
+	switch(Byte) {
+	case 0xF0U:
+		return 8U;
+	case 0xF4U:
+	case 0xF5U:
+	case 0xF6U:
+	case 0xF7U:
+	case 0xFEU:
+	case 0xFFU:
+		return 1U;
+	case 0xF8U:
+		return 2U;
+	case 0xFCU:
+		return 4U;
+	default:
+		return 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API makes sure a trace table can hold more records.
+*
+* @param	Table: Trace table.
+* @param	Need: Number of records to add.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TraceTableReserve(XAie_TraceTable *Table, u64 Need)
+{
+	u64 Cap = Table->Capacity;
+	void *Ptr;
+
+	if(Table->NumRecords + Need <= Cap) {
+		return XAIE_OK;
+	}
+
+	if(Cap < XAIE_TRACEDEC_MIN_RECORDS) {
+		Cap = XAIE_TRACEDEC_MIN_RECORDS;
+	}
+	while(Cap < Table->NumRecords + Need) {
+		Cap *= 2U;
+	}
+
+	Ptr = realloc(Table->Time, Cap * sizeof(*Table->Time));
+	if(Ptr == NULL) {
+		goto alloc_err;
+	}
+	Table->Time = (u64 *)Ptr;
+	Ptr = realloc(Table->Data, Cap * sizeof(*Table->Data));
+	if(Ptr == NULL) {
+		goto alloc_err;
+	}
+	Table->Data = (u32 *)Ptr;
+	Ptr = realloc(Table->Stream, Cap * sizeof(*Table->Stream));
+	if(Ptr == NULL) {
+		goto alloc_err;
+	}
+	Table->Stream = (u16 *)Ptr;
+	Ptr = realloc(Table->Slot, Cap * sizeof(*Table->Slot));
+	if(Ptr == NULL) {
+		goto alloc_err;
+	}
+	Table->Slot = (u8 *)Ptr;
+	Ptr = realloc(Table->Type, Cap * sizeof(*Table->Type));
+	if(Ptr == NULL) {
+		goto alloc_err;
+	}
+	Table->Type = (u8 *)Ptr;
+	Table->Capacity = Cap;
+
+	return XAIE_OK;
+
+alloc_err:
+	XAIE_ERROR("Memory allocation for trace table failed\n");
+	return XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API appends a record to a trace table.
+*
+* @param	Table: Trace table.
+* @param	Time: Timer value of the record.
+* @param	Data: PC or trace word of the record.
+* @param	Stream: Stream index of the record.
+* @param	Slot: Trace slot of the record.
+* @param	Type: Type of the record.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline AieRC _XAie_TraceTableAdd(XAie_TraceTable *Table, u64 Time,
+		u32 Data, u32 Stream, u8 Slot, XAie_TraceRecType Type)
+{
+	u64 i = Table->NumRecords;
+
+	if(i == Table->Capacity) {
+		AieRC RC = _XAie_TraceTableReserve(Table, 1U);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	Table->Time[i] = Time;
+	Table->Data[i] = Data;
+	Table->Stream[i] = (u16)Stream;
+	Table->Slot[i] = Slot;
+	Table->Type[i] = (u8)Type;
+	Table->NumRecords = i + 1U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API advances the timer of a stream and adds one event record per slot
+* of a bitmap.
+*
+* @param	Table: Trace table.
+* @param	S: Stream state.
+* @param	Idx: Stream index.
+* @param	Slots: Bitmap of the slots with an event.
+* @param	Delta: Cycles since the previous frame.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TraceDecEvents(XAie_TraceTable *Table,
+		XAie_TraceDecStream *S, u32 Idx, u8 Slots, u32 Delta)
+{
+	AieRC RC;
+
+	S->Time += Delta;
+	S->LastSlots = Slots;
+	S->LastDelta = Delta;
+
+	for(u8 Slot = 0U; Slots != 0U; Slot++, Slots >>= 1U) {
+		if((Slots & 1U) == 0U) {
+			continue;
+		}
+
+		RC = _XAie_TraceTableAdd(Table, S->Time, 0U, Idx, Slot,
+				XAIE_TRACE_REC_EVENT);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API decodes a complete trace frame of a stream.
+*
+* @param	Dec: Trace decoder.
+* @param	Table: Trace table.
+* @param	Idx: Stream index.
+* @param	F: Bytes of the frame.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TraceDecFrame(XAie_TraceDec *Dec, XAie_TraceTable *Table,
+		u32 Idx, const u8 *F)
+{
+	XAie_TraceDecStream *S = &Dec->Streams[Idx];
+	AieRC RC;
+	u32 Count;
+
+	if((F[0] & 0x80U) == 0U) {
+		return _XAie_TraceDecEvents(Table, S, Idx,
+				(u8)(1U << ((F[0] >> 4U) & 0x7U)), F[0] & 0xFU);
+	}
+
+	switch(F[0] >> 4U) {
+	case 0x8U:
+		return _XAie_TraceDecEvents(Table, S, Idx,
+				(u8)(1U << ((F[0] >> 1U) & 0x7U)),
+				((u32)(F[0] & 0x1U) << 8U) | F[1]);
+	case 0x9U:
+		return _XAie_TraceDecEvents(Table, S, Idx,
+				(u8)(1U << ((F[0] >> 1U) & 0x7U)),
+				((u32)(F[0] & 0x1U) << 16U) |
+				((u32)F[1] << 8U) | F[2]);
+	case 0xCU:
+		return _XAie_TraceDecEvents(Table, S, Idx, F[1],
+				F[0] & 0xFU);
+	case 0xDU:
+		return _XAie_TraceDecEvents(Table, S, Idx, F[2],
+				((u32)(F[0] & 0xFU) << 8U) | F[1]);
+	case 0xEU:
+		return _XAie_TraceDecEvents(Table, S, Idx, F[3],
+				((u32)(F[0] & 0xFU) << 16U) |
+				((u32)F[1] << 8U) | F[2]);
+	default:
+		break;
+	}
+
+	switch(F[0]) {
+	case 0xF0U:
+		S->Time = 0U;
+		for(u8 i = 1U; i < 8U; i++) {
+			S->Time = (S->Time << 8U) | F[i];
+		}
+		return XAIE_OK;
+	case 0xF8U:
+		Count = (u32)F[1] + 1U;
+		break;
+	case 0xFCU:
+		return _XAie_TraceTableAdd(Table, S->Time,
+				((u32)F[2] << 8U) | F[3], Idx, F[1] & 0x7U,
+				XAIE_TRACE_REC_PC);
+	case 0xFEU:
+	case 0xFFU:
+		return XAIE_OK;
+	default:
+		Count = (u32)(F[0] & 0x3U) + 1U;
+		break;
+	}
+
+	/* Repeat frames */
+	while(Count-- > 0U) {
+		RC = _XAie_TraceDecEvents(Table, S, Idx, S->LastSlots,
+				S->LastDelta);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API decodes a payload word of a stream.
+*
+* @param	Dec: Trace decoder.
+* @param	Table: Trace table.
+* @param	Idx: Stream index.
+* @param	Word: Payload word.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TraceDecWord(XAie_TraceDec *Dec, XAie_TraceTable *Table,
+		u32 Idx, u32 Word)
+{
+	XAie_TraceDecStream *S = &Dec->Streams[Idx];
+	AieRC RC;
+
+	if(S->Mode == XAIE_TRACE_INST_EXEC) {
+		return _XAie_TraceTableAdd(Table, S->Time, Word, Idx, 0U,
+				XAIE_TRACE_REC_RAW);
+	}
+
+	if(S->PendLen == 0U) {
+		/* Fast paths for padding and runs of short event frames */
+		if(Word == XAIE_TRACEDEC_FILLER_WORD) {
+			return XAIE_OK;
+		}
+
+		if((Word & XAIE_TRACEDEC_SINGLE0_MASK) == 0U) {
+			RC = _XAie_TraceTableReserve(Table, 4U);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+
+			for(s8 Shift = 24; Shift >= 0; Shift -= 8) {
+				u8 B = (u8)(Word >> Shift);
+
+				S->Time += B & 0xFU;
+				S->LastDelta = B & 0xFU;
+				S->LastSlots = (u8)(1U << (B >> 4U));
+				_XAie_TraceTableAdd(Table, S->Time, 0U, Idx,
+						B >> 4U, XAIE_TRACE_REC_EVENT);
+			}
+
+			return XAIE_OK;
+		}
+	}
+
+	for(s8 Shift = 24; Shift >= 0; Shift -= 8) {
+		u8 B = (u8)(Word >> Shift);
+
+		if(S->PendLen == 0U) {
+			S->FrameLen = Dec->FrameLen[B];
+			if(S->FrameLen == 0U) {
+				/* Drop the rest of the word to resync */
+				Dec->Errors++;
+				return XAIE_OK;
+			}
+		}
+
+		S->Pend[S->PendLen++] = B;
+		if(S->PendLen < S->FrameLen) {
+			continue;
+		}
+
+		S->PendLen = 0U;
+		RC = _XAie_TraceDecFrame(Dec, Table, Idx, S->Pend);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks the odd parity of a packet header.
+*
+* @param	Hdr: Packet header.
+*
+* @return	1 if the parity is correct, 0 otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline u8 _XAie_TraceDecHdrValid(u32 Hdr)
+{
+	Hdr ^= Hdr >> 16U;
+	Hdr ^= Hdr >> 8U;
+	Hdr ^= Hdr >> 4U;
+	Hdr ^= Hdr >> 2U;
+	Hdr ^= Hdr >> 1U;
+
+	return (u8)(Hdr & 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the index of the stream of a packet header, adding a new
+* stream for a new source.
+*
+* @param	Dec: Trace decoder.
+* @param	Hdr: Packet header.
+* @param	Idx: Pointer to return the stream index.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TraceDecStreamIdx(XAie_TraceDec *Dec, u32 Hdr, u32 *Idx)
+{
+	u32 Key = Hdr & XAIE_TRACEDEC_HDR_KEY_MASK;
+	XAie_TraceDecStream *S;
+
+	if(Dec->NumStreams > 0U && Key == Dec->LastKey) {
+		*Idx = Dec->LastIdx;
+		return XAIE_OK;
+	}
+
+	for(u32 i = 0U; i < Dec->NumStreams; i++) {
+		if(Dec->Streams[i].Key == Key) {
+			Dec->LastKey = Key;
+			Dec->LastIdx = i;
+			*Idx = i;
+			return XAIE_OK;
+		}
+	}
+
+	if(Dec->NumStreams == XAIE_TRACEDEC_MAX_STREAMS) {
+		XAIE_ERROR("Too many trace streams\n");
+		return XAIE_ERR;
+	}
+
+	if(Dec->NumStreams == Dec->MaxStreams) {
+		u32 Max = Dec->MaxStreams * 2U;
+
+		S = (XAie_TraceDecStream *)realloc(Dec->Streams,
+				Max * sizeof(*S));
+		if(S == NULL) {
+			XAIE_ERROR("Memory allocation for trace streams failed\n");
+			return XAIE_ERR;
+		}
+		Dec->Streams = S;
+		Dec->MaxStreams = Max;
+	}
+
+	S = &Dec->Streams[Dec->NumStreams];
+	memset(S, 0, sizeof(*S));
+	S->Key = Key;
+	S->Mode = Dec->PktMode[XAIE_TRACEDEC_HDR_PKTID(Hdr)];
+
+	Dec->LastKey = Key;
+	Dec->LastIdx = Dec->NumStreams;
+	*Idx = Dec->NumStreams++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a trace decoder.
+*
+* @param	Mode: Trace mode of the streams, as set with
+*		XAie_TraceModeConfig().
+* @param	PktSwitched: XAIE_ENABLE if the trace is packet switched,
+*		XAIE_DISABLE if the words are the payload of a single stream.
+*
+* @return	Pointer to the decoder on success, NULL on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+XAie_TraceDec* XAie_TraceDecCreate(XAie_TraceMode Mode, u8 PktSwitched)
+{
+	XAie_TraceDec *Dec;
+
+	if(Mode > XAIE_TRACE_INST_EXEC) {
+		XAIE_ERROR("Invalid trace mode\n");
+		return NULL;
+	}
+
+	Dec = (XAie_TraceDec *)calloc(1U, sizeof(*Dec));
+	if(Dec == NULL) {
+		XAIE_ERROR("Memory allocation for trace decoder failed\n");
+		return NULL;
+	}
+
+	Dec->MaxStreams = 16U;
+	Dec->Streams = (XAie_TraceDecStream *)calloc(Dec->MaxStreams,
+			sizeof(*Dec->Streams));
+	if(Dec->Streams == NULL) {
+		XAIE_ERROR("Memory allocation for trace decoder failed\n");
+		free(Dec);
+		return NULL;
+	}
+
+	for(u32 i = 0U; i < 32U; i++) {
+		Dec->PktMode[i] = Mode;
+	}
+	for(u32 i = 0U; i < 256U; i++) {
+		Dec->FrameLen[i] = _XAie_TraceDecFrameLen((u8)i);
+	}
+
+	Dec->PktSwitched = PktSwitched;
+	if(PktSwitched == XAIE_DISABLE) {
+		Dec->Streams[0].Mode = Mode;
+		Dec->NumStreams = 1U;
+	}
+
+	return Dec;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the trace mode of the streams with a packet ID. It is needed
+* when modules of a trace use different modes.
+*
+* @param	Dec: Trace decoder.
+* @param	PktId: Packet ID of the streams, as set with
+*		XAie_TracePktConfig().
+* @param	Mode: Trace mode of the streams.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_TraceDecSetMode(XAie_TraceDec *Dec, u8 PktId, XAie_TraceMode Mode)
+{
+	if(Dec == NULL || PktId >= 32U || Mode > XAIE_TRACE_INST_EXEC) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Dec->PktMode[PktId] = Mode;
+	for(u32 i = 0U; i < Dec->NumStreams; i++) {
+		if(Dec->PktSwitched == XAIE_DISABLE ||
+				XAIE_TRACEDEC_HDR_PKTID(Dec->Streams[i].Key) ==
+				PktId) {
+			Dec->Streams[i].Mode = Mode;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API decodes trace words and appends the records to a table. The state
+* of the streams is kept, so a trace can be decoded in chunks of any size in
+* the order the words were written.
+*
+* @param	Dec: Trace decoder.
+* @param	Words: Trace words.
+* @param	NumWords: Number of trace words.
+* @param	Table: Trace table to append the records to. It has to be
+*		zero initialized before its first use.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Packet headers with a wrong parity, such as the zeros after
+*		the end of a trace buffer, are skipped and counted as errors.
+*
+******************************************************************************/
+AieRC XAie_TraceDecode(XAie_TraceDec *Dec, const u32 *Words, u64 NumWords,
+		XAie_TraceTable *Table)
+{
+	AieRC RC;
+
+	if(Dec == NULL || Table == NULL || (Words == NULL && NumWords > 0U)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_TraceTableReserve(Table, NumWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	for(u64 i = 0U; i < NumWords; i++) {
+		u32 Word = Words[i];
+
+		if(Dec->PktSwitched == XAIE_DISABLE) {
+			RC = _XAie_TraceDecWord(Dec, Table, 0U, Word);
+		} else if(Dec->WordsLeft == 0U) {
+			if(_XAie_TraceDecHdrValid(Word) == 0U) {
+				Dec->Errors++;
+				continue;
+			}
+
+			RC = _XAie_TraceDecStreamIdx(Dec, Word, &Dec->Cur);
+			Dec->WordsLeft = XAIE_TRACEDEC_PKT_PAYLOAD_WORDS;
+		} else {
+			Dec->WordsLeft--;
+			RC = _XAie_TraceDecWord(Dec, Table, Dec->Cur, Word);
+		}
+
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the source of a trace stream.
+*
+* @param	Dec: Trace decoder.
+* @param	Idx: Stream index, as in the Stream column of a trace table.
+* @param	Info: Pointer to return the stream source.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_TraceDecGetStream(XAie_TraceDec *Dec, u16 Idx,
+		XAie_TraceStreamInfo *Info)
+{
+	u32 Key;
+
+	if(Dec == NULL || Info == NULL || Idx >= Dec->NumStreams) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Key = Dec->Streams[Idx].Key;
+	Info->Loc = XAie_TileLoc(XAIE_TRACEDEC_HDR_COL(Key),
+			XAIE_TRACEDEC_HDR_ROW(Key));
+	Info->PktId = XAIE_TRACEDEC_HDR_PKTID(Key);
+	Info->PktType = XAIE_TRACEDEC_HDR_PKTTYPE(Key);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the number of trace streams seen by a decoder.
+*
+* @param	Dec: Trace decoder.
+*
+* @return	Number of streams.
+*
+* @note		None.
+*
+******************************************************************************/
+u16 XAie_TraceDecGetNumStreams(XAie_TraceDec *Dec)
+{
+	if(Dec == NULL) {
+		return 0U;
+	}
+
+	return (u16)Dec->NumStreams;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the number of invalid packet headers and frames skipped
+* by a decoder.
+*
+* @param	Dec: Trace decoder.
+*
+* @return	Number of errors.
+*
+* @note		None.
+*
+******************************************************************************/
+u64 XAie_TraceDecGetErrors(XAie_TraceDec *Dec)
+{
+	if(Dec == NULL) {
+		return 0U;
+	}
+
+	return Dec->Errors;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees a trace decoder.
+*
+* @param	Dec: Trace decoder.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_TraceDecFree(XAie_TraceDec *Dec)
+{
+	if(Dec == NULL) {
+		return;
+	}
+
+	free(Dec->Streams);
+	free(Dec);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees the columns of a trace table.
+*
+* @param	Table: Trace table.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_TraceTableFree(XAie_TraceTable *Table)
+{
+	if(Table == NULL) {
+		return;
+	}
+
+	free(Table->Time);
+	free(Table->Data);
+	free(Table->Stream);
+	free(Table->Slot);
+	free(Table->Type);
+	memset(Table, 0, sizeof(*Table));
+}
+
+#endif /* XAIE_FEATURE_TRACE_ENABLE */
+/** @} */
@@ -0,0 +1,71 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_tracedec.h
+* @{
+*
+* Header file for the host side decoder of AIE trace streams.
+*
+******************************************************************************/
+#ifndef XAIETRACEDEC_H
+#define XAIETRACEDEC_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+#include "xaie_trace.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * Decoder of trace words as written to memory by the shim DMA. It keeps the
+ * state of every trace stream so a trace can be decoded in chunks.
+ */
+typedef struct XAie_TraceDec XAie_TraceDec;
+
+/* This enum captures the types of decoded trace records */
+typedef enum {
+	XAIE_TRACE_REC_EVENT,	/* Event of a trace slot */
+	XAIE_TRACE_REC_PC,	/* Event of a trace slot with its PC */
+	XAIE_TRACE_REC_RAW,	/* Undecoded execution trace word */
+} XAie_TraceRecType;
+
+/*
+ * Columnar table of decoded trace records. Record i is made of the ith entry
+ * of every column. The columns are grown by the decoder as needed.
+ */
+typedef struct {
+	u64 *Time;	/* Timer value of the record */
+	u32 *Data;	/* PC for PC records, trace word for raw records */
+	u16 *Stream;	/* Index of the stream of the record */
+	u8 *Slot;	/* Trace slot of the event */
+	u8 *Type;	/* Record type, XAie_TraceRecType */
+	u64 NumRecords;
+	u64 Capacity;
+} XAie_TraceTable;
+
+/* Source of a trace stream, as found in the packet headers */
+typedef struct {
+	XAie_LocType Loc;
+	u8 PktId;
+	u8 PktType;
+} XAie_TraceStreamInfo;
+
+/************************** Function Prototypes  *****************************/
+XAie_TraceDec* XAie_TraceDecCreate(XAie_TraceMode Mode, u8 PktSwitched);
+AieRC XAie_TraceDecSetMode(XAie_TraceDec *Dec, u8 PktId, XAie_TraceMode Mode);
+AieRC XAie_TraceDecode(XAie_TraceDec *Dec, const u32 *Words, u64 NumWords,
+		XAie_TraceTable *Table);
+AieRC XAie_TraceDecGetStream(XAie_TraceDec *Dec, u16 Idx,
+		XAie_TraceStreamInfo *Info);
+u16 XAie_TraceDecGetNumStreams(XAie_TraceDec *Dec);
+u64 XAie_TraceDecGetErrors(XAie_TraceDec *Dec);
+void XAie_TraceDecFree(XAie_TraceDec *Dec);
+void XAie_TraceTableFree(XAie_TraceTable *Table);
+
+#endif		/* end of protection macro */
+/** @} */
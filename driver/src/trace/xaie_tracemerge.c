@@ -0,0 +1,1141 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_tracemerge.c
+* @{
+*
+* This file contains routines to merge the streams of decoded trace tables
+* into one global timeline and to export it as a Chrome trace.
+*
+* The records of a stream are in time order in its table, but the streams of
+* a table are interleaved by packet. The merge links the records of every
+* stream once, then does a k-way merge with a binary heap of one cursor per
+* stream, so it needs the heap and a 32-bit link per record, never a copy of
+* the records. The timers of the tiles are expected to be synchronized with
+* XAie_SyncTimer(); residual offsets of tiles can be set, and a fit of
+* XAie_TimeCal maps the timer values to host time.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_tracemerge.h"
+
+#ifdef XAIE_FEATURE_TRACE_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TRACEMERGE_NO_REC			0xFFFFFFFFU
+#define XAIE_TRACEMERGE_NUM_SLOTS		8U
+#define XAIE_TRACEMERGE_JSON_BUF_SIZE		0x10000U
+#define XAIE_TRACEMERGE_JSON_MAX_LINE		0x200U
+#define XAIE_TRACEMERGE_MAX_NAME		0x80U
+#define XAIE_TRACEMERGE_PKTTYPE_CORE		0U
+#define XAIE_TRACEMERGE_PKTTYPE_MEM		1U
+#define XAIE_TRACEMERGE_PKTTYPE_MEMTILE		3U
+
+/**************************** Type Definitions *******************************/
+/* Decoded trace table merged and the links of its streams */
+typedef struct {
+	XAie_TraceDec *Dec;
+	const XAie_TraceTable *Table;
+	u32 *Link;		/* Next record of the same stream */
+} XAie_TraceMergeInput;
+
+/* Names and tracks of the trace slots of a module of a tile */
+typedef struct {
+	XAie_LocType Loc;
+	u8 PktType;
+	const char *Names[XAIE_TRACEMERGE_NUM_SLOTS];
+	u8 Tracks[XAIE_TRACEMERGE_NUM_SLOTS];
+} XAie_TraceMergeSlots;
+
+/* Timer offset of a tile */
+typedef struct {
+	XAie_LocType Loc;
+	u64 Cycles;
+} XAie_TraceMergeOffset;
+
+/* Position of the merge in a stream */
+typedef struct {
+	u64 Time;		/* Time of the current record with the offset */
+	u64 Offset;
+	u32 Rec;		/* Current record */
+	u32 Input;
+	XAie_LocType Loc;
+	u8 PktType;
+	const XAie_TraceMergeSlots *Slots;	/* NULL for the defaults */
+} XAie_TraceMergeCursor;
+
+struct XAie_TraceMerge {
+	XAie_TraceMergeInput *Inputs;
+	u32 NumInputs;
+	u32 MaxInputs;
+	XAie_TraceMergeSlots *Slots;
+	u32 NumSlots;
+	u32 MaxSlots;
+	XAie_TraceMergeOffset *Offsets;
+	u32 NumOffsets;
+	u32 MaxOffsets;
+	XAie_TraceMergeCursor *Cursors;
+	u32 NumCursors;
+	u32 *Heap;		/* Min heap of cursors by time */
+	u32 HeapSize;
+	XAie_TimeCalFit Fit;
+	u8 HasFit;
+	u32 ClockMhz;
+};
+
+/* Buffered writer of a Chrome trace */
+typedef struct {
+	XAie_TraceSinkFn Sink;
+	void *SinkArg;
+	char *Buf;
+	u32 Len;
+	u8 First;		/* No event written yet */
+	AieRC RC;
+} XAie_TraceMergeWriter;
+
+/* Slice of consecutive occurrences of an event */
+typedef struct {
+	u64 Start;
+	u64 End;
+	u8 Open;
+} XAie_TraceMergeSlice;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API makes sure an array of the merge can hold one more element.
+*
+* @param	Arr: Pointer to the array.
+* @param	Max: Pointer to the capacity of the array.
+* @param	Num: Number of elements in the array.
+* @param	Size: Size of an element.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TraceMergeGrow(void **Arr, u32 *Max, u32 Num, size_t Size)
+{
+	u32 Cap;
+	void *Ptr;
+
+	if(Num < *Max) {
+		return XAIE_OK;
+	}
+
+	Cap = (*Max == 0U) ? 8U : *Max * 2U;
+	Ptr = realloc(*Arr, Cap * Size);
+	if(Ptr == NULL) {
+		XAIE_ERROR("Memory allocation for trace merge failed\n");
+		return XAIE_ERR;
+	}
+
+	*Arr = Ptr;
+	*Max = Cap;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the slot descriptions of a module of a tile.
+*
+* @param	Merge: Trace merge.
+* @param	Loc: Location of the tile.
+* @param	PktType: Packet type of the module.
+*
+* @return	Pointer to the slot descriptions, NULL if none were set.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static XAie_TraceMergeSlots* _XAie_TraceMergeFindSlots(XAie_TraceMerge *Merge,
+		XAie_LocType Loc, u8 PktType)
+{
+	for(u32 i = 0U; i < Merge->NumSlots; i++) {
+		XAie_TraceMergeSlots *S = &Merge->Slots[i];
+
+		if(S->Loc.Col == Loc.Col && S->Loc.Row == Loc.Row &&
+				S->PktType == PktType) {
+			return S;
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the default track of the events of a module.
+*
+* @param	PktType: Packet type of the module.
+*
+* @return	Track of the events.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u8 _XAie_TraceMergeDefaultTrack(u8 PktType)
+{
+	if(PktType == XAIE_TRACEMERGE_PKTTYPE_CORE) {
+		return (u8)XAIE_TRACE_TRACK_CORE;
+	} else if(PktType == XAIE_TRACEMERGE_PKTTYPE_MEM ||
+			PktType == XAIE_TRACEMERGE_PKTTYPE_MEMTILE) {
+		return (u8)XAIE_TRACE_TRACK_MEM;
+	}
+
+	return (u8)XAIE_TRACE_TRACK_OTHER;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the timer offset of a tile to a timer value. Values a
+* negative offset would take below zero are clamped to zero.
+*
+* @param	Time: Timer value.
+* @param	Offset: Offset in two's complement.
+*
+* @return	Offset timer value.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static inline u64 _XAie_TraceMergeAdjust(u64 Time, u64 Offset)
+{
+	if((Offset >> 63U) != 0U && Time < (~Offset + 1U)) {
+		return 0U;
+	}
+
+	return Time + Offset;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API converts an offset timer value to host time with the calibration
+* fit of the merge.
+*
+* @param	Merge: Trace merge.
+* @param	Time: Offset timer value.
+*
+* @return	Host time in nanoseconds.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static u64 _XAie_TraceMergeHostNs(XAie_TraceMerge *Merge, u64 Time)
+{
+	const XAie_TimeCalFit *Fit = &Merge->Fit;
+	u64 Delta;
+
+	if(Time >= Fit->CycleRef) {
+		return Fit->HostRefNs + (u64)((double)(Time - Fit->CycleRef) *
+				Fit->NsPerCycle);
+	}
+
+	Delta = (u64)((double)(Fit->CycleRef - Time) * Fit->NsPerCycle);
+	return (Delta < Fit->HostRefNs) ? (Fit->HostRefNs - Delta) : 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API compares two cursors of the merge heap.
+*
+* @param	Merge: Trace merge.
+* @param	A: Index of a cursor.
+* @param	B: Index of a cursor.
+*
+* @return	1 if cursor A goes before cursor B, 0 otherwise.
+*
+* @note		Ties are broken by cursor index so the merge is stable.
+*		Internal only.
+*
+******************************************************************************/
+static inline u8 _XAie_TraceMergeLess(XAie_TraceMerge *Merge, u32 A, u32 B)
+{
+	u64 TA = Merge->Cursors[A].Time, TB = Merge->Cursors[B].Time;
+
+	return (TA < TB || (TA == TB && A < B)) ? 1U : 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API moves a cursor of the merge heap down to its place.
+*
+* @param	Merge: Trace merge.
+* @param	Pos: Position of the cursor in the heap.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TraceMergeSiftDown(XAie_TraceMerge *Merge, u32 Pos)
+{
+	u32 *Heap = Merge->Heap;
+	u32 Cur = Heap[Pos];
+
+	while(1) {
+		u32 Child = 2U * Pos + 1U;
+
+		if(Child >= Merge->HeapSize) {
+			break;
+		}
+		if(Child + 1U < Merge->HeapSize &&
+				_XAie_TraceMergeLess(Merge, Heap[Child + 1U],
+					Heap[Child]) != 0U) {
+			Child++;
+		}
+		if(_XAie_TraceMergeLess(Merge, Heap[Child], Cur) == 0U) {
+			break;
+		}
+
+		Heap[Pos] = Heap[Child];
+		Pos = Child;
+	}
+
+	Heap[Pos] = Cur;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees the cursors, heap and links of the last merge.
+*
+* @param	Merge: Trace merge.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TraceMergeReset(XAie_TraceMerge *Merge)
+{
+	for(u32 i = 0U; i < Merge->NumInputs; i++) {
+		free(Merge->Inputs[i].Link);
+		Merge->Inputs[i].Link = NULL;
+	}
+
+	free(Merge->Cursors);
+	free(Merge->Heap);
+	Merge->Cursors = NULL;
+	Merge->Heap = NULL;
+	Merge->NumCursors = 0U;
+	Merge->HeapSize = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API links the records of the streams of an input and adds a cursor on
+* the first record of every stream.
+*
+* @param	Merge: Trace merge.
+* @param	Idx: Index of the input.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_TraceMergeLinkInput(XAie_TraceMerge *Merge, u32 Idx)
+{
+	XAie_TraceMergeInput *In = &Merge->Inputs[Idx];
+	const XAie_TraceTable *Table = In->Table;
+	u32 NumStreams = XAie_TraceDecGetNumStreams(In->Dec);
+	u32 NumRecords = (u32)Table->NumRecords;
+	u32 *Head;
+
+	if(NumRecords == 0U || NumStreams == 0U) {
+		return XAIE_OK;
+	}
+
+	Head = (u32 *)malloc(NumStreams * sizeof(*Head));
+	In->Link = (u32 *)malloc(NumRecords * sizeof(*In->Link));
+	if(Head == NULL || In->Link == NULL) {
+		XAIE_ERROR("Memory allocation for trace merge failed\n");
+		free(Head);
+		return XAIE_ERR;
+	}
+
+	for(u32 s = 0U; s < NumStreams; s++) {
+		Head[s] = XAIE_TRACEMERGE_NO_REC;
+	}
+	for(u32 r = NumRecords; r > 0U; r--) {
+		u16 s = Table->Stream[r - 1U];
+
+		if(s >= NumStreams) {
+			In->Link[r - 1U] = XAIE_TRACEMERGE_NO_REC;
+			continue;
+		}
+		In->Link[r - 1U] = Head[s];
+		Head[s] = r - 1U;
+	}
+
+	for(u32 s = 0U; s < NumStreams; s++) {
+		XAie_TraceMergeCursor *C = &Merge->Cursors[Merge->NumCursors];
+		XAie_TraceStreamInfo Info;
+
+		if(Head[s] == XAIE_TRACEMERGE_NO_REC) {
+			continue;
+		}
+
+		(void)XAie_TraceDecGetStream(In->Dec, (u16)s, &Info);
+		C->Rec = Head[s];
+		C->Input = Idx;
+		C->Loc = Info.Loc;
+		C->PktType = Info.PktType;
+		C->Offset = 0U;
+		for(u32 o = 0U; o < Merge->NumOffsets; o++) {
+			if(Merge->Offsets[o].Loc.Col == Info.Loc.Col &&
+					Merge->Offsets[o].Loc.Row ==
+					Info.Loc.Row) {
+				C->Offset = Merge->Offsets[o].Cycles;
+				break;
+			}
+		}
+		C->Slots = _XAie_TraceMergeFindSlots(Merge, Info.Loc,
+				Info.PktType);
+		C->Time = _XAie_TraceMergeAdjust(Table->Time[C->Rec],
+				C->Offset);
+		Merge->Heap[Merge->HeapSize++] = Merge->NumCursors;
+		Merge->NumCursors++;
+	}
+
+	free(Head);
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a trace merge.
+*
+* @param	Fit: Calibration fit of the AIE timer to host time, as returned
+*		by XAie_TimeCalGetFit(), or NULL to keep timer values. It is
+*		copied.
+* @param	ClockMhz: AIE clock frequency used to convert timer values to
+*		time in exports without a fit. 0 for 1000.
+*
+* @return	Pointer to the merge on success, NULL on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+XAie_TraceMerge* XAie_TraceMergeCreate(const XAie_TimeCalFit *Fit,
+		u32 ClockMhz)
+{
+	XAie_TraceMerge *Merge;
+
+	if(Fit != NULL && Fit->NsPerCycle <= 0.0) {
+		XAIE_ERROR("Invalid calibration fit\n");
+		return NULL;
+	}
+
+	Merge = (XAie_TraceMerge *)calloc(1U, sizeof(*Merge));
+	if(Merge == NULL) {
+		XAIE_ERROR("Memory allocation for trace merge failed\n");
+		return NULL;
+	}
+
+	if(Fit != NULL) {
+		Merge->Fit = *Fit;
+		Merge->HasFit = 1U;
+	}
+	Merge->ClockMhz = (ClockMhz == 0U) ? 1000U : ClockMhz;
+
+	return Merge;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds a decoded trace table to a merge. The table and decoder are
+* read by the merge until it is freed and must not be changed meanwhile.
+*
+* @param	Merge: Trace merge.
+* @param	Dec: Decoder of the table, to find the sources of its streams.
+* @param	Table: Decoded trace table.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Tables of 2^32 records or more have to be split.
+*
+******************************************************************************/
+AieRC XAie_TraceMergeAddInput(XAie_TraceMerge *Merge, XAie_TraceDec *Dec,
+		const XAie_TraceTable *Table)
+{
+	AieRC RC;
+
+	if(Merge == NULL || Dec == NULL || Table == NULL ||
+			Table->NumRecords >= XAIE_TRACEMERGE_NO_REC) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_TraceMergeGrow((void **)&Merge->Inputs, &Merge->MaxInputs,
+			Merge->NumInputs, sizeof(*Merge->Inputs));
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Merge->Inputs[Merge->NumInputs].Dec = Dec;
+	Merge->Inputs[Merge->NumInputs].Table = Table;
+	Merge->Inputs[Merge->NumInputs].Link = NULL;
+	Merge->NumInputs++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the offset added to the timer values of the streams of a
+* tile, to align tiles whose timers were not synchronized.
+*
+* @param	Merge: Trace merge.
+* @param	Loc: Location of the tile.
+* @param	Cycles: Offset in cycles, in two's complement for a negative
+*		offset.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		It applies from the next XAie_TraceMergeStart().
+*
+******************************************************************************/
+AieRC XAie_TraceMergeSetOffset(XAie_TraceMerge *Merge, XAie_LocType Loc,
+		u64 Cycles)
+{
+	AieRC RC;
+
+	if(Merge == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < Merge->NumOffsets; i++) {
+		if(Merge->Offsets[i].Loc.Col == Loc.Col &&
+				Merge->Offsets[i].Loc.Row == Loc.Row) {
+			Merge->Offsets[i].Cycles = Cycles;
+			return XAIE_OK;
+		}
+	}
+
+	RC = _XAie_TraceMergeGrow((void **)&Merge->Offsets,
+			&Merge->MaxOffsets, Merge->NumOffsets,
+			sizeof(*Merge->Offsets));
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Merge->Offsets[Merge->NumOffsets].Loc = Loc;
+	Merge->Offsets[Merge->NumOffsets].Cycles = Cycles;
+	Merge->NumOffsets++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the offsets of the tiles of a timer skew table, so the records
+* of the tiles are aligned with the reference tile of the table.
+*
+* @param	Merge: Trace merge.
+* @param	Table: Skew table measured with XAie_TimerSkewCalibrate().
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		It replaces the offsets of the tiles of the table set with
+*		XAie_TraceMergeSetOffset() and applies from the next
+*		XAie_TraceMergeStart().
+*
+******************************************************************************/
+AieRC XAie_TraceMergeSetSkew(XAie_TraceMerge *Merge,
+		const XAie_TimerSkewTable *Table)
+{
+	AieRC RC;
+
+	if((Merge == NULL) || (Table == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < Table->NumSkews; i++) {
+		RC = XAie_TraceMergeSetOffset(Merge, Table->Skews[i].Loc,
+				Table->Skews[i].Comp);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the name and the track of the event traced in a slot of a
+* module of a tile. Events of slots not set are named after their slot and
+* shown on the core track for core modules and the memory track otherwise.
+*
+* @param	Merge: Trace merge.
+* @param	Loc: Location of the tile.
+* @param	PktType: Packet type of the trace of the module, as set with
+*		XAie_TracePktConfig().
+* @param	Slot: Trace slot.
+* @param	Name: Name of the event. It is not copied and has to stay
+*		valid while the merge is used.
+* @param	Track: Track of the event.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		It applies from the next XAie_TraceMergeStart().
+*
+******************************************************************************/
+AieRC XAie_TraceMergeSetSlot(XAie_TraceMerge *Merge, XAie_LocType Loc,
+		u8 PktType, u8 Slot, const char *Name, XAie_TraceTrack Track)
+{
+	XAie_TraceMergeSlots *S;
+	AieRC RC;
+
+	if(Merge == NULL || Slot >= XAIE_TRACEMERGE_NUM_SLOTS ||
+			Track >= XAIE_TRACE_TRACK_MAX) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	S = _XAie_TraceMergeFindSlots(Merge, Loc, PktType);
+	if(S == NULL) {
+		RC = _XAie_TraceMergeGrow((void **)&Merge->Slots,
+				&Merge->MaxSlots, Merge->NumSlots,
+				sizeof(*Merge->Slots));
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		S = &Merge->Slots[Merge->NumSlots++];
+		S->Loc = Loc;
+		S->PktType = PktType;
+		for(u32 i = 0U; i < XAIE_TRACEMERGE_NUM_SLOTS; i++) {
+			S->Names[i] = NULL;
+			S->Tracks[i] = _XAie_TraceMergeDefaultTrack(PktType);
+		}
+	}
+
+	S->Names[Slot] = Name;
+	S->Tracks[Slot] = (u8)Track;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts a merge of the streams of the inputs, or restarts it from
+* the first records.
+*
+* @param	Merge: Trace merge.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_TraceMergeStart(XAie_TraceMerge *Merge)
+{
+	u32 MaxCursors = 0U;
+	AieRC RC;
+
+	if(Merge == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_TraceMergeReset(Merge);
+	for(u32 i = 0U; i < Merge->NumInputs; i++) {
+		MaxCursors += XAie_TraceDecGetNumStreams(Merge->Inputs[i].Dec);
+	}
+	if(MaxCursors == 0U) {
+		return XAIE_OK;
+	}
+
+	Merge->Cursors = (XAie_TraceMergeCursor *)malloc(MaxCursors *
+			sizeof(*Merge->Cursors));
+	Merge->Heap = (u32 *)malloc(MaxCursors * sizeof(*Merge->Heap));
+	if(Merge->Cursors == NULL || Merge->Heap == NULL) {
+		XAIE_ERROR("Memory allocation for trace merge failed\n");
+		_XAie_TraceMergeReset(Merge);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < Merge->NumInputs; i++) {
+		RC = _XAie_TraceMergeLinkInput(Merge, i);
+		if(RC != XAIE_OK) {
+			_XAie_TraceMergeReset(Merge);
+			return RC;
+		}
+	}
+
+	for(u32 i = Merge->HeapSize / 2U; i > 0U; i--) {
+		_XAie_TraceMergeSiftDown(Merge, i - 1U);
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the next record of the merged timeline.
+*
+* @param	Merge: Trace merge, started with XAie_TraceMergeStart().
+* @param	Rec: Pointer to return the record.
+*
+* @return	1 if a record was returned, 0 once all the records were
+*		returned or if an argument is invalid.
+*
+* @note		Records of the same time keep the order of their inputs and
+*		streams.
+*
+******************************************************************************/
+u8 XAie_TraceMergeNext(XAie_TraceMerge *Merge, XAie_TraceMergeRec *Rec)
+{
+	const XAie_TraceTable *Table;
+	XAie_TraceMergeCursor *C;
+	u32 R;
+
+	if(Merge == NULL || Rec == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return 0U;
+	}
+
+	if(Merge->HeapSize == 0U) {
+		return 0U;
+	}
+
+	C = &Merge->Cursors[Merge->Heap[0]];
+	Table = Merge->Inputs[C->Input].Table;
+	R = C->Rec;
+
+	Rec->Time = C->Time;
+	Rec->HostNs = (Merge->HasFit != 0U) ?
+		_XAie_TraceMergeHostNs(Merge, C->Time) : 0U;
+	Rec->Loc = C->Loc;
+	Rec->PktType = C->PktType;
+	Rec->Slot = Table->Slot[R];
+	Rec->Type = Table->Type[R];
+	Rec->Data = Table->Data[R];
+	if(C->Slots != NULL && Rec->Slot < XAIE_TRACEMERGE_NUM_SLOTS) {
+		Rec->Name = C->Slots->Names[Rec->Slot];
+		Rec->Track = C->Slots->Tracks[Rec->Slot];
+	} else {
+		Rec->Name = NULL;
+		Rec->Track = _XAie_TraceMergeDefaultTrack(C->PktType);
+	}
+
+	C->Rec = Merge->Inputs[C->Input].Link[R];
+	if(C->Rec == XAIE_TRACEMERGE_NO_REC) {
+		Merge->Heap[0] = Merge->Heap[--Merge->HeapSize];
+	} else {
+		C->Time = _XAie_TraceMergeAdjust(Table->Time[C->Rec],
+				C->Offset);
+	}
+	if(Merge->HeapSize > 0U) {
+		_XAie_TraceMergeSiftDown(Merge, 0U);
+	}
+
+	return 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API passes the buffered text of a Chrome trace writer to its sink.
+*
+* @param	W: Writer.
+*
+* @return	None.
+*
+* @note		Internal only. Errors are kept in the writer.
+*
+******************************************************************************/
+static void _XAie_TraceMergeFlush(XAie_TraceMergeWriter *W)
+{
+	if(W->RC == XAIE_OK && W->Len > 0U) {
+		W->RC = W->Sink(W->SinkArg, W->Buf, W->Len);
+	}
+	W->Len = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API appends formatted text to a Chrome trace writer.
+*
+* @param	W: Writer.
+* @param	Fmt: Format of the text, of at most
+*		XAIE_TRACEMERGE_JSON_MAX_LINE bytes.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TraceMergePrint(XAie_TraceMergeWriter *W,
+		const char *Fmt, ...)
+{
+	va_list Args;
+	int Len;
+
+	if(XAIE_TRACEMERGE_JSON_BUF_SIZE - W->Len <
+			XAIE_TRACEMERGE_JSON_MAX_LINE) {
+		_XAie_TraceMergeFlush(W);
+	}
+
+	va_start(Args, Fmt);
+	Len = vsnprintf(W->Buf + W->Len, XAIE_TRACEMERGE_JSON_MAX_LINE, Fmt,
+			Args);
+	va_end(Args);
+	if(Len > 0) {
+		W->Len += ((u32)Len < XAIE_TRACEMERGE_JSON_MAX_LINE) ?
+			(u32)Len : XAIE_TRACEMERGE_JSON_MAX_LINE - 1U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the name of an event as a JSON string.
+*
+* @param	Out: Buffer of XAIE_TRACEMERGE_MAX_NAME bytes.
+* @param	Name: Name of the event, NULL for a name after its slot.
+* @param	Slot: Trace slot of the event.
+*
+* @return	None.
+*
+* @note		Internal only. Long names are truncated.
+*
+******************************************************************************/
+static void _XAie_TraceMergeJsonName(char *Out, const char *Name, u8 Slot)
+{
+	u32 Len = 0U;
+
+	if(Name == NULL) {
+		snprintf(Out, XAIE_TRACEMERGE_MAX_NAME, "slot %u", Slot);
+		return;
+	}
+
+	for(; *Name != '\0' && Len + 3U < XAIE_TRACEMERGE_MAX_NAME; Name++) {
+		char Ch = *Name;
+
+		if((u8)Ch < 0x20U) {
+			Ch = ' ';
+		} else if(Ch == '"' || Ch == '\\') {
+			Out[Len++] = '\\';
+		}
+		Out[Len++] = Ch;
+	}
+	Out[Len] = '\0';
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the time of an offset timer value in a Chrome trace.
+*
+* @param	Merge: Trace merge.
+* @param	Time: Offset timer value.
+*
+* @return	Time in microseconds.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static double _XAie_TraceMergeUs(XAie_TraceMerge *Merge, u64 Time)
+{
+	if(Merge->HasFit != 0U) {
+		return (double)_XAie_TraceMergeHostNs(Merge, Time) / 1000.0;
+	}
+
+	return (double)Time / Merge->ClockMhz;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes an event to a Chrome trace, as an instant event or as a
+* slice of consecutive occurrences.
+*
+* @param	Merge: Trace merge.
+* @param	W: Writer.
+* @param	Loc: Location of the tile.
+* @param	Track: Track of the event.
+* @param	Name: Name of the event, NULL for a name after its slot.
+* @param	Slot: Trace slot of the event.
+* @param	Start: Time of the first occurrence.
+* @param	End: Time of the last occurrence of a slice.
+* @param	IsSlice: 1 for a slice, 0 for an instant event.
+* @param	Pc: PC of the event, XAIE_TRACEMERGE_NO_REC if none.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TraceMergeJsonEvent(XAie_TraceMerge *Merge,
+		XAie_TraceMergeWriter *W, XAie_LocType Loc, u8 Track,
+		const char *Name, u8 Slot, u64 Start, u64 End, u8 IsSlice,
+		u32 Pc)
+{
+	char Str[XAIE_TRACEMERGE_MAX_NAME];
+	u32 Pid = (((u32)Loc.Col << 8U) | Loc.Row) + 1U;
+	double Ts = _XAie_TraceMergeUs(Merge, Start);
+
+	_XAie_TraceMergeJsonName(Str, Name, Slot);
+	_XAie_TraceMergePrint(W, "%s\n{\"name\":\"%s\",\"pid\":%u,\"tid\":%u,"
+			"\"ts\":%.3f,", (W->First != 0U) ? "" : ",", Str,
+			Pid, (u32)Track + 1U, Ts);
+	W->First = 0U;
+
+	if(IsSlice == 0U) {
+		if(Pc != XAIE_TRACEMERGE_NO_REC) {
+			_XAie_TraceMergePrint(W, "\"ph\":\"i\",\"s\":\"t\","
+					"\"args\":{\"pc\":\"0x%x\"}}", Pc);
+		} else {
+			_XAie_TraceMergePrint(W, "\"ph\":\"i\",\"s\":\"t\"}");
+		}
+	} else {
+		/* The last occurrence lasts its cycle */
+		double Dur = _XAie_TraceMergeUs(Merge, End + 1U) - Ts;
+
+		_XAie_TraceMergePrint(W, "\"ph\":\"X\",\"dur\":%.3f}", Dur);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the names of the tiles and tracks of the cursors of a merge
+* to a Chrome trace.
+*
+* @param	Merge: Trace merge, just started.
+* @param	W: Writer.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TraceMergeJsonNames(XAie_TraceMerge *Merge,
+		XAie_TraceMergeWriter *W)
+{
+	static const char *TrackNames[XAIE_TRACE_TRACK_MAX] = {
+		"core", "memory", "dma", "locks", "streams", "events",
+	};
+
+	for(u32 i = 0U; i < Merge->NumCursors; i++) {
+		XAie_LocType Loc = Merge->Cursors[i].Loc;
+		u32 Pid = (((u32)Loc.Col << 8U) | Loc.Row) + 1U;
+		u8 Seen = 0U;
+
+		for(u32 j = 0U; j < i; j++) {
+			if(Merge->Cursors[j].Loc.Col == Loc.Col &&
+					Merge->Cursors[j].Loc.Row == Loc.Row) {
+				Seen = 1U;
+				break;
+			}
+		}
+		if(Seen != 0U) {
+			continue;
+		}
+
+		_XAie_TraceMergePrint(W, "%s\n{\"name\":\"process_name\","
+				"\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":"
+				"\"tile (%u,%u)\"}}", (W->First != 0U) ? "" :
+				",", Pid, Loc.Col, Loc.Row);
+		_XAie_TraceMergePrint(W, ",\n{\"name\":\"process_sort_index\","
+				"\"ph\":\"M\",\"pid\":%u,\"args\":"
+				"{\"sort_index\":%u}}", Pid, Pid);
+		W->First = 0U;
+		for(u32 t = 0U; t < XAIE_TRACE_TRACK_MAX; t++) {
+			_XAie_TraceMergePrint(W, ",\n{\"name\":"
+					"\"thread_name\",\"ph\":\"M\",\"pid\":%u,"
+					"\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+					Pid, t + 1U, TrackNames[t]);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the merged timeline as a Chrome trace in JSON, which can be
+* loaded in Perfetto or chrome://tracing. Every tile is a process, with one
+* thread per track. Times are host times in microseconds with a calibration
+* fit, otherwise timer values converted with the clock of the merge.
+*
+* @param	Merge: Trace merge.
+* @param	GapCycles: Occurrences of an event at most GapCycles apart are
+*		written as one slice. 0 to write every occurrence as an instant
+*		event.
+* @param	Sink: Sink of the JSON text, e.g. XAie_TraceOffloadFdSink.
+* @param	SinkArg: Argument of the sink.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The merge is restarted. Events with a PC are written as
+*		instant events with the PC as argument. Raw execution trace
+*		records are left out.
+*
+******************************************************************************/
+AieRC XAie_TraceMergeWriteJson(XAie_TraceMerge *Merge, u32 GapCycles,
+		XAie_TraceSinkFn Sink, void *SinkArg)
+{
+	XAie_TraceMergeSlice *Slices = NULL;
+	XAie_TraceMergeWriter W;
+	AieRC RC;
+
+	if(Merge == NULL || Sink == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = XAie_TraceMergeStart(Merge);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	W.Sink = Sink;
+	W.SinkArg = SinkArg;
+	W.Len = 0U;
+	W.First = 1U;
+	W.RC = XAIE_OK;
+	W.Buf = (char *)malloc(XAIE_TRACEMERGE_JSON_BUF_SIZE);
+	if(Merge->NumCursors > 0U) {
+		Slices = (XAie_TraceMergeSlice *)calloc(Merge->NumCursors *
+				XAIE_TRACEMERGE_NUM_SLOTS, sizeof(*Slices));
+	}
+	if(W.Buf == NULL || (Merge->NumCursors > 0U && Slices == NULL)) {
+		XAIE_ERROR("Memory allocation for trace merge failed\n");
+		free(W.Buf);
+		free(Slices);
+		return XAIE_ERR;
+	}
+
+	_XAie_TraceMergePrint(&W, "{\"displayTimeUnit\":\"ns\","
+			"\"traceEvents\":[");
+	_XAie_TraceMergeJsonNames(Merge, &W);
+
+	while(Merge->HeapSize > 0U && W.RC == XAIE_OK) {
+		u32 Cur = Merge->Heap[0];
+		XAie_TraceMergeSlice *S;
+		XAie_TraceMergeRec Rec;
+
+		(void)XAie_TraceMergeNext(Merge, &Rec);
+		if(Rec.Type == XAIE_TRACE_REC_RAW) {
+			continue;
+		}
+		if(GapCycles == 0U || Rec.Type == XAIE_TRACE_REC_PC ||
+				Rec.Slot >= XAIE_TRACEMERGE_NUM_SLOTS) {
+			_XAie_TraceMergeJsonEvent(Merge, &W, Rec.Loc,
+					Rec.Track, Rec.Name, Rec.Slot,
+					Rec.Time, Rec.Time, 0U,
+					(Rec.Type == XAIE_TRACE_REC_PC) ?
+					Rec.Data : XAIE_TRACEMERGE_NO_REC);
+			continue;
+		}
+
+		S = &Slices[Cur * XAIE_TRACEMERGE_NUM_SLOTS + Rec.Slot];
+		if(S->Open != 0U && Rec.Time - S->End <= GapCycles) {
+			S->End = Rec.Time;
+			continue;
+		}
+		if(S->Open != 0U) {
+			_XAie_TraceMergeJsonEvent(Merge, &W, Rec.Loc,
+					Rec.Track, Rec.Name, Rec.Slot,
+					S->Start, S->End, 1U,
+					XAIE_TRACEMERGE_NO_REC);
+		}
+		S->Start = Rec.Time;
+		S->End = Rec.Time;
+		S->Open = 1U;
+	}
+
+	/* Close the slices left open at the end of the streams */
+	for(u32 c = 0U; c < Merge->NumCursors && Slices != NULL; c++) {
+		XAie_TraceMergeCursor *C = &Merge->Cursors[c];
+
+		for(u8 s = 0U; s < XAIE_TRACEMERGE_NUM_SLOTS; s++) {
+			XAie_TraceMergeSlice *S =
+				&Slices[c * XAIE_TRACEMERGE_NUM_SLOTS + s];
+			const char *Name = NULL;
+			u8 Track = _XAie_TraceMergeDefaultTrack(C->PktType);
+
+			if(S->Open == 0U) {
+				continue;
+			}
+			if(C->Slots != NULL) {
+				Name = C->Slots->Names[s];
+				Track = C->Slots->Tracks[s];
+			}
+			_XAie_TraceMergeJsonEvent(Merge, &W, C->Loc, Track,
+					Name, s, S->Start, S->End, 1U,
+					XAIE_TRACEMERGE_NO_REC);
+		}
+	}
+
+	_XAie_TraceMergePrint(&W, "\n]}\n");
+	_XAie_TraceMergeFlush(&W);
+
+	free(W.Buf);
+	free(Slices);
+
+	return W.RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees a trace merge. The inputs are not freed.
+*
+* @param	Merge: Trace merge.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAie_TraceMergeFree(XAie_TraceMerge *Merge)
+{
+	if(Merge == NULL) {
+		return;
+	}
+
+	_XAie_TraceMergeReset(Merge);
+	free(Merge->Inputs);
+	free(Merge->Slots);
+	free(Merge->Offsets);
+	free(Merge);
+}
+
+#endif /* XAIE_FEATURE_TRACE_ENABLE */
+/** @} */
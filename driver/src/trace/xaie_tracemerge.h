@@ -0,0 +1,74 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_tracemerge.h
+* @{
+*
+* Header file for the merge of decoded AIE trace streams into one timeline.
+*
+******************************************************************************/
+#ifndef XAIETRACEMERGE_H
+#define XAIETRACEMERGE_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+#include "xaie_timecal.h"
+#include "xaie_tracedec.h"
+#include "xaie_traceoffload.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * Merge of the streams of decoded trace tables into one timeline sorted by
+ * time. It reads the tables of the caller and keeps one cursor per stream.
+ */
+typedef struct XAie_TraceMerge XAie_TraceMerge;
+
+/* This enum captures the tracks events are shown on in exported timelines */
+typedef enum {
+	XAIE_TRACE_TRACK_CORE,
+	XAIE_TRACE_TRACK_MEM,
+	XAIE_TRACE_TRACK_DMA,
+	XAIE_TRACE_TRACK_LOCK,
+	XAIE_TRACE_TRACK_STREAM,
+	XAIE_TRACE_TRACK_OTHER,
+	XAIE_TRACE_TRACK_MAX,
+} XAie_TraceTrack;
+
+/* Record of a merged timeline */
+typedef struct {
+	u64 Time;		/* Timer value, with the offset of the tile */
+	u64 HostNs;		/* Host time, 0 without a calibration fit */
+	XAie_LocType Loc;	/* Tile of the stream */
+	u8 PktType;		/* Packet type of the stream, i.e. its module */
+	u8 Slot;		/* Trace slot of the event */
+	u8 Type;		/* Record type, XAie_TraceRecType */
+	u8 Track;		/* Track of the event, XAie_TraceTrack */
+	u32 Data;		/* PC or raw trace word */
+	const char *Name;	/* Name of the event, NULL if not set */
+} XAie_TraceMergeRec;
+
+/************************** Function Prototypes  *****************************/
+XAie_TraceMerge* XAie_TraceMergeCreate(const XAie_TimeCalFit *Fit,
+		u32 ClockMhz);
+AieRC XAie_TraceMergeAddInput(XAie_TraceMerge *Merge, XAie_TraceDec *Dec,
+		const XAie_TraceTable *Table);
+AieRC XAie_TraceMergeSetOffset(XAie_TraceMerge *Merge, XAie_LocType Loc,
+		u64 Cycles);
+AieRC XAie_TraceMergeSetSkew(XAie_TraceMerge *Merge,
+		const XAie_TimerSkewTable *Table);
+AieRC XAie_TraceMergeSetSlot(XAie_TraceMerge *Merge, XAie_LocType Loc,
+		u8 PktType, u8 Slot, const char *Name, XAie_TraceTrack Track);
+AieRC XAie_TraceMergeStart(XAie_TraceMerge *Merge);
+u8 XAie_TraceMergeNext(XAie_TraceMerge *Merge, XAie_TraceMergeRec *Rec);
+AieRC XAie_TraceMergeWriteJson(XAie_TraceMerge *Merge, u32 GapCycles,
+		XAie_TraceSinkFn Sink, void *SinkArg);
+void XAie_TraceMergeFree(XAie_TraceMerge *Merge);
+
+#endif		/* end of protection macro */
+/** @} */
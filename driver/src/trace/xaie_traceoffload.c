@@ -0,0 +1,693 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_traceoffload.c
+* @{
+*
+* This file contains routines to offload trace streams to the host while the
+* trace is running. The trace is routed to a shim S2MM channel which writes a
+* ring of host buffers, one BD per buffer. The BDs are queued to the channel
+* up to its task queue depth, so the channel moves on to the next buffer as
+* soon as one is full. A host thread polls the channel, passes the full
+* buffers to a sink and queues them again. If the host falls behind, the
+* channel runs out of buffers and back-pressures the trace stream; this is
+* counted so that the ring can be sized for the trace bandwidth.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifndef __AIEBAREMETAL__
+#define  _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#ifndef __AIEBAREMETAL__
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include "xaie_feature_config.h"
+#include "xaie_dma.h"
+#include "xaie_helper.h"
+#include "xaie_plif.h"
+#include "xaie_traceoffload.h"
+
+#if defined(XAIE_FEATURE_TRACE_ENABLE) && defined(XAIE_FEATURE_DMA_ENABLE) && \
+	defined(XAIE_FEATURE_SS_ENABLE) && defined(XAIE_FEATURE_PL_ENABLE)
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TRACEOFFLOAD_MIN_BUFS		2U
+#define XAIE_TRACEOFFLOAD_SHIM_PORT_OFFSET	2U
+
+/**************************** Type Definitions *******************************/
+struct XAie_TraceOffload {
+	XAie_DevInst *DevInst;
+	XAie_TraceOffloadCfg Cfg;
+	XAie_MemInst **Bufs;
+	XAie_StrmRoute Route;
+	u32 Head;		/* Oldest buffer queued to the channel */
+	u32 NumQueued;		/* Buffers queued to the channel */
+	u32 MaxQueued;		/* Most buffers the channel can queue */
+	u8 Started;
+	XAie_TraceOffloadStats Stats;
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_t Lock;
+	pthread_t Thread;
+	u32 PeriodUs;
+	u8 Running;
+	u8 Stop;
+	AieRC Status;	/* Error which stopped the offload thread */
+#endif
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API takes the lock protecting the state of a trace offload.
+*
+* @param	Off: Trace offload.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TraceOffloadLock(XAie_TraceOffload *Off)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_lock(&Off->Lock);
+#else
+	(void)Off;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the lock protecting the state of a trace offload.
+*
+* @param	Off: Trace offload.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_TraceOffloadUnlock(XAie_TraceOffload *Off)
+{
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_unlock(&Off->Lock);
+#else
+	(void)Off;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API queues the free buffers of the ring to the channel, as far as its
+* task queue allows. Buffers are cleared first, so the end of the trace in a
+* partially written buffer can be found.
+*
+* @param	Off: Trace offload.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. The caller holds the lock of the offload.
+*
+******************************************************************************/
+static AieRC _XAie_TraceOffloadQueue(XAie_TraceOffload *Off)
+{
+	AieRC RC;
+
+	while(Off->NumQueued < Off->MaxQueued) {
+		u32 Idx = (Off->Head + Off->NumQueued) % Off->Cfg.NumBufs;
+		XAie_MemInst *Buf = Off->Bufs[Idx];
+
+		memset(XAie_MemGetVAddr(Buf), 0, Buf->Size);
+		RC = XAie_MemSyncForDev(Buf);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RC = XAie_DmaChannelPushBdToQueue(Off->DevInst,
+				Off->Cfg.ShimLoc, Off->Cfg.ChNum, DMA_S2MM,
+				(u8)(Off->Cfg.StartBd + Idx));
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to queue trace buffer\n");
+			return RC;
+		}
+
+		Off->NumQueued++;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API passes the trace of a buffer to the sink.
+*
+* @param	Off: Trace offload.
+* @param	Buf: Buffer to drain.
+* @param	Partial: XAIE_ENABLE if the buffer may be partially written. The
+*		zero words at its end are then left out.
+*
+* @return	None.
+*
+* @note		Internal only. The caller holds the lock of the offload. A sink
+*		error is counted, the trace keeps going.
+*
+******************************************************************************/
+static void _XAie_TraceOffloadDrain(XAie_TraceOffload *Off,
+		XAie_MemInst *Buf, u8 Partial)
+{
+	const u32 *Words;
+	u64 Size;
+
+	if(XAie_MemSyncForCPU(Buf) != XAIE_OK) {
+		Off->Stats.SinkErrors++;
+		return;
+	}
+
+	Words = (const u32 *)XAie_MemGetVAddr(Buf);
+	Size = Buf->Size;
+	if(Partial == XAIE_ENABLE) {
+		while(Size >= sizeof(u32) &&
+				Words[Size / sizeof(u32) - 1U] == 0U) {
+			Size -= sizeof(u32);
+		}
+		if(Size == 0U) {
+			return;
+		}
+	}
+
+	if(Off->Cfg.Sink(Off->Cfg.SinkArg, Words, Size) != XAIE_OK) {
+		Off->Stats.SinkErrors++;
+		return;
+	}
+
+	Off->Stats.Bytes += Size;
+	Off->Stats.NumBufs++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a trace offload. The BDs of the buffer ring are written to
+* the shim tile and the route is compiled, nothing is started.
+*
+* @param	DevInst: Device Instance.
+* @param	Cfg: Offload configuration. The buffers must be allocated with
+*		XAie_MemAllocate() and have a size multiple of 4 bytes.
+*
+* @return	Pointer to the offload on success, NULL on failure.
+*
+* @note		The trace modules have to send their packets to the route of
+*		the offload, see XAie_TracePktConfig().
+*
+******************************************************************************/
+XAie_TraceOffload* XAie_TraceOffloadCreate(XAie_DevInst *DevInst,
+		const XAie_TraceOffloadCfg *Cfg)
+{
+	XAie_TraceOffload *Off;
+	XAie_DmaDesc Desc;
+	u8 QueueSize;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return NULL;
+	}
+
+	if((Cfg == NULL) || (Cfg->Bufs == NULL) || (Cfg->Sink == NULL) ||
+			(Cfg->NumBufs < XAIE_TRACEOFFLOAD_MIN_BUFS) ||
+			(Cfg->NumFlows > 0U && Cfg->Flows == NULL)) {
+		XAIE_ERROR("Invalid trace offload configuration\n");
+		return NULL;
+	}
+
+	if(_XAie_GetTileTypefromLoc(DevInst, Cfg->ShimLoc) !=
+			XAIEGBL_TILE_TYPE_SHIMNOC) {
+		XAIE_ERROR("Invalid tile type, trace offload needs a shim NoC tile\n");
+		return NULL;
+	}
+
+	if(Cfg->StartBd + Cfg->NumBufs >
+			DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_SHIMNOC].DmaMod->NumBds) {
+		XAIE_ERROR("Invalid BD range for trace buffers\n");
+		return NULL;
+	}
+
+	for(u32 i = 0U; i < Cfg->NumBufs; i++) {
+		if((Cfg->Bufs[i] == NULL) || (Cfg->Bufs[i]->Size == 0U) ||
+				(Cfg->Bufs[i]->Size > 0xFFFFFFFFU) ||
+				(Cfg->Bufs[i]->Size % sizeof(u32) != 0U)) {
+			XAIE_ERROR("Invalid trace buffer %u\n", i);
+			return NULL;
+		}
+	}
+
+	RC = XAie_DmaGetMaxQueueSize(DevInst, Cfg->ShimLoc, &QueueSize);
+	if(RC != XAIE_OK) {
+		return NULL;
+	}
+
+	Off = (XAie_TraceOffload *)calloc(1U, sizeof(*Off));
+	if(Off == NULL) {
+		XAIE_ERROR("Memory allocation for trace offload failed\n");
+		return NULL;
+	}
+
+	Off->Bufs = (XAie_MemInst **)malloc(Cfg->NumBufs * sizeof(*Off->Bufs));
+	if(Off->Bufs == NULL) {
+		XAIE_ERROR("Memory allocation for trace offload failed\n");
+		free(Off);
+		return NULL;
+	}
+	memcpy(Off->Bufs, Cfg->Bufs, Cfg->NumBufs * sizeof(*Off->Bufs));
+
+	Off->DevInst = DevInst;
+	Off->Cfg = *Cfg;
+	Off->Cfg.Bufs = Off->Bufs;
+	Off->Cfg.Flows = NULL;
+	Off->MaxQueued = (QueueSize < Cfg->NumBufs) ? QueueSize : Cfg->NumBufs;
+
+	if(Cfg->NumFlows > 0U) {
+		RC = XAie_StrmRouteCompile(DevInst, &Off->Route, Cfg->Flows,
+				Cfg->NumFlows);
+		if(RC != XAIE_OK) {
+			goto err;
+		}
+	}
+
+	for(u32 i = 0U; i < Cfg->NumBufs; i++) {
+		RC = XAie_DmaDescInit(DevInst, &Desc, Cfg->ShimLoc);
+		RC |= XAie_DmaSetAddrOffsetLen(&Desc, Cfg->Bufs[i], 0U,
+				(u32)Cfg->Bufs[i]->Size);
+		RC |= XAie_DmaEnableBd(&Desc);
+		RC |= XAie_DmaWriteBd(DevInst, &Desc, Cfg->ShimLoc,
+				(u8)(Cfg->StartBd + i));
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to write trace buffer BD\n");
+			RC = XAIE_ERR;
+			goto err;
+		}
+	}
+
+#ifndef __AIEBAREMETAL__
+	if(pthread_mutex_init(&Off->Lock, NULL) != 0) {
+		XAIE_ERROR("Unable to create trace offload lock\n");
+		goto err;
+	}
+#endif
+
+	return Off;
+
+err:
+	if(Off->Route.IsReady == XAIE_COMPONENT_IS_READY) {
+		XAie_StrmRouteFree(&Off->Route);
+	}
+	free(Off->Bufs);
+	free(Off);
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API drains the full buffers of a trace offload into its sink and
+* queues them to the channel again.
+*
+* @param	Off: Trace offload.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Called periodically by the offload thread. Without the thread,
+*		such as for baremetal, it has to be called often enough for
+*		the trace bandwidth.
+*
+******************************************************************************/
+AieRC XAie_TraceOffloadPoll(XAie_TraceOffload *Off)
+{
+	AieRC RC;
+	u8 Pending;
+	u32 Done;
+
+	if(Off == NULL) {
+		XAIE_ERROR("Invalid trace offload\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_TraceOffloadLock(Off);
+	if(Off->Started == 0U) {
+		_XAie_TraceOffloadUnlock(Off);
+		return XAIE_OK;
+	}
+
+	RC = XAie_DmaGetPendingBdCount(Off->DevInst, Off->Cfg.ShimLoc,
+			Off->Cfg.ChNum, DMA_S2MM, &Pending);
+	if(RC != XAIE_OK) {
+		_XAie_TraceOffloadUnlock(Off);
+		return RC;
+	}
+
+	Done = (Pending < Off->NumQueued) ? Off->NumQueued - Pending : 0U;
+	if(Pending == 0U) {
+		Off->Stats.Stalls++;
+	}
+	if(Done > Off->Stats.MaxDone) {
+		Off->Stats.MaxDone = Done;
+	}
+
+	for(u32 i = 0U; i < Done; i++) {
+		_XAie_TraceOffloadDrain(Off, Off->Bufs[Off->Head],
+				XAIE_DISABLE);
+		Off->Head = (Off->Head + 1U) % Off->Cfg.NumBufs;
+		Off->NumQueued--;
+	}
+
+	RC = _XAie_TraceOffloadQueue(Off);
+	_XAie_TraceOffloadUnlock(Off);
+
+	return RC;
+}
+
+#ifndef __AIEBAREMETAL__
+/*****************************************************************************/
+/**
+*
+* This is the body of the thread of a trace offload. It polls the channel
+* once per period until it is asked to stop or a poll fails.
+*
+* @param	Arg: Trace offload.
+*
+* @return	NULL.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void *_XAie_TraceOffloadWorker(void *Arg)
+{
+	XAie_TraceOffload *Off = (XAie_TraceOffload *)Arg;
+	struct timespec Period;
+
+	Period.tv_sec = Off->PeriodUs / 1000000U;
+	Period.tv_nsec = (long)(Off->PeriodUs % 1000000U) * 1000L;
+
+	while(1) {
+		AieRC RC;
+		u8 Stop;
+
+		pthread_mutex_lock(&Off->Lock);
+		Stop = Off->Stop;
+		pthread_mutex_unlock(&Off->Lock);
+		if(Stop != 0U) {
+			break;
+		}
+
+		RC = XAie_TraceOffloadPoll(Off);
+		if(RC != XAIE_OK) {
+			pthread_mutex_lock(&Off->Lock);
+			Off->Status = RC;
+			pthread_mutex_unlock(&Off->Lock);
+			break;
+		}
+
+		nanosleep(&Period, NULL);
+	}
+
+	return NULL;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This API starts a trace offload. It applies the route, connects the shim
+* stream port to the channel, queues the buffers, enables the channel and
+* starts the offload thread.
+*
+* @param	Off: Trace offload.
+* @param	PeriodUs: Period between two polls of the channel in
+*		microseconds. It has to be shorter than the time the trace
+*		takes to fill the queued buffers.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		For baremetal no thread is started, XAie_TraceOffloadPoll()
+*		has to be called instead. Start the trace after the offload.
+*
+******************************************************************************/
+AieRC XAie_TraceOffloadStart(XAie_TraceOffload *Off, u32 PeriodUs)
+{
+	AieRC RC;
+
+	if(Off == NULL) {
+		XAIE_ERROR("Invalid trace offload\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Off->Started != 0U) {
+		XAIE_ERROR("Trace offload is already started\n");
+		return XAIE_ERR;
+	}
+
+	if(Off->Route.IsReady == XAIE_COMPONENT_IS_READY) {
+		RC = XAie_StrmRouteApply(Off->DevInst, &Off->Route);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	RC = XAie_EnableAieToShimDmaStrmPort(Off->DevInst, Off->Cfg.ShimLoc,
+			Off->Cfg.ChNum + XAIE_TRACEOFFLOAD_SHIM_PORT_OFFSET);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to connect shim stream port to S2MM channel\n");
+		return RC;
+	}
+
+	Off->Head = 0U;
+	Off->NumQueued = 0U;
+	memset(&Off->Stats, 0, sizeof(Off->Stats));
+	RC = _XAie_TraceOffloadQueue(Off);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = XAie_DmaChannelEnable(Off->DevInst, Off->Cfg.ShimLoc,
+			Off->Cfg.ChNum, DMA_S2MM);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+	Off->Started = 1U;
+
+#ifndef __AIEBAREMETAL__
+	Off->PeriodUs = PeriodUs;
+	Off->Stop = 0U;
+	Off->Status = XAIE_OK;
+	if(pthread_create(&Off->Thread, NULL, _XAie_TraceOffloadWorker,
+				Off) != 0) {
+		XAIE_ERROR("Unable to create trace offload thread\n");
+		(void)XAie_TraceOffloadStop(Off);
+		return XAIE_ERR;
+	}
+	Off->Running = 1U;
+#else
+	(void)PeriodUs;
+#endif
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stops a trace offload. The offload thread is stopped, the channel
+* is disabled and the trace left in the buffers, including the partially
+* written one, is passed to the sink. The route is then cleared.
+*
+* @param	Off: Trace offload.
+*
+* @return	XAIE_OK on success, the error which stopped the offload thread
+*		or error code on failure.
+*
+* @note		Stop the trace first, so no trace is lost in the stream switch.
+*		The end of a partially written buffer is found from the zero
+*		words left by the clearing of the buffer.
+*
+******************************************************************************/
+AieRC XAie_TraceOffloadStop(XAie_TraceOffload *Off)
+{
+	AieRC RC = XAIE_OK;
+
+	if(Off == NULL) {
+		XAIE_ERROR("Invalid trace offload\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+#ifndef __AIEBAREMETAL__
+	if(Off->Running != 0U) {
+		pthread_mutex_lock(&Off->Lock);
+		Off->Stop = 1U;
+		pthread_mutex_unlock(&Off->Lock);
+		pthread_join(Off->Thread, NULL);
+		Off->Running = 0U;
+		RC = Off->Status;
+	}
+#endif
+
+	if(Off->Started == 0U) {
+		return RC;
+	}
+
+	if(XAie_TraceOffloadPoll(Off) != XAIE_OK) {
+		RC = XAIE_ERR;
+	}
+
+	_XAie_TraceOffloadLock(Off);
+	if(XAie_DmaChannelDisable(Off->DevInst, Off->Cfg.ShimLoc,
+				Off->Cfg.ChNum, DMA_S2MM) != XAIE_OK) {
+		RC = XAIE_ERR;
+	}
+
+	while(Off->NumQueued > 0U) {
+		_XAie_TraceOffloadDrain(Off, Off->Bufs[Off->Head],
+				XAIE_ENABLE);
+		Off->Head = (Off->Head + 1U) % Off->Cfg.NumBufs;
+		Off->NumQueued--;
+	}
+
+	if(Off->Route.IsReady == XAIE_COMPONENT_IS_READY &&
+			XAie_StrmRouteClear(Off->DevInst, &Off->Route) != XAIE_OK) {
+		RC = XAIE_ERR;
+	}
+	Off->Started = 0U;
+	_XAie_TraceOffloadUnlock(Off);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the accounting of a trace offload since it was started.
+*
+* @param	Off: Trace offload.
+* @param	Stats: Pointer to return the accounting.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Stalls mean the channel had no buffer to write while the
+*		trace kept running, so trace packets were back-pressured and
+*		the trace modules may have overrun. Use more buffers or a
+*		shorter poll period.
+*
+******************************************************************************/
+AieRC XAie_TraceOffloadGetStats(XAie_TraceOffload *Off,
+		XAie_TraceOffloadStats *Stats)
+{
+	if((Off == NULL) || (Stats == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_TraceOffloadLock(Off);
+	*Stats = Off->Stats;
+	_XAie_TraceOffloadUnlock(Off);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases a trace offload. It is stopped first if it is running.
+*
+* @param	Off: Trace offload.
+*
+* @return	None.
+*
+* @note		The buffers are owned by the caller and left allocated.
+*
+******************************************************************************/
+void XAie_TraceOffloadFree(XAie_TraceOffload *Off)
+{
+	if(Off == NULL) {
+		return;
+	}
+
+	(void)XAie_TraceOffloadStop(Off);
+
+#ifndef __AIEBAREMETAL__
+	pthread_mutex_destroy(&Off->Lock);
+#endif
+	if(Off->Route.IsReady == XAIE_COMPONENT_IS_READY) {
+		XAie_StrmRouteFree(&Off->Route);
+	}
+	free(Off->Bufs);
+	free(Off);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API is a trace sink writing to a file descriptor, such as a file, a
+* pipe or a socket.
+*
+* @param	Arg: Pointer to the file descriptor, an int.
+* @param	Data: Trace to write.
+* @param	Size: Size of the trace in bytes.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Not supported for baremetal.
+*
+******************************************************************************/
+AieRC XAie_TraceOffloadFdSink(void *Arg, const void *Data, u64 Size)
+{
+#ifndef __AIEBAREMETAL__
+	const u8 *Ptr = (const u8 *)Data;
+	int Fd;
+
+	if((Arg == NULL) || (Data == NULL && Size > 0U)) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	Fd = *(int *)Arg;
+	while(Size > 0U) {
+		ssize_t Ret = write(Fd, Ptr, Size);
+
+		if(Ret < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			XAIE_ERROR("Unable to write trace to sink\n");
+			return XAIE_ERR;
+		}
+
+		Ptr += Ret;
+		Size -= (u64)Ret;
+	}
+
+	return XAIE_OK;
+#else
+	(void)Arg;
+	(void)Data;
+	(void)Size;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+}
+
+#endif /* XAIE_FEATURE_TRACE_ENABLE && XAIE_FEATURE_DMA_ENABLE ... */
+/** @} */
@@ -0,0 +1,72 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_traceoffload.h
+* @{
+*
+* Header file for the offload of trace streams through a shim DMA channel.
+*
+******************************************************************************/
+#ifndef XAIETRACEOFFLOAD_H
+#define XAIETRACEOFFLOAD_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+#include "xaie_ss.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * Offload of trace streams, written by a shim S2MM channel to a ring of host
+ * buffers which a host thread drains into a sink.
+ */
+typedef struct XAie_TraceOffload XAie_TraceOffload;
+
+/*
+ * Sink of the offloaded trace. It is called with the trace words of each
+ * drained buffer, in order, and returns XAIE_OK on success.
+ */
+typedef AieRC (*XAie_TraceSinkFn)(void *Arg, const void *Data, u64 Size);
+
+/* Configuration of a trace offload */
+typedef struct {
+	XAie_LocType ShimLoc;	/* Shim tile of the S2MM channel */
+	u8 ChNum;		/* S2MM channel, fed by south port ChNum + 2 */
+	u8 StartBd;		/* First of NumBufs consecutive BDs */
+	XAie_MemInst **Bufs;	/* Ring of at least 2 buffers */
+	u32 NumBufs;
+	const XAie_StrmFlow *Flows;	/* Route from the trace ports to the
+					 * channel, NULL if already routed */
+	u32 NumFlows;
+	XAie_TraceSinkFn Sink;
+	void *SinkArg;
+} XAie_TraceOffloadCfg;
+
+/* Accounting of a trace offload */
+typedef struct {
+	u64 Bytes;		/* Bytes passed to the sink */
+	u64 NumBufs;		/* Buffers drained */
+	u64 Stalls;		/* Polls which found no buffer left queued to
+				 * the channel, so the trace was stalled */
+	u64 SinkErrors;		/* Buffers the sink failed to take */
+	u32 MaxDone;		/* Most buffers found full in one poll */
+} XAie_TraceOffloadStats;
+
+/************************** Function Prototypes  *****************************/
+XAie_TraceOffload* XAie_TraceOffloadCreate(XAie_DevInst *DevInst,
+		const XAie_TraceOffloadCfg *Cfg);
+AieRC XAie_TraceOffloadStart(XAie_TraceOffload *Off, u32 PeriodUs);
+AieRC XAie_TraceOffloadPoll(XAie_TraceOffload *Off);
+AieRC XAie_TraceOffloadStop(XAie_TraceOffload *Off);
+AieRC XAie_TraceOffloadGetStats(XAie_TraceOffload *Off,
+		XAie_TraceOffloadStats *Stats);
+void XAie_TraceOffloadFree(XAie_TraceOffload *Off);
+AieRC XAie_TraceOffloadFdSink(void *Arg, const void *Data, u64 Size);
+
+#endif		/* end of protection macro */
+/** @} */
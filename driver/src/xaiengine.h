@@ -8,21 +8,50 @@
 extern "C" {
 #endif
 
+#include <xaiengine/xaie_cfgsnap.h>
 #include <xaiengine/xaie_clock.h>
 #include <xaiengine/xaie_core.h>
 #include <xaiengine/xaie_dma.h>
+#include <xaiengine/xaie_dma_copy.h>
+#include <xaiengine/xaie_dma_datamem.h>
+#include <xaiengine/xaie_dma_load.h>
+#include <xaiengine/xaie_dma_lower.h>
+#include <xaiengine/xaie_dma_memtile.h>
+#include <xaiengine/xaie_dma_profile.h>
+#include <xaiengine/xaie_dma_sched.h>
+#include <xaiengine/xaie_dma_shadow.h>
+#include <xaiengine/xaie_dma_stream.h>
 #include <xaiengine/xaie_elfloader.h>
 #include <xaiengine/xaie_events.h>
+#include <xaiengine/xaie_graphload.h>
+#include <xaiengine/xaie_health.h>
 #include <xaiengine/xaie_interrupt.h>
+#include <xaiengine/xaie_iorecord.h>
+#include <xaiengine/xaie_iostats.h>
 #include <xaiengine/xaie_locks.h>
+#include <xaiengine/xaie_log.h>
 #include <xaiengine/xaie_mem.h>
+#include <xaiengine/xaie_memckpt.h>
+#include <xaiengine/xaie_mempool.h>
+#include <xaiengine/xaie_partgroup.h>
+#include <xaiengine/xaie_pcprofile.h>
 #include <xaiengine/xaie_perfcnt.h>
+#include <xaiengine/xaie_perfcnt64.h>
 #include <xaiengine/xaie_plif.h>
 #include <xaiengine/xaie_reset.h>
 #include <xaiengine/xaie_rsc.h>
+#include <xaiengine/xaie_rtp.h>
+#include <xaiengine/xaie_shadow.h>
 #include <xaiengine/xaie_ss.h>
+#include <xaiengine/xaie_timecal.h>
 #include <xaiengine/xaie_timer.h>
 #include <xaiengine/xaie_trace.h>
+#include <xaiengine/xaie_tracecmp.h>
+#include <xaiengine/xaie_tracedec.h>
+#include <xaiengine/xaie_tracemerge.h>
+#include <xaiengine/xaie_traceoffload.h>
+#include <xaiengine/xaie_txn.h>
+#include <xaiengine/xaie_txnmemo.h>
 #include <xaiengine/xaie_lite.h>
 #include <xaiengine/xaiegbl.h>
 #include <xaiengine/xaiegbl_defs.h>
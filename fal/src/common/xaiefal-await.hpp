@@ -0,0 +1,602 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-common.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+#include <sys/eventfd.h>
+#include <thread>
+#include <unistd.h>
+#endif
+
+#ifdef __cpp_impl_coroutine
+#include <coroutine>
+#endif
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @class XAieReactor
+	 * @brief Completes waits on DMA channels, locks, cores and events of
+	 * a partition from a thread of its own.
+	 * Each wait arms its event on an event waiter of the driver, which
+	 * routes the event to the interrupt of the partition, and the
+	 * reactor thread sleeps on the interrupt. After each interrupt the
+	 * conditions of all the waits in flight are read back and the waits
+	 * met are completed, so one thread serves any number of waits.
+	 * A module broadcasts one armed event at a time: a wait whose event
+	 * cannot be armed, as its module broadcasts another event of a wait
+	 * in flight, is checked after each interrupt and at least once per
+	 * poll period.
+	 * Completions run on the reactor thread, or are handed to the
+	 * dispatcher set with setDispatcher(), such as the executor of a
+	 * coroutine runtime. With C++20 coroutines, the waits are also
+	 * available as awaitables, e.g. co_await Reactor.dmaDone(...).
+	 * The driver is called from the reactor thread while waits are in
+	 * flight, the application has to serialize its own accesses to the
+	 * device instance with them if the backend requires it.
+	 */
+	class XAieReactor {
+	public:
+		/**
+		 * Completion of a wait. It gets XAIE_OK once the condition
+		 * is met, XAIE_ERR on timeout or when the reactor stops, or
+		 * the error code of the driver.
+		 */
+		typedef std::function<void(AieRC)> Completion;
+		/**
+		 * Dispatcher running the completions, e.g. by posting them to
+		 * an executor.
+		 */
+		typedef std::function<void(std::function<void()>)> Dispatcher;
+
+		XAieReactor() = delete;
+		/**
+		 * This function constructs a reactor.
+		 *
+		 * @param DevHd AI engine device handle
+		 * @param IrqFd file descriptor readable on an AIE interrupt,
+		 *	  such as a UIO device, owned by the caller
+		 * @param IrqIsUio true if IrqFd is a UIO device
+		 * @param PollUs poll period in microseconds of the waits
+		 *	  which cannot be armed; it also bounds the time to
+		 *	  detect a lost interrupt
+		 */
+		XAieReactor(const std::shared_ptr<XAieDevHandle> &DevHd,
+			int IrqFd, bool IrqIsUio = false,
+			uint32_t PollUs = 1000): AieHd(DevHd), SrcFd(IrqFd),
+			SrcIsUio(IrqIsUio), PollPeriodUs(PollUs),
+			Running(false), NumPending(0), Waiter(nullptr),
+			WakeFd(-1) {}
+		XAieReactor(XAieDev &Dev, int IrqFd, bool IrqIsUio = false,
+			uint32_t PollUs = 1000):
+			XAieReactor(Dev.getDevHandle(), IrqFd, IrqIsUio,
+				PollUs) {}
+		XAieReactor(const XAieReactor &) = delete;
+		XAieReactor &operator=(const XAieReactor &) = delete;
+		~XAieReactor() {
+			stop();
+		}
+		/**
+		 * This function sets the dispatcher of the completions. It
+		 * has to be set before the reactor is started.
+		 *
+		 * @param D dispatcher, empty to run the completions on the
+		 *	  reactor thread
+		 */
+		void setDispatcher(Dispatcher D) {
+			Dispatch = D;
+		}
+		/**
+		 * This function creates the event waiter and starts the
+		 * reactor thread. The interrupts of the partition have to be
+		 * set up with XAie_ErrorHandlingInit().
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC start() {
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+			XAie_EventWaiterCfg Cfg;
+
+			if (Running) {
+				XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+					" already started." << '\n';
+				return XAIE_ERR;
+			}
+			Cfg.SrcFd = SrcFd;
+			Cfg.SrcIsUio = SrcIsUio ? 1 : 0;
+			Waiter = XAie_EventWaiterCreate(AieHd->dev(), &Cfg);
+			if (Waiter == nullptr) {
+				XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+					" failed to create event waiter." << '\n';
+				return XAIE_ERR;
+			}
+			WakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+			if (WakeFd < 0) {
+				XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+					" failed to create eventfd." << '\n';
+				XAie_EventWaiterFree(Waiter);
+				Waiter = nullptr;
+				return XAIE_ERR;
+			}
+			Running = true;
+			Thread = std::thread(&XAieReactor::_run, this);
+			return XAIE_OK;
+#else
+			XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+				" threads not supported." << '\n';
+			return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+		}
+		/**
+		 * This function stops the reactor thread. The waits still in
+		 * flight complete with XAIE_ERR.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC stop() {
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+			if (!Running) {
+				return XAIE_OK;
+			}
+			Running = false;
+			_wake();
+			Thread.join();
+			for (auto &W: vWaits) {
+				_complete(W, XAIE_ERR);
+			}
+			vWaits.clear();
+			{
+				_XAIEFAL_MUTEX_ACQUIRE(mLock);
+				for (auto &W: vIncoming) {
+					_complete(W, XAIE_ERR);
+				}
+				vIncoming.clear();
+			}
+			NumPending = 0;
+			XAie_EventWaiterFree(Waiter);
+			Waiter = nullptr;
+			close(WakeFd);
+			WakeFd = -1;
+#endif
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the number of waits in flight.
+		 *
+		 * @return number of waits in flight
+		 */
+		size_t pending() const {
+			return NumPending.load(std::memory_order_relaxed);
+		}
+		/**
+		 * This function waits for a DMA channel of an AIE tile or a
+		 * shim NoC tile to have no BD pending.
+		 *
+		 * @param Loc tile location
+		 * @param ChNum channel number, 0 or 1
+		 * @param Dir channel direction
+		 * @param TimeoutUs timeout in microseconds, 0 for none
+		 * @param Done completion of the wait
+		 * @return XAIE_OK if the wait is in flight, error code for
+		 *	   failure, in which case Done is not called
+		 */
+		AieRC waitDmaDone(XAie_LocType Loc, uint8_t ChNum,
+				XAie_DmaDirection Dir, uint32_t TimeoutUs,
+				Completion Done) {
+			XAie_ModuleType Mod;
+			XAie_Events Event;
+			uint8_t TType;
+			/* finished BD events are S2MM 0, S2MM 1, MM2S 0, MM2S 1 */
+			uint32_t Off = ((Dir == DMA_MM2S) ? 2 : 0) + ChNum;
+
+			if (ChNum > 1 || Dir >= DMA_MAX) {
+				XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+					" invalid DMA channel." << '\n';
+				return XAIE_INVALID_CHANNEL_NUM;
+			}
+			TType = _XAie_GetTileTypefromLoc(AieHd->dev(), Loc);
+			if (TType == XAIEGBL_TILE_TYPE_AIETILE) {
+				Mod = XAIE_MEM_MOD;
+				Event = (XAie_Events)(
+					XAIE_EVENT_DMA_S2MM_0_FINISHED_BD_MEM + Off);
+			} else if (TType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+				Mod = XAIE_PL_MOD;
+				Event = (XAie_Events)(
+					XAIE_EVENT_DMA_S2MM_0_FINISHED_BD_PL + Off);
+			} else {
+				XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+					" invalid tile type." << '\n';
+				return XAIE_INVALID_TILE;
+			}
+			return _submit(Loc, Mod, Event, TimeoutUs,
+				[Loc, ChNum, Dir](XAie_DevInst *Dev, bool &Met) {
+					uint8_t Pending = 0;
+					AieRC RC = XAie_DmaGetPendingBdCount(Dev,
+						Loc, ChNum, Dir, &Pending);
+
+					Met = (Pending == 0);
+					return RC;
+				}, Done);
+		}
+		/**
+		 * This function waits for a lock to hold a value.
+		 *
+		 * @param Loc tile location
+		 * @param Event lock event of the memory module of the tile, or
+		 *	  of the PL module of a shim tile, fired when the lock may
+		 *	  reach the value, such as the release of the lock
+		 * @param LockId lock index
+		 * @param Value lock value waited for
+		 * @param TimeoutUs timeout in microseconds, 0 for none
+		 * @param Done completion of the wait
+		 * @return XAIE_OK if the wait is in flight, error code for
+		 *	   failure, in which case Done is not called
+		 */
+		AieRC waitLockValue(XAie_LocType Loc, XAie_Events Event,
+				uint8_t LockId, uint8_t Value,
+				uint32_t TimeoutUs, Completion Done) {
+			uint8_t TType;
+			XAie_ModuleType Mod = XAIE_MEM_MOD;
+
+			TType = _XAie_GetTileTypefromLoc(AieHd->dev(), Loc);
+			if (TType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+				Mod = XAIE_PL_MOD;
+			} else if (TType == XAIEGBL_TILE_TYPE_SHIMPL ||
+					TType == XAIEGBL_TILE_TYPE_MAX) {
+				XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+					" invalid tile type." << '\n';
+				return XAIE_INVALID_TILE;
+			}
+			if (LockId >= MaxLocks) {
+				XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+					" invalid lock." << '\n';
+				return XAIE_INVALID_LOCK_ID;
+			}
+			return _submit(Loc, Mod, Event, TimeoutUs,
+				[Loc, LockId, Value](XAie_DevInst *Dev,
+						bool &Met) {
+					uint8_t Values[MaxLocks];
+					uint32_t Num = MaxLocks;
+					AieRC RC = XAie_LockGetValues(Dev, Loc,
+						Values, &Num);
+
+					Met = (RC == XAIE_OK && LockId < Num &&
+						Values[LockId] == Value);
+					return RC;
+				}, Done);
+		}
+		/**
+		 * This function waits for a core to be done.
+		 *
+		 * @param Loc AIE tile location
+		 * @param TimeoutUs timeout in microseconds, 0 for none
+		 * @param Done completion of the wait
+		 * @return XAIE_OK if the wait is in flight, error code for
+		 *	   failure, in which case Done is not called
+		 */
+		AieRC waitCoreDone(XAie_LocType Loc, uint32_t TimeoutUs,
+				Completion Done) {
+			if (_XAie_GetTileTypefromLoc(AieHd->dev(), Loc) !=
+					XAIEGBL_TILE_TYPE_AIETILE) {
+				XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+					" invalid tile type." << '\n';
+				return XAIE_INVALID_TILE;
+			}
+			return _submit(Loc, XAIE_CORE_MOD,
+				XAIE_EVENT_DISABLED_CORE, TimeoutUs,
+				[Loc](XAie_DevInst *Dev, bool &Met) {
+					uint8_t IsDone = 0;
+					AieRC RC = XAie_CoreReadDoneBit(Dev, Loc,
+						&IsDone);
+
+					Met = (IsDone != 0);
+					return RC;
+				}, Done);
+		}
+		/**
+		 * This function waits for an event to occur. The event status
+		 * is sticky: an occurrence before the wait, since the status
+		 * was last cleared, completes the wait.
+		 *
+		 * @param Loc tile location
+		 * @param Mod module of the event
+		 * @param Event event waited for
+		 * @param TimeoutUs timeout in microseconds, 0 for none
+		 * @param Done completion of the wait
+		 * @return XAIE_OK if the wait is in flight, error code for
+		 *	   failure, in which case Done is not called
+		 */
+		AieRC waitEvent(XAie_LocType Loc, XAie_ModuleType Mod,
+				XAie_Events Event, uint32_t TimeoutUs,
+				Completion Done) {
+			return _submit(Loc, Mod, Event, TimeoutUs,
+				[Loc, Mod, Event](XAie_DevInst *Dev, bool &Met) {
+					uint8_t Status = 0;
+					AieRC RC = XAie_EventReadStatus(Dev, Loc,
+						Mod, Event, &Status);
+
+					Met = (Status != 0);
+					return RC;
+				}, Done);
+		}
+#ifdef __cpp_impl_coroutine
+		/**
+		 * @class Awaitable
+		 * @brief Suspends a coroutine until a wait of the reactor
+		 * completes. co_await returns the result of the wait.
+		 */
+		class Awaitable {
+		public:
+			Awaitable(std::function<AieRC(Completion)> S):
+				Submit(S), RC(XAIE_OK) {}
+			bool await_ready() const noexcept {
+				return false;
+			}
+			bool await_suspend(std::coroutine_handle<> H) {
+				/* the coroutine may resume before Submit returns */
+				AieRC SubmitRC = Submit([this, H](AieRC R) {
+						RC = R;
+						H.resume();
+					});
+
+				if (SubmitRC != XAIE_OK) {
+					RC = SubmitRC;
+					return false;
+				}
+				return true;
+			}
+			AieRC await_resume() const noexcept {
+				return RC;
+			}
+		private:
+			std::function<AieRC(Completion)> Submit;
+			AieRC RC;
+		};
+		/**
+		 * This function returns an awaitable of waitDmaDone().
+		 */
+		Awaitable dmaDone(XAie_LocType Loc, uint8_t ChNum,
+				XAie_DmaDirection Dir, uint32_t TimeoutUs = 0) {
+			return Awaitable([=, this](Completion Done) {
+					return waitDmaDone(Loc, ChNum, Dir,
+						TimeoutUs, Done);
+				});
+		}
+		/**
+		 * This function returns an awaitable of waitLockValue().
+		 */
+		Awaitable lockValue(XAie_LocType Loc, XAie_Events Event,
+				uint8_t LockId, uint8_t Value,
+				uint32_t TimeoutUs = 0) {
+			return Awaitable([=, this](Completion Done) {
+					return waitLockValue(Loc, Event, LockId,
+						Value, TimeoutUs, Done);
+				});
+		}
+		/**
+		 * This function returns an awaitable of waitCoreDone().
+		 */
+		Awaitable coreDone(XAie_LocType Loc, uint32_t TimeoutUs = 0) {
+			return Awaitable([=, this](Completion Done) {
+					return waitCoreDone(Loc, TimeoutUs, Done);
+				});
+		}
+		/**
+		 * This function returns an awaitable of waitEvent().
+		 */
+		Awaitable event(XAie_LocType Loc, XAie_ModuleType Mod,
+				XAie_Events Event, uint32_t TimeoutUs = 0) {
+			return Awaitable([=, this](Completion Done) {
+					return waitEvent(Loc, Mod, Event,
+						TimeoutUs, Done);
+				});
+		}
+#endif
+	private:
+		static const uint32_t MaxLocks = 64;
+		typedef std::function<AieRC(XAie_DevInst *, bool &)> Condition;
+		/* wait in flight */
+		struct Wait {
+			XAie_LocType Loc;
+			XAie_ModuleType Mod;
+			XAie_Events Event;
+			Condition Cond;
+			Completion Done;
+			bool HasDeadline;
+			std::chrono::steady_clock::time_point Deadline;
+			bool Armed; /**< event armed on the waiter */
+		};
+		/* event armed for the waits of a module */
+		struct ArmedEvent {
+			XAie_Events Event;
+			uint32_t Refs;
+		};
+		typedef std::tuple<uint8_t, uint8_t, uint32_t> ModKey;
+
+		std::shared_ptr<XAieDevHandle> AieHd; /**< AI engine device */
+		int SrcFd;
+		bool SrcIsUio;
+		uint32_t PollPeriodUs;
+		std::atomic<bool> Running;
+		std::atomic<size_t> NumPending;
+		XAie_EventWaiter *Waiter;
+		int WakeFd; /**< eventfd waking up the reactor thread */
+		Dispatcher Dispatch;
+		std::vector<Wait> vIncoming; /**< waits not seen by the thread */
+		std::vector<Wait> vWaits; /**< waits of the reactor thread */
+		std::map<ModKey, ArmedEvent> mArmed;
+		_XAIEFAL_MUTEX_DECLARE(mLock);
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+		std::thread Thread;
+#endif
+
+		AieRC _submit(XAie_LocType Loc, XAie_ModuleType Mod,
+				XAie_Events Event, uint32_t TimeoutUs,
+				Condition Cond, Completion Done) {
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+			Wait W;
+
+			if (!Running) {
+				XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+					" reactor is not started." << '\n';
+				return XAIE_ERR;
+			}
+			W.Loc = Loc;
+			W.Mod = Mod;
+			W.Event = Event;
+			W.Cond = Cond;
+			W.Done = Done;
+			W.HasDeadline = (TimeoutUs != 0);
+			W.Deadline = std::chrono::steady_clock::now() +
+				std::chrono::microseconds(TimeoutUs);
+			W.Armed = false;
+			{
+				_XAIEFAL_MUTEX_ACQUIRE(mLock);
+				vIncoming.push_back(W);
+			}
+			NumPending.fetch_add(1, std::memory_order_relaxed);
+			_wake();
+			return XAIE_OK;
+#else
+			(void)Loc;
+			(void)Mod;
+			(void)Event;
+			(void)TimeoutUs;
+			(void)Cond;
+			(void)Done;
+			XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+				" threads not supported." << '\n';
+			return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+		}
+		void _complete(Wait &W, AieRC RC) {
+			Completion Done = W.Done;
+
+			if (Dispatch) {
+				Dispatch([Done, RC]() { Done(RC); });
+			} else {
+				Done(RC);
+			}
+		}
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+		void _wake() {
+			uint64_t One = 1;
+
+			if (write(WakeFd, &One, sizeof(One)) < 0) {
+				/* counter saturated, the thread is woken up */
+			}
+		}
+		/* armed events of a shim tile share its interrupt event */
+		ModKey _key(const Wait &W) {
+			uint8_t TType = _XAie_GetTileTypefromLoc(AieHd->dev(),
+				W.Loc);
+
+			if (TType == XAIEGBL_TILE_TYPE_SHIMNOC ||
+					TType == XAIEGBL_TILE_TYPE_SHIMPL) {
+				return ModKey(W.Loc.Col, W.Loc.Row, XAIE_MOD_ANY);
+			}
+			return ModKey(W.Loc.Col, W.Loc.Row, W.Mod);
+		}
+		void _arm(Wait &W) {
+			ModKey K = _key(W);
+			auto It = mArmed.find(K);
+
+			if (It != mArmed.end()) {
+				if (It->second.Event == W.Event) {
+					It->second.Refs++;
+					W.Armed = true;
+				}
+				return;
+			}
+			if (XAie_EventWaiterArm(Waiter, W.Loc, W.Mod, W.Event) ==
+					XAIE_OK) {
+				mArmed[K] = {W.Event, 1};
+				W.Armed = true;
+			}
+		}
+		void _disarm(Wait &W) {
+			if (!W.Armed) {
+				return;
+			}
+			auto It = mArmed.find(_key(W));
+
+			if (--It->second.Refs == 0) {
+				XAie_EventWaiterDisarm(Waiter, W.Loc, W.Mod);
+				mArmed.erase(It);
+			}
+			W.Armed = false;
+		}
+		void _run() {
+			XAie_DevInst *Dev = AieHd->dev();
+
+			while (Running) {
+				auto Now = std::chrono::steady_clock::now();
+				auto Sleep = std::chrono::microseconds(PollPeriodUs);
+				uint64_t Count;
+				uint8_t Fired;
+
+				{
+					_XAIEFAL_MUTEX_ACQUIRE(mLock);
+					for (auto &W: vIncoming) {
+						vWaits.push_back(W);
+						_arm(vWaits.back());
+					}
+					vIncoming.clear();
+				}
+
+				for (size_t i = 0; i < vWaits.size();) {
+					Wait &W = vWaits[i];
+					bool Met = false;
+					AieRC RC = W.Cond(Dev, Met);
+
+					if (RC == XAIE_OK && !Met) {
+						if (!W.HasDeadline || Now < W.Deadline) {
+							if (W.HasDeadline &&
+								W.Deadline - Now < Sleep) {
+								Sleep = std::chrono::duration_cast<
+									std::chrono::microseconds>(
+									W.Deadline - Now) +
+									std::chrono::microseconds(1);
+							}
+							i++;
+							continue;
+						}
+						RC = XAIE_ERR;
+					}
+					_disarm(W);
+					_complete(W, RC);
+					vWaits[i] = vWaits.back();
+					vWaits.pop_back();
+					NumPending.fetch_sub(1,
+						std::memory_order_relaxed);
+				}
+
+				if (XAie_EventWaiterSleep(Waiter, WakeFd,
+						(uint32_t)Sleep.count(), &Fired) !=
+						XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "reactor " << __func__ <<
+						" failed to sleep on interrupt." << '\n';
+					std::this_thread::sleep_for(Sleep);
+				}
+				while (read(WakeFd, &Count, sizeof(Count)) > 0);
+			}
+
+			for (auto &W: vWaits) {
+				_disarm(W);
+			}
+		}
+#endif
+	};
+}
@@ -5,6 +5,7 @@
  * Base classes for AI engine resources management
  */
 
+#include <algorithm>
 #include <fstream>
 #include <functional>
 #include <map>
@@ -16,6 +17,7 @@
 #include <xaiengine.h>
 #include <xaiefal/common/xaiefal-common.hpp>
 #include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/common/xaiefal-pool.hpp>
 #include <xaiefal/rsc/xaiefal-rsc-group.hpp>
 
 #pragma once
@@ -88,7 +90,7 @@ namespace xaiefal {
 		}
 
 		template<class RT>
-		AieRC addRsc(std::shared_ptr<RT> R) {
+		AieRC addRsc(const std::shared_ptr<RT> &R) {
 			return RscGroup->addRsc(R);
 		}
 	private:
@@ -137,6 +139,7 @@ namespace xaiefal {
 			XAieGroupEventMapPl[6] = XAIE_EVENT_GROUP_USER_EVENT_PL;
 		}
 		~XAieDevHandle() {
+			flushRscPool();
 			if (FinishOnDestruct) {
 				XAie_Finish(Dev);
 			}
@@ -180,10 +183,12 @@ namespace xaiefal {
 		 */
 		XAieDevHdRscGroupWrapper &getRscGroup(const std::string &GName) {
 			_XAIEFAL_MUTEX_ACQUIRE(mLock);
-			if (RscGroupsMap.find(GName) == RscGroupsMap.end()) {
-				_createGroup<XAieRscGroupRuntime>(GName);
+			auto it = RscGroupsMap.find(GName);
+
+			if (it == RscGroupsMap.end()) {
+				return _createGroup<XAieRscGroupRuntime>(GName);
 			}
-			return RscGroupsMap[GName];
+			return it->second;
 		}
 
 		/**
@@ -201,6 +206,145 @@ namespace xaiefal {
 			}
 		}
 
+		/**
+		 * This function enables or disables the warm resource pool.
+		 * When the pool is enabled, the perfcounters, trace controls
+		 * and broadcast channels released by the resource objects stay
+		 * reserved in the driver and are kept in the pool. A following
+		 * reservation of the same type on the same tiles and modules
+		 * is served from the pool without going to the resource
+		 * manager. Disabling the pool releases the pooled resources.
+		 *
+		 * @param Enable true to enable the pool, false to disable it
+		 */
+		void enableRscPool(bool Enable) {
+			{
+				_XAIEFAL_MUTEX_ACQUIRE(PoolLock);
+				PoolEnabled = Enable;
+			}
+			if (!Enable) {
+				flushRscPool();
+			}
+		}
+		/**
+		 * This function checks if the warm resource pool is enabled.
+		 *
+		 * @return true if the pool is enabled, false otherwise
+		 */
+		bool isRscPoolEnabled() {
+			_XAIEFAL_MUTEX_ACQUIRE(PoolLock);
+			return PoolEnabled;
+		}
+		/**
+		 * This function keeps the resources of a reservation in the
+		 * warm resource pool instead of releasing them.
+		 *
+		 * @param Rscs resources of the reservation
+		 * @param NumRscs number of resources
+		 * @return true if the resources are pooled, false if the
+		 *	   caller has to release them to the driver.
+		 */
+		bool poolRscs(const XAie_UserRsc *Rscs, uint32_t NumRscs) {
+			_XAIEFAL_MUTEX_ACQUIRE(PoolLock);
+
+			if (!PoolEnabled || NumRscs == 0 ||
+				!_isPoolable(Rscs[0].RscType)) {
+				return false;
+			}
+			RscPool.emplace_back(Rscs, Rscs + NumRscs);
+			return true;
+		}
+		/**
+		 * This function serves a reservation from the warm resource
+		 * pool. The type, tile and module of each requested resource
+		 * have to match the pooled reservation, in the same order.
+		 *
+		 * @param Rscs requested resources, the resource IDs are
+		 *	  returned in it if the reservation is served.
+		 * @param NumRscs number of resources
+		 * @param RscId preferred resource ID, XAIE_RSC_ID_ANY for any
+		 * @return true if the reservation is served from the pool,
+		 *	   false otherwise.
+		 */
+		bool takePooledRscs(XAie_UserRsc *Rscs, uint32_t NumRscs,
+				uint32_t RscId = XAIE_RSC_ID_ANY) {
+			_XAIEFAL_MUTEX_ACQUIRE(PoolLock);
+
+			for (auto it = RscPool.begin(); it != RscPool.end(); it++) {
+				bool Match = (it->size() == NumRscs) &&
+					(RscId == XAIE_RSC_ID_ANY ||
+					 (*it)[0].RscId == RscId);
+
+				for (uint32_t i = 0; Match && i < NumRscs; i++) {
+					const XAie_UserRsc &P = (*it)[i];
+
+					Match = P.RscType == Rscs[i].RscType &&
+						P.Mod == Rscs[i].Mod &&
+						P.Loc.Col == Rscs[i].Loc.Col &&
+						P.Loc.Row == Rscs[i].Loc.Row;
+				}
+				if (Match) {
+					std::copy(it->begin(), it->end(), Rscs);
+					RscPool.erase(it);
+					return true;
+				}
+			}
+			return false;
+		}
+		/**
+		 * This function releases the oldest pooled reservations to the
+		 * driver until at most the specified number is left.
+		 *
+		 * @param MaxRsvs number of pooled reservations to keep
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC trimRscPool(uint32_t MaxRsvs) {
+			_XAIEFAL_MUTEX_ACQUIRE(PoolLock);
+			AieRC RC = XAIE_OK;
+
+			while (RscPool.size() > MaxRsvs) {
+				auto &R = RscPool.front();
+				AieRC lRC = _releasePooled(R);
+
+				if (lRC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "failed to release pooled rsc type " <<
+						R[0].RscType << '\n';
+					RC = lRC;
+				}
+				RscPool.erase(RscPool.begin());
+			}
+			return RC;
+		}
+		/**
+		 * This function releases all the pooled reservations to the
+		 * driver.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC flushRscPool() {
+			return trimRscPool(0);
+		}
+		/**
+		 * This function returns the statistics of the pooled resources.
+		 * The pooled resources are reserved in the driver but are
+		 * available to this application, the "Avail" resource group
+		 * counts them as available.
+		 *
+		 * @return statistics of the pooled resources
+		 */
+		XAieRscStat getRscPoolStat() {
+			_XAIEFAL_MUTEX_ACQUIRE(PoolLock);
+			XAieRscStat RscStat("Pool");
+
+			for (auto &R: RscPool) {
+				for (auto &E: R) {
+					RscStat.addRscStat(E.Loc, E.Mod, E.RscType,
+							1);
+				}
+			}
+			return RscStat;
+		}
+
 		// TODO: Configure group event should be moved to c driver
 		uint32_t XAieGroupEventMapCore[9];
 		uint32_t XAieGroupEventMapMem[8];
@@ -208,17 +352,44 @@ namespace xaiefal {
 	private:
 		XAie_DevInst *Dev;
 		bool FinishOnDestruct;
-		std::map <std::string, XAieDevHdRscGroupWrapper> RscGroupsMap; /**< resource groups map */
+		/**
+		 * resource groups map. References to the wrappers stay valid
+		 * when the map grows, as they are handed out by getRscGroup().
+		 */
+		std::unordered_map<std::string, XAieDevHdRscGroupWrapper> RscGroupsMap;
 		_XAIEFAL_MUTEX_DECLARE(mLock); /**< mutex lock */
+		bool PoolEnabled = false; /**< true if warm resource pool is enabled */
+		/** pooled reservations, oldest first */
+		std::vector<std::vector<XAie_UserRsc>> RscPool;
+		_XAIEFAL_MUTEX_DECLARE(PoolLock); /**< warm resource pool lock */
 
 	private:
+		static bool _isPoolable(uint32_t RscType) {
+			return RscType == static_cast<uint32_t>(XAIE_PERFCNT_RSC) ||
+				RscType == static_cast<uint32_t>(XAIE_TRACE_CTRL_RSC) ||
+				RscType == static_cast<uint32_t>(XAIE_BCAST_CHANNEL_RSC);
+		}
+		AieRC _releasePooled(std::vector<XAie_UserRsc> &R) {
+			switch (R[0].RscType) {
+			case XAIE_PERFCNT_RSC:
+				return XAie_ReleasePerfcnt(Dev, R.size(), R.data());
+			case XAIE_TRACE_CTRL_RSC:
+				return XAie_ReleaseTraceCtrl(Dev, R.size(), R.data());
+			default:
+				return XAie_ReleaseBroadcastChannel(Dev, R.size(),
+						R.data());
+			}
+		}
 		template<class GT>
-		void _createGroup(const std::string &GName) {
+		XAieDevHdRscGroupWrapper &_createGroup(const std::string &GName) {
 			auto GPtr = std::make_shared<GT>(shared_from_this(),
 					GName);
-			RscGroupsMap[GName] = XAieDevHdRscGroupWrapper(GPtr);
-			Logger::log(LogLevel::INFO) << "Resource group " <<
-				GName << " is created." << std::endl;
+			auto &G = RscGroupsMap[GName];
+
+			G = XAieDevHdRscGroupWrapper(GPtr);
+			XAIEFAL_LOG(INFO) << "Resource group " <<
+				GName << " is created." << '\n';
+			return G;
 		}
 	};
 
@@ -235,17 +406,14 @@ namespace xaiefal {
 		~XAieDev() {}
 
 		/**
-		 * This function returns a tile object reference.
+		 * This function returns a tile object reference. The tile
+		 * object and its modules are created on the first use of the
+		 * tile.
 		 *
 		 * @param L tile Location
 		 * @return tile object reference
 		 */
-		XAieTile &tile(XAie_LocType L) {
-			if (L.Col > NumCols || L.Row > NumRows) {
-				throw std::invalid_argument("Invalid tile location");
-			}
-			return Tiles[L.Col * NumRows + L.Row];
-		}
+		XAieTile &tile(XAie_LocType L);
 
 		/**
 		 * This function returns a tile object reference.
@@ -326,20 +494,72 @@ namespace xaiefal {
 		 * function of the resource class.
 		 */
 		std::shared_ptr<XAieBroadcast> broadcast(
-			std::vector<XAie_LocType> &vL, XAie_ModuleType StartM,
-			XAie_ModuleType EndM,
+			const std::vector<XAie_LocType> &vL,
+			XAie_ModuleType StartM, XAie_ModuleType EndM,
+			XAieDevHdRscGroupWrapper &RGroup) {
+			return broadcast(vL.begin(), vL.end(), StartM, EndM,
+					RGroup);
+		}
+		std::shared_ptr<XAieBroadcast> broadcast(
+			const std::vector<XAie_LocType> &vL,
+			XAie_ModuleType StartM, XAie_ModuleType EndM) {
+			XAieDevHdRscGroupWrapper RGroup =
+				AieHandle->getRscGroup("Generic");
+			return broadcast(vL, StartM, EndM, RGroup);
+		}
+		/**
+		 * This function returns broadcast resource software object
+		 * of the tiles moved from the vector.
+		 *
+		 * @param vL vector of tile locations, moved to the object
+		 * @param StartM starting module of the broadcast channel
+		 * @param EndM Ending module of the broadcast channel
+		 * @param RGroup resource group
+		 * @return broadcast channel software object pointer
+		 */
+		std::shared_ptr<XAieBroadcast> broadcast(
+			std::vector<XAie_LocType> &&vL,
+			XAie_ModuleType StartM, XAie_ModuleType EndM,
 			XAieDevHdRscGroupWrapper &RGroup) {
-			auto BC = std::make_shared<XAieBroadcast>(*this, vL,
+			auto BC = makePooled<XAieBroadcast>(*this, std::move(vL),
 					StartM, EndM);
 			RGroup.addRsc(BC);
 			return BC;
 		}
 		std::shared_ptr<XAieBroadcast> broadcast(
-			std::vector<XAie_LocType> &vL, XAie_ModuleType StartM,
-			XAie_ModuleType EndM) {
+			std::vector<XAie_LocType> &&vL,
+			XAie_ModuleType StartM, XAie_ModuleType EndM) {
 			XAieDevHdRscGroupWrapper RGroup =
 				AieHandle->getRscGroup("Generic");
-			return broadcast(vL, StartM, EndM, RGroup);
+			return broadcast(std::move(vL), StartM, EndM, RGroup);
+		}
+		/**
+		 * This function returns broadcast resource software object
+		 * of the tiles of an iterator range, e.g. a plain array or a
+		 * part of a larger container.
+		 *
+		 * @param First iterator to the first tile location
+		 * @param Last iterator past the last tile location
+		 * @param StartM starting module of the broadcast channel
+		 * @param EndM Ending module of the broadcast channel
+		 * @param RGroup resource group
+		 * @return broadcast channel software object pointer
+		 */
+		template<class It>
+		std::shared_ptr<XAieBroadcast> broadcast(It First, It Last,
+			XAie_ModuleType StartM, XAie_ModuleType EndM,
+			XAieDevHdRscGroupWrapper &RGroup) {
+			auto BC = makePooled<XAieBroadcast>(*this, First, Last,
+					StartM, EndM);
+			RGroup.addRsc(BC);
+			return BC;
+		}
+		template<class It>
+		std::shared_ptr<XAieBroadcast> broadcast(It First, It Last,
+			XAie_ModuleType StartM, XAie_ModuleType EndM) {
+			XAieDevHdRscGroupWrapper RGroup =
+				AieHandle->getRscGroup("Generic");
+			return broadcast(First, Last, StartM, EndM, RGroup);
 		}
 
 		/**
@@ -360,9 +580,9 @@ namespace xaiefal {
 				MString = "shim";
 			} else {
 				RC = XAIE_INVALID_ARGS;
-				Logger::log(LogLevel::ERROR) << __func__ <<
+				XAIEFAL_LOG(ERROR) << __func__ <<
 					"failed. invalid module type." <<
-					std::endl;
+					'\n';
 			}
 			return RC;
 		}
@@ -385,8 +605,8 @@ namespace xaiefal {
 				Mod = XAIE_PL_MOD;
 			} else {
 				RC = XAIE_INVALID_ARGS;
-				Logger::log(LogLevel::ERROR) << __func__ <<
-				"failed. invalid module string." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+				"failed. invalid module string." << '\n';
 			}
 			return RC;
 		}
@@ -396,7 +616,8 @@ namespace xaiefal {
 							    handle */
 		uint32_t NumCols; /**< number of AI engine columns */
 		uint32_t NumRows; /**< number of AI engine rows */
-		std::vector<XAieTile> Tiles;
+		std::vector<XAieTile> Tiles; /**< tiles, created on first use */
+		_XAIEFAL_MUTEX_DECLARE(mLock); /**< mutex lock */
 	};
 
 	/**
@@ -414,7 +635,7 @@ namespace xaiefal {
 				throw std::invalid_argument("Invalid module and tile");
 			}
 			AieHandle = Dev.getDevHandle();
-			TraceCntr = std::make_shared<XAieTraceCntr>(AieHandle,
+			TraceCntr = makePooled<XAieTraceCntr>(AieHandle,
 					Loc, Mod);
 			AieHandle->getRscGroup("Generic").addRsc(TraceCntr);
 			AieHandle->getRscGroup("Avail").addRsc(TraceCntr);
@@ -464,7 +685,7 @@ namespace xaiefal {
 		 */
 		std::shared_ptr<XAiePerfCounter> perfCounter(
 				XAieDevHdRscGroupWrapper &RGroup) {
-			auto R = std::make_shared<XAiePerfCounter>(AieHandle,
+			auto R = makePooled<XAiePerfCounter>(AieHandle,
 					Loc, Mod);
 
 			RGroup.addRsc(R);
@@ -506,7 +727,7 @@ namespace xaiefal {
 		 */
 		std::shared_ptr<XAieTraceEvent> traceEvent(
 				XAieDevHdRscGroupWrapper &RGroup) {
-			auto R = std::make_shared<XAieTraceEvent>(AieHandle,
+			auto R = makePooled<XAieTraceEvent>(AieHandle,
 				Loc, Mod, TraceCntr);
 
 			RGroup.addRsc(R);
@@ -534,7 +755,7 @@ namespace xaiefal {
 		 */
 		std::shared_ptr<XAieActiveCycles> activeCycles(
 				XAieDevHdRscGroupWrapper &RGroup) {
-			auto R = std::make_shared<XAieActiveCycles>(AieHandle,
+			auto R = makePooled<XAieActiveCycles>(AieHandle,
 					Loc);
 			RGroup.addRsc(R);
 			return R;
@@ -562,7 +783,7 @@ namespace xaiefal {
 				XAieDevHdRscGroupWrapper &RGroup) {
 			auto StallG = groupEvent(XAIE_EVENT_GROUP_CORE_STALL_CORE);
 			auto FlowG = groupEvent(XAIE_EVENT_GROUP_CORE_PROGRAM_FLOW_CORE);
-			auto R = std::make_shared<XAieStallCycles>(AieHandle,
+			auto R = makePooled<XAieStallCycles>(AieHandle,
 					Loc, StallG, FlowG);
 			RGroup.addRsc(R);
 			return R;
@@ -589,7 +810,7 @@ namespace xaiefal {
 		std::shared_ptr<XAieStallOccurrences> stallOccurrences(
 				XAieDevHdRscGroupWrapper &RGroup) {
 			auto StallG = groupEvent(XAIE_EVENT_GROUP_CORE_STALL_CORE);
-			auto R = std::make_shared<XAieStallOccurrences>(AieHandle,
+			auto R = makePooled<XAieStallOccurrences>(AieHandle,
 					Loc, StallG);
 			RGroup.addRsc(R);
 			return R;
@@ -614,7 +835,7 @@ namespace xaiefal {
 		 */
 		std::shared_ptr<XAiePCEvent> pcEvent(
 				XAieDevHdRscGroupWrapper &RGroup) {
-			auto R = std::make_shared<XAiePCEvent>(AieHandle, Loc);
+			auto R = makePooled<XAiePCEvent>(AieHandle, Loc);
 			RGroup.addRsc(R);
 			return R;
 		}
@@ -638,7 +859,7 @@ namespace xaiefal {
 		 */
 		std::shared_ptr<XAiePCRange> pcRange(
 				XAieDevHdRscGroupWrapper &RGroup) {
-			auto R = std::make_shared<XAiePCRange>(AieHandle, Loc);
+			auto R = makePooled<XAiePCRange>(AieHandle, Loc);
 			RGroup.addRsc(R);
 			return R;
 		}
@@ -664,7 +885,7 @@ namespace xaiefal {
 		std::shared_ptr<XAieComboEvent> comboEvent(
 				XAieDevHdRscGroupWrapper &RGroup,
 				uint32_t ENum = 2) {
-			auto R = std::make_shared<XAieComboEvent>(AieHandle,
+			auto R = makePooled<XAieComboEvent>(AieHandle,
 								Loc, Mod,
 								ENum);
 			RGroup.addRsc(R);
@@ -694,13 +915,13 @@ namespace xaiefal {
 				XAie_Events E) {
 			auto G = GroupEvents.find(E);
 			if (G != GroupEvents.end()) {
-				return std::make_shared<XAieGroupEventHandle>(
+				return makePooled<XAieGroupEventHandle>(
 						AieHandle, GroupEvents[E]);
 			}
-			auto gEPtr = std::make_shared<XAieGroupEvent>(AieHandle, Loc, Mod, E);
+			auto gEPtr = makePooled<XAieGroupEvent>(AieHandle, Loc, Mod, E);
 			RGroup.addRsc(gEPtr);
 			GroupEvents.emplace(E, gEPtr);
-			return std::make_shared<XAieGroupEventHandle>(AieHandle,
+			return makePooled<XAieGroupEventHandle>(AieHandle,
 					gEPtr);
 		}
 		std::shared_ptr<XAieGroupEventHandle> groupEvent(
@@ -724,7 +945,7 @@ namespace xaiefal {
 		 */
 		std::shared_ptr<XAieUserEvent> userEvent(
 				XAieDevHdRscGroupWrapper &RGroup) {
-			auto R = std::make_shared<XAieUserEvent>(AieHandle,
+			auto R = makePooled<XAieUserEvent>(AieHandle,
 								Loc, Mod);
 			RGroup.addRsc(R);
 			return R;
@@ -749,6 +970,7 @@ namespace xaiefal {
 	 *	  such as get resource within a tile, or get a module.
 	 */
 	class XAieTile {
+		friend class XAieDev;
 	public:
 		XAieTile() {}
 		XAieTile(XAieDev &Dev, XAie_LocType L):
@@ -858,10 +1080,8 @@ namespace xaiefal {
 		 */
 		std::shared_ptr<XAieBroadcast> broadcast(
 				XAieDevHdRscGroupWrapper &RGroup) {
-			std::vector<XAie_LocType> vL;
 			XAie_ModuleType StartM, EndM;
 
-			vL.push_back(Loc);
 			if (_XAie_CheckModule(AieHandle->dev(), Loc, XAIE_CORE_MOD)
 				== XAIE_OK) {
 				StartM = XAIE_CORE_MOD;
@@ -874,8 +1094,8 @@ namespace xaiefal {
 				StartM = XAIE_MEM_MOD;
 				EndM = XAIE_MEM_MOD;
 			}
-			auto BC = std::make_shared<XAieBroadcast>(AieHandle,
-				vL, StartM, EndM);
+			auto BC = makePooled<XAieBroadcast>(AieHandle,
+				&Loc, &Loc + 1, StartM, EndM);
 			RGroup.addRsc(BC);
 
 			return BC;
@@ -901,7 +1121,7 @@ namespace xaiefal {
 		 */
 		std::shared_ptr<XAiePerfCounter> perfCounter(
 				XAieDevHdRscGroupWrapper &RGroup) {
-			auto C = std::make_shared<XAiePerfCounter>(AieHandle,
+			auto C = makePooled<XAiePerfCounter>(AieHandle,
 					Loc, Mods[0].mod(), true);
 			RGroup.addRsc(C);
 			return C;
@@ -928,7 +1148,7 @@ namespace xaiefal {
 		 */
 		std::shared_ptr<XAieStreamPortSelect> sswitchPort(
 				XAieDevHdRscGroupWrapper &RGroup) {
-			auto SS = std::make_shared<XAieStreamPortSelect>(
+			auto SS = makePooled<XAieStreamPortSelect>(
 					AieHandle, Loc);
 			RGroup.addRsc(SS);
 			return SS;
@@ -959,13 +1179,20 @@ namespace xaiefal {
 
 		NumCols = DevPtr->NumCols;
 		NumRows = DevPtr->NumRows;
-		for (uint32_t c = 0; c < NumCols; c++) {
-			for (uint32_t r = 0; r < NumRows; r++) {
-				Tiles.push_back(XAieTile(*this,
-					XAie_TileLoc(c, r)));
-			}
+		Tiles.resize(NumCols * NumRows);
+	}
+
+	inline XAieTile &XAieDev::tile(XAie_LocType L) {
+		if (L.Col >= NumCols || L.Row >= NumRows) {
+			throw std::invalid_argument("Invalid tile location");
 		}
 
+		_XAIEFAL_MUTEX_ACQUIRE(mLock);
+		XAieTile &T = Tiles[L.Col * NumRows + L.Row];
+		if (!T.AieHandle) {
+			T = XAieTile(*this, L);
+		}
+		return T;
 	}
 
 	/**
@@ -987,8 +1214,10 @@ namespace xaiefal {
 			M = XAIE_CORE_MOD;
 		} else if (E < XAIE_EVENT_NONE_PL) {
 			M = XAIE_MEM_MOD;
-		} else {
+		} else if (E < XAIE_EVENT_NONE_MEM_TILE) {
 			M = XAIE_PL_MOD;
+		} else {
+			M = XAIE_MEM_MOD;
 		}
 		return M;
 	}
@@ -1,10 +1,11 @@
 // Copyright(C) 2020 - 2021 by Xilinx, Inc. All rights reserved.
 // SPDX-License-Identifier: MIT
 
+#include <xaiengine.h>
+
 #pragma once
 
 namespace xaiefal {
-	#define XAIE_RSC_ID_ANY (-1U)
 	#define XAIE_RSC_TYPE_ANY (-1U)
 	#define XAIE_MOD_ANY (-1U)
 	#define XAIE_LOC_ANY 0xFFU
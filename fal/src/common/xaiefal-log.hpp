@@ -2,10 +2,30 @@
 // SPDX-License-Identifier: MIT
 
 #include <iostream>
+#include <fstream>
 #include <functional>
 
 #pragma once
 
+/*
+ * Lowest log level compiled in. Messages of lower levels are removed at
+ * compile time, e.g. -DXAIEFAL_LOG_MIN_LEVEL=WARN removes DEBUG and INFO
+ * messages.
+ */
+#ifndef XAIEFAL_LOG_MIN_LEVEL
+#define XAIEFAL_LOG_MIN_LEVEL DEBUG
+#endif
+
+/*
+ * Log a message at level L, one of DEBUG, INFO, WARN or ERROR:
+ *	XAIEFAL_LOG(ERROR) << "failed to reserve " << Id << "\n";
+ * The message operands are not evaluated if the level is filtered out, either
+ * at compile time or by the runtime log level.
+ */
+#define XAIEFAL_LOG(L) \
+	if (!xaiefal::Logger::isEnabled(xaiefal::LogLevel::L)) {} \
+	else xaiefal::Logger::log(xaiefal::LogLevel::L)
+
 namespace xaiefal {
 	enum class LogLevel {
 		DEBUG,
@@ -34,10 +54,40 @@ namespace xaiefal {
 			return Level;
 		}
 
+		/**
+		 * This function opens the log file. The file is fully
+		 * buffered, it is written when the buffer is full, on flush()
+		 * and when the logger is destroyed.
+		 *
+		 * @param File log file name
+		 */
 		void setLogFile(const std::string& File) {
 			of.open(File);
 		}
 
+		/**
+		 * This function flushes the buffered messages to the log
+		 * sink.
+		 */
+		void flush() {
+			if (of.is_open()) {
+				of.flush();
+			} else {
+				std::cout.flush();
+			}
+		}
+
+		/**
+		 * This function checks if messages of a log level are logged.
+		 *
+		 * @param L log level
+		 * @return true if the messages are logged, false otherwise
+		 */
+		static bool isEnabled(LogLevel L) {
+			return L >= LogLevel::XAIEFAL_LOG_MIN_LEVEL &&
+				get().Level <= L;
+		}
+
 		Logger(const Logger&) = delete;
 		Logger& operator=(const Logger &) = delete;
 		Logger(Logger &&) = delete;
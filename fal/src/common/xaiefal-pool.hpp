@@ -0,0 +1,134 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <xaiefal/common/xaiefal-common.hpp>
+
+#pragma once
+
+#ifndef XAIEFAL_POOL_MAX_FREE
+#define XAIEFAL_POOL_MAX_FREE 4096U
+#endif
+
+namespace xaiefal {
+	/**
+	 * @class XAieFreeList
+	 * @brief List of freed memory blocks of one size kept for reuse.
+	 *	  At most XAIEFAL_POOL_MAX_FREE blocks are kept, the others are
+	 *	  returned to the heap.
+	 */
+	class XAieFreeList {
+	public:
+		XAieFreeList(): Head(nullptr), NumFree(0) {}
+		/**
+		 * This function takes a block from the list.
+		 *
+		 * @return block, nullptr if the list is empty
+		 */
+		void *get() {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+			Node *N = Head;
+
+			if (N != nullptr) {
+				Head = N->Next;
+				NumFree--;
+			}
+			return N;
+		}
+		/**
+		 * This function gives a block back to the list.
+		 *
+		 * @param P block
+		 * @return true if the block is kept, false if the list is
+		 *	   full and the caller has to free the block.
+		 */
+		bool put(void *P) {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+
+			if (NumFree >= XAIEFAL_POOL_MAX_FREE) {
+				return false;
+			}
+			Node *N = static_cast<Node *>(P);
+			N->Next = Head;
+			Head = N;
+			NumFree++;
+			return true;
+		}
+	private:
+		struct Node {
+			Node *Next;
+		};
+		Node *Head; /**< first free block */
+		size_t NumFree; /**< number of free blocks */
+		_XAIEFAL_MUTEX_DECLARE(mLock);
+	};
+
+	/**
+	 * @class XAiePoolAllocator
+	 * @brief Allocator recycling single objects through a free list per
+	 *	  type. It is used with std::allocate_shared() so the object and
+	 *	  its reference count are recycled together.
+	 */
+	template<class T>
+	class XAiePoolAllocator {
+	public:
+		typedef T value_type;
+
+		XAiePoolAllocator() noexcept {}
+		template<class U>
+		XAiePoolAllocator(const XAiePoolAllocator<U> &) noexcept {}
+
+		T *allocate(size_t N) {
+			if (N == 1 && sizeof(T) >= sizeof(void *)) {
+				void *P = _list().get();
+
+				if (P != nullptr) {
+					return static_cast<T *>(P);
+				}
+			}
+			return static_cast<T *>(::operator new(N * sizeof(T)));
+		}
+		void deallocate(T *P, size_t N) noexcept {
+			if (N == 1 && sizeof(T) >= sizeof(void *) &&
+				_list().put(P)) {
+				return;
+			}
+			::operator delete(P);
+		}
+	private:
+		/*
+		 * The list is never destroyed, so objects released during
+		 * static destruction can still be given back.
+		 */
+		static XAieFreeList &_list() {
+			static XAieFreeList *L = new XAieFreeList();
+			return *L;
+		}
+	};
+
+	template<class T, class U>
+	bool operator==(const XAiePoolAllocator<T> &,
+			const XAiePoolAllocator<U> &) noexcept {
+		return true;
+	}
+	template<class T, class U>
+	bool operator!=(const XAiePoolAllocator<T> &,
+			const XAiePoolAllocator<U> &) noexcept {
+		return false;
+	}
+
+	/**
+	 * This function creates a shared object from the FAL object pool.
+	 *
+	 * @param Args arguments of the object constructor
+	 * @return shared pointer to the object
+	 */
+	template<class T, class... Args>
+	std::shared_ptr<T> makePooled(Args&&... args) {
+		return std::allocate_shared<T>(XAiePoolAllocator<T>(),
+				std::forward<Args>(args)...);
+	}
+}
@@ -0,0 +1,271 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <exception>
+#include <memory>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @class XAieTxn
+	 * @brief Scope of a driver transaction of the calling thread.
+	 *	  The transaction is started when the scope is created and
+	 *	  submitted when it goes out of scope, unless it is submitted
+	 *	  explicitly before. If the scope is left by an exception, the
+	 *	  pending commands are dropped instead. All the register
+	 *	  accesses of the thread in between are queued in the
+	 *	  transaction, so resources started or stopped inside the
+	 *	  scope, one by one or with a resource batch, are configured
+	 *	  in one flush.
+	 *	  If the thread already has a transaction open on the device
+	 *	  when the scope is created, the scope joins it: it neither
+	 *	  starts nor submits a transaction, the outer owner does.
+	 *	  The pending commands can be exported to a transaction
+	 *	  instance owned by the scope, which can be replayed any number
+	 *	  of times and is freed with the scope. With auto flush, the
+	 *	  commands already flushed by reads are not exported, so
+	 *	  scopes to export are usually created without auto flush.
+	 *	  The scope can be moved, e.g. returned from a function, but
+	 *	  not copied. An open transaction belongs to the thread which
+	 *	  started it, the scope must not be moved to another thread
+	 *	  before it is submitted.
+	 */
+	class XAieTxn {
+	public:
+		XAieTxn() = delete;
+		/**
+		 * This function starts a transaction scope.
+		 *
+		 * @param DevHd AI engine device handle
+		 * @param Flags transaction flags of XAie_StartTransaction()
+		 * @param SubmitOnExit true to submit the pending commands when
+		 *	  the scope is destroyed, false to drop them. They are
+		 *	  dropped anyway if the scope is left by an exception.
+		 */
+		XAieTxn(const std::shared_ptr<XAieDevHandle> &DevHd,
+			uint32_t Flags = XAIE_TRANSACTION_ENABLE_AUTO_FLUSH,
+			bool SubmitOnExit = true): AieHd(DevHd),
+			Submit(SubmitOnExit), Uncaught(_uncaught()) {
+			if (!DevHd) {
+				throw std::invalid_argument("aie txn: empty device handle");
+			}
+			if (_XAie_TxnIsActive(AieHd->dev()) == XAIE_ENABLE) {
+				Joined = true;
+				return;
+			}
+			Status = XAie_StartTransaction(AieHd->dev(), Flags);
+			if (Status != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << "aie txn: failed to start transaction." <<
+					'\n';
+				return;
+			}
+			Open = true;
+		}
+		XAieTxn(XAieDev &Dev,
+			uint32_t Flags = XAIE_TRANSACTION_ENABLE_AUTO_FLUSH,
+			bool SubmitOnExit = true):
+			XAieTxn(Dev.getDevHandle(), Flags, SubmitOnExit) {}
+		XAieTxn(const XAieTxn &) = delete;
+		XAieTxn &operator=(const XAieTxn &) = delete;
+		XAieTxn(XAieTxn &&T) noexcept: AieHd(std::move(T.AieHd)),
+			Exported(T.Exported), Status(T.Status), Submit(T.Submit),
+			Uncaught(T.Uncaught), Open(T.Open), Joined(T.Joined) {
+			T.Exported = nullptr;
+			T.Open = false;
+			T.Joined = false;
+		}
+		XAieTxn &operator=(XAieTxn &&T) noexcept {
+			if (this != &T) {
+				_close();
+				AieHd = std::move(T.AieHd);
+				Exported = T.Exported;
+				Status = T.Status;
+				Submit = T.Submit;
+				Uncaught = T.Uncaught;
+				Open = T.Open;
+				Joined = T.Joined;
+				T.Exported = nullptr;
+				T.Open = false;
+				T.Joined = false;
+			}
+			return *this;
+		}
+		~XAieTxn() {
+			_close();
+		}
+		/**
+		 * This function submits the pending commands and closes the
+		 * scope. A scope which joined an outer transaction is closed
+		 * without submitting it.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC submit() {
+			if (Joined) {
+				Joined = false;
+				return XAIE_OK;
+			}
+			if (!Open) {
+				if (Status != XAIE_OK) {
+					return Status;
+				}
+				XAIEFAL_LOG(ERROR) << "aie txn: " << __func__ <<
+					" transaction is not open." << '\n';
+				return XAIE_ERR;
+			}
+			Open = false;
+			Status = XAie_SubmitTransaction(AieHd->dev(), nullptr);
+			return Status;
+		}
+		/**
+		 * This function drops the pending commands and closes the
+		 * scope. Resources started inside the scope are left in the
+		 * running state, the caller has to stop them.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC cancel() {
+			XAie_TxnInst *Inst;
+
+			if (Joined) {
+				XAIEFAL_LOG(ERROR) << "aie txn: " << __func__ <<
+					" cannot cancel an outer transaction." << '\n';
+				return XAIE_ERR;
+			}
+			if (!Open) {
+				XAIEFAL_LOG(ERROR) << "aie txn: " << __func__ <<
+					" transaction is not open." << '\n';
+				return XAIE_ERR;
+			}
+			Open = false;
+			Inst = _XAie_TxnDetach(AieHd->dev());
+			if (Inst == nullptr) {
+				return XAIE_ERR;
+			}
+			return XAie_FreeTransactionInstance(Inst);
+		}
+		/**
+		 * This function exports a copy of the pending commands. The
+		 * scope stays open. A previous export is freed.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC exportTxn() {
+			XAie_TxnInst *Inst;
+
+			if (!Open && !Joined) {
+				XAIEFAL_LOG(ERROR) << "aie txn: " << __func__ <<
+					" transaction is not open." << '\n';
+				return XAIE_ERR;
+			}
+			Inst = XAie_ExportTransactionInstance(AieHd->dev());
+			if (Inst == nullptr) {
+				return XAIE_ERR;
+			}
+			_freeExported();
+			Exported = Inst;
+			return XAIE_OK;
+		}
+		/**
+		 * This function executes the exported commands again. It can
+		 * be called any number of times, also after the scope is
+		 * closed.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 *
+		 * @note The commands are executed right away, ahead of the
+		 *	 pending commands of a transaction open on the thread.
+		 */
+		AieRC replay() {
+			if (Exported == nullptr) {
+				XAIEFAL_LOG(ERROR) << "aie txn: " << __func__ <<
+					" nothing exported." << '\n';
+				return XAIE_ERR;
+			}
+			return XAie_SubmitTransaction(AieHd->dev(), Exported);
+		}
+		/**
+		 * This function returns the exported transaction instance,
+		 * e.g. to serialize it. It stays owned by the scope.
+		 *
+		 * @return exported transaction instance, nullptr if none
+		 */
+		XAie_TxnInst *exported() const {
+			return Exported;
+		}
+		/**
+		 * This function checks if the scope owns an open transaction.
+		 *
+		 * @return true if the transaction is open
+		 */
+		bool isOpen() const {
+			return Open;
+		}
+		/**
+		 * This function checks if the scope joined a transaction
+		 * started by an outer scope of the thread.
+		 *
+		 * @return true if the scope joined an outer transaction
+		 */
+		bool isJoined() const {
+			return Joined;
+		}
+		/**
+		 * This function returns the result of starting or of the last
+		 * submission of the transaction.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC status() const {
+			return Status;
+		}
+	private:
+		std::shared_ptr<XAieDevHandle> AieHd; /**< AI engine device handle */
+		XAie_TxnInst *Exported = nullptr; /**< exported commands */
+		AieRC Status = XAIE_OK; /**< result of start or submit */
+		bool Submit; /**< submit the commands on destruction */
+		int Uncaught; /**< exceptions in flight when created */
+		bool Open = false; /**< transaction started by the scope */
+		bool Joined = false; /**< outer transaction joined */
+
+		void _freeExported() {
+			if (Exported != nullptr) {
+				XAie_FreeTransactionInstance(Exported);
+				Exported = nullptr;
+			}
+		}
+		/**
+		 * This function returns the number of exceptions in flight
+		 * on the calling thread. Before C++17 it can only tell if
+		 * there is one.
+		 *
+		 * @return number of uncaught exceptions
+		 */
+		static int _uncaught() {
+#if __cplusplus >= 201703L
+			return std::uncaught_exceptions();
+#else
+			return std::uncaught_exception() ? 1 : 0;
+#endif
+		}
+		void _close() {
+			if (Open) {
+				if (Submit && _uncaught() <= Uncaught) {
+					if (submit() != XAIE_OK) {
+						XAIEFAL_LOG(ERROR) << "aie txn: " <<
+							"failed to submit transaction on exit." <<
+							'\n';
+					}
+				} else {
+					cancel();
+				}
+			}
+			Joined = false;
+			_freeExported();
+		}
+	};
+}
@@ -0,0 +1,435 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-common.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/rsc/xaiefal-pc.hpp>
+#include <xaiefal/rsc/xaiefal-perf.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @class XAieFuncProfile
+	 * @brief Counts the cycles spent in and the calls of functions of an
+	 * AI engine core with PC ranges and perf counters, without trace.
+	 * Each slot of the profiler is a PC range with two perf counters of
+	 * the core module: one counting the cycles the PC is in the range and
+	 * one counting the PC reaching the start address of the range. If
+	 * there are more functions than slots, rotate() moves the slots to
+	 * the next functions in round robin, and the results are scaled by
+	 * the host time each function was profiled for.
+	 */
+	class XAieFuncProfile {
+	public:
+		/**
+		 * Results of a function. Estimated values are scaled to the
+		 * whole profiling time.
+		 */
+		struct FuncStats {
+			uint64_t Cycles; /**< cycles counted in the function */
+			uint64_t Calls; /**< calls counted */
+			uint64_t EstCycles; /**< estimated cycles */
+			uint64_t EstCalls; /**< estimated calls */
+			uint64_t ActiveNs; /**< time the function was profiled */
+			uint64_t TotalNs; /**< time of the profiling */
+		};
+
+		XAieFuncProfile() = delete;
+		XAieFuncProfile(const std::shared_ptr<XAieDevHandle> &DevHd,
+			XAie_LocType L): AieHd(DevHd), Loc(L), Next(0),
+			Running(false) {}
+		XAieFuncProfile(XAieDev &Dev, XAie_LocType L):
+			XAieFuncProfile(Dev.getDevHandle(), L) {}
+		XAieFuncProfile(const XAieFuncProfile &) = delete;
+		XAieFuncProfile &operator=(const XAieFuncProfile &) = delete;
+		~XAieFuncProfile() {
+			stop();
+			release();
+		}
+		/**
+		 * This function loads the elf of the core to resolve function
+		 * names.
+		 *
+		 * @param ElfPath path to the elf loaded to the core
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC loadElf(const std::string &ElfPath) {
+			std::ifstream F(ElfPath, std::ios::binary);
+
+			if (!F) {
+				XAIEFAL_LOG(ERROR) << "func profile " << __func__ <<
+					" failed to open " << ElfPath << '\n';
+				return XAIE_INVALID_ELF;
+			}
+			vElf.assign(std::istreambuf_iterator<char>(F),
+				std::istreambuf_iterator<char>());
+			return XAIE_OK;
+		}
+		/**
+		 * This function adds a function of the loaded elf to profile.
+		 *
+		 * @param Name name of the function symbol
+		 * @param Index returns the index of the function in the results
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC addFunction(const std::string &Name, uint32_t &Index) {
+			u32 Addr, Size;
+			AieRC RC;
+
+			if (vElf.empty()) {
+				XAIEFAL_LOG(ERROR) << "func profile " << __func__ <<
+					" no elf loaded." << '\n';
+				return XAIE_ERR;
+			}
+			RC = XAie_PcProfileFindFunc(
+				reinterpret_cast<const unsigned char *>(vElf.data()),
+				Name.c_str(), &Addr, &Size);
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+			return addFunction(Name, Addr, Size, Index);
+		}
+		/**
+		 * This function adds a code address range to profile.
+		 *
+		 * @param Name name reported for the range
+		 * @param Addr start address of the range
+		 * @param Size size of the range in bytes
+		 * @param Index returns the index of the range in the results
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC addFunction(const std::string &Name, uint32_t Addr,
+				uint32_t Size, uint32_t &Index) {
+			if (Running || Size == 0) {
+				XAIEFAL_LOG(ERROR) << "func profile " << __func__ <<
+					" running or empty function " << Name << '\n';
+				return XAIE_ERR;
+			}
+			vFuncs.push_back({Name, Addr, Addr + Size, 0, 0, 0});
+			Index = static_cast<uint32_t>(vFuncs.size() - 1);
+			return XAIE_OK;
+		}
+		/**
+		 * This function reserves the slots of the profiler. As many
+		 * slots as PC ranges and perf counters are available, up to one
+		 * per function, are reserved; at least one has to be.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC reserve() {
+			if (!vSlots.empty() || vFuncs.empty()) {
+				XAIEFAL_LOG(ERROR) << "func profile " << __func__ <<
+					" already reserved or no function." << '\n';
+				return XAIE_ERR;
+			}
+			while (vSlots.size() < vFuncs.size()) {
+				Slot S;
+
+				if (_reserveSlot(S) != XAIE_OK) {
+					break;
+				}
+				vSlots.push_back(S);
+			}
+			if (vSlots.empty()) {
+				XAIEFAL_LOG(ERROR) << "func profile " << __func__ <<
+					" (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ")" <<
+					" no PC range or perf counter available." <<
+					'\n';
+				return XAIE_ERR;
+			}
+			return XAIE_OK;
+		}
+		/**
+		 * This function releases the slots of the profiler.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC release() {
+			if (Running) {
+				XAIEFAL_LOG(ERROR) << "func profile " << __func__ <<
+					" profiler is running." << '\n';
+				return XAIE_ERR;
+			}
+			for (auto &S: vSlots) {
+				S.Cycles->release();
+				S.Calls->release();
+				S.Range->release();
+			}
+			vSlots.clear();
+			return XAIE_OK;
+		}
+		/**
+		 * This function clears the results and starts profiling the
+		 * first functions.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC start() {
+			AieRC RC = XAIE_OK;
+
+			if (Running || vSlots.empty()) {
+				XAIEFAL_LOG(ERROR) << "func profile " << __func__ <<
+					" running or not reserved." << '\n';
+				return XAIE_ERR;
+			}
+			for (auto &F: vFuncs) {
+				F.Cycles = 0;
+				F.Calls = 0;
+				F.ActiveNs = 0;
+			}
+			Next = 0;
+			for (auto &S: vSlots) {
+				S.Func = Next;
+				Next = (Next + 1) % vFuncs.size();
+				RC = S.Range->updatePcAddr(vFuncs[S.Func].Addr0,
+					vFuncs[S.Func].Addr1);
+				if (RC == XAIE_OK) {
+					RC = S.Range->start();
+				}
+				if (RC == XAIE_OK) {
+					RC = S.Cycles->start();
+				}
+				if (RC == XAIE_OK) {
+					RC = S.Calls->start();
+				}
+				if (RC != XAIE_OK) {
+					_stopSlots();
+					return RC;
+				}
+			}
+			StartNs = _nowNs();
+			LastNs = StartNs;
+			Running = true;
+			return XAIE_OK;
+		}
+		/**
+		 * This function accumulates the counts of the functions being
+		 * profiled and, if there are more functions than slots, moves
+		 * the slots to the next functions. It is to be called
+		 * periodically, often enough for the 32-bit counters not to
+		 * wrap.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC rotate() {
+			AieRC RC;
+			uint64_t Now;
+
+			if (!Running) {
+				XAIEFAL_LOG(ERROR) << "func profile " << __func__ <<
+					" profiler not running." << '\n';
+				return XAIE_ERR;
+			}
+			Now = _nowNs();
+			RC = _collect(Now);
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+			for (auto &S: vSlots) {
+				XAie_LocType L;
+				XAie_ModuleType M;
+				uint32_t Id;
+
+				/* slots stay on their function if all have one */
+				if (vFuncs.size() > vSlots.size()) {
+					S.Func = Next;
+					Next = (Next + 1) % vFuncs.size();
+					RC = S.Range->updatePcAddr(
+						vFuncs[S.Func].Addr0,
+						vFuncs[S.Func].Addr1);
+				}
+				if (RC == XAIE_OK) {
+					RC = S.Cycles->getRscId(L, M, Id);
+				}
+				if (RC == XAIE_OK) {
+					RC = XAie_PerfCounterReset(AieHd->dev(), L,
+						M, Id);
+				}
+				if (RC == XAIE_OK) {
+					RC = S.Calls->getRscId(L, M, Id);
+				}
+				if (RC == XAIE_OK) {
+					RC = XAie_PerfCounterReset(AieHd->dev(), L,
+						M, Id);
+				}
+				if (RC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "func profile " <<
+						__func__ << " failed to move slot." <<
+						'\n';
+					return RC;
+				}
+			}
+			return XAIE_OK;
+		}
+		/**
+		 * This function accumulates the last counts and stops
+		 * profiling. The results stay available.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC stop() {
+			AieRC RC;
+
+			if (!Running) {
+				return XAIE_OK;
+			}
+			StopNs = _nowNs();
+			RC = _collect(StopNs);
+			_stopSlots();
+			Running = false;
+			return RC;
+		}
+		/**
+		 * This function returns the results of a function.
+		 *
+		 * @param Index index of the function returned by addFunction()
+		 * @param S returns the results
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC getStats(uint32_t Index, FuncStats &S) const {
+			double Scale;
+
+			if (Index >= vFuncs.size()) {
+				XAIEFAL_LOG(ERROR) << "func profile " << __func__ <<
+					" invalid index " << Index << '\n';
+				return XAIE_INVALID_ARGS;
+			}
+			const Func &F = vFuncs[Index];
+
+			S.Cycles = F.Cycles;
+			S.Calls = F.Calls;
+			S.ActiveNs = F.ActiveNs;
+			S.TotalNs = (Running ? LastNs : StopNs) - StartNs;
+			Scale = (F.ActiveNs == 0) ? 0.0 :
+				static_cast<double>(S.TotalNs) / F.ActiveNs;
+			S.EstCycles = static_cast<uint64_t>(F.Cycles * Scale + 0.5);
+			S.EstCalls = static_cast<uint64_t>(F.Calls * Scale + 0.5);
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the name of a function.
+		 *
+		 * @param Index index of the function returned by addFunction()
+		 * @return name of the function
+		 */
+		const std::string &getName(uint32_t Index) const {
+			return vFuncs.at(Index).Name;
+		}
+		uint32_t size() const {
+			return static_cast<uint32_t>(vFuncs.size());
+		}
+	private:
+		/* function profiled */
+		struct Func {
+			std::string Name;
+			uint32_t Addr0; /**< start address */
+			uint32_t Addr1; /**< end address, excluded */
+			uint64_t Cycles;
+			uint64_t Calls;
+			uint64_t ActiveNs; /**< time the function was profiled */
+		};
+		/* PC range and counters profiling one function at a time */
+		struct Slot {
+			std::shared_ptr<XAiePCRange> Range;
+			std::shared_ptr<XAiePerfCounter> Cycles;
+			std::shared_ptr<XAiePerfCounter> Calls;
+			uint32_t Func; /**< index of the function profiled */
+		};
+
+		std::shared_ptr<XAieDevHandle> AieHd; /**< AI engine device */
+		XAie_LocType Loc; /**< tile of the core */
+		uint32_t Next; /**< next function to profile */
+		bool Running;
+		uint64_t StartNs = 0; /**< time profiling started */
+		uint64_t StopNs = 0; /**< time profiling stopped */
+		uint64_t LastNs = 0; /**< time of the last rotation */
+		std::vector<char> vElf; /**< elf to resolve names */
+		std::vector<Func> vFuncs;
+		std::vector<Slot> vSlots;
+
+		static uint64_t _nowNs() {
+			return std::chrono::duration_cast<
+				std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().
+				time_since_epoch()).count();
+		}
+		AieRC _reserveSlot(Slot &S) {
+			XAie_Events RangeE, EntryE;
+			AieRC RC;
+
+			S.Range = std::make_shared<XAiePCRange>(AieHd, Loc);
+			RC = S.Range->reserve();
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+			S.Range->getEvent(RangeE);
+			/* the start PC event of the range fires on each call */
+			EntryE = (RangeE == XAIE_EVENT_PC_RANGE_0_1_CORE) ?
+				XAIE_EVENT_PC_0_CORE : XAIE_EVENT_PC_2_CORE;
+
+			S.Cycles = std::make_shared<XAiePerfCounter>(AieHd, Loc,
+				XAIE_CORE_MOD);
+			S.Calls = std::make_shared<XAiePerfCounter>(AieHd, Loc,
+				XAIE_CORE_MOD);
+			RC = S.Cycles->initialize(XAIE_CORE_MOD, RangeE,
+				XAIE_CORE_MOD, RangeE);
+			if (RC == XAIE_OK) {
+				RC = S.Calls->initialize(XAIE_CORE_MOD, EntryE,
+					XAIE_CORE_MOD, EntryE);
+			}
+			if (RC == XAIE_OK) {
+				RC = S.Cycles->reserve();
+			}
+			if (RC == XAIE_OK) {
+				RC = S.Calls->reserve();
+				if (RC != XAIE_OK) {
+					S.Cycles->release();
+				}
+			}
+			if (RC != XAIE_OK) {
+				S.Range->release();
+			}
+			S.Func = 0;
+			return RC;
+		}
+		AieRC _collect(uint64_t Now) {
+			for (auto &S: vSlots) {
+				uint32_t Cycles, Calls;
+				AieRC RC;
+
+				RC = S.Cycles->readResult(Cycles);
+				if (RC == XAIE_OK) {
+					RC = S.Calls->readResult(Calls);
+				}
+				if (RC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "func profile " <<
+						__func__ << " failed to read counters." <<
+						'\n';
+					return RC;
+				}
+				vFuncs[S.Func].Cycles += Cycles;
+				vFuncs[S.Func].Calls += Calls;
+				vFuncs[S.Func].ActiveNs += Now - LastNs;
+			}
+			LastNs = Now;
+			return XAIE_OK;
+		}
+		void _stopSlots() {
+			for (auto &S: vSlots) {
+				S.Calls->stop();
+				S.Cycles->stop();
+				S.Range->stop();
+			}
+		}
+	};
+}
@@ -0,0 +1,274 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <memory>
+#include <vector>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/profile/xaiefal-perf-collector.hpp>
+#include <xaiefal/profile/xaiefal-profile.hpp>
+#include <xaiefal/rsc/xaiefal-rsc-batch.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * Metrics of a graph profile
+	 */
+	enum XAieProfileMetric {
+		XAIE_PROFILE_ACTIVE_CYCLES, /**< core active cycles */
+		XAIE_PROFILE_STALL_CYCLES, /**< core stall cycles */
+		XAIE_PROFILE_STALL_OCCURRENCES, /**< core stalls */
+		XAIE_PROFILE_DMA_S2MM_CYCLES, /**< cycles of S2MM channel 0 transfers */
+		XAIE_PROFILE_DMA_MM2S_CYCLES, /**< cycles of MM2S channel 0 transfers */
+		XAIE_PROFILE_MAX_METRICS
+	};
+
+	/**
+	 * @class XAieGraphProfile
+	 * @brief Profiles a set of AIE tiles with a list of metrics.
+	 *	  One perf counter is used per tile and metric. The counters
+	 *	  are reserved and started as one resource batch, so the profile
+	 *	  starts all or nothing in one driver transaction. They are read
+	 *	  with a perf collector, one block read per module, and the
+	 *	  32-bit counter values are accumulated to 64-bit totals at each
+	 *	  sample.
+	 *	  The stall metrics of a tile share the stall group event of the
+	 *	  core module.
+	 *	  sample() has to be called periodically, at least once per
+	 *	  counter wrap period, which is about 4 seconds at 1 GHz.
+	 */
+	class XAieGraphProfile {
+	public:
+		XAieGraphProfile() = delete;
+		XAieGraphProfile(XAieDev &Dev, const std::vector<XAie_LocType> &vL,
+			const std::vector<XAieProfileMetric> &vM):
+			AieDev(Dev), vLocs(vL),
+			vMetrics(vM) {}
+		XAieGraphProfile(const XAieGraphProfile &) = delete;
+		XAieGraphProfile &operator=(const XAieGraphProfile &) = delete;
+		~XAieGraphProfile() {
+			stop();
+		}
+		/**
+		 * This function allocates and starts the counters of all the
+		 * tiles and metrics.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC start() {
+			AieRC RC;
+
+			if (!vCounters.empty()) {
+				XAIEFAL_LOG(ERROR) << "graph profile " << __func__ <<
+					" already started." << '\n';
+				return XAIE_ERR;
+			}
+			for (auto L: vLocs) {
+				if (_XAie_GetTileTypefromLoc(AieDev.dev(), L) !=
+					XAIEGBL_TILE_TYPE_AIETILE) {
+					XAIEFAL_LOG(ERROR) << "graph profile " << __func__ <<
+						" (" << (uint32_t)L.Col << "," <<
+						(uint32_t)L.Row << ") is not an AIE tile." <<
+						'\n';
+					return XAIE_INVALID_TILE;
+				}
+			}
+			for (auto M: vMetrics) {
+				if (M >= XAIE_PROFILE_MAX_METRICS) {
+					XAIEFAL_LOG(ERROR) << "graph profile " << __func__ <<
+						" invalid metric " << M << "." << '\n';
+					return XAIE_INVALID_ARGS;
+				}
+			}
+			Batch.reset(new XAieRscBatch(AieDev));
+			Collector.reset(new XAiePerfCollector(AieDev));
+			for (auto L: vLocs) {
+				for (auto M: vMetrics) {
+					auto C = _createCounter(L, M);
+
+					vCounters.push_back(C);
+					Batch->add(C);
+				}
+			}
+			RC = Batch->reserve();
+			if (RC == XAIE_OK) {
+				RC = Batch->start();
+				if (RC != XAIE_OK) {
+					Batch->release();
+				}
+			}
+			if (RC == XAIE_OK) {
+				for (auto &C: vCounters) {
+					Collector->addCounter(C);
+				}
+				RC = Collector->prepare();
+				if (RC != XAIE_OK) {
+					Batch->stop();
+					Batch->release();
+				}
+			}
+			if (RC != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << "graph profile " << __func__ <<
+					" failed to allocate counters." << '\n';
+				_reset();
+				return RC;
+			}
+			Last.assign(vCounters.size(), 0);
+			Totals.assign(vCounters.size(), 0);
+			return Collector->read(Last);
+		}
+		/**
+		 * This function reads all the counters in one sweep and adds
+		 * the counts since the previous sample to the totals.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC sample() {
+			AieRC RC;
+
+			if (vCounters.empty()) {
+				XAIEFAL_LOG(ERROR) << "graph profile " << __func__ <<
+					" not started." << '\n';
+				return XAIE_ERR;
+			}
+			RC = Collector->read();
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+			for (uint32_t i = 0; i < Totals.size(); i++) {
+				uint32_t V = Collector->result(i);
+
+				/* unsigned difference also covers counter wrap */
+				Totals[i] += static_cast<uint32_t>(V - Last[i]);
+				Last[i] = V;
+			}
+			return XAIE_OK;
+		}
+		/**
+		 * This function stops and releases the counters. The totals
+		 * are kept until the profile is started again.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC stop() {
+			AieRC RC = XAIE_OK;
+
+			if (vCounters.empty()) {
+				return RC;
+			}
+			RC = Batch->stop();
+			if (RC == XAIE_OK) {
+				RC = Batch->release();
+			}
+			_reset();
+			return RC;
+		}
+		/**
+		 * This function returns the total of a metric of a tile at the
+		 * last sample.
+		 *
+		 * @param TileIdx index of the tile in the profile tiles
+		 * @param M metric
+		 * @return total, 0 if the metric is not profiled
+		 */
+		uint64_t result(uint32_t TileIdx, XAieProfileMetric M) const {
+			uint32_t MIdx = _metricIdx(M);
+
+			if (TileIdx >= vLocs.size() || MIdx >= vMetrics.size() ||
+				Totals.empty()) {
+				return 0;
+			}
+			return Totals[TileIdx * vMetrics.size() + MIdx];
+		}
+		/**
+		 * This function returns the sum of a metric over all the tiles
+		 * at the last sample.
+		 *
+		 * @param M metric
+		 * @return sum, 0 if the metric is not profiled
+		 */
+		uint64_t total(XAieProfileMetric M) const {
+			uint64_t Sum = 0;
+
+			for (uint32_t t = 0; t < vLocs.size(); t++) {
+				Sum += result(t, M);
+			}
+			return Sum;
+		}
+		/**
+		 * This function returns the tiles of the profile.
+		 *
+		 * @return tile locations
+		 */
+		const std::vector<XAie_LocType> &tiles() const {
+			return vLocs;
+		}
+	private:
+		XAieDev &AieDev; /**< AI engine device */
+		std::unique_ptr<XAieRscBatch> Batch; /**< counters started together */
+		std::unique_ptr<XAiePerfCollector> Collector; /**< counters read per sample */
+		std::vector<XAie_LocType> vLocs; /**< profiled tiles */
+		std::vector<XAieProfileMetric> vMetrics; /**< profiled metrics */
+		/* counters, tile major, in the order of vLocs and vMetrics */
+		std::vector<std::shared_ptr<XAiePerfCounter>> vCounters;
+		std::vector<uint32_t> Last; /**< counter values of last sample */
+		std::vector<uint64_t> Totals; /**< counts since start */
+
+		std::shared_ptr<XAiePerfCounter> _createCounter(XAie_LocType L,
+				XAieProfileMetric M) {
+			auto &Tile = AieDev.tile(L);
+			switch (M) {
+			case XAIE_PROFILE_ACTIVE_CYCLES:
+				return Tile.core().activeCycles();
+			case XAIE_PROFILE_STALL_CYCLES:
+				return Tile.core().stallCycles();
+			case XAIE_PROFILE_STALL_OCCURRENCES:
+				return Tile.core().stallOccurrences();
+			case XAIE_PROFILE_DMA_S2MM_CYCLES:
+				return _dmaCounter(Tile, XAIE_EVENT_DMA_S2MM_0_START_BD_MEM,
+					XAIE_EVENT_DMA_S2MM_0_FINISHED_BD_MEM,
+					XAIE_EVENT_DMA_S2MM_0_START_TASK_MEM,
+					XAIE_EVENT_DMA_S2MM_0_FINISHED_TASK_MEM);
+			default:
+				return _dmaCounter(Tile, XAIE_EVENT_DMA_MM2S_0_START_BD_MEM,
+					XAIE_EVENT_DMA_MM2S_0_FINISHED_BD_MEM,
+					XAIE_EVENT_DMA_MM2S_0_START_TASK_MEM,
+					XAIE_EVENT_DMA_MM2S_0_FINISHED_TASK_MEM);
+			}
+		}
+		/*
+		 * DMA counters count from the start to the end of a transfer:
+		 * a BD on AIE, a task on later generations.
+		 */
+		std::shared_ptr<XAiePerfCounter> _dmaCounter(XAieTile &Tile,
+				XAie_Events StartBd, XAie_Events EndBd,
+				XAie_Events StartTask, XAie_Events EndTask) {
+			auto C = Tile.mem().perfCounter();
+
+			if (AieDev.dev()->DevProp.DevGen == XAIE_DEV_GEN_AIE) {
+				C->initialize(XAIE_MEM_MOD, StartBd, XAIE_MEM_MOD, EndBd);
+			} else {
+				C->initialize(XAIE_MEM_MOD, StartTask, XAIE_MEM_MOD,
+					EndTask);
+			}
+			return C;
+		}
+		uint32_t _metricIdx(XAieProfileMetric M) const {
+			uint32_t i;
+
+			for (i = 0; i < vMetrics.size(); i++) {
+				if (vMetrics[i] == M) {
+					break;
+				}
+			}
+			return i;
+		}
+		void _reset() {
+			vCounters.clear();
+			Batch.reset();
+			Collector.reset();
+		}
+	};
+}
@@ -0,0 +1,532 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/profile/xaiefal-perf-collector.hpp>
+#include <xaiefal/rsc/xaiefal-perf.hpp>
+#include <xaiefal/rsc/xaiefal-rsc-batch.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @struct XAieLockWaiterStats
+	 * @brief Wait cycles of one waiter of a profiled lock.
+	 */
+	struct XAieLockWaiterStats {
+		XAie_LocType Loc; /**< tile of the waiter */
+		bool Core; /**< core waiter, else DMA channel waiter */
+		XAie_DmaDirection Dir; /**< direction of a DMA channel waiter */
+		uint8_t ChNum; /**< channel of a DMA channel waiter */
+		uint64_t WaitCycles; /**< cycles stalled on a lock */
+	};
+
+	/**
+	 * @struct XAieLockStats
+	 * @brief Contention of one profiled lock.
+	 */
+	struct XAieLockStats {
+		std::string Name; /**< name given to the lock */
+		XAie_LocType Loc; /**< tile of the lock */
+		uint8_t LockId; /**< lock in the tile */
+		bool CountOps; /**< acquires and releases are counted */
+		uint64_t Acquires; /**< acquires of the lock */
+		uint64_t Releases; /**< releases of the lock */
+		uint64_t WaitCycles; /**< wait cycles of all the waiters */
+		std::vector<XAieLockWaiterStats> vWaiters;
+
+		/**
+		 * This function returns the average wait per acquire.
+		 *
+		 * @return average wait cycles, 0 if no acquire is counted
+		 */
+		double avgWaitCycles() const {
+			if (Acquires == 0) {
+				return 0.0;
+			}
+			return static_cast<double>(WaitCycles) / Acquires;
+		}
+	};
+
+	/**
+	 * @class XAieLockProfiler
+	 * @brief Profiles the contention of a set of locks.
+	 *	  The acquires and releases of each lock are counted with the
+	 *	  lock events of the tile of the lock, and the cycles its
+	 *	  waiters, cores or DMA channels, are stalled on a lock are
+	 *	  counted with their lock stall events. As the stall events do
+	 *	  not tell which lock is waited for, each waiter is attributed
+	 *	  to the lock it is added to.
+	 *	  On AIE each lock has its own events. On later generations the
+	 *	  lock events come from the lock event selections of the tile,
+	 *	  which the profiler allocates in order from selection 0 and
+	 *	  programs when it starts; selections programmed by others on
+	 *	  the same tiles are overwritten. Acquires are counted with the
+	 *	  acquire greater or equal event there.
+	 *	  Counting the operations of a lock takes two perf counters of
+	 *	  the module of the lock, and each waiter one perf counter of
+	 *	  its module. The counters are reserved and started as one
+	 *	  resource batch, and read with a perf collector.
+	 *	  sample() has to be called periodically, at least once per
+	 *	  counter wrap period.
+	 */
+	class XAieLockProfiler {
+	public:
+		XAieLockProfiler() = delete;
+		XAieLockProfiler(XAieDev &Dev): AieDev(Dev) {}
+		XAieLockProfiler(const XAieLockProfiler &) = delete;
+		XAieLockProfiler &operator=(const XAieLockProfiler &) = delete;
+		~XAieLockProfiler() {
+			stop();
+		}
+		/**
+		 * This function adds a lock to the profile.
+		 *
+		 * @param L tile of the lock
+		 * @param LockId lock in the tile
+		 * @param Name name of the lock in the report
+		 * @param CountOps true to count the acquires and releases of
+		 *	  the lock, false to only count the waits of its waiters
+		 * @return index of the lock in the profile
+		 */
+		uint32_t addLock(XAie_LocType L, uint8_t LockId,
+				const std::string &Name = "", bool CountOps = true) {
+			LockEntry E;
+
+			E.Stats.Name = Name;
+			E.Stats.Loc = L;
+			E.Stats.LockId = LockId;
+			E.Stats.CountOps = CountOps;
+			E.Stats.Acquires = 0;
+			E.Stats.Releases = 0;
+			E.Stats.WaitCycles = 0;
+			vLocks.push_back(E);
+			return static_cast<uint32_t>(vLocks.size() - 1);
+		}
+		/**
+		 * This function adds a core waiting on a lock of the profile.
+		 *
+		 * @param LockIdx index of the lock returned by addLock()
+		 * @param L AIE tile of the core
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC addCoreWaiter(uint32_t LockIdx, XAie_LocType L) {
+			return _addWaiter(LockIdx, L, true, DMA_S2MM, 0);
+		}
+		/**
+		 * This function adds a DMA channel waiting on a lock of the
+		 * profile. On memory tiles, the channel is one of the two
+		 * channels selected for the DMA events of the direction.
+		 *
+		 * @param LockIdx index of the lock returned by addLock()
+		 * @param L tile of the DMA
+		 * @param Dir DMA direction
+		 * @param ChNum channel, 0 or 1
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC addDmaWaiter(uint32_t LockIdx, XAie_LocType L,
+				XAie_DmaDirection Dir, uint8_t ChNum) {
+			if ((Dir != DMA_S2MM && Dir != DMA_MM2S) || ChNum > 1) {
+				XAIEFAL_LOG(ERROR) << "lock profile " << __func__ <<
+					" invalid DMA channel." << '\n';
+				return XAIE_INVALID_ARGS;
+			}
+			return _addWaiter(LockIdx, L, false, Dir, ChNum);
+		}
+		/**
+		 * This function selects the lock events, then allocates and
+		 * starts the counters of all the locks and waiters.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC start() {
+			std::map<uint32_t, uint8_t> NextSel;
+			AieRC RC = XAIE_OK;
+
+			if (!vCounters.empty()) {
+				XAIEFAL_LOG(ERROR) << "lock profile " << __func__ <<
+					" already started." << '\n';
+				return XAIE_ERR;
+			}
+			Batch.reset(new XAieRscBatch(AieDev));
+			Collector.reset(new XAiePerfCollector(AieDev));
+			for (auto &E: vLocks) {
+				XAie_LocType L = E.Stats.Loc;
+
+				E.Stats.Acquires = 0;
+				E.Stats.Releases = 0;
+				E.Stats.WaitCycles = 0;
+				if (E.Stats.CountOps) {
+					uint32_t Key = ((uint32_t)L.Col << 8) | L.Row;
+
+					RC = _addLockCounters(E, NextSel[Key]);
+					if (RC != XAIE_OK) {
+						break;
+					}
+				}
+				for (auto &W: E.vWaiters) {
+					W.Stats.WaitCycles = 0;
+					RC = _addWaiterCounter(W);
+					if (RC != XAIE_OK) {
+						break;
+					}
+				}
+				if (RC != XAIE_OK) {
+					break;
+				}
+			}
+			if (RC == XAIE_OK) {
+				RC = Batch->reserve();
+				if (RC == XAIE_OK) {
+					RC = Batch->start();
+					if (RC != XAIE_OK) {
+						Batch->release();
+					}
+				}
+				if (RC == XAIE_OK) {
+					for (auto &C: vCounters) {
+						Collector->addCounter(C);
+					}
+					RC = Collector->prepare();
+					if (RC != XAIE_OK) {
+						Batch->stop();
+						Batch->release();
+					}
+				}
+				if (RC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "lock profile " <<
+						__func__ << " failed to allocate counters." <<
+						'\n';
+				}
+			}
+			if (RC != XAIE_OK) {
+				_reset();
+				return RC;
+			}
+			Last.assign(vCounters.size(), 0);
+			return Collector->read(Last);
+		}
+		/**
+		 * This function reads all the counters in one sweep and adds
+		 * the counts since the previous sample to the lock statistics.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC sample() {
+			AieRC RC;
+
+			if (vCounters.empty()) {
+				XAIEFAL_LOG(ERROR) << "lock profile " << __func__ <<
+					" not started." << '\n';
+				return XAIE_ERR;
+			}
+			RC = Collector->read();
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+			for (auto &E: vLocks) {
+				if (E.Stats.CountOps) {
+					E.Stats.Acquires += _delta(E.AcqIdx);
+					E.Stats.Releases += _delta(E.RelIdx);
+				}
+				for (auto &W: E.vWaiters) {
+					uint64_t D = _delta(W.Idx);
+
+					W.Stats.WaitCycles += D;
+					E.Stats.WaitCycles += D;
+				}
+			}
+			return XAIE_OK;
+		}
+		/**
+		 * This function stops and releases the counters. The
+		 * statistics are kept until the profile is started again.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC stop() {
+			AieRC RC = XAIE_OK;
+
+			if (vCounters.empty()) {
+				return RC;
+			}
+			RC = Batch->stop();
+			if (RC == XAIE_OK) {
+				RC = Batch->release();
+			}
+			_reset();
+			return RC;
+		}
+		/**
+		 * This function returns the statistics of a lock at the last
+		 * sample.
+		 *
+		 * @param LockIdx index of the lock returned by addLock()
+		 * @return lock statistics
+		 */
+		XAieLockStats result(uint32_t LockIdx) const {
+			XAieLockStats S = vLocks.at(LockIdx).Stats;
+
+			for (auto &W: vLocks[LockIdx].vWaiters) {
+				S.vWaiters.push_back(W.Stats);
+			}
+			return S;
+		}
+		/**
+		 * This function returns the number of locks of the profile.
+		 *
+		 * @return number of locks
+		 */
+		uint32_t size() const {
+			return static_cast<uint32_t>(vLocks.size());
+		}
+		/**
+		 * This function writes the statistics of all the locks, the
+		 * most waited for lock first.
+		 *
+		 * @param Os output stream
+		 */
+		void report(std::ostream &Os) const {
+			std::vector<uint32_t> vOrder(vLocks.size());
+
+			for (uint32_t i = 0; i < vOrder.size(); i++) {
+				vOrder[i] = i;
+			}
+			std::stable_sort(vOrder.begin(), vOrder.end(),
+				[this](uint32_t A, uint32_t B) {
+					return vLocks[A].Stats.WaitCycles >
+						vLocks[B].Stats.WaitCycles;
+				});
+			for (auto i: vOrder) {
+				const XAieLockStats &S = vLocks[i].Stats;
+
+				Os << "lock " << (S.Name.empty() ? std::to_string(i) :
+					S.Name) << " (" << (uint32_t)S.Loc.Col << "," <<
+					(uint32_t)S.Loc.Row << ")#" <<
+					(uint32_t)S.LockId << ":";
+				if (S.CountOps) {
+					Os << " acquires " << S.Acquires <<
+						" releases " << S.Releases;
+				}
+				Os << " wait cycles " << S.WaitCycles;
+				if (S.CountOps) {
+					Os << " avg wait " << S.avgWaitCycles();
+				}
+				Os << '\n';
+				for (auto &W: vLocks[i].vWaiters) {
+					Os << "  " << (W.Stats.Core ? "core" :
+						(W.Stats.Dir == DMA_S2MM ? "s2mm" : "mm2s")) <<
+						" (" << (uint32_t)W.Stats.Loc.Col << "," <<
+						(uint32_t)W.Stats.Loc.Row << ")";
+					if (!W.Stats.Core) {
+						Os << " ch " << (uint32_t)W.Stats.ChNum;
+					}
+					Os << ": wait cycles " << W.Stats.WaitCycles <<
+						'\n';
+				}
+			}
+		}
+	private:
+		/* waiter of a lock and the index of its counter */
+		struct WaiterEntry {
+			XAieLockWaiterStats Stats;
+			uint32_t Idx;
+		};
+		/* lock and the indexes of its counters */
+		struct LockEntry {
+			XAieLockStats Stats;
+			std::vector<WaiterEntry> vWaiters;
+			uint32_t AcqIdx;
+			uint32_t RelIdx;
+		};
+
+		XAieDev &AieDev; /**< AI engine device */
+		std::unique_ptr<XAieRscBatch> Batch; /**< counters started together */
+		std::unique_ptr<XAiePerfCollector> Collector; /**< counters read per sample */
+		std::vector<LockEntry> vLocks; /**< profiled locks */
+		std::vector<std::shared_ptr<XAiePerfCounter>> vCounters;
+		std::vector<uint32_t> Last; /**< counter values of last sample */
+
+		AieRC _addWaiter(uint32_t LockIdx, XAie_LocType L, bool Core,
+				XAie_DmaDirection Dir, uint8_t ChNum) {
+			WaiterEntry W;
+
+			if (LockIdx >= vLocks.size()) {
+				XAIEFAL_LOG(ERROR) << "lock profile " << __func__ <<
+					" invalid lock " << LockIdx << "." << '\n';
+				return XAIE_INVALID_ARGS;
+			}
+			if (!vCounters.empty()) {
+				XAIEFAL_LOG(ERROR) << "lock profile " << __func__ <<
+					" profile is started." << '\n';
+				return XAIE_ERR;
+			}
+			W.Stats.Loc = L;
+			W.Stats.Core = Core;
+			W.Stats.Dir = Dir;
+			W.Stats.ChNum = ChNum;
+			W.Stats.WaitCycles = 0;
+			vLocks[LockIdx].vWaiters.push_back(W);
+			return XAIE_OK;
+		}
+		/*
+		 * Counts the acquires and releases of a lock. On generations
+		 * after AIE, the next free lock event selection of the tile is
+		 * pointed to the lock first.
+		 */
+		AieRC _addLockCounters(LockEntry &E, uint8_t &NextSel) {
+			XAie_LocType L = E.Stats.Loc;
+			uint8_t TType = _XAie_GetTileTypefromLoc(AieDev.dev(), L);
+			bool IsAie = AieDev.dev()->DevProp.DevGen ==
+				XAIE_DEV_GEN_AIE;
+			uint32_t Id = E.Stats.LockId;
+			XAie_ModuleType M = XAIE_MEM_MOD;
+			XAie_Events Acq, Rel;
+
+			if (IsAie) {
+				/* AIE tiles and shim NoC tiles have 16 locks */
+				if (Id >= 16 || (TType != XAIEGBL_TILE_TYPE_AIETILE &&
+					TType != XAIEGBL_TILE_TYPE_SHIMNOC)) {
+					XAIEFAL_LOG(ERROR) << "lock profile " << __func__ <<
+						" invalid lock " << Id << " of tile (" <<
+						(uint32_t)L.Col << "," << (uint32_t)L.Row <<
+						")." << '\n';
+					return XAIE_INVALID_ARGS;
+				}
+				if (TType == XAIEGBL_TILE_TYPE_AIETILE) {
+					Acq = _event(XAIE_EVENT_LOCK_0_ACQ_MEM, 2 * Id);
+				} else {
+					M = XAIE_PL_MOD;
+					Acq = _event(XAIE_EVENT_LOCK_0_ACQUIRED_PL, 2 * Id);
+				}
+				Rel = _event(Acq, 1);
+			} else {
+				uint8_t NumSels = 0;
+				uint32_t Sel = NextSel;
+				AieRC RC;
+
+				RC = XAie_LockGetNumEventSels(AieDev.dev(), L, &NumSels);
+				if (RC != XAIE_OK) {
+					return RC;
+				}
+				if (Sel >= NumSels) {
+					XAIEFAL_LOG(ERROR) << "lock profile " << __func__ <<
+						" no lock event selection left in tile (" <<
+						(uint32_t)L.Col << "," << (uint32_t)L.Row <<
+						")." << '\n';
+					return XAIE_ERR_OUTOFBOUND;
+				}
+				RC = XAie_LockEventSelect(AieDev.dev(), L, Sel, Id, 0);
+				if (RC != XAIE_OK) {
+					return RC;
+				}
+				NextSel++;
+				if (TType == XAIEGBL_TILE_TYPE_AIETILE) {
+					Acq = _event(XAIE_EVENT_LOCK_SEL0_ACQ_GE_MEM, 3 * Sel);
+					Rel = _event(XAIE_EVENT_LOCK_0_REL_MEM, 2 * Sel);
+				} else if (TType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+					M = XAIE_PL_MOD;
+					Acq = _event(XAIE_EVENT_LOCK_0_ACQ_GE_PL, 3 * Sel);
+					Rel = _event(XAIE_EVENT_LOCK_0_RELEASED_PL, 2 * Sel);
+				} else {
+					Acq = _event(XAIE_EVENT_LOCK_SEL0_ACQ_GE_MEM_TILE,
+						4 * Sel);
+					Rel = _event(Acq, 1);
+				}
+			}
+			E.AcqIdx = _addCounter(L, M, Acq);
+			E.RelIdx = _addCounter(L, M, Rel);
+			if (E.AcqIdx == UINT32_MAX || E.RelIdx == UINT32_MAX) {
+				return XAIE_INVALID_ARGS;
+			}
+			return XAIE_OK;
+		}
+		/* Counts the cycles a waiter is stalled on a lock */
+		AieRC _addWaiterCounter(WaiterEntry &W) {
+			XAie_LocType L = W.Stats.Loc;
+			uint8_t TType = _XAie_GetTileTypefromLoc(AieDev.dev(), L);
+			bool IsAie = AieDev.dev()->DevProp.DevGen ==
+				XAIE_DEV_GEN_AIE;
+			uint32_t Off = (W.Stats.Dir == DMA_MM2S ? 2 : 0) +
+				W.Stats.ChNum;
+			XAie_ModuleType M = XAIE_MEM_MOD;
+			XAie_Events E;
+
+			if (W.Stats.Core) {
+				if (TType != XAIEGBL_TILE_TYPE_AIETILE) {
+					XAIEFAL_LOG(ERROR) << "lock profile " << __func__ <<
+						" (" << (uint32_t)L.Col << "," <<
+						(uint32_t)L.Row << ") is not an AIE tile." <<
+						'\n';
+					return XAIE_INVALID_TILE;
+				}
+				M = XAIE_CORE_MOD;
+				E = XAIE_EVENT_LOCK_STALL_CORE;
+			} else if (TType == XAIEGBL_TILE_TYPE_AIETILE) {
+				E = _event(IsAie ?
+					XAIE_EVENT_DMA_S2MM_0_STALLED_LOCK_ACQUIRE_MEM :
+					XAIE_EVENT_DMA_S2MM_0_STALLED_LOCK_MEM, Off);
+			} else if (TType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+				M = XAIE_PL_MOD;
+				E = _event(IsAie ?
+					XAIE_EVENT_DMA_S2MM_0_STALLED_LOCK_ACQUIRE_PL :
+					XAIE_EVENT_DMA_S2MM_0_STALLED_LOCK_PL, Off);
+			} else if (TType == XAIEGBL_TILE_TYPE_MEMTILE) {
+				E = _event(
+					XAIE_EVENT_DMA_S2MM_SEL0_STALLED_LOCK_ACQUIRE_MEM_TILE,
+					Off);
+			} else {
+				XAIEFAL_LOG(ERROR) << "lock profile " << __func__ <<
+					" (" << (uint32_t)L.Col << "," << (uint32_t)L.Row <<
+					") has no DMA." << '\n';
+				return XAIE_INVALID_TILE;
+			}
+			W.Idx = _addCounter(L, M, E);
+			if (W.Idx == UINT32_MAX) {
+				return XAIE_INVALID_ARGS;
+			}
+			return XAIE_OK;
+		}
+		/*
+		 * Adds a counter counting an event to the batch. A counter
+		 * started and stopped by the same event counts the occurrences
+		 * of the event, or the cycles it is high for a level event.
+		 */
+		uint32_t _addCounter(XAie_LocType L, XAie_ModuleType M,
+				XAie_Events E) {
+			auto C = AieDev.tile(L).module(M).perfCounter();
+
+			if (C->initialize(M, E, M, E) != XAIE_OK) {
+				return UINT32_MAX;
+			}
+			vCounters.push_back(C);
+			Batch->add(C);
+			return static_cast<uint32_t>(vCounters.size() - 1);
+		}
+		static XAie_Events _event(XAie_Events Base, uint32_t Off) {
+			return static_cast<XAie_Events>(
+				static_cast<uint32_t>(Base) + Off);
+		}
+		uint64_t _delta(uint32_t Idx) {
+			uint32_t V = Collector->result(Idx);
+			/* unsigned difference also covers counter wrap */
+			uint32_t D = V - Last[Idx];
+
+			Last[Idx] = V;
+			return D;
+		}
+		void _reset() {
+			vCounters.clear();
+			Batch.reset();
+			Collector.reset();
+		}
+	};
+}
@@ -0,0 +1,671 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-common.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/profile/xaiefal-perf-mux.hpp>
+#include <xaiefal/profile/xaiefal-sampler.hpp>
+
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <thread>
+#include <unistd.h>
+#endif
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @class XAieMetricsExporter
+	 * @brief Exports AI engine metrics in the OpenMetrics text format.
+	 * The exporter drains a perf sampler into 64-bit counter totals,
+	 * reads the results of perf muxes, counts errors handed over from
+	 * error aggregations and reads the available resources of tiles.
+	 * All of it is done by refresh(), called by the user or by a thread
+	 * of the exporter at a fixed interval, which renders a snapshot of
+	 * the text. Scrapes, whether from write() or from the HTTP server
+	 * of the exporter, only copy the last snapshot and never access the
+	 * hardware, so their cost and rate do not depend on the sampling.
+	 * Rates such as DMA throughput are left to the metrics backend,
+	 * from the counter totals of stream port or DMA channel counters.
+	 * This header is not included by xaiefal.hpp as the server uses
+	 * POSIX sockets.
+	 */
+	class XAieMetricsExporter {
+	public:
+		XAieMetricsExporter() = delete;
+		XAieMetricsExporter(const std::shared_ptr<XAieDevHandle> &DevHd,
+			std::shared_ptr<XAiePerfSampler> S = nullptr):
+			AieHd(DevHd), Sampler(S), Running(false),
+			Serving(false), ServerFd(-1), Refreshes(0),
+			Snapshot(std::make_shared<const std::string>("# EOF\n")) {}
+		XAieMetricsExporter(XAieDev &Dev,
+			std::shared_ptr<XAiePerfSampler> S = nullptr):
+			XAieMetricsExporter(Dev.getDevHandle(), S) {}
+		XAieMetricsExporter(const XAieMetricsExporter &) = delete;
+		XAieMetricsExporter &operator=(const XAieMetricsExporter &) =
+			delete;
+		~XAieMetricsExporter() {
+			stopServer();
+			stop();
+		}
+		/**
+		 * This function exports a counter of the perf sampler. Its
+		 * 32-bit samples are accumulated into a 64-bit total, so the
+		 * counter has to be sampled at least once per wrap around.
+		 * Counters of the same metric name are one metric family and
+		 * differ by their tile and module labels.
+		 *
+		 * @param Name metric name, e.g. aie_active_cycles
+		 * @param Help help text of the metric
+		 * @param Index index of the counter in the sampler
+		 * @param L tile of the counter
+		 * @param M module of the counter
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC addCounter(const std::string &Name, const std::string &Help,
+				uint32_t Index, XAie_LocType L, XAie_ModuleType M) {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+
+			if (!Sampler) {
+				XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+					" no sampler." << '\n';
+				return XAIE_ERR;
+			}
+			if (!_validName(Name)) {
+				XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+					" invalid name " << Name << '\n';
+				return XAIE_INVALID_ARGS;
+			}
+			if (Index >= vCntrIdx.size()) {
+				vCntrIdx.resize(Index + 1, UINT32_MAX);
+			}
+			if (vCntrIdx[Index] != UINT32_MAX) {
+				XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+					" counter " << Index << " already added." <<
+					'\n';
+				return XAIE_INVALID_ARGS;
+			}
+			vCntrIdx[Index] = static_cast<uint32_t>(vCntrs.size());
+			vCntrs.push_back({_family(Name, Help, "counter"),
+				_labels(L, M), 0, 0});
+			return XAIE_OK;
+		}
+		/**
+		 * This function exports the estimated count of an event of a
+		 * perf mux. The mux is rotated by its user or by a sampler.
+		 *
+		 * @param Name metric name
+		 * @param Help help text of the metric
+		 * @param Mux perf mux
+		 * @param Index index of the event in the mux
+		 * @param L tile of the mux
+		 * @param M module of the mux
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC addMuxEvent(const std::string &Name, const std::string &Help,
+				std::shared_ptr<XAiePerfMux> Mux, uint32_t Index,
+				XAie_LocType L, XAie_ModuleType M) {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+
+			if (!Mux || !_validName(Name)) {
+				XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+					" invalid mux or name." << '\n';
+				return XAIE_INVALID_ARGS;
+			}
+			vMuxEvents.push_back({_family(Name, Help, "counter"),
+				_labels(L, M), Mux, Index});
+			return XAIE_OK;
+		}
+		/**
+		 * This function exports the number of available resources
+		 * of a resource type of a module of a tile, as returned by
+		 * XAie_GetAvailRscStat().
+		 *
+		 * @param L tile
+		 * @param M module
+		 * @param T resource type
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC addRscStat(XAie_LocType L, XAie_ModuleType M,
+				XAie_RscType T) {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+			XAie_UserRscStat Stat;
+
+			if (T >= XAIE_MAX_RSC) {
+				XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+					" invalid resource type " << T << '\n';
+				return XAIE_INVALID_ARGS;
+			}
+			Stat.Loc = L;
+			Stat.Mod = static_cast<uint8_t>(M);
+			Stat.RscType = static_cast<uint8_t>(T);
+			Stat.NumRscs = 0;
+			vRscStats.push_back(Stat);
+			return XAIE_OK;
+		}
+		/**
+		 * This function adds error counts to the exported error
+		 * totals. It is meant to be called with the summary returned
+		 * by XAie_ErrorAggrFlush(), e.g. from an error dispatcher
+		 * callback.
+		 *
+		 * @param Counts error counts
+		 * @param NumCounts number of error counts
+		 */
+		void addErrorCounts(const XAie_ErrorCount *Counts,
+				uint32_t NumCounts) {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+
+			for (uint32_t i = 0; i < NumCounts; i++) {
+				uint64_t Key = _errorKey(Counts[i]);
+
+				ErrorTotals[Key] += Counts[i].Count;
+			}
+		}
+		/**
+		 * This function updates the metrics and renders a new
+		 * snapshot. It drains the sampler, reads the perf mux results
+		 * and the resource statistics.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC refresh() {
+			std::string Text;
+			AieRC RC;
+
+			{
+				_XAIEFAL_MUTEX_ACQUIRE(mLock);
+
+				RC = _update();
+				Text = _render();
+			}
+			auto S = std::make_shared<const std::string>(
+				std::move(Text));
+			{
+				_XAIEFAL_MUTEX_ACQUIRE(sLock);
+				Snapshot = S;
+			}
+			Refreshes.fetch_add(1, std::memory_order_relaxed);
+			return RC;
+		}
+		/**
+		 * This function starts refreshing the metrics at a fixed
+		 * interval on a thread of the exporter.
+		 *
+		 * @param IntervalUs refresh interval in microseconds
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC start(uint32_t IntervalUs) {
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+			if (Running) {
+				XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+					" already started." << '\n';
+				return XAIE_ERR;
+			}
+			Interval = std::chrono::microseconds(IntervalUs);
+			Running = true;
+			RefreshThread = std::thread(&XAieMetricsExporter::_run,
+				this);
+			return XAIE_OK;
+#else
+			(void)IntervalUs;
+			XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+				" threads not supported." << '\n';
+			return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+		}
+		/**
+		 * This function stops the refresh thread.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC stop() {
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+			if (Running) {
+				Running = false;
+				RefreshThread.join();
+			}
+#endif
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the last rendered snapshot.
+		 *
+		 * @return OpenMetrics text of the last refresh
+		 */
+		std::shared_ptr<const std::string> snapshot() {
+			_XAIEFAL_MUTEX_ACQUIRE(sLock);
+			return Snapshot;
+		}
+		/**
+		 * This function writes the last snapshot to a stream.
+		 *
+		 * @param OS output stream
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC write(std::ostream &OS) {
+			auto S = snapshot();
+
+			OS << *S;
+			return OS.good() ? XAIE_OK : XAIE_ERR;
+		}
+		/**
+		 * This function writes the last snapshot to a file. It is
+		 * written to a temporary file renamed over the file, so
+		 * readers such as a node exporter text file collector never
+		 * see a partial file.
+		 *
+		 * @param Path file path
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC writeFile(const std::string &Path) {
+			std::string Tmp = Path + ".tmp";
+			AieRC RC;
+
+			{
+				std::ofstream OFS(Tmp, std::ios::out |
+					std::ios::trunc);
+
+				RC = write(OFS);
+				OFS.close();
+				if (RC == XAIE_OK && OFS.fail()) {
+					RC = XAIE_ERR;
+				}
+			}
+			if (RC != XAIE_OK ||
+				std::rename(Tmp.c_str(), Path.c_str()) != 0) {
+				XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+					" failed to write " << Path << '\n';
+				std::remove(Tmp.c_str());
+				return XAIE_ERR;
+			}
+			return XAIE_OK;
+		}
+		/**
+		 * This function starts serving the snapshots over HTTP on a
+		 * thread of the exporter. GET requests of / and /metrics are
+		 * answered with the last snapshot, one connection at a time.
+		 *
+		 * @param Port TCP port, 0 for a port picked by the system
+		 * @param LoopbackOnly true to accept local connections only
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC startServer(uint16_t Port, bool LoopbackOnly = true) {
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+			struct sockaddr_in Addr = {};
+			socklen_t Len = sizeof(Addr);
+			int Fd, On = 1;
+
+			if (Serving) {
+				XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+					" already serving." << '\n';
+				return XAIE_ERR;
+			}
+			Fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+			if (Fd < 0) {
+				XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+					" failed to create socket." << '\n';
+				return XAIE_ERR;
+			}
+			setsockopt(Fd, SOL_SOCKET, SO_REUSEADDR, &On, sizeof(On));
+			Addr.sin_family = AF_INET;
+			Addr.sin_port = htons(Port);
+			Addr.sin_addr.s_addr = htonl(LoopbackOnly ?
+				INADDR_LOOPBACK : INADDR_ANY);
+			if (bind(Fd, (struct sockaddr *)&Addr, sizeof(Addr)) < 0 ||
+				listen(Fd, 16) < 0 ||
+				getsockname(Fd, (struct sockaddr *)&Addr,
+					&Len) < 0) {
+				XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+					" failed to listen on port " << Port <<
+					'\n';
+				close(Fd);
+				return XAIE_ERR;
+			}
+			ServerFd = Fd;
+			ServerPort = ntohs(Addr.sin_port);
+			Serving = true;
+			ServerThread = std::thread(&XAieMetricsExporter::_serve,
+				this);
+			return XAIE_OK;
+#else
+			(void)Port;
+			(void)LoopbackOnly;
+			XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+				" sockets not supported." << '\n';
+			return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+		}
+		/**
+		 * This function stops the HTTP server.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC stopServer() {
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+			if (Serving) {
+				Serving = false;
+				ServerThread.join();
+				close(ServerFd);
+				ServerFd = -1;
+			}
+#endif
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the port of the HTTP server.
+		 *
+		 * @return TCP port the server listens on, 0 if not serving
+		 */
+		uint16_t port() const {
+			return Serving ? ServerPort : 0;
+		}
+		/**
+		 * This function returns the number of refreshes done.
+		 *
+		 * @return number of refreshes
+		 */
+		uint64_t refreshes() const {
+			return Refreshes.load(std::memory_order_relaxed);
+		}
+	private:
+		/* metric family, rendered with its samples */
+		struct Family {
+			std::string Name;
+			std::string Help;
+			std::string Type;
+		};
+		/* sampler counter and its 64-bit total */
+		struct CntrMetric {
+			uint32_t Family;
+			std::string Labels;
+			uint32_t Last; /**< last raw sample */
+			uint64_t Total;
+		};
+		/* event of a perf mux */
+		struct MuxMetric {
+			uint32_t Family;
+			std::string Labels;
+			std::shared_ptr<XAiePerfMux> Mux;
+			uint32_t Index;
+		};
+
+		std::shared_ptr<XAieDevHandle> AieHd; /**< AI engine device */
+		std::shared_ptr<XAiePerfSampler> Sampler; /**< drained sampler */
+		std::vector<Family> vFamilies;
+		std::vector<uint32_t> vCntrIdx; /**< sampler index to counter */
+		std::vector<CntrMetric> vCntrs;
+		std::vector<MuxMetric> vMuxEvents;
+		std::vector<XAie_UserRscStat> vRscStats;
+		std::map<uint64_t, uint64_t> ErrorTotals; /**< error totals */
+		std::vector<XAiePerfSample> vSamples; /**< drain buffer */
+		std::atomic<bool> Running;
+		std::atomic<bool> Serving;
+		int ServerFd;
+		uint16_t ServerPort = 0;
+		std::chrono::microseconds Interval;
+		std::atomic<uint64_t> Refreshes;
+		std::shared_ptr<const std::string> Snapshot; /**< last text */
+		_XAIEFAL_MUTEX_DECLARE(mLock); /**< metrics mutex lock */
+		_XAIEFAL_MUTEX_DECLARE(sLock); /**< snapshot mutex lock */
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+		std::thread RefreshThread;
+		std::thread ServerThread;
+#endif
+
+		static bool _validName(const std::string &Name) {
+			if (Name.empty() || (Name[0] >= '0' && Name[0] <= '9')) {
+				return false;
+			}
+			for (char C: Name) {
+				if (!((C >= 'a' && C <= 'z') ||
+					(C >= 'A' && C <= 'Z') ||
+					(C >= '0' && C <= '9') || C == '_' ||
+					C == ':')) {
+					return false;
+				}
+			}
+			return true;
+		}
+		static const char *_modName(uint32_t M) {
+			static const char *Names[] = {"memory", "core", "pl"};
+
+			return M < 3 ? Names[M] : "unknown";
+		}
+		static const char *_rscName(uint32_t T) {
+			static const char *Names[] = {"perf_counter",
+				"user_event", "trace_control", "pc_event",
+				"stream_event_port", "broadcast_channel",
+				"combo_event", "group_event"};
+
+			return T < XAIE_MAX_RSC ? Names[T] : "unknown";
+		}
+		static std::string _labels(XAie_LocType L, uint32_t M) {
+			std::ostringstream OS;
+
+			OS << "col=\"" << (uint32_t)L.Col << "\",row=\"" <<
+				(uint32_t)L.Row << "\",module=\"" <<
+				_modName(M) << "\"";
+			return OS.str();
+		}
+		static uint64_t _errorKey(const XAie_ErrorCount &E) {
+			return ((uint64_t)E.Loc.Col << 24) |
+				((uint64_t)E.Loc.Row << 16) |
+				((uint64_t)E.Module << 8) | E.EventId;
+		}
+		/* returns the index of a family, added if new */
+		uint32_t _family(const std::string &Name, const std::string &Help,
+				const char *Type) {
+			for (uint32_t i = 0; i < vFamilies.size(); i++) {
+				if (vFamilies[i].Name == Name) {
+					return i;
+				}
+			}
+			vFamilies.push_back({Name, Help, Type});
+			return static_cast<uint32_t>(vFamilies.size() - 1);
+		}
+		AieRC _update() {
+			AieRC RC = XAIE_OK;
+
+			if (Sampler) {
+				vSamples.clear();
+				Sampler->drain(vSamples);
+				for (auto &S: vSamples) {
+					if (S.Index >= vCntrIdx.size() ||
+						vCntrIdx[S.Index] == UINT32_MAX) {
+						continue;
+					}
+					CntrMetric &C = vCntrs[vCntrIdx[S.Index]];
+
+					/* unsigned difference absorbs a wrap */
+					C.Total += static_cast<uint32_t>(S.Value -
+						C.Last);
+					C.Last = S.Value;
+				}
+			}
+			if (!vRscStats.empty()) {
+				RC = XAie_GetAvailRscStat(AieHd->dev(),
+					static_cast<uint32_t>(vRscStats.size()),
+					vRscStats.data());
+				if (RC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "metrics " << __func__ <<
+						" failed to get resource stats." <<
+						'\n';
+				}
+			}
+			return RC;
+		}
+		std::string _render() {
+			std::ostringstream OS;
+
+			for (uint32_t f = 0; f < vFamilies.size(); f++) {
+				const Family &F = vFamilies[f];
+
+				OS << "# TYPE " << F.Name << " " << F.Type << '\n';
+				if (!F.Help.empty()) {
+					OS << "# HELP " << F.Name << " " <<
+						F.Help << '\n';
+				}
+				for (auto &C: vCntrs) {
+					if (C.Family == f) {
+						OS << F.Name << "_total{" <<
+							C.Labels << "} " <<
+							C.Total << '\n';
+					}
+				}
+				for (auto &E: vMuxEvents) {
+					uint64_t Val;
+
+					if (E.Family == f && E.Mux->readResult(
+						E.Index, Val) == XAIE_OK) {
+						OS << F.Name << "_total{" <<
+							E.Labels << "} " <<
+							Val << '\n';
+					}
+				}
+			}
+			if (!vRscStats.empty()) {
+				OS << "# TYPE aie_resources_available gauge\n" <<
+					"# HELP aie_resources_available " <<
+					"Resources free for allocation.\n";
+				for (auto &S: vRscStats) {
+					OS << "aie_resources_available{" <<
+						_labels(S.Loc, S.Mod) <<
+						",resource=\"" <<
+						_rscName(S.RscType) << "\"} " <<
+						(uint32_t)S.NumRscs << '\n';
+				}
+			}
+			if (!ErrorTotals.empty()) {
+				OS << "# TYPE aie_errors counter\n" <<
+					"# HELP aie_errors Errors raised by " <<
+					"the tiles.\n";
+				for (auto &E: ErrorTotals) {
+					XAie_LocType L = XAie_TileLoc(
+						(uint8_t)(E.first >> 24),
+						(uint8_t)(E.first >> 16));
+
+					OS << "aie_errors_total{" <<
+						_labels(L, (E.first >> 8) & 0xFFU) <<
+						",event=\"" << (E.first & 0xFFU) <<
+						"\"} " << E.second << '\n';
+				}
+			}
+			if (Sampler) {
+				uint64_t Sweeps, BusyNs;
+
+				Sampler->overhead(Sweeps, BusyNs);
+				OS << "# TYPE aie_sampler_sweeps counter\n" <<
+					"aie_sampler_sweeps_total " << Sweeps <<
+					'\n' <<
+					"# TYPE aie_sampler_busy_seconds counter\n" <<
+					"aie_sampler_busy_seconds_total " <<
+					BusyNs / 1e9 << '\n' <<
+					"# TYPE aie_sampler_dropped_samples counter\n" <<
+					"aie_sampler_dropped_samples_total " <<
+					Sampler->dropped() << '\n';
+			}
+			OS << "# EOF\n";
+			return OS.str();
+		}
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+		void _run() {
+			auto Next = std::chrono::steady_clock::now();
+
+			while (Running) {
+				refresh();
+				Next += Interval;
+				std::this_thread::sleep_until(Next);
+			}
+		}
+		/* answers one HTTP request of a connection */
+		void _answer(int Fd) {
+			struct timeval Tv = {1, 0};
+			std::string Req;
+			char Buf[1024];
+
+			/* a slow client must not hold the server */
+			setsockopt(Fd, SOL_SOCKET, SO_RCVTIMEO, &Tv, sizeof(Tv));
+			setsockopt(Fd, SOL_SOCKET, SO_SNDTIMEO, &Tv, sizeof(Tv));
+			while (Req.find("\r\n\r\n") == std::string::npos &&
+				Req.size() < 8192) {
+				ssize_t N = recv(Fd, Buf, sizeof(Buf), 0);
+
+				if (N <= 0) {
+					return;
+				}
+				Req.append(Buf, N);
+			}
+
+			std::string Status = "200 OK";
+			std::shared_ptr<const std::string> Body;
+			std::string Line = Req.substr(0, Req.find("\r\n"));
+
+			if (Line.compare(0, 4, "GET ") != 0) {
+				Status = "405 Method Not Allowed";
+			} else if (Line.compare(4, 2, "/ ") != 0 &&
+				Line.compare(4, 9, "/metrics ") != 0 &&
+				Line.compare(4, 9, "/metrics?") != 0) {
+				Status = "404 Not Found";
+			} else {
+				Body = snapshot();
+			}
+
+			std::ostringstream Hdr;
+			Hdr << "HTTP/1.1 " << Status << "\r\n" <<
+				"Content-Type: application/openmetrics-text; " <<
+				"version=1.0.0; charset=utf-8\r\n" <<
+				"Content-Length: " << (Body ? Body->size() : 0) <<
+				"\r\nConnection: close\r\n\r\n";
+			std::string H = Hdr.str();
+			_send(Fd, H.data(), H.size());
+			if (Body) {
+				_send(Fd, Body->data(), Body->size());
+			}
+		}
+		static void _send(int Fd, const char *Data, size_t Size) {
+			while (Size > 0) {
+				ssize_t N = send(Fd, Data, Size, MSG_NOSIGNAL);
+
+				if (N <= 0) {
+					return;
+				}
+				Data += N;
+				Size -= N;
+			}
+		}
+		void _serve() {
+			while (Serving) {
+				struct pollfd Pfd = {ServerFd, POLLIN, 0};
+				int Fd;
+
+				/* wakes up to see stopServer() */
+				if (poll(&Pfd, 1, 100) <= 0) {
+					continue;
+				}
+				Fd = accept4(ServerFd, NULL, NULL, SOCK_CLOEXEC);
+				if (Fd < 0) {
+					continue;
+				}
+				_answer(Fd);
+				close(Fd);
+			}
+		}
+#endif
+	};
+}
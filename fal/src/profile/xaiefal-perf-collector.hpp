@@ -0,0 +1,217 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/rsc/xaiefal-perf.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @class XAiePerfCollector
+	 * @brief Reads the values of a set of running perf counters in one
+	 * sweep over the hardware.
+	 * The counters are grouped by tile and module and read with the
+	 * driver perf snapshots, one block read per module, instead of one
+	 * register read per counter. Any XAiePerfCounter can be added, so
+	 * derived metrics such as XAieActiveCycles or XAieStallCycles come
+	 * out of the same sweep.
+	 */
+	class XAiePerfCollector {
+	public:
+		XAiePerfCollector() = delete;
+		XAiePerfCollector(const std::shared_ptr<XAieDevHandle> &DevHd):
+			AieHd(DevHd) {}
+		XAiePerfCollector(XAieDev &Dev):
+			XAiePerfCollector(Dev.getDevHandle()) {}
+		XAiePerfCollector(const XAiePerfCollector &) = delete;
+		XAiePerfCollector &operator=(const XAiePerfCollector &) = delete;
+		~XAiePerfCollector() {
+			_freeSnapshots();
+		}
+		/**
+		 * This function adds a counter to the collector. The counter
+		 * has to be running when the collector is read.
+		 *
+		 * @param C perf counter
+		 * @return index of the counter in the results
+		 */
+		uint32_t addCounter(std::shared_ptr<XAiePerfCounter> C) {
+			_freeSnapshots();
+			vCounters.push_back(C);
+			return static_cast<uint32_t>(vCounters.size() - 1);
+		}
+		/**
+		 * This function returns the number of counters of the
+		 * collector.
+		 *
+		 * @return number of counters
+		 */
+		uint32_t size() const {
+			return static_cast<uint32_t>(vCounters.size());
+		}
+		/**
+		 * This function sets up the driver snapshots for the current
+		 * counters. It is called by read() if needed, and can be
+		 * called ahead to keep the setup out of the first sweep.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC prepare() {
+			/* (counter id, collector index) pairs per module */
+			typedef std::vector<std::pair<uint32_t, uint32_t>> ModCntrs;
+			std::map<uint64_t, ModCntrs> Mods;
+			/* modules grouped by number of counters to read */
+			std::map<uint32_t, std::vector<std::pair<uint64_t,
+				ModCntrs>>> ByNum;
+			AieRC RC = XAIE_OK;
+
+			_freeSnapshots();
+			for (uint32_t i = 0; i < vCounters.size(); i++) {
+				XAie_LocType L;
+				XAie_ModuleType M;
+				uint32_t Id;
+
+				if (!vCounters[i]->isRunning() ||
+					vCounters[i]->getRscId(L, M, Id) != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "perf collector " <<
+						__func__ << " counter " << i <<
+						" not running." << '\n';
+					return XAIE_ERR;
+				}
+
+				uint64_t Key = ((uint64_t)L.Col << 16) |
+					((uint64_t)L.Row << 8) | M;
+				Mods[Key].push_back({Id, i});
+			}
+
+			for (auto &E: Mods) {
+				uint32_t Num = 0;
+
+				for (auto &C: E.second) {
+					Num = std::max(Num, C.first + 1);
+				}
+				ByNum[Num].push_back(E);
+			}
+
+			for (auto &G: ByNum) {
+				std::vector<XAie_LocType> vL;
+				std::vector<XAie_ModuleType> vM;
+				Snap S;
+
+				for (uint32_t e = 0; e < G.second.size(); e++) {
+					uint64_t Key = G.second[e].first;
+
+					vL.push_back(XAie_TileLoc((Key >> 16) & 0xFF,
+						(Key >> 8) & 0xFF));
+					vM.push_back(static_cast<XAie_ModuleType>(
+						Key & 0xFF));
+					for (auto &C: G.second[e].second) {
+						S.vSlots.push_back({e, C.first, C.second});
+					}
+				}
+				RC = XAie_PerfSnapshotInit(AieHd->dev(), &S.S,
+					vL.data(), vM.data(), vL.size(), G.first,
+					XAIE_DISABLE);
+				if (RC != XAIE_OK) {
+					_freeSnapshots();
+					return RC;
+				}
+				vSnaps.push_back(S);
+			}
+			Values.assign(vCounters.size(), 0);
+			Prepared = true;
+			return RC;
+		}
+		/**
+		 * This function reads all the counters of the collector in
+		 * one sweep. The values are available with result() until the
+		 * next read.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC read() {
+			AieRC RC = XAIE_OK;
+
+			if (!Prepared) {
+				RC = prepare();
+				if (RC != XAIE_OK) {
+					return RC;
+				}
+			}
+			for (auto &S: vSnaps) {
+				RC = XAie_PerfSnapshotRead(AieHd->dev(), &S.S);
+				if (RC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "perf collector " <<
+						__func__ << " failed to read counters." <<
+						'\n';
+					return RC;
+				}
+				for (auto &Slot: S.vSlots) {
+					Values[Slot.Index] = S.S.CounterVals[
+						Slot.Entry * S.S.NumCounters +
+						Slot.Counter];
+				}
+			}
+			return RC;
+		}
+		/**
+		 * This function reads all the counters of the collector in
+		 * one sweep into a flat array.
+		 *
+		 * @param vValues returns the counter values, indexed as
+		 *	  returned by addCounter()
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC read(std::vector<uint32_t> &vValues) {
+			AieRC RC = read();
+
+			if (RC == XAIE_OK) {
+				vValues = Values;
+			}
+			return RC;
+		}
+		/**
+		 * This function returns the value of a counter from the last
+		 * read.
+		 *
+		 * @param Index index of the counter returned by addCounter()
+		 * @return counter value
+		 */
+		uint32_t result(uint32_t Index) const {
+			return Values.at(Index);
+		}
+	private:
+		/* value to scatter from one snapshot entry */
+		struct SnapSlot {
+			uint32_t Entry; /**< entry in the snapshot */
+			uint32_t Counter; /**< hardware counter id */
+			uint32_t Index; /**< index of the counter in the results */
+		};
+		/* snapshot of the modules needing the same number of counters */
+		struct Snap {
+			XAie_PerfSnapshot S;
+			std::vector<SnapSlot> vSlots;
+		};
+
+		std::shared_ptr<XAieDevHandle> AieHd; /**< AI engine device */
+		std::vector<std::shared_ptr<XAiePerfCounter>> vCounters;
+		std::vector<Snap> vSnaps; /**< perf snapshots read per sweep */
+		std::vector<uint32_t> Values; /**< values of the last read */
+		bool Prepared = false;
+
+		void _freeSnapshots() {
+			for (auto &S: vSnaps) {
+				XAie_PerfSnapshotFree(&S.S);
+			}
+			vSnaps.clear();
+			Prepared = false;
+		}
+	};
+}
@@ -0,0 +1,381 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-common.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/rsc/xaiefal-perf.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @class XAiePerfMux
+	 * @brief Counts more events of a module than it has perf counters by
+	 * time multiplexing the events on the counters.
+	 * The counters are reserved as XAiePerfCounter resources, and every
+	 * rotation reads the counters, then moves them to the next events
+	 * in round robin. The host time each event was counted for is
+	 * tracked, and the results are scaled to the whole measurement
+	 * time. Rotations are done by calling rotate(), or by a perf sampler
+	 * the mux is added to.
+	 */
+	class XAiePerfMux {
+	public:
+		XAiePerfMux() = delete;
+		XAiePerfMux(const std::shared_ptr<XAieDevHandle> &DevHd,
+			XAie_LocType L, XAie_ModuleType M, uint32_t NumCntrs,
+			uint32_t IntervalUs = 1000): AieHd(DevHd), Loc(L),
+			Mod(M), MaxCntrs(NumCntrs), Interval(IntervalUs),
+			Next(0), Running(false) {}
+		XAiePerfMux(XAieDev &Dev, XAie_LocType L, XAie_ModuleType M,
+			uint32_t NumCntrs, uint32_t IntervalUs = 1000):
+			XAiePerfMux(Dev.getDevHandle(), L, M, NumCntrs,
+				IntervalUs) {}
+		XAiePerfMux(const XAiePerfMux &) = delete;
+		XAiePerfMux &operator=(const XAiePerfMux &) = delete;
+		~XAiePerfMux() {
+			stop();
+			release();
+		}
+		/**
+		 * This function adds an event to count. A counter assigned
+		 * to it counts from the start event to the stop event; with
+		 * the same start and stop event it counts the occurrences of
+		 * the event.
+		 *
+		 * @param StartE start event of the module of the mux
+		 * @param StopE stop event of the module of the mux
+		 * @param Index returns the index of the event in the results
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC addEvent(XAie_Events StartE, XAie_Events StopE,
+				uint32_t &Index) {
+			uint8_t HwEvent;
+			AieRC RC;
+
+			if (Running) {
+				XAIEFAL_LOG(ERROR) << "perf mux " << __func__ <<
+					" mux is running." << '\n';
+				return XAIE_ERR;
+			}
+			RC = XAie_EventLogicalToPhysicalConv(AieHd->dev(), Loc,
+				Mod, StartE, &HwEvent);
+			if (RC == XAIE_OK) {
+				RC = XAie_EventLogicalToPhysicalConv(AieHd->dev(),
+					Loc, Mod, StopE, &HwEvent);
+			}
+			if (RC != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << "perf mux " << __func__ <<
+					" (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ") Mod=" << Mod <<
+					" invalid event " << StartE << "," << StopE <<
+					'\n';
+				return RC;
+			}
+			vEvents.push_back({StartE, StopE, 0, 0});
+			Index = static_cast<uint32_t>(vEvents.size() - 1);
+			return XAIE_OK;
+		}
+		/**
+		 * This function adds an event whose occurrences are counted.
+		 *
+		 * @param E event of the module of the mux
+		 * @param Index returns the index of the event in the results
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC addEvent(XAie_Events E, uint32_t &Index) {
+			return addEvent(E, E, Index);
+		}
+		/**
+		 * This function reserves the counters of the mux. As many
+		 * counters as available up to the number requested are
+		 * reserved, at least one has to be.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC reserve() {
+			if (!vCntrs.empty()) {
+				XAIEFAL_LOG(ERROR) << "perf mux " << __func__ <<
+					" counters already reserved." << '\n';
+				return XAIE_ERR;
+			}
+			for (uint32_t i = 0; i < MaxCntrs; i++) {
+				auto C = std::make_shared<XAiePerfCounter>(AieHd,
+					Loc, Mod);
+
+				if (C->reserve() != XAIE_OK) {
+					break;
+				}
+				vCntrs.push_back({C, 0, 0});
+			}
+			if (vCntrs.empty()) {
+				XAIEFAL_LOG(ERROR) << "perf mux " << __func__ <<
+					" (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ") Mod=" << Mod <<
+					" no counter available." << '\n';
+				return XAIE_ERR;
+			}
+			return XAIE_OK;
+		}
+		/**
+		 * This function releases the counters of the mux.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC release() {
+			if (Running) {
+				XAIEFAL_LOG(ERROR) << "perf mux " << __func__ <<
+					" mux is running." << '\n';
+				return XAIE_ERR;
+			}
+			for (auto &C: vCntrs) {
+				C.Cntr->release();
+			}
+			vCntrs.clear();
+			return XAIE_OK;
+		}
+		/**
+		 * This function clears the results and starts counting the
+		 * first events on the counters.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC start() {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+			AieRC RC = XAIE_OK;
+
+			if (Running || vCntrs.empty() || vEvents.empty()) {
+				XAIEFAL_LOG(ERROR) << "perf mux " << __func__ <<
+					" running, not reserved or no event." <<
+					'\n';
+				return XAIE_ERR;
+			}
+			for (auto &E: vEvents) {
+				E.Count = 0;
+				E.ActiveNs = 0;
+			}
+			for (auto &C: vCntrs) {
+				XAie_LocType L;
+				XAie_ModuleType M;
+				uint32_t Id;
+
+				RC = C.Cntr->getRscId(L, M, Id);
+				if (RC != XAIE_OK) {
+					return RC;
+				}
+				C.Id = static_cast<uint8_t>(Id);
+			}
+			Next = 0;
+			StartNs = _nowNs();
+			RC = _assign(StartNs);
+			if (RC == XAIE_OK) {
+				Running = true;
+			}
+			return RC;
+		}
+		/**
+		 * This function reads the counters and moves them to the next
+		 * events.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC rotate() {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+			AieRC RC;
+			uint64_t Now;
+
+			if (!Running) {
+				XAIEFAL_LOG(ERROR) << "perf mux " << __func__ <<
+					" mux not running." << '\n';
+				return XAIE_ERR;
+			}
+			Now = _nowNs();
+			RC = _collect(Now);
+			if (RC == XAIE_OK) {
+				RC = _assign(Now);
+			}
+			return RC;
+		}
+		/**
+		 * This function reads the counters a last time and stops
+		 * counting. The results stay available.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC stop() {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+			AieRC RC;
+
+			if (!Running) {
+				return XAIE_OK;
+			}
+			StopNs = _nowNs();
+			RC = _collect(StopNs);
+			for (auto &C: vCntrs) {
+				XAie_PerfCounterControlReset(AieHd->dev(), Loc,
+					Mod, C.Id);
+				XAie_PerfCounterReset(AieHd->dev(), Loc, Mod,
+					C.Id);
+			}
+			Running = false;
+			return RC;
+		}
+		/**
+		 * This function returns the estimated count of an event over
+		 * the whole measurement: its raw count scaled by the ratio of
+		 * the measurement time to the time it was counted for.
+		 *
+		 * @param Index index of the event returned by addEvent()
+		 * @param Val returns the estimated count
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC readResult(uint32_t Index, uint64_t &Val) {
+			uint64_t Raw, ActiveNs, TotalNs;
+			AieRC RC;
+
+			RC = readRaw(Index, Raw, ActiveNs, TotalNs);
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+			if (ActiveNs == 0) {
+				Val = 0;
+			} else {
+				Val = static_cast<uint64_t>(static_cast<double>(Raw) *
+					TotalNs / ActiveNs + 0.5);
+			}
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the raw count of an event and the
+		 * times used to scale it. Counts of the events currently on
+		 * the counters are included up to the last rotation.
+		 *
+		 * @param Index index of the event returned by addEvent()
+		 * @param Raw returns the count read from the counters
+		 * @param ActiveNs returns the time the event was counted for
+		 * @param TotalNs returns the time of the measurement, up to
+		 *	  the last rotation if the mux is running
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC readRaw(uint32_t Index, uint64_t &Raw, uint64_t &ActiveNs,
+				uint64_t &TotalNs) {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+
+			if (Index >= vEvents.size()) {
+				XAIEFAL_LOG(ERROR) << "perf mux " << __func__ <<
+					" invalid index " << Index << '\n';
+				return XAIE_INVALID_ARGS;
+			}
+			Raw = vEvents[Index].Count;
+			ActiveNs = vEvents[Index].ActiveNs;
+			TotalNs = (Running ? LastNs : StopNs) - StartNs;
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the rotation interval of the mux.
+		 *
+		 * @return rotation interval in microseconds
+		 */
+		uint32_t interval() const {
+			return Interval;
+		}
+		bool isRunning() const {
+			return Running;
+		}
+	private:
+		/* event counted by the mux */
+		struct MuxEvent {
+			XAie_Events StartE;
+			XAie_Events StopE;
+			uint64_t Count; /**< raw count */
+			uint64_t ActiveNs; /**< time the event was counted */
+		};
+		/* reserved counter and the event assigned to it */
+		struct MuxCntr {
+			std::shared_ptr<XAiePerfCounter> Cntr;
+			uint8_t Id; /**< hardware counter id */
+			uint32_t Event; /**< index of the event counted */
+		};
+
+		std::shared_ptr<XAieDevHandle> AieHd; /**< AI engine device */
+		XAie_LocType Loc; /**< tile of the counters */
+		XAie_ModuleType Mod; /**< module of the counters */
+		uint32_t MaxCntrs; /**< maximum number of counters to reserve */
+		uint32_t Interval; /**< rotation interval in microseconds */
+		uint32_t Next; /**< next event to assign */
+		std::atomic<bool> Running;
+		uint64_t StartNs = 0; /**< time counting started */
+		uint64_t StopNs = 0; /**< time counting stopped */
+		uint64_t LastNs = 0; /**< time of the last assignment */
+		std::vector<MuxEvent> vEvents;
+		std::vector<MuxCntr> vCntrs;
+		_XAIEFAL_MUTEX_DECLARE(mLock); /**< rotation mutex lock */
+
+		static uint64_t _nowNs() {
+			return std::chrono::duration_cast<
+				std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().
+				time_since_epoch()).count();
+		}
+		/* accounts the counts of the events on the counters */
+		AieRC _collect(uint64_t Now) {
+			for (auto &C: vCntrs) {
+				uint32_t Val;
+				AieRC RC;
+
+				if (C.Event >= vEvents.size()) {
+					continue;
+				}
+				RC = XAie_PerfCounterGet(AieHd->dev(), Loc, Mod,
+					C.Id, &Val);
+				if (RC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "perf mux " <<
+						__func__ << " failed to read counter." <<
+						'\n';
+					return RC;
+				}
+				vEvents[C.Event].Count += Val;
+				vEvents[C.Event].ActiveNs += Now - LastNs;
+			}
+			return XAIE_OK;
+		}
+		/* moves the counters to the next events */
+		AieRC _assign(uint64_t Now) {
+			uint32_t NumEvents = static_cast<uint32_t>(vEvents.size());
+
+			for (uint32_t i = 0; i < vCntrs.size(); i++) {
+				MuxCntr &C = vCntrs[i];
+				AieRC RC;
+
+				/* more counters than events leaves some idle */
+				if (i >= NumEvents) {
+					C.Event = NumEvents;
+					continue;
+				}
+				C.Event = Next;
+				Next = (Next + 1) % NumEvents;
+				RC = XAie_PerfCounterControlSet(AieHd->dev(), Loc,
+					Mod, C.Id, vEvents[C.Event].StartE,
+					vEvents[C.Event].StopE);
+				if (RC == XAIE_OK) {
+					RC = XAie_PerfCounterReset(AieHd->dev(),
+						Loc, Mod, C.Id);
+				}
+				if (RC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "perf mux " <<
+						__func__ << " failed to set counter." <<
+						'\n';
+					return RC;
+				}
+			}
+			LastNs = Now;
+			return XAIE_OK;
+		}
+	};
+}
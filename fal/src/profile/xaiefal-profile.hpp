@@ -7,14 +7,17 @@
 #include <xaiengine.h>
 #include <xaiefal/rsc/xaiefal-groupevent.hpp>
 #include <xaiefal/rsc/xaiefal-perf.hpp>
+#include <xaiefal/rsc/xaiefal-ss.hpp>
 
 #pragma once
 
+#define XAIEFAL_STREAM_BYTES_PER_CYCLE 4U
+
 namespace xaiefal {
 	class XAieActiveCycles: public XAiePerfCounter {
 	public:
 		XAieActiveCycles() = delete;
-		XAieActiveCycles(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieActiveCycles(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L, bool CrossM = false):
 			XAiePerfCounter(DevHd, L, XAIE_CORE_MOD, CrossM) {
 			initialize(XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
@@ -27,7 +30,7 @@ namespace xaiefal {
 	class XAieStallCycles: public XAiePerfCounter {
 	public:
 		XAieStallCycles() = delete;
-		XAieStallCycles(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieStallCycles(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L,
 			std::shared_ptr<XAieGroupEventHandle> StallG,
 			std::shared_ptr<XAieGroupEventHandle> FlowG,
@@ -61,10 +64,10 @@ namespace xaiefal {
 			AieRC RC = XAIE_OK;
 
 			if (State.Reserved == 0) {
-				Logger::log(LogLevel::ERROR) << "StallCycles " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "StallCycles " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod <<
-					" resource not allocated." << std::endl;
+					" resource not allocated." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				StallGroupEvent->setGroupEvents(C);
@@ -83,10 +86,10 @@ namespace xaiefal {
 			AieRC RC = XAIE_OK;
 
 			if (State.Reserved == 0) {
-				Logger::log(LogLevel::ERROR) << "StallCycles " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "StallCycles " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod <<
-					" resource not allocated." << std::endl;
+					" resource not allocated." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				FlowGroupEvent->setGroupEvents(C);
@@ -142,7 +145,7 @@ namespace xaiefal {
 	class XAieStallOccurrences: public XAiePerfCounter {
 	public:
 		XAieStallOccurrences() = delete;
-		XAieStallOccurrences(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieStallOccurrences(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L,
 			std::shared_ptr<XAieGroupEventHandle> StallG,
 			bool CrossM = false):
@@ -173,10 +176,10 @@ namespace xaiefal {
 			AieRC RC = XAIE_OK;
 
 			if (State.Reserved == 0) {
-				Logger::log(LogLevel::ERROR) << "StallCycles " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "StallCycles " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod <<
-					" resource not allocated." << std::endl;
+					" resource not allocated." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				StallGroupEvent->setGroupEvents(C);
@@ -211,4 +214,141 @@ namespace xaiefal {
 	private:
 		std::shared_ptr<XAieGroupEventHandle> StallGroupEvent;
 	};
+
+	/**
+	 * Stream port states which can be counted
+	 */
+	enum XAieStreamPortState {
+		XAIE_STREAM_PORT_IDLE, /**< no data, no stall */
+		XAIE_STREAM_PORT_RUNNING, /**< data transferred */
+		XAIE_STREAM_PORT_STALLED, /**< data held by back-pressure */
+		XAIE_STREAM_PORT_TLAST, /**< end of a packet or transfer */
+	};
+
+	/**
+	 * @class XAieStreamPortCycles
+	 * @brief class for number of cycles a stream switch port spends in
+	 *	  a state. The port is selected with a stream port select
+	 *	  resource of the tile, which is reserved, started, stopped and
+	 *	  released with the counter.
+	 *	  Counting the running cycles gives the port utilization, the
+	 *	  stalled cycles give the back-pressure on the port.
+	 */
+	class XAieStreamPortCycles: public XAiePerfCounter {
+	public:
+		XAieStreamPortCycles() = delete;
+		XAieStreamPortCycles(const std::shared_ptr<XAieDevHandle> &DevHd,
+			XAie_LocType L, XAie_StrmPortIntf PIntf,
+			StrmSwPortType PType, uint32_t PNum,
+			XAieStreamPortState St = XAIE_STREAM_PORT_RUNNING,
+			bool CrossM = false):
+			XAiePerfCounter(DevHd, L, _portMod(DevHd, L), CrossM),
+			PortState(St) {
+			XAie_Events E;
+
+			PortSelect = std::make_shared<XAieStreamPortSelect>(DevHd,
+					L);
+			PortSelect->setPortToSelect(PIntf, PType, PNum);
+			/*
+			 * The selected port is only known once the port select
+			 * is reserved, use the events of port 0 until then.
+			 */
+			XAie_EventGetIdlePortEventBase(DevHd->dev(), L, Mod, &E);
+			E = static_cast<XAie_Events>(static_cast<uint32_t>(E) + St);
+			initialize(Mod, E, Mod, E);
+		}
+		XAieStreamPortCycles(XAieDev &Dev, XAie_LocType L,
+			XAie_StrmPortIntf PIntf, StrmSwPortType PType,
+			uint32_t PNum,
+			XAieStreamPortState St = XAIE_STREAM_PORT_RUNNING,
+			bool CrossM = false):
+			XAieStreamPortCycles(Dev.getDevHandle(), L, PIntf, PType,
+				PNum, St, CrossM) {}
+	protected:
+		AieRC _reserveAppend() {
+			AieRC RC;
+			XAie_Events E;
+
+			RC = PortSelect->reserve();
+			if (RC == XAIE_OK) {
+				PortSelect->getSSIdleEvent(E);
+				StartEvent = static_cast<XAie_Events>(
+					static_cast<uint32_t>(E) + PortState);
+				StopEvent = StartEvent;
+			}
+			return RC;
+		}
+		AieRC _releaseAppend() {
+			return PortSelect->release();
+		}
+		AieRC _startPrepend() {
+			return PortSelect->start();
+		}
+		AieRC _stopAppend() {
+			return PortSelect->stop();
+		}
+		void _getRscsAppend(std::vector<XAie_UserRsc> &vRscs) const {
+			PortSelect->getRscs(vRscs);
+		}
+	private:
+		std::shared_ptr<XAieStreamPortSelect> PortSelect;
+		XAieStreamPortState PortState;
+
+		static XAie_ModuleType _portMod(
+				const std::shared_ptr<XAieDevHandle> &DevHd,
+				XAie_LocType L) {
+			uint8_t TType = _XAie_GetTileTypefromLoc(DevHd->dev(), L);
+
+			if (TType == XAIEGBL_TILE_TYPE_AIETILE) {
+				return XAIE_CORE_MOD;
+			} else if (TType == XAIEGBL_TILE_TYPE_MEMTILE) {
+				return XAIE_MEM_MOD;
+			}
+			return XAIE_PL_MOD;
+		}
+	};
+
+	/**
+	 * @class XAieDmaChannelCycles
+	 * @brief class for number of cycles a DMA channel moves data, or is
+	 *	  stalled, on its stream switch port. Each running cycle moves
+	 *	  one 32-bit word, readBytes() converts the count to bytes.
+	 */
+	class XAieDmaChannelCycles: public XAieStreamPortCycles {
+	public:
+		XAieDmaChannelCycles() = delete;
+		XAieDmaChannelCycles(const std::shared_ptr<XAieDevHandle> &DevHd,
+			XAie_LocType L, XAie_DmaDirection Dir, uint32_t ChNum,
+			XAieStreamPortState St = XAIE_STREAM_PORT_RUNNING,
+			bool CrossM = false):
+			XAieStreamPortCycles(DevHd, L,
+				/* S2MM channels are fed by a master port */
+				Dir == DMA_S2MM ? XAIE_STRMSW_MASTER :
+				XAIE_STRMSW_SLAVE, DMA, ChNum, St, CrossM) {}
+		XAieDmaChannelCycles(XAieDev &Dev, XAie_LocType L,
+			XAie_DmaDirection Dir, uint32_t ChNum,
+			XAieStreamPortState St = XAIE_STREAM_PORT_RUNNING,
+			bool CrossM = false):
+			XAieDmaChannelCycles(Dev.getDevHandle(), L, Dir, ChNum,
+				St, CrossM) {}
+		/**
+		 * This function returns the number of bytes moved by the
+		 * channel since the counter started. It is only meaningful
+		 * when running cycles are counted.
+		 *
+		 * @param Bytes returns the number of bytes
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC readBytes(uint64_t &Bytes) {
+			uint32_t Cycles;
+			AieRC RC;
+
+			RC = readResult(Cycles);
+			if (RC == XAIE_OK) {
+				Bytes = static_cast<uint64_t>(Cycles) *
+					XAIEFAL_STREAM_BYTES_PER_CYCLE;
+			}
+			return RC;
+		}
+	};
 }
@@ -0,0 +1,260 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-common.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/profile/xaiefal-perf-collector.hpp>
+#include <xaiefal/profile/xaiefal-perf-mux.hpp>
+#include <xaiefal/rsc/xaiefal-perf.hpp>
+
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+#include <thread>
+#endif
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @struct XAiePerfSample
+	 * @brief Timestamped value of one counter of a perf sampler.
+	 */
+	struct XAiePerfSample {
+		uint64_t TimeNs; /**< host steady clock time of the sweep */
+		uint32_t Index; /**< index of the counter in the sampler */
+		uint32_t Value; /**< raw 32-bit counter value */
+	};
+
+	/**
+	 * @class XAiePerfSampler
+	 * @brief Samples a set of running perf counters at a fixed interval
+	 * on a thread of its own.
+	 * The counters are read with a perf collector, one block read per
+	 * module, and the samples are pushed to a single producer
+	 * single consumer ring buffer. Consumers drain it without blocking
+	 * the sampler; samples which do not fit are dropped and counted.
+	 * Perf muxes added to the sampler are rotated by the same thread at
+	 * their own interval, so events multiplexed on the counters are
+	 * measured in the same run.
+	 */
+	class XAiePerfSampler {
+	public:
+		XAiePerfSampler() = delete;
+		XAiePerfSampler(const std::shared_ptr<XAieDevHandle> &DevHd,
+			size_t RingSize = 4096): AieHd(DevHd), Collector(DevHd),
+			Running(false), Head(0), Tail(0), Dropped(0), Sweeps(0),
+			BusyNs(0) {
+			size_t Size = 1;
+
+			while (Size < RingSize) {
+				Size <<= 1;
+			}
+			Ring.resize(Size);
+		}
+		XAiePerfSampler(XAieDev &Dev, size_t RingSize = 4096):
+			XAiePerfSampler(Dev.getDevHandle(), RingSize) {}
+		~XAiePerfSampler() {
+			stop();
+		}
+		/**
+		 * This function adds a counter to the sampler. The counter
+		 * has to be running when the sampler is started.
+		 *
+		 * @param C perf counter, e.g. XAieActiveCycles or
+		 *	  XAieStallCycles
+		 * @return index of the counter in the samples
+		 */
+		uint32_t addCounter(std::shared_ptr<XAiePerfCounter> C) {
+			return Collector.addCounter(C);
+		}
+		/**
+		 * This function adds a perf mux to be rotated by the sampler
+		 * at the interval of the mux. The mux has to be started before
+		 * the sampler; its results are read from the mux.
+		 *
+		 * @param M perf mux
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC addMux(std::shared_ptr<XAiePerfMux> M) {
+			if (Running) {
+				XAIEFAL_LOG(ERROR) << "sampler " << __func__ <<
+					" sampler is running." << '\n';
+				return XAIE_ERR;
+			}
+			vMuxes.push_back({M, std::chrono::steady_clock::now()});
+			return XAIE_OK;
+		}
+		/**
+		 * This function starts sampling the counters.
+		 *
+		 * @param PeriodUs sampling period in microseconds
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC start(uint32_t PeriodUs) {
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+			AieRC RC;
+
+			if (Running) {
+				XAIEFAL_LOG(ERROR) << "sampler " << __func__ <<
+					" already started." << '\n';
+				return XAIE_ERR;
+			}
+			RC = Collector.prepare();
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+			Period = std::chrono::microseconds(PeriodUs);
+			for (auto &M: vMuxes) {
+				M.Next = std::chrono::steady_clock::now() +
+					std::chrono::microseconds(M.Mux->interval());
+			}
+			Running = true;
+			Thread = std::thread(&XAiePerfSampler::_run, this);
+			return XAIE_OK;
+#else
+			(void)PeriodUs;
+			XAIEFAL_LOG(ERROR) << "sampler " << __func__ <<
+				" threads not supported." << '\n';
+			return XAIE_FEATURE_NOT_SUPPORTED;
+#endif
+		}
+		/**
+		 * This function stops sampling. Samples left in the ring
+		 * buffer can still be drained.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC stop() {
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+			if (Running) {
+				Running = false;
+				Thread.join();
+			}
+#endif
+			return XAIE_OK;
+		}
+		/**
+		 * This function moves the samples available in the ring
+		 * buffer to a vector. It does not block the sampler.
+		 *
+		 * @param vSamples vector the samples are appended to
+		 * @param Max maximum number of samples to drain
+		 * @return number of samples drained
+		 */
+		size_t drain(std::vector<XAiePerfSample> &vSamples,
+				size_t Max = SIZE_MAX) {
+			size_t H = Head.load(std::memory_order_relaxed);
+			size_t T = Tail.load(std::memory_order_acquire);
+			size_t N = std::min(T - H, Max);
+
+			for (size_t i = 0; i < N; i++) {
+				vSamples.push_back(Ring[(H + i) & (Ring.size() - 1)]);
+			}
+			Head.store(H + N, std::memory_order_release);
+			return N;
+		}
+		/**
+		 * This function returns the number of samples dropped as the
+		 * ring buffer was full.
+		 *
+		 * @return number of dropped samples
+		 */
+		uint64_t dropped() const {
+			return Dropped.load(std::memory_order_relaxed);
+		}
+		/**
+		 * This function returns the overhead of the sampler.
+		 *
+		 * @param NumSweeps returns the number of sweeps over the
+		 *	  counters done so far
+		 * @param TotalNs returns the time spent reading counters and
+		 *	  pushing samples in nanoseconds
+		 */
+		void overhead(uint64_t &NumSweeps, uint64_t &TotalNs) const {
+			NumSweeps = Sweeps.load(std::memory_order_relaxed);
+			TotalNs = BusyNs.load(std::memory_order_relaxed);
+		}
+	private:
+		std::shared_ptr<XAieDevHandle> AieHd; /**< AI engine device */
+		XAiePerfCollector Collector; /**< counters read per sweep */
+		std::vector<XAiePerfSample> Ring; /**< sample ring buffer */
+		std::chrono::microseconds Period; /**< sampling period */
+		std::atomic<bool> Running;
+		std::atomic<size_t> Head; /**< next sample to drain */
+		std::atomic<size_t> Tail; /**< next sample to fill */
+		std::atomic<uint64_t> Dropped;
+		std::atomic<uint64_t> Sweeps;
+		std::atomic<uint64_t> BusyNs;
+		/* perf mux and its next rotation time */
+		struct MuxEntry {
+			std::shared_ptr<XAiePerfMux> Mux;
+			std::chrono::steady_clock::time_point Next;
+		};
+		std::vector<MuxEntry> vMuxes;
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+		std::thread Thread;
+#endif
+
+		void _sweep() {
+			auto Start = std::chrono::steady_clock::now();
+			uint64_t TimeNs = std::chrono::duration_cast<
+				std::chrono::nanoseconds>(
+				Start.time_since_epoch()).count();
+			size_t T = Tail.load(std::memory_order_relaxed);
+			size_t H = Head.load(std::memory_order_acquire);
+
+			if (Collector.read() != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << "sampler " << __func__ <<
+					" failed to read counters." << '\n';
+			} else {
+				for (uint32_t i = 0; i < Collector.size(); i++) {
+					if (T - H >= Ring.size()) {
+						Dropped.fetch_add(1, std::memory_order_relaxed);
+						continue;
+					}
+					XAiePerfSample &Sample = Ring[T & (Ring.size() - 1)];
+					Sample.TimeNs = TimeNs;
+					Sample.Index = i;
+					Sample.Value = Collector.result(i);
+					T++;
+				}
+			}
+			Tail.store(T, std::memory_order_release);
+
+			for (auto &M: vMuxes) {
+				if (Start < M.Next || !M.Mux->isRunning()) {
+					continue;
+				}
+				if (M.Mux->rotate() != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "sampler " << __func__ <<
+						" failed to rotate perf mux." << '\n';
+				}
+				M.Next = Start + std::chrono::microseconds(
+					M.Mux->interval());
+			}
+
+			auto End = std::chrono::steady_clock::now();
+			Sweeps.fetch_add(1, std::memory_order_relaxed);
+			BusyNs.fetch_add(std::chrono::duration_cast<
+				std::chrono::nanoseconds>(End - Start).count(),
+				std::memory_order_relaxed);
+		}
+#ifdef __COMPILER_SUPPORTS_LOCKS__
+		void _run() {
+			auto Next = std::chrono::steady_clock::now();
+
+			while (Running) {
+				_sweep();
+				Next += Period;
+				std::this_thread::sleep_until(Next);
+			}
+		}
+#endif
+	};
+}
@@ -0,0 +1,233 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-common.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/rsc/xaiefal-events.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @struct XAieTraceMarkerRec
+	 * @brief Side table record of a marker with a payload.
+	 */
+	struct XAieTraceMarkerRec {
+		uint64_t Seq; /**< occurrence of the marker event, from 0 */
+		uint64_t HostNs; /**< host steady clock time of the marker */
+		uint64_t Payload; /**< payload of the marker */
+		uint32_t Index; /**< index of the marker event */
+	};
+
+	/**
+	 * @class XAieTraceMarker
+	 * @brief Emits markers from host code into the trace of a shim tile.
+	 * A marker generates a user event of the shim tile reserved by the
+	 * marker. Once the events are added to the trace of the shim tile,
+	 * each marker shows in the trace at the cycle it reached the tile,
+	 * which aligns the host and device timelines. The register write of
+	 * every event is computed at reserve() and a marker only issues
+	 * it, without validation.
+	 * Payloads are kept in a side table on the host: the Nth occurrence
+	 * of a marker event in the trace is the record with sequence N of
+	 * that event, as long as the event is only used for markers with a
+	 * payload.
+	 */
+	class XAieTraceMarker {
+	public:
+		XAieTraceMarker() = delete;
+		XAieTraceMarker(const std::shared_ptr<XAieDevHandle> &DevHd,
+			XAie_LocType ShimLoc, uint32_t NumEvents = 1,
+			size_t TableSize = 4096): AieHd(DevHd), Loc(ShimLoc),
+			NumEvts(NumEvents), Tail(0) {
+			size_t Size = 1;
+
+			while (Size < TableSize) {
+				Size <<= 1;
+			}
+			Table.resize(Size);
+		}
+		XAieTraceMarker(XAieDev &Dev, XAie_LocType ShimLoc,
+			uint32_t NumEvents = 1, size_t TableSize = 4096):
+			XAieTraceMarker(Dev.getDevHandle(), ShimLoc, NumEvents,
+				TableSize) {}
+		XAieTraceMarker(const XAieTraceMarker &) = delete;
+		XAieTraceMarker &operator=(const XAieTraceMarker &) = delete;
+		~XAieTraceMarker() {
+			release();
+		}
+		/**
+		 * This function reserves the user events of the markers and
+		 * computes their register writes.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC reserve() {
+			AieRC RC = XAIE_OK;
+
+			if (!vEvents.empty()) {
+				XAIEFAL_LOG(ERROR) << "trace marker " << __func__ <<
+					" already reserved." << '\n';
+				return XAIE_ERR;
+			}
+			for (uint32_t i = 0; i < NumEvts && RC == XAIE_OK; i++) {
+				MarkerEvent M;
+
+				M.UserEvent = std::make_shared<XAieUserEvent>(AieHd,
+					Loc, XAIE_PL_MOD);
+				M.Seq = 0;
+				RC = M.UserEvent->reserve();
+				if (RC == XAIE_OK) {
+					RC = M.UserEvent->getEvent(M.Event);
+					if (RC == XAIE_OK) {
+						RC = XAie_EventGenerateHandle(
+							AieHd->dev(), Loc,
+							XAIE_PL_MOD, M.Event,
+							&M.Hdl);
+					}
+					if (RC != XAIE_OK) {
+						M.UserEvent->release();
+					}
+				}
+				if (RC == XAIE_OK) {
+					vEvents.push_back(M);
+				}
+			}
+			if (RC != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << "trace marker " << __func__ <<
+					" (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ") failed to reserve " <<
+					NumEvts << " user events." << '\n';
+				release();
+			}
+			return RC;
+		}
+		/**
+		 * This function releases the user events of the markers.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC release() {
+			for (auto &M: vEvents) {
+				M.UserEvent->release();
+			}
+			vEvents.clear();
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns a marker event, to be added to the
+		 * trace of the shim tile.
+		 *
+		 * @param Index index of the marker event
+		 * @param E returns the user event
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC getEvent(uint32_t Index, XAie_Events &E) const {
+			if (Index >= vEvents.size()) {
+				XAIEFAL_LOG(ERROR) << "trace marker " << __func__ <<
+					" invalid index " << Index << '\n';
+				return XAIE_INVALID_ARGS;
+			}
+			E = vEvents[Index].Event;
+			return XAIE_OK;
+		}
+		/**
+		 * This function emits a marker, as one register write. It
+		 * does not validate the index.
+		 *
+		 * @param Index index of the marker event
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC mark(uint32_t Index = 0) {
+			return XAie_EventGenerateFast(AieHd->dev(),
+				&vEvents[Index].Hdl);
+		}
+		/**
+		 * This function emits a marker with a payload. The payload
+		 * is recorded in the side table with the host time and the
+		 * sequence of the marker, under a lock so the records and the
+		 * events of concurrent callers are in the same order. It
+		 * does not validate the index.
+		 *
+		 * @param Index index of the marker event
+		 * @param Payload payload of the marker, e.g. a request id
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC mark(uint32_t Index, uint64_t Payload) {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+			MarkerEvent &M = vEvents[Index];
+			uint64_t T = Tail.load(std::memory_order_relaxed);
+			XAieTraceMarkerRec &R = Table[T & (Table.size() - 1)];
+
+			R.Seq = M.Seq++;
+			R.HostNs = std::chrono::duration_cast<
+				std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().
+				time_since_epoch()).count();
+			R.Payload = Payload;
+			R.Index = Index;
+			Tail.store(T + 1, std::memory_order_release);
+			return XAie_EventGenerateFast(AieHd->dev(), &M.Hdl);
+		}
+		/**
+		 * This function returns the records of the side table, oldest
+		 * first. Once more markers than the table size were emitted,
+		 * only the latest ones are kept.
+		 *
+		 * @param vRecs vector the records are appended to
+		 * @return number of records lost as the table wrapped
+		 */
+		uint64_t getRecords(std::vector<XAieTraceMarkerRec> &vRecs) {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+			uint64_t T = Tail.load(std::memory_order_acquire);
+			uint64_t H = T > Table.size() ? T - Table.size() : 0;
+
+			for (uint64_t i = H; i < T; i++) {
+				vRecs.push_back(Table[i & (Table.size() - 1)]);
+			}
+			return H;
+		}
+		/**
+		 * This function clears the side table and the sequences of
+		 * the marker events, e.g. for a new trace.
+		 */
+		void clear() {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+
+			for (auto &M: vEvents) {
+				M.Seq = 0;
+			}
+			Tail.store(0, std::memory_order_relaxed);
+		}
+		/**
+		 * This function returns the number of marker events.
+		 *
+		 * @return number of reserved marker events
+		 */
+		uint32_t size() const {
+			return static_cast<uint32_t>(vEvents.size());
+		}
+	private:
+		/* marker event and its pre-computed register write */
+		struct MarkerEvent {
+			std::shared_ptr<XAieUserEvent> UserEvent;
+			XAie_Events Event;
+			XAie_EventGenHandle Hdl;
+			uint64_t Seq; /**< next payload sequence */
+		};
+
+		std::shared_ptr<XAieDevHandle> AieHd; /**< AI engine device */
+		XAie_LocType Loc; /**< shim tile of the markers */
+		uint32_t NumEvts; /**< number of marker events to reserve */
+		std::vector<MarkerEvent> vEvents;
+		std::vector<XAieTraceMarkerRec> Table; /**< payload side table */
+		std::atomic<uint64_t> Tail; /**< records written */
+		_XAIEFAL_MUTEX_DECLARE(mLock); /**< side table mutex lock */
+	};
+}
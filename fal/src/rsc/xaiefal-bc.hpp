@@ -4,6 +4,7 @@
 #include <fstream>
 #include <functional>
 #include <string.h>
+#include <utility>
 #include <vector>
 #include <xaiengine.h>
 
@@ -29,7 +30,7 @@ namespace xaiefal {
 	class XAieBroadcast: public XAieRsc {
 	public:
 		XAieBroadcast() = delete;
-		XAieBroadcast(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieBroadcast(const std::shared_ptr<XAieDevHandle> &DevHd,
 			const std::vector<XAie_LocType> &vL,
 			XAie_ModuleType StartM, XAie_ModuleType EndM):
 			XAieRsc(DevHd) {
@@ -40,10 +41,48 @@ namespace xaiefal {
 			State.Initialized = 1;
 			State.Configured = 1;
 		}
+		XAieBroadcast(const std::shared_ptr<XAieDevHandle> &DevHd,
+			std::vector<XAie_LocType> &&vL,
+			XAie_ModuleType StartM, XAie_ModuleType EndM):
+			XAieRsc(DevHd), StartMod(StartM), EndMod(EndM),
+			vLocs(std::move(vL)) {
+			State.Initialized = 1;
+			State.Configured = 1;
+		}
+		/**
+		 * This constructor takes the tiles of the channel from an
+		 * iterator range, e.g. a plain array or a part of a larger
+		 * container, without building a temporary vector.
+		 *
+		 * @param DevHd AI engine device handle
+		 * @param First iterator to the first tile
+		 * @param Last iterator past the last tile
+		 * @param StartM starting module of the channel
+		 * @param EndM ending module of the channel
+		 */
+		template<class It>
+		XAieBroadcast(const std::shared_ptr<XAieDevHandle> &DevHd,
+			It First, It Last,
+			XAie_ModuleType StartM, XAie_ModuleType EndM):
+			XAieRsc(DevHd), StartMod(StartM), EndMod(EndM),
+			vLocs(First, Last) {
+			State.Initialized = 1;
+			State.Configured = 1;
+		}
 		XAieBroadcast(XAieDev &Dev,
 			const std::vector<XAie_LocType> &vL,
 			XAie_ModuleType StartM, XAie_ModuleType EndM):
 			XAieBroadcast(Dev.getDevHandle(), vL, StartM, EndM) {}
+		XAieBroadcast(XAieDev &Dev,
+			std::vector<XAie_LocType> &&vL,
+			XAie_ModuleType StartM, XAie_ModuleType EndM):
+			XAieBroadcast(Dev.getDevHandle(), std::move(vL),
+				StartM, EndM) {}
+		template<class It>
+		XAieBroadcast(XAieDev &Dev, It First, It Last,
+			XAie_ModuleType StartM, XAie_ModuleType EndM):
+			XAieBroadcast(Dev.getDevHandle(), First, Last,
+				StartM, EndM) {}
 		~XAieBroadcast() {}
 		/**
 		 * This function returns the broadcast channel ID
@@ -72,10 +111,10 @@ namespace xaiefal {
 			AieRC RC = XAIE_INVALID_ARGS;
 
 			if (State.Reserved == 0) {
-				Logger::log(LogLevel::ERROR) << "broadcast object " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "broadcast object " << __func__ << " (" <<
 					static_cast<uint32_t>(L.Col) << "," << static_cast<uint32_t>(L.Row) << ")" <<
 					" Mod= " << M <<
-					" resource not reserved." << std::endl;
+					" resource not reserved." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				for (int i = 0; i < (int)vLocs.size(); i++) {
@@ -112,6 +151,15 @@ namespace xaiefal {
 
 			return XAIE_OK;
 		}
+		/**
+		 * This function returns the tiles of the channel without
+		 * copying them.
+		 *
+		 * @return tiles of the channel
+		 */
+		const std::vector<XAie_LocType> &getLocs() const {
+			return vLocs;
+		}
 		uint32_t getRscType() const {
 			return static_cast<uint32_t>(XAIE_BCAST_CHANNEL_RSC);
 		}
@@ -139,10 +187,9 @@ namespace xaiefal {
 				numRscs = AieHd->dev()->AieTileNumRows * AieHd->dev()->NumCols * 2
 				+ (AieHd->dev()->NumRows - AieHd->dev()->AieTileNumRows) * AieHd->dev()->NumCols;
 				XAie_UserRsc rsc;
-				for (uint32_t i = 0; i < numRscs; i++) {
-					rsc.RscType = XAIE_BCAST_CHANNEL_RSC;
-					vRscs.push_back(rsc);
-				}
+
+				rsc.RscType = XAIE_BCAST_CHANNEL_RSC;
+				vRscs.assign(numRscs, rsc);
 				RC = XAIE_OK;
 			} else {
 				RC = setRscs(AieHd, vLocs, StartMod, EndMod, vRscs);
@@ -150,6 +197,11 @@ namespace xaiefal {
 				broadcastAll = 0;
 			}
 
+			if (RC == XAIE_OK && broadcastAll == 0 &&
+				AieHd->takePooledRscs(vRscs.data(), numRscs,
+					preferredId)) {
+				return XAIE_OK;
+			}
 			if (RC == XAIE_OK) {
 				if (preferredId == XAIE_RSC_ID_ANY) {
 					RC = XAie_RequestBroadcastChannel(AieHd->dev(), &numRscs, &vRscs[0], broadcastAll);
@@ -162,6 +214,10 @@ namespace xaiefal {
 
 		}
 		AieRC _release() {
+			if (vLocs.size() != 0 &&
+				AieHd->poolRscs(vRscs.data(), vRscs.size())) {
+				return XAIE_OK;
+			}
 			return XAie_ReleaseBroadcastChannel(AieHd->dev(), vRscs.size(), &vRscs[0]);
 		}
 		AieRC _start() {
@@ -289,8 +345,8 @@ namespace xaiefal {
 				i++;
 			}
 			if (RC != XAIE_OK) {
-				Logger::log(LogLevel::ERROR) << "BC: " <<
-					" failed to stop." << std::endl;
+				XAIEFAL_LOG(ERROR) << "BC: " <<
+					" failed to stop." << '\n';
 			}
 			return RC;
 		}
@@ -322,8 +378,8 @@ namespace xaiefal {
 				}
 			}
 			if (iRC != (int)XAIE_OK) {
-				Logger::log(LogLevel::ERROR) << "BC: " <<
-					" failed to stop." << std::endl;
+				XAIEFAL_LOG(ERROR) << "BC: " <<
+					" failed to stop." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				RC = XAIE_OK;
@@ -344,7 +400,7 @@ namespace xaiefal {
 		 * TODO: Following function will not be required.
 		 * Bitmap will be moved to device driver
 		 */
-		static AieRC setRscs(std::shared_ptr<XAieDevHandle> Dev,
+		static AieRC setRscs(const std::shared_ptr<XAieDevHandle> &Dev,
 				const std::vector<XAie_LocType> &vL,
 				XAie_ModuleType startM, XAie_ModuleType endM,
 				std::vector<XAie_UserRsc> &vR) {
@@ -353,11 +409,12 @@ namespace xaiefal {
 			    (vL.back().Row == 0 && endM != XAIE_PL_MOD) ||
 			    (vL[0].Row != 0 && startM == XAIE_PL_MOD) ||
 			    (vL.back().Row != 0 && endM == XAIE_PL_MOD)) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"BC: invalid tiles and modules combination." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"BC: invalid tiles and modules combination." << '\n';
 				return XAIE_INVALID_ARGS;
 			}
 
+			vR.reserve(vL.size() * 2);
 			for (size_t i = 0; i < vL.size(); i++) {
 				XAie_UserRsc R;
 				uint32_t TType;
@@ -367,10 +424,10 @@ namespace xaiefal {
 				TType = _XAie_GetTileTypefromLoc(Dev->dev(),
 						vL[i]);
 				if (TType == XAIEGBL_TILE_TYPE_MAX) {
-					Logger::log(LogLevel::ERROR) << __func__ <<
+					XAIEFAL_LOG(ERROR) << __func__ <<
 						"BC: invalid tile (" << vL[i].Col <<
 						"," << vL[i].Row <<")" <<
-						std::endl;
+						'\n';
 					return XAIE_INVALID_ARGS;
 				}
 
@@ -393,9 +450,9 @@ namespace xaiefal {
 				if (i != vL.size() - 1) {
 					if (vL[i+1].Row == vL[i].Row &&
 						vL[i+1].Col == vL[i].Col) {
-						Logger::log(LogLevel::ERROR) << __func__ <<
+						XAIEFAL_LOG(ERROR) << __func__ <<
 							"BC: duplicated tiles in the vector." <<
-							std::endl;
+							'\n';
 						return XAIE_INVALID_ARGS;
 					}
 					if (vL[i+1].Row != vL[i].Row) {
@@ -404,9 +461,9 @@ namespace xaiefal {
 							 (vL[i+1].Row - vL[i].Row) > 1) ||
 							(vL[i+1].Row < vL[i].Row &&
 							 (vL[i].Row - vL[i+1].Row) > 1)) {
-							Logger::log(LogLevel::ERROR) << __func__ <<
+							XAIEFAL_LOG(ERROR) << __func__ <<
 								"BC: discontinuous input tiles." <<
-								std::endl;
+								'\n';
 							return XAIE_INVALID_ARGS;
 						}
 					} else {
@@ -414,9 +471,9 @@ namespace xaiefal {
 						     (vL[i+1].Col - vL[i].Col) > 1) ||
 						    (vL[i+1].Col < vL[i].Col &&
 						     (vL[i].Col - vL[i+1].Col) > 1)) {
-							Logger::log(LogLevel::ERROR) << __func__ <<
+							XAIEFAL_LOG(ERROR) << __func__ <<
 								"BC: discontinuous input tiles." <<
-								std::endl;
+								'\n';
 							return XAIE_INVALID_ARGS;
 						}
 					}
@@ -19,7 +19,7 @@ namespace xaiefal {
 	class XAieComboEvent: public XAieSingleTileRsc {
 	public:
 		XAieComboEvent() = delete;
-		XAieComboEvent(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieComboEvent(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L, XAie_ModuleType M, uint32_t ENum = 2):
 			XAieSingleTileRsc(DevHd, L, M) {
 			if (ENum > 4 || ENum < 2) {
@@ -50,9 +50,9 @@ namespace xaiefal {
 			if ((vE.size() != vEvents.size()) || (vOp.size() > 3) ||
 				(vE.size() <= 2 && vOp.size() > 1) ||
 				(vE.size() > 2 && vOp.size() < 2)) {
-				Logger::log(LogLevel::ERROR) << "combo event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "combo event " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row <<
-					" Mod=" << Mod <<  " invalid number of input events and ops." << std::endl;
+					" Mod=" << Mod <<  " invalid number of input events and ops." << '\n';
 				RC = XAIE_INVALID_ARGS;
 			} else {
 				for (int i = 0; i < (int)vE.size(); i++) {
@@ -61,9 +61,9 @@ namespace xaiefal {
 					RC = XAie_EventLogicalToPhysicalConv(dev(), Loc,
 							Mod, vE[i], &HwEvent);
 					if (RC != XAIE_OK) {
-						Logger::log(LogLevel::ERROR) << "combo event " << __func__ << " (" <<
+						XAIEFAL_LOG(ERROR) << "combo event " << __func__ << " (" <<
 							(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row <<
-							" Mod=" << Mod <<  " invalid E=" << vE[i] << std::endl;
+							" Mod=" << Mod <<  " invalid E=" << vE[i] << '\n';
 						break;
 					} else {
 						vEvents[i] = vE[i];
@@ -94,9 +94,9 @@ namespace xaiefal {
 
 			(void)vE;
 			if (State.Reserved == 0) {
-				Logger::log(LogLevel::ERROR) << "combo event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "combo event " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row <<
-					" Mod=" << Mod <<  " resource is not reserved." << std::endl;
+					" Mod=" << Mod <<  " resource is not reserved." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				XAie_Events BaseEvent;
@@ -129,9 +129,9 @@ namespace xaiefal {
 				}
 				RC = XAIE_OK;
 			} else {
-				Logger::log(LogLevel::ERROR) << "combo event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "combo event " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row <<
-					" Mod=" << Mod <<  " no input events specified." << std::endl;
+					" Mod=" << Mod <<  " no input events specified." << '\n';
 				RC = XAIE_ERR;
 			}
 			return RC;
@@ -196,9 +196,9 @@ namespace xaiefal {
 				RC = XAie_EventComboConfig(dev(), Loc, Mod,
 						ComboId, vOps[i/2], vEvents[i], vEvents[i+1]);
 				if (RC != XAIE_OK) {
-					Logger::log(LogLevel::ERROR) << "combo event " << __func__ << " (" <<
+					XAIEFAL_LOG(ERROR) << "combo event " << __func__ << " (" <<
 						(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row <<
-						" Mod=" << Mod <<  " failed to config combo " << ComboId << std::endl;
+						" Mod=" << Mod <<  " failed to config combo " << ComboId << '\n';
 					for (XAie_EventComboId tId = StartCId;
 						tId < ComboId;
 						tId = (XAie_EventComboId)((int)tId + i)) {
@@ -212,9 +212,9 @@ namespace xaiefal {
 				RC = XAie_EventComboConfig(dev(), Loc, Mod,
 					XAIE_EVENT_COMBO2, vOps[2], vEvents[0], vEvents[0]);
 				if (RC != XAIE_OK) {
-					Logger::log(LogLevel::ERROR) << "combo event " << __func__ << " (" <<
+					XAIEFAL_LOG(ERROR) << "combo event " << __func__ << " (" <<
 						(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row <<
-						" Mod=" << Mod <<  " failed to config combo " << XAIE_EVENT_COMBO2 << std::endl;
+						" Mod=" << Mod <<  " failed to config combo " << XAIE_EVENT_COMBO2 << '\n';
 				}
 			}
 			return RC;
@@ -247,7 +247,7 @@ namespace xaiefal {
 	class XAieUserEvent: public XAieSingleTileRsc {
 	public:
 		XAieUserEvent() = delete;
-		XAieUserEvent(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieUserEvent(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L, XAie_ModuleType M):
 			XAieSingleTileRsc(DevHd, L, M) {
 			State.Initialized = 1;
@@ -268,9 +268,9 @@ namespace xaiefal {
 			AieRC RC = XAIE_OK;
 
 			if (State.Reserved == 0) {
-				Logger::log(LogLevel::ERROR) << "User Event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "User Event " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ")" <<
-					" resource not resesrved." << std::endl;
+					" resource not resesrved." << '\n';
 				RC = XAIE_INVALID_ARGS;
 			} else {
 				E = _getEventFromId(Rsc.RscId);
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <string.h>
+#include <unordered_map>
 #include <vector>
 #include <xaiengine.h>
 
@@ -18,7 +19,7 @@ namespace xaiefal {
 	class XAieGroupEvent: public XAieSingleTileRsc {
 	public:
 		XAieGroupEvent() = delete;
-		XAieGroupEvent(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieGroupEvent(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L, XAie_ModuleType M, XAie_Events gE):
 			XAieSingleTileRsc(DevHd, L, M),
 			GroupEvent(gE), GroupComposition(0) {
@@ -62,19 +63,19 @@ namespace xaiefal {
 			_XAIEFAL_MUTEX_ACQUIRE(mLock);
 
 			if (Hid == nullptr) {
-				Logger::log(LogLevel::ERROR) << "Group event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "Group event " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
-					" Mod=" << Mod << ", empty handle." << std::endl;
+					" Mod=" << Mod << ", empty handle." << '\n';
 				return XAIE_INVALID_ARGS;
 			}
 			if (State.Reserved == 1) {
 				if (GroupComposition != C) {
-					Logger::log(LogLevel::ERROR) << "Group event " << __func__ << " (" <<
+					XAIEFAL_LOG(ERROR) << "Group event " << __func__ << " (" <<
 						(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 						" Mod=" << Mod << "(" <<
 						GroupEvent << ") is reserved with " <<
 						GroupComposition << ", request composition is " <<
-						C << "." << std::endl;
+						C << "." << '\n';
 					RC = XAIE_INVALID_ARGS;
 				} else {
 					Handles.emplace(Hid, false);
@@ -106,11 +107,11 @@ namespace xaiefal {
 
 			auto H = Handles.find(Hid);
 			if (H == Handles.end()) {
-				Logger::log(LogLevel::ERROR) << "Group event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "Group event " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Mod=" << Mod <<
 					" group event(" << GroupEvent <<
-					"), invalid handle." << std::endl;
+					"), invalid handle." << '\n';
 				RC = XAIE_INVALID_ARGS;
 			} else {
 				_XAIEFAL_MUTEX_ACQUIRE(mLock);
@@ -141,11 +142,11 @@ namespace xaiefal {
 
 			auto H = Handles.find(Hid);
 			if (H == Handles.end()) {
-				Logger::log(LogLevel::ERROR) << "Group event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "Group event " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Mod=" << Mod <<
 					" group event(" << GroupEvent <<
-					"), invalid handle." << std::endl;
+					"), invalid handle." << '\n';
 				RC = XAIE_INVALID_ARGS;
 			} else {
 				_XAIEFAL_MUTEX_ACQUIRE(mLock);
@@ -159,8 +160,8 @@ namespace xaiefal {
 				// use for loop to save memory, as this is
 				// not in performance critical path as it is
 				// used for profiling and debugging.
-				std::map<const XAieGroupEventHandle *, bool>::iterator it;
-				for (it = Handles.begin(); it != Handles.end();
+				auto it = Handles.begin();
+				for (; it != Handles.end();
 				     it++) {
 					if (it->second) {
 						break;
@@ -193,11 +194,11 @@ namespace xaiefal {
 
 			auto H = Handles.find(Hid);
 			if (H == Handles.end()) {
-				Logger::log(LogLevel::ERROR) << "Group event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "Group event " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Mod=" << Mod <<
 					" group event(" << GroupEvent <<
-					"), invalid handle." << std::endl;
+					"), invalid handle." << '\n';
 				RC = XAIE_INVALID_ARGS;
 			} else {
 				_XAIEFAL_MUTEX_ACQUIRE(mLock);
@@ -216,7 +217,7 @@ namespace xaiefal {
 		XAie_Events GroupEvent; /**< group event */
 		uint32_t GroupComposition; /**< group event configuration */
 		_XAIEFAL_MUTEX_DECLARE(mLock); /**< group config mutex lock */
-		std::map<const XAieGroupEventHandle *, bool> Handles; /**< Group events handles */
+		std::unordered_map<const XAieGroupEventHandle *, bool> Handles; /**< Group events handles */
 
 	protected:
 		AieRC _reserve() {
@@ -229,7 +230,7 @@ namespace xaiefal {
 			Rsc.RscId = static_cast<uint32_t>(GroupEvent);
 			RC = XAie_RequestAllocatedGroupEvents(dev(), 1, &Rsc);
 			if (RC != XAIE_OK) {
-				Logger::log(LogLevel::WARN) << "Group event " << __func__ << " (" <<
+				XAIEFAL_LOG(WARN) << "Group event " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Mod=" << Mod << " resource not available.\n";
 			}
@@ -269,7 +270,7 @@ namespace xaiefal {
 		 * @param Id returns the group ID of the group event
 		 * @return XAIE_OK for success, and error code for failure
 		 */
-		static AieRC getGroupId(std::shared_ptr<XAieDevHandle> DevHd,
+		static AieRC getGroupId(const std::shared_ptr<XAieDevHandle> &DevHd,
 				XAie_ModuleType M, XAie_Events E, uint32_t &Id) {
 			uint32_t i, *EIds;
 			uint32_t EIdsTotal;
@@ -296,9 +297,9 @@ namespace xaiefal {
 			}
 			if (i >= EIdsTotal) {
 				RC = XAIE_INVALID_ARGS;
-				Logger::log(LogLevel::ERROR) << "Group event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "Group event " << __func__ << " (" <<
 					" Mod=" << M << " " << E <<
-					" invalid." << std::endl;
+					" invalid." << '\n';
 			} else {
 				RC = XAIE_OK;
 			}
@@ -313,7 +314,7 @@ namespace xaiefal {
 	class XAieGroupEventHandle: public XAieRsc {
 	public:
 		XAieGroupEventHandle() = delete;
-		XAieGroupEventHandle(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieGroupEventHandle(const std::shared_ptr<XAieDevHandle> &DevHd,
 			std::shared_ptr<XAieGroupEvent> gEPtr):
 			XAieRsc(DevHd), GroupEventPtr(gEPtr), GroupComposition(0) {
 			State.Initialized = 1;
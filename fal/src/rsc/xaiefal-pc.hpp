@@ -19,7 +19,7 @@ namespace xaiefal {
 	class XAiePCEvent: public XAieSingleTileRsc {
 	public:
 		XAiePCEvent() = delete;
-		XAiePCEvent(std::shared_ptr<XAieDevHandle> DevHd,
+		XAiePCEvent(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L):
 			XAieSingleTileRsc(DevHd, L, XAIE_CORE_MOD), PcAddr(0) {
 			State.Initialized = 1;
@@ -60,9 +60,9 @@ namespace xaiefal {
 		AieRC getEvent(XAie_Events &E) const {
 			AieRC RC = XAIE_OK;
 			if (State.Reserved == 0) {
-				Logger::log(LogLevel::ERROR) << "PC Event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "PC Event " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ")" <<
-					" resource not resesrved." << std::endl;
+					" resource not resesrved." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				E = XAIE_EVENT_PC_0_CORE;
@@ -80,9 +80,9 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (_XAie_GetTileTypefromLoc(dev(), Loc) != XAIEGBL_TILE_TYPE_AIETILE) {
-				Logger::log(LogLevel::ERROR) << "PC event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "PC event " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ")" <<
-					" tile is not core tile." << std::endl;
+					" tile is not core tile." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				if (preferredId == XAIE_RSC_ID_ANY) {
@@ -99,7 +99,7 @@ namespace xaiefal {
 					RC = XAie_RequestAllocatedPCEvents(AieHd->dev(), 1, &Rsc);
 				}
 				if (RC != XAIE_OK) {
-					Logger::log(LogLevel::WARN) << "PC event " << __func__ << " (" <<
+					XAIEFAL_LOG(WARN) << "PC event " << __func__ << " (" <<
 						static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ")" <<
 						" no available resource.\n";
 				}
@@ -130,7 +130,7 @@ namespace xaiefal {
 	class XAiePCRange: public XAieSingleTileRsc {
 	public:
 		XAiePCRange() = delete;
-		XAiePCRange(std::shared_ptr<XAieDevHandle> DevHd,
+		XAiePCRange(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L):
 			XAieSingleTileRsc(DevHd, L) {
 			for (int i = 0;
@@ -181,9 +181,9 @@ namespace xaiefal {
 		AieRC getEvent(XAie_Events &E) const {
 			AieRC RC = XAIE_OK;
 			if (State.Reserved == 0) {
-				Logger::log(LogLevel::ERROR) << "PC range " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "PC range " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ")" <<
-					" resource not resesrved." << std::endl;
+					" resource not resesrved." << '\n';
 				RC = XAIE_ERR;
 			} else if (Rscs[0].RscId == 0) {
 				E = XAIE_EVENT_PC_RANGE_0_1_CORE;
@@ -204,17 +204,17 @@ namespace xaiefal {
 			XAie_UserRscReq Req = {Loc, Mod, 2};
 
 			if (_XAie_GetTileTypefromLoc(dev(), Loc) != XAIEGBL_TILE_TYPE_AIETILE) {
-				Logger::log(LogLevel::ERROR) << "PC range " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "PC range " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ")" <<
-					" not core tile." << std::endl;
+					" not core tile." << '\n';
 				RC = XAIE_ERR;
 			} else {
 					RC = XAie_RequestPCRangeEvents(AieHd->dev(), 1, &Req, 2, Rscs);
 				}
 				if (RC != XAIE_OK) {
-					Logger::log(LogLevel::ERROR) << "PC range " << __func__ << " (" <<
+					XAIEFAL_LOG(ERROR) << "PC range " << __func__ << " (" <<
 						static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ")" <<
-						" resource not availalble." << std::endl;
+						" resource not availalble." << '\n';
 				} else {
 					Rscs[0].RscId -= static_cast<uint32_t>(XAIE_EVENT_PC_0_CORE);
 					Rscs[1].RscId -= static_cast<uint32_t>(XAIE_EVENT_PC_0_CORE);
@@ -242,9 +242,9 @@ namespace xaiefal {
 				RC = XAie_EventPCEnable(dev(), Loc, Rscs[1].RscId, PcAddrs[1]);
 			}
 			if (RC != XAIE_OK) {
-				Logger::log(LogLevel::ERROR) << "PC range " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "PC range " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ")" <<
-					" failed to start." << std::endl;
+					" failed to start." << '\n';
 			}
 			return RC;
 		}
@@ -256,9 +256,9 @@ namespace xaiefal {
 			iRC |= (int)XAie_EventPCDisable(dev(), Loc, Rscs[1].RscId);
 
 			if (iRC != (int)XAIE_OK) {
-				Logger::log(LogLevel::ERROR) << "PC range " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "PC range " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ")" <<
-					" failed to stop." << std::endl;
+					" failed to stop." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				RC = XAIE_OK;
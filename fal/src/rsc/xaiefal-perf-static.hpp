@@ -0,0 +1,516 @@
+// Copyright(C) 2020 - 2021 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+/**
+ * @param file xaiefal-perf-static.hpp
+ * Perfcounter resource specialized at compile time for a device generation,
+ * tile type and module.
+ */
+
+#include <memory>
+#include <stdexcept>
+#include <xaiengine.h>
+#include <xaiengine/xaiegbl_params.h>
+#include <xaiengine/xaiemlgbl_params.h>
+
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @struct XAiePerfRegs
+	 * @brief Perfcounter register layout of a module.
+	 * It mirrors the XAie_PerfMod data of the driver as compile time
+	 * constants, all the offsets are relative to the tile address.
+	 */
+	template <uint8_t NumCntrs, uint32_t CntrBase, uint32_t CtrlBase,
+		uint32_t CtrlStride, uint32_t RstCtrlBase, uint32_t EvtValBase,
+		uint32_t StartLsb, uint32_t StartMask, uint32_t StopLsb,
+		uint32_t StopMask, uint32_t RstLsb, uint32_t RstMask,
+		XAie_Events CntrEventBase>
+	struct XAiePerfRegs {
+		static constexpr uint8_t numCntrs() {
+			return NumCntrs;
+		}
+		static constexpr uint32_t cntrOff(uint8_t Id) {
+			return CntrBase + Id * 0x4U;
+		}
+		static constexpr uint32_t evtValOff(uint8_t Id) {
+			return EvtValBase + Id * 0x4U;
+		}
+		static constexpr uint32_t ctrlOff(uint8_t Id) {
+			return CtrlBase + Id / 2U * CtrlStride;
+		}
+		static constexpr uint32_t ctrlMask(uint8_t Id) {
+			return (StartMask | StopMask) << (16U * (Id % 2U));
+		}
+		static constexpr uint32_t ctrlVal(uint8_t Id, uint8_t StartE,
+				uint8_t StopE) {
+			return (((uint32_t)StartE << StartLsb) & StartMask) <<
+				(16U * (Id % 2U)) |
+				(((uint32_t)StopE << StopLsb) & StopMask) <<
+				(16U * (Id % 2U));
+		}
+		static constexpr uint32_t rstCtrlOff() {
+			return RstCtrlBase;
+		}
+		static constexpr uint32_t rstCtrlMask(uint8_t Id) {
+			return RstMask << (8U * Id);
+		}
+		static constexpr uint32_t rstCtrlVal(uint8_t Id, uint8_t RstE) {
+			return (((uint32_t)RstE << RstLsb) & RstMask) << (8U * Id);
+		}
+		static constexpr XAie_Events cntrEvent(uint8_t Id) {
+			return static_cast<XAie_Events>(
+				static_cast<uint32_t>(CntrEventBase) + Id);
+		}
+	};
+
+	/**
+	 * @struct XAiePerfTraits
+	 * @brief Perfcounter registers of a device generation, tile type and
+	 * module. Only the supported combinations are specialized, others
+	 * fail to compile.
+	 */
+	template <uint8_t Gen, uint8_t TType, XAie_ModuleType M>
+	struct XAiePerfTraits;
+
+	template <>
+	struct XAiePerfTraits<XAIE_DEV_GEN_AIE, XAIEGBL_TILE_TYPE_AIETILE,
+		XAIE_CORE_MOD>: XAiePerfRegs<4U, XAIEGBL_CORE_PERCOU0,
+		XAIEGBL_CORE_PERCTR0, 0x4U, XAIEGBL_CORE_PERCTR2,
+		XAIEGBL_CORE_PERCOU0EVTVAL,
+		XAIEGBL_CORE_PERCTR0_CNT0STAEVT_LSB,
+		XAIEGBL_CORE_PERCTR0_CNT0STAEVT_MASK,
+		XAIEGBL_CORE_PERCTR0_CNT0STOPEVT_LSB,
+		XAIEGBL_CORE_PERCTR0_CNT0STOPEVT_MASK,
+		XAIEGBL_CORE_PERCTR2_CNT0RSTEVT_LSB,
+		XAIEGBL_CORE_PERCTR2_CNT0RSTEVT_MASK,
+		XAIE_EVENT_PERF_CNT_0_CORE> {
+		static constexpr const char *name() {
+			return "aie core perfcount";
+		}
+	};
+
+	template <>
+	struct XAiePerfTraits<XAIE_DEV_GEN_AIE, XAIEGBL_TILE_TYPE_AIETILE,
+		XAIE_MEM_MOD>: XAiePerfRegs<2U, XAIEGBL_MEM_PERCOU0,
+		XAIEGBL_MEM_PERCTRL0, 0x0U, XAIEGBL_MEM_PERCTRL1,
+		XAIEGBL_MEM_PERCOU0EVTVAL,
+		XAIEGBL_MEM_PERCTRL0_CNT0STAEVT_LSB,
+		XAIEGBL_MEM_PERCTRL0_CNT0STAEVT_MASK,
+		XAIEGBL_MEM_PERCTRL0_CNT0STOPEVT_LSB,
+		XAIEGBL_MEM_PERCTRL0_CNT0STOPEVT_MASK,
+		XAIEGBL_MEM_PERCTRL1_CNT0RSTEVT_LSB,
+		XAIEGBL_MEM_PERCTRL1_CNT0RSTEVT_MASK,
+		XAIE_EVENT_PERF_CNT_0_MEM> {
+		static constexpr const char *name() {
+			return "aie mem perfcount";
+		}
+	};
+
+	struct XAieAiePlPerfTraits: XAiePerfRegs<2U, XAIEGBL_PL_PERCOU0,
+		XAIEGBL_PL_PERCTR0, 0x0U, XAIEGBL_PL_PERCTR1,
+		XAIEGBL_PL_PERCOU0EVTVAL,
+		XAIEGBL_PL_PERCTR0_CNT0STAEVT_LSB,
+		XAIEGBL_PL_PERCTR0_CNT0STAEVT_MASK,
+		XAIEGBL_PL_PERCTR0_CNT0STOPEVT_LSB,
+		XAIEGBL_PL_PERCTR0_CNT0STOPEVT_MASK,
+		XAIEGBL_PL_PERCTR1_CNT0RSTEVT_LSB,
+		XAIEGBL_PL_PERCTR1_CNT0RSTEVT_MASK,
+		XAIE_EVENT_PERF_CNT_0_PL> {
+		static constexpr const char *name() {
+			return "aie shim perfcount";
+		}
+	};
+
+	template <>
+	struct XAiePerfTraits<XAIE_DEV_GEN_AIE, XAIEGBL_TILE_TYPE_SHIMNOC,
+		XAIE_PL_MOD>: XAieAiePlPerfTraits {};
+
+	template <>
+	struct XAiePerfTraits<XAIE_DEV_GEN_AIE, XAIEGBL_TILE_TYPE_SHIMPL,
+		XAIE_PL_MOD>: XAieAiePlPerfTraits {};
+
+	template <>
+	struct XAiePerfTraits<XAIE_DEV_GEN_AIEML, XAIEGBL_TILE_TYPE_AIETILE,
+		XAIE_CORE_MOD>: XAiePerfRegs<4U,
+		XAIEMLGBL_CORE_MODULE_PERFORMANCE_COUNTER0,
+		XAIEMLGBL_CORE_MODULE_PERFORMANCE_CONTROL0, 0x4U,
+		XAIEMLGBL_CORE_MODULE_PERFORMANCE_CONTROL2,
+		XAIEMLGBL_CORE_MODULE_PERFORMANCE_COUNTER0_EVENT_VALUE,
+		XAIEMLGBL_CORE_MODULE_PERFORMANCE_CONTROL0_CNT0_START_EVENT_LSB,
+		XAIEMLGBL_CORE_MODULE_PERFORMANCE_CONTROL0_CNT0_START_EVENT_MASK,
+		XAIEMLGBL_CORE_MODULE_PERFORMANCE_CONTROL0_CNT0_STOP_EVENT_LSB,
+		XAIEMLGBL_CORE_MODULE_PERFORMANCE_CONTROL0_CNT0_STOP_EVENT_MASK,
+		XAIEMLGBL_CORE_MODULE_PERFORMANCE_CONTROL2_CNT0_RESET_EVENT_LSB,
+		XAIEMLGBL_CORE_MODULE_PERFORMANCE_CONTROL2_CNT0_RESET_EVENT_MASK,
+		XAIE_EVENT_PERF_CNT_0_CORE> {
+		static constexpr const char *name() {
+			return "aieml core perfcount";
+		}
+	};
+
+	template <>
+	struct XAiePerfTraits<XAIE_DEV_GEN_AIEML, XAIEGBL_TILE_TYPE_AIETILE,
+		XAIE_MEM_MOD>: XAiePerfRegs<2U,
+		XAIEMLGBL_MEMORY_MODULE_PERFORMANCE_COUNTER0,
+		XAIEMLGBL_MEMORY_MODULE_PERFORMANCE_CONTROL0, 0x4U,
+		XAIEMLGBL_MEMORY_MODULE_PERFORMANCE_CONTROL1,
+		XAIEMLGBL_MEMORY_MODULE_PERFORMANCE_COUNTER0_EVENT_VALUE,
+		XAIEMLGBL_MEMORY_MODULE_PERFORMANCE_CONTROL0_CNT0_START_EVENT_LSB,
+		XAIEMLGBL_MEMORY_MODULE_PERFORMANCE_CONTROL0_CNT0_START_EVENT_MASK,
+		XAIEMLGBL_MEMORY_MODULE_PERFORMANCE_CONTROL0_CNT0_STOP_EVENT_LSB,
+		XAIEMLGBL_MEMORY_MODULE_PERFORMANCE_CONTROL0_CNT0_STOP_EVENT_MASK,
+		XAIEMLGBL_MEMORY_MODULE_PERFORMANCE_CONTROL1_CNT0_RESET_EVENT_LSB,
+		XAIEMLGBL_MEMORY_MODULE_PERFORMANCE_CONTROL1_CNT0_RESET_EVENT_MASK,
+		XAIE_EVENT_PERF_CNT_0_MEM> {
+		static constexpr const char *name() {
+			return "aieml mem perfcount";
+		}
+	};
+
+	template <>
+	struct XAiePerfTraits<XAIE_DEV_GEN_AIEML, XAIEGBL_TILE_TYPE_MEMTILE,
+		XAIE_MEM_MOD>: XAiePerfRegs<4U,
+		XAIEMLGBL_MEM_TILE_MODULE_PERFORMANCE_COUNTER0,
+		XAIEMLGBL_MEM_TILE_MODULE_PERFORMANCE_CONTROL0, 0x4U,
+		XAIEMLGBL_MEM_TILE_MODULE_PERFORMANCE_CONTROL2,
+		XAIEMLGBL_MEM_TILE_MODULE_PERFORMANCE_COUNTER0_EVENT_VALUE,
+		XAIEMLGBL_MEM_TILE_MODULE_PERFORMANCE_CONTROL0_CNT0_START_EVENT_LSB,
+		XAIEMLGBL_MEM_TILE_MODULE_PERFORMANCE_CONTROL0_CNT0_START_EVENT_MASK,
+		XAIEMLGBL_MEM_TILE_MODULE_PERFORMANCE_CONTROL0_CNT0_STOP_EVENT_LSB,
+		XAIEMLGBL_MEM_TILE_MODULE_PERFORMANCE_CONTROL0_CNT0_STOP_EVENT_MASK,
+		XAIEMLGBL_MEM_TILE_MODULE_PERFORMANCE_CONTROL2_CNT0_RESET_EVENT_LSB,
+		XAIEMLGBL_MEM_TILE_MODULE_PERFORMANCE_CONTROL2_CNT0_RESET_EVENT_MASK,
+		XAIE_EVENT_PERF_CNT0_EVENT_MEM_TILE> {
+		static constexpr const char *name() {
+			return "aieml memtile perfcount";
+		}
+	};
+
+	struct XAieAieMlPlPerfTraits: XAiePerfRegs<2U,
+		XAIEMLGBL_PL_MODULE_PERFORMANCE_COUNTER0,
+		XAIEMLGBL_PL_MODULE_PERFORMANCE_CTRL0, 0x0U,
+		XAIEMLGBL_PL_MODULE_PERFORMANCE_CTRL1,
+		XAIEMLGBL_PL_MODULE_PERFORMANCE_COUNTER0_EVENT_VALUE,
+		XAIEMLGBL_PL_MODULE_PERFORMANCE_CTRL0_CNT0_START_EVENT_LSB,
+		XAIEMLGBL_PL_MODULE_PERFORMANCE_CTRL0_CNT0_START_EVENT_MASK,
+		XAIEMLGBL_PL_MODULE_PERFORMANCE_CTRL0_CNT0_STOP_EVENT_LSB,
+		XAIEMLGBL_PL_MODULE_PERFORMANCE_CTRL0_CNT0_STOP_EVENT_MASK,
+		XAIEMLGBL_PL_MODULE_PERFORMANCE_CTRL1_CNT0_RESET_EVENT_LSB,
+		XAIEMLGBL_PL_MODULE_PERFORMANCE_CTRL1_CNT0_RESET_EVENT_MASK,
+		XAIE_EVENT_PERF_CNT_0_PL> {
+		static constexpr const char *name() {
+			return "aieml shim perfcount";
+		}
+	};
+
+	template <>
+	struct XAiePerfTraits<XAIE_DEV_GEN_AIEML, XAIEGBL_TILE_TYPE_SHIMNOC,
+		XAIE_PL_MOD>: XAieAieMlPlPerfTraits {};
+
+	template <>
+	struct XAiePerfTraits<XAIE_DEV_GEN_AIEML, XAIEGBL_TILE_TYPE_SHIMPL,
+		XAIE_PL_MOD>: XAieAieMlPlPerfTraits {};
+
+	/**
+	 * @class XAieStaticPerfCounter
+	 * @brief Perfcounter resource of a module specialized at compile time.
+	 * Unlike XAiePerfCounter, it has no virtual functions and no
+	 * run time type information. The register offsets, the field layout
+	 * and the counter event come from XAiePerfTraits, the tile address and
+	 * the hardware start, stop and reset events are resolved once, so
+	 * start(), stop() and readResult() access the registers directly
+	 * instead of looking up the driver module tables on each call.
+	 * The counter is reserved from the driver resource manager, so it
+	 * coexists with the dynamic resource classes. The start, stop and
+	 * reset events have to be from the same module as the counter, use
+	 * XAiePerfCounter for cross module counting.
+	 */
+	template <uint8_t Gen, uint8_t TType, XAie_ModuleType M>
+	class XAieStaticPerfCounter final {
+	public:
+		typedef XAiePerfTraits<Gen, TType, M> Traits;
+
+		XAieStaticPerfCounter() = delete;
+		XAieStaticPerfCounter(const XAieStaticPerfCounter &) = delete;
+		XAieStaticPerfCounter &operator=(const XAieStaticPerfCounter &) = delete;
+		XAieStaticPerfCounter(const std::shared_ptr<XAieDevHandle> &DevHd,
+			XAie_LocType L):
+			AieHd(DevHd), Loc(L), Reserved(false), Running(false),
+			StartHwE(0), StopHwE(0), RstHwE(0), HasRst(false),
+			EventVal(0) {
+			XAie_DevInst *Dev;
+
+			if (!AieHd) {
+				throw std::invalid_argument("AI engine device is NULL");
+			}
+			Dev = AieHd->dev();
+			if (Dev->DevProp.DevGen != Gen ||
+				_XAie_GetTileTypefromLoc(Dev, Loc) != TType) {
+				throw std::invalid_argument(std::string(Traits::name()) +
+					": device generation or tile mismatched");
+			}
+			TileAddr = ((uint64_t)Loc.Row << Dev->DevProp.RowShift) |
+				((uint64_t)Loc.Col << Dev->DevProp.ColShift);
+			Rsc.RscType = XAIE_PERFCNT_RSC;
+			Rsc.Loc = Loc;
+			Rsc.Mod = static_cast<uint32_t>(M);
+			Rsc.RscId = XAIE_RSC_ID_ANY;
+		}
+		XAieStaticPerfCounter(XAieDev &Dev, XAie_LocType L):
+			XAieStaticPerfCounter(Dev.getDevHandle(), L) {}
+		~XAieStaticPerfCounter() {
+			if (Running) {
+				stop();
+			}
+			if (Reserved) {
+				release();
+			}
+		}
+		/**
+		 * This function returns the number of counters of the module.
+		 *
+		 * @return number of counters
+		 */
+		static constexpr uint8_t numCounters() {
+			return Traits::numCntrs();
+		}
+		/**
+		 * This function sets the perfcounter start, stop, reset events
+		 * and the threshold to generate the counter event. The events
+		 * are converted to hardware events here, once.
+		 *
+		 * @param StartE start event
+		 * @param StopE stop event
+		 * @param RstE reset event, default is XAIE_EVENT_NONE_CORE,
+		 *	       that is no reset event.
+		 * @param Threshold counter value to generate counter event
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC initialize(XAie_Events StartE, XAie_Events StopE,
+				XAie_Events RstE = XAIE_EVENT_NONE_CORE,
+				uint32_t Threshold = 0) {
+			AieRC RC;
+
+			if (Running) {
+				XAIEFAL_LOG(ERROR) << Traits::name() << " " <<
+					__func__ << " (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ") resource is in use.\n";
+				return XAIE_ERR;
+			}
+			RC = XAie_EventLogicalToPhysicalConv(dev(), Loc, M,
+				StartE, &StartHwE);
+			if (RC == XAIE_OK) {
+				RC = XAie_EventLogicalToPhysicalConv(dev(), Loc, M,
+					StopE, &StopHwE);
+			}
+			if (RC == XAIE_OK && RstE != XAIE_EVENT_NONE_CORE) {
+				RC = XAie_EventLogicalToPhysicalConv(dev(), Loc, M,
+					RstE, &RstHwE);
+			}
+			if (RC != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << Traits::name() << " " <<
+					__func__ << " (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ")" <<
+					" StartEvent=" << StartE <<
+					" StopEvent=" << StopE <<
+					" RstEvent=" << RstE << '\n';
+				return RC;
+			}
+			HasRst = (RstE != XAIE_EVENT_NONE_CORE);
+			EventVal = Threshold;
+			return XAIE_OK;
+		}
+		/**
+		 * This function reserves a counter from the resource manager.
+		 *
+		 * @param Id preferred counter ID, XAIE_RSC_ID_ANY for any
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC reserve(uint32_t Id = XAIE_RSC_ID_ANY) {
+			AieRC RC;
+
+			if (Reserved) {
+				return XAIE_OK;
+			}
+			if (Id == XAIE_RSC_ID_ANY) {
+				XAie_UserRscReq Req = {Loc, M, 1};
+
+				RC = XAie_RequestPerfcnt(dev(), 1, &Req, 1, &Rsc);
+			} else {
+				Rsc.RscId = Id;
+				RC = XAie_RequestAllocatedPerfcnt(dev(), 1, &Rsc);
+			}
+			if (RC != XAIE_OK) {
+				XAIEFAL_LOG(WARN) << Traits::name() << " " <<
+					__func__ << " (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ") resource not available.\n";
+				Rsc.RscId = XAIE_RSC_ID_ANY;
+				return RC;
+			}
+			Reserved = true;
+			return XAIE_OK;
+		}
+		/**
+		 * This function releases the counter to the resource manager.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC release() {
+			AieRC RC;
+
+			if (Running) {
+				XAIEFAL_LOG(ERROR) << Traits::name() << " " <<
+					__func__ << " (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ") resource is in use.\n";
+				return XAIE_ERR;
+			}
+			if (!Reserved) {
+				return XAIE_OK;
+			}
+			RC = XAie_ReleasePerfcnt(dev(), 1, &Rsc);
+			Rsc.RscId = XAIE_RSC_ID_ANY;
+			Reserved = false;
+			return RC;
+		}
+		/**
+		 * This function configures the counter in hardware.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC start() {
+			AieRC RC;
+			uint8_t Id = static_cast<uint8_t>(Rsc.RscId);
+
+			if (!Reserved) {
+				XAIEFAL_LOG(ERROR) << Traits::name() << " " <<
+					__func__ << " (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ") resource not reserved.\n";
+				return XAIE_ERR;
+			}
+			if (Running) {
+				return XAIE_OK;
+			}
+			RC = XAie_Write32(dev(), TileAddr + Traits::evtValOff(Id),
+				EventVal);
+			if (RC == XAIE_OK) {
+				RC = XAie_MaskWrite32(dev(),
+					TileAddr + Traits::ctrlOff(Id),
+					Traits::ctrlMask(Id),
+					Traits::ctrlVal(Id, StartHwE, StopHwE));
+			}
+			if (RC == XAIE_OK && HasRst) {
+				RC = XAie_MaskWrite32(dev(),
+					TileAddr + Traits::rstCtrlOff(),
+					Traits::rstCtrlMask(Id),
+					Traits::rstCtrlVal(Id, RstHwE));
+			}
+			if (RC != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << Traits::name() << " " <<
+					__func__ << " (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ") failed to start.\n";
+				return RC;
+			}
+			Running = true;
+			return XAIE_OK;
+		}
+		/**
+		 * This function resets the counter configuration in hardware.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC stop() {
+			int iRC;
+			uint8_t Id = static_cast<uint8_t>(Rsc.RscId);
+
+			if (!Running) {
+				return XAIE_OK;
+			}
+			iRC = (int)XAie_MaskWrite32(dev(),
+				TileAddr + Traits::ctrlOff(Id),
+				Traits::ctrlMask(Id), 0);
+			iRC |= (int)XAie_MaskWrite32(dev(),
+				TileAddr + Traits::rstCtrlOff(),
+				Traits::rstCtrlMask(Id), 0);
+			iRC |= (int)XAie_Write32(dev(),
+				TileAddr + Traits::cntrOff(Id), 0);
+			iRC |= (int)XAie_Write32(dev(),
+				TileAddr + Traits::evtValOff(Id), 0);
+			Running = false;
+			if (iRC != (int)XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << Traits::name() << " " <<
+					__func__ << " (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ") failed to stop.\n";
+				return XAIE_ERR;
+			}
+			return XAIE_OK;
+		}
+		/**
+		 * This function reads the perfcounter value if counter is
+		 * in use.
+		 *
+		 * @param R counter value if counter is in use.
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC readResult(uint32_t &R) {
+			if (!Running) {
+				XAIEFAL_LOG(ERROR) << Traits::name() << " " <<
+					__func__ << " (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ") resource not in use.\n";
+				return XAIE_ERR;
+			}
+			return XAie_Read32(dev(), TileAddr +
+				Traits::cntrOff(static_cast<uint8_t>(Rsc.RscId)), &R);
+		}
+		/**
+		 * This function returns the counter event.
+		 *
+		 * @param E counter event
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC getCounterEvent(XAie_Events &E) const {
+			if (!Reserved) {
+				XAIEFAL_LOG(ERROR) << Traits::name() << " " <<
+					__func__ << " (" << (uint32_t)Loc.Col << "," <<
+					(uint32_t)Loc.Row << ") resource not allocated.\n";
+				return XAIE_ERR;
+			}
+			E = Traits::cntrEvent(static_cast<uint8_t>(Rsc.RscId));
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the reserved driver resource.
+		 *
+		 * @return driver resource, RscId is XAIE_RSC_ID_ANY if not
+		 *	   reserved.
+		 */
+		const XAie_UserRsc &getRsc() const {
+			return Rsc;
+		}
+		bool isReserved() const {
+			return Reserved;
+		}
+		bool isRunning() const {
+			return Running;
+		}
+	private:
+		XAie_DevInst *dev() {
+			return AieHd->dev();
+		}
+
+		std::shared_ptr<XAieDevHandle> AieHd; /**< AI engine device handle */
+		XAie_LocType Loc; /**< tile location */
+		uint64_t TileAddr; /**< tile address */
+		XAie_UserRsc Rsc; /**< reserved counter */
+		bool Reserved; /**< true if the counter is reserved */
+		bool Running; /**< true if the counter is configured */
+		uint8_t StartHwE; /**< hardware start event */
+		uint8_t StopHwE; /**< hardware stop event */
+		uint8_t RstHwE; /**< hardware reset event */
+		bool HasRst; /**< true if there is a reset event */
+		uint32_t EventVal; /**< counter event value */
+	};
+}
@@ -1,19 +1,33 @@
 // Copyright(C) 2020 - 2021 by Xilinx, Inc. All rights reserved.
 // SPDX-License-Identifier: MIT
 
+#include <atomic>
 #include <fstream>
 #include <functional>
 #include <map>
+#include <memory>
 #include <string.h>
 #include <vector>
 #include <xaiengine.h>
 
+#include <xaiefal/common/xaiefal-await.hpp>
 #include <xaiefal/rsc/xaiefal-bc.hpp>
 #include <xaiefal/rsc/xaiefal-rsc-base.hpp>
 
 #pragma once
 
 namespace xaiefal {
+	/**
+	 * @struct XAiePerfEventSample
+	 * @brief Sample taken when a perf counter reaches its threshold.
+	 */
+	struct XAiePerfEventSample {
+		uint64_t Index; /**< number of the sample since sampling started */
+		uint64_t Timer; /**< timer of the counter module */
+		uint32_t PC; /**< program counter, 0 if not an AIE tile */
+		std::vector<uint32_t> Values; /**< values of the other counters */
+	};
+
 	/**
 	 * @class XAiePerfCounter
 	 * @brief class for Perfcounter resource.
@@ -29,7 +43,7 @@ namespace xaiefal {
 	class XAiePerfCounter : public XAieSingleTileRsc {
 	public:
 		XAiePerfCounter() = delete;
-		XAiePerfCounter(std::shared_ptr<XAieDevHandle> DevHd,
+		XAiePerfCounter(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L, XAie_ModuleType M,
 			bool CrossM = false, uint32_t Threshold = 0):
 			XAieSingleTileRsc(DevHd, L, M), CrossMod(CrossM) {
@@ -39,12 +53,21 @@ namespace xaiefal {
 			RstEvent = XAIE_EVENT_NONE_CORE;
 			State.Initialized = 1;
 			EventVal = Threshold;
+			Cntr64 = nullptr;
 		}
+		/**
+		 * Handler of the samples of the event based sampling mode.
+		 */
+		typedef std::function<void(const XAiePerfEventSample &)> SampleHandler;
 		XAiePerfCounter(XAieDev &Dev,
 			XAie_LocType L, XAie_ModuleType M,
 			bool CrossM = false):
 			XAiePerfCounter(Dev.getDevHandle(), L, M, CrossM) {}
 		~XAiePerfCounter() {
+			if (Sampling) {
+				Sampling->Active = false;
+			}
+			XAie_PerfCounter64Free(Cntr64);
 			if (State.Reserved == 1) {
 				if (StartMod != static_cast<XAie_ModuleType>(Rsc.Mod)) {
 					delete StartBC;
@@ -76,9 +99,9 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Reserved == 1) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
-					" Expect Mod= " << Mod << " resource reserved." << std::endl;
+					" Expect Mod= " << Mod << " resource reserved." << '\n';
 				return XAIE_ERR;
 			} else {
 				uint8_t HwEvent;
@@ -105,13 +128,13 @@ namespace xaiefal {
 					State.Initialized = 1;
 					State.Configured = 1;
 				} else {
-					Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+					XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 						(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 						" Expect Mod= " << Mod <<
 						" StartEvent=" <<StartM << "," << StartE << " " <<
 						" StopEvent=" <<StopM << "," << StopE << " " <<
 						" RstEvent=" <<RstM << "," << RstE << " " <<
-						std::endl;
+						'\n';
 				}
 			}
 			return RC;
@@ -139,17 +162,17 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod << " Actual Mod=" << Rsc.Mod <<
-					" resource is in use" << std::endl;
+					" resource is in use" << '\n';
 				RC = XAIE_ERR;
 			} else if (State.Reserved == 1 && M != RstMod) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod << " Actual Mod=" << Rsc.Mod <<
 					" resource is reserved, event module type cannot change." <<
-					std::endl;
+					'\n';
 				RC = XAIE_INVALID_ARGS;
 			} else {
 				uint8_t HwEvent;
@@ -175,10 +198,10 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod << " Actual Mod=" << Rsc.Mod <<
-					" resource is in use." << std::endl;
+					" resource is in use." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				EventVal = Val;
@@ -200,17 +223,17 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod << " Actual Mod=" << Rsc.Mod <<
-					" resource is in use." << std::endl;
+					" resource is in use." << '\n';
 				RC = XAIE_ERR;
 			} else if (State.Reserved == 1 && M != StartMod) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod << " Actual Mod=" << Rsc.Mod <<
 					" resource is reserved, event module type cannot change." <<
-					std::endl;
+					'\n';
 				RC = XAIE_INVALID_ARGS;
 			} else {
 				uint8_t HwEvent;
@@ -237,17 +260,17 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod << " Actual Mod=" << Rsc.Mod <<
-					" resource is in use." << std::endl;
+					" resource is in use." << '\n';
 				RC = XAIE_ERR;
 			} else if (State.Reserved == 1 && M != StopMod) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod << " Actual Counter Mod=" << Rsc.Mod <<
 					" resource is reserved, event module type cannot change." <<
-					std::endl;
+					'\n';
 				RC = XAIE_INVALID_ARGS;
 			} else {
 				uint8_t HwEvent;
@@ -272,10 +295,10 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Running == 0) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod <<
-					" resource not in use." << std::endl;
+					" resource not in use." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				RC = XAie_PerfCounterGet(dev(), Loc, static_cast<XAie_ModuleType>(Rsc.Mod),
@@ -283,6 +306,136 @@ namespace xaiefal {
 			}
 			return RC;
 		}
+		/**
+		 * This function reads the 64-bit virtual value of the counter.
+		 * The 32-bit hardware counter is extended by accumulating its
+		 * increments on the host, so it has to be read at least once
+		 * per wrap period, or accumulated in the background with
+		 * accumulate(). Only available if the counter has no reset
+		 * event.
+		 *
+		 * @param R 64-bit counter value if counter is in use.
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC readResult64(uint64_t &R) {
+			if (State.Running == 0 || Cntr64 == nullptr) {
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
+					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
+					" Expect Mod= " << Mod <<
+					" resource not in use or not free running." << '\n';
+				return XAIE_ERR;
+			}
+			return XAie_PerfCounter64Get(Cntr64, 0, &R);
+		}
+		/**
+		 * This function starts a host thread accumulating the 64-bit
+		 * virtual value of the counter periodically.
+		 *
+		 * @param PeriodUs accumulation period in microseconds, shorter
+		 *	  than the wrap period of the hardware counter.
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC accumulate(uint32_t PeriodUs) {
+			if (State.Running == 0 || Cntr64 == nullptr) {
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
+					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
+					" Expect Mod= " << Mod <<
+					" resource not in use or not free running." << '\n';
+				return XAIE_ERR;
+			}
+			return XAie_PerfCounter64Start(Cntr64, PeriodUs);
+		}
+		/**
+		 * This function starts the event based sampling mode. The
+		 * counter event, generated when the counter reaches its
+		 * threshold, is waited for on a reactor, which routes it to
+		 * the interrupt of the partition. On each interrupt the
+		 * program counter of the core, the timer of the counter
+		 * module and the other counters are read, and the counter
+		 * is reset and waited for again, so the overhead follows the
+		 * sample rate set by the threshold instead of a poll period.
+		 * The counter has to be running with a non zero threshold;
+		 * its 64-bit value is no longer available once sampling is
+		 * started, as it is reset at each sample.
+		 *
+		 * @param Reactor started reactor, it has to run until the
+		 *	  sampling is stopped and the last wait completed
+		 * @param H handler of the samples, called on the reactor
+		 *	  thread or its dispatcher
+		 * @param Others running counters read at each sample, e.g.
+		 *	  of the same tile
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC startSampling(XAieReactor &Reactor, SampleHandler H,
+				const std::vector<std::shared_ptr<XAiePerfCounter>> &Others = {}) {
+			std::shared_ptr<SampleState> S;
+			AieRC RC;
+
+			if (State.Running == 0 || EventVal == 0 || !H) {
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
+					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
+					" Expect Mod= " << Mod <<
+					" resource not in use, no threshold or no handler." << '\n';
+				return XAIE_ERR;
+			}
+			if (Sampling && Sampling->Active) {
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
+					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
+					" Expect Mod= " << Mod << " already sampling." << '\n';
+				return XAIE_ERR;
+			}
+
+			S = std::make_shared<SampleState>();
+			S->AieHd = AieHd;
+			S->Reactor = &Reactor;
+			S->Loc = Loc;
+			S->Mod = static_cast<XAie_ModuleType>(Rsc.Mod);
+			S->RscId = Rsc.RscId;
+			S->Handler = H;
+			S->Others = Others;
+			S->Active = true;
+			S->Count = 0;
+			getCounterEvent(S->Mod, S->Event);
+
+			XAie_PerfCounter64Free(Cntr64);
+			Cntr64 = nullptr;
+			RC = _rearm(S);
+			if (RC != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
+					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
+					" Expect Mod= " << Mod << " Actual Mod=" << Rsc.Mod <<
+					" failed to start sampling." << '\n';
+				return RC;
+			}
+			Sampling = S;
+			return XAIE_OK;
+		}
+		/**
+		 * This function stops the event based sampling mode. The wait
+		 * in flight completes without a sample when the counter event
+		 * occurs or the reactor stops. Stopping the counter stops the
+		 * sampling too.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC stopSampling() {
+			if (Sampling) {
+				Sampling->Active = false;
+			}
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the number of samples taken since
+		 * the sampling was last started.
+		 *
+		 * @return number of samples
+		 */
+		uint64_t getSampleCount() const {
+			if (!Sampling) {
+				return 0;
+			}
+			return Sampling->Count.load(std::memory_order_relaxed);
+		}
 		/**
 		 * This function returns the counter event and the event module.
 		 *
@@ -294,10 +447,10 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Reserved == 0) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod <<
-					" resource not allocated." << std::endl;
+					" resource not allocated." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				M = static_cast<XAie_ModuleType>(Rsc.Mod);
@@ -341,14 +494,88 @@ namespace xaiefal {
 		XAieBroadcast *StartBC; /**< start Event braodcast resource */
 		XAieBroadcast *StopBC; /**< stop Event braodcast resource */
 		XAieBroadcast *RstBC; /**< reset Event braodcast resource */
+		XAie_PerfCounter64 *Cntr64; /**< 64-bit virtual counter */
 	private:
+		/* state of the event based sampling, shared with the waits */
+		struct SampleState {
+			std::shared_ptr<XAieDevHandle> AieHd;
+			XAieReactor *Reactor;
+			XAie_LocType Loc;
+			XAie_ModuleType Mod;
+			uint32_t RscId;
+			XAie_Events Event;
+			SampleHandler Handler;
+			std::vector<std::shared_ptr<XAiePerfCounter>> Others;
+			std::atomic<bool> Active;
+			std::atomic<uint64_t> Count;
+		};
+		std::shared_ptr<SampleState> Sampling; /**< event based sampling */
+
+		/* resets the counter and waits for its next counter event */
+		static AieRC _rearm(const std::shared_ptr<SampleState> &S) {
+			XAie_DevInst *Dev = S->AieHd->dev();
+			AieRC RC;
+
+			RC = XAie_PerfCounterReset(Dev, S->Loc, S->Mod, S->RscId);
+			if (RC == XAIE_OK) {
+				RC = XAie_EventClearStatus(Dev, S->Loc, S->Mod,
+					S->Event);
+			}
+			if (RC == XAIE_OK) {
+				RC = S->Reactor->waitEvent(S->Loc, S->Mod,
+					S->Event, 0, [S](AieRC R) {
+						_sample(S, R);
+					});
+			}
+			return RC;
+		}
+		/* takes a sample on the counter event and waits for the next */
+		static void _sample(const std::shared_ptr<SampleState> &S,
+				AieRC RC) {
+			XAie_DevInst *Dev = S->AieHd->dev();
+			XAiePerfEventSample Smp;
+
+			if (RC != XAIE_OK || !S->Active) {
+				S->Active = false;
+				return;
+			}
+
+			Smp.Index = S->Count.fetch_add(1,
+				std::memory_order_relaxed);
+			Smp.Timer = 0;
+			Smp.PC = 0;
+			if (_XAie_GetTileTypefromLoc(Dev, S->Loc) ==
+					XAIEGBL_TILE_TYPE_AIETILE) {
+				(void)XAie_CoreGetPCValue(Dev, S->Loc, &Smp.PC);
+			}
+			(void)XAie_ReadTimer(Dev, S->Loc, S->Mod, &Smp.Timer);
+			for (auto &C: S->Others) {
+				uint32_t V = 0;
+
+				(void)C->readResult(V);
+				Smp.Values.push_back(V);
+			}
+
+			if (_rearm(S) != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
+					(uint32_t)S->Loc.Col << "," << (uint32_t)S->Loc.Row << ")" <<
+					" failed to rearm sampling." << '\n';
+				S->Active = false;
+			}
+			S->Handler(Smp);
+		}
 		AieRC _reserve() {
 			AieRC RC;
 			uint32_t TType = _XAie_GetTileTypefromLoc(dev(), Loc);
 
 			XAie_UserRscReq Req = {Loc, Mod, 1};
 
-			if (preferredId == XAIE_RSC_ID_ANY) {
+			Rsc.RscType = XAIE_PERFCNT_RSC;
+			Rsc.Loc = Loc;
+			Rsc.Mod = static_cast<uint32_t>(Mod);
+			if (AieHd->takePooledRscs(&Rsc, 1, preferredId)) {
+				RC = XAIE_OK;
+			} else if (preferredId == XAIE_RSC_ID_ANY) {
 				RC = XAie_RequestPerfcnt(AieHd->dev(), 1, &Req, 1, &Rsc);
 			} else {
 				Rsc.RscType = XAIE_PERFCNT_RSC;
@@ -374,11 +601,8 @@ namespace xaiefal {
 			}
 			if (RC  == XAIE_OK &&
 				TType == XAIEGBL_TILE_TYPE_AIETILE) {
-				std::vector<XAie_LocType> vL;
-
-				vL.push_back(Loc);
 				if (StartMod != static_cast<XAie_ModuleType>(Rsc.Mod)) {
-					StartBC = new XAieBroadcast(AieHd, vL,
+					StartBC = new XAieBroadcast(AieHd, &Loc, &Loc + 1,
 						StartMod, static_cast<XAie_ModuleType>(Rsc.Mod));
 					RC = StartBC->reserve();
 					if (RC != XAIE_OK) {
@@ -386,7 +610,7 @@ namespace xaiefal {
 					}
 				}
 				if (RC == XAIE_OK && StopMod != static_cast<XAie_ModuleType>(Rsc.Mod)) {
-					StopBC = new XAieBroadcast(AieHd, vL,
+					StopBC = new XAieBroadcast(AieHd, &Loc, &Loc + 1,
 							StartMod, static_cast<XAie_ModuleType>(Rsc.Mod));
 					RC = StopBC->reserve();
 					if (RC != XAIE_OK) {
@@ -399,7 +623,7 @@ namespace xaiefal {
 				}
 				if (RC == XAIE_OK && RstEvent != XAIE_EVENT_NONE_CORE &&
 					RstMod != static_cast<XAie_ModuleType>(Rsc.Mod)) {
-					RstBC = new XAieBroadcast(AieHd, vL,
+					RstBC = new XAieBroadcast(AieHd, &Loc, &Loc + 1,
 							StartMod, static_cast<XAie_ModuleType>(Rsc.Mod));
 					RC = RstBC->reserve();
 					if (RC != XAIE_OK) {
@@ -420,7 +644,7 @@ namespace xaiefal {
 			}
 
 			if (RC != XAIE_OK) {
-				Logger::log(LogLevel::WARN) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(WARN) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod << " resource not available.\n";
 			} else {
@@ -442,6 +666,9 @@ namespace xaiefal {
 				delete RstBC;
 			}
 			_releaseAppend();
+			if (AieHd->poolRscs(&Rsc, 1)) {
+				return XAIE_OK;
+			}
 			return XAie_ReleasePerfcnt(AieHd->dev(), 1, &Rsc);
 		}
 		AieRC _start() {
@@ -487,13 +714,16 @@ namespace xaiefal {
 					RC = XAie_PerfCounterResetControlSet(dev(), Loc,
 						static_cast<XAie_ModuleType>(Rsc.Mod), Rsc.RscId, lRstE);
 				}
+				if (RC == XAIE_OK && RstEvent == XAIE_EVENT_NONE_CORE) {
+					Cntr64 = XAie_PerfCounter64Create(dev(), &Rsc, 1);
+				}
 			}
 
 			if (RC != XAIE_OK) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod << " Actual Mod=" << Rsc.Mod <<
-					" failed to start." << std::endl;
+					" failed to start." << '\n';
 			}
 			return RC;
 		}
@@ -501,6 +731,11 @@ namespace xaiefal {
 			AieRC RC;
 			int iRC;
 
+			if (Sampling) {
+				Sampling->Active = false;
+			}
+			XAie_PerfCounter64Free(Cntr64);
+			Cntr64 = nullptr;
 			iRC = (int)XAie_PerfCounterControlReset(dev(), Loc, static_cast<XAie_ModuleType>(Rsc.Mod), Rsc.RscId);
 			iRC |= (int)XAie_PerfCounterResetControlReset(dev(), Loc, static_cast<XAie_ModuleType>(Rsc.Mod), Rsc.RscId);
 			iRC |= (int)XAie_PerfCounterReset(dev(), Loc, static_cast<XAie_ModuleType>(Rsc.Mod), Rsc.RscId);
@@ -525,10 +760,10 @@ namespace xaiefal {
 				iRC |= RstBC->stop();
 			}
 			if (iRC != (int)XAIE_OK) {
-				Logger::log(LogLevel::ERROR) << "perfcount " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "perfcount " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod << " Actual Mod=" << Rsc.Mod <<
-					" failed to stop." << std::endl;
+					" failed to stop." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				RC = _stopAppend();
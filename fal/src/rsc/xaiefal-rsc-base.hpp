@@ -5,6 +5,7 @@
  * Base classes for AI engine resources management
  */
 
+#include <algorithm>
 #include <fstream>
 #include <functional>
 #include <map>
@@ -56,7 +57,7 @@ namespace xaiefal {
 	class XAieRsc {
 	public:
 		XAieRsc() = delete;
-		XAieRsc(std::shared_ptr<XAieDevHandle> DevHd):
+		XAieRsc(const std::shared_ptr<XAieDevHandle> &DevHd):
 			State(), AieHd(DevHd) {
 			if (!DevHd) {
 				throw std::invalid_argument("aie rsc: empty device handle");
@@ -100,9 +101,9 @@ namespace xaiefal {
 				if (isStaticAllocated) {
 					if (id == XAIE_RSC_ID_ANY) {
 						RC = XAIE_INVALID_ARGS;
-						Logger::log(LogLevel::ERROR) << __func__ << " " <<
+						XAIEFAL_LOG(ERROR) << __func__ << " " <<
 							typeid(*this).name() <<
-							" If Rsc ID is any, cannot be statically allocated" << std::endl;
+							" If Rsc ID is any, cannot be statically allocated" << '\n';
 					} else {
 						State.Prereserved = 1;
 					}
@@ -132,17 +133,18 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Reserved == 1) {
-				Logger::log(LogLevel::ERROR) << __func__ << " " <<
-					typeid(*this).name() << " resource has been allocated." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ << " " <<
+					typeid(*this).name() << " resource has been allocated." << '\n';
 				RC = XAIE_ERR;
 			} else if (State.Initialized == 0) {
-				Logger::log(LogLevel::ERROR) << __func__ << " " <<
-					typeid(*this).name() << " resource not configured." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ << " " <<
+					typeid(*this).name() << " resource not configured." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				RC = _reserve();
 				if (RC == XAIE_OK) {
 					State.Reserved = 1;
+					_notifyReserved();
 				}
 			}
 			return RC;
@@ -159,13 +161,14 @@ namespace xaiefal {
 			AieRC RC = XAIE_OK;
 
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << __func__ << " " <<
-					typeid(*this).name() << "resource is running." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ << " " <<
+					typeid(*this).name() << "resource is running." << '\n';
 				RC = XAIE_ERR;
 			} else if (State.Reserved == 1) {
 				RC = _release();
 				State.Reserved = 0;
 				State.Prereserved = 0;
+				_notifyReleased();
 			}
 			return RC;
 		}
@@ -184,17 +187,18 @@ namespace xaiefal {
 			AieRC RC = XAIE_OK;
 
 			if (State.Prereserved == 0) {
-				Logger::log(LogLevel::ERROR) << __func__ << " " <<
-					typeid(*this).name() << " resource is not preserved." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ << " " <<
+					typeid(*this).name() << " resource is not preserved." << '\n';
 				RC = XAIE_INVALID_ARGS;
 			} else {
 				if (State.Running == 1) {
-					Logger::log(LogLevel::ERROR) << __func__ << " " <<
-						typeid(*this).name() << " resource is running." << std::endl;
+					XAIEFAL_LOG(ERROR) << __func__ << " " <<
+						typeid(*this).name() << " resource is running." << '\n';
 					RC = XAIE_INVALID_ARGS;
 				} else if (State.Reserved == 1) {
 					RC = _free();
 					State.Reserved = 0;
+					_notifyReleased();
 				}
 			}
 			return RC;
@@ -218,13 +222,13 @@ namespace xaiefal {
 						State.Running = 1;
 					}
 				} else {
-					Logger::log(LogLevel::ERROR) << __func__ << " " <<
-						typeid(*this).name() << " resource is not configured." << std::endl;
+					XAIEFAL_LOG(ERROR) << __func__ << " " <<
+						typeid(*this).name() << " resource is not configured." << '\n';
 					RC = XAIE_ERR;
 				}
 			} else {
-				Logger::log(LogLevel::ERROR) << __func__ << " " <<
-					typeid(*this).name() << " resource is not allocated." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ << " " <<
+					typeid(*this).name() << " resource is not allocated." << '\n';
 				RC = XAIE_ERR;
 			}
 			return RC;
@@ -292,6 +296,24 @@ namespace xaiefal {
 				_getRscs(vRscs);
 			}
 		}
+		/**
+		 * This function writes resources reserved to an output
+		 * iterator, e.g. a plain array. The resources are collected
+		 * in a buffer kept by the object, which is reused by the
+		 * following calls.
+		 *
+		 * @param Out output iterator to store the reserved resources
+		 * @return output iterator past the last resource stored
+		 */
+		template<class OutIt>
+		OutIt getRscs(OutIt Out) const {
+			if (State.Reserved == 0) {
+				return Out;
+			}
+			RscsBuf.clear();
+			_getRscs(RscsBuf);
+			return std::copy(RscsBuf.begin(), RscsBuf.end(), Out);
+		}
 		/**
 		 * This function returns resources type.
 		 *
@@ -320,6 +342,27 @@ namespace xaiefal {
 			throw std::invalid_argument("get rsc stat not supported of rsc" +
 					rName);
 		}
+		/**
+		 * This function registers a resource group to be told when
+		 * this resource is reserved or released. If the resource is
+		 * already reserved, the group is told right away.
+		 *
+		 * @param G resource group
+		 */
+		void addGroup(const std::shared_ptr<XAieRscGroupBase> &G) {
+			for (auto &W: Groups) {
+				if (W.lock() == G) {
+					return;
+				}
+			}
+			Groups.push_back(G);
+			if (State.Reserved == 1) {
+				if (Counted.empty()) {
+					_getRscs(Counted);
+				}
+				G->rscReserved(Counted);
+			}
+		}
 		/**
 		 * This funtion returns AI engine device
 		 */
@@ -352,6 +395,37 @@ namespace xaiefal {
 		std::shared_ptr<XAieDevHandle> AieHd; /**< AI engine device instance */
 		uint32_t preferredId; /**< preferred resource Id*/
 	private:
+		/** groups to tell about reserve and release */
+		std::vector<std::weak_ptr<XAieRscGroupBase>> Groups;
+		/** hardware resources the groups have counted */
+		std::vector<XAie_UserRsc> Counted;
+		/** buffer of the resources returned to output iterators */
+		mutable std::vector<XAie_UserRsc> RscsBuf;
+
+		void _notifyReserved() {
+			if (Groups.empty()) {
+				return;
+			}
+			Counted.clear();
+			_getRscs(Counted);
+			for (auto &W: Groups) {
+				auto G = W.lock();
+
+				if (G != nullptr) {
+					G->rscReserved(Counted);
+				}
+			}
+		}
+		void _notifyReleased() {
+			for (auto &W: Groups) {
+				auto G = W.lock();
+
+				if (G != nullptr) {
+					G->rscReleased(Counted);
+				}
+			}
+			Counted.clear();
+		}
 		/**
 		 * This function will be called by reserve(). It allows child
 		 * class to implement its own resource reservation.
@@ -409,7 +483,7 @@ namespace xaiefal {
 	class XAieSingleTileRsc: public XAieRsc {
 	public:
 		XAieSingleTileRsc() = delete;
-		XAieSingleTileRsc(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieSingleTileRsc(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L, XAie_ModuleType M):
 			XAieRsc(DevHd), Loc(L), Mod(M) {
 			if (_XAie_CheckModule(AieHd->dev(), Loc, M) !=
@@ -420,7 +494,7 @@ namespace xaiefal {
 		XAieSingleTileRsc(XAieDev &Dev,
 			XAie_LocType L, XAie_ModuleType M):
 			XAieSingleTileRsc(Dev.getDevHandle(), L, M) {}
-		XAieSingleTileRsc(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieSingleTileRsc(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L):
 			XAieRsc(DevHd), Loc(L) {
 			uint8_t TType = _XAie_GetTileTypefromLoc(
@@ -469,11 +543,11 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Reserved == 0) {
-				Logger::log(LogLevel::ERROR) << typeid(*this).name() << " " <<
+				XAIEFAL_LOG(ERROR) << typeid(*this).name() << " " <<
 					__func__ << "(" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
 					" Expect Mod= " << Mod <<
-					" resource not reserved." << std::endl;
+					" resource not reserved." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				L = Loc;
@@ -0,0 +1,246 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <memory>
+#include <vector>
+#include <xaiengine.h>
+
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/rsc/xaiefal-rsc-base.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @class XAieRscBatch
+	 * @brief Collection of AI engine resources which are reserved,
+	 *	  started, stopped and released together. The operations are
+	 *	  all or nothing: if one resource fails, the resources of the
+	 *	  batch which have already been moved to the new state are
+	 *	  moved back to their previous state.
+	 *	  The register writes of starting and stopping the resources
+	 *	  are queued in one driver transaction and flushed once. If
+	 *	  the calling thread already has a transaction open, e.g. with
+	 *	  an XAieTxn scope, the writes join it instead.
+	 */
+	class XAieRscBatch {
+	public:
+		XAieRscBatch() = delete;
+		XAieRscBatch(const std::shared_ptr<XAieDevHandle> &DevHd):
+			AieHd(DevHd) {
+			if (!DevHd) {
+				throw std::invalid_argument("aie rsc batch: empty device handle");
+			}
+		}
+		XAieRscBatch(XAieDev &Dev):
+			AieHd(Dev.getDevHandle()) {}
+		/**
+		 * This function adds a resource to the batch. The resource
+		 * has to be configured before the batch is reserved.
+		 *
+		 * @param R resource
+		 * @return XAIE_OK for success, and error code for failure.
+		 */
+		AieRC add(std::shared_ptr<XAieRsc> R) {
+			if (!R || R->dev() != AieHd->dev()) {
+				XAIEFAL_LOG(ERROR) << "rsc batch: " << __func__ <<
+					" resource is empty or of another device." << '\n';
+				return XAIE_INVALID_ARGS;
+			}
+			Rscs.push_back(R);
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the number of resources of the batch.
+		 *
+		 * @return number of resources
+		 */
+		size_t size() const {
+			return Rscs.size();
+		}
+		/**
+		 * This function reserves all the resources of the batch which
+		 * are not reserved yet. If one of them fails, the resources
+		 * reserved by this call are released again.
+		 *
+		 * @return XAIE_OK for success, and error code for failure.
+		 */
+		AieRC reserve() {
+			std::vector<std::shared_ptr<XAieRsc>> Done;
+			AieRC RC = XAIE_OK;
+
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+			for (auto &R: Rscs) {
+				if (R->isReserved()) {
+					continue;
+				}
+				RC = R->reserve();
+				if (RC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "rsc batch: failed to reserve " <<
+						typeid(*R).name() << ", rolling back." << '\n';
+					break;
+				}
+				Done.push_back(R);
+			}
+			if (RC != XAIE_OK) {
+				_undo(Done, &XAieRsc::release);
+			}
+			return RC;
+		}
+		/**
+		 * This function starts all the reserved resources of the batch
+		 * which are not running yet inside one driver transaction. If
+		 * one of them fails, the resources started by this call are
+		 * stopped again.
+		 *
+		 * @return XAIE_OK for success, and error code for failure.
+		 *
+		 * @note If the calling thread has a transaction open, the
+		 *	 writes and their rollback are queued in it.
+		 */
+		AieRC start() {
+			std::vector<std::shared_ptr<XAieRsc>> Done;
+			AieRC RC;
+
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+			for (auto &R: Rscs) {
+				if (!R->isReserved()) {
+					XAIEFAL_LOG(ERROR) << "rsc batch: " << __func__ << " " <<
+						typeid(*R).name() << " resource is not allocated." << '\n';
+					return XAIE_ERR;
+				}
+			}
+			bool Own = _startTxn(RC);
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+			for (auto &R: Rscs) {
+				if (R->isRunning()) {
+					continue;
+				}
+				RC = R->start();
+				if (RC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "rsc batch: failed to start " <<
+						typeid(*R).name() << ", rolling back." << '\n';
+					break;
+				}
+				Done.push_back(R);
+			}
+			/*
+			 * Flush what has been queued, so that the rollback below
+			 * undoes configuration which is in the hardware.
+			 */
+			AieRC SubmitRC = _submitTxn(Own);
+			if (RC == XAIE_OK) {
+				RC = SubmitRC;
+			}
+			if (RC != XAIE_OK) {
+				_undo(Done, &XAieRsc::stop);
+			}
+			return RC;
+		}
+		/**
+		 * This function stops all the running resources of the batch
+		 * inside one driver transaction. It stops as many resources
+		 * as possible and returns the first error.
+		 *
+		 * @return XAIE_OK for success, and error code for failure.
+		 *
+		 * @note If the calling thread has a transaction open, the
+		 *	 writes are queued in it.
+		 */
+		AieRC stop() {
+			AieRC RC;
+
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+			bool Own = _startTxn(RC);
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+			RC = _forEach(&XAieRsc::stop);
+			AieRC SubmitRC = _submitTxn(Own);
+			return RC != XAIE_OK ? RC : SubmitRC;
+		}
+		/**
+		 * This function releases all the reserved resources of the
+		 * batch. It releases as many resources as possible and returns
+		 * the first error.
+		 *
+		 * @return XAIE_OK for success, and error code for failure.
+		 */
+		AieRC release() {
+			_XAIEFAL_MUTEX_ACQUIRE(mLock);
+			return _forEach(&XAieRsc::release);
+		}
+	private:
+		std::shared_ptr<XAieDevHandle> AieHd; /**< AI engine device handle */
+		std::vector<std::shared_ptr<XAieRsc>> Rscs; /**< resources */
+		_XAIEFAL_MUTEX_DECLARE(mLock);
+
+		/**
+		 * This function starts a transaction, unless the calling
+		 * thread has one open already.
+		 *
+		 * @param RC returns XAIE_OK for success, error code for failure
+		 * @return true if the transaction is started by this call
+		 */
+		bool _startTxn(AieRC &RC) {
+			if (_XAie_TxnIsActive(AieHd->dev()) == XAIE_ENABLE) {
+				RC = XAIE_OK;
+				return false;
+			}
+			RC = XAie_StartTransaction(AieHd->dev(),
+					XAIE_TRANSACTION_ENABLE_AUTO_FLUSH);
+			return RC == XAIE_OK;
+		}
+		/**
+		 * This function submits the transaction started by
+		 * _startTxn().
+		 *
+		 * @param Own true if the transaction was started by _startTxn()
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC _submitTxn(bool Own) {
+			if (!Own) {
+				return XAIE_OK;
+			}
+			return XAie_SubmitTransaction(AieHd->dev(), nullptr);
+		}
+		/**
+		 * This function applies an operation to all the resources of
+		 * the batch.
+		 *
+		 * @param Op resource operation
+		 * @return XAIE_OK if it succeeds on all the resources, the
+		 *	   first error code otherwise.
+		 */
+		AieRC _forEach(AieRC (XAieRsc::*Op)()) {
+			AieRC RC = XAIE_OK;
+
+			for (auto &R: Rscs) {
+				AieRC TRC = ((*R).*Op)();
+				if (TRC != XAIE_OK && RC == XAIE_OK) {
+					RC = TRC;
+				}
+			}
+			return RC;
+		}
+		/**
+		 * This function rolls back an operation on the resources it
+		 * has succeeded on, in the reverse order.
+		 *
+		 * @param Done resources to roll back
+		 * @param Op resource operation which undoes the failed one
+		 */
+		void _undo(std::vector<std::shared_ptr<XAieRsc>> &Done,
+				AieRC (XAieRsc::*Op)()) {
+			for (auto R = Done.rbegin(); R != Done.rend(); R++) {
+				if (((**R).*Op)() != XAIE_OK) {
+					XAIEFAL_LOG(WARN) << "rsc batch: failed to roll back " <<
+						typeid(**R).name() << '\n';
+				}
+			}
+		}
+	};
+}
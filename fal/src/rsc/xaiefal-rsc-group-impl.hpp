@@ -5,6 +5,9 @@
  * Base classes for AI engine resources management
  */
 
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include <xaiengine.h>
 #include <xaiefal/rsc/xaiefal-rsc-group.hpp>
@@ -16,11 +19,12 @@ namespace xaiefal {
 	/**
 	 * @class XAieRscGroupRuntime
 	 * @brief class to runtime resources functional group
-	 * Each element in the group is a resource.
+	 * Each element in the group is a resource. The statistics are
+	 * counted per tile as the resources are reserved and released.
 	 */
 	class XAieRscGroupRuntime : public XAieRscGroupBase {
 	public:
-		XAieRscGroupRuntime(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieRscGroupRuntime(const std::shared_ptr<XAieDevHandle> &DevHd,
 				const std::string &Name = ""):
 			XAieRscGroupBase(DevHd, Name) {}
 		XAieRscGroupRuntime() {}
@@ -32,58 +36,114 @@ namespace xaiefal {
 		 * @param  AI engine resource shared pointer
 		 * @return XAIE_OK for success, error code for failure.
 		 */
-		AieRC addRsc(std::shared_ptr<XAieRsc> R) {
-			bool toAdd = true;
-			std::vector<std::weak_ptr<XAieRsc>>::iterator it;
+		AieRC addRsc(const std::shared_ptr<XAieRsc> &R) {
+			R->addGroup(shared_from_this());
+			return XAIE_OK;
+		}
+		/**
+		 * This function counts the hardware resources of a resource
+		 * of the group which has been reserved.
+		 *
+		 * @param vRscs hardware resources of the resource
+		 */
+		void rscReserved(const std::vector<XAie_UserRsc> &vRscs) {
+			for (auto &R: vRscs) {
+				auto &vCnts = Counts[_tileKey(R.Loc)];
+				bool Found = false;
 
-			for (it = vRefs.begin(); it != vRefs.end();) {
-				auto lR = it->lock();
+				for (auto &C: vCnts) {
+					if (C.Mod == R.Mod && C.RscType == R.RscType &&
+						C.RscId == R.RscId) {
+						C.Num++;
+						Found = true;
+						break;
+					}
+				}
+				if (!Found) {
+					vCnts.push_back({R.Mod, R.RscType, R.RscId, 1});
+				}
+			}
+		}
+		/**
+		 * This function uncounts the hardware resources of a resource
+		 * of the group which has been released.
+		 *
+		 * @param vRscs hardware resources counted on reservation
+		 */
+		void rscReleased(const std::vector<XAie_UserRsc> &vRscs) {
+			for (auto &R: vRscs) {
+				auto it = Counts.find(_tileKey(R.Loc));
 
-				if (lR == nullptr) {
-					vRefs.erase(it);
+				if (it == Counts.end()) {
 					continue;
 				}
-				it++;
-				if (lR == R) {
-					toAdd = false;
-					break;
+				auto &vCnts = it->second;
+				for (auto C = vCnts.begin(); C != vCnts.end(); C++) {
+					if (C->Mod == R.Mod && C->RscType == R.RscType &&
+						C->RscId == R.RscId) {
+						if (--C->Num == 0) {
+							vCnts.erase(C);
+						}
+						break;
+					}
 				}
 			}
-			if (toAdd) {
-				vRefs.push_back(R);
-			}
-			return XAIE_OK;
 		}
 	private:
-		std::vector<std::weak_ptr<XAieRsc>> vRefs; /**< vector of AI engine resource objects */
+		/* number of reserved hardware resources of one kind in a tile */
+		struct RscCount {
+			uint32_t Mod;
+			uint32_t RscType;
+			uint32_t RscId;
+			uint32_t Num;
+		};
+		/**
+		 * counters of reserved hardware resources per tile, updated
+		 * as the resources of the group are reserved and released
+		 */
+		std::unordered_map<uint16_t, std::vector<RscCount>> Counts;
+
+		static uint16_t _tileKey(XAie_LocType L) {
+			return static_cast<uint16_t>((L.Col << 8) | L.Row);
+		}
+
+		void _addTileStat(XAieRscStat &RscStat, uint16_t Key,
+				const std::vector<RscCount> &vCnts, uint32_t Mod,
+				uint32_t RscType, uint32_t RscId) const {
+			XAie_LocType Loc = XAie_TileLoc(Key >> 8, Key & 0xFF);
+
+			for (auto &C: vCnts) {
+				if ((Mod != XAIE_MOD_ANY && C.Mod != Mod) ||
+					(RscType != XAIE_RSC_TYPE_ANY && C.RscType != RscType) ||
+					(RscId != XAIE_RSC_ID_ANY && C.RscId != RscId)) {
+					continue;
+				}
+				RscStat.addRscStat(Loc, C.Mod, C.RscType, C.Num);
+			}
+		}
 
 		XAieRscStat _getRscStat(const std::vector<XAie_LocType> &vLocs,
 				uint32_t Mod, uint32_t RscType,
 				uint32_t RscId) const {
 			XAieRscStat RscStat(FuncName);
-			std::vector<XAie_UserRsc> vRscs;
 
-			for (auto Ref: vRefs) {
-				auto R = Ref.lock();
+			for (auto L: vLocs) {
+				if (L.Col != XAIE_LOC_ANY && L.Row != XAIE_LOC_ANY) {
+					auto it = Counts.find(_tileKey(L));
 
-				if (R == nullptr) {
+					if (it != Counts.end()) {
+						_addTileStat(RscStat, it->first, it->second,
+							Mod, RscType, RscId);
+					}
 					continue;
 				}
-
-				auto RscWrapper = std::make_shared<
-					XAieRscGetRscsWrapper>(R, vRscs);
-			}
-
-			for (auto R: vRscs) {
-				for (auto L: vLocs) {
-					if ((L.Col != XAIE_LOC_ANY && R.Loc.Col != L.Col) ||
-						(L.Row != XAIE_LOC_ANY && R.Loc.Row != L.Row) ||
-						(Mod != XAIE_MOD_ANY && R.Mod != Mod) ||
-						(RscType != XAIE_RSC_TYPE_ANY && R.RscType != RscType) ||
-						(RscId != XAIE_RSC_ID_ANY && R.RscId != RscId)) {
+				for (auto &T: Counts) {
+					if ((L.Col != XAIE_LOC_ANY && (T.first >> 8) != L.Col) ||
+						(L.Row != XAIE_LOC_ANY && (T.first & 0xFF) != L.Row)) {
 						continue;
 					}
-					RscStat.addRscStat(R.Loc, R.Mod, R.RscType, 1);
+					_addTileStat(RscStat, T.first, T.second, Mod,
+						RscType, RscId);
 				}
 			}
 
@@ -98,7 +158,7 @@ namespace xaiefal {
 	 */
 	class XAieRscGroupStatic : public XAieRscGroupBase {
 	public:
-		XAieRscGroupStatic(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieRscGroupStatic(const std::shared_ptr<XAieDevHandle> &DevHd,
 				const std::string &Name = "Static"):
 			XAieRscGroupBase(DevHd, Name) {}
 		XAieRscGroupStatic() {};
@@ -133,19 +193,44 @@ namespace xaiefal {
 						vLocs, Mod, RscType);
 			}
 
-			if (XAie_GetStaticRscStat(AieHdPtr->dev(),
-				RscStats.size(), RscStats.data())) {
-				Logger::log(LogLevel::ERROR) << "failed to get static resource stat." << std::endl;
-			} else {
-				for (auto S: RscStats) {
-					if (S.NumRscs != 0) {
-						RscStat.addRscStat(S.Loc, S.Mod, S.RscType, S.NumRscs);
-					}
+			/*
+			 * Static allocations do not change at runtime, so only
+			 * the stats not queried before go to the driver.
+			 */
+			std::vector<XAie_UserRscStat> Misses;
+			for (auto &S: RscStats) {
+				if (Cache.find(_statKey(S)) == Cache.end()) {
+					Misses.push_back(S);
+				}
+			}
+			if (!Misses.empty()) {
+				if (XAie_GetStaticRscStat(AieHdPtr->dev(),
+					Misses.size(), Misses.data())) {
+					XAIEFAL_LOG(ERROR) << "failed to get static resource stat." << '\n';
+					return RscStat;
+				}
+				for (auto &S: Misses) {
+					Cache[_statKey(S)] = S.NumRscs;
+				}
+			}
+			for (auto &S: RscStats) {
+				uint32_t NumRscs = Cache[_statKey(S)];
+
+				if (NumRscs != 0) {
+					RscStat.addRscStat(S.Loc, S.Mod, S.RscType, NumRscs);
 				}
 			}
 
 			return RscStat;
 		}
+
+		/** static resources per tile, module and resource type */
+		mutable std::unordered_map<uint32_t, uint8_t> Cache;
+
+		static uint32_t _statKey(const XAie_UserRscStat &S) {
+			return ((uint32_t)S.Loc.Col << 24) | ((uint32_t)S.Loc.Row << 16) |
+				((uint32_t)S.Mod << 8) | S.RscType;
+		}
 	};
 
 	/**
@@ -155,7 +240,7 @@ namespace xaiefal {
 	 */
 	class XAieRscGroupAvail : public XAieRscGroupBase {
 	public:
-		XAieRscGroupAvail(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieRscGroupAvail(const std::shared_ptr<XAieDevHandle> &DevHd,
 				const std::string &Name = "Avail"):
 			XAieRscGroupBase(DevHd, Name) {}
 		XAieRscGroupAvail() {}
@@ -172,7 +257,7 @@ namespace xaiefal {
 		 * go to the lower level driver to get the resource
 		 * availability.
 		 */
-		AieRC addRsc(std::shared_ptr<XAieRsc> R) {
+		AieRC addRsc(const std::shared_ptr<XAieRsc> &R) {
 			bool toAdd = true;
 			std::vector<std::weak_ptr<XAieRsc>>::iterator it;
 
@@ -184,7 +269,7 @@ namespace xaiefal {
 				auto lR = it->lock();
 
 				if (lR == nullptr) {
-					vRefs.erase(it);
+					it = vRefs.erase(it);
 					continue;
 				}
 				it++;
@@ -238,7 +323,7 @@ namespace xaiefal {
 
 			if (XAie_GetAvailRscStat(AieHdPtr->dev(),
 				RscStats.size(), RscStats.data())) {
-				Logger::log(LogLevel::ERROR) << "failed to get avail resource stat." << std::endl;
+				XAIEFAL_LOG(ERROR) << "failed to get avail resource stat." << '\n';
 			} else {
 				for (auto S: RscStats) {
 					if (S.NumRscs == 0) {
@@ -248,8 +333,34 @@ namespace xaiefal {
 				}
 			}
 
+			/*
+			 * Resources in the warm pool are reserved in the driver
+			 * but available to this application.
+			 */
+			auto PoolStat = AieHdPtr->getRscPoolStat();
+			for (auto &P: PoolStat.Rscs) {
+				XAie_LocType L = XAie_TileLoc(std::get<0>(P.first),
+						std::get<1>(P.first));
+				uint32_t PMod = std::get<2>(P.first);
+				uint32_t PRscType = std::get<3>(P.first);
+				bool InLocs = (vLocs[0].Col == XAIE_LOC_ANY);
+
+				if ((Mod != XAIE_MOD_ANY && PMod != Mod) ||
+					(lRscType != XAIE_RSC_TYPE_ANY &&
+					 PRscType != lRscType)) {
+					continue;
+				}
+				for (size_t i = 0; !InLocs && i < vLocs.size(); i++) {
+					InLocs = (vLocs[i].Col == L.Col &&
+						vLocs[i].Row == L.Row);
+				}
+				if (InLocs) {
+					RscStat.addRscStat(L, PMod, PRscType, P.second);
+				}
+			}
+
 			/* Handle resoure whose availability is managed by AIE FAL layer */
-			for (auto Ref: vRefs) {
+			for (auto &Ref: vRefs) {
 				uint32_t NumRscs;
 				XAie_LocType Loc;
 				uint32_t Mod;
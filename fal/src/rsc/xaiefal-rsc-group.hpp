@@ -8,6 +8,8 @@
 #include <fstream>
 #include <functional>
 #include <map>
+#include <memory>
+#include <tuple>
 #include <vector>
 #include <xaiengine.h>
 #include <xaiefal/common/xaiefal-common.hpp>
@@ -32,8 +34,9 @@ namespace xaiefal {
 		XAieRscStat(const std::string &Name = ""):
 			GroupName(Name) {}
 		std::string GroupName; /**< name of the group of resources */
-		std::map<std::tuple<uint8_t, uint8_t, uint32_t, uint32_t>,
-			uint32_t> Rscs; /**< number of resources info:
+		/** key of resource stats: col, row, mod type, rsc type */
+		typedef std::tuple<uint8_t, uint8_t, uint32_t, uint32_t> RscKey;
+		std::map<RscKey, uint32_t> Rscs; /**< number of resources info:
 					       * key: col, row, mod type, rsc type>
 					       * value: numer of resources
 					       */
@@ -46,18 +49,9 @@ namespace xaiefal {
 		 */
 		void addRscStat(XAie_LocType Loc, uint32_t Mod, uint32_t RscType,
 			uint32_t NumRscs) {
-			(void)Mod;
-			(void)RscType;
-			(void)NumRscs;
+			RscKey rKey {Loc.Col, Loc.Row, Mod, RscType};
 
-			std::tuple<uint8_t, uint8_t, uint32_t, uint32_t> rKey {
-				Loc.Col, Loc.Row, Mod, RscType};
-
-			if (Rscs.find(rKey) != Rscs.end()) {
-				Rscs[rKey] += NumRscs;
-			} else {
-				Rscs[rKey] = NumRscs;
-			}
+			Rscs[rKey] += NumRscs;
 		}
 
 		/**
@@ -70,16 +64,14 @@ namespace xaiefal {
 		 * @return number of resources of the type of resources of a module
 		 *	of a tile.
 		 */
-		uint32_t getNumRsc(XAie_LocType Loc, uint32_t Mod, uint32_t RscType) {
-			uint32_t NumRscs = 0;
-			std::tuple<uint8_t, uint8_t, uint32_t, uint32_t> rKey {
-				Loc.Col, Loc.Row, Mod, RscType};
+		uint32_t getNumRsc(XAie_LocType Loc, uint32_t Mod, uint32_t RscType) const {
+			RscKey rKey {Loc.Col, Loc.Row, Mod, RscType};
+			auto it = Rscs.find(rKey);
 
-			if (Rscs.find(rKey) != Rscs.end()) {
-				NumRscs =  Rscs[rKey];
+			if (it != Rscs.end()) {
+				return it->second;
 			}
-
-			return NumRscs;
+			return 0;
 		}
 
 		/**
@@ -96,7 +88,7 @@ namespace xaiefal {
 		 * This function shows the resources information of this resource group
 		 */
 		void show() const {
-			Logger::log(LogLevel::INFO) << GroupName << ":" << std::endl;
+			XAIEFAL_LOG(INFO) << GroupName << ":" << '\n';
 			for (auto const& r : Rscs) {
 				std::string Str = "\t(" +
 					std::to_string(static_cast<uint32_t>(std::get<0>(r.first))) +
@@ -153,7 +145,7 @@ namespace xaiefal {
 					break;
 				}
 				Str += ": " + std::to_string(r.second);
-				std::cout << Str << std::endl;
+				std::cout << Str << '\n';
 			}
 		}
 	};
@@ -162,9 +154,10 @@ namespace xaiefal {
 	 * @class XAieRscGroupBase
 	 * @brief base class to resources functional group
 	 */
-	class XAieRscGroupBase {
+	class XAieRscGroupBase:
+		public std::enable_shared_from_this<XAieRscGroupBase> {
 	public:
-		XAieRscGroupBase(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieRscGroupBase(const std::shared_ptr<XAieDevHandle> &DevHd,
 				const std::string &Name = ""):
 			FuncName(Name), AieHd(DevHd) {}
 		XAieRscGroupBase() {}
@@ -278,11 +271,30 @@ namespace xaiefal {
 			return _getRscStat(vLocs, XAIE_MOD_ANY, RscType, RscId);
 		}
 
-		virtual AieRC addRsc(std::shared_ptr<XAieRsc> R) {
+		virtual AieRC addRsc(const std::shared_ptr<XAieRsc> &R) {
 			(void)R;
 			throw std::invalid_argument("Add Rsc not supported, rsc group: " + FuncName);
 			return XAIE_ERR;
 		}
+		/**
+		 * This function is called when a resource of the group has
+		 * been reserved.
+		 *
+		 * @param vRscs hardware resources of the resource
+		 */
+		virtual void rscReserved(const std::vector<XAie_UserRsc> &vRscs) {
+			(void)vRscs;
+		}
+		/**
+		 * This function is called when a resource of the group has
+		 * been released or freed.
+		 *
+		 * @param vRscs hardware resources counted when the resource
+		 *	  was reserved
+		 */
+		virtual void rscReleased(const std::vector<XAie_UserRsc> &vRscs) {
+			(void)vRscs;
+		}
 	protected:
 		std::string FuncName; /**< function name of this group */
 		std::weak_ptr<XAieDevHandle> AieHd; /**< AI engine device instance */
@@ -22,7 +22,7 @@ namespace xaiefal {
 	class XAieStreamPortSelect: public XAieSingleTileRsc {
 	public:
 		XAieStreamPortSelect() = delete;
-		XAieStreamPortSelect(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieStreamPortSelect(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L):
 			XAieSingleTileRsc(DevHd, L) {
 			State.Initialized = 1;
@@ -43,9 +43,9 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << "Stream port select " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "Stream port select " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
-					" resource is in use." << std::endl;
+					" resource is in use." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				PortIntf = PIntf;
@@ -66,9 +66,9 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Reserved == 0) {
-				Logger::log(LogLevel::ERROR) << "Stream port select " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "Stream port select " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
-					" resource not reserved." << std::endl;
+					" resource not reserved." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				XAie_EventGetIdlePortEventBase(AieHd->dev(), Loc, Mod, &E);
@@ -145,7 +145,7 @@ namespace xaiefal {
 				RC = XAie_RequestAllocatedSSEventPortSelect(AieHd->dev(), 1, &Rsc);
 			}
 			if (RC != XAIE_OK) {
-				Logger::log(LogLevel::WARN) << "Stream port select " << __func__ << " (" <<
+				XAIEFAL_LOG(WARN) << "Stream port select " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ")" <<
 					" resource not available.\n";
 			}
@@ -160,9 +160,9 @@ namespace xaiefal {
 			RC = XAie_EventSelectStrmPort(dev(), Loc, Rsc.RscId,
 					PortIntf, PortType, PortNum);
 			if (RC != XAIE_OK) {
-				Logger::log(LogLevel::ERROR) << "Stream port select " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "Stream port select " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
-					" failed to start." << std::endl;
+					" failed to start." << '\n';
 			}
 			return RC;
 		}
@@ -171,9 +171,9 @@ namespace xaiefal {
 
 			RC = XAie_EventSelectStrmPortReset(dev(), Loc, Rsc.RscId);
 			if (RC != XAIE_OK) {
-				Logger::log(LogLevel::ERROR) << "Stream port select " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "Stream port select " << __func__ << " (" <<
 					(uint32_t)Loc.Col << "," << (uint32_t)Loc.Row << ")" <<
-					" failed to stop." << std::endl;
+					" failed to stop." << '\n';
 			}
 			return RC;
 		}
@@ -0,0 +1,432 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <memory>
+#include <vector>
+#include <xaiengine.h>
+
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/rsc/xaiefal-bc.hpp>
+#include <xaiefal/rsc/xaiefal-rsc-batch.hpp>
+#include <xaiefal/rsc/xaiefal-trace.hpp>
+
+#pragma once
+
+#ifndef XAIEFAL_TRACE_PLANNER_NUM_PKT_IDS
+#define XAIEFAL_TRACE_PLANNER_NUM_PKT_IDS 32U
+#endif
+
+namespace xaiefal {
+	/**
+	 * @struct XAieTraceObservation
+	 * @brief Event to trace with the trace control of a module.
+	 */
+	struct XAieTraceObservation {
+		XAie_LocType Loc; /**< tile location */
+		XAie_ModuleType Mod; /**< module of the trace control */
+		XAie_Events Event; /**< event to trace */
+	};
+
+	/**
+	 * @struct XAieTraceStream
+	 * @brief Trace packet stream of one module in a trace plan.
+	 */
+	struct XAieTraceStream {
+		XAie_LocType Loc; /**< tile location */
+		XAie_ModuleType Mod; /**< module of the trace control */
+		XAie_Packet Pkt; /**< packet ID and type of the stream */
+		std::vector<XAie_Events> Events; /**< events to trace */
+	};
+
+	/**
+	 * @class XAieTracePlanner
+	 * @brief Plans and sets up the tracing of many modules at once.
+	 *	  Observations are grouped into one trace stream per module, up
+	 *	  to the number of trace slots of the module. Streams are kept in
+	 *	  the order they are first observed, up to the bandwidth budget
+	 *	  and the packet IDs available; observations which do not fit
+	 *	  are dropped and reported.
+	 *	  Each stream gets its own packet ID, with the packet type of the
+	 *	  tile type: 0 for core modules, 1 for memory modules, 2 for shim
+	 *	  tiles and 3 for memory tiles.
+	 *	  If a trigger is set, its start and stop events are broadcast
+	 *	  to the whole partition on two channels and start and stop all
+	 *	  the streams together. Otherwise the streams start as soon as
+	 *	  they are configured.
+	 */
+	class XAieTracePlanner {
+	public:
+		XAieTracePlanner() = delete;
+		XAieTracePlanner(XAieDev &Dev): AieDev(Dev),
+			MaxStreams(UINT32_MAX), PktIdBase(0),
+			Mode(XAIE_TRACE_EVENT_TIME), HasTrigger(false),
+			Planned(false) {}
+		~XAieTracePlanner() {
+			stop();
+		}
+		/**
+		 * This function adds an event to trace.
+		 *
+		 * @param L tile location
+		 * @param M module of the trace control, the event has to be
+		 *	  an event of this module
+		 * @param E event to trace
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC addObservation(XAie_LocType L, XAie_ModuleType M,
+				XAie_Events E) {
+			if (_XAie_CheckModule(AieDev.dev(), L, M) != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << "trace planner " << __func__ <<
+					" invalid tile or module." << '\n';
+				return XAIE_INVALID_ARGS;
+			}
+			vObs.push_back({L, M, E});
+			Planned = false;
+			return XAIE_OK;
+		}
+		/**
+		 * This function sets the bandwidth budget as the maximum
+		 * number of trace streams. Each traced module sends its trace
+		 * packets as one stream towards the shim.
+		 *
+		 * @param N maximum number of trace streams
+		 */
+		void setBandwidthBudget(uint32_t N) {
+			MaxStreams = N;
+			Planned = false;
+		}
+		/**
+		 * This function sets the first packet ID given to the trace
+		 * streams.
+		 *
+		 * @param Id first packet ID
+		 */
+		void setPktIdBase(uint8_t Id) {
+			PktIdBase = Id;
+			Planned = false;
+		}
+		/**
+		 * This function sets the trace mode of all the streams.
+		 *
+		 * @param M trace mode
+		 */
+		void setMode(XAie_TraceMode M) {
+			Mode = M;
+		}
+		/**
+		 * This function sets the events which start and stop all the
+		 * trace streams.
+		 *
+		 * @param L tile of the trigger events
+		 * @param M module of the trigger events
+		 * @param StartE event starting the trace
+		 * @param StopE event stopping the trace
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC setTrigger(XAie_LocType L, XAie_ModuleType M,
+				XAie_Events StartE, XAie_Events StopE) {
+			if (_XAie_CheckModule(AieDev.dev(), L, M) != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << "trace planner " << __func__ <<
+					" invalid tile or module." << '\n';
+				return XAIE_INVALID_ARGS;
+			}
+			TrigLoc = L;
+			TrigMod = M;
+			TrigStart = StartE;
+			TrigStop = StopE;
+			HasTrigger = true;
+			return XAIE_OK;
+		}
+		/**
+		 * This function plans the trace streams from the observations.
+		 * No resource is reserved.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC plan() {
+			uint32_t MaxPkts = XAIEFAL_TRACE_PLANNER_NUM_PKT_IDS;
+
+			vStreams.clear();
+			vDropped.clear();
+			MaxPkts = PktIdBase < MaxPkts ? MaxPkts - PktIdBase : 0;
+			for (auto &O: vObs) {
+				XAieTraceStream *S = nullptr;
+
+				for (auto &lS: vStreams) {
+					if (lS.Loc.Col == O.Loc.Col &&
+						lS.Loc.Row == O.Loc.Row &&
+						lS.Mod == O.Mod) {
+						S = &lS;
+						break;
+					}
+				}
+				if (S == nullptr) {
+					if (vStreams.size() >= MaxStreams ||
+						vStreams.size() >= MaxPkts) {
+						vDropped.push_back(O);
+						continue;
+					}
+					uint8_t Id = PktIdBase + vStreams.size();
+
+					vStreams.push_back({O.Loc, O.Mod,
+						XAie_PacketInit(Id, _pktType(O.Loc, O.Mod)),
+						{}});
+					S = &vStreams.back();
+				}
+
+				bool Dup = false;
+				for (auto E: S->Events) {
+					if (E == O.Event) {
+						Dup = true;
+						break;
+					}
+				}
+				if (Dup) {
+					continue;
+				}
+				if (S->Events.size() >= AieDev.tile(O.Loc).module(
+					O.Mod).traceControl()->getMaxTraceEvents()) {
+					vDropped.push_back(O);
+					continue;
+				}
+				S->Events.push_back(O.Event);
+			}
+			if (!vDropped.empty()) {
+				XAIEFAL_LOG(WARN) << "trace planner " << __func__ << " " <<
+					vDropped.size() << " observations dropped." << '\n';
+			}
+			Planned = true;
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the planned trace streams.
+		 *
+		 * @return trace streams
+		 */
+		const std::vector<XAieTraceStream> &streams() const {
+			return vStreams;
+		}
+		/**
+		 * This function returns the observations left out of the plan.
+		 *
+		 * @return dropped observations
+		 */
+		const std::vector<XAieTraceObservation> &dropped() const {
+			return vDropped;
+		}
+		/**
+		 * This function reserves and starts the tracing of all the
+		 * planned streams. The trace controls are configured in one
+		 * driver transaction, and the trigger is armed last.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC start() {
+			AieRC RC;
+
+			if (!vTracings.empty()) {
+				XAIEFAL_LOG(ERROR) << "trace planner " << __func__ <<
+					" already started." << '\n';
+				return XAIE_ERR;
+			}
+			if (!Planned) {
+				plan();
+			}
+			if (HasTrigger) {
+				RC = _reserveTrigger();
+				if (RC != XAIE_OK) {
+					return RC;
+				}
+			}
+			Batch.reset(new XAieRscBatch(AieDev));
+			for (auto &S: vStreams) {
+				auto T = makePooled<XAieTracing>(AieDev, S.Loc, S.Mod);
+
+				RC = _configure(*T, S);
+				if (RC != XAIE_OK) {
+					_cleanup();
+					return RC;
+				}
+				vTracings.push_back(T);
+				Batch->add(T);
+			}
+			RC = Batch->reserve();
+			if (RC == XAIE_OK) {
+				RC = Batch->start();
+				if (RC != XAIE_OK) {
+					Batch->release();
+				}
+			}
+			if (RC == XAIE_OK && HasTrigger) {
+				RC = XAie_EventBroadcast(AieDev.dev(), TrigLoc,
+					TrigMod, StartBC->getBc(), TrigStart);
+				if (RC == XAIE_OK) {
+					RC = XAie_EventBroadcast(AieDev.dev(), TrigLoc,
+						TrigMod, StopBC->getBc(), TrigStop);
+				}
+				if (RC != XAIE_OK) {
+					Batch->stop();
+					Batch->release();
+				}
+			}
+			if (RC != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << "trace planner " << __func__ <<
+					" failed to start tracing." << '\n';
+				_cleanup();
+			}
+			return RC;
+		}
+		/**
+		 * This function stops the tracing and releases its resources.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC stop() {
+			AieRC RC = XAIE_OK;
+
+			if (vTracings.empty()) {
+				return RC;
+			}
+			if (HasTrigger) {
+				XAie_EventBroadcastReset(AieDev.dev(), TrigLoc,
+					TrigMod, StartBC->getBc());
+				XAie_EventBroadcastReset(AieDev.dev(), TrigLoc,
+					TrigMod, StopBC->getBc());
+			}
+			RC = Batch->stop();
+			if (RC == XAIE_OK) {
+				RC = Batch->release();
+			}
+			_cleanup();
+			return RC;
+		}
+	private:
+		XAieDev &AieDev; /**< AI engine device */
+		std::unique_ptr<XAieRscBatch> Batch; /**< tracings started together */
+		std::vector<XAieTraceObservation> vObs; /**< observations */
+		std::vector<XAieTraceStream> vStreams; /**< planned streams */
+		std::vector<XAieTraceObservation> vDropped; /**< left out */
+		std::vector<std::shared_ptr<XAieTracing>> vTracings; /**< tracings */
+		std::shared_ptr<XAieBroadcast> StartBC; /**< start channel */
+		std::shared_ptr<XAieBroadcast> StopBC; /**< stop channel */
+		uint32_t MaxStreams; /**< bandwidth budget in streams */
+		uint8_t PktIdBase; /**< first packet ID */
+		XAie_TraceMode Mode; /**< trace mode */
+		bool HasTrigger;
+		XAie_LocType TrigLoc; /**< tile of the trigger events */
+		XAie_ModuleType TrigMod; /**< module of the trigger events */
+		XAie_Events TrigStart; /**< trigger start event */
+		XAie_Events TrigStop; /**< trigger stop event */
+		bool Planned;
+
+		/**
+		 * This function returns the packet type of a trace stream.
+		 */
+		uint8_t _pktType(XAie_LocType L, XAie_ModuleType M) {
+			uint8_t TType = _XAie_GetTileTypefromLoc(AieDev.dev(), L);
+
+			if (TType == XAIEGBL_TILE_TYPE_MEMTILE) {
+				return 3;
+			} else if (TType != XAIEGBL_TILE_TYPE_AIETILE) {
+				return 2;
+			}
+			return (M == XAIE_CORE_MOD) ? 0 : 1;
+		}
+		/**
+		 * This function returns an event of a module from the event of
+		 * an AIE tile core module with the same offset, such as the
+		 * true event or a broadcast event.
+		 */
+		XAie_Events _modEvent(XAie_LocType L, XAie_ModuleType M,
+				XAie_Events Core, XAie_Events Mem,
+				XAie_Events Pl, XAie_Events MemTile,
+				uint32_t Offset = 0) {
+			uint8_t TType = _XAie_GetTileTypefromLoc(AieDev.dev(), L);
+			XAie_Events E;
+
+			if (TType == XAIEGBL_TILE_TYPE_MEMTILE) {
+				E = MemTile;
+			} else if (TType != XAIEGBL_TILE_TYPE_AIETILE) {
+				E = Pl;
+			} else {
+				E = (M == XAIE_CORE_MOD) ? Core : Mem;
+			}
+			return static_cast<XAie_Events>(static_cast<uint32_t>(E) +
+				Offset);
+		}
+		AieRC _reserveTrigger() {
+			std::vector<XAie_LocType> vL;
+			AieRC RC;
+
+			StartBC = makePooled<XAieBroadcast>(AieDev, vL, TrigMod,
+					TrigMod);
+			StopBC = makePooled<XAieBroadcast>(AieDev, vL, TrigMod,
+					TrigMod);
+			RC = StartBC->reserve();
+			if (RC == XAIE_OK) {
+				RC = StopBC->reserve();
+				if (RC != XAIE_OK) {
+					StartBC->release();
+				}
+			}
+			if (RC != XAIE_OK) {
+				XAIEFAL_LOG(ERROR) << "trace planner " << __func__ <<
+					" no broadcast channels for the trigger." << '\n';
+				StartBC.reset();
+				StopBC.reset();
+			}
+			return RC;
+		}
+		AieRC _configure(XAieTracing &T, const XAieTraceStream &S) {
+			XAie_Events StartE, StopE;
+			AieRC RC = XAIE_OK;
+
+			if (HasTrigger) {
+				StartE = _modEvent(S.Loc, S.Mod,
+					XAIE_EVENT_BROADCAST_0_CORE,
+					XAIE_EVENT_BROADCAST_0_MEM,
+					XAIE_EVENT_BROADCAST_A_0_PL,
+					XAIE_EVENT_BROADCAST_0_MEM_TILE,
+					StartBC->getBc());
+				StopE = _modEvent(S.Loc, S.Mod,
+					XAIE_EVENT_BROADCAST_0_CORE,
+					XAIE_EVENT_BROADCAST_0_MEM,
+					XAIE_EVENT_BROADCAST_A_0_PL,
+					XAIE_EVENT_BROADCAST_0_MEM_TILE,
+					StopBC->getBc());
+			} else {
+				StartE = _modEvent(S.Loc, S.Mod,
+					XAIE_EVENT_TRUE_CORE, XAIE_EVENT_TRUE_MEM,
+					XAIE_EVENT_TRUE_PL, XAIE_EVENT_TRUE_MEM_TILE);
+				StopE = _modEvent(S.Loc, S.Mod,
+					XAIE_EVENT_NONE_CORE, XAIE_EVENT_NONE_MEM,
+					XAIE_EVENT_NONE_PL, XAIE_EVENT_NONE_MEM_TILE);
+			}
+			for (auto E: S.Events) {
+				RC = T.addEvent(S.Mod, E);
+				if (RC != XAIE_OK) {
+					return RC;
+				}
+			}
+			RC = T.setCntrEvent(StartE, StopE);
+			if (RC == XAIE_OK) {
+				RC = T.setMode(Mode);
+			}
+			if (RC == XAIE_OK) {
+				RC = T.setPkt(S.Pkt);
+			}
+			return RC;
+		}
+		void _cleanup() {
+			vTracings.clear();
+			Batch.reset();
+			if (StartBC) {
+				StartBC->release();
+				StopBC->release();
+				StartBC.reset();
+				StopBC.reset();
+			}
+		}
+	};
+}
@@ -22,7 +22,7 @@ namespace xaiefal {
 	class XAieTraceCntr: public XAieSingleTileRsc {
 	public:
 		XAieTraceCntr() = delete;
-		XAieTraceCntr(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieTraceCntr(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L, XAie_ModuleType M):
 			XAieSingleTileRsc(DevHd, L, M), Pkt() {
 			XAie_EventPhysicalToLogicalConv(dev(), Loc, Mod, 0,
@@ -73,8 +73,8 @@ namespace xaiefal {
 			AieRC RC = XAIE_ERR;
 
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed, tracing already started." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed, tracing already started." << '\n';
 			} else {
 				for (uint32_t i = 0; i < TraceSlotBits.size(); i++) {
 					if (TraceSlotBits.test(i) == 0) {
@@ -97,11 +97,11 @@ namespace xaiefal {
 			AieRC RC = XAIE_ERR;
 
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed, tracing already started." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed, tracing already started." << '\n';
 			} else if (Slot >= static_cast<uint32_t>(TraceSlotBits.size())) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed, invalid slot id " << Slot << "." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed, invalid slot id " << Slot << "." << '\n';
 				RC = XAIE_INVALID_ARGS;
 			} else {
 				XAie_Events E;
@@ -128,20 +128,20 @@ namespace xaiefal {
 		AieRC setTraceEvent(uint32_t Slot, XAie_Events E) {
 			AieRC RC;
 
-			Logger::log(LogLevel::DEBUG) << __func__ << " " <<
+			XAIEFAL_LOG(DEBUG) << __func__ << " " <<
 				"(" << static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ") Mod=" << Mod <<
-				" Slot=" << Slot << " E=" << E << std::endl;
+				" Slot=" << Slot << " E=" << E << '\n';
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed, trace started." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed, trace started." << '\n';
 				RC = XAIE_ERR;
 			} else if (Slot >= static_cast<uint32_t>(TraceSlotBits.size())) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed, invalid slot." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed, invalid slot." << '\n';
 				RC = XAIE_INVALID_ARGS;
 			} else if ((TraceSlotBits.test(Slot) == 0)) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed, trace slot is not reserved." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed, trace slot is not reserved." << '\n';
 				RC = XAIE_INVALID_ARGS;
 			} else {
 				if (E == XAIE_EVENT_NONE_CORE) {
@@ -168,12 +168,12 @@ namespace xaiefal {
 			XAie_ModuleType StartM, StopM;
 			AieRC RC;
 
-			Logger::log(LogLevel::DEBUG) << __func__ << " " <<
+			XAIEFAL_LOG(DEBUG) << __func__ << " " <<
 				"(" << static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ") Mod=" << Mod <<
-				" StartE=" << StartE << " StopE=" << StopE << std::endl;
+				" StartE=" << StartE << " StopE=" << StopE << '\n';
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed, trace started." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed, trace started." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				uint8_t HwE;
@@ -188,11 +188,11 @@ namespace xaiefal {
 				}
 				if ((StartM != Mod || StopM != Mod) &&
 					State.Reserved == 1) {
-					Logger::log(LogLevel::ERROR) << __func__ <<
+					XAIEFAL_LOG(ERROR) << __func__ <<
 						"failed, trace reserved," <<
 						"but start/stop event not of the same module of trace control. " <<
 						"Please set control event before reserve() if they are of different mod" <<
-						std::endl;
+						'\n';
 					RC = XAIE_ERR;
 				}
 			}
@@ -218,8 +218,8 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed, trace started." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed, trace started." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				Mode = M;
@@ -241,8 +241,8 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed, trace started." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed, trace started." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				Pkt = P;
@@ -287,10 +287,10 @@ namespace xaiefal {
 					BcId = -EINVAL;
 				}
 			} else {
-				Logger::log(LogLevel::ERROR) << "trace control " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "trace control " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 					") trace control Mod=" << Mod <<
-					" not reserved" << Mod << std::endl;
+					" not reserved" << Mod << '\n';
 				BcId = -EPERM;
 			}
 
@@ -313,10 +313,10 @@ namespace xaiefal {
 					BcId = -EINVAL;
 				}
 			} else {
-				Logger::log(LogLevel::ERROR) << "trace control " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "trace control " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 					") trace control Mod=" << Mod <<
-					" not reserved" << Mod << std::endl;
+					" not reserved" << Mod << '\n';
 				BcId = -EPERM;
 			}
 
@@ -337,17 +337,21 @@ namespace xaiefal {
 			AieRC RC;
 			XAie_UserRscReq Req = {Loc, Mod, 1};
 
-			RC = XAie_RequestTraceCtrl(AieHd->dev(), 1, &Req, 1, &Rsc);
+			Rsc.RscType = XAIE_TRACE_CTRL_RSC;
+			Rsc.Loc = Loc;
+			Rsc.Mod = static_cast<uint32_t>(Mod);
+			if (AieHd->takePooledRscs(&Rsc, 1)) {
+				RC = XAIE_OK;
+			} else {
+				RC = XAie_RequestTraceCtrl(AieHd->dev(), 1, &Req, 1, &Rsc);
+			}
 			if (RC != XAIE_OK) {
-				Logger::log(LogLevel::ERROR) << "trace control " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "trace control " << __func__ << " (" <<
 							static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
-							") Mod=" << Mod <<" failed to reserve." << std::endl;
+							") Mod=" << Mod <<" failed to reserve." << '\n';
 			}
 			if (RC == XAIE_OK && StartMod != Mod) {
-				std::vector<XAie_LocType> vL;
-
-				vL.push_back(Loc);
-				StartBC = new XAieBroadcast(AieHd, vL,
+				StartBC = new XAieBroadcast(AieHd, &Loc, &Loc + 1,
 					StartMod, Mod);
 				RC = StartBC->reserve();
 				if (RC != XAIE_OK) {
@@ -355,10 +359,7 @@ namespace xaiefal {
 				}
 			}
 			if (RC == XAIE_OK && StopMod != Mod) {
-				std::vector<XAie_LocType> vL;
-
-				vL.push_back(Loc);
-				StopBC = new XAieBroadcast(AieHd, vL,
+				StopBC = new XAieBroadcast(AieHd, &Loc, &Loc + 1,
 						StartMod, Mod);
 				RC = StopBC->reserve();
 				if (RC != XAIE_OK) {
@@ -384,11 +385,15 @@ namespace xaiefal {
 				delete StopBC;
 			}
 
-			RC = XAie_ReleaseTraceCtrl(AieHd->dev(), 1, &Rsc);
+			if (AieHd->poolRscs(&Rsc, 1)) {
+				RC = XAIE_OK;
+			} else {
+				RC = XAie_ReleaseTraceCtrl(AieHd->dev(), 1, &Rsc);
+			}
 			if(RC != XAIE_OK) {
-				Logger::log(LogLevel::ERROR) << "trace control " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "trace control " << __func__ << " (" <<
 							static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
-							") Mod=" << Mod <<" failed to release." << std::endl;
+							") Mod=" << Mod <<" failed to release." << '\n';
 			}
 			return RC;
 		}
@@ -400,8 +405,8 @@ namespace xaiefal {
 			XAie_Events lStartE = StartEvent;
 			XAie_Events lStopE = StopEvent;
 
-			Logger::log(LogLevel::DEBUG) << "trace control " << __func__ << " (" <<
-				static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ") Mod=" << Mod << std::endl;
+			XAIEFAL_LOG(DEBUG) << "trace control " << __func__ << " (" <<
+				static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ") Mod=" << Mod << '\n';
 			for (uint32_t i = 0; i < TraceSlotBits.size(); i++) {
 				if (TraceSlotBits.test(i) != 0) {
 					vE.push_back(Events[i]);
@@ -444,8 +449,8 @@ namespace xaiefal {
 		AieRC _stop() {
 			AieRC RC;
 
-			Logger::log(LogLevel::DEBUG) << "trace control " << __func__ << " (" <<
-				static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ") Mod=" << Mod << std::endl;
+			XAIEFAL_LOG(DEBUG) << "trace control " << __func__ << " (" <<
+				static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) << ") Mod=" << Mod << '\n';
 			// Do not reset the packet setting as it can
 			// cause issues on outstanding contents in
 			// the trace buffer.
@@ -529,7 +534,7 @@ namespace xaiefal {
 	class XAieTraceEvent: public XAieSingleTileRsc {
 	public:
 		XAieTraceEvent() = delete;
-		XAieTraceEvent(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieTraceEvent(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L, XAie_ModuleType M,
 			std::shared_ptr<XAieTraceCntr> TCntr):
 			XAieSingleTileRsc(DevHd, L, M),
@@ -566,23 +571,23 @@ namespace xaiefal {
 			RC = XAie_EventLogicalToPhysicalConv(dev(), Loc,
 					M, E, &HwEvent);
 			if (RC != XAIE_OK) {
-				Logger::log(LogLevel::ERROR) << "trace event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "trace event " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 					") Event Mod=" << M << " Event=" << E <<
-					" invalid event" << std::endl;
+					" invalid event" << '\n';
 				RC = XAIE_INVALID_ARGS;
 			} else if (State.Running == 1) {
 				RC = XAIE_ERR;
-				Logger::log(LogLevel::ERROR) << "trace event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "trace event " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 					") Event Mod=" << M << " Event=" << E <<
-					" trace event already in used" << std::endl;
+					" trace event already in used" << '\n';
 			} else if (State.Reserved == 1 && M != EventMod) {
 				RC = XAIE_INVALID_ARGS;
-				Logger::log(LogLevel::ERROR) << "trace event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "trace event " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 					") Event Mod=" << M << " Event=" << E <<
-					" trace event already reserved, input event module is different to the one already set" << std::endl;
+					" trace event already reserved, input event module is different to the one already set" << '\n';
 			} else {
 				Event = E;
 				EventMod = M;
@@ -602,10 +607,10 @@ namespace xaiefal {
 			AieRC RC;
 
 			if (State.Configured == 0) {
-				Logger::log(LogLevel::ERROR) << "trace event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "trace event " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 					") trace control Mod=" << TraceCntr->getModule() <<
-					" Event Mod=" << Mod << " no event specified" << std::endl;
+					" Event Mod=" << Mod << " no event specified" << '\n';
 				RC = XAIE_ERR;
 			} else {
 				E = Event;
@@ -631,11 +636,11 @@ namespace xaiefal {
 					BcId = -EINVAL;
 				}
 			} else {
-				Logger::log(LogLevel::ERROR) << "trace event " << __func__ << " (" <<
+				XAIEFAL_LOG(ERROR) << "trace event " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 					") trace control Mod=" << TraceCntr->getModule() <<
 					" Event Mod=" << EventMod <<
-					" resource not reserved." << std::endl;
+					" resource not reserved." << '\n';
 				BcId = -EPERM;
 			}
 
@@ -648,28 +653,25 @@ namespace xaiefal {
 		AieRC _reserve() {
 			AieRC RC;
 
-			Logger::log(LogLevel::DEBUG) << "trace event " << __func__ << " (" <<
+			XAIEFAL_LOG(DEBUG) << "trace event " << __func__ << " (" <<
 				static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 				") trace control Mod=" << TraceCntr->getModule() <<
-				" Event Mod=" << Mod << std::endl;
+				" Event Mod=" << Mod << '\n';
 			RC = TraceCntr->reserveTraceSlot(Slot);
 			if (RC != XAIE_OK) {
-				Logger::log(LogLevel::WARN) << "trace event " << __func__ << " (" <<
+				XAIEFAL_LOG(WARN) << "trace event " << __func__ << " (" <<
 					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 					") trace control Mod=" << TraceCntr->getModule() <<
-					" Event Mod=" << Mod << " no trace slot" << std::endl;
+					" Event Mod=" << Mod << " no trace slot" << '\n';
 			} else if (EventMod != TraceCntr->getModule()) {
-				std::vector<XAie_LocType> vL;
-
-				vL.push_back(Loc);
-				BC = std::make_shared<XAieBroadcast>(AieHd, vL,
+				BC = makePooled<XAieBroadcast>(AieHd, &Loc, &Loc + 1,
 					XAIE_CORE_MOD, XAIE_MEM_MOD);
 				RC = BC->reserve();
 				if (RC != XAIE_OK) {
-					Logger::log(LogLevel::ERROR) << "trace event " << __func__ << " (" <<
+					XAIEFAL_LOG(ERROR) << "trace event " << __func__ << " (" <<
 						static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 						") trace control Mod=" << TraceCntr->getModule() <<
-						" Event Mod=" << Mod << " no broadcast event" << std::endl;
+						" Event Mod=" << Mod << " no broadcast event" << '\n';
 					TraceCntr->releaseTraceSlot(Slot);
 				} else {
 					Rsc.Mod = Mod;
@@ -682,10 +684,10 @@ namespace xaiefal {
 			return RC;
 		}
 		AieRC _release() {
-			Logger::log(LogLevel::DEBUG) << "trace event " << __func__ << " (" <<
+			XAIEFAL_LOG(DEBUG) << "trace event " << __func__ << " (" <<
 				static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 				") trace control Mod=" << TraceCntr->getModule() <<
-				" Event Mod=" << Mod << "Event=" << Event << std::endl;
+				" Event Mod=" << Mod << "Event=" << Event << '\n';
 			TraceCntr->releaseTraceSlot(Slot);
 			if (EventMod != TraceCntr->getModule()) {
 				BC->release();
@@ -695,10 +697,10 @@ namespace xaiefal {
 		AieRC _start() {
 			AieRC RC;
 
-			Logger::log(LogLevel::DEBUG) << "trace event " << __func__ << " (" <<
+			XAIEFAL_LOG(DEBUG) << "trace event " << __func__ << " (" <<
 				static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 				") trace control Mod=" << TraceCntr->getModule() <<
-				" Event Mod=" << EventMod << "Event=" << Event << std::endl;
+				" Event Mod=" << EventMod << "Event=" << Event << '\n';
 			if (EventMod != TraceCntr->getModule()) {
 				RC = XAie_EventBroadcast(dev(), Loc, EventMod,
 						BC->getBc(), Event);
@@ -711,11 +713,11 @@ namespace xaiefal {
 					if (RC == XAIE_OK) {
 						RC = TraceCntr->setTraceEvent(Slot, BcE);
 					} else {
-						Logger::log(LogLevel::ERROR) << "trace event " << __func__ << " (" <<
+						XAIEFAL_LOG(ERROR) << "trace event " << __func__ << " (" <<
 							static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 							") trace control Mod=" << TraceCntr->getModule() <<
 							" Event Mod=" << EventMod << "Event=" << Event <<
-							" failed." << std::endl;
+							" failed." << '\n';
 					}
 				}
 			} else {
@@ -727,10 +729,10 @@ namespace xaiefal {
 			AieRC RC, lRC;
 			XAie_Events E;
 
-			Logger::log(LogLevel::DEBUG) << "trace event " << __func__ << " (" <<
+			XAIEFAL_LOG(DEBUG) << "trace event " << __func__ << " (" <<
 				static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
 				") trace control Mod=" << TraceCntr->getModule() <<
-				" Event Mod=" << Mod << "Event=" << Event << std::endl;
+				" Event Mod=" << Mod << "Event=" << Event << '\n';
 			RC = XAIE_OK;
 			XAie_EventPhysicalToLogicalConv(dev(), Loc,
 					TraceCntr->getModule(), 0, &E);
@@ -776,7 +778,7 @@ namespace xaiefal {
 	class XAieTracing: public XAieSingleTileRsc {
 	public:
 		XAieTracing() = delete;
-		XAieTracing(std::shared_ptr<XAieDevHandle> DevHd,
+		XAieTracing(const std::shared_ptr<XAieDevHandle> &DevHd,
 			XAie_LocType L, XAie_ModuleType M, std::shared_ptr<XAieTraceCntr> TCntr):
 			XAieSingleTileRsc(DevHd, L, M) {
 			if (!TCntr) {
@@ -811,29 +813,29 @@ namespace xaiefal {
 		AieRC addEvent(XAie_ModuleType M, XAie_Events E) {
 			AieRC RC;
 
-			Logger::log(LogLevel::DEBUG) << "tracing " << __func__ << " ("
+			XAIEFAL_LOG(DEBUG) << "tracing " << __func__ << " ("
 				<< static_cast<uint32_t>(TraceCntr->loc().Col) << "," << static_cast<uint32_t>(TraceCntr->loc().Row) <<
-				") Mod=" << static_cast<uint32_t>(M) << " E=" << E << std::endl;
+				") Mod=" << static_cast<uint32_t>(M) << " E=" << E << '\n';
 			if (Events.size() == TraceCntr->getMaxTraceEvents()) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed for tracing, exceeded max num of events." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed for tracing, exceeded max num of events." << '\n';
 				RC = XAIE_ERR;
 			} else if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed for tracing, resource reserved." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed for tracing, resource reserved." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				XAieTraceEvent TraceE(AieHd, Loc, Mod, TraceCntr);
 
 				RC = TraceE.setEvent(M, E);
 				if (RC != XAIE_OK) {
-					Logger::log(LogLevel::ERROR) << __func__ <<
-						"failed for tracing, failed to initialize event." << std::endl;
+					XAIEFAL_LOG(ERROR) << __func__ <<
+						"failed for tracing, failed to initialize event." << '\n';
 				} else if (State.Reserved == 1) {
 					RC = TraceE.reserve();
 					if (RC != XAIE_OK) {
-						Logger::log(LogLevel::ERROR) << __func__ <<
-							"failed for tracing, reserved new event failed." << std::endl;
+						XAIEFAL_LOG(ERROR) << __func__ <<
+							"failed for tracing, reserved new event failed." << '\n';
 					} else {
 						RC = TraceE.start();
 						if (RC != XAIE_OK) {
@@ -859,12 +861,12 @@ namespace xaiefal {
 		AieRC removeEvent(XAie_ModuleType M, XAie_Events E) {
 			AieRC RC;
 
-			Logger::log(LogLevel::DEBUG) << "tracing " << __func__ << " ("
+			XAIEFAL_LOG(DEBUG) << "tracing " << __func__ << " ("
 				<< static_cast<uint32_t>(TraceCntr->loc().Col) << "," << static_cast<uint32_t>(TraceCntr->loc().Row) <<
-				") Mod=" << static_cast<uint32_t>(M) << " E=" << E << std::endl;
+				") Mod=" << static_cast<uint32_t>(M) << " E=" << E << '\n';
 			if (State.Running == 1) {
-				Logger::log(LogLevel::ERROR) << __func__ <<
-					"failed for tracing, resource reserved." << std::endl;
+				XAIEFAL_LOG(ERROR) << __func__ <<
+					"failed for tracing, resource reserved." << '\n';
 				RC = XAIE_ERR;
 			} else {
 				RC = XAIE_INVALID_ARGS;
@@ -880,8 +882,8 @@ namespace xaiefal {
 					}
 				}
 				if (RC != XAIE_OK) {
-					Logger::log(LogLevel::ERROR) << __func__ <<
-						"failed for tracing, event doesn't exist." << std::endl;
+					XAIEFAL_LOG(ERROR) << __func__ <<
+						"failed for tracing, event doesn't exist." << '\n';
 				} else {
 					changeToConfigured();
 				}
@@ -902,10 +904,10 @@ namespace xaiefal {
 		AieRC setCntrEvent(XAie_Events StartE, XAie_Events StopE) {
 			AieRC RC;
 
-			Logger::log(LogLevel::DEBUG) << "tracing " << __func__ << " ("
+			XAIEFAL_LOG(DEBUG) << "tracing " << __func__ << " ("
 				<< static_cast<uint32_t>(TraceCntr->loc().Col) << "," << static_cast<uint32_t>(TraceCntr->loc().Row) <<
 				") Mod=" << static_cast<uint32_t>(TraceCntr->getModule()) <<
-				" StartE=" << StartE << " StopE=" << StopE << std::endl;
+				" StartE=" << StartE << " StopE=" << StopE << '\n';
 			RC = TraceCntr->setCntrEvent(StartE, StopE);
 			if (RC == XAIE_OK) {
 				changeToConfigured();
@@ -924,9 +926,9 @@ namespace xaiefal {
 		AieRC setMode(XAie_TraceMode M) {
 			AieRC RC;
 
-			Logger::log(LogLevel::DEBUG) << "tracing " << __func__ << " ("
+			XAIEFAL_LOG(DEBUG) << "tracing " << __func__ << " ("
 				<< static_cast<uint32_t>(TraceCntr->loc().Col) << "," << static_cast<uint32_t>(TraceCntr->loc().Row) <<
-				") M=" << M << std::endl;
+				") M=" << M << '\n';
 			RC = TraceCntr->setMode(M);
 			if (RC == XAIE_OK) {
 				changeToConfigured();
@@ -945,9 +947,9 @@ namespace xaiefal {
 		AieRC setPkt(const XAie_Packet &P) {
 			AieRC RC;
 
-			Logger::log(LogLevel::DEBUG) << "tracing " << __func__ << " ("
+			XAIEFAL_LOG(DEBUG) << "tracing " << __func__ << " ("
 				<< static_cast<uint32_t>(TraceCntr->loc().Col) << "," << static_cast<uint32_t>(TraceCntr->loc().Row) <<
-				") Mod=" << static_cast<uint32_t>(TraceCntr->getModule()) << std::endl;
+				") Mod=" << static_cast<uint32_t>(TraceCntr->getModule()) << '\n';
 			RC = TraceCntr->setPkt(P);
 			if (RC == XAIE_OK) {
 				changeToConfigured();
@@ -980,9 +982,9 @@ namespace xaiefal {
 		AieRC _reserve() {
 			AieRC RC = XAIE_OK;
 
-			Logger::log(LogLevel::DEBUG) << "tracing " << __func__ << " ("
+			XAIEFAL_LOG(DEBUG) << "tracing " << __func__ << " ("
 				<< static_cast<uint32_t>(TraceCntr->loc().Col) << "," << static_cast<uint32_t>(TraceCntr->loc().Row) <<
-				") Mod=" << static_cast<uint32_t>(TraceCntr->getModule()) << std::endl;
+				") Mod=" << static_cast<uint32_t>(TraceCntr->getModule()) << '\n';
 			if (RC == XAIE_OK && !(TraceCntr->isReserved())) {
 				RC = TraceCntr->reserve();
 			}
@@ -1008,9 +1010,9 @@ namespace xaiefal {
 			return RC;
 		}
 		AieRC _release() {
-			Logger::log(LogLevel::DEBUG) << "tracing " << __func__ << " ("
+			XAIEFAL_LOG(DEBUG) << "tracing " << __func__ << " ("
 				<< static_cast<uint32_t>(TraceCntr->loc().Col) << "," << static_cast<uint32_t>(TraceCntr->loc().Row) <<
-				") Mod=" << static_cast<uint32_t>(TraceCntr->getModule()) << std::endl;
+				") Mod=" << static_cast<uint32_t>(TraceCntr->getModule()) << '\n';
 			TraceCntr->release();
 			for (uint32_t i = 0; i < Events.size(); i++) {
 				Events[i].release();
@@ -1020,9 +1022,9 @@ namespace xaiefal {
 		AieRC _start() {
 			AieRC RC = XAIE_OK;
 
-			Logger::log(LogLevel::DEBUG) << "tracing " << __func__ << " (" <<
+			XAIEFAL_LOG(DEBUG) << "tracing " << __func__ << " (" <<
 				static_cast<uint32_t>(TraceCntr->loc().Col) << "," << static_cast<uint32_t>(TraceCntr->loc().Row) << ")" <<
-				" Mod=" << TraceCntr->getModule() << ", " << Events.size() << " events to trace." << std::endl;
+				" Mod=" << TraceCntr->getModule() << ", " << Events.size() << " events to trace." << '\n';
 			for (uint32_t i = 0; i < Events.size(); i++) {
 				RC = Events[i].start();
 				if (RC != XAIE_OK) {
@@ -1040,9 +1042,9 @@ namespace xaiefal {
 			return RC;
 		}
 		AieRC _stop() {
-			Logger::log(LogLevel::DEBUG) << "tracing "<< __func__ << " (" <<
+			XAIEFAL_LOG(DEBUG) << "tracing "<< __func__ << " (" <<
 				static_cast<uint32_t>(TraceCntr->loc().Col) << "," << static_cast<uint32_t>(TraceCntr->loc().Row) << ")" <<
-				" Mod=" << TraceCntr->getModule() << ", " << Events.size() << " events to trace." << std::endl;
+				" Mod=" << TraceCntr->getModule() << ", " << Events.size() << " events to trace." << '\n';
 			TraceCntr->stop();
 			for (uint32_t i = 0; i < Events.size(); i++) {
 				Events[i].stop();
@@ -0,0 +1,336 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <memory>
+#include <vector>
+#include <xaiengine.h>
+
+#include <xaiefal/rsc/xaiefal-events.hpp>
+#include <xaiefal/rsc/xaiefal-groupevent.hpp>
+#include <xaiefal/rsc/xaiefal-rsc-base.hpp>
+#include <xaiefal/rsc/xaiefal-trace.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @class XAieTraceFilterExpr
+	 * @brief Expression over the events of a module to trace with a
+	 *	  trace filter. A leaf is an event, or a group event with its
+	 *	  enabled events. Leaves are combined with AND, AND NOT, OR and
+	 *	  OR NOT, as far as the combo events of a module allow: up to
+	 *	  two levels of operations over up to four leaves.
+	 */
+	class XAieTraceFilterExpr {
+	public:
+		XAieTraceFilterExpr(XAie_Events E): Event(E), GroupMask(0),
+			Op(XAIE_EVENT_COMBO_E1_OR_E2) {}
+		XAieTraceFilterExpr(std::shared_ptr<XAieGroupEventHandle> G,
+			uint32_t Mask): Event(G->getEvent()), Group(G),
+			GroupMask(Mask), Op(XAIE_EVENT_COMBO_E1_OR_E2) {}
+		XAieTraceFilterExpr operator&(const XAieTraceFilterExpr &R) const {
+			return XAieTraceFilterExpr(*this, R, XAIE_EVENT_COMBO_E1_AND_E2);
+		}
+		XAieTraceFilterExpr operator|(const XAieTraceFilterExpr &R) const {
+			return XAieTraceFilterExpr(*this, R, XAIE_EVENT_COMBO_E1_OR_E2);
+		}
+		XAieTraceFilterExpr andNot(const XAieTraceFilterExpr &R) const {
+			return XAieTraceFilterExpr(*this, R, XAIE_EVENT_COMBO_E1_AND_NOTE2);
+		}
+		XAieTraceFilterExpr orNot(const XAieTraceFilterExpr &R) const {
+			return XAieTraceFilterExpr(*this, R, XAIE_EVENT_COMBO_E1_OR_NOTE2);
+		}
+		bool isLeaf() const {
+			return !Left;
+		}
+	private:
+		XAieTraceFilterExpr(const XAieTraceFilterExpr &L,
+			const XAieTraceFilterExpr &R, XAie_EventComboOps O):
+			Event(), GroupMask(0), Op(O),
+			Left(std::make_shared<XAieTraceFilterExpr>(L)),
+			Right(std::make_shared<XAieTraceFilterExpr>(R)) {}
+
+		XAie_Events Event; /**< event of a leaf */
+		std::shared_ptr<XAieGroupEventHandle> Group; /**< group of a leaf */
+		uint32_t GroupMask; /**< enabled events of the group */
+		XAie_EventComboOps Op; /**< operation of a node */
+		std::shared_ptr<XAieTraceFilterExpr> Left; /**< first operand */
+		std::shared_ptr<XAieTraceFilterExpr> Right; /**< second operand */
+
+		friend class XAieTraceFilter;
+	};
+
+	/**
+	 * @class XAieTraceFilter
+	 * @brief Trace filter resource class. It compiles an event
+	 *	  expression into group and combo events of the event module,
+	 *	  and traces the resulting event in a single trace slot, so
+	 *	  that only the occurrences of interest use trace bandwidth.
+	 */
+	class XAieTraceFilter: public XAieSingleTileRsc {
+	public:
+		XAieTraceFilter() = delete;
+		XAieTraceFilter(const std::shared_ptr<XAieDevHandle> &DevHd,
+			XAie_LocType L, XAie_ModuleType M,
+			std::shared_ptr<XAieTraceCntr> TCntr):
+			XAieSingleTileRsc(DevHd, L, M), EventMod(M) {
+			if (!TCntr) {
+				throw std::invalid_argument("Trace filter failed, empty trace control");
+			}
+			if (TCntr->dev() != DevHd->dev() ||
+				TCntr->getModule() != Mod) {
+				throw std::invalid_argument("Trace filter failed, trace control aiedev or module mismatched");
+			}
+			TraceCntr = std::move(TCntr);
+			State.Initialized = 1;
+		}
+		XAieTraceFilter(XAieDev &Dev, XAie_LocType L,
+			XAie_ModuleType M):
+			XAieSingleTileRsc(Dev, L, M), EventMod(M) {
+			TraceCntr = Dev.tile(L).module(M).traceControl();
+			State.Initialized = 1;
+		}
+		/**
+		 * This function sets the filter expression. It needs to be
+		 * called before reserve().
+		 *
+		 * @param M module of the events of the expression
+		 * @param Expr filter expression
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC setFilter(XAie_ModuleType M, const XAieTraceFilterExpr &Expr) {
+			std::vector<XAie_Events> vE;
+			std::vector<XAie_EventComboOps> vOp;
+			std::vector<std::shared_ptr<XAieGroupEventHandle>> vG;
+			AieRC RC;
+
+			if (State.Reserved == 1) {
+				XAIEFAL_LOG(ERROR) << "trace filter " << __func__ << " (" <<
+					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
+					") Mod=" << Mod << " resource already reserved." << '\n';
+				return XAIE_ERR;
+			}
+			if (Expr.isLeaf()) {
+				_addLeaf(Expr, vE, vG);
+			} else if (Expr.Left->isLeaf() && Expr.Right->isLeaf()) {
+				_addLeaf(*Expr.Left, vE, vG);
+				_addLeaf(*Expr.Right, vE, vG);
+				vOp.push_back(Expr.Op);
+			} else {
+				RC = _addPair(*Expr.Left, vE, vOp, vG);
+				if (RC == XAIE_OK) {
+					RC = _addPair(*Expr.Right, vE, vOp, vG);
+				}
+				if (RC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "trace filter " << __func__ << " (" <<
+						static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
+						") Mod=" << Mod << " expression too deep for combo events." << '\n';
+					return RC;
+				}
+				vOp.push_back(Expr.Op);
+			}
+
+			Combo.reset();
+			if (vE.size() > 1) {
+				Combo = makePooled<XAieComboEvent>(AieHd, Loc,
+					M, vE.size());
+				RC = Combo->setEvents(vE, vOp);
+				if (RC != XAIE_OK) {
+					Combo.reset();
+					return RC;
+				}
+			} else {
+				uint8_t HwEvent;
+
+				RC = XAie_EventLogicalToPhysicalConv(dev(), Loc, M,
+						vE[0], &HwEvent);
+				if (RC != XAIE_OK) {
+					XAIEFAL_LOG(ERROR) << "trace filter " << __func__ << " (" <<
+						static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
+						") Mod=" << M << " invalid E=" << vE[0] << '\n';
+					return XAIE_INVALID_ARGS;
+				}
+				Event = vE[0];
+			}
+			vGroups = vG;
+			EventMod = M;
+			State.Configured = 1;
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the event traced by the filter.
+		 *
+		 * @param M returns the module of the event
+		 * @param E returns the event
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC getEvent(XAie_ModuleType &M, XAie_Events &E) const {
+			if (State.Reserved == 0) {
+				XAIEFAL_LOG(ERROR) << "trace filter " << __func__ << " (" <<
+					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
+					") Mod=" << Mod << " resource not reserved." << '\n';
+				return XAIE_ERR;
+			}
+			M = EventMod;
+			E = Event;
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the hardware resources used by the
+		 * filter.
+		 *
+		 * @param TraceSlots returns the number of trace slots
+		 * @param ComboEvents returns the number of combo event inputs
+		 * @param GroupEvents returns the number of group events
+		 */
+		void getRscUsage(uint32_t &TraceSlots, uint32_t &ComboEvents,
+				uint32_t &GroupEvents) const {
+			std::vector<XAie_UserRsc> vRscs;
+
+			TraceSlots = 0;
+			ComboEvents = 0;
+			if (State.Reserved == 1) {
+				TraceSlots = 1;
+				if (Combo) {
+					Combo->getRscs(vRscs);
+					ComboEvents = vRscs.size();
+				}
+			}
+			GroupEvents = vGroups.size();
+		}
+		uint32_t getRscType() const {
+			return static_cast<uint32_t>(XAIE_TRACE_EVENTS_RSC);
+		}
+	protected:
+		std::shared_ptr<XAieTraceCntr> TraceCntr; /**< trace control */
+		std::shared_ptr<XAieTraceEvent> TraceE; /**< traced event */
+		std::shared_ptr<XAieComboEvent> Combo; /**< combo events */
+		std::vector<std::shared_ptr<XAieGroupEventHandle>> vGroups; /**< group events */
+		XAie_ModuleType EventMod; /**< module of the events */
+		XAie_Events Event; /**< event to trace */
+	private:
+		void _addLeaf(const XAieTraceFilterExpr &X,
+				std::vector<XAie_Events> &vE,
+				std::vector<std::shared_ptr<XAieGroupEventHandle>> &vG) {
+			vE.push_back(X.Event);
+			if (X.Group) {
+				X.Group->setGroupEvents(X.GroupMask);
+				vG.push_back(X.Group);
+			}
+		}
+		AieRC _addPair(const XAieTraceFilterExpr &X,
+				std::vector<XAie_Events> &vE,
+				std::vector<XAie_EventComboOps> &vOp,
+				std::vector<std::shared_ptr<XAieGroupEventHandle>> &vG) {
+			if (X.isLeaf()) {
+				// A leaf takes both inputs of a combo: E OR E
+				_addLeaf(X, vE, vG);
+				vE.push_back(X.Event);
+				vOp.push_back(XAIE_EVENT_COMBO_E1_OR_E2);
+			} else if (X.Left->isLeaf() && X.Right->isLeaf()) {
+				_addLeaf(*X.Left, vE, vG);
+				_addLeaf(*X.Right, vE, vG);
+				vOp.push_back(X.Op);
+			} else {
+				return XAIE_INVALID_ARGS;
+			}
+			return XAIE_OK;
+		}
+		AieRC _reserve() {
+			AieRC RC = XAIE_OK;
+			uint32_t NumGroups = 0;
+
+			for (auto &G: vGroups) {
+				RC = G->reserve();
+				if (RC != XAIE_OK) {
+					break;
+				}
+				NumGroups++;
+			}
+			if (RC == XAIE_OK && Combo) {
+				RC = Combo->reserve();
+				if (RC == XAIE_OK) {
+					std::vector<XAie_Events> vE;
+
+					Combo->getEvents(vE);
+					Event = vE.back();
+				}
+			}
+			if (RC == XAIE_OK) {
+				TraceE = makePooled<XAieTraceEvent>(AieHd,
+					Loc, Mod, TraceCntr);
+				RC = TraceE->setEvent(EventMod, Event);
+				if (RC == XAIE_OK) {
+					RC = TraceE->reserve();
+				}
+				if (RC != XAIE_OK) {
+					TraceE.reset();
+					if (Combo) {
+						Combo->release();
+					}
+				}
+			}
+			if (RC != XAIE_OK) {
+				XAIEFAL_LOG(WARN) << "trace filter " << __func__ << " (" <<
+					static_cast<uint32_t>(Loc.Col) << "," << static_cast<uint32_t>(Loc.Row) <<
+					") Mod=" << Mod << " not enough resources." << '\n';
+				for (uint32_t i = 0; i < NumGroups; i++) {
+					vGroups[i]->release();
+				}
+			} else {
+				XAie_LocType L;
+				XAie_ModuleType M;
+				uint32_t I;
+
+				TraceE->getRscId(L, M, I);
+				Rsc.Mod = M;
+				Rsc.RscId = I;
+			}
+			return RC;
+		}
+		AieRC _release() {
+			TraceE->release();
+			TraceE.reset();
+			if (Combo) {
+				Combo->release();
+			}
+			for (auto &G: vGroups) {
+				G->release();
+			}
+			return XAIE_OK;
+		}
+		AieRC _start() {
+			AieRC RC = XAIE_OK;
+
+			for (auto &G: vGroups) {
+				RC = G->start();
+				if (RC != XAIE_OK) {
+					return RC;
+				}
+			}
+			if (Combo) {
+				RC = Combo->start();
+			}
+			if (RC == XAIE_OK) {
+				RC = TraceE->start();
+			}
+			return RC;
+		}
+		AieRC _stop() {
+			TraceE->stop();
+			if (Combo) {
+				Combo->stop();
+			}
+			for (auto &G: vGroups) {
+				G->stop();
+			}
+			return XAIE_OK;
+		}
+		void _getRscs(std::vector<XAie_UserRsc> &vRscs) const {
+			TraceE->getRscs(vRscs);
+			if (Combo) {
+				Combo->getRscs(vRscs);
+			}
+		}
+	};
+}
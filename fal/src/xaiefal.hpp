@@ -7,15 +7,28 @@
 #include <xaiengine.h>
 #include <xaiefal/common/xaiefal-base.hpp>
 #include <xaiefal/common/xaiefal-common.hpp>
+#include <xaiefal/common/xaiefal-await.hpp>
 #include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/common/xaiefal-txn.hpp>
+#include <xaiefal/profile/xaiefal-graph-profile.hpp>
+#include <xaiefal/profile/xaiefal-func-profile.hpp>
+#include <xaiefal/profile/xaiefal-lock-profile.hpp>
+#include <xaiefal/profile/xaiefal-perf-collector.hpp>
+#include <xaiefal/profile/xaiefal-perf-mux.hpp>
 #include <xaiefal/profile/xaiefal-profile.hpp>
+#include <xaiefal/profile/xaiefal-sampler.hpp>
+#include <xaiefal/profile/xaiefal-trace-marker.hpp>
 #include <xaiefal/rsc/xaiefal-bc.hpp>
 #include <xaiefal/rsc/xaiefal-events.hpp>
 #include <xaiefal/rsc/xaiefal-groupevent.hpp>
 #include <xaiefal/rsc/xaiefal-pc.hpp>
 #include <xaiefal/rsc/xaiefal-perf.hpp>
+#include <xaiefal/rsc/xaiefal-perf-static.hpp>
+#include <xaiefal/rsc/xaiefal-rsc-batch.hpp>
 #include <xaiefal/rsc/xaiefal-rsc-group.hpp>
 #include <xaiefal/rsc/xaiefal-rsc-group-impl.hpp>
 #include <xaiefal/rsc/xaiefal-ss.hpp>
+#include <xaiefal/rsc/xaiefal-trace-planner.hpp>
 #include <xaiefal/rsc/xaiefal-trace.hpp>
+#include <xaiefal/rsc/xaiefal-tracefilter.hpp>
 
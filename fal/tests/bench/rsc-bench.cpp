@@ -0,0 +1,290 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * Benchmarks of the FAL resource management.
+ *
+ * For perf counters, broadcast channels, tracings and group events, it
+ * times the create, reserve, start, stop, release and destroy of 1, 10, 100
+ * and as many resources as the partition holds, and the resource statistics
+ * queries of the device, a tile and a module while they are reserved.
+ * Resources are spread round robin over the AIE tile modules, or the columns
+ * for broadcast channels, so that the cost per resource shows how the
+ * resource manager and the FAL containers scale.
+ *
+ * Every result is printed as one JSON object per line to stdout, or to the
+ * file given as the first argument, which keeps them apart from the register
+ * accesses printed by the debug backend.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "xaiefal/xaiefal.hpp"
+
+#include "common/tc_config.h"
+
+using namespace xaiefal;
+
+#define BENCH_NUM_QUERIES	100U
+#define BENCH_BC_NUM_TILES	3U
+
+/**
+ * This structure describes a kind of resource to benchmark.
+ */
+struct BenchRscKind {
+	const char *Name;
+	uint32_t NumSlots;	/**< tile modules or columns used */
+	uint32_t MaxPerSlot;	/**< bound of the full partition search */
+	std::function<std::shared_ptr<XAieRsc>(XAieDev &, uint32_t)> Create;
+};
+
+static FILE *Out = stdout;
+static std::vector<std::pair<XAie_LocType, XAie_ModuleType>> Slots;
+
+static uint64_t benchNow()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void benchReport(const char *Rsc, const std::string &Scale,
+		size_t Objs, const char *Op, uint64_t Ns, uint32_t Errors)
+{
+	fprintf(Out, "{\"rsc\": \"%s\", \"scale\": \"%s\", \"objs\": %zu, "
+		"\"op\": \"%s\", \"ns\": %llu, \"ns_per_op\": %.1f, "
+		"\"errors\": %u}\n", Rsc, Scale.c_str(), Objs, Op,
+		(unsigned long long)Ns,
+		(Objs != 0) ? (double)Ns / (double)Objs : 0.0, Errors);
+	fflush(Out);
+}
+
+/**
+ * This function times one operation on every resource.
+ */
+static void benchOp(const BenchRscKind &K, const std::string &Scale,
+		std::vector<std::shared_ptr<XAieRsc>> &vRscs, const char *Op,
+		const std::function<AieRC(XAieRsc &)> &Func)
+{
+	uint32_t Errors = 0;
+	uint64_t Start = benchNow();
+
+	for (auto &R : vRscs) {
+		if (Func(*R) != XAIE_OK) {
+			Errors++;
+		}
+	}
+	benchReport(K.Name, Scale, vRscs.size(), Op, benchNow() - Start,
+			Errors);
+}
+
+/**
+ * This function times the resource statistics queries while the resources
+ * are reserved.
+ */
+static void benchRscStat(XAieDev &Aie, const BenchRscKind &K,
+		const std::string &Scale)
+{
+	XAie_LocType Loc = Slots[0].first;
+	XAie_ModuleType Mod = Slots[0].second;
+	uint32_t NumRsc = 0;
+	uint64_t Start;
+
+	Start = benchNow();
+	for (uint32_t i = 0; i < BENCH_NUM_QUERIES; i++) {
+		auto Stat = Aie.getRscStat(XAIEDEV_DEFAULT_GROUP_GENERIC);
+		NumRsc += Stat.getNumRsc(Loc, Mod, XAIE_PERFCNT_RSC);
+	}
+	benchReport(K.Name, Scale, BENCH_NUM_QUERIES, "rsc_stat_dev",
+			benchNow() - Start, 0);
+
+	Start = benchNow();
+	for (uint32_t i = 0; i < BENCH_NUM_QUERIES; i++) {
+		auto Stat = Aie.tile(Loc).getRscStat(
+				XAIEDEV_DEFAULT_GROUP_GENERIC);
+		NumRsc += Stat.getNumRsc(Loc, Mod, XAIE_PERFCNT_RSC);
+	}
+	benchReport(K.Name, Scale, BENCH_NUM_QUERIES, "rsc_stat_tile",
+			benchNow() - Start, 0);
+
+	Start = benchNow();
+	for (uint32_t i = 0; i < BENCH_NUM_QUERIES; i++) {
+		auto Stat = Aie.tile(Loc).module(Mod).getRscStat(
+				XAIEDEV_DEFAULT_GROUP_GENERIC);
+		NumRsc += Stat.getNumRsc(Loc, Mod, XAIE_PERFCNT_RSC);
+	}
+	benchReport(K.Name, Scale, BENCH_NUM_QUERIES, "rsc_stat_mod",
+			benchNow() - Start, 0);
+	(void)NumRsc;
+}
+
+/**
+ * This function returns the indexes of the resources of a kind which fill
+ * the partition, by reserving them until the search bound. As the modules
+ * hold different numbers of resources, the indexes are not contiguous.
+ */
+static std::vector<uint32_t> benchFullScale(XAieDev &Aie,
+		const BenchRscKind &K)
+{
+	std::vector<std::shared_ptr<XAieRsc>> vRscs;
+	std::vector<uint32_t> vIdx;
+
+	for (uint32_t i = 0; i < K.NumSlots * K.MaxPerSlot; i++) {
+		auto R = K.Create(Aie, i);
+
+		if (R->reserve() == XAIE_OK) {
+			vIdx.push_back(i);
+		}
+		vRscs.push_back(R);
+	}
+	for (auto &R : vRscs) {
+		R->release();
+	}
+
+	return vIdx;
+}
+
+static void benchScale(XAieDev &Aie, const BenchRscKind &K,
+		const std::vector<uint32_t> &vIdx, const std::string &Scale)
+{
+	std::vector<std::shared_ptr<XAieRsc>> vRscs;
+	uint64_t Start;
+
+	vRscs.reserve(vIdx.size());
+	Start = benchNow();
+	for (auto i : vIdx) {
+		vRscs.push_back(K.Create(Aie, i));
+	}
+	benchReport(K.Name, Scale, vRscs.size(), "create", benchNow() - Start,
+			0);
+
+	benchOp(K, Scale, vRscs, "reserve",
+			[](XAieRsc &R) { return R.reserve(); });
+	benchRscStat(Aie, K, Scale);
+	benchOp(K, Scale, vRscs, "start",
+			[](XAieRsc &R) { return R.start(); });
+	benchOp(K, Scale, vRscs, "stop",
+			[](XAieRsc &R) { return R.stop(); });
+	benchOp(K, Scale, vRscs, "release",
+			[](XAieRsc &R) { return R.release(); });
+
+	Start = benchNow();
+	vRscs.clear();
+	benchReport(K.Name, Scale, vIdx.size(), "destroy", benchNow() - Start,
+			0);
+}
+
+int main(int argc, char *argv[])
+{
+	AieRC RC;
+
+	if (argc > 1) {
+		Out = fopen(argv[1], "w");
+		if (Out == NULL) {
+			perror("Failed to open the output file");
+			return -1;
+		}
+	}
+
+	XAie_SetupConfig(ConfigPtr, HW_GEN, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&(DevInst), &ConfigPtr);
+	if (RC != XAIE_OK) {
+		fprintf(stderr, "Driver initialization failed.\n");
+		return -1;
+	}
+
+	XAieDev Aie(&DevInst, true);
+
+	for (uint8_t c = 0; c < XAIE_NUM_COLS; c++) {
+		for (uint8_t r = XAIE_AIE_TILE_ROW_START;
+				r < XAIE_AIE_TILE_ROW_START + XAIE_AIE_TILE_NUM_ROWS;
+				r++) {
+			Slots.push_back({XAie_TileLoc(c, r), XAIE_CORE_MOD});
+			Slots.push_back({XAie_TileLoc(c, r), XAIE_MEM_MOD});
+		}
+	}
+	uint32_t NumSlots = Slots.size();
+
+	std::vector<BenchRscKind> Kinds = {
+		{"perf_counter", NumSlots, 4,
+		[](XAieDev &Dev, uint32_t i) -> std::shared_ptr<XAieRsc> {
+			auto &S = Slots[i % Slots.size()];
+			auto PC = Dev.tile(S.first).module(S.second).perfCounter();
+
+			if (S.second == XAIE_CORE_MOD) {
+				PC->initialize(XAIE_CORE_MOD, XAIE_EVENT_TRUE_CORE,
+					XAIE_CORE_MOD, XAIE_EVENT_NONE_CORE);
+			} else {
+				PC->initialize(XAIE_MEM_MOD, XAIE_EVENT_TRUE_MEM,
+					XAIE_MEM_MOD, XAIE_EVENT_NONE_MEM);
+			}
+			return PC;
+		}},
+		{"broadcast", XAIE_NUM_COLS, 16,
+		[](XAieDev &Dev, uint32_t i) -> std::shared_ptr<XAieRsc> {
+			std::vector<XAie_LocType> vL;
+			uint8_t Col = i % XAIE_NUM_COLS;
+
+			for (uint8_t r = 0; r < BENCH_BC_NUM_TILES; r++) {
+				vL.push_back(XAie_TileLoc(Col,
+					XAIE_AIE_TILE_ROW_START + r));
+			}
+			return Dev.broadcast(vL, XAIE_CORE_MOD, XAIE_CORE_MOD);
+		}},
+		{"tracing", NumSlots, 1,
+		[](XAieDev &Dev, uint32_t i) -> std::shared_ptr<XAieRsc> {
+			auto &S = Slots[i % Slots.size()];
+			auto T = std::make_shared<XAieTracing>(Dev, S.first,
+					S.second);
+
+			if (S.second == XAIE_CORE_MOD) {
+				T->setCntrEvent(XAIE_EVENT_TRUE_CORE,
+					XAIE_EVENT_NONE_CORE);
+				T->addEvent(XAIE_CORE_MOD, XAIE_EVENT_TRUE_CORE);
+			} else {
+				T->setCntrEvent(XAIE_EVENT_TRUE_MEM,
+					XAIE_EVENT_NONE_MEM);
+				T->addEvent(XAIE_MEM_MOD, XAIE_EVENT_TRUE_MEM);
+			}
+			return T;
+		}},
+		{"group_event", NumSlots, 1,
+		[](XAieDev &Dev, uint32_t i) -> std::shared_ptr<XAieRsc> {
+			auto &S = Slots[i % Slots.size()];
+
+			return Dev.tile(S.first).module(S.second).groupEvent(
+					(S.second == XAIE_CORE_MOD) ?
+					XAIE_EVENT_GROUP_CORE_PROGRAM_FLOW_CORE :
+					XAIE_EVENT_GROUP_DMA_ACTIVITY_MEM);
+		}},
+	};
+
+	for (auto &K : Kinds) {
+		for (uint32_t Num : {1U, 10U, 100U}) {
+			std::vector<uint32_t> vIdx;
+
+			for (uint32_t i = 0; i < Num; i++) {
+				vIdx.push_back(i);
+			}
+			benchScale(Aie, K, vIdx, std::to_string(Num));
+		}
+		benchScale(Aie, K, benchFullScale(Aie, K), "full");
+	}
+
+	if (Out != stdout) {
+		fclose(Out);
+	}
+
+	return 0;
+}
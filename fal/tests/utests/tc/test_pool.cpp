@@ -0,0 +1,86 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "xaiefal/xaiefal.hpp"
+
+#include "CppUTest/CommandLineTestRunner.h"
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestRegistry.h"
+
+#include "common/tc_config.h"
+
+using namespace xaiefal;
+
+struct XAiePoolTester {
+	XAiePoolTester(uint64_t V): Val(V) {}
+	uint64_t Val;
+};
+
+TEST_GROUP(Pool)
+{
+};
+
+TEST(Pool, PoolReuse)
+{
+	auto P0 = makePooled<XAiePoolTester>(1);
+	auto P1 = makePooled<XAiePoolTester>(2);
+	CHECK(P0.get() != P1.get());
+	CHECK_EQUAL(P0->Val, 1);
+	CHECK_EQUAL(P1->Val, 2);
+
+	/* the last block released is the first one reused */
+	XAiePoolTester *Addr = P1.get();
+	P1.reset();
+	auto P2 = makePooled<XAiePoolTester>(3);
+	CHECK(P2.get() == Addr);
+	CHECK_EQUAL(P2->Val, 3);
+
+	/* a block still in use is not handed out again */
+	auto P3 = makePooled<XAiePoolTester>(4);
+	CHECK(P3.get() != P0.get());
+	CHECK(P3.get() != P2.get());
+	CHECK_EQUAL(P0->Val, 1);
+}
+
+TEST(Pool, PoolRscReuse)
+{
+	AieRC RC;
+
+	XAie_SetupConfig(ConfigPtr, HW_GEN, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&(DevInst), &ConfigPtr);
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	XAieDev Aie(&DevInst, true);
+
+	auto PCounter = Aie.tile(1,3).core().perfCounter();
+	RC = PCounter->initialize(XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+			XAIE_CORE_MOD, XAIE_EVENT_DISABLED_CORE);
+	CHECK_EQUAL(RC, XAIE_OK);
+	RC = PCounter->reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	/* freeing the counter releases it and gives it back to the pool */
+	XAiePerfCounter *Addr = PCounter.get();
+	PCounter.reset();
+	auto PCounter1 = Aie.tile(1,4).core().perfCounter();
+	CHECK(PCounter1.get() == Addr);
+	CHECK_EQUAL(PCounter1->isReserved(), false);
+	CHECK(PCounter1->loc().Col == 1 && PCounter1->loc().Row == 4);
+
+	bool hasRsc = Aie.tile(1,3).core().perfCounter()->
+		getRscStat(XAIEDEV_DEFAULT_GROUP_GENERIC).hasRsc();
+	CHECK_EQUAL(hasRsc, false);
+
+	RC = PCounter1->initialize(XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+			XAIE_CORE_MOD, XAIE_EVENT_DISABLED_CORE);
+	CHECK_EQUAL(RC, XAIE_OK);
+	RC = PCounter1->reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+}
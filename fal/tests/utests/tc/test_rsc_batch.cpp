@@ -0,0 +1,145 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "xaiefal/xaiefal.hpp"
+
+#include "CppUTest/CommandLineTestRunner.h"
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestRegistry.h"
+
+#include "common/tc_config.h"
+
+using namespace xaiefal;
+
+TEST_GROUP(RscBatch)
+{
+};
+
+TEST(RscBatch, RscBatchBasic)
+{
+	AieRC RC;
+
+	XAie_SetupConfig(ConfigPtr, HW_GEN, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&(DevInst), &ConfigPtr);
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	XAieDev Aie(&DevInst, true);
+	XAieRscBatch Batch(Aie);
+
+	auto PCounter0 = Aie.tile(1,3).core().perfCounter();
+	RC = PCounter0->initialize(XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+			XAIE_CORE_MOD, XAIE_EVENT_DISABLED_CORE);
+	CHECK_EQUAL(RC, XAIE_OK);
+	auto PCounter1 = Aie.tile(1,4).core().perfCounter();
+	RC = PCounter1->initialize(XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+			XAIE_CORE_MOD, XAIE_EVENT_DISABLED_CORE);
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	RC = Batch.add(PCounter0);
+	CHECK_EQUAL(RC, XAIE_OK);
+	RC = Batch.add(PCounter1);
+	CHECK_EQUAL(RC, XAIE_OK);
+	RC = Batch.add(nullptr);
+	CHECK_EQUAL(RC, XAIE_INVALID_ARGS);
+	CHECK_EQUAL(Batch.size(), 2);
+
+	/* start is refused until the resources are reserved */
+	RC = Batch.start();
+	CHECK_EQUAL(RC, XAIE_ERR);
+
+	RC = Batch.reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(PCounter0->isReserved(), true);
+	CHECK_EQUAL(PCounter1->isReserved(), true);
+
+	RC = Batch.start();
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(PCounter0->isRunning(), true);
+	CHECK_EQUAL(PCounter1->isRunning(), true);
+
+	RC = Batch.stop();
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(PCounter0->isRunning(), false);
+	CHECK_EQUAL(PCounter1->isRunning(), false);
+
+	RC = Batch.release();
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(PCounter0->isReserved(), false);
+	CHECK_EQUAL(PCounter1->isReserved(), false);
+}
+
+TEST(RscBatch, RscBatchReserveRollback)
+{
+	AieRC RC;
+	std::vector<std::shared_ptr<XAiePerfCounter>> vPCounters;
+
+	XAie_SetupConfig(ConfigPtr, HW_GEN, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&(DevInst), &ConfigPtr);
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	XAieDev Aie(&DevInst, true);
+	XAieRscBatch Batch(Aie);
+
+	uint32_t NumAvail = Aie.tile(1,3).core().getRscStat(XAIEDEV_DEFAULT_GROUP_AVAIL).
+		getNumRsc(XAie_TileLoc(1,3), XAIE_CORE_MOD, XAIE_PERFCNT_RSC);
+	CHECK(NumAvail > 1);
+
+	/*
+	 * One more counter than the tile has, the first one is reserved
+	 * before the batch.
+	 */
+	for (uint32_t i = 0; i <= NumAvail; i++) {
+		auto PCounter = Aie.tile(1,3).core().perfCounter();
+
+		RC = PCounter->initialize(XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+				XAIE_CORE_MOD, XAIE_EVENT_DISABLED_CORE);
+		CHECK_EQUAL(RC, XAIE_OK);
+		RC = Batch.add(PCounter);
+		CHECK_EQUAL(RC, XAIE_OK);
+		vPCounters.push_back(PCounter);
+	}
+	RC = vPCounters[0]->reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	RC = Batch.reserve();
+	CHECK(RC != XAIE_OK);
+	/* the counter reserved before the batch is kept */
+	CHECK_EQUAL(vPCounters[0]->isReserved(), true);
+	for (uint32_t i = 1; i < vPCounters.size(); i++) {
+		CHECK_EQUAL(vPCounters[i]->isReserved(), false);
+	}
+	uint32_t NumLeft = Aie.tile(1,3).core().getRscStat(XAIEDEV_DEFAULT_GROUP_AVAIL).
+		getNumRsc(XAie_TileLoc(1,3), XAIE_CORE_MOD, XAIE_PERFCNT_RSC);
+	CHECK_EQUAL(NumLeft, NumAvail - 1);
+
+	/* once the tile has room again, the whole batch is reserved */
+	RC = vPCounters[0]->release();
+	CHECK_EQUAL(RC, XAIE_OK);
+	vPCounters.pop_back();
+	XAieRscBatch Batch1(Aie);
+	for (auto &PCounter: vPCounters) {
+		RC = Batch1.add(PCounter);
+		CHECK_EQUAL(RC, XAIE_OK);
+	}
+	RC = Batch1.reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+	for (auto &PCounter: vPCounters) {
+		CHECK_EQUAL(PCounter->isReserved(), true);
+	}
+	RC = Batch1.release();
+	CHECK_EQUAL(RC, XAIE_OK);
+}
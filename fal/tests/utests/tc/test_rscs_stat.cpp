@@ -279,3 +279,167 @@ TEST(RSC, RscDefaultGroups) {
 	Aie.tile(1,1).mem().getRscStat(XAIEDEV_DEFAULT_GROUP_STATIC).show();
 	Aie.tile(1,1).core().perfCounter()->getRscStat(XAIEDEV_DEFAULT_GROUP_STATIC).show();
 }
+
+TEST(RSC, RscStatKeys) {
+	XAieRscStat RscStat("Keys");
+	const uint32_t Mod = static_cast<uint32_t>(XAIE_CORE_MOD);
+	const uint32_t RType = static_cast<uint32_t>(XAIE_PERFCNT_RSC);
+
+	CHECK_EQUAL(RscStat.hasRsc(), false);
+
+	/* keys added out of order, one of them twice */
+	RscStat.addRscStat(XAie_TileLoc(3,1), Mod, RType, 1);
+	RscStat.addRscStat(XAie_TileLoc(1,2), Mod, RType, 2);
+	RscStat.addRscStat(XAie_TileLoc(2,1), Mod, RType, 3);
+	RscStat.addRscStat(XAie_TileLoc(1,2), Mod, RType, 1);
+	RscStat.addRscStat(XAie_TileLoc(1,2), Mod,
+			static_cast<uint32_t>(XAIE_USER_EVENTS_RSC), 4);
+
+	CHECK_EQUAL(RscStat.hasRsc(), true);
+	CHECK_EQUAL(RscStat.getNumRsc(XAie_TileLoc(1,2), Mod, RType), 3);
+	CHECK_EQUAL(RscStat.getNumRsc(XAie_TileLoc(2,1), Mod, RType), 3);
+	CHECK_EQUAL(RscStat.getNumRsc(XAie_TileLoc(3,1), Mod, RType), 1);
+	CHECK_EQUAL(RscStat.getNumRsc(XAie_TileLoc(1,2), Mod,
+			static_cast<uint32_t>(XAIE_USER_EVENTS_RSC)), 4);
+	CHECK_EQUAL(RscStat.getNumRsc(XAie_TileLoc(1,2),
+			static_cast<uint32_t>(XAIE_MEM_MOD), RType), 0);
+	CHECK_EQUAL(RscStat.getNumRsc(XAie_TileLoc(4,1), Mod, RType), 0);
+	RscStat.show();
+}
+
+TEST(RSC, RscGroupLookup) {
+	AieRC RC;
+	std::vector<std::shared_ptr<XAieUserEvent>> vUEvents;
+
+	XAie_SetupConfig(ConfigPtr, HW_GEN, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&(DevInst), &ConfigPtr);
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	XAieDev Aie(&DevInst, true);
+	XAie_LocType Loc = XAie_TileLoc(1, XAIE_AIE_TILE_ROW_START);
+
+	/* a group name always returns the same group */
+	auto RGroup0 = Aie.getRscGroup("Custom0");
+	auto RGroup1 = Aie.getRscGroup("Custom1");
+	auto UserEvent = Aie.tile(Loc.Col, Loc.Row).core().userEvent(RGroup0);
+	RC = UserEvent->reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+	uint32_t NumRsc = Aie.getRscGroup("Custom0").getRscStat(Loc).
+		getNumRsc(Loc, XAIE_CORE_MOD, XAIE_USER_EVENTS_RSC);
+	CHECK_EQUAL(NumRsc, 1);
+	CHECK_EQUAL(RGroup1.getRscStat().hasRsc(), false);
+
+	/*
+	 * Add many short lived resources to the group, so that its expired
+	 * references are compacted, while some of them stay reserved.
+	 */
+	for (uint32_t i = 0; i < 256; i++) {
+		XAie_LocType L = XAie_TileLoc(1 + i % 16, XAIE_AIE_TILE_ROW_START);
+		auto UE = Aie.tile(L.Col, L.Row).core().userEvent(RGroup0);
+
+		if (i % 67 == 0) {
+			RC = UE->reserve();
+			CHECK_EQUAL(RC, XAIE_OK);
+			vUEvents.push_back(UE);
+		}
+	}
+	NumRsc = RGroup0.getRscStat(Loc).getNumRsc(Loc, XAIE_CORE_MOD,
+			XAIE_USER_EVENTS_RSC);
+	CHECK_EQUAL(NumRsc, 2);
+	CHECK_EQUAL(vUEvents.size(), 4);
+	auto RscStat = RGroup0.getRscStat();
+	CHECK_EQUAL(RscStat.getNumRsc(XAie_TileLoc(4, XAIE_AIE_TILE_ROW_START),
+			XAIE_CORE_MOD, XAIE_USER_EVENTS_RSC), 1);
+	CHECK_EQUAL(RscStat.getNumRsc(XAie_TileLoc(2, XAIE_AIE_TILE_ROW_START),
+			XAIE_CORE_MOD, XAIE_USER_EVENTS_RSC), 0);
+	CHECK_EQUAL(RGroup1.getRscStat().hasRsc(), false);
+
+	vUEvents.clear();
+	UserEvent.reset();
+	CHECK_EQUAL(RGroup0.getRscStat().hasRsc(), false);
+}
+
+TEST(RSC, RscGroupRuntimeCount) {
+	AieRC RC;
+	std::vector<XAie_LocType> vL;
+
+	XAie_SetupConfig(ConfigPtr, HW_GEN, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&(DevInst), &ConfigPtr);
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	XAieDev Aie(&DevInst, true);
+	XAie_LocType Loc = XAie_TileLoc(1, XAIE_AIE_TILE_ROW_START);
+	auto RGroup = Aie.getRscGroup("Counted");
+	auto &Generic = Aie.getRscGroup(XAIEDEV_DEFAULT_GROUP_GENERIC);
+
+	auto PCounter = Aie.tile(Loc.Col, Loc.Row).core().perfCounter(RGroup);
+	RC = PCounter->initialize(XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+			XAIE_CORE_MOD, XAIE_EVENT_DISABLED_CORE);
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(RGroup.getRscStat(Loc).getNumRsc(Loc, XAIE_CORE_MOD,
+			XAIE_PERFCNT_RSC), 0);
+
+	/* reserve and release count up and down */
+	RC = PCounter->reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(RGroup.getRscStat(Loc).getNumRsc(Loc, XAIE_CORE_MOD,
+			XAIE_PERFCNT_RSC), 1);
+	RC = PCounter->release();
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(RGroup.getRscStat(Loc).getNumRsc(Loc, XAIE_CORE_MOD,
+			XAIE_PERFCNT_RSC), 0);
+	RC = PCounter->reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(RGroup.getRscStat(Loc).getNumRsc(Loc, XAIE_CORE_MOD,
+			XAIE_PERFCNT_RSC), 1);
+
+	/* adding a reserved resource to a group counts it right away */
+	CHECK_EQUAL(Generic.getRscStat(Loc).getNumRsc(Loc, XAIE_CORE_MOD,
+			XAIE_PERFCNT_RSC), 0);
+	RC = Generic.addRsc(PCounter);
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(Generic.getRscStat(Loc).getNumRsc(Loc, XAIE_CORE_MOD,
+			XAIE_PERFCNT_RSC), 1);
+	/* adding it again does not count it twice */
+	RC = Generic.addRsc(PCounter);
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(Generic.getRscStat(Loc).getNumRsc(Loc, XAIE_CORE_MOD,
+			XAIE_PERFCNT_RSC), 1);
+
+	/* a resource over several tiles is counted on each of them */
+	vL.push_back(XAie_TileLoc(1,0));
+	vL.push_back(XAie_TileLoc(2,0));
+	auto BC = Aie.broadcast(vL, XAIE_PL_MOD, XAIE_PL_MOD);
+	RC = RGroup.addRsc(BC);
+	CHECK_EQUAL(RC, XAIE_OK);
+	RC = BC->reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+	auto RscStat = RGroup.getRscStat(vL, XAIE_BCAST_CHANNEL_RSC);
+	CHECK_EQUAL(RscStat.getNumRsc(XAie_TileLoc(1,0), XAIE_PL_MOD,
+			XAIE_BCAST_CHANNEL_RSC), 1);
+	CHECK_EQUAL(RscStat.getNumRsc(XAie_TileLoc(2,0), XAIE_PL_MOD,
+			XAIE_BCAST_CHANNEL_RSC), 1);
+	RC = BC->release();
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(RGroup.getRscStat(vL, XAIE_BCAST_CHANNEL_RSC).hasRsc(),
+			false);
+
+	/* freeing a reserved resource takes it out of all its groups */
+	PCounter.reset();
+	CHECK_EQUAL(RGroup.getRscStat(Loc).hasRsc(), false);
+	CHECK_EQUAL(Generic.getRscStat(Loc).hasRsc(), false);
+}
@@ -0,0 +1,171 @@
+// Copyright(C) 2022 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <stdexcept>
+
+#include "xaiefal/xaiefal.hpp"
+
+#include "CppUTest/CommandLineTestRunner.h"
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestRegistry.h"
+
+#include "common/tc_config.h"
+
+using namespace xaiefal;
+
+#define TXN_TEST_REG_OFF 0x32000U
+
+TEST_GROUP(Txn)
+{
+};
+
+TEST(Txn, TxnScope)
+{
+	AieRC RC;
+
+	XAie_SetupConfig(ConfigPtr, HW_GEN, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&(DevInst), &ConfigPtr);
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	XAieDev Aie(&DevInst, true);
+
+	{
+		XAieTxn Txn(Aie);
+		CHECK_EQUAL(Txn.isOpen(), true);
+		CHECK_EQUAL(Txn.isJoined(), false);
+		CHECK_EQUAL(_XAie_TxnIsActive(&DevInst), XAIE_ENABLE);
+
+		/* an inner scope joins the open transaction */
+		{
+			XAieTxn Inner(Aie);
+			CHECK_EQUAL(Inner.isOpen(), false);
+			CHECK_EQUAL(Inner.isJoined(), true);
+			CHECK_EQUAL(Inner.cancel(), XAIE_ERR);
+		}
+		CHECK_EQUAL(_XAie_TxnIsActive(&DevInst), XAIE_ENABLE);
+
+		RC = Txn.submit();
+		CHECK_EQUAL(RC, XAIE_OK);
+		CHECK_EQUAL(Txn.isOpen(), false);
+		CHECK_EQUAL(_XAie_TxnIsActive(&DevInst), XAIE_DISABLE);
+		RC = Txn.submit();
+		CHECK_EQUAL(RC, XAIE_ERR);
+	}
+
+	/* the scope can be moved, only the last owner closes it */
+	{
+		XAieTxn Txn(Aie);
+		XAieTxn Moved(std::move(Txn));
+		CHECK_EQUAL(Txn.isOpen(), false);
+		CHECK_EQUAL(Moved.isOpen(), true);
+		RC = Moved.cancel();
+		CHECK_EQUAL(RC, XAIE_OK);
+		CHECK_EQUAL(_XAie_TxnIsActive(&DevInst), XAIE_DISABLE);
+	}
+}
+
+TEST(Txn, TxnScopeExit)
+{
+	AieRC RC;
+	bool Thrown = false;
+
+	XAie_SetupConfig(ConfigPtr, HW_GEN, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&(DevInst), &ConfigPtr);
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	XAieDev Aie(&DevInst, true);
+	XAie_LocType Loc = XAie_TileLoc(1, XAIE_AIE_TILE_ROW_START);
+	u64 RegOff = ((u64)Loc.Col << XAIE_COL_SHIFT) |
+		((u64)Loc.Row << XAIE_ROW_SHIFT) | TXN_TEST_REG_OFF;
+
+#ifndef TEST_HARDWARE
+	XAie_IORecord Records[16];
+	XAie_IORecordRing Ring = {Records, 16, 0};
+
+	RC = XAie_ConfigIORecord(&DevInst, &Ring);
+	CHECK_EQUAL(RC, XAIE_OK);
+#endif
+
+	/* the writes are queued and submitted when the scope exits */
+	{
+		XAieTxn Txn(Aie, 0);
+
+		RC = XAie_Write32(&DevInst, RegOff, 0x1U);
+		CHECK_EQUAL(RC, XAIE_OK);
+#ifndef TEST_HARDWARE
+		CHECK_EQUAL(Ring.NumWritten, 0);
+#endif
+	}
+	CHECK_EQUAL(_XAie_TxnIsActive(&DevInst), XAIE_DISABLE);
+#ifndef TEST_HARDWARE
+	CHECK_EQUAL(Ring.NumWritten, 1);
+	CHECK_EQUAL(Records[0].Op, XAIE_IO_RECORD_WRITE);
+	CHECK_EQUAL(Records[0].Value, 0x1U);
+#endif
+
+	/* the writes are dropped when the scope is left by an exception */
+	try {
+		XAieTxn Txn(Aie, 0);
+
+		RC = XAie_Write32(&DevInst, RegOff, 0x2U);
+		CHECK_EQUAL(RC, XAIE_OK);
+		throw std::runtime_error("txn test");
+	} catch (const std::runtime_error &) {
+		Thrown = true;
+	}
+	CHECK_EQUAL(Thrown, true);
+	CHECK_EQUAL(_XAie_TxnIsActive(&DevInst), XAIE_DISABLE);
+#ifndef TEST_HARDWARE
+	CHECK_EQUAL(Ring.NumWritten, 1);
+#endif
+
+	/* the writes are dropped by a scope created not to submit them */
+	{
+		XAieTxn Txn(Aie, 0, false);
+
+		RC = XAie_Write32(&DevInst, RegOff, 0x3U);
+		CHECK_EQUAL(RC, XAIE_OK);
+	}
+	CHECK_EQUAL(_XAie_TxnIsActive(&DevInst), XAIE_DISABLE);
+#ifndef TEST_HARDWARE
+	CHECK_EQUAL(Ring.NumWritten, 1);
+#endif
+
+	/* exported writes can be replayed after the scope is closed */
+	{
+		XAieTxn Txn(Aie, 0, false);
+
+		RC = XAie_Write32(&DevInst, RegOff, 0x4U);
+		CHECK_EQUAL(RC, XAIE_OK);
+		RC = Txn.exportTxn();
+		CHECK_EQUAL(RC, XAIE_OK);
+		CHECK(Txn.exported() != nullptr);
+		RC = Txn.cancel();
+		CHECK_EQUAL(RC, XAIE_OK);
+		RC = Txn.replay();
+		CHECK_EQUAL(RC, XAIE_OK);
+		RC = Txn.replay();
+		CHECK_EQUAL(RC, XAIE_OK);
+	}
+#ifndef TEST_HARDWARE
+	CHECK_EQUAL(Ring.NumWritten, 3);
+	CHECK_EQUAL(Records[2].Value, 0x4U);
+
+	RC = XAie_ConfigIORecord(&DevInst, NULL);
+	CHECK_EQUAL(RC, XAIE_OK);
+#endif
+}